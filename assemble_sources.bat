@@ -1 +1,2 @@
-python scripts/amalgamate.py -c scripts/config.json -s .
\ No newline at end of file
+python scripts/amalgamate.py -c scripts/config.json -s .
+python scripts/generate_module.py -i include/centurion.hpp -o include/centurion.cppm
\ No newline at end of file
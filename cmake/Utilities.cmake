@@ -9,6 +9,28 @@ function(add_header_only_lib name includeDirectory sources)
   target_include_directories(${name} SYSTEM INTERFACE ${includeDirectory})
 endfunction()
 
+# Creates an interface library target that precompiles a header for its consumers.
+#   name: the name of the library target.
+#   header: the header that will be precompiled.
+function(cen_add_precompiled_header name header)
+  add_library(${name} INTERFACE)
+
+  if (CMAKE_VERSION VERSION_LESS 3.16)
+    message(WARNING "Precompiled headers require CMake 3.16 or later!")
+  else ()
+    target_precompile_headers(${name} INTERFACE ${header})
+  endif ()
+endfunction()
+
+# Appends a CENTURION_NO_* definition to CEN_FEATURE_DEFINITIONS if an option is disabled.
+#   option: the name of the option that enables the feature.
+#   definition: the macro that excludes the feature from the headers.
+macro(cen_add_feature_definition option definition)
+  if (NOT ${option})
+    list(APPEND CEN_FEATURE_DEFINITIONS ${definition})
+  endif ()
+endmacro()
+
 # Checks if an environment variable is defined.
 #   envVar: the name of the actual environment variable.
 #   name: the name of the library associated with the environment variable.
@@ -117,4 +139,31 @@ function(cen_copy_runtime_binaries target)
       ${target}
       ${CEN_BINARIES_DIR}
       ${CMAKE_CURRENT_BINARY_DIR})
-endfunction()
\ No newline at end of file
+endfunction()
+
+# Prepares an interactive test for scripted runs, see test/interactive/scripted_session.hpp.
+# If CEN_SCRIPTED is enabled, a headless run is registered with CTest, which replays the
+# replay.txt file next to the test if there is one, and compares the results with the
+# baseline.txt file in the build directory, which is written by the first run.
+#   target: the associated target.
+#   ARGN: additional arguments of the scripted run, e.g. the video driver.
+function(cen_add_scripted_test target)
+  target_include_directories(${target} PRIVATE ${CEN_ROOT_DIR}/test/interactive)
+  target_compile_definitions(${target} PRIVATE CENTURION_ENABLE_RENDER_STATS)
+
+  if (CEN_SCRIPTED)
+    set(arguments
+        --headless
+        --frames ${CEN_SCRIPTED_FRAMES}
+        --baseline ${CMAKE_CURRENT_BINARY_DIR}/baseline.txt
+        --time-tolerance ${CEN_SCRIPTED_TIME_TOLERANCE})
+
+    if (EXISTS ${CMAKE_CURRENT_SOURCE_DIR}/replay.txt)
+      list(APPEND arguments --replay ${CMAKE_CURRENT_SOURCE_DIR}/replay.txt)
+    endif ()
+
+    add_test(NAME ${target}Scripted
+        COMMAND ${target} ${arguments} ${ARGN}
+        WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
+  endif ()
+endfunction()
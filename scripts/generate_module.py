@@ -0,0 +1,214 @@
+#!/usr/bin/env python
+# coding=utf-8
+
+# generate_module.py - Generates a C++20 module interface unit for the amalgamated header.
+#
+# The module includes the amalgamated header in its global module fragment, and exports
+# using-declarations for every public name at namespace scope. Declarations that are
+# guarded by preprocessor conditionals, e.g. version checks, are exported under the same
+# conditions. Macros, such as the CENTURION_* configuration macros, can't be exported by
+# modules, so they are only available by including the header.
+#
+# Usage: python scripts/generate_module.py [-i include/centurion.hpp] [-o include/centurion.cppm]
+
+from __future__ import print_function
+
+import argparse
+import collections
+import re
+
+namespace_pattern = re.compile(r"^namespace\s+([\w:]+)\s*\{")
+
+declaration_patterns = [
+    re.compile(r"^(?:template\s*<.*>\s*)?(?:class|struct|union)\s+"
+               r"(?:alignas\(\w+\)\s+)?(\w+)\b"),
+    re.compile(r"^enum(?:\s+class|\s+struct)?\s+(\w+)\b"),
+    re.compile(r"^(?:template\s*<.*>\s*)?using\s+(\w+)\s*="),
+    re.compile(r"^(?:\[\[\w+\]\]\s*)?(?:(?:inline|constexpr|extern)\s+)*"
+               r"(?:auto|void|bool|int)\s+(operator\s*(?:\"\"\s*\w+|[^\s(]+)|\w+)\s*\("),
+    re.compile(r"^inline\s+(?:constexpr\s+)?[\w:<>, ]+?\s(\w+)\s*(?:=|\{)"),
+]
+
+literal_pattern = re.compile(r"\"(?:\\.|[^\"\\])*\"|'(?:\\.|[^'\\])+'")
+
+
+class Condition(object):
+    def __init__(self, expression):
+        self.branches = [expression]
+        self.is_guard = False
+
+    # The expression of the currently active branch.
+    def current(self):
+        previous = ["!({0})".format(b) for b in self.branches[:-1]]
+        return " && ".join(previous + (["({0})".format(self.branches[-1])]
+                                       if self.branches[-1] != "1" else []))
+
+
+def strip_comments_and_literals(line, in_comment):
+    result = ""
+    i = 0
+    while i < len(line):
+        if in_comment:
+            end = line.find("*/", i)
+            if end == -1:
+                return result, True
+            i = end + 2
+            in_comment = False
+        elif line.startswith("//", i):
+            break
+        elif line.startswith("/*", i):
+            in_comment = True
+            i += 2
+        else:
+            result += line[i]
+            i += 1
+    return literal_pattern.sub("\"\"", result), in_comment
+
+
+def read_logical_lines(path):
+    with open(path, 'r') as f:
+        buffered = ""
+        for line in f:
+            line = line.rstrip("\n")
+            if line.endswith("\\"):
+                buffered += line[:-1] + " "
+                continue
+            yield buffered + line
+            buffered = ""
+
+
+def preprocessor_expression(directive, argument):
+    if directive == "ifdef":
+        return "defined({0})".format(argument)
+    elif directive == "ifndef":
+        return "!defined({0})".format(argument)
+    else:
+        return argument
+
+
+def collect_declarations(path):
+    declarations = collections.OrderedDict()
+
+    conditions = []
+    namespaces = []  # (name, brace depth at which the namespace body begins)
+    depth = 0
+    in_comment = False
+    pending_guard = None
+
+    for line in read_logical_lines(path):
+        stripped = line.strip()
+
+        directive = re.match(r"#\s*(\w+)\s*(.*)", stripped) if not in_comment else None
+        if directive:
+            name, argument = directive.group(1), directive.group(2).split("//")[0].strip()
+
+            if name in ("if", "ifdef", "ifndef"):
+                condition = Condition(preprocessor_expression(name, argument))
+                conditions.append(condition)
+                pending_guard = condition if name == "ifndef" else None
+            elif name == "elif":
+                conditions[-1].branches.append(argument)
+            elif name == "else":
+                conditions[-1].branches.append("1")
+            elif name == "endif":
+                conditions.pop()
+            elif name == "define" and pending_guard:
+                if argument.split()[0:1] == [pending_guard.branches[0][len("!defined("):-1]]:
+                    pending_guard.is_guard = True
+                pending_guard = None
+            continue
+
+        pending_guard = None
+        code, in_comment = strip_comments_and_literals(line, in_comment)
+
+        # Only declarations directly at namespace scope can be exported
+        scope = [n for n, _ in namespaces]
+        at_namespace_scope = namespaces and depth == namespaces[-1][1]
+        exported = at_namespace_scope and scope[0].split("::")[0] == "cen" and not any(
+            n in ("detail", "") or n.endswith("::detail") for n in scope)
+
+        match = namespace_pattern.match(code)
+        if match and exported or (match and not namespaces):
+            namespaces.append((match.group(1), depth + 1))
+        elif match:
+            namespaces.append(("detail", depth + 1))
+        elif exported and not code.startswith("static ") and not code.startswith(" "):
+            for pattern in declaration_patterns:
+                declaration = pattern.match(code)
+                if declaration:
+                    name = re.sub(r"\s+", "", declaration.group(1))
+                    if name.startswith("operator"):
+                        name = name.replace("operator\"\"", "operator\"\" ")
+                    expressions = []
+                    for c in conditions:
+                        if not c.is_guard and c.current() not in [""] + expressions:
+                            expressions.append(c.current())
+                    expression = " && ".join(expressions)
+                    key = ("::".join(scope), name, expression)
+                    declarations[key] = True
+                    break
+
+        for character in code:
+            if character == "{":
+                depth += 1
+            elif character == "}":
+                depth -= 1
+                while namespaces and depth < namespaces[-1][1]:
+                    namespaces.pop()
+
+    return declarations.keys()
+
+
+def generate(header, declarations):
+    lines = ["// This file was generated by scripts/generate_module.py, do not edit!",
+             "",
+             "module;",
+             "",
+             "#include \"{0}\"".format(header),
+             "",
+             "export module centurion;",
+             ""]
+
+    by_namespace = collections.OrderedDict()
+    for namespace, name, expression in declarations:
+        by_namespace.setdefault(namespace, []).append((name, expression))
+
+    for namespace, names in by_namespace.items():
+        lines.append("export namespace {0} {{".format(namespace))
+        active = ""
+        for name, expression in names:
+            if expression != active:
+                if active:
+                    lines.append("#endif")
+                if expression:
+                    lines.append("#if {0}".format(expression))
+                active = expression
+            lines.append("using ::{0}::{1};".format(namespace, name))
+        if active:
+            lines.append("#endif")
+        lines.append("}}  // namespace {0}".format(namespace))
+        lines.append("")
+
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate a C++20 module interface unit.")
+    parser.add_argument("-i", "--input", dest="input", default="include/centurion.hpp",
+                        metavar="", help="path to the amalgamated header")
+    parser.add_argument("-o", "--output", dest="output", default="include/centurion.cppm",
+                        metavar="", help="path of the generated module interface unit")
+    args = parser.parse_args()
+
+    declarations = collect_declarations(args.input)
+
+    header = args.input.split("/")[-1]
+    with open(args.output, 'w') as f:
+        f.write(generate(header, declarations))
+
+    print("Generated \"{0}\" with {1} exported names".format(args.output,
+                                                           len(declarations)))
+
+
+if __name__ == "__main__":
+    main()
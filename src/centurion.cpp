@@ -0,0 +1,64 @@
+// Explicit instantiations of the owner and handle class templates, which make up the
+// compiled library, see the CEN_COMPILED_LIBRARY CMake option.
+
+#include "everything.hpp"
+
+#ifndef CENTURION_COMPILED_LIBRARY
+#error "The compiled library must be built with CENTURION_COMPILED_LIBRARY defined!"
+#endif  // CENTURION_COMPILED_LIBRARY
+
+namespace cen {
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+template class basic_sound_effect<detail::owning_type>;
+template class basic_sound_effect<detail::handle_type>;
+
+#endif  // CENTURION_NO_SDL_MIXER
+
+template class basic_controller<detail::owning_type>;
+template class basic_controller<detail::handle_type>;
+
+#ifndef CENTURION_NO_HAPTIC
+
+template class basic_haptic<detail::owning_type>;
+template class basic_haptic<detail::handle_type>;
+
+#endif  // CENTURION_NO_HAPTIC
+
+template class basic_joystick<detail::owning_type>;
+template class basic_joystick<detail::handle_type>;
+
+#ifndef CENTURION_NO_SENSOR
+
+template class basic_sensor<detail::owning_type>;
+template class basic_sensor<detail::handle_type>;
+
+#endif  // CENTURION_NO_SENSOR
+
+template class basic_cursor<detail::owning_type>;
+template class basic_cursor<detail::handle_type>;
+
+template class basic_pixel_format_info<detail::owning_type>;
+template class basic_pixel_format_info<detail::handle_type>;
+
+template class basic_renderer<detail::owning_type>;
+template class basic_renderer<detail::handle_type>;
+
+template class basic_surface<detail::owning_type>;
+template class basic_surface<detail::handle_type>;
+
+template class basic_texture<detail::owning_type>;
+template class basic_texture<detail::handle_type>;
+
+template class basic_window<detail::owning_type>;
+template class basic_window<detail::handle_type>;
+
+#ifndef CENTURION_NO_OPENGL
+
+template class gl::basic_context<detail::owning_type>;
+template class gl::basic_context<detail::handle_type>;
+
+#endif  // CENTURION_NO_OPENGL
+
+}  // namespace cen
@@ -0,0 +1,26 @@
+#ifndef CENTURION_AUDIO_SUBSYSTEM_HEADER
+#define CENTURION_AUDIO_SUBSYSTEM_HEADER
+
+/**
+ * \file audio.hpp
+ *
+ * \brief Includes all headers of the audio subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "audio/audio_command_queue.hpp"
+#include "audio/channels.hpp"
+#include "audio/effect_chain.hpp"
+#include "audio/mixer_monitor.hpp"
+#include "audio/music.hpp"
+#include "audio/music_transition.hpp"
+#include "audio/sound_bank.hpp"
+#include "audio/sound_effect.hpp"
+#include "audio/sound_fonts.hpp"
+#include "audio/voice_pool.hpp"
+
+#endif  // CENTURION_AUDIO_SUBSYSTEM_HEADER
@@ -0,0 +1,450 @@
+#ifndef CENTURION_AUDIO_COMMAND_QUEUE_HEADER
+#define CENTURION_AUDIO_COMMAND_QUEUE_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <atomic>   // atomic, memory_order_...
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../detail/clamp.hpp"
+#include "../detail/max.hpp"
+#include "../thread/mpmc_queue.hpp"
+#include "channels.hpp"
+#include "sound_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class audio_command_queue
+ *
+ * \brief Gathers playback commands from any thread, and applies them on the audio thread.
+ *
+ * \details Functions such as `basic_sound_effect::play()` and `channels::expire()` lock
+ * the mixer, which is also locked while the audio is mixed, so calling them from
+ * gameplay threads can stall those threads for the duration of a mix. Instead, commands
+ * are pushed to a bounded lock-free queue, and applied in a batch by a post-mix effect
+ * that runs in the audio callback, where the mixer is already locked. Commands are
+ * applied after the current buffer has been mixed, i.e. before the next buffer is mixed.
+ * \code{cpp}
+ *   cen::audio_command_queue commands;
+ *   commands.attach();
+ *
+ *   // Any thread
+ *   commands.play(explosion);
+ *   commands.set_volume(3, 64);
+ * \endcode
+ *
+ * \note Sound effects must outlive the commands that refer to them. When a command is
+ * applied, the corresponding SDL_mixer function is called, so e.g. `play()` picks the
+ * first free channel when the command is applied, rather than when it is pushed.
+ *
+ * \since 6.1.0
+ */
+class audio_command_queue final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty command queue.
+   *
+   * \param capacity the maximum amount of pending commands, which is rounded up to the
+   * next power of two.
+   *
+   * \throws sdl_error if the queue can't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit audio_command_queue(const size_type capacity = 256) : m_commands{capacity}
+  {}
+
+  audio_command_queue(const audio_command_queue&) = delete;
+
+  auto operator=(const audio_command_queue&) -> audio_command_queue& = delete;
+
+  /**
+   * \brief Detaches the queue, if it's attached.
+   *
+   * \details Pending commands are discarded.
+   *
+   * \since 6.1.0
+   */
+  ~audio_command_queue() noexcept
+  {
+    detach();
+  }
+
+  /// \name Commands
+  /// \brief Functions that push commands, which return `false` if the queue is full.
+  /// \{
+
+  /**
+   * \brief Plays a sound effect, on the first available channel.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will be played, must outlive the command.
+   * \param nLoops the amount of loops, `sound_effect::forever` loops the sound until it's
+   * stopped.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto play(const basic_sound_effect<T>& sound, const int nLoops = 0) noexcept -> bool
+  {
+    return play(-1, sound, nLoops);
+  }
+
+  /**
+   * \brief Plays a sound effect on a specific channel.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param channel the channel that the sound will be played on, any playing sound on the
+   * channel is stopped.
+   * \param sound the sound effect that will be played, must outlive the command.
+   * \param nLoops the amount of loops, `sound_effect::forever` loops the sound until it's
+   * stopped.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto play(const channel_index channel,
+            const basic_sound_effect<T>& sound,
+            const int nLoops = 0) noexcept -> bool
+  {
+    const auto loops = detail::max(nLoops, basic_sound_effect<T>::forever);
+    return push(command_type::play, channel, loops, sound.get());
+  }
+
+  /**
+   * \brief Stops the playback of a channel.
+   *
+   * \param channel the channel that will be halted, -1 halts all channels.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto halt(const channel_index channel) noexcept -> bool
+  {
+    return push(command_type::halt, channel);
+  }
+
+  /**
+   * \brief Pauses a channel.
+   *
+   * \param channel the channel that will be paused, -1 pauses all channels.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto pause(const channel_index channel) noexcept -> bool
+  {
+    return push(command_type::pause, channel);
+  }
+
+  /**
+   * \brief Resumes a paused channel.
+   *
+   * \param channel the channel that will be resumed, -1 resumes all channels.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto resume(const channel_index channel) noexcept -> bool
+  {
+    return push(command_type::resume, channel);
+  }
+
+  /**
+   * \brief Sets the volume of a channel.
+   *
+   * \param channel the channel that will be affected, -1 affects all channels.
+   * \param volume the new volume, clamped to [0, `MIX_MAX_VOLUME`].
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto set_volume(const channel_index channel, const int volume) noexcept -> bool
+  {
+    return push(command_type::volume, channel, detail::clamp(volume, 0, MIX_MAX_VOLUME));
+  }
+
+  /**
+   * \brief Sets the volume of a sound effect.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will be affected, must outlive the command.
+   * \param volume the new volume, clamped to [0, `MIX_MAX_VOLUME`].
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto set_volume(const basic_sound_effect<T>& sound, const int volume) noexcept -> bool
+  {
+    const auto clamped = detail::clamp(volume, 0, MIX_MAX_VOLUME);
+    return push(command_type::sound_volume, -1, clamped, sound.get());
+  }
+
+  /**
+   * \brief Stops a channel after the specified amount of time.
+   *
+   * \param channel the channel that will be affected, -1 affects all channels.
+   * \param ms the time until the channel is stopped.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto expire(const channel_index channel,
+              const milliseconds<int> ms) noexcept(noexcept(ms.count())) -> bool
+  {
+    return push(command_type::expire, channel, ms.count());
+  }
+
+  /**
+   * \brief Fades out a channel over the specified amount of time.
+   *
+   * \param channel the channel that will be faded out, -1 fades out all channels.
+   * \param ms the duration of the fade.
+   *
+   * \return `true` if the command was pushed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto fade_out(const channel_index channel,
+                const milliseconds<int> ms) noexcept(noexcept(ms.count())) -> bool
+  {
+    return push(command_type::fade_out, channel, ms.count());
+  }
+
+  /// \} End of commands
+
+  /**
+   * \brief Registers the queue as a post-mix effect, which applies the pending commands.
+   *
+   * \return `success` if the queue was attached; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto attach() noexcept -> result
+  {
+    if (is_attached())
+    {
+      return failure;
+    }
+
+    m_attached.store(true, std::memory_order_release);
+    if (!Mix_RegisterEffect(MIX_CHANNEL_POST, &on_effect, &on_done, this))
+    {
+      m_attached.store(false, std::memory_order_release);
+      return failure;
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Unregisters the queue, if it's attached.
+   *
+   * \details Pending commands remain in the queue, and can be applied with `flush()`.
+   *
+   * \return `success` if the queue was detached; `failure` if it wasn't attached.
+   *
+   * \since 6.1.0
+   */
+  auto detach() noexcept -> result
+  {
+    if (!is_attached())
+    {
+      return failure;
+    }
+
+    // This invokes the done callback, which resets the attached flag
+    Mix_UnregisterEffect(MIX_CHANNEL_POST, &on_effect);
+    m_attached.store(false, std::memory_order_release);
+
+    return success;
+  }
+
+  /**
+   * \brief Applies the pending commands on the calling thread.
+   *
+   * \details This is what the registered effect does. Call this function if the queue
+   * isn't attached, e.g. when the audio device is paused.
+   *
+   * \return the amount of applied commands.
+   *
+   * \since 6.1.0
+   */
+  auto flush() noexcept -> size_type
+  {
+    size_type count = 0;
+
+    command cmd;
+    while (m_commands.try_pop(cmd))
+    {
+      apply(cmd);
+      ++count;
+    }
+
+    return count;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not the queue is registered with the mixer.
+   *
+   * \return `true` if the queue is attached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_attached() const noexcept -> bool
+  {
+    return m_attached.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns an approximation of the amount of pending commands.
+   *
+   * \return the approximate amount of pending commands.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size_approx() const noexcept -> size_type
+  {
+    return m_commands.size_approx();
+  }
+
+  /**
+   * \brief Returns the maximum amount of pending commands.
+   *
+   * \return the capacity of the queue.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_commands.capacity();
+  }
+
+  /// \} End of queries
+
+ private:
+  enum class command_type
+  {
+    play,
+    halt,
+    pause,
+    resume,
+    volume,
+    sound_volume,
+    expire,
+    fade_out
+  };
+
+  struct command final
+  {
+    command_type type{};
+    channel_index channel{};
+    int value{};  // The loops, the volume or the duration in milliseconds
+    Mix_Chunk* chunk{};
+  };
+
+  mpmc_queue<command> m_commands;
+  std::atomic<bool> m_attached{false};
+
+  auto push(const command_type type,
+            const channel_index channel,
+            const int value = 0,
+            Mix_Chunk* chunk = nullptr) noexcept -> bool
+  {
+    return m_commands.try_push(command{type, channel, value, chunk});
+  }
+
+  static void apply(const command& cmd) noexcept
+  {
+    switch (cmd.type)
+    {
+      case command_type::play:
+        Mix_PlayChannel(cmd.channel, cmd.chunk, cmd.value);
+        break;
+
+      case command_type::halt:
+        Mix_HaltChannel(cmd.channel);
+        break;
+
+      case command_type::pause:
+        Mix_Pause(cmd.channel);
+        break;
+
+      case command_type::resume:
+        Mix_Resume(cmd.channel);
+        break;
+
+      case command_type::volume:
+        Mix_Volume(cmd.channel, cmd.value);
+        break;
+
+      case command_type::sound_volume:
+        Mix_VolumeChunk(cmd.chunk, cmd.value);
+        break;
+
+      case command_type::expire:
+        Mix_ExpireChannel(cmd.channel, cmd.value);
+        break;
+
+      case command_type::fade_out:
+        Mix_FadeOutChannel(cmd.channel, cmd.value);
+        break;
+
+      default:
+        assert(false);
+        break;
+    }
+  }
+
+  // The mixer is locked by the audio callback, and the lock is recursive, so the
+  // commands don't block. Post-mix effects run after all channels have been mixed, so
+  // the channels can safely be modified here.
+  static void SDLCALL on_effect(int, void*, int, void* data) noexcept
+  {
+    static_cast<audio_command_queue*>(data)->flush();
+  }
+
+  // Invoked when the queue is unregistered, or when the mixer is closed
+  static void SDLCALL on_done(int, void* data) noexcept
+  {
+    auto* self = static_cast<audio_command_queue*>(data);
+    self->m_attached.store(false, std::memory_order_release);
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_AUDIO_COMMAND_QUEUE_HEADER
@@ -1,13 +1,21 @@
 #ifndef CENTURION_CHANNELS_HEADER
 #define CENTURION_CHANNELS_HEADER
 
+#ifndef CENTURION_NO_SDL_MIXER
+
 #include <SDL.h>
 #include <SDL_mixer.h>
 
+#include <cassert>   // assert
+#include <cstddef>   // size_t
 #include <optional>  // optional
+#include <vector>    // vector
 
+#include "../core/integers.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
+#include "../detail/spatial_kernels.hpp"
+#include "../math/vector3.hpp"
 
 namespace cen {
 
@@ -234,6 +242,257 @@ inline auto reset_group(const channel_index channel) noexcept -> result
 
 }  // namespace channels
 
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct spatial_listener
+ *
+ * \brief The position and orientation of the listener of positional audio.
+ *
+ * \see `spatializer`
+ *
+ * \since 6.1.0
+ */
+struct spatial_listener final
+{
+  vector3<float> position;                ///< The position of the listener.
+  vector3<float> right{1.0f, 0.0f, 0.0f};  ///< The normalized right vector.
+};
+
+/**
+ * \struct spatial_emitters
+ *
+ * \brief A view of the positions of sound emitters, stored as structure of arrays.
+ *
+ * \details The arrays must contain at least `count` elements. The emitter at each index
+ * is played on the channel at the same index in `channels`.
+ *
+ * \see `spatializer`
+ *
+ * \since 6.1.0
+ */
+struct spatial_emitters final
+{
+  const channel_index* channels{};  ///< The channels that the emitters are played on.
+  const float* x{};                 ///< The x-coordinates of the emitters.
+  const float* y{};                 ///< The y-coordinates of the emitters.
+  const float* z{};                 ///< The z-coordinates of the emitters.
+  std::size_t count{};              ///< The amount of emitters.
+};
+
+/**
+ * \class spatializer
+ *
+ * \brief Positions the channels of many sound emitters relative to a listener.
+ *
+ * \details The stereo panning and the distance attenuation of all emitters are computed
+ * in a single pass with SIMD kernels, where the panning has constant power. Only the
+ * channels whose values changed by more than a threshold since they were last set are
+ * updated with `Mix_SetPanning()` and `Mix_SetDistance()`, since each of those calls
+ * locks the mixer.
+ * \code{cpp}
+ *   cen::spatializer spatializer{50.0f};
+ *
+ *   // Every frame
+ *   const cen::spatial_emitters emitters{channels.data(),
+ *                                         xs.data(),
+ *                                         ys.data(),
+ *                                         zs.data(),
+ *                                         channels.size()};
+ *   spatializer.update(listener, emitters);
+ * \endcode
+ *
+ * \note SDL_mixer removes the positional effect of a channel when it stops playing, so
+ * `invalidate()` must be called when another sound is started on a channel.
+ *
+ * \since 6.1.0
+ */
+class spatializer final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a spatializer.
+   *
+   * \param range the distance at which emitters are the faintest, must be greater than
+   * zero.
+   * \param threshold the amount that a value must change by before a channel is updated,
+   * in the units of `Mix_SetPanning()` and `Mix_SetDistance()`.
+   *
+   * \since 6.1.0
+   */
+  explicit spatializer(const float range, const u8 threshold = 2) noexcept
+      : m_range{range}
+      , m_threshold{threshold}
+      , m_level{detail::get_simd_level()}
+  {
+    assert(range > 0);
+  }
+
+  /**
+   * \brief Updates the positional effects of the channels of emitters.
+   *
+   * \pre No channel may occur more than once among the emitters.
+   *
+   * \param listener the listener that the emitters are heard by.
+   * \param emitters the emitters that will be positioned.
+   *
+   * \return the amount of channels that were updated.
+   *
+   * \since 6.1.0
+   */
+  auto update(const spatial_listener& listener, const spatial_emitters& emitters)
+      -> size_type
+  {
+    if (m_left.size() < emitters.count)
+    {
+      m_left.resize(emitters.count);
+      m_right.resize(emitters.count);
+      m_distance.resize(emitters.count);
+    }
+
+    const detail::spatial_params params{listener.position.x,
+                                        listener.position.y,
+                                        listener.position.z,
+                                        listener.right.x,
+                                        listener.right.y,
+                                        listener.right.z,
+                                        1.0f / m_range};
+    const detail::spatial_output out{m_left.data(), m_right.data(), m_distance.data()};
+    detail::spatialize(m_level,
+                       params,
+                       emitters.x,
+                       emitters.y,
+                       emitters.z,
+                       out,
+                       emitters.count);
+
+    size_type updated = 0;
+    for (size_type index = 0; index < emitters.count; ++index)
+    {
+      const auto channel = emitters.channels[index];
+      assert(channel >= 0);
+
+      auto& state = state_of(channel);
+      if (state.valid && !exceeds(state.left, m_left[index]) &&
+          !exceeds(state.right, m_right[index]) &&
+          !exceeds(state.distance, m_distance[index]))
+      {
+        continue;
+      }
+
+      // A channel is updated again by the next call, if something went wrong
+      state.valid = Mix_SetPanning(channel, m_left[index], m_right[index]) != 0 &&
+                    Mix_SetDistance(channel, m_distance[index]) != 0;
+      if (state.valid)
+      {
+        state.left = m_left[index];
+        state.right = m_right[index];
+        state.distance = m_distance[index];
+        ++updated;
+      }
+    }
+
+    return updated;
+  }
+
+  /**
+   * \brief Forgets the values that were set for a channel, so that it's updated again.
+   *
+   * \param channel the channel that will be updated by the next call to `update()`.
+   *
+   * \since 6.1.0
+   */
+  void invalidate(const channel_index channel) noexcept
+  {
+    if (channel >= 0 && static_cast<size_type>(channel) < m_states.size())
+    {
+      m_states[static_cast<size_type>(channel)].valid = false;
+    }
+  }
+
+  /**
+   * \brief Forgets the values that were set for all channels.
+   *
+   * \since 6.1.0
+   */
+  void invalidate_all() noexcept
+  {
+    for (auto& state : m_states)
+    {
+      state.valid = false;
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the distance at which emitters are the faintest.
+   *
+   * \return the range of the emitters.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto range() const noexcept -> float
+  {
+    return m_range;
+  }
+
+  /**
+   * \brief Returns the amount that a value must change by before a channel is updated.
+   *
+   * \return the update threshold.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto threshold() const noexcept -> u8
+  {
+    return m_threshold;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct channel_state final
+  {
+    u8 left{};
+    u8 right{};
+    u8 distance{};
+    bool valid{};  // Whether the values have been set on the channel
+  };
+
+  std::vector<channel_state> m_states;  // Indexed by channel
+  std::vector<u8> m_left;
+  std::vector<u8> m_right;
+  std::vector<u8> m_distance;
+  float m_range{};
+  u8 m_threshold{};
+  detail::simd_level m_level{};
+
+  [[nodiscard]] auto state_of(const channel_index channel) -> channel_state&
+  {
+    const auto index = static_cast<size_type>(channel);
+    if (index >= m_states.size())
+    {
+      m_states.resize(index + 1);
+    }
+
+    return m_states[index];
+  }
+
+  [[nodiscard]] auto exceeds(const u8 previous, const u8 current) const noexcept -> bool
+  {
+    const auto delta = (previous > current) ? previous - current : current - previous;
+    return delta > m_threshold;
+  }
+};
+
+/// \} End of group audio
+
 }  // namespace cen
 
+#endif  // CENTURION_NO_SDL_MIXER
 #endif  // CENTURION_CHANNELS_HEADER
@@ -0,0 +1,456 @@
+#ifndef CENTURION_EFFECT_CHAIN_HEADER
+#define CENTURION_EFFECT_CHAIN_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <atomic>       // atomic, memory_order_...
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <type_traits>  // is_invocable_v
+#include <vector>       // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/sample_kernels.hpp"
+#include "channels.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct audio_block
+ *
+ * \brief A view of a block of interleaved floating-point samples, processed by effects.
+ *
+ * \details The samples are in the range [-1, 1), and are converted back to the format of
+ * the mixer with saturation, so effects don't have to clip their output.
+ *
+ * \see `effect_chain`
+ *
+ * \since 6.1.0
+ */
+struct audio_block final
+{
+  float* samples{};      ///< The interleaved samples of all channels.
+  std::size_t frames{};  ///< The amount of sample frames, i.e. samples per channel.
+  int channels{};        ///< The amount of interleaved audio channels, e.g. 2 for stereo.
+  int frequency{};       ///< The sample rate of the mixer.
+
+  /// Returns the total amount of samples in the block.
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return frames * static_cast<std::size_t>(channels);
+  }
+};
+
+/**
+ * \class gain_effect
+ *
+ * \brief An effect that scales the volume of the samples, e.g. to duck music under
+ * dialogue.
+ *
+ * \details The gain can be changed from any thread. Changes are applied gradually over
+ * the next processed block, which avoids audible clicks.
+ *
+ * \see `effect_chain`
+ *
+ * \since 6.1.0
+ */
+class gain_effect final
+{
+ public:
+  /**
+   * \brief Creates a gain effect.
+   *
+   * \param gain the initial gain, where 1 leaves the samples unchanged.
+   *
+   * \since 6.1.0
+   */
+  explicit gain_effect(const float gain = 1.0f) noexcept : m_target{gain}, m_current{gain}
+  {}
+
+  /**
+   * \brief Sets the gain that will be applied, which may be done from any thread.
+   *
+   * \param gain the new gain, where 1 leaves the samples unchanged.
+   *
+   * \since 6.1.0
+   */
+  void set_gain(const float gain) noexcept
+  {
+    m_target.store(gain, std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the gain that is applied once the current change has completed.
+   *
+   * \return the target gain.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto gain() const noexcept -> float
+  {
+    return m_target.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Applies the gain to a block of samples.
+   *
+   * \param block the block that will be processed.
+   *
+   * \since 6.1.0
+   */
+  void operator()(const audio_block& block) noexcept
+  {
+    const auto target = m_target.load(std::memory_order_relaxed);
+    const auto channels = static_cast<std::size_t>(block.channels);
+
+    if (target == m_current)
+    {
+      for (std::size_t index = 0, size = block.size(); index < size; ++index)
+      {
+        block.samples[index] *= target;
+      }
+    }
+    else if (block.frames != 0)
+    {
+      // The gain is interpolated over the block, towards the target
+      const auto step = (target - m_current) / static_cast<float>(block.frames);
+      for (std::size_t frame = 0; frame < block.frames; ++frame)
+      {
+        const auto gain = m_current + step * static_cast<float>(frame + 1);
+        for (std::size_t channel = 0; channel < channels; ++channel)
+        {
+          block.samples[frame * channels + channel] *= gain;
+        }
+      }
+
+      m_current = target;
+    }
+  }
+
+ private:
+  std::atomic<float> m_target;
+  float m_current;  // Only accessed by the audio thread
+};
+
+/**
+ * \class effect_chain
+ *
+ * \brief A sequence of effects that process the output of a channel, or the final mix.
+ *
+ * \details The chain is registered with `Mix_RegisterEffect()`, and converts the samples
+ * of the mixer to floating-point samples with SIMD kernels, so effects process whole
+ * blocks of samples instead of raw bytes. Nothing is allocated in the audio callback, a
+ * scratch buffer is allocated when the chain is attached, and longer streams are
+ * processed in several blocks.
+ * \code{cpp}
+ *   cen::gain_effect ducking;
+ *   auto equalizer = [](const cen::audio_block& block) noexcept {
+ *     // ...
+ *   };
+ *
+ *   cen::effect_chain chain;
+ *   chain.add(ducking);
+ *   chain.add(equalizer);
+ *
+ *   chain.attach_post_mix();
+ *
+ *   ducking.set_gain(0.3f);  // From the main thread
+ * \endcode
+ *
+ * \note Effects are invoked on the audio thread, must not block and must outlive the
+ * chain. Mixers with signed 16-bit and 32-bit floating-point samples are supported.
+ *
+ * \note SDL_mixer removes the effects of a channel when the channel stops playing, so a
+ * chain needs to be attached again for every sound played on a channel. A channel should
+ * not have more than one effect chain at a time.
+ *
+ * \since 6.1.0
+ */
+class effect_chain final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty effect chain.
+   *
+   * \param blockFrames the maximum amount of sample frames that effects process at a
+   * time, must be greater than zero.
+   *
+   * \since 6.1.0
+   */
+  explicit effect_chain(const size_type blockFrames = 4'096) : m_blockFrames{blockFrames}
+  {
+    assert(blockFrames > 0);
+  }
+
+  effect_chain(const effect_chain&) = delete;
+
+  auto operator=(const effect_chain&) -> effect_chain& = delete;
+
+  /**
+   * \brief Detaches the chain, if it's attached.
+   *
+   * \since 6.1.0
+   */
+  ~effect_chain() noexcept
+  {
+    detach();
+  }
+
+  /**
+   * \brief Appends an effect to the chain.
+   *
+   * \pre The chain must not be attached.
+   *
+   * \tparam Effect the type of the effect, invocable with `const audio_block&`.
+   *
+   * \param effect the effect, which is not copied and must outlive the chain.
+   *
+   * \since 6.1.0
+   */
+  template <typename Effect>
+  void add(Effect& effect)
+  {
+    static_assert(std::is_invocable_v<Effect&, const audio_block&>,
+                  "Effect must be invocable with const audio_block&!");
+    assert(!is_attached());
+
+    m_effects.push_back({&effect, [](void* object, const audio_block& block) noexcept {
+                           (*static_cast<Effect*>(object))(block);
+                         }});
+  }
+
+  /**
+   * \brief Queries the format of the mixer and allocates the scratch buffer.
+   *
+   * \details This is done by the `attach()` functions, but it must be done explicitly in
+   * order to use `apply()` without attaching the chain.
+   *
+   * \pre The chain must not be attached.
+   *
+   * \return `success` if the mixer is open and its format is supported; `failure`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto prepare() -> result
+  {
+    assert(!is_attached());
+
+    int frequency{};
+    u16 format{};
+    int channels{};
+    if (!Mix_QuerySpec(&frequency, &format, &channels) || channels <= 0)
+    {
+      return failure;
+    }
+
+    if (format != AUDIO_S16SYS && format != AUDIO_F32SYS)
+    {
+      return failure;
+    }
+
+    m_frequency = frequency;
+    m_format = format;
+    m_channels = channels;
+    m_level = detail::get_simd_level();
+
+    if (m_format == AUDIO_S16SYS)
+    {
+      m_scratch.resize(m_blockFrames * static_cast<size_type>(channels));
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Registers the chain as an effect of a channel.
+   *
+   * \param channel the channel whose output will be processed.
+   *
+   * \return `success` if the chain was attached; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto attach(const channel_index channel) -> result
+  {
+    if (is_attached() || !prepare())
+    {
+      return failure;
+    }
+
+    m_attached.store(true, std::memory_order_release);
+    if (!Mix_RegisterEffect(channel, &on_effect, &on_done, this))
+    {
+      m_attached.store(false, std::memory_order_release);
+      return failure;
+    }
+
+    m_channel = channel;
+    return success;
+  }
+
+  /**
+   * \brief Registers the chain as a post-mix effect, which processes the final mix.
+   *
+   * \return `success` if the chain was attached; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto attach_post_mix() -> result
+  {
+    return attach(MIX_CHANNEL_POST);
+  }
+
+  /**
+   * \brief Unregisters the chain, if it's attached.
+   *
+   * \return `success` if the chain was detached; `failure` if it wasn't attached.
+   *
+   * \since 6.1.0
+   */
+  auto detach() noexcept -> result
+  {
+    if (!is_attached())
+    {
+      return failure;
+    }
+
+    // This invokes the done callback, which resets the attached flag
+    Mix_UnregisterEffect(m_channel, &on_effect);
+    m_attached.store(false, std::memory_order_release);
+
+    return success;
+  }
+
+  /**
+   * \brief Processes a buffer of samples in the format of the mixer with the effects.
+   *
+   * \details This is what the registered effect does, which makes it possible to apply
+   * the chain to other streams as well, e.g. in a music hook.
+   *
+   * \pre `prepare()` must have succeeded, otherwise the samples aren't processed.
+   *
+   * \param stream the samples, in the format of the mixer.
+   * \param bytes the size of the buffer, in bytes.
+   *
+   * \since 6.1.0
+   */
+  void apply(void* stream, const size_type bytes) noexcept
+  {
+    assert(m_format == AUDIO_F32SYS || !m_scratch.empty());
+
+    if (m_format == AUDIO_F32SYS)
+    {
+      process(static_cast<float*>(stream), bytes / sizeof(float));
+      return;
+    }
+
+    // Without a scratch buffer, the loop below would never finish
+    if (m_scratch.empty())
+    {
+      return;
+    }
+
+    auto* samples = static_cast<i16*>(stream);
+    auto remaining = bytes / sizeof(i16);
+
+    while (remaining != 0)
+    {
+      const auto count = (remaining < m_scratch.size()) ? remaining : m_scratch.size();
+
+      detail::s16_to_float(m_level, samples, m_scratch.data(), count);
+      process(m_scratch.data(), count);
+      detail::float_to_s16(m_level, m_scratch.data(), samples, count);
+
+      samples += count;
+      remaining -= count;
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not the chain is registered with the mixer.
+   *
+   * \return `true` if the chain is attached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_attached() const noexcept -> bool
+  {
+    return m_attached.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of effects in the chain.
+   *
+   * \return the amount of effects.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_effects.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct effect_entry final
+  {
+    void* object{};
+    void (*process)(void*, const audio_block&) noexcept {};
+  };
+
+  std::vector<effect_entry> m_effects;
+  std::vector<float> m_scratch;
+  size_type m_blockFrames{};
+  detail::simd_level m_level{};
+  channel_index m_channel{};
+  int m_frequency{};
+  int m_channels{1};
+  u16 m_format{};
+  std::atomic<bool> m_attached{false};
+
+  void process(float* samples, const size_type count) noexcept
+  {
+    const auto channels = static_cast<size_type>(m_channels);
+    const audio_block block{samples, count / channels, m_channels, m_frequency};
+
+    for (const auto& effect : m_effects)
+    {
+      effect.process(effect.object, block);
+    }
+  }
+
+  static void SDLCALL on_effect(int, void* stream, const int length, void* data) noexcept
+  {
+    if (length > 0)
+    {
+      static_cast<effect_chain*>(data)->apply(stream, static_cast<size_type>(length));
+    }
+  }
+
+  // Invoked when the chain is unregistered, or when its channel stops playing
+  static void SDLCALL on_done(int, void* data) noexcept
+  {
+    static_cast<effect_chain*>(data)->m_attached.store(false, std::memory_order_release);
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_EFFECT_CHAIN_HEADER
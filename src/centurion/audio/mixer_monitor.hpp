@@ -0,0 +1,409 @@
+#ifndef CENTURION_MIXER_MONITOR_HEADER
+#define CENTURION_MIXER_MONITOR_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <atomic>   // atomic, memory_order_...
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../system/counter.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct mixer_stats
+ *
+ * \brief Statistics about the audio callbacks observed by a `mixer_monitor`.
+ *
+ * \since 6.1.0
+ */
+struct mixer_stats final
+{
+  u64 callbacks{};                         ///< The amount of mixed buffers.
+  u64 underruns{};                         ///< The amount of buffers that were late.
+  u32 buffer_frames{};                     ///< The sample frames in the last buffer.
+  milliseconds<double> buffer_duration{};  ///< The duration of the last buffer.
+  milliseconds<double> mean_interval{};    ///< The average time between callbacks.
+  milliseconds<double> max_interval{};     ///< The longest time between callbacks.
+  int active_channels{};                   ///< The playing channels in the last buffer.
+  int max_active_channels{};               ///< The most channels playing in a buffer.
+  float peak_level{};                      ///< The largest sample, 1 is full scale.
+  u64 clipped_samples{};                   ///< The amount of full-scale samples.
+
+  /**
+   * \brief Returns the average time between callbacks, relative to the buffer duration.
+   *
+   * \details Values close to one mean that the device is fed at its own pace, larger
+   * values mean that buffers were late, which is audible as crackling.
+   *
+   * \return the ratio of the mean interval to the buffer duration; zero if unknown.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto load() const noexcept -> double
+  {
+    return (buffer_duration.count() > 0) ? mean_interval / buffer_duration : 0.0;
+  }
+};
+
+/**
+ * \class mixer_monitor
+ *
+ * \brief Instruments the audio callback of the mixer, to diagnose crackling audio.
+ *
+ * \details The monitor is registered as a post-mix effect, so it observes every mixed
+ * buffer. It measures the time between callbacks, which is close to the duration of a
+ * buffer as long as the device is fed in time, and counts buffers that arrive later than
+ * a tolerance as underruns. It also records the amount of playing channels, and the peak
+ * level and clipping of the final mix.
+ * \code{cpp}
+ *   cen::mixer_monitor monitor;
+ *   monitor.attach();
+ *
+ *   // Later, on any thread
+ *   const auto stats = monitor.stats();
+ *   if (stats.underruns != 0) {
+ *     // Increase config::mixerChunkSize
+ *   }
+ * \endcode
+ *
+ * \note The statistics are updated by the audio thread, so a snapshot may combine values
+ * from two consecutive callbacks. Mixers with signed 16-bit and 32-bit floating-point
+ * samples are supported.
+ *
+ * \since 6.1.0
+ */
+class mixer_monitor final
+{
+ public:
+  /**
+   * \brief Creates a monitor.
+   *
+   * \param tolerance the time between callbacks, relative to the buffer duration, above
+   * which a buffer is counted as an underrun.
+   *
+   * \since 6.1.0
+   */
+  explicit mixer_monitor(const double tolerance = 1.5) noexcept
+      : m_tolerance{tolerance}
+      , m_frequency{static_cast<double>(counter::frequency())}
+  {
+    assert(tolerance > 0);
+  }
+
+  mixer_monitor(const mixer_monitor&) = delete;
+
+  auto operator=(const mixer_monitor&) -> mixer_monitor& = delete;
+
+  /**
+   * \brief Detaches the monitor, if it's attached.
+   *
+   * \since 6.1.0
+   */
+  ~mixer_monitor() noexcept
+  {
+    detach();
+  }
+
+  /**
+   * \brief Queries the format of the mixer.
+   *
+   * \details This is done by `attach()`, but it must be done explicitly in order to use
+   * `record()` without attaching the monitor.
+   *
+   * \pre The monitor must not be attached.
+   *
+   * \return `success` if the mixer is open and its format is supported; `failure`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto prepare() noexcept -> result
+  {
+    assert(!is_attached());
+
+    int frequency{};
+    u16 format{};
+    int channels{};
+    if (!Mix_QuerySpec(&frequency, &format, &channels) || frequency <= 0 || channels <= 0)
+    {
+      return failure;
+    }
+
+    if (format != AUDIO_S16SYS && format != AUDIO_F32SYS)
+    {
+      return failure;
+    }
+
+    m_sampleRate = frequency;
+    m_format = format;
+    m_channels = channels;
+    m_last.store(0, std::memory_order_relaxed);
+
+    return success;
+  }
+
+  /**
+   * \brief Registers the monitor as a post-mix effect.
+   *
+   * \details Effects that are registered after the monitor don't affect the observed
+   * peak level.
+   *
+   * \return `success` if the monitor was attached; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto attach() noexcept -> result
+  {
+    if (is_attached() || !prepare())
+    {
+      return failure;
+    }
+
+    m_attached.store(true, std::memory_order_release);
+    if (!Mix_RegisterEffect(MIX_CHANNEL_POST, &on_effect, &on_done, this))
+    {
+      m_attached.store(false, std::memory_order_release);
+      return failure;
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Unregisters the monitor, if it's attached.
+   *
+   * \return `success` if the monitor was detached; `failure` if it wasn't attached.
+   *
+   * \since 6.1.0
+   */
+  auto detach() noexcept -> result
+  {
+    if (!is_attached())
+    {
+      return failure;
+    }
+
+    // This invokes the done callback, which resets the attached flag
+    Mix_UnregisterEffect(MIX_CHANNEL_POST, &on_effect);
+    m_attached.store(false, std::memory_order_release);
+
+    return success;
+  }
+
+  /**
+   * \brief Records a mixed buffer.
+   *
+   * \details This is what the registered effect does, which makes it possible to
+   * instrument other audio callbacks as well.
+   *
+   * \pre `prepare()` must have succeeded.
+   *
+   * \param stream the mixed samples, in the format of the mixer.
+   * \param bytes the size of the buffer, in bytes.
+   * \param activeChannels the amount of playing channels.
+   *
+   * \since 6.1.0
+   */
+  void record(const void* stream,
+              const std::size_t bytes,
+              const int activeChannels) noexcept
+  {
+    const auto now = counter::now();
+    const auto sampleSize = (m_format == AUDIO_F32SYS) ? sizeof(float) : sizeof(i16);
+    const auto samples = bytes / sampleSize;
+    const auto frames = static_cast<u32>(samples / static_cast<std::size_t>(m_channels));
+
+    const auto bufferTicks = static_cast<double>(frames) * m_frequency / m_sampleRate;
+    if (const auto last = m_last.exchange(now, std::memory_order_relaxed); last != 0)
+    {
+      const auto interval = now - last;
+      m_intervalSum.fetch_add(interval, std::memory_order_relaxed);
+      m_intervals.fetch_add(1, std::memory_order_relaxed);
+
+      if (interval > m_maxInterval.load(std::memory_order_relaxed))
+      {
+        m_maxInterval.store(interval, std::memory_order_relaxed);
+      }
+
+      if (static_cast<double>(interval) > bufferTicks * m_tolerance)
+      {
+        m_underruns.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    float peak{};
+    u64 clipped{};
+    if (m_format == AUDIO_F32SYS)
+    {
+      const auto* values = static_cast<const float*>(stream);
+      for (std::size_t index = 0; index < samples; ++index)
+      {
+        const auto value = (values[index] < 0) ? -values[index] : values[index];
+        peak = (value > peak) ? value : peak;
+        clipped += (value >= 1.0f) ? 1u : 0u;
+      }
+    }
+    else
+    {
+      int max{};
+      const auto* values = static_cast<const i16*>(stream);
+      for (std::size_t index = 0; index < samples; ++index)
+      {
+        const auto value = (values[index] < 0) ? -values[index] : +values[index];
+        max = (value > max) ? value : max;
+        clipped += (value >= 32'767) ? 1u : 0u;
+      }
+
+      peak = static_cast<float>(max) / 32'768.0f;
+    }
+
+    if (peak > m_peak.load(std::memory_order_relaxed))
+    {
+      m_peak.store(peak, std::memory_order_relaxed);
+    }
+
+    if (activeChannels > m_maxActive.load(std::memory_order_relaxed))
+    {
+      m_maxActive.store(activeChannels, std::memory_order_relaxed);
+    }
+
+    m_clipped.fetch_add(clipped, std::memory_order_relaxed);
+    m_active.store(activeChannels, std::memory_order_relaxed);
+    m_bufferFrames.store(frames, std::memory_order_relaxed);
+    m_callbacks.fetch_add(1, std::memory_order_release);
+  }
+
+  /**
+   * \brief Resets the statistics.
+   *
+   * \note This function should not be called while the monitor is attached, since the
+   * audio thread might update the statistics at the same time.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_callbacks.store(0, std::memory_order_relaxed);
+    m_underruns.store(0, std::memory_order_relaxed);
+    m_intervals.store(0, std::memory_order_relaxed);
+    m_intervalSum.store(0, std::memory_order_relaxed);
+    m_maxInterval.store(0, std::memory_order_relaxed);
+    m_clipped.store(0, std::memory_order_relaxed);
+    m_maxActive.store(0, std::memory_order_relaxed);
+    m_peak.store(0, std::memory_order_relaxed);
+    m_last.store(0, std::memory_order_relaxed);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a snapshot of the statistics, which may be done from any thread.
+   *
+   * \return the current statistics.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> mixer_stats
+  {
+    mixer_stats result;
+    result.callbacks = m_callbacks.load(std::memory_order_acquire);
+    result.underruns = m_underruns.load(std::memory_order_relaxed);
+    result.buffer_frames = m_bufferFrames.load(std::memory_order_relaxed);
+    result.active_channels = m_active.load(std::memory_order_relaxed);
+    result.max_active_channels = m_maxActive.load(std::memory_order_relaxed);
+    result.peak_level = m_peak.load(std::memory_order_relaxed);
+    result.clipped_samples = m_clipped.load(std::memory_order_relaxed);
+
+    if (m_sampleRate > 0)
+    {
+      const auto frames = static_cast<double>(result.buffer_frames);
+      result.buffer_duration = milliseconds<double>{frames * 1'000.0 / m_sampleRate};
+    }
+
+    const auto intervals = m_intervals.load(std::memory_order_relaxed);
+    if (intervals != 0)
+    {
+      const auto sum = static_cast<double>(m_intervalSum.load(std::memory_order_relaxed));
+      result.mean_interval = to_milliseconds(sum / static_cast<double>(intervals));
+    }
+
+    const auto max = m_maxInterval.load(std::memory_order_relaxed);
+    result.max_interval = to_milliseconds(static_cast<double>(max));
+
+    return result;
+  }
+
+  /**
+   * \brief Indicates whether or not the monitor is registered with the mixer.
+   *
+   * \return `true` if the monitor is attached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_attached() const noexcept -> bool
+  {
+    return m_attached.load(std::memory_order_acquire);
+  }
+
+  /// \} End of queries
+
+ private:
+  double m_tolerance{};
+  double m_frequency{};  // Of the performance counter
+  double m_sampleRate{};
+  u16 m_format{};
+  int m_channels{1};
+
+  std::atomic<u64> m_last{0};  // The time of the previous callback, or 0
+  std::atomic<u64> m_callbacks{0};
+  std::atomic<u64> m_underruns{0};
+  std::atomic<u64> m_intervals{0};
+  std::atomic<u64> m_intervalSum{0};  // In counter ticks
+  std::atomic<u64> m_maxInterval{0};  // In counter ticks
+  std::atomic<u64> m_clipped{0};
+  std::atomic<u32> m_bufferFrames{0};
+  std::atomic<int> m_active{0};
+  std::atomic<int> m_maxActive{0};
+  std::atomic<float> m_peak{0};
+  std::atomic<bool> m_attached{false};
+
+  [[nodiscard]] auto to_milliseconds(const double ticks) const noexcept
+      -> milliseconds<double>
+  {
+    return milliseconds<double>{ticks * 1'000.0 / m_frequency};
+  }
+
+  static void SDLCALL on_effect(int, void* stream, const int length, void* data) noexcept
+  {
+    if (length > 0)
+    {
+      auto* self = static_cast<mixer_monitor*>(data);
+      self->record(stream, static_cast<std::size_t>(length), Mix_Playing(-1));
+    }
+  }
+
+  // Invoked when the monitor is unregistered, or when the mixer is closed
+  static void SDLCALL on_done(int, void* data) noexcept
+  {
+    static_cast<mixer_monitor*>(data)->m_attached.store(false, std::memory_order_release);
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_MIXER_MONITOR_HEADER
@@ -1,9 +1,12 @@
 #ifndef CENTURION_MUSIC_HEADER
 #define CENTURION_MUSIC_HEADER
 
+#ifndef CENTURION_NO_SDL_MIXER
+
 #include <SDL_mixer.h>
 
 #include <cassert>   // assert
+#include <cstddef>   // size_t
 #include <memory>    // unique_ptr
 #include <optional>  // optional
 #include <ostream>   // ostream
@@ -14,11 +17,11 @@
 #include "../core/not_null.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
-#include "../detail/address_of.hpp"
 #include "../detail/any_eq.hpp"
 #include "../detail/clamp.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/max.hpp"
-#include "../detail/to_string.hpp"
+#include "../filesystem/file.hpp"
 
 namespace cen {
 
@@ -130,6 +133,45 @@ class music final
   explicit music(const std::string& file) : music{file.c_str()}
   {}
 
+  /**
+   * \brief Creates a `music` instance based on the audio data read from a file.
+   *
+   * \details Music is decoded from the file while it is being played, so the instance
+   * claims ownership of the file and closes it when it is destroyed.
+   * The file is read on the audio thread, use `make_read_ahead_file()` to avoid blocking
+   * the audio thread on storage.
+   *
+   * \param source the file that the music will be read from, ownership is claimed.
+   *
+   * \throws mix_error if the music cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  explicit music(file&& source) : m_music{Mix_LoadMUS_RW(source.release(), 1)}
+  {
+    if (!m_music)
+    {
+      throw mix_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a `music` instance based on audio data stored in a block of memory.
+   *
+   * \details The memory isn't copied, and music is decoded from it while it is being
+   * played, so the memory must outlive the instance.
+   *
+   * \param data a pointer to the audio data, cannot be null.
+   * \param size the amount of bytes of audio data.
+   *
+   * \throws mix_error if the music cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  music(const not_null<const void*> data, const std::size_t size)
+      : music{file::from_memory(data, size)}
+  {}
+
   /// \} End of construction
 
   /// \name Playback functions
@@ -590,6 +632,25 @@ inline void on_music_finished(music_finished_callback callback) noexcept
 
 /// \} End of callbacks
 
+/**
+ * \brief Writes a textual representation of a `music` instance to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param music the instance that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer, const std::size_t size, const music& music) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("music{data: ", music.get(), ", volume: ", music::volume(), "}");
+}
+
 /**
  * \brief Returns a textual representation of a `music` instance.
  *
@@ -601,8 +662,7 @@ inline void on_music_finished(music_finished_callback callback) noexcept
  */
 [[nodiscard]] inline auto to_string(const music& music) -> std::string
 {
-  return "music{data: " + detail::address_of(music.get()) +
-         ", volume: " + detail::to_string(music::volume()).value() + "}";
+  return detail::format_string(music);
 }
 
 /**
@@ -720,4 +780,5 @@ inline auto operator<<(std::ostream& stream, const music& music) -> std::ostream
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_SDL_MIXER
 #endif  // CENTURION_MUSIC_HEADER
\ No newline at end of file
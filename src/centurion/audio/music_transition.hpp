@@ -0,0 +1,152 @@
+#ifndef CENTURION_MUSIC_TRANSITION_HEADER
+#define CENTURION_MUSIC_TRANSITION_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <cassert>  // assert
+
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../detail/max.hpp"
+#include "music.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class music_transition
+ *
+ * \brief Transitions between music tracks, by fading out the current track and then
+ * fading in the next one.
+ *
+ * \details Fading out the current track with `music::fade_out()` and starting the next
+ * one with `music::fade_in()` doesn't work, since starting a track halts the fading
+ * track immediately. A transition fades out the current track over the first half of
+ * its duration, and fades in the next track over the second half, as soon as the
+ * current track has stopped.
+ * \code{cpp}
+ *   cen::music_transition transition;
+ *   transition.start(battle, cen::milliseconds<int>{2'000}, cen::music::forever);
+ *
+ *   // In the game loop
+ *   transition.update();
+ * \endcode
+ *
+ * \note This is not a crossfade, the tracks never overlap, since SDL_mixer only mixes one
+ * music stream at a time. Overlapping tracks have to be played as sound effects on
+ * separate channels instead, which means that they are decoded up front.
+ *
+ * \note The next track is started by `update()`, which should be called every frame,
+ * rather than from the `Mix_HookMusicFinished()` callback. SDL_mixer invokes that
+ * callback while it's halting the music stream, where starting another track corrupts
+ * the state of the stream. Post-mix effects, which `audio_command_queue` uses, don't
+ * have this problem, since they run once all streams have been mixed.
+ *
+ * \since 6.1.0
+ */
+class music_transition final
+{
+ public:
+  /**
+   * \brief Starts a transition to another track.
+   *
+   * \details The next track is faded in immediately if no music is playing. A pending
+   * transition is replaced by the new one.
+   *
+   * \pre `duration` must be greater than zero.
+   *
+   * \param next the track that will be faded in, must outlive the transition.
+   * \param duration the total duration of the transition.
+   * \param nLoops the amount of times to loop the next track, `music::forever` loops the
+   * track until it's stopped.
+   *
+   * \return `success` if the transition was started; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto start(music& next,
+             const milliseconds<int> duration,
+             const int nLoops = 0) noexcept(noexcept(duration.count())) -> result
+  {
+    assert(duration.count() > 0);
+
+    m_next = nullptr;
+    if (!music::is_playing())
+    {
+      return next.fade_in(duration, nLoops);
+    }
+
+    const auto half = detail::max(duration.count() / 2, 1);
+
+    // A track that is fading in is faded out from its current volume
+    if (music::get_fade_status() != fade_status::out && !Mix_FadeOutMusic(half))
+    {
+      return failure;
+    }
+
+    m_next = &next;
+    m_fadeIn = milliseconds<int>{detail::max(duration.count() - half, 1)};
+    m_loops = nLoops;
+
+    return success;
+  }
+
+  /**
+   * \brief Fades in the next track, if the previous track has stopped.
+   *
+   * \return `success` if the next track was started; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update() noexcept -> result
+  {
+    if (!m_next || music::is_playing())
+    {
+      return failure;
+    }
+
+    auto* next = m_next;
+    m_next = nullptr;
+
+    return next->fade_in(m_fadeIn, m_loops);
+  }
+
+  /**
+   * \brief Cancels the pending transition, without affecting the current track.
+   *
+   * \since 6.1.0
+   */
+  void cancel() noexcept
+  {
+    m_next = nullptr;
+  }
+
+  /**
+   * \brief Indicates whether or not a track is waiting to be faded in.
+   *
+   * \return `true` if a transition is in progress; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_pending() const noexcept -> bool
+  {
+    return m_next != nullptr;
+  }
+
+ private:
+  music* m_next{};
+  milliseconds<int> m_fadeIn{};
+  int m_loops{};
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_MUSIC_TRANSITION_HEADER
@@ -0,0 +1,473 @@
+#ifndef CENTURION_SOUND_BANK_HEADER
+#define CENTURION_SOUND_BANK_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <cassert>        // assert
+#include <cstddef>        // size_t, byte
+#include <cstring>        // memcmp
+#include <memory>         // unique_ptr, make_unique
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map, unordered_multimap
+#include <utility>        // exchange, move
+#include <vector>         // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../filesystem/asset_pack.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/mapped_file.hpp"
+#include "sound_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \class sound_bank
+ *
+ * \brief Decodes sound effects once and shares them among all of their users.
+ *
+ * \details Each `sound_effect` decodes its own chunk, so loading the same sound for every
+ * instance of an entity decodes it over and over again. A sound bank decodes each sound
+ * once and hands out reference-counted `shared_sound` handles to the decoded chunk.
+ *
+ * Sounds are deduplicated by path, and by their encoded contents, so the same sound is
+ * only decoded once even if it's loaded through different paths, from an asset pack or
+ * from memory. The contents are looked up by means of a 64-bit hash, and sounds with the
+ * same hash are compared byte by byte, so a hash collision never shares the wrong sound.
+ * To that end, the bank keeps a copy of the encoded bytes of every sound.
+ * \code{cpp}
+ *   cen::sound_bank bank;
+ *
+ *   const auto hit = bank.load("sounds/hit.wav");
+ *   const auto same = bank.load(pack, "sounds/hit.wav");  // Not decoded again
+ *
+ *   hit.get().play();
+ * \endcode
+ *
+ * \details Sounds are kept after their last handle has been destroyed, so that they
+ * don't have to be decoded again if they're loaded later on. Call `trim()` to free the
+ * sounds that aren't referenced by any handle.
+ *
+ * \note The bank must outlive all of its handles, and handles must not be shared between
+ * threads.
+ *
+ * \since 6.1.0
+ */
+class sound_bank final
+{
+  struct entry;
+
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \class shared_sound
+   *
+   * \brief A reference-counted handle to a sound effect in a sound bank.
+   *
+   * \since 6.1.0
+   */
+  class shared_sound final
+  {
+   public:
+    /**
+     * \brief Creates an empty handle.
+     *
+     * \since 6.1.0
+     */
+    shared_sound() noexcept = default;
+
+    shared_sound(const shared_sound& other) noexcept : m_entry{other.m_entry}
+    {
+      acquire();
+    }
+
+    shared_sound(shared_sound&& other) noexcept
+        : m_entry{std::exchange(other.m_entry, nullptr)}
+    {}
+
+    auto operator=(const shared_sound& other) noexcept -> shared_sound&
+    {
+      if (this != &other)
+      {
+        release();
+        m_entry = other.m_entry;
+        acquire();
+      }
+
+      return *this;
+    }
+
+    auto operator=(shared_sound&& other) noexcept -> shared_sound&
+    {
+      if (this != &other)
+      {
+        release();
+        m_entry = std::exchange(other.m_entry, nullptr);
+      }
+
+      return *this;
+    }
+
+    ~shared_sound() noexcept
+    {
+      release();
+    }
+
+    /**
+     * \brief Returns a handle to the shared sound effect.
+     *
+     * \pre The handle must not be empty.
+     *
+     * \return a non-owning handle to the sound effect.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto get() const noexcept -> sound_effect_handle
+    {
+      assert(m_entry);
+      return sound_effect_handle{m_entry->sound};
+    }
+
+    /**
+     * \brief Returns the amount of handles to the sound effect.
+     *
+     * \return the amount of handles that share the sound effect; zero if this handle is
+     * empty.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto use_count() const noexcept -> size_type
+    {
+      return m_entry ? m_entry->references : 0;
+    }
+
+    /**
+     * \brief Indicates whether or not the handle refers to a sound effect.
+     *
+     * \return `true` if the handle isn't empty; `false` otherwise.
+     *
+     * \since 6.1.0
+     */
+    explicit operator bool() const noexcept
+    {
+      return m_entry != nullptr;
+    }
+
+    [[nodiscard]] auto operator==(const shared_sound& other) const noexcept -> bool
+    {
+      return m_entry == other.m_entry;
+    }
+
+    [[nodiscard]] auto operator!=(const shared_sound& other) const noexcept -> bool
+    {
+      return !(*this == other);
+    }
+
+   private:
+    friend class sound_bank;
+
+    entry* m_entry{};
+
+    explicit shared_sound(entry& shared) noexcept : m_entry{&shared}
+    {
+      acquire();
+    }
+
+    void acquire() noexcept
+    {
+      if (m_entry)
+      {
+        ++m_entry->references;
+      }
+    }
+
+    void release() noexcept
+    {
+      if (m_entry)
+      {
+        --m_entry->references;
+        m_entry = nullptr;
+      }
+    }
+  };
+
+  sound_bank() = default;
+
+  sound_bank(const sound_bank&) = delete;
+
+  auto operator=(const sound_bank&) -> sound_bank& = delete;
+
+  /// \name Loading
+  /// \{
+
+  /**
+   * \brief Loads the sound effect at the specified path.
+   *
+   * \details The file isn't accessed if the path has already been loaded.
+   *
+   * \param path the path of the audio file.
+   *
+   * \return a handle to the sound effect.
+   *
+   * \throws cen_error if the file can't be opened.
+   * \throws mix_error if the sound effect can't be decoded.
+   *
+   * \since 6.1.0
+   */
+  auto load(const std::string& path) -> shared_sound
+  {
+    if (const auto it = m_paths.find(path); it != m_paths.end())
+    {
+      return shared_sound{*it->second};
+    }
+
+    const mapped_file source{path};
+
+    auto& loaded = find_or_decode(source.data(), source.size());
+    loaded.paths.push_back(path);
+    m_paths.emplace(path, &loaded);
+
+    return shared_sound{loaded};
+  }
+
+  /**
+   * \brief Loads a sound effect from an asset pack.
+   *
+   * \details The encoded bytes are read from the memory of the pack, so no file is
+   * opened.
+   *
+   * \param pack the asset pack that contains the sound effect.
+   * \param name the name of the entry in the pack.
+   *
+   * \return a handle to the sound effect.
+   *
+   * \throws cen_error if there is no entry with the name.
+   * \throws mix_error if the sound effect can't be decoded.
+   *
+   * \since 6.1.0
+   */
+  auto load(const asset_pack& pack, const std::string_view name) -> shared_sound
+  {
+    const auto asset = pack.find(name);
+    if (!asset)
+    {
+      throw cen_error{"There is no asset pack entry with the specified name!"};
+    }
+
+    return shared_sound{find_or_decode(asset->data, asset->size)};
+  }
+
+  /**
+   * \brief Loads a sound effect from encoded bytes in memory.
+   *
+   * \details The bytes are only used while the sound effect is decoded.
+   *
+   * \param data the encoded sound effect, e.g. the contents of a WAV file.
+   * \param size the amount of bytes.
+   *
+   * \return a handle to the sound effect.
+   *
+   * \throws mix_error if the sound effect can't be decoded.
+   *
+   * \since 6.1.0
+   */
+  auto load(const not_null<const void*> data, const size_type size) -> shared_sound
+  {
+    assert(data);
+    return shared_sound{find_or_decode(data, size)};
+  }
+
+  /// \} End of loading
+
+  /**
+   * \brief Frees the sound effects that aren't referenced by any handle.
+   *
+   * \return the amount of freed sound effects.
+   *
+   * \since 6.1.0
+   */
+  auto trim() -> size_type
+  {
+    size_type freed = 0;
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+      auto& unused = **it;
+      if (unused.references != 0)
+      {
+        ++it;
+        continue;
+      }
+
+      for (const auto& path : unused.paths)
+      {
+        m_paths.erase(path);
+      }
+
+      const auto [first, last] = m_contents.equal_range(unused.hash);
+      for (auto content = first; content != last; ++content)
+      {
+        if (content->second == &unused)
+        {
+          m_contents.erase(content);
+          break;
+        }
+      }
+
+      it = m_entries.erase(it);
+      ++freed;
+    }
+
+    return freed;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not a path has been loaded.
+   *
+   * \param path the path of the audio file.
+   *
+   * \return `true` if the sound effect at the path is in the bank; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const std::string& path) const -> bool
+  {
+    return m_paths.find(path) != m_paths.end();
+  }
+
+  /**
+   * \brief Returns the amount of decoded sound effects in the bank.
+   *
+   * \return the amount of sound effects.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the bank is empty.
+   *
+   * \return `true` if there are no sound effects in the bank; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_entries.empty();
+  }
+
+  /**
+   * \brief Returns the amount of memory used by the decoded samples.
+   *
+   * \return the total amount of decoded bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto decoded_bytes() const noexcept -> size_type
+  {
+    size_type bytes = 0;
+    for (const auto& decoded : m_entries)
+    {
+      bytes += decoded->sound.get()->alen;
+    }
+
+    return bytes;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct entry final
+  {
+    entry(sound_effect&& decoded,
+          const u64 encodedHash,
+          const void* data,
+          const size_type size)
+        : sound{std::move(decoded)}
+        , hash{encodedHash}
+        , encoded(static_cast<const u8*>(data), static_cast<const u8*>(data) + size)
+    {}
+
+    [[nodiscard]] auto matches(const void* data, const size_type size) const noexcept
+        -> bool
+    {
+      return encoded.size() == size &&
+             (size == 0 || std::memcmp(encoded.data(), data, size) == 0);
+    }
+
+    sound_effect sound;
+    u64 hash{};               // Of the encoded bytes
+    std::vector<u8> encoded;  // Compared when the hashes are equal
+    size_type references{};
+    std::vector<std::string> paths;
+  };
+
+  // Entries are never moved, since handles refer to them
+  std::vector<std::unique_ptr<entry>> m_entries;
+  std::unordered_map<std::string, entry*> m_paths;
+  std::unordered_multimap<u64, entry*> m_contents;
+
+  [[nodiscard]] static auto content_hash(const void* data, const size_type size) noexcept
+      -> u64
+  {
+    const auto* bytes = static_cast<const u8*>(data);
+
+    u64 hash = 14'695'981'039'346'656'037u;
+    for (size_type index = 0; index < size; ++index)
+    {
+      hash ^= bytes[index];
+      hash *= 1'099'511'628'211u;
+    }
+
+    return hash;
+  }
+
+  auto find_or_decode(const void* data, const size_type size) -> entry&
+  {
+    const auto hash = content_hash(data, size);
+
+    const auto [first, last] = m_contents.equal_range(hash);
+    for (auto it = first; it != last; ++it)
+    {
+      if (it->second->matches(data, size))
+      {
+        return *it->second;
+      }
+    }
+
+    auto source = file::from_memory(data ? data : "", size);
+    if (!source)
+    {
+      throw mix_error{};
+    }
+
+    sound_effect sound{Mix_LoadWAV_RW(source.release(), 1)};
+
+    auto& decoded = *m_entries.emplace_back(
+        std::make_unique<entry>(std::move(sound), hash, data, size));
+    m_contents.emplace(hash, &decoded);
+
+    return decoded;
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_SOUND_BANK_HEADER
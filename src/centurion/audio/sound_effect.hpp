@@ -1,9 +1,12 @@
 #ifndef CENTURION_SOUND_EFFECT_HEADER
 #define CENTURION_SOUND_EFFECT_HEADER
 
+#ifndef CENTURION_NO_SDL_MIXER
+
 #include <SDL_mixer.h>
 
 #include <cassert>   // assert
+#include <cstddef>   // size_t
 #include <memory>    // unique_ptr
 #include <optional>  // optional
 #include <ostream>   // ostream
@@ -13,13 +16,14 @@
 #include "../core/exception.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
+#include "../core/resource_traits.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
-#include "../detail/address_of.hpp"
 #include "../detail/clamp.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/max.hpp"
 #include "../detail/owner_handle_api.hpp"
-#include "../detail/to_string.hpp"
+#include "../filesystem/file.hpp"
 
 namespace cen {
 
@@ -142,6 +146,50 @@ class basic_sound_effect final
   explicit basic_sound_effect(const std::string& file) : basic_sound_effect{file.c_str()}
   {}
 
+  /**
+   * \brief Creates a sound effect by decoding the audio read from a file.
+   *
+   * \details The audio is decoded from the current offset of the file, which is left
+   * open. The file is not needed after the sound effect has been created.
+   *
+   * \param source the file that the audio will be read from.
+   *
+   * \throws mix_error if the audio cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  explicit basic_sound_effect(file& source) : m_chunk{Mix_LoadWAV_RW(source.get(), 0)}
+  {
+    if (!m_chunk)
+    {
+      throw mix_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a sound effect by decoding the audio stored in a block of memory.
+   *
+   * \details The memory is decoded in place, without being copied first, and is not
+   * needed after the sound effect has been created.
+   *
+   * \param data a pointer to the encoded audio data, cannot be null.
+   * \param size the amount of bytes of encoded audio data.
+   *
+   * \throws mix_error if the audio cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  basic_sound_effect(const not_null<const void*> data, const std::size_t size)
+      : m_chunk{Mix_LoadWAV_RW(file::from_memory(data, size).release(), 1)}
+  {
+    if (!m_chunk)
+    {
+      throw mix_error{};
+    }
+  }
+
   /**
    * \brief Creates a sound effect handle to on an existing sound effect.
    *
@@ -473,6 +521,13 @@ class basic_sound_effect final
 #endif  // CENTURION_MOCK_FRIENDLY_MODE
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_sound_effect<detail::owning_type>;
+extern template class basic_sound_effect<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
 /**
  * \brief Returns a handle to the sound effect currently associated with the specified
  * channel.
@@ -491,6 +546,30 @@ class basic_sound_effect final
   return sound_effect_handle{Mix_GetChunk(channel)};
 }
 
+/**
+ * \brief Writes a textual representation of a sound effect to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param sound the sound effect that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer,
+                      const std::size_t size,
+                      const sound_effect& sound) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("sound_effect{data: ",
+                      sound.get(),
+                      ", volume: ",
+                      sound.volume(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a sound effect.
  *
@@ -502,8 +581,7 @@ class basic_sound_effect final
  */
 [[nodiscard]] inline auto to_string(const sound_effect& sound) -> std::string
 {
-  return "sound_effect{data: " + detail::address_of(sound.get()) +
-         ", volume: " + detail::to_string(sound.volume()).value() + "}";
+  return detail::format_string(sound);
 }
 
 /**
@@ -521,8 +599,33 @@ inline auto operator<<(std::ostream& stream, const sound_effect& sound) -> std::
   return stream << to_string(sound);
 }
 
+/**
+ * \brief Provides the memory usage of owning sound effects to resource managers.
+ *
+ * \since 6.1.0
+ */
+template <>
+struct resource_traits<sound_effect>
+{
+  [[nodiscard]] static auto bytes(const sound_effect& sound) noexcept -> std::size_t
+  {
+    return sound.get()->alen;
+  }
+
+  [[nodiscard]] static auto default_budget() noexcept -> std::size_t
+  {
+    return detail::default_resource_budget();
+  }
+
+  [[nodiscard]] static auto over_budget() -> bool
+  {
+    return false;
+  }
+};
+
 /// \} End of group audio
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_SDL_MIXER
 #endif  // CENTURION_SOUND_EFFECT_HEADER
@@ -0,0 +1,427 @@
+#ifndef CENTURION_VOICE_POOL_HEADER
+#define CENTURION_VOICE_POOL_HEADER
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+#include <SDL.h>
+#include <SDL_mixer.h>
+
+#include <cstddef>   // size_t
+#include <limits>    // numeric_limits
+#include <optional>  // optional
+#include <vector>    // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/max.hpp"
+#include "channels.hpp"
+#include "sound_effect.hpp"
+
+namespace cen {
+
+/// \addtogroup audio
+/// \{
+
+/**
+ * \struct voice
+ *
+ * \brief Identifies a sound that was started by a `voice_pool`.
+ *
+ * \details A voice remains associated with its channel until another sound is started on
+ * the same channel, after which the voice is considered to be stopped.
+ *
+ * \see `voice_pool`
+ *
+ * \since 6.1.0
+ */
+struct voice final
+{
+  channel_index channel{-1};  ///< The channel that the sound is played on.
+  u64 id{};                   ///< The unique identifier of the voice.
+};
+
+/**
+ * \class voice_pool
+ *
+ * \brief Plays sound effects on a fixed set of channels, stealing the least important
+ * voice when all channels are busy.
+ *
+ * \details Playing a sound with `basic_sound_effect::play()` fails when there is no free
+ * channel, so the sound is silently dropped. Instead, a voice pool keeps track of the
+ * priority, the category and the start order of each sound it plays. When there are no
+ * free channels, the sound with the lowest priority is stopped to make room for the new
+ * one, where the oldest sound is chosen among sounds with the same priority. A sound is
+ * only dropped if all playing sounds are more important.
+ *
+ * Categories can be limited to an amount of concurrent voices, e.g. to avoid that
+ * footsteps drown out everything else. When a category is at its limit, one of its own
+ * voices is stolen instead.
+ * \code{cpp}
+ *   enum category : cen::voice_pool::category_type { effects, footsteps };
+ *
+ *   cen::voice_pool pool{32};
+ *   pool.set_limit(footsteps, 8);
+ *
+ *   pool.play(step, footsteps);
+ *   pool.play(explosion, effects, 10);
+ * \endcode
+ *
+ * \note The pool assumes that it's the only user of its channels. Use
+ * `channels::reserve()` to prevent `basic_sound_effect::play()` from picking the channels
+ * of the pool, which start at channel zero by default.
+ *
+ * \since 6.1.0
+ */
+class voice_pool final
+{
+ public:
+  using size_type = std::size_t;
+  using category_type = std::size_t;
+  using priority_type = int;
+
+  /**
+   * \brief Indicates that a category has no voice limit.
+   *
+   * \since 6.1.0
+   */
+  inline constexpr static int unlimited = -1;
+
+  /**
+   * \brief Creates a voice pool that manages a range of channels.
+   *
+   * \details Additional channels are allocated if there are fewer than
+   * `first + count` channels.
+   *
+   * \param count the amount of channels that will be managed, must be greater than zero.
+   * \param first the index of the first managed channel.
+   *
+   * \throws cen_error if the channel range is invalid.
+   *
+   * \since 6.1.0
+   */
+  explicit voice_pool(const int count, const channel_index first = 0)
+      : m_first{first}
+  {
+    if (count <= 0 || first < 0)
+    {
+      throw cen_error{"Invalid voice pool channel range!"};
+    }
+
+    if (channels::allocate(-1) < first + count)
+    {
+      channels::allocate(first + count);
+    }
+
+    m_slots.resize(static_cast<size_type>(count));
+  }
+
+  /**
+   * \brief Plays a sound effect on a channel of the pool.
+   *
+   * \details A free channel is used if one is available and the category isn't at its
+   * limit, otherwise the least important voice of the pool or the category is stolen,
+   * unless it's more important than the new sound.
+   *
+   * \tparam T the ownership semantics of the sound effect.
+   *
+   * \param sound the sound effect that will be played.
+   * \param category the category of the sound.
+   * \param priority the priority of the sound, higher values are more important.
+   * \param nLoops the amount of times to loop the sound, `sound_effect::forever` loops
+   * the sound until it's stopped.
+   *
+   * \return the voice that plays the sound; `std::nullopt` if the sound was dropped or if
+   * it couldn't be played.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto play(const basic_sound_effect<T>& sound,
+            const category_type category = 0,
+            const priority_type priority = 0,
+            const int nLoops = 0) -> std::optional<voice>
+  {
+    if (limit(category) == 0)
+    {
+      return std::nullopt;
+    }
+
+    const auto limited = at_limit(category);
+
+    auto index = limited ? npos : find_free();
+    if (index == npos)
+    {
+      index = find_victim(limited, category, priority);
+      if (index == npos)
+      {
+        return std::nullopt;
+      }
+
+      Mix_HaltChannel(channel_of(index));
+    }
+
+    const auto channel = channel_of(index);
+    const auto loops = detail::max(nLoops, basic_sound_effect<T>::forever);
+    if (Mix_PlayChannel(channel, sound.get(), loops) == -1)
+    {
+      m_slots[index].active = false;
+      return std::nullopt;
+    }
+
+    auto& slot = m_slots[index];
+    slot.id = ++m_nextId;
+    slot.category = category;
+    slot.priority = priority;
+    slot.active = true;
+
+    return voice{channel, slot.id};
+  }
+
+  /**
+   * \brief Stops a voice.
+   *
+   * \param voice the voice that will be stopped.
+   *
+   * \return `true` if the voice was playing and has been stopped; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto stop(const voice& voice) noexcept -> bool
+  {
+    if (!is_playing(voice))
+    {
+      return false;
+    }
+
+    Mix_HaltChannel(voice.channel);
+    slot_of(voice).active = false;
+
+    return true;
+  }
+
+  /**
+   * \brief Stops all voices of the pool.
+   *
+   * \since 6.1.0
+   */
+  void stop_all() noexcept
+  {
+    for (size_type index = 0; index < m_slots.size(); ++index)
+    {
+      if (m_slots[index].active)
+      {
+        Mix_HaltChannel(channel_of(index));
+        m_slots[index].active = false;
+      }
+    }
+  }
+
+  /**
+   * \brief Sets the maximum amount of concurrent voices of a category.
+   *
+   * \param category the category that will be limited.
+   * \param limit the maximum amount of voices, or `unlimited`. A limit of zero mutes the
+   * category.
+   *
+   * \since 6.1.0
+   */
+  void set_limit(const category_type category, const int limit)
+  {
+    if (category >= m_limits.size())
+    {
+      m_limits.resize(category + 1, unlimited);
+    }
+
+    m_limits[category] = limit;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not a voice is still playing.
+   *
+   * \param voice the voice that will be checked.
+   *
+   * \return `true` if the voice is playing, or paused; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_playing(const voice& voice) const noexcept -> bool
+  {
+    if (voice.channel < m_first || voice.channel >= channel_of(m_slots.size()))
+    {
+      return false;
+    }
+
+    const auto& slot = slot_of(voice);
+    return slot.active && slot.id == voice.id && Mix_Playing(voice.channel);
+  }
+
+  /**
+   * \brief Returns the maximum amount of concurrent voices of a category.
+   *
+   * \param category the category that will be queried.
+   *
+   * \return the voice limit of the category, `unlimited` by default.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto limit(const category_type category) const noexcept -> int
+  {
+    return (category < m_limits.size()) ? m_limits[category] : unlimited;
+  }
+
+  /**
+   * \brief Returns the amount of voices of a category that are playing.
+   *
+   * \param category the category that will be queried.
+   *
+   * \return the amount of playing voices of the category.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto active_count(const category_type category) const noexcept
+      -> size_type
+  {
+    size_type count = 0;
+    for (size_type index = 0; index < m_slots.size(); ++index)
+    {
+      if (m_slots[index].category == category && is_active(index))
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Returns the amount of voices that are playing.
+   *
+   * \return the amount of playing voices.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto active_count() const noexcept -> size_type
+  {
+    size_type count = 0;
+    for (size_type index = 0; index < m_slots.size(); ++index)
+    {
+      if (is_active(index))
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Returns the amount of channels that are managed by the pool.
+   *
+   * \return the amount of channels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_slots.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct slot final
+  {
+    u64 id{};  // Increases with each started voice, so lower values are older voices
+    category_type category{};
+    priority_type priority{};
+    bool active{};
+  };
+
+  inline constexpr static auto npos = (std::numeric_limits<size_type>::max)();
+
+  std::vector<slot> m_slots;
+  std::vector<int> m_limits;
+  channel_index m_first{};
+  u64 m_nextId{};
+
+  [[nodiscard]] auto channel_of(const size_type index) const noexcept -> channel_index
+  {
+    return m_first + static_cast<channel_index>(index);
+  }
+
+  [[nodiscard]] auto slot_of(const voice& voice) noexcept -> slot&
+  {
+    return m_slots[static_cast<size_type>(voice.channel - m_first)];
+  }
+
+  [[nodiscard]] auto slot_of(const voice& voice) const noexcept -> const slot&
+  {
+    return m_slots[static_cast<size_type>(voice.channel - m_first)];
+  }
+
+  // Channels are also freed when their sounds end, which is detected lazily
+  [[nodiscard]] auto is_active(const size_type index) const noexcept -> bool
+  {
+    return m_slots[index].active && Mix_Playing(channel_of(index));
+  }
+
+  [[nodiscard]] auto at_limit(const category_type category) const noexcept -> bool
+  {
+    const auto max = limit(category);
+    return max != unlimited && active_count(category) >= static_cast<size_type>(max);
+  }
+
+  [[nodiscard]] auto find_free() const noexcept -> size_type
+  {
+    for (size_type index = 0; index < m_slots.size(); ++index)
+    {
+      if (!is_active(index))
+      {
+        return index;
+      }
+    }
+
+    return npos;
+  }
+
+  // Finds the least important voice, among the voices of the category if it's limited
+  [[nodiscard]] auto find_victim(const bool limited,
+                                 const category_type category,
+                                 const priority_type priority) const noexcept
+      -> size_type
+  {
+    auto victim = npos;
+    for (size_type index = 0; index < m_slots.size(); ++index)
+    {
+      const auto& candidate = m_slots[index];
+      if ((limited && candidate.category != category) || !is_active(index))
+      {
+        continue;
+      }
+
+      if (victim == npos || candidate.priority < m_slots[victim].priority ||
+          (candidate.priority == m_slots[victim].priority &&
+           candidate.id < m_slots[victim].id))
+      {
+        victim = index;
+      }
+    }
+
+    if (victim != npos && m_slots[victim].priority > priority)
+    {
+      return npos;  // Every candidate is more important than the new sound
+    }
+
+    return victim;
+  }
+};
+
+/// \} End of group audio
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_MIXER
+#endif  // CENTURION_VOICE_POOL_HEADER
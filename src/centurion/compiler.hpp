@@ -0,0 +1,17 @@
+#ifndef CENTURION_COMPILER_SUBSYSTEM_HEADER
+#define CENTURION_COMPILER_SUBSYSTEM_HEADER
+
+/**
+ * \file compiler.hpp
+ *
+ * \brief Includes all headers of the compiler subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "compiler/compiler.hpp"
+
+#endif  // CENTURION_COMPILER_SUBSYSTEM_HEADER
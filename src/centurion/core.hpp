@@ -0,0 +1,37 @@
+#ifndef CENTURION_CORE_SUBSYSTEM_HEADER
+#define CENTURION_CORE_SUBSYSTEM_HEADER
+
+/**
+ * \file core.hpp
+ *
+ * \brief Includes all headers of the core subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "core/macros.hpp"
+#include "core/async_log.hpp"
+#include "core/cast.hpp"
+#include "core/czstring.hpp"
+#include "core/delegate.hpp"
+#include "core/exception.hpp"
+#include "core/integers.hpp"
+#include "core/library.hpp"
+#include "core/log.hpp"
+#include "core/memory_functions.hpp"
+#include "core/memory_resource.hpp"
+#include "core/not_null.hpp"
+#include "core/owner.hpp"
+#include "core/resource_manager.hpp"
+#include "core/resource_traits.hpp"
+#include "core/result.hpp"
+#include "core/sdl_string.hpp"
+#include "core/sfinae.hpp"
+#include "core/time.hpp"
+#include "core/to_underlying.hpp"
+#include "core/version.hpp"
+
+#endif  // CENTURION_CORE_SUBSYSTEM_HEADER
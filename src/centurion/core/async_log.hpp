@@ -0,0 +1,756 @@
+#ifndef CENTURION_ASYNC_LOG_HEADER
+#define CENTURION_ASYNC_LOG_HEADER
+
+#include <SDL.h>
+
+#include <array>        // array
+#include <atomic>       // atomic, memory_order_...
+#include <cassert>      // assert
+#include <csignal>      // signal, raise, SIGABRT, SIGSEGV, ...
+#include <cstddef>      // size_t
+#include <memory>       // unique_ptr, make_unique
+#include <string_view>  // string_view
+#include <type_traits>  // enable_if_t
+#include <utility>      // forward, move
+
+#include "../detail/deferred_format.hpp"
+#include "../detail/format_writer.hpp"
+#include "../filesystem/file.hpp"
+#include "../thread/mpmc_queue.hpp"
+#include "../thread/semaphore.hpp"
+#include "../thread/thread.hpp"
+#include "czstring.hpp"
+#include "delegate.hpp"
+#include "log.hpp"
+#include "not_null.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \struct log_record
+ *
+ * \brief A pre-formatted log message, as handled by `async_log`.
+ *
+ * \details Records have a fixed size, so that they can be stored in a ring buffer without
+ * allocating any memory. Longer messages are truncated.
+ *
+ * \since 6.1.0
+ */
+struct log_record final
+{
+  /// The maximum amount of characters in a message, excluding the null-terminator.
+  inline static constexpr std::size_t max_length = 255;
+
+  log_priority priority{log_priority::info};  ///< The priority of the message.
+  log_category category{log_category::app};   ///< The category of the message.
+  std::size_t length{};                       ///< The amount of characters in the text.
+  std::array<char, max_length + 1> text{};    ///< The null-terminated message.
+
+  /**
+   * \brief Returns the message.
+   *
+   * \return a view of the text.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto message() const noexcept -> std::string_view
+  {
+    return {text.data(), length};
+  }
+};
+
+/**
+ * \enum log_overflow
+ *
+ * \brief Determines what happens to messages that are logged while the ring buffer of an
+ * `async_log` is full.
+ *
+ * \since 6.1.0
+ */
+enum class log_overflow
+{
+  drop,  ///< The message is discarded and counted, see `async_log::dropped()`.
+  block  ///< The logging thread waits until there is room in the ring buffer.
+};
+
+/// The signature of the functions that write the records of an `async_log`.
+using log_sink = delegate<void(const log_record&)>;
+
+/**
+ * \brief Returns a sink that writes records to the current SDL log output function.
+ *
+ * \details The output function is obtained when the sink is created, so the sink keeps
+ * writing to it if the SDL output is later captured by `async_log::capture_sdl_output()`.
+ *
+ * \return a sink that forwards records to the SDL log output function.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto sdl_log_sink() noexcept -> log_sink
+{
+  SDL_LogOutputFunction function{};
+  void* data{};
+  SDL_LogGetOutputFunction(&function, &data);
+
+  return [function, data](const log_record& record) {
+    if (function)
+    {
+      function(data,
+               static_cast<int>(record.category),
+               static_cast<SDL_LogPriority>(record.priority),
+               record.text.data());
+    }
+  };
+}
+
+/**
+ * \brief Returns a sink that writes records to a file, one line per record.
+ *
+ * \details Every line starts with the priority of the record, e.g. `"WARN: "`, like the
+ * default SDL output.
+ *
+ * \param file the file that will be written to, must outlive the sink.
+ *
+ * \return a sink that writes records to the file.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto file_log_sink(file& file) noexcept -> log_sink
+{
+  return [target = &file](const log_record& record) {
+    czstring prefix{};
+    switch (record.priority)
+    {
+      case log_priority::verbose:
+        prefix = "VERBOSE: ";
+        break;
+
+      case log_priority::debug:
+        prefix = "DEBUG: ";
+        break;
+
+      case log_priority::info:
+        prefix = "INFO: ";
+        break;
+
+      case log_priority::warn:
+        prefix = "WARN: ";
+        break;
+
+      case log_priority::error:
+        prefix = "ERROR: ";
+        break;
+
+      case log_priority::critical:
+        prefix = "CRITICAL: ";
+        break;
+
+      default:  // Priorities outside of the enumerators are written without a label
+        prefix = "";
+        break;
+    }
+
+    const std::string_view label{prefix};
+    target->write(label.data(), label.size());
+    target->write(record.text.data(), record.length);
+    target->write_byte('\n');
+  };
+}
+
+class async_log;
+
+/// \cond FALSE
+namespace detail {
+
+// The log that is drained by the crash handler, and the handlers that it replaced
+inline std::atomic<async_log*> crash_log{};
+inline constexpr std::array crash_signals = {SIGABRT, SIGSEGV, SIGFPE, SIGILL};
+inline std::array<void (*)(int), crash_signals.size()> previous_crash_handlers{};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class async_log
+ *
+ * \brief Writes log messages on a background thread, so that logging doesn't block the
+ * calling thread on console or file I/O.
+ *
+ * \details Messages are formatted on the calling thread into fixed-size records, which
+ * are pushed to a bounded lock-free ring buffer. A background thread drains the ring and
+ * hands the records to a sink, which by default writes to the SDL log output. Submitting
+ * a message never allocates memory. Messages with a priority that is disabled for their
+ * category are discarded before they are formatted.
+ * \code{cpp}
+ *   cen::async_log log;
+ *   log.capture_sdl_output();  // cen::log::info() etc. now go through the ring as well
+ *   log.install_crash_handler();
+ *
+ *   log.msg(cen::log_priority::info, cen::log_category::app, "Frame time: %f", ms);
+ * \endcode
+ *
+ * \note The sink and the crash handler must not log through the same `async_log` when
+ * the overflow policy is `log_overflow::block`, since that could block forever.
+ *
+ * \see `log_sink`
+ * \see `sdl_log_sink()`
+ * \see `file_log_sink()`
+ *
+ * \since 6.1.0
+ */
+class async_log final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates an asynchronous log and starts its background thread.
+   *
+   * \param sink the function that writes the records, which is only called by the
+   * background thread (and by the crash handler).
+   * \param capacity the maximum amount of pending records, rounded up to a power of two.
+   * \param overflow what happens to messages that are logged while the ring is full.
+   *
+   * \throws sdl_error if the background thread can't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit async_log(log_sink sink = sdl_log_sink(),
+                     const size_type capacity = 1'024,
+                     const log_overflow overflow = log_overflow::drop)
+      : m_sink{std::move(sink)}
+      , m_queue{capacity}
+      , m_overflow{overflow}
+  {
+    m_thread = std::make_unique<thread>(&async_log::run, "async-log", this);
+  }
+
+  async_log(const async_log&) = delete;
+
+  auto operator=(const async_log&) -> async_log& = delete;
+
+  /**
+   * \brief Writes all pending records and stops the background thread.
+   *
+   * \details The SDL output and the crash handler are released if they were claimed by
+   * this log.
+   *
+   * \since 6.1.0
+   */
+  ~async_log() noexcept
+  {
+    release_sdl_output();
+    uninstall_crash_handler();
+
+    m_queue.push(entry{entry_kind::stop});
+    m_thread->join();
+  }
+
+  /// \} End of construction/destruction
+
+  /// \name Logging
+  /// \{
+
+  /**
+   * \brief Formats a message with `printf` semantics and submits it.
+   *
+   * \tparam Args the types of the format arguments.
+   *
+   * \param priority the priority of the message.
+   * \param category the category of the message.
+   * \param fmt the format string, cannot be null.
+   * \param args the arguments used by the format string.
+   *
+   * \return `true` if the message was submitted or filtered out by its priority; `false`
+   * if it was dropped because the ring was full.
+   *
+   * \since 6.1.0
+   */
+  template <typename... Args>
+  auto msg(const log_priority priority,
+           const log_category category,
+           const not_null<czstring> fmt,
+           Args&&... args) noexcept -> bool
+  {
+    assert(fmt);
+
+    if (!is_enabled(priority, category))
+    {
+      return true;
+    }
+
+    entry item{entry_kind::record};
+    item.record.priority = priority;
+    item.record.category = category;
+
+    auto& text = item.record.text;
+    const auto length =
+        SDL_snprintf(text.data(), text.size(), fmt, std::forward<Args>(args)...);
+    item.record.length = clamp_length(length);
+
+    return submit(item);
+  }
+
+  /**
+   * \brief Submits a string.
+   *
+   * \param priority the priority of the message.
+   * \param category the category of the message.
+   * \param str the message.
+   *
+   * \return `true` if the message was submitted or filtered out by its priority; `false`
+   * if it was dropped because the ring was full.
+   *
+   * \since 6.1.0
+   */
+  auto put(const log_priority priority,
+           const log_category category,
+           const std::string_view str) noexcept -> bool
+  {
+    if (!is_enabled(priority, category))
+    {
+      return true;
+    }
+
+    entry item{entry_kind::record};
+    item.record.priority = priority;
+    item.record.category = category;
+
+    auto& text = item.record.text;
+    detail::format_writer writer{text.data(), text.size()};
+    item.record.length = clamp_length(writer.write(str));
+
+    return submit(item);
+  }
+
+  /**
+   * \brief Submits a textual representation of a value.
+   *
+   * \tparam T the type of the value, must provide a `format_to()` overload.
+   *
+   * \param priority the priority of the message.
+   * \param category the category of the message.
+   * \param value the value that will be logged.
+   *
+   * \return `true` if the message was submitted or filtered out by its priority; `false`
+   * if it was dropped because the ring was full.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, std::enable_if_t<detail::is_formattable_v<T>, int> = 0>
+  auto put(const log_priority priority,
+           const log_category category,
+           const T& value) noexcept -> bool
+  {
+    if (!is_enabled(priority, category))
+    {
+      return true;
+    }
+
+    entry item{entry_kind::record};
+    item.record.priority = priority;
+    item.record.category = category;
+
+    auto& text = item.record.text;
+    item.record.length = clamp_length(format_to(text.data(), text.size(), value));
+
+    return submit(item);
+  }
+
+  /**
+   * \brief Submits a message that is formatted by the background thread.
+   *
+   * \details Instead of the formatted text, the raw bytes of the arguments are stored in
+   * the ring along with the address of the format string, which makes this considerably
+   * cheaper than `msg()` for high-volume logging. Strings are copied, but they're
+   * truncated if the arguments don't fit in a record.
+   * \code{cpp}
+   *   log.defer(cen::log_priority::debug, cen::log_category::app, "%i: %f", id, value);
+   * \endcode
+   *
+   * \tparam Args the types of the format arguments, which must be numbers, strings or
+   * pointers.
+   *
+   * \param priority the priority of the message.
+   * \param category the category of the message.
+   * \param fmt the format string, must have static storage duration, e.g. a string
+   * literal.
+   * \param args the arguments used by the format string.
+   *
+   * \return `true` if the message was submitted or filtered out by its priority; `false`
+   * if it was dropped because the ring was full.
+   *
+   * \since 6.1.0
+   */
+  template <typename... Args>
+  auto defer(const log_priority priority,
+             const log_category category,
+             const not_null<czstring> fmt,
+             const Args&... args) noexcept -> bool
+  {
+    static_assert((detail::is_deferrable_v<Args> && ...),
+                  "Deferred arguments must be numbers, strings or pointers!");
+    static_assert(detail::deferred_min_size<Args...> <= log_record::max_length + 1,
+                  "Too many arguments for a deferred message!");
+    assert(fmt);
+
+    if (!is_enabled(priority, category))
+    {
+      return true;
+    }
+
+    entry item{entry_kind::deferred};
+    item.record.priority = priority;
+    item.record.category = category;
+    item.format = fmt;
+    item.formatter = &detail::format_arguments<detail::deferred_t<Args>...>;
+
+    auto& arguments = item.record.text;
+    item.record.length =
+        detail::encode_arguments(arguments.data(), arguments.size(), args...);
+
+    return submit(item);
+  }
+
+  /**
+   * \brief Blocks until all records that were submitted before the call have been
+   * written by the sink.
+   *
+   * \since 6.1.0
+   */
+  void flush()
+  {
+    semaphore done{0};
+
+    entry item{entry_kind::flush};
+    item.flushed = &done;
+
+    m_queue.push(item);
+    done.acquire();
+  }
+
+  /// \} End of logging
+
+  /// \name SDL output
+  /// \{
+
+  /**
+   * \brief Routes all messages logged through SDL through this log.
+   *
+   * \details This replaces the SDL log output function, so that `log::msg()`,
+   * `log::info()` and so on, as well as messages logged by SDL itself, are written by the
+   * background thread. The sink should have been created before the call, e.g. by
+   * `sdl_log_sink()`.
+   *
+   * \note SDL still formats the messages of `log::msg()` on the calling thread, in a
+   * buffer on the stack.
+   *
+   * \since 6.1.0
+   */
+  void capture_sdl_output() noexcept
+  {
+    if (!m_captured)
+    {
+      SDL_LogGetOutputFunction(&m_previousOutput, &m_previousData);
+      SDL_LogSetOutputFunction(&async_log::on_sdl_output, this);
+      m_captured = true;
+    }
+  }
+
+  /**
+   * \brief Restores the SDL log output function that was replaced by
+   * `capture_sdl_output()`.
+   *
+   * \details This function has no effect if the output hasn't been captured.
+   *
+   * \since 6.1.0
+   */
+  void release_sdl_output() noexcept
+  {
+    if (m_captured)
+    {
+      SDL_LogSetOutputFunction(m_previousOutput, m_previousData);
+      m_captured = false;
+    }
+  }
+
+  /// \} End of SDL output
+
+  /// \name Crash handling
+  /// \{
+
+  /**
+   * \brief Writes the pending records if the program crashes.
+   *
+   * \details This installs handlers for `SIGABRT`, `SIGSEGV`, `SIGFPE` and `SIGILL`,
+   * which drain the ring on the crashing thread before the default handler terminates the
+   * program. Uncaught exceptions end up in `std::abort()`, so they are handled as well.
+   * Only one log can be flushed on a crash at a time.
+   *
+   * \warning Writing log records isn't async-signal-safe, so this is a last resort that
+   * works in practice for the SDL and file sinks, but isn't guaranteed to.
+   *
+   * \return `true` if the handlers were installed; `false` if another log already
+   * installed them.
+   *
+   * \since 6.1.0
+   */
+  auto install_crash_handler() noexcept -> bool
+  {
+    async_log* expected = nullptr;
+    if (!detail::crash_log.compare_exchange_strong(expected, this))
+    {
+      return expected == this;
+    }
+
+    for (size_type index = 0; index < detail::crash_signals.size(); ++index)
+    {
+      const auto signal = detail::crash_signals[index];
+      const auto previous = std::signal(signal, &async_log::on_crash);
+      detail::previous_crash_handlers[index] = (previous != SIG_ERR) ? previous : nullptr;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Removes the crash handlers installed by `install_crash_handler()`.
+   *
+   * \details This function has no effect if the handlers weren't installed by this log.
+   *
+   * \since 6.1.0
+   */
+  void uninstall_crash_handler() noexcept
+  {
+    async_log* expected = this;
+    if (detail::crash_log.compare_exchange_strong(expected, nullptr))
+    {
+      for (size_type index = 0; index < detail::crash_signals.size(); ++index)
+      {
+        const auto previous = detail::previous_crash_handlers[index];
+        std::signal(detail::crash_signals[index], previous ? previous : SIG_DFL);
+      }
+    }
+  }
+
+  /**
+   * \brief Writes the pending records on the calling thread, without waiting for the
+   * background thread.
+   *
+   * \details This is used by the crash handler, but may also be called when the
+   * background thread might be stuck.
+   *
+   * \since 6.1.0
+   */
+  void drain() noexcept
+  {
+    entry item;
+    while (m_queue.try_pop(item))
+    {
+      process(item);
+    }
+  }
+
+  /// \} End of crash handling
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of messages that were dropped because the ring was full.
+   *
+   * \return the amount of dropped messages.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> size_type
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * \brief Returns the maximum amount of pending records.
+   *
+   * \return the capacity of the ring.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_queue.capacity();
+  }
+
+  /**
+   * \brief Returns the overflow policy of the log.
+   *
+   * \return what happens to messages that are logged while the ring is full.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto overflow() const noexcept -> log_overflow
+  {
+    return m_overflow;
+  }
+
+  /// \} End of queries
+
+ private:
+  enum class entry_kind
+  {
+    record,
+    deferred,
+    flush,
+    stop
+  };
+
+  struct entry final
+  {
+    entry() noexcept = default;
+
+    explicit entry(const entry_kind entryKind) noexcept : kind{entryKind}
+    {}
+
+    entry_kind kind{entry_kind::record};
+    log_record record;  // The text holds the arguments of deferred entries
+    czstring format{};
+    detail::deferred_formatter formatter{};
+    semaphore* flushed{};  // Released once a flush entry has been reached
+  };
+
+  log_sink m_sink;
+  mpmc_queue<entry> m_queue;
+  log_overflow m_overflow;
+  std::atomic<size_type> m_dropped{0};
+  std::unique_ptr<thread> m_thread;
+  SDL_LogOutputFunction m_previousOutput{};
+  void* m_previousData{};
+  bool m_captured{false};
+
+  [[nodiscard]] static auto is_enabled(const log_priority priority,
+                                       const log_category category) noexcept -> bool
+  {
+    const auto sdlCategory = static_cast<SDL_LogCategory>(category);
+    return log::is_compiled(priority) &&
+           static_cast<SDL_LogPriority>(priority) >= SDL_LogGetPriority(sdlCategory);
+  }
+
+  [[nodiscard]] static auto clamp_length(const int length) noexcept -> size_type
+  {
+    return (length > 0) ? clamp_length(static_cast<size_type>(length)) : 0u;
+  }
+
+  [[nodiscard]] static auto clamp_length(const size_type length) noexcept -> size_type
+  {
+    return (length < log_record::max_length) ? length : log_record::max_length;
+  }
+
+  auto submit(const entry& item) noexcept -> bool
+  {
+    if (m_overflow == log_overflow::block)
+    {
+      m_queue.push(item);
+      return true;
+    }
+    else if (m_queue.try_push(item))
+    {
+      return true;
+    }
+    else
+    {
+      m_dropped.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  // Returns false when the background thread should stop
+  auto process(const entry& item) noexcept -> bool
+  {
+    switch (item.kind)
+    {
+      case entry_kind::record:
+        m_sink(item.record);
+        return true;
+
+      case entry_kind::deferred: {
+        log_record record;
+        record.priority = item.record.priority;
+        record.category = item.record.category;
+
+        auto& text = record.text;
+        const auto* arguments = item.record.text.data();
+        const auto length =
+            item.formatter(item.format, arguments, text.data(), text.size());
+        record.length = clamp_length(length);
+
+        m_sink(record);
+        return true;
+      }
+
+      case entry_kind::flush:
+        item.flushed->release();
+        return true;
+
+      case entry_kind::stop:
+        return false;
+
+      default:
+        assert(false);
+        return false;
+    }
+  }
+
+  static auto run(void* data) -> int
+  {
+    auto* self = static_cast<async_log*>(data);
+
+    entry item;
+    do
+    {
+      self->m_queue.pop(item);
+    } while (self->process(item));
+
+    return 0;
+  }
+
+  static void on_sdl_output(void* data,
+                            const int category,
+                            const SDL_LogPriority priority,
+                            const char* message)
+  {
+    auto* self = static_cast<async_log*>(data);
+
+    // SDL has already filtered the message by its priority
+    entry item{entry_kind::record};
+    item.record.priority = static_cast<log_priority>(priority);
+    item.record.category = static_cast<log_category>(category);
+
+    auto& text = item.record.text;
+    detail::format_writer writer{text.data(), text.size()};
+    item.record.length = clamp_length(writer.write(message));
+
+    self->submit(item);
+  }
+
+  static void on_crash(const int signal)
+  {
+    if (auto* self = detail::crash_log.exchange(nullptr))
+    {
+      self->drain();
+    }
+
+    std::signal(signal, SIG_DFL);
+    std::raise(signal);
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_ASYNC_LOG_HEADER
@@ -0,0 +1,362 @@
+#ifndef CENTURION_DELEGATE_HEADER
+#define CENTURION_DELEGATE_HEADER
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t, max_align_t, nullptr_t
+#include <cstring>      // memcpy
+#include <functional>   // invoke
+#include <new>          // placement new
+#include <type_traits>  // decay_t, is_same_v, is_invocable_r_v, ...
+#include <utility>      // forward, move
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+template <typename Signature>
+class delegate;
+
+/**
+ * \class delegate
+ *
+ * \brief A copyable function wrapper that avoids heap allocations for small callables.
+ *
+ * \details This class is similar to `std::function`, but callables that fit in a small
+ * internal buffer, e.g. lambdas that capture a few references, are always stored inline.
+ * Free functions and member functions can be bound at compile-time with `from()`, which
+ * results in a direct call through a generated thunk, without any stored state apart
+ * from the object pointer.
+ *
+ * \details Callables that are larger than the internal buffer, or that might throw when
+ * moved, are stored on the heap, just like with `std::function`.
+ *
+ * \tparam R the return type.
+ * \tparam Args the parameter types.
+ *
+ * \since 6.1.0
+ */
+template <typename R, typename... Args>
+class delegate<R(Args...)> final
+{
+ public:
+  /// The size of the internal buffer, in bytes.
+  inline static constexpr std::size_t buffer_size = 3 * sizeof(void*);
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates an empty delegate.
+   *
+   * \since 6.1.0
+   */
+  delegate() noexcept = default;
+
+  /// \copydoc delegate()
+  delegate(std::nullptr_t) noexcept  // NOLINT implicit
+  {}
+
+  /**
+   * \brief Creates a delegate that stores a copy of a callable.
+   *
+   * \tparam T the type of the callable.
+   *
+   * \param callable the callable that will be stored.
+   *
+   * \since 6.1.0
+   */
+  template <typename T,
+            typename F = std::decay_t<T>,
+            typename = std::enable_if_t<!std::is_same_v<F, delegate> &&
+                                        std::is_invocable_r_v<R, F&, Args...>>>
+  delegate(T&& callable)  // NOLINT implicit, like std::function
+  {
+    emplace<F>(std::forward<T>(callable));
+  }
+
+  delegate(const delegate& other)
+      : m_invoke{other.m_invoke}
+      , m_manage{other.m_manage}
+      , m_allocated{other.m_allocated}
+  {
+    if (m_manage)
+    {
+      m_manage(operation::copy, m_buffer, const_cast<unsigned char*>(other.m_buffer));
+    }
+    else
+    {
+      std::memcpy(m_buffer, other.m_buffer, buffer_size);
+    }
+  }
+
+  delegate(delegate&& other) noexcept
+      : m_invoke{other.m_invoke}
+      , m_manage{other.m_manage}
+  {
+    move_from(other);
+  }
+
+  auto operator=(const delegate& other) -> delegate&
+  {
+    if (this != &other)
+    {
+      delegate copy{other};
+      *this = std::move(copy);
+    }
+
+    return *this;
+  }
+
+  auto operator=(delegate&& other) noexcept -> delegate&
+  {
+    if (this != &other)
+    {
+      reset();
+
+      m_invoke = other.m_invoke;
+      m_manage = other.m_manage;
+      move_from(other);
+    }
+
+    return *this;
+  }
+
+  auto operator=(std::nullptr_t) noexcept -> delegate&
+  {
+    reset();
+    return *this;
+  }
+
+  ~delegate() noexcept
+  {
+    reset();
+  }
+
+  /**
+   * \brief Creates a delegate that calls a free function.
+   *
+   * \tparam Function a pointer to the function that will be called.
+   *
+   * \return a delegate that calls the function.
+   *
+   * \since 6.1.0
+   */
+  template <auto Function>
+  [[nodiscard]] static auto from() noexcept -> delegate
+  {
+    static_assert(std::is_invocable_r_v<R, decltype(Function), Args...>,
+                  "Function must be invocable with the delegate parameters!");
+
+    delegate result;
+    result.m_invoke = [](void*, Args... args) -> R {
+      return static_cast<R>(std::invoke(Function, std::forward<Args>(args)...));
+    };
+
+    return result;
+  }
+
+  /**
+   * \brief Creates a delegate that calls a member function.
+   *
+   * \note The delegate does *not* take ownership of the supplied pointer.
+   *
+   * \tparam Member a pointer to the member function that will be called.
+   * \tparam Self the type of the object that owns the function.
+   *
+   * \param self a pointer to the object that the member function will be called on.
+   *
+   * \return a delegate that calls the member function.
+   *
+   * \since 6.1.0
+   */
+  template <auto Member, typename Self>
+  [[nodiscard]] static auto from(Self* self) noexcept -> delegate
+  {
+    static_assert(std::is_member_function_pointer_v<decltype(Member)>,
+                  "\"Member\" must be a member function pointer!");
+    static_assert(std::is_invocable_r_v<R, decltype(Member), Self*, Args...>,
+                  "Member function must be invocable with the delegate parameters!");
+
+    delegate result;
+    result.m_invoke = [](void* buffer, Args... args) -> R {
+      auto* object = *static_cast<Self**>(buffer);
+      return static_cast<R>(std::invoke(Member, object, std::forward<Args>(args)...));
+    };
+
+    ::new (static_cast<void*>(result.m_buffer)) Self*{self};
+    return result;
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Invokes the stored callable.
+   *
+   * \pre The delegate must not be empty.
+   *
+   * \param args the arguments that will be forwarded to the callable.
+   *
+   * \return the value returned by the callable.
+   *
+   * \since 6.1.0
+   */
+  auto operator()(Args... args) const -> R
+  {
+    assert(m_invoke);
+
+    // The callable may be mutable, just like with std::function
+    return m_invoke(const_cast<unsigned char*>(m_buffer), std::forward<Args>(args)...);
+  }
+
+  /**
+   * \brief Removes the stored callable.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    if (m_manage)
+    {
+      m_manage(operation::destroy, m_buffer, nullptr);
+    }
+
+    m_invoke = nullptr;
+    m_manage = nullptr;
+    m_allocated = false;
+  }
+
+  /**
+   * \brief Indicates whether or not the stored callable is allocated on the heap.
+   *
+   * \return `true` if the callable didn't fit in the internal buffer; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_allocated() const noexcept -> bool
+  {
+    return m_allocated;
+  }
+
+  /**
+   * \brief Indicates whether or not the delegate stores a callable.
+   *
+   * \return `true` if the delegate isn't empty; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return m_invoke != nullptr;
+  }
+
+ private:
+  enum class operation
+  {
+    copy,
+    move,
+    destroy
+  };
+
+  using invoke_fn = R (*)(void*, Args...);
+  using manage_fn = void (*)(operation, void*, void*);
+
+  template <typename T>
+  inline static constexpr bool is_inline_v =
+      sizeof(T) <= buffer_size && alignof(T) <= alignof(std::max_align_t) &&
+      std::is_nothrow_move_constructible_v<T>;
+
+  alignas(std::max_align_t) unsigned char m_buffer[buffer_size]{};
+  invoke_fn m_invoke{};
+  manage_fn m_manage{};  // Null if the buffer can be copied with memcpy
+  bool m_allocated{};
+
+  template <typename T, typename U>
+  void emplace(U&& callable)
+  {
+    static_assert(std::is_copy_constructible_v<T>, "Callable must be copyable!");
+
+    if constexpr (is_inline_v<T>)
+    {
+      ::new (static_cast<void*>(m_buffer)) T(std::forward<U>(callable));
+
+      m_invoke = [](void* buffer, Args... args) -> R {
+        return static_cast<R>(
+            std::invoke(*static_cast<T*>(buffer), std::forward<Args>(args)...));
+      };
+
+      if constexpr (!std::is_trivially_copyable_v<T>)
+      {
+        m_manage = [](const operation op, void* dst, void* src) {
+          switch (op)
+          {
+            case operation::copy:
+              ::new (dst) T(*static_cast<const T*>(src));
+              break;
+
+            case operation::move:
+              ::new (dst) T(std::move(*static_cast<T*>(src)));
+              static_cast<T*>(src)->~T();
+              break;
+
+            case operation::destroy:
+              static_cast<T*>(dst)->~T();
+              break;
+          }
+        };
+      }
+    }
+    else
+    {
+      ::new (static_cast<void*>(m_buffer)) T*{new T(std::forward<U>(callable))};
+      m_allocated = true;
+
+      m_invoke = [](void* buffer, Args... args) -> R {
+        return static_cast<R>(
+            std::invoke(**static_cast<T**>(buffer), std::forward<Args>(args)...));
+      };
+
+      m_manage = [](const operation op, void* dst, void* src) {
+        switch (op)
+        {
+          case operation::copy:
+            ::new (dst) T*{new T(**static_cast<T**>(src))};
+            break;
+
+          case operation::move:
+            ::new (dst) T*{*static_cast<T**>(src)};
+            break;
+
+          case operation::destroy:
+            delete *static_cast<T**>(dst);
+            break;
+        }
+      };
+    }
+  }
+
+  void move_from(delegate& other) noexcept
+  {
+    m_allocated = other.m_allocated;
+
+    if (m_manage)
+    {
+      m_manage(operation::move, m_buffer, other.m_buffer);
+    }
+    else
+    {
+      std::memcpy(m_buffer, other.m_buffer, buffer_size);
+    }
+
+    // The source no longer owns anything, so it must not destroy anything
+    other.m_invoke = nullptr;
+    other.m_manage = nullptr;
+    other.m_allocated = false;
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_DELEGATE_HEADER
@@ -35,15 +35,28 @@
 #define CENTURION_LIBRARY_HEADER
 
 #include <SDL.h>
+
+#ifndef CENTURION_NO_SDL_IMAGE
 #include <SDL_image.h>
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#ifndef CENTURION_NO_SDL_MIXER
 #include <SDL_mixer.h>
+#endif  // CENTURION_NO_SDL_MIXER
+
+#ifndef CENTURION_NO_SDL_TTF
 #include <SDL_ttf.h>
+#endif  // CENTURION_NO_SDL_TTF
 
 #include <cassert>   // assert
 #include <optional>  // optional
+#include <utility>   // pair
+#include <vector>    // vector
 
+#include "czstring.hpp"
 #include "exception.hpp"
 #include "integers.hpp"
+#include "time.hpp"
 
 /**
  * \namespace cen
@@ -60,7 +73,9 @@ namespace cen {
  *
  * \brief Used to specify how the library is initialized.
  *
- * \details All fields are initialized to the default values used by the library.
+ * \details All fields are initialized to the default values used by the library. The
+ * fields that configure an extension library that is disabled, e.g. with
+ * `CENTURION_NO_SDL_MIXER`, are ignored or absent.
  *
  * \since 4.0.0
  *
@@ -79,6 +94,10 @@ namespace cen {
  * \var config::coreFlags
  * Flags passed on to `SDL_Init()`, if \ref config.initCore is `true`.
  *
+ * \var config::deferredFlags
+ * Subsystems in \ref config.coreFlags that aren't initialized until they're requested
+ * with `library::require()`.
+ *
  * \var config::imageFlags
  * Flags passed on to `IMG_Init()`, if \ref config.initImage is `true`.
  *
@@ -96,6 +115,10 @@ namespace cen {
  *
  * \var config::mixerChunkSize
  * The chunk size used by SDL2_mixer, if \ref config.initMixer is `true`.
+ *
+ * \var config::deferMixer
+ * Indicates whether or not SDL2_mixer is initialized, and the audio device is opened,
+ * when requested with `library::require_mixer()` instead of up front.
  */
 struct config final
 {
@@ -105,9 +128,13 @@ struct config final
   bool initTTF{true};
 
   u32 coreFlags{SDL_INIT_EVERYTHING};
+  u32 deferredFlags{};
 
+#ifndef CENTURION_NO_SDL_IMAGE
   int imageFlags{IMG_INIT_PNG | IMG_INIT_JPG | IMG_INIT_TIF | IMG_INIT_WEBP};
+#endif  // CENTURION_NO_SDL_IMAGE
 
+#ifndef CENTURION_NO_SDL_MIXER
   int mixerFlags{MIX_INIT_MP3 | MIX_INIT_OGG | MIX_INIT_FLAC | MIX_INIT_MID |
                  MIX_INIT_MOD | MIX_INIT_OPUS};
 
@@ -115,6 +142,24 @@ struct config final
   u16 mixerFormat{MIX_DEFAULT_FORMAT};
   int mixerChannels{MIX_DEFAULT_CHANNELS};
   int mixerChunkSize{4096};
+  bool deferMixer{false};
+#endif  // CENTURION_NO_SDL_MIXER
+};
+
+/**
+ * \struct init_timing
+ *
+ * \brief Describes the time it took to initialize a part of the library.
+ *
+ * \see `library::timings()`
+ *
+ * \since 6.1.0
+ */
+struct init_timing final
+{
+  czstring name{};                  ///< The name of the part, e.g. "SDL_ttf".
+  u32 flags{};                      ///< The initialized SDL subsystems, if any.
+  milliseconds<double> duration{};  ///< The time spent initializing.
 };
 
 /**
@@ -136,6 +181,22 @@ struct config final
  *   }
  * \endcode
  *
+ * \details Opening the audio device and initializing some subsystems, e.g. the game
+ * controller subsystem, can take a considerable amount of time. Subsystems that aren't
+ * needed right away can be deferred with \ref config.deferredFlags and
+ * \ref config.deferMixer, and are then initialized on first use with `require()` and
+ * `require_mixer()`. The time spent initializing each part is reported by `timings()`.
+ * \code{cpp}
+ *   cen::config cfg;
+ *   cfg.deferredFlags = SDL_INIT_GAMECONTROLLER | SDL_INIT_HAPTIC | SDL_INIT_SENSOR;
+ *   cfg.deferMixer = true;
+ *
+ *   cen::library centurion{cfg};
+ *
+ *   // Later, when the options menu is opened
+ *   centurion.require(SDL_INIT_GAMECONTROLLER);
+ * \endcode
+ *
  * \note The signature of the main-method must be `ìnt(int, char**)` when
  * using the Centurion library!
  *
@@ -194,6 +255,104 @@ class library final
 
   auto operator=(library&&) -> library& = delete;
 
+  /// \name Deferred initialization
+  /// \{
+
+  /**
+   * \brief Initializes SDL subsystems, unless they're already initialized.
+   *
+   * \details Each subsystem is initialized separately, so that its initialization time
+   * is reported by `timings()`.
+   *
+   * \pre The SDL2 core must have been initialized by the library.
+   *
+   * \param flags the subsystems that will be initialized, e.g. `SDL_INIT_AUDIO`.
+   *
+   * \throws sdl_error if a subsystem can't be initialized.
+   *
+   * \see `SDL_InitSubSystem`
+   *
+   * \since 6.1.0
+   */
+  void require(const u32 flags)
+  {
+    assert(m_sdl);
+
+    for (const auto& [name, flag] : subsystems)
+    {
+      if ((flags & flag) && !is_initialized(flag))
+      {
+        const auto start = SDL_GetPerformanceCounter();
+        if (SDL_InitSubSystem(flag) < 0)
+        {
+          throw sdl_error{};
+        }
+
+        record(name, flag, start);
+      }
+    }
+  }
+
+#ifndef CENTURION_NO_SDL_MIXER
+
+  /**
+   * \brief Initializes SDL2_mixer and opens the audio device, unless it's already done.
+   *
+   * \details This function has no effect if \ref config.initMixer is `false`.
+   *
+   * \throws mix_error if the SDL2_mixer library can't be initialized.
+   *
+   * \since 6.1.0
+   */
+  void require_mixer()
+  {
+    if (m_cfg.initMixer && !m_mixer)
+    {
+      const auto start = SDL_GetPerformanceCounter();
+      m_mixer.emplace(m_cfg.mixerFlags,
+                      m_cfg.mixerFreq,
+                      m_cfg.mixerFormat,
+                      m_cfg.mixerChannels,
+                      m_cfg.mixerChunkSize);
+      record("SDL_mixer", 0, start);
+    }
+  }
+
+#endif  // CENTURION_NO_SDL_MIXER
+
+  /**
+   * \brief Indicates whether or not SDL subsystems are initialized.
+   *
+   * \param flags the subsystems that will be checked.
+   *
+   * \return `true` if all of the subsystems are initialized; `false` otherwise.
+   *
+   * \see `SDL_WasInit`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto is_initialized(const u32 flags) noexcept -> bool
+  {
+    return SDL_WasInit(flags) == flags;
+  }
+
+  /**
+   * \brief Returns the time spent initializing the parts of the library.
+   *
+   * \details The entries are in the order of initialization, including the parts that
+   * were initialized later with `require()` or `require_mixer()`.
+   *
+   * \return the initialization timings.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto timings() const noexcept -> const std::vector<init_timing>&
+  {
+    return m_timings;
+  }
+
+  /// \} End of deferred initialization
+
  private:
   struct sdl final
   {
@@ -211,6 +370,8 @@ class library final
     }
   };
 
+#ifndef CENTURION_NO_SDL_TTF
+
   struct sdl_ttf final
   {
     explicit sdl_ttf()
@@ -227,6 +388,10 @@ class library final
     }
   };
 
+#endif  // CENTURION_NO_SDL_TTF
+
+#ifndef CENTURION_NO_SDL_MIXER
+
   struct sdl_mixer final
   {
     sdl_mixer(const int flags,
@@ -253,6 +418,10 @@ class library final
     }
   };
 
+#endif  // CENTURION_NO_SDL_MIXER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
   struct sdl_image final
   {
     explicit sdl_image(const int flags)
@@ -269,37 +438,78 @@ class library final
     }
   };
 
+#endif  // CENTURION_NO_SDL_IMAGE
+
+  // The subsystems that can be initialized individually, in order of initialization
+  inline static constexpr std::pair<czstring, u32> subsystems[] = {
+      {"timer", SDL_INIT_TIMER},
+      {"audio", SDL_INIT_AUDIO},
+      {"video", SDL_INIT_VIDEO},
+      {"joystick", SDL_INIT_JOYSTICK},
+      {"haptic", SDL_INIT_HAPTIC},
+      {"game controller", SDL_INIT_GAMECONTROLLER},
+      {"events", SDL_INIT_EVENTS},
+      {"sensor", SDL_INIT_SENSOR}};
+
   config m_cfg;
+  std::vector<init_timing> m_timings;
   std::optional<sdl> m_sdl;
+
+#ifndef CENTURION_NO_SDL_IMAGE
   std::optional<sdl_image> m_img;
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#ifndef CENTURION_NO_SDL_TTF
   std::optional<sdl_ttf> m_ttf;
+#endif  // CENTURION_NO_SDL_TTF
+
+#ifndef CENTURION_NO_SDL_MIXER
   std::optional<sdl_mixer> m_mixer;
+#endif  // CENTURION_NO_SDL_MIXER
+
+  void record(const czstring name, const u32 flags, const u64 start)
+  {
+    const auto ticks = SDL_GetPerformanceCounter() - start;
+    const auto freq = SDL_GetPerformanceFrequency();
+    const milliseconds<double> duration{1'000.0 * static_cast<double>(ticks) /
+                                        static_cast<double>(freq)};
+    m_timings.push_back({name, flags, duration});
+  }
 
   void init()
   {
     if (m_cfg.initCore)
     {
-      m_sdl.emplace(m_cfg.coreFlags);
+      const auto flags = m_cfg.coreFlags & ~m_cfg.deferredFlags;
+      const auto start = SDL_GetPerformanceCounter();
+      m_sdl.emplace(flags);
+      record("SDL", flags, start);
     }
 
+#ifndef CENTURION_NO_SDL_IMAGE
     if (m_cfg.initImage)
     {
+      const auto start = SDL_GetPerformanceCounter();
       m_img.emplace(m_cfg.imageFlags);
+      record("SDL_image", 0, start);
     }
+#endif  // CENTURION_NO_SDL_IMAGE
 
+#ifndef CENTURION_NO_SDL_TTF
     if (m_cfg.initTTF)
     {
+      const auto start = SDL_GetPerformanceCounter();
       m_ttf.emplace();
+      record("SDL_ttf", 0, start);
     }
+#endif  // CENTURION_NO_SDL_TTF
 
-    if (m_cfg.initMixer)
+#ifndef CENTURION_NO_SDL_MIXER
+    if (!m_cfg.deferMixer)
     {
-      m_mixer.emplace(m_cfg.mixerFlags,
-                      m_cfg.mixerFreq,
-                      m_cfg.mixerFormat,
-                      m_cfg.mixerChannels,
-                      m_cfg.mixerChunkSize);
+      require_mixer();
     }
+#endif  // CENTURION_NO_SDL_MIXER
   }
 };
 
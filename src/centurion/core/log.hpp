@@ -3,10 +3,13 @@
 
 #include <SDL.h>
 
-#include <cassert>  // assert
-#include <string>   // string
-#include <utility>  // forward
+#include <array>        // array
+#include <cassert>      // assert
+#include <string>       // string
+#include <type_traits>  // enable_if_t
+#include <utility>      // forward
 
+#include "../detail/format_writer.hpp"
 #include "czstring.hpp"
 #include "macros.hpp"
 #include "not_null.hpp"
@@ -19,6 +22,32 @@ using SDL_LogCategory = decltype(SDL_LOG_CATEGORY_APPLICATION);
 
 #endif  // CENTURION_SDL_VERSION_IS(2, 0, 10)
 
+/// \addtogroup core
+/// \{
+
+#ifndef CENTURION_LOG_MIN_PRIORITY
+
+/**
+ * \def CENTURION_LOG_MIN_PRIORITY
+ *
+ * \brief The lowest log priority that is compiled into the program.
+ *
+ * \details Define this macro as one of the `SDL_LogPriority` values before including the
+ * library to remove all logging with lower priorities at compile-time, e.g.
+ * `-DCENTURION_LOG_MIN_PRIORITY=SDL_LOG_PRIORITY_INFO` removes verbose and debug logging
+ * from release builds. The default value doesn't remove anything.
+ *
+ * \see `log::is_compiled()`
+ * \see `CENTURION_LOG`
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_LOG_MIN_PRIORITY SDL_LOG_PRIORITY_VERBOSE
+
+#endif  // CENTURION_LOG_MIN_PRIORITY
+
+/// \} End of group core
+
 namespace cen {
 
 /// \addtogroup core
@@ -68,6 +97,19 @@ enum class log_category : int
 
 /// \} End of group core
 
+/// \cond FALSE
+namespace detail {
+
+// Used to format the values passed to log::put(), so that logging doesn't allocate
+[[nodiscard]] inline auto log_buffer() noexcept -> std::array<char, SDL_MAX_LOG_MESSAGE>&
+{
+  thread_local std::array<char, SDL_MAX_LOG_MESSAGE> buffer;
+  return buffer;
+}
+
+}  // namespace detail
+/// \endcond
+
 /**
  * \namespace cen::log
  *
@@ -85,12 +127,43 @@ namespace log {
 /// \addtogroup core
 /// \{
 
+/**
+ * \brief The lowest priority that is compiled into the program.
+ *
+ * \see `CENTURION_LOG_MIN_PRIORITY`
+ *
+ * \since 6.1.0
+ */
+inline constexpr log_priority min_priority =
+    static_cast<log_priority>(CENTURION_LOG_MIN_PRIORITY);
+
+/**
+ * \brief Indicates whether or not messages with a priority are compiled into the program.
+ *
+ * \details Logging with priorities below `min_priority` compiles to nothing, no matter
+ * what the runtime priorities of the categories are.
+ *
+ * \param priority the priority that will be checked.
+ *
+ * \return `true` if messages with the priority can be logged; `false` otherwise.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] constexpr auto is_compiled(const log_priority priority) noexcept -> bool
+{
+  return to_underlying(priority) >= to_underlying(min_priority);
+}
+
 /**
  * \brief Logs a message with the specified priority and category.
  *
  * \details This method has no effect if the supplied string is null. Usage of this method
  * is quite bulky, so refer to the other logging methods for casual logging.
  *
+ * \details The priority is only known at runtime, so priorities that are removed at
+ * compile-time are discarded by a check on every call. Use `msg<Priority>()` when the
+ * priority is a constant.
+ *
  * \tparam Args the types of the arguments that will be used in the formatted string.
  *
  * \param priority the priority that will be used.
@@ -107,9 +180,41 @@ void msg(const log_priority priority,
          Args&&... args) noexcept
 {
   assert(fmt);
-  const auto sdlCategory = static_cast<SDL_LogCategory>(category);
-  const auto prio = static_cast<SDL_LogPriority>(priority);
-  SDL_LogMessage(sdlCategory, prio, fmt, std::forward<Args>(args)...);
+  if (log::is_compiled(priority))
+  {
+    const auto sdlCategory = static_cast<SDL_LogCategory>(category);
+    const auto prio = static_cast<SDL_LogPriority>(priority);
+    SDL_LogMessage(sdlCategory, prio, fmt, std::forward<Args>(args)...);
+  }
+}
+
+/**
+ * \brief Logs a message with a constant priority and the specified category.
+ *
+ * \details Calls with priorities below `min_priority` compile to nothing. Note that the
+ * arguments are still evaluated, see `CENTURION_LOG` for logging that skips them.
+ *
+ * \tparam Priority the priority that will be used.
+ * \tparam Args the types of the arguments that will be used in the formatted string.
+ *
+ * \param category the category that will be used.
+ * \param fmt the formatted string that will be logged, cannot be null.
+ * \param args the arguments that will be used by the formatted string.
+ *
+ * \since 6.1.0
+ */
+template <log_priority Priority, typename... Args>
+void msg(const log_category category,
+         const not_null<czstring> fmt,
+         Args&&... args) noexcept
+{
+  assert(fmt);
+  if constexpr (log::is_compiled(Priority))
+  {
+    const auto sdlCategory = static_cast<SDL_LogCategory>(category);
+    const auto prio = static_cast<SDL_LogPriority>(Priority);
+    SDL_LogMessage(sdlCategory, prio, fmt, std::forward<Args>(args)...);
+  }
 }
 
 /**
@@ -130,7 +235,7 @@ void info(const log_category category,
           const not_null<czstring> fmt,
           Args&&... args) noexcept
 {
-  log::msg(log_priority::info, category, fmt, std::forward<Args>(args)...);
+  log::msg<log_priority::info>(category, fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -169,7 +274,7 @@ void warn(const log_category category,
           const not_null<czstring> fmt,
           Args&&... args) noexcept
 {
-  log::msg(log_priority::warn, category, fmt, std::forward<Args>(args)...);
+  log::msg<log_priority::warn>(category, fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -208,7 +313,7 @@ void verbose(const log_category category,
              const not_null<czstring> fmt,
              Args&&... args) noexcept
 {
-  log::msg(log_priority::verbose, category, fmt, std::forward<Args>(args)...);
+  log::msg<log_priority::verbose>(category, fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -247,7 +352,7 @@ void debug(const log_category category,
            const not_null<czstring> fmt,
            Args&&... args) noexcept
 {
-  log::msg(log_priority::debug, category, fmt, std::forward<Args>(args)...);
+  log::msg<log_priority::debug>(category, fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -286,7 +391,7 @@ void critical(const log_category category,
               const not_null<czstring> fmt,
               Args&&... args) noexcept
 {
-  log::msg(log_priority::critical, category, fmt, std::forward<Args>(args)...);
+  log::msg<log_priority::critical>(category, fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -323,7 +428,7 @@ void critical(const not_null<czstring> fmt, Args&&... args) noexcept
 template <typename... Args>
 void error(const log_category category, const czstring fmt, Args&&... args) noexcept
 {
-  log::msg(log_priority::error, category, fmt, std::forward<Args>(args)...);
+  log::msg<log_priority::error>(category, fmt, std::forward<Args>(args)...);
 }
 
 /**
@@ -363,6 +468,59 @@ inline void put(const not_null<czstring> str) noexcept
   log::info("%s", str);
 }
 
+/**
+ * \brief Logs a textual representation of a value, without allocating any memory.
+ *
+ * \details The value is written by its `format_to()` overload to a thread-local buffer of
+ * `SDL_MAX_LOG_MESSAGE` bytes, longer representations are truncated. Nothing is formatted
+ * if the priority is disabled for the category, so that disabled verbose logging is
+ * almost free.
+ * \code{cpp}
+ *   cen::log::put(cen::log_priority::verbose, cen::log_category::render, viewport);
+ * \endcode
+ *
+ * \tparam T the type of the value, must provide a `format_to()` overload.
+ *
+ * \param priority the priority that will be used.
+ * \param category the category that will be used.
+ * \param value the value that will be logged.
+ *
+ * \since 6.1.0
+ */
+template <typename T, std::enable_if_t<detail::is_formattable_v<T>, int> = 0>
+void put(const log_priority priority,
+         const log_category category,
+         const T& value) noexcept
+{
+  const auto sdlCategory = static_cast<SDL_LogCategory>(category);
+  const auto prio = static_cast<SDL_LogPriority>(priority);
+
+  if (log::is_compiled(priority) && prio >= SDL_LogGetPriority(sdlCategory))
+  {
+    auto& buffer = detail::log_buffer();
+    format_to(buffer.data(), buffer.size(), value);
+    SDL_LogMessage(sdlCategory, prio, "%s", buffer.data());
+  }
+}
+
+/**
+ * \brief Logs a textual representation of a value with `priority::info` and
+ * `category::app`, without allocating any memory.
+ *
+ * \tparam T the type of the value, must provide a `format_to()` overload.
+ *
+ * \param value the value that will be logged.
+ *
+ * \see `put(log_priority, log_category, const T&)`
+ *
+ * \since 6.1.0
+ */
+template <typename T, std::enable_if_t<detail::is_formattable_v<T>, int> = 0>
+void put(const T& value) noexcept
+{
+  log::put(log_priority::info, log_category::app, value);
+}
+
 /**
  * \brief Resets all of the logging priorities.
  *
@@ -540,6 +698,33 @@ inline void set_priority(const log_category category,
 /// \addtogroup core
 /// \{
 
+/**
+ * \def CENTURION_LOG
+ *
+ * \brief Logs a message, unless its priority is removed at compile-time.
+ *
+ * \details Unlike the logging functions, the arguments aren't evaluated at all if the
+ * priority is below `CENTURION_LOG_MIN_PRIORITY`, which makes the macro suitable for
+ * logging in hot loops.
+ * \code{cpp}
+ *   CENTURION_LOG(cen::log_priority::debug, cen::log_category::app, "%i", count());
+ * \endcode
+ *
+ * \param priority the priority of the message, must be a constant expression.
+ * \param category the category of the message.
+ * \param ... the format string and its arguments.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_LOG(priority, category, ...)            \
+  do                                                      \
+  {                                                       \
+    if constexpr (cen::log::is_compiled(priority))        \
+    {                                                     \
+      cen::log::msg<(priority)>((category), __VA_ARGS__); \
+    }                                                     \
+  } while (false)
+
 #ifndef CENTURION_NO_DEBUG_LOG_MACROS
 #ifdef NDEBUG
 
@@ -578,32 +763,38 @@ inline void set_priority(const log_category category,
 /**
  * \def CENTURION_LOG_INFO
  */
-#define CENTURION_LOG_INFO(fmt, ...) cen::log::info(fmt, __VA_ARGS__)
+#define CENTURION_LOG_INFO(fmt, ...) \
+  CENTURION_LOG(cen::log_priority::info, cen::log_category::app, fmt, __VA_ARGS__)
 
 /**
  * \def CENTURION_LOG_WARN
  */
-#define CENTURION_LOG_WARN(fmt, ...) cen::log::warn(fmt, __VA_ARGS__)
+#define CENTURION_LOG_WARN(fmt, ...) \
+  CENTURION_LOG(cen::log_priority::warn, cen::log_category::app, fmt, __VA_ARGS__)
 
 /**
  * \def CENTURION_LOG_VERBOSE
  */
-#define CENTURION_LOG_VERBOSE(fmt, ...) cen::log::verbose(fmt, __VA_ARGS__)
+#define CENTURION_LOG_VERBOSE(fmt, ...) \
+  CENTURION_LOG(cen::log_priority::verbose, cen::log_category::app, fmt, __VA_ARGS__)
 
 /**
  * \def CENTURION_LOG_DEBUG
  */
-#define CENTURION_LOG_DEBUG(fmt, ...) cen::log::debug(fmt, __VA_ARGS__)
+#define CENTURION_LOG_DEBUG(fmt, ...) \
+  CENTURION_LOG(cen::log_priority::debug, cen::log_category::app, fmt, __VA_ARGS__)
 
 /**
  * \def CENTURION_LOG_CRITICAL
  */
-#define CENTURION_LOG_CRITICAL(fmt, ...) cen::log::critical(fmt, __VA_ARGS__)
+#define CENTURION_LOG_CRITICAL(fmt, ...) \
+  CENTURION_LOG(cen::log_priority::critical, cen::log_category::app, fmt, __VA_ARGS__)
 
 /**
  * \def CENTURION_LOG_ERROR
  */
-#define CENTURION_LOG_ERROR(fmt, ...) cen::log::error(fmt, __VA_ARGS__)
+#define CENTURION_LOG_ERROR(fmt, ...) \
+  CENTURION_LOG(cen::log_priority::error, cen::log_category::app, fmt, __VA_ARGS__)
 
 #endif  // NDEBUG
 #endif  // CENTURION_NO_DEBUG_LOG_MACROS
@@ -613,7 +804,10 @@ inline void set_priority(const log_category category,
  *
  * \note This macro can be excluded by defining `CENTURION_NO_DEBUG_LOG_MACROS`.
  *
- * \brief A debug-only macro that expands to `cen::log::info`.
+ * \brief A debug-only macro that logs a message with `log_priority::info`.
+ *
+ * \details The arguments aren't evaluated if the priority is below
+ * `CENTURION_LOG_MIN_PRIORITY`.
  *
  * \since 5.0.0
  */
@@ -623,7 +817,10 @@ inline void set_priority(const log_category category,
  *
  * \note This macro can be excluded by defining `CENTURION_NO_DEBUG_LOG_MACROS`.
  *
- * \brief A debug-only macro that expands to `cen::log::warn`.
+ * \brief A debug-only macro that logs a message with `log_priority::warn`.
+ *
+ * \details The arguments aren't evaluated if the priority is below
+ * `CENTURION_LOG_MIN_PRIORITY`.
  *
  * \since 5.0.0
  */
@@ -633,7 +830,10 @@ inline void set_priority(const log_category category,
  *
  * \note This macro can be excluded by defining `CENTURION_NO_DEBUG_LOG_MACROS`.
  *
- * \brief A debug-only macro that expands to `cen::log::verbose`.
+ * \brief A debug-only macro that logs a message with `log_priority::verbose`.
+ *
+ * \details The arguments aren't evaluated if the priority is below
+ * `CENTURION_LOG_MIN_PRIORITY`.
  *
  * \since 5.0.0
  */
@@ -643,7 +843,10 @@ inline void set_priority(const log_category category,
  *
  * \note This macro can be excluded by defining `CENTURION_NO_DEBUG_LOG_MACROS`.
  *
- * \brief A debug-only macro that expands to `cen::log::debug`.
+ * \brief A debug-only macro that logs a message with `log_priority::debug`.
+ *
+ * \details The arguments aren't evaluated if the priority is below
+ * `CENTURION_LOG_MIN_PRIORITY`.
  *
  * \since 5.0.0
  */
@@ -653,7 +856,10 @@ inline void set_priority(const log_category category,
  *
  * \note This macro can be excluded by defining `CENTURION_NO_DEBUG_LOG_MACROS`.
  *
- * \brief A debug-only macro that expands to `cen::log::critical`.
+ * \brief A debug-only macro that logs a message with `log_priority::critical`.
+ *
+ * \details The arguments aren't evaluated if the priority is below
+ * `CENTURION_LOG_MIN_PRIORITY`.
  *
  * \since 5.0.0
  */
@@ -663,7 +869,10 @@ inline void set_priority(const log_category category,
  *
  * \note This macro can be excluded by defining `CENTURION_NO_DEBUG_LOG_MACROS`.
  *
- * \brief A debug-only macro that expands to `cen::log::error`.
+ * \brief A debug-only macro that logs a message with `log_priority::error`.
+ *
+ * \details The arguments aren't evaluated if the priority is below
+ * `CENTURION_LOG_MIN_PRIORITY`.
  *
  * \since 5.0.0
  */
@@ -24,6 +24,23 @@
 
 #endif  // __clang__
 
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && \
+    __has_include(<coroutine>)
+
+/**
+ * \def CENTURION_HAS_COROUTINES
+ *
+ * \brief This macro is defined if the compiler supports C++20 coroutines.
+ *
+ * \details The coroutine components, such as `task` and `coroutine_scheduler`, are only
+ * available if this macro is defined.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_HAS_COROUTINES
+
+#endif  // __cpp_impl_coroutine
+
 /**
  * \def CENTURION_SDL_VERSION_IS
  *
@@ -35,6 +52,129 @@
 #define CENTURION_SDL_VERSION_IS(x, y, z) \
   ((SDL_MAJOR_VERSION == (x)) && (SDL_MINOR_VERSION == (y)) && (SDL_PATCHLEVEL == (z)))
 
+#ifdef CENTURION___DOXYGEN
+
+/**
+ * \def CENTURION_COMPILED_LIBRARY
+ *
+ * \brief This macro is defined when the compiled library is used, i.e. when the
+ * `CEN_COMPILED_LIBRARY` CMake option is enabled.
+ *
+ * \details The owner and handle specializations of the class templates in the library,
+ * e.g. `window` and `renderer_handle`, are then declared as `extern` templates, and are
+ * instead explicitly instantiated once, in the compiled library. Define this macro
+ * manually when linking against the compiled library without CMake.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_COMPILED_LIBRARY
+
+/**
+ * \def CENTURION_NO_SDL_IMAGE
+ *
+ * \brief Excludes the components that depend on SDL2_image.
+ *
+ * \details Surfaces and textures can then not be loaded from image files. Disable the
+ * `CEN_IMAGE` CMake option to define this macro.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_NO_SDL_IMAGE
+
+/**
+ * \def CENTURION_NO_SDL_MIXER
+ *
+ * \brief Excludes the audio components, which depend on SDL2_mixer.
+ *
+ * \details Disable the `CEN_MIXER` CMake option to define this macro.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_NO_SDL_MIXER
+
+/**
+ * \def CENTURION_NO_SDL_TTF
+ *
+ * \brief Excludes the components that depend on SDL2_ttf.
+ *
+ * \details Fonts, font caches, text layouts and the text rendering functions of renderers
+ * are then unavailable. Disable the `CEN_TTF` CMake option to define this macro.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_NO_SDL_TTF
+
+/**
+ * \def CENTURION_NO_HAPTIC
+ *
+ * \brief Excludes the haptic components.
+ *
+ * \details Disable the `CEN_HAPTIC` CMake option to define this macro.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_NO_HAPTIC
+
+/**
+ * \def CENTURION_NO_SENSOR
+ *
+ * \brief Excludes the sensor components.
+ *
+ * \details The sensor functions of game controllers are then unavailable as well. Disable
+ * the `CEN_SENSOR` CMake option to define this macro.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_NO_SENSOR
+
+/**
+ * \def CENTURION_NO_MESSAGE_BOX
+ *
+ * \brief Excludes the message box components.
+ *
+ * \details Disable the `CEN_MESSAGE_BOX` CMake option to define this macro.
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_NO_MESSAGE_BOX
+
+/**
+ * \def CENTURION_NO_OPENGL
+ *
+ * \brief Excludes the OpenGL components.
+ *
+ * \details Disable the `CEN_OPENGL` CMake option to define this macro.
+ *
+ * \since 6.0.0
+ */
+#define CENTURION_NO_OPENGL
+
+/**
+ * \def CENTURION_NO_VULKAN
+ *
+ * \brief Excludes the Vulkan components.
+ *
+ * \details Disable the `CEN_VULKAN` CMake option to define this macro.
+ *
+ * \since 6.0.0
+ */
+#define CENTURION_NO_VULKAN
+
+/**
+ * \def CENTURION_USE_HARFBUZZ
+ *
+ * \brief Includes the text shaping components, which depend on HarfBuzz and FreeType.
+ *
+ * \details Enable the `CEN_HARFBUZZ` CMake option to define this macro.
+ *
+ * \see `text_shaper`
+ *
+ * \since 6.1.0
+ */
+#define CENTURION_USE_HARFBUZZ
+
+#endif  // CENTURION___DOXYGEN
+
 #if CENTURION_SDL_VERSION_IS(2, 0, 10)
 
 // Workaround for this enum being completely anonymous in SDL 2.0.10. We include
@@ -0,0 +1,316 @@
+#ifndef CENTURION_MEMORY_FUNCTIONS_HEADER
+#define CENTURION_MEMORY_FUNCTIONS_HEADER
+
+#include <SDL.h>
+
+#include <atomic>   // atomic
+#include <cstddef>  // size_t
+
+#include "exception.hpp"
+#include "integers.hpp"
+#include "result.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \struct memory_functions
+ *
+ * \brief The functions that are used by `SDL_malloc()` and friends.
+ *
+ * \details All memory that is allocated by SDL and the extension libraries, e.g. for
+ * surfaces, strings and audio chunks, is obtained through these functions.
+ *
+ * \see `get_memory_functions()`
+ * \see `set_memory_functions()`
+ *
+ * \since 6.1.0
+ */
+struct memory_functions final
+{
+  SDL_malloc_func mallocFunc{};    ///< Allocates uninitialized memory.
+  SDL_calloc_func callocFunc{};    ///< Allocates zero-initialized memory.
+  SDL_realloc_func reallocFunc{};  ///< Resizes an allocation.
+  SDL_free_func freeFunc{};        ///< Frees an allocation.
+};
+
+/**
+ * \brief Returns the memory functions currently used by SDL.
+ *
+ * \return the current memory functions.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto get_memory_functions() noexcept -> memory_functions
+{
+  memory_functions functions;
+  SDL_GetMemoryFunctions(&functions.mallocFunc,
+                         &functions.callocFunc,
+                         &functions.reallocFunc,
+                         &functions.freeFunc);
+  return functions;
+}
+
+/**
+ * \brief Replaces the memory functions used by SDL, e.g. with a faster general purpose
+ * allocator.
+ *
+ * \details Memory that was allocated before the functions were replaced is freed with
+ * the new free function, so custom allocators that can't free memory from the standard
+ * heap must be installed before SDL is initialized, i.e. before a `library` is created.
+ *
+ * \warning The memory functions must not be replaced while other threads might be
+ * calling SDL.
+ *
+ * \param functions the new memory functions, all of them must be non-null.
+ *
+ * \return `success` if the memory functions were replaced; `failure` if any of the
+ * functions was null.
+ *
+ * \since 6.1.0
+ */
+inline auto set_memory_functions(const memory_functions& functions) noexcept -> result
+{
+  return SDL_SetMemoryFunctions(functions.mallocFunc,
+                                functions.callocFunc,
+                                functions.reallocFunc,
+                                functions.freeFunc) == 0;
+}
+
+/**
+ * \brief Returns the amount of allocations made through the SDL memory functions that
+ * haven't been freed.
+ *
+ * \return the amount of outstanding allocations.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto allocation_count() noexcept -> int
+{
+  return SDL_GetNumAllocations();
+}
+
+/**
+ * \struct allocation_stats
+ *
+ * \brief Cumulative statistics of the calls to the SDL memory functions.
+ *
+ * \details The difference between two sets of statistics describes the heap traffic of
+ * the code that ran in between.
+ *
+ * \see `allocation_tracker`
+ *
+ * \since 6.1.0
+ */
+struct allocation_stats final
+{
+  u64 allocations{};    ///< The amount of malloc and calloc calls.
+  u64 reallocations{};  ///< The amount of realloc calls.
+  u64 deallocations{};  ///< The amount of free calls with non-null pointers.
+  u64 bytes{};          ///< The total amount of requested bytes.
+};
+
+/**
+ * \brief Returns the difference between two sets of allocation statistics.
+ *
+ * \param lhs the later statistics.
+ * \param rhs the earlier statistics.
+ *
+ * \return the statistics of the calls made in between.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] constexpr auto operator-(const allocation_stats& lhs,
+                                       const allocation_stats& rhs) noexcept
+    -> allocation_stats
+{
+  return {lhs.allocations - rhs.allocations,
+          lhs.reallocations - rhs.reallocations,
+          lhs.deallocations - rhs.deallocations,
+          lhs.bytes - rhs.bytes};
+}
+
+/// \} End of group core
+
+}  // namespace cen
+
+/// \cond FALSE
+namespace cen::detail {
+
+// The SDL memory functions have no user data, so the tracker state is global
+struct allocation_counters final
+{
+  inline static memory_functions upstream;
+  inline static std::atomic<u64> allocations{0};
+  inline static std::atomic<u64> reallocations{0};
+  inline static std::atomic<u64> deallocations{0};
+  inline static std::atomic<u64> bytes{0};
+  inline static std::atomic<bool> active{false};
+
+  static void reset() noexcept
+  {
+    allocations = 0;
+    reallocations = 0;
+    deallocations = 0;
+    bytes = 0;
+  }
+
+  [[nodiscard]] static auto SDLCALL tracked_malloc(const std::size_t size) noexcept
+      -> void*
+  {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    return upstream.mallocFunc(size);
+  }
+
+  [[nodiscard]] static auto SDLCALL tracked_calloc(const std::size_t count,
+                                                   const std::size_t size) noexcept
+      -> void*
+  {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(count * size, std::memory_order_relaxed);
+    return upstream.callocFunc(count, size);
+  }
+
+  [[nodiscard]] static auto SDLCALL tracked_realloc(void* ptr,
+                                                    const std::size_t size) noexcept
+      -> void*
+  {
+    reallocations.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(size, std::memory_order_relaxed);
+    return upstream.reallocFunc(ptr, size);
+  }
+
+  static void SDLCALL tracked_free(void* ptr) noexcept
+  {
+    if (ptr)
+    {
+      deallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    upstream.freeFunc(ptr);
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \class allocation_tracker
+ *
+ * \brief Counts the calls to the SDL memory functions during its lifetime.
+ *
+ * \details The tracker wraps the memory functions that are installed when it's created,
+ * and restores them when it's destroyed. Since the wrappers forward to the previous
+ * functions, a tracker can be created and destroyed at any time, and can be combined
+ * with custom memory functions installed with `set_memory_functions()`.
+ * \code{cpp}
+ *   cen::allocation_tracker tracker;
+ *
+ *   const auto before = tracker.stats();
+ *   update_game();
+ *   const auto frame = tracker.stats() - before;
+ *
+ *   profiler.record("SDL allocations", frame.allocations);
+ * \endcode
+ *
+ * \details SDL doesn't report where memory is requested from, so the statistics cover
+ * all calls. Take the difference of the statistics around a specific call to find out
+ * how much it allocates.
+ *
+ * \note Only one tracker can exist at a time.
+ *
+ * \since 6.1.0
+ */
+class allocation_tracker final
+{
+  using counters = detail::allocation_counters;
+
+ public:
+  /**
+   * \brief Installs the counting memory functions.
+   *
+   * \warning The memory functions must not be replaced while other threads might be
+   * calling SDL.
+   *
+   * \throws cen_error if there already is an allocation tracker.
+   * \throws sdl_error if the memory functions couldn't be replaced.
+   *
+   * \since 6.1.0
+   */
+  allocation_tracker()
+  {
+    if (counters::active.exchange(true))
+    {
+      throw cen_error{"There already is an allocation tracker!"};
+    }
+
+    counters::upstream = get_memory_functions();
+    counters::reset();
+
+    const memory_functions tracked{&counters::tracked_malloc,
+                                   &counters::tracked_calloc,
+                                   &counters::tracked_realloc,
+                                   &counters::tracked_free};
+    if (!set_memory_functions(tracked))
+    {
+      counters::active = false;
+      throw sdl_error{};
+    }
+  }
+
+  allocation_tracker(const allocation_tracker&) = delete;
+
+  auto operator=(const allocation_tracker&) -> allocation_tracker& = delete;
+
+  /**
+   * \brief Restores the memory functions that were installed when the tracker was
+   * created.
+   *
+   * \since 6.1.0
+   */
+  ~allocation_tracker() noexcept
+  {
+    set_memory_functions(counters::upstream);
+    counters::active = false;
+  }
+
+  /**
+   * \brief Returns the statistics of the calls made since the tracker was created, or
+   * since the last call to `reset()`.
+   *
+   * \return the current allocation statistics.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> allocation_stats
+  {
+    return {counters::allocations.load(std::memory_order_relaxed),
+            counters::reallocations.load(std::memory_order_relaxed),
+            counters::deallocations.load(std::memory_order_relaxed),
+            counters::bytes.load(std::memory_order_relaxed)};
+  }
+
+  /**
+   * \brief Resets all statistics to zero.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    counters::reset();
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_MEMORY_FUNCTIONS_HEADER
@@ -0,0 +1,430 @@
+#ifndef CENTURION_MEMORY_RESOURCE_HEADER
+#define CENTURION_MEMORY_RESOURCE_HEADER
+
+#include "macros.hpp"
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+#include <array>            // array
+#include <cassert>          // assert
+#include <cstddef>          // byte, size_t, max_align_t
+#include <memory_resource>  // memory_resource, monotonic_buffer_resource
+#include <new>              // placement new
+
+#include "../detail/frame_arena.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/*
+ * The memory resources below are compatible with the allocator-aware containers in the
+ * std::pmr namespace, e.g. std::pmr::vector and std::pmr::string. None of them are
+ * thread safe, apart from scratch_resource() which provides an arena per thread.
+ */
+
+/**
+ * \class stack_resource
+ *
+ * \brief A monotonic memory resource that is backed by a buffer stored in the object.
+ *
+ * \details Allocations that don't fit in the buffer are forwarded to the default memory
+ * resource. Memory is only released when the resource is destroyed or `release()` is
+ * called, so this is intended for short-lived containers on the stack.
+ * \code{cpp}
+ *   cen::stack_resource<256> resource;
+ *   std::pmr::vector<int> values{resource.get()};
+ * \endcode
+ *
+ * \tparam BufferSize the size of the buffer, in bytes.
+ *
+ * \since 6.1.0
+ */
+template <std::size_t BufferSize>
+class stack_resource final
+{
+ public:
+  stack_resource() noexcept = default;
+
+  stack_resource(const stack_resource&) = delete;
+
+  auto operator=(const stack_resource&) -> stack_resource& = delete;
+
+  /**
+   * \brief Releases all allocated memory, so that the buffer can be reused.
+   *
+   * \warning Any memory allocated from the resource must no longer be in use.
+   *
+   * \since 6.1.0
+   */
+  void release() noexcept
+  {
+    m_pool.release();
+  }
+
+  /**
+   * \brief Returns the memory resource.
+   *
+   * \return a pointer to the memory resource, which is owned by this object.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() noexcept -> std::pmr::memory_resource*
+  {
+    return &m_pool;
+  }
+
+ private:
+  std::array<std::byte, BufferSize> m_buffer{};
+  std::pmr::monotonic_buffer_resource m_pool{m_buffer.data(), m_buffer.size()};
+};
+
+class scratch_scope;
+
+/**
+ * \class frame_resource
+ *
+ * \brief A linear arena, where all memory is released at once with `reset()`.
+ *
+ * \details Allocations bump a pointer within blocks obtained from the global heap.
+ * Deallocations have no effect, and resetting the arena keeps its blocks, so once the
+ * arena has grown to the size needed by a frame, subsequent frames don't allocate at
+ * all. Owning renderers provide an arena that is reset by `basic_renderer::present()`.
+ * \code{cpp}
+ *   std::pmr::vector<cen::fpoint> points{&renderer.frame_resource()};
+ * \endcode
+ *
+ * \see `basic_renderer::frame_resource()`
+ * \see `scratch_resource()`
+ *
+ * \since 6.1.0
+ */
+class frame_resource final : public std::pmr::memory_resource
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty arena, memory is allocated on demand.
+   *
+   * \param blockSize the size of the blocks that are allocated by the arena, larger
+   * allocations get a block of their own.
+   *
+   * \since 6.1.0
+   */
+  explicit frame_resource(const size_type blockSize = 65'536) noexcept
+      : m_arena{blockSize}
+  {}
+
+  /**
+   * \brief Releases all allocations at once, while keeping the allocated blocks.
+   *
+   * \warning Any memory allocated from the arena must no longer be in use.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_arena.reset();
+  }
+
+  /**
+   * \brief Returns the total size of the blocks owned by the arena.
+   *
+   * \return the capacity of the arena, in bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_arena.capacity();
+  }
+
+ private:
+  friend class scratch_scope;
+
+  detail::frame_arena m_arena;
+
+  auto do_allocate(const size_type bytes, const size_type alignment) -> void* override
+  {
+    return m_arena.allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void*, size_type, size_type) noexcept override
+  {}
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override
+  {
+    return this == &other;
+  }
+};
+
+/**
+ * \brief Returns an arena for temporary allocations, which is local to the calling
+ * thread.
+ *
+ * \details Use `scratch_scope` to release the memory allocated within a function.
+ *
+ * \return the scratch arena of the current thread.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto scratch_resource() noexcept -> frame_resource&
+{
+  thread_local frame_resource resource;
+  return resource;
+}
+
+/**
+ * \class scratch_scope
+ *
+ * \brief Releases the memory that was allocated from an arena during its lifetime.
+ *
+ * \details Scopes can be nested, since only the memory allocated after the creation of a
+ * scope is released when it is destroyed. Containers that use the scope must be
+ * destroyed before it.
+ * \code{cpp}
+ *   cen::scratch_scope scratch;
+ *   std::pmr::vector<float> temporary(count, scratch.get());
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+class scratch_scope final
+{
+ public:
+  /**
+   * \brief Creates a scope for the scratch arena of the current thread.
+   *
+   * \since 6.1.0
+   */
+  scratch_scope() noexcept : scratch_scope{scratch_resource()}
+  {}
+
+  /**
+   * \brief Creates a scope for an arena.
+   *
+   * \param resource the arena, must outlive the scope.
+   *
+   * \since 6.1.0
+   */
+  explicit scratch_scope(frame_resource& resource) noexcept
+      : m_resource{&resource}
+      , m_marker{resource.m_arena.mark()}
+  {}
+
+  scratch_scope(const scratch_scope&) = delete;
+
+  auto operator=(const scratch_scope&) -> scratch_scope& = delete;
+
+  ~scratch_scope() noexcept
+  {
+    m_resource->m_arena.rewind(m_marker);
+  }
+
+  /**
+   * \brief Returns the arena of the scope.
+   *
+   * \return a pointer to the arena.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() const noexcept -> std::pmr::memory_resource*
+  {
+    return m_resource;
+  }
+
+ private:
+  frame_resource* m_resource{};
+  detail::frame_arena::marker m_marker;
+};
+
+/**
+ * \class pool_resource
+ *
+ * \brief A memory resource that hands out blocks of a fixed size from a free list.
+ *
+ * \details Blocks are carved from chunks that are obtained from an upstream resource,
+ * and are reused once they are deallocated. Allocations that are larger than the block
+ * size, or that require an alignment greater than `alignof(std::max_align_t)`, are
+ * forwarded to the upstream resource. This is suitable for node-based containers such
+ * as `std::pmr::list` and `std::pmr::map`.
+ *
+ * \since 6.1.0
+ */
+class pool_resource final : public std::pmr::memory_resource
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a pool, memory is allocated on demand.
+   *
+   * \param blockSize the size of the blocks, rounded up to a multiple of
+   * `alignof(std::max_align_t)`.
+   * \param blocksPerChunk the amount of blocks that are allocated at once.
+   * \param upstream the resource that provides the chunks, must outlive the pool.
+   *
+   * \since 6.1.0
+   */
+  explicit pool_resource(
+      const size_type blockSize,
+      const size_type blocksPerChunk = 64,
+      std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+      : m_upstream{upstream}
+      , m_blockSize{round_up(blockSize)}
+      , m_blocksPerChunk{(blocksPerChunk > 0) ? blocksPerChunk : size_type{1}}
+  {
+    assert(upstream);
+  }
+
+  pool_resource(const pool_resource&) = delete;
+
+  auto operator=(const pool_resource&) -> pool_resource& = delete;
+
+  ~pool_resource() noexcept override
+  {
+    release();
+  }
+
+  /**
+   * \brief Returns all chunks to the upstream resource.
+   *
+   * \warning Any blocks allocated from the pool must no longer be in use.
+   *
+   * \since 6.1.0
+   */
+  void release() noexcept
+  {
+    while (m_chunks)
+    {
+      auto* next = m_chunks->next;
+      m_upstream->deallocate(m_chunks, chunk_size(), alignof(std::max_align_t));
+      m_chunks = next;
+    }
+
+    m_free = nullptr;
+    m_chunkCount = 0;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the size of the blocks.
+   *
+   * \return the block size, in bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto block_size() const noexcept -> size_type
+  {
+    return m_blockSize;
+  }
+
+  /**
+   * \brief Returns the amount of chunks that have been obtained from the upstream
+   * resource.
+   *
+   * \return the amount of chunks.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto chunk_count() const noexcept -> size_type
+  {
+    return m_chunkCount;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct node final
+  {
+    node* next{};
+  };
+
+  std::pmr::memory_resource* m_upstream{};
+  size_type m_blockSize{};
+  size_type m_blocksPerChunk{};
+  node* m_free{};
+  node* m_chunks{};  // The first block of each chunk links to the next chunk
+  size_type m_chunkCount{};
+
+  [[nodiscard]] constexpr static auto round_up(const size_type size) noexcept
+      -> size_type
+  {
+    constexpr auto alignment = alignof(std::max_align_t);
+    const auto minimum = (size > sizeof(node)) ? size : sizeof(node);
+    return (minimum + alignment - 1) / alignment * alignment;
+  }
+
+  [[nodiscard]] auto chunk_size() const noexcept -> size_type
+  {
+    return m_blockSize * (m_blocksPerChunk + 1);
+  }
+
+  [[nodiscard]] auto is_pooled(const size_type bytes,
+                               const size_type alignment) const noexcept -> bool
+  {
+    return bytes <= m_blockSize && alignment <= alignof(std::max_align_t);
+  }
+
+  void grow()
+  {
+    auto* chunk = static_cast<std::byte*>(
+        m_upstream->allocate(chunk_size(), alignof(std::max_align_t)));
+
+    auto* header = new (chunk) node{m_chunks};
+    m_chunks = header;
+    ++m_chunkCount;
+
+    for (size_type index = m_blocksPerChunk; index > 0; --index)
+    {
+      m_free = new (chunk + index * m_blockSize) node{m_free};
+    }
+  }
+
+  auto do_allocate(const size_type bytes, const size_type alignment) -> void* override
+  {
+    if (!is_pooled(bytes, alignment))
+    {
+      return m_upstream->allocate(bytes, alignment);
+    }
+
+    if (!m_free)
+    {
+      grow();
+    }
+
+    auto* block = m_free;
+    m_free = block->next;
+
+    return block;
+  }
+
+  void do_deallocate(void* ptr, const size_type bytes, const size_type alignment) override
+  {
+    if (!is_pooled(bytes, alignment))
+    {
+      m_upstream->deallocate(ptr, bytes, alignment);
+      return;
+    }
+
+    m_free = new (ptr) node{m_free};
+  }
+
+  [[nodiscard]] auto do_is_equal(const std::pmr::memory_resource& other) const noexcept
+      -> bool override
+  {
+    return this == &other;
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+#endif  // CENTURION_MEMORY_RESOURCE_HEADER
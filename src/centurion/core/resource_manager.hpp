@@ -0,0 +1,597 @@
+#ifndef CENTURION_RESOURCE_MANAGER_HEADER
+#define CENTURION_RESOURCE_MANAGER_HEADER
+
+#include <cassert>        // assert
+#include <cstddef>        // size_t
+#include <functional>     // invoke
+#include <optional>       // optional
+#include <stdexcept>      // out_of_range
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <utility>        // move, as_const
+#include <vector>         // vector
+
+#include "integers.hpp"
+#include "resource_traits.hpp"
+
+namespace cen {
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \struct resource_handle
+ *
+ * \brief A handle to a resource that is stored in a `resource_manager`.
+ *
+ * \details Handles are small values that can be copied freely. Every slot of a manager
+ * has a generation, which is incremented when its resource is evicted, so handles to
+ * evicted resources are detected instead of referring to whatever resource reuses the
+ * slot.
+ *
+ * \tparam T the type of the resource.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+struct resource_handle final
+{
+  u32 index{};       ///< The index of the slot of the resource.
+  u32 generation{};  ///< The generation of the slot, zero for invalid handles.
+
+  /**
+   * \brief Indicates whether or not the handle was obtained from a manager.
+   *
+   * \note This doesn't indicate whether or not the resource is still loaded, see
+   * `resource_manager::is_valid()`.
+   *
+   * \return `true` if the handle isn't default constructed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return generation != 0;
+  }
+
+  [[nodiscard]] auto operator==(const resource_handle& other) const noexcept -> bool
+  {
+    return index == other.index && generation == other.generation;
+  }
+
+  [[nodiscard]] auto operator!=(const resource_handle& other) const noexcept -> bool
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * \class resource_manager
+ *
+ * \brief Loads resources by path, shares them between users and unloads unused ones.
+ *
+ * \details Resources are stored in a dense array of slots, and are referred to with
+ * generational handles. Loading a path that has already been loaded returns a handle to
+ * the same resource, and increments its reference count. Resources whose last user
+ * released them stay loaded, so that they can be reacquired cheaply, until the manager
+ * exceeds its budget, in which case the least recently released resources are evicted.
+ * \code{cpp}
+ *   cen::resource_manager<cen::texture> textures;
+ *
+ *   const auto load = [&](const std::string& path) {
+ *     return cen::texture{renderer, path};
+ *   };
+ *
+ *   const auto player = textures.acquire("sprites/player.png", load);
+ *   renderer.render(textures.at(player), cen::ipoint{10, 10});
+ *
+ *   textures.release(player);
+ * \endcode
+ *
+ * \details The memory used by each resource is obtained from `resource_traits`, i.e.
+ * texture managers account for the texture memory, and sound effect managers for the
+ * sample data. The default budget is derived from the system RAM, and texture managers
+ * also evict unused textures while the texture memory budget is exceeded, see
+ * `texture_memory::set_budget()`.
+ *
+ * \tparam T the type of the resources, must be move-constructible.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class resource_manager final
+{
+ public:
+  using resource_type = T;
+  using handle_type = resource_handle<T>;
+  using traits_type = resource_traits<T>;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty resource manager.
+   *
+   * \param budget the maximum amount of bytes used by the resources, before unused
+   * resources are evicted.
+   *
+   * \since 6.1.0
+   */
+  explicit resource_manager(const size_type budget = traits_type::default_budget())
+      : m_budget{budget}
+  {}
+
+  /// \name Loading and releasing
+  /// \{
+
+  /**
+   * \brief Acquires the resource associated with a path, loading it if necessary.
+   *
+   * \details If the path has already been loaded, the loader isn't invoked, and the
+   * reference count of the resource is incremented. Otherwise, the loaded resource is
+   * stored with a reference count of one, after which unused resources are evicted if
+   * the budget is exceeded.
+   *
+   * \tparam Loader the type of the loader, must be invocable with a `const std::string&`
+   * and return a `T`.
+   *
+   * \param path the path of the resource, which is also used as its key.
+   * \param loader the function object that loads the resource.
+   *
+   * \return a handle to the resource.
+   *
+   * \throws any exception thrown by the loader, in which case nothing is stored.
+   *
+   * \since 6.1.0
+   */
+  template <typename Loader>
+  auto acquire(const std::string_view path, Loader&& loader) -> handle_type
+  {
+    m_key.assign(path);
+
+    if (const auto it = m_paths.find(m_key); it != m_paths.end())
+    {
+      const auto index = it->second;
+      auto& slot = m_slots[index];
+
+      if (slot.refs++ == 0)
+      {
+        unlink(index);
+      }
+
+      return {index, slot.generation};
+    }
+
+    T resource = std::invoke(loader, std::as_const(m_key));
+    const auto bytes = traits_type::bytes(resource);
+
+    const auto index = allocate();
+    auto& slot = m_slots[index];
+
+    try
+    {
+      slot.path = m_key;
+      m_paths.try_emplace(m_key, index);
+    }
+    catch (...)
+    {
+      slot.path.clear();
+      m_free.push_back(index);  // Cannot throw, the free list had room for the slot
+      throw;
+    }
+
+    slot.resource.emplace(std::move(resource));
+    slot.bytes = bytes;
+    slot.refs = 1;
+
+    m_bytes += bytes;
+    ++m_size;
+
+    const handle_type handle{index, slot.generation};
+    trim();
+
+    return handle;
+  }
+
+  /**
+   * \brief Increments the reference count of a resource.
+   *
+   * \details This is intended to be used when a handle is shared with another user,
+   * which must release it separately.
+   *
+   * \param handle the handle of the resource.
+   *
+   * \return `true` if the reference count was incremented; `false` if the handle is
+   * stale.
+   *
+   * \since 6.1.0
+   */
+  auto retain(const handle_type handle) noexcept -> bool
+  {
+    if (!is_valid(handle))
+    {
+      return false;
+    }
+
+    if (m_slots[handle.index].refs++ == 0)
+    {
+      unlink(handle.index);
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Decrements the reference count of a resource.
+   *
+   * \details When the last reference is released, the resource becomes the most
+   * recently used of the unused resources. It's evicted immediately if the budget is
+   * exceeded.
+   *
+   * \note This function has no effect if the handle is stale, or if the resource is
+   * already unused.
+   *
+   * \param handle the handle of the resource.
+   *
+   * \since 6.1.0
+   */
+  void release(const handle_type handle) noexcept
+  {
+    if (!is_valid(handle))
+    {
+      return;
+    }
+
+    auto& slot = m_slots[handle.index];
+    if (slot.refs == 0)
+    {
+      return;
+    }
+
+    if (--slot.refs == 0)
+    {
+      link_back(handle.index);
+      trim();
+    }
+  }
+
+  /// \} End of loading and releasing
+
+  /// \name Access
+  /// \{
+
+  /**
+   * \brief Returns the resource associated with a handle.
+   *
+   * \param handle the handle of the resource.
+   *
+   * \return the resource.
+   *
+   * \throws std::out_of_range if the handle is stale.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto at(const handle_type handle) -> T&
+  {
+    if (auto* resource = try_get(handle))
+    {
+      return *resource;
+    }
+    else
+    {
+      throw std::out_of_range{"Stale resource handle!"};
+    }
+  }
+
+  /// \copydoc at()
+  [[nodiscard]] auto at(const handle_type handle) const -> const T&
+  {
+    if (const auto* resource = try_get(handle))
+    {
+      return *resource;
+    }
+    else
+    {
+      throw std::out_of_range{"Stale resource handle!"};
+    }
+  }
+
+  /**
+   * \brief Returns the resource associated with a handle, if it's still loaded.
+   *
+   * \note Do not store the returned pointer, it's invalidated when the resource is
+   * evicted, and when other resources are loaded.
+   *
+   * \param handle the handle of the resource.
+   *
+   * \return a pointer to the resource; a null pointer if the handle is stale.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto try_get(const handle_type handle) noexcept -> T*
+  {
+    return is_valid(handle) ? &*m_slots[handle.index].resource : nullptr;
+  }
+
+  /// \copydoc try_get()
+  [[nodiscard]] auto try_get(const handle_type handle) const noexcept -> const T*
+  {
+    return is_valid(handle) ? &*m_slots[handle.index].resource : nullptr;
+  }
+
+  /**
+   * \brief Indicates whether or not a handle refers to a loaded resource.
+   *
+   * \param handle the handle that will be checked.
+   *
+   * \return `true` if the resource is loaded; `false` if the handle is stale.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_valid(const handle_type handle) const noexcept -> bool
+  {
+    return handle && handle.index < m_slots.size() &&
+           m_slots[handle.index].generation == handle.generation &&
+           m_slots[handle.index].resource.has_value();
+  }
+
+  /**
+   * \brief Indicates whether or not the resource of a path is loaded.
+   *
+   * \param path the path of the resource.
+   *
+   * \return `true` if the resource is loaded; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const std::string_view path) -> bool
+  {
+    m_key.assign(path);
+    return m_paths.find(m_key) != m_paths.end();
+  }
+
+  /**
+   * \brief Returns the reference count of a resource.
+   *
+   * \param handle the handle of the resource.
+   *
+   * \return the amount of users of the resource; zero if it's unused, or if the handle
+   * is stale.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto use_count(const handle_type handle) const noexcept -> size_type
+  {
+    return is_valid(handle) ? m_slots[handle.index].refs : 0u;
+  }
+
+  /// \} End of access
+
+  /// \name Budget
+  /// \{
+
+  /**
+   * \brief Evicts the least recently released resources until the budget is met.
+   *
+   * \details This is done automatically when resources are loaded and released, but
+   * should be called when a global budget is exceeded, e.g. from a texture memory
+   * budget callback.
+   *
+   * \return the amount of evicted resources.
+   *
+   * \since 6.1.0
+   */
+  auto trim() noexcept -> size_type
+  {
+    size_type evicted = 0;
+    while (m_lruHead != npos && (m_bytes > m_budget || traits_type::over_budget()))
+    {
+      evict(m_lruHead);
+      ++evicted;
+    }
+
+    return evicted;
+  }
+
+  /**
+   * \brief Evicts all unused resources, regardless of the budget.
+   *
+   * \return the amount of evicted resources.
+   *
+   * \since 6.1.0
+   */
+  auto clear_unused() noexcept -> size_type
+  {
+    size_type evicted = 0;
+    while (m_lruHead != npos)
+    {
+      evict(m_lruHead);
+      ++evicted;
+    }
+
+    return evicted;
+  }
+
+  /**
+   * \brief Sets the budget of the manager, and evicts unused resources if necessary.
+   *
+   * \param budget the maximum amount of bytes used by the resources.
+   *
+   * \since 6.1.0
+   */
+  void set_budget(const size_type budget) noexcept
+  {
+    m_budget = budget;
+    trim();
+  }
+
+  /**
+   * \brief Returns the budget of the manager.
+   *
+   * \return the maximum amount of bytes used by the resources.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto budget() const noexcept -> size_type
+  {
+    return m_budget;
+  }
+
+  /**
+   * \brief Returns the amount of memory used by the loaded resources.
+   *
+   * \details This may exceed the budget, since resources that are in use are never
+   * evicted.
+   *
+   * \return the amount of bytes used by the resources, see `resource_traits`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto bytes() const noexcept -> size_type
+  {
+    return m_bytes;
+  }
+
+  /**
+   * \brief Returns the amount of loaded resources.
+   *
+   * \return the amount of loaded resources, including unused ones.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the amount of loaded resources that aren't in use.
+   *
+   * \return the amount of resources that may be evicted.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto unused_count() const noexcept -> size_type
+  {
+    return m_unused;
+  }
+
+  /// \} End of budget
+
+ private:
+  inline constexpr static u32 npos = 0xFFFF'FFFFu;
+
+  struct slot_type final
+  {
+    std::optional<T> resource;
+    std::string path;
+    size_type bytes{};
+    u32 generation{1};
+    u32 refs{};
+    u32 previous{npos};  // The neighbours in the list of unused resources
+    u32 next{npos};
+  };
+
+  std::vector<slot_type> m_slots;
+  std::vector<u32> m_free;  // Indices of unused slots
+  std::unordered_map<std::string, u32> m_paths;
+  std::string m_key;     // Reused to avoid allocating keys for lookups
+  u32 m_lruHead{npos};   // The least recently released resource
+  u32 m_lruTail{npos};   // The most recently released resource
+  size_type m_bytes{};
+  size_type m_budget{};
+  size_type m_size{};
+  size_type m_unused{};
+
+  /// Returns the index of an empty slot, with room for it in the free list.
+  auto allocate() -> u32
+  {
+    if (m_free.empty())
+    {
+      m_free.reserve(m_slots.size() + 1u);
+      m_slots.emplace_back();
+      return static_cast<u32>(m_slots.size() - 1u);
+    }
+    else
+    {
+      const auto index = m_free.back();
+      m_free.pop_back();
+      return index;
+    }
+  }
+
+  void link_back(const u32 index) noexcept
+  {
+    auto& slot = m_slots[index];
+    slot.previous = m_lruTail;
+    slot.next = npos;
+
+    if (m_lruTail != npos)
+    {
+      m_slots[m_lruTail].next = index;
+    }
+    else
+    {
+      m_lruHead = index;
+    }
+
+    m_lruTail = index;
+    ++m_unused;
+  }
+
+  void unlink(const u32 index) noexcept
+  {
+    auto& slot = m_slots[index];
+
+    if (slot.previous != npos)
+    {
+      m_slots[slot.previous].next = slot.next;
+    }
+    else
+    {
+      m_lruHead = slot.next;
+    }
+
+    if (slot.next != npos)
+    {
+      m_slots[slot.next].previous = slot.previous;
+    }
+    else
+    {
+      m_lruTail = slot.previous;
+    }
+
+    slot.previous = npos;
+    slot.next = npos;
+    --m_unused;
+  }
+
+  void evict(const u32 index) noexcept
+  {
+    unlink(index);
+
+    auto& slot = m_slots[index];
+    assert(slot.refs == 0 && "Cannot evict resources that are in use!");
+
+    m_paths.erase(slot.path);
+    slot.path.clear();
+    slot.resource.reset();
+
+    m_bytes -= slot.bytes;
+    slot.bytes = 0;
+    --m_size;
+
+    ++slot.generation;
+    if (slot.generation == 0)
+    {
+      slot.generation = 1;  // Zero is reserved for invalid handles
+    }
+
+    m_free.push_back(index);  // Cannot throw, the free list has room for every slot
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_RESOURCE_MANAGER_HEADER
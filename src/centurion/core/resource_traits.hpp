@@ -0,0 +1,79 @@
+#ifndef CENTURION_RESOURCE_TRAITS_HEADER
+#define CENTURION_RESOURCE_TRAITS_HEADER
+
+#include <cstddef>  // size_t
+
+#include "../system/ram.hpp"
+
+namespace cen {
+
+namespace detail {
+
+// A quarter of the system RAM, in bytes
+[[nodiscard]] inline auto default_resource_budget() noexcept -> std::size_t
+{
+  const auto megabytes = static_cast<std::size_t>(ram::amount_mb());
+  return megabytes * 1'000'000u / 4u;
+}
+
+}  // namespace detail
+
+/// \addtogroup core
+/// \{
+
+/**
+ * \struct resource_traits
+ *
+ * \brief Describes the memory usage of a resource type, for `resource_manager`.
+ *
+ * \details The primary template is used for resources whose memory can't be measured,
+ * such as fonts and music, which don't count towards the budget of a manager. The
+ * specializations for owning textures and sound effects are provided next to those
+ * classes.
+ *
+ * \tparam T the type of the resources.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+struct resource_traits
+{
+  /**
+   * \brief Returns the amount of memory used by a resource.
+   *
+   * \return the size of the resource in bytes; zero if it's unknown.
+   */
+  [[nodiscard]] static auto bytes(const T&) noexcept -> std::size_t
+  {
+    return 0;
+  }
+
+  /**
+   * \brief Returns the budget that managers of the resource type use by default.
+   *
+   * \return a quarter of the system RAM, in bytes.
+   */
+  [[nodiscard]] static auto default_budget() noexcept -> std::size_t
+  {
+    return detail::default_resource_budget();
+  }
+
+  /**
+   * \brief Indicates whether or not a global budget of the resource type is exceeded.
+   *
+   * \details Managers evict unused resources while this function returns `true`, even if
+   * the budget of the manager is met, e.g. when the texture memory budget is exceeded.
+   *
+   * \return `true` if a global budget is exceeded; `false` otherwise.
+   */
+  [[nodiscard]] static auto over_budget() -> bool
+  {
+    return false;
+  }
+};
+
+/// \} End of group core
+
+}  // namespace cen
+
+#endif  // CENTURION_RESOURCE_TRAITS_HEADER
@@ -1,9 +1,12 @@
 #ifndef CENTURION_RESULT_HEADER
 #define CENTURION_RESULT_HEADER
 
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
+#include "../detail/format_writer.hpp"
+
 namespace cen {
 
 /// \addtogroup core
@@ -122,6 +125,25 @@ inline constexpr result success{true};
 /// \since 6.0.0
 inline constexpr result failure{false};
 
+/**
+ * \brief Writes a string that represents a result value to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param result the value that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer, const std::size_t size, const result result) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write(result ? "success" : "failure");
+}
+
 /**
  * \brief Returns a string that represents a result value.
  *
@@ -136,7 +158,7 @@ inline constexpr result failure{false};
  */
 [[nodiscard]] inline auto to_string(const result result) -> std::string
 {
-  return result ? "success" : "failure";
+  return detail::format_string(result);
 }
 
 /**
@@ -2,6 +2,7 @@
 #define CENTURION_SFINAE_HEADER
 
 #include <type_traits>  // enable_if_t, is_same_v, is_integral_v, is_floating_point_v, ...
+#include <utility>      // declval
 
 namespace cen {
 
@@ -27,6 +28,11 @@ template <typename T, typename... Args>
 using enable_if_convertible_t =
     std::enable_if_t<(std::is_convertible_v<T, Args> || ...), int>;
 
+/// Enables a template if the type is a container that provides `data()`, e.g. a vector.
+template <typename T>
+using enable_if_container_t =
+    std::enable_if_t<std::is_pointer_v<decltype(std::declval<const T&>().data())>, int>;
+
 /// \} End of group core
 
 }  // namespace cen
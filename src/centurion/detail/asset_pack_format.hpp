@@ -0,0 +1,84 @@
+#ifndef CENTURION_DETAIL_ASSET_PACK_FORMAT_HEADER
+#define CENTURION_DETAIL_ASSET_PACK_FORMAT_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>      // size_t
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Asset packs start with a header, followed by the entry data, the index and the names.
+ * All values are stored in little-endian byte order.
+ *
+ *   Header:
+ *     u8[8]  magic, "CENPACK\0"
+ *     u32    format version
+ *     u32    amount of entries
+ *     u32    alignment of the entry data, a power of two
+ *     u32    reserved, zero
+ *     u64    offset of the index
+ *
+ *   Data:
+ *     u8[]   the bytes of every entry, each starting at a multiple of the alignment
+ *
+ *   Index, sorted by hash and then by name:
+ *     u64    FNV-1a hash of the name
+ *     u64    offset of the data
+ *     u64    size of the data
+ *     u32    offset of the name, relative to the start of the names
+ *     u32    size of the name, excluding the null terminator
+ *
+ *   Names, directly after the index:
+ *     u8[]   the null-terminated names of the entries
+ */
+
+inline constexpr char asset_pack_magic[8] = {'C', 'E', 'N', 'P', 'A', 'C', 'K', '\0'};
+inline constexpr u32 asset_pack_version = 1;
+inline constexpr std::size_t asset_pack_header_size = 32;
+inline constexpr std::size_t asset_pack_index_entry_size = 32;
+
+[[nodiscard]] constexpr auto asset_name_hash(const std::string_view name) noexcept -> u64
+{
+  u64 hash = 14'695'981'039'346'656'037u;
+  for (const auto ch : name)
+  {
+    hash ^= static_cast<u8>(ch);
+    hash *= 1'099'511'628'211u;
+  }
+
+  return hash;
+}
+
+template <typename T>
+[[nodiscard]] auto load_little_endian(const void* data) noexcept -> T
+{
+  const auto* bytes = static_cast<const u8*>(data);
+
+  T result = 0;
+  for (std::size_t index = 0; index < sizeof(T); ++index)
+  {
+    result |= static_cast<T>(static_cast<T>(bytes[index]) << (index * 8u));
+  }
+
+  return result;
+}
+
+template <typename T>
+void store_little_endian(void* data, const T value) noexcept
+{
+  auto* bytes = static_cast<u8*>(data);
+  for (std::size_t index = 0; index < sizeof(T); ++index)
+  {
+    bytes[index] = static_cast<u8>((value >> (index * 8u)) & 0xFFu);
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_ASSET_PACK_FORMAT_HEADER
@@ -0,0 +1,50 @@
+#ifndef CENTURION_DETAIL_BINARY_LAYOUT_HEADER
+#define CENTURION_DETAIL_BINARY_LAYOUT_HEADER
+
+#include <cstddef>      // size_t
+#include <type_traits>  // enable_if_t, is_arithmetic_v, is_trivially_copyable_v
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \brief Describes types that are stored as a packed array of arithmetic components.
+ *
+ * \details Arrays of such types can be converted between byte orders, and written to or
+ * read from files, in bulk, by treating them as arrays of their components. Types opt in
+ * by specializing this template next to their definition.
+ *
+ * \tparam T the described type.
+ *
+ * \since 6.1.0
+ */
+template <typename T, typename = void>
+struct binary_layout final
+{
+  inline constexpr static std::size_t components = 0;
+  inline constexpr static std::size_t component_size = 0;
+};
+
+template <typename T>
+struct binary_layout<T, std::enable_if_t<std::is_arithmetic_v<T>>> final
+{
+  inline constexpr static std::size_t components = 1;
+  inline constexpr static std::size_t component_size = sizeof(T);
+};
+
+/// Indicates whether or not arrays of a type can be treated as arrays of components.
+template <typename T>
+inline constexpr bool has_binary_layout_v =
+    std::is_trivially_copyable_v<T> && binary_layout<T>::components != 0 &&
+    sizeof(T) == binary_layout<T>::components * binary_layout<T>::component_size &&
+    (binary_layout<T>::component_size == 1 || binary_layout<T>::component_size == 2 ||
+     binary_layout<T>::component_size == 4 || binary_layout<T>::component_size == 8);
+
+/// Enables a template if arrays of the type can be treated as arrays of components.
+template <typename T>
+using enable_if_binary_layout_t = std::enable_if_t<has_binary_layout_v<T>, int>;
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BINARY_LAYOUT_HEADER
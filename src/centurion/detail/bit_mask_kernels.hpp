@@ -0,0 +1,171 @@
+#ifndef CENTURION_DETAIL_BIT_MASK_KERNELS_HEADER
+#define CENTURION_DETAIL_BIT_MASK_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels operate on rows of bits packed into 64-bit words, where bit x of a row is
+ * bit x % 64 of word x / 64. A row of the second mask is shifted towards higher bits by
+ * the specified amount, where the bits that are shifted out of a word are carried into
+ * the next word, so the word before the first word of the second row must be readable.
+ */
+
+/// \name Scalar kernels
+/// \{
+
+[[nodiscard]] inline auto rows_overlap_scalar(const u64* a,
+                                              const u64* b,
+                                              const std::size_t count,
+                                              const unsigned shift) noexcept -> bool
+{
+  if (shift == 0)
+  {
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      if (a[index] & b[index])
+      {
+        return true;
+      }
+    }
+  }
+  else
+  {
+    const auto carry = 64u - shift;
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      // Reads the word before the current word, which exists for the first word too
+      const auto shifted = (b[index] << shift) | (b[index - 1] >> carry);
+      if (a[index] & shifted)
+      {
+        return true;
+      }
+    }
+  }
+
+  return false;
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+[[nodiscard]] inline auto rows_overlap_sse2(const u64* a,
+                                            const u64* b,
+                                            const std::size_t count,
+                                            const unsigned shift) noexcept -> bool
+{
+  // Shifting by 64 produces zero, so the carry vanishes if the shift is zero
+  const auto left = _mm_cvtsi32_si128(static_cast<int>(shift));
+  const auto right = _mm_cvtsi32_si128(static_cast<int>(64u - shift));
+  const auto zero = _mm_setzero_si128();
+
+  std::size_t index = 0;
+  for (; index + 2u <= count; index += 2u)
+  {
+    const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + index));
+    const auto y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + index));
+    const auto p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + index - 1));
+
+    const auto shifted = _mm_or_si128(_mm_sll_epi64(y, left), _mm_srl_epi64(p, right));
+    const auto both = _mm_and_si128(x, shifted);
+
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(both, zero)) != 0xFFFF)
+    {
+      return true;
+    }
+  }
+
+  return rows_overlap_scalar(a + index, b + index, count - index, shift);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+[[nodiscard]] inline auto rows_overlap_neon(const u64* a,
+                                            const u64* b,
+                                            const std::size_t count,
+                                            const unsigned shift) noexcept -> bool
+{
+  // Negative amounts shift to the right, and shifting by 64 produces zero
+  const auto left = vdupq_n_s64(static_cast<i64>(shift));
+  const auto right = vdupq_n_s64(static_cast<i64>(shift) - 64);
+
+  std::size_t index = 0;
+  for (; index + 2u <= count; index += 2u)
+  {
+    const auto x = vld1q_u64(a + index);
+    const auto y = vld1q_u64(b + index);
+    const auto previous = vld1q_u64(b + index - 1);
+
+    const auto shifted = vorrq_u64(vshlq_u64(y, left), vshlq_u64(previous, right));
+    const auto both = vandq_u64(x, shifted);
+
+    if ((vgetq_lane_u64(both, 0) | vgetq_lane_u64(both, 1)) != 0)
+    {
+      return true;
+    }
+  }
+
+  return rows_overlap_scalar(a + index, b + index, count - index, shift);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Indicates whether any bit is set in both a row and a shifted row, with shift < 64.
+[[nodiscard]] inline auto rows_overlap(const simd_level level,
+                                       const u64* a,
+                                       const u64* b,
+                                       const std::size_t count,
+                                       const unsigned shift) noexcept -> bool
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      return rows_overlap_sse2(a, b, count, shift);
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      return rows_overlap_neon(a, b, count, shift);
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      return rows_overlap_scalar(a, b, count, shift);
+
+    default:
+      assert(false);
+      return false;
+  }
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BIT_MASK_KERNELS_HEADER
@@ -0,0 +1,382 @@
+#ifndef CENTURION_DETAIL_BLIT_KERNELS_HEADER
+#define CENTURION_DETAIL_BLIT_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "color_kernels.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels composite rows of 32-bit pixels with the same channel layout, using the
+ * equations of the SDL blend modes, i.e. the source colors are not premultiplied:
+ *
+ *   copy:   dst = src
+ *   blend:  dstRGB = srcRGB * srcA + dstRGB * (1 - srcA), dstA = srcA + dstA * (1 - srcA)
+ *   add:    dstRGB = srcRGB * srcA + dstRGB, dstA = dstA
+ *   mod:    dstRGB = srcRGB * dstRGB, dstA = dstA
+ *   mul:    dstRGB = srcRGB * dstRGB + dstRGB * (1 - srcA), dstA = dstA
+ *
+ * All products are rounded to nearest, so every kernel produces the same results.
+ */
+
+enum class blit_op
+{
+  copy,
+  blend,
+  add,
+  mod,
+  mul
+};
+
+/// Returns the composition of one 8-bit channel, the alpha values are the source alpha.
+template <blit_op Op>
+[[nodiscard]] constexpr auto blit_channel(const u32 source,
+                                          const u32 sourceAlpha,
+                                          const u32 destination,
+                                          const bool isAlpha) noexcept -> u32
+{
+  if constexpr (Op == blit_op::copy)
+  {
+    return source;
+  }
+  else if constexpr (Op == blit_op::blend)
+  {
+    return lerp_255(destination, isAlpha ? 255u : source, sourceAlpha);
+  }
+  else if (isAlpha)
+  {
+    return destination;
+  }
+  else if constexpr (Op == blit_op::add)
+  {
+    const auto sum = destination + multiply_255(source, sourceAlpha);
+    return (sum < 255u) ? sum : 255u;
+  }
+  else if constexpr (Op == blit_op::mod)
+  {
+    return multiply_255(source, destination);
+  }
+  else
+  {
+    const auto sum = multiply_255(source, destination) +
+                     multiply_255(destination, 255u - sourceAlpha);
+    return (sum < 255u) ? sum : 255u;
+  }
+}
+
+template <blit_op Op>
+[[nodiscard]] constexpr auto blit_pixel(const u32 alphaShift,
+                                        const u32 source,
+                                        const u32 destination) noexcept -> u32
+{
+  const auto alpha = (source >> alphaShift) & 0xFFu;
+
+  u32 result{};
+  for (u32 shift = 0; shift < 32u; shift += 8u)
+  {
+    const auto channel = blit_channel<Op>((source >> shift) & 0xFFu,
+                                          alpha,
+                                          (destination >> shift) & 0xFFu,
+                                          shift == alphaShift);
+    result |= channel << shift;
+  }
+
+  return result;
+}
+
+/// \name Scalar kernels
+/// \{
+
+template <blit_op Op>
+void blit_row_scalar(const channel_layout& layout,
+                     const u32* src,
+                     u32* dst,
+                     const std::size_t count) noexcept
+{
+  if constexpr (Op == blit_op::copy)
+  {
+    SDL_memcpy(dst, src, count * sizeof(u32));
+  }
+  else
+  {
+    const auto alphaShift = static_cast<u32>(layout.alpha);
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      dst[index] = blit_pixel<Op>(alphaShift, src[index], dst[index]);
+    }
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+/// Composites two pixels, that have been widened to 16-bit channels.
+template <blit_op Op, int AlphaIndex>
+[[nodiscard]] inline auto blit_sse2(const __m128i source,
+                                    const __m128i destination,
+                                    const __m128i alphaMask) noexcept -> __m128i
+{
+  constexpr int order = _MM_SHUFFLE(AlphaIndex, AlphaIndex, AlphaIndex, AlphaIndex);
+
+  const auto max = _mm_set1_epi16(255);
+  const auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, order), order);
+
+  if constexpr (Op == blit_op::blend)
+  {
+    // The alpha lanes are interpolated towards 255 instead of the source alpha
+    const auto s = _mm_or_si128(source, _mm_and_si128(alphaMask, max));
+    return divide_255_sse2(
+        _mm_add_epi16(_mm_mullo_epi16(destination, _mm_sub_epi16(max, alpha)),
+                      _mm_mullo_epi16(s, alpha)));
+  }
+  else if constexpr (Op == blit_op::add)
+  {
+    // The scaled source is added with saturation, with zero in the alpha lanes
+    return _mm_andnot_si128(alphaMask,
+                            divide_255_sse2(_mm_mullo_epi16(source, alpha)));
+  }
+  else
+  {
+    // Multiplying the destination alpha by 255 leaves it unchanged
+    const auto s = _mm_or_si128(source, _mm_and_si128(alphaMask, max));
+    return divide_255_sse2(_mm_mullo_epi16(s, destination));
+  }
+}
+
+/// Returns the second term of the multiplication blend mode, zero in the alpha lanes.
+template <int AlphaIndex>
+[[nodiscard]] inline auto scale_mul_sse2(const __m128i source,
+                                         const __m128i destination,
+                                         const __m128i alphaMask) noexcept -> __m128i
+{
+  constexpr int order = _MM_SHUFFLE(AlphaIndex, AlphaIndex, AlphaIndex, AlphaIndex);
+
+  const auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, order), order);
+  const auto inverse =
+      _mm_andnot_si128(alphaMask, _mm_sub_epi16(_mm_set1_epi16(255), alpha));
+
+  return divide_255_sse2(_mm_mullo_epi16(destination, inverse));
+}
+
+template <blit_op Op, int AlphaIndex>
+void blit_row_sse2(const channel_layout& layout,
+                   const u32* src,
+                   u32* dst,
+                   const std::size_t count) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+  const auto alphaMask =
+      _mm_set1_epi64x(static_cast<long long>(0xFFFFull << (16 * AlphaIndex)));
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    auto* ptr = reinterpret_cast<__m128i*>(dst + index);
+    const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+    const auto d = _mm_loadu_si128(ptr);
+
+    const auto sl = _mm_unpacklo_epi8(s, zero);
+    const auto sh = _mm_unpackhi_epi8(s, zero);
+    const auto dl = _mm_unpacklo_epi8(d, zero);
+    const auto dh = _mm_unpackhi_epi8(d, zero);
+
+    auto result = _mm_packus_epi16(blit_sse2<Op, AlphaIndex>(sl, dl, alphaMask),
+                                   blit_sse2<Op, AlphaIndex>(sh, dh, alphaMask));
+
+    if constexpr (Op == blit_op::add)
+    {
+      result = _mm_adds_epu8(d, result);
+    }
+    else if constexpr (Op == blit_op::mul)
+    {
+      const auto low = scale_mul_sse2<AlphaIndex>(sl, dl, alphaMask);
+      const auto high = scale_mul_sse2<AlphaIndex>(sh, dh, alphaMask);
+      result = _mm_adds_epu8(result, _mm_packus_epi16(low, high));
+    }
+
+    _mm_storeu_si128(ptr, result);
+  }
+
+  blit_row_scalar<Op>(layout, src + index, dst + index, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+template <blit_op Op>
+void blit_row_neon(const channel_layout& layout,
+                   const u32* src,
+                   u32* dst,
+                   const std::size_t count) noexcept
+{
+  // Byte index of the alpha channel in memory, which depends on the byte order
+  const auto alphaIndex =
+      (SDL_BYTEORDER == SDL_LIL_ENDIAN) ? layout.alpha / 8 : 3 - layout.alpha / 8;
+
+  const auto max = vdup_n_u8(255);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    auto* ptr = reinterpret_cast<u8*>(dst + index);
+
+    // Deinterleaves eight pixels into separate channels
+    const auto s = vld4_u8(reinterpret_cast<const u8*>(src + index));
+    auto d = vld4_u8(ptr);
+
+    const auto alpha = s.val[alphaIndex];
+    const auto inverse = vmvn_u8(alpha);
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+      const auto sc = s.val[channel];
+      const auto dc = d.val[channel];
+
+      if constexpr (Op == blit_op::blend)
+      {
+        const auto target = (channel == alphaIndex) ? max : sc;
+        d.val[channel] = divide_255_neon(vmlal_u8(vmull_u8(dc, inverse), target, alpha));
+      }
+      else if (channel == alphaIndex)
+      {
+        continue;
+      }
+      else if constexpr (Op == blit_op::add)
+      {
+        d.val[channel] = vqadd_u8(dc, divide_255_neon(vmull_u8(sc, alpha)));
+      }
+      else if constexpr (Op == blit_op::mod)
+      {
+        d.val[channel] = divide_255_neon(vmull_u8(sc, dc));
+      }
+      else
+      {
+        d.val[channel] = vqadd_u8(divide_255_neon(vmull_u8(sc, dc)),
+                                  divide_255_neon(vmull_u8(dc, inverse)));
+      }
+    }
+
+    vst4_u8(ptr, d);
+  }
+
+  blit_row_scalar<Op>(layout, src + index, dst + index, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+template <blit_op Op>
+void blit_row(const simd_level level,
+              const channel_layout& layout,
+              const u32* src,
+              u32* dst,
+              const std::size_t count) noexcept
+{
+  [[maybe_unused]] const auto alphaIndex = layout.alpha / 8;
+
+  switch (level)
+  {
+    case simd_level::avx2:
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      switch (alphaIndex)
+      {
+        case 0:
+          blit_row_sse2<Op, 0>(layout, src, dst, count);
+          break;
+
+        case 1:
+          blit_row_sse2<Op, 1>(layout, src, dst, count);
+          break;
+
+        case 2:
+          blit_row_sse2<Op, 2>(layout, src, dst, count);
+          break;
+
+        default:
+          blit_row_sse2<Op, 3>(layout, src, dst, count);
+          break;
+      }
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      blit_row_neon<Op>(layout, src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      blit_row_scalar<Op>(layout, src, dst, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Composites a row of source pixels onto a row of destination pixels, in place.
+inline void blit_pixels(const simd_level level,
+                        const blit_op op,
+                        const channel_layout& layout,
+                        const u32* src,
+                        u32* dst,
+                        const std::size_t count) noexcept
+{
+  switch (op)
+  {
+    case blit_op::blend:
+      blit_row<blit_op::blend>(level, layout, src, dst, count);
+      break;
+
+    case blit_op::add:
+      blit_row<blit_op::add>(level, layout, src, dst, count);
+      break;
+
+    case blit_op::mod:
+      blit_row<blit_op::mod>(level, layout, src, dst, count);
+      break;
+
+    case blit_op::mul:
+      blit_row<blit_op::mul>(level, layout, src, dst, count);
+      break;
+
+    case blit_op::copy:
+      // Copying is limited by memory bandwidth, there's nothing to vectorize
+      blit_row_scalar<blit_op::copy>(layout, src, dst, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BLIT_KERNELS_HEADER
@@ -0,0 +1,292 @@
+#ifndef CENTURION_DETAIL_BLOCK_COMPRESSION_HEADER
+#define CENTURION_DETAIL_BLOCK_COMPRESSION_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Blocks are compressed with a greedy LZ77 matcher and are encoded in the LZ4 block
+ * format, which is designed to be decoded at close to memory bandwidth. A block is a
+ * series of sequences, each consisting of:
+ *
+ *   u8     token, the literal length and the match length minus four, as nibbles
+ *   u8[]   255-valued bytes extending the literal length, if its nibble is 15
+ *   u8[]   literals
+ *   u16    offset of the match, little-endian
+ *   u8[]   255-valued bytes extending the match length, if its nibble is 15
+ *
+ * The last sequence only consists of literals, and the last five bytes of a block are
+ * always literals.
+ */
+
+inline constexpr std::size_t block_min_match = 4;
+inline constexpr std::size_t block_last_literals = 5;
+inline constexpr std::size_t block_match_limit = 12;  // No match may start after this
+inline constexpr std::size_t block_max_offset = 65'535;
+inline constexpr int block_hash_log = 12;
+
+/// Returns the maximum size of a compressed block of the specified size.
+[[nodiscard]] constexpr auto block_compress_bound(const std::size_t size) noexcept
+    -> std::size_t
+{
+  return size + size / 255u + 16u;
+}
+
+[[nodiscard]] inline auto block_read32(const u8* data) noexcept -> u32
+{
+  u32 value;
+  std::memcpy(&value, data, sizeof value);
+  return value;
+}
+
+[[nodiscard]] inline auto block_hash(const u32 sequence) noexcept -> u32
+{
+  return (sequence * 2'654'435'761u) >> (32 - block_hash_log);
+}
+
+// Writes an extended length, the nibble has already been written to the token
+inline auto block_write_length(u8* out, std::size_t length) noexcept -> u8*
+{
+  for (; length >= 255u; length -= 255u)
+  {
+    *out++ = 255u;
+  }
+
+  *out++ = static_cast<u8>(length);
+  return out;
+}
+
+/**
+ * Compresses a block, returns the size of the compressed data; zero if it wouldn't fit in
+ * the output buffer. The output buffer must be at least `block_compress_bound(size)`
+ * bytes to always succeed.
+ */
+inline auto compress_block(const u8* in,
+                           const std::size_t size,
+                           u8* out,
+                           const std::size_t capacity) noexcept -> std::size_t
+{
+  u32 table[1u << block_hash_log]{};  // Positions plus one, zero means empty
+
+  const auto* outBegin = out;
+  const auto* outEnd = out + capacity;
+
+  auto emit = [&](const std::size_t anchor,
+                  const std::size_t literals,
+                  const std::size_t offset,
+                  const std::size_t matchLength) noexcept -> bool {
+    // Token, literals, lengths and the offset, where each length needs a byte per 255
+    const auto needed =
+        1u + literals + literals / 255u + 1u + 2u + matchLength / 255u + 1u;
+    if (needed > static_cast<std::size_t>(outEnd - out))
+    {
+      return false;
+    }
+
+    auto* token = out++;
+    *token = static_cast<u8>(((literals < 15u) ? literals : 15u) << 4u);
+    if (literals >= 15u)
+    {
+      out = block_write_length(out, literals - 15u);
+    }
+
+    if (literals != 0)
+    {
+      std::memcpy(out, in + anchor, literals);
+      out += literals;
+    }
+
+    if (matchLength != 0)
+    {
+      *out++ = static_cast<u8>(offset & 0xFFu);
+      *out++ = static_cast<u8>(offset >> 8u);
+
+      const auto length = matchLength - block_min_match;
+      *token |= static_cast<u8>((length < 15u) ? length : 15u);
+      if (length >= 15u)
+      {
+        out = block_write_length(out, length - 15u);
+      }
+    }
+
+    return true;
+  };
+
+  std::size_t anchor = 0;
+
+  if (size > block_match_limit)
+  {
+    const auto limit = size - block_match_limit;
+    const auto matchEnd = size - block_last_literals;
+
+    std::size_t pos = 0;
+    while (pos < limit)
+    {
+      const auto sequence = block_read32(in + pos);
+      auto& slot = table[block_hash(sequence)];
+
+      const auto candidate = static_cast<std::size_t>(slot);
+      slot = static_cast<u32>(pos + 1u);
+
+      if (candidate == 0 || pos - (candidate - 1u) > block_max_offset ||
+          block_read32(in + candidate - 1u) != sequence)
+      {
+        ++pos;
+        continue;
+      }
+
+      auto match = candidate - 1u;
+      auto length = block_min_match;
+      while (pos + length < matchEnd && in[match + length] == in[pos + length])
+      {
+        ++length;
+      }
+
+      // Extend the match backwards into the pending literals
+      while (pos > anchor && match > 0 && in[pos - 1u] == in[match - 1u])
+      {
+        --pos;
+        --match;
+        ++length;
+      }
+
+      if (!emit(anchor, pos - anchor, pos - match, length))
+      {
+        return 0;
+      }
+
+      pos += length;
+      anchor = pos;
+
+      // Index a position inside the match, which helps with repetitive data
+      if (pos < limit)
+      {
+        table[block_hash(block_read32(in + pos - 2u))] = static_cast<u32>(pos - 1u);
+      }
+    }
+  }
+
+  if (!emit(anchor, size - anchor, 0, 0))
+  {
+    return 0;
+  }
+
+  return static_cast<std::size_t>(out - outBegin);
+}
+
+// Reads an extended length, returns false if the input ends prematurely
+[[nodiscard]] inline auto block_read_length(const u8*& in,
+                                            const u8* inEnd,
+                                            std::size_t& length) noexcept -> bool
+{
+  u8 byte;
+  do
+  {
+    if (in == inEnd)
+    {
+      return false;
+    }
+
+    byte = *in++;
+    length += byte;
+  } while (byte == 255u);
+
+  return true;
+}
+
+/**
+ * Decompresses a block into a buffer of exactly `rawSize` bytes. The input is validated,
+ * so malformed blocks are rejected instead of causing out-of-bounds accesses.
+ */
+[[nodiscard]] inline auto decompress_block(const u8* in,
+                                           const std::size_t size,
+                                           u8* out,
+                                           const std::size_t rawSize) noexcept -> bool
+{
+  const auto* inEnd = in + size;
+  auto* const outBegin = out;
+  const auto* outEnd = out + rawSize;
+
+  while (in != inEnd)
+  {
+    const auto token = *in++;
+
+    std::size_t literals = token >> 4u;
+    if (literals == 15u && !block_read_length(in, inEnd, literals))
+    {
+      return false;
+    }
+
+    if (literals > static_cast<std::size_t>(inEnd - in) ||
+        literals > static_cast<std::size_t>(outEnd - out))
+    {
+      return false;
+    }
+
+    if (literals != 0)
+    {
+      std::memcpy(out, in, literals);
+      in += literals;
+      out += literals;
+    }
+
+    if (in == inEnd)
+    {
+      break;  // The last sequence has no match
+    }
+
+    if (inEnd - in < 2)
+    {
+      return false;
+    }
+
+    const auto offset = static_cast<std::size_t>(in[0] | (in[1] << 8u));
+    in += 2;
+
+    if (offset == 0 || offset > static_cast<std::size_t>(out - outBegin))
+    {
+      return false;
+    }
+
+    std::size_t length = token & 0xFu;
+    if (length == 15u && !block_read_length(in, inEnd, length))
+    {
+      return false;
+    }
+
+    length += block_min_match;
+    if (length > static_cast<std::size_t>(outEnd - out))
+    {
+      return false;
+    }
+
+    const auto* match = out - offset;
+    if (offset >= length)
+    {
+      std::memcpy(out, match, length);
+      out += length;
+    }
+    else
+    {
+      // The match overlaps the output, which repeats the last `offset` bytes
+      for (std::size_t i = 0; i < length; ++i)
+      {
+        *out++ = *match++;
+      }
+    }
+  }
+
+  return out == outEnd;
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BLOCK_COMPRESSION_HEADER
@@ -0,0 +1,453 @@
+#ifndef CENTURION_DETAIL_BMFONT_FORMAT_HEADER
+#define CENTURION_DETAIL_BMFONT_FORMAT_HEADER
+
+#include <charconv>      // from_chars
+#include <cstddef>       // size_t
+#include <cstring>       // memchr, memcmp
+#include <string>        // string
+#include <string_view>   // string_view
+#include <system_error>  // errc
+#include <vector>        // vector
+
+#include "../core/integers.hpp"
+#include "asset_pack_format.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * BMFont descriptors are either text or binary files. Text descriptors consist of lines
+ * that start with a tag, followed by key=value pairs, where string values are quoted.
+ *
+ *   common lineHeight=16 base=12 scaleW=128 scaleH=128 pages=1
+ *   page id=0 file="font_0.png"
+ *   char id=65 x=0 y=0 width=8 height=10 xoffset=0 yoffset=2 xadvance=9 page=0
+ *   kerning first=65 second=86 amount=-1
+ *
+ * Binary descriptors (version 3) start with "BMF\3", followed by blocks of a u8 type and
+ * a u32 size. All values are stored in little-endian byte order.
+ *
+ *   1 info:     i16 size, 12 bytes of flags and paddings, null-terminated face name
+ *   2 common:   u16 line height, u16 base, u16 scale width, u16 scale height, u16 pages,
+ *               5 bytes of flags and channels
+ *   3 pages:    null-terminated file names, that all have the same length
+ *   4 chars:    20 bytes each, u32 id, u16 x, u16 y, u16 width, u16 height, i16 x-offset,
+ *               i16 y-offset, i16 x-advance, u8 page, u8 channel
+ *   5 kerning:  10 bytes each, u32 first, u32 second, i16 amount
+ */
+
+inline constexpr char bmfont_binary_magic[4] = {'B', 'M', 'F', '\3'};
+inline constexpr std::size_t bmfont_char_size = 20;
+inline constexpr std::size_t bmfont_kerning_size = 10;
+inline constexpr int bmfont_max_pages = 256;  // Binary char records store pages in a byte
+
+struct bmfont_char final
+{
+  u32 id{};
+  int x{};
+  int y{};
+  int width{};
+  int height{};
+  int xOffset{};
+  int yOffset{};
+  int xAdvance{};
+  int page{};
+};
+
+struct bmfont_kerning final
+{
+  u32 first{};
+  u32 second{};
+  int amount{};
+};
+
+struct bmfont_description final
+{
+  std::string face;
+  int size{};
+  int lineHeight{};
+  int base{};
+  std::vector<std::string> pages;
+  std::vector<bmfont_char> chars;
+  std::vector<bmfont_kerning> kernings;
+};
+
+// Extracts the next key=value pair of a text descriptor line, removing it from the line
+inline auto next_bmfont_attribute(std::string_view& line,
+                                  std::string_view& key,
+                                  std::string_view& value) noexcept -> bool
+{
+  const auto begin = line.find_first_not_of(" \t");
+  if (begin == std::string_view::npos)
+  {
+    return false;
+  }
+
+  line.remove_prefix(begin);
+
+  const auto equals = line.find('=');
+  if (equals == std::string_view::npos)
+  {
+    return false;
+  }
+
+  key = line.substr(0, equals);
+  line.remove_prefix(equals + 1);
+
+  if (!line.empty() && line.front() == '"')
+  {
+    const auto quote = line.find('"', 1);
+    if (quote == std::string_view::npos)
+    {
+      return false;
+    }
+
+    value = line.substr(1, quote - 1);
+    line.remove_prefix(quote + 1);
+  }
+  else
+  {
+    const auto end = line.find_first_of(" \t");
+    value = line.substr(0, end);
+    line.remove_prefix((end == std::string_view::npos) ? line.size() : end);
+  }
+
+  return true;
+}
+
+template <typename T>
+[[nodiscard]] auto parse_bmfont_number(const std::string_view value, T& number) noexcept
+    -> bool
+{
+  const auto* last = value.data() + value.size();
+  const auto [end, error] = std::from_chars(value.data(), last, number);
+  return error == std::errc{} && end == last;
+}
+
+inline auto parse_bmfont_text(std::string_view text, bmfont_description& font) -> bool
+{
+  int pageCount = -1;
+
+  while (!text.empty())
+  {
+    const auto newline = text.find('\n');
+    auto line = text.substr(0, newline);
+    text.remove_prefix((newline == std::string_view::npos) ? text.size() : newline + 1);
+
+    if (!line.empty() && line.back() == '\r')
+    {
+      line.remove_suffix(1);
+    }
+
+    const auto tagEnd = line.find_first_of(" \t");
+    const auto tag = line.substr(0, tagEnd);
+    line.remove_prefix((tagEnd == std::string_view::npos) ? line.size() : tagEnd);
+
+    bmfont_char ch;
+    bmfont_kerning kerning;
+    bool fallback = false;
+    int pageId = -1;
+    std::string_view pageFile;
+
+    std::string_view key;
+    std::string_view value;
+    while (next_bmfont_attribute(line, key, value))
+    {
+      auto ok = true;
+      if (tag == "info")
+      {
+        if (key == "face")
+        {
+          font.face = value;
+        }
+        else if (key == "size")
+        {
+          ok = parse_bmfont_number(value, font.size);
+        }
+      }
+      else if (tag == "common")
+      {
+        if (key == "lineHeight")
+        {
+          ok = parse_bmfont_number(value, font.lineHeight);
+        }
+        else if (key == "base")
+        {
+          ok = parse_bmfont_number(value, font.base);
+        }
+        else if (key == "pages")
+        {
+          ok = parse_bmfont_number(value, pageCount);
+        }
+      }
+      else if (tag == "page")
+      {
+        if (key == "id")
+        {
+          ok = parse_bmfont_number(value, pageId);
+        }
+        else if (key == "file")
+        {
+          pageFile = value;
+        }
+      }
+      else if (tag == "char")
+      {
+        // Some generators emit a fallback character with the id -1, which is ignored
+        if (key == "id")
+        {
+          fallback = value == "-1";
+          ok = fallback || parse_bmfont_number(value, ch.id);
+        }
+        else if (key == "x")
+        {
+          ok = parse_bmfont_number(value, ch.x);
+        }
+        else if (key == "y")
+        {
+          ok = parse_bmfont_number(value, ch.y);
+        }
+        else if (key == "width")
+        {
+          ok = parse_bmfont_number(value, ch.width);
+        }
+        else if (key == "height")
+        {
+          ok = parse_bmfont_number(value, ch.height);
+        }
+        else if (key == "xoffset")
+        {
+          ok = parse_bmfont_number(value, ch.xOffset);
+        }
+        else if (key == "yoffset")
+        {
+          ok = parse_bmfont_number(value, ch.yOffset);
+        }
+        else if (key == "xadvance")
+        {
+          ok = parse_bmfont_number(value, ch.xAdvance);
+        }
+        else if (key == "page")
+        {
+          ok = parse_bmfont_number(value, ch.page);
+        }
+      }
+      else if (tag == "kerning")
+      {
+        if (key == "first")
+        {
+          ok = parse_bmfont_number(value, kerning.first);
+        }
+        else if (key == "second")
+        {
+          ok = parse_bmfont_number(value, kerning.second);
+        }
+        else if (key == "amount")
+        {
+          ok = parse_bmfont_number(value, kerning.amount);
+        }
+      }
+
+      if (!ok)
+      {
+        return false;
+      }
+    }
+
+    if (tag == "page")
+    {
+      // The pages are stored by ID, so IDs beyond the page count must not allocate
+      const auto limit = (pageCount >= 0) ? pageCount : bmfont_max_pages;
+      if (pageId < 0 || pageId >= limit || pageId >= bmfont_max_pages || pageFile.empty())
+      {
+        return false;
+      }
+
+      const auto index = static_cast<std::size_t>(pageId);
+      if (font.pages.size() <= index)
+      {
+        font.pages.resize(index + 1);
+      }
+
+      font.pages[index] = pageFile;
+    }
+    else if (tag == "char" && !fallback)
+    {
+      font.chars.push_back(ch);
+    }
+    else if (tag == "kerning")
+    {
+      font.kernings.push_back(kerning);
+    }
+  }
+
+  for (const auto& page : font.pages)
+  {
+    if (page.empty())
+    {
+      return false;
+    }
+  }
+
+  return font.lineHeight > 0 &&
+         (pageCount < 0 || static_cast<std::size_t>(pageCount) == font.pages.size());
+}
+
+inline auto parse_bmfont_binary(const u8* data,
+                                const std::size_t size,
+                                bmfont_description& font) -> bool
+{
+  const auto i16At = [](const u8* bytes) noexcept {
+    return static_cast<int>(static_cast<i16>(load_little_endian<u16>(bytes)));
+  };
+
+  const auto u16At = [](const u8* bytes) noexcept {
+    return static_cast<int>(load_little_endian<u16>(bytes));
+  };
+
+  std::size_t offset = sizeof(bmfont_binary_magic);
+  int pageCount = 0;
+
+  while (offset + 5 <= size)
+  {
+    const auto type = data[offset];
+    const auto blockSize = std::size_t{load_little_endian<u32>(data + offset + 1)};
+    offset += 5;
+
+    if (blockSize > size - offset)
+    {
+      return false;
+    }
+
+    const auto* block = data + offset;
+    offset += blockSize;
+
+    switch (type)
+    {
+      case 1:  // Info
+      {
+        if (blockSize < 15)
+        {
+          return false;
+        }
+
+        font.size = i16At(block);
+
+        const auto* name = reinterpret_cast<const char*>(block + 14);
+        const auto* end =
+            static_cast<const char*>(std::memchr(name, '\0', blockSize - 14));
+        if (!end)
+        {
+          return false;
+        }
+
+        font.face.assign(name, end);
+        break;
+      }
+      case 2:  // Common
+      {
+        if (blockSize < 10)
+        {
+          return false;
+        }
+
+        font.lineHeight = u16At(block);
+        font.base = u16At(block + 2);
+        pageCount = u16At(block + 8);
+        break;
+      }
+      case 3:  // Pages
+      {
+        std::size_t position = 0;
+        while (position < blockSize)
+        {
+          const auto* name = reinterpret_cast<const char*>(block + position);
+          const auto* end = std::memchr(name, '\0', blockSize - position);
+          if (!end)
+          {
+            return false;
+          }
+
+          const auto* last = static_cast<const char*>(end);
+          const auto length = static_cast<std::size_t>(last - name);
+
+          font.pages.emplace_back(name, length);
+          position += length + 1;
+        }
+
+        break;
+      }
+      case 4:  // Chars
+      {
+        if (blockSize % bmfont_char_size != 0)
+        {
+          return false;
+        }
+
+        for (std::size_t position = 0; position < blockSize; position += bmfont_char_size)
+        {
+          const auto* record = block + position;
+
+          bmfont_char ch;
+          ch.id = load_little_endian<u32>(record);
+          ch.x = u16At(record + 4);
+          ch.y = u16At(record + 6);
+          ch.width = u16At(record + 8);
+          ch.height = u16At(record + 10);
+          ch.xOffset = i16At(record + 12);
+          ch.yOffset = i16At(record + 14);
+          ch.xAdvance = i16At(record + 16);
+          ch.page = record[18];
+
+          font.chars.push_back(ch);
+        }
+
+        break;
+      }
+      case 5:  // Kerning pairs
+      {
+        if (blockSize % bmfont_kerning_size != 0)
+        {
+          return false;
+        }
+
+        for (std::size_t position = 0; position < blockSize;
+             position += bmfont_kerning_size)
+        {
+          const auto* record = block + position;
+          font.kernings.push_back({load_little_endian<u32>(record),
+                                   load_little_endian<u32>(record + 4),
+                                   i16At(record + 8)});
+        }
+
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  return offset == size && font.lineHeight > 0 &&
+         static_cast<std::size_t>(pageCount) == font.pages.size();
+}
+
+/// Parses a text or binary BMFont descriptor, returns false if the descriptor is invalid.
+inline auto parse_bmfont(const void* data,
+                         const std::size_t size,
+                         bmfont_description& font) -> bool
+{
+  const auto* bytes = static_cast<const u8*>(data);
+
+  if (size >= sizeof(bmfont_binary_magic) &&
+      std::memcmp(bytes, bmfont_binary_magic, sizeof(bmfont_binary_magic)) == 0)
+  {
+    return parse_bmfont_binary(bytes, size, font);
+  }
+
+  return parse_bmfont_text({static_cast<const char*>(data), size}, font);
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BMFONT_FORMAT_HEADER
@@ -0,0 +1,231 @@
+#ifndef CENTURION_DETAIL_BYTE_SWAP_KERNELS_HEADER
+#define CENTURION_DETAIL_BYTE_SWAP_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <cstring>      // memcpy
+#include <type_traits>  // is_arithmetic_v
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels reverse the bytes of every element of a block of `Size`-byte values, in
+ * place. The values are accessed as bytes, so they may be of any type of that size.
+ */
+
+/// Indicates whether or not the byte order of values of a type can be swapped in bulk.
+template <typename T>
+inline constexpr bool is_byte_swappable_v =
+    std::is_arithmetic_v<T> && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// \name Scalar kernels
+/// \{
+
+template <std::size_t Size>
+void swap_bytes_scalar(u8* data, const std::size_t count) noexcept
+{
+  static_assert(Size == 2 || Size == 4 || Size == 8);
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    auto* ptr = data + index * Size;
+
+    if constexpr (Size == 2)
+    {
+      u16 value;
+      std::memcpy(&value, ptr, Size);
+      value = SDL_Swap16(value);
+      std::memcpy(ptr, &value, Size);
+    }
+    else if constexpr (Size == 4)
+    {
+      u32 value;
+      std::memcpy(&value, ptr, Size);
+      value = SDL_Swap32(value);
+      std::memcpy(ptr, &value, Size);
+    }
+    else
+    {
+      u64 value;
+      std::memcpy(&value, ptr, Size);
+      value = SDL_Swap64(value);
+      std::memcpy(ptr, &value, Size);
+    }
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+template <std::size_t Size>
+void swap_bytes_sse2(u8* data, const std::size_t count) noexcept
+{
+  constexpr std::size_t perBlock = 16u / Size;
+
+  std::size_t index = 0;
+  for (; index + perBlock <= count; index += perBlock)
+  {
+    auto* ptr = reinterpret_cast<__m128i*>(data + index * Size);
+    auto values = _mm_loadu_si128(ptr);
+
+    // Without SSSE3 there is no byte shuffle, so the 16-bit words are reordered first
+    if constexpr (Size == 4)
+    {
+      constexpr int order = _MM_SHUFFLE(2, 3, 0, 1);
+      values = _mm_shufflehi_epi16(_mm_shufflelo_epi16(values, order), order);
+    }
+    else if constexpr (Size == 8)
+    {
+      constexpr int order = _MM_SHUFFLE(0, 1, 2, 3);
+      values = _mm_shufflehi_epi16(_mm_shufflelo_epi16(values, order), order);
+    }
+
+    values = _mm_or_si128(_mm_slli_epi16(values, 8), _mm_srli_epi16(values, 8));
+    _mm_storeu_si128(ptr, values);
+  }
+
+  swap_bytes_scalar<Size>(data + index * Size, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+/// \name AVX2 kernels
+/// \{
+
+template <std::size_t Size>
+CENTURION_DETAIL_TARGET_AVX2 void swap_bytes_avx2(u8* data,
+                                                  const std::size_t count) noexcept
+{
+  constexpr std::size_t perBlock = 32u / Size;
+  constexpr auto size = static_cast<int>(Size);
+
+  // The byte shuffle operates on each 128-bit lane separately
+  alignas(32) char order[32];
+  for (int index = 0; index < 32; ++index)
+  {
+    const auto offset = (index % 16) % size;
+    order[index] = static_cast<char>(index % 16 - offset + size - 1 - offset);
+  }
+
+  const auto mask = _mm256_load_si256(reinterpret_cast<const __m256i*>(order));
+
+  std::size_t index = 0;
+  for (; index + perBlock <= count; index += perBlock)
+  {
+    auto* ptr = reinterpret_cast<__m256i*>(data + index * Size);
+    _mm256_storeu_si256(ptr, _mm256_shuffle_epi8(_mm256_loadu_si256(ptr), mask));
+  }
+
+  swap_bytes_scalar<Size>(data + index * Size, count - index);
+}
+
+/// \} End of AVX2 kernels
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+template <std::size_t Size>
+void swap_bytes_neon(u8* data, const std::size_t count) noexcept
+{
+  constexpr std::size_t perBlock = 16u / Size;
+
+  std::size_t index = 0;
+  for (; index + perBlock <= count; index += perBlock)
+  {
+    auto* ptr = data + index * Size;
+    const auto values = vld1q_u8(ptr);
+
+    if constexpr (Size == 2)
+    {
+      vst1q_u8(ptr, vrev16q_u8(values));
+    }
+    else if constexpr (Size == 4)
+    {
+      vst1q_u8(ptr, vrev32q_u8(values));
+    }
+    else
+    {
+      vst1q_u8(ptr, vrev64q_u8(values));
+    }
+  }
+
+  swap_bytes_scalar<Size>(data + index * Size, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Reverses the bytes of each `Size`-byte element, in place.
+template <std::size_t Size>
+void swap_bytes(const simd_level level, void* data, const std::size_t count) noexcept
+{
+  auto* bytes = static_cast<u8*>(data);
+
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      swap_bytes_avx2<Size>(bytes, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      swap_bytes_sse2<Size>(bytes, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      swap_bytes_neon<Size>(bytes, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      swap_bytes_scalar<Size>(bytes, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+using swap_bytes_function = void(u8*, std::size_t) noexcept;
+
+/// The byte swap kernels, called with the implementation of the current instruction set.
+template <std::size_t Size>
+inline constexpr simd_kernel<swap_bytes_function> swap_bytes_kernel{
+    &swap_bytes_scalar<Size>,
+    CENTURION_DETAIL_SSE2_KERNEL(swap_bytes_sse2<Size>),
+    CENTURION_DETAIL_AVX2_KERNEL(swap_bytes_avx2<Size>),
+    CENTURION_DETAIL_NEON_KERNEL(swap_bytes_neon<Size>)};
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_BYTE_SWAP_KERNELS_HEADER
@@ -0,0 +1,1550 @@
+#ifndef CENTURION_DETAIL_COLOR_KERNELS_HEADER
+#define CENTURION_DETAIL_COLOR_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels operate on colors stored as four bytes in the order red, green, blue and
+ * alpha, i.e. the layout of SDL_Color, and on hues, saturations, values and lightnesses
+ * stored as separate arrays of floats, in the same ranges as color::from_hsv() and
+ * color::from_hsl(). Blending uses 8-bit fixed-point arithmetic, where all kernels
+ * produce the same results. The HSV/HSL conversions use floats, where the vectorized
+ * kernels might differ from the scalar kernels by one unit due to rounding.
+ */
+
+/// Returns the interpolation of two 8-bit values by a weight in [0, 255], rounded.
+[[nodiscard]] constexpr auto lerp_255(const u32 a, const u32 b, const u32 weight) noexcept
+    -> u32
+{
+  const auto t = a * (255u - weight) + b * weight + 128u;
+  return (t + (t >> 8u)) >> 8u;
+}
+
+/// Returns the premultiplied "over" composition of two 8-bit channels.
+[[nodiscard]] constexpr auto composite_255(const u32 source,
+                                           const u32 sourceAlpha,
+                                           const u32 destination) noexcept -> u32
+{
+  const auto result = source + multiply_255(destination, 255u - sourceAlpha);
+  return (result < 255u) ? result : 255u;
+}
+
+[[nodiscard]] inline auto to_channel(const float value) noexcept -> u8
+{
+  return static_cast<u8>(static_cast<int>(value * 255.0f + 0.5f));
+}
+
+[[nodiscard]] inline auto min3(const float a, const float b, const float c) noexcept
+    -> float
+{
+  const auto ab = (a < b) ? a : b;
+  return (ab < c) ? ab : c;
+}
+
+[[nodiscard]] inline auto max3(const float a, const float b, const float c) noexcept
+    -> float
+{
+  const auto ab = (a > b) ? a : b;
+  return (ab > c) ? ab : c;
+}
+
+// The hue in [0, 6) of channels in [0, 255], where the denominator is at least 1
+[[nodiscard]] inline auto hue_sector(const float r,
+                                     const float g,
+                                     const float b,
+                                     const float max,
+                                     const float denominator) noexcept -> float
+{
+  if (max == r)
+  {
+    const auto hue = (g - b) / denominator;
+    return (hue < 0) ? hue + 6.0f : hue;
+  }
+  else if (max == g)
+  {
+    return (b - r) / denominator + 2.0f;
+  }
+  else
+  {
+    return (r - g) / denominator + 4.0f;
+  }
+}
+
+/// \name Scalar kernels
+/// \{
+
+inline void lerp_colors_scalar(const u8* a,
+                               const u8* b,
+                               u8* out,
+                               const std::size_t count,
+                               const u32 weight) noexcept
+{
+  for (std::size_t index = 0; index < count * 4u; ++index)
+  {
+    out[index] = static_cast<u8>(lerp_255(a[index], b[index], weight));
+  }
+}
+
+inline void multiply_colors_scalar(const u8* a,
+                                   const u8* b,
+                                   u8* out,
+                                   const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count * 4u; ++index)
+  {
+    out[index] = static_cast<u8>(multiply_255(a[index], b[index]));
+  }
+}
+
+inline void composite_colors_scalar(const u8* src,
+                                    const u8* dst,
+                                    u8* out,
+                                    const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count * 4u; index += 4u)
+  {
+    const u32 alpha = src[index + 3u];
+    for (std::size_t channel = 0; channel < 4u; ++channel)
+    {
+      const auto offset = index + channel;
+      out[offset] = static_cast<u8>(composite_255(src[offset], alpha, dst[offset]));
+    }
+  }
+}
+
+inline void hsv_to_rgb_scalar(const float* hues,
+                              const float* saturations,
+                              const float* values,
+                              u8* out,
+                              const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto h = hues[index] * (1.0f / 60.0f);
+    const auto v = values[index] * 0.01f;
+    const auto vs = v * (saturations[index] * 0.01f);
+
+    const float offsets[] = {5.0f, 3.0f, 1.0f};
+    for (std::size_t channel = 0; channel < 3u; ++channel)
+    {
+      auto k = offsets[channel] + h;
+      k = (k >= 6.0f) ? k - 6.0f : k;
+
+      const auto t = min3(k, 4.0f - k, 1.0f);
+      out[index * 4u + channel] = to_channel(v - vs * ((t > 0) ? t : 0.0f));
+    }
+
+    out[index * 4u + 3u] = 0xFF;
+  }
+}
+
+inline void hsl_to_rgb_scalar(const float* hues,
+                              const float* saturations,
+                              const float* lightnesses,
+                              u8* out,
+                              const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto h = hues[index] * (1.0f / 30.0f);
+    const auto l = lightnesses[index] * 0.01f;
+    const auto inverse = 1.0f - l;
+    const auto a = (saturations[index] * 0.01f) * ((l < inverse) ? l : inverse);
+
+    const float offsets[] = {0.0f, 8.0f, 4.0f};
+    for (std::size_t channel = 0; channel < 3u; ++channel)
+    {
+      auto k = offsets[channel] + h;
+      k = (k >= 12.0f) ? k - 12.0f : k;
+
+      const auto t = min3(k - 3.0f, 9.0f - k, 1.0f);
+      out[index * 4u + channel] = to_channel(l - a * ((t > -1.0f) ? t : -1.0f));
+    }
+
+    out[index * 4u + 3u] = 0xFF;
+  }
+}
+
+inline void rgb_to_hsv_scalar(const u8* colors,
+                              float* hues,
+                              float* saturations,
+                              float* values,
+                              const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto r = static_cast<float>(colors[index * 4u]);
+    const auto g = static_cast<float>(colors[index * 4u + 1u]);
+    const auto b = static_cast<float>(colors[index * 4u + 2u]);
+
+    const auto max = max3(r, g, b);
+    const auto delta = max - min3(r, g, b);
+    const auto denominator = (delta > 1.0f) ? delta : 1.0f;
+
+    hues[index] = hue_sector(r, g, b, max, denominator) * 60.0f;
+    saturations[index] = delta / ((max > 1.0f) ? max : 1.0f) * 100.0f;
+    values[index] = max * (100.0f / 255.0f);
+  }
+}
+
+inline void rgb_to_hsl_scalar(const u8* colors,
+                              float* hues,
+                              float* saturations,
+                              float* lightnesses,
+                              const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto r = static_cast<float>(colors[index * 4u]);
+    const auto g = static_cast<float>(colors[index * 4u + 1u]);
+    const auto b = static_cast<float>(colors[index * 4u + 2u]);
+
+    const auto max = max3(r, g, b);
+    const auto min = min3(r, g, b);
+    const auto delta = max - min;
+    const auto denominator = (delta > 1.0f) ? delta : 1.0f;
+
+    const auto sum = max + min;
+    const auto distance = (sum > 255.0f) ? sum - 255.0f : 255.0f - sum;
+    const auto range = 255.0f - distance;
+
+    hues[index] = hue_sector(r, g, b, max, denominator) * 60.0f;
+    saturations[index] = delta / ((range > 1.0f) ? range : 1.0f) * 100.0f;
+    lightnesses[index] = sum * (50.0f / 255.0f);
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+/// Divides 16-bit values in [0, 65025] by 255, rounded to nearest.
+[[nodiscard]] inline auto divide_255_sse2(const __m128i values) noexcept -> __m128i
+{
+  const auto t = _mm_add_epi16(values, _mm_set1_epi16(128));
+  return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+}
+
+[[nodiscard]] inline auto blend_lanes_sse2(const __m128 mask,
+                                           const __m128 values,
+                                           const __m128 fallback) noexcept -> __m128
+{
+  return _mm_or_ps(_mm_and_ps(mask, values), _mm_andnot_ps(mask, fallback));
+}
+
+inline void lerp_colors_sse2(const u8* a,
+                             const u8* b,
+                             u8* out,
+                             const std::size_t count,
+                             const u32 weight) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+  const auto w = _mm_set1_epi16(static_cast<short>(weight));
+  const auto iw = _mm_set1_epi16(static_cast<short>(255u - weight));
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + index * 4u));
+    const auto y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + index * 4u));
+
+    const auto low = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(x, zero), iw),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(y, zero), w));
+    const auto high = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(x, zero), iw),
+                                    _mm_mullo_epi16(_mm_unpackhi_epi8(y, zero), w));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index * 4u),
+                     _mm_packus_epi16(divide_255_sse2(low), divide_255_sse2(high)));
+  }
+
+  lerp_colors_scalar(a + index * 4u,
+                     b + index * 4u,
+                     out + index * 4u,
+                     count - index,
+                     weight);
+}
+
+inline void multiply_colors_sse2(const u8* a,
+                                 const u8* b,
+                                 u8* out,
+                                 const std::size_t count) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + index * 4u));
+    const auto y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + index * 4u));
+
+    const auto low =
+        _mm_mullo_epi16(_mm_unpacklo_epi8(x, zero), _mm_unpacklo_epi8(y, zero));
+    const auto high =
+        _mm_mullo_epi16(_mm_unpackhi_epi8(x, zero), _mm_unpackhi_epi8(y, zero));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index * 4u),
+                     _mm_packus_epi16(divide_255_sse2(low), divide_255_sse2(high)));
+  }
+
+  multiply_colors_scalar(a + index * 4u, b + index * 4u, out + index * 4u, count - index);
+}
+
+/// Scales two colors, that have been widened to 16-bit channels, by 255 - source alpha.
+[[nodiscard]] inline auto scale_by_inverse_alpha_sse2(const __m128i source,
+                                                      const __m128i destination) noexcept
+    -> __m128i
+{
+  constexpr int order = _MM_SHUFFLE(3, 3, 3, 3);
+
+  const auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(source, order), order);
+  const auto inverse = _mm_sub_epi16(_mm_set1_epi16(255), alpha);
+
+  return divide_255_sse2(_mm_mullo_epi16(destination, inverse));
+}
+
+inline void composite_colors_sse2(const u8* src,
+                                  const u8* dst,
+                                  u8* out,
+                                  const std::size_t count) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index * 4u));
+    const auto d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + index * 4u));
+
+    const auto low = scale_by_inverse_alpha_sse2(_mm_unpacklo_epi8(s, zero),
+                                                 _mm_unpacklo_epi8(d, zero));
+    const auto high = scale_by_inverse_alpha_sse2(_mm_unpackhi_epi8(s, zero),
+                                                  _mm_unpackhi_epi8(d, zero));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + index * 4u),
+                     _mm_adds_epu8(s, _mm_packus_epi16(low, high)));
+  }
+
+  composite_colors_scalar(src + index * 4u,
+                          dst + index * 4u,
+                          out + index * 4u,
+                          count - index);
+}
+
+// Splits four colors into floating-point channels, the bytes are in memory order
+inline void load_channels_sse2(const u8* colors, __m128& r, __m128& g, __m128& b) noexcept
+{
+  const auto mask = _mm_set1_epi32(0xFF);
+  const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colors));
+
+  r = _mm_cvtepi32_ps(_mm_and_si128(values, mask));
+  g = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(values, 8), mask));
+  b = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(values, 16), mask));
+}
+
+// Stores channels in [0, 1] as four opaque colors
+inline void store_channels_sse2(const __m128 r,
+                                const __m128 g,
+                                const __m128 b,
+                                u8* colors) noexcept
+{
+  const auto scale = _mm_set1_ps(255.0f);
+  const auto half = _mm_set1_ps(0.5f);
+
+  const auto red = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(r, scale), half));
+  const auto green = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(g, scale), half));
+  const auto blue = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(b, scale), half));
+
+  const auto alpha = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+  const auto result = _mm_or_si128(_mm_or_si128(red, _mm_slli_epi32(green, 8)),
+                                   _mm_or_si128(_mm_slli_epi32(blue, 16), alpha));
+
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(colors), result);
+}
+
+[[nodiscard]] inline auto hue_sector_sse2(const __m128 r,
+                                          const __m128 g,
+                                          const __m128 b,
+                                          const __m128 max,
+                                          const __m128 denominator) noexcept -> __m128
+{
+  const auto isRed = _mm_cmpeq_ps(max, r);
+  const auto isGreen = _mm_andnot_ps(isRed, _mm_cmpeq_ps(max, g));
+
+  auto red = _mm_div_ps(_mm_sub_ps(g, b), denominator);
+  red = _mm_add_ps(red,
+                   _mm_and_ps(_mm_cmplt_ps(red, _mm_setzero_ps()), _mm_set1_ps(6.0f)));
+
+  const auto green =
+      _mm_add_ps(_mm_div_ps(_mm_sub_ps(b, r), denominator), _mm_set1_ps(2.0f));
+  const auto blue =
+      _mm_add_ps(_mm_div_ps(_mm_sub_ps(r, g), denominator), _mm_set1_ps(4.0f));
+
+  return blend_lanes_sse2(isRed, red, blend_lanes_sse2(isGreen, green, blue));
+}
+
+inline void hsv_to_rgb_sse2(const float* hues,
+                            const float* saturations,
+                            const float* values,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  const auto zero = _mm_setzero_ps();
+  const auto one = _mm_set1_ps(1.0f);
+  const auto four = _mm_set1_ps(4.0f);
+  const auto six = _mm_set1_ps(6.0f);
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto h = _mm_mul_ps(_mm_loadu_ps(hues + index), _mm_set1_ps(1.0f / 60.0f));
+    const auto v = _mm_mul_ps(_mm_loadu_ps(values + index), _mm_set1_ps(0.01f));
+    const auto vs =
+        _mm_mul_ps(v, _mm_mul_ps(_mm_loadu_ps(saturations + index), _mm_set1_ps(0.01f)));
+
+    __m128 channels[3];
+    const float offsets[] = {5.0f, 3.0f, 1.0f};
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      auto k = _mm_add_ps(_mm_set1_ps(offsets[channel]), h);
+      k = _mm_sub_ps(k, _mm_and_ps(_mm_cmpge_ps(k, six), six));
+
+      const auto t = _mm_min_ps(_mm_min_ps(k, _mm_sub_ps(four, k)), one);
+      channels[channel] = _mm_sub_ps(v, _mm_mul_ps(vs, _mm_max_ps(t, zero)));
+    }
+
+    store_channels_sse2(channels[0], channels[1], channels[2], out + index * 4u);
+  }
+
+  hsv_to_rgb_scalar(hues + index,
+                    saturations + index,
+                    values + index,
+                    out + index * 4u,
+                    count - index);
+}
+
+inline void hsl_to_rgb_sse2(const float* hues,
+                            const float* saturations,
+                            const float* lightnesses,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm_set1_ps(1.0f);
+  const auto minusOne = _mm_set1_ps(-1.0f);
+  const auto three = _mm_set1_ps(3.0f);
+  const auto nine = _mm_set1_ps(9.0f);
+  const auto twelve = _mm_set1_ps(12.0f);
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto h = _mm_mul_ps(_mm_loadu_ps(hues + index), _mm_set1_ps(1.0f / 30.0f));
+    const auto l = _mm_mul_ps(_mm_loadu_ps(lightnesses + index), _mm_set1_ps(0.01f));
+    const auto s = _mm_mul_ps(_mm_loadu_ps(saturations + index), _mm_set1_ps(0.01f));
+    const auto a = _mm_mul_ps(s, _mm_min_ps(l, _mm_sub_ps(one, l)));
+
+    __m128 channels[3];
+    const float offsets[] = {0.0f, 8.0f, 4.0f};
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      auto k = _mm_add_ps(_mm_set1_ps(offsets[channel]), h);
+      k = _mm_sub_ps(k, _mm_and_ps(_mm_cmpge_ps(k, twelve), twelve));
+
+      const auto t =
+          _mm_min_ps(_mm_min_ps(_mm_sub_ps(k, three), _mm_sub_ps(nine, k)), one);
+      channels[channel] = _mm_sub_ps(l, _mm_mul_ps(a, _mm_max_ps(t, minusOne)));
+    }
+
+    store_channels_sse2(channels[0], channels[1], channels[2], out + index * 4u);
+  }
+
+  hsl_to_rgb_scalar(hues + index,
+                    saturations + index,
+                    lightnesses + index,
+                    out + index * 4u,
+                    count - index);
+}
+
+inline void rgb_to_hsv_sse2(const u8* colors,
+                            float* hues,
+                            float* saturations,
+                            float* values,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm_set1_ps(1.0f);
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    __m128 r;
+    __m128 g;
+    __m128 b;
+    load_channels_sse2(colors + index * 4u, r, g, b);
+
+    const auto max = _mm_max_ps(_mm_max_ps(r, g), b);
+    const auto delta = _mm_sub_ps(max, _mm_min_ps(_mm_min_ps(r, g), b));
+    const auto denominator = _mm_max_ps(delta, one);
+
+    const auto hue = hue_sector_sse2(r, g, b, max, denominator);
+    const auto saturation = _mm_div_ps(delta, _mm_max_ps(max, one));
+
+    _mm_storeu_ps(hues + index, _mm_mul_ps(hue, _mm_set1_ps(60.0f)));
+    _mm_storeu_ps(saturations + index, _mm_mul_ps(saturation, _mm_set1_ps(100.0f)));
+    _mm_storeu_ps(values + index, _mm_mul_ps(max, _mm_set1_ps(100.0f / 255.0f)));
+  }
+
+  rgb_to_hsv_scalar(colors + index * 4u,
+                    hues + index,
+                    saturations + index,
+                    values + index,
+                    count - index);
+}
+
+inline void rgb_to_hsl_sse2(const u8* colors,
+                            float* hues,
+                            float* saturations,
+                            float* lightnesses,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm_set1_ps(1.0f);
+  const auto full = _mm_set1_ps(255.0f);
+  const auto sign = _mm_set1_ps(-0.0f);
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    __m128 r;
+    __m128 g;
+    __m128 b;
+    load_channels_sse2(colors + index * 4u, r, g, b);
+
+    const auto max = _mm_max_ps(_mm_max_ps(r, g), b);
+    const auto min = _mm_min_ps(_mm_min_ps(r, g), b);
+    const auto delta = _mm_sub_ps(max, min);
+    const auto denominator = _mm_max_ps(delta, one);
+
+    const auto sum = _mm_add_ps(max, min);
+    const auto distance = _mm_andnot_ps(sign, _mm_sub_ps(sum, full));
+    const auto range = _mm_sub_ps(full, distance);
+
+    const auto hue = hue_sector_sse2(r, g, b, max, denominator);
+    const auto saturation = _mm_div_ps(delta, _mm_max_ps(range, one));
+
+    _mm_storeu_ps(hues + index, _mm_mul_ps(hue, _mm_set1_ps(60.0f)));
+    _mm_storeu_ps(saturations + index, _mm_mul_ps(saturation, _mm_set1_ps(100.0f)));
+    _mm_storeu_ps(lightnesses + index, _mm_mul_ps(sum, _mm_set1_ps(50.0f / 255.0f)));
+  }
+
+  rgb_to_hsl_scalar(colors + index * 4u,
+                    hues + index,
+                    saturations + index,
+                    lightnesses + index,
+                    count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+/// \name AVX2 kernels
+/// \{
+
+CENTURION_DETAIL_TARGET_AVX2
+[[nodiscard]] inline auto divide_255_avx2(const __m256i values) noexcept -> __m256i
+{
+  const auto t = _mm256_add_epi16(values, _mm256_set1_epi16(128));
+  return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void lerp_colors_avx2(const u8* a,
+                             const u8* b,
+                             u8* out,
+                             const std::size_t count,
+                             const u32 weight) noexcept
+{
+  const auto zero = _mm256_setzero_si256();
+  const auto w = _mm256_set1_epi16(static_cast<short>(weight));
+  const auto iw = _mm256_set1_epi16(static_cast<short>(255u - weight));
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + index * 4u));
+    const auto y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + index * 4u));
+
+    // The unpacking and packing both operate within 128-bit lanes, so the order is kept
+    const auto low =
+        _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x, zero), iw),
+                         _mm256_mullo_epi16(_mm256_unpacklo_epi8(y, zero), w));
+    const auto high =
+        _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x, zero), iw),
+                         _mm256_mullo_epi16(_mm256_unpackhi_epi8(y, zero), w));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index * 4u),
+                        _mm256_packus_epi16(divide_255_avx2(low), divide_255_avx2(high)));
+  }
+
+  lerp_colors_scalar(a + index * 4u,
+                     b + index * 4u,
+                     out + index * 4u,
+                     count - index,
+                     weight);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void multiply_colors_avx2(const u8* a,
+                                 const u8* b,
+                                 u8* out,
+                                 const std::size_t count) noexcept
+{
+  const auto zero = _mm256_setzero_si256();
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + index * 4u));
+    const auto y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + index * 4u));
+
+    const auto low = _mm256_mullo_epi16(_mm256_unpacklo_epi8(x, zero),
+                                        _mm256_unpacklo_epi8(y, zero));
+    const auto high = _mm256_mullo_epi16(_mm256_unpackhi_epi8(x, zero),
+                                         _mm256_unpackhi_epi8(y, zero));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index * 4u),
+                        _mm256_packus_epi16(divide_255_avx2(low), divide_255_avx2(high)));
+  }
+
+  multiply_colors_scalar(a + index * 4u, b + index * 4u, out + index * 4u, count - index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+[[nodiscard]] inline auto scale_by_inverse_alpha_avx2(const __m256i source,
+                                                      const __m256i destination) noexcept
+    -> __m256i
+{
+  constexpr int order = _MM_SHUFFLE(3, 3, 3, 3);
+
+  const auto alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(source, order), order);
+  const auto inverse = _mm256_sub_epi16(_mm256_set1_epi16(255), alpha);
+
+  return divide_255_avx2(_mm256_mullo_epi16(destination, inverse));
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void composite_colors_avx2(const u8* src,
+                                  const u8* dst,
+                                  u8* out,
+                                  const std::size_t count) noexcept
+{
+  const auto zero = _mm256_setzero_si256();
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto s =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + index * 4u));
+    const auto d =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + index * 4u));
+
+    const auto low = scale_by_inverse_alpha_avx2(_mm256_unpacklo_epi8(s, zero),
+                                                 _mm256_unpacklo_epi8(d, zero));
+    const auto high = scale_by_inverse_alpha_avx2(_mm256_unpackhi_epi8(s, zero),
+                                                  _mm256_unpackhi_epi8(d, zero));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index * 4u),
+                        _mm256_adds_epu8(s, _mm256_packus_epi16(low, high)));
+  }
+
+  composite_colors_scalar(src + index * 4u,
+                          dst + index * 4u,
+                          out + index * 4u,
+                          count - index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void load_channels_avx2(const u8* colors,
+                               __m256& r,
+                               __m256& g,
+                               __m256& b) noexcept
+{
+  const auto mask = _mm256_set1_epi32(0xFF);
+  const auto values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(colors));
+
+  r = _mm256_cvtepi32_ps(_mm256_and_si256(values, mask));
+  g = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(values, 8), mask));
+  b = _mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(values, 16), mask));
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void store_channels_avx2(const __m256 r,
+                                const __m256 g,
+                                const __m256 b,
+                                u8* colors) noexcept
+{
+  const auto scale = _mm256_set1_ps(255.0f);
+  const auto half = _mm256_set1_ps(0.5f);
+
+  const auto red = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(r, scale), half));
+  const auto green = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(g, scale), half));
+  const auto blue = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(b, scale), half));
+
+  const auto alpha = _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+  const auto result =
+      _mm256_or_si256(_mm256_or_si256(red, _mm256_slli_epi32(green, 8)),
+                      _mm256_or_si256(_mm256_slli_epi32(blue, 16), alpha));
+
+  _mm256_storeu_si256(reinterpret_cast<__m256i*>(colors), result);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+[[nodiscard]] inline auto hue_sector_avx2(const __m256 r,
+                                          const __m256 g,
+                                          const __m256 b,
+                                          const __m256 max,
+                                          const __m256 denominator) noexcept -> __m256
+{
+  const auto isRed = _mm256_cmp_ps(max, r, _CMP_EQ_OQ);
+  const auto isGreen = _mm256_cmp_ps(max, g, _CMP_EQ_OQ);
+
+  auto red = _mm256_div_ps(_mm256_sub_ps(g, b), denominator);
+  red = _mm256_add_ps(red,
+                      _mm256_and_ps(_mm256_cmp_ps(red, _mm256_setzero_ps(), _CMP_LT_OQ),
+                                    _mm256_set1_ps(6.0f)));
+
+  const auto two = _mm256_set1_ps(2.0f);
+  const auto four = _mm256_set1_ps(4.0f);
+
+  const auto green = _mm256_add_ps(_mm256_div_ps(_mm256_sub_ps(b, r), denominator), two);
+  const auto blue = _mm256_add_ps(_mm256_div_ps(_mm256_sub_ps(r, g), denominator), four);
+
+  return _mm256_blendv_ps(_mm256_blendv_ps(blue, green, isGreen), red, isRed);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void hsv_to_rgb_avx2(const float* hues,
+                            const float* saturations,
+                            const float* values,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  const auto zero = _mm256_setzero_ps();
+  const auto one = _mm256_set1_ps(1.0f);
+  const auto four = _mm256_set1_ps(4.0f);
+  const auto six = _mm256_set1_ps(6.0f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto h =
+        _mm256_mul_ps(_mm256_loadu_ps(hues + index), _mm256_set1_ps(1.0f / 60.0f));
+    const auto v = _mm256_mul_ps(_mm256_loadu_ps(values + index), _mm256_set1_ps(0.01f));
+    const auto vs = _mm256_mul_ps(
+        v,
+        _mm256_mul_ps(_mm256_loadu_ps(saturations + index), _mm256_set1_ps(0.01f)));
+
+    __m256 channels[3];
+    const float offsets[] = {5.0f, 3.0f, 1.0f};
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      auto k = _mm256_add_ps(_mm256_set1_ps(offsets[channel]), h);
+      k = _mm256_sub_ps(k, _mm256_and_ps(_mm256_cmp_ps(k, six, _CMP_GE_OQ), six));
+
+      const auto t = _mm256_min_ps(_mm256_min_ps(k, _mm256_sub_ps(four, k)), one);
+      channels[channel] = _mm256_sub_ps(v, _mm256_mul_ps(vs, _mm256_max_ps(t, zero)));
+    }
+
+    store_channels_avx2(channels[0], channels[1], channels[2], out + index * 4u);
+  }
+
+  hsv_to_rgb_scalar(hues + index,
+                    saturations + index,
+                    values + index,
+                    out + index * 4u,
+                    count - index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void hsl_to_rgb_avx2(const float* hues,
+                            const float* saturations,
+                            const float* lightnesses,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm256_set1_ps(1.0f);
+  const auto minusOne = _mm256_set1_ps(-1.0f);
+  const auto three = _mm256_set1_ps(3.0f);
+  const auto nine = _mm256_set1_ps(9.0f);
+  const auto twelve = _mm256_set1_ps(12.0f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto h =
+        _mm256_mul_ps(_mm256_loadu_ps(hues + index), _mm256_set1_ps(1.0f / 30.0f));
+    const auto l =
+        _mm256_mul_ps(_mm256_loadu_ps(lightnesses + index), _mm256_set1_ps(0.01f));
+    const auto s =
+        _mm256_mul_ps(_mm256_loadu_ps(saturations + index), _mm256_set1_ps(0.01f));
+    const auto a = _mm256_mul_ps(s, _mm256_min_ps(l, _mm256_sub_ps(one, l)));
+
+    __m256 channels[3];
+    const float offsets[] = {0.0f, 8.0f, 4.0f};
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      auto k = _mm256_add_ps(_mm256_set1_ps(offsets[channel]), h);
+      k = _mm256_sub_ps(k, _mm256_and_ps(_mm256_cmp_ps(k, twelve, _CMP_GE_OQ), twelve));
+
+      const auto t = _mm256_min_ps(
+          _mm256_min_ps(_mm256_sub_ps(k, three), _mm256_sub_ps(nine, k)),
+          one);
+      channels[channel] = _mm256_sub_ps(l, _mm256_mul_ps(a, _mm256_max_ps(t, minusOne)));
+    }
+
+    store_channels_avx2(channels[0], channels[1], channels[2], out + index * 4u);
+  }
+
+  hsl_to_rgb_scalar(hues + index,
+                    saturations + index,
+                    lightnesses + index,
+                    out + index * 4u,
+                    count - index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void rgb_to_hsv_avx2(const u8* colors,
+                            float* hues,
+                            float* saturations,
+                            float* values,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm256_set1_ps(1.0f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    __m256 r;
+    __m256 g;
+    __m256 b;
+    load_channels_avx2(colors + index * 4u, r, g, b);
+
+    const auto max = _mm256_max_ps(_mm256_max_ps(r, g), b);
+    const auto delta = _mm256_sub_ps(max, _mm256_min_ps(_mm256_min_ps(r, g), b));
+    const auto denominator = _mm256_max_ps(delta, one);
+
+    const auto hue = hue_sector_avx2(r, g, b, max, denominator);
+    const auto saturation = _mm256_div_ps(delta, _mm256_max_ps(max, one));
+
+    _mm256_storeu_ps(hues + index, _mm256_mul_ps(hue, _mm256_set1_ps(60.0f)));
+    _mm256_storeu_ps(saturations + index,
+                     _mm256_mul_ps(saturation, _mm256_set1_ps(100.0f)));
+    _mm256_storeu_ps(values + index,
+                     _mm256_mul_ps(max, _mm256_set1_ps(100.0f / 255.0f)));
+  }
+
+  rgb_to_hsv_scalar(colors + index * 4u,
+                    hues + index,
+                    saturations + index,
+                    values + index,
+                    count - index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void rgb_to_hsl_avx2(const u8* colors,
+                            float* hues,
+                            float* saturations,
+                            float* lightnesses,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm256_set1_ps(1.0f);
+  const auto full = _mm256_set1_ps(255.0f);
+  const auto sign = _mm256_set1_ps(-0.0f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    __m256 r;
+    __m256 g;
+    __m256 b;
+    load_channels_avx2(colors + index * 4u, r, g, b);
+
+    const auto max = _mm256_max_ps(_mm256_max_ps(r, g), b);
+    const auto min = _mm256_min_ps(_mm256_min_ps(r, g), b);
+    const auto delta = _mm256_sub_ps(max, min);
+    const auto denominator = _mm256_max_ps(delta, one);
+
+    const auto sum = _mm256_add_ps(max, min);
+    const auto distance = _mm256_andnot_ps(sign, _mm256_sub_ps(sum, full));
+    const auto range = _mm256_sub_ps(full, distance);
+
+    const auto hue = hue_sector_avx2(r, g, b, max, denominator);
+    const auto saturation = _mm256_div_ps(delta, _mm256_max_ps(range, one));
+
+    _mm256_storeu_ps(hues + index, _mm256_mul_ps(hue, _mm256_set1_ps(60.0f)));
+    _mm256_storeu_ps(saturations + index,
+                     _mm256_mul_ps(saturation, _mm256_set1_ps(100.0f)));
+    _mm256_storeu_ps(lightnesses + index,
+                     _mm256_mul_ps(sum, _mm256_set1_ps(50.0f / 255.0f)));
+  }
+
+  rgb_to_hsl_scalar(colors + index * 4u,
+                    hues + index,
+                    saturations + index,
+                    lightnesses + index,
+                    count - index);
+}
+
+/// \} End of AVX2 kernels
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+/// Divides 16-bit values in [0, 65025] by 255, rounded to nearest, and narrows them.
+[[nodiscard]] inline auto divide_255_neon(const uint16x8_t values) noexcept -> uint8x8_t
+{
+  const auto t = vaddq_u16(values, vdupq_n_u16(128));
+  return vshrn_n_u16(vsraq_n_u16(t, t, 8), 8);
+}
+
+[[nodiscard]] inline auto divide_neon(const float32x4_t a, const float32x4_t b) noexcept
+    -> float32x4_t
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vdivq_f32(a, b);
+#else
+  // 32-bit ARM has no vector division, so the reciprocal is refined twice
+  auto reciprocal = vrecpeq_f32(b);
+  reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+  reciprocal = vmulq_f32(vrecpsq_f32(b, reciprocal), reciprocal);
+  return vmulq_f32(a, reciprocal);
+#endif
+}
+
+inline void lerp_colors_neon(const u8* a,
+                             const u8* b,
+                             u8* out,
+                             const std::size_t count,
+                             const u32 weight) noexcept
+{
+  const auto w = vdup_n_u8(static_cast<u8>(weight));
+  const auto iw = vdup_n_u8(static_cast<u8>(255u - weight));
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto x = vld1q_u8(a + index * 4u);
+    const auto y = vld1q_u8(b + index * 4u);
+
+    const auto low = vmlal_u8(vmull_u8(vget_low_u8(x), iw), vget_low_u8(y), w);
+    const auto high = vmlal_u8(vmull_u8(vget_high_u8(x), iw), vget_high_u8(y), w);
+
+    vst1q_u8(out + index * 4u, vcombine_u8(divide_255_neon(low), divide_255_neon(high)));
+  }
+
+  lerp_colors_scalar(a + index * 4u,
+                     b + index * 4u,
+                     out + index * 4u,
+                     count - index,
+                     weight);
+}
+
+inline void multiply_colors_neon(const u8* a,
+                                 const u8* b,
+                                 u8* out,
+                                 const std::size_t count) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto x = vld1q_u8(a + index * 4u);
+    const auto y = vld1q_u8(b + index * 4u);
+
+    const auto low = vmull_u8(vget_low_u8(x), vget_low_u8(y));
+    const auto high = vmull_u8(vget_high_u8(x), vget_high_u8(y));
+
+    vst1q_u8(out + index * 4u, vcombine_u8(divide_255_neon(low), divide_255_neon(high)));
+  }
+
+  multiply_colors_scalar(a + index * 4u, b + index * 4u, out + index * 4u, count - index);
+}
+
+inline void composite_colors_neon(const u8* src,
+                                  const u8* dst,
+                                  u8* out,
+                                  const std::size_t count) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    // Deinterleaves eight colors into separate channels
+    const auto s = vld4_u8(src + index * 4u);
+    const auto d = vld4_u8(dst + index * 4u);
+    const auto inverse = vmvn_u8(s.val[3]);
+
+    uint8x8x4_t result;
+    for (int channel = 0; channel < 4; ++channel)
+    {
+      const auto scaled = divide_255_neon(vmull_u8(d.val[channel], inverse));
+      result.val[channel] = vqadd_u8(s.val[channel], scaled);
+    }
+
+    vst4_u8(out + index * 4u, result);
+  }
+
+  composite_colors_scalar(src + index * 4u,
+                          dst + index * 4u,
+                          out + index * 4u,
+                          count - index);
+}
+
+// Widens eight 8-bit channels to two vectors of floats
+inline void widen_channel_neon(const uint8x8_t channel,
+                               float32x4_t& low,
+                               float32x4_t& high) noexcept
+{
+  const auto wide = vmovl_u8(channel);
+  low = vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide)));
+  high = vcvtq_f32_u32(vmovl_u16(vget_high_u16(wide)));
+}
+
+// Converts two vectors of channels in [0, 1] to eight 8-bit channels
+[[nodiscard]] inline auto narrow_channel_neon(const float32x4_t low,
+                                              const float32x4_t high) noexcept
+    -> uint8x8_t
+{
+  const auto scale = vdupq_n_f32(255.0f);
+  const auto half = vdupq_n_f32(0.5f);
+
+  const auto lo = vcvtq_u32_f32(vaddq_f32(vmulq_f32(low, scale), half));
+  const auto hi = vcvtq_u32_f32(vaddq_f32(vmulq_f32(high, scale), half));
+
+  return vmovn_u16(vcombine_u16(vmovn_u32(lo), vmovn_u32(hi)));
+}
+
+[[nodiscard]] inline auto hue_sector_neon(const float32x4_t r,
+                                          const float32x4_t g,
+                                          const float32x4_t b,
+                                          const float32x4_t max,
+                                          const float32x4_t denominator) noexcept
+    -> float32x4_t
+{
+  auto red = divide_neon(vsubq_f32(g, b), denominator);
+  red = vbslq_f32(vcltq_f32(red, vdupq_n_f32(0)), vaddq_f32(red, vdupq_n_f32(6)), red);
+
+  const auto green = vaddq_f32(divide_neon(vsubq_f32(b, r), denominator), vdupq_n_f32(2));
+  const auto blue = vaddq_f32(divide_neon(vsubq_f32(r, g), denominator), vdupq_n_f32(4));
+
+  return vbslq_f32(vceqq_f32(max, r),
+                   red,
+                   vbslq_f32(vceqq_f32(max, g), green, blue));
+}
+
+[[nodiscard]] inline auto hsv_channel_neon(const float offset,
+                                           const float32x4_t h,
+                                           const float32x4_t v,
+                                           const float32x4_t vs) noexcept -> float32x4_t
+{
+  const auto six = vdupq_n_f32(6.0f);
+
+  auto k = vaddq_f32(vdupq_n_f32(offset), h);
+  k = vbslq_f32(vcgeq_f32(k, six), vsubq_f32(k, six), k);
+
+  const auto t = vminq_f32(vminq_f32(k, vsubq_f32(vdupq_n_f32(4.0f), k)), vdupq_n_f32(1));
+  return vsubq_f32(v, vmulq_f32(vs, vmaxq_f32(t, vdupq_n_f32(0))));
+}
+
+[[nodiscard]] inline auto hsl_channel_neon(const float offset,
+                                           const float32x4_t h,
+                                           const float32x4_t l,
+                                           const float32x4_t a) noexcept -> float32x4_t
+{
+  const auto twelve = vdupq_n_f32(12.0f);
+
+  auto k = vaddq_f32(vdupq_n_f32(offset), h);
+  k = vbslq_f32(vcgeq_f32(k, twelve), vsubq_f32(k, twelve), k);
+
+  const auto t = vminq_f32(vminq_f32(vsubq_f32(k, vdupq_n_f32(3.0f)),
+                                     vsubq_f32(vdupq_n_f32(9.0f), k)),
+                           vdupq_n_f32(1));
+  return vsubq_f32(l, vmulq_f32(a, vmaxq_f32(t, vdupq_n_f32(-1))));
+}
+
+inline void hsv_to_rgb_neon(const float* hues,
+                            const float* saturations,
+                            const float* values,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    float32x4_t channels[3][2];
+    for (int half = 0; half < 2; ++half)
+    {
+      const auto offset = index + static_cast<std::size_t>(half) * 4u;
+
+      const auto h = vmulq_n_f32(vld1q_f32(hues + offset), 1.0f / 60.0f);
+      const auto v = vmulq_n_f32(vld1q_f32(values + offset), 0.01f);
+      const auto vs = vmulq_f32(v, vmulq_n_f32(vld1q_f32(saturations + offset), 0.01f));
+
+      channels[0][half] = hsv_channel_neon(5.0f, h, v, vs);
+      channels[1][half] = hsv_channel_neon(3.0f, h, v, vs);
+      channels[2][half] = hsv_channel_neon(1.0f, h, v, vs);
+    }
+
+    uint8x8x4_t result;
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      const auto& channelHalves = channels[channel];
+      result.val[channel] = narrow_channel_neon(channelHalves[0], channelHalves[1]);
+    }
+
+    result.val[3] = vdup_n_u8(0xFF);
+    vst4_u8(out + index * 4u, result);
+  }
+
+  hsv_to_rgb_scalar(hues + index,
+                    saturations + index,
+                    values + index,
+                    out + index * 4u,
+                    count - index);
+}
+
+inline void hsl_to_rgb_neon(const float* hues,
+                            const float* saturations,
+                            const float* lightnesses,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    float32x4_t channels[3][2];
+    for (int half = 0; half < 2; ++half)
+    {
+      const auto offset = index + static_cast<std::size_t>(half) * 4u;
+
+      const auto h = vmulq_n_f32(vld1q_f32(hues + offset), 1.0f / 30.0f);
+      const auto l = vmulq_n_f32(vld1q_f32(lightnesses + offset), 0.01f);
+      const auto s = vmulq_n_f32(vld1q_f32(saturations + offset), 0.01f);
+      const auto a = vmulq_f32(s, vminq_f32(l, vsubq_f32(vdupq_n_f32(1.0f), l)));
+
+      channels[0][half] = hsl_channel_neon(0.0f, h, l, a);
+      channels[1][half] = hsl_channel_neon(8.0f, h, l, a);
+      channels[2][half] = hsl_channel_neon(4.0f, h, l, a);
+    }
+
+    uint8x8x4_t result;
+    for (int channel = 0; channel < 3; ++channel)
+    {
+      const auto& channelHalves = channels[channel];
+      result.val[channel] = narrow_channel_neon(channelHalves[0], channelHalves[1]);
+    }
+
+    result.val[3] = vdup_n_u8(0xFF);
+    vst4_u8(out + index * 4u, result);
+  }
+
+  hsl_to_rgb_scalar(hues + index,
+                    saturations + index,
+                    lightnesses + index,
+                    out + index * 4u,
+                    count - index);
+}
+
+inline void rgb_to_hsv_neon(const u8* colors,
+                            float* hues,
+                            float* saturations,
+                            float* values,
+                            const std::size_t count) noexcept
+{
+  const auto one = vdupq_n_f32(1.0f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto channels = vld4_u8(colors + index * 4u);
+
+    float32x4_t r[2];
+    float32x4_t g[2];
+    float32x4_t b[2];
+    widen_channel_neon(channels.val[0], r[0], r[1]);
+    widen_channel_neon(channels.val[1], g[0], g[1]);
+    widen_channel_neon(channels.val[2], b[0], b[1]);
+
+    for (int half = 0; half < 2; ++half)
+    {
+      const auto offset = index + static_cast<std::size_t>(half) * 4u;
+
+      const auto max = vmaxq_f32(vmaxq_f32(r[half], g[half]), b[half]);
+      const auto delta = vsubq_f32(max, vminq_f32(vminq_f32(r[half], g[half]), b[half]));
+      const auto denominator = vmaxq_f32(delta, one);
+
+      const auto hue = hue_sector_neon(r[half], g[half], b[half], max, denominator);
+      const auto saturation = divide_neon(delta, vmaxq_f32(max, one));
+
+      vst1q_f32(hues + offset, vmulq_n_f32(hue, 60.0f));
+      vst1q_f32(saturations + offset, vmulq_n_f32(saturation, 100.0f));
+      vst1q_f32(values + offset, vmulq_n_f32(max, 100.0f / 255.0f));
+    }
+  }
+
+  rgb_to_hsv_scalar(colors + index * 4u,
+                    hues + index,
+                    saturations + index,
+                    values + index,
+                    count - index);
+}
+
+inline void rgb_to_hsl_neon(const u8* colors,
+                            float* hues,
+                            float* saturations,
+                            float* lightnesses,
+                            const std::size_t count) noexcept
+{
+  const auto one = vdupq_n_f32(1.0f);
+  const auto full = vdupq_n_f32(255.0f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto channels = vld4_u8(colors + index * 4u);
+
+    float32x4_t r[2];
+    float32x4_t g[2];
+    float32x4_t b[2];
+    widen_channel_neon(channels.val[0], r[0], r[1]);
+    widen_channel_neon(channels.val[1], g[0], g[1]);
+    widen_channel_neon(channels.val[2], b[0], b[1]);
+
+    for (int half = 0; half < 2; ++half)
+    {
+      const auto offset = index + static_cast<std::size_t>(half) * 4u;
+
+      const auto max = vmaxq_f32(vmaxq_f32(r[half], g[half]), b[half]);
+      const auto min = vminq_f32(vminq_f32(r[half], g[half]), b[half]);
+      const auto delta = vsubq_f32(max, min);
+      const auto denominator = vmaxq_f32(delta, one);
+
+      const auto sum = vaddq_f32(max, min);
+      const auto range = vsubq_f32(full, vabsq_f32(vsubq_f32(sum, full)));
+
+      const auto hue = hue_sector_neon(r[half], g[half], b[half], max, denominator);
+      const auto saturation = divide_neon(delta, vmaxq_f32(range, one));
+
+      vst1q_f32(hues + offset, vmulq_n_f32(hue, 60.0f));
+      vst1q_f32(saturations + offset, vmulq_n_f32(saturation, 100.0f));
+      vst1q_f32(lightnesses + offset, vmulq_n_f32(sum, 50.0f / 255.0f));
+    }
+  }
+
+  rgb_to_hsl_scalar(colors + index * 4u,
+                    hues + index,
+                    saturations + index,
+                    lightnesses + index,
+                    count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Interpolates between two sequences of colors, by a weight in [0, 255].
+inline void lerp_colors(const simd_level level,
+                        const u8* a,
+                        const u8* b,
+                        u8* out,
+                        const std::size_t count,
+                        const u32 weight) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      lerp_colors_avx2(a, b, out, count, weight);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      lerp_colors_sse2(a, b, out, count, weight);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      lerp_colors_neon(a, b, out, count, weight);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      lerp_colors_scalar(a, b, out, count, weight);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Multiplies the channels of two sequences of colors.
+inline void multiply_colors(const simd_level level,
+                            const u8* a,
+                            const u8* b,
+                            u8* out,
+                            const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      multiply_colors_avx2(a, b, out, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      multiply_colors_sse2(a, b, out, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      multiply_colors_neon(a, b, out, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      multiply_colors_scalar(a, b, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Composites premultiplied source colors over premultiplied destination colors.
+inline void composite_colors(const simd_level level,
+                             const u8* src,
+                             const u8* dst,
+                             u8* out,
+                             const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      composite_colors_avx2(src, dst, out, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      composite_colors_sse2(src, dst, out, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      composite_colors_neon(src, dst, out, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      composite_colors_scalar(src, dst, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Converts HSV values to opaque colors.
+inline void hsv_to_rgb(const simd_level level,
+                       const float* hues,
+                       const float* saturations,
+                       const float* values,
+                       u8* out,
+                       const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      hsv_to_rgb_avx2(hues, saturations, values, out, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      hsv_to_rgb_sse2(hues, saturations, values, out, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      hsv_to_rgb_neon(hues, saturations, values, out, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      hsv_to_rgb_scalar(hues, saturations, values, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Converts HSL values to opaque colors.
+inline void hsl_to_rgb(const simd_level level,
+                       const float* hues,
+                       const float* saturations,
+                       const float* lightnesses,
+                       u8* out,
+                       const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      hsl_to_rgb_avx2(hues, saturations, lightnesses, out, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      hsl_to_rgb_sse2(hues, saturations, lightnesses, out, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      hsl_to_rgb_neon(hues, saturations, lightnesses, out, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      hsl_to_rgb_scalar(hues, saturations, lightnesses, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Converts colors to HSV values, the alpha values are ignored.
+inline void rgb_to_hsv(const simd_level level,
+                       const u8* colors,
+                       float* hues,
+                       float* saturations,
+                       float* values,
+                       const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      rgb_to_hsv_avx2(colors, hues, saturations, values, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      rgb_to_hsv_sse2(colors, hues, saturations, values, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      rgb_to_hsv_neon(colors, hues, saturations, values, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      rgb_to_hsv_scalar(colors, hues, saturations, values, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Converts colors to HSL values, the alpha values are ignored.
+inline void rgb_to_hsl(const simd_level level,
+                       const u8* colors,
+                       float* hues,
+                       float* saturations,
+                       float* lightnesses,
+                       const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      rgb_to_hsl_avx2(colors, hues, saturations, lightnesses, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      rgb_to_hsl_sse2(colors, hues, saturations, lightnesses, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      rgb_to_hsl_neon(colors, hues, saturations, lightnesses, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      rgb_to_hsl_scalar(colors, hues, saturations, lightnesses, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+using composite_function = void(const u8*, const u8*, u8*, std::size_t) noexcept;
+
+/// The composite kernels, called with the implementation of the current instruction set.
+inline constexpr simd_kernel<composite_function> composite_kernel{
+    &composite_colors_scalar,
+    CENTURION_DETAIL_SSE2_KERNEL(composite_colors_sse2),
+    CENTURION_DETAIL_AVX2_KERNEL(composite_colors_avx2),
+    CENTURION_DETAIL_NEON_KERNEL(composite_colors_neon)};
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_COLOR_KERNELS_HEADER
@@ -15,6 +15,26 @@ struct czstring_compare final
   }
 };
 
+// Orders C-style strings lexicographically, where null strings precede all other strings
+struct czstring_less final
+{
+  constexpr auto operator()(const czstring lhs, const czstring rhs) const noexcept -> bool
+  {
+    if (!lhs || !rhs)
+    {
+      return !lhs && rhs;
+    }
+
+    auto* a = lhs;
+    auto* b = rhs;
+
+    for (; *a != '\0' && *a == *b; ++a, ++b)
+    {}
+
+    return static_cast<unsigned char>(*a) < static_cast<unsigned char>(*b);
+  }
+};
+
 }  // namespace cen::detail
 /// \endcond
 
@@ -0,0 +1,153 @@
+#ifndef CENTURION_DETAIL_DEFERRED_FORMAT_HEADER
+#define CENTURION_DETAIL_DEFERRED_FORMAT_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>      // size_t
+#include <cstring>      // memcpy, strlen
+#include <string_view>  // string_view
+#include <tuple>        // tuple, apply
+#include <type_traits>  // conditional_t, decay_t, is_same_v, is_arithmetic_v, ...
+
+#include "../core/czstring.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Deferred messages store the raw bytes of their format arguments, so that formatting
+ * can be postponed to another thread. The arguments are stored back to back in native
+ * byte order, without any padding:
+ *
+ *   Numbers and pointers:  the bytes of the (decayed) value
+ *   Strings:               the characters, followed by a null-terminator
+ *
+ * Strings are copied, since they might not outlive the message, and truncated so that
+ * all of the other arguments still fit in the buffer. The format string isn't stored,
+ * it's identified by its address, i.e. it must have static storage duration.
+ */
+
+// The type that is stored for an argument, all character pointers are stored as strings
+template <typename T>
+using deferred_t = std::conditional_t<std::is_same_v<std::decay_t<T>, char*>,
+                                      czstring,
+                                      std::decay_t<T>>;
+
+template <typename T>
+inline constexpr bool is_deferred_string_v = std::is_same_v<deferred_t<T>, czstring>;
+
+template <typename T>
+inline constexpr bool is_deferrable_v =
+    std::is_arithmetic_v<deferred_t<T>> || std::is_pointer_v<deferred_t<T>>;
+
+// The amount of bytes that are needed for the arguments, with the strings left empty
+template <typename... Args>
+inline constexpr std::size_t deferred_min_size =
+    ((is_deferred_string_v<Args> ? 1u : sizeof(deferred_t<Args>)) + ... + 0u);
+
+using deferred_formatter = int (*)(czstring fmt,
+                                   const char* arguments,
+                                   char* buffer,
+                                   std::size_t size) noexcept;
+
+template <typename T>
+void encode_argument(char* out,
+                     std::size_t& offset,
+                     std::size_t& available,
+                     const T& value) noexcept
+{
+  if constexpr (is_deferred_string_v<T>)
+  {
+    const czstring ptr = value;  // Decays arrays
+    const std::string_view str{ptr ? ptr : ""};
+    const auto count = (str.size() < available) ? str.size() : available;
+
+    str.copy(out + offset, count);
+    out[offset + count] = '\0';
+
+    offset += count + 1u;
+    available -= count;
+  }
+  else
+  {
+    const deferred_t<T> stored = value;
+    std::memcpy(out + offset, &stored, sizeof stored);
+    offset += sizeof stored;
+  }
+}
+
+/**
+ * \brief Stores the format arguments of a deferred message.
+ *
+ * \param[out] out the buffer that receives the arguments.
+ * \param size the size of the buffer, must be at least `deferred_min_size<Args...>`.
+ * \param args the format arguments.
+ *
+ * \return the amount of written bytes.
+ */
+template <typename... Args>
+auto encode_arguments([[maybe_unused]] char* out,
+                      const std::size_t size,
+                      const Args&... args) noexcept -> std::size_t
+{
+  std::size_t offset = 0;
+  [[maybe_unused]] std::size_t available = size - deferred_min_size<Args...>;
+
+  (encode_argument(out, offset, available, args), ...);
+
+  return offset;
+}
+
+template <typename T>
+[[nodiscard]] auto decode_argument(const char* in, std::size_t& offset) noexcept -> T
+{
+  if constexpr (std::is_same_v<T, czstring>)
+  {
+    const auto* str = in + offset;
+    offset += std::strlen(str) + 1u;
+    return str;
+  }
+  else
+  {
+    T value;
+    std::memcpy(&value, in + offset, sizeof value);
+    offset += sizeof value;
+    return value;
+  }
+}
+
+/**
+ * \brief Formats a deferred message with `printf` semantics.
+ *
+ * \details Pointers to instantiations of this function are stored along with the
+ * arguments of a message, in order to restore their types.
+ *
+ * \tparam Args the stored argument types, i.e. `deferred_t` of each argument.
+ *
+ * \param fmt the format string.
+ * \param arguments the arguments written by `encode_arguments()`.
+ * \param[out] buffer the buffer that receives the message.
+ * \param size the size of the buffer.
+ *
+ * \return the length of the complete message, like `SDL_snprintf()`.
+ */
+template <typename... Args>
+auto format_arguments(const czstring fmt,
+                      [[maybe_unused]] const char* arguments,
+                      char* buffer,
+                      const std::size_t size) noexcept -> int
+{
+  [[maybe_unused]] std::size_t offset = 0;
+
+  // Arguments in braced initializers are evaluated in order
+  const std::tuple<Args...> values{decode_argument<Args>(arguments, offset)...};
+
+  return std::apply(
+      [=](const Args&... args) { return SDL_snprintf(buffer, size, fmt, args...); },
+      values);
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_DEFERRED_FORMAT_HEADER
@@ -0,0 +1,185 @@
+#ifndef CENTURION_DETAIL_DISTANCE_FIELD_HEADER
+#define CENTURION_DETAIL_DISTANCE_FIELD_HEADER
+
+#include <algorithm>  // clamp, max
+#include <cmath>      // sqrt, lround
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/memory_resource.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+inline constexpr float edt_infinity = 1e20f;
+
+/**
+ * \brief Computes the one-dimensional squared Euclidean distance transform of a sampled
+ * function, using the lower envelope of parabolas (Felzenszwalb and Huttenlocher).
+ *
+ * \param f the sampled function, of size `n`, that will be replaced by its transform.
+ * \param n the amount of samples.
+ * \param v scratch buffer of size `n`.
+ * \param z scratch buffer of size `n + 1`.
+ * \param d scratch buffer of size `n`.
+ */
+inline void squared_edt_1d(float* f, const int n, int* v, float* z, float* d)
+{
+  int k = 0;
+  v[0] = 0;
+  z[0] = -edt_infinity;
+  z[1] = edt_infinity;
+
+  for (int q = 1; q < n; ++q)
+  {
+    auto s = 0.0f;
+    while (true)
+    {
+      const auto r = v[k];
+      s = ((f[q] + static_cast<float>(q * q)) - (f[r] + static_cast<float>(r * r))) /
+          static_cast<float>(2 * q - 2 * r);
+
+      if (s > z[k] || k == 0)
+      {
+        break;
+      }
+
+      --k;
+    }
+
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = edt_infinity;
+  }
+
+  k = 0;
+  for (int q = 0; q < n; ++q)
+  {
+    while (z[k + 1] < static_cast<float>(q))
+    {
+      ++k;
+    }
+
+    const auto dx = static_cast<float>(q - v[k]);
+    d[q] = dx * dx + f[v[k]];
+  }
+
+  std::copy(d, d + n, f);
+}
+
+/// Replaces a grid of zeroes (features) and infinities by squared feature distances.
+inline void squared_edt_2d(float* grid, const int width, const int height)
+{
+  const auto n = static_cast<std::size_t>((std::max)(width, height));
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  // The buffers are only needed during this call, so they use the scratch arena
+  scratch_scope scratch;
+  std::pmr::vector<float> line(n, scratch.get());
+  std::pmr::vector<int> v(n, scratch.get());
+  std::pmr::vector<float> z(n + 1u, scratch.get());
+  std::pmr::vector<float> d(n, scratch.get());
+#else
+  std::vector<float> line(n);
+  std::vector<int> v(n);
+  std::vector<float> z(n + 1u);
+  std::vector<float> d(n);
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  for (int x = 0; x < width; ++x)
+  {
+    for (int y = 0; y < height; ++y)
+    {
+      line[y] = grid[y * width + x];
+    }
+
+    squared_edt_1d(line.data(), height, v.data(), z.data(), d.data());
+
+    for (int y = 0; y < height; ++y)
+    {
+      grid[y * width + x] = line[y];
+    }
+  }
+
+  for (int y = 0; y < height; ++y)
+  {
+    squared_edt_1d(grid + y * width, width, v.data(), z.data(), d.data());
+  }
+}
+
+/**
+ * \brief Creates a signed distance field from a coverage mask.
+ *
+ * \details The field is larger than the mask by `spread` pixels on each side. A value of
+ * 128 corresponds to the outline, larger values are inside the shape and smaller values
+ * are outside of it. Distances beyond `spread` pixels are clamped.
+ *
+ * \param coverage the coverage mask, e.g. the alpha channel of a rendered glyph.
+ * \param width the width of the mask.
+ * \param height the height of the mask.
+ * \param pitch the amount of bytes between consecutive rows in the mask.
+ * \param stride the amount of bytes between consecutive pixels in the mask.
+ * \param spread the maximum represented distance, in pixels.
+ *
+ * \return the distance field, with `(width + 2 * spread) * (height + 2 * spread)` values.
+ */
+[[nodiscard]] inline auto make_distance_field(const u8* coverage,
+                                              const int width,
+                                              const int height,
+                                              const int pitch,
+                                              const int stride,
+                                              const int spread) -> std::vector<u8>
+{
+  const auto fieldWidth = width + 2 * spread;
+  const auto fieldHeight = height + 2 * spread;
+  const auto count = static_cast<std::size_t>(fieldWidth * fieldHeight);
+
+  // Distances to the closest pixel inside and outside of the shape, respectively
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  scratch_scope scratch;
+  std::pmr::vector<float> toInside(count, edt_infinity, scratch.get());
+  std::pmr::vector<float> toOutside(count, 0.0f, scratch.get());
+#else
+  std::vector<float> toInside(count, edt_infinity);
+  std::vector<float> toOutside(count, 0.0f);
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  for (int y = 0; y < height; ++y)
+  {
+    for (int x = 0; x < width; ++x)
+    {
+      if (coverage[y * pitch + x * stride] >= 128u)
+      {
+        const auto index = (y + spread) * fieldWidth + (x + spread);
+        toInside[index] = 0.0f;
+        toOutside[index] = edt_infinity;
+      }
+    }
+  }
+
+  squared_edt_2d(toInside.data(), fieldWidth, fieldHeight);
+  squared_edt_2d(toOutside.data(), fieldWidth, fieldHeight);
+
+  std::vector<u8> field(count);
+
+  const auto scale = 127.5f / static_cast<float>((std::max)(spread, 1));
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    // The outline is halfway between the centers of an inside and an outside pixel
+    const auto distance = (toInside[index] > 0.0f)
+                              ? std::sqrt(toInside[index]) - 0.5f
+                              : 0.5f - std::sqrt(toOutside[index]);
+
+    const auto value = std::clamp(127.5f - distance * scale, 0.0f, 255.0f);
+    field[index] = static_cast<u8>(std::lround(value));
+  }
+
+  return field;
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_DISTANCE_FIELD_HEADER
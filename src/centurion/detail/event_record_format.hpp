@@ -0,0 +1,124 @@
+#ifndef CENTURION_DETAIL_EVENT_RECORD_FORMAT_HEADER
+#define CENTURION_DETAIL_EVENT_RECORD_FORMAT_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Event recordings start with a header, followed by a sequence of records. All values
+ * are stored in little-endian byte order.
+ *
+ *   Header:
+ *     u8[8]  magic, "CENEVREC"
+ *     u32    format version
+ *     u32    sizeof(SDL_Event), recordings are only valid for compatible SDL builds
+ *
+ *   Record:
+ *     u32    microseconds since the previous record
+ *     u16    payload size, zero for frame markers
+ *     u8[]   the first bytes of the SDL_Event, i.e. the struct of the event type, in
+ *            native byte order
+ */
+
+inline constexpr char event_record_magic[8] = {'C', 'E', 'N', 'E', 'V', 'R', 'E', 'C'};
+inline constexpr u32 event_record_version = 1;
+inline constexpr std::size_t event_record_header_size = 16;
+inline constexpr std::size_t event_record_prefix_size = 6;
+
+// Returns the amount of bytes of an SDL_Event that are relevant for its type
+[[nodiscard]] constexpr auto event_payload_size(const u32 type) noexcept -> std::size_t
+{
+  switch (type)
+  {
+    case SDL_QUIT:
+      return sizeof(SDL_QuitEvent);
+
+    case SDL_WINDOWEVENT:
+      return sizeof(SDL_WindowEvent);
+
+    case SDL_KEYDOWN:
+    case SDL_KEYUP:
+      return sizeof(SDL_KeyboardEvent);
+
+    case SDL_TEXTEDITING:
+      return sizeof(SDL_TextEditingEvent);
+
+    case SDL_TEXTINPUT:
+      return sizeof(SDL_TextInputEvent);
+
+    case SDL_MOUSEMOTION:
+      return sizeof(SDL_MouseMotionEvent);
+
+    case SDL_MOUSEBUTTONDOWN:
+    case SDL_MOUSEBUTTONUP:
+      return sizeof(SDL_MouseButtonEvent);
+
+    case SDL_MOUSEWHEEL:
+      return sizeof(SDL_MouseWheelEvent);
+
+    case SDL_JOYAXISMOTION:
+      return sizeof(SDL_JoyAxisEvent);
+
+    case SDL_JOYBALLMOTION:
+      return sizeof(SDL_JoyBallEvent);
+
+    case SDL_JOYHATMOTION:
+      return sizeof(SDL_JoyHatEvent);
+
+    case SDL_JOYBUTTONDOWN:
+    case SDL_JOYBUTTONUP:
+      return sizeof(SDL_JoyButtonEvent);
+
+    case SDL_JOYDEVICEADDED:
+    case SDL_JOYDEVICEREMOVED:
+      return sizeof(SDL_JoyDeviceEvent);
+
+    case SDL_CONTROLLERAXISMOTION:
+      return sizeof(SDL_ControllerAxisEvent);
+
+    case SDL_CONTROLLERBUTTONDOWN:
+    case SDL_CONTROLLERBUTTONUP:
+      return sizeof(SDL_ControllerButtonEvent);
+
+    case SDL_CONTROLLERDEVICEADDED:
+    case SDL_CONTROLLERDEVICEREMOVED:
+    case SDL_CONTROLLERDEVICEREMAPPED:
+      return sizeof(SDL_ControllerDeviceEvent);
+
+    case SDL_FINGERMOTION:
+    case SDL_FINGERDOWN:
+    case SDL_FINGERUP:
+      return sizeof(SDL_TouchFingerEvent);
+
+    case SDL_DOLLARGESTURE:
+    case SDL_DOLLARRECORD:
+      return sizeof(SDL_DollarGestureEvent);
+
+    case SDL_MULTIGESTURE:
+      return sizeof(SDL_MultiGestureEvent);
+
+    case SDL_DROPBEGIN:
+    case SDL_DROPCOMPLETE:
+    case SDL_DROPFILE:
+    case SDL_DROPTEXT:
+      return sizeof(SDL_DropEvent);
+
+    case SDL_AUDIODEVICEADDED:
+    case SDL_AUDIODEVICEREMOVED:
+      return sizeof(SDL_AudioDeviceEvent);
+
+    default:
+      return sizeof(SDL_Event);
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_EVENT_RECORD_FORMAT_HEADER
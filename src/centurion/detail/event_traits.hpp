@@ -0,0 +1,357 @@
+#ifndef CENTURION_DETAIL_EVENT_TRAITS_HEADER
+#define CENTURION_DETAIL_EVENT_TRAITS_HEADER
+
+#include <SDL.h>
+
+#include <array>        // array
+#include <type_traits>  // remove_reference_t
+#include <utility>      // declval
+
+#include "../core/integers.hpp"
+#include "../events/audio_device_event.hpp"
+#include "../events/controller_axis_event.hpp"
+#include "../events/controller_button_event.hpp"
+#include "../events/controller_device_event.hpp"
+#include "../events/dollar_gesture_event.hpp"
+#include "../events/drop_event.hpp"
+#include "../events/joy_axis_event.hpp"
+#include "../events/joy_ball_event.hpp"
+#include "../events/joy_button_event.hpp"
+#include "../events/joy_device_event.hpp"
+#include "../events/joy_hat_event.hpp"
+#include "../events/keyboard_event.hpp"
+#include "../events/mouse_button_event.hpp"
+#include "../events/mouse_motion_event.hpp"
+#include "../events/mouse_wheel_event.hpp"
+#include "../events/multi_gesture_event.hpp"
+#include "../events/quit_event.hpp"
+#include "../events/text_editing_event.hpp"
+#include "../events/text_input_event.hpp"
+#include "../events/touch_finger_event.hpp"
+#include "../events/window_event.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Maps each event wrapper to the SDL event types that it represents, which is shared by
+ * cen::event and the event dispatcher. The member pointers refer to the member of the
+ * SDL_Event union that stores the payload, and the make() functions create the wrapper
+ * from it.
+ */
+
+template <typename Event>
+struct event_traits;
+
+template <>
+struct event_traits<quit_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_QUIT};
+
+  inline static constexpr auto member = &SDL_Event::quit;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> quit_event
+  {
+    return quit_event{event.quit};
+  }
+};
+
+template <>
+struct event_traits<audio_device_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_AUDIODEVICEADDED,
+                                                      SDL_AUDIODEVICEREMOVED};
+
+  inline static constexpr auto member = &SDL_Event::adevice;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> audio_device_event
+  {
+    return audio_device_event{event.adevice};
+  }
+};
+
+template <>
+struct event_traits<controller_axis_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_CONTROLLERAXISMOTION};
+
+  inline static constexpr auto member = &SDL_Event::caxis;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept
+      -> controller_axis_event
+  {
+    return controller_axis_event{event.caxis};
+  }
+};
+
+template <>
+struct event_traits<controller_button_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_CONTROLLERBUTTONDOWN,
+                                                      SDL_CONTROLLERBUTTONUP};
+
+  inline static constexpr auto member = &SDL_Event::cbutton;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept
+      -> controller_button_event
+  {
+    return controller_button_event{event.cbutton};
+  }
+};
+
+template <>
+struct event_traits<controller_device_event> final
+{
+  inline static constexpr std::array<u32, 3> types = {SDL_CONTROLLERDEVICEADDED,
+                                                      SDL_CONTROLLERDEVICEREMOVED,
+                                                      SDL_CONTROLLERDEVICEREMAPPED};
+
+  inline static constexpr auto member = &SDL_Event::cdevice;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept
+      -> controller_device_event
+  {
+    return controller_device_event{event.cdevice};
+  }
+};
+
+template <>
+struct event_traits<dollar_gesture_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_DOLLARGESTURE,
+                                                      SDL_DOLLARRECORD};
+
+  inline static constexpr auto member = &SDL_Event::dgesture;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> dollar_gesture_event
+  {
+    return dollar_gesture_event{event.dgesture};
+  }
+};
+
+template <>
+struct event_traits<drop_event> final
+{
+  inline static constexpr std::array<u32, 4> types = {SDL_DROPBEGIN,
+                                                      SDL_DROPCOMPLETE,
+                                                      SDL_DROPFILE,
+                                                      SDL_DROPTEXT};
+
+  inline static constexpr auto member = &SDL_Event::drop;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> drop_event
+  {
+    return drop_event{event.drop};
+  }
+};
+
+template <>
+struct event_traits<joy_axis_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_JOYAXISMOTION};
+
+  inline static constexpr auto member = &SDL_Event::jaxis;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> joy_axis_event
+  {
+    return joy_axis_event{event.jaxis};
+  }
+};
+
+template <>
+struct event_traits<joy_ball_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_JOYBALLMOTION};
+
+  inline static constexpr auto member = &SDL_Event::jball;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> joy_ball_event
+  {
+    return joy_ball_event{event.jball};
+  }
+};
+
+template <>
+struct event_traits<joy_button_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_JOYBUTTONDOWN, SDL_JOYBUTTONUP};
+
+  inline static constexpr auto member = &SDL_Event::jbutton;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> joy_button_event
+  {
+    return joy_button_event{event.jbutton};
+  }
+};
+
+template <>
+struct event_traits<joy_device_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_JOYDEVICEADDED,
+                                                      SDL_JOYDEVICEREMOVED};
+
+  inline static constexpr auto member = &SDL_Event::jdevice;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> joy_device_event
+  {
+    return joy_device_event{event.jdevice};
+  }
+};
+
+template <>
+struct event_traits<joy_hat_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_JOYHATMOTION};
+
+  inline static constexpr auto member = &SDL_Event::jhat;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> joy_hat_event
+  {
+    return joy_hat_event{event.jhat};
+  }
+};
+
+template <>
+struct event_traits<keyboard_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_KEYDOWN, SDL_KEYUP};
+
+  inline static constexpr auto member = &SDL_Event::key;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> keyboard_event
+  {
+    return keyboard_event{event.key};
+  }
+};
+
+template <>
+struct event_traits<mouse_button_event> final
+{
+  inline static constexpr std::array<u32, 2> types = {SDL_MOUSEBUTTONDOWN,
+                                                      SDL_MOUSEBUTTONUP};
+
+  inline static constexpr auto member = &SDL_Event::button;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> mouse_button_event
+  {
+    return mouse_button_event{event.button};
+  }
+};
+
+template <>
+struct event_traits<mouse_motion_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_MOUSEMOTION};
+
+  inline static constexpr auto member = &SDL_Event::motion;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> mouse_motion_event
+  {
+    return mouse_motion_event{event.motion};
+  }
+};
+
+template <>
+struct event_traits<mouse_wheel_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_MOUSEWHEEL};
+
+  inline static constexpr auto member = &SDL_Event::wheel;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> mouse_wheel_event
+  {
+    return mouse_wheel_event{event.wheel};
+  }
+};
+
+template <>
+struct event_traits<multi_gesture_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_MULTIGESTURE};
+
+  inline static constexpr auto member = &SDL_Event::mgesture;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> multi_gesture_event
+  {
+    return multi_gesture_event{event.mgesture};
+  }
+};
+
+template <>
+struct event_traits<text_editing_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_TEXTEDITING};
+
+  inline static constexpr auto member = &SDL_Event::edit;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> text_editing_event
+  {
+    return text_editing_event{event.edit};
+  }
+};
+
+template <>
+struct event_traits<text_input_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_TEXTINPUT};
+
+  inline static constexpr auto member = &SDL_Event::text;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> text_input_event
+  {
+    return text_input_event{event.text};
+  }
+};
+
+template <>
+struct event_traits<touch_finger_event> final
+{
+  inline static constexpr std::array<u32, 3> types = {SDL_FINGERMOTION,
+                                                      SDL_FINGERDOWN,
+                                                      SDL_FINGERUP};
+
+  inline static constexpr auto member = &SDL_Event::tfinger;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> touch_finger_event
+  {
+    return touch_finger_event{event.tfinger};
+  }
+};
+
+template <>
+struct event_traits<window_event> final
+{
+  inline static constexpr std::array<u32, 1> types = {SDL_WINDOWEVENT};
+
+  inline static constexpr auto member = &SDL_Event::window;
+
+  [[nodiscard]] static auto make(const SDL_Event& event) noexcept -> window_event
+  {
+    return window_event{event.window};
+  }
+};
+
+// The SDL event type stored by an event wrapper, e.g. SDL_KeyboardEvent
+template <typename Event>
+using sdl_event_t = std::remove_reference_t<
+    decltype(std::declval<SDL_Event&>().*event_traits<Event>::member)>;
+
+// Indicates whether an SDL event type is represented by an event wrapper
+template <typename Event>
+[[nodiscard]] constexpr auto is_event_type(const u32 type) noexcept -> bool
+{
+  for (const auto candidate : event_traits<Event>::types)
+  {
+    if (candidate == type)
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_EVENT_TRAITS_HEADER
@@ -0,0 +1,285 @@
+#ifndef CENTURION_DETAIL_FLAT_ID_MAP_HEADER
+#define CENTURION_DETAIL_FLAT_ID_MAP_HEADER
+
+#include <array>      // array
+#include <cstddef>    // size_t
+#include <memory>     // unique_ptr, make_unique
+#include <optional>   // optional
+#include <stdexcept>  // out_of_range
+#include <utility>    // forward, pair
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \brief A map from integer IDs to values, with stable references.
+ *
+ * \details The IDs are stored in a flat hash table that uses open addressing with linear
+ * probing, which maps them to indices of the values. The values are stored in fixed-size
+ * chunks of slots, which are never moved, so references to values remain valid until
+ * the values are erased. The slots of erased values are reused by later insertions.
+ *
+ * \tparam Key the type of the IDs, an integer type.
+ * \tparam Value the type of the stored values.
+ *
+ * \since 6.1.0
+ */
+template <typename Key, typename Value>
+class flat_id_map final
+{
+ public:
+  inline constexpr static std::size_t chunk_size = 16;
+
+  /**
+   * \brief Creates a value, if there is no value associated with the ID.
+   *
+   * \return a pointer to the value associated with the ID, and `true` if the value was
+   * created; `false` otherwise.
+   */
+  template <typename... Args>
+  auto try_emplace(const Key id, Args&&... args) -> std::pair<Value*, bool>
+  {
+    if (auto* value = find(id))
+    {
+      return {value, false};
+    }
+
+    if ((m_size + 1u) * 2u > m_entries.size())
+    {
+      grow();
+    }
+
+    if (m_free.empty())
+    {
+      add_chunk();
+    }
+
+    const auto index = m_free.back();
+    auto& slot = value_slot(index);
+    slot.emplace(std::forward<Args>(args)...);  // Nothing is modified if this throws
+    m_free.pop_back();
+
+    auto& entry = m_entries[probe(id)];
+    entry.id = id;
+    entry.index = index;
+
+    ++m_size;
+    return {&*slot, true};
+  }
+
+  /**
+   * \brief Removes the value associated with an ID, if there is one.
+   *
+   * \return the amount of removed values.
+   */
+  auto erase(const Key id) noexcept -> std::size_t
+  {
+    if (m_entries.empty())
+    {
+      return 0;
+    }
+
+    auto hole = probe(id);
+    if (m_entries[hole].index == npos)
+    {
+      return 0;
+    }
+
+    const auto index = m_entries[hole].index;
+    value_slot(index).reset();
+    m_free.push_back(index);  // Cannot throw, the free list has room for every slot
+
+    // Shifts the following entries of the cluster back, so that no tombstones are needed
+    const auto mask = m_entries.size() - 1u;
+    auto next = hole;
+    for (;;)
+    {
+      next = (next + 1u) & mask;
+      if (m_entries[next].index == npos)
+      {
+        break;
+      }
+
+      const auto home = home_of(m_entries[next].id);
+      const auto distanceToHole = (hole - home) & mask;
+      const auto distanceToNext = (next - home) & mask;
+      if (distanceToHole <= distanceToNext)
+      {
+        m_entries[hole] = m_entries[next];
+        hole = next;
+      }
+    }
+
+    m_entries[hole].index = npos;
+
+    --m_size;
+    return 1;
+  }
+
+  void clear() noexcept
+  {
+    m_entries.clear();
+    m_chunks.clear();
+    m_free.clear();
+    m_size = 0;
+    m_shift = 64;
+  }
+
+  [[nodiscard]] auto find(const Key id) noexcept -> Value*
+  {
+    if (m_entries.empty())
+    {
+      return nullptr;
+    }
+
+    const auto& entry = m_entries[probe(id)];
+    return (entry.index != npos) ? &*value_slot(entry.index) : nullptr;
+  }
+
+  [[nodiscard]] auto find(const Key id) const noexcept -> const Value*
+  {
+    if (m_entries.empty())
+    {
+      return nullptr;
+    }
+
+    const auto& entry = m_entries[probe(id)];
+    return (entry.index != npos) ? &*value_slot(entry.index) : nullptr;
+  }
+
+  /// \throws std::out_of_range if there is no value associated with the ID.
+  [[nodiscard]] auto at(const Key id) -> Value&
+  {
+    if (auto* value = find(id))
+    {
+      return *value;
+    }
+    else
+    {
+      throw std::out_of_range{"flat_id_map::at"};
+    }
+  }
+
+  /// \copydoc at()
+  [[nodiscard]] auto at(const Key id) const -> const Value&
+  {
+    if (const auto* value = find(id))
+    {
+      return *value;
+    }
+    else
+    {
+      throw std::out_of_range{"flat_id_map::at"};
+    }
+  }
+
+  [[nodiscard]] auto contains(const Key id) const noexcept -> bool
+  {
+    return find(id) != nullptr;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+ private:
+  inline constexpr static u32 npos = 0xFFFF'FFFFu;
+
+  using chunk_type = std::array<std::optional<Value>, chunk_size>;
+
+  struct entry_type final
+  {
+    Key id{};
+    u32 index{npos};  // The index of the value slot, or npos for empty entries
+  };
+
+  std::vector<entry_type> m_entries;
+  std::vector<std::unique_ptr<chunk_type>> m_chunks;
+  std::vector<u32> m_free;  // Indices of empty value slots
+  std::size_t m_size{};
+  u32 m_shift{64};  // 64 - log2 of the amount of entries
+
+  /// Returns the index of the entry where the probing for an ID starts.
+  [[nodiscard]] auto home_of(const Key id) const noexcept -> std::size_t
+  {
+    // Fibonacci hashing, which uses the high bits of the product since they depend on all
+    // bits of the ID. The low bits only depend on the low bits of the ID, so IDs that are
+    // multiples of a power of two, e.g. handles with a generation, would collide.
+    const auto product = static_cast<u64>(id) * 0x9E37'79B9'7F4A'7C15u;
+    return static_cast<std::size_t>(product >> m_shift);
+  }
+
+  [[nodiscard]] auto value_slot(const u32 index) noexcept -> std::optional<Value>&
+  {
+    return (*m_chunks[index / chunk_size])[index % chunk_size];
+  }
+
+  [[nodiscard]] auto value_slot(const u32 index) const noexcept
+      -> const std::optional<Value>&
+  {
+    return (*m_chunks[index / chunk_size])[index % chunk_size];
+  }
+
+  /// Returns the index of the entry of the ID, or of the empty entry where it belongs.
+  [[nodiscard]] auto probe(const Key id) const noexcept -> std::size_t
+  {
+    const auto mask = m_entries.size() - 1u;
+
+    auto index = home_of(id);
+    while (m_entries[index].index != npos && m_entries[index].id != id)
+    {
+      index = (index + 1u) & mask;
+    }
+
+    return index;
+  }
+
+  void add_chunk()
+  {
+    const auto first = static_cast<u32>(m_chunks.size() * chunk_size);
+    const auto last = static_cast<u32>(first + chunk_size);
+
+    m_free.reserve(last);  // Room for every slot, so that erasing cannot throw
+    m_chunks.push_back(std::make_unique<chunk_type>());
+
+    // Pushed in reverse, so that the slots are used in order
+    for (auto index = last; index > first; --index)
+    {
+      m_free.push_back(index - 1u);
+    }
+  }
+
+  void grow()
+  {
+    std::vector<entry_type> old(m_entries.empty() ? 16u : m_entries.size() * 2u);
+    old.swap(m_entries);
+
+    m_shift = 64;
+    for (auto size = m_entries.size(); size > 1u; size /= 2u)
+    {
+      --m_shift;
+    }
+
+    for (const auto& entry : old)
+    {
+      if (entry.index != npos)
+      {
+        m_entries[probe(entry.id)] = entry;
+      }
+    }
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_FLAT_ID_MAP_HEADER
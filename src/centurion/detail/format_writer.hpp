@@ -0,0 +1,198 @@
+#ifndef CENTURION_DETAIL_FORMAT_WRITER_HEADER
+#define CENTURION_DETAIL_FORMAT_WRITER_HEADER
+
+#include <array>         // array
+#include <charconv>      // to_chars
+#include <cstddef>       // size_t
+#include <cstdio>        // snprintf
+#include <string>        // string
+#include <string_view>   // string_view
+#include <system_error>  // errc
+#include <type_traits>   // is_floating_point_v, void_t
+#include <utility>       // declval
+
+#include "../compiler/compiler.hpp"
+#include "../core/czstring.hpp"
+#include "../core/sfinae.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \brief Writes textual representations into a fixed-size character buffer.
+ *
+ * \details The writer follows the semantics of `snprintf`, i.e. the output is truncated
+ * to fit in the buffer and is always null-terminated (unless the buffer size is zero),
+ * while `length()` returns the length of the complete, untruncated output. No memory is
+ * allocated.
+ *
+ * \details Numbers are formatted like `detail::to_string()` would, so that the output
+ * of `to_string()` and `format_to()` is identical.
+ *
+ * \since 6.1.0
+ */
+class format_writer final
+{
+ public:
+  format_writer(char* buffer, const std::size_t size) noexcept
+      : m_buffer{buffer}
+      , m_size{size}
+  {
+    if (m_size != 0)
+    {
+      m_buffer[0] = '\0';
+    }
+  }
+
+  /**
+   * \brief Appends a series of values, see `append()`.
+   *
+   * \return the length of the complete output.
+   */
+  template <typename... Args>
+  auto write(const Args&... args) noexcept -> std::size_t
+  {
+    (append(args), ...);
+    return m_length;
+  }
+
+  void append(const std::string_view str) noexcept
+  {
+    if (m_length + 1 < m_size)
+    {
+      const auto available = m_size - m_length - 1;
+      const auto count = (str.size() < available) ? str.size() : available;
+
+      str.copy(m_buffer + m_length, count);
+      m_buffer[m_length + count] = '\0';
+    }
+
+    m_length += str.size();
+  }
+
+  void append(const czstring str) noexcept
+  {
+    append(std::string_view{str ? str : ""});
+  }
+
+  void append(const std::string& str) noexcept
+  {
+    append(std::string_view{str});
+  }
+
+  void append(const char ch) noexcept
+  {
+    append(std::string_view{&ch, 1});
+  }
+
+  /// Appends the address of a pointer, nothing is appended for null pointers.
+  void append(const void* ptr) noexcept
+  {
+    if (ptr)
+    {
+      std::array<char, 32> buffer{};
+      const auto count = std::snprintf(buffer.data(), buffer.size(), "%p", ptr);
+      append_printed(buffer.data(), count);
+    }
+  }
+
+  template <typename T, enable_if_number_t<T> = 0>
+  void append(const T value) noexcept
+  {
+    std::array<char, 32> buffer{};
+    if constexpr (std::is_floating_point_v<T> && (on_gcc() || on_clang()))
+    {
+      // Equivalent to std::to_string, which detail::to_string() uses on GCC and Clang
+      const auto number = static_cast<double>(value);
+      const auto count = std::snprintf(buffer.data(), buffer.size(), "%f", number);
+
+      if (count > 0 && static_cast<std::size_t>(count) >= buffer.size())
+      {
+        // Huge values are printed straight into the buffer
+        if (m_length + 1 < m_size)
+        {
+          std::snprintf(m_buffer + m_length, m_size - m_length, "%f", number);
+        }
+
+        m_length += static_cast<std::size_t>(count);
+      }
+      else
+      {
+        append_printed(buffer.data(), count);
+      }
+    }
+    else
+    {
+      const auto first = buffer.data();
+      if (const auto [last, error] = std::to_chars(first, first + buffer.size(), value);
+          error == std::errc{})
+      {
+        append(std::string_view{first, static_cast<std::size_t>(last - first)});
+      }
+    }
+  }
+
+  /// Returns the length of the complete output, excluding the null-terminator.
+  [[nodiscard]] auto length() const noexcept -> std::size_t
+  {
+    return m_length;
+  }
+
+ private:
+  char* m_buffer{};
+  std::size_t m_size{};
+  std::size_t m_length{};
+
+  void append_printed(const char* str, const int count) noexcept
+  {
+    if (count > 0)
+    {
+      append(std::string_view{str, static_cast<std::size_t>(count)});
+    }
+  }
+};
+
+/// Indicates whether or not a `format_to()` overload is available for a type.
+template <typename T, typename = void>
+inline constexpr bool is_formattable_v = false;
+
+template <typename T>
+inline constexpr bool is_formattable_v<
+    T,
+    std::void_t<decltype(format_to(std::declval<char*>(),
+                                   std::declval<std::size_t>(),
+                                   std::declval<const T&>()))>> = true;
+
+/**
+ * \brief Returns a string created with the `format_to()` overload of a type.
+ *
+ * \details Representations of up to 127 characters don't require any memory apart from
+ * the returned string.
+ *
+ * \param value the value that will be converted.
+ *
+ * \return a textual representation of the value.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+[[nodiscard]] auto format_string(const T& value) -> std::string
+{
+  std::array<char, 128> buffer{};
+  const auto length = format_to(buffer.data(), buffer.size(), value);
+  if (length < buffer.size())
+  {
+    return std::string{buffer.data(), length};
+  }
+  else
+  {
+    std::string result(length, '\0');
+    format_to(result.data(), length + 1, value);
+    return result;
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_FORMAT_WRITER_HEADER
@@ -0,0 +1,125 @@
+#ifndef CENTURION_DETAIL_FRAME_ARENA_HEADER
+#define CENTURION_DETAIL_FRAME_ARENA_HEADER
+
+#include <cstddef>  // size_t, byte
+#include <memory>   // unique_ptr, make_unique
+#include <vector>   // vector
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * A bump allocator whose memory is released all at once. Resetting the arena keeps the
+ * blocks that have been allocated so far, so once an arena has grown to the size needed
+ * by a frame, subsequent frames don't allocate any memory at all.
+ */
+class frame_arena final
+{
+ public:
+  explicit frame_arena(const std::size_t blockSize) noexcept
+      : m_blockSize{(blockSize > 0) ? blockSize : std::size_t{1'024}}
+  {}
+
+  // Returns uninitialized memory, the arena doesn't run any destructors
+  [[nodiscard]] auto allocate(const std::size_t size, const std::size_t alignment)
+      -> void*
+  {
+    if (m_block < m_blocks.size())
+    {
+      if (auto* memory = try_allocate(m_blocks[m_block], size, alignment))
+      {
+        return memory;
+      }
+    }
+
+    // Move on to the next retained block that is large enough, or add a new one
+    const auto required = size + alignment;
+    for (++m_block; m_block < m_blocks.size(); ++m_block)
+    {
+      m_offset = 0;
+      if (auto* memory = try_allocate(m_blocks[m_block], size, alignment))
+      {
+        return memory;
+      }
+    }
+
+    const auto capacity = (required > m_blockSize) ? required : m_blockSize;
+    m_blocks.push_back(block{std::make_unique<std::byte[]>(capacity), capacity});
+
+    m_block = m_blocks.size() - 1u;
+    m_offset = 0;
+
+    return try_allocate(m_blocks.back(), size, alignment);
+  }
+
+  // A position in the arena, allocations made after it can be released with rewind()
+  struct marker final
+  {
+    std::size_t block{};
+    std::size_t offset{};
+  };
+
+  void reset() noexcept
+  {
+    m_block = 0;
+    m_offset = 0;
+  }
+
+  [[nodiscard]] auto mark() const noexcept -> marker
+  {
+    return {m_block, m_offset};
+  }
+
+  void rewind(const marker position) noexcept
+  {
+    m_block = position.block;
+    m_offset = position.offset;
+  }
+
+  // Returns the total size of the blocks owned by the arena
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t
+  {
+    std::size_t total = 0;
+    for (const auto& b : m_blocks)
+    {
+      total += b.size;
+    }
+
+    return total;
+  }
+
+ private:
+  struct block final
+  {
+    std::unique_ptr<std::byte[]> data;
+    std::size_t size{};
+  };
+
+  std::vector<block> m_blocks;
+  std::size_t m_blockSize{};
+  std::size_t m_block{};
+  std::size_t m_offset{};
+
+  [[nodiscard]] auto try_allocate(block& target,
+                                  const std::size_t size,
+                                  const std::size_t alignment) noexcept -> void*
+  {
+    const auto address = reinterpret_cast<std::size_t>(target.data.get()) + m_offset;
+    const auto padding = (alignment - address % alignment) % alignment;
+
+    if (m_offset + padding + size > target.size)
+    {
+      return nullptr;
+    }
+
+    auto* memory = target.data.get() + m_offset + padding;
+    m_offset += padding + size;
+
+    return memory;
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_FRAME_ARENA_HEADER
@@ -0,0 +1,91 @@
+#ifndef CENTURION_DETAIL_GL_FUNCTIONS_HEADER
+#define CENTURION_DETAIL_GL_FUNCTIONS_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * OpenGL functions are loaded at runtime, since applications aren't required to link
+ * against an OpenGL library, and since functions beyond OpenGL 1.1 aren't exported by
+ * the system libraries on all platforms. The functions must be loaded while a context
+ * is current, and are valid for all contexts with the same pixel format.
+ */
+
+template <typename F>
+[[nodiscard]] auto load_gl_function(const char* name) noexcept -> F
+{
+  return reinterpret_cast<F>(SDL_GL_GetProcAddress(name));
+}
+
+struct gl_sync_functions final
+{
+  using flush_function = void(APIENTRY*)();
+
+  PFNGLFENCESYNCPROC fenceSync{load_gl_function<PFNGLFENCESYNCPROC>("glFenceSync")};
+  PFNGLCLIENTWAITSYNCPROC clientWaitSync{
+      load_gl_function<PFNGLCLIENTWAITSYNCPROC>("glClientWaitSync")};
+  PFNGLDELETESYNCPROC deleteSync{load_gl_function<PFNGLDELETESYNCPROC>("glDeleteSync")};
+  flush_function flush{load_gl_function<flush_function>("glFlush")};
+  flush_function finish{load_gl_function<flush_function>("glFinish")};
+
+  // Fences require OpenGL 3.2 or GL_ARB_sync
+  [[nodiscard]] auto has_sync() const noexcept -> bool
+  {
+    return fenceSync && clientWaitSync && deleteSync;
+  }
+
+  enum class wait_status
+  {
+    signaled,
+    timed_out,
+    failed  // E.g. the context was lost, waiting again would never succeed
+  };
+
+  // Blocks until the fence is signaled, or until the timeout (in nanoseconds) expires
+  auto wait(const GLsync fence, const GLuint64 timeout) const noexcept -> wait_status
+  {
+    switch (clientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, timeout))
+    {
+      case GL_ALREADY_SIGNALED:
+      case GL_CONDITION_SATISFIED:
+        return wait_status::signaled;
+
+      case GL_TIMEOUT_EXPIRED:
+        return wait_status::timed_out;
+
+      default:
+        return wait_status::failed;
+    }
+  }
+
+  // Waits until the fence is signaled, returns false if waiting failed
+  auto wait(const GLsync fence) const noexcept -> bool
+  {
+    constexpr GLuint64 timeout = 1'000'000'000;  // One second, in nanoseconds
+
+    auto status = wait(fence, timeout);
+    while (status == wait_status::timed_out)
+    {
+      status = wait(fence, timeout);
+    }
+
+    return status == wait_status::signaled;
+  }
+
+  [[nodiscard]] auto is_signaled(const GLsync fence) const noexcept -> bool
+  {
+    const auto res = clientWaitSync(fence, 0, 0);
+    return res == GL_ALREADY_SIGNALED || res == GL_CONDITION_SATISFIED;
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_DETAIL_GL_FUNCTIONS_HEADER
@@ -0,0 +1,159 @@
+#ifndef CENTURION_DETAIL_GLYPH_TABLE_HEADER
+#define CENTURION_DETAIL_GLYPH_TABLE_HEADER
+
+#include <array>     // array
+#include <cstddef>   // size_t
+#include <optional>  // optional
+#include <utility>   // move
+#include <vector>    // vector
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \brief A lookup table for glyph data, optimized for Latin-1 text.
+ *
+ * \details Glyphs in the range [0, 256) are stored in a directly indexed array, so that
+ * looking them up is a single array access. Other glyphs are stored in a flat hash table
+ * that uses open addressing with linear probing, which avoids the pointer chasing of
+ * node-based maps.
+ *
+ * \note Values cannot be removed, since glyphs are never evicted from font caches.
+ *
+ * \tparam Value the type of the stored values, must be move-constructible.
+ * \tparam Key the type of the glyph keys, an unsigned integer type. Wider keys can be
+ * used to store several variants of each glyph in the same table.
+ *
+ * \since 6.1.0
+ */
+template <typename Value, typename Key = u16>
+class glyph_table final
+{
+ public:
+  inline constexpr static std::size_t dense_size = 256;
+
+  /**
+   * \brief Inserts a value, if there is no value associated with the glyph.
+   *
+   * \return `true` if the value was inserted; `false` otherwise.
+   */
+  auto try_emplace(const Key glyph, Value&& value) -> bool
+  {
+    if (glyph < dense_size)
+    {
+      auto& slot = m_dense[glyph];
+      if (slot)
+      {
+        return false;
+      }
+
+      slot.emplace(std::move(value));
+    }
+    else
+    {
+      if (find(glyph))
+      {
+        return false;
+      }
+
+      if ((m_sparseCount + 1u) * 2u > m_slots.size())
+      {
+        grow();
+      }
+
+      auto& slot = m_slots[probe(glyph)];
+      slot.glyph = glyph;
+      slot.value.emplace(std::move(value));
+
+      ++m_sparseCount;
+    }
+
+    ++m_size;
+    return true;
+  }
+
+  [[nodiscard]] auto find(const Key glyph) const noexcept -> const Value*
+  {
+    if (glyph < dense_size)
+    {
+      const auto& slot = m_dense[glyph];
+      return slot ? &*slot : nullptr;
+    }
+    else if (m_slots.empty())
+    {
+      return nullptr;
+    }
+    else
+    {
+      const auto& slot = m_slots[probe(glyph)];
+      return slot.value ? &*slot.value : nullptr;
+    }
+  }
+
+  [[nodiscard]] auto contains(const Key glyph) const noexcept -> bool
+  {
+    return find(glyph) != nullptr;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+ private:
+  struct slot_type final
+  {
+    Key glyph{};
+    std::optional<Value> value;
+  };
+
+  std::array<std::optional<Value>, dense_size> m_dense{};
+  std::vector<slot_type> m_slots;
+  std::size_t m_sparseCount{};
+  std::size_t m_size{};
+
+  /// Returns the index of the slot of the glyph, or of the empty slot where it belongs.
+  [[nodiscard]] auto probe(const Key glyph) const noexcept -> std::size_t
+  {
+    const auto mask = m_slots.size() - 1u;
+
+    // Multiplicative hashing spreads consecutive code points over the table
+    auto index = (static_cast<std::size_t>(glyph) * 40'503u) & mask;
+    while (m_slots[index].value && m_slots[index].glyph != glyph)
+    {
+      index = (index + 1u) & mask;
+    }
+
+    return index;
+  }
+
+  void grow()
+  {
+    auto old = std::move(m_slots);
+
+    m_slots.clear();
+    m_slots.resize(old.empty() ? 16u : old.size() * 2u);
+
+    for (auto& slot : old)
+    {
+      if (slot.value)
+      {
+        auto& target = m_slots[probe(slot.glyph)];
+        target.glyph = slot.glyph;
+        target.value.emplace(std::move(*slot.value));
+      }
+    }
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_GLYPH_TABLE_HEADER
@@ -15,7 +15,7 @@
 namespace cen::detail {
 
 template <typename Key, std::size_t size>
-using string_map = static_bimap<Key, czstring, czstring_compare, size>;
+using string_map = static_bimap_for<Key, czstring, czstring_compare, czstring_less, size>;
 
 template <typename Derived, typename Arg>
 class crtp_hint
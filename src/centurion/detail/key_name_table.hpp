@@ -0,0 +1,189 @@
+#ifndef CENTURION_DETAIL_KEY_NAME_TABLE_HEADER
+#define CENTURION_DETAIL_KEY_NAME_TABLE_HEADER
+
+#include <SDL.h>
+
+#include <array>    // array
+#include <cstddef>  // size_t
+
+#include "../core/czstring.hpp"
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+[[nodiscard]] constexpr auto ascii_lower(const char ch) noexcept -> char
+{
+  return (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+}
+
+// FNV-1a, case-insensitive for ASCII, since key names are compared like SDL_strcasecmp
+[[nodiscard]] constexpr auto key_name_hash(const czstring name) noexcept -> u32
+{
+  u32 hash = 2'166'136'261u;
+  for (auto* it = name; *it != '\0'; ++it)
+  {
+    hash ^= static_cast<u8>(ascii_lower(*it));
+    hash *= 16'777'619u;
+  }
+
+  return hash;
+}
+
+[[nodiscard]] constexpr auto key_name_eq(const czstring lhs, const czstring rhs) noexcept
+    -> bool
+{
+  auto* a = lhs;
+  auto* b = rhs;
+
+  for (; *a != '\0' && *b != '\0'; ++a, ++b)
+  {
+    if (ascii_lower(*a) != ascii_lower(*b))
+    {
+      return false;
+    }
+  }
+
+  return *a == *b;
+}
+
+// The smallest power of two that is at least four times the amount of scan codes
+[[nodiscard]] constexpr auto key_name_bucket_count() noexcept -> std::size_t
+{
+  std::size_t count = 1;
+  while (count < SDL_NUM_SCANCODES * 4u)
+  {
+    count *= 2u;
+  }
+
+  return count;
+}
+
+/**
+ * \class key_name_table
+ *
+ * \brief A hash table that maps key names to scan codes and key codes.
+ *
+ * \details The names are obtained from SDL when the table is first used, so that the
+ * results are always the same as `SDL_GetScancodeFromName` and `SDL_GetKeyFromName`, but
+ * without the linear search over all names. The table uses open addressing with linear
+ * probing, and is sized so that it is at most a quarter full.
+ *
+ * \since 6.1.0
+ */
+class key_name_table final
+{
+ public:
+  [[nodiscard]] static auto get() noexcept -> const key_name_table&
+  {
+    static const key_name_table table;
+    return table;
+  }
+
+  // Equivalent to SDL_GetScancodeFromName
+  [[nodiscard]] auto to_scan_code(const czstring name) const noexcept -> SDL_Scancode
+  {
+    if (!name || *name == '\0')
+    {
+      return SDL_SCANCODE_UNKNOWN;
+    }
+
+    auto index = key_name_hash(name) & mask;
+    while (m_buckets[index].name)
+    {
+      if (key_name_eq(m_buckets[index].name, name))
+      {
+        return static_cast<SDL_Scancode>(m_buckets[index].code);
+      }
+
+      index = (index + 1u) & mask;
+    }
+
+    return SDL_SCANCODE_UNKNOWN;
+  }
+
+  // Equivalent to SDL_GetKeyFromName
+  [[nodiscard]] auto to_key_code(const czstring name) const noexcept -> SDL_Keycode
+  {
+    if (!name)
+    {
+      return SDLK_UNKNOWN;
+    }
+
+    const auto first = static_cast<u8>(*name);
+    if (first >= 0xC0u)
+    {
+      return SDL_GetKeyFromName(name);  // Multibyte UTF-8 characters are decoded by SDL
+    }
+    else if (first != 0 && name[1] == '\0')
+    {
+      // Single characters are the key codes themselves
+      return static_cast<SDL_Keycode>(ascii_lower(static_cast<char>(first)));
+    }
+    else
+    {
+      return m_keys[to_scan_code(name)];
+    }
+  }
+
+ private:
+  inline static constexpr std::size_t bucket_count = key_name_bucket_count();
+  inline static constexpr std::size_t mask = bucket_count - 1u;
+
+  struct bucket final
+  {
+    czstring name{};  // Points to the static name table in SDL
+    u16 code{};
+  };
+
+  std::array<bucket, bucket_count> m_buckets{};
+  std::array<SDL_Keycode, SDL_NUM_SCANCODES> m_keys{};
+
+  key_name_table() noexcept
+  {
+    for (int code = 1; code < SDL_NUM_SCANCODES; ++code)
+    {
+      const auto* name = SDL_GetScancodeName(static_cast<SDL_Scancode>(code));
+      if (!name || *name == '\0')
+      {
+        continue;
+      }
+
+      auto index = key_name_hash(name) & mask;
+      bool duplicate = false;
+
+      while (m_buckets[index].name)
+      {
+        // SDL returns the first scan code with a matching name
+        if (key_name_eq(m_buckets[index].name, name))
+        {
+          duplicate = true;
+          break;
+        }
+
+        index = (index + 1u) & mask;
+      }
+
+      if (!duplicate)
+      {
+        m_buckets[index].name = name;
+        m_buckets[index].code = static_cast<u16>(code);
+      }
+    }
+
+    m_keys[SDL_SCANCODE_UNKNOWN] = SDLK_UNKNOWN;
+    for (int code = 1; code < SDL_NUM_SCANCODES; ++code)
+    {
+      const auto* name = SDL_GetScancodeName(static_cast<SDL_Scancode>(code));
+      if (name && *name != '\0')
+      {
+        m_keys[code] = SDL_GetKeyFromName(name);
+      }
+    }
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_KEY_NAME_TABLE_HEADER
@@ -0,0 +1,194 @@
+#ifndef CENTURION_DETAIL_KEYMAP_TABLE_HEADER
+#define CENTURION_DETAIL_KEYMAP_TABLE_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // lower_bound, sort
+#include <array>      // array
+#include <atomic>     // atomic, memory_order_acquire, memory_order_release
+#include <cstddef>    // size_t, ptrdiff_t
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \class keymap_table
+ *
+ * \brief A table that maps key codes to scan codes, according to the current layout.
+ *
+ * \details The table is the inverse of `SDL_GetKeyFromScancode`, so that the results are
+ * the same as `SDL_GetScancodeFromKey`, but without the linear search over the keymap.
+ * Key codes below 256 and key codes of keys without characters, which contain the scan
+ * code, are looked up directly, and the remaining key codes, which only occur with
+ * layouts for other scripts, are found with a binary search.
+ *
+ * The table is built from the current layout when it's created. Event watches run on
+ * whichever thread pushes the event, so the watch only marks the table as stale on
+ * `SDL_KEYMAPCHANGED`, and the owner rebuilds it with `refresh()`, e.g. once per update.
+ * The stale flag is the only member that is accessed by other threads.
+ *
+ * \since 6.1.0
+ */
+class keymap_table final
+{
+ public:
+  keymap_table() noexcept
+  {
+    build();
+    SDL_AddEventWatch(&on_event, this);
+  }
+
+  keymap_table(const keymap_table& other) noexcept
+      : m_chars{other.m_chars}
+      , m_keys{other.m_keys}
+      , m_others{other.m_others}
+      , m_nOthers{other.m_nOthers}
+      , m_stale{other.is_stale()}
+  {
+    SDL_AddEventWatch(&on_event, this);
+  }
+
+  // The event watch stays registered with this table
+  auto operator=(const keymap_table& other) noexcept -> keymap_table&
+  {
+    m_chars = other.m_chars;
+    m_keys = other.m_keys;
+    m_others = other.m_others;
+    m_nOthers = other.m_nOthers;
+    m_stale.store(other.is_stale(), std::memory_order_release);
+    return *this;
+  }
+
+  ~keymap_table() noexcept
+  {
+    SDL_DelEventWatch(&on_event, this);
+  }
+
+  // Rebuilds the table if the keymap changed since the last build
+  void refresh() noexcept
+  {
+    if (is_stale())
+    {
+      build();
+    }
+  }
+
+  // Builds the table from the current keymap
+  void build() noexcept
+  {
+    // Cleared first, so that changes during the build mark the table as stale again
+    m_stale.store(false, std::memory_order_release);
+
+    m_chars.fill(unmapped);
+    m_keys.fill(unmapped);
+    m_nOthers = 0;
+
+    // SDL returns the first scan code whose key matches, so later scan codes are skipped
+    for (int code = 0; code < SDL_NUM_SCANCODES; ++code)
+    {
+      const auto sc = static_cast<SDL_Scancode>(code);
+      const auto key = SDL_GetKeyFromScancode(sc);
+
+      if (auto* slot = find_slot(key))
+      {
+        if (*slot == unmapped)
+        {
+          *slot = static_cast<u16>(code);
+        }
+      }
+      else
+      {
+        m_others[m_nOthers++] = key_entry{key, static_cast<u16>(code)};
+      }
+    }
+
+    // Duplicate keys are ordered by scan code, so the first scan code is found
+    std::sort(m_others.begin(),
+              m_others.begin() + static_cast<std::ptrdiff_t>(m_nOthers),
+              [](const key_entry& a, const key_entry& b) noexcept {
+                return (a.key != b.key) ? a.key < b.key : a.code < b.code;
+              });
+  }
+
+  // Equivalent to SDL_GetScancodeFromKey
+  [[nodiscard]] auto to_scan_code(const SDL_Keycode key) const noexcept -> SDL_Scancode
+  {
+    if (const auto* slot = find_slot(key))
+    {
+      return (*slot == unmapped) ? SDL_SCANCODE_UNKNOWN
+                                 : static_cast<SDL_Scancode>(*slot);
+    }
+
+    const auto* last = m_others.data() + m_nOthers;
+    const auto* it = std::lower_bound(m_others.data(),
+                                      last,
+                                      key,
+                                      [](const key_entry& entry, const SDL_Keycode k) {
+                                        return entry.key < k;
+                                      });
+
+    return (it != last && it->key == key) ? static_cast<SDL_Scancode>(it->code)
+                                          : SDL_SCANCODE_UNKNOWN;
+  }
+
+  [[nodiscard]] auto is_stale() const noexcept -> bool
+  {
+    return m_stale.load(std::memory_order_acquire);
+  }
+
+ private:
+  inline constexpr static u16 unmapped = 0xFFFF;
+  inline constexpr static SDL_Keycode char_count = 256;
+
+  struct key_entry final
+  {
+    SDL_Keycode key{};
+    u16 code{};
+  };
+
+  std::array<u16, char_count> m_chars{};                // Keys below 256
+  std::array<u16, SDL_NUM_SCANCODES> m_keys{};          // Keys without characters
+  std::array<key_entry, SDL_NUM_SCANCODES> m_others{};  // Sorted by key
+  std::size_t m_nOthers{};
+  std::atomic<bool> m_stale{};  // Set by the event watch, on any thread
+
+  [[nodiscard]] auto find_slot(const SDL_Keycode key) noexcept -> u16*
+  {
+    return const_cast<u16*>(static_cast<const keymap_table*>(this)->find_slot(key));
+  }
+
+  [[nodiscard]] auto find_slot(const SDL_Keycode key) const noexcept -> const u16*
+  {
+    if (key >= 0 && key < char_count)
+    {
+      return &m_chars[static_cast<std::size_t>(key)];
+    }
+    else if (key & SDLK_SCANCODE_MASK)
+    {
+      const auto index = key & ~SDLK_SCANCODE_MASK;
+      if (index >= 0 && index < SDL_NUM_SCANCODES)
+      {
+        return &m_keys[static_cast<std::size_t>(index)];
+      }
+    }
+
+    return nullptr;
+  }
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    if (event->type == SDL_KEYMAPCHANGED)
+    {
+      static_cast<keymap_table*>(data)->m_stale.store(true, std::memory_order_release);
+    }
+
+    return 0;
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_KEYMAP_TABLE_HEADER
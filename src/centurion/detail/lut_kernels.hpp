@@ -0,0 +1,284 @@
+#ifndef CENTURION_DETAIL_LUT_KERNELS_HEADER
+#define CENTURION_DETAIL_LUT_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels map 8-bit indices or floating-point values to 32-bit pixels, by looking
+ * them up in a table. Values are scaled to the size of the table, rounded to the nearest
+ * entry and clamped to the table, where NaN values map to the first entry. Only AVX2 can
+ * gather the table entries with vector instructions, the other instruction sets only
+ * vectorize the computation of the indices.
+ */
+
+/// Describes how floating-point values are scaled to indices of a table.
+struct lut_range final
+{
+  float min{};    ///< The value that maps to the first entry.
+  float scale{};  ///< The factor that maps values relative to the minimum to indices.
+  float last{};   ///< The index of the last entry.
+};
+
+[[nodiscard]] inline auto lut_index(const lut_range& range, const float value) noexcept
+    -> u32
+{
+  const auto t = (value - range.min) * range.scale;
+  const auto clamped = (t > 0) ? ((t < range.last) ? t : range.last) : 0.0f;
+  return static_cast<u32>(clamped + 0.5f);
+}
+
+/// \name Scalar kernels
+/// \{
+
+inline void lookup_bytes_scalar(const u32* table,
+                                const u8* in,
+                                u32* out,
+                                const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    out[index] = table[in[index]];
+  }
+}
+
+inline void lookup_values_scalar(const u32* table,
+                                 const lut_range& range,
+                                 const float* in,
+                                 u32* out,
+                                 const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    out[index] = table[lut_index(range, in[index])];
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+inline void lookup_values_sse2(const u32* table,
+                               const lut_range& range,
+                               const float* in,
+                               u32* out,
+                               const std::size_t count) noexcept
+{
+  const auto min = _mm_set1_ps(range.min);
+  const auto scale = _mm_set1_ps(range.scale);
+  const auto last = _mm_set1_ps(range.last);
+  const auto zero = _mm_setzero_ps();
+  const auto half = _mm_set1_ps(0.5f);
+
+  alignas(16) i32 lanes[4];
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto t = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(in + index), min), scale);
+
+    // The maximum returns the second operand for NaN values, so they become zero
+    const auto clamped = _mm_min_ps(_mm_max_ps(t, zero), last);
+    _mm_store_si128(reinterpret_cast<__m128i*>(lanes),
+                    _mm_cvttps_epi32(_mm_add_ps(clamped, half)));
+
+    for (int lane = 0; lane < 4; ++lane)
+    {
+      out[index + static_cast<std::size_t>(lane)] = table[lanes[lane]];
+    }
+  }
+
+  lookup_values_scalar(table, range, in + index, out + index, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+/// \name AVX2 kernels
+/// \{
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void lookup_bytes_avx2(const u32* table,
+                              const u8* in,
+                              u32* out,
+                              const std::size_t count) noexcept
+{
+  const auto* entries = reinterpret_cast<const int*>(table);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + index));
+    const auto indices = _mm256_cvtepu8_epi32(bytes);
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index),
+                        _mm256_i32gather_epi32(entries, indices, 4));
+  }
+
+  lookup_bytes_scalar(table, in + index, out + index, count - index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void lookup_values_avx2(const u32* table,
+                               const lut_range& range,
+                               const float* in,
+                               u32* out,
+                               const std::size_t count) noexcept
+{
+  const auto* entries = reinterpret_cast<const int*>(table);
+
+  const auto min = _mm256_set1_ps(range.min);
+  const auto scale = _mm256_set1_ps(range.scale);
+  const auto last = _mm256_set1_ps(range.last);
+  const auto zero = _mm256_setzero_ps();
+  const auto half = _mm256_set1_ps(0.5f);
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto t = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(in + index), min), scale);
+
+    // The maximum returns the second operand for NaN values, so they become zero
+    const auto clamped = _mm256_min_ps(_mm256_max_ps(t, zero), last);
+    const auto indices = _mm256_cvttps_epi32(_mm256_add_ps(clamped, half));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + index),
+                        _mm256_i32gather_epi32(entries, indices, 4));
+  }
+
+  lookup_values_scalar(table, range, in + index, out + index, count - index);
+}
+
+/// \} End of AVX2 kernels
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+inline void lookup_values_neon(const u32* table,
+                               const lut_range& range,
+                               const float* in,
+                               u32* out,
+                               const std::size_t count) noexcept
+{
+  const auto min = vdupq_n_f32(range.min);
+  const auto scale = vdupq_n_f32(range.scale);
+  const auto last = vdupq_n_f32(range.last);
+  const auto zero = vdupq_n_f32(0);
+  const auto half = vdupq_n_f32(0.5f);
+
+  u32 lanes[4];
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto t = vmulq_f32(vsubq_f32(vld1q_f32(in + index), min), scale);
+
+    // NaN values propagate through the clamping, and are then converted to zero
+    const auto clamped = vminq_f32(vmaxq_f32(t, zero), last);
+    vst1q_u32(lanes, vcvtq_u32_f32(vaddq_f32(clamped, half)));
+
+    for (int lane = 0; lane < 4; ++lane)
+    {
+      out[index + static_cast<std::size_t>(lane)] = table[lanes[lane]];
+    }
+  }
+
+  lookup_values_scalar(table, range, in + index, out + index, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Maps 8-bit indices to the entries of a table with 256 entries.
+inline void lookup_bytes(const simd_level level,
+                         const u32* table,
+                         const u8* in,
+                         u32* out,
+                         const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      lookup_bytes_avx2(table, in, out, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+    case simd_level::neon:
+    case simd_level::none:
+      lookup_bytes_scalar(table, in, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Maps floating-point values to the entries of a table.
+inline void lookup_values(const simd_level level,
+                          const u32* table,
+                          const lut_range& range,
+                          const float* in,
+                          u32* out,
+                          const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      lookup_values_avx2(table, range, in, out, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      lookup_values_sse2(table, range, in, out, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      lookup_values_neon(table, range, in, out, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      lookup_values_scalar(table, range, in, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_LUT_KERNELS_HEADER
@@ -0,0 +1,191 @@
+#ifndef CENTURION_DETAIL_PARTICLE_KERNELS_HEADER
+#define CENTURION_DETAIL_PARTICLE_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels advance particles that are stored as separate arrays of components, using
+ * semi-implicit Euler integration, i.e. the velocities are updated before the positions.
+ * The ages of the particles are increased by the time step.
+ */
+
+struct particle_columns final
+{
+  float* xs{};
+  float* ys{};
+  float* vxs{};
+  float* vys{};
+  float* ages{};
+};
+
+struct particle_step final
+{
+  float dt{};
+  float ax{};  // The acceleration, e.g. gravity
+  float ay{};
+};
+
+inline void integrate_particles_scalar(const particle_columns& particles,
+                                       const std::size_t first,
+                                       const std::size_t last,
+                                       const particle_step& step) noexcept
+{
+  const auto dvx = step.ax * step.dt;
+  const auto dvy = step.ay * step.dt;
+
+  for (auto index = first; index < last; ++index)
+  {
+    particles.vxs[index] += dvx;
+    particles.vys[index] += dvy;
+    particles.xs[index] += particles.vxs[index] * step.dt;
+    particles.ys[index] += particles.vys[index] * step.dt;
+    particles.ages[index] += step.dt;
+  }
+}
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+inline void integrate_particles_sse2(const particle_columns& particles,
+                                     const std::size_t first,
+                                     const std::size_t last,
+                                     const particle_step& step) noexcept
+{
+  const auto dt = _mm_set1_ps(step.dt);
+  const auto dvx = _mm_set1_ps(step.ax * step.dt);
+  const auto dvy = _mm_set1_ps(step.ay * step.dt);
+
+  auto index = first;
+  for (; index + 4 <= last; index += 4)
+  {
+    const auto vx = _mm_add_ps(_mm_loadu_ps(particles.vxs + index), dvx);
+    const auto vy = _mm_add_ps(_mm_loadu_ps(particles.vys + index), dvy);
+    const auto x = _mm_loadu_ps(particles.xs + index);
+    const auto y = _mm_loadu_ps(particles.ys + index);
+    const auto age = _mm_loadu_ps(particles.ages + index);
+
+    _mm_storeu_ps(particles.vxs + index, vx);
+    _mm_storeu_ps(particles.vys + index, vy);
+    _mm_storeu_ps(particles.xs + index, _mm_add_ps(x, _mm_mul_ps(vx, dt)));
+    _mm_storeu_ps(particles.ys + index, _mm_add_ps(y, _mm_mul_ps(vy, dt)));
+    _mm_storeu_ps(particles.ages + index, _mm_add_ps(age, dt));
+  }
+
+  integrate_particles_scalar(particles, index, last, step);
+}
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void integrate_particles_avx2(const particle_columns& particles,
+                                     const std::size_t first,
+                                     const std::size_t last,
+                                     const particle_step& step) noexcept
+{
+  const auto dt = _mm256_set1_ps(step.dt);
+  const auto dvx = _mm256_set1_ps(step.ax * step.dt);
+  const auto dvy = _mm256_set1_ps(step.ay * step.dt);
+
+  auto index = first;
+  for (; index + 8 <= last; index += 8)
+  {
+    const auto vx = _mm256_add_ps(_mm256_loadu_ps(particles.vxs + index), dvx);
+    const auto vy = _mm256_add_ps(_mm256_loadu_ps(particles.vys + index), dvy);
+    const auto x = _mm256_loadu_ps(particles.xs + index);
+    const auto y = _mm256_loadu_ps(particles.ys + index);
+    const auto age = _mm256_loadu_ps(particles.ages + index);
+
+    _mm256_storeu_ps(particles.vxs + index, vx);
+    _mm256_storeu_ps(particles.vys + index, vy);
+    _mm256_storeu_ps(particles.xs + index, _mm256_add_ps(x, _mm256_mul_ps(vx, dt)));
+    _mm256_storeu_ps(particles.ys + index, _mm256_add_ps(y, _mm256_mul_ps(vy, dt)));
+    _mm256_storeu_ps(particles.ages + index, _mm256_add_ps(age, dt));
+  }
+
+  integrate_particles_scalar(particles, index, last, step);
+}
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+inline void integrate_particles_neon(const particle_columns& particles,
+                                     const std::size_t first,
+                                     const std::size_t last,
+                                     const particle_step& step) noexcept
+{
+  const auto dt = vdupq_n_f32(step.dt);
+  const auto dvx = vdupq_n_f32(step.ax * step.dt);
+  const auto dvy = vdupq_n_f32(step.ay * step.dt);
+
+  auto index = first;
+  for (; index + 4 <= last; index += 4)
+  {
+    const auto vx = vaddq_f32(vld1q_f32(particles.vxs + index), dvx);
+    const auto vy = vaddq_f32(vld1q_f32(particles.vys + index), dvy);
+    const auto x = vld1q_f32(particles.xs + index);
+    const auto y = vld1q_f32(particles.ys + index);
+    const auto age = vld1q_f32(particles.ages + index);
+
+    vst1q_f32(particles.vxs + index, vx);
+    vst1q_f32(particles.vys + index, vy);
+    vst1q_f32(particles.xs + index, vmlaq_f32(x, vx, dt));
+    vst1q_f32(particles.ys + index, vmlaq_f32(y, vy, dt));
+    vst1q_f32(particles.ages + index, vaddq_f32(age, dt));
+  }
+
+  integrate_particles_scalar(particles, index, last, step);
+}
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// Advances the particles in the range [first, last) by a time step.
+inline void integrate_particles(const simd_level level,
+                                const particle_columns& particles,
+                                const std::size_t first,
+                                const std::size_t last,
+                                const particle_step& step) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      integrate_particles_avx2(particles, first, last, step);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      integrate_particles_sse2(particles, first, last, step);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      integrate_particles_neon(particles, first, last, step);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      integrate_particles_scalar(particles, first, last, step);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_PARTICLE_KERNELS_HEADER
@@ -0,0 +1,608 @@
+#ifndef CENTURION_DETAIL_PIXEL_KERNELS_HEADER
+#define CENTURION_DETAIL_PIXEL_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "simd_dispatch.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * All kernels operate on 32-bit pixels with 8-bit channels, where the position of each
+ * channel is described by its shift within the native 32-bit pixel value. This makes the
+ * kernels independent of the byte order, since SDL defines packed formats in terms of
+ * native pixel values.
+ */
+
+/// Describes the bit positions of the channels of a 32-bit pixel format.
+struct channel_layout final
+{
+  int red{};
+  int green{};
+  int blue{};
+  int alpha{};
+  bool opaque{};  ///< The alpha byte is padding, and the pixels are always opaque.
+};
+
+/// Returns the channel layout of a format, or false if it isn't supported by the kernels.
+[[nodiscard]] constexpr auto get_channel_layout(const u32 format,
+                                                channel_layout& layout) noexcept -> bool
+{
+  switch (format)
+  {
+    case SDL_PIXELFORMAT_RGBA8888:
+      layout = {24, 16, 8, 0, false};
+      return true;
+
+    case SDL_PIXELFORMAT_ARGB8888:
+      layout = {16, 8, 0, 24, false};
+      return true;
+
+    case SDL_PIXELFORMAT_ABGR8888:
+      layout = {0, 8, 16, 24, false};
+      return true;
+
+    case SDL_PIXELFORMAT_BGRA8888:
+      layout = {8, 16, 24, 0, false};
+      return true;
+
+    case SDL_PIXELFORMAT_RGB888:  // Also known as XRGB8888
+      layout = {16, 8, 0, 24, true};
+      return true;
+
+    case SDL_PIXELFORMAT_BGR888:  // Also known as XBGR8888
+      layout = {0, 8, 16, 24, true};
+      return true;
+
+    case SDL_PIXELFORMAT_RGBX8888:
+      layout = {24, 16, 8, 0, true};
+      return true;
+
+    case SDL_PIXELFORMAT_BGRX8888:
+      layout = {8, 16, 24, 0, true};
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * A channel permutation, expressed as four "shift right, shift left, mask" terms that are
+ * combined with a bitwise OR, along with a constant that provides opaque alpha values.
+ */
+struct swizzle_plan final
+{
+  u32 masks[4]{};
+  int right[4]{};
+  int left[4]{};
+  u32 fill{};
+};
+
+[[nodiscard]] constexpr auto make_swizzle_plan(const channel_layout& from,
+                                               const channel_layout& to) noexcept
+    -> swizzle_plan
+{
+  swizzle_plan plan;
+
+  const int sources[] = {from.red, from.green, from.blue, from.alpha};
+  const int targets[] = {to.red, to.green, to.blue, to.alpha};
+
+  for (int index = 0; index < 4; ++index)
+  {
+    const auto src = sources[index];
+    const auto dst = targets[index];
+
+    // Opaque formats always use 0xFF as the alpha value, in both directions
+    if (index == 3 && (from.opaque || to.opaque))
+    {
+      plan.fill |= 0xFFu << static_cast<u32>(dst);
+      continue;
+    }
+
+    plan.masks[index] = 0xFFu << static_cast<u32>(dst);
+    plan.right[index] = (src > dst) ? src - dst : 0;
+    plan.left[index] = (dst > src) ? dst - src : 0;
+  }
+
+  return plan;
+}
+
+[[nodiscard]] constexpr auto swizzle(const swizzle_plan& plan, const u32 pixel) noexcept
+    -> u32
+{
+  auto result = plan.fill;
+  for (int index = 0; index < 4; ++index)
+  {
+    const auto shifted = (pixel >> static_cast<u32>(plan.right[index]))
+                         << static_cast<u32>(plan.left[index]);
+    result |= shifted & plan.masks[index];
+  }
+
+  return result;
+}
+
+/// Returns the product of two 8-bit values divided by 255, rounded to nearest.
+[[nodiscard]] constexpr auto multiply_255(const u32 a, const u32 b) noexcept -> u32
+{
+  const auto t = a * b + 128u;
+  return (t + (t >> 8u)) >> 8u;
+}
+
+[[nodiscard]] constexpr auto premultiply(const channel_layout& layout,
+                                         const u32 pixel) noexcept -> u32
+{
+  const auto alphaShift = static_cast<u32>(layout.alpha);
+  const auto alpha = (pixel >> alphaShift) & 0xFFu;
+
+  auto result = pixel & (0xFFu << alphaShift);
+  const int shifts[] = {layout.red, layout.green, layout.blue};
+  for (const auto shift : shifts)
+  {
+    const auto channel = (pixel >> static_cast<u32>(shift)) & 0xFFu;
+    result |= multiply_255(channel, alpha) << static_cast<u32>(shift);
+  }
+
+  return result;
+}
+
+[[nodiscard]] constexpr auto unpremultiply(const channel_layout& layout,
+                                           const u32 pixel) noexcept -> u32
+{
+  const auto alphaShift = static_cast<u32>(layout.alpha);
+  const auto alpha = (pixel >> alphaShift) & 0xFFu;
+
+  if (alpha == 0)
+  {
+    return 0;
+  }
+
+  auto result = pixel & (0xFFu << alphaShift);
+  const int shifts[] = {layout.red, layout.green, layout.blue};
+  for (const auto shift : shifts)
+  {
+    const auto channel = (pixel >> static_cast<u32>(shift)) & 0xFFu;
+    const auto value = (channel * 255u + alpha / 2u) / alpha;
+    result |= ((value < 255u) ? value : 255u) << static_cast<u32>(shift);
+  }
+
+  return result;
+}
+
+/// \name Scalar kernels
+/// \{
+
+inline void swizzle_scalar(const swizzle_plan& plan,
+                           const u32* src,
+                           u32* dst,
+                           const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    dst[index] = swizzle(plan, src[index]);
+  }
+}
+
+inline void premultiply_scalar(const channel_layout& layout,
+                               u32* pixels,
+                               const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    pixels[index] = premultiply(layout, pixels[index]);
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+inline void swizzle_sse2(const swizzle_plan& plan,
+                         const u32* src,
+                         u32* dst,
+                         const std::size_t count) noexcept
+{
+  __m128i masks[4];
+  __m128i right[4];
+  __m128i left[4];
+
+  for (int index = 0; index < 4; ++index)
+  {
+    masks[index] = _mm_set1_epi32(static_cast<int>(plan.masks[index]));
+    right[index] = _mm_cvtsi32_si128(plan.right[index]);
+    left[index] = _mm_cvtsi32_si128(plan.left[index]);
+  }
+
+  const auto fill = _mm_set1_epi32(static_cast<int>(plan.fill));
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+
+    auto result = fill;
+    for (int term = 0; term < 4; ++term)
+    {
+      const auto shifted = _mm_sll_epi32(_mm_srl_epi32(pixels, right[term]), left[term]);
+      result = _mm_or_si128(result, _mm_and_si128(shifted, masks[term]));
+    }
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), result);
+  }
+
+  swizzle_scalar(plan, src + index, dst + index, count - index);
+}
+
+/// Premultiplies two pixels, that have been widened to 16-bit channels.
+template <int AlphaIndex>
+[[nodiscard]] inline auto premultiply_sse2(const __m128i wide, const __m128i alphaMask)
+    -> __m128i
+{
+  constexpr int order = _MM_SHUFFLE(AlphaIndex, AlphaIndex, AlphaIndex, AlphaIndex);
+
+  const auto alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(wide, order), order);
+  auto t = _mm_add_epi16(_mm_mullo_epi16(wide, alpha), _mm_set1_epi16(128));
+  t = _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+
+  // Keep the original alpha values
+  return _mm_or_si128(_mm_andnot_si128(alphaMask, t), _mm_and_si128(alphaMask, wide));
+}
+
+template <int AlphaIndex>
+void premultiply_sse2(const channel_layout& layout,
+                      u32* pixels,
+                      const std::size_t count) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+  const auto alphaMask =
+      _mm_set1_epi64x(static_cast<long long>(0xFFFFull << (16 * AlphaIndex)));
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    auto* ptr = reinterpret_cast<__m128i*>(pixels + index);
+    const auto values = _mm_loadu_si128(ptr);
+
+    const auto low = _mm_unpacklo_epi8(values, zero);
+    const auto high = _mm_unpackhi_epi8(values, zero);
+
+    _mm_storeu_si128(ptr,
+                     _mm_packus_epi16(premultiply_sse2<AlphaIndex>(low, alphaMask),
+                                      premultiply_sse2<AlphaIndex>(high, alphaMask)));
+
+  }
+
+  premultiply_scalar(layout, pixels + index, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+/// \name AVX2 kernels
+/// \{
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void swizzle_avx2(const swizzle_plan& plan,
+                         const u32* src,
+                         u32* dst,
+                         const std::size_t count) noexcept
+{
+  __m256i masks[4];
+  __m128i right[4];
+  __m128i left[4];
+
+  for (int index = 0; index < 4; ++index)
+  {
+    masks[index] = _mm256_set1_epi32(static_cast<int>(plan.masks[index]));
+    right[index] = _mm_cvtsi32_si128(plan.right[index]);
+    left[index] = _mm_cvtsi32_si128(plan.left[index]);
+  }
+
+  const auto fill = _mm256_set1_epi32(static_cast<int>(plan.fill));
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    const auto pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + index));
+
+    auto result = fill;
+    for (int term = 0; term < 4; ++term)
+    {
+      const auto shifted =
+          _mm256_sll_epi32(_mm256_srl_epi32(pixels, right[term]), left[term]);
+      result = _mm256_or_si256(result, _mm256_and_si256(shifted, masks[term]));
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + index), result);
+  }
+
+  swizzle_scalar(plan, src + index, dst + index, count - index);
+}
+
+template <int AlphaIndex>
+CENTURION_DETAIL_TARGET_AVX2 inline auto premultiply_avx2(const __m256i wide,
+                                                          const __m256i alphaMask)
+    -> __m256i
+{
+  constexpr int order = _MM_SHUFFLE(AlphaIndex, AlphaIndex, AlphaIndex, AlphaIndex);
+
+  const auto alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(wide, order), order);
+  auto t = _mm256_add_epi16(_mm256_mullo_epi16(wide, alpha), _mm256_set1_epi16(128));
+  t = _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+
+  return _mm256_or_si256(_mm256_andnot_si256(alphaMask, t),
+                         _mm256_and_si256(alphaMask, wide));
+}
+
+template <int AlphaIndex>
+CENTURION_DETAIL_TARGET_AVX2 void premultiply_avx2(const channel_layout& layout,
+                                                   u32* pixels,
+                                                   const std::size_t count) noexcept
+{
+  const auto zero = _mm256_setzero_si256();
+  const auto alphaMask =
+      _mm256_set1_epi64x(static_cast<long long>(0xFFFFull << (16 * AlphaIndex)));
+
+  std::size_t index = 0;
+  for (; index + 8u <= count; index += 8u)
+  {
+    auto* ptr = reinterpret_cast<__m256i*>(pixels + index);
+    const auto values = _mm256_loadu_si256(ptr);
+
+    // The unpack and pack instructions operate on 128-bit lanes, so the order is kept
+    const auto low =
+        premultiply_avx2<AlphaIndex>(_mm256_unpacklo_epi8(values, zero), alphaMask);
+    const auto high =
+        premultiply_avx2<AlphaIndex>(_mm256_unpackhi_epi8(values, zero), alphaMask);
+
+    _mm256_storeu_si256(ptr, _mm256_packus_epi16(low, high));
+  }
+
+  premultiply_scalar(layout, pixels + index, count - index);
+}
+
+/// \} End of AVX2 kernels
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+inline void swizzle_neon(const swizzle_plan& plan,
+                         const u32* src,
+                         u32* dst,
+                         const std::size_t count) noexcept
+{
+  uint32x4_t masks[4];
+  int32x4_t right[4];
+  int32x4_t left[4];
+
+  for (int index = 0; index < 4; ++index)
+  {
+    masks[index] = vdupq_n_u32(plan.masks[index]);
+    right[index] = vdupq_n_s32(-plan.right[index]);  // Negative shifts are right shifts
+    left[index] = vdupq_n_s32(plan.left[index]);
+  }
+
+  const auto fill = vdupq_n_u32(plan.fill);
+
+  std::size_t index = 0;
+  for (; index + 4u <= count; index += 4u)
+  {
+    const auto pixels = vld1q_u32(src + index);
+
+    auto result = fill;
+    for (int term = 0; term < 4; ++term)
+    {
+      const auto shifted = vshlq_u32(vshlq_u32(pixels, right[term]), left[term]);
+      result = vorrq_u32(result, vandq_u32(shifted, masks[term]));
+    }
+
+    vst1q_u32(dst + index, result);
+  }
+
+  swizzle_scalar(plan, src + index, dst + index, count - index);
+}
+
+inline void premultiply_neon(const channel_layout& layout,
+                             u32* pixels,
+                             const std::size_t count) noexcept
+{
+  // Byte indices of the channels in memory, which depend on the byte order
+  const auto byte_index = [](const int shift) noexcept {
+    return (SDL_BYTEORDER == SDL_LIL_ENDIAN) ? shift / 8 : 3 - shift / 8;
+  };
+
+  const auto alphaIndex = byte_index(layout.alpha);
+  const int colorIndices[] = {byte_index(layout.red),
+                              byte_index(layout.green),
+                              byte_index(layout.blue)};
+
+  const auto bias = vdupq_n_u16(128);
+
+  std::size_t index = 0;
+  for (; index + 16u <= count; index += 16u)
+  {
+    auto* ptr = reinterpret_cast<u8*>(pixels + index);
+
+    auto planes = vld4q_u8(ptr);
+    const auto alpha = planes.val[alphaIndex];
+
+    for (const auto channel : colorIndices)
+    {
+      auto low = vaddq_u16(vmull_u8(vget_low_u8(planes.val[channel]),
+                                    vget_low_u8(alpha)),
+                           bias);
+      auto high = vaddq_u16(vmull_u8(vget_high_u8(planes.val[channel]),
+                                     vget_high_u8(alpha)),
+                            bias);
+
+      low = vaddq_u16(low, vshrq_n_u16(low, 8));
+      high = vaddq_u16(high, vshrq_n_u16(high, 8));
+
+      planes.val[channel] = vcombine_u8(vshrn_n_u16(low, 8), vshrn_n_u16(high, 8));
+    }
+
+    vst4q_u8(ptr, planes);
+  }
+
+  premultiply_scalar(layout, pixels + index, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Converts pixels between two layouts, the source and destination may be the same.
+inline void swizzle_pixels(const simd_level level,
+                           const swizzle_plan& plan,
+                           const u32* src,
+                           u32* dst,
+                           const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      swizzle_avx2(plan, src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      swizzle_sse2(plan, src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      swizzle_neon(plan, src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      swizzle_scalar(plan, src, dst, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Premultiplies the color channels of pixels by their alpha values, in place.
+inline void premultiply_pixels(const simd_level level,
+                               const channel_layout& layout,
+                               u32* pixels,
+                               const std::size_t count) noexcept
+{
+  [[maybe_unused]] const auto alphaIndex = layout.alpha / 8;
+
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      switch (alphaIndex)
+      {
+        case 0:
+          premultiply_avx2<0>(layout, pixels, count);
+          break;
+
+        case 1:
+          premultiply_avx2<1>(layout, pixels, count);
+          break;
+
+        case 2:
+          premultiply_avx2<2>(layout, pixels, count);
+          break;
+
+        default:
+          premultiply_avx2<3>(layout, pixels, count);
+          break;
+      }
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      switch (alphaIndex)
+      {
+        case 0:
+          premultiply_sse2<0>(layout, pixels, count);
+          break;
+
+        case 1:
+          premultiply_sse2<1>(layout, pixels, count);
+          break;
+
+        case 2:
+          premultiply_sse2<2>(layout, pixels, count);
+          break;
+
+        default:
+          premultiply_sse2<3>(layout, pixels, count);
+          break;
+      }
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      premultiply_neon(layout, pixels, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      premultiply_scalar(layout, pixels, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Reverts alpha premultiplication in place, fully transparent pixels become zero.
+inline void unpremultiply_pixels(const channel_layout& layout,
+                                 u32* pixels,
+                                 const std::size_t count) noexcept
+{
+  // This is dominated by the division, which doesn't vectorize well with exact results
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    pixels[index] = unpremultiply(layout, pixels[index]);
+  }
+}
+
+using swizzle_function =
+    void(const swizzle_plan&, const u32*, u32*, std::size_t) noexcept;
+
+/// The swizzle kernels, called with the implementation of the current instruction set.
+inline constexpr simd_kernel<swizzle_function> swizzle_kernel{
+    &swizzle_scalar,
+    CENTURION_DETAIL_SSE2_KERNEL(swizzle_sse2),
+    CENTURION_DETAIL_AVX2_KERNEL(swizzle_avx2),
+    CENTURION_DETAIL_NEON_KERNEL(swizzle_neon)};
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_PIXEL_KERNELS_HEADER
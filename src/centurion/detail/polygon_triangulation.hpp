@@ -0,0 +1,152 @@
+#ifndef CENTURION_DETAIL_POLYGON_TRIANGULATION_HEADER
+#define CENTURION_DETAIL_POLYGON_TRIANGULATION_HEADER
+
+#include <cstddef>  // size_t, ptrdiff_t
+#include <vector>   // vector
+
+#include "../math/point.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+[[nodiscard]] inline auto cross_product(const fpoint origin,
+                                        const fpoint a,
+                                        const fpoint b) noexcept -> float
+{
+  return (a.x() - origin.x()) * (b.y() - origin.y()) -
+         (a.y() - origin.y()) * (b.x() - origin.x());
+}
+
+// Returns twice the signed area, which is positive for counter-clockwise polygons in a
+// y-up coordinate system, i.e. clockwise polygons on the screen
+[[nodiscard]] inline auto signed_area(const fpoint* points,
+                                      const std::size_t count) noexcept -> float
+{
+  float area = 0;
+  for (std::size_t index = 0, prev = count - 1; index < count; prev = index++)
+  {
+    area += points[prev].x() * points[index].y() - points[index].x() * points[prev].y();
+  }
+
+  return area;
+}
+
+// Indicates whether a point is inside or on the border of a triangle with the winding
+[[nodiscard]] inline auto in_triangle(const fpoint point,
+                                      const fpoint a,
+                                      const fpoint b,
+                                      const fpoint c,
+                                      const float winding) noexcept -> bool
+{
+  return cross_product(a, b, point) * winding >= 0 &&
+         cross_product(b, c, point) * winding >= 0 &&
+         cross_product(c, a, point) * winding >= 0;
+}
+
+/**
+ * \brief Triangulates a simple polygon, which may be concave, by ear clipping.
+ *
+ * \details The indices of the triangles, relative to the first point, are appended to
+ * the index vector. Collinear points are skipped. This takes quadratic time, so the
+ * triangles of large polygons should be computed once and reused.
+ *
+ * \param points the vertices of the polygon, in either winding order.
+ * \param count the amount of vertices.
+ * \param indices the vector that the indices are appended to.
+ *
+ * \return `true` if the polygon was triangulated; `false` if it has fewer than three
+ * vertices, no area, or intersects itself, in which case no indices are appended.
+ */
+inline auto triangulate_polygon(const fpoint* points,
+                                const std::size_t count,
+                                std::vector<int>& indices) -> bool
+{
+  if (count < 3)
+  {
+    return false;
+  }
+
+  const auto area = signed_area(points, count);
+  if (area == 0)
+  {
+    return false;
+  }
+
+  const auto winding = (area > 0) ? 1.0f : -1.0f;
+  const auto firstIndex = indices.size();
+
+  std::vector<int> remaining;
+  remaining.reserve(count);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    remaining.push_back(static_cast<int>(index));
+  }
+
+  // Every clipped ear or skipped point resets the attempts, so a full pass without
+  // either means that the polygon isn't simple
+  std::size_t current = 0;
+  std::size_t attempts = 0;
+  while (remaining.size() > 3)
+  {
+    if (attempts > remaining.size())
+    {
+      indices.resize(firstIndex);
+      return false;
+    }
+
+    const auto size = remaining.size();
+    const auto prev = remaining[(current + size - 1) % size];
+    const auto cur = remaining[current % size];
+    const auto next = remaining[(current + 1) % size];
+
+    const auto& a = points[prev];
+    const auto& b = points[cur];
+    const auto& c = points[next];
+
+    const auto turn = cross_product(a, b, c) * winding;
+    if (turn == 0)
+    {
+      remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(current % size));
+      attempts = 0;
+      continue;
+    }
+
+    auto isEar = turn > 0;
+    for (std::size_t other = 0; isEar && other < size; ++other)
+    {
+      const auto index = remaining[other];
+      if (index != prev && index != cur && index != next)
+      {
+        isEar = !in_triangle(points[index], a, b, c, winding);
+      }
+    }
+
+    if (isEar)
+    {
+      indices.insert(indices.end(), {prev, cur, next});
+      remaining.erase(remaining.begin() + static_cast<std::ptrdiff_t>(current % size));
+      attempts = 0;
+    }
+    else
+    {
+      current = (current + 1) % size;
+      ++attempts;
+    }
+  }
+
+  const auto first = remaining[0];
+  const auto second = remaining[1];
+  const auto third = remaining[2];
+
+  if (cross_product(points[first], points[second], points[third]) != 0)
+  {
+    indices.insert(indices.end(), {first, second, third});
+  }
+
+  return true;
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_POLYGON_TRIANGULATION_HEADER
@@ -0,0 +1,78 @@
+#ifndef CENTURION_DETAIL_QUEUE_WAITER_HEADER
+#define CENTURION_DETAIL_QUEUE_WAITER_HEADER
+
+#include <SDL.h>
+
+#include <atomic>  // atomic, atomic_thread_fence, memory_order_...
+
+#include "../thread/semaphore.hpp"
+#include "spin_backoff.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// The amount of attempts before a waiting thread goes to sleep
+inline constexpr int queue_spin_count = 128;
+
+/*
+ * Lets threads sleep until an operation on a lock-free queue might succeed. Threads that
+ * wait register themselves before checking the queue again, and other threads release a
+ * semaphore token after changing the queue if there are any registered waiters. The
+ * fences ensure that either the waiter sees the change, or the notifier sees the waiter.
+ * Redundant tokens only cause spurious wake-ups, since waiters always check again.
+ */
+class queue_waiter final
+{
+ public:
+  queue_waiter() : m_semaphore{0}
+  {}
+
+  // Blocks until the operation succeeds, the operation is a predicate that attempts it
+  template <typename Operation>
+  void wait_until(Operation&& operation)
+  {
+    for (int spin = 0; spin < queue_spin_count; ++spin)
+    {
+      if (operation())
+      {
+        return;
+      }
+
+      cpu_pause();
+    }
+
+    for (;;)
+    {
+      m_waiting.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      if (operation())
+      {
+        m_waiting.fetch_sub(1, std::memory_order_relaxed);
+        return;
+      }
+
+      m_semaphore.acquire();
+      m_waiting.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  // Wakes up a waiting thread, if there is one
+  void notify() noexcept
+  {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiting.load(std::memory_order_relaxed) > 0)
+    {
+      m_semaphore.release();
+    }
+  }
+
+ private:
+  std::atomic<int> m_waiting{0};
+  semaphore m_semaphore;
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_QUEUE_WAITER_HEADER
@@ -0,0 +1,96 @@
+#ifndef CENTURION_DETAIL_RADIX_SORT_HEADER
+#define CENTURION_DETAIL_RADIX_SORT_HEADER
+
+#include <array>    // array
+#include <cstddef>  // size_t
+#include <utility>  // swap
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// A sort key and the index of the element that it belongs to
+struct sort_pair final
+{
+  u64 key{};
+  u32 index{};
+};
+
+/**
+ * \brief Stably sorts key/index pairs by their keys, in linear time.
+ *
+ * \details This is a least significant digit radix sort with 8-bit digits. The
+ * histograms of all digits are gathered in a single scan, and passes over digits that are
+ * the same for all keys are skipped, so that keys that only use a few of their bits, such
+ * as small layer and texture indices, are sorted in a couple of passes.
+ *
+ * \param pairs the pairs that will be sorted.
+ * \param scratch a buffer that is resized to the amount of pairs, which can be reused
+ * between calls to avoid allocations.
+ *
+ * \since 6.1.0
+ */
+inline void radix_sort(std::vector<sort_pair>& pairs, std::vector<sort_pair>& scratch)
+{
+  constexpr std::size_t digits = sizeof(u64);
+  constexpr std::size_t buckets = 256;
+
+  const auto count = pairs.size();
+  if (count < 2)
+  {
+    return;
+  }
+
+  std::array<std::array<std::size_t, buckets>, digits> histograms{};
+  for (const auto& pair : pairs)
+  {
+    for (std::size_t digit = 0; digit < digits; ++digit)
+    {
+      ++histograms[digit][(pair.key >> (digit * 8u)) & 0xFFu];
+    }
+  }
+
+  scratch.resize(count);
+
+  auto* source = &pairs;
+  auto* target = &scratch;
+
+  for (std::size_t digit = 0; digit < digits; ++digit)
+  {
+    auto& histogram = histograms[digit];
+
+    // All keys share this digit, so the pass wouldn't change the order
+    const auto shift = digit * 8u;
+    if (histogram[(pairs.front().key >> shift) & 0xFFu] == count)
+    {
+      continue;
+    }
+
+    std::size_t offset = 0;
+    for (auto& bucket : histogram)
+    {
+      const auto size = bucket;
+      bucket = offset;
+      offset += size;
+    }
+
+    for (const auto& pair : *source)
+    {
+      (*target)[histogram[(pair.key >> shift) & 0xFFu]++] = pair;
+    }
+
+    std::swap(source, target);
+  }
+
+  if (source != &pairs)
+  {
+    pairs.swap(scratch);
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RADIX_SORT_HEADER
@@ -0,0 +1,1221 @@
+#ifndef CENTURION_DETAIL_RECT_KERNELS_HEADER
+#define CENTURION_DETAIL_RECT_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <limits>   // numeric_limits
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels operate on rectangles and points stored as separate arrays of coordinates,
+ * and match the semantics of intersects(), basic_rect::contains() and get_union(), i.e.
+ * intersections exclude the borders, while points on the borders are contained. The
+ * results are stored as one byte per element, which is 1 for hits and 0 otherwise, and
+ * the kernels return the amount of hits. Only floating-point coordinates have vectorized
+ * kernels, integer coordinates use the scalar kernels.
+ */
+
+template <typename T>
+struct rect_columns final
+{
+  const T* xs{};
+  const T* ys{};
+  const T* widths{};
+  const T* heights{};
+};
+
+template <typename T>
+struct rect_extent final
+{
+  T x{};  // The minimum coordinates
+  T y{};
+  T maxX{};
+  T maxY{};
+};
+
+// The coefficients of an affine transform, i.e. x' = a*x + c*y + tx, y' = b*x + d*y + ty
+struct affine_coefficients final
+{
+  float a{1};
+  float b{};
+  float c{};
+  float d{1};
+  float tx{};
+  float ty{};
+};
+
+template <typename T>
+[[nodiscard]] constexpr auto offset_columns(const rect_columns<T>& rects,
+                                            const std::size_t offset) noexcept
+    -> rect_columns<T>
+{
+  return {rects.xs + offset,
+          rects.ys + offset,
+          rects.widths + offset,
+          rects.heights + offset};
+}
+
+template <typename T>
+[[nodiscard]] constexpr auto empty_extent() noexcept -> rect_extent<T>
+{
+  return {(std::numeric_limits<T>::max)(),
+          (std::numeric_limits<T>::max)(),
+          std::numeric_limits<T>::lowest(),
+          std::numeric_limits<T>::lowest()};
+}
+
+// Stores the lowest bits of a movemask result as bytes, and returns the amount of hits
+inline auto store_hits(u32 mask, u8* out, const int lanes) noexcept -> std::size_t
+{
+  std::size_t hits = 0;
+
+  for (int lane = 0; lane < lanes; ++lane)
+  {
+    const auto hit = static_cast<u8>(mask & 1u);
+    out[lane] = hit;
+    hits += hit;
+    mask >>= 1u;
+  }
+
+  return hits;
+}
+
+/// \name Scalar kernels
+/// \{
+
+template <typename T>
+auto rects_intersect_scalar(const rect_columns<T>& rects,
+                            const std::size_t count,
+                            const rect_extent<T>& area,
+                            u8* out) noexcept -> std::size_t
+{
+  std::size_t hits = 0;
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto x = rects.xs[index];
+    const auto y = rects.ys[index];
+
+    const auto hit = !(x >= area.maxX || x + rects.widths[index] <= area.x ||
+                       y >= area.maxY || y + rects.heights[index] <= area.y);
+
+    out[index] = static_cast<u8>(hit);
+    hits += hit;
+  }
+
+  return hits;
+}
+
+template <typename T>
+auto rects_contain_scalar(const rect_columns<T>& rects,
+                          const std::size_t count,
+                          const T px,
+                          const T py,
+                          u8* out) noexcept -> std::size_t
+{
+  std::size_t hits = 0;
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto x = rects.xs[index];
+    const auto y = rects.ys[index];
+
+    const auto hit = !(px < x || py < y || px > x + rects.widths[index] ||
+                       py > y + rects.heights[index]);
+
+    out[index] = static_cast<u8>(hit);
+    hits += hit;
+  }
+
+  return hits;
+}
+
+template <typename T>
+auto points_within_scalar(const T* xs,
+                          const T* ys,
+                          const std::size_t count,
+                          const rect_extent<T>& area,
+                          u8* out) noexcept -> std::size_t
+{
+  std::size_t hits = 0;
+
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto px = xs[index];
+    const auto py = ys[index];
+
+    const auto hit = !(px < area.x || py < area.y || px > area.maxX || py > area.maxY);
+
+    out[index] = static_cast<u8>(hit);
+    hits += hit;
+  }
+
+  return hits;
+}
+
+template <typename T>
+void translate_scalar(T* xs,
+                      T* ys,
+                      const std::size_t count,
+                      const T dx,
+                      const T dy) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    xs[index] += dx;
+    ys[index] += dy;
+  }
+}
+
+inline void transform_scalar(float* xs,
+                             float* ys,
+                             const std::size_t count,
+                             const affine_coefficients& m) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto x = xs[index];
+    const auto y = ys[index];
+
+    xs[index] = m.a * x + m.c * y + m.tx;
+    ys[index] = m.b * x + m.d * y + m.ty;
+  }
+}
+
+// Extends the extent by the rectangles with an area, like a fold over get_union()
+template <typename T>
+void rect_bounds_scalar(const rect_columns<T>& rects,
+                        const std::size_t count,
+                        rect_extent<T>& extent) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto width = rects.widths[index];
+    const auto height = rects.heights[index];
+
+    if (width > 0 && height > 0)
+    {
+      const auto x = rects.xs[index];
+      const auto y = rects.ys[index];
+
+      extent.x = (x < extent.x) ? x : extent.x;
+      extent.y = (y < extent.y) ? y : extent.y;
+      extent.maxX = (x + width > extent.maxX) ? x + width : extent.maxX;
+      extent.maxY = (y + height > extent.maxY) ? y + height : extent.maxY;
+    }
+  }
+}
+
+template <typename T>
+void point_bounds_scalar(const T* xs,
+                         const T* ys,
+                         const std::size_t count,
+                         rect_extent<T>& extent) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto x = xs[index];
+    const auto y = ys[index];
+
+    extent.x = (x < extent.x) ? x : extent.x;
+    extent.y = (y < extent.y) ? y : extent.y;
+    extent.maxX = (x > extent.maxX) ? x : extent.maxX;
+    extent.maxY = (y > extent.maxY) ? y : extent.maxY;
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+inline auto rects_intersect_sse2(const rect_columns<float>& rects,
+                                 const std::size_t count,
+                                 const rect_extent<float>& area,
+                                 u8* out) noexcept -> std::size_t
+{
+  const auto minX = _mm_set1_ps(area.x);
+  const auto minY = _mm_set1_ps(area.y);
+  const auto maxX = _mm_set1_ps(area.maxX);
+  const auto maxY = _mm_set1_ps(area.maxY);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = _mm_loadu_ps(rects.xs + index);
+    const auto y = _mm_loadu_ps(rects.ys + index);
+    const auto right = _mm_add_ps(x, _mm_loadu_ps(rects.widths + index));
+    const auto bottom = _mm_add_ps(y, _mm_loadu_ps(rects.heights + index));
+
+    const auto hit =
+        _mm_and_ps(_mm_and_ps(_mm_cmplt_ps(x, maxX), _mm_cmpgt_ps(right, minX)),
+                   _mm_and_ps(_mm_cmplt_ps(y, maxY), _mm_cmpgt_ps(bottom, minY)));
+
+    hits += store_hits(static_cast<u32>(_mm_movemask_ps(hit)), out + index, 4);
+  }
+
+  return hits + rects_intersect_scalar(offset_columns(rects, index),
+                                       count - index,
+                                       area,
+                                       out + index);
+}
+
+inline auto rects_contain_sse2(const rect_columns<float>& rects,
+                               const std::size_t count,
+                               const float px,
+                               const float py,
+                               u8* out) noexcept -> std::size_t
+{
+  const auto pointX = _mm_set1_ps(px);
+  const auto pointY = _mm_set1_ps(py);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = _mm_loadu_ps(rects.xs + index);
+    const auto y = _mm_loadu_ps(rects.ys + index);
+    const auto right = _mm_add_ps(x, _mm_loadu_ps(rects.widths + index));
+    const auto bottom = _mm_add_ps(y, _mm_loadu_ps(rects.heights + index));
+
+    const auto hit =
+        _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(pointX, x), _mm_cmpge_ps(pointY, y)),
+                   _mm_and_ps(_mm_cmple_ps(pointX, right), _mm_cmple_ps(pointY, bottom)));
+
+    hits += store_hits(static_cast<u32>(_mm_movemask_ps(hit)), out + index, 4);
+  }
+
+  return hits + rects_contain_scalar(offset_columns(rects, index),
+                                     count - index,
+                                     px,
+                                     py,
+                                     out + index);
+}
+
+inline auto points_within_sse2(const float* xs,
+                               const float* ys,
+                               const std::size_t count,
+                               const rect_extent<float>& area,
+                               u8* out) noexcept -> std::size_t
+{
+  const auto minX = _mm_set1_ps(area.x);
+  const auto minY = _mm_set1_ps(area.y);
+  const auto maxX = _mm_set1_ps(area.maxX);
+  const auto maxY = _mm_set1_ps(area.maxY);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = _mm_loadu_ps(xs + index);
+    const auto y = _mm_loadu_ps(ys + index);
+
+    const auto hit = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(x, minX), _mm_cmpge_ps(y, minY)),
+                                _mm_and_ps(_mm_cmple_ps(x, maxX), _mm_cmple_ps(y, maxY)));
+
+    hits += store_hits(static_cast<u32>(_mm_movemask_ps(hit)), out + index, 4);
+  }
+
+  return hits +
+         points_within_scalar(xs + index, ys + index, count - index, area, out + index);
+}
+
+inline void translate_sse2(float* xs,
+                           float* ys,
+                           const std::size_t count,
+                           const float dx,
+                           const float dy) noexcept
+{
+  const auto offsetX = _mm_set1_ps(dx);
+  const auto offsetY = _mm_set1_ps(dy);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    _mm_storeu_ps(xs + index, _mm_add_ps(_mm_loadu_ps(xs + index), offsetX));
+    _mm_storeu_ps(ys + index, _mm_add_ps(_mm_loadu_ps(ys + index), offsetY));
+  }
+
+  translate_scalar(xs + index, ys + index, count - index, dx, dy);
+}
+
+inline void transform_sse2(float* xs,
+                           float* ys,
+                           const std::size_t count,
+                           const affine_coefficients& m) noexcept
+{
+  const auto a = _mm_set1_ps(m.a);
+  const auto b = _mm_set1_ps(m.b);
+  const auto c = _mm_set1_ps(m.c);
+  const auto d = _mm_set1_ps(m.d);
+  const auto tx = _mm_set1_ps(m.tx);
+  const auto ty = _mm_set1_ps(m.ty);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = _mm_loadu_ps(xs + index);
+    const auto y = _mm_loadu_ps(ys + index);
+
+    _mm_storeu_ps(xs + index,
+                  _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, x), _mm_mul_ps(c, y)), tx));
+    _mm_storeu_ps(ys + index,
+                  _mm_add_ps(_mm_add_ps(_mm_mul_ps(b, x), _mm_mul_ps(d, y)), ty));
+  }
+
+  transform_scalar(xs + index, ys + index, count - index, m);
+}
+
+// Selects the values of the lanes with an area, and the fallback in the other lanes
+[[nodiscard]] inline auto select_sse2(const __m128 mask,
+                                      const __m128 values,
+                                      const __m128 fallback) noexcept -> __m128
+{
+  return _mm_or_ps(_mm_and_ps(mask, values), _mm_andnot_ps(mask, fallback));
+}
+
+// Merges the lanes of the vectors into the extent
+inline void reduce_extent_sse2(const __m128 minX,
+                               const __m128 minY,
+                               const __m128 maxX,
+                               const __m128 maxY,
+                               rect_extent<float>& extent) noexcept
+{
+  alignas(16) float lanes[4][4];
+  _mm_store_ps(lanes[0], minX);
+  _mm_store_ps(lanes[1], minY);
+  _mm_store_ps(lanes[2], maxX);
+  _mm_store_ps(lanes[3], maxY);
+
+  for (int lane = 0; lane < 4; ++lane)
+  {
+    extent.x = (lanes[0][lane] < extent.x) ? lanes[0][lane] : extent.x;
+    extent.y = (lanes[1][lane] < extent.y) ? lanes[1][lane] : extent.y;
+    extent.maxX = (lanes[2][lane] > extent.maxX) ? lanes[2][lane] : extent.maxX;
+    extent.maxY = (lanes[3][lane] > extent.maxY) ? lanes[3][lane] : extent.maxY;
+  }
+}
+
+inline void rect_bounds_sse2(const rect_columns<float>& rects,
+                             const std::size_t count,
+                             rect_extent<float>& extent) noexcept
+{
+  const auto zero = _mm_setzero_ps();
+  const auto highest = _mm_set1_ps((std::numeric_limits<float>::max)());
+  const auto lowest = _mm_set1_ps(std::numeric_limits<float>::lowest());
+
+  auto minX = highest;
+  auto minY = highest;
+  auto maxX = lowest;
+  auto maxY = lowest;
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = _mm_loadu_ps(rects.xs + index);
+    const auto y = _mm_loadu_ps(rects.ys + index);
+    const auto width = _mm_loadu_ps(rects.widths + index);
+    const auto height = _mm_loadu_ps(rects.heights + index);
+
+    const auto area = _mm_and_ps(_mm_cmpgt_ps(width, zero), _mm_cmpgt_ps(height, zero));
+
+    minX = _mm_min_ps(minX, select_sse2(area, x, highest));
+    minY = _mm_min_ps(minY, select_sse2(area, y, highest));
+    maxX = _mm_max_ps(maxX, select_sse2(area, _mm_add_ps(x, width), lowest));
+    maxY = _mm_max_ps(maxY, select_sse2(area, _mm_add_ps(y, height), lowest));
+  }
+
+  reduce_extent_sse2(minX, minY, maxX, maxY, extent);
+  rect_bounds_scalar(offset_columns(rects, index), count - index, extent);
+}
+
+inline void point_bounds_sse2(const float* xs,
+                              const float* ys,
+                              const std::size_t count,
+                              rect_extent<float>& extent) noexcept
+{
+  auto minX = _mm_set1_ps(extent.x);
+  auto minY = _mm_set1_ps(extent.y);
+  auto maxX = _mm_set1_ps(extent.maxX);
+  auto maxY = _mm_set1_ps(extent.maxY);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = _mm_loadu_ps(xs + index);
+    const auto y = _mm_loadu_ps(ys + index);
+
+    minX = _mm_min_ps(minX, x);
+    minY = _mm_min_ps(minY, y);
+    maxX = _mm_max_ps(maxX, x);
+    maxY = _mm_max_ps(maxY, y);
+  }
+
+  reduce_extent_sse2(minX, minY, maxX, maxY, extent);
+  point_bounds_scalar(xs + index, ys + index, count - index, extent);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+/// \name AVX2 kernels
+/// \{
+
+CENTURION_DETAIL_TARGET_AVX2
+inline auto rects_intersect_avx2(const rect_columns<float>& rects,
+                                 const std::size_t count,
+                                 const rect_extent<float>& area,
+                                 u8* out) noexcept -> std::size_t
+{
+  const auto minX = _mm256_set1_ps(area.x);
+  const auto minY = _mm256_set1_ps(area.y);
+  const auto maxX = _mm256_set1_ps(area.maxX);
+  const auto maxY = _mm256_set1_ps(area.maxY);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto x = _mm256_loadu_ps(rects.xs + index);
+    const auto y = _mm256_loadu_ps(rects.ys + index);
+    const auto right = _mm256_add_ps(x, _mm256_loadu_ps(rects.widths + index));
+    const auto bottom = _mm256_add_ps(y, _mm256_loadu_ps(rects.heights + index));
+
+    const auto hit =
+        _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(x, maxX, _CMP_LT_OQ),
+                                    _mm256_cmp_ps(right, minX, _CMP_GT_OQ)),
+                      _mm256_and_ps(_mm256_cmp_ps(y, maxY, _CMP_LT_OQ),
+                                    _mm256_cmp_ps(bottom, minY, _CMP_GT_OQ)));
+
+    hits += store_hits(static_cast<u32>(_mm256_movemask_ps(hit)), out + index, 8);
+  }
+
+  return hits + rects_intersect_scalar(offset_columns(rects, index),
+                                       count - index,
+                                       area,
+                                       out + index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline auto rects_contain_avx2(const rect_columns<float>& rects,
+                               const std::size_t count,
+                               const float px,
+                               const float py,
+                               u8* out) noexcept -> std::size_t
+{
+  const auto pointX = _mm256_set1_ps(px);
+  const auto pointY = _mm256_set1_ps(py);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto x = _mm256_loadu_ps(rects.xs + index);
+    const auto y = _mm256_loadu_ps(rects.ys + index);
+    const auto right = _mm256_add_ps(x, _mm256_loadu_ps(rects.widths + index));
+    const auto bottom = _mm256_add_ps(y, _mm256_loadu_ps(rects.heights + index));
+
+    const auto hit =
+        _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(pointX, x, _CMP_GE_OQ),
+                                    _mm256_cmp_ps(pointY, y, _CMP_GE_OQ)),
+                      _mm256_and_ps(_mm256_cmp_ps(pointX, right, _CMP_LE_OQ),
+                                    _mm256_cmp_ps(pointY, bottom, _CMP_LE_OQ)));
+
+    hits += store_hits(static_cast<u32>(_mm256_movemask_ps(hit)), out + index, 8);
+  }
+
+  return hits + rects_contain_scalar(offset_columns(rects, index),
+                                     count - index,
+                                     px,
+                                     py,
+                                     out + index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline auto points_within_avx2(const float* xs,
+                               const float* ys,
+                               const std::size_t count,
+                               const rect_extent<float>& area,
+                               u8* out) noexcept -> std::size_t
+{
+  const auto minX = _mm256_set1_ps(area.x);
+  const auto minY = _mm256_set1_ps(area.y);
+  const auto maxX = _mm256_set1_ps(area.maxX);
+  const auto maxY = _mm256_set1_ps(area.maxY);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto x = _mm256_loadu_ps(xs + index);
+    const auto y = _mm256_loadu_ps(ys + index);
+
+    const auto hit = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(x, minX, _CMP_GE_OQ),
+                                                 _mm256_cmp_ps(y, minY, _CMP_GE_OQ)),
+                                   _mm256_and_ps(_mm256_cmp_ps(x, maxX, _CMP_LE_OQ),
+                                                 _mm256_cmp_ps(y, maxY, _CMP_LE_OQ)));
+
+    hits += store_hits(static_cast<u32>(_mm256_movemask_ps(hit)), out + index, 8);
+  }
+
+  return hits +
+         points_within_scalar(xs + index, ys + index, count - index, area, out + index);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void translate_avx2(float* xs,
+                           float* ys,
+                           const std::size_t count,
+                           const float dx,
+                           const float dy) noexcept
+{
+  const auto offsetX = _mm256_set1_ps(dx);
+  const auto offsetY = _mm256_set1_ps(dy);
+
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    _mm256_storeu_ps(xs + index, _mm256_add_ps(_mm256_loadu_ps(xs + index), offsetX));
+    _mm256_storeu_ps(ys + index, _mm256_add_ps(_mm256_loadu_ps(ys + index), offsetY));
+  }
+
+  translate_scalar(xs + index, ys + index, count - index, dx, dy);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void transform_avx2(float* xs,
+                           float* ys,
+                           const std::size_t count,
+                           const affine_coefficients& m) noexcept
+{
+  const auto a = _mm256_set1_ps(m.a);
+  const auto b = _mm256_set1_ps(m.b);
+  const auto c = _mm256_set1_ps(m.c);
+  const auto d = _mm256_set1_ps(m.d);
+  const auto tx = _mm256_set1_ps(m.tx);
+  const auto ty = _mm256_set1_ps(m.ty);
+
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto x = _mm256_loadu_ps(xs + index);
+    const auto y = _mm256_loadu_ps(ys + index);
+
+    _mm256_storeu_ps(
+        xs + index,
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a, x), _mm256_mul_ps(c, y)), tx));
+    _mm256_storeu_ps(
+        ys + index,
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(b, x), _mm256_mul_ps(d, y)), ty));
+  }
+
+  transform_scalar(xs + index, ys + index, count - index, m);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void reduce_extent_avx2(const __m256 minX,
+                               const __m256 minY,
+                               const __m256 maxX,
+                               const __m256 maxY,
+                               rect_extent<float>& extent) noexcept
+{
+  alignas(32) float lanes[4][8];
+  _mm256_store_ps(lanes[0], minX);
+  _mm256_store_ps(lanes[1], minY);
+  _mm256_store_ps(lanes[2], maxX);
+  _mm256_store_ps(lanes[3], maxY);
+
+  for (int lane = 0; lane < 8; ++lane)
+  {
+    extent.x = (lanes[0][lane] < extent.x) ? lanes[0][lane] : extent.x;
+    extent.y = (lanes[1][lane] < extent.y) ? lanes[1][lane] : extent.y;
+    extent.maxX = (lanes[2][lane] > extent.maxX) ? lanes[2][lane] : extent.maxX;
+    extent.maxY = (lanes[3][lane] > extent.maxY) ? lanes[3][lane] : extent.maxY;
+  }
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void rect_bounds_avx2(const rect_columns<float>& rects,
+                             const std::size_t count,
+                             rect_extent<float>& extent) noexcept
+{
+  const auto zero = _mm256_setzero_ps();
+  const auto highest = _mm256_set1_ps((std::numeric_limits<float>::max)());
+  const auto lowest = _mm256_set1_ps(std::numeric_limits<float>::lowest());
+
+  auto minX = highest;
+  auto minY = highest;
+  auto maxX = lowest;
+  auto maxY = lowest;
+
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto x = _mm256_loadu_ps(rects.xs + index);
+    const auto y = _mm256_loadu_ps(rects.ys + index);
+    const auto width = _mm256_loadu_ps(rects.widths + index);
+    const auto height = _mm256_loadu_ps(rects.heights + index);
+
+    const auto area = _mm256_and_ps(_mm256_cmp_ps(width, zero, _CMP_GT_OQ),
+                                    _mm256_cmp_ps(height, zero, _CMP_GT_OQ));
+
+    minX = _mm256_min_ps(minX, _mm256_blendv_ps(highest, x, area));
+    minY = _mm256_min_ps(minY, _mm256_blendv_ps(highest, y, area));
+    maxX = _mm256_max_ps(maxX, _mm256_blendv_ps(lowest, _mm256_add_ps(x, width), area));
+    maxY = _mm256_max_ps(maxY, _mm256_blendv_ps(lowest, _mm256_add_ps(y, height), area));
+  }
+
+  reduce_extent_avx2(minX, minY, maxX, maxY, extent);
+  rect_bounds_scalar(offset_columns(rects, index), count - index, extent);
+}
+
+CENTURION_DETAIL_TARGET_AVX2
+inline void point_bounds_avx2(const float* xs,
+                              const float* ys,
+                              const std::size_t count,
+                              rect_extent<float>& extent) noexcept
+{
+  auto minX = _mm256_set1_ps(extent.x);
+  auto minY = _mm256_set1_ps(extent.y);
+  auto maxX = _mm256_set1_ps(extent.maxX);
+  auto maxY = _mm256_set1_ps(extent.maxY);
+
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto x = _mm256_loadu_ps(xs + index);
+    const auto y = _mm256_loadu_ps(ys + index);
+
+    minX = _mm256_min_ps(minX, x);
+    minY = _mm256_min_ps(minY, y);
+    maxX = _mm256_max_ps(maxX, x);
+    maxY = _mm256_max_ps(maxY, y);
+  }
+
+  reduce_extent_avx2(minX, minY, maxX, maxY, extent);
+  point_bounds_scalar(xs + index, ys + index, count - index, extent);
+}
+
+/// \} End of AVX2 kernels
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+// Stores the lanes of a comparison result as bytes, and returns the amount of hits
+inline auto store_hits_neon(const uint32x4_t mask, u8* out) noexcept -> std::size_t
+{
+  const auto bits = vandq_u32(mask, vdupq_n_u32(1));
+
+  u32 lanes[4];
+  vst1q_u32(lanes, bits);
+
+  std::size_t hits = 0;
+  for (int lane = 0; lane < 4; ++lane)
+  {
+    out[lane] = static_cast<u8>(lanes[lane]);
+    hits += lanes[lane];
+  }
+
+  return hits;
+}
+
+inline auto rects_intersect_neon(const rect_columns<float>& rects,
+                                 const std::size_t count,
+                                 const rect_extent<float>& area,
+                                 u8* out) noexcept -> std::size_t
+{
+  const auto minX = vdupq_n_f32(area.x);
+  const auto minY = vdupq_n_f32(area.y);
+  const auto maxX = vdupq_n_f32(area.maxX);
+  const auto maxY = vdupq_n_f32(area.maxY);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = vld1q_f32(rects.xs + index);
+    const auto y = vld1q_f32(rects.ys + index);
+    const auto right = vaddq_f32(x, vld1q_f32(rects.widths + index));
+    const auto bottom = vaddq_f32(y, vld1q_f32(rects.heights + index));
+
+    const auto hit = vandq_u32(vandq_u32(vcltq_f32(x, maxX), vcgtq_f32(right, minX)),
+                               vandq_u32(vcltq_f32(y, maxY), vcgtq_f32(bottom, minY)));
+
+    hits += store_hits_neon(hit, out + index);
+  }
+
+  return hits + rects_intersect_scalar(offset_columns(rects, index),
+                                       count - index,
+                                       area,
+                                       out + index);
+}
+
+inline auto rects_contain_neon(const rect_columns<float>& rects,
+                               const std::size_t count,
+                               const float px,
+                               const float py,
+                               u8* out) noexcept -> std::size_t
+{
+  const auto pointX = vdupq_n_f32(px);
+  const auto pointY = vdupq_n_f32(py);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = vld1q_f32(rects.xs + index);
+    const auto y = vld1q_f32(rects.ys + index);
+    const auto right = vaddq_f32(x, vld1q_f32(rects.widths + index));
+    const auto bottom = vaddq_f32(y, vld1q_f32(rects.heights + index));
+
+    const auto hit =
+        vandq_u32(vandq_u32(vcgeq_f32(pointX, x), vcgeq_f32(pointY, y)),
+                  vandq_u32(vcleq_f32(pointX, right), vcleq_f32(pointY, bottom)));
+
+    hits += store_hits_neon(hit, out + index);
+  }
+
+  return hits + rects_contain_scalar(offset_columns(rects, index),
+                                     count - index,
+                                     px,
+                                     py,
+                                     out + index);
+}
+
+inline auto points_within_neon(const float* xs,
+                               const float* ys,
+                               const std::size_t count,
+                               const rect_extent<float>& area,
+                               u8* out) noexcept -> std::size_t
+{
+  const auto minX = vdupq_n_f32(area.x);
+  const auto minY = vdupq_n_f32(area.y);
+  const auto maxX = vdupq_n_f32(area.maxX);
+  const auto maxY = vdupq_n_f32(area.maxY);
+
+  std::size_t hits = 0;
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = vld1q_f32(xs + index);
+    const auto y = vld1q_f32(ys + index);
+
+    const auto hit = vandq_u32(vandq_u32(vcgeq_f32(x, minX), vcgeq_f32(y, minY)),
+                               vandq_u32(vcleq_f32(x, maxX), vcleq_f32(y, maxY)));
+
+    hits += store_hits_neon(hit, out + index);
+  }
+
+  return hits +
+         points_within_scalar(xs + index, ys + index, count - index, area, out + index);
+}
+
+inline void translate_neon(float* xs,
+                           float* ys,
+                           const std::size_t count,
+                           const float dx,
+                           const float dy) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    vst1q_f32(xs + index, vaddq_f32(vld1q_f32(xs + index), vdupq_n_f32(dx)));
+    vst1q_f32(ys + index, vaddq_f32(vld1q_f32(ys + index), vdupq_n_f32(dy)));
+  }
+
+  translate_scalar(xs + index, ys + index, count - index, dx, dy);
+}
+
+inline void transform_neon(float* xs,
+                           float* ys,
+                           const std::size_t count,
+                           const affine_coefficients& m) noexcept
+{
+  const auto tx = vdupq_n_f32(m.tx);
+  const auto ty = vdupq_n_f32(m.ty);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = vld1q_f32(xs + index);
+    const auto y = vld1q_f32(ys + index);
+
+    vst1q_f32(xs + index, vmlaq_n_f32(vmlaq_n_f32(tx, x, m.a), y, m.c));
+    vst1q_f32(ys + index, vmlaq_n_f32(vmlaq_n_f32(ty, x, m.b), y, m.d));
+  }
+
+  transform_scalar(xs + index, ys + index, count - index, m);
+}
+
+inline void reduce_extent_neon(const float32x4_t minX,
+                               const float32x4_t minY,
+                               const float32x4_t maxX,
+                               const float32x4_t maxY,
+                               rect_extent<float>& extent) noexcept
+{
+  float lanes[4][4];
+  vst1q_f32(lanes[0], minX);
+  vst1q_f32(lanes[1], minY);
+  vst1q_f32(lanes[2], maxX);
+  vst1q_f32(lanes[3], maxY);
+
+  for (int lane = 0; lane < 4; ++lane)
+  {
+    extent.x = (lanes[0][lane] < extent.x) ? lanes[0][lane] : extent.x;
+    extent.y = (lanes[1][lane] < extent.y) ? lanes[1][lane] : extent.y;
+    extent.maxX = (lanes[2][lane] > extent.maxX) ? lanes[2][lane] : extent.maxX;
+    extent.maxY = (lanes[3][lane] > extent.maxY) ? lanes[3][lane] : extent.maxY;
+  }
+}
+
+inline void rect_bounds_neon(const rect_columns<float>& rects,
+                             const std::size_t count,
+                             rect_extent<float>& extent) noexcept
+{
+  const auto zero = vdupq_n_f32(0);
+  const auto highest = vdupq_n_f32((std::numeric_limits<float>::max)());
+  const auto lowest = vdupq_n_f32(std::numeric_limits<float>::lowest());
+
+  auto minX = highest;
+  auto minY = highest;
+  auto maxX = lowest;
+  auto maxY = lowest;
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = vld1q_f32(rects.xs + index);
+    const auto y = vld1q_f32(rects.ys + index);
+    const auto width = vld1q_f32(rects.widths + index);
+    const auto height = vld1q_f32(rects.heights + index);
+
+    const auto area = vandq_u32(vcgtq_f32(width, zero), vcgtq_f32(height, zero));
+
+    minX = vminq_f32(minX, vbslq_f32(area, x, highest));
+    minY = vminq_f32(minY, vbslq_f32(area, y, highest));
+    maxX = vmaxq_f32(maxX, vbslq_f32(area, vaddq_f32(x, width), lowest));
+    maxY = vmaxq_f32(maxY, vbslq_f32(area, vaddq_f32(y, height), lowest));
+  }
+
+  reduce_extent_neon(minX, minY, maxX, maxY, extent);
+  rect_bounds_scalar(offset_columns(rects, index), count - index, extent);
+}
+
+inline void point_bounds_neon(const float* xs,
+                              const float* ys,
+                              const std::size_t count,
+                              rect_extent<float>& extent) noexcept
+{
+  auto minX = vdupq_n_f32(extent.x);
+  auto minY = vdupq_n_f32(extent.y);
+  auto maxX = vdupq_n_f32(extent.maxX);
+  auto maxY = vdupq_n_f32(extent.maxY);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto x = vld1q_f32(xs + index);
+    const auto y = vld1q_f32(ys + index);
+
+    minX = vminq_f32(minX, x);
+    minY = vminq_f32(minY, y);
+    maxX = vmaxq_f32(maxX, x);
+    maxY = vmaxq_f32(maxY, y);
+  }
+
+  reduce_extent_neon(minX, minY, maxX, maxY, extent);
+  point_bounds_scalar(xs + index, ys + index, count - index, extent);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Marks the rectangles that intersect an area, and returns the amount of them.
+inline auto rects_intersect(const simd_level level,
+                            const rect_columns<float>& rects,
+                            const std::size_t count,
+                            const rect_extent<float>& area,
+                            u8* out) noexcept -> std::size_t
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      return rects_intersect_avx2(rects, count, area, out);
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      return rects_intersect_sse2(rects, count, area, out);
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      return rects_intersect_neon(rects, count, area, out);
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      return rects_intersect_scalar(rects, count, area, out);
+
+    default:
+      assert(false);
+      return 0;
+  }
+}
+
+/// Marks the rectangles that contain a point, and returns the amount of them.
+inline auto rects_contain(const simd_level level,
+                          const rect_columns<float>& rects,
+                          const std::size_t count,
+                          const float px,
+                          const float py,
+                          u8* out) noexcept -> std::size_t
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      return rects_contain_avx2(rects, count, px, py, out);
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      return rects_contain_sse2(rects, count, px, py, out);
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      return rects_contain_neon(rects, count, px, py, out);
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      return rects_contain_scalar(rects, count, px, py, out);
+
+    default:
+      assert(false);
+      return 0;
+  }
+}
+
+/// Marks the points that are within an area, and returns the amount of them.
+inline auto points_within(const simd_level level,
+                          const float* xs,
+                          const float* ys,
+                          const std::size_t count,
+                          const rect_extent<float>& area,
+                          u8* out) noexcept -> std::size_t
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      return points_within_avx2(xs, ys, count, area, out);
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      return points_within_sse2(xs, ys, count, area, out);
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      return points_within_neon(xs, ys, count, area, out);
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      return points_within_scalar(xs, ys, count, area, out);
+
+    default:
+      assert(false);
+      return 0;
+  }
+}
+
+/// Offsets the coordinates of rectangles or points, in place.
+inline void translate_coordinates(const simd_level level,
+                                  float* xs,
+                                  float* ys,
+                                  const std::size_t count,
+                                  const float dx,
+                                  const float dy) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      translate_avx2(xs, ys, count, dx, dy);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      translate_sse2(xs, ys, count, dx, dy);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      translate_neon(xs, ys, count, dx, dy);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      translate_scalar(xs, ys, count, dx, dy);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Applies an affine transform to the coordinates of points, in place.
+inline void transform_coordinates(const simd_level level,
+                                  float* xs,
+                                  float* ys,
+                                  const std::size_t count,
+                                  const affine_coefficients& m) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      transform_avx2(xs, ys, count, m);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      transform_sse2(xs, ys, count, m);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      transform_neon(xs, ys, count, m);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      transform_scalar(xs, ys, count, m);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Extends an extent by the rectangles with an area.
+inline void rect_bounds(const simd_level level,
+                        const rect_columns<float>& rects,
+                        const std::size_t count,
+                        rect_extent<float>& extent) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      rect_bounds_avx2(rects, count, extent);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      rect_bounds_sse2(rects, count, extent);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      rect_bounds_neon(rects, count, extent);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      rect_bounds_scalar(rects, count, extent);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Extends an extent by points.
+inline void point_bounds(const simd_level level,
+                         const float* xs,
+                         const float* ys,
+                         const std::size_t count,
+                         rect_extent<float>& extent) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      point_bounds_avx2(xs, ys, count, extent);
+      break;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      point_bounds_sse2(xs, ys, count, extent);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      point_bounds_neon(xs, ys, count, extent);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      point_bounds_scalar(xs, ys, count, extent);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+using rects_intersect_function = auto(const rect_columns<float>&,
+                                     std::size_t,
+                                     const rect_extent<float>&,
+                                     u8*) noexcept -> std::size_t;
+
+/// The intersection kernels, called with the implementation of the current instruction
+/// set.
+inline constexpr simd_kernel<rects_intersect_function> rects_intersect_kernel{
+    &rects_intersect_scalar<float>,
+    CENTURION_DETAIL_SSE2_KERNEL(rects_intersect_sse2),
+    CENTURION_DETAIL_AVX2_KERNEL(rects_intersect_avx2),
+    CENTURION_DETAIL_NEON_KERNEL(rects_intersect_neon)};
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RECT_KERNELS_HEADER
@@ -0,0 +1,61 @@
+#ifndef CENTURION_DETAIL_RENDER_TARGET_SCOPE_HEADER
+#define CENTURION_DETAIL_RENDER_TARGET_SCOPE_HEADER
+
+#include <SDL.h>
+
+#include "../core/result.hpp"
+#include "../video/renderer.hpp"
+#include "../video/texture.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Redirects rendering to a target texture, and restores the previous target on exit
+template <typename T>
+class render_target_scope final
+{
+ public:
+  template <typename U>
+  render_target_scope(basic_renderer<T>& renderer, basic_texture<U>& target) noexcept
+      : m_renderer{renderer}
+      , m_previous{SDL_GetRenderTarget(renderer.get())}
+      , m_active{renderer.set_target(target)}
+  {}
+
+  render_target_scope(const render_target_scope&) = delete;
+
+  auto operator=(const render_target_scope&) -> render_target_scope& = delete;
+
+  ~render_target_scope() noexcept
+  {
+    if (!m_active)
+    {
+      return;
+    }
+
+    if (m_previous)
+    {
+      texture_handle previous{m_previous};
+      m_renderer.set_target(previous);
+    }
+    else
+    {
+      m_renderer.reset_target();
+    }
+  }
+
+  [[nodiscard]] auto is_active() const noexcept -> bool
+  {
+    return static_cast<bool>(m_active);
+  }
+
+ private:
+  basic_renderer<T>& m_renderer;
+  SDL_Texture* m_previous{};
+  result m_active;
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RENDER_TARGET_SCOPE_HEADER
@@ -0,0 +1,563 @@
+#ifndef CENTURION_DETAIL_RESAMPLE_KERNELS_HEADER
+#define CENTURION_DETAIL_RESAMPLE_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // fill
+#include <cassert>    // assert
+#include <cmath>      // fabs, sin, floor, ceil, lround
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The resampling kernels treat the four bytes of a 32-bit pixel as independent channels,
+ * so they work with any of the 32-bit formats supported by the pixel kernels. Filter
+ * weights are 2.14 fixed-point values, and the amount of taps per output sample is
+ * padded to an even number so that two taps can be combined with a single
+ * multiply-add. Padding taps have zero weights, but may refer to samples past the end of
+ * very small sources, which the callers must account for.
+ */
+
+inline constexpr int resample_shift = 14;
+inline constexpr int resample_one = 1 << resample_shift;
+inline constexpr int resample_round = 1 << (resample_shift - 1);
+
+enum class resample_kernel
+{
+  box,
+  triangle,
+  lanczos3
+};
+
+[[nodiscard]] inline auto resample_support(const resample_kernel kernel) noexcept
+    -> double
+{
+  switch (kernel)
+  {
+    case resample_kernel::box:
+      return 0.5;
+
+    case resample_kernel::triangle:
+      return 1.0;
+
+    case resample_kernel::lanczos3:
+      return 3.0;
+
+    default:
+      assert(false);
+      return 0.5;
+  }
+}
+
+[[nodiscard]] inline auto resample_weight(const resample_kernel kernel, double x) noexcept
+    -> double
+{
+  x = std::fabs(x);
+  switch (kernel)
+  {
+    case resample_kernel::box:
+      return (x <= 0.5) ? 1.0 : 0.0;
+
+    case resample_kernel::triangle:
+      return (x < 1.0) ? 1.0 - x : 0.0;
+
+    case resample_kernel::lanczos3:
+    {
+      if (x < 1e-8)
+      {
+        return 1.0;
+      }
+      else if (x >= 3.0)
+      {
+        return 0.0;
+      }
+
+      constexpr double pi = 3.14159265358979323846;
+      const auto px = pi * x;
+      return 3.0 * std::sin(px) * std::sin(px / 3.0) / (px * px);
+    }
+
+    default:
+      assert(false);
+      return 0.0;
+  }
+}
+
+/// The filter taps of every output sample along one axis.
+struct resample_taps final
+{
+  std::vector<int> first;  ///< The first source index of every output sample.
+  std::vector<i16> weights;
+  int count{};  ///< The amount of taps per output sample, always even.
+};
+
+[[nodiscard]] inline auto make_resample_taps(const resample_kernel kernel,
+                                             const int sourceSize,
+                                             const int targetSize) -> resample_taps
+{
+  const auto scale = static_cast<double>(sourceSize) / targetSize;
+
+  // Downscaling widens the filter, so that every source sample contributes
+  const auto stretch = (scale > 1.0) ? scale : 1.0;
+  const auto support = resample_support(kernel) * stretch;
+
+  int count = static_cast<int>(std::ceil(support * 2.0)) + 1;
+  if (count > sourceSize)
+  {
+    count = sourceSize;
+  }
+  count += count % 2;
+
+  resample_taps taps;
+  taps.count = count;
+  taps.first.resize(static_cast<std::size_t>(targetSize));
+  taps.weights.assign(static_cast<std::size_t>(targetSize) * count, 0);
+
+  std::vector<double> weights(static_cast<std::size_t>(count));
+
+  for (int target = 0; target < targetSize; ++target)
+  {
+    const auto center = (target + 0.5) * scale;
+
+    // Samples outside of the source are folded onto the edges
+    auto first = static_cast<int>(std::floor(center - support));
+    if (first + count > sourceSize)
+    {
+      first = sourceSize - count;
+    }
+    if (first < 0)
+    {
+      first = 0;
+    }
+
+    std::fill(weights.begin(), weights.end(), 0.0);
+
+    double sum = 0;
+    const auto lo = static_cast<int>(std::floor(center - support));
+    const auto hi = static_cast<int>(std::ceil(center + support));
+    for (int source = lo; source <= hi; ++source)
+    {
+      const auto weight = resample_weight(kernel, (source + 0.5 - center) / stretch);
+      if (weight == 0.0)
+      {
+        continue;
+      }
+
+      auto index = (source < 0) ? 0 : (source >= sourceSize ? sourceSize - 1 : source);
+      index -= first;
+      if (index < 0)
+      {
+        index = 0;
+      }
+      else if (index >= count)
+      {
+        index = count - 1;
+      }
+
+      weights[static_cast<std::size_t>(index)] += weight;
+      sum += weight;
+    }
+
+    // Fall back to the nearest sample if the filter missed every sample
+    if (sum == 0.0)
+    {
+      auto nearest = static_cast<int>(center) - first;
+      nearest = (nearest < 0) ? 0 : (nearest >= count ? count - 1 : nearest);
+      weights[static_cast<std::size_t>(nearest)] = 1.0;
+      sum = 1.0;
+    }
+
+    // The fixed-point weights must add up to exactly one
+    auto* fixed = taps.weights.data() + static_cast<std::size_t>(target) * count;
+    int total = 0;
+    int largest = 0;
+    for (int tap = 0; tap < count; ++tap)
+    {
+      const auto weight = weights[static_cast<std::size_t>(tap)] / sum;
+      fixed[tap] = static_cast<i16>(std::lround(weight * resample_one));
+      total += fixed[tap];
+
+      if (fixed[tap] > fixed[largest])
+      {
+        largest = tap;
+      }
+    }
+
+    fixed[largest] = static_cast<i16>(fixed[largest] + (resample_one - total));
+    taps.first[static_cast<std::size_t>(target)] = first;
+  }
+
+  return taps;
+}
+
+[[nodiscard]] constexpr auto resample_clamp(const int sum) noexcept -> u8
+{
+  if (sum <= 0)
+  {
+    return 0;
+  }
+
+  const auto value = (sum + resample_round) >> resample_shift;
+  return static_cast<u8>((value > 255) ? 255 : value);
+}
+
+/// \name Scalar kernels
+/// \{
+
+/// Resamples a row of pixels horizontally.
+inline void resample_row_scalar(const resample_taps& taps,
+                                const u8* src,
+                                u8* dst,
+                                const int width) noexcept
+{
+  for (int x = 0; x < width; ++x)
+  {
+    const auto* weights = taps.weights.data() + static_cast<std::size_t>(x) * taps.count;
+    const auto* pixels = src + taps.first[static_cast<std::size_t>(x)] * 4;
+
+    int sums[4] = {};
+    for (int tap = 0; tap < taps.count; ++tap)
+    {
+      for (int channel = 0; channel < 4; ++channel)
+      {
+        sums[channel] += weights[tap] * pixels[tap * 4 + channel];
+      }
+    }
+
+    for (int channel = 0; channel < 4; ++channel)
+    {
+      dst[x * 4 + channel] = resample_clamp(sums[channel]);
+    }
+  }
+}
+
+/// Combines the bytes in [begin, end) of rows, with one weight per row.
+inline void resample_column_scalar(const u8* const* rows,
+                                   const i16* weights,
+                                   const int count,
+                                   u8* dst,
+                                   const std::size_t begin,
+                                   const std::size_t end) noexcept
+{
+  for (std::size_t index = begin; index < end; ++index)
+  {
+    int sum = 0;
+    for (int tap = 0; tap < count; ++tap)
+    {
+      sum += weights[tap] * rows[tap][index];
+    }
+
+    dst[index] = resample_clamp(sum);
+  }
+}
+
+/// Averages blocks of 2x2 pixels, the source rows must hold `2 * width` pixels.
+inline void halve_scalar(const u8* top,
+                         const u8* bottom,
+                         u8* dst,
+                         const int width) noexcept
+{
+  for (int x = 0; x < width * 4; ++x)
+  {
+    const auto left = (x / 4) * 8 + (x % 4);
+    const auto sum = top[left] + top[left + 4] + bottom[left] + bottom[left + 4];
+    dst[x] = static_cast<u8>((sum + 2) >> 2);
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+// Multiplies pairs of 16-bit values by a pair of weights, and accumulates the sums
+[[nodiscard]] inline auto madd_pair(const __m128i acc,
+                                    const __m128i interleaved,
+                                    const i16 first,
+                                    const i16 second) noexcept -> __m128i
+{
+  const auto weights = _mm_set1_epi32(static_cast<int>(
+      (static_cast<u32>(static_cast<u16>(second)) << 16u) | static_cast<u16>(first)));
+  return _mm_add_epi32(acc, _mm_madd_epi16(interleaved, weights));
+}
+
+[[nodiscard]] inline auto pack_sums(const __m128i low, const __m128i high) noexcept
+    -> __m128i
+{
+  const auto round = _mm_set1_epi32(resample_round);
+  const auto a = _mm_srai_epi32(_mm_add_epi32(low, round), resample_shift);
+  const auto b = _mm_srai_epi32(_mm_add_epi32(high, round), resample_shift);
+  const auto words = _mm_packs_epi32(a, b);
+  return _mm_packus_epi16(words, words);
+}
+
+inline void resample_row_sse2(const resample_taps& taps,
+                              const u8* src,
+                              u8* dst,
+                              const int width) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+
+  for (int x = 0; x < width; ++x)
+  {
+    const auto* weights = taps.weights.data() + static_cast<std::size_t>(x) * taps.count;
+    const auto* pixels = src + taps.first[static_cast<std::size_t>(x)] * 4;
+
+    auto acc = _mm_setzero_si128();
+    for (int tap = 0; tap < taps.count; tap += 2)
+    {
+      u32 a{};
+      u32 b{};
+      SDL_memcpy(&a, pixels + tap * 4, sizeof a);
+      SDL_memcpy(&b, pixels + tap * 4 + 4, sizeof b);
+
+      const auto first = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(a)), zero);
+      const auto second = _mm_unpacklo_epi8(_mm_cvtsi32_si128(static_cast<int>(b)), zero);
+      acc = madd_pair(acc,
+                      _mm_unpacklo_epi16(first, second),
+                      weights[tap],
+                      weights[tap + 1]);
+    }
+
+    const auto packed = pack_sums(acc, acc);
+    const auto value = static_cast<u32>(_mm_cvtsi128_si32(packed));
+    SDL_memcpy(dst + x * 4, &value, sizeof value);
+  }
+}
+
+inline void resample_column_sse2(const u8* const* rows,
+                                 const i16* weights,
+                                 const int count,
+                                 u8* dst,
+                                 const std::size_t bytes) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+
+  std::size_t index = 0;
+  for (; index + 8 <= bytes; index += 8)
+  {
+    auto low = _mm_setzero_si128();
+    auto high = _mm_setzero_si128();
+
+    for (int tap = 0; tap < count; tap += 2)
+    {
+      const auto* a = reinterpret_cast<const __m128i*>(rows[tap] + index);
+      const auto* b = reinterpret_cast<const __m128i*>(rows[tap + 1] + index);
+      const auto first = _mm_unpacklo_epi8(_mm_loadl_epi64(a), zero);
+      const auto second = _mm_unpacklo_epi8(_mm_loadl_epi64(b), zero);
+
+      const auto wa = weights[tap];
+      const auto wb = weights[tap + 1];
+      low = madd_pair(low, _mm_unpacklo_epi16(first, second), wa, wb);
+      high = madd_pair(high, _mm_unpackhi_epi16(first, second), wa, wb);
+    }
+
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + index), pack_sums(low, high));
+  }
+
+  resample_column_scalar(rows, weights, count, dst, index, bytes);
+}
+
+inline void halve_sse2(const u8* top, const u8* bottom, u8* dst, const int width) noexcept
+{
+  const auto zero = _mm_setzero_si128();
+  const auto two = _mm_set1_epi16(2);
+
+  int x = 0;
+  for (; x + 2 <= width; x += 2)
+  {
+    // Four source pixels in each row yield two output pixels
+    const auto a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + x * 8));
+    const auto b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + x * 8));
+
+    const auto low =
+        _mm_add_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero));
+    const auto high =
+        _mm_add_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero));
+
+    const auto left = _mm_add_epi16(low, _mm_srli_si128(low, 8));
+    const auto right = _mm_add_epi16(high, _mm_srli_si128(high, 8));
+
+    auto sums = _mm_unpacklo_epi64(left, right);
+    sums = _mm_srli_epi16(_mm_add_epi16(sums, two), 2);
+
+    const auto packed = _mm_packus_epi16(sums, sums);
+    _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + x * 4), packed);
+  }
+
+  halve_scalar(top + x * 8, bottom + x * 8, dst + x * 4, width - x);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+inline void resample_column_neon(const u8* const* rows,
+                                 const i16* weights,
+                                 const int count,
+                                 u8* dst,
+                                 const std::size_t bytes) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 8 <= bytes; index += 8)
+  {
+    auto low = vdupq_n_s32(0);
+    auto high = vdupq_n_s32(0);
+
+    for (int tap = 0; tap < count; ++tap)
+    {
+      const auto values = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(rows[tap] + index)));
+      low = vmlal_n_s16(low, vget_low_s16(values), weights[tap]);
+      high = vmlal_n_s16(high, vget_high_s16(values), weights[tap]);
+    }
+
+    // Rounds, saturates to 16 bits, and then saturates to unsigned bytes
+    const auto words = vcombine_s16(vqrshrn_n_s32(low, resample_shift),
+                                    vqrshrn_n_s32(high, resample_shift));
+    vst1_u8(dst + index, vqmovun_s16(words));
+  }
+
+  resample_column_scalar(rows, weights, count, dst, index, bytes);
+}
+
+inline void halve_neon(const u8* top, const u8* bottom, u8* dst, const int width) noexcept
+{
+  int x = 0;
+  for (; x + 4 <= width; x += 4)
+  {
+    // De-interleaves eight pixels per row, so that neighbouring pixels can be added
+    const auto a = vld2q_u32(reinterpret_cast<const u32*>(top + x * 8));
+    const auto b = vld2q_u32(reinterpret_cast<const u32*>(bottom + x * 8));
+
+    const auto topFirst = vaddl_u8(vget_low_u8(vreinterpretq_u8_u32(a.val[0])),
+                                   vget_low_u8(vreinterpretq_u8_u32(a.val[1])));
+    const auto topSecond = vaddl_u8(vget_high_u8(vreinterpretq_u8_u32(a.val[0])),
+                                    vget_high_u8(vreinterpretq_u8_u32(a.val[1])));
+    const auto bottomFirst = vaddl_u8(vget_low_u8(vreinterpretq_u8_u32(b.val[0])),
+                                      vget_low_u8(vreinterpretq_u8_u32(b.val[1])));
+    const auto bottomSecond = vaddl_u8(vget_high_u8(vreinterpretq_u8_u32(b.val[0])),
+                                       vget_high_u8(vreinterpretq_u8_u32(b.val[1])));
+
+    const auto left = vrshrn_n_u16(vaddq_u16(topFirst, bottomFirst), 2);
+    const auto right = vrshrn_n_u16(vaddq_u16(topSecond, bottomSecond), 2);
+    vst1q_u8(dst + x * 4, vcombine_u8(left, right));
+  }
+
+  halve_scalar(top + x * 8, bottom + x * 8, dst + x * 4, width - x);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+inline void resample_row(const simd_level level,
+                         const resample_taps& taps,
+                         const u8* src,
+                         u8* dst,
+                         const int width) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      resample_row_sse2(taps, src, dst, width);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+    case simd_level::none:
+      resample_row_scalar(taps, src, dst, width);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+inline void resample_column(const simd_level level,
+                            const u8* const* rows,
+                            const i16* weights,
+                            const int count,
+                            u8* dst,
+                            const std::size_t bytes) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      resample_column_sse2(rows, weights, count, dst, bytes);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      resample_column_neon(rows, weights, count, dst, bytes);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      resample_column_scalar(rows, weights, count, dst, 0, bytes);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+inline void halve_row(const simd_level level,
+                      const u8* top,
+                      const u8* bottom,
+                      u8* dst,
+                      const int width) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      halve_sse2(top, bottom, dst, width);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      halve_neon(top, bottom, dst, width);
+      break;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      halve_scalar(top, bottom, dst, width);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RESAMPLE_KERNELS_HEADER
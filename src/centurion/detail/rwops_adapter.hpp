@@ -0,0 +1,44 @@
+#ifndef CENTURION_DETAIL_RWOPS_ADAPTER_HEADER
+#define CENTURION_DETAIL_RWOPS_ADAPTER_HEADER
+
+#include <SDL.h>
+
+#include <memory>  // unique_ptr
+
+#include "../filesystem/file.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// The state of a file is stored in the user data of the SDL_RWops
+template <typename State>
+[[nodiscard]] auto rwops_state(SDL_RWops* context) noexcept -> State&
+{
+  return *static_cast<State*>(context->hidden.unknown.data1);
+}
+
+// Creates a file that forwards its operations to the static functions of the state
+template <typename State>
+[[nodiscard]] auto make_rwops(std::unique_ptr<State> state) noexcept -> file
+{
+  auto* context = SDL_AllocRW();
+  if (!context)
+  {
+    return file{nullptr};
+  }
+
+  context->type = SDL_RWOPS_UNKNOWN;
+  context->size = &State::size;
+  context->seek = &State::seek;
+  context->read = &State::read;
+  context->write = &State::write;
+  context->close = &State::close;
+  context->hidden.unknown.data1 = state.release();
+
+  return file{context};
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_RWOPS_ADAPTER_HEADER
@@ -0,0 +1,226 @@
+#ifndef CENTURION_DETAIL_SAMPLE_KERNELS_HEADER
+#define CENTURION_DETAIL_SAMPLE_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cmath>    // nearbyint
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels convert between signed 16-bit samples and floating-point samples in the
+ * range [-1, 1). Floating-point samples are rounded to the nearest integer, with ties to
+ * even, and saturated when they are converted back, so that every implementation produces
+ * the same samples. The result of converting NaN is unspecified.
+ */
+
+inline constexpr float sample_scale = 32'768.0f;
+inline constexpr float sample_inverse_scale = 1.0f / sample_scale;
+
+/// \name Scalar kernels
+/// \{
+
+inline void s16_to_float_scalar(const i16* src,
+                                float* dst,
+                                const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    dst[index] = static_cast<float>(src[index]) * sample_inverse_scale;
+  }
+}
+
+inline void float_to_s16_scalar(const float* src,
+                                i16* dst,
+                                const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    auto value = std::nearbyint(src[index] * sample_scale);
+
+    value = (value < 32'767.0f) ? value : 32'767.0f;
+    value = (value > -32'768.0f) ? value : -32'768.0f;
+
+    dst[index] = static_cast<i16>(value);
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+inline void s16_to_float_sse2(const i16* src,
+                              float* dst,
+                              const std::size_t count) noexcept
+{
+  const auto scale = _mm_set1_ps(sample_inverse_scale);
+
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+
+    // Sign extension, by moving the samples into the upper halves of 32-bit lanes
+    const auto low = _mm_srai_epi32(_mm_unpacklo_epi16(values, values), 16);
+    const auto high = _mm_srai_epi32(_mm_unpackhi_epi16(values, values), 16);
+
+    _mm_storeu_ps(dst + index, _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+    _mm_storeu_ps(dst + index + 4, _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+  }
+
+  s16_to_float_scalar(src + index, dst + index, count - index);
+}
+
+inline void float_to_s16_sse2(const float* src,
+                              i16* dst,
+                              const std::size_t count) noexcept
+{
+  const auto scale = _mm_set1_ps(sample_scale);
+  const auto max = _mm_set1_ps(32'767.0f);
+
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    // Out-of-range values would convert to the "integer indefinite" value otherwise
+    const auto low = _mm_min_ps(_mm_mul_ps(_mm_loadu_ps(src + index), scale), max);
+    const auto high = _mm_min_ps(_mm_mul_ps(_mm_loadu_ps(src + index + 4), scale), max);
+
+    // The conversions round to nearest even, and the pack saturates
+    const auto packed = _mm_packs_epi32(_mm_cvtps_epi32(low), _mm_cvtps_epi32(high));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), packed);
+  }
+
+  float_to_s16_scalar(src + index, dst + index, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#if defined(CENTURION_DETAIL_NEON_KERNELS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define CENTURION_DETAIL_NEON_SAMPLE_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+inline void s16_to_float_neon(const i16* src,
+                              float* dst,
+                              const std::size_t count) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    const auto values = vld1q_s16(src + index);
+
+    const auto low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(values)));
+    const auto high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(values)));
+
+    vst1q_f32(dst + index, vmulq_n_f32(low, sample_inverse_scale));
+    vst1q_f32(dst + index + 4, vmulq_n_f32(high, sample_inverse_scale));
+  }
+
+  s16_to_float_scalar(src + index, dst + index, count - index);
+}
+
+inline void float_to_s16_neon(const float* src,
+                              i16* dst,
+                              const std::size_t count) noexcept
+{
+  std::size_t index = 0;
+  for (; index + 8 <= count; index += 8)
+  {
+    // The conversions round to nearest even and saturate, as does the narrowing
+    const auto low = vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + index), sample_scale));
+    const auto high =
+        vcvtnq_s32_f32(vmulq_n_f32(vld1q_f32(src + index + 4), sample_scale));
+
+    vst1q_s16(dst + index, vcombine_s16(vqmovn_s32(low), vqmovn_s32(high)));
+  }
+
+  float_to_s16_scalar(src + index, dst + index, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_SAMPLE_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Converts signed 16-bit samples to floating-point samples.
+inline void s16_to_float(const simd_level level,
+                         const i16* src,
+                         float* dst,
+                         const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:  // The conversions are bound by the memory bandwidth
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      s16_to_float_sse2(src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_SAMPLE_KERNELS
+      s16_to_float_neon(src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_SAMPLE_KERNELS
+
+    case simd_level::none:
+      s16_to_float_scalar(src, dst, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// Converts floating-point samples to signed 16-bit samples, with saturation.
+inline void float_to_s16(const simd_level level,
+                         const float* src,
+                         i16* dst,
+                         const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      float_to_s16_sse2(src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_SAMPLE_KERNELS
+      float_to_s16_neon(src, dst, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_SAMPLE_KERNELS
+
+    case simd_level::none:
+      float_to_s16_scalar(src, dst, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SAMPLE_KERNELS_HEADER
@@ -0,0 +1,265 @@
+#ifndef CENTURION_DETAIL_SIMD_DISPATCH_HEADER
+#define CENTURION_DETAIL_SIMD_DISPATCH_HEADER
+
+#include <SDL.h>
+
+#include <atomic>   // atomic, memory_order_relaxed
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <utility>  // forward
+
+#include "../system/cpu.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CENTURION_DETAIL_SSE2_KERNELS
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#if defined(__GNUC__) || defined(__clang__)
+#include <immintrin.h>
+#define CENTURION_DETAIL_AVX2_KERNELS
+#define CENTURION_DETAIL_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(_MSC_VER)
+#include <immintrin.h>
+#define CENTURION_DETAIL_AVX2_KERNELS
+#define CENTURION_DETAIL_TARGET_AVX2
+#endif
+#endif
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define CENTURION_DETAIL_NEON_KERNELS
+#endif
+
+// Expand to the address of a kernel, or to a null pointer if it wasn't compiled
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+#define CENTURION_DETAIL_SSE2_KERNEL(kernel) &kernel
+#else
+#define CENTURION_DETAIL_SSE2_KERNEL(kernel) nullptr
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+#define CENTURION_DETAIL_AVX2_KERNEL(kernel) &kernel
+#else
+#define CENTURION_DETAIL_AVX2_KERNEL(kernel) nullptr
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+#define CENTURION_DETAIL_NEON_KERNEL(kernel) &kernel
+#else
+#define CENTURION_DETAIL_NEON_KERNEL(kernel) nullptr
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels are selected at runtime, based on the instruction sets supported by both
+ * the build and the CPU. The CPU is only queried once, after which the selected level is
+ * stored in an atomic that can be overridden, e.g. to test the fallbacks of higher level
+ * APIs on CPUs that support faster kernels.
+ *
+ * The dispatch functions switch over every level, ordered from AVX2 to scalar, so that
+ * levels whose kernels weren't compiled fall through to the next lower level.
+ */
+
+enum class simd_level
+{
+  none,
+  sse2,
+  avx2,
+  neon
+};
+
+/// Indicates whether or not kernels for an instruction set were compiled.
+[[nodiscard]] constexpr auto is_simd_level_available(const simd_level level) noexcept
+    -> bool
+{
+  switch (level)
+  {
+    case simd_level::none:
+      return true;
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      return true;
+#else
+      return false;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      return true;
+#else
+      return false;
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      return true;
+#else
+      return false;
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    default:
+      assert(false);
+      return false;
+  }
+}
+
+/// Indicates whether or not kernels for an instruction set were compiled and can run.
+[[nodiscard]] inline auto is_simd_level_supported(const simd_level level) noexcept
+    -> bool
+{
+  if (!is_simd_level_available(level))
+  {
+    return false;
+  }
+
+  switch (level)
+  {
+    case simd_level::none:
+      return true;
+
+    case simd_level::sse2:
+      return cpu::has_sse2();
+
+    case simd_level::avx2:
+      return cpu::has_avx2();
+
+    case simd_level::neon:
+      return cpu::has_neon();
+
+    default:
+      assert(false);
+      return false;
+  }
+}
+
+/// Returns the best instruction set supported by both the build and the CPU.
+[[nodiscard]] inline auto detect_simd_level() noexcept -> simd_level
+{
+  static const auto level = []() noexcept {
+    for (const auto candidate : {simd_level::avx2, simd_level::sse2, simd_level::neon})
+    {
+      if (is_simd_level_supported(candidate))
+      {
+        return candidate;
+      }
+    }
+
+    return simd_level::none;
+  }();
+
+  return level;
+}
+
+[[nodiscard]] inline auto current_simd_level() noexcept -> std::atomic<simd_level>&
+{
+  static std::atomic<simd_level> level{detect_simd_level()};
+  return level;
+}
+
+/// Returns the instruction set that the dispatched kernels use.
+[[nodiscard]] inline auto get_simd_level() noexcept -> simd_level
+{
+  return current_simd_level().load(std::memory_order_relaxed);
+}
+
+/**
+ * Overrides the instruction set used by the dispatched kernels, which fails if the
+ * instruction set isn't supported. Kernels that are already running are not affected.
+ */
+inline auto set_simd_level(const simd_level level) noexcept -> bool
+{
+  if (!is_simd_level_supported(level))
+  {
+    return false;
+  }
+
+  current_simd_level().store(level, std::memory_order_relaxed);
+  return true;
+}
+
+/// Restores the instruction set that was selected based on the CPU.
+inline void reset_simd_level() noexcept
+{
+  current_simd_level().store(detect_simd_level(), std::memory_order_relaxed);
+}
+
+/// Overrides the instruction set of the dispatched kernels for the lifetime of the scope.
+class scoped_simd_level final
+{
+ public:
+  explicit scoped_simd_level(const simd_level level) noexcept
+      : m_previous{get_simd_level()}
+      , m_active{set_simd_level(level)}
+  {}
+
+  scoped_simd_level(const scoped_simd_level&) = delete;
+  auto operator=(const scoped_simd_level&) -> scoped_simd_level& = delete;
+
+  ~scoped_simd_level() noexcept
+  {
+    current_simd_level().store(m_previous, std::memory_order_relaxed);
+  }
+
+  /// Indicates whether or not the instruction set was supported, and thus selected.
+  [[nodiscard]] auto active() const noexcept -> bool
+  {
+    return m_active;
+  }
+
+ private:
+  simd_level m_previous;
+  bool m_active;
+};
+
+/**
+ * A table of the implementations of a kernel for each instruction set.
+ *
+ * Missing implementations, i.e. null pointers, are replaced by the scalar implementation
+ * when the table is created, which happens during constant initialization, so a call
+ * only loads the current level and the function pointer at that index. This replaces a
+ * switch at each call site, and lets the kernel families share the level override.
+ */
+template <typename Function>
+class simd_kernel final
+{
+ public:
+  using pointer = Function*;
+
+  constexpr simd_kernel(const pointer scalar,
+                        const pointer sse2,
+                        const pointer avx2,
+                        const pointer neon) noexcept
+      : m_table{scalar, sse2 ? sse2 : scalar, avx2 ? avx2 : scalar, neon ? neon : scalar}
+  {}
+
+  template <typename... Args>
+  auto operator()(Args&&... args) const noexcept -> decltype(auto)
+  {
+    return get()(std::forward<Args>(args)...);
+  }
+
+  /// Returns the implementation for the current instruction set.
+  [[nodiscard]] auto get() const noexcept -> pointer
+  {
+    return get(get_simd_level());
+  }
+
+  /// Returns the implementation for an instruction set, which must be supported.
+  [[nodiscard]] constexpr auto get(const simd_level level) const noexcept -> pointer
+  {
+    return m_table[static_cast<std::size_t>(level)];
+  }
+
+ private:
+  pointer m_table[4];
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SIMD_DISPATCH_HEADER
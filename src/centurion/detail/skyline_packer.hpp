@@ -0,0 +1,183 @@
+#ifndef CENTURION_DETAIL_SKYLINE_PACKER_HEADER
+#define CENTURION_DETAIL_SKYLINE_PACKER_HEADER
+
+#include <cstddef>   // size_t
+#include <optional>  // optional, nullopt
+#include <vector>    // vector
+
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * \brief A rectangle packer that uses the "skyline bottom-left" heuristic.
+ *
+ * \details The packer keeps track of the silhouette, i.e. the skyline, formed by the
+ * rectangles that have been packed so far. New rectangles are placed at the position
+ * that results in the lowest resulting top edge, which gives good results for the
+ * typical use case of packing many small images into a texture atlas.
+ *
+ * \since 6.1.0
+ */
+class skyline_packer final
+{
+ public:
+  explicit skyline_packer(const iarea size) : m_size{size}
+  {
+    m_nodes.push_back({0, 0, size.width});
+  }
+
+  /**
+   * \brief Attempts to find a position for a rectangle of the specified size.
+   *
+   * \param size the size of the rectangle.
+   *
+   * \return the position of the rectangle; `std::nullopt` if it didn't fit.
+   */
+  [[nodiscard]] auto insert(const iarea size) -> std::optional<ipoint>
+  {
+    if (size.width <= 0 || size.height <= 0)
+    {
+      return std::nullopt;
+    }
+
+    std::optional<std::size_t> bestIndex;
+    int bestTop{};
+    int bestWidth{};
+    int bestY{};
+
+    for (std::size_t index = 0; index < m_nodes.size(); ++index)
+    {
+      if (const auto y = fit(index, size))
+      {
+        const auto top = *y + size.height;
+        const auto width = m_nodes[index].width;
+        if (!bestIndex || top < bestTop || (top == bestTop && width < bestWidth))
+        {
+          bestIndex = index;
+          bestTop = top;
+          bestWidth = width;
+          bestY = *y;
+        }
+      }
+    }
+
+    if (!bestIndex)
+    {
+      return std::nullopt;
+    }
+
+    const ipoint position{m_nodes[*bestIndex].x, bestY};
+    add_level(*bestIndex, position, size);
+
+    m_usedArea += size.width * size.height;
+    return position;
+  }
+
+  /**
+   * \brief Returns the ratio of the packed area and the total area, in the range [0, 1].
+   */
+  [[nodiscard]] auto occupancy() const noexcept -> float
+  {
+    return static_cast<float>(m_usedArea) /
+           static_cast<float>(m_size.width * m_size.height);
+  }
+
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+ private:
+  struct node final
+  {
+    int x{};
+    int y{};
+    int width{};
+  };
+
+  iarea m_size;
+  std::vector<node> m_nodes;
+  int m_usedArea{};
+
+  [[nodiscard]] auto fit(std::size_t index, const iarea size) const -> std::optional<int>
+  {
+    const auto x = m_nodes[index].x;
+    if (x + size.width > m_size.width)
+    {
+      return std::nullopt;
+    }
+
+    auto y = m_nodes[index].y;
+    auto remaining = size.width;
+
+    while (remaining > 0)
+    {
+      const auto& node = m_nodes[index];
+      y = (node.y > y) ? node.y : y;
+
+      if (y + size.height > m_size.height)
+      {
+        return std::nullopt;
+      }
+
+      remaining -= node.width;
+      ++index;
+    }
+
+    return y;
+  }
+
+  void add_level(const std::size_t index, const ipoint position, const iarea size)
+  {
+    const auto begin = m_nodes.begin() + static_cast<std::ptrdiff_t>(index);
+    m_nodes.insert(begin, {position.x(), position.y() + size.height, size.width});
+
+    // Shrink or remove the nodes that are now covered by the new node
+    for (auto i = index + 1; i < m_nodes.size();)
+    {
+      const auto& prev = m_nodes[i - 1];
+      auto& current = m_nodes[i];
+
+      const auto prevEnd = prev.x + prev.width;
+      if (current.x >= prevEnd)
+      {
+        break;
+      }
+
+      const auto shrink = prevEnd - current.x;
+      current.x += shrink;
+      current.width -= shrink;
+
+      if (current.width <= 0)
+      {
+        m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(i));
+      }
+      else
+      {
+        break;
+      }
+    }
+
+    // Merge adjacent nodes at the same height
+    for (std::size_t i = 0; i + 1 < m_nodes.size();)
+    {
+      if (m_nodes[i].y == m_nodes[i + 1].y)
+      {
+        m_nodes[i].width += m_nodes[i + 1].width;
+        m_nodes.erase(m_nodes.begin() + static_cast<std::ptrdiff_t>(i + 1));
+      }
+      else
+      {
+        ++i;
+      }
+    }
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SKYLINE_PACKER_HEADER
@@ -0,0 +1,257 @@
+#ifndef CENTURION_DETAIL_SPATIAL_KERNELS_HEADER
+#define CENTURION_DETAIL_SPATIAL_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cmath>    // sqrt
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels compute the stereo gains and the distance of emitters relative to a
+ * listener, in the format of Mix_SetPanning() and Mix_SetDistance(). The pan is the
+ * cosine of the angle between the direction to the emitter and the right vector of the
+ * listener, and the gains use constant-power panning, i.e. sqrt((1 -/+ pan) / 2), so
+ * that centered emitters aren't quieter than emitters to the side. Every implementation
+ * performs the same operations in the same order, so the results only differ if the
+ * compiler fuses the multiplications and additions of the scalar kernel.
+ */
+
+struct spatial_params final
+{
+  float x{};  // The position of the listener
+  float y{};
+  float z{};
+  float rightX{};  // The normalized right vector of the listener
+  float rightY{};
+  float rightZ{};
+  float inverseRange{};  // The inverse of the distance at which emitters are the faintest
+};
+
+struct spatial_output final
+{
+  u8* left{};
+  u8* right{};
+  u8* distance{};
+};
+
+inline constexpr float spatial_min_distance = 1e-6f;
+
+/// \name Scalar kernels
+/// \{
+
+[[nodiscard]] inline auto spatial_to_u8(const float value) noexcept -> u8
+{
+  return static_cast<u8>(value * 255.0f + 0.5f);
+}
+
+inline void spatialize_scalar(const spatial_params& params,
+                              const float* xs,
+                              const float* ys,
+                              const float* zs,
+                              const spatial_output& out,
+                              const std::size_t count) noexcept
+{
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    const auto dx = xs[index] - params.x;
+    const auto dy = ys[index] - params.y;
+    const auto dz = zs[index] - params.z;
+
+    const auto distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+    const auto side = dx * params.rightX + dy * params.rightY + dz * params.rightZ;
+
+    // The pan is zero for an emitter at the position of the listener, since side is zero
+    const auto divisor =
+        (distance > spatial_min_distance) ? distance : spatial_min_distance;
+
+    auto pan = side / divisor;
+    pan = (pan < 1.0f) ? pan : 1.0f;
+    pan = (pan > -1.0f) ? pan : -1.0f;
+
+    const auto scaled = distance * params.inverseRange;
+
+    out.left[index] = spatial_to_u8(std::sqrt((1.0f - pan) * 0.5f));
+    out.right[index] = spatial_to_u8(std::sqrt((1.0f + pan) * 0.5f));
+    out.distance[index] = spatial_to_u8((scaled < 1.0f) ? scaled : 1.0f);
+  }
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+inline void spatial_store_u8_sse2(const __m128 values, u8* dst) noexcept
+{
+  const auto scaled =
+      _mm_add_ps(_mm_mul_ps(values, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f));
+
+  // The values are in [0, 255.5], so truncation and the saturating packs are exact
+  const auto words = _mm_packs_epi32(_mm_cvttps_epi32(scaled), _mm_setzero_si128());
+  const auto bytes = _mm_cvtsi128_si32(_mm_packus_epi16(words, words));
+
+  std::memcpy(dst, &bytes, 4);
+}
+
+inline void spatialize_sse2(const spatial_params& params,
+                            const float* xs,
+                            const float* ys,
+                            const float* zs,
+                            const spatial_output& out,
+                            const std::size_t count) noexcept
+{
+  const auto one = _mm_set1_ps(1.0f);
+  const auto half = _mm_set1_ps(0.5f);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto dx = _mm_sub_ps(_mm_loadu_ps(xs + index), _mm_set1_ps(params.x));
+    const auto dy = _mm_sub_ps(_mm_loadu_ps(ys + index), _mm_set1_ps(params.y));
+    const auto dz = _mm_sub_ps(_mm_loadu_ps(zs + index), _mm_set1_ps(params.z));
+
+    const auto squared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)),
+                                    _mm_mul_ps(dz, dz));
+    const auto distance = _mm_sqrt_ps(squared);
+
+    const auto side = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, _mm_set1_ps(params.rightX)),
+                                            _mm_mul_ps(dy, _mm_set1_ps(params.rightY))),
+                                 _mm_mul_ps(dz, _mm_set1_ps(params.rightZ)));
+
+    const auto divisor = _mm_max_ps(distance, _mm_set1_ps(spatial_min_distance));
+    auto pan = _mm_div_ps(side, divisor);
+    pan = _mm_max_ps(_mm_min_ps(pan, one), _mm_set1_ps(-1.0f));
+
+    const auto scaled = _mm_mul_ps(distance, _mm_set1_ps(params.inverseRange));
+
+    spatial_store_u8_sse2(_mm_sqrt_ps(_mm_mul_ps(_mm_sub_ps(one, pan), half)),
+                          out.left + index);
+    spatial_store_u8_sse2(_mm_sqrt_ps(_mm_mul_ps(_mm_add_ps(one, pan), half)),
+                          out.right + index);
+    spatial_store_u8_sse2(_mm_min_ps(scaled, one), out.distance + index);
+  }
+
+  const spatial_output rest{out.left + index, out.right + index, out.distance + index};
+  spatialize_scalar(params, xs + index, ys + index, zs + index, rest, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#if defined(CENTURION_DETAIL_NEON_KERNELS) && (defined(__aarch64__) || defined(_M_ARM64))
+#define CENTURION_DETAIL_NEON_SPATIAL_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+inline void spatial_store_u8_neon(const float32x4_t values, u8* dst) noexcept
+{
+  const auto scaled = vaddq_f32(vmulq_n_f32(values, 255.0f), vdupq_n_f32(0.5f));
+
+  const auto words = vmovn_u32(vcvtq_u32_f32(scaled));
+  const auto bytes = vmovn_u16(vcombine_u16(words, words));
+
+  vst1_lane_u32(reinterpret_cast<u32*>(dst), vreinterpret_u32_u8(bytes), 0);
+}
+
+inline void spatialize_neon(const spatial_params& params,
+                            const float* xs,
+                            const float* ys,
+                            const float* zs,
+                            const spatial_output& out,
+                            const std::size_t count) noexcept
+{
+  const auto one = vdupq_n_f32(1.0f);
+
+  std::size_t index = 0;
+  for (; index + 4 <= count; index += 4)
+  {
+    const auto dx = vsubq_f32(vld1q_f32(xs + index), vdupq_n_f32(params.x));
+    const auto dy = vsubq_f32(vld1q_f32(ys + index), vdupq_n_f32(params.y));
+    const auto dz = vsubq_f32(vld1q_f32(zs + index), vdupq_n_f32(params.z));
+
+    // Multiplications and additions are kept separate, since fused operations round
+    // differently from the scalar kernel
+    const auto squared =
+        vaddq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(dz, dz));
+    const auto distance = vsqrtq_f32(squared);
+
+    const auto side = vaddq_f32(vaddq_f32(vmulq_n_f32(dx, params.rightX),
+                                          vmulq_n_f32(dy, params.rightY)),
+                                vmulq_n_f32(dz, params.rightZ));
+
+    const auto divisor = vmaxq_f32(distance, vdupq_n_f32(spatial_min_distance));
+    auto pan = vdivq_f32(side, divisor);
+    pan = vmaxq_f32(vminq_f32(pan, one), vdupq_n_f32(-1.0f));
+
+    const auto scaled = vmulq_n_f32(distance, params.inverseRange);
+
+    spatial_store_u8_neon(vsqrtq_f32(vmulq_n_f32(vsubq_f32(one, pan), 0.5f)),
+                          out.left + index);
+    spatial_store_u8_neon(vsqrtq_f32(vmulq_n_f32(vaddq_f32(one, pan), 0.5f)),
+                          out.right + index);
+    spatial_store_u8_neon(vminq_f32(scaled, one), out.distance + index);
+  }
+
+  const spatial_output rest{out.left + index, out.right + index, out.distance + index};
+  spatialize_scalar(params, xs + index, ys + index, zs + index, rest, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_SPATIAL_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Computes the stereo gains and distances of emitters, relative to a listener.
+inline void spatialize(const simd_level level,
+                       const spatial_params& params,
+                       const float* xs,
+                       const float* ys,
+                       const float* zs,
+                       const spatial_output& out,
+                       const std::size_t count) noexcept
+{
+  switch (level)
+  {
+    case simd_level::avx2:  // The amount of emitters is too small to benefit from AVX2
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      spatialize_sse2(params, xs, ys, zs, out, count);
+      break;
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_SPATIAL_KERNELS
+      spatialize_neon(params, xs, ys, zs, out, count);
+      break;
+#endif  // CENTURION_DETAIL_NEON_SPATIAL_KERNELS
+
+    case simd_level::none:
+      spatialize_scalar(params, xs, ys, zs, out, count);
+      break;
+
+    default:
+      assert(false);
+      break;
+  }
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SPATIAL_KERNELS_HEADER
@@ -0,0 +1,53 @@
+#ifndef CENTURION_DETAIL_SPIN_BACKOFF_HEADER
+#define CENTURION_DETAIL_SPIN_BACKOFF_HEADER
+
+#include <thread>  // yield
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define CENTURION_HAS_PAUSE_INSTRUCTION
+#endif
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Hints to the CPU that the calling thread is spinning, which saves power and avoids
+// memory order violations when the spin loop exits
+inline void cpu_pause() noexcept
+{
+#ifdef CENTURION_HAS_PAUSE_INSTRUCTION
+  _mm_pause();
+#endif
+}
+
+// Exponential backoff for spin loops, which yields the thread once the limit is reached
+class spin_backoff final
+{
+ public:
+  void operator()() noexcept
+  {
+    if (m_count < limit)
+    {
+      for (int i = 0; i < m_count; ++i)
+      {
+        cpu_pause();
+      }
+
+      m_count *= 2;
+    }
+    else
+    {
+      std::this_thread::yield();
+    }
+  }
+
+ private:
+  inline static constexpr int limit = 64;
+
+  int m_count{1};
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SPIN_BACKOFF_HEADER
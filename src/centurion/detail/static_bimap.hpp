@@ -1,9 +1,12 @@
 #ifndef CENTURION_DETAIL_STATIC_BIMAP_HEADER
 #define CENTURION_DETAIL_STATIC_BIMAP_HEADER
 
-#include <algorithm>  // find_if
-#include <array>      // array
-#include <utility>    // pair
+#include <algorithm>    // find_if
+#include <array>        // array
+#include <cstddef>      // size_t
+#include <functional>   // less
+#include <type_traits>  // conditional_t
+#include <utility>      // pair
 
 #include "../core/exception.hpp"
 
@@ -70,6 +73,170 @@ class static_bimap final
   }
 };
 
+/**
+ * \class sorted_static_bimap
+ *
+ * \brief A bidirectional associative container with logarithmic lookups, for when keys
+ * and values are known at compile-time.
+ *
+ * \details The pairs are stored in the order in which they were supplied, along with two
+ * index tables that are sorted by key and value respectively, when the map is
+ * constructed. Since the constructor is constexpr, a map declared as a `constexpr`
+ * variable is sorted entirely at compile-time.
+ *
+ * \tparam Key the type of the keys, must be ordered by `std::less`.
+ * \tparam Value the type of the values.
+ * \tparam ValueLess the constexpr predicate used to order values.
+ * \tparam Size the amount of key-value pairs.
+ *
+ * \see `static_bimap_for`
+ *
+ * \since 6.1.0
+ */
+template <typename Key, typename Value, typename ValueLess, std::size_t Size>
+class sorted_static_bimap final
+{
+  using pair_type = std::pair<Key, Value>;
+  using storage_type = std::array<pair_type, Size>;
+  using index_type = std::array<std::size_t, Size>;
+
+ public:
+  storage_type data;
+
+  template <typename... Pairs>
+  constexpr sorted_static_bimap(const Pairs&... pairs) : data{pairs...}
+  {
+    static_assert(sizeof...(Pairs) == Size, "Wrong amount of key-value pairs!");
+
+    for (std::size_t index = 0; index < Size; ++index)
+    {
+      m_byKey[index] = index;
+      m_byValue[index] = index;
+    }
+
+    sort(m_byKey, [this](const std::size_t a, const std::size_t b) {
+      return std::less<Key>{}(data[a].first, data[b].first);
+    });
+
+    sort(m_byValue, [this](const std::size_t a, const std::size_t b) {
+      return ValueLess{}(data[a].second, data[b].second);
+    });
+  }
+
+  constexpr auto find(const Key& key) const -> const Value&
+  {
+    const auto index =
+        search(m_byKey, key, std::less<Key>{}, [](const pair_type& pair) -> const Key& {
+          return pair.first;
+        });
+
+    if (index != Size)
+    {
+      return data[index].second;
+    }
+    else
+    {
+      throw cen_error{"Failed to find element in static map!"};
+    }
+  }
+
+  constexpr auto key_from(const Value& value) const -> const Key&
+  {
+    const auto index =
+        search(m_byValue, value, ValueLess{}, [](const pair_type& pair) -> const Value& {
+          return pair.second;
+        });
+
+    if (index != Size)
+    {
+      return data[index].first;
+    }
+    else
+    {
+      throw cen_error{"Failed to find key in static map!"};
+    }
+  }
+
+ private:
+  index_type m_byKey{};
+  index_type m_byValue{};
+
+  // Insertion sort, since std::sort isn't constexpr in C++17
+  template <typename Less>
+  constexpr static void sort(index_type& indices, Less&& less)
+  {
+    for (std::size_t i = 1; i < Size; ++i)
+    {
+      const auto current = indices[i];
+
+      auto j = i;
+      for (; j > 0 && less(current, indices[j - 1]); --j)
+      {
+        indices[j] = indices[j - 1];
+      }
+
+      indices[j] = current;
+    }
+  }
+
+  // Returns the index of the pair with a matching element, or Size if there is none
+  template <typename T, typename Less, typename Projection>
+  constexpr auto search(const index_type& indices,
+                        const T& target,
+                        Less&& less,
+                        Projection&& projection) const -> std::size_t
+  {
+    std::size_t first = 0;
+    std::size_t count = Size;
+
+    while (count > 0)
+    {
+      const auto step = count / 2;
+      const auto middle = first + step;
+
+      if (less(projection(data[indices[middle]]), target))
+      {
+        first = middle + 1;
+        count -= step + 1;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+
+    if (first != Size && !less(target, projection(data[indices[first]])))
+    {
+      return indices[first];
+    }
+    else
+    {
+      return Size;
+    }
+  }
+};
+
+/// The size at which `static_bimap_for` switches to binary searches.
+inline constexpr std::size_t sorted_static_bimap_threshold = 16;
+
+/**
+ * \brief Selects a bimap implementation based on the amount of key-value pairs.
+ *
+ * \details Small maps use linear searches, which are faster than binary searches for a
+ * handful of elements. Both implementations are constructed in the same way.
+ *
+ * \since 6.1.0
+ */
+template <typename Key,
+          typename Value,
+          typename ValueCmp,
+          typename ValueLess,
+          std::size_t Size>
+using static_bimap_for =
+    std::conditional_t<(Size < sorted_static_bimap_threshold),
+                       static_bimap<Key, Value, ValueCmp, Size>,
+                       sorted_static_bimap<Key, Value, ValueLess, Size>>;
+
 }  // namespace cen::detail
 /// \endcond
 
@@ -0,0 +1,42 @@
+#ifndef CENTURION_DETAIL_SURFACE_READ_LOCK_HEADER
+#define CENTURION_DETAIL_SURFACE_READ_LOCK_HEADER
+
+#include <SDL.h>
+
+#include "../core/exception.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Locks a surface for reading, if locking is required
+class surface_read_lock final
+{
+ public:
+  explicit surface_read_lock(SDL_Surface* surface) : m_surface{surface}
+  {
+    if (SDL_MUSTLOCK(m_surface) && SDL_LockSurface(m_surface) != 0)
+    {
+      throw sdl_error{};
+    }
+  }
+
+  surface_read_lock(const surface_read_lock&) = delete;
+
+  auto operator=(const surface_read_lock&) -> surface_read_lock& = delete;
+
+  ~surface_read_lock() noexcept
+  {
+    if (SDL_MUSTLOCK(m_surface))
+    {
+      SDL_UnlockSurface(m_surface);
+    }
+  }
+
+ private:
+  SDL_Surface* m_surface{};
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_SURFACE_READ_LOCK_HEADER
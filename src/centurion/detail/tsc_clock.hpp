@@ -0,0 +1,179 @@
+#ifndef CENTURION_DETAIL_TSC_CLOCK_HEADER
+#define CENTURION_DETAIL_TSC_CLOCK_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max
+
+#include "../core/integers.hpp"
+#include "../system/cpu.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define CENTURION_DETAIL_TSC_CLOCK
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define CENTURION_DETAIL_TSC_CLOCK
+#endif
+#endif
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Timestamps are nanoseconds since an unspecified origin, which is the same for both the
+ * TSC and the performance counter path. The TSC is converted with a 40.24 fixed-point
+ * factor, which is calibrated against the performance counter on first use. The delta is
+ * split at the fractional bits of the factor, so the conversion can't overflow for any
+ * realistic TSC rate and uptime.
+ */
+
+inline constexpr int tsc_shift = 24;
+
+struct tsc_calibration final
+{
+  u64 tscOrigin{};
+  u64 nanoOrigin{};
+  u64 factor{};  ///< Nanoseconds per TSC tick, scaled by 2^tsc_shift, 0 if not usable
+};
+
+/// Converts a performance counter value to nanoseconds, without overflowing.
+[[nodiscard]] inline auto counter_to_nanoseconds(const u64 ticks,
+                                                 const u64 frequency) noexcept -> u64
+{
+  if (frequency == 0)
+  {
+    return 0;
+  }
+
+  return (ticks / frequency) * 1'000'000'000u +
+         (ticks % frequency) * 1'000'000'000u / frequency;
+}
+
+#ifdef CENTURION_DETAIL_TSC_CLOCK
+
+/// Indicates whether the TSC runs at a constant rate in all power states, and is thus
+/// usable as a clock, see CPUID leaf 0x80000007.
+[[nodiscard]] inline auto has_invariant_tsc() noexcept -> bool
+{
+  if (!cpu::has_rdtsc())
+  {
+    return false;
+  }
+
+#if defined(__GNUC__) || defined(__clang__)
+  unsigned eax{}, ebx{}, ecx{}, edx{};
+  if (__get_cpuid_max(0x8000'0000u, nullptr) < 0x8000'0007u)
+  {
+    return false;
+  }
+
+  __cpuid(0x8000'0007u, eax, ebx, ecx, edx);
+  return (edx & (1u << 8u)) != 0;
+#else
+  int registers[4]{};
+  __cpuid(registers, static_cast<int>(0x8000'0000u));
+  if (static_cast<unsigned>(registers[0]) < 0x8000'0007u)
+  {
+    return false;
+  }
+
+  __cpuid(registers, static_cast<int>(0x8000'0007u));
+  return (static_cast<unsigned>(registers[3]) & (1u << 8u)) != 0;
+#endif
+}
+
+[[nodiscard]] inline auto read_tsc() noexcept -> u64
+{
+  return static_cast<u64>(__rdtsc());
+}
+
+/// Measures the TSC rate against the performance counter, which takes a few milliseconds.
+[[nodiscard]] inline auto calibrate_tsc() noexcept -> tsc_calibration
+{
+  tsc_calibration calibration;
+
+  const u64 frequency = SDL_GetPerformanceFrequency();
+  if (frequency == 0 || !has_invariant_tsc())
+  {
+    return calibration;
+  }
+
+  const u64 counterBegin = SDL_GetPerformanceCounter();
+  const auto tscBegin = read_tsc();
+
+  // Roughly 5 ms, which keeps the error of the factor in the order of parts per million
+  const auto interval = (std::max)(frequency / 200u, u64{1});
+
+  u64 counterEnd = counterBegin;
+  while (counterEnd - counterBegin < interval)
+  {
+    counterEnd = SDL_GetPerformanceCounter();
+  }
+
+  const auto tscEnd = read_tsc();
+  if (tscEnd <= tscBegin)
+  {
+    return calibration;
+  }
+
+  const auto nanos = static_cast<double>(counterEnd - counterBegin) * 1'000'000'000.0 /
+                     static_cast<double>(frequency);
+  const auto nanosPerTick = nanos / static_cast<double>(tscEnd - tscBegin);
+
+  calibration.tscOrigin = tscEnd;
+  calibration.nanoOrigin = counter_to_nanoseconds(counterEnd, frequency);
+  calibration.factor =
+      static_cast<u64>(nanosPerTick * static_cast<double>(u64{1} << tsc_shift) + 0.5);
+
+  return calibration;
+}
+
+[[nodiscard]] inline auto get_tsc_calibration() noexcept -> const tsc_calibration&
+{
+  static const auto calibration = calibrate_tsc();
+  return calibration;
+}
+
+#endif  // CENTURION_DETAIL_TSC_CLOCK
+
+/// Returns the current monotonic time in nanoseconds.
+[[nodiscard]] inline auto monotonic_nanoseconds() noexcept -> u64
+{
+#ifdef CENTURION_DETAIL_TSC_CLOCK
+  const auto& calibration = get_tsc_calibration();
+  if (calibration.factor != 0)
+  {
+    const auto tsc = read_tsc();
+
+    // The TSC is synchronized across cores, but reads can be reordered slightly
+    const auto delta = (tsc > calibration.tscOrigin) ? tsc - calibration.tscOrigin : 0;
+
+    constexpr u64 fraction = (u64{1} << tsc_shift) - 1u;
+    const auto whole = (delta >> tsc_shift) * calibration.factor;
+    const auto rest = ((delta & fraction) * calibration.factor) >> tsc_shift;
+
+    return calibration.nanoOrigin + whole + rest;
+  }
+#endif  // CENTURION_DETAIL_TSC_CLOCK
+
+  return counter_to_nanoseconds(SDL_GetPerformanceCounter(),
+                                SDL_GetPerformanceFrequency());
+}
+
+/// Indicates whether or not the monotonic clock reads the TSC directly.
+[[nodiscard]] inline auto uses_tsc_clock() noexcept -> bool
+{
+#ifdef CENTURION_DETAIL_TSC_CLOCK
+  return get_tsc_calibration().factor != 0;
+#else
+  return false;
+#endif  // CENTURION_DETAIL_TSC_CLOCK
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_TSC_CLOCK_HEADER
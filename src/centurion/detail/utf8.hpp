@@ -0,0 +1,85 @@
+#ifndef CENTURION_DETAIL_UTF8_HEADER
+#define CENTURION_DETAIL_UTF8_HEADER
+
+#include <cstddef>      // size_t
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+inline constexpr u32 replacement_character = 0xFFFD;
+
+/**
+ * \brief Decodes the UTF-8 encoded code point at the specified index.
+ *
+ * \details Invalid and truncated sequences are decoded as the replacement character, and
+ * only consume a single byte.
+ *
+ * \param str the UTF-8 encoded string.
+ * \param index the index of the first byte of the code point, is advanced to the index of
+ * the next code point.
+ *
+ * \return the decoded code point.
+ */
+[[nodiscard]] constexpr auto next_code_point(const std::string_view str,
+                                             std::size_t& index) noexcept -> u32
+{
+  const auto lead = static_cast<u8>(str[index]);
+
+  std::size_t length{};
+  u32 code{};
+
+  if (lead < 0x80u)
+  {
+    ++index;
+    return lead;
+  }
+  else if ((lead & 0xE0u) == 0xC0u)
+  {
+    length = 2;
+    code = lead & 0x1Fu;
+  }
+  else if ((lead & 0xF0u) == 0xE0u)
+  {
+    length = 3;
+    code = lead & 0x0Fu;
+  }
+  else if ((lead & 0xF8u) == 0xF0u)
+  {
+    length = 4;
+    code = lead & 0x07u;
+  }
+  else
+  {
+    ++index;
+    return replacement_character;
+  }
+
+  if (index + length > str.size())
+  {
+    ++index;
+    return replacement_character;
+  }
+
+  for (std::size_t i = 1; i < length; ++i)
+  {
+    const auto byte = static_cast<u8>(str[index + i]);
+    if ((byte & 0xC0u) != 0x80u)
+    {
+      ++index;
+      return replacement_character;
+    }
+
+    code = (code << 6u) | (byte & 0x3Fu);
+  }
+
+  index += length;
+  return code;
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_UTF8_HEADER
@@ -0,0 +1,215 @@
+#ifndef CENTURION_DETAIL_UTF8_KERNELS_HEADER
+#define CENTURION_DETAIL_UTF8_KERNELS_HEADER
+
+#include <SDL.h>
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+#include "pixel_kernels.hpp"
+#include "utf8.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * The kernels widen a run of ASCII characters to 16-bit code units, and stop at the
+ * first block that contains a byte that isn't ASCII. They return the amount of converted
+ * characters, the decoder then handles the multi-byte sequence and resumes the kernel.
+ */
+
+/// \name Scalar kernels
+/// \{
+
+inline auto widen_ascii_scalar(const u8* in, u16* out, const std::size_t count) noexcept
+    -> std::size_t
+{
+  std::size_t index = 0;
+  for (; index < count && in[index] < 0x80u; ++index)
+  {
+    out[index] = in[index];
+  }
+
+  return index;
+}
+
+/// \} End of scalar kernels
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+
+/// \name SSE2 kernels
+/// \{
+
+inline auto widen_ascii_sse2(const u8* in, u16* out, const std::size_t count) noexcept
+    -> std::size_t
+{
+  const auto zero = _mm_setzero_si128();
+
+  std::size_t index = 0;
+  for (; index + 16u <= count; index += 16u)
+  {
+    const auto bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + index));
+    if (_mm_movemask_epi8(bytes) != 0)
+    {
+      break;
+    }
+
+    auto* dst = reinterpret_cast<__m128i*>(out + index);
+    _mm_storeu_si128(dst, _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128(dst + 1, _mm_unpackhi_epi8(bytes, zero));
+  }
+
+  return index + widen_ascii_scalar(in + index, out + index, count - index);
+}
+
+/// \} End of SSE2 kernels
+
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+
+/// \name AVX2 kernels
+/// \{
+
+CENTURION_DETAIL_TARGET_AVX2
+inline auto widen_ascii_avx2(const u8* in, u16* out, const std::size_t count) noexcept
+    -> std::size_t
+{
+  std::size_t index = 0;
+  for (; index + 32u <= count; index += 32u)
+  {
+    const auto bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + index));
+    if (_mm256_movemask_epi8(bytes) != 0)
+    {
+      break;
+    }
+
+    const auto low = _mm256_castsi256_si128(bytes);
+    const auto high = _mm256_extracti128_si256(bytes, 1);
+
+    auto* dst = reinterpret_cast<__m256i*>(out + index);
+    _mm256_storeu_si256(dst, _mm256_cvtepu8_epi16(low));
+    _mm256_storeu_si256(dst + 1, _mm256_cvtepu8_epi16(high));
+  }
+
+  return index + widen_ascii_scalar(in + index, out + index, count - index);
+}
+
+/// \} End of AVX2 kernels
+
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+
+/// \name NEON kernels
+/// \{
+
+inline auto widen_ascii_neon(const u8* in, u16* out, const std::size_t count) noexcept
+    -> std::size_t
+{
+  std::size_t index = 0;
+  for (; index + 16u <= count; index += 16u)
+  {
+    const auto bytes = vld1q_u8(in + index);
+
+    // Folds the halves together, so that a single 64-bit test covers all bytes
+    const auto folded = vorr_u8(vget_low_u8(bytes), vget_high_u8(bytes));
+    if ((vget_lane_u64(vreinterpret_u64_u8(folded), 0) & 0x8080'8080'8080'8080u) != 0)
+    {
+      break;
+    }
+
+    vst1q_u16(out + index, vmovl_u8(vget_low_u8(bytes)));
+    vst1q_u16(out + index + 8u, vmovl_u8(vget_high_u8(bytes)));
+  }
+
+  return index + widen_ascii_scalar(in + index, out + index, count - index);
+}
+
+/// \} End of NEON kernels
+
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+/// \name Dispatch
+/// \{
+
+/// Widens ASCII characters until the first one that isn't ASCII, see above.
+inline auto widen_ascii(const simd_level level,
+                        const u8* in,
+                        u16* out,
+                        const std::size_t count) noexcept -> std::size_t
+{
+  switch (level)
+  {
+    case simd_level::avx2:
+#ifdef CENTURION_DETAIL_AVX2_KERNELS
+      return widen_ascii_avx2(in, out, count);
+#endif  // CENTURION_DETAIL_AVX2_KERNELS
+
+    case simd_level::sse2:
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+      return widen_ascii_sse2(in, out, count);
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    case simd_level::neon:
+#ifdef CENTURION_DETAIL_NEON_KERNELS
+      return widen_ascii_neon(in, out, count);
+#endif  // CENTURION_DETAIL_NEON_KERNELS
+
+    case simd_level::none:
+      return widen_ascii_scalar(in, out, count);
+
+    default:
+      assert(false);
+      return 0;
+  }
+}
+
+/**
+ * \brief Decodes a UTF-8 string to 16-bit code units.
+ *
+ * \details Code points outside of the Basic Multilingual Plane can't be represented by a
+ * single code unit, so they are decoded as the replacement character, like invalid
+ * sequences.
+ *
+ * \param level the instruction set used for runs of ASCII characters.
+ * \param str the UTF-8 encoded string.
+ * \param[out] out the buffer that receives the code units, must be able to hold at least
+ * as many code units as there are bytes in the string.
+ *
+ * \return the amount of written code units.
+ */
+inline auto decode_utf8(const simd_level level,
+                        const std::string_view str,
+                        u16* out) noexcept -> std::size_t
+{
+  const auto* bytes = reinterpret_cast<const u8*>(str.data());
+
+  std::size_t index = 0;
+  std::size_t written = 0;
+
+  while (index < str.size())
+  {
+    const auto remaining = str.size() - index;
+    const auto ascii = widen_ascii(level, bytes + index, out + written, remaining);
+    index += ascii;
+    written += ascii;
+
+    if (index < str.size())
+    {
+      const auto code = next_code_point(str, index);
+      out[written++] = static_cast<u16>((code <= 0xFFFFu) ? code : replacement_character);
+    }
+  }
+
+  return written;
+}
+
+/// \} End of dispatch
+
+}  // namespace cen::detail
+/// \endcond
+
+#endif  // CENTURION_DETAIL_UTF8_KERNELS_HEADER
@@ -0,0 +1,32 @@
+#ifndef CENTURION_DETAIL_WINDOWS_API_HEADER
+#define CENTURION_DETAIL_WINDOWS_API_HEADER
+
+#ifdef _WIN32
+
+// Stops windows.h from defining the min and max macros, which break std::min and friends,
+// and from pulling in rarely used headers. The macros are only defined temporarily, so
+// that the configuration of the including code isn't changed.
+#ifndef NOMINMAX
+#define NOMINMAX
+#define CENTURION_DETAIL_DEFINED_NOMINMAX
+#endif  // NOMINMAX
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#define CENTURION_DETAIL_DEFINED_WIN32_LEAN_AND_MEAN
+#endif  // WIN32_LEAN_AND_MEAN
+
+#include <windows.h>
+
+#ifdef CENTURION_DETAIL_DEFINED_NOMINMAX
+#undef NOMINMAX
+#undef CENTURION_DETAIL_DEFINED_NOMINMAX
+#endif  // CENTURION_DETAIL_DEFINED_NOMINMAX
+
+#ifdef CENTURION_DETAIL_DEFINED_WIN32_LEAN_AND_MEAN
+#undef WIN32_LEAN_AND_MEAN
+#undef CENTURION_DETAIL_DEFINED_WIN32_LEAN_AND_MEAN
+#endif  // CENTURION_DETAIL_DEFINED_WIN32_LEAN_AND_MEAN
+
+#endif  // _WIN32
+#endif  // CENTURION_DETAIL_WINDOWS_API_HEADER
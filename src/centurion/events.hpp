@@ -0,0 +1,49 @@
+#ifndef CENTURION_EVENTS_SUBSYSTEM_HEADER
+#define CENTURION_EVENTS_SUBSYSTEM_HEADER
+
+/**
+ * \file events.hpp
+ *
+ * \brief Includes all headers of the events subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "events/audio_device_event.hpp"
+#include "events/common_event.hpp"
+#include "events/controller_axis_event.hpp"
+#include "events/controller_button_event.hpp"
+#include "events/controller_device_event.hpp"
+#include "events/dollar_gesture_event.hpp"
+#include "events/drop_batcher.hpp"
+#include "events/drop_event.hpp"
+#include "events/event.hpp"
+#include "events/event_channel.hpp"
+#include "events/event_coalescing.hpp"
+#include "events/event_dispatcher.hpp"
+#include "events/event_filter.hpp"
+#include "events/event_player.hpp"
+#include "events/event_recorder.hpp"
+#include "events/event_signal.hpp"
+#include "events/event_type.hpp"
+#include "events/joy_axis_event.hpp"
+#include "events/joy_ball_event.hpp"
+#include "events/joy_button_event.hpp"
+#include "events/joy_device_event.hpp"
+#include "events/joy_hat_event.hpp"
+#include "events/keyboard_event.hpp"
+#include "events/mouse_button_event.hpp"
+#include "events/mouse_motion_event.hpp"
+#include "events/mouse_wheel_event.hpp"
+#include "events/multi_gesture_event.hpp"
+#include "events/quit_event.hpp"
+#include "events/text_editing_event.hpp"
+#include "events/text_input_buffer.hpp"
+#include "events/text_input_event.hpp"
+#include "events/touch_finger_event.hpp"
+#include "events/window_event.hpp"
+
+#endif  // CENTURION_EVENTS_SUBSYSTEM_HEADER
@@ -0,0 +1,315 @@
+#ifndef CENTURION_DROP_BATCHER_HEADER
+#define CENTURION_DROP_BATCHER_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // find_if
+#include <array>      // array
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <deque>      // deque
+#include <optional>   // optional
+#include <string>     // string
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \struct drop_batch
+ *
+ * \brief Represents all files and text that were dropped onto a window at once.
+ *
+ * \see `drop_batcher`
+ *
+ * \since 6.1.0
+ */
+struct drop_batch final
+{
+  u32 window_id{};                 ///< The window that the items were dropped onto.
+  std::vector<std::string> files;  ///< The paths of the dropped files, in drop order.
+  std::vector<std::string> texts;  ///< The dropped text snippets, in drop order.
+
+  /**
+   * \brief Indicates whether or not the batch contains any dropped items.
+   *
+   * \return `true` if there are no files or text in the batch; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return files.empty() && texts.empty();
+  }
+};
+
+/**
+ * \class drop_batcher
+ *
+ * \brief Aggregates sequences of drop events into batches.
+ *
+ * \details When several files are dropped onto a window, SDL emits a `SDL_DROPBEGIN`
+ * event, followed by one `SDL_DROPFILE` event per file, and finally a `SDL_DROPCOMPLETE`
+ * event. Dispatching each of these events separately, e.g. as `drop_event` instances,
+ * scales poorly when thousands of files are dropped. A drop batcher instead collects
+ * the items of each sequence, and reports them as a single `drop_batch` once the
+ * sequence is complete.
+ * \code{cpp}
+ *   cen::drop_batcher drops;
+ *
+ *   // Every frame
+ *   drops.collect();
+ *   while (auto batch = drops.next())
+ *   {
+ *     const auto ids = loader.load_all(batch->files);  // Decoded by worker threads
+ *   }
+ * \endcode
+ *
+ * \details Drop events that aren't part of a sequence, e.g. events pushed by the
+ * application, are reported as batches with a single item. Sequences for different
+ * windows are tracked independently.
+ *
+ * \note The batcher takes ownership of the strings of the events that it handles, which
+ * are freed with `SDL_free()`.
+ *
+ * \since 6.1.0
+ */
+class drop_batcher final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Updates the batcher with an event.
+   *
+   * \details The string associated with a handled drop event is copied into the current
+   * batch, freed and set to null.
+   *
+   * \param event the event that will be handled.
+   *
+   * \return `true` if the event was a drop event; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto feed(SDL_Event& event) -> bool
+  {
+    switch (event.type)
+    {
+      case SDL_DROPBEGIN:
+        open(event.drop.windowID);
+        break;
+
+      case SDL_DROPFILE:
+      case SDL_DROPTEXT:
+        add(event.drop);
+        break;
+
+      case SDL_DROPCOMPLETE:
+        close(event.drop.windowID);
+        break;
+
+      default:
+        return false;
+    }
+
+    if (event.drop.file)
+    {
+      SDL_free(event.drop.file);
+      event.drop.file = nullptr;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Updates the batcher with a sequence of events.
+   *
+   * \param events the events that will be handled.
+   * \param count the amount of events.
+   *
+   * \return the amount of drop events in the sequence.
+   *
+   * \see `feed(SDL_Event&)`
+   *
+   * \since 6.1.0
+   */
+  auto feed(SDL_Event* events, const int count) -> int
+  {
+    assert(events || count == 0);
+
+    int handled = 0;
+    for (int index = 0; index < count; ++index)
+    {
+      if (feed(events[index]))
+      {
+        ++handled;
+      }
+    }
+
+    return handled;
+  }
+
+  /**
+   * \brief Moves all drop events from the event queue into the batcher.
+   *
+   * \details Only drop events are removed from the event queue, in batches obtained with
+   * `SDL_PeepEvents()`. Other events are left in the queue, in their original order.
+   *
+   * \note This function doesn't update the event loop, which is usually done by the
+   * event polling of the application.
+   *
+   * \return the amount of handled drop events; `std::nullopt` if something goes wrong.
+   *
+   * \since 6.1.0
+   */
+  auto collect() -> std::optional<int>
+  {
+    std::array<SDL_Event, 64> events;  // NOLINT
+
+    int total = 0;
+    while (true)
+    {
+      const auto count = SDL_PeepEvents(events.data(),
+                                        static_cast<int>(events.size()),
+                                        SDL_GETEVENT,
+                                        SDL_DROPFILE,
+                                        SDL_DROPCOMPLETE);
+      if (count == -1)
+      {
+        return std::nullopt;
+      }
+
+      total += feed(events.data(), count);
+
+      if (count < static_cast<int>(events.size()))
+      {
+        return total;
+      }
+    }
+  }
+
+  /**
+   * \brief Removes and returns the oldest completed batch.
+   *
+   * \return the oldest completed batch; `std::nullopt` if there are no completed batches.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto next() -> std::optional<drop_batch>
+  {
+    if (m_ready.empty())
+    {
+      return std::nullopt;
+    }
+
+    auto batch = std::move(m_ready.front());
+    m_ready.pop_front();
+
+    return batch;
+  }
+
+  /**
+   * \brief Returns the amount of completed batches that haven't been obtained yet.
+   *
+   * \return the amount of completed batches.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto ready_count() const noexcept -> size_type
+  {
+    return m_ready.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are drop sequences that haven't completed.
+   *
+   * \return `true` if items are still being dropped; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_dropping() const noexcept -> bool
+  {
+    return !m_open.empty();
+  }
+
+  /**
+   * \brief Discards all completed and incomplete batches.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_open.clear();
+    m_ready.clear();
+  }
+
+ private:
+  std::vector<drop_batch> m_open;  // Incomplete batches, at most one per window
+  std::deque<drop_batch> m_ready;
+
+  [[nodiscard]] auto find_open(const u32 windowId) noexcept
+      -> std::vector<drop_batch>::iterator
+  {
+    return std::find_if(m_open.begin(), m_open.end(), [=](const drop_batch& batch) {
+      return batch.window_id == windowId;
+    });
+  }
+
+  void open(const u32 windowId)
+  {
+    if (find_open(windowId) == m_open.end())
+    {
+      auto& batch = m_open.emplace_back();
+      batch.window_id = windowId;
+    }
+  }
+
+  void add(const SDL_DropEvent& event)
+  {
+    if (const auto it = find_open(event.windowID); it != m_open.end())
+    {
+      append(*it, event);
+    }
+    else
+    {
+      auto& batch = m_ready.emplace_back();
+      batch.window_id = event.windowID;
+      append(batch, event);
+    }
+  }
+
+  void close(const u32 windowId)
+  {
+    if (const auto it = find_open(windowId); it != m_open.end())
+    {
+      if (!it->empty())
+      {
+        m_ready.push_back(std::move(*it));
+      }
+
+      m_open.erase(it);
+    }
+  }
+
+  static void append(drop_batch& batch, const SDL_DropEvent& event)
+  {
+    if (!event.file)
+    {
+      return;
+    }
+
+    auto& items = (event.type == SDL_DROPFILE) ? batch.files : batch.texts;
+    items.emplace_back(event.file);
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_DROP_BATCHER_HEADER
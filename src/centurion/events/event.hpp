@@ -3,12 +3,16 @@
 
 #include <SDL.h>
 
-#include <optional>  // optional
-#include <utility>   // move
-#include <variant>   // variant, holds_alternative, monostate, get, get_if
+#include <array>        // array
+#include <cstddef>      // size_t
+#include <optional>     // optional
+#include <type_traits>  // is_same_v
+#include <utility>      // index_sequence, make_index_sequence
+#include <variant>      // variant, monostate, get_if, bad_variant_access
 
 #include "../core/result.hpp"
 #include "../core/to_underlying.hpp"
+#include "../detail/event_traits.hpp"
 #include "audio_device_event.hpp"
 #include "common_event.hpp"
 #include "controller_axis_event.hpp"
@@ -43,6 +47,14 @@ namespace cen {
  *
  * \brief Serves as the main interface for dealing with events.
  *
+ * \details The event is stored once, as an `SDL_Event`. The type checks only inspect the
+ * type of that event, and the wrapper returned by `get()` and `try_get()` is created on
+ * first access, so polling an event doesn't copy its payload. Use `try_view()` to read
+ * the payload in place, without creating a wrapper at all.
+ *
+ * \note Since the wrapper is created on demand, even by the `const` accessors, an event
+ * must not be accessed by several threads at the same time.
+ *
  * \see `SDL_Event`
  *
  * \since 4.0.0
@@ -64,16 +76,18 @@ class event final
    *
    * \since 4.0.0
    */
-  explicit event(const SDL_Event& event) noexcept : m_event{event}
-  {
-    update_data(static_cast<event_type>(event.type));
-  }
+  explicit event(const SDL_Event& event) noexcept
+      : m_event{event}
+      , m_hasEvent{true}
+      , m_stale{true}
+  {}
 
   template <typename T>
-  explicit event(const common_event<T>& event) noexcept : m_event{as_sdl_event(event)}
-  {
-    update_data(event.type());
-  }
+  explicit event(const common_event<T>& event) noexcept
+      : m_event{as_sdl_event(event)}
+      , m_hasEvent{true}
+      , m_stale{true}
+  {}
 
   /**
    * \brief Updates the event loop, gathering events from the input devices.
@@ -155,18 +169,63 @@ class event final
    */
   auto poll() noexcept -> bool
   {
-    const bool result = SDL_PollEvent(&m_event);
+    m_hasEvent = SDL_PollEvent(&m_event);
+    m_stale = true;
+
+    return m_hasEvent;
+  }
 
-    if (result)
+  /**
+   * \brief Moves multiple events from the event queue into a buffer.
+   *
+   * \details The event loop is updated once, after which up to `count` events are
+   * obtained with a single call to `SDL_PeepEvents()`. This is cheaper than polling the
+   * events one at a time, since the event queue is only locked once.
+   *
+   * \param[out] events the buffer that will receive the events.
+   * \param count the maximum amount of events that will be obtained.
+   *
+   * \return the amount of obtained events, i.e. zero if the queue was empty;
+   * `std::nullopt` if something goes wrong.
+   *
+   * \see `SDL_PeepEvents`
+   *
+   * \since 6.1.0
+   */
+  static auto drain(SDL_Event* events, const int count) noexcept -> std::optional<int>
+  {
+    SDL_PumpEvents();
+
+    const auto num =
+        SDL_PeepEvents(events, count, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+    if (num != -1)
     {
-      update_data(static_cast<event_type>(m_event.type));
+      return num;
     }
     else
     {
-      update_data(std::nullopt);
+      return std::nullopt;
     }
+  }
 
-    return result;
+  /**
+   * \brief Moves multiple events from the event queue into an array.
+   *
+   * \tparam N the size of the array.
+   *
+   * \param[out] events the array that will receive the events.
+   *
+   * \return the amount of obtained events; `std::nullopt` if something goes wrong.
+   *
+   * \see `drain(SDL_Event*, int)`
+   *
+   * \since 6.1.0
+   */
+  template <std::size_t N>
+  static auto drain(std::array<SDL_Event, N>& events) noexcept -> std::optional<int>
+  {
+    static_assert(N != 0, "Can't drain events into an empty array!");
+    return drain(events.data(), static_cast<int>(N));
   }
 
   /**
@@ -271,7 +330,14 @@ class event final
   template <typename T>
   [[nodiscard]] auto is() const noexcept -> bool
   {
-    return std::holds_alternative<T>(m_data);
+    if constexpr (std::is_same_v<T, std::monostate>)
+    {
+      return !m_hasEvent || !is_any(std::make_index_sequence<alternative_count>{});
+    }
+    else
+    {
+      return m_hasEvent && detail::is_event_type<T>(m_event.type);
+    }
   }
 
   /**
@@ -298,7 +364,14 @@ class event final
   template <typename T>
   [[nodiscard]] auto get() -> T&
   {
-    return std::get<T>(m_data);
+    if (auto* data = try_get<T>())
+    {
+      return *data;
+    }
+    else
+    {
+      throw std::bad_variant_access{};
+    }
   }
 
   /**
@@ -307,7 +380,14 @@ class event final
   template <typename T>
   [[nodiscard]] auto get() const -> const T&
   {
-    return std::get<T>(m_data);
+    if (const auto* data = try_get<T>())
+    {
+      return *data;
+    }
+    else
+    {
+      throw std::bad_variant_access{};
+    }
   }
 
   /**
@@ -328,7 +408,7 @@ class event final
   template <typename T>
   [[nodiscard]] auto try_get() noexcept -> T*
   {
-    return std::get_if<T>(&m_data);
+    return is<T>() ? &load<T>() : nullptr;
   }
 
   /**
@@ -349,7 +429,37 @@ class event final
   template <typename T>
   [[nodiscard]] auto try_get() const noexcept -> const T*
   {
-    return std::get_if<T>(&m_data);
+    return is<T>() ? &load<T>() : nullptr;
+  }
+
+  /**
+   * \brief Returns the payload of the event, without copying it.
+   *
+   * \details Unlike `try_get()`, this function doesn't create an event wrapper, the
+   * returned pointer refers to the payload stored in the underlying `SDL_Event`. This is
+   * the cheapest way to inspect an event.
+   * \code{cpp}
+   *   if (const auto* key = event.try_view<cen::keyboard_event>())
+   *   {
+   *     handle_key(key->keysym.scancode);
+   *   }
+   * \endcode
+   *
+   * \note The pointer is invalidated when the event is polled again or destroyed.
+   *
+   * \tparam T the event type to obtain, e.g. `keyboard_event`.
+   *
+   * \return a pointer to the SDL event payload, e.g. `SDL_KeyboardEvent`; a null
+   * pointer if the event isn't of the specified type.
+   *
+   * \see `try_get`
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  [[nodiscard]] auto try_view() const noexcept -> const detail::sdl_event_t<T>*
+  {
+    return is<T>() ? &(m_event.*detail::event_traits<T>::member) : nullptr;
   }
 
   /**
@@ -365,128 +475,79 @@ class event final
     return is<std::monostate>();
   }
 
+  /**
+   * \brief Returns the underlying SDL event.
+   *
+   * \return a reference to the internal SDL event.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const SDL_Event&
+  {
+    return m_event;
+  }
+
  private:
+  using data_type = std::variant<std::monostate,
+                                 audio_device_event,
+                                 controller_axis_event,
+                                 controller_button_event,
+                                 controller_device_event,
+                                 dollar_gesture_event,
+                                 drop_event,
+                                 joy_axis_event,
+                                 joy_ball_event,
+                                 joy_button_event,
+                                 joy_device_event,
+                                 joy_hat_event,
+                                 keyboard_event,
+                                 mouse_button_event,
+                                 mouse_motion_event,
+                                 mouse_wheel_event,
+                                 multi_gesture_event,
+                                 quit_event,
+                                 text_editing_event,
+                                 text_input_event,
+                                 touch_finger_event,
+                                 window_event>;
+
+  // The amount of event wrappers, i.e. excluding the leading monostate
+  inline static constexpr std::size_t alternative_count =
+      std::variant_size_v<data_type> - 1;
+
   SDL_Event m_event{};
 
-  // behold, the beast!
-  std::variant<std::monostate,
-               audio_device_event,
-               controller_axis_event,
-               controller_button_event,
-               controller_device_event,
-               dollar_gesture_event,
-               drop_event,
-               joy_axis_event,
-               joy_ball_event,
-               joy_button_event,
-               joy_device_event,
-               joy_hat_event,
-               keyboard_event,
-               mouse_button_event,
-               mouse_motion_event,
-               mouse_wheel_event,
-               multi_gesture_event,
-               quit_event,
-               text_editing_event,
-               text_input_event,
-               touch_finger_event,
-               window_event>
-      m_data{};
-
-  void update_data(const std::optional<event_type> t) noexcept
+  // The wrapper of the event, which is created on first access
+  mutable data_type m_data{};
+
+  bool m_hasEvent{};
+  mutable bool m_stale{};
+
+  template <std::size_t... Index>
+  [[nodiscard]] auto is_any(std::index_sequence<Index...>) const noexcept -> bool
   {
-    using et = event_type;
+    return (is<std::variant_alternative_t<Index + 1, data_type>>() || ...);
+  }
 
-    if (t == et::quit)
-    {
-      m_data.emplace<quit_event>(m_event.quit);
-    }
-    else if (t == et::audio_device_added || t == et::audio_device_removed)
-    {
-      m_data.emplace<audio_device_event>(m_event.adevice);
-    }
-    else if (t == et::controller_axis_motion)
-    {
-      m_data.emplace<controller_axis_event>(m_event.caxis);
-    }
-    else if (t == et::controller_button_down || t == et::controller_button_up)
-    {
-      m_data.emplace<controller_button_event>(m_event.cbutton);
-    }
-    else if (t == et::controller_device_added || t == et::controller_device_removed ||
-             t == et::controller_device_remapped)
-    {
-      m_data.emplace<controller_device_event>(m_event.cdevice);
-    }
-    else if (t == et::dollar_gesture || t == et::dollar_record)
-    {
-      m_data.emplace<dollar_gesture_event>(m_event.dgesture);
-    }
-    else if (t == et::drop_begin || t == et::drop_complete || t == et::drop_file ||
-             t == et::drop_text)
-    {
-      m_data.emplace<drop_event>(m_event.drop);
-    }
-    else if (t == et::joystick_axis_motion)
-    {
-      m_data.emplace<joy_axis_event>(m_event.jaxis);
-    }
-    else if (t == et::joystick_ball_motion)
-    {
-      m_data.emplace<joy_ball_event>(m_event.jball);
-    }
-    else if (t == et::joystick_button_up || t == et::joystick_button_down)
-    {
-      m_data.emplace<joy_button_event>(m_event.jbutton);
-    }
-    else if (t == et::joystick_device_added || t == et::joystick_device_removed)
-    {
-      m_data.emplace<joy_device_event>(m_event.jdevice);
-    }
-    else if (t == event_type::joystick_hat_motion)
-    {
-      m_data.emplace<joy_hat_event>(m_event.jhat);
-    }
-    else if (t == et::key_down || t == et::key_up)
-    {
-      m_data.emplace<keyboard_event>(m_event.key);
-    }
-    else if (t == et::mouse_button_up || t == et::mouse_button_down)
-    {
-      m_data.emplace<mouse_button_event>(m_event.button);
-    }
-    else if (t == et::mouse_motion)
-    {
-      m_data.emplace<mouse_motion_event>(m_event.motion);
-    }
-    else if (t == et::mouse_wheel)
-    {
-      m_data.emplace<mouse_wheel_event>(m_event.wheel);
-    }
-    else if (t == et::multi_gesture)
-    {
-      m_data.emplace<multi_gesture_event>(m_event.mgesture);
-    }
-    else if (t == et::text_editing)
-    {
-      m_data.emplace<text_editing_event>(m_event.edit);
-    }
-    else if (t == et::text_input)
-    {
-      m_data.emplace<text_input_event>(m_event.text);
-    }
-    else if (t == et::touch_motion || t == et::touch_down || t == et::touch_up)
-    {
-      m_data.emplace<touch_finger_event>(m_event.tfinger);
-    }
-    else if (t == et::window)
-    {
-      m_data.emplace<window_event>(m_event.window);
-    }
-    else
+  // Returns the wrapper of the event, creating it if needed. The type must be correct.
+  template <typename T>
+  auto load() const noexcept -> T&
+  {
+    if (m_stale)
     {
-      m_data.emplace<std::monostate>();
+      if constexpr (std::is_same_v<T, std::monostate>)
+      {
+        m_data.template emplace<std::monostate>();
+      }
+      else
+      {
+        m_data.template emplace<T>(m_event.*detail::event_traits<T>::member);
+      }
+
+      m_stale = false;
     }
+
+    return *std::get_if<T>(&m_data);
   }
 };
 
@@ -0,0 +1,190 @@
+#ifndef CENTURION_EVENT_CHANNEL_HEADER
+#define CENTURION_EVENT_CHANNEL_HEADER
+
+#include <cstddef>      // size_t
+#include <type_traits>  // is_nothrow_constructible_v, ...
+#include <utility>      // forward, move
+
+#include "../thread/mpmc_queue.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_channel
+ *
+ * \brief A lock-free queue for sending messages from other threads to the main thread.
+ *
+ * \details Unlike `event::push()`, which goes through the locked SDL event queue and is
+ * limited to `SDL_Event` payloads, a channel stores arbitrary values in a fixed-size
+ * ring buffer. Any amount of threads may send messages, but only a single thread, e.g.
+ * the thread that runs the event loop, may receive them. Sending and receiving never
+ * allocate memory or block.
+ * \code{cpp}
+ *   cen::event_channel<asset_loaded> channel{1024};
+ *
+ *   // Worker thread
+ *   channel.try_emplace(id, std::move(pixels));
+ *
+ *   // Main thread
+ *   channel.drain([](asset_loaded& message) {
+ *     // ...
+ *   });
+ * \endcode
+ *
+ * \details Channels can be attached to an `event_dispatcher`, which drains them after
+ * the SDL events have been dispatched, see `event_dispatcher::attach()`.
+ *
+ * \note Channels are built on `mpmc_queue`, of which only the non-blocking functions
+ * are used. Messages whose constructors might throw are constructed before a slot is
+ * claimed, so that an exception leaves the channel untouched.
+ *
+ * \tparam T the type of the messages, which must be nothrow move constructible.
+ *
+ * \see `mpmc_queue`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class event_channel final
+{
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty channel.
+   *
+   * \param capacity the maximum amount of pending messages, which is rounded up to the
+   * next power of two, at least two.
+   *
+   * \throws sdl_error if the underlying queue can't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit event_channel(const size_type capacity = 1'024) : m_queue{capacity}
+  {}
+
+  /**
+   * \brief Attempts to send a message, from any thread.
+   *
+   * \tparam Args the types of the arguments used to construct the message.
+   *
+   * \param args the arguments that will be forwarded to the constructor of the message.
+   *
+   * \return `true` if the message was sent; `false` if the channel was full.
+   *
+   * \since 6.1.0
+   */
+  template <typename... Args>
+  auto try_emplace(Args&&... args) noexcept(
+      std::is_nothrow_constructible_v<T, Args...>) -> bool
+  {
+    return m_queue.try_emplace(std::forward<Args>(args)...);
+  }
+
+  /// \copydoc try_emplace()
+  auto try_push(const T& message) noexcept(std::is_nothrow_copy_constructible_v<T>)
+      -> bool
+  {
+    return try_emplace(message);
+  }
+
+  /// \copydoc try_emplace()
+  auto try_push(T&& message) noexcept -> bool
+  {
+    return try_emplace(std::move(message));
+  }
+
+  /**
+   * \brief Receives a message, from the consumer thread only.
+   *
+   * \param[out] message the value that will be assigned the received message.
+   *
+   * \return `true` if a message was received; `false` if the channel was empty.
+   *
+   * \since 6.1.0
+   */
+  auto try_pop(T& message) -> bool
+  {
+    return m_queue.try_consume([&](T& received) { message = std::move(received); });
+  }
+
+  /**
+   * \brief Invokes a function object with every pending message, from the consumer
+   * thread only.
+   *
+   * \details Messages sent while draining might not be received until the next call,
+   * which ensures that this function returns even if producers keep sending messages.
+   *
+   * \tparam Function the type of the function object, invocable with `T&`.
+   *
+   * \param function the function object that will receive the messages.
+   *
+   * \return the amount of received messages.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  auto drain(Function&& function) -> size_type
+  {
+    const auto capacity = m_queue.capacity();
+
+    size_type count = 0;
+    while (count < capacity && m_queue.try_consume(function))
+    {
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Discards all pending messages, from the consumer thread only.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    while (m_queue.try_consume([](T&) noexcept {}))
+    {}
+  }
+
+  /**
+   * \brief Returns the maximum amount of pending messages.
+   *
+   * \return the capacity of the channel.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_queue.capacity();
+  }
+
+  /**
+   * \brief Returns an approximation of the amount of pending messages.
+   *
+   * \note The returned value might be outdated as soon as it is obtained, if other
+   * threads are sending messages.
+   *
+   * \return the approximate amount of pending messages.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size_approx() const noexcept -> size_type
+  {
+    return m_queue.size_approx();
+  }
+
+ private:
+  mpmc_queue<T> m_queue;
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_CHANNEL_HEADER
@@ -0,0 +1,159 @@
+#ifndef CENTURION_EVENT_COALESCING_HEADER
+#define CENTURION_EVENT_COALESCING_HEADER
+
+#include <SDL.h>
+
+#include <array>    // array
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+/// \cond FALSE
+namespace cen::detail {
+
+[[nodiscard]] constexpr auto is_coalescable(const SDL_Event& event) noexcept -> bool
+{
+  return event.type == SDL_MOUSEMOTION || event.type == SDL_CONTROLLERAXISMOTION ||
+         event.type == SDL_JOYAXISMOTION;
+}
+
+// Indicates whether or not two coalescable events originate from the same source
+[[nodiscard]] constexpr auto same_source(const SDL_Event& a, const SDL_Event& b) noexcept
+    -> bool
+{
+  if (a.type != b.type)
+  {
+    return false;
+  }
+
+  switch (a.type)
+  {
+    case SDL_MOUSEMOTION:
+      return a.motion.windowID == b.motion.windowID && a.motion.which == b.motion.which;
+
+    case SDL_CONTROLLERAXISMOTION:
+      return a.caxis.which == b.caxis.which && a.caxis.axis == b.caxis.axis;
+
+    case SDL_JOYAXISMOTION:
+      return a.jaxis.which == b.jaxis.which && a.jaxis.axis == b.jaxis.axis;
+
+    default:
+      return false;
+  }
+}
+
+// Merges a later event into an earlier event from the same source
+inline void merge_into(SDL_Event& earlier, const SDL_Event& later) noexcept
+{
+  if (earlier.type == SDL_MOUSEMOTION)
+  {
+    const auto dx = earlier.motion.xrel + later.motion.xrel;
+    const auto dy = earlier.motion.yrel + later.motion.yrel;
+
+    earlier.motion = later.motion;
+    earlier.motion.xrel = dx;
+    earlier.motion.yrel = dy;
+  }
+  else
+  {
+    earlier = later;
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \brief Merges redundant motion events in a sequence of events, in place.
+ *
+ * \details High-frequency input devices can produce a lot of motion events per frame,
+ * where usually only the latest state is of interest. This function merges mouse motion
+ * events from the same mouse and window, and controller and joystick axis events for
+ * the same device and axis.
+ *
+ * \details Merged mouse motion events have the position, button state and timestamp of
+ * the latest event, while the relative motion is accumulated. Merged axis events simply
+ * have the latest axis value.
+ *
+ * \details Events are only merged if there are no other kinds of events between them,
+ * so that e.g. a button press is still preceded by the motion that led up to it and
+ * followed by the motion after it. The remaining events keep their relative order.
+ *
+ * \param events the events that will be coalesced.
+ * \param count the amount of events.
+ *
+ * \return the amount of remaining events, which are stored at the beginning of the
+ * sequence.
+ *
+ * \see `event::drain()`
+ *
+ * \since 6.1.0
+ */
+inline auto coalesce_events(SDL_Event* events, const int count) noexcept -> int
+{
+  assert(events || count == 0);
+
+  int size = 0;      // The amount of kept events
+  int runBegin = 0;  // The index of the first kept event in the current motion run
+
+  for (int index = 0; index < count; ++index)
+  {
+    const auto& event = events[index];
+
+    if (!detail::is_coalescable(event))
+    {
+      events[size++] = event;
+      runBegin = size;
+      continue;
+    }
+
+    bool merged = false;
+    for (int kept = runBegin; kept < size; ++kept)
+    {
+      if (detail::same_source(events[kept], event))
+      {
+        detail::merge_into(events[kept], event);
+        merged = true;
+        break;
+      }
+    }
+
+    if (!merged)
+    {
+      events[size++] = event;
+    }
+  }
+
+  return size;
+}
+
+/**
+ * \brief Merges redundant motion events in an array of events, in place.
+ *
+ * \tparam N the size of the array.
+ *
+ * \param events the events that will be coalesced.
+ * \param count the amount of events in the array that will be considered.
+ *
+ * \return the amount of remaining events.
+ *
+ * \see `coalesce_events(SDL_Event*, int)`
+ *
+ * \since 6.1.0
+ */
+template <std::size_t N>
+auto coalesce_events(std::array<SDL_Event, N>& events, const int count) noexcept -> int
+{
+  assert(count >= 0 && static_cast<std::size_t>(count) <= N);
+  return coalesce_events(events.data(), count);
+}
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_COALESCING_HEADER
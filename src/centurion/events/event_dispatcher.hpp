@@ -1,17 +1,29 @@
 #ifndef CENTURION_EVENT_DISPATCHER_HEADER
 #define CENTURION_EVENT_DISPATCHER_HEADER
 
+#include <SDL.h>
+
 #include <array>        // array
 #include <cstddef>      // size_t
-#include <functional>   // function, bind
 #include <ostream>      // ostream
 #include <string>       // string
 #include <tuple>        // tuple
 #include <type_traits>  // is_same_v, is_invocable_v, is_reference_v, ...
+#include <utility>      // forward
+#include <vector>       // vector
 
-#include "../detail/to_string.hpp"
+#include "../core/delegate.hpp"
+#include "../core/integers.hpp"
+#include "../detail/event_traits.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/tuple_type_index.hpp"
+#include "../input/mouse.hpp"
+#include "../system/profiler.hpp"
 #include "event.hpp"
+#include "event_channel.hpp"
+#include "event_coalescing.hpp"
+#include "event_recorder.hpp"
+#include "event_signal.hpp"
 
 namespace cen {
 
@@ -21,6 +33,11 @@ namespace cen {
 /**
  * \brief Manages a subscription to an event.
  *
+ * \details A sink has a single primary handler, set with `to()`, and any amount of
+ * additional handlers with priorities, connected with `connect()`. The connected
+ * handlers are invoked first, in order of priority, and the primary handler is only
+ * invoked if none of them consumed the event, see `event_signal`.
+ *
  * \note This class is used by `event_dispatcher` and isn't really meant to be
  * used by itself.
  *
@@ -36,7 +53,7 @@ class event_sink final
  public:
   using event_type = std::decay_t<E>;              ///< Associated event type.
   using signature_type = void(const event_type&);  ///< Signature of handler.
-  using function_type = std::function<signature_type>;
+  using function_type = delegate<signature_type>;  ///< Stores the handler.
 
   /**
    * \brief Resets the event sink, removing any associated handler.
@@ -46,6 +63,7 @@ class event_sink final
   void reset() noexcept
   {
     m_function = nullptr;
+    m_signal.clear();
   }
 
   /**
@@ -53,6 +71,9 @@ class event_sink final
    *
    * \note This function will overwrite any previously set handler.
    *
+   * \note Function objects that fit in `delegate::buffer_size` bytes, such as lambdas
+   * that capture a few references, are stored without allocating memory.
+   *
    * \tparam T the type of the function object.
    *
    * \param callable the callable that will be invoked when an event is
@@ -66,7 +87,7 @@ class event_sink final
     static_assert(std::is_invocable_v<T, const event_type&>,
                   "Callable must be invocable with subscribed event!");
 
-    m_function = function_type{callable};
+    m_function = function_type{std::forward<T>(callable)};
   }
 
   /**
@@ -91,7 +112,7 @@ class event_sink final
     static_assert(std::is_invocable_v<decltype(memberFunc), Self*, const event_type&>,
                   "Member function must be invocable with subscribed event!");
 
-    to(std::bind(memberFunc, self, std::placeholders::_1));
+    m_function = function_type::template from<memberFunc>(self);
   }
 
   /**
@@ -106,7 +127,139 @@ class event_sink final
   template <auto function>
   void to()
   {
-    to(function);
+    m_function = function_type::template from<function>();
+  }
+
+  /**
+   * \brief Connects an additional handler, without affecting other handlers.
+   *
+   * \details The handler may return `bool`, where `true` indicates that the event was
+   * consumed and shouldn't be passed to handlers with lower priorities.
+   *
+   * \tparam T the type of the function object.
+   *
+   * \param callable the callable that will be invoked when an event is received.
+   * \param priority the priority of the handler, higher priorities are invoked first.
+   *
+   * \return a handle that can be used to disconnect the handler.
+   *
+   * \see `event_signal::connect()`
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto connect(T&& callable, const int priority = 0) -> event_connection
+  {
+    return m_signal.connect(std::forward<T>(callable), priority);
+  }
+
+  /**
+   * \brief Connects an additional member function handler.
+   *
+   * \note The event sink does *not* take ownership of the supplied pointer.
+   *
+   * \tparam memberFunc a pointer to a member function.
+   * \tparam Self the type of the object that owns the function.
+   *
+   * \param self a pointer to the object that will handle the event.
+   * \param priority the priority of the handler, higher priorities are invoked first.
+   *
+   * \return a handle that can be used to disconnect the handler.
+   *
+   * \since 6.1.0
+   */
+  template <auto memberFunc, typename Self>
+  auto connect(Self* self, const int priority = 0) -> event_connection
+  {
+    return m_signal.template connect<memberFunc>(self, priority);
+  }
+
+  /**
+   * \brief Connects an additional free function handler.
+   *
+   * \tparam function a function pointer.
+   *
+   * \param priority the priority of the handler, higher priorities are invoked first.
+   *
+   * \return a handle that can be used to disconnect the handler.
+   *
+   * \since 6.1.0
+   */
+  template <auto function>
+  auto connect(const int priority = 0) -> event_connection
+  {
+    return m_signal.template connect<function>(priority);
+  }
+
+  /**
+   * \brief Disconnects a handler that was connected with `connect()`.
+   *
+   * \param connection the handle of the handler.
+   *
+   * \return `true` if the handler was disconnected; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto disconnect(const event_connection connection) noexcept -> bool
+  {
+    return m_signal.disconnect(connection);
+  }
+
+  /**
+   * \brief Invokes the handlers of the sink with an event.
+   *
+   * \param event the event that will be handled.
+   *
+   * \since 6.1.0
+   */
+  void invoke(const event_type& event)
+  {
+    if (!m_signal.emit(event) && m_function)
+    {
+      m_function(event);
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the sink has any handlers.
+   *
+   * \return `true` if there is a primary handler or a connected handler; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has_handlers() const noexcept -> bool
+  {
+    return m_function || !m_signal.empty();
+  }
+
+  /**
+   * \brief Returns the amount of handlers of the sink.
+   *
+   * \return the amount of connected handlers, including the primary handler.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto handler_count() const noexcept -> std::size_t
+  {
+    return m_signal.size() + (m_function ? 1u : 0u);
+  }
+
+  /**
+   * \brief Returns the signal that stores the additional handlers.
+   *
+   * \return the signal of the sink.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto signal() noexcept -> event_signal<event_type>&
+  {
+    return m_signal;
+  }
+
+  [[nodiscard]] auto signal() const noexcept -> const event_signal<event_type>&
+  {
+    return m_signal;
   }
 
   /**
@@ -128,6 +281,7 @@ class event_sink final
 
  private:
   function_type m_function;
+  event_signal<event_type> m_signal;
 };
 
 /**
@@ -178,6 +332,8 @@ class event_dispatcher final
   static_assert((!std::is_pointer_v<E> && ...),
                 "Pointer types can't be used as template parameters!");
 
+  using sink_tuple = std::tuple<event_sink<E>...>;
+
   /**
    * \brief Returns the index of an event type in the function tuple.
    *
@@ -212,33 +368,66 @@ class event_dispatcher final
     return std::get<index>(m_sinks);
   }
 
+  /// Associates an SDL event type with the index of the sink that handles it.
+  struct table_entry final
+  {
+    u32 type{};
+    std::size_t index{};
+  };
+
+  using handler_type = void (*)(event_dispatcher&, const SDL_Event&);
+
+  inline static constexpr std::size_t table_size =
+      (0u + ... + detail::event_traits<E>::types.size());
+
   /**
-   * \brief Checks for the specified event type in the event handler.
-   *
-   * \tparam Event the event to look for.
+   * \brief Creates a table of all SDL event types of the subscribed events.
    *
-   * \return `true` if there was a match; `false` otherwise.
+   * \return the table entries, sorted by event type.
    *
-   * \since 5.1.0
+   * \since 6.1.0
    */
-  template <typename Event>
-  auto check_for() -> bool
+  [[nodiscard]] constexpr static auto make_table() noexcept
+      -> std::array<table_entry, table_size>
   {
-    if (const auto* event = m_event.template try_get<Event>())
-    {
-      if (auto& function = get_sink<Event>().function())
+    std::array<table_entry, table_size> table{};
+    std::size_t count = 0;
+
+    [[maybe_unused]] const auto append = [&](const auto& types, const std::size_t index) {
+      for (const auto type : types)
       {
-        function(*event);
+        // Insertion sort, the tables are small and this has to be constexpr
+        auto position = count;
+        while (position > 0 && table[position - 1u].type > type)
+        {
+          table[position] = table[position - 1u];
+          --position;
+        }
+
+        table[position] = table_entry{type, index};
+        ++count;
       }
+    };
 
-      return true;
-    }
-    else
+    (append(detail::event_traits<E>::types, index_of<E>()), ...);
+
+    return table;
+  }
+
+  inline static constexpr auto table = make_table();
+
+  template <typename Event>
+  static void invoke(event_dispatcher& self, const SDL_Event& event)
+  {
+    if (auto& sink = self.get_sink<Event>(); sink.has_handlers())
     {
-      return false;
+      sink.invoke(detail::event_traits<Event>::make(event));
     }
   }
 
+  inline static constexpr std::array<handler_type, sizeof...(E)> handlers = {
+      &invoke<E>...};
+
  public:
   using size_type = std::size_t;
 
@@ -249,14 +438,301 @@ class event_dispatcher final
    * used to manage events. You should call this function once for every
    * iteration in your game loop.
    *
+   * \details Events are dispatched by looking up their SDL event type in a table that
+   * is generated at compile-time, so events that aren't subscribed to are discarded
+   * without ever being converted to their Centurion counterparts.
+   *
+   * \details Attached channels are drained after the SDL events, see `attach()`. If
+   * there is a recorder, the start of the frame and all polled SDL events are recorded,
+   * see `set_recorder()`.
+   *
    * \since 5.1.0
    */
   void poll()
   {
-    while (m_event.poll())
+    CENTURION_PROFILE_SCOPE("event_dispatcher::poll");
+
+    if (m_recorder)
+    {
+      m_recorder->mark_frame();
+    }
+
+    SDL_Event event;
+    while (SDL_PollEvent(&event))
     {
-      (check_for<E>() || ...);
+      if (m_recorder)
+      {
+        m_recorder->record(event);
+      }
+
+      if (m_mouse)
+      {
+        m_mouse->accumulate(event);
+      }
+
+      dispatch(event);
     }
+
+    poll_channels();
+  }
+
+  /**
+   * \brief Polls all events in batches, checking for subscribed events.
+   *
+   * \details This function behaves like `poll()`, but moves the events out of the event
+   * queue in batches, see `event::drain()`. This reduces the overhead of locking the
+   * event queue once per event, which is noticeable when there are lots of events, e.g.
+   * from touch screens and mice with high polling rates.
+   *
+   * \details If coalescing is enabled, redundant motion events in each batch are merged
+   * before they are dispatched, see `set_coalescing_enabled()`.
+   *
+   * \tparam BatchSize the maximum amount of events obtained at once.
+   *
+   * \since 6.1.0
+   */
+  template <std::size_t BatchSize = 64>
+  void poll_batched()
+  {
+    CENTURION_PROFILE_SCOPE("event_dispatcher::poll_batched");
+
+    std::array<SDL_Event, BatchSize> events;
+
+    if (m_recorder)
+    {
+      m_recorder->mark_frame();
+    }
+
+    // The queue is drained until it is empty, so that events pushed by handlers are also
+    // dispatched, just like with poll()
+    for (auto count = event::drain(events); count && *count > 0;
+         count = event::drain(events))
+    {
+      if (m_recorder)
+      {
+        for (int index = 0; index < *count; ++index)
+        {
+          m_recorder->record(events[static_cast<std::size_t>(index)]);
+        }
+      }
+
+      if (m_mouse)
+      {
+        m_mouse->accumulate(events.data(), *count);
+      }
+
+      const auto size = m_coalescing ? coalesce_events(events, *count) : *count;
+      for (int index = 0; index < size; ++index)
+      {
+        dispatch(events[static_cast<std::size_t>(index)]);
+      }
+    }
+
+    poll_channels();
+  }
+
+  /**
+   * \brief Dispatches a single event to the associated handler, if there is one.
+   *
+   * \param event the event that will be dispatched.
+   *
+   * \return `true` if the event is one of the subscribed events; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto dispatch(const SDL_Event& event) -> bool
+  {
+    const auto type = event.type;
+
+    // Binary search, the table is sorted by event type
+    std::size_t first = 0;
+    std::size_t last = table_size;
+    while (first < last)
+    {
+      const auto middle = first + (last - first) / 2u;
+      if (table[middle].type < type)
+      {
+        first = middle + 1u;
+      }
+      else
+      {
+        last = middle;
+      }
+    }
+
+    if (first != table_size && table[first].type == type)
+    {
+      handlers[table[first].index](*this, event);
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Attaches a channel, which will be drained by `poll()` and `poll_batched()`.
+   *
+   * \note The dispatcher does *not* take ownership of the channel, which must outlive
+   * the dispatcher or be detached before it is destroyed.
+   *
+   * \tparam T the message type of the channel.
+   * \tparam Function the type of the function object, invocable with `T&`.
+   *
+   * \param channel the channel that will be drained.
+   * \param function the function object that will receive the messages.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename Function>
+  void attach(event_channel<T>& channel, Function&& function)
+  {
+    static_assert(std::is_invocable_v<std::decay_t<Function>&, T&>,
+                  "Function must be invocable with the message type!");
+
+    auto drain = [&channel, f = std::forward<Function>(function)]() mutable {
+      return channel.drain(f);
+    };
+
+    m_channels.push_back({&channel, channel_function{std::move(drain)}});
+  }
+
+  /**
+   * \brief Detaches a channel.
+   *
+   * \tparam T the message type of the channel.
+   *
+   * \param channel the channel that will no longer be drained.
+   *
+   * \return `true` if the channel was detached; `false` if it wasn't attached.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto detach(const event_channel<T>& channel) noexcept -> bool
+  {
+    for (auto it = m_channels.begin(); it != m_channels.end(); ++it)
+    {
+      if (it->channel == &channel)
+      {
+        m_channels.erase(it);
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Drains all attached channels.
+   *
+   * \details This is called by `poll()` and `poll_batched()`.
+   *
+   * \return the total amount of received messages.
+   *
+   * \since 6.1.0
+   */
+  auto poll_channels() -> size_type
+  {
+    size_type count = 0;
+    for (auto& attached : m_channels)
+    {
+      count += attached.drain();
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Sets the recorder that records the polled events.
+   *
+   * \details Events are recorded before they are coalesced or dispatched, including
+   * events that aren't subscribed to. Each call to `poll()` or `poll_batched()` also
+   * records the start of a frame, see `event_recorder::mark_frame()`.
+   *
+   * \note The dispatcher does *not* take ownership of the recorder.
+   *
+   * \param recorder the recorder that will be used, can be null to stop recording.
+   *
+   * \since 6.1.0
+   */
+  void set_recorder(event_recorder* recorder) noexcept
+  {
+    m_recorder = recorder;
+  }
+
+  /**
+   * \brief Returns the recorder that records the polled events.
+   *
+   * \return a pointer to the recorder, might be null.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto recorder() const noexcept -> event_recorder*
+  {
+    return m_recorder;
+  }
+
+  /**
+   * \brief Sets the mouse that accumulates the relative motion and wheel scrolling of the
+   * polled events.
+   *
+   * \details Events are accumulated before they are coalesced or dispatched, so the
+   * mouse receives every event, including events that aren't subscribed to, see
+   * `mouse::accumulate()`.
+   *
+   * \note The dispatcher does *not* take ownership of the mouse.
+   *
+   * \param mouse the mouse that will be used, can be null to stop accumulating.
+   *
+   * \since 6.1.0
+   */
+  void set_mouse(cen::mouse* mouse) noexcept
+  {
+    m_mouse = mouse;
+  }
+
+  /**
+   * \brief Returns the mouse that accumulates the polled events.
+   *
+   * \return a pointer to the mouse, might be null.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto tracked_mouse() const noexcept -> cen::mouse*
+  {
+    return m_mouse;
+  }
+
+  /**
+   * \brief Sets whether or not `poll_batched()` coalesces motion events.
+   *
+   * \details Coalescing merges consecutive mouse motion events into a single event with
+   * the accumulated relative motion, and only keeps the latest value of controller and
+   * joystick axes, see `coalesce_events()`. This is disabled by default.
+   *
+   * \note This doesn't affect `poll()`, which handles one event at a time.
+   *
+   * \param enabled `true` if motion events should be coalesced; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  void set_coalescing_enabled(const bool enabled) noexcept
+  {
+    m_coalescing = enabled;
+  }
+
+  /**
+   * \brief Indicates whether or not `poll_batched()` coalesces motion events.
+   *
+   * \return `true` if motion events are coalesced; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_coalescing_enabled() const noexcept -> bool
+  {
+    return m_coalescing;
   }
 
   /**
@@ -298,7 +774,7 @@ class event_dispatcher final
    */
   [[nodiscard]] auto active_count() const -> size_type
   {
-    return (0u + ... + (get_sink<E>().function() ? 1u : 0u));
+    return (0u + ... + get_sink<E>().handler_count());
   }
 
   /**
@@ -317,18 +793,39 @@ class event_dispatcher final
   }
 
  private:
-  using sink_tuple = std::tuple<event_sink<E>...>;
+  using channel_function = delegate<size_type()>;
+
+  struct attached_channel final
+  {
+    const void* channel{};
+    channel_function drain;
+  };
 
-  cen::event m_event;
   sink_tuple m_sinks;
+  std::vector<attached_channel> m_channels;
+  event_recorder* m_recorder{};
+  cen::mouse* m_mouse{};
+  bool m_coalescing{};
 };
 
+template <typename... E>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const event_dispatcher<E...>& dispatcher) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("event_dispatcher{size: ",
+                      dispatcher.size(),
+                      ", #active: ",
+                      dispatcher.active_count(),
+                      "}");
+}
+
 template <typename... E>
 [[nodiscard]] inline auto to_string(const event_dispatcher<E...>& dispatcher)
     -> std::string
 {
-  return "event_dispatcher{size: " + detail::to_string(dispatcher.size()).value() +
-         ", #active: " + detail::to_string(dispatcher.active_count()).value() + "}";
+  return detail::format_string(dispatcher);
 }
 
 template <typename... E>
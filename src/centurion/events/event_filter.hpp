@@ -0,0 +1,325 @@
+#ifndef CENTURION_EVENT_FILTER_HEADER
+#define CENTURION_EVENT_FILTER_HEADER
+
+#include <SDL.h>
+
+#include <utility>  // move
+
+#include "../core/delegate.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/event_traits.hpp"
+#include "event_type.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Indicates whether an SDL event type is represented by any of the event wrappers, an
+// empty set of wrappers matches every event
+template <typename... Events>
+[[nodiscard]] constexpr auto matches_any(const u32 type) noexcept -> bool
+{
+  if constexpr (sizeof...(Events) == 0)
+  {
+    return true;
+  }
+  else
+  {
+    return (is_event_type<Events>(type) || ...);
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/// \name Event state functions
+/// \{
+
+/**
+ * \brief Sets whether or not events of a specific type are processed.
+ *
+ * \details Disabled events are dropped by SDL before they enter the event queue, so they
+ * are never seen by filters, watches or `event::poll()`. Disabling a type also removes
+ * the events of that type that are already in the queue.
+ *
+ * \param type the event type that will be changed.
+ * \param enabled `true` if the events should be processed; `false` otherwise.
+ *
+ * \see `SDL_EventState`
+ *
+ * \since 6.1.0
+ */
+inline void set_event_enabled(const event_type type, const bool enabled) noexcept
+{
+  SDL_EventState(to_underlying(type), enabled ? SDL_ENABLE : SDL_IGNORE);
+}
+
+/**
+ * \brief Indicates whether or not events of a specific type are processed.
+ *
+ * \param type the event type that will be checked.
+ *
+ * \return `true` if the events are processed; `false` if they are dropped.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto is_event_enabled(const event_type type) noexcept -> bool
+{
+  return SDL_EventState(to_underlying(type), SDL_QUERY) == SDL_ENABLE;
+}
+
+/**
+ * \brief Sets whether or not the events represented by some event wrappers are processed.
+ *
+ * \details For example, `set_events_enabled<cen::joy_axis_event,
+ * cen::joy_ball_event>(false)` drops all joystick axis and ball motion events.
+ *
+ * \tparam Events the event wrappers, e.g. `mouse_motion_event`.
+ *
+ * \param enabled `true` if the events should be processed; `false` otherwise.
+ *
+ * \since 6.1.0
+ */
+template <typename... Events>
+void set_events_enabled(const bool enabled) noexcept
+{
+  static_assert(sizeof...(Events) != 0, "No event types were specified!");
+
+  const auto apply = [=](const auto& types) noexcept {
+    for (const auto type : types)
+    {
+      set_event_enabled(static_cast<event_type>(type), enabled);
+    }
+  };
+
+  (apply(detail::event_traits<Events>::types), ...);
+}
+
+/**
+ * \brief Disables every event type, except for those represented by some event wrappers.
+ *
+ * \details Events that an application never handles still have to be queued and polled,
+ * which involves locking the event queue. This function makes SDL drop such events
+ * at the source instead.
+ * \code{cpp}
+ *   cen::enable_only<cen::quit_event, cen::keyboard_event, cen::window_event>();
+ * \endcode
+ *
+ * \details Every type below the user event range is disabled first, including types
+ * that were added in later versions of SDL, after which the requested types are enabled.
+ * Types that are requested aren't disabled in between, so their queued events are kept.
+ * User events are not affected.
+ *
+ * \note Remember to include `quit_event`, unless the application detects that it should
+ * quit by other means.
+ *
+ * \tparam Events the event wrappers whose events will be processed.
+ *
+ * \since 6.1.0
+ */
+template <typename... Events>
+void enable_only() noexcept
+{
+  static_assert(sizeof...(Events) != 0, "No event types were specified!");
+
+  for (u32 type = SDL_FIRSTEVENT + 1; type < SDL_USEREVENT; ++type)
+  {
+    const auto enabled = SDL_EventState(type, SDL_QUERY) == SDL_ENABLE;
+    if (enabled && !detail::matches_any<Events...>(type))
+    {
+      SDL_EventState(type, SDL_IGNORE);
+    }
+  }
+
+  set_events_enabled<Events...>(true);
+}
+
+/// \} End of event state functions
+
+/**
+ * \class event_filter
+ *
+ * \brief Decides which events are added to the event queue.
+ *
+ * \details The filter is invoked for every event that is pushed onto the queue, that is
+ * represented by one of the event wrappers `Events`, or every event if `Events` is
+ * empty. Events for which the callback returns `false` are dropped. Other events are
+ * kept, unless the previous filter drops them.
+ * \code{cpp}
+ *   // Drops the motion of the mouse that is emulated by touch input
+ *   cen::event_filter<cen::mouse_motion_event> filter{[](const SDL_Event& event) {
+ *     return event.motion.which != SDL_TOUCH_MOUSEID;
+ *   }};
+ * \endcode
+ *
+ * \note SDL only supports a single event filter. Creating a filter replaces the current
+ * one, which is restored when the filter is destroyed, so filters must be destroyed in
+ * the reverse order of their creation. Events that are kept by the filter are passed on
+ * to the previous filter, so that it still gets a chance to drop them.
+ *
+ * \note The callback is invoked on the thread that pushes the event, which isn't
+ * necessarily the thread that polls the events, and it must not throw.
+ *
+ * \tparam Events the event wrappers whose events are filtered, e.g. `keyboard_event`.
+ *
+ * \see `SDL_SetEventFilter`
+ *
+ * \since 6.1.0
+ */
+template <typename... Events>
+class event_filter final
+{
+ public:
+  using callback_type = delegate<bool(const SDL_Event&)>;
+
+  /**
+   * \brief Installs an event filter.
+   *
+   * \param callback the callback that decides whether or not events are kept.
+   *
+   * \since 6.1.0
+   */
+  explicit event_filter(callback_type callback) noexcept : m_callback{std::move(callback)}
+  {
+    if (!SDL_GetEventFilter(&m_previous, &m_previousData))
+    {
+      m_previous = nullptr;
+      m_previousData = nullptr;
+    }
+
+    SDL_SetEventFilter(&on_event, this);
+  }
+
+  event_filter(const event_filter&) = delete;
+
+  auto operator=(const event_filter&) -> event_filter& = delete;
+
+  /**
+   * \brief Restores the previous event filter, if there was one.
+   *
+   * \since 6.1.0
+   */
+  ~event_filter() noexcept
+  {
+    SDL_SetEventFilter(m_previous, m_previousData);
+  }
+
+  /**
+   * \brief Applies the filter to the events that are already in the event queue.
+   *
+   * \details This is useful after creating the filter, to remove the matching events
+   * that were queued before.
+   *
+   * \see `SDL_FilterEvents`
+   *
+   * \since 6.1.0
+   */
+  void apply() noexcept
+  {
+    SDL_FilterEvents(&on_event, this);
+  }
+
+ private:
+  callback_type m_callback;
+  SDL_EventFilter m_previous{};
+  void* m_previousData{};
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    auto* self = static_cast<event_filter*>(data);
+
+    if (self->m_callback && detail::matches_any<Events...>(event->type) &&
+        !self->m_callback(*event))
+    {
+      return 0;
+    }
+
+    return self->m_previous ? self->m_previous(self->m_previousData, event) : 1;
+  }
+};
+
+/**
+ * \class event_watch
+ *
+ * \brief Observes events as they are added to the event queue.
+ *
+ * \details The callback is invoked for every event that is pushed onto the queue, that
+ * is represented by one of the event wrappers `Events`, or every event if `Events` is
+ * empty. Unlike a filter, a watch can't drop events, and any amount of watches can be
+ * active at the same time.
+ * \code{cpp}
+ *   cen::event_watch<cen::window_event> watch{[&](const SDL_Event& event) {
+ *     if (event.window.event == SDL_WINDOWEVENT_RESIZED)
+ *     {
+ *       renderer.invalidate();  // Also during live resizing, when no events are polled
+ *     }
+ *   }};
+ * \endcode
+ *
+ * \note The callback is invoked on the thread that pushes the event, which isn't
+ * necessarily the thread that polls the events, and it must not throw.
+ *
+ * \tparam Events the event wrappers whose events are watched, e.g. `window_event`.
+ *
+ * \see `SDL_AddEventWatch`
+ *
+ * \since 6.1.0
+ */
+template <typename... Events>
+class event_watch final
+{
+ public:
+  using callback_type = delegate<void(const SDL_Event&)>;
+
+  /**
+   * \brief Registers an event watch.
+   *
+   * \param callback the callback that will be invoked with the watched events.
+   *
+   * \since 6.1.0
+   */
+  explicit event_watch(callback_type callback) noexcept : m_callback{std::move(callback)}
+  {
+    SDL_AddEventWatch(&on_event, this);
+  }
+
+  event_watch(const event_watch&) = delete;
+
+  auto operator=(const event_watch&) -> event_watch& = delete;
+
+  /**
+   * \brief Unregisters the event watch.
+   *
+   * \since 6.1.0
+   */
+  ~event_watch() noexcept
+  {
+    SDL_DelEventWatch(&on_event, this);
+  }
+
+ private:
+  callback_type m_callback;
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    auto* self = static_cast<event_watch*>(data);
+
+    if (self->m_callback && detail::matches_any<Events...>(event->type))
+    {
+      self->m_callback(*event);
+    }
+
+    return 0;  // The return value of event watches is ignored
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_FILTER_HEADER
@@ -0,0 +1,352 @@
+#ifndef CENTURION_EVENT_PLAYER_HEADER
+#define CENTURION_EVENT_PLAYER_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy, memcmp
+#include <string>   // string
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../detail/event_record_format.hpp"
+#include "../filesystem/file.hpp"
+#include "../system/counter.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \enum playback_mode
+ *
+ * \brief Provides values that determine how an `event_player` injects events.
+ *
+ * \since 6.1.0
+ */
+enum class playback_mode
+{
+  realtime,     ///< Events are injected at the same cadence as they were recorded.
+  frame_locked  ///< The events of one recorded frame are injected per update.
+};
+
+/**
+ * \class event_player
+ *
+ * \brief Replays events that were recorded by an `event_recorder`.
+ *
+ * \details In the realtime mode, events are injected when the same amount of time has
+ * passed since the start of the playback as when they were recorded. In the frame locked
+ * mode, each call to `update()` injects the events of the next recorded frame, which
+ * means that the session is replayed as fast as the application runs, with the same
+ * events in every frame. The latter is useful for reproducible benchmarks.
+ * \code{cpp}
+ *   cen::event_player player{"session.cenrec", cen::playback_mode::frame_locked};
+ *
+ *   while (!player.is_finished()) {
+ *     player.update();     // Pushes the events of the next frame to the event queue
+ *     dispatcher.poll();
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+class event_player final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a player from the binary representation of a recording.
+   *
+   * \param data the recording, see `event_recorder::data()`.
+   * \param mode the playback mode.
+   *
+   * \throws cen_error if the data isn't a compatible recording.
+   *
+   * \since 6.1.0
+   */
+  explicit event_player(std::vector<u8> data,
+                        const playback_mode mode = playback_mode::realtime)
+      : m_data{std::move(data)}
+      , m_mode{mode}
+  {
+    if (m_data.size() < detail::event_record_header_size ||
+        std::memcmp(m_data.data(),
+                    detail::event_record_magic,
+                    sizeof detail::event_record_magic) != 0)
+    {
+      throw cen_error{"Not an event recording!"};
+    }
+
+    if (read_u32(8) != detail::event_record_version ||
+        read_u32(12) != static_cast<u32>(sizeof(SDL_Event)))
+    {
+      throw cen_error{"Incompatible event recording!"};
+    }
+
+    restart();
+  }
+
+  /**
+   * \brief Loads a recording from a file.
+   *
+   * \param path the file path of the recording.
+   * \param mode the playback mode.
+   *
+   * \throws cen_error if the file couldn't be read, or isn't a compatible recording.
+   *
+   * \since 6.1.0
+   */
+  explicit event_player(const not_null<czstring> path,
+                        const playback_mode mode = playback_mode::realtime)
+      : event_player{load(path), mode}
+  {}
+
+  /// \copydoc event_player(not_null<czstring>, playback_mode)
+  explicit event_player(const std::string& path,
+                        const playback_mode mode = playback_mode::realtime)
+      : event_player{path.c_str(), mode}
+  {}
+
+  /**
+   * \brief Pushes the events that are due to the event queue.
+   *
+   * \details In the realtime mode, the clock starts with the first call to this
+   * function, or with the first call to `poll()`.
+   *
+   * \return the amount of pushed events.
+   *
+   * \since 6.1.0
+   */
+  auto update() -> int
+  {
+    if (m_mode == playback_mode::frame_locked)
+    {
+      next_frame();
+    }
+
+    int count = 0;
+
+    SDL_Event event;
+    while (poll(event))
+    {
+      if (SDL_PushEvent(&event) == 1)
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Obtains the next event that is due, without pushing it to the event queue.
+   *
+   * \details In the frame locked mode, this function only returns the events of the
+   * current frame, see `next_frame()`.
+   *
+   * \param[out] event the event that will be assigned the next event.
+   *
+   * \return `true` if an event was obtained; `false` if there are no more events that are
+   * due.
+   *
+   * \since 6.1.0
+   */
+  auto poll(SDL_Event& event) -> bool
+  {
+    if (m_mode == playback_mode::realtime && !m_started)
+    {
+      m_start = counter::now();
+      m_started = true;
+    }
+
+    while (m_offset + detail::event_record_prefix_size <= m_data.size())
+    {
+      const auto delta = read_u32(m_offset);
+      const auto size = static_cast<size_type>(read_u16(m_offset + 4u));
+
+      if (size > sizeof(SDL_Event) ||
+          m_offset + detail::event_record_prefix_size + size > m_data.size())
+      {
+        m_offset = m_data.size();  // The recording is truncated or corrupt
+        return false;
+      }
+
+      if (m_mode == playback_mode::realtime && m_time + delta > elapsed())
+      {
+        return false;
+      }
+
+      if (size == 0)
+      {
+        if (m_mode == playback_mode::frame_locked && m_inFrame)
+        {
+          return false;  // The marker of the next frame is consumed by next_frame()
+        }
+
+        consume(delta, size);
+        m_inFrame = true;
+        continue;
+      }
+
+      const auto* payload = m_data.data() + m_offset + detail::event_record_prefix_size;
+
+      event = SDL_Event{};
+      std::memcpy(&event, payload, size);
+
+      consume(delta, size);
+      ++m_played;
+
+      return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Advances to the next recorded frame, in the frame locked mode.
+   *
+   * \details Any remaining events of the current frame are skipped.
+   *
+   * \since 6.1.0
+   */
+  void next_frame()
+  {
+    if (m_inFrame)
+    {
+      SDL_Event ignored;
+      while (poll(ignored))
+      {}
+    }
+
+    m_inFrame = false;
+  }
+
+  /**
+   * \brief Restarts the playback from the beginning of the recording.
+   *
+   * \since 6.1.0
+   */
+  void restart() noexcept
+  {
+    m_offset = detail::event_record_header_size;
+    m_time = 0;
+    m_played = 0;
+    m_started = false;
+    m_inFrame = false;
+  }
+
+  void set_mode(const playback_mode mode) noexcept
+  {
+    m_mode = mode;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not all events have been played.
+   *
+   * \return `true` if the end of the recording has been reached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_finished() const noexcept -> bool
+  {
+    return m_offset + detail::event_record_prefix_size > m_data.size();
+  }
+
+  /**
+   * \brief Returns the amount of events that have been played.
+   *
+   * \return the amount of played events, since the last restart.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto played_count() const noexcept -> size_type
+  {
+    return m_played;
+  }
+
+  [[nodiscard]] auto mode() const noexcept -> playback_mode
+  {
+    return m_mode;
+  }
+
+  /// \} End of queries
+
+ private:
+  std::vector<u8> m_data;
+  size_type m_offset{};  // The offset of the next record
+  u64 m_time{};          // The time of the last consumed record, in microseconds
+  u64 m_start{};         // The value of the performance counter when playback started
+  size_type m_played{};
+  playback_mode m_mode;
+  bool m_started{};
+  bool m_inFrame{};
+
+  [[nodiscard]] static auto load(const czstring path) -> std::vector<u8>
+  {
+    file input{path, file_mode::read_existing_binary};
+    if (!input)
+    {
+      throw cen_error{"Failed to open event recording!"};
+    }
+
+    const auto size = input.size();
+    if (!size)
+    {
+      throw cen_error{"Failed to determine the size of event recording!"};
+    }
+
+    std::vector<u8> data(*size);
+    if (input.read_to(data) != data.size())
+    {
+      throw cen_error{"Failed to read event recording!"};
+    }
+
+    return data;
+  }
+
+  [[nodiscard]] auto elapsed() const noexcept -> u64
+  {
+    const auto ticks = counter::now() - m_start;
+    const auto frequency = counter::frequency();
+    return (ticks / frequency) * 1'000'000u +
+           ((ticks % frequency) * 1'000'000u) / frequency;
+  }
+
+  void consume(const u32 delta, const size_type size) noexcept
+  {
+    m_time += delta;
+    m_offset += detail::event_record_prefix_size + size;
+  }
+
+  [[nodiscard]] auto read_u16(const size_type offset) const noexcept -> u16
+  {
+    return static_cast<u16>(m_data[offset] | (m_data[offset + 1u] << 8u));
+  }
+
+  [[nodiscard]] auto read_u32(const size_type offset) const noexcept -> u32
+  {
+    u32 result = 0;
+    for (u32 index = 0; index < 4u; ++index)
+    {
+      result |= static_cast<u32>(m_data[offset + index]) << (index * 8u);
+    }
+
+    return result;
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_PLAYER_HEADER
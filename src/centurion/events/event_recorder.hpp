@@ -0,0 +1,259 @@
+#ifndef CENTURION_EVENT_RECORDER_HEADER
+#define CENTURION_EVENT_RECORDER_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>   // size_t
+#include <cstring>   // memcpy
+#include <iterator>  // begin, end
+#include <string>    // string
+#include <vector>    // vector
+
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../core/result.hpp"
+#include "../detail/event_record_format.hpp"
+#include "../filesystem/file.hpp"
+#include "../system/counter.hpp"
+#include "event.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class event_recorder
+ *
+ * \brief Records a stream of events with timestamps, which can be replayed later.
+ *
+ * \details Recordings are stored in a compact binary format, where every event only
+ * occupies the size of its SDL event struct, along with a small prefix that holds the
+ * time since the previous event. Frame boundaries can also be recorded, which makes it
+ * possible to replay a session with exactly the same events in every frame, see
+ * `event_player`.
+ * \code{cpp}
+ *   cen::event_recorder recorder;
+ *   dispatcher.set_recorder(&recorder);  // Or call record() manually
+ *
+ *   // ...
+ *
+ *   recorder.save("session.cenrec");
+ * \endcode
+ *
+ * \note Events that refer to memory that is owned by someone else, i.e. the file names
+ * of drop events and the data pointers of user events, are recorded with null pointers.
+ * System window manager events aren't recorded at all.
+ *
+ * \since 6.1.0
+ */
+class event_recorder final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty recording.
+   *
+   * \details The timestamps of recorded events are relative to the creation of the
+   * recorder, or to the last call to `clear()`.
+   *
+   * \since 6.1.0
+   */
+  event_recorder()
+  {
+    clear();
+  }
+
+  /**
+   * \brief Records an event.
+   *
+   * \param event the event that will be recorded.
+   *
+   * \since 6.1.0
+   */
+  void record(const SDL_Event& event)
+  {
+    if (event.type == SDL_SYSWMEVENT)
+    {
+      return;
+    }
+
+    SDL_Event copy = event;
+    if (copy.type == SDL_DROPFILE || copy.type == SDL_DROPTEXT)
+    {
+      copy.drop.file = nullptr;
+    }
+    else if (copy.type >= SDL_USEREVENT && copy.type <= SDL_LASTEVENT)
+    {
+      copy.user.data1 = nullptr;
+      copy.user.data2 = nullptr;
+    }
+
+    const auto size = detail::event_payload_size(copy.type);
+    write_prefix(static_cast<u16>(size));
+
+    const auto offset = m_data.size();
+    m_data.resize(offset + size);
+    std::memcpy(m_data.data() + offset, &copy, size);
+
+    ++m_count;
+  }
+
+  /// \copydoc record()
+  void record(const event& event)
+  {
+    if (!event.is_empty())
+    {
+      record(event.data());
+    }
+  }
+
+  /**
+   * \brief Records the start of a new frame.
+   *
+   * \details This should be called once per frame, before the events of the frame are
+   * recorded. `event_dispatcher` does this automatically.
+   *
+   * \since 6.1.0
+   */
+  void mark_frame()
+  {
+    write_prefix(0);
+    ++m_frames;
+  }
+
+  /**
+   * \brief Removes all recorded events and restarts the clock.
+   *
+   * \since 6.1.0
+   */
+  void clear()
+  {
+    m_data.clear();
+    m_data.insert(m_data.end(),
+                  std::begin(detail::event_record_magic),
+                  std::end(detail::event_record_magic));
+
+    write_u32(detail::event_record_version);
+    write_u32(static_cast<u32>(sizeof(SDL_Event)));
+
+    m_start = counter::now();
+    m_micros = 0;
+    m_count = 0;
+    m_frames = 0;
+  }
+
+  /**
+   * \brief Writes the recording to a file.
+   *
+   * \param path the file path of the recording.
+   *
+   * \return `success` if the recording was saved; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto save(const not_null<czstring> path) const -> result
+  {
+    file output{path, file_mode::write_binary};
+    if (!output)
+    {
+      return failure;
+    }
+
+    return output.write(m_data) == m_data.size();
+  }
+
+  /// \copydoc save()
+  auto save(const std::string& path) const -> result
+  {
+    return save(path.c_str());
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the binary representation of the recording.
+   *
+   * \return the recorded data, which is the same as the file contents written by
+   * `save()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const std::vector<u8>&
+  {
+    return m_data;
+  }
+
+  /**
+   * \brief Returns the amount of recorded events.
+   *
+   * \return the amount of recorded events, not including frame markers.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto count() const noexcept -> size_type
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Returns the amount of recorded frame markers.
+   *
+   * \return the amount of calls to `mark_frame()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> size_type
+  {
+    return m_frames;
+  }
+
+  /// \} End of queries
+
+ private:
+  std::vector<u8> m_data;
+  u64 m_start{};   // The value of the performance counter when the recording started
+  u64 m_micros{};  // The time of the last record, in microseconds since the start
+  size_type m_count{};
+  size_type m_frames{};
+
+  void write_prefix(const u16 size)
+  {
+    const auto ticks = counter::now() - m_start;
+    const auto frequency = counter::frequency();
+
+    // The time is computed from the start, so that rounding errors don't accumulate
+    const auto micros = (ticks / frequency) * 1'000'000u +
+                        ((ticks % frequency) * 1'000'000u) / frequency;
+
+    const auto delta = (micros - m_micros > 0xFFFF'FFFFu)
+                           ? u32{0xFFFF'FFFFu}
+                           : static_cast<u32>(micros - m_micros);
+    m_micros += delta;
+
+    write_u32(delta);
+    write_u16(size);
+  }
+
+  void write_u16(const u16 value)
+  {
+    m_data.push_back(static_cast<u8>(value & 0xFFu));
+    m_data.push_back(static_cast<u8>(value >> 8u));
+  }
+
+  void write_u32(const u32 value)
+  {
+    for (u32 shift = 0; shift < 32u; shift += 8u)
+    {
+      m_data.push_back(static_cast<u8>((value >> shift) & 0xFFu));
+    }
+  }
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_RECORDER_HEADER
@@ -0,0 +1,562 @@
+#ifndef CENTURION_EVENT_SIGNAL_HEADER
+#define CENTURION_EVENT_SIGNAL_HEADER
+
+#include <algorithm>    // stable_sort
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <functional>   // invoke
+#include <type_traits>  // decay_t, is_same_v, invoke_result_t, ...
+#include <utility>      // forward, move
+#include <vector>       // vector
+
+#include "../core/delegate.hpp"
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \struct event_connection
+ *
+ * \brief A handle to a handler that is connected to an `event_signal`.
+ *
+ * \details Connections are small values that can be copied freely. A connection that
+ * refers to a disconnected handler is simply ignored by the signal.
+ *
+ * \since 6.1.0
+ */
+struct event_connection final
+{
+  u32 index{};       ///< The index of the slot of the connection.
+  u32 generation{};  ///< The generation of the slot, zero for invalid connections.
+
+  /**
+   * \brief Indicates whether or not the connection was obtained from a signal.
+   *
+   * \note This doesn't indicate whether or not the handler is still connected, see
+   * `event_signal::is_connected()`.
+   *
+   * \return `true` if the connection isn't default constructed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return generation != 0;
+  }
+
+  [[nodiscard]] auto operator==(const event_connection& other) const noexcept -> bool
+  {
+    return index == other.index && generation == other.generation;
+  }
+
+  [[nodiscard]] auto operator!=(const event_connection& other) const noexcept -> bool
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * \class event_signal
+ *
+ * \brief Invokes multiple handlers for an event, ordered by priority.
+ *
+ * \details Handlers with higher priorities are invoked first, and handlers with the same
+ * priority are invoked in the order that they were connected. A handler can stop the
+ * propagation of an event by returning `true`, which marks the event as consumed, e.g.
+ * so that a click on a user interface element doesn't reach the gameplay layer. Handlers
+ * that return `void` never consume events.
+ * \code{cpp}
+ *   cen::event_signal<cen::mouse_button_event> signal;
+ *
+ *   const auto ui = signal.connect(
+ *       [&](const cen::mouse_button_event& event) { return menu.handle(event); },
+ *       100);
+ *
+ *   signal.connect([&](const cen::mouse_button_event& event) { game.handle(event); });
+ *
+ *   signal.disconnect(ui);
+ * \endcode
+ *
+ * \details The handlers are stored contiguously, in a vector that is sorted whenever
+ * the order has changed, so no memory is allocated per handler apart from the storage
+ * of callables that don't fit in a `delegate`. Connecting and disconnecting handlers
+ * are constant time operations, and handlers may be connected and disconnected while an
+ * event is being emitted, in which case the changes take effect for the next event.
+ *
+ * \tparam E the event type, e.g. `window_event`.
+ *
+ * \see `event_sink`
+ *
+ * \since 6.1.0
+ */
+template <typename E>
+class event_signal final
+{
+ public:
+  using event_type = std::decay_t<E>;              ///< Associated event type.
+  using signature_type = bool(const event_type&);  ///< Signature of stored handlers.
+  using function_type = delegate<signature_type>;  ///< Stores the handlers.
+  using size_type = std::size_t;
+
+  /**
+   * \brief Connects a function object.
+   *
+   * \tparam T the type of the function object, which must return `bool` or `void`.
+   *
+   * \param callable the callable that will be invoked when an event is emitted.
+   * \param priority the priority of the handler, higher priorities are invoked first.
+   *
+   * \return a handle that can be used to disconnect the handler.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto connect(T&& callable, const int priority = 0) -> event_connection
+  {
+    static_assert(std::is_invocable_v<std::decay_t<T>&, const event_type&>,
+                  "Callable must be invocable with the event!");
+
+    using result_type = std::invoke_result_t<std::decay_t<T>&, const event_type&>;
+
+    if constexpr (std::is_void_v<result_type>)
+    {
+      return add(function_type{[function = std::forward<T>(callable)](
+                                   const event_type& event) mutable {
+                   function(event);
+                   return false;
+                 }},
+                 priority);
+    }
+    else
+    {
+      static_assert(std::is_same_v<result_type, bool>,
+                    "Callable must return either bool or void!");
+      return add(function_type{std::forward<T>(callable)}, priority);
+    }
+  }
+
+  /**
+   * \brief Connects a member function.
+   *
+   * \note The signal does *not* take ownership of the supplied pointer.
+   *
+   * \tparam memberFunc a pointer to a member function, which must return `bool` or
+   * `void`.
+   * \tparam Self the type of the object that owns the function.
+   *
+   * \param self a pointer to the object that will handle the event.
+   * \param priority the priority of the handler, higher priorities are invoked first.
+   *
+   * \return a handle that can be used to disconnect the handler.
+   *
+   * \since 6.1.0
+   */
+  template <auto memberFunc, typename Self>
+  auto connect(Self* self, const int priority = 0) -> event_connection
+  {
+    static_assert(std::is_member_function_pointer_v<decltype(memberFunc)>,
+                  "\"memberFunc\" must be member function pointer!");
+    static_assert(std::is_invocable_v<decltype(memberFunc), Self*, const event_type&>,
+                  "Member function must be invocable with the event!");
+
+    using result_type =
+        std::invoke_result_t<decltype(memberFunc), Self*, const event_type&>;
+
+    if constexpr (std::is_void_v<result_type>)
+    {
+      return connect(
+          [self](const event_type& event) { std::invoke(memberFunc, self, event); },
+          priority);
+    }
+    else
+    {
+      return add(function_type::template from<memberFunc>(self), priority);
+    }
+  }
+
+  /**
+   * \brief Connects a free function.
+   *
+   * \tparam function a function pointer, the function must return `bool` or `void`.
+   *
+   * \param priority the priority of the handler, higher priorities are invoked first.
+   *
+   * \return a handle that can be used to disconnect the handler.
+   *
+   * \since 6.1.0
+   */
+  template <auto function>
+  auto connect(const int priority = 0) -> event_connection
+  {
+    using result_type = std::invoke_result_t<decltype(function), const event_type&>;
+
+    if constexpr (std::is_void_v<result_type>)
+    {
+      return connect([](const event_type& event) { std::invoke(function, event); },
+                     priority);
+    }
+    else
+    {
+      return add(function_type::template from<function>(), priority);
+    }
+  }
+
+  /**
+   * \brief Disconnects a handler.
+   *
+   * \param connection the handle of the handler that will be disconnected.
+   *
+   * \return `true` if the handler was disconnected; `false` if it wasn't connected.
+   *
+   * \since 6.1.0
+   */
+  auto disconnect(const event_connection connection) noexcept -> bool
+  {
+    if (!is_connected(connection))
+    {
+      return false;
+    }
+
+    const auto& slot = m_slots[connection.index];
+
+    if (slot.entry != npos)
+    {
+      // The entry is removed when the signal is compacted, which keeps the order intact
+      m_entries[slot.entry].connected = false;
+      ++m_dead;
+    }
+    else
+    {
+      // The handler was connected during emission, and hasn't been flushed yet
+      for (auto& e : m_added)
+      {
+        if (e.slot == connection.index)
+        {
+          e.connected = false;
+          break;
+        }
+      }
+    }
+
+    release(connection.index);
+    return true;
+  }
+
+  /**
+   * \brief Disconnects all handlers.
+   *
+   * \details All previously obtained connections become invalid.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    for (auto& e : m_entries)
+    {
+      if (e.connected)
+      {
+        e.connected = false;
+        ++m_dead;
+
+        release(e.slot);
+      }
+    }
+
+    for (auto& e : m_added)
+    {
+      if (e.connected)
+      {
+        e.connected = false;
+        release(e.slot);
+      }
+    }
+
+    if (!is_emitting())
+    {
+      compact();
+    }
+  }
+
+  /**
+   * \brief Invokes the connected handlers with an event.
+   *
+   * \details The handlers are invoked in order of priority, until a handler consumes the
+   * event.
+   *
+   * \param event the event that will be passed to the handlers.
+   *
+   * \return `true` if a handler consumed the event; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto emit(const event_type& event) -> bool
+  {
+    if (!is_emitting())
+    {
+      compact();
+      sort();
+    }
+
+    const emit_scope scope{*this};
+
+    // The amount of entries is fixed during emission, see add()
+    const auto count = m_entries.size();
+    for (size_type index = 0; index < count; ++index)
+    {
+      // Disconnected handlers are destroyed later, since they might be running
+      if (const auto& e = m_entries[index]; e.connected && e.function(event))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * \brief Indicates whether or not a handler is connected.
+   *
+   * \param connection the handle of the handler.
+   *
+   * \return `true` if the handler is connected; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_connected(const event_connection connection) const noexcept
+      -> bool
+  {
+    return connection && connection.index < m_slots.size() &&
+           m_slots[connection.index].generation == connection.generation;
+  }
+
+  /**
+   * \brief Returns the amount of connected handlers.
+   *
+   * \return the amount of connected handlers.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_live;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return size() == 0;
+  }
+
+ private:
+  struct entry final
+  {
+    function_type function;
+    int priority{};
+    u32 slot{};
+    u64 sequence{};  // Preserves the connection order of handlers with equal priority
+    bool connected{true};
+  };
+
+  struct slot final
+  {
+    size_type entry{};
+    u32 generation{1};
+  };
+
+  struct emit_scope final
+  {
+    explicit emit_scope(event_signal& signal) noexcept : signal{signal}
+    {
+      ++signal.m_emitting;
+    }
+
+    ~emit_scope() noexcept
+    {
+      if (--signal.m_emitting == 0)
+      {
+        signal.flush_added();
+      }
+    }
+
+    event_signal& signal;
+  };
+
+  std::vector<entry> m_entries;  // Sorted by priority, unless m_sorted is false
+  std::vector<entry> m_added;    // Entries connected during emission
+  std::vector<slot> m_slots;
+  std::vector<u32> m_free;  // Indices of unused slots
+  size_type m_dead{};       // The amount of disconnected entries in m_entries
+  size_type m_live{};       // The amount of connected handlers
+  u64 m_sequence{};
+  int m_emitting{};
+  bool m_sorted{true};
+
+  [[nodiscard]] static auto precedes(const entry& a, const entry& b) noexcept -> bool
+  {
+    return (a.priority != b.priority) ? a.priority > b.priority : a.sequence < b.sequence;
+  }
+
+  [[nodiscard]] auto is_emitting() const noexcept -> bool
+  {
+    return m_emitting != 0;
+  }
+
+  auto add(function_type function, const int priority) -> event_connection
+  {
+    assert(function);
+
+    u32 index{};
+    if (m_free.empty())
+    {
+      index = static_cast<u32>(m_slots.size());
+      m_slots.emplace_back();
+    }
+    else
+    {
+      index = m_free.back();
+      m_free.pop_back();
+    }
+
+    entry e{std::move(function), priority, index, m_sequence++};
+
+    /* Entries can't be added to m_entries during emission, since that could relocate the
+       delegate that is currently being invoked. Those entries are stored separately and
+       are moved to m_entries once the emission has finished. */
+    auto& target = is_emitting() ? m_added : m_entries;
+
+    try
+    {
+      target.push_back(std::move(e));
+    }
+    catch (...)
+    {
+      m_free.push_back(index);
+      throw;
+    }
+
+    if (!is_emitting())
+    {
+      on_appended();
+    }
+
+    auto& slot = m_slots[index];
+    slot.entry = is_emitting() ? npos : m_entries.size() - 1u;
+    ++m_live;
+
+    return event_connection{index, slot.generation};
+  }
+
+  void on_appended() noexcept
+  {
+    const auto size = m_entries.size();
+    if (size > 1u && precedes(m_entries[size - 1u], m_entries[size - 2u]))
+    {
+      m_sorted = false;
+    }
+  }
+
+  void release(const u32 index) noexcept
+  {
+    auto& slot = m_slots[index];
+    slot.entry = npos;
+    --m_live;
+
+    ++slot.generation;
+    if (slot.generation == 0)
+    {
+      slot.generation = 1;  // Zero is reserved for invalid connections
+    }
+
+    try
+    {
+      m_free.push_back(index);
+    }
+    catch (...)
+    {
+      // The slot is simply never reused if it can't be stored
+    }
+  }
+
+  void flush_added() noexcept
+  {
+    compact();
+
+    for (auto& e : m_added)
+    {
+      // Entries disconnected during emission have already released their slots
+      if (!e.connected)
+      {
+        continue;
+      }
+
+      try
+      {
+        m_entries.push_back(std::move(e));
+        m_slots[m_entries.back().slot].entry = m_entries.size() - 1u;
+        on_appended();
+      }
+      catch (...)
+      {
+        // The handler is disconnected if there's no room for it
+        release(e.slot);
+      }
+    }
+
+    m_added.clear();
+  }
+
+  // Removes disconnected entries, without changing the order of the remaining entries
+  void compact() noexcept
+  {
+    if (m_dead == 0)
+    {
+      return;
+    }
+
+    size_type size = 0;
+    for (size_type index = 0; index < m_entries.size(); ++index)
+    {
+      if (m_entries[index].connected)
+      {
+        if (size != index)
+        {
+          m_entries[size] = std::move(m_entries[index]);
+        }
+
+        m_slots[m_entries[size].slot].entry = size;
+        ++size;
+      }
+    }
+
+    m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(size),
+                    m_entries.end());
+    m_dead = 0;
+  }
+
+  void sort()
+  {
+    if (m_sorted)
+    {
+      return;
+    }
+
+    std::stable_sort(m_entries.begin(), m_entries.end(), &precedes);
+
+    for (size_type index = 0; index < m_entries.size(); ++index)
+    {
+      m_slots[m_entries[index].slot].entry = index;
+    }
+
+    m_sorted = true;
+  }
+
+  inline static constexpr size_type npos = static_cast<size_type>(-1);
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_EVENT_SIGNAL_HEADER
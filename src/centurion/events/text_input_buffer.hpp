@@ -0,0 +1,333 @@
+#ifndef CENTURION_TEXT_INPUT_BUFFER_HEADER
+#define CENTURION_TEXT_INPUT_BUFFER_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>    // find
+#include <array>        // array
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <optional>     // optional
+#include <string>       // string
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// The text of text events is null-terminated, unless it fills the entire array
+template <std::size_t N>
+[[nodiscard]] auto event_text(const char (&text)[N]) noexcept -> std::string_view
+{
+  const auto* end = std::find(text, text + N, '\0');
+  return std::string_view{text, static_cast<std::size_t>(end - text)};
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup event
+/// \{
+
+/**
+ * \class text_input_buffer
+ *
+ * \brief Accumulates text input and IME composition text from text events.
+ *
+ * \details SDL delivers typed text in many small `SDL_TEXTINPUT` events, each holding a
+ * few bytes of UTF-8. Instead of handling every event individually, a text input buffer
+ * appends the committed text of all text input events to a single growable buffer, which
+ * the UI consumes once per frame. The buffer also keeps track of the current composition
+ * of the input method editor (IME), which is reported by `SDL_TEXTEDITING` events.
+ * \code{cpp}
+ *   cen::text_input_buffer input;
+ *
+ *   // Every frame
+ *   input.collect();
+ *   if (!input.text().empty())
+ *   {
+ *     chat_box.insert(input.text());
+ *     input.clear();
+ *   }
+ *
+ *   chat_box.set_preedit(input.composition(), input.composition_cursor());
+ * \endcode
+ *
+ * \details The buffer retains its capacity when it's cleared, so after a short warm-up
+ * accumulating text doesn't allocate any memory.
+ *
+ * \see `SDL_StartTextInput`
+ *
+ * \since 6.1.0
+ */
+class text_input_buffer final
+{
+ public:
+  using size_type = std::size_t;
+
+  text_input_buffer() = default;
+
+  /**
+   * \brief Creates a buffer with preallocated storage for the committed text.
+   *
+   * \param capacity the amount of bytes of text to reserve storage for.
+   *
+   * \since 6.1.0
+   */
+  explicit text_input_buffer(const size_type capacity)
+  {
+    reserve(capacity);
+  }
+
+  /// \name Input
+  /// \{
+
+  /**
+   * \brief Updates the buffer with an event.
+   *
+   * \details Text input events append their text to the committed text, and text editing
+   * events replace the current composition. Other events are ignored.
+   *
+   * \param event the event that will be handled.
+   *
+   * \return `true` if the event was a text event; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto feed(const SDL_Event& event) -> bool
+  {
+    if (event.type == SDL_TEXTINPUT)
+    {
+      m_text += detail::event_text(event.text.text);
+
+      // The composition is committed, or cancelled, when text is entered
+      m_composition.clear();
+      m_cursor = 0;
+      m_selection = 0;
+
+      return true;
+    }
+    else if (event.type == SDL_TEXTEDITING)
+    {
+      m_composition.assign(detail::event_text(event.edit.text));
+      m_cursor = event.edit.start;
+      m_selection = event.edit.length;
+
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Updates the buffer with a sequence of events.
+   *
+   * \details This is intended to be used with events obtained in batches, e.g. with
+   * `event::drain()`.
+   *
+   * \param events the events that will be handled.
+   * \param count the amount of events.
+   *
+   * \return the amount of text events in the sequence.
+   *
+   * \since 6.1.0
+   */
+  auto feed(const SDL_Event* events, const int count) -> int
+  {
+    assert(events || count == 0);
+
+    int handled = 0;
+    for (int index = 0; index < count; ++index)
+    {
+      if (feed(events[index]))
+      {
+        ++handled;
+      }
+    }
+
+    return handled;
+  }
+
+  /**
+   * \brief Moves all text events from the event queue into the buffer.
+   *
+   * \details Only text input and text editing events are removed from the event queue,
+   * with a single call to `SDL_PeepEvents()` per batch of events. Other events are left
+   * in the queue, in their original order.
+   *
+   * \note This function doesn't update the event loop, which is usually done by the
+   * event polling of the application.
+   *
+   * \return the amount of handled text events; `std::nullopt` if something goes wrong.
+   *
+   * \see `SDL_PeepEvents`
+   *
+   * \since 6.1.0
+   */
+  auto collect() -> std::optional<int>
+  {
+    std::array<SDL_Event, 32> events;  // NOLINT
+
+    int total = 0;
+    while (true)
+    {
+      const auto count = SDL_PeepEvents(events.data(),
+                                        static_cast<int>(events.size()),
+                                        SDL_GETEVENT,
+                                        SDL_TEXTEDITING,
+                                        SDL_TEXTINPUT);
+      if (count == -1)
+      {
+        return std::nullopt;
+      }
+
+      total += feed(events.data(), count);
+
+      if (count < static_cast<int>(events.size()))
+      {
+        return total;
+      }
+    }
+  }
+
+  /// \} End of input
+
+  /// \name Committed text
+  /// \{
+
+  /**
+   * \brief Returns the text that has been entered since the buffer was last cleared.
+   *
+   * \details The returned view is invalidated by any function that modifies the buffer.
+   *
+   * \return the committed text, in UTF-8 encoding.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto text() const noexcept -> std::string_view
+  {
+    return m_text;
+  }
+
+  /**
+   * \brief Indicates whether or not any text has been entered since the buffer was last
+   * cleared.
+   *
+   * \return `true` if there is no committed text; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_text.empty();
+  }
+
+  /**
+   * \brief Removes the committed text, without affecting the composition.
+   *
+   * \details The storage of the buffer is retained.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_text.clear();
+  }
+
+  /**
+   * \brief Reserves storage for the committed text.
+   *
+   * \param capacity the amount of bytes of text to reserve storage for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_text.reserve(capacity);
+  }
+
+  /**
+   * \brief Returns the amount of bytes of text that can be stored without allocating.
+   *
+   * \return the capacity of the committed text buffer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_text.capacity();
+  }
+
+  /// \} End of committed text
+
+  /// \name Composition
+  /// \{
+
+  /**
+   * \brief Returns the text that is currently being composed with the IME.
+   *
+   * \return the composition text, in UTF-8 encoding; an empty string if there is no
+   * ongoing composition.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto composition() const noexcept -> std::string_view
+  {
+    return m_composition;
+  }
+
+  /**
+   * \brief Returns the position of the cursor in the composition.
+   *
+   * \return the cursor position, in characters.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto composition_cursor() const noexcept -> i32
+  {
+    return m_cursor;
+  }
+
+  /**
+   * \brief Returns the length of the selection in the composition.
+   *
+   * \return the amount of selected characters after the cursor.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto composition_length() const noexcept -> i32
+  {
+    return m_selection;
+  }
+
+  /**
+   * \brief Indicates whether or not there is an ongoing composition.
+   *
+   * \return `true` if the composition isn't empty; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_composing() const noexcept -> bool
+  {
+    return !m_composition.empty();
+  }
+
+  /// \} End of composition
+
+ private:
+  std::string m_text;
+  std::string m_composition;
+  i32 m_cursor{};
+  i32 m_selection{};
+};
+
+/// \} End of group event
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXT_INPUT_BUFFER_HEADER
@@ -0,0 +1,29 @@
+#ifndef CENTURION_FILESYSTEM_SUBSYSTEM_HEADER
+#define CENTURION_FILESYSTEM_SUBSYSTEM_HEADER
+
+/**
+ * \file filesystem.hpp
+ *
+ * \brief Includes all headers of the filesystem subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "filesystem/asset_pack.hpp"
+#include "filesystem/async_file_io.hpp"
+#include "filesystem/base_path.hpp"
+#include "filesystem/buffered_file.hpp"
+#include "filesystem/compressed_file.hpp"
+#include "filesystem/directory_watcher.hpp"
+#include "filesystem/file.hpp"
+#include "filesystem/image_format.hpp"
+#include "filesystem/join_path.hpp"
+#include "filesystem/mapped_file.hpp"
+#include "filesystem/path_cache.hpp"
+#include "filesystem/preferred_path.hpp"
+#include "filesystem/read_ahead_file.hpp"
+
+#endif  // CENTURION_FILESYSTEM_SUBSYSTEM_HEADER
@@ -0,0 +1,584 @@
+#ifndef CENTURION_ASSET_PACK_HEADER
+#define CENTURION_ASSET_PACK_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>      // sort
+#include <cstddef>        // size_t, byte
+#include <cstring>        // memcmp
+#include <optional>       // optional
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_set>  // unordered_set
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../core/result.hpp"
+#include "../detail/asset_pack_format.hpp"
+#include "file.hpp"
+#include "mapped_file.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct asset_entry
+ *
+ * \brief A view of an entry in an asset pack.
+ *
+ * \details The data refers to the memory of the pack, so it is only valid as long as the
+ * pack is alive.
+ *
+ * \since 6.1.0
+ */
+struct asset_entry final
+{
+  czstring name{};          ///< The null-terminated name of the entry.
+  const std::byte* data{};  ///< The bytes of the entry.
+  std::size_t size{};       ///< The amount of bytes of the entry.
+};
+
+/**
+ * \class asset_pack
+ *
+ * \brief Provides access to the entries of an asset pack, without copying them.
+ *
+ * \details An asset pack is a single file that contains many assets, along with an index
+ * of their names. The pack is memory-mapped, so opening it is a single file open no
+ * matter how many entries it holds, and entries are paged in when they are accessed.
+ * Looking up an entry is a binary search over the hashes of the entry names.
+ * \code{cpp}
+ *   const cen::asset_pack pack{"assets.pak"};
+ *
+ *   auto file = pack.open("sprites/player.png");
+ *   cen::surface player{IMG_Load_RW(file.get(), 0)};
+ * \endcode
+ *
+ * \since 6.1.0
+ *
+ * \see `asset_pack_writer`
+ * \see `mapped_file`
+ */
+class asset_pack final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Opens an asset pack.
+   *
+   * \param path the path of the asset pack.
+   *
+   * \throws cen_error if the file couldn't be mapped, or if it isn't a valid asset pack.
+   *
+   * \since 6.1.0
+   */
+  explicit asset_pack(const not_null<czstring> path) : m_file{path}
+  {
+    validate();
+  }
+
+  /// \copydoc asset_pack(not_null<czstring>)
+  explicit asset_pack(const std::string& path) : asset_pack{path.c_str()}
+  {}
+
+  /**
+   * \brief Opens an asset pack that has already been mapped into memory.
+   *
+   * \details This is used to read asset packs that aren't regular files, such as assets
+   * in an Android APK, which can be mapped with `mapped_file::from_android_asset()`.
+   *
+   * \param file the mapped asset pack.
+   *
+   * \throws cen_error if the file isn't a valid asset pack.
+   *
+   * \since 6.1.0
+   */
+  explicit asset_pack(mapped_file file) : m_file{std::move(file)}
+  {
+    validate();
+  }
+
+  /**
+   * \brief Looks up an entry by name.
+   *
+   * \param name the name of the entry.
+   *
+   * \return the entry; `std::nullopt` if there is no entry with the name.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find(const std::string_view name) const noexcept
+      -> std::optional<asset_entry>
+  {
+    const auto hash = detail::asset_name_hash(name);
+
+    // Lower bound of the hash, there are usually no collisions
+    size_type first = 0;
+    size_type count = m_count;
+    while (count > 0)
+    {
+      const auto step = count / 2u;
+      if (hash_at(first + step) < hash)
+      {
+        first += step + 1u;
+        count -= step + 1u;
+      }
+      else
+      {
+        count = step;
+      }
+    }
+
+    for (auto index = first; index < m_count && hash_at(index) == hash; ++index)
+    {
+      const auto entry = at(index);
+      if (name == std::string_view{entry.name})
+      {
+        return entry;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /**
+   * \brief Indicates whether or not the pack has an entry with the specified name.
+   *
+   * \param name the name of the entry.
+   *
+   * \return `true` if there is an entry with the name; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const std::string_view name) const noexcept -> bool
+  {
+    return find(name).has_value();
+  }
+
+  /**
+   * \brief Opens an entry as a read-only file, without copying it.
+   *
+   * \details The returned file can be used with the `SDL_RWops` based loading functions,
+   * and must not outlive the pack.
+   *
+   * \param name the name of the entry.
+   *
+   * \return a file that reads the bytes of the entry.
+   *
+   * \throws cen_error if there is no entry with the name.
+   * \throws sdl_error if the file couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto open(const std::string_view name) const -> file
+  {
+    const auto entry = find(name);
+    if (!entry)
+    {
+      throw cen_error{"There is no asset pack entry with the specified name!"};
+    }
+
+    return m_file.open(static_cast<size_type>(entry->data - m_file.data()), entry->size);
+  }
+
+  /**
+   * \brief Returns the entry at an index, in the order of the index.
+   *
+   * \pre the index must be smaller than `size()`.
+   *
+   * \param index the index of the entry.
+   *
+   * \return the entry at the index.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto at(const size_type index) const noexcept -> asset_entry
+  {
+    const auto* record = index_record(index);
+
+    const auto offset = detail::load_little_endian<u64>(record + 8);
+    const auto size = detail::load_little_endian<u64>(record + 16);
+    const auto name = detail::load_little_endian<u32>(record + 24);
+
+    asset_entry entry;
+    entry.name = reinterpret_cast<czstring>(m_names + name);
+    entry.data = m_file.data() + offset;
+    entry.size = static_cast<size_type>(size);
+
+    return entry;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of entries in the pack.
+   *
+   * \return the amount of entries.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Indicates whether or not the pack has no entries.
+   *
+   * \return `true` if there are no entries; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_count == 0;
+  }
+
+  /// \} End of queries
+
+ private:
+  mapped_file m_file;
+  const std::byte* m_index{};
+  const std::byte* m_names{};
+  size_type m_count{};
+
+  [[nodiscard]] auto index_record(const size_type index) const noexcept
+      -> const std::byte*
+  {
+    return m_index + index * detail::asset_pack_index_entry_size;
+  }
+
+  [[nodiscard]] auto hash_at(const size_type index) const noexcept -> u64
+  {
+    return detail::load_little_endian<u64>(index_record(index));
+  }
+
+  // Checks the header and the index once, so that lookups don't need to
+  void validate()
+  {
+    const auto* data = m_file.data();
+    const auto fileSize = static_cast<u64>(m_file.size());
+
+    if (fileSize < detail::asset_pack_header_size ||
+        std::memcmp(data, detail::asset_pack_magic, sizeof detail::asset_pack_magic) != 0)
+    {
+      throw cen_error{"The file isn't an asset pack!"};
+    }
+
+    if (detail::load_little_endian<u32>(data + 8) != detail::asset_pack_version)
+    {
+      throw cen_error{"Unsupported asset pack version!"};
+    }
+
+    const auto count = detail::load_little_endian<u32>(data + 12);
+    const auto indexOffset = detail::load_little_endian<u64>(data + 24);
+    const auto indexSize = u64{count} * detail::asset_pack_index_entry_size;
+
+    if (indexOffset > fileSize || indexSize > fileSize - indexOffset)
+    {
+      throw cen_error{"The asset pack index is corrupt!"};
+    }
+
+    m_count = count;
+    m_index = data + indexOffset;
+    m_names = m_index + indexSize;
+
+    const auto namesSize = fileSize - indexOffset - indexSize;
+    for (size_type index = 0; index < m_count; ++index)
+    {
+      const auto* record = index_record(index);
+
+      const auto offset = detail::load_little_endian<u64>(record + 8);
+      const auto size = detail::load_little_endian<u64>(record + 16);
+      const auto name = u64{detail::load_little_endian<u32>(record + 24)};
+      const auto nameSize = u64{detail::load_little_endian<u32>(record + 28)};
+
+      if (offset > fileSize || size > fileSize - offset || name + nameSize >= namesSize ||
+          m_names[name + nameSize] != std::byte{0})
+      {
+        throw cen_error{"The asset pack index is corrupt!"};
+      }
+    }
+  }
+};
+
+/**
+ * \class asset_pack_writer
+ *
+ * \brief Creates asset packs.
+ *
+ * \details The data of the entries is written to the file as the entries are added, and
+ * the index is written by `finish()`, or when the writer is destroyed.
+ * \code{cpp}
+ *   cen::asset_pack_writer writer{"assets.pak"};
+ *
+ *   writer.add_file("sprites/player.png", "resources/player.png");
+ *   writer.add_file("fonts/ui.ttf", "resources/ui.ttf");
+ *
+ *   if (!writer.finish()) {
+ *     // Failed to write the pack
+ *   }
+ * \endcode
+ *
+ * \since 6.1.0
+ *
+ * \see `asset_pack`
+ */
+class asset_pack_writer final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an asset pack file.
+   *
+   * \param path the path of the asset pack, an existing file is replaced.
+   * \param alignment the alignment of the data of each entry, in bytes.
+   *
+   * \throws cen_error if the alignment isn't a power of two, or if the file couldn't be
+   * created.
+   *
+   * \since 6.1.0
+   */
+  explicit asset_pack_writer(const not_null<czstring> path, const u32 alignment = 16)
+      : m_file{path, file_mode::write_binary}
+      , m_alignment{alignment}
+  {
+    if (alignment == 0 || (alignment & (alignment - 1u)) != 0)
+    {
+      throw cen_error{"The alignment of asset pack entries must be a power of two!"};
+    }
+
+    if (!m_file)
+    {
+      throw cen_error{"Failed to create asset pack!"};
+    }
+
+    // The header is written once the index offset is known
+    const u8 header[detail::asset_pack_header_size]{};
+    if (m_file.write(header) != sizeof header)
+    {
+      m_failed = true;
+    }
+
+    m_offset = sizeof header;
+  }
+
+  /// \copydoc asset_pack_writer(not_null<czstring>, u32)
+  explicit asset_pack_writer(const std::string& path, const u32 alignment = 16)
+      : asset_pack_writer{path.c_str(), alignment}
+  {}
+
+  asset_pack_writer(const asset_pack_writer&) = delete;
+
+  auto operator=(const asset_pack_writer&) -> asset_pack_writer& = delete;
+
+  /**
+   * \brief Writes the index, unless `finish()` has already been called.
+   */
+  ~asset_pack_writer() noexcept
+  {
+    if (!m_finished)
+    {
+      finish();
+    }
+  }
+
+  /**
+   * \brief Adds an entry to the pack.
+   *
+   * \param name the unique name of the entry.
+   * \param data the bytes of the entry.
+   * \param size the amount of bytes.
+   *
+   * \return `success` if the entry was written; `failure` if the name is already used,
+   * the pack has been finished, or if something went wrong.
+   *
+   * \since 6.1.0
+   */
+  auto add(const std::string_view name, const void* data, const size_type size) -> result
+  {
+    if (m_finished || m_failed || !m_names.emplace(name).second)
+    {
+      return failure;
+    }
+
+    // Pad the previous entry, so that the data starts at a multiple of the alignment
+    const auto padding = (m_alignment - m_offset % m_alignment) % m_alignment;
+    if (padding != 0)
+    {
+      const std::vector<u8> zeros(padding);
+      if (m_file.write(zeros) != padding)
+      {
+        m_failed = true;
+        return failure;
+      }
+
+      m_offset += padding;
+    }
+
+    if (size != 0 && m_file.write(static_cast<const u8*>(data), size) != size)
+    {
+      m_failed = true;
+      return failure;
+    }
+
+    const auto hash = detail::asset_name_hash(name);
+    m_entries.push_back({hash, m_offset, size, std::string{name}});
+    m_offset += size;
+
+    return success;
+  }
+
+  /**
+   * \brief Adds the contents of a file as an entry of the pack.
+   *
+   * \param name the unique name of the entry.
+   * \param path the path of the file that will be added.
+   *
+   * \return `success` if the entry was written; `failure` if the file couldn't be read,
+   * the name is already used, the pack has been finished, or if something went wrong.
+   *
+   * \since 6.1.0
+   */
+  auto add_file(const std::string_view name, const not_null<czstring> path) -> result
+  {
+    file input{path, file_mode::read_existing_binary};
+    if (!input)
+    {
+      return failure;
+    }
+
+    const auto size = input.size();
+    if (!size)
+    {
+      return failure;
+    }
+
+    m_buffer.resize(*size);
+    if (input.read_to(m_buffer) != m_buffer.size())
+    {
+      return failure;
+    }
+
+    return add(name, m_buffer.data(), m_buffer.size());
+  }
+
+  /// \copydoc add_file()
+  auto add_file(const std::string_view name, const std::string& path) -> result
+  {
+    return add_file(name, path.c_str());
+  }
+
+  /**
+   * \brief Writes the index and completes the pack.
+   *
+   * \details No entries can be added once the pack has been finished.
+   *
+   * \return `success` if the pack was completed; `failure` if something went wrong.
+   *
+   * \since 6.1.0
+   */
+  auto finish() noexcept -> result
+  {
+    if (m_finished || m_failed)
+    {
+      return failure;
+    }
+
+    m_finished = true;
+
+    try
+    {
+      std::sort(m_entries.begin(), m_entries.end(), [](const entry& a, const entry& b) {
+        return (a.hash != b.hash) ? a.hash < b.hash : a.name < b.name;
+      });
+
+      std::vector<u8> index(m_entries.size() * detail::asset_pack_index_entry_size);
+      std::vector<u8> names;
+
+      for (size_type i = 0; i < m_entries.size(); ++i)
+      {
+        const auto& e = m_entries[i];
+        auto* record = index.data() + i * detail::asset_pack_index_entry_size;
+
+        detail::store_little_endian<u64>(record, e.hash);
+        detail::store_little_endian<u64>(record + 8, e.offset);
+        detail::store_little_endian<u64>(record + 16, e.size);
+        detail::store_little_endian<u32>(record + 24, static_cast<u32>(names.size()));
+        detail::store_little_endian<u32>(record + 28, static_cast<u32>(e.name.size()));
+
+        names.insert(names.end(), e.name.begin(), e.name.end());
+        names.push_back(0);
+      }
+
+      u8 header[detail::asset_pack_header_size]{};
+      for (size_type i = 0; i < sizeof detail::asset_pack_magic; ++i)
+      {
+        header[i] = static_cast<u8>(detail::asset_pack_magic[i]);
+      }
+
+      detail::store_little_endian<u32>(header + 8, detail::asset_pack_version);
+      detail::store_little_endian<u32>(header + 12, static_cast<u32>(m_entries.size()));
+      detail::store_little_endian<u32>(header + 16, m_alignment);
+      detail::store_little_endian<u64>(header + 24, m_offset);
+
+      return m_file.write(index) == index.size() && m_file.write(names) == names.size() &&
+             m_file.seek(0, seek_mode::from_beginning) &&
+             m_file.write(header) == sizeof header;
+    }
+    catch (...)
+    {
+      return failure;
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of entries that have been added.
+   *
+   * \return the amount of entries.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_entries.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct entry final
+  {
+    u64 hash{};
+    u64 offset{};
+    u64 size{};
+    std::string name;
+  };
+
+  file m_file;
+  std::vector<entry> m_entries;
+  std::unordered_set<std::string> m_names;
+  std::vector<u8> m_buffer;
+  u64 m_offset{};
+  u32 m_alignment{};
+  bool m_finished{};
+  bool m_failed{};
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_ASSET_PACK_HEADER
@@ -0,0 +1,398 @@
+#ifndef CENTURION_ASYNC_FILE_IO_HEADER
+#define CENTURION_ASYNC_FILE_IO_HEADER
+
+#include <SDL.h>
+
+#include <atomic>   // atomic, memory_order_...
+#include <cassert>  // assert
+#include <cstddef>  // size_t, byte
+#include <memory>   // unique_ptr, make_unique
+#include <string>   // string
+#include <utility>  // move, forward
+#include <vector>   // vector
+
+#include "../detail/spin_backoff.hpp"
+#include "../events/event_channel.hpp"
+#include "../thread/thread_pool.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \enum file_operation
+ *
+ * \brief Provides values that represent the kinds of asynchronous file operations.
+ *
+ * \see `async_file_io`
+ *
+ * \since 6.1.0
+ */
+enum class file_operation
+{
+  read,   ///< The contents of a file are read.
+  write,  ///< The contents of a file are replaced.
+  append  ///< Data is appended to a file, which is created if it doesn't exist.
+};
+
+/**
+ * \struct file_completion
+ *
+ * \brief Describes the outcome of an asynchronous file operation.
+ *
+ * \see `async_file_io`
+ *
+ * \since 6.1.0
+ */
+struct file_completion final
+{
+  using id_type = std::size_t;
+
+  id_type id{};                 ///< The identifier of the operation.
+  file_operation operation{};   ///< The kind of operation.
+  bool succeeded{};             ///< Indicates whether or not the operation succeeded.
+  std::string path;             ///< The path of the file.
+  std::vector<std::byte> data;  ///< The read bytes, or the written bytes for reuse.
+};
+
+/**
+ * \class async_file_io
+ *
+ * \brief Reads and writes files on a thread pool, without blocking the calling thread.
+ *
+ * \details Operations are executed as tasks on a `thread_pool`, using the blocking `file`
+ * API. When an operation has finished, a `file_completion` is sent through an
+ * `event_channel`, which is drained on the thread that queued the operation, either by
+ * calling `poll()` or by attaching the channel to an `event_dispatcher`.
+ * \code{cpp}
+ *   cen::thread_pool pool;
+ *   cen::async_file_io io{pool};
+ *
+ *   io.write("save.bin", serialize(world));
+ *
+ *   // Once per frame
+ *   io.poll([](cen::file_completion& completion) {
+ *     if (!completion.succeeded) {
+ *       // ...
+ *     }
+ *   });
+ * \endcode
+ *
+ * \details The buffers are moved into and out of the operations, so neither writing nor
+ * reading copies the data on the calling thread. The buffer of a write operation is
+ * handed back in its completion, which makes it possible to reuse its memory.
+ *
+ * \note Operations that are queued for the same file may be executed in any order, and
+ * even concurrently, so an operation should only be queued for a file once the previous
+ * operation on that file has completed.
+ *
+ * \note If the channel is full, the workers wait for completions to be received before
+ * they send more of them, which ties up the workers of the pool. Therefore, the channel
+ * capacity should be at least the amount of operations that are pending at any time.
+ *
+ * \since 6.1.0
+ */
+class async_file_io final
+{
+ public:
+  using id_type = file_completion::id_type;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an I/O service that executes its operations on a thread pool.
+   *
+   * \param pool the thread pool that will execute the operations, must outlive the
+   * service.
+   * \param capacity the capacity of the completion channel.
+   *
+   * \since 6.1.0
+   */
+  explicit async_file_io(thread_pool& pool, const size_type capacity = 256)
+      : m_pool{&pool}
+      , m_shared{std::make_unique<shared_data>(capacity)}
+  {}
+
+  async_file_io(const async_file_io&) = delete;
+
+  auto operator=(const async_file_io&) -> async_file_io& = delete;
+
+  /**
+   * \brief Waits for all queued operations to finish.
+   *
+   * \details Completions that haven't been received are discarded. Pending tasks of the
+   * pool are executed on the calling thread while waiting.
+   *
+   * \since 6.1.0
+   */
+  ~async_file_io() noexcept
+  {
+    // The workers must not wait for the channel, since nothing will drain it anymore
+    m_shared->discarding.store(true, std::memory_order_release);
+
+    detail::spin_backoff backoff;
+    while (m_shared->outstanding.load(std::memory_order_acquire) != 0)
+    {
+      try
+      {
+        if (!m_pool->run_pending_task())
+        {
+          backoff();
+        }
+      }
+      catch (...)
+      {}
+    }
+
+    m_shared->channel.clear();
+  }
+
+  /// \name Operations
+  /// \{
+
+  /**
+   * \brief Queues an operation that reads the entire contents of a file.
+   *
+   * \param path the path of the file.
+   *
+   * \return the identifier of the operation.
+   *
+   * \since 6.1.0
+   */
+  auto read(std::string path) -> id_type
+  {
+    return queue(file_operation::read, std::move(path), {});
+  }
+
+  /**
+   * \brief Queues an operation that replaces the contents of a file.
+   *
+   * \details The file is created if it doesn't exist.
+   *
+   * \param path the path of the file.
+   * \param data the bytes that will be written to the file.
+   *
+   * \return the identifier of the operation.
+   *
+   * \since 6.1.0
+   */
+  auto write(std::string path, std::vector<std::byte> data) -> id_type
+  {
+    return queue(file_operation::write, std::move(path), std::move(data));
+  }
+
+  /**
+   * \brief Queues an operation that appends data to a file.
+   *
+   * \details The file is created if it doesn't exist.
+   *
+   * \param path the path of the file.
+   * \param data the bytes that will be appended to the file.
+   *
+   * \return the identifier of the operation.
+   *
+   * \since 6.1.0
+   */
+  auto append(std::string path, std::vector<std::byte> data) -> id_type
+  {
+    return queue(file_operation::append, std::move(path), std::move(data));
+  }
+
+  /// \} End of operations
+
+  /**
+   * \brief Invokes a function object with every completion that has been received.
+   *
+   * \pre This function must be called on the thread that queued the operations.
+   *
+   * \tparam Function the type of the function object, invocable with
+   * `file_completion&`.
+   *
+   * \param function the function object that will receive the completions.
+   *
+   * \return the amount of received completions.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  auto poll(Function&& function) -> size_type
+  {
+    return m_shared->channel.drain(std::forward<Function>(function));
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the channel that completions are sent through.
+   *
+   * \details The channel can be attached to an `event_dispatcher`, as an alternative to
+   * calling `poll()`.
+   *
+   * \return the completion channel.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto channel() noexcept -> event_channel<file_completion>&
+  {
+    return m_shared->channel;
+  }
+
+  /**
+   * \brief Returns the amount of operations whose completions haven't been sent yet.
+   *
+   * \return the amount of unfinished operations.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> size_type
+  {
+    return m_shared->outstanding.load(std::memory_order_relaxed);
+  }
+
+  /// \} End of queries
+
+ private:
+  struct shared_data final
+  {
+    explicit shared_data(const size_type capacity) : channel{capacity}
+    {}
+
+    event_channel<file_completion> channel;
+    std::atomic<size_type> outstanding{0};
+    std::atomic<bool> discarding{false};
+  };
+
+  thread_pool* m_pool{};
+  std::unique_ptr<shared_data> m_shared;
+  id_type m_nextId{};
+
+  auto queue(const file_operation operation,
+             std::string path,
+             std::vector<std::byte> data) -> id_type
+  {
+    file_completion completion;
+    completion.id = m_nextId++;
+    completion.operation = operation;
+    completion.path = std::move(path);
+    completion.data = std::move(data);
+
+    const auto id = completion.id;
+    auto* shared = m_shared.get();
+
+    shared->outstanding.fetch_add(1, std::memory_order_relaxed);
+    try
+    {
+      m_pool->submit([shared, completion = std::move(completion)]() mutable {
+        execute(completion);
+
+        detail::spin_backoff backoff;
+        while (!shared->discarding.load(std::memory_order_acquire) &&
+               !shared->channel.try_push(std::move(completion)))
+        {
+          backoff();
+        }
+
+        // The service may be destroyed as soon as the counter reaches zero
+        shared->outstanding.fetch_sub(1, std::memory_order_release);
+      });
+    }
+    catch (...)
+    {
+      shared->outstanding.fetch_sub(1, std::memory_order_relaxed);
+      throw;
+    }
+
+    return id;
+  }
+
+  static void execute(file_completion& completion) noexcept
+  {
+    try
+    {
+      switch (completion.operation)
+      {
+        case file_operation::read:
+          completion.succeeded = read_all(completion.path, completion.data);
+          break;
+
+        case file_operation::write:
+          completion.succeeded =
+              write_all(completion.path, file_mode::write_binary, completion.data);
+          break;
+
+        case file_operation::append:
+          completion.succeeded = write_all(completion.path,
+                                           file_mode::append_or_create_binary,
+                                           completion.data);
+          break;
+
+        default:
+          assert(false);
+          completion.succeeded = false;
+          break;
+      }
+    }
+    catch (...)
+    {
+      // Exceptions must not escape the task, the operation is reported as failed
+      completion.succeeded = false;
+    }
+  }
+
+  [[nodiscard]] static auto read_all(const std::string& path,
+                                     std::vector<std::byte>& data) -> bool
+  {
+    file source{path, file_mode::read_existing_binary};
+    if (!source)
+    {
+      return false;
+    }
+
+    // The size is unknown for some kinds of files, which are read in chunks instead
+    if (const auto size = source.size())
+    {
+      data.resize(*size);
+      return data.empty() || source.read_to(data) == data.size();
+    }
+
+    constexpr size_type chunkSize = 65'536;
+
+    size_type count = 0;
+    for (;;)
+    {
+      data.resize(count + chunkSize);
+
+      const auto result = source.read_to(data.data() + count, chunkSize);
+      count += result;
+
+      if (result != chunkSize)
+      {
+        break;
+      }
+    }
+
+    data.resize(count);
+    return true;
+  }
+
+  [[nodiscard]] static auto write_all(const std::string& path,
+                                      const file_mode mode,
+                                      const std::vector<std::byte>& data) -> bool
+  {
+    file target{path, mode};
+    if (!target)
+    {
+      return false;
+    }
+
+    return data.empty() || target.write(data) == data.size();
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_ASYNC_FILE_IO_HEADER
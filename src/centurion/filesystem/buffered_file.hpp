@@ -0,0 +1,805 @@
+#ifndef CENTURION_BUFFERED_FILE_HEADER
+#define CENTURION_BUFFERED_FILE_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>    // min
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <cstring>      // memcpy, memmove
+#include <optional>     // optional
+#include <type_traits>  // is_trivially_copyable_v
+#include <vector>       // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/sfinae.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/byte_swap_kernels.hpp"
+#include "../system/byte_order.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class buffered_reader
+ *
+ * \brief Reads from a file through an intermediate buffer.
+ *
+ * \details Every read function of `file` results in at least one call through the
+ * function pointers of the underlying `SDL_RWops`. This class instead reads the file in
+ * large blocks, and decodes values directly from its buffer, which makes parsing binary
+ * files with many small values considerably faster.
+ * \code{cpp}
+ *   cen::file file{"map.bin", cen::file_mode::read_existing_binary};
+ *   cen::buffered_reader reader{file};
+ *
+ *   const auto width = reader.read_little_endian_u32();
+ *   const auto height = reader.read_little_endian_u32();
+ * \endcode
+ *
+ * \note The reader reads ahead, so the offset of the underlying file is generally ahead
+ * of the offset of the reader. The file shouldn't be used directly while it is being
+ * read through a reader.
+ *
+ * \since 6.1.0
+ *
+ * \see `buffered_writer`
+ */
+class buffered_reader final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a reader for a file.
+   *
+   * \pre the file must not be null.
+   *
+   * \param source the file that will be read, must outlive the reader.
+   * \param bufferSize the size of the buffer, in bytes.
+   *
+   * \throws cen_error if the buffer size is smaller than eight bytes.
+   *
+   * \since 6.1.0
+   */
+  explicit buffered_reader(file& source, const size_type bufferSize = 4'096)
+      : m_file{source}
+  {
+    assert(source);
+
+    if (bufferSize < sizeof(u64))
+    {
+      throw cen_error{"The buffer must be able to hold at least eight bytes!"};
+    }
+
+    m_buffer.resize(bufferSize);
+  }
+
+  /**
+   * \brief Reads bytes from the file.
+   *
+   * \details Reads that are larger than the buffer bypass it, after the buffered bytes
+   * have been copied.
+   *
+   * \param[out] data the destination of the read bytes.
+   * \param size the maximum amount of bytes that will be read.
+   *
+   * \return the amount of bytes that were read.
+   *
+   * \since 6.1.0
+   */
+  auto read_bytes(void* data, const size_type size) noexcept -> size_type
+  {
+    auto* output = static_cast<u8*>(data);
+
+    const auto buffered = (std::min)(size, available());
+    std::memcpy(output, m_buffer.data() + m_begin, buffered);
+    m_begin += buffered;
+
+    const auto remaining = size - buffered;
+    if (remaining == 0)
+    {
+      return size;
+    }
+
+    output += buffered;
+    if (remaining >= m_buffer.size())
+    {
+      // The buffer is empty at this point, and no longer corresponds to the file offset
+      m_begin = 0;
+      m_end = 0;
+
+      const auto count = SDL_RWread(m_file.get(), output, 1, remaining);
+      if (count < remaining)
+      {
+        m_eof = true;
+      }
+
+      return buffered + count;
+    }
+
+    const auto count = fill(remaining) ? remaining : available();
+    std::memcpy(output, m_buffer.data() + m_begin, count);
+    m_begin += count;
+
+    return buffered + count;
+  }
+
+  /**
+   * \brief Reads a single value from the file, in the native byte order.
+   *
+   * \tparam T the type of the value, must be trivially copyable.
+   *
+   * \return the read value; a value-initialized value if the end of the file was hit.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto read() noexcept -> T
+  {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be read!");
+
+    T value{};
+    read_bytes(&value, sizeof(T));
+    return value;
+  }
+
+  /**
+   * \brief Reads an unsigned 8-bit integer from the file.
+   *
+   * \return the read value; zero if the end of the file was hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_byte() noexcept -> u8
+  {
+    return decode<u8>();
+  }
+
+  /**
+   * \brief Reads an unsigned 16-bit integer from the file, stored in little endian.
+   *
+   * \return the read value, in the native byte order; zero if the end of the file was
+   * hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_little_endian_u16() noexcept -> u16
+  {
+    return SDL_SwapLE16(decode<u16>());
+  }
+
+  /**
+   * \brief Reads an unsigned 32-bit integer from the file, stored in little endian.
+   *
+   * \return the read value, in the native byte order; zero if the end of the file was
+   * hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_little_endian_u32() noexcept -> u32
+  {
+    return SDL_SwapLE32(decode<u32>());
+  }
+
+  /**
+   * \brief Reads an unsigned 64-bit integer from the file, stored in little endian.
+   *
+   * \return the read value, in the native byte order; zero if the end of the file was
+   * hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_little_endian_u64() noexcept -> u64
+  {
+    return SDL_SwapLE64(decode<u64>());
+  }
+
+  /**
+   * \brief Reads an unsigned 16-bit integer from the file, stored in big endian.
+   *
+   * \return the read value, in the native byte order; zero if the end of the file was
+   * hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_big_endian_u16() noexcept -> u16
+  {
+    return SDL_SwapBE16(decode<u16>());
+  }
+
+  /**
+   * \brief Reads an unsigned 32-bit integer from the file, stored in big endian.
+   *
+   * \return the read value, in the native byte order; zero if the end of the file was
+   * hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_big_endian_u32() noexcept -> u32
+  {
+    return SDL_SwapBE32(decode<u32>());
+  }
+
+  /**
+   * \brief Reads an unsigned 64-bit integer from the file, stored in big endian.
+   *
+   * \return the read value, in the native byte order; zero if the end of the file was
+   * hit.
+   *
+   * \since 6.1.0
+   */
+  auto read_big_endian_u64() noexcept -> u64
+  {
+    return SDL_SwapBE64(decode<u64>());
+  }
+
+  /**
+   * \brief Reads an array of little endian values from the file.
+   *
+   * \details The values are copied straight from the buffer, or the file for large
+   * arrays, and swapped in place if the native byte order is big endian. Points,
+   * rectangles, areas, 3D vectors and colors are read as arrays of their components.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param[out] data the destination of the read values.
+   * \param maxCount the maximum amount of values that will be read.
+   *
+   * \return the amount of complete values that were read, in the native byte order.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, detail::enable_if_binary_layout_t<T> = 0>
+  auto read_little_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    return read_endian_to<SDL_BYTEORDER == SDL_BIG_ENDIAN>(data, maxCount);
+  }
+
+  /// \copydoc read_little_endian_to(T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto read_little_endian_to(Container& container) noexcept -> size_type
+  {
+    return read_little_endian_to(container.data(), container.size());
+  }
+
+  /**
+   * \brief Reads an array of big endian values from the file.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param[out] data the destination of the read values.
+   * \param maxCount the maximum amount of values that will be read.
+   *
+   * \return the amount of complete values that were read, in the native byte order.
+   *
+   * \see `read_little_endian_to()`
+   *
+   * \since 6.1.0
+   */
+  template <typename T, detail::enable_if_binary_layout_t<T> = 0>
+  auto read_big_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    return read_endian_to<SDL_BYTEORDER == SDL_LIL_ENDIAN>(data, maxCount);
+  }
+
+  /// \copydoc read_big_endian_to(T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto read_big_endian_to(Container& container) noexcept -> size_type
+  {
+    return read_big_endian_to(container.data(), container.size());
+  }
+
+  /**
+   * \brief Seeks to the specified offset, using the specified seek mode.
+   *
+   * \details The buffered bytes are discarded, unless the target offset is within the
+   * buffer.
+   *
+   * \param offset the offset to seek to.
+   * \param mode the seek mode that will be used.
+   *
+   * \return the resulting offset; `std::nullopt` if something went wrong.
+   *
+   * \since 6.1.0
+   */
+  auto seek(const i64 offset, const seek_mode mode) noexcept -> std::optional<i64>
+  {
+    if (mode == seek_mode::relative_to_end)
+    {
+      discard();
+      return m_file.seek(offset, mode);
+    }
+
+    const auto target =
+        (mode == seek_mode::relative_to_current) ? this->offset() + offset : offset;
+
+    // Seeking within the buffer avoids reading the same block again
+    const auto start = m_file.offset() - static_cast<i64>(m_end);
+    if (target >= start && target <= start + static_cast<i64>(m_end))
+    {
+      m_begin = static_cast<size_type>(target - start);
+      m_eof = false;
+      return target;
+    }
+
+    discard();
+    return m_file.seek(target, seek_mode::from_beginning);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the current offset of the reader in the file.
+   *
+   * \return the offset of the next byte that will be read.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto offset() const noexcept -> i64
+  {
+    return m_file.offset() - static_cast<i64>(available());
+  }
+
+  /**
+   * \brief Returns the amount of bytes that can be read without accessing the file.
+   *
+   * \return the amount of buffered bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto available() const noexcept -> size_type
+  {
+    return m_end - m_begin;
+  }
+
+  /**
+   * \brief Returns the size of the buffer.
+   *
+   * \return the size of the buffer, in bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto buffer_size() const noexcept -> size_type
+  {
+    return m_buffer.size();
+  }
+
+  /**
+   * \brief Indicates whether or not a read has hit the end of the file.
+   *
+   * \return `true` if a read couldn't be completed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto eof() const noexcept -> bool
+  {
+    return m_eof;
+  }
+
+  /// \} End of queries
+
+ private:
+  file& m_file;
+  std::vector<u8> m_buffer;
+  size_type m_begin{};
+  size_type m_end{};
+  bool m_eof{};
+
+  void discard() noexcept
+  {
+    m_begin = 0;
+    m_end = 0;
+    m_eof = false;
+  }
+
+  // Makes sure that at least the specified amount of bytes are buffered
+  auto fill(const size_type size) noexcept -> bool
+  {
+    if (available() >= size)
+    {
+      return true;
+    }
+
+    const auto remaining = available();
+    std::memmove(m_buffer.data(), m_buffer.data() + m_begin, remaining);
+
+    m_begin = 0;
+    m_end = remaining + SDL_RWread(m_file.get(),
+                                   m_buffer.data() + remaining,
+                                   1,
+                                   m_buffer.size() - remaining);
+
+    if (m_end < size)
+    {
+      m_eof = true;
+      return false;
+    }
+
+    return true;
+  }
+
+  template <bool Swap, typename T>
+  auto read_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    static_assert(detail::has_binary_layout_v<T>,
+                  "The values must be arithmetic, or made up of arithmetic components!");
+
+    // A partially read value at the end of the file is left as is, but not counted
+    const auto count = read_bytes(data, maxCount * sizeof(T)) / sizeof(T);
+    if constexpr (Swap)
+    {
+      swap_byte_order(data, count);
+    }
+
+    return count;
+  }
+
+  template <typename T>
+  auto decode() noexcept -> T
+  {
+    T value{};
+    if (fill(sizeof(T)))
+    {
+      std::memcpy(&value, m_buffer.data() + m_begin, sizeof(T));
+      m_begin += sizeof(T);
+    }
+    else
+    {
+      m_begin = m_end;
+    }
+
+    return value;
+  }
+};
+
+/**
+ * \class buffered_writer
+ *
+ * \brief Writes to a file through an intermediate buffer.
+ *
+ * \details Values are encoded into a buffer, which is written to the file in a single
+ * call once it is full, when `flush()` is called, or when the writer is destroyed.
+ * \code{cpp}
+ *   cen::file file{"map.bin", cen::file_mode::write_binary};
+ *   cen::buffered_writer writer{file};
+ *
+ *   writer.write_as_little_endian(width);
+ *   writer.write_as_little_endian(height);
+ * \endcode
+ *
+ * \note Write errors are reported by the function that writes the buffer to the file,
+ * which may be a later call than the one that wrote the value.
+ *
+ * \since 6.1.0
+ *
+ * \see `buffered_reader`
+ */
+class buffered_writer final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a writer for a file.
+   *
+   * \pre the file must not be null.
+   *
+   * \param target the file that will be written to, must outlive the writer.
+   * \param bufferSize the size of the buffer, in bytes.
+   *
+   * \throws cen_error if the buffer size is smaller than eight bytes.
+   *
+   * \since 6.1.0
+   */
+  explicit buffered_writer(file& target, const size_type bufferSize = 4'096)
+      : m_file{target}
+  {
+    assert(target);
+
+    if (bufferSize < sizeof(u64))
+    {
+      throw cen_error{"The buffer must be able to hold at least eight bytes!"};
+    }
+
+    m_buffer.reserve(bufferSize);
+  }
+
+  buffered_writer(const buffered_writer&) = delete;
+
+  auto operator=(const buffered_writer&) -> buffered_writer& = delete;
+
+  /**
+   * \brief Writes the buffered bytes to the file.
+   */
+  ~buffered_writer() noexcept
+  {
+    flush();
+  }
+
+  /**
+   * \brief Writes bytes to the file.
+   *
+   * \details Writes that are larger than the buffer bypass it, after the buffered bytes
+   * have been flushed.
+   *
+   * \param data the bytes that will be written.
+   * \param size the amount of bytes that will be written.
+   *
+   * \return `success` if the bytes were buffered or written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto write_bytes(const void* data, const size_type size) noexcept -> result
+  {
+    if (m_buffer.size() + size > m_buffer.capacity())
+    {
+      if (!flush())
+      {
+        return failure;
+      }
+
+      if (size >= m_buffer.capacity())
+      {
+        return SDL_RWwrite(m_file.get(), data, 1, size) == size;
+      }
+    }
+
+    const auto* bytes = static_cast<const u8*>(data);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+
+    return success;
+  }
+
+  /**
+   * \brief Writes a single value to the file, in the native byte order.
+   *
+   * \tparam T the type of the value, must be trivially copyable.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered or written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto write(const T& value) noexcept -> result
+  {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Only trivially copyable types can be written!");
+    return write_bytes(&value, sizeof(T));
+  }
+
+  /**
+   * \brief Writes an unsigned 8-bit integer to the file.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered or written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto write_byte(const u8 value) noexcept -> result
+  {
+    return write(value);
+  }
+
+  /**
+   * \brief Writes an unsigned 16-bit integer to the file, as a little endian value.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered or written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto write_as_little_endian(const u16 value) noexcept -> result
+  {
+    return write(SDL_SwapLE16(value));
+  }
+
+  /// \copydoc write_as_little_endian(u16)
+  auto write_as_little_endian(const u32 value) noexcept -> result
+  {
+    return write(SDL_SwapLE32(value));
+  }
+
+  /// \copydoc write_as_little_endian(u16)
+  auto write_as_little_endian(const u64 value) noexcept -> result
+  {
+    return write(SDL_SwapLE64(value));
+  }
+
+  /**
+   * \brief Writes an unsigned 16-bit integer to the file, as a big endian value.
+   *
+   * \param value the value that will be written.
+   *
+   * \return `success` if the value was buffered or written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto write_as_big_endian(const u16 value) noexcept -> result
+  {
+    return write(SDL_SwapBE16(value));
+  }
+
+  /// \copydoc write_as_big_endian(u16)
+  auto write_as_big_endian(const u32 value) noexcept -> result
+  {
+    return write(SDL_SwapBE32(value));
+  }
+
+  /// \copydoc write_as_big_endian(u16)
+  auto write_as_big_endian(const u64 value) noexcept -> result
+  {
+    return write(SDL_SwapBE64(value));
+  }
+
+  /**
+   * \brief Writes an array of values to the file, as little endian values.
+   *
+   * \details The values are copied into the buffer in as few blocks as possible, and
+   * swapped in place in the buffer if the native byte order is big endian, so the source
+   * is never copied value by value. Points, rectangles, areas, 3D vectors and colors are
+   * written as arrays of their components, which makes this considerably faster than
+   * serializing them one at a time.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param data the values that will be written.
+   * \param count the amount of values that will be written.
+   *
+   * \return `success` if all values were buffered or written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto write_as_little_endian(const T* data, const size_type count) noexcept -> result
+  {
+    return write_endian<SDL_BYTEORDER == SDL_BIG_ENDIAN>(data, count);
+  }
+
+  /// \copydoc write_as_little_endian(const T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto write_as_little_endian(const Container& container) noexcept -> result
+  {
+    return write_as_little_endian(container.data(), container.size());
+  }
+
+  /**
+   * \brief Writes an array of values to the file, as big endian values.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param data the values that will be written.
+   * \param count the amount of values that will be written.
+   *
+   * \return `success` if all values were buffered or written; `failure` otherwise.
+   *
+   * \see `write_as_little_endian(const T*, size_type)`
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto write_as_big_endian(const T* data, const size_type count) noexcept -> result
+  {
+    return write_endian<SDL_BYTEORDER == SDL_LIL_ENDIAN>(data, count);
+  }
+
+  /// \copydoc write_as_big_endian(const T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto write_as_big_endian(const Container& container) noexcept -> result
+  {
+    return write_as_big_endian(container.data(), container.size());
+  }
+
+  /**
+   * \brief Writes the buffered bytes to the file.
+   *
+   * \return `success` if all buffered bytes were written; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto flush() noexcept -> result
+  {
+    if (m_buffer.empty())
+    {
+      return success;
+    }
+
+    const auto size = m_buffer.size();
+    const auto written = SDL_RWwrite(m_file.get(), m_buffer.data(), 1, size);
+
+    // Any bytes that weren't written are discarded, to avoid writing them out of order
+    m_buffer.clear();
+
+    return written == size;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of bytes that haven't been written to the file yet.
+   *
+   * \return the amount of buffered bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> size_type
+  {
+    return m_buffer.size();
+  }
+
+  /**
+   * \brief Returns the size of the buffer.
+   *
+   * \return the size of the buffer, in bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto buffer_size() const noexcept -> size_type
+  {
+    return m_buffer.capacity();
+  }
+
+  /// \} End of queries
+
+ private:
+  file& m_file;
+  std::vector<u8> m_buffer;
+
+  template <bool Swap, typename T>
+  auto write_endian(const T* data, const size_type count) noexcept -> result
+  {
+    static_assert(detail::has_binary_layout_v<T>,
+                  "The values must be arithmetic, or made up of arithmetic components!");
+
+    constexpr auto componentSize = detail::binary_layout<T>::component_size;
+    if constexpr (!Swap || componentSize == 1)
+    {
+      return write_bytes(data, count * sizeof(T));
+    }
+    else
+    {
+      const auto* bytes = reinterpret_cast<const u8*>(data);
+      auto remaining = count * sizeof(T);
+
+      while (remaining != 0)
+      {
+        if (m_buffer.capacity() - m_buffer.size() < componentSize && !flush())
+        {
+          return failure;
+        }
+
+        // Only whole components are copied, so that they can be swapped in the buffer
+        const auto room = (m_buffer.capacity() - m_buffer.size()) / componentSize;
+        const auto size = (std::min)(room * componentSize, remaining);
+        const auto offset = m_buffer.size();
+
+        m_buffer.insert(m_buffer.end(), bytes, bytes + size);
+        detail::swap_bytes_kernel<componentSize>(m_buffer.data() + offset,
+                                                 size / componentSize);
+
+        bytes += size;
+        remaining -= size;
+      }
+
+      return success;
+    }
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_BUFFERED_FILE_HEADER
@@ -0,0 +1,519 @@
+#ifndef CENTURION_COMPRESSED_FILE_HEADER
+#define CENTURION_COMPRESSED_FILE_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // min
+#include <cstddef>    // size_t
+#include <cstring>    // memcpy, memcmp
+#include <memory>     // make_unique
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/czstring.hpp"
+#include "../core/integers.hpp"
+#include "../detail/asset_pack_format.hpp"
+#include "../detail/block_compression.hpp"
+#include "../detail/rwops_adapter.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+/*
+ * Compressed files start with a header, followed by the blocks and an end marker. All
+ * values are stored in little-endian byte order.
+ *
+ *   Header:
+ *     u8[4]  magic, "CENZ"
+ *     u32    format version
+ *     u32    maximum amount of uncompressed bytes in a block
+ *
+ *   Block:
+ *     u32    amount of uncompressed bytes, zero marks the end of the file
+ *     u32    amount of stored bytes, the high bit is set if the block is uncompressed
+ *     u8[]   the stored bytes
+ */
+
+inline constexpr char compressed_file_magic[4] = {'C', 'E', 'N', 'Z'};
+inline constexpr u32 compressed_file_version = 1;
+inline constexpr std::size_t compressed_file_header_size = 12;
+inline constexpr std::size_t compressed_block_header_size = 8;
+inline constexpr u32 compressed_block_stored_flag = 0x8000'0000u;
+inline constexpr u32 compressed_block_max_size = 0x0100'0000u;  // 16 MiB
+
+[[nodiscard]] inline auto read_exactly(file& source, void* data, const std::size_t size)
+    -> bool
+{
+  return size == 0 || source.read_to(static_cast<u8*>(data), size) == size;
+}
+
+[[nodiscard]] inline auto write_exactly(file& target,
+                                        const void* data,
+                                        const std::size_t size) -> bool
+{
+  return size == 0 || target.write(static_cast<const u8*>(data), size) == size;
+}
+
+class compressed_writer final
+{
+ public:
+  compressed_writer(file&& target, const std::size_t blockSize)
+      : m_target{std::move(target)}
+      , m_input(blockSize)
+      , m_output(block_compress_bound(blockSize))
+  {}
+
+  [[nodiscard]] auto write_header() -> bool
+  {
+    u8 header[compressed_file_header_size];
+    std::memcpy(header, compressed_file_magic, sizeof compressed_file_magic);
+    store_little_endian<u32>(header + 4, compressed_file_version);
+    store_little_endian<u32>(header + 8, static_cast<u32>(m_input.size()));
+
+    return write_exactly(m_target, header, sizeof header);
+  }
+
+  static auto size(SDL_RWops*) noexcept -> Sint64
+  {
+    return SDL_SetError("The size of a compressed file is unknown!");
+  }
+
+  static auto seek(SDL_RWops* context, const Sint64 offset, const int whence) noexcept
+      -> Sint64
+  {
+    const auto& self = rwops_state<compressed_writer>(context);
+    if (whence == RW_SEEK_CUR && offset == 0)
+    {
+      return self.m_offset;
+    }
+
+    return SDL_SetError("Compressed files can't be seeked whilst writing!");
+  }
+
+  static auto read(SDL_RWops*, void*, std::size_t, std::size_t) noexcept -> std::size_t
+  {
+    SDL_SetError("Compressed files can't be read whilst writing!");
+    return 0;
+  }
+
+  static auto write(SDL_RWops* context,
+                    const void* data,
+                    const std::size_t size,
+                    const std::size_t count) noexcept -> std::size_t
+  {
+    auto& self = rwops_state<compressed_writer>(context);
+    if (size == 0 || self.m_failed)
+    {
+      return 0;
+    }
+
+    const auto* bytes = static_cast<const u8*>(data);
+    const auto total = size * count;
+
+    std::size_t written = 0;
+    while (written < total)
+    {
+      const auto n = (std::min)(total - written, self.m_input.size() - self.m_used);
+      std::memcpy(self.m_input.data() + self.m_used, bytes + written, n);
+
+      self.m_used += n;
+      written += n;
+
+      if (self.m_used == self.m_input.size() && !self.flush())
+      {
+        break;
+      }
+    }
+
+    // Bytes still in the buffer count as written, unless the buffer couldn't be flushed
+    if (self.m_failed)
+    {
+      written -= (std::min)(written, self.m_used);
+    }
+
+    self.m_offset += static_cast<Sint64>(written);
+    return written / size;
+  }
+
+  static auto close(SDL_RWops* context) noexcept -> int
+  {
+    auto* self = &rwops_state<compressed_writer>(context);
+
+    u8 marker[compressed_block_header_size]{};
+    const auto succeeded =
+        self->flush() && write_exactly(self->m_target, marker, sizeof marker);
+
+    delete self;
+    SDL_FreeRW(context);
+
+    return succeeded ? 0 : -1;
+  }
+
+ private:
+  file m_target;
+  std::vector<u8> m_input;
+  std::vector<u8> m_output;
+  std::size_t m_used{};
+  Sint64 m_offset{};
+  bool m_failed{};
+
+  auto flush() noexcept -> bool
+  {
+    if (m_failed || m_used == 0)
+    {
+      return !m_failed;
+    }
+
+    auto stored =
+        compress_block(m_input.data(), m_used, m_output.data(), m_output.size());
+
+    // Incompressible data is stored as is, which avoids expanding it
+    auto* data = m_output.data();
+    auto storedSize = static_cast<u32>(stored);
+    if (stored == 0 || stored >= m_used)
+    {
+      data = m_input.data();
+      stored = m_used;
+      storedSize = static_cast<u32>(m_used) | compressed_block_stored_flag;
+    }
+
+    u8 header[compressed_block_header_size];
+    store_little_endian<u32>(header, static_cast<u32>(m_used));
+    store_little_endian<u32>(header + 4, storedSize);
+
+    if (!write_exactly(m_target, header, sizeof header) ||
+        !write_exactly(m_target, data, stored))
+    {
+      m_failed = true;
+      SDL_SetError("Failed to write compressed block!");
+      return false;
+    }
+
+    m_used = 0;
+    return true;
+  }
+};
+
+class compressed_reader final
+{
+ public:
+  explicit compressed_reader(file&& source) : m_source{std::move(source)}
+  {}
+
+  [[nodiscard]] auto read_header() -> bool
+  {
+    u8 header[compressed_file_header_size];
+    if (!read_exactly(m_source, header, sizeof header) ||
+        std::memcmp(header, compressed_file_magic, sizeof compressed_file_magic) != 0 ||
+        load_little_endian<u32>(header + 4) != compressed_file_version)
+    {
+      SDL_SetError("Invalid compressed file header!");
+      return false;
+    }
+
+    const auto blockSize = load_little_endian<u32>(header + 8);
+    if (blockSize == 0 || blockSize > compressed_block_max_size)
+    {
+      SDL_SetError("Invalid compressed file block size!");
+      return false;
+    }
+
+    m_block.reserve(blockSize);
+    m_stored.reserve(block_compress_bound(blockSize));
+    m_maxBlockSize = blockSize;
+    m_dataOffset = m_source.offset();
+
+    return true;
+  }
+
+  static auto size(SDL_RWops*) noexcept -> Sint64
+  {
+    return SDL_SetError("The size of a compressed file is unknown!");
+  }
+
+  static auto seek(SDL_RWops* context, const Sint64 offset, const int whence) noexcept
+      -> Sint64
+  {
+    auto& self = rwops_state<compressed_reader>(context);
+
+    Sint64 target;
+    if (whence == RW_SEEK_SET)
+    {
+      target = offset;
+    }
+    else if (whence == RW_SEEK_CUR)
+    {
+      target = self.m_offset + offset;
+    }
+    else
+    {
+      return SDL_SetError("Compressed files can't be seeked relative to their end!");
+    }
+
+    if (target < 0)
+    {
+      return SDL_SetError("Can't seek to a negative offset!");
+    }
+
+    const auto blockStart = self.m_offset - static_cast<Sint64>(self.m_blockOffset);
+    if (target < blockStart)
+    {
+      // The blocks can only be decoded in order, so decoding starts over
+      if (!self.m_source.seek(self.m_dataOffset, seek_mode::from_beginning))
+      {
+        return SDL_SetError("Failed to rewind compressed file!");
+      }
+
+      self.m_block.clear();
+      self.m_blockOffset = 0;
+      self.m_offset = 0;
+      self.m_ended = false;
+      self.m_failed = false;
+    }
+    else if (target < self.m_offset)
+    {
+      // The target is within the current block, which is still decoded
+      self.m_blockOffset = static_cast<std::size_t>(target - blockStart);
+      self.m_offset = target;
+    }
+
+    // Skip forward, block by block
+    while (self.m_offset < target)
+    {
+      if (self.m_blockOffset == self.m_block.size() && !self.next_block())
+      {
+        break;
+      }
+
+      const auto n = (std::min)(static_cast<std::size_t>(target - self.m_offset),
+                                self.m_block.size() - self.m_blockOffset);
+      self.m_blockOffset += n;
+      self.m_offset += static_cast<Sint64>(n);
+    }
+
+    return self.m_offset;
+  }
+
+  static auto read(SDL_RWops* context,
+                   void* data,
+                   const std::size_t size,
+                   const std::size_t count) noexcept -> std::size_t
+  {
+    auto& self = rwops_state<compressed_reader>(context);
+    if (size == 0)
+    {
+      return 0;
+    }
+
+    auto* bytes = static_cast<u8*>(data);
+    const auto total = size * count;
+
+    std::size_t copied = 0;
+    while (copied < total)
+    {
+      if (self.m_blockOffset == self.m_block.size() && !self.next_block())
+      {
+        break;
+      }
+
+      const auto n = (std::min)(total - copied, self.m_block.size() - self.m_blockOffset);
+      std::memcpy(bytes + copied, self.m_block.data() + self.m_blockOffset, n);
+
+      self.m_blockOffset += n;
+      copied += n;
+    }
+
+    self.m_offset += static_cast<Sint64>(copied);
+    return copied / size;
+  }
+
+  static auto write(SDL_RWops*, const void*, std::size_t, std::size_t) noexcept
+      -> std::size_t
+  {
+    SDL_SetError("Compressed files can't be written whilst reading!");
+    return 0;
+  }
+
+  static auto close(SDL_RWops* context) noexcept -> int
+  {
+    delete &rwops_state<compressed_reader>(context);
+    SDL_FreeRW(context);
+    return 0;
+  }
+
+ private:
+  file m_source;
+  std::vector<u8> m_block;   // The uncompressed bytes of the current block
+  std::vector<u8> m_stored;  // The stored bytes of the current block
+  std::size_t m_blockOffset{};
+  std::size_t m_maxBlockSize{};
+  Sint64 m_offset{};
+  i64 m_dataOffset{};
+  bool m_ended{};
+  bool m_failed{};
+
+  auto next_block() noexcept -> bool
+  {
+    if (m_ended || m_failed)
+    {
+      return false;
+    }
+
+    m_block.clear();
+    m_blockOffset = 0;
+
+    u8 header[compressed_block_header_size];
+    if (!read_exactly(m_source, header, sizeof header))
+    {
+      return fail("Unexpected end of compressed file!");
+    }
+
+    const auto rawSize = load_little_endian<u32>(header);
+    const auto storedSize = load_little_endian<u32>(header + 4);
+
+    if (rawSize == 0)
+    {
+      m_ended = true;
+      return false;
+    }
+
+    const auto isStored = (storedSize & compressed_block_stored_flag) != 0;
+    const std::size_t size = storedSize & ~compressed_block_stored_flag;
+
+    if (rawSize > m_maxBlockSize || size > block_compress_bound(m_maxBlockSize) ||
+        (isStored && size != rawSize))
+    {
+      return fail("Invalid compressed block!");
+    }
+
+    // The buffers were reserved up front, so resizing them doesn't allocate
+    m_block.resize(rawSize);
+
+    if (isStored)
+    {
+      if (!read_exactly(m_source, m_block.data(), size))
+      {
+        return fail("Unexpected end of compressed file!");
+      }
+    }
+    else
+    {
+      m_stored.resize(size);
+      if (!read_exactly(m_source, m_stored.data(), size))
+      {
+        return fail("Unexpected end of compressed file!");
+      }
+
+      if (!decompress_block(m_stored.data(), size, m_block.data(), rawSize))
+      {
+        return fail("Corrupt compressed block!");
+      }
+    }
+
+    return true;
+  }
+
+  auto fail(const czstring message) noexcept -> bool
+  {
+    m_block.clear();
+    m_failed = true;
+    SDL_SetError("%s", message);
+    return false;
+  }
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Opens a file that compresses the data written to it, before it is written to
+ * another file.
+ *
+ * \details The returned file can be used with the ordinary `file` API, and with any
+ * other function that accepts an `SDL_RWops`. The data is split into blocks, which are
+ * compressed using a fast LZ77 codec, so that less data has to be written to disk. The
+ * compressed data can be read back by means of `make_compressed_reader()`.
+ * \code{cpp}
+ *   auto save = cen::make_compressed_writer({"save.bin", cen::file_mode::write_binary});
+ *   save.write_as_little_endian(version);
+ *   save.write(world.data(), world.size());
+ * \endcode
+ *
+ * \details The remaining data is compressed and written when the returned file is
+ * closed, i.e. when it is destroyed.
+ *
+ * \note The returned file only supports writing, and querying the offset.
+ *
+ * \param target the file that the compressed data will be written to, ownership is
+ * claimed.
+ * \param blockSize the maximum amount of uncompressed bytes in a block, larger blocks
+ * compress better but use more memory.
+ *
+ * \return a file that compresses the data written to it; a null file if `target` is
+ * null, the block size is invalid or the header couldn't be written.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto make_compressed_writer(file&& target,
+                                                 const std::size_t blockSize = 65'536)
+    -> file
+{
+  if (!target || blockSize == 0 || blockSize > detail::compressed_block_max_size)
+  {
+    return file{nullptr};
+  }
+
+  auto state = std::make_unique<detail::compressed_writer>(std::move(target), blockSize);
+  if (!state->write_header())
+  {
+    return file{nullptr};
+  }
+
+  return detail::make_rwops(std::move(state));
+}
+
+/**
+ * \brief Opens a file that decompresses the data read from another file.
+ *
+ * \details The returned file can be used with the ordinary `file` API, and with any
+ * other function that accepts an `SDL_RWops`, e.g. the loading functions of SDL_image.
+ *
+ * \note The returned file only supports reading, querying the offset and seeking
+ * relative to the beginning, or the current offset. Seeking backwards is slow, since the
+ * data has to be decompressed from the beginning.
+ *
+ * \param source the file that contains the compressed data, written by a file obtained
+ * from `make_compressed_writer()`, ownership is claimed.
+ *
+ * \return a file that decompresses the data read from it; a null file if `source` is
+ * null or doesn't start with a valid header.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto make_compressed_reader(file&& source) -> file
+{
+  if (!source)
+  {
+    return file{nullptr};
+  }
+
+  auto state = std::make_unique<detail::compressed_reader>(std::move(source));
+  if (!state->read_header())
+  {
+    return file{nullptr};
+  }
+
+  return detail::make_rwops(std::move(state));
+}
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_COMPRESSED_FILE_HEADER
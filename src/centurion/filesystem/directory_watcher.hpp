@@ -0,0 +1,819 @@
+#ifndef CENTURION_DIRECTORY_WATCHER_HEADER
+#define CENTURION_DIRECTORY_WATCHER_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>        // size_t
+#include <memory>         // unique_ptr, make_unique
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <utility>        // move, forward
+#include <vector>         // vector
+
+#if defined(_WIN32)
+#include "../detail/windows_api.hpp"  // CreateFileA, ReadDirectoryChangesW, ...
+#elif defined(__linux__)
+#include <dirent.h>       // opendir, readdir, closedir
+#include <sys/inotify.h>  // inotify_init1, inotify_add_watch, inotify_event
+#include <sys/stat.h>     // stat
+#include <unistd.h>       // read, close
+
+#include <cerrno>  // errno, EINTR
+#elif defined(__APPLE__)
+#include <CoreServices/CoreServices.h>  // FSEventStreamCreate, ...
+#include <dispatch/dispatch.h>          // dispatch_queue_create, dispatch_sync_f, ...
+#include <limits.h>                     // PATH_MAX
+#include <stdlib.h>                     // realpath
+#include <sys/stat.h>                   // stat
+#endif
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../events/event_channel.hpp"
+#include "../system/counter.hpp"
+#include "join_path.hpp"
+
+#if defined(__APPLE__)
+#include "../thread/scoped_lock.hpp"
+#include "../thread/spin_mutex.hpp"
+#endif
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \enum file_change_type
+ *
+ * \brief Provides values that represent the kinds of changes to watched files.
+ *
+ * \see `directory_watcher`
+ *
+ * \since 6.1.0
+ */
+enum class file_change_type
+{
+  created,   ///< A file was created, or moved into the directory.
+  modified,  ///< The contents or attributes of a file were changed.
+  removed    ///< A file was removed, or moved out of the directory.
+};
+
+/**
+ * \struct file_change
+ *
+ * \brief Describes a change to a file in a watched directory.
+ *
+ * \see `directory_watcher`
+ *
+ * \since 6.1.0
+ */
+struct file_change final
+{
+  std::string path;       ///< The path of the file, prefixed by the watched directory.
+  file_change_type type;  ///< The kind of change.
+};
+
+/**
+ * \class directory_watcher
+ *
+ * \brief Watches a directory for changes to its files, e.g. to hot-reload assets.
+ *
+ * \details The notifications of the operating system are used, i.e. inotify on Linux,
+ * `ReadDirectoryChangesW()` on Windows and FSEvents on macOS, so the cost of watching
+ * doesn't depend on the amount of files. Changes to directories aren't reported.
+ *
+ * Editors and asset tools often write a file in several steps, so changes are debounced:
+ * a change is only sent once the file hasn't changed for the specified delay, and the
+ * changes that occurred in the meantime are merged. For instance, a file that's created
+ * and then written to is reported as created, and a temporary file that's created and
+ * removed again isn't reported at all.
+ *
+ * The settled changes are sent through an `event_channel`, which is drained either by
+ * calling `poll()`, or by attaching the channel to an `event_dispatcher` and calling
+ * `update()` once per frame.
+ * \code{cpp}
+ *   cen::directory_watcher watcher{"resources"};
+ *
+ *   // Once per frame
+ *   watcher.poll([&](cen::file_change& change) {
+ *     if (change.type != cen::file_change_type::removed) {
+ *       loader.load(change.path);
+ *     }
+ *   });
+ * \endcode
+ *
+ * \note A file that's replaced by moving another file on top of it, which is how many
+ * editors save files, is reported as created rather than modified.
+ *
+ * \note On macOS, the CoreServices framework must be linked.
+ *
+ * \since 6.1.0
+ */
+class directory_watcher final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Starts watching a directory.
+   *
+   * \param directory the path of the directory that will be watched.
+   * \param recursive `true` if files in subdirectories should be watched as well.
+   * \param delay the amount of time that a file must remain unchanged before its changes
+   * are sent.
+   * \param capacity the capacity of the change channel.
+   *
+   * \throws cen_error if the directory can't be watched.
+   *
+   * \since 6.1.0
+   */
+  explicit directory_watcher(std::string directory,
+                             const bool recursive = true,
+                             const milliseconds<u32> delay = milliseconds<u32>{100},
+                             const size_type capacity = 256)
+      : m_directory{std::move(directory)}
+      , m_channel{capacity}
+      , m_delay{delay}
+      , m_recursive{recursive}
+  {
+    if (!m_directory.empty() && !detail::is_path_separator(m_directory.back()))
+    {
+      m_directory += path_separator;
+    }
+
+    open();
+  }
+
+  directory_watcher(const directory_watcher&) = delete;
+
+  auto operator=(const directory_watcher&) -> directory_watcher& = delete;
+
+  ~directory_watcher() noexcept
+  {
+    close();
+  }
+
+  /**
+   * \brief Collects the changes reported by the operating system, and sends the changes
+   * that have settled.
+   *
+   * \details This function doesn't block. Settled changes that don't fit in the channel
+   * are kept, and sent by a later call.
+   *
+   * \param now the current time, compared to the time of the last change to each file.
+   *
+   * \return the amount of sent changes.
+   *
+   * \since 6.1.0
+   */
+  auto update(const milliseconds<u32> now) -> size_type
+  {
+    read_changes(now);
+
+    size_type sent = 0;
+    for (auto it = m_pending.begin(); it != m_pending.end();)
+    {
+      auto& [path, change] = *it;
+      if (now - change.time < m_delay)
+      {
+        ++it;
+        continue;
+      }
+
+      if (!m_channel.try_push(file_change{path, change.type}))
+      {
+        break;
+      }
+
+      it = m_pending.erase(it);
+      ++sent;
+    }
+
+    return sent;
+  }
+
+  /**
+   * \brief Collects and sends changes, using the current time.
+   *
+   * \see `update(milliseconds<u32>)`
+   *
+   * \since 6.1.0
+   */
+  auto update() -> size_type
+  {
+    return update(counter::ticks());
+  }
+
+  /**
+   * \brief Updates the watcher and invokes a function object with every sent change.
+   *
+   * \tparam Function the type of the function object, invocable with `file_change&`.
+   *
+   * \param function the function object that will receive the changes.
+   *
+   * \return the amount of received changes.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  auto poll(Function&& function) -> size_type
+  {
+    update();
+    return m_channel.drain(std::forward<Function>(function));
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the channel that settled changes are sent through.
+   *
+   * \return the change channel.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto channel() noexcept -> event_channel<file_change>&
+  {
+    return m_channel;
+  }
+
+  /**
+   * \brief Returns the path of the watched directory.
+   *
+   * \return the path of the watched directory, which ends with a path separator.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto directory() const noexcept -> const std::string&
+  {
+    return m_directory;
+  }
+
+  /**
+   * \brief Returns the amount of files with changes that haven't settled yet.
+   *
+   * \return the amount of files with unsent changes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> size_type
+  {
+    return m_pending.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct pending_change final
+  {
+    file_change_type type;
+    milliseconds<u32> time;
+  };
+
+  std::string m_directory;
+  event_channel<file_change> m_channel;
+  std::unordered_map<std::string, pending_change> m_pending;
+  milliseconds<u32> m_delay;
+  bool m_recursive;
+
+  // Merges a change with the unsettled changes to the same file
+  void record(const std::string& relative,
+              const file_change_type type,
+              const milliseconds<u32> now)
+  {
+    const auto path = m_directory + relative;
+
+    const auto it = m_pending.find(path);
+    if (it == m_pending.end())
+    {
+      m_pending.emplace(path, pending_change{type, now});
+      return;
+    }
+
+    auto& change = it->second;
+    if (change.type == file_change_type::created)
+    {
+      if (type == file_change_type::removed)
+      {
+        m_pending.erase(it);  // The file was only there temporarily
+        return;
+      }
+    }
+    else
+    {
+      change.type = (type == file_change_type::removed) ? file_change_type::removed
+                                                        : file_change_type::modified;
+    }
+
+    change.time = now;
+  }
+
+#if defined(_WIN32)
+
+  HANDLE m_handle{INVALID_HANDLE_VALUE};
+  OVERLAPPED m_overlapped{};
+  std::vector<DWORD> m_buffer;  // DWORD-aligned, as required by ReadDirectoryChangesW
+
+  void open()
+  {
+    m_handle = CreateFileA(m_directory.c_str(),
+                           FILE_LIST_DIRECTORY,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                           nullptr,
+                           OPEN_EXISTING,
+                           FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+                           nullptr);
+    if (m_handle == INVALID_HANDLE_VALUE)
+    {
+      throw cen_error{"Failed to open watched directory!"};
+    }
+
+    m_overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    if (!m_overlapped.hEvent)
+    {
+      CloseHandle(m_handle);
+      throw cen_error{"Failed to create directory watcher event!"};
+    }
+
+    m_buffer.resize(16'384);
+
+    if (!issue())
+    {
+      close();
+      throw cen_error{"Failed to watch directory!"};
+    }
+  }
+
+  [[nodiscard]] auto issue() noexcept -> bool
+  {
+    constexpr DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME |
+                             FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_SIZE;
+    return ReadDirectoryChangesW(m_handle,
+                                 m_buffer.data(),
+                                 static_cast<DWORD>(m_buffer.size() * sizeof(DWORD)),
+                                 m_recursive ? TRUE : FALSE,
+                                 filter,
+                                 nullptr,
+                                 &m_overlapped,
+                                 nullptr) != 0;
+  }
+
+  void read_changes(const milliseconds<u32> now)
+  {
+    DWORD size{};
+    while (GetOverlappedResult(m_handle, &m_overlapped, &size, FALSE))
+    {
+      // A size of zero means that the buffer overflowed and the changes were lost
+      const auto* bytes = reinterpret_cast<const char*>(m_buffer.data());
+      for (DWORD offset = 0; size != 0;)
+      {
+        const auto* info =
+            reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(bytes + offset);
+        record_change(*info, now);
+
+        if (info->NextEntryOffset == 0)
+        {
+          break;
+        }
+
+        offset += info->NextEntryOffset;
+      }
+
+      ResetEvent(m_overlapped.hEvent);
+      if (!issue())
+      {
+        break;
+      }
+    }
+  }
+
+  void record_change(const FILE_NOTIFY_INFORMATION& info, const milliseconds<u32> now)
+  {
+    const auto length = static_cast<int>(info.FileNameLength / sizeof(WCHAR));
+    const auto size = WideCharToMultiByte(CP_UTF8,
+                                          0,
+                                          info.FileName,
+                                          length,
+                                          nullptr,
+                                          0,
+                                          nullptr,
+                                          nullptr);
+
+    std::string relative(static_cast<size_type>(size), '\0');
+    WideCharToMultiByte(CP_UTF8,
+                        0,
+                        info.FileName,
+                        length,
+                        relative.data(),
+                        size,
+                        nullptr,
+                        nullptr);
+
+    switch (info.Action)
+    {
+      case FILE_ACTION_ADDED:
+      case FILE_ACTION_RENAMED_NEW_NAME:
+        record(relative, file_change_type::created, now);
+        break;
+
+      case FILE_ACTION_REMOVED:
+      case FILE_ACTION_RENAMED_OLD_NAME:
+        record(relative, file_change_type::removed, now);
+        break;
+
+      case FILE_ACTION_MODIFIED: {
+        // Directories are reported as modified when their contents change
+        const auto attributes = GetFileAttributesA((m_directory + relative).c_str());
+        if (attributes == INVALID_FILE_ATTRIBUTES ||
+            !(attributes & FILE_ATTRIBUTE_DIRECTORY))
+        {
+          record(relative, file_change_type::modified, now);
+        }
+
+        break;
+      }
+    }
+  }
+
+  void close() noexcept
+  {
+    if (m_handle != INVALID_HANDLE_VALUE)
+    {
+      // The pending read must be finished before the buffer may be freed
+      DWORD size{};
+      CancelIoEx(m_handle, &m_overlapped);
+      GetOverlappedResult(m_handle, &m_overlapped, &size, TRUE);
+
+      CloseHandle(m_handle);
+      m_handle = INVALID_HANDLE_VALUE;
+    }
+
+    if (m_overlapped.hEvent)
+    {
+      CloseHandle(m_overlapped.hEvent);
+      m_overlapped.hEvent = nullptr;
+    }
+  }
+
+#elif defined(__linux__)
+
+  int m_descriptor{-1};
+  std::unordered_map<int, std::string> m_watches;  // Directories relative to the root
+
+  void open()
+  {
+    m_descriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (m_descriptor == -1)
+    {
+      throw cen_error{"Failed to create inotify instance!"};
+    }
+
+    if (!watch(std::string{}))
+    {
+      close();
+      throw cen_error{"Failed to watch directory!"};
+    }
+  }
+
+  // Watches a directory, and its subdirectories if the watcher is recursive
+  auto watch(const std::string& relative) -> bool
+  {
+    constexpr u32 mask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE |
+                         IN_ATTRIB | IN_MOVED_FROM | IN_MOVED_TO | IN_ONLYDIR;
+
+    const auto path = m_directory + relative;
+
+    const auto wd = inotify_add_watch(m_descriptor, path.c_str(), mask);
+    if (wd == -1)
+    {
+      return false;
+    }
+
+    m_watches[wd] = relative;
+
+    if (m_recursive)
+    {
+      for_each_entry(relative, [this](const std::string& entry, const bool isDirectory) {
+        if (isDirectory)
+        {
+          watch(entry + '/');
+        }
+      });
+    }
+
+    return true;
+  }
+
+  template <typename Function>
+  void for_each_entry(const std::string& relative, Function&& function)
+  {
+    auto* dir = opendir((m_directory + relative).c_str());
+    if (!dir)
+    {
+      return;
+    }
+
+    while (const auto* entry = readdir(dir))
+    {
+      const std::string_view name{entry->d_name};
+      if (name == "." || name == "..")
+      {
+        continue;
+      }
+
+      auto path = relative;
+      path += name;
+
+      auto isDirectory = entry->d_type == DT_DIR;
+      if (entry->d_type == DT_UNKNOWN)
+      {
+        struct stat info{};
+        isDirectory = stat((m_directory + path).c_str(), &info) == 0 &&
+                      S_ISDIR(info.st_mode);
+      }
+
+      function(path, isDirectory);
+    }
+
+    closedir(dir);
+  }
+
+  // Files may be added to a new directory before it's watched, so those are reported
+  void record_new_directory(const std::string& relative, const milliseconds<u32> now)
+  {
+    if (!watch(relative + '/'))
+    {
+      return;
+    }
+
+    for_each_entry(relative + '/',
+                   [this, now](const std::string& entry, const bool isDirectory) {
+                     if (isDirectory)
+                     {
+                       record_new_directory(entry, now);
+                     }
+                     else
+                     {
+                       record(entry, file_change_type::created, now);
+                     }
+                   });
+  }
+
+  void read_changes(const milliseconds<u32> now)
+  {
+    alignas(inotify_event) char buffer[4'096];
+
+    for (;;)
+    {
+      const auto size = ::read(m_descriptor, buffer, sizeof buffer);
+      if (size <= 0)
+      {
+        if (size == -1 && errno == EINTR)
+        {
+          continue;
+        }
+
+        break;  // No more changes are available
+      }
+
+      for (ssize_t offset = 0; offset < size;)
+      {
+        const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+        record_change(*event, now);
+
+        offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+      }
+    }
+  }
+
+  void record_change(const inotify_event& event, const milliseconds<u32> now)
+  {
+    if (event.mask & IN_IGNORED)
+    {
+      m_watches.erase(event.wd);
+      return;
+    }
+
+    const auto it = m_watches.find(event.wd);
+    if (it == m_watches.end() || event.len == 0)
+    {
+      return;
+    }
+
+    const auto relative = it->second + event.name;
+
+    if (event.mask & IN_ISDIR)
+    {
+      // Removed directories are unwatched automatically
+      if (m_recursive && (event.mask & (IN_CREATE | IN_MOVED_TO)))
+      {
+        record_new_directory(relative, now);
+      }
+    }
+    else if (event.mask & (IN_CREATE | IN_MOVED_TO))
+    {
+      record(relative, file_change_type::created, now);
+    }
+    else if (event.mask & (IN_DELETE | IN_MOVED_FROM))
+    {
+      record(relative, file_change_type::removed, now);
+    }
+    else if (event.mask & (IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB))
+    {
+      record(relative, file_change_type::modified, now);
+    }
+  }
+
+  void close() noexcept
+  {
+    if (m_descriptor != -1)
+    {
+      ::close(m_descriptor);
+      m_descriptor = -1;
+    }
+  }
+
+#elif defined(__APPLE__)
+
+  struct raw_change final
+  {
+    std::string path;
+    FSEventStreamEventFlags flags;
+  };
+
+  // Filled on the dispatch queue of the stream
+  struct shared_data final
+  {
+    spin_mutex mutex;
+    std::vector<raw_change> changes;
+  };
+
+  std::unique_ptr<shared_data> m_shared;
+  std::vector<raw_change> m_received;
+  std::string m_realDirectory;  // The resolved path, as reported by FSEvents
+  dispatch_queue_t m_queue{};
+  FSEventStreamRef m_stream{};
+
+  void open()
+  {
+    char resolved[PATH_MAX];
+    if (!realpath(m_directory.c_str(), resolved))
+    {
+      throw cen_error{"Failed to resolve watched directory!"};
+    }
+
+    m_realDirectory = resolved;
+    m_realDirectory += '/';
+
+    m_shared = std::make_unique<shared_data>();
+
+    auto* path = CFStringCreateWithCString(nullptr, resolved, kCFStringEncodingUTF8);
+    auto* paths = CFArrayCreate(nullptr,
+                                reinterpret_cast<const void**>(&path),
+                                1,
+                                &kCFTypeArrayCallBacks);
+    CFRelease(path);
+
+    FSEventStreamContext context{};
+    context.info = m_shared.get();
+
+    // The latency is zero, since changes are debounced by the watcher itself
+    m_stream = FSEventStreamCreate(nullptr,
+                                   &on_changes,
+                                   &context,
+                                   paths,
+                                   kFSEventStreamEventIdSinceNow,
+                                   0.0,
+                                   kFSEventStreamCreateFlagFileEvents |
+                                       kFSEventStreamCreateFlagNoDefer);
+    CFRelease(paths);
+
+    if (!m_stream)
+    {
+      throw cen_error{"Failed to create event stream!"};
+    }
+
+    m_queue = dispatch_queue_create("cen.directory_watcher", DISPATCH_QUEUE_SERIAL);
+    FSEventStreamSetDispatchQueue(m_stream, m_queue);
+
+    if (!FSEventStreamStart(m_stream))
+    {
+      close();
+      throw cen_error{"Failed to start event stream!"};
+    }
+  }
+
+  static void on_changes(ConstFSEventStreamRef,
+                         void* info,
+                         const size_t count,
+                         void* paths,
+                         const FSEventStreamEventFlags* flags,
+                         const FSEventStreamEventId*)
+  {
+    auto* shared = static_cast<shared_data*>(info);
+    auto** strings = static_cast<char**>(paths);
+
+    try
+    {
+      scoped_lock lock{shared->mutex};
+      for (size_t index = 0; index < count; ++index)
+      {
+        shared->changes.push_back({strings[index], flags[index]});
+      }
+    }
+    catch (...)
+    {}
+  }
+
+  void read_changes(const milliseconds<u32> now)
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_received.swap(m_shared->changes);
+    }
+
+    for (const auto& change : m_received)
+    {
+      record_change(change, now);
+    }
+
+    m_received.clear();
+  }
+
+  void record_change(const raw_change& change, const milliseconds<u32> now)
+  {
+    if ((change.flags & kFSEventStreamEventFlagItemIsDir) ||
+        change.path.compare(0, m_realDirectory.size(), m_realDirectory) != 0)
+    {
+      return;
+    }
+
+    const auto relative = change.path.substr(m_realDirectory.size());
+    if (!m_recursive && relative.find('/') != std::string::npos)
+    {
+      return;
+    }
+
+    // A single event may describe several changes, so the current state is inspected
+    struct stat info{};
+    const auto exists = stat(change.path.c_str(), &info) == 0;
+
+    if (!exists)
+    {
+      record(relative, file_change_type::removed, now);
+    }
+    else if (change.flags & (kFSEventStreamEventFlagItemCreated |
+                             kFSEventStreamEventFlagItemRenamed))
+    {
+      record(relative, file_change_type::created, now);
+    }
+    else if (change.flags & (kFSEventStreamEventFlagItemModified |
+                             kFSEventStreamEventFlagItemInodeMetaMod))
+    {
+      record(relative, file_change_type::modified, now);
+    }
+  }
+
+  void close() noexcept
+  {
+    if (m_stream)
+    {
+      FSEventStreamStop(m_stream);
+      FSEventStreamInvalidate(m_stream);
+      FSEventStreamRelease(m_stream);
+      m_stream = nullptr;
+    }
+
+    if (m_queue)
+    {
+      // Waits for callbacks that are still running, before the shared data is freed
+      dispatch_sync_f(m_queue, nullptr, [](void*) {});
+      dispatch_release(m_queue);
+      m_queue = nullptr;
+    }
+  }
+
+#else
+
+  void open()
+  {
+    throw cen_error{"Directory watching isn't supported on this platform!"};
+  }
+
+  void read_changes(milliseconds<u32>)
+  {}
+
+  void close() noexcept
+  {}
+
+#endif  // defined(_WIN32)
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_DIRECTORY_WATCHER_HEADER
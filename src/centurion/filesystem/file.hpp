@@ -2,18 +2,29 @@
 #define CENTURION_FILE_HEADER
 
 #include <SDL.h>
+
+#ifndef CENTURION_NO_SDL_IMAGE
 #include <SDL_image.h>
+#endif  // CENTURION_NO_SDL_IMAGE
 
-#include <cassert>   // assert
-#include <cstddef>   // size_t
-#include <memory>    // unique_ptr
-#include <optional>  // optional
-#include <string>    // string
+#include <algorithm>  // min
+#include <cassert>    // assert
+#include <climits>    // INT_MAX
+#include <cstddef>    // size_t
+#include <cstring>    // memcpy
+#include <memory>     // unique_ptr
+#include <optional>   // optional
+#include <string>     // string
 
 #include "../core/czstring.hpp"
 #include "../core/integers.hpp"
 #include "../core/not_null.hpp"
+#include "../core/owner.hpp"
 #include "../core/result.hpp"
+#include "../core/sfinae.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../system/byte_order.hpp"
+#include "image_format.hpp"
 
 namespace cen {
 
@@ -136,6 +147,36 @@ class file final
   file(const std::string& path, const file_mode mode) noexcept : file{path.c_str(), mode}
   {}
 
+  /**
+   * \brief Creates a read-only file that refers to a block of memory.
+   *
+   * \details The memory isn't copied, so it must outlive the returned file. This makes it
+   * possible to use the `SDL_RWops` based loading functions with data that is already in
+   * memory, e.g. data that was obtained from an archive or over the network.
+   *
+   * \param data a pointer to the first byte of the memory.
+   * \param size the amount of bytes in the memory block.
+   *
+   * \return a file that reads the memory block; a null file if the block is larger than
+   * `INT_MAX` bytes or if the file couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto from_memory(const not_null<const void*> data,
+                                        const size_type size) noexcept -> file
+  {
+    assert(data);
+
+    // The size parameter of SDL_RWFromConstMem is an int
+    if (size > static_cast<size_type>(INT_MAX))
+    {
+      SDL_SetError("The memory block is too large to be opened as a file!");
+      return file{nullptr};
+    }
+
+    return file{SDL_RWFromConstMem(data, static_cast<int>(size))};
+  }
+
   /// \} End of construction
 
   /// \name Write API
@@ -324,6 +365,88 @@ class file final
     return SDL_WriteBE64(m_context.get(), value) == 1;
   }
 
+  /**
+   * \brief Writes an array of values to the file, as little endian values.
+   *
+   * \details The values are written in a single call if the native byte order is little
+   * endian. Otherwise, they are swapped in blocks with SIMD instructions, and each block
+   * is written in a single call.
+   *
+   * \details Points, rectangles, areas, 3D vectors and colors are written as arrays of
+   * their components, which is much faster than serializing them one at a time.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param data the values that will be written.
+   * \param count the amount of values that will be written.
+   *
+   * \return the number of values that were written.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto write_as_little_endian(const T* data, const size_type count) noexcept
+      -> size_type
+  {
+    return write_endian<SDL_BYTEORDER == SDL_BIG_ENDIAN>(data, count);
+  }
+
+  /// \copydoc write_as_little_endian(const T*, size_type)
+  template <typename T, size_type size>
+  auto write_as_little_endian(const T (&data)[size]) noexcept -> size_type
+  {
+    return write_as_little_endian(data, size);
+  }
+
+  /// \copydoc write_as_little_endian(const T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto write_as_little_endian(const Container& container) noexcept(
+      noexcept(container.data()) && noexcept(container.size())) -> size_type
+  {
+    return write_as_little_endian(container.data(), container.size());
+  }
+
+  /**
+   * \brief Writes an array of values to the file, as big endian values.
+   *
+   * \details The values are written in a single call if the native byte order is big
+   * endian. Otherwise, they are swapped in blocks with SIMD instructions, and each block
+   * is written in a single call.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param data the values that will be written.
+   * \param count the amount of values that will be written.
+   *
+   * \return the number of values that were written.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto write_as_big_endian(const T* data, const size_type count) noexcept -> size_type
+  {
+    return write_endian<SDL_BYTEORDER == SDL_LIL_ENDIAN>(data, count);
+  }
+
+  /// \copydoc write_as_big_endian(const T*, size_type)
+  template <typename T, size_type size>
+  auto write_as_big_endian(const T (&data)[size]) noexcept -> size_type
+  {
+    return write_as_big_endian(data, size);
+  }
+
+  /// \copydoc write_as_big_endian(const T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto write_as_big_endian(const Container& container) noexcept(
+      noexcept(container.data()) && noexcept(container.size())) -> size_type
+  {
+    return write_as_big_endian(container.data(), container.size());
+  }
+
   /// \} End of write API
 
   /// \name Read API
@@ -529,11 +652,131 @@ class file final
     return SDL_ReadBE64(m_context.get());
   }
 
+  /**
+   * \brief Reads an array of little endian values from the file.
+   *
+   * \details The values are read in a single call and, if the native byte order is big
+   * endian, swapped in place with SIMD instructions.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param[out] data the pointer to which the read values will be written to.
+   * \param maxCount the maximum number of values that will be read.
+   *
+   * \return the number of values that were read, in the native byte order.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, detail::enable_if_binary_layout_t<T> = 0>
+  auto read_little_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    const auto count = read_to(data, maxCount);
+    swap_little_endian(data, count);
+
+    return count;
+  }
+
+  /// \copydoc read_little_endian_to(T*, size_type)
+  template <typename T, size_type size, detail::enable_if_binary_layout_t<T> = 0>
+  auto read_little_endian_to(T (&data)[size]) noexcept -> size_type
+  {
+    return read_little_endian_to(data, size);
+  }
+
+  /// \copydoc read_little_endian_to(T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto read_little_endian_to(Container& container) noexcept(
+      noexcept(container.data()) && noexcept(container.size())) -> size_type
+  {
+    return read_little_endian_to(container.data(), container.size());
+  }
+
+  /**
+   * \brief Reads an array of big endian values from the file.
+   *
+   * \details The values are read in a single call and, if the native byte order is
+   * little endian, swapped in place with SIMD instructions.
+   *
+   * \pre the internal file context must not be null.
+   *
+   * \tparam T the type of the values, e.g. `u32`, `fpoint`, `irect` or `color`.
+   *
+   * \param[out] data the pointer to which the read values will be written to.
+   * \param maxCount the maximum number of values that will be read.
+   *
+   * \return the number of values that were read, in the native byte order.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, detail::enable_if_binary_layout_t<T> = 0>
+  auto read_big_endian_to(T* data, const size_type maxCount) noexcept -> size_type
+  {
+    const auto count = read_to(data, maxCount);
+    swap_big_endian(data, count);
+
+    return count;
+  }
+
+  /// \copydoc read_big_endian_to(T*, size_type)
+  template <typename T, size_type size, detail::enable_if_binary_layout_t<T> = 0>
+  auto read_big_endian_to(T (&data)[size]) noexcept -> size_type
+  {
+    return read_big_endian_to(data, size);
+  }
+
+  /// \copydoc read_big_endian_to(T*, size_type)
+  template <typename Container, enable_if_container_t<Container> = 0>
+  auto read_big_endian_to(Container& container) noexcept(
+      noexcept(container.data()) && noexcept(container.size())) -> size_type
+  {
+    return read_big_endian_to(container.data(), container.size());
+  }
+
   /// \} End of read API
 
   /// \name File type queries
   /// \{
 
+  /**
+   * \brief Detects the image format of the file.
+   *
+   * \details The header is read once, at the current offset, and all formats are checked
+   * against it, which is considerably cheaper than calling several of the `is_*()`
+   * functions, since each of them reads the header again. The offset is restored
+   * afterwards.
+   *
+   * \return the detected image format; `image_format::unknown` if it couldn't be detected
+   * or if the file couldn't be read.
+   *
+   * \see `probe_image()`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto probe() const noexcept -> image_format
+  {
+    assert(m_context);
+
+    const auto start = SDL_RWtell(m_context.get());
+    if (start == -1)
+    {
+      return image_format::unknown;
+    }
+
+    u8 header[image_probe_size];
+    const auto count = SDL_RWread(m_context.get(), header, 1, sizeof header);
+
+    if (SDL_RWseek(m_context.get(), start, RW_SEEK_SET) == -1)
+    {
+      return image_format::unknown;
+    }
+
+    return probe_image(header, count);
+  }
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
   /**
    * \brief Indicates whether or not the file represents a PNG image.
    *
@@ -714,6 +957,8 @@ class file final
     return IMG_isXV(m_context.get()) == 1;
   }
 
+#endif  // CENTURION_NO_SDL_IMAGE
+
   /// \} End of file type queries
 
   /**
@@ -801,6 +1046,23 @@ class file final
     return m_context.get();
   }
 
+  /**
+   * \brief Releases ownership of the internal file context.
+   *
+   * \details This is used to hand the context over to functions that close it, such as
+   * the `SDL_RWops` based loading functions when `freesrc` is non-zero. The file is null
+   * after this call.
+   *
+   * \return the internal file context, which must now be closed by the caller; can be
+   * null.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto release() noexcept -> owner<SDL_RWops*>
+  {
+    return m_context.release();
+  }
+
   /**
    * \brief Indicates whether or not the file holds a non-null pointer.
    *
@@ -823,6 +1085,43 @@ class file final
   };
   std::unique_ptr<SDL_RWops, deleter> m_context;
 
+  template <bool Swap, typename T>
+  auto write_endian(const T* data, const size_type count) noexcept -> size_type
+  {
+    static_assert(detail::has_binary_layout_v<T>,
+                  "The values must be arithmetic, or made up of arithmetic components!");
+    assert(m_context);
+
+    if constexpr (Swap && detail::binary_layout<T>::component_size != 1)
+    {
+      // The source is read-only, so the values are swapped in blocks on the stack
+      constexpr size_type blockSize = 4'096 / sizeof(T);
+      T block[blockSize];
+
+      size_type written = 0;
+      while (written < count)
+      {
+        const auto n = (std::min)(blockSize, count - written);
+        std::memcpy(block, data + written, n * sizeof(T));
+        swap_byte_order(block, n);
+
+        const auto result = SDL_RWwrite(m_context.get(), block, sizeof(T), n);
+        written += result;
+
+        if (result != n)
+        {
+          break;
+        }
+      }
+
+      return written;
+    }
+    else
+    {
+      return SDL_RWwrite(m_context.get(), data, sizeof(T), count);
+    }
+  }
+
   [[nodiscard]] static auto to_string(const file_mode mode) noexcept -> czstring
   {
     switch (mode)
@@ -0,0 +1,248 @@
+#ifndef CENTURION_IMAGE_FORMAT_HEADER
+#define CENTURION_IMAGE_FORMAT_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>      // size_t
+#include <cstring>      // memcmp
+#include <string_view>  // string_view
+
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \enum image_format
+ *
+ * \brief Provides values that represent the image formats that can be detected.
+ *
+ * \see `probe_image()`
+ * \see `file::probe()`
+ *
+ * \since 6.1.0
+ */
+enum class image_format
+{
+  unknown,  ///< The format couldn't be detected.
+  bmp,      ///< A Windows bitmap.
+  cur,      ///< A Windows cursor.
+  gif,      ///< A GIF image.
+  ico,      ///< A Windows icon.
+  jpg,      ///< A JPEG image.
+  lbm,      ///< An Interchange File Format bitmap.
+  pcx,      ///< A PCX image.
+  png,      ///< A PNG image.
+  pnm,      ///< A portable anymap image.
+  svg,      ///< An SVG image.
+  tif,      ///< A TIFF image.
+  webp,     ///< A WebP image.
+  xcf,      ///< A GIMP image.
+  xpm,      ///< An X pixmap.
+  xv        ///< An XV thumbnail.
+};
+
+/**
+ * \brief The amount of header bytes that are inspected by `probe_image()`.
+ *
+ * \details SVG images are only detected if an `<svg` tag occurs within these bytes.
+ *
+ * \since 6.1.0
+ */
+inline constexpr std::size_t image_probe_size = 512;
+
+/// \cond FALSE
+namespace detail {
+
+[[nodiscard]] inline auto has_signature(const u8* data,
+                                        const std::size_t size,
+                                        const std::string_view prefix,
+                                        const std::size_t offset = 0) noexcept -> bool
+{
+  return size >= offset + prefix.size() &&
+         std::memcmp(data + offset, prefix.data(), prefix.size()) == 0;
+}
+
+[[nodiscard]] inline auto contains_text(const u8* data,
+                                        const std::size_t size,
+                                        const std::string_view text) noexcept -> bool
+{
+  const std::string_view haystack{reinterpret_cast<const char*>(data), size};
+  return haystack.find(text) != std::string_view::npos;
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Detects the format of an image from its header bytes.
+ *
+ * \details The checks mirror those of the `IMG_is*()` functions, but all formats are
+ * checked in a single pass over the supplied bytes. This also makes it possible to
+ * detect the format of data that's already in memory, e.g. a mapped file. At most
+ * `image_probe_size` bytes are inspected.
+ *
+ * \param data a pointer to the first bytes of the image, can be null if `size` is zero.
+ * \param size the amount of available bytes.
+ *
+ * \return the detected image format; `image_format::unknown` if it couldn't be detected.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto probe_image(const void* data, std::size_t size) noexcept
+    -> image_format
+{
+  const auto* bytes = static_cast<const u8*>(data);
+  size = (size < image_probe_size) ? size : image_probe_size;
+
+  if (size < 2)
+  {
+    return image_format::unknown;
+  }
+
+  switch (bytes[0])
+  {
+    case 0x00: {
+      // ICO and CUR files have a reserved zero field, a type and a non-zero image count
+      if (size >= 6 && bytes[1] == 0x00 && bytes[3] == 0x00 &&
+          (bytes[4] != 0 || bytes[5] != 0))
+      {
+        if (bytes[2] == 0x01)
+        {
+          return image_format::ico;
+        }
+        else if (bytes[2] == 0x02)
+        {
+          return image_format::cur;
+        }
+      }
+
+      break;
+    }
+    case 0x0A: {
+      // The manufacturer, the version and either no encoding or run-length encoding
+      if (size >= 3 && bytes[1] == 5u && bytes[2] <= 1u)
+      {
+        return image_format::pcx;
+      }
+
+      break;
+    }
+    case 0x89: {
+      if (detail::has_signature(bytes, size, "\x89PNG\r\n\x1A\n"))
+      {
+        return image_format::png;
+      }
+
+      break;
+    }
+    case 0xFF: {
+      if (bytes[1] == 0xD8)
+      {
+        return image_format::jpg;
+      }
+
+      break;
+    }
+    case '/': {
+      if (detail::has_signature(bytes, size, "/* XPM */"))
+      {
+        return image_format::xpm;
+      }
+
+      break;
+    }
+    case 'B': {
+      if (bytes[1] == 'M')
+      {
+        return image_format::bmp;
+      }
+
+      break;
+    }
+    case 'F': {
+      if (detail::has_signature(bytes, size, "FORM") &&
+          (detail::has_signature(bytes, size, "PBM ", 8) ||
+           detail::has_signature(bytes, size, "ILBM", 8)))
+      {
+        return image_format::lbm;
+      }
+
+      break;
+    }
+    case 'G': {
+      if (detail::has_signature(bytes, size, "GIF87a") ||
+          detail::has_signature(bytes, size, "GIF89a"))
+      {
+        return image_format::gif;
+      }
+
+      break;
+    }
+    case 'I': {
+      if (detail::has_signature(bytes, size, std::string_view{"II*\0", 4}))
+      {
+        return image_format::tif;
+      }
+
+      break;
+    }
+    case 'M': {
+      if (detail::has_signature(bytes, size, std::string_view{"MM\0*", 4}))
+      {
+        return image_format::tif;
+      }
+
+      break;
+    }
+    case 'P': {
+      if (detail::has_signature(bytes, size, "P7 332"))
+      {
+        return image_format::xv;
+      }
+      else if (size >= 3 && bytes[1] >= '1' && bytes[1] <= '6' &&
+               (bytes[2] == ' ' || bytes[2] == '\t' || bytes[2] == '\r' ||
+                bytes[2] == '\n'))
+      {
+        return image_format::pnm;
+      }
+
+      break;
+    }
+    case 'R': {
+      if (detail::has_signature(bytes, size, "RIFF") &&
+          detail::has_signature(bytes, size, "WEBPVP8", 8))
+      {
+        return image_format::webp;
+      }
+
+      break;
+    }
+    case 'g': {
+      if (detail::has_signature(bytes, size, "gimp xcf"))
+      {
+        return image_format::xcf;
+      }
+
+      break;
+    }
+    default:
+      break;
+  }
+
+  // SVG images are text, so the tag may be preceded by a declaration and comments
+  if (detail::contains_text(bytes, size, "<svg"))
+  {
+    return image_format::svg;
+  }
+
+  return image_format::unknown;
+}
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_IMAGE_FORMAT_HEADER
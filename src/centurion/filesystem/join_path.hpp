@@ -0,0 +1,144 @@
+#ifndef CENTURION_JOIN_PATH_HEADER
+#define CENTURION_JOIN_PATH_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>           // size_t
+#include <cstring>           // memcpy
+#include <initializer_list>  // initializer_list
+#include <optional>          // optional
+#include <string_view>       // string_view
+
+#include "../core/not_null.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \brief The preferred path separator of the platform.
+ *
+ * \since 6.1.0
+ */
+#ifdef _WIN32
+inline constexpr char path_separator = '\\';
+#else
+inline constexpr char path_separator = '/';
+#endif  // _WIN32
+
+/// \cond FALSE
+namespace detail {
+
+[[nodiscard]] constexpr auto is_path_separator(const char ch) noexcept -> bool
+{
+#ifdef _WIN32
+  return ch == '/' || ch == '\\';
+#else
+  return ch == '/';
+#endif  // _WIN32
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Joins path components into a caller-supplied buffer, without allocating memory.
+ *
+ * \details A path separator is inserted between two components, unless one of them
+ * already has a separator at the boundary. Empty components are ignored. This works well
+ * with the strings returned by `cached_base_path()`, which end with a separator.
+ * \code{cpp}
+ *   char buffer[256];
+ *   const auto path = cen::join_path(buffer, {cen::cached_base_path(), "images", name});
+ * \endcode
+ *
+ * \param buffer the buffer that the null-terminated path will be written to.
+ * \param size the size of the buffer, including space for the null terminator.
+ * \param components the components of the path.
+ *
+ * \return a view of the joined path in the buffer, which is null-terminated;
+ * `std::nullopt` if the path doesn't fit in the buffer, in which case the buffer holds an
+ * empty string.
+ *
+ * \since 6.1.0
+ */
+inline auto join_path(const not_null<char*> buffer,
+                      const std::size_t size,
+                      const std::initializer_list<std::string_view> components) noexcept
+    -> std::optional<std::string_view>
+{
+  if (size == 0)
+  {
+    return std::nullopt;
+  }
+
+  std::size_t length = 0;
+  for (auto component : components)
+  {
+    if (component.empty())
+    {
+      continue;
+    }
+
+    if (length != 0)
+    {
+      const auto hasSeparator = detail::is_path_separator(buffer[length - 1]);
+      if (hasSeparator && detail::is_path_separator(component.front()))
+      {
+        component.remove_prefix(1);
+      }
+      else if (!hasSeparator && !detail::is_path_separator(component.front()))
+      {
+        if (length + 1 >= size)
+        {
+          buffer[0] = '\0';
+          return std::nullopt;
+        }
+
+        buffer[length++] = path_separator;
+      }
+    }
+
+    if (component.size() >= size - length)
+    {
+      buffer[0] = '\0';
+      return std::nullopt;
+    }
+
+    std::memcpy(buffer + length, component.data(), component.size());
+    length += component.size();
+  }
+
+  buffer[length] = '\0';
+  return std::string_view{buffer, length};
+}
+
+/**
+ * \brief Joins path components into an array, without allocating memory.
+ *
+ * \copydetails join_path(not_null<char*>, std::size_t, std::initializer_list<std::string_view>)
+ *
+ * \tparam Size the size of the array.
+ *
+ * \param buffer the array that the null-terminated path will be written to.
+ * \param components the components of the path.
+ *
+ * \return a view of the joined path in the array, which is null-terminated;
+ * `std::nullopt` if the path doesn't fit in the array.
+ *
+ * \since 6.1.0
+ */
+template <std::size_t Size>
+auto join_path(char (&buffer)[Size],
+               const std::initializer_list<std::string_view> components) noexcept
+    -> std::optional<std::string_view>
+{
+  return join_path(buffer, Size, components);
+}
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_JOIN_PATH_HEADER
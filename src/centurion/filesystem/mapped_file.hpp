@@ -0,0 +1,563 @@
+#ifndef CENTURION_MAPPED_FILE_HEADER
+#define CENTURION_MAPPED_FILE_HEADER
+
+#include <SDL.h>
+
+#include <climits>  // INT_MAX
+#include <cstddef>  // size_t, byte
+#include <memory>   // make_unique
+#include <string>   // string
+#include <utility>  // exchange
+
+#if defined(_WIN32)
+#include "../detail/windows_api.hpp"  // CreateFileA, MapViewOfFile, ...
+#elif defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, munmap
+#include <sys/stat.h>  // fstat
+#include <unistd.h>    // close, sysconf
+#endif
+
+#ifdef __ANDROID__
+#include <android/asset_manager.h>      // AAssetManager_open, AAsset_openFileDescriptor64
+#include <android/asset_manager_jni.h>  // AAssetManager_fromJava
+#include <jni.h>                        // JNIEnv, jobject
+#endif  // __ANDROID__
+
+#include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/not_null.hpp"
+#include "../detail/rwops_adapter.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+#ifdef __ANDROID__
+
+/// \cond FALSE
+namespace detail {
+
+// The manager is only valid while its Java object is referenced, so a global reference
+// to the object is kept for the lifetime of the application
+[[nodiscard]] inline auto android_asset_manager() noexcept -> AAssetManager*
+{
+  static AAssetManager* const manager = []() -> AAssetManager* {
+    auto* env = static_cast<JNIEnv*>(SDL_AndroidGetJNIEnv());
+    auto activity = static_cast<jobject>(SDL_AndroidGetActivity());
+    if (!env || !activity)
+    {
+      return nullptr;
+    }
+
+    auto type = env->GetObjectClass(activity);
+    auto getAssets =
+        env->GetMethodID(type, "getAssets", "()Landroid/content/res/AssetManager;");
+    auto assets = getAssets ? env->CallObjectMethod(activity, getAssets) : nullptr;
+
+    AAssetManager* result{};
+    if (assets)
+    {
+      result = AAssetManager_fromJava(env, env->NewGlobalRef(assets));
+      env->DeleteLocalRef(assets);
+    }
+
+    env->DeleteLocalRef(type);
+    env->DeleteLocalRef(activity);
+
+    return result;
+  }();
+
+  return manager;
+}
+
+}  // namespace detail
+/// \endcond
+
+#endif  // __ANDROID__
+
+/// \cond FALSE
+namespace detail {
+
+// SDL_RWFromConstMem rejects empty ranges, so those are opened as files without bytes
+struct empty_mapped_range final
+{
+  static auto size(SDL_RWops*) noexcept -> Sint64
+  {
+    return 0;
+  }
+
+  static auto seek(SDL_RWops*, Sint64, int) noexcept -> Sint64
+  {
+    return 0;
+  }
+
+  static auto read(SDL_RWops*, void*, std::size_t, std::size_t) noexcept -> std::size_t
+  {
+    return 0;
+  }
+
+  static auto write(SDL_RWops*, const void*, std::size_t, std::size_t) noexcept
+      -> std::size_t
+  {
+    SDL_SetError("Mapped files can't be written to!");
+    return 0;
+  }
+
+  static auto close(SDL_RWops* context) noexcept -> int
+  {
+    delete &rwops_state<empty_mapped_range>(context);
+    SDL_FreeRW(context);
+    return 0;
+  }
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class mapped_file
+ *
+ * \brief A read-only view of a file that is mapped into memory.
+ *
+ * \details The contents of the file are paged in lazily by the operating system when
+ * they are accessed, instead of being copied into a buffer up front. This is useful for
+ * large files, such as asset packs, of which only parts are used.
+ *
+ * The mapped bytes can also be opened as a `file`, which makes it possible to load
+ * surfaces, fonts and music straight from the mapped pages by means of the `SDL_RWops`
+ * based loading functions of SDL.
+ * \code{cpp}
+ *   const cen::mapped_file pack{"assets.pak"};
+ *
+ *   auto entry = pack.open(offset, size);
+ *   cen::surface image{IMG_Load_RW(entry.get(), 0)};
+ * \endcode
+ *
+ * \note Memory-mapped files are supported on Windows and POSIX platforms. On Android,
+ * assets in the APK can be mapped with `from_android_asset()`.
+ *
+ * \since 6.1.0
+ */
+class mapped_file final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Maps a file into memory.
+   *
+   * \param path the path of the file.
+   *
+   * \throws cen_error if the file couldn't be opened or mapped, or if memory-mapped files
+   * aren't supported on the platform.
+   *
+   * \since 6.1.0
+   */
+  explicit mapped_file(const not_null<czstring> path)
+  {
+    map(path);
+  }
+
+  /// \copydoc mapped_file(not_null<czstring>)
+  explicit mapped_file(const std::string& path) : mapped_file{path.c_str()}
+  {}
+
+  mapped_file(const mapped_file&) = delete;
+
+  auto operator=(const mapped_file&) -> mapped_file& = delete;
+
+  mapped_file(mapped_file&& other) noexcept
+      : m_data{std::exchange(other.m_data, nullptr)}
+      , m_size{std::exchange(other.m_size, 0)}
+      , m_padding{std::exchange(other.m_padding, 0)}
+#ifdef __ANDROID__
+      , m_asset{std::exchange(other.m_asset, nullptr)}
+#endif  // __ANDROID__
+  {}
+
+  auto operator=(mapped_file&& other) noexcept -> mapped_file&
+  {
+    if (this != &other)
+    {
+      unmap();
+      m_data = std::exchange(other.m_data, nullptr);
+      m_size = std::exchange(other.m_size, 0);
+      m_padding = std::exchange(other.m_padding, 0);
+#ifdef __ANDROID__
+      m_asset = std::exchange(other.m_asset, nullptr);
+#endif  // __ANDROID__
+    }
+
+    return *this;
+  }
+
+  ~mapped_file() noexcept
+  {
+    unmap();
+  }
+
+#ifdef __ANDROID__
+
+  /**
+   * \brief Maps an asset of the APK of the application into memory.
+   *
+   * \details Loading assets with `file` and a path goes through the `SDL_RWops` of the
+   * Android asset manager, which reads the asset in small chunks. Assets that are stored
+   * uncompressed in the APK are instead mapped directly from the APK, so they are paged
+   * in when they are accessed, without any intermediate buffers. Compressed assets are
+   * decompressed into memory by the asset manager, so large assets, such as asset packs,
+   * should be excluded from compression by the build, e.g. with `noCompress`.
+   * \code{cpp}
+   *   const cen::asset_pack pack{cen::mapped_file::from_android_asset("assets.pak")};
+   * \endcode
+   *
+   * \param name the path of the asset, relative to the assets directory of the APK.
+   *
+   * \return the mapped asset.
+   *
+   * \throws cen_error if the asset manager isn't available, or if the asset couldn't be
+   * opened or mapped.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto from_android_asset(const not_null<czstring> name)
+      -> mapped_file
+  {
+    auto* manager = detail::android_asset_manager();
+    if (!manager)
+    {
+      throw cen_error{"Failed to obtain the Android asset manager!"};
+    }
+
+    auto* asset = AAssetManager_open(manager, name, AASSET_MODE_RANDOM);
+    if (!asset)
+    {
+      throw cen_error{"Failed to open Android asset!"};
+    }
+
+    mapped_file result;
+
+    off64_t start{};
+    off64_t length{};
+    const auto descriptor = AAsset_openFileDescriptor64(asset, &start, &length);
+    if (descriptor >= 0)
+    {
+      AAsset_close(asset);
+      result.map_range(descriptor, static_cast<size_type>(start), length);
+    }
+    else if (AAsset_getLength64(asset) == 0)
+    {
+      AAsset_close(asset);  // Empty assets have no buffer
+    }
+    else
+    {
+      // The asset is compressed, so the manager keeps a decompressed copy while it's open
+      const auto* buffer = AAsset_getBuffer(asset);
+      if (!buffer)
+      {
+        AAsset_close(asset);
+        throw cen_error{"Failed to read Android asset!"};
+      }
+
+      result.m_data = static_cast<const std::byte*>(buffer);
+      result.m_size = static_cast<size_type>(AAsset_getLength64(asset));
+      result.m_asset = asset;
+    }
+
+    return result;
+  }
+
+#endif  // __ANDROID__
+
+  /**
+   * \brief Opens the mapped bytes as a read-only file, without copying them.
+   *
+   * \details The returned file refers to the mapped memory, so it must not outlive the
+   * mapped file. Empty ranges, such as the contents of an empty file, are opened as
+   * files without any bytes.
+   *
+   * \param offset the offset of the first byte of the file.
+   * \param size the amount of bytes in the file.
+   *
+   * \return a file that reads the specified range of the mapped bytes.
+   *
+   * \throws cen_error if the range is out of bounds, or larger than `INT_MAX` bytes.
+   * \throws sdl_error if the file couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto open(const size_type offset, const size_type size) const -> file
+  {
+    if (offset > m_size || size > m_size - offset)
+    {
+      throw cen_error{"The range is outside of the mapped file!"};
+    }
+
+    // The size parameter of SDL_RWFromConstMem is an int
+    if (size > static_cast<size_type>(INT_MAX))
+    {
+      throw cen_error{"The range is too large to be opened as a file!"};
+    }
+
+    auto result = (size == 0)
+                      ? detail::make_rwops(std::make_unique<detail::empty_mapped_range>())
+                      : file{SDL_RWFromConstMem(m_data + offset, static_cast<int>(size))};
+    if (!result)
+    {
+      throw sdl_error{};
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Opens all mapped bytes as a read-only file, without copying them.
+   *
+   * \copydetails open(size_type, size_type)
+   *
+   * \return a file that reads the mapped bytes.
+   *
+   * \throws cen_error if the file is larger than `INT_MAX` bytes.
+   * \throws sdl_error if the file couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto open() const -> file
+  {
+    return open(0, m_size);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a pointer to the mapped bytes.
+   *
+   * \return a pointer to the first byte; null if the file is empty.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const std::byte*
+  {
+    return m_data;
+  }
+
+  /**
+   * \brief Returns the size of the mapped file.
+   *
+   * \return the amount of mapped bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Indicates whether or not the mapped file is empty.
+   *
+   * \return `true` if there are no mapped bytes; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Returns an iterator to the first mapped byte.
+   *
+   * \return an iterator to the first byte.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto begin() const noexcept -> const std::byte*
+  {
+    return m_data;
+  }
+
+  /**
+   * \brief Returns an iterator one past the last mapped byte.
+   *
+   * \return an iterator one past the last byte.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto end() const noexcept -> const std::byte*
+  {
+    return m_data + m_size;
+  }
+
+  /// \} End of queries
+
+ private:
+  const std::byte* m_data{};
+  size_type m_size{};
+  size_type m_padding{};  // The distance between the mapping and the data
+
+#ifdef __ANDROID__
+  AAsset* m_asset{};  // Owns the data of compressed assets
+#endif  // __ANDROID__
+
+  mapped_file() noexcept = default;
+
+#if defined(_WIN32)
+
+  void map(const czstring path)
+  {
+    const auto handle = CreateFileA(path,
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL,
+                                    nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+      throw cen_error{"Failed to open file!"};
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(handle, &size))
+    {
+      CloseHandle(handle);
+      throw cen_error{"Failed to obtain file size!"};
+    }
+
+    m_size = static_cast<size_type>(size.QuadPart);
+    if (m_size == 0)
+    {
+      CloseHandle(handle);
+      return;  // Empty files can't be mapped
+    }
+
+    const auto mapping =
+        CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(handle);
+
+    if (!mapping)
+    {
+      m_size = 0;
+      throw cen_error{"Failed to create file mapping!"};
+    }
+
+    // The view keeps the mapping alive, so the handle can be closed right away
+    auto* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+
+    m_data = static_cast<const std::byte*>(view);
+
+    if (!m_data)
+    {
+      m_size = 0;
+      throw cen_error{"Failed to map file!"};
+    }
+  }
+
+  void unmap() noexcept
+  {
+    if (m_data)
+    {
+      UnmapViewOfFile(m_data);
+    }
+  }
+
+#elif defined(__unix__) || defined(__APPLE__)
+
+  void map(const czstring path)
+  {
+    const auto descriptor = ::open(path, O_RDONLY);
+    if (descriptor == -1)
+    {
+      throw cen_error{"Failed to open file!"};
+    }
+
+    struct stat info{};
+    if (fstat(descriptor, &info) == -1)
+    {
+      ::close(descriptor);
+      throw cen_error{"Failed to obtain file size!"};
+    }
+
+    m_size = static_cast<size_type>(info.st_size);
+    if (m_size == 0)
+    {
+      ::close(descriptor);
+      return;  // Empty files can't be mapped
+    }
+
+    map_range(descriptor, 0, static_cast<off_t>(m_size));
+  }
+
+  // Maps a range of an open file, and closes the descriptor
+  void map_range(const int descriptor, const size_type offset, const off_t size)
+  {
+    m_size = static_cast<size_type>(size);
+    if (m_size == 0)
+    {
+      ::close(descriptor);
+      return;
+    }
+
+    // Mappings must start at a page boundary, e.g. for entries in the middle of an APK
+    const auto pageSize = static_cast<size_type>(sysconf(_SC_PAGESIZE));
+    m_padding = offset % pageSize;
+
+    // The mapping stays valid after the descriptor has been closed
+    auto* memory = mmap(nullptr,
+                        m_size + m_padding,
+                        PROT_READ,
+                        MAP_PRIVATE,
+                        descriptor,
+                        static_cast<off_t>(offset - m_padding));
+    ::close(descriptor);
+
+    if (memory == MAP_FAILED)
+    {
+      m_size = 0;
+      m_padding = 0;
+      throw cen_error{"Failed to map file!"};
+    }
+
+    m_data = static_cast<const std::byte*>(memory) + m_padding;
+  }
+
+  void unmap() noexcept
+  {
+#ifdef __ANDROID__
+    if (m_asset)
+    {
+      AAsset_close(m_asset);
+      return;
+    }
+#endif  // __ANDROID__
+
+    if (m_data)
+    {
+      munmap(const_cast<std::byte*>(m_data - m_padding), m_size + m_padding);
+    }
+  }
+
+#else
+
+  void map(czstring)
+  {
+    throw cen_error{"Memory-mapped files aren't supported on this platform!"};
+  }
+
+  void unmap() noexcept
+  {}
+
+#endif  // defined(_WIN32)
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_MAPPED_FILE_HEADER
@@ -0,0 +1,177 @@
+#ifndef CENTURION_PATH_CACHE_HEADER
+#define CENTURION_PATH_CACHE_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <deque>    // deque
+#include <string>   // string
+#include <vector>   // vector
+
+#include "../core/czstring.hpp"
+#include "../core/not_null.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/spin_mutex.hpp"
+#include "base_path.hpp"
+#include "preferred_path.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+class path_cache final
+{
+ public:
+  [[nodiscard]] static auto get() -> path_cache&
+  {
+    static path_cache cache;
+    return cache;
+  }
+
+  [[nodiscard]] auto base() -> const std::string&
+  {
+    scoped_lock lock{m_mutex};
+
+    if (!m_base)
+    {
+      const auto path = cen::base_path();
+      if (!path)
+      {
+        return m_empty;  // Not cached, so that the next call tries again
+      }
+
+      m_base = &m_strings.emplace_back(path.get());
+    }
+
+    return *m_base;
+  }
+
+  [[nodiscard]] auto preferred(const czstring org, const czstring app)
+      -> const std::string&
+  {
+    scoped_lock lock{m_mutex};
+
+    for (const auto& entry : m_preferred)
+    {
+      if (entry.org == org && entry.app == app)
+      {
+        return *entry.path;
+      }
+    }
+
+    const auto path = cen::preferred_path(org, app);
+    if (!path)
+    {
+      return m_empty;
+    }
+
+    const auto& stored = m_strings.emplace_back(path.get());
+    m_preferred.push_back({org, app, &stored});
+
+    return stored;
+  }
+
+  void invalidate()
+  {
+    scoped_lock lock{m_mutex};
+
+    m_base = nullptr;
+    m_preferred.clear();
+  }
+
+ private:
+  struct preferred_entry final
+  {
+    std::string org;
+    std::string app;
+    const std::string* path{};
+  };
+
+  spin_mutex m_mutex;
+  std::deque<std::string> m_strings;  // Never shrinks, so that references stay valid
+  std::vector<preferred_entry> m_preferred;
+  const std::string* m_base{};
+  const std::string m_empty;
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Returns the base path of the application, which is only obtained once.
+ *
+ * \details Unlike `base_path()`, which queries the operating system and allocates a new
+ * string every time it's called, the path is cached the first time this function
+ * succeeds. This makes it cheap to call while building asset paths. This function is
+ * thread-safe.
+ *
+ * \return the base path of the application, the reference remains valid for the rest of
+ * the program, even after `invalidate_path_cache()`; an empty string if the path couldn't
+ * be obtained.
+ *
+ * \see `base_path()`
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto cached_base_path() -> const std::string&
+{
+  return detail::path_cache::get().base();
+}
+
+/**
+ * \brief Returns the preferred path for storing files, which is only obtained once for
+ * each organization and application.
+ *
+ * \details The directory is created by SDL the first time the path is obtained. This
+ * function is thread-safe.
+ *
+ * \param org the name of the organization, mustn't be null.
+ * \param app the name of the application, mustn't be null.
+ *
+ * \return the preferred path, the reference remains valid for the rest of the program,
+ * even after `invalidate_path_cache()`; an empty string if the path couldn't be obtained.
+ *
+ * \see `preferred_path()`
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto cached_preferred_path(const not_null<czstring> org,
+                                                const not_null<czstring> app)
+    -> const std::string&
+{
+  assert(org);
+  assert(app);
+  return detail::path_cache::get().preferred(org, app);
+}
+
+/// \copydoc cached_preferred_path(not_null<czstring>, not_null<czstring>)
+[[nodiscard]] inline auto cached_preferred_path(const std::string& org,
+                                                const std::string& app)
+    -> const std::string&
+{
+  return cached_preferred_path(org.c_str(), app.c_str());
+}
+
+/**
+ * \brief Discards the cached paths, which are obtained again when they're next requested.
+ *
+ * \details This is useful if the paths may have changed, e.g. if the preferred path
+ * directory was removed. Previously returned references remain valid, but refer to the
+ * old paths.
+ *
+ * \since 6.1.0
+ */
+inline void invalidate_path_cache()
+{
+  detail::path_cache::get().invalidate();
+}
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_PATH_CACHE_HEADER
@@ -0,0 +1,323 @@
+#ifndef CENTURION_READ_AHEAD_FILE_HEADER
+#define CENTURION_READ_AHEAD_FILE_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // min
+#include <cstddef>    // size_t
+#include <cstring>    // memcpy
+#include <memory>     // unique_ptr, make_unique
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../detail/rwops_adapter.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/thread.hpp"
+#include "file.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+/*
+ * The buffer is a ring of bytes that the worker fills ahead of the reader. The buffered
+ * bytes start at the head, and the worker appends bytes after them. The worker reads from
+ * the source without holding the lock, which is safe since the reader never touches the
+ * free part of the ring, and seeking waits until the worker isn't reading.
+ */
+class read_ahead_reader final
+{
+ public:
+  read_ahead_reader(file&& source, const std::size_t bufferSize)
+      : m_source{std::move(source)}
+      , m_buffer(bufferSize)
+      , m_chunkSize{(std::max)(bufferSize / 4, std::size_t{1})}
+      , m_offset{m_source.offset()}
+      , m_size{SDL_RWsize(m_source.get())}
+  {}
+
+  read_ahead_reader(const read_ahead_reader&) = delete;
+
+  auto operator=(const read_ahead_reader&) -> read_ahead_reader& = delete;
+
+  // The worker uses the state, so it must have stopped before the state is destroyed
+  ~read_ahead_reader() noexcept
+  {
+    if (m_worker)
+    {
+      m_mutex.lock();
+      m_stopping = true;
+      m_changed.broadcast();
+      m_mutex.unlock();
+
+      m_worker->join();
+    }
+  }
+
+  void start()
+  {
+    m_worker = std::make_unique<thread>(&read_ahead_reader::run, "read-ahead", this);
+  }
+
+  static auto size(SDL_RWops* context) noexcept -> Sint64
+  {
+    const auto& self = rwops_state<read_ahead_reader>(context);
+    if (self.m_size < 0)
+    {
+      return SDL_SetError("The size of the file is unknown!");
+    }
+
+    return self.m_size;
+  }
+
+  static auto seek(SDL_RWops* context, const Sint64 offset, const int whence) noexcept
+      -> Sint64
+  {
+    auto& self = rwops_state<read_ahead_reader>(context);
+    self.m_mutex.lock();
+
+    Sint64 target;
+    if (whence == RW_SEEK_SET)
+    {
+      target = offset;
+    }
+    else if (whence == RW_SEEK_CUR)
+    {
+      target = self.m_offset + offset;
+    }
+    else if (self.m_size >= 0)
+    {
+      target = self.m_size + offset;
+    }
+    else
+    {
+      self.m_mutex.unlock();
+      return SDL_SetError("The size of the file is unknown!");
+    }
+
+    if (target < 0)
+    {
+      self.m_mutex.unlock();
+      return SDL_SetError("Can't seek to a negative offset!");
+    }
+
+    const auto buffered = static_cast<Sint64>(self.m_count);
+    if (target >= self.m_offset && target - self.m_offset <= buffered)
+    {
+      // Skipping forward within the buffered bytes requires no reading, e.g. when the
+      // offset is queried
+      self.consume(static_cast<std::size_t>(target - self.m_offset));
+      self.m_mutex.unlock();
+      return target;
+    }
+
+    while (self.m_reading)
+    {
+      self.m_changed.wait(self.m_mutex);
+    }
+
+    if (SDL_RWseek(self.m_source.get(), target, RW_SEEK_SET) < 0)
+    {
+      self.m_mutex.unlock();
+      return -1;
+    }
+
+    self.m_head = 0;
+    self.m_count = 0;
+    self.m_offset = target;
+    self.m_ended = false;
+
+    self.m_changed.broadcast();
+    self.m_mutex.unlock();
+
+    return target;
+  }
+
+  static auto read(SDL_RWops* context,
+                   void* data,
+                   const std::size_t size,
+                   const std::size_t count) noexcept -> std::size_t
+  {
+    auto& self = rwops_state<read_ahead_reader>(context);
+    if (size == 0)
+    {
+      return 0;
+    }
+
+    auto* bytes = static_cast<u8*>(data);
+    const auto total = size * count;
+
+    std::size_t copied = 0;
+    self.m_mutex.lock();
+
+    while (copied < total)
+    {
+      // Blocking only happens if the reader has caught up with the worker
+      while (self.m_count == 0 && !self.m_ended)
+      {
+        self.m_changed.wait(self.m_mutex);
+      }
+
+      if (self.m_count == 0)
+      {
+        break;
+      }
+
+      const auto capacity = self.m_buffer.size();
+      const auto contiguous = (std::min)(self.m_count, capacity - self.m_head);
+      const auto n = (std::min)(total - copied, contiguous);
+
+      std::memcpy(bytes + copied, self.m_buffer.data() + self.m_head, n);
+      self.consume(n);
+
+      copied += n;
+    }
+
+    self.m_mutex.unlock();
+    return copied / size;
+  }
+
+  static auto write(SDL_RWops*, const void*, std::size_t, std::size_t) noexcept
+      -> std::size_t
+  {
+    SDL_SetError("Read-ahead files can't be written to!");
+    return 0;
+  }
+
+  static auto close(SDL_RWops* context) noexcept -> int
+  {
+    delete &rwops_state<read_ahead_reader>(context);
+    SDL_FreeRW(context);
+    return 0;
+  }
+
+ private:
+  file m_source;
+  std::vector<u8> m_buffer;
+  std::size_t m_chunkSize{};  // The maximum amount of bytes read by the worker at a time
+  std::size_t m_head{};       // The index of the first buffered byte
+  std::size_t m_count{};      // The amount of buffered bytes
+  Sint64 m_offset{};          // The offset of the reader, i.e. of the first buffered byte
+  Sint64 m_size{};
+  bool m_ended{};             // Whether the worker reached the end of the source
+  bool m_reading{};           // Whether the worker is reading from the source
+  bool m_stopping{};
+  mutex m_mutex;
+  condition m_changed;  // Signalled whenever the state of the buffer changes
+  std::unique_ptr<thread> m_worker;
+
+  void consume(const std::size_t n) noexcept
+  {
+    m_head = (m_head + n) % m_buffer.size();
+    m_count -= n;
+    m_offset += static_cast<Sint64>(n);
+
+    m_changed.broadcast();  // Wakes the worker, since there is room for more bytes
+  }
+
+  static auto run(void* data) -> int
+  {
+    auto& self = *static_cast<read_ahead_reader*>(data);
+    const auto capacity = self.m_buffer.size();
+
+    self.m_mutex.lock();
+    for (;;)
+    {
+      while (!self.m_stopping && (self.m_ended || self.m_count == capacity))
+      {
+        self.m_changed.wait(self.m_mutex);
+      }
+
+      if (self.m_stopping)
+      {
+        break;
+      }
+
+      const auto tail = (self.m_head + self.m_count) % capacity;
+      const auto space = (std::min)(capacity - self.m_count, capacity - tail);
+      const auto n = (std::min)(space, self.m_chunkSize);
+
+      self.m_reading = true;
+      self.m_mutex.unlock();
+
+      const auto received = self.m_source.read_to(self.m_buffer.data() + tail, n);
+
+      self.m_mutex.lock();
+      self.m_reading = false;
+
+      if (received == 0)
+      {
+        self.m_ended = true;  // Either the end of the source, or an error
+      }
+      else
+      {
+        self.m_count += received;
+      }
+
+      self.m_changed.broadcast();
+    }
+
+    self.m_mutex.unlock();
+    return 0;
+  }
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Opens a file that reads ahead of its reader on a background thread.
+ *
+ * \details A worker thread reads from the source file into a ring buffer, ahead of the
+ * offset of the returned file, so reading from the returned file only copies bytes that
+ * are already in memory. This is useful for data that is read incrementally on a thread
+ * that must not block on storage, e.g. music that is decoded on the audio thread.
+ * \code{cpp}
+ *   cen::file source{"music/theme.ogg", cen::file_mode::read_binary};
+ *   cen::music theme{cen::make_read_ahead_file(std::move(source))};
+ * \endcode
+ *
+ * \details Seeking forward within the buffered bytes is free, other seeks discard the
+ * buffer and wait for the worker to finish its current read. Reads only block if the
+ * reader catches up with the worker.
+ *
+ * \note The returned file only supports reading, seeking and querying its size. The
+ * source file must not be used by anything else, and the returned file must not be used
+ * by more than one thread at a time.
+ *
+ * \param source the file that will be read from, ownership is claimed.
+ * \param bufferSize the size of the ring buffer, in bytes.
+ *
+ * \return a file that reads ahead of its reader; a null file if `source` is null or the
+ * buffer size is zero.
+ *
+ * \throws sdl_error if the worker thread can't be created.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto make_read_ahead_file(file&& source,
+                                               const std::size_t bufferSize = 262'144)
+    -> file
+{
+  if (!source || bufferSize == 0)
+  {
+    return file{nullptr};
+  }
+
+  auto state = std::make_unique<detail::read_ahead_reader>(std::move(source), bufferSize);
+  state->start();
+
+  return detail::make_rwops(std::move(state));
+}
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_READ_AHEAD_FILE_HEADER
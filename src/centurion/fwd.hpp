@@ -0,0 +1,148 @@
+#ifndef CENTURION_FWD_HEADER
+#define CENTURION_FWD_HEADER
+
+#include <type_traits>  // true_type, false_type
+
+/**
+ * \file fwd.hpp
+ *
+ * \brief Provides forward declarations of the most commonly used types.
+ *
+ * \details This header doesn't include any SDL headers, so it's intended to be used by
+ * headers that only refer to the library types by reference or pointer, which keeps the
+ * parsing cost of the library confined to the translation units that actually use it.
+ *
+ * \since 6.1.0
+ */
+
+namespace cen {
+
+/// \cond FALSE
+namespace detail {
+
+// Redeclarations of the tag types in owner_handle_api.hpp
+using owning_type = std::true_type;
+using handle_type = std::false_type;
+
+}  // namespace detail
+/// \endcond
+
+// Math
+
+template <typename T>
+struct basic_area;
+
+template <typename T>
+class basic_point;
+
+template <typename T>
+class basic_rect;
+
+using iarea = basic_area<int>;
+using farea = basic_area<float>;
+using darea = basic_area<double>;
+
+using ipoint = basic_point<int>;
+using fpoint = basic_point<float>;
+
+using irect = basic_rect<int>;
+using frect = basic_rect<float>;
+
+// Core
+
+class library;
+
+// Audio
+
+class music;
+
+template <typename T>
+class basic_sound_effect;
+
+using sound_effect = basic_sound_effect<detail::owning_type>;
+using sound_effect_handle = basic_sound_effect<detail::handle_type>;
+
+// Events
+
+class event;
+class window_event;
+
+template <typename... E>
+class event_dispatcher;
+
+// Input
+
+class key_code;
+class scan_code;
+class keyboard;
+class mouse;
+
+template <typename T>
+class basic_controller;
+
+template <typename T>
+class basic_joystick;
+
+template <typename T>
+class basic_haptic;
+
+template <typename T>
+class basic_sensor;
+
+using controller = basic_controller<detail::owning_type>;
+using controller_handle = basic_controller<detail::handle_type>;
+
+using joystick = basic_joystick<detail::owning_type>;
+using joystick_handle = basic_joystick<detail::handle_type>;
+
+using haptic = basic_haptic<detail::owning_type>;
+using haptic_handle = basic_haptic<detail::handle_type>;
+
+using sensor = basic_sensor<detail::owning_type>;
+using sensor_handle = basic_sensor<detail::handle_type>;
+
+// Video
+
+class color;
+class font;
+class palette;
+
+template <typename T>
+class basic_window;
+
+template <typename T>
+class basic_renderer;
+
+template <typename T>
+class basic_texture;
+
+template <typename T>
+class basic_surface;
+
+template <typename T>
+class basic_cursor;
+
+template <typename T>
+class basic_pixel_format_info;
+
+using window = basic_window<detail::owning_type>;
+using window_handle = basic_window<detail::handle_type>;
+
+using renderer = basic_renderer<detail::owning_type>;
+using renderer_handle = basic_renderer<detail::handle_type>;
+
+using texture = basic_texture<detail::owning_type>;
+using texture_handle = basic_texture<detail::handle_type>;
+
+using surface = basic_surface<detail::owning_type>;
+using surface_handle = basic_surface<detail::handle_type>;
+
+using cursor = basic_cursor<detail::owning_type>;
+using cursor_handle = basic_cursor<detail::handle_type>;
+
+using pixel_format_info = basic_pixel_format_info<detail::owning_type>;
+using pixel_format_info_handle = basic_pixel_format_info<detail::handle_type>;
+
+}  // namespace cen
+
+#endif  // CENTURION_FWD_HEADER
@@ -0,0 +1,35 @@
+#ifndef CENTURION_HINTS_SUBSYSTEM_HEADER
+#define CENTURION_HINTS_SUBSYSTEM_HEADER
+
+/**
+ * \file hints.hpp
+ *
+ * \brief Includes all headers of the hints subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "hints/android_hints.hpp"
+#include "hints/apple_tv_hints.hpp"
+#include "hints/common_hints.hpp"
+#include "hints/controller_hints.hpp"
+#include "hints/d3d_hints.hpp"
+#include "hints/emscripten_hints.hpp"
+#include "hints/enum_hint.hpp"
+#include "hints/hint_cache.hpp"
+#include "hints/hint_profile.hpp"
+#include "hints/hints.hpp"
+#include "hints/joystick_hints.hpp"
+#include "hints/mac_hints.hpp"
+#include "hints/mouse_hints.hpp"
+#include "hints/qtwayland_hints.hpp"
+#include "hints/raspberry_pi_hints.hpp"
+#include "hints/windows_hints.hpp"
+#include "hints/winrt_hints.hpp"
+#include "hints/x11_hints.hpp"
+#include "hints/xinput_hints.hpp"
+
+#endif  // CENTURION_HINTS_SUBSYSTEM_HEADER
@@ -0,0 +1,159 @@
+#ifndef CENTURION_HINT_CACHE_HEADER
+#define CENTURION_HINT_CACHE_HEADER
+
+#include <SDL.h>
+
+#include <atomic>       // atomic
+#include <optional>     // optional
+#include <string>       // string
+#include <type_traits>  // is_same_v, conditional_t
+
+#include "../core/czstring.hpp"
+#include "hints.hpp"
+
+namespace cen {
+
+/// \addtogroup configuration
+/// \{
+
+/**
+ * \class cached_hint
+ *
+ * \brief Caches the parsed value of a hint until the hint changes.
+ *
+ * \details Obtaining the value of a hint with `get_hint()` looks up the hint by name and
+ * parses its string value on every call, which adds up for hints that are queried every
+ * frame. A cached hint instead parses the value on first use, and keeps it until it's
+ * notified through a hint callback that the hint has changed.
+ * \code{cpp}
+ *   const cen::cached_hint<cen::hint::mouse::relative_scaling> scaling;
+ *
+ *   // Every frame, cheap unless the hint was changed
+ *   if (scaling.get().value_or(false))
+ *   {
+ *     ...
+ *   }
+ * \endcode
+ *
+ * \details The values of string hints are copied into the cache, so the returned strings
+ * remain valid until the hint changes and the value is obtained again.
+ *
+ * \note Hints can be changed from any thread, in which case the cached value is
+ * invalidated from that thread, but the value itself must only be obtained from a single
+ * thread.
+ *
+ * \tparam Hint the type of the hint, e.g. `hint::render_driver`.
+ *
+ * \see `hint_callback`
+ *
+ * \since 6.1.0
+ */
+template <typename Hint>
+class cached_hint final
+{
+ public:
+  /// The type of the values returned by `get_hint<Hint>()`.
+  using value_type = decltype(Hint::current_value());
+
+  /**
+   * \brief Creates a cache, which registers a callback for the hint.
+   *
+   * \since 6.1.0
+   */
+  cached_hint() : m_callback{&on_changed, this}
+  {
+    m_callback.connect();
+  }
+
+  cached_hint(const cached_hint&) = delete;
+
+  auto operator=(const cached_hint&) -> cached_hint& = delete;
+
+  /**
+   * \brief Unregisters the callback for the hint.
+   *
+   * \since 6.1.0
+   */
+  ~cached_hint() noexcept
+  {
+    m_callback.disconnect();
+  }
+
+  /**
+   * \brief Returns the current value of the hint.
+   *
+   * \details The value is only parsed if the hint has changed since the previous call.
+   *
+   * \return the current value of the hint; `std::nullopt` if the hint isn't set.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() const -> value_type
+  {
+    if (m_stale.exchange(false))
+    {
+      refresh();
+    }
+
+    if constexpr (is_string)
+    {
+      return m_value ? value_type{m_value->c_str()} : value_type{};
+    }
+    else
+    {
+      return m_value;
+    }
+  }
+
+  /**
+   * \brief Forces the value to be parsed again the next time that it's obtained.
+   *
+   * \since 6.1.0
+   */
+  void invalidate() noexcept
+  {
+    m_stale = true;
+  }
+
+ private:
+  inline constexpr static bool is_string =
+      std::is_same_v<value_type, std::optional<czstring>>;
+
+  // String values are copied, since SDL frees the old string when a hint changes
+  using storage_type =
+      std::conditional_t<is_string, std::optional<std::string>, value_type>;
+
+  hint_callback<Hint, cached_hint> m_callback;
+  mutable storage_type m_value;
+  mutable std::atomic<bool> m_stale{true};
+
+  void refresh() const
+  {
+    if constexpr (is_string)
+    {
+      if (const auto value = Hint::current_value())
+      {
+        m_value.emplace(*value);
+      }
+      else
+      {
+        m_value.reset();
+      }
+    }
+    else
+    {
+      m_value = Hint::current_value();
+    }
+  }
+
+  static void SDLCALL on_changed(void* data, czstring, czstring, czstring) noexcept
+  {
+    static_cast<cached_hint*>(data)->invalidate();
+  }
+};
+
+/// \} End of group configuration
+
+}  // namespace cen
+
+#endif  // CENTURION_HINT_CACHE_HEADER
@@ -0,0 +1,162 @@
+#ifndef CENTURION_HINT_PROFILE_HEADER
+#define CENTURION_HINT_PROFILE_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>      // size_t
+#include <string>       // string
+#include <type_traits>  // enable_if_t
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "../core/czstring.hpp"
+#include "../core/result.hpp"
+#include "../detail/czstring_eq.hpp"
+#include "hints.hpp"
+
+namespace cen {
+
+/// \addtogroup configuration
+/// \{
+
+/**
+ * \class hint_profile
+ *
+ * \brief A set of hint values that are applied together.
+ *
+ * \details A hint profile is assembled with the same type-safe interface as `set_hint()`,
+ * while the values are converted to strings once, when they're added to the profile.
+ * The whole configuration is then applied in a single pass with `apply()`, e.g. at
+ * startup, before the subsystems that read the hints are initialized.
+ * \code{cpp}
+ *   cen::hint_profile profile;
+ *   profile.set<cen::hint::render_driver>(cen::hint::render_driver::value::opengl)
+ *       .set<cen::hint::vsync>(true)
+ *       .set<cen::hint::event_logging, cen::hint_priority::override>(0);
+ *
+ *   profile.apply();
+ * \endcode
+ *
+ * \details Setting a hint that is already in the profile replaces its value. The hints
+ * are applied in the order in which they were first added.
+ *
+ * \since 6.1.0
+ */
+class hint_profile final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Adds a hint value to the profile, or replaces the value of the hint.
+   *
+   * \tparam Hint the type of the hint.
+   * \tparam priority the priority that will be used when the hint is applied.
+   * \tparam Value the type of the hint value.
+   *
+   * \param value the value of the hint.
+   *
+   * \return the profile itself.
+   *
+   * \see `set_hint()`
+   *
+   * \since 6.1.0
+   */
+  template <typename Hint,
+            hint_priority priority = hint_priority::normal,
+            typename Value,
+            typename = std::enable_if_t<Hint::template valid_arg<Value>()>>
+  auto set(const Value& value) -> hint_profile&
+  {
+    auto str = Hint::to_string(value);
+
+    for (auto& entry : m_entries)
+    {
+      if (detail::czstring_eq(entry.name, Hint::name()))
+      {
+        entry.value = std::move(str);
+        entry.priority = priority;
+        return *this;
+      }
+    }
+
+    m_entries.push_back({Hint::name(), std::move(str), priority});
+    return *this;
+  }
+
+  /**
+   * \brief Sets all hints in the profile.
+   *
+   * \details All hints are set, even if some of them fail to be set.
+   *
+   * \return `success` if all hints were set; `failure` otherwise.
+   *
+   * \see `SDL_SetHintWithPriority`
+   *
+   * \since 6.1.0
+   */
+  auto apply() const noexcept -> result
+  {
+    bool ok = true;
+
+    for (const auto& entry : m_entries)
+    {
+      ok &= SDL_SetHintWithPriority(entry.name,
+                                    entry.value.c_str(),
+                                    static_cast<SDL_HintPriority>(entry.priority)) ==
+            SDL_TRUE;
+    }
+
+    return ok;
+  }
+
+  /**
+   * \brief Removes all hints from the profile.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_entries.clear();
+  }
+
+  /**
+   * \brief Returns the amount of hints in the profile.
+   *
+   * \return the amount of hints.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the profile contains any hints.
+   *
+   * \return `true` if there are no hints in the profile; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_entries.empty();
+  }
+
+ private:
+  struct entry final
+  {
+    czstring name{};
+    std::string value;
+    hint_priority priority{};
+  };
+
+  std::vector<entry> m_entries;
+};
+
+/// \} End of group configuration
+
+}  // namespace cen
+
+#endif  // CENTURION_HINT_PROFILE_HEADER
@@ -0,0 +1,34 @@
+#ifndef CENTURION_INPUT_SUBSYSTEM_HEADER
+#define CENTURION_INPUT_SUBSYSTEM_HEADER
+
+/**
+ * \file input.hpp
+ *
+ * \brief Includes all headers of the input subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "input/action_map.hpp"
+#include "input/button_state.hpp"
+#include "input/controller.hpp"
+#include "input/controller_snapshot.hpp"
+#include "input/device_registry.hpp"
+#include "input/gesture_recognizer.hpp"
+#include "input/haptic.hpp"
+#include "input/haptic_effect_cache.hpp"
+#include "input/joystick.hpp"
+#include "input/key_code.hpp"
+#include "input/key_modifier.hpp"
+#include "input/keyboard.hpp"
+#include "input/mouse.hpp"
+#include "input/scan_code.hpp"
+#include "input/sensor.hpp"
+#include "input/sensor_stream.hpp"
+#include "input/touch.hpp"
+#include "input/virtual_controller.hpp"
+
+#endif  // CENTURION_INPUT_SUBSYSTEM_HEADER
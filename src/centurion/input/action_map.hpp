@@ -0,0 +1,699 @@
+#ifndef CENTURION_ACTION_MAP_HEADER
+#define CENTURION_ACTION_MAP_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>    // sort, find, fill
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <optional>     // optional
+#include <string>       // string
+#include <string_view>  // string_view
+#include <tuple>        // tie
+#include <utility>      // move, swap
+#include <vector>       // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "controller.hpp"
+#include "controller_snapshot.hpp"
+#include "key_code.hpp"
+#include "mouse_button.hpp"
+#include "scan_code.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \typedef action_id
+ *
+ * \brief The index of an action in an action map.
+ *
+ * \since 6.1.0
+ */
+using action_id = u16;
+
+/**
+ * \typedef action_context
+ *
+ * \brief Identifies a set of bindings that can be enabled and disabled together, e.g.
+ * the bindings of a menu. Must be less than 64.
+ *
+ * \since 6.1.0
+ */
+using action_context = u8;
+
+/**
+ * \enum axis_direction
+ *
+ * \brief Represents the half of a controller axis that an action is bound to.
+ *
+ * \since 6.1.0
+ */
+enum class axis_direction
+{
+  positive,
+  negative
+};
+
+/**
+ * \struct action_input
+ *
+ * \brief The input state that the actions of an action map are evaluated from.
+ *
+ * \since 6.1.0
+ */
+struct action_input final
+{
+  const u8* keys{};                 ///< The key states, indexed by scan code.
+  int key_count{};                  ///< The amount of key states.
+  u32 mouse_buttons{};              ///< The mouse button mask, see `SDL_BUTTON`.
+  controller_snapshot controller{};  ///< The state of the game controller.
+
+  /**
+   * \brief Captures the current keyboard and mouse state.
+   *
+   * \note `SDL_PumpEvents` isn't invoked by this function.
+   *
+   * \param controller the state of the game controller, detached by default.
+   *
+   * \return the current input state.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto capture(const controller_snapshot& controller = {}) noexcept
+      -> action_input
+  {
+    action_input input;
+    input.keys = SDL_GetKeyboardState(&input.key_count);
+    input.mouse_buttons = SDL_GetMouseState(nullptr, nullptr);
+    input.controller = controller;
+    return input;
+  }
+};
+
+/// \cond FALSE
+namespace detail {
+
+enum class binding_source : u8
+{
+  key,
+  mouse,
+  button,
+  axis
+};
+
+struct compiled_binding final
+{
+  binding_source source{};
+  action_context context{};
+  action_id action{};
+  u16 code{};      // Scan code, mouse button, controller button or axis
+  i16 deadzone{};  // Only used by axes
+  bool negative{};
+};
+
+inline constexpr std::size_t action_bits = 64;
+
+}  // namespace detail
+/// \endcond
+
+class action_map;
+
+/**
+ * \class action_map_builder
+ *
+ * \brief Describes the actions and bindings of an action map.
+ *
+ * \details Actions are named when they are added, but bound and queried by their IDs,
+ * so names are only resolved while the bindings are set up. Each binding belongs to a
+ * context, which makes it possible to e.g. bind the same key to different actions in
+ * different contexts.
+ * \code{cpp}
+ *   cen::action_map_builder builder;
+ *
+ *   const auto jump = builder.add_action("jump");
+ *   builder.bind(jump, cen::scancodes::space);
+ *   builder.bind(jump, cen::controller_button::a);
+ *
+ *   const auto left = builder.add_action("left");
+ *   builder.bind(left, cen::controller_axis::left_x, cen::axis_direction::negative);
+ *
+ *   auto actions = builder.compile();
+ * \endcode
+ *
+ * \see `action_map`
+ *
+ * \since 6.1.0
+ */
+class action_map_builder final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Adds an action.
+   *
+   * \param name the unique name of the action.
+   *
+   * \return the ID of the action.
+   *
+   * \throws cen_error if there already is an action with the name, or if there are too
+   * many actions.
+   *
+   * \since 6.1.0
+   */
+  auto add_action(std::string name) -> action_id
+  {
+    if (find(name))
+    {
+      throw cen_error{"Action names must be unique!"};
+    }
+
+    if (m_names.size() > max_action)
+    {
+      throw cen_error{"Too many actions!"};
+    }
+
+    m_names.push_back(std::move(name));
+    return static_cast<action_id>(m_names.size() - 1);
+  }
+
+  /**
+   * \brief Binds a key to an action.
+   *
+   * \param action the ID of the action.
+   * \param code the scan code of the key.
+   * \param context the context of the binding.
+   *
+   * \return the builder.
+   *
+   * \since 6.1.0
+   */
+  auto bind(const action_id action,
+            const scan_code& code,
+            const action_context context = 0) -> action_map_builder&
+  {
+    assert(code.get() >= 0);
+
+    const auto index = static_cast<u16>(code.get());
+    return add(detail::binding_source::key, action, index, context);
+  }
+
+  /**
+   * \brief Binds a key to an action.
+   *
+   * \details The key code is translated to a scan code according to the current keyboard
+   * layout, so the map should be compiled again if the layout changes, see
+   * `SDL_KEYMAPCHANGED`.
+   *
+   * \param action the ID of the action.
+   * \param code the key code of the key.
+   * \param context the context of the binding.
+   *
+   * \return the builder.
+   *
+   * \since 6.1.0
+   */
+  auto bind(const action_id action,
+            const key_code& code,
+            const action_context context = 0) -> action_map_builder&
+  {
+    return bind(action, scan_code{code.get()}, context);
+  }
+
+  /**
+   * \brief Binds a mouse button to an action.
+   *
+   * \param action the ID of the action.
+   * \param button the mouse button.
+   * \param context the context of the binding.
+   *
+   * \return the builder.
+   *
+   * \since 6.1.0
+   */
+  auto bind(const action_id action,
+            const mouse_button button,
+            const action_context context = 0) -> action_map_builder&
+  {
+    return add(detail::binding_source::mouse, action, static_cast<u16>(button), context);
+  }
+
+  /**
+   * \brief Binds a game controller button to an action.
+   *
+   * \param action the ID of the action.
+   * \param button the controller button, mustn't be `invalid` or `max`.
+   * \param context the context of the binding.
+   *
+   * \return the builder.
+   *
+   * \since 6.1.0
+   */
+  auto bind(const action_id action,
+            const controller_button button,
+            const action_context context = 0) -> action_map_builder&
+  {
+    assert(static_cast<int>(button) >= 0);
+    assert(static_cast<int>(button) < controller_snapshot::button_count);
+    return add(detail::binding_source::button, action, static_cast<u16>(button), context);
+  }
+
+  /**
+   * \brief Binds half of a game controller axis to an action.
+   *
+   * \details The value of the action is zero inside of the deadzone, and grows linearly
+   * to one at the end of the axis.
+   *
+   * \param action the ID of the action.
+   * \param axis the controller axis, mustn't be `invalid` or `max`.
+   * \param direction the half of the axis that triggers the action.
+   * \param deadzone the fraction of the axis that is ignored, in the range [0, 1).
+   * \param context the context of the binding.
+   *
+   * \return the builder.
+   *
+   * \since 6.1.0
+   */
+  auto bind(const action_id action,
+            const controller_axis axis,
+            const axis_direction direction,
+            const float deadzone = 0.25f,
+            const action_context context = 0) -> action_map_builder&
+  {
+    assert(static_cast<int>(axis) >= 0);
+    assert(static_cast<int>(axis) < controller_snapshot::axis_count);
+    assert(deadzone >= 0 && deadzone < 1);
+
+    add(detail::binding_source::axis, action, static_cast<u16>(axis), context);
+
+    auto& binding = m_bindings.back();
+    binding.deadzone = static_cast<i16>(deadzone * 32'767.0f);
+    binding.negative = direction == axis_direction::negative;
+
+    return *this;
+  }
+
+  /**
+   * \brief Returns the ID of the action with a name.
+   *
+   * \param name the name of the action.
+   *
+   * \return the ID of the action; `std::nullopt` if there is no such action.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find(const std::string_view name) const -> std::optional<action_id>
+  {
+    const auto it = std::find(m_names.begin(), m_names.end(), name);
+    if (it != m_names.end())
+    {
+      return static_cast<action_id>(it - m_names.begin());
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the amount of actions.
+   *
+   * \return the amount of actions.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto action_count() const noexcept -> size_type
+  {
+    return m_names.size();
+  }
+
+  /**
+   * \brief Returns the amount of bindings.
+   *
+   * \return the amount of bindings.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto binding_count() const noexcept -> size_type
+  {
+    return m_bindings.size();
+  }
+
+  /**
+   * \brief Creates an action map with the actions and bindings of the builder.
+   *
+   * \return an action map.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto compile() const -> action_map;
+
+ private:
+  inline constexpr static size_type max_action = 0xFFFF;
+
+  std::vector<std::string> m_names;
+  std::vector<detail::compiled_binding> m_bindings;
+
+  auto add(const detail::binding_source source,
+           const action_id action,
+           const u16 code,
+           const action_context context) -> action_map_builder&
+  {
+    assert(action < m_names.size());
+    assert(context < detail::action_bits);
+
+    detail::compiled_binding binding;
+    binding.source = source;
+    binding.context = context;
+    binding.action = action;
+    binding.code = code;
+
+    m_bindings.push_back(binding);
+    return *this;
+  }
+};
+
+/**
+ * \class action_map
+ *
+ * \brief Evaluates the state of a set of actions from the keyboard, mouse and a game
+ * controller.
+ *
+ * \details The bindings are compiled into a flat table, which is sorted by the kind of
+ * input, and evaluated in a single pass each frame. The states of the actions are
+ * stored as bitsets, so querying an action is a constant-time operation.
+ * \code{cpp}
+ *   // Every frame
+ *   actions.update(cen::action_input::capture(cen::capture_snapshot(controller)));
+ *
+ *   if (actions.just_pressed(jump)) {
+ *     // Jump
+ *   }
+ * \endcode
+ *
+ * \note All contexts are enabled by default.
+ *
+ * \see `action_map_builder`
+ *
+ * \since 6.1.0
+ */
+class action_map final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Evaluates the actions.
+   *
+   * \details An action is pressed if any of its enabled bindings is active, and its value
+   * is the largest value of the active bindings, i.e. `1` for keys and buttons.
+   *
+   * \param input the current input state.
+   *
+   * \since 6.1.0
+   */
+  void update(const action_input& input) noexcept
+  {
+    std::swap(m_current, m_previous);
+    std::fill(m_current.begin(), m_current.end(), 0);
+    std::fill(m_values.begin(), m_values.end(), 0.0f);
+
+    for (const auto& binding : m_bindings)
+    {
+      if (!((m_enabled >> binding.context) & 1u))
+      {
+        continue;
+      }
+
+      const auto value = evaluate(binding, input);
+      if (value > 0)
+      {
+        const auto index = binding.action;
+        m_current[index / detail::action_bits] |= bit(index);
+
+        if (value > m_values[index])
+        {
+          m_values[index] = value;
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Enables the bindings of a context.
+   *
+   * \param context the context that will be enabled.
+   *
+   * \since 6.1.0
+   */
+  void enable(const action_context context) noexcept
+  {
+    assert(context < detail::action_bits);
+    m_enabled |= u64{1} << context;
+  }
+
+  /**
+   * \brief Disables the bindings of a context.
+   *
+   * \details The actions of the disabled bindings are released on the next update.
+   *
+   * \param context the context that will be disabled.
+   *
+   * \since 6.1.0
+   */
+  void disable(const action_context context) noexcept
+  {
+    assert(context < detail::action_bits);
+    m_enabled &= ~(u64{1} << context);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not the bindings of a context are enabled.
+   *
+   * \param context the context that will be checked.
+   *
+   * \return `true` if the context is enabled; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_enabled(const action_context context) const noexcept -> bool
+  {
+    assert(context < detail::action_bits);
+    return (m_enabled >> context) & 1u;
+  }
+
+  /**
+   * \brief Indicates whether or not an action is pressed.
+   *
+   * \param action the ID of the action.
+   *
+   * \return `true` if the action is pressed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_pressed(const action_id action) const noexcept -> bool
+  {
+    return state(m_current, action);
+  }
+
+  /**
+   * \brief Indicates whether or not an action was pressed in the last update, but not
+   * in the one before it.
+   *
+   * \param action the ID of the action.
+   *
+   * \return `true` if the action was just pressed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto just_pressed(const action_id action) const noexcept -> bool
+  {
+    return state(m_current, action) && !state(m_previous, action);
+  }
+
+  /**
+   * \brief Indicates whether or not an action was released in the last update, but
+   * pressed in the one before it.
+   *
+   * \param action the ID of the action.
+   *
+   * \return `true` if the action was just released; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto just_released(const action_id action) const noexcept -> bool
+  {
+    return !state(m_current, action) && state(m_previous, action);
+  }
+
+  /**
+   * \brief Returns the value of an action.
+   *
+   * \param action the ID of the action.
+   *
+   * \return the value of the action, in the range [0, 1].
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto value(const action_id action) const noexcept -> float
+  {
+    assert(action < m_values.size());
+    return m_values[action];
+  }
+
+  /**
+   * \brief Returns the ID of the action with a name.
+   *
+   * \details This is a linear search, so the IDs should be looked up once.
+   *
+   * \param name the name of the action.
+   *
+   * \return the ID of the action; `std::nullopt` if there is no such action.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find(const std::string_view name) const -> std::optional<action_id>
+  {
+    const auto it = std::find(m_names.begin(), m_names.end(), name);
+    if (it != m_names.end())
+    {
+      return static_cast<action_id>(it - m_names.begin());
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Returns the name of an action.
+   *
+   * \param action the ID of the action.
+   *
+   * \return the name of the action.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto name(const action_id action) const -> const std::string&
+  {
+    assert(action < m_names.size());
+    return m_names[action];
+  }
+
+  /**
+   * \brief Returns the amount of actions.
+   *
+   * \return the amount of actions.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto action_count() const noexcept -> size_type
+  {
+    return m_names.size();
+  }
+
+  /**
+   * \brief Returns the amount of bindings.
+   *
+   * \return the amount of bindings.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto binding_count() const noexcept -> size_type
+  {
+    return m_bindings.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  std::vector<std::string> m_names;
+  std::vector<detail::compiled_binding> m_bindings;
+  std::vector<u64> m_current;
+  std::vector<u64> m_previous;
+  std::vector<float> m_values;
+  u64 m_enabled{~u64{0}};
+
+  friend class action_map_builder;
+
+  action_map(std::vector<std::string> names,
+             std::vector<detail::compiled_binding> bindings)
+      : m_names{std::move(names)}
+      , m_bindings{std::move(bindings)}
+  {
+    const auto words = (m_names.size() + detail::action_bits - 1) / detail::action_bits;
+    m_current.resize(words);
+    m_previous.resize(words);
+    m_values.resize(m_names.size());
+
+    // Bindings of the same kind of input are evaluated together, in the order of their
+    // codes, which keeps the branches predictable and the state accesses sequential
+    std::sort(m_bindings.begin(),
+              m_bindings.end(),
+              [](const detail::compiled_binding& a, const detail::compiled_binding& b) {
+                return std::tie(a.source, a.code) < std::tie(b.source, b.code);
+              });
+  }
+
+  [[nodiscard]] constexpr static auto bit(const action_id action) noexcept -> u64
+  {
+    return u64{1} << (action % detail::action_bits);
+  }
+
+  [[nodiscard]] static auto state(const std::vector<u64>& bits,
+                                  const action_id action) noexcept -> bool
+  {
+    assert(action / detail::action_bits < bits.size());
+    return bits[action / detail::action_bits] & bit(action);
+  }
+
+  [[nodiscard]] static auto evaluate(const detail::compiled_binding& binding,
+                                     const action_input& input) noexcept -> float
+  {
+    switch (binding.source)
+    {
+      case detail::binding_source::key:
+        return (binding.code < input.key_count && input.keys[binding.code]) ? 1.0f : 0.0f;
+
+      case detail::binding_source::mouse:
+        return (input.mouse_buttons & SDL_BUTTON(binding.code)) ? 1.0f : 0.0f;
+
+      case detail::binding_source::button:
+        return ((input.controller.buttons >> binding.code) & 1u) ? 1.0f : 0.0f;
+
+      case detail::binding_source::axis: {
+        const int raw = input.controller.axes[binding.code];
+        const int value = binding.negative ? -raw : raw;
+        if (value <= binding.deadzone)
+        {
+          return 0.0f;
+        }
+
+        const auto range = static_cast<float>(32'767 - binding.deadzone);
+        const auto result = static_cast<float>(value - binding.deadzone) / range;
+        return (result < 1.0f) ? result : 1.0f;
+      }
+
+      default:
+        return 0.0f;
+    }
+  }
+};
+
+inline auto action_map_builder::compile() const -> action_map
+{
+  return action_map{m_names, m_bindings};
+}
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_ACTION_MAP_HEADER
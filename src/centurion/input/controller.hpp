@@ -18,7 +18,7 @@
 #include "../core/result.hpp"
 #include "../core/sdl_string.hpp"
 #include "../core/time.hpp"
-#include "../detail/address_of.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/owner_handle_api.hpp"
 #include "../detail/sdl_version_at_least.hpp"
 #include "../video/color.hpp"
@@ -1015,6 +1015,8 @@ class basic_controller final
 
   /// \} End of touchpad functions
 
+#ifndef CENTURION_NO_SENSOR
+
   /// \name Sensor functions
   /// \{
 
@@ -1104,6 +1106,8 @@ class basic_controller final
 
   /// \} End of sensor functions
 
+#endif  // CENTURION_NO_SENSOR
+
   /// \name LED functions
   /// \{
 
@@ -1345,28 +1349,59 @@ class basic_controller final
   detail::pointer_manager<T, SDL_GameController, deleter> m_controller;
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_controller<detail::owning_type>;
+extern template class basic_controller<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
 /**
- * \brief Returns a textual representation of a game controller.
+ * \brief Writes a textual representation of a game controller to a buffer.
  *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
  * \param controller the game controller that will be converted.
  *
- * \return a string that represents a game controller.
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
  *
- * \since 5.0.0
+ * \since 6.1.0
  */
 template <typename T>
-[[nodiscard]] auto to_string(const basic_controller<T>& controller) -> std::string
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_controller<T>& controller) noexcept -> std::size_t
 {
-  const auto* name = controller.name();
-
   czstring serial{};
   if constexpr (detail::sdl_version_at_least(2, 0, 14))
   {
     serial = controller.serial();
   }
 
-  return "controller{data: " + detail::address_of(controller.get()) +
-         ", name: " + str_or_na(name) + ", serial: " + str_or_na(serial) + "}";
+  detail::format_writer writer{buffer, size};
+  return writer.write("controller{data: ",
+                      controller.get(),
+                      ", name: ",
+                      str_or_na(controller.name()),
+                      ", serial: ",
+                      str_or_na(serial),
+                      "}");
+}
+
+/**
+ * \brief Returns a textual representation of a game controller.
+ *
+ * \param controller the game controller that will be converted.
+ *
+ * \return a string that represents a game controller.
+ *
+ * \since 5.0.0
+ */
+template <typename T>
+[[nodiscard]] auto to_string(const basic_controller<T>& controller) -> std::string
+{
+  return detail::format_string(controller);
 }
 
 /**
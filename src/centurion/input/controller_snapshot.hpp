@@ -0,0 +1,296 @@
+#ifndef CENTURION_CONTROLLER_SNAPSHOT_HEADER
+#define CENTURION_CONTROLLER_SNAPSHOT_HEADER
+
+#include <SDL.h>
+
+#include <array>    // array
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "controller.hpp"
+
+namespace cen {
+
+/// \cond FALSE
+namespace detail {
+
+// Keeps the joysticks locked while the snapshots are captured, even if an iterator throws
+class joystick_lock final
+{
+ public:
+  joystick_lock() noexcept
+  {
+    SDL_LockJoysticks();
+  }
+
+  joystick_lock(const joystick_lock&) = delete;
+
+  auto operator=(const joystick_lock&) -> joystick_lock& = delete;
+
+  ~joystick_lock() noexcept
+  {
+    SDL_UnlockJoysticks();
+  }
+};
+
+[[nodiscard]] constexpr auto controller_bit(const controller_button button) noexcept
+    -> u32
+{
+  return u32{1} << static_cast<u32>(button);
+}
+
+}  // namespace detail
+/// \endcond
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \struct controller_snapshot
+ *
+ * \brief The state of the buttons and axes of a game controller at a point in time.
+ *
+ * \details Snapshots are trivially copyable, so the snapshot of the previous frame can be
+ * kept by value, and compared with the current one with `diff_snapshots()`.
+ *
+ * \see `capture_snapshot()`
+ * \see `capture_snapshots()`
+ *
+ * \since 6.1.0
+ */
+struct controller_snapshot final
+{
+  inline constexpr static int button_count = SDL_CONTROLLER_BUTTON_MAX;
+  inline constexpr static int axis_count = SDL_CONTROLLER_AXIS_MAX;
+
+  static_assert(button_count <= 32, "The buttons must fit in 32 bits!");
+
+  u32 buttons{};                       ///< Bit N is set if button N is pressed.
+  std::array<i16, axis_count> axes{};  ///< The axis values, indexed by axis.
+  bool attached{};                     ///< Whether or not the controller was attached.
+
+  /**
+   * \brief Indicates whether or not a button was pressed.
+   *
+   * \param button the button that will be checked, mustn't be `invalid` or `max`.
+   *
+   * \return `true` if the button was pressed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto is_pressed(const controller_button button) const noexcept
+      -> bool
+  {
+    return buttons & detail::controller_bit(button);
+  }
+
+  /**
+   * \brief Indicates whether or not a button was released.
+   *
+   * \param button the button that will be checked, mustn't be `invalid` or `max`.
+   *
+   * \return `true` if the button was released; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto is_released(const controller_button button) const noexcept
+      -> bool
+  {
+    return !is_pressed(button);
+  }
+
+  /**
+   * \brief Returns the value of an axis.
+   *
+   * \param axis the axis that will be queried, mustn't be `invalid` or `max`.
+   *
+   * \return the value of the axis.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto axis(const controller_axis axis) const noexcept -> i16
+  {
+    return axes[static_cast<std::size_t>(axis)];
+  }
+};
+
+/**
+ * \struct controller_snapshot_diff
+ *
+ * \brief The buttons that changed between two snapshots of a game controller.
+ *
+ * \see `diff_snapshots()`
+ *
+ * \since 6.1.0
+ */
+struct controller_snapshot_diff final
+{
+  u32 pressed{};   ///< Bit N is set if button N became pressed.
+  u32 released{};  ///< Bit N is set if button N became released.
+
+  /**
+   * \brief Indicates whether or not a button became pressed between the snapshots.
+   *
+   * \param button the button that will be checked, mustn't be `invalid` or `max`.
+   *
+   * \return `true` if the button was just pressed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto just_pressed(const controller_button button) const noexcept
+      -> bool
+  {
+    return pressed & detail::controller_bit(button);
+  }
+
+  /**
+   * \brief Indicates whether or not a button became released between the snapshots.
+   *
+   * \param button the button that will be checked, mustn't be `invalid` or `max`.
+   *
+   * \return `true` if the button was just released; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto just_released(
+      const controller_button button) const noexcept -> bool
+  {
+    return released & detail::controller_bit(button);
+  }
+
+  /**
+   * \brief Indicates whether or not any button changed between the snapshots.
+   *
+   * \return `true` if a button was pressed or released; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto any() const noexcept -> bool
+  {
+    return (pressed | released) != 0;
+  }
+};
+
+/// \name Controller snapshot functions
+/// \{
+
+/**
+ * \brief Returns the buttons that changed between two snapshots.
+ *
+ * \param previous the older snapshot.
+ * \param current the newer snapshot.
+ *
+ * \return the buttons that were pressed and released between the snapshots.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] constexpr auto diff_snapshots(const controller_snapshot& previous,
+                                            const controller_snapshot& current) noexcept
+    -> controller_snapshot_diff
+{
+  const auto changed = previous.buttons ^ current.buttons;
+  return controller_snapshot_diff{changed & current.buttons, changed & previous.buttons};
+}
+
+/// \cond FALSE
+namespace detail {
+
+// The joysticks must be locked by the caller
+[[nodiscard]] inline auto capture_unlocked(SDL_GameController* controller) noexcept
+    -> controller_snapshot
+{
+  controller_snapshot snapshot;
+  snapshot.attached = SDL_GameControllerGetAttached(controller) == SDL_TRUE;
+
+  for (int index = 0; index < controller_snapshot::button_count; ++index)
+  {
+    const auto button = static_cast<SDL_GameControllerButton>(index);
+    if (SDL_GameControllerGetButton(controller, button) == SDL_PRESSED)
+    {
+      snapshot.buttons |= u32{1} << static_cast<u32>(index);
+    }
+  }
+
+  for (int index = 0; index < controller_snapshot::axis_count; ++index)
+  {
+    const auto axis = static_cast<SDL_GameControllerAxis>(index);
+    snapshot.axes[static_cast<std::size_t>(index)] =
+        SDL_GameControllerGetAxis(controller, axis);
+  }
+
+  return snapshot;
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Captures the state of a game controller.
+ *
+ * \details The joysticks are locked while the state is captured, so the state of all
+ * buttons and axes is consistent, even if the joysticks are updated by another thread.
+ *
+ * \tparam T the ownership semantics of the controller.
+ *
+ * \param controller the controller that will be captured.
+ *
+ * \return a snapshot of the controller.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+[[nodiscard]] auto capture_snapshot(const basic_controller<T>& controller) noexcept
+    -> controller_snapshot
+{
+  const detail::joystick_lock lock;
+  return detail::capture_unlocked(controller.get());
+}
+
+/**
+ * \brief Captures the state of several game controllers, while the joysticks are locked
+ * once.
+ *
+ * \details This is cheaper than capturing the controllers one by one, and the snapshots
+ * are consistent with each other.
+ * \code{cpp}
+ *   std::array<cen::controller_snapshot, 4> current;
+ *   cen::capture_snapshots(controllers.begin(), controllers.end(), current.begin());
+ *
+ *   const auto diff = cen::diff_snapshots(previous[0], current[0]);
+ *   if (diff.just_pressed(cen::controller_button::a)) {
+ *     // Jump
+ *   }
+ * \endcode
+ *
+ * \tparam InputIt the type of the iterators to the controllers.
+ * \tparam OutputIt the type of the iterator that the snapshots are written to.
+ *
+ * \param first the first controller that will be captured.
+ * \param last the end of the controller range.
+ * \param out the iterator that the snapshots will be written to, in order.
+ *
+ * \return the end of the written snapshots.
+ *
+ * \since 6.1.0
+ */
+template <typename InputIt, typename OutputIt>
+auto capture_snapshots(InputIt first, const InputIt last, OutputIt out) -> OutputIt
+{
+  const detail::joystick_lock lock;
+
+  for (; first != last; ++first)
+  {
+    *out = detail::capture_unlocked(first->get());
+    ++out;
+  }
+
+  return out;
+}
+
+/// \} End of controller snapshot functions
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_CONTROLLER_SNAPSHOT_HEADER
@@ -0,0 +1,675 @@
+#ifndef CENTURION_DEVICE_REGISTRY_HEADER
+#define CENTURION_DEVICE_REGISTRY_HEADER
+
+#include <SDL.h>
+
+#include <array>          // array
+#include <cassert>        // assert
+#include <cstddef>        // size_t
+#include <memory>         // unique_ptr, make_unique
+#include <optional>       // optional
+#include <type_traits>    // is_same_v
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "controller.hpp"
+#include "joystick.hpp"
+#include "sensor.hpp"
+#include "sensor_stream.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+template <typename Device>
+struct device_traits;
+
+template <>
+struct device_traits<controller> final
+{
+  inline static constexpr u32 added = SDL_CONTROLLERDEVICEADDED;
+  inline static constexpr u32 removed = SDL_CONTROLLERDEVICEREMOVED;
+
+  [[nodiscard]] static auto which(const SDL_Event& event) noexcept -> i32
+  {
+    return event.cdevice.which;
+  }
+
+  [[nodiscard]] static auto open(const int index) noexcept -> SDL_GameController*
+  {
+    if (SDL_IsGameController(index))
+    {
+      return SDL_GameControllerOpen(index);
+    }
+    else
+    {
+      return nullptr;
+    }
+  }
+
+  [[nodiscard]] static auto instance_id(SDL_GameController* ptr) noexcept
+      -> SDL_JoystickID
+  {
+    return SDL_JoystickInstanceID(SDL_GameControllerGetJoystick(ptr));
+  }
+};
+
+template <>
+struct device_traits<joystick> final
+{
+  inline static constexpr u32 added = SDL_JOYDEVICEADDED;
+  inline static constexpr u32 removed = SDL_JOYDEVICEREMOVED;
+
+  [[nodiscard]] static auto which(const SDL_Event& event) noexcept -> i32
+  {
+    return event.jdevice.which;
+  }
+
+  [[nodiscard]] static auto open(const int index) noexcept -> SDL_Joystick*
+  {
+    return SDL_JoystickOpen(index);
+  }
+
+  [[nodiscard]] static auto instance_id(SDL_Joystick* ptr) noexcept -> SDL_JoystickID
+  {
+    return SDL_JoystickInstanceID(ptr);
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class device_registry
+ *
+ * \brief Keeps track of the attached game controllers or joysticks.
+ *
+ * \details A device registry opens devices as they are attached, and closes them as they
+ * are removed, based on the device events that it's fed. The open devices are stored
+ * contiguously, so per-frame input code can simply iterate the registry. Devices can
+ * also be looked up in constant time by their instance ID, which is the identifier used
+ * by `controller_*_event` and `joy_*_event`.
+ * \code{cpp}
+ *   cen::controller_registry controllers;
+ *   controllers.open_all();
+ *
+ *   cen::event event;
+ *   while (event.poll())
+ *   {
+ *     controllers.feed(event.data());
+ *   }
+ *
+ *   for (auto& controller : controllers)
+ *   {
+ *     update_player(controller);
+ *   }
+ * \endcode
+ *
+ * \details Removing a device moves the last device into the freed slot, so the devices
+ * remain contiguous. As a result, an index only identifies a device until the next
+ * removal. Use the instance IDs to refer to devices over longer periods.
+ *
+ * \details Controller registries can also capture every reading of the motion sensors
+ * of their controllers, see `capture_sensor()`.
+ *
+ * \tparam Device the type of the devices, either `controller` or `joystick`.
+ *
+ * \see `controller_registry`
+ * \see `joystick_registry`
+ *
+ * \since 6.1.0
+ */
+template <typename Device>
+class device_registry final
+{
+  using traits = detail::device_traits<Device>;
+
+ public:
+  using device_type = Device;
+  using size_type = std::size_t;
+  using iterator = typename std::vector<Device>::iterator;
+  using const_iterator = typename std::vector<Device>::const_iterator;
+
+  device_registry() = default;
+
+  device_registry(const device_registry&) = delete;
+
+  device_registry(device_registry&&) noexcept = default;
+
+  auto operator=(const device_registry&) -> device_registry& = delete;
+
+  auto operator=(device_registry&&) noexcept -> device_registry& = default;
+
+  /// \name Updates
+  /// \{
+
+  /**
+   * \brief Updates the registry with an event.
+   *
+   * \details Device added events open the device, if it isn't already open, and device
+   * removed events close it. Other events are ignored.
+   *
+   * \param event the event that will be handled.
+   *
+   * \return `true` if a device was opened or closed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto feed(const SDL_Event& event) -> bool
+  {
+    if (event.type == traits::added)
+    {
+      // The added events store the device index, not the instance ID
+      return open(traits::which(event));
+    }
+    else if (event.type == traits::removed)
+    {
+      return close(traits::which(event));
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Opens a device, if it isn't already open.
+   *
+   * \param index the device index of the device.
+   *
+   * \return `true` if the device was opened; `false` if it was already open, or if it
+   * couldn't be opened.
+   *
+   * \since 6.1.0
+   */
+  auto open(const int index) -> bool
+  {
+    auto* ptr = traits::open(index);
+    if (!ptr)
+    {
+      return false;
+    }
+
+    // Opening a device again only increments its reference count
+    Device device{ptr};
+
+    const auto id = traits::instance_id(ptr);
+    if (m_slots.find(id) != m_slots.end())
+    {
+      return false;
+    }
+
+    m_slots.try_emplace(id, m_devices.size());
+    m_ids.push_back(id);
+    m_devices.push_back(std::move(device));
+
+#if !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+    if constexpr (std::is_same_v<Device, controller>)
+    {
+      m_sensors.emplace_back();
+      for (std::size_t sensor = 0; sensor < m_captured.size(); ++sensor)
+      {
+        if (m_captured[sensor])
+        {
+          start_capture(m_devices.size() - 1, sensor);
+        }
+      }
+    }
+#endif  // !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+    return true;
+  }
+
+  /**
+   * \brief Opens all attached devices that aren't already open.
+   *
+   * \details This is useful when the registry is created after the device added events
+   * of the initially attached devices have been polled.
+   *
+   * \return the amount of opened devices.
+   *
+   * \since 6.1.0
+   */
+  auto open_all() -> size_type
+  {
+    size_type count = 0;
+
+    const auto total = SDL_NumJoysticks();
+    for (int index = 0; index < total; ++index)
+    {
+      if (open(index))
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Closes a device.
+   *
+   * \param id the instance ID of the device.
+   *
+   * \return `true` if the device was closed; `false` if there was no such device.
+   *
+   * \since 6.1.0
+   */
+  auto close(const SDL_JoystickID id) -> bool
+  {
+    const auto it = m_slots.find(id);
+    if (it == m_slots.end())
+    {
+      return false;
+    }
+
+    const auto slot = it->second;
+    const auto last = m_devices.size() - 1;
+
+    if (slot != last)
+    {
+      m_devices[slot] = std::move(m_devices[last]);
+      m_ids[slot] = m_ids[last];
+      m_slots[m_ids[slot]] = slot;
+    }
+
+#if !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+    if constexpr (std::is_same_v<Device, controller>)
+    {
+      // The streams are heap allocated, so moving them doesn't affect their event watches
+      if (slot != last)
+      {
+        m_sensors[slot] = std::move(m_sensors[last]);
+      }
+
+      m_sensors.pop_back();
+    }
+#endif  // !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+    m_devices.pop_back();
+    m_ids.pop_back();
+    m_slots.erase(id);
+
+    return true;
+  }
+
+  /**
+   * \brief Closes all devices.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+#if !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+    m_sensors.clear();
+#endif  // !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+    m_devices.clear();
+    m_ids.clear();
+    m_slots.clear();
+  }
+
+  /// \} End of updates
+
+#if !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+  /// \name Sensors
+  /// \{
+
+  /**
+   * \brief Captures every reading of a sensor of the controllers.
+   *
+   * \details Data reporting is enabled for the sensor of every open controller that has
+   * it, and a `controller_sensor_stream` is created for each of them. Controllers that
+   * are opened later are captured as well, and their streams are destroyed when they're
+   * closed, so the readings are simply drained per controller once per frame.
+   * \code{cpp}
+   *   controllers.capture_sensor(cen::sensor_type::gyroscope);
+   *
+   *   // Every frame, after polling the events
+   *   for (std::size_t index = 0; index < controllers.size(); ++index)
+   *   {
+   *     const auto id = controllers.instance_id(index);
+   *     controllers.drain_sensor(id, cen::sensor_type::gyroscope, [&](const auto& s) {
+   *       aim[id].add(s);
+   *     });
+   *   }
+   * \endcode
+   *
+   * \note Only controller registries support sensors.
+   *
+   * \param type the type of the sensor, i.e. the accelerometer or the gyroscope.
+   *
+   * \return the amount of open controllers whose sensor is captured.
+   *
+   * \since 6.1.0
+   */
+  auto capture_sensor(const sensor_type type) -> size_type
+  {
+    static_assert(std::is_same_v<Device, controller>, "Only controllers have sensors!");
+
+    const auto sensor = sensor_index(type);
+    if (!sensor)
+    {
+      return 0;
+    }
+
+    m_captured[*sensor] = true;
+
+    size_type count = 0;
+    for (size_type slot = 0; slot < m_devices.size(); ++slot)
+    {
+      if (start_capture(slot, *sensor))
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Stops capturing the readings of a sensor of the controllers.
+   *
+   * \details Data reporting is disabled for the sensor of the captured controllers, and
+   * any readings that haven't been drained are discarded.
+   *
+   * \param type the type of the sensor.
+   *
+   * \since 6.1.0
+   */
+  void release_sensor(const sensor_type type) noexcept
+  {
+    static_assert(std::is_same_v<Device, controller>, "Only controllers have sensors!");
+
+    if (const auto sensor = sensor_index(type))
+    {
+      m_captured[*sensor] = false;
+
+      for (size_type slot = 0; slot < m_devices.size(); ++slot)
+      {
+        if (auto& stream = m_sensors[slot][*sensor])
+        {
+          m_devices[slot].set_sensor_enabled(type, false);
+          stream.reset();
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Removes all captured readings of a sensor of a controller, oldest first.
+   *
+   * \tparam F the type of the function object.
+   *
+   * \param id the instance ID of the controller.
+   * \param type the type of the sensor.
+   * \param callable the function object that is invoked with each `sensor_sample`.
+   *
+   * \return the amount of readings; zero if the sensor of the controller isn't captured.
+   *
+   * \since 6.1.0
+   */
+  template <typename F>
+  auto drain_sensor(const SDL_JoystickID id, const sensor_type type, F&& callable)
+      -> size_type
+  {
+    auto* stream = find_sensor_stream(id, type);
+    return stream ? stream->drain(callable) : 0;
+  }
+
+  /**
+   * \brief Returns the stream that captures a sensor of a controller.
+   *
+   * \details The stream is owned by the registry, and is destroyed when the controller is
+   * closed or when the sensor is released.
+   *
+   * \param id the instance ID of the controller.
+   * \param type the type of the sensor.
+   *
+   * \return a pointer to the stream; a null pointer if the sensor isn't captured.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find_sensor_stream(const SDL_JoystickID id,
+                                        const sensor_type type) noexcept
+      -> controller_sensor_stream<>*
+  {
+    const auto slot = index_of(id);
+    const auto sensor = sensor_index(type);
+    return (slot && sensor) ? m_sensors[*slot][*sensor].get() : nullptr;
+  }
+
+  /// \} End of sensors
+
+#endif  // !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+  /// \name Lookup
+  /// \{
+
+  /**
+   * \brief Returns the device associated with an instance ID.
+   *
+   * \param id the instance ID of the device.
+   *
+   * \return a pointer to the device; a null pointer if there is no such device.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find(const SDL_JoystickID id) noexcept -> Device*
+  {
+    const auto index = index_of(id);
+    return index ? &m_devices[*index] : nullptr;
+  }
+
+  /// \copydoc find()
+  [[nodiscard]] auto find(const SDL_JoystickID id) const noexcept -> const Device*
+  {
+    const auto index = index_of(id);
+    return index ? &m_devices[*index] : nullptr;
+  }
+
+  /**
+   * \brief Returns the current index of the device associated with an instance ID.
+   *
+   * \param id the instance ID of the device.
+   *
+   * \return the index of the device; `std::nullopt` if there is no such device.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto index_of(const SDL_JoystickID id) const noexcept
+      -> std::optional<size_type>
+  {
+    if (const auto it = m_slots.find(id); it != m_slots.end())
+    {
+      return it->second;
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not a device is open.
+   *
+   * \param id the instance ID of the device.
+   *
+   * \return `true` if the registry contains the device; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const SDL_JoystickID id) const noexcept -> bool
+  {
+    return m_slots.find(id) != m_slots.end();
+  }
+
+  /**
+   * \brief Returns the instance ID of the device at an index.
+   *
+   * \pre `index` must be less than `size()`.
+   *
+   * \param index the index of the device.
+   *
+   * \return the instance ID of the device.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto instance_id(const size_type index) const noexcept -> SDL_JoystickID
+  {
+    assert(index < m_ids.size());
+    return m_ids[index];
+  }
+
+  /**
+   * \brief Returns the device at an index.
+   *
+   * \pre `index` must be less than `size()`.
+   *
+   * \param index the index of the device.
+   *
+   * \return the device at the index.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) noexcept -> Device&
+  {
+    assert(index < m_devices.size());
+    return m_devices[index];
+  }
+
+  /// \copydoc operator[]()
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> const Device&
+  {
+    assert(index < m_devices.size());
+    return m_devices[index];
+  }
+
+  /// \} End of lookup
+
+  /// \name Iteration
+  /// \{
+
+  [[nodiscard]] auto begin() noexcept -> iterator
+  {
+    return m_devices.begin();
+  }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator
+  {
+    return m_devices.begin();
+  }
+
+  [[nodiscard]] auto end() noexcept -> iterator
+  {
+    return m_devices.end();
+  }
+
+  [[nodiscard]] auto end() const noexcept -> const_iterator
+  {
+    return m_devices.end();
+  }
+
+  /**
+   * \brief Returns the amount of open devices.
+   *
+   * \return the amount of devices in the registry.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_devices.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are any open devices.
+   *
+   * \return `true` if the registry is empty; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_devices.empty();
+  }
+
+  /// \} End of iteration
+
+ private:
+  std::vector<Device> m_devices;
+  std::vector<SDL_JoystickID> m_ids;  // The instance IDs, parallel to the devices
+  std::unordered_map<SDL_JoystickID, size_type> m_slots;
+
+#if !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+  // The captured accelerometers and gyroscopes, parallel to the devices
+  using sensor_streams = std::array<std::unique_ptr<controller_sensor_stream<>>, 2>;
+
+  std::vector<sensor_streams> m_sensors;
+  std::array<bool, 2> m_captured{};
+
+  [[nodiscard]] static auto sensor_index(const sensor_type type) noexcept
+      -> std::optional<std::size_t>
+  {
+    switch (type)
+    {
+      case sensor_type::accelerometer:
+        return 0;
+
+      case sensor_type::gyroscope:
+        return 1;
+
+      case sensor_type::invalid:
+      case sensor_type::unknown:
+        return std::nullopt;
+
+      default:  // Values that aren't enumerators
+        return std::nullopt;
+    }
+  }
+
+  [[nodiscard]] static auto sensor_of(const std::size_t index) noexcept -> sensor_type
+  {
+    return (index == 0) ? sensor_type::accelerometer : sensor_type::gyroscope;
+  }
+
+  auto start_capture(const size_type slot, const std::size_t sensor) -> bool
+  {
+    auto& stream = m_sensors[slot][sensor];
+    if (stream)
+    {
+      return true;
+    }
+
+    const auto type = sensor_of(sensor);
+
+    auto& device = m_devices[slot];
+    if (!device.has_sensor(type) || !device.set_sensor_enabled(type, true))
+    {
+      return false;
+    }
+
+    stream = std::make_unique<controller_sensor_stream<>>(m_ids[slot], type);
+    return true;
+  }
+#endif  // !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+};
+
+/// A registry of the attached game controllers.
+using controller_registry = device_registry<controller>;
+
+/// A registry of the attached joysticks.
+using joystick_registry = device_registry<joystick>;
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_DEVICE_REGISTRY_HEADER
@@ -0,0 +1,498 @@
+#ifndef CENTURION_GESTURE_RECOGNIZER_HEADER
+#define CENTURION_GESTURE_RECOGNIZER_HEADER
+
+#include <SDL.h>
+
+#include <array>    // array
+#include <cmath>    // atan2, sqrt, fabs
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../events/touch_finger_event.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \enum gesture_type
+ *
+ * \brief Represents the gestures recognized by a `gesture_recognizer`.
+ *
+ * \since 6.1.0
+ */
+enum class gesture_type
+{
+  tap,         ///< A short touch of a single finger, without moving it.
+  double_tap,  ///< A second tap close to the previous one, after the second tap.
+  pan,         ///< A movement of the fingers, reported continuously.
+  pinch,       ///< A change in the distance between two fingers, reported continuously.
+  rotate       ///< A change in the angle between two fingers, reported continuously.
+};
+
+/**
+ * \struct gesture
+ *
+ * \brief A gesture recognized by a `gesture_recognizer`.
+ *
+ * \details All coordinates are normalized, like those of touch finger events.
+ *
+ * \since 6.1.0
+ */
+struct gesture final
+{
+  gesture_type type{};  ///< The type of the gesture.
+  SDL_TouchID touch{};  ///< The touch device of the gesture.
+  u32 time{};           ///< The timestamp of the event that completed the gesture.
+  int fingers{};        ///< The amount of fingers touching the device.
+  float x{};            ///< The x-coordinate of the center of the fingers.
+  float y{};            ///< The y-coordinate of the center of the fingers.
+  float dx{};           ///< The horizontal movement since the previous pan.
+  float dy{};           ///< The vertical movement since the previous pan.
+  float scale{1};       ///< The change in distance since the previous pinch, as a ratio.
+  float rotation{};     ///< The change in angle since the previous rotation, in radians.
+};
+
+/**
+ * \struct gesture_config
+ *
+ * \brief The thresholds used to recognize gestures.
+ *
+ * \details Distances are normalized, i.e. relative to the size of the touch device.
+ *
+ * \since 6.1.0
+ */
+struct gesture_config final
+{
+  milliseconds<u32> tap_duration{250};        ///< The longest touch that is a tap.
+  milliseconds<u32> double_tap_interval{300};  ///< The longest time between two taps.
+  float tap_slop{0.02f};                       ///< The most a finger moves during a tap.
+  float double_tap_slop{0.05f};                ///< The largest distance between two taps.
+  float pan_threshold{0.02f};                  ///< The movement that starts a pan.
+  float pinch_threshold{0.1f};   ///< The relative change in distance that starts a pinch.
+  float rotate_threshold{0.1f};  ///< The change in angle that starts a rotation.
+};
+
+/**
+ * \class gesture_recognizer
+ *
+ * \brief Recognizes taps, double taps, pans, pinches and rotations in touch events.
+ *
+ * \details The recognizer tracks up to `MaxFingers` fingers in a fixed-size array, so
+ * processing events never allocates memory, and events can be processed in batches.
+ * Continuous gestures only start once the fingers moved beyond a threshold, after which
+ * every movement is reported relative to the previous one. Pinches and rotations are
+ * based on the first two fingers.
+ * \code{cpp}
+ *   cen::gesture_recognizer<> recognizer;
+ *
+ *   recognizer.process(events.data(), events.size(), [](const cen::gesture& gesture) {
+ *     if (gesture.type == cen::gesture_type::pinch) {
+ *       zoom *= gesture.scale;
+ *     }
+ *   });
+ * \endcode
+ *
+ * \note Fingers beyond the capacity are ignored.
+ *
+ * \tparam MaxFingers the maximum amount of tracked fingers.
+ *
+ * \since 6.1.0
+ */
+template <std::size_t MaxFingers = 10>
+class gesture_recognizer final
+{
+  static_assert(MaxFingers >= 2, "Pinches and rotations require at least two fingers!");
+
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a recognizer.
+   *
+   * \param config the thresholds used to recognize gestures.
+   *
+   * \since 6.1.0
+   */
+  explicit gesture_recognizer(const gesture_config& config = {}) noexcept
+      : m_config{config}
+  {}
+
+  /**
+   * \brief Processes a touch finger event.
+   *
+   * \tparam F the type of the function object.
+   *
+   * \param event the touch finger event, events of other types are ignored.
+   * \param callable the function object that is invoked with each recognized gesture.
+   *
+   * \return the amount of recognized gestures.
+   *
+   * \since 6.1.0
+   */
+  template <typename F>
+  auto process(const touch_finger_event& event, F&& callable) -> size_type
+  {
+    switch (event.type())
+    {
+      case event_type::touch_down:
+        return on_down(event);
+
+      case event_type::touch_motion:
+        return on_motion(event, callable);
+
+      case event_type::touch_up:
+        return on_up(event, callable);
+
+      default:
+        return 0;
+    }
+  }
+
+  /**
+   * \brief Processes a batch of touch finger events, in order.
+   *
+   * \tparam F the type of the function object.
+   *
+   * \param events the touch finger events.
+   * \param count the amount of events.
+   * \param callable the function object that is invoked with each recognized gesture.
+   *
+   * \return the amount of recognized gestures.
+   *
+   * \since 6.1.0
+   */
+  template <typename F>
+  auto process(const touch_finger_event* events, const size_type count, F&& callable)
+      -> size_type
+  {
+    size_type gestures = 0;
+
+    for (size_type index = 0; index < count; ++index)
+    {
+      gestures += process(events[index], callable);
+    }
+
+    return gestures;
+  }
+
+  /**
+   * \brief Forgets all fingers and gestures in progress.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_count = 0;
+    m_lastTap = {};
+    m_hasLastTap = false;
+    m_tapCandidate = false;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of tracked fingers.
+   *
+   * \return the amount of fingers touching the device.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto finger_count() const noexcept -> size_type
+  {
+    return m_count;
+  }
+
+  /**
+   * \brief Returns the thresholds used to recognize gestures.
+   *
+   * \return the gesture configuration.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto config() const noexcept -> const gesture_config&
+  {
+    return m_config;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct finger final
+  {
+    SDL_TouchID touch{};
+    SDL_FingerID id{};
+    float startX{};
+    float startY{};
+    float x{};
+    float y{};
+    u32 downTime{};
+  };
+
+  gesture_config m_config;
+  std::array<finger, MaxFingers> m_fingers{};
+  size_type m_count{};
+
+  // The values of the previous pan, pinch and rotation, in order to report deltas
+  float m_centerX{};
+  float m_centerY{};
+  float m_distance{};
+  float m_angle{};
+  bool m_panning{};
+  bool m_pinching{};
+  bool m_rotating{};
+
+  bool m_tapCandidate{};
+  bool m_hasLastTap{};
+  gesture m_lastTap{};
+
+  [[nodiscard]] auto find(const touch_finger_event& event) noexcept -> finger*
+  {
+    for (size_type index = 0; index < m_count; ++index)
+    {
+      auto& finger = m_fingers[index];
+      if (finger.id == event.finger_id() && finger.touch == event.touch_id())
+      {
+        return &finger;
+      }
+    }
+
+    return nullptr;
+  }
+
+  [[nodiscard]] auto distance() const noexcept -> float
+  {
+    const auto dx = m_fingers[1].x - m_fingers[0].x;
+    const auto dy = m_fingers[1].y - m_fingers[0].y;
+    return std::sqrt(dx * dx + dy * dy);
+  }
+
+  [[nodiscard]] auto angle() const noexcept -> float
+  {
+    return std::atan2(m_fingers[1].y - m_fingers[0].y, m_fingers[1].x - m_fingers[0].x);
+  }
+
+  // Called whenever the set of fingers changes, so that gestures restart from there
+  void reset_references() noexcept
+  {
+    m_centerX = 0;
+    m_centerY = 0;
+    for (size_type index = 0; index < m_count; ++index)
+    {
+      m_centerX += m_fingers[index].x;
+      m_centerY += m_fingers[index].y;
+    }
+
+    if (m_count != 0)
+    {
+      m_centerX /= static_cast<float>(m_count);
+      m_centerY /= static_cast<float>(m_count);
+    }
+
+    if (m_count >= 2)
+    {
+      m_distance = distance();
+      m_angle = angle();
+    }
+
+    m_panning = false;
+    m_pinching = false;
+    m_rotating = false;
+  }
+
+  [[nodiscard]] auto make_gesture(const gesture_type type,
+                                  const touch_finger_event& event,
+                                  const float x,
+                                  const float y) const noexcept -> gesture
+  {
+    gesture result;
+    result.type = type;
+    result.touch = event.touch_id();
+    result.time = event.time();
+    result.fingers = static_cast<int>(m_count);
+    result.x = x;
+    result.y = y;
+    return result;
+  }
+
+  auto on_down(const touch_finger_event& event) noexcept -> size_type
+  {
+    if (find(event) || m_count == MaxFingers)
+    {
+      return 0;
+    }
+
+    auto& finger = m_fingers[m_count++];
+    finger.touch = event.touch_id();
+    finger.id = event.finger_id();
+    finger.startX = finger.x = event.x();
+    finger.startY = finger.y = event.y();
+    finger.downTime = event.time();
+
+    // Only single fingers tap
+    m_tapCandidate = m_count == 1;
+
+    reset_references();
+    return 0;
+  }
+
+  template <typename F>
+  auto on_motion(const touch_finger_event& event, F& callable) -> size_type
+  {
+    auto* finger = find(event);
+    if (!finger)
+    {
+      return 0;
+    }
+
+    finger->x = event.x();
+    finger->y = event.y();
+
+    const auto moveX = finger->x - finger->startX;
+    const auto moveY = finger->y - finger->startY;
+    if (moveX * moveX + moveY * moveY > m_config.tap_slop * m_config.tap_slop)
+    {
+      m_tapCandidate = false;
+    }
+
+    float centerX{};
+    float centerY{};
+    for (size_type index = 0; index < m_count; ++index)
+    {
+      centerX += m_fingers[index].x;
+      centerY += m_fingers[index].y;
+    }
+
+    centerX /= static_cast<float>(m_count);
+    centerY /= static_cast<float>(m_count);
+
+    size_type gestures = 0;
+
+    const auto dx = centerX - m_centerX;
+    const auto dy = centerY - m_centerY;
+    const auto threshold = m_config.pan_threshold;
+    if (m_panning || dx * dx + dy * dy > threshold * threshold)
+    {
+      m_panning = true;
+      m_centerX = centerX;
+      m_centerY = centerY;
+
+      auto pan = make_gesture(gesture_type::pan, event, centerX, centerY);
+      pan.dx = dx;
+      pan.dy = dy;
+      callable(pan);
+      ++gestures;
+    }
+
+    // The references are only valid while the first two fingers remain unchanged
+    if (m_count >= 2 && m_distance > 0)
+    {
+      const auto current = distance();
+      const auto scale = current / m_distance;
+      if (m_pinching || std::fabs(scale - 1.0f) > m_config.pinch_threshold)
+      {
+        m_pinching = true;
+        m_distance = current;
+
+        auto pinch = make_gesture(gesture_type::pinch, event, centerX, centerY);
+        pinch.scale = scale;
+        callable(pinch);
+        ++gestures;
+      }
+
+      const auto currentAngle = angle();
+      auto rotation = currentAngle - m_angle;
+
+      // Keep the smallest angle, in [-pi, pi]
+      constexpr auto pi = 3.14159265f;
+      if (rotation > pi)
+      {
+        rotation -= 2 * pi;
+      }
+      else if (rotation < -pi)
+      {
+        rotation += 2 * pi;
+      }
+
+      if (m_rotating || std::fabs(rotation) > m_config.rotate_threshold)
+      {
+        m_rotating = true;
+        m_angle = currentAngle;
+
+        auto rotate = make_gesture(gesture_type::rotate, event, centerX, centerY);
+        rotate.rotation = rotation;
+        callable(rotate);
+        ++gestures;
+      }
+    }
+
+    return gestures;
+  }
+
+  template <typename F>
+  auto on_up(const touch_finger_event& event, F& callable) -> size_type
+  {
+    auto* finger = find(event);
+    if (!finger)
+    {
+      return 0;
+    }
+
+    size_type gestures = 0;
+
+    const auto duration = event.time() - finger->downTime;
+    if (m_tapCandidate && m_count == 1 && duration <= m_config.tap_duration.count())
+    {
+      const auto tap = make_gesture(gesture_type::tap, event, finger->x, finger->y);
+      callable(tap);
+      ++gestures;
+
+      if (is_double_tap(tap))
+      {
+        auto doubleTap = tap;
+        doubleTap.type = gesture_type::double_tap;
+        callable(doubleTap);
+        ++gestures;
+
+        // A third tap starts a new double tap
+        m_hasLastTap = false;
+      }
+      else
+      {
+        m_lastTap = tap;
+        m_hasLastTap = true;
+      }
+    }
+
+    // The last finger takes the place of the lifted finger
+    *finger = m_fingers[--m_count];
+    m_tapCandidate = false;
+
+    reset_references();
+    return gestures;
+  }
+
+  [[nodiscard]] auto is_double_tap(const gesture& tap) const noexcept -> bool
+  {
+    if (!m_hasLastTap || m_lastTap.touch != tap.touch)
+    {
+      return false;
+    }
+
+    const auto dx = tap.x - m_lastTap.x;
+    const auto dy = tap.y - m_lastTap.y;
+    const auto slop = m_config.double_tap_slop;
+
+    return tap.time - m_lastTap.time <= m_config.double_tap_interval.count() &&
+           dx * dx + dy * dy <= slop * slop;
+  }
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_GESTURE_RECOGNIZER_HEADER
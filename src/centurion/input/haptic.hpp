@@ -1,9 +1,12 @@
 #ifndef CENTURION_HAPTIC_HEADER
 #define CENTURION_HAPTIC_HEADER
 
+#ifndef CENTURION_NO_HAPTIC
+
 #include <SDL.h>
 
 #include <cassert>      // assert
+#include <cstddef>      // size_t
 #include <optional>     // optional
 #include <ostream>      // ostream
 #include <string>       // string
@@ -15,8 +18,8 @@
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
-#include "../detail/address_of.hpp"
 #include "../detail/clamp.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/max.hpp"
 #include "../detail/owner_handle_api.hpp"
 #include "../math/vector3.hpp"
@@ -2315,6 +2318,38 @@ class basic_haptic final
   }
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_haptic<detail::owning_type>;
+extern template class basic_haptic<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
+/**
+ * \brief Writes a textual representation of a haptic device to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param haptic the haptic device that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_haptic<T>& haptic) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("haptic{data: ",
+                      haptic.get(),
+                      ", name: ",
+                      str_or_na(haptic.name()),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a haptic device.
  *
@@ -2327,8 +2362,7 @@ class basic_haptic final
 template <typename T>
 [[nodiscard]] auto to_string(const basic_haptic<T>& haptic) -> std::string
 {
-  return "haptic{data: " + detail::address_of(haptic.get()) +
-         ", name: " + str_or_na(haptic.name()) + "}";
+  return detail::format_string(haptic);
 }
 
 /**
@@ -2351,4 +2385,5 @@ auto operator<<(std::ostream& stream, const basic_haptic<T>& haptic) -> std::ost
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_HAPTIC
 #endif  // CENTURION_HAPTIC_HEADER
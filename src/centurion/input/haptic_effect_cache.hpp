@@ -0,0 +1,704 @@
+#ifndef CENTURION_HAPTIC_EFFECT_CACHE_HEADER
+#define CENTURION_HAPTIC_EFFECT_CACHE_HEADER
+
+#ifndef CENTURION_NO_HAPTIC
+
+#include <SDL.h>
+
+#include <algorithm>  // equal, upper_bound
+#include <cstddef>    // size_t
+#include <iterator>   // begin, end
+#include <optional>   // optional, nullopt
+#include <tuple>      // tie
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "haptic.hpp"
+
+namespace cen {
+
+/// \cond FALSE
+namespace detail {
+
+template <typename T, std::size_t Size>
+[[nodiscard]] auto haptic_array_eq(const T (&a)[Size], const T (&b)[Size]) noexcept
+    -> bool
+{
+  return std::equal(std::begin(a), std::end(a), std::begin(b));
+}
+
+// Compares the members that every effect but the left/right effect has
+template <typename T>
+[[nodiscard]] auto haptic_common_eq(const T& a, const T& b) noexcept -> bool
+{
+  return a.direction.type == b.direction.type &&
+         haptic_array_eq(a.direction.dir, b.direction.dir) &&
+         std::tie(a.length, a.delay, a.button, a.interval) ==
+             std::tie(b.length, b.delay, b.button, b.interval);
+}
+
+template <typename T>
+[[nodiscard]] auto haptic_envelope_eq(const T& a, const T& b) noexcept -> bool
+{
+  return std::tie(a.attack_length, a.attack_level, a.fade_length, a.fade_level) ==
+         std::tie(b.attack_length, b.attack_level, b.fade_length, b.fade_level);
+}
+
+// Effects are compared member by member, since the padding of the union is unspecified
+[[nodiscard]] inline auto haptic_effect_eq(const SDL_HapticEffect& a,
+                                           const SDL_HapticEffect& b) noexcept -> bool
+{
+  if (a.type != b.type)
+  {
+    return false;
+  }
+
+  switch (a.type)
+  {
+    case SDL_HAPTIC_CONSTANT:
+      return haptic_common_eq(a.constant, b.constant) &&
+             haptic_envelope_eq(a.constant, b.constant) &&
+             a.constant.level == b.constant.level;
+
+    case SDL_HAPTIC_SINE:
+    case SDL_HAPTIC_TRIANGLE:
+    case SDL_HAPTIC_SAWTOOTHUP:
+    case SDL_HAPTIC_SAWTOOTHDOWN: {
+      const auto& x = a.periodic;
+      const auto& y = b.periodic;
+      return haptic_common_eq(x, y) && haptic_envelope_eq(x, y) &&
+             std::tie(x.period, x.magnitude, x.offset, x.phase) ==
+                 std::tie(y.period, y.magnitude, y.offset, y.phase);
+    }
+
+    case SDL_HAPTIC_SPRING:
+    case SDL_HAPTIC_DAMPER:
+    case SDL_HAPTIC_INERTIA:
+    case SDL_HAPTIC_FRICTION: {
+      const auto& x = a.condition;
+      const auto& y = b.condition;
+      return haptic_common_eq(x, y) && haptic_array_eq(x.right_sat, y.right_sat) &&
+             haptic_array_eq(x.left_sat, y.left_sat) &&
+             haptic_array_eq(x.right_coeff, y.right_coeff) &&
+             haptic_array_eq(x.left_coeff, y.left_coeff) &&
+             haptic_array_eq(x.deadband, y.deadband) &&
+             haptic_array_eq(x.center, y.center);
+    }
+
+    case SDL_HAPTIC_RAMP:
+      return haptic_common_eq(a.ramp, b.ramp) && haptic_envelope_eq(a.ramp, b.ramp) &&
+             a.ramp.start == b.ramp.start && a.ramp.end == b.ramp.end;
+
+    case SDL_HAPTIC_LEFTRIGHT:
+      return a.leftright.length == b.leftright.length &&
+             a.leftright.large_magnitude == b.leftright.large_magnitude &&
+             a.leftright.small_magnitude == b.leftright.small_magnitude;
+
+    case SDL_HAPTIC_CUSTOM: {
+      // The samples are compared by address, rather than by value
+      const auto& x = a.custom;
+      const auto& y = b.custom;
+      return haptic_common_eq(x, y) && haptic_envelope_eq(x, y) &&
+             std::tie(x.channels, x.period, x.samples, x.data) ==
+                 std::tie(y.channels, y.period, y.samples, y.data);
+    }
+
+    default:
+      return false;
+  }
+}
+
+}  // namespace detail
+/// \endcond
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class haptic_effect_cache
+ *
+ * \brief Keeps effects uploaded to a haptic device, so that they are only uploaded once.
+ *
+ * \details Uploading an effect with `basic_haptic::upload()` can take milliseconds with
+ * some drivers, so uploading effects as they are needed, e.g. for every hit, stalls the
+ * calling thread. A cache remembers the parameters of the uploaded effects, and reuses
+ * the uploaded effect when an identical effect is played again.
+ *
+ * \details Effects can also be associated with a key, in which case the effect
+ * associated with the key is updated with `SDL_HapticUpdateEffect()` when its parameters
+ * change, e.g. for an engine rumble that follows the speed of a vehicle.
+ * \code{cpp}
+ *   cen::haptic_effect_cache cache{haptic};
+ *
+ *   cache.play(hit);             // Uploaded and played
+ *   cache.play(hit);             // Played
+ *   cache.play(engine, rumble);  // Updated if the parameters of the rumble changed
+ * \endcode
+ *
+ * \details When the cache is full, the least recently used effect that isn't playing is
+ * replaced, preferably one of the same type, since it can be updated rather than
+ * destroyed and uploaded again.
+ *
+ * \note The cache doesn't own the haptic device, which must outlive the cache.
+ * Destroying the cache destroys the uploaded effects.
+ *
+ * \see `haptic_timeline`
+ *
+ * \since 6.1.0
+ */
+class haptic_effect_cache final
+{
+  friend class haptic_timeline;
+
+ public:
+  using effect_id = int;
+  using key_type = u32;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty cache for a haptic device.
+   *
+   * \tparam T the ownership semantics of the haptic device.
+   *
+   * \param haptic the haptic device that the effects are uploaded to.
+   * \param capacity the maximum amount of uploaded effects, which is limited to the
+   * amount of effects that the device can store.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  explicit haptic_effect_cache(basic_haptic<T>& haptic,
+                               const std::optional<size_type> capacity = std::nullopt)
+      : m_haptic{haptic.get()}
+      , m_hasStatus{haptic.has_feature_status()}
+  {
+    // Devices that don't report their capacity are still allowed one effect
+    const auto reported = static_cast<size_type>(haptic.effect_capacity().value_or(1));
+    m_capacity = (capacity && *capacity < reported) ? *capacity : reported;
+  }
+
+  haptic_effect_cache(const haptic_effect_cache&) = delete;
+
+  auto operator=(const haptic_effect_cache&) -> haptic_effect_cache& = delete;
+
+  /**
+   * \brief Destroys the uploaded effects.
+   *
+   * \since 6.1.0
+   */
+  ~haptic_effect_cache() noexcept
+  {
+    clear();
+  }
+
+  /// \name Acquisition
+  /// \{
+
+  /**
+   * \brief Returns the ID of an uploaded effect with the same parameters, uploading the
+   * effect if there isn't one.
+   *
+   * \details This can be used to upload effects ahead of time.
+   *
+   * \tparam D the type of the effect.
+   *
+   * \param effect the effect that will be looked up.
+   *
+   * \return the ID of the uploaded effect; `std::nullopt` if the effect couldn't be
+   * uploaded.
+   *
+   * \since 6.1.0
+   */
+  template <typename D>
+  auto acquire(const haptic_effect<D>& effect) noexcept -> std::optional<effect_id>
+  {
+    return acquire(std::nullopt, effect.get());
+  }
+
+  /**
+   * \brief Returns the ID of the effect associated with a key, which is updated if its
+   * parameters differ from the supplied effect.
+   *
+   * \tparam D the type of the effect.
+   *
+   * \param key the key associated with the effect.
+   * \param effect the current parameters of the effect.
+   *
+   * \return the ID of the uploaded effect; `std::nullopt` if the effect couldn't be
+   * uploaded or updated.
+   *
+   * \since 6.1.0
+   */
+  template <typename D>
+  auto acquire(const key_type key, const haptic_effect<D>& effect) noexcept
+      -> std::optional<effect_id>
+  {
+    return acquire(key, effect.get());
+  }
+
+  /**
+   * \brief Runs an effect, uploading it if there's no identical uploaded effect.
+   *
+   * \tparam D the type of the effect.
+   *
+   * \param effect the effect that will be run.
+   * \param iterations the number of iterations, can be `haptic_infinity`.
+   *
+   * \return the ID of the effect; `std::nullopt` if the effect couldn't be run.
+   *
+   * \since 6.1.0
+   */
+  template <typename D>
+  auto play(const haptic_effect<D>& effect, const u32 iterations = 1) noexcept
+      -> std::optional<effect_id>
+  {
+    return play(std::nullopt, effect.get(), iterations);
+  }
+
+  /**
+   * \brief Runs the effect associated with a key, updating its parameters if necessary.
+   *
+   * \tparam D the type of the effect.
+   *
+   * \param key the key associated with the effect.
+   * \param effect the current parameters of the effect.
+   * \param iterations the number of iterations, can be `haptic_infinity`.
+   *
+   * \return the ID of the effect; `std::nullopt` if the effect couldn't be run.
+   *
+   * \since 6.1.0
+   */
+  template <typename D>
+  auto play(const key_type key,
+            const haptic_effect<D>& effect,
+            const u32 iterations = 1) noexcept -> std::optional<effect_id>
+  {
+    return play(key, effect.get(), iterations);
+  }
+
+  /// \} End of acquisition
+
+  /**
+   * \brief Destroys the effect associated with a key.
+   *
+   * \param key the key of the effect that will be destroyed.
+   *
+   * \return `success` if an effect was destroyed; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto release(const key_type key) noexcept -> result
+  {
+    for (size_type index = 0; index < m_entries.size(); ++index)
+    {
+      if (m_entries[index].key == key)
+      {
+        SDL_HapticDestroyEffect(m_haptic, m_entries[index].id);
+        m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(index));
+        return success;
+      }
+    }
+
+    return failure;
+  }
+
+  /**
+   * \brief Destroys all uploaded effects.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    for (const auto& entry : m_entries)
+    {
+      SDL_HapticDestroyEffect(m_haptic, entry.id);
+    }
+
+    m_entries.clear();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of uploaded effects.
+   *
+   * \return the amount of effects in the cache.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Returns the maximum amount of uploaded effects.
+   *
+   * \return the capacity of the cache.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns the haptic device that the effects are uploaded to.
+   *
+   * \return a handle to the haptic device.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto device() const noexcept -> haptic_handle
+  {
+    return haptic_handle{m_haptic};
+  }
+
+  /// \} End of queries
+
+ private:
+  struct entry final
+  {
+    SDL_HapticEffect effect{};
+    effect_id id{-1};
+    std::optional<key_type> key;
+    u64 lastUse{};
+  };
+
+  SDL_Haptic* m_haptic{};
+  std::vector<entry> m_entries;
+  size_type m_capacity{};
+  u64 m_clock{};  // Incremented by every acquisition, to find the least recently used
+  bool m_hasStatus{};
+
+  auto play(const std::optional<key_type> key,
+            const SDL_HapticEffect& effect,
+            const u32 iterations) noexcept -> std::optional<effect_id>
+  {
+    const auto id = acquire(key, effect);
+    if (id && SDL_HapticRunEffect(m_haptic, *id, iterations) == 0)
+    {
+      return id;
+    }
+    else
+    {
+      return std::nullopt;
+    }
+  }
+
+  auto acquire(const std::optional<key_type> key, const SDL_HapticEffect& effect) noexcept
+      -> std::optional<effect_id>
+  {
+    ++m_clock;
+
+    for (size_type index = 0; index < m_entries.size(); ++index)
+    {
+      auto& entry = m_entries[index];
+      const auto found =
+          key ? (entry.key == key)
+              : (!entry.key && detail::haptic_effect_eq(entry.effect, effect));
+
+      if (found)
+      {
+        if (!detail::haptic_effect_eq(entry.effect, effect) && !replace(index, effect))
+        {
+          return std::nullopt;
+        }
+
+        m_entries[index].lastUse = m_clock;
+        return m_entries[index].id;
+      }
+    }
+
+    // Effects are only recycled once the cache (or the device) is full
+    if (m_entries.size() < m_capacity)
+    {
+      auto internal = effect;
+      const auto id = SDL_HapticNewEffect(m_haptic, &internal);
+      if (id != -1)
+      {
+        m_entries.push_back(entry{effect, id, key, m_clock});
+        return id;
+      }
+    }
+
+    if (const auto victim = find_victim(effect.type); victim && replace(*victim, effect))
+    {
+      m_entries[*victim].key = key;
+      m_entries[*victim].lastUse = m_clock;
+      return m_entries[*victim].id;
+    }
+
+    return std::nullopt;
+  }
+
+  // Replaces the effect of an entry, which is removed if the new effect can't be uploaded
+  auto replace(const size_type index, const SDL_HapticEffect& effect) noexcept -> bool
+  {
+    auto& entry = m_entries[index];
+    auto internal = effect;
+
+    // The type of an uploaded effect can't be changed
+    if (entry.effect.type == effect.type)
+    {
+      if (SDL_HapticUpdateEffect(m_haptic, entry.id, &internal) == 0)
+      {
+        entry.effect = effect;
+        return true;
+      }
+    }
+
+    SDL_HapticDestroyEffect(m_haptic, entry.id);
+
+    const auto id = SDL_HapticNewEffect(m_haptic, &internal);
+    if (id != -1)
+    {
+      entry.effect = effect;
+      entry.id = id;
+      return true;
+    }
+    else
+    {
+      m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(index));
+      return false;
+    }
+  }
+
+  // Returns the least recently used idle entry, preferring entries of the same type
+  [[nodiscard]] auto find_victim(const u16 type) const noexcept
+      -> std::optional<size_type>
+  {
+    std::optional<size_type> any;
+    std::optional<size_type> same;
+
+    for (size_type index = 0; index < m_entries.size(); ++index)
+    {
+      const auto& entry = m_entries[index];
+      if (m_hasStatus && SDL_HapticGetEffectStatus(m_haptic, entry.id) == 1)
+      {
+        continue;
+      }
+
+      if (!any || entry.lastUse < m_entries[*any].lastUse)
+      {
+        any = index;
+      }
+
+      const auto sameType = entry.effect.type == type;
+      if (sameType && (!same || entry.lastUse < m_entries[*same].lastUse))
+      {
+        same = index;
+      }
+    }
+
+    return same ? same : any;
+  }
+};
+
+/**
+ * \class haptic_timeline
+ *
+ * \brief Plays a sequence of haptic effects on a device, at fixed offsets.
+ *
+ * \details A timeline doesn't depend on a clock, instead it's advanced by the elapsed
+ * time, e.g. every frame, and runs the effects whose offsets have been reached. The
+ * effects are played through a cache, so they can be uploaded ahead of time with
+ * `preload()`, and identical effects share a single uploaded effect.
+ * \code{cpp}
+ *   cen::haptic_timeline explosion{cache};
+ *   explosion.add(cen::milliseconds<cen::u32>{0}, blast);
+ *   explosion.add(cen::milliseconds<cen::u32>{150}, rumble, 3);
+ *   explosion.preload();
+ *
+ *   // In the game loop
+ *   explosion.advance(delta);
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+class haptic_timeline final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty timeline.
+   *
+   * \param cache the cache used to play the effects, must outlive the timeline.
+   *
+   * \since 6.1.0
+   */
+  explicit haptic_timeline(haptic_effect_cache& cache) noexcept : m_cache{&cache}
+  {}
+
+  /**
+   * \brief Adds an effect to the timeline.
+   *
+   * \details Effects with the same offset are run in the order that they were added.
+   *
+   * \tparam D the type of the effect.
+   *
+   * \param offset the time from the start of the timeline until the effect is run.
+   * \param effect the effect that will be run, which is copied.
+   * \param iterations the number of iterations, can be `haptic_infinity`.
+   *
+   * \since 6.1.0
+   */
+  template <typename D>
+  void add(const milliseconds<u32> offset,
+           const haptic_effect<D>& effect,
+           const u32 iterations = 1)
+  {
+    const event added{offset, effect.get(), iterations};
+    const auto position = std::upper_bound(
+        m_events.begin(),
+        m_events.end(),
+        added,
+        [](const event& a, const event& b) noexcept { return a.offset < b.offset; });
+
+    const auto index = static_cast<size_type>(position - m_events.begin());
+    m_events.insert(position, added);
+
+    // Effects before the current position have already been run, or skipped
+    if (index < m_next)
+    {
+      ++m_next;
+    }
+  }
+
+  /**
+   * \brief Uploads all effects of the timeline, so that playing it doesn't upload any.
+   *
+   * \return `success` if all effects were uploaded; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto preload() noexcept -> result
+  {
+    bool ok = true;
+    for (const auto& event : m_events)
+    {
+      ok = m_cache->acquire(std::nullopt, event.effect).has_value() && ok;
+    }
+
+    return ok;
+  }
+
+  /**
+   * \brief Advances the timeline, running the effects whose offsets have been reached.
+   *
+   * \param delta the amount of time since the previous call.
+   *
+   * \return the amount of effects that were successfully run.
+   *
+   * \since 6.1.0
+   */
+  auto advance(const milliseconds<u32> delta) noexcept(noexcept(delta.count()))
+      -> size_type
+  {
+    m_elapsed += delta;
+
+    size_type count = 0;
+    while (m_next < m_events.size() && m_events[m_next].offset <= m_elapsed)
+    {
+      const auto& event = m_events[m_next];
+      if (m_cache->play(std::nullopt, event.effect, event.iterations))
+      {
+        ++count;
+      }
+
+      ++m_next;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Moves the timeline back to the start, without stopping running effects.
+   *
+   * \since 6.1.0
+   */
+  void restart() noexcept
+  {
+    m_elapsed = milliseconds<u32>::zero();
+    m_next = 0;
+  }
+
+  /**
+   * \brief Removes all effects from the timeline.
+   *
+   * \details The uploaded effects remain in the cache.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_events.clear();
+    restart();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not all effects have been run.
+   *
+   * \return `true` if the end of the timeline has been reached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_finished() const noexcept -> bool
+  {
+    return m_next == m_events.size();
+  }
+
+  /**
+   * \brief Returns the time since the start of the timeline.
+   *
+   * \return the elapsed time.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto elapsed() const noexcept -> milliseconds<u32>
+  {
+    return m_elapsed;
+  }
+
+  /**
+   * \brief Returns the amount of effects in the timeline.
+   *
+   * \return the amount of effects.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_events.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct event final
+  {
+    milliseconds<u32> offset{};
+    SDL_HapticEffect effect{};
+    u32 iterations{};
+  };
+
+  haptic_effect_cache* m_cache{};
+  std::vector<event> m_events;
+  milliseconds<u32> m_elapsed{};
+  size_type m_next{};
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_HAPTIC
+#endif  // CENTURION_HAPTIC_EFFECT_CACHE_HEADER
@@ -4,6 +4,7 @@
 #include <SDL.h>
 
 #include <cassert>   // assert
+#include <cstddef>   // size_t
 #include <optional>  // optional
 #include <ostream>   // ostream
 #include <string>    // string
@@ -16,10 +17,9 @@
 #include "../core/result.hpp"
 #include "../core/time.hpp"
 #include "../core/to_underlying.hpp"
-#include "../detail/address_of.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/owner_handle_api.hpp"
 #include "../detail/sdl_version_at_least.hpp"
-#include "../detail/to_string.hpp"
 #include "../video/color.hpp"
 #include "button_state.hpp"
 
@@ -1133,19 +1133,31 @@ class basic_joystick final
   detail::pointer_manager<T, SDL_Joystick, deleter> m_joystick;
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_joystick<detail::owning_type>;
+extern template class basic_joystick<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
 /**
- * \brief Returns a textual representation of a joystick.
+ * \brief Writes a textual representation of a joystick to a buffer.
  *
  * \tparam T the ownership semantics tag for the joystick.
  *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
  * \param joystick the joystick that will be converted.
  *
- * \return a string representation of the joystick.
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
  *
- * \since 6.0.0
+ * \since 6.1.0
  */
 template <typename T>
-[[nodiscard]] auto to_string(const basic_joystick<T>& joystick) -> std::string
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_joystick<T>& joystick) noexcept -> std::size_t
 {
   czstring serial{};
   if constexpr (detail::sdl_version_at_least(2, 0, 14))
@@ -1153,9 +1165,33 @@ template <typename T>
     serial = joystick.serial();
   }
 
-  return "joystick{data: " + detail::address_of(joystick.get()) +
-         ", id: " + detail::to_string(joystick.instance_id()).value() +
-         ", name: " + str_or_na(joystick.name()) + ", serial: " + str_or_na(serial) + "}";
+  detail::format_writer writer{buffer, size};
+  return writer.write("joystick{data: ",
+                      joystick.get(),
+                      ", id: ",
+                      joystick.instance_id(),
+                      ", name: ",
+                      str_or_na(joystick.name()),
+                      ", serial: ",
+                      str_or_na(serial),
+                      "}");
+}
+
+/**
+ * \brief Returns a textual representation of a joystick.
+ *
+ * \tparam T the ownership semantics tag for the joystick.
+ *
+ * \param joystick the joystick that will be converted.
+ *
+ * \return a string representation of the joystick.
+ *
+ * \since 6.0.0
+ */
+template <typename T>
+[[nodiscard]] auto to_string(const basic_joystick<T>& joystick) -> std::string
+{
+  return detail::format_string(joystick);
 }
 
 /**
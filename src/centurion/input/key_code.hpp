@@ -4,12 +4,15 @@
 #include <SDL.h>
 
 #include <cassert>  // assert
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
 #include "../core/czstring.hpp"
 #include "../core/macros.hpp"
 #include "../core/not_null.hpp"
+#include "../detail/format_writer.hpp"
+#include "../detail/key_name_table.hpp"
 
 namespace cen {
 
@@ -97,7 +100,7 @@ class key_code final
    * \since 5.0.0
    */
   explicit key_code(const not_null<czstring> name) noexcept
-      : m_key{static_cast<SDL_KeyCode>(SDL_GetKeyFromName(name))}
+      : m_key{static_cast<SDL_KeyCode>(detail::key_name_table::get().to_key_code(name))}
   {}
 
   /**
@@ -169,7 +172,7 @@ class key_code final
   auto operator=(const not_null<czstring> name) noexcept -> key_code&
   {
     assert(name);
-    m_key = static_cast<SDL_KeyCode>(SDL_GetKeyFromName(name));
+    m_key = static_cast<SDL_KeyCode>(detail::key_name_table::get().to_key_code(name));
     return *this;
   }
 
@@ -314,6 +317,26 @@ class key_code final
   SDL_KeyCode m_key{SDLK_UNKNOWN};
 };
 
+/**
+ * \brief Writes a textual representation of a key code to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param keyCode the key code that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer,
+                      const std::size_t size,
+                      const key_code& keyCode) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("key_code{key: ", SDL_GetKeyName(keyCode.get()), "}");
+}
+
 /**
  * \brief Returns a textual representation of a key code.
  *
@@ -325,7 +348,7 @@ class key_code final
  */
 [[nodiscard]] inline auto to_string(const key_code& keyCode) -> std::string
 {
-  return "key_code{key: " + keyCode.name() + "}";
+  return detail::format_string(keyCode);
 }
 
 /**
@@ -3,11 +3,13 @@
 
 #include <SDL.h>
 
-#include <algorithm>  // copy
-#include <array>      // array
+#include <array>    // array
+#include <cstddef>  // size_t
 
 #include "../compiler/compiler.hpp"
 #include "../core/integers.hpp"
+#include "../detail/keymap_table.hpp"
+#include "../detail/simd_dispatch.hpp"
 #include "key_code.hpp"
 #include "key_modifier.hpp"
 #include "scan_code.hpp"
@@ -25,6 +27,10 @@ namespace cen {
  * \details Using the keyboard state is an alternative to using events for
  * keyboard input.
  *
+ * \details Key codes are translated to scan codes with a table that is built from the
+ * current keyboard layout, and rebuilt automatically when the layout changes, so querying
+ * keys by their key codes is about as cheap as querying them by their scan codes.
+ *
  * \see `mouse`
  * \see `has_screen_keyboard()`
  *
@@ -32,7 +38,84 @@ namespace cen {
  */
 class keyboard final
 {
+  using word_type = u64;
+
+  inline static constexpr int bits_per_word = 64;
+  inline static constexpr int word_count =
+      (cen::scan_code::count() + bits_per_word - 1) / bits_per_word;
+
  public:
+  /**
+   * \class change_range
+   *
+   * \brief A view of the scan codes of the keys that changed in the last update.
+   *
+   * \since 6.1.0
+   */
+  class change_range final
+  {
+   public:
+    class iterator final
+    {
+     public:
+      explicit iterator(const u16* ptr) noexcept : m_ptr{ptr}
+      {}
+
+      [[nodiscard]] auto operator*() const noexcept -> scan_code
+      {
+        return scan_code{static_cast<SDL_Scancode>(*m_ptr)};
+      }
+
+      auto operator++() noexcept -> iterator&
+      {
+        ++m_ptr;
+        return *this;
+      }
+
+      [[nodiscard]] auto operator==(const iterator& other) const noexcept -> bool
+      {
+        return m_ptr == other.m_ptr;
+      }
+
+      [[nodiscard]] auto operator!=(const iterator& other) const noexcept -> bool
+      {
+        return m_ptr != other.m_ptr;
+      }
+
+     private:
+      const u16* m_ptr{};
+    };
+
+    change_range(const u16* first, const u16* last) noexcept
+        : m_first{first}
+        , m_last{last}
+    {}
+
+    [[nodiscard]] auto begin() const noexcept -> iterator
+    {
+      return iterator{m_first};
+    }
+
+    [[nodiscard]] auto end() const noexcept -> iterator
+    {
+      return iterator{m_last};
+    }
+
+    [[nodiscard]] auto size() const noexcept -> std::size_t
+    {
+      return static_cast<std::size_t>(m_last - m_first);
+    }
+
+    [[nodiscard]] auto empty() const noexcept -> bool
+    {
+      return m_first == m_last;
+    }
+
+   private:
+    const u16* m_first{};
+    const u16* m_last{};
+  };
+
   /**
    * \brief Creates a `keyboard` instance.
    *
@@ -46,13 +129,91 @@ class keyboard final
   /**
    * \brief Updates the state of the key state object.
    *
+   * \details The key states are stored as a bitset, which is compared to the bitset of
+   * the previous update in order to find the keys that changed, see `changed_keys()`.
+   *
+   * \details The table that translates key codes to scan codes is rebuilt first, if the
+   * keyboard layout changed since the last update.
+   *
    * \note `SDL_PumpEvents` isn't invoked by this method.
    *
    * \since 3.0.0
    */
-  void update()
+  void update() noexcept
   {
-    std::copy(m_states, m_states + m_nKeys, m_previous.begin());
+    m_keymap.refresh();
+
+    const auto old = m_previous;
+    pack(m_previous);
+
+    m_nChanged = 0;
+    for (int word = 0; word < word_count; ++word)
+    {
+      auto diff = old[word] ^ m_previous[word];
+      while (diff != 0)
+      {
+        const auto bit = lowest_bit(diff);
+        m_changed[m_nChanged++] = static_cast<u16>(word * bits_per_word + bit);
+        diff &= diff - 1u;
+      }
+    }
+  }
+
+  /**
+   * \brief Returns the keys whose state changed between the last two updates.
+   *
+   * \details This is cheaper than checking lots of keys with `just_pressed()` or
+   * `just_released()`, since most keys usually don't change. Whether a key was pressed
+   * or released can be determined with `was_pressed()`.
+   * \code{cpp}
+   *   keyboard.update();
+   *   for (const auto code : keyboard.changed_keys()) {
+   *     if (keyboard.was_pressed(code)) {
+   *       // ...
+   *     }
+   *   }
+   * \endcode
+   *
+   * \return the scan codes of the changed keys, in ascending order.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto changed_keys() const noexcept -> change_range
+  {
+    return change_range{m_changed.data(), m_changed.data() + m_nChanged};
+  }
+
+  /**
+   * \brief Indicates whether or not a key was pressed in the last update.
+   *
+   * \details Unlike `is_pressed()`, this function is based on the state obtained in the
+   * last call to `update()`, rather than the current state.
+   *
+   * \param code the scan code that will be checked.
+   *
+   * \return `true` if the key was pressed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto was_pressed(const scan_code& code) const noexcept -> bool
+  {
+    return check_state(code, [this](const SDL_Scancode sc) noexcept {
+      return previous(sc);
+    });
+  }
+
+  /**
+   * \brief Indicates whether or not a key was pressed in the last update.
+   *
+   * \param code the key code that will be checked.
+   *
+   * \return `true` if the key was pressed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto was_pressed(const key_code& code) const noexcept -> bool
+  {
+    return was_pressed(m_keymap.to_scan_code(code.get()));
   }
 
   /**
@@ -78,8 +239,6 @@ class keyboard final
    *
    * \details This method returns false if the supplied key isn't recognized.
    *
-   * \note This method is slightly slower that the `scan_code` version.
-   *
    * \param code the key code that will be checked.
    *
    * \return `true` if the key is being pressed; `false` otherwise.
@@ -88,7 +247,7 @@ class keyboard final
    */
   [[nodiscard]] auto is_pressed(const key_code& code) const noexcept -> bool
   {
-    return is_pressed(code.to_scan_code());
+    return is_pressed(m_keymap.to_scan_code(code.get()));
   }
 
   /**
@@ -106,7 +265,7 @@ class keyboard final
   [[nodiscard]] auto is_held(const scan_code& code) const noexcept(on_msvc()) -> bool
   {
     return check_state(code, [this](const SDL_Scancode sc) noexcept(on_msvc()) {
-      return m_states[sc] && m_previous[sc];
+      return m_states[sc] && previous(sc);
     });
   }
 
@@ -116,8 +275,6 @@ class keyboard final
    *
    * \details This method returns false if the supplied key isn't recognized.
    *
-   * \note This method is slightly slower that the `scan_code` version.
-   *
    * \param code the key code that will be checked.
    *
    * \return `true` if the key has been held down; `false` otherwise.
@@ -126,7 +283,7 @@ class keyboard final
    */
   [[nodiscard]] auto is_held(const key_code& code) const noexcept(on_msvc()) -> bool
   {
-    return is_held(code.to_scan_code());
+    return is_held(m_keymap.to_scan_code(code.get()));
   }
 
   /**
@@ -144,7 +301,7 @@ class keyboard final
   [[nodiscard]] auto just_pressed(const scan_code& code) const noexcept(on_msvc()) -> bool
   {
     return check_state(code, [this](const SDL_Scancode sc) noexcept(on_msvc()) {
-      return m_states[sc] && !m_previous[sc];
+      return m_states[sc] && !previous(sc);
     });
   }
 
@@ -154,8 +311,6 @@ class keyboard final
    *
    * \details This method returns false if the supplied key isn't recognized.
    *
-   * \note This method is slightly slower that the `scan_code` version.
-   *
    * \param code the key code that will be checked.
    *
    * \return `true` if the key has just been pressed; `false` otherwise.
@@ -164,7 +319,7 @@ class keyboard final
    */
   [[nodiscard]] auto just_pressed(const key_code& code) const noexcept(on_msvc()) -> bool
   {
-    return just_pressed(code.to_scan_code());
+    return just_pressed(m_keymap.to_scan_code(code.get()));
   }
 
   /**
@@ -183,7 +338,7 @@ class keyboard final
       -> bool
   {
     return check_state(code, [this](const SDL_Scancode sc) noexcept(on_msvc()) {
-      return !m_states[sc] && m_previous[sc];
+      return !m_states[sc] && previous(sc);
     });
   }
 
@@ -193,8 +348,6 @@ class keyboard final
    *
    * \details This method returns false if the supplied key isn't recognized.
    *
-   * \note This method is slightly slower that the `scan_code` version.
-   *
    * \param code the key code that will be checked.
    *
    * \return `true` if the key was released; `false` otherwise.
@@ -203,7 +356,7 @@ class keyboard final
    */
   [[nodiscard]] auto just_released(const key_code& code) const noexcept(on_msvc()) -> bool
   {
-    return just_released(code.to_scan_code());
+    return just_released(m_keymap.to_scan_code(code.get()));
   }
 
   /**
@@ -222,6 +375,20 @@ class keyboard final
     return static_cast<SDL_Keymod>(modifier) & SDL_GetModState();
   }
 
+  /**
+   * \brief Rebuilds the table that translates key codes to scan codes.
+   *
+   * \details This is done automatically by `update()` after `SDL_KEYMAPCHANGED` is
+   * emitted, so this is only needed if the layout could have changed without the event,
+   * e.g. if SDL was reinitialized, which removes all event watches.
+   *
+   * \since 6.1.0
+   */
+  void refresh_keymap() noexcept
+  {
+    m_keymap.build();
+  }
+
   /**
    * \brief Returns the total amount of keys.
    *
@@ -236,8 +403,64 @@ class keyboard final
 
  private:
   const u8* m_states{};
-  std::array<u8, cen::scan_code::count()> m_previous{};
+  std::array<word_type, word_count> m_previous{};  // The states of the last update
+  std::array<u16, cen::scan_code::count()> m_changed{};
+  int m_nChanged{};
   int m_nKeys{};
+  detail::keymap_table m_keymap;
+
+  [[nodiscard]] auto previous(const SDL_Scancode sc) const noexcept -> bool
+  {
+    const auto index = static_cast<int>(sc);
+    return (m_previous[index / bits_per_word] >> (index % bits_per_word)) & 1u;
+  }
+
+  // Packs the current key states into a bitset, with one bit per key
+  void pack(std::array<word_type, word_count>& bits) const noexcept
+  {
+    bits.fill(0);
+
+    const auto count = (m_nKeys < scan_code::count()) ? m_nKeys : scan_code::count();
+    int index = 0;
+
+#ifdef CENTURION_DETAIL_SSE2_KERNELS
+    const auto zero = _mm_setzero_si128();
+    for (; index + 16 <= count; index += 16)
+    {
+      const auto* block = reinterpret_cast<const __m128i*>(m_states + index);
+      const auto bytes = _mm_loadu_si128(block);
+
+      // The key states are either 0 or 1, so all nonzero bytes are pressed keys
+      const auto released = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero));
+      const auto mask = static_cast<word_type>(~released & 0xFFFF);
+
+      bits[index / bits_per_word] |= mask << (index % bits_per_word);
+    }
+#endif  // CENTURION_DETAIL_SSE2_KERNELS
+
+    for (; index < count; ++index)
+    {
+      if (m_states[index])
+      {
+        bits[index / bits_per_word] |= word_type{1} << (index % bits_per_word);
+      }
+    }
+  }
+
+  [[nodiscard]] static auto lowest_bit(const word_type value) noexcept -> int
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(value);
+#else
+    int result = 0;
+    while (!((value >> result) & 1u))
+    {
+      ++result;
+    }
+
+    return result;
+#endif
+  }
 
   template <typename Predicate>
   auto check_state(const cen::scan_code& code, Predicate&& predicate) const
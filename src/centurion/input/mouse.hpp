@@ -1,6 +1,8 @@
 #ifndef CENTURION_MOUSE_HEADER
 #define CENTURION_MOUSE_HEADER
 
+#include <SDL.h>
+
 #include "../core/integers.hpp"
 #include "../detail/max.hpp"
 #include "../math/area.hpp"
@@ -17,6 +19,22 @@ namespace cen {
  * \brief Provides information about the mouse state, which is an alternative to dealing
  * with mouse events.
  *
+ * \details The mouse state is sampled once per update, so the motion between two updates
+ * is only available as the difference of the positions, which is lost when the cursor
+ * is confined. Feeding the mouse events to `accumulate()` instead makes the relative
+ * motion and wheel scrolling of every event since the last update available, see
+ * `motion()` and `wheel()`.
+ * \code{cpp}
+ *   cen::mouse mouse;
+ *   dispatcher.set_mouse(&mouse);
+ *
+ *   // Every frame
+ *   dispatcher.poll_batched();
+ *   mouse.update(window.width(), window.height());
+ *
+ *   camera.rotate(mouse.motion().x() * sensitivity);
+ * \endcode
+ *
  * \since 3.0.0
  *
  * \see `keyboard`
@@ -42,6 +60,19 @@ class mouse final
    */
   void update(const int windowWidth = 1, const int windowHeight = 1) noexcept
   {
+    const auto xScale = static_cast<float>(m_logicalWidth) /
+                        static_cast<float>(detail::max(windowWidth, 1));
+    const auto yScale = static_cast<float>(m_logicalHeight) /
+                        static_cast<float>(detail::max(windowHeight, 1));
+
+    m_motion = {static_cast<float>(m_accumulatedX) * xScale,
+                static_cast<float>(m_accumulatedY) * yScale};
+    m_wheel = m_accumulatedWheel;
+
+    m_accumulatedX = 0;
+    m_accumulatedY = 0;
+    m_accumulatedWheel = {};
+
     m_oldX = m_mouseX;
     m_oldY = m_mouseY;
     m_prevLeftPressed = m_leftPressed;
@@ -79,6 +110,61 @@ class mouse final
     update(size.width, size.height);
   }
 
+  /**
+   * \brief Accumulates the relative motion and wheel scrolling of a mouse event.
+   *
+   * \details The accumulated values are made available by the next update, see
+   * `motion()` and `wheel()`. Other kinds of events are ignored.
+   *
+   * \param event the event that will be accumulated.
+   *
+   * \see `event_dispatcher::set_mouse()`
+   *
+   * \since 6.1.0
+   */
+  void accumulate(const SDL_Event& event) noexcept
+  {
+    if (event.type == SDL_MOUSEMOTION)
+    {
+      m_accumulatedX += event.motion.xrel;
+      m_accumulatedY += event.motion.yrel;
+    }
+    else if (event.type == SDL_MOUSEWHEEL)
+    {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+      auto x = event.wheel.preciseX;
+      auto y = event.wheel.preciseY;
+#else
+      auto x = static_cast<float>(event.wheel.x);
+      auto y = static_cast<float>(event.wheel.y);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+      if (event.wheel.direction == SDL_MOUSEWHEEL_FLIPPED)
+      {
+        x = -x;
+        y = -y;
+      }
+
+      m_accumulatedWheel = m_accumulatedWheel + fpoint{x, y};
+    }
+  }
+
+  /**
+   * \brief Accumulates the relative motion and wheel scrolling of several events.
+   *
+   * \param events the events that will be accumulated, e.g. from `event::drain()`.
+   * \param count the amount of events.
+   *
+   * \since 6.1.0
+   */
+  void accumulate(const SDL_Event* events, const int count) noexcept
+  {
+    for (int index = 0; index < count; ++index)
+    {
+      accumulate(events[index]);
+    }
+  }
+
   /**
    * \brief Resets the screen and logical dimensions of the mouse state instance.
    *
@@ -205,6 +291,42 @@ class mouse final
     return {m_mouseX, m_mouseY};
   }
 
+  /**
+   * \brief Returns the relative motion of the mouse between the last two updates.
+   *
+   * \details The motion is the sum of the relative motion of all accumulated events,
+   * scaled by the ratio of the logical size to the window size, so no motion is lost,
+   * even if the cursor is confined or the mouse reports at a higher rate than the frame
+   * rate.
+   *
+   * \return the accumulated relative motion in logical coordinates.
+   *
+   * \see `accumulate()`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto motion() const noexcept -> fpoint
+  {
+    return m_motion;
+  }
+
+  /**
+   * \brief Returns the wheel scrolling between the last two updates.
+   *
+   * \details Positive values scroll to the right and away from the user, regardless of
+   * whether the scroll direction is flipped by the system.
+   *
+   * \return the accumulated horizontal and vertical scrolling.
+   *
+   * \see `accumulate()`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto wheel() const noexcept -> fpoint
+  {
+    return m_wheel;
+  }
+
   /**
    * \brief Returns the logical width used by the mouse state instance.
    *
@@ -272,6 +394,11 @@ class mouse final
   int m_oldY{};
   int m_logicalWidth{1};
   int m_logicalHeight{1};
+  i64 m_accumulatedX{};
+  i64 m_accumulatedY{};
+  fpoint m_accumulatedWheel;
+  fpoint m_motion;
+  fpoint m_wheel;
   bool m_leftPressed{};
   bool m_rightPressed{};
   bool m_prevLeftPressed{};
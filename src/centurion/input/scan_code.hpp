@@ -4,12 +4,15 @@
 #include <SDL.h>
 
 #include <cassert>  // assert
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
 #include "../core/czstring.hpp"
 #include "../core/macros.hpp"
 #include "../core/not_null.hpp"
+#include "../detail/format_writer.hpp"
+#include "../detail/key_name_table.hpp"
 
 namespace cen {
 
@@ -90,7 +93,7 @@ class scan_code final
    * \since 5.0.0
    */
   explicit scan_code(const not_null<czstring> name) noexcept
-      : m_code{SDL_GetScancodeFromName(name)}
+      : m_code{detail::key_name_table::get().to_scan_code(name)}
   {}
 
   /**
@@ -162,7 +165,7 @@ class scan_code final
   auto operator=(const not_null<czstring> name) noexcept -> scan_code&
   {
     assert(name);
-    m_code = SDL_GetScancodeFromName(name);
+    m_code = detail::key_name_table::get().to_scan_code(name);
     return *this;
   }
 
@@ -309,6 +312,26 @@ class scan_code final
   SDL_Scancode m_code{SDL_SCANCODE_UNKNOWN};
 };
 
+/**
+ * \brief Writes a textual representation of a scan code to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param scanCode the scan code that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer,
+                      const std::size_t size,
+                      const scan_code& scanCode) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("scan_code{key: ", SDL_GetScancodeName(scanCode.get()), "}");
+}
+
 /**
  * \brief Returns a textual representation of a scan code.
  *
@@ -320,7 +343,7 @@ class scan_code final
  */
 [[nodiscard]] inline auto to_string(const scan_code& scanCode) -> std::string
 {
-  return "scan_code{key: " + scanCode.name() + "}";
+  return detail::format_string(scanCode);
 }
 
 /**
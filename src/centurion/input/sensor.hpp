@@ -1,6 +1,8 @@
 #ifndef CENTURION_SENSOR_HEADER
 #define CENTURION_SENSOR_HEADER
 
+#ifndef CENTURION_NO_SENSOR
+
 #include <SDL.h>
 
 #include <array>     // array
@@ -13,9 +15,8 @@
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/owner.hpp"
-#include "../detail/address_of.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/owner_handle_api.hpp"
-#include "../detail/to_string.hpp"
 
 namespace cen {
 
@@ -397,6 +398,40 @@ class basic_sensor final
   detail::pointer_manager<T, SDL_Sensor, deleter> m_sensor;
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_sensor<detail::owning_type>;
+extern template class basic_sensor<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
+/**
+ * \brief Writes a textual representation of a sensor instance to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param sensor the sensor that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_sensor<T>& sensor) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("sensor{data: ",
+                      sensor.get(),
+                      ", id: ",
+                      sensor.id(),
+                      ", name: ",
+                      str_or_na(sensor.name()),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a sensor instance.
  *
@@ -409,9 +444,7 @@ class basic_sensor final
 template <typename T>
 [[nodiscard]] auto to_string(const basic_sensor<T>& sensor) -> std::string
 {
-  return "sensor{data: " + detail::address_of(sensor.get()) +
-         ", id: " + detail::to_string(sensor.id()).value() +
-         ", name: " + str_or_na(sensor.name()) + "}";
+  return detail::format_string(sensor);
 }
 
 /**
@@ -497,4 +530,5 @@ auto operator<<(std::ostream& stream, const basic_sensor<T>& sensor) -> std::ost
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_SENSOR
 #endif  // CENTURION_SENSOR_HEADER
@@ -0,0 +1,661 @@
+#ifndef CENTURION_SENSOR_STREAM_HEADER
+#define CENTURION_SENSOR_STREAM_HEADER
+
+#ifndef CENTURION_NO_SENSOR
+
+#include <SDL.h>
+
+#include <array>    // array
+#include <atomic>   // atomic, memory_order_...
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../math/vector3.hpp"
+#include "../thread/spsc_queue.hpp"
+#include "sensor.hpp"
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \struct sensor_sample
+ *
+ * \brief A single reading of a sensor, obtained from an `SDL_SENSORUPDATE` event.
+ *
+ * \since 6.1.0
+ */
+struct sensor_sample final
+{
+  microseconds<u64> timestamp{};  ///< The time of the reading.
+  std::array<float, 6> values{};  ///< The sensor data, see `SDL_SensorEvent`.
+
+  /**
+   * \brief Returns the first three values, i.e. the axes of gyroscopes and
+   * accelerometers.
+   *
+   * \return the values as a vector.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto xyz() const noexcept -> vector3<float>
+  {
+    return {values[0], values[1], values[2]};
+  }
+};
+
+/// \cond FALSE
+namespace detail {
+
+template <typename Event>
+[[nodiscard]] auto sensor_timestamp(const Event& event) noexcept -> microseconds<u64>
+{
+#if SDL_VERSION_ATLEAST(2, 26, 0)
+  return microseconds<u64>{event.timestamp_us};
+#else
+  return microseconds<u64>{u64{event.timestamp} * 1'000u};
+#endif  // SDL_VERSION_ATLEAST(2, 26, 0)
+}
+
+// The ring used by the sensor streams, which counts the readings that don't fit
+template <std::size_t Capacity>
+class sensor_ring final
+{
+ public:
+  auto push(const sensor_sample& sample) noexcept -> bool
+  {
+    if (m_samples.try_push(sample))
+    {
+      return true;
+    }
+    else
+    {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+  }
+
+  auto try_pop(sensor_sample& sample) noexcept -> bool
+  {
+    return m_samples.try_pop(sample);
+  }
+
+  template <typename F>
+  auto drain(F&& callable) -> std::size_t
+  {
+    std::size_t count = 0;
+
+    sensor_sample sample;
+    while (m_samples.try_pop(sample))
+    {
+      callable(sample);
+      ++count;
+    }
+
+    return count;
+  }
+
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  spsc_queue<sensor_sample, Capacity> m_samples;
+  std::atomic<u64> m_dropped{0};
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class sensor_stream
+ *
+ * \brief Captures every reading of a sensor, rather than only the latest one.
+ *
+ * \details `basic_sensor::data()` only returns the latest reading, so the readings of
+ * gyroscopes and accelerometers that update faster than the frame rate are lost. A
+ * stream registers an event watch that copies the `SDL_SENSORUPDATE` events of a sensor
+ * into a lock-free ring, as soon as they are pushed to the event queue, from which the
+ * readings are drained, e.g. once per frame.
+ * \code{cpp}
+ *   cen::sensor_stream<> gyro{sensor};
+ *   cen::gyro_integrator rotation;
+ *
+ *   // Every frame, after polling the events
+ *   gyro.drain([&](const cen::sensor_sample& sample) { rotation.add(sample); });
+ * \endcode
+ *
+ * \note The event watch is invoked by the thread that pushes the events, which is the
+ * thread that pumps the events, and the readings must be drained by a single thread.
+ * Readings are dropped if the ring is full.
+ *
+ * \tparam Capacity the maximum amount of buffered readings, must be a power of two.
+ *
+ * \since 6.1.0
+ */
+template <std::size_t Capacity = 256>
+class sensor_stream final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Starts capturing the readings of a sensor.
+   *
+   * \param id the instance ID of the sensor.
+   *
+   * \throws sdl_error if the ring can't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit sensor_stream(const sensor_id id) : m_id{id}
+  {
+    SDL_AddEventWatch(&on_event, this);
+  }
+
+  /**
+   * \brief Starts capturing the readings of a sensor.
+   *
+   * \tparam T the ownership semantics of the sensor.
+   *
+   * \param sensor the sensor that will be captured.
+   *
+   * \throws sdl_error if the ring can't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  explicit sensor_stream(const basic_sensor<T>& sensor) : sensor_stream{sensor.id()}
+  {}
+
+  sensor_stream(const sensor_stream&) = delete;
+
+  auto operator=(const sensor_stream&) -> sensor_stream& = delete;
+
+  /**
+   * \brief Stops capturing the readings.
+   *
+   * \since 6.1.0
+   */
+  ~sensor_stream() noexcept
+  {
+    SDL_DelEventWatch(&on_event, this);
+  }
+
+  /**
+   * \brief Captures a sensor event, if it belongs to the sensor of the stream.
+   *
+   * \details This is what the event watch does, which makes it possible to feed the
+   * stream from other sources, e.g. recorded events.
+   *
+   * \param event the sensor event.
+   *
+   * \return `true` if the reading was captured; `false` if the event belongs to another
+   * sensor, or if the ring is full.
+   *
+   * \since 6.1.0
+   */
+  auto record(const SDL_SensorEvent& event) noexcept -> bool
+  {
+    if (event.which != m_id)
+    {
+      return false;
+    }
+
+    sensor_sample sample;
+    sample.timestamp = detail::sensor_timestamp(event);
+
+    for (size_type index = 0; index < sample.values.size(); ++index)
+    {
+      sample.values[index] = event.data[index];
+    }
+
+    return m_ring.push(sample);
+  }
+
+  /**
+   * \brief Removes the oldest captured reading.
+   *
+   * \param[out] sample the reading, only written to if there was one.
+   *
+   * \return `true` if a reading was obtained; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto try_pop(sensor_sample& sample) noexcept -> bool
+  {
+    return m_ring.try_pop(sample);
+  }
+
+  /**
+   * \brief Removes all captured readings, oldest first.
+   *
+   * \tparam F the type of the function object.
+   *
+   * \param callable the function object that is invoked with each reading.
+   *
+   * \return the amount of readings.
+   *
+   * \since 6.1.0
+   */
+  template <typename F>
+  auto drain(F&& callable) -> size_type
+  {
+    return m_ring.drain(callable);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of readings that were dropped because the ring was full.
+   *
+   * \return the amount of dropped readings.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_ring.dropped();
+  }
+
+  /**
+   * \brief Returns the instance ID of the captured sensor.
+   *
+   * \return the sensor ID.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto id() const noexcept -> sensor_id
+  {
+    return m_id;
+  }
+
+  /**
+   * \brief Returns the maximum amount of buffered readings.
+   *
+   * \return the capacity of the ring.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto capacity() noexcept -> size_type
+  {
+    return Capacity;
+  }
+
+  /// \} End of queries
+
+ private:
+  sensor_id m_id{};
+  detail::sensor_ring<Capacity> m_ring;
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    if (event->type == SDL_SENSORUPDATE)
+    {
+      static_cast<sensor_stream*>(data)->record(event->sensor);
+    }
+
+    return 0;
+  }
+};
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+/**
+ * \class controller_sensor_stream
+ *
+ * \brief Captures every reading of a game controller sensor, e.g. the gyroscope of a
+ * DualShock or DualSense controller.
+ *
+ * \details This is the controller equivalent of `sensor_stream`, which captures the
+ * `SDL_CONTROLLERSENSORUPDATE` events of one sensor of a controller. Controllers often
+ * report their motion sensors at 1 kHz, far above the frame rate, so motion aiming
+ * should consume every reading instead of polling `basic_controller::get_sensor_data()`.
+ * \code{cpp}
+ *   controller.set_sensor_enabled(cen::sensor_type::gyroscope, true);
+ *
+ *   cen::controller_sensor_stream<> gyro{id, cen::sensor_type::gyroscope};
+ *   cen::gyro_integrator rotation;
+ *
+ *   // Every frame, after polling the events
+ *   gyro.drain([&](const cen::sensor_sample& sample) { rotation.add(sample); });
+ * \endcode
+ *
+ * \details Controller sensor events only contain three values, so the remaining values
+ * of the samples are zero. The same threading rules as for `sensor_stream` apply.
+ *
+ * \note Data reporting must be enabled for the sensor, see
+ * `basic_controller::set_sensor_enabled()`, otherwise SDL doesn't emit any readings.
+ *
+ * \tparam Capacity the maximum amount of buffered readings, must be a power of two.
+ *
+ * \see `device_registry::capture_sensor()`
+ *
+ * \since 6.1.0
+ */
+template <std::size_t Capacity = 256>
+class controller_sensor_stream final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Starts capturing the readings of a controller sensor.
+   *
+   * \param id the instance ID of the controller.
+   * \param type the type of the sensor.
+   *
+   * \since 6.1.0
+   */
+  controller_sensor_stream(const SDL_JoystickID id, const sensor_type type)
+      : m_id{id}
+      , m_type{type}
+  {
+    SDL_AddEventWatch(&on_event, this);
+  }
+
+  controller_sensor_stream(const controller_sensor_stream&) = delete;
+
+  auto operator=(const controller_sensor_stream&) -> controller_sensor_stream& = delete;
+
+  /**
+   * \brief Stops capturing the readings.
+   *
+   * \since 6.1.0
+   */
+  ~controller_sensor_stream() noexcept
+  {
+    SDL_DelEventWatch(&on_event, this);
+  }
+
+  /**
+   * \brief Captures a controller sensor event, if it belongs to the sensor of the stream.
+   *
+   * \param event the controller sensor event.
+   *
+   * \return `true` if the reading was captured; `false` if the event belongs to another
+   * controller or sensor, or if the ring is full.
+   *
+   * \since 6.1.0
+   */
+  auto record(const SDL_ControllerSensorEvent& event) noexcept -> bool
+  {
+    if (event.which != m_id || event.sensor != static_cast<i32>(m_type))
+    {
+      return false;
+    }
+
+    sensor_sample sample;
+    sample.timestamp = detail::sensor_timestamp(event);
+    sample.values[0] = event.data[0];
+    sample.values[1] = event.data[1];
+    sample.values[2] = event.data[2];
+
+    return m_ring.push(sample);
+  }
+
+  /// \copydoc sensor_stream::try_pop()
+  auto try_pop(sensor_sample& sample) noexcept -> bool
+  {
+    return m_ring.try_pop(sample);
+  }
+
+  /// \copydoc sensor_stream::drain()
+  template <typename F>
+  auto drain(F&& callable) -> size_type
+  {
+    return m_ring.drain(callable);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /// \copydoc sensor_stream::dropped()
+  [[nodiscard]] auto dropped() const noexcept -> u64
+  {
+    return m_ring.dropped();
+  }
+
+  /**
+   * \brief Returns the instance ID of the controller.
+   *
+   * \return the controller ID.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto id() const noexcept -> SDL_JoystickID
+  {
+    return m_id;
+  }
+
+  /**
+   * \brief Returns the type of the captured sensor.
+   *
+   * \return the sensor type.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto type() const noexcept -> sensor_type
+  {
+    return m_type;
+  }
+
+  /// \copydoc sensor_stream::capacity()
+  [[nodiscard]] constexpr static auto capacity() noexcept -> size_type
+  {
+    return Capacity;
+  }
+
+  /// \} End of queries
+
+ private:
+  SDL_JoystickID m_id{};
+  sensor_type m_type{};
+  detail::sensor_ring<Capacity> m_ring;
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    if (event->type == SDL_CONTROLLERSENSORUPDATE)
+    {
+      static_cast<controller_sensor_stream*>(data)->record(event->csensor);
+    }
+
+    return 0;
+  }
+};
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+/**
+ * \class gyro_integrator
+ *
+ * \brief Integrates the angular velocities of a gyroscope into a rotation.
+ *
+ * \details The readings are integrated with the trapezoidal rule, using the timestamps
+ * of consecutive readings, so the result doesn't depend on the frame rate.
+ *
+ * \since 6.1.0
+ */
+class gyro_integrator final
+{
+ public:
+  /**
+   * \brief Adds a reading of a gyroscope, in radians per second.
+   *
+   * \details The first reading only serves as the starting point.
+   *
+   * \param sample the gyroscope reading.
+   *
+   * \since 6.1.0
+   */
+  void add(const sensor_sample& sample) noexcept
+  {
+    const auto velocity = sample.xyz();
+
+    if (m_hasPrevious && sample.timestamp > m_previousTime)
+    {
+      const auto elapsed = sample.timestamp - m_previousTime;
+      const auto dt = static_cast<float>(elapsed.count()) * 1e-6f;
+
+      m_angle.x += (m_previous.x + velocity.x) * 0.5f * dt;
+      m_angle.y += (m_previous.y + velocity.y) * 0.5f * dt;
+      m_angle.z += (m_previous.z + velocity.z) * 0.5f * dt;
+    }
+
+    m_previous = velocity;
+    m_previousTime = sample.timestamp;
+    m_hasPrevious = true;
+  }
+
+  /**
+   * \brief Returns the accumulated rotation, and resets it to zero.
+   *
+   * \details This is useful to apply the rotation since the previous frame, e.g. to a
+   * camera. The last reading remains the starting point of the next interval.
+   *
+   * \return the rotation around each axis, in radians.
+   *
+   * \since 6.1.0
+   */
+  auto consume() noexcept -> vector3<float>
+  {
+    const auto angle = m_angle;
+    m_angle = {};
+    return angle;
+  }
+
+  /**
+   * \brief Discards the accumulated rotation and the last reading.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_angle = {};
+    m_hasPrevious = false;
+  }
+
+  /**
+   * \brief Returns the accumulated rotation.
+   *
+   * \return the rotation around each axis, in radians.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto angle() const noexcept -> vector3<float>
+  {
+    return m_angle;
+  }
+
+ private:
+  vector3<float> m_angle;
+  vector3<float> m_previous;
+  microseconds<u64> m_previousTime{};
+  bool m_hasPrevious{};
+};
+
+/**
+ * \class sensor_low_pass
+ *
+ * \brief An exponential low-pass filter for sensor readings, e.g. to obtain the
+ * direction of gravity from an accelerometer.
+ *
+ * \details The weight of each reading depends on the time since the previous reading,
+ * so readings that arrive at irregular intervals are filtered consistently.
+ *
+ * \since 6.1.0
+ */
+class sensor_low_pass final
+{
+ public:
+  /**
+   * \brief Creates a filter.
+   *
+   * \param timeConstant the time it takes for the output to reach ~63% of a step in the
+   * input, larger values smooth the output more, but add latency.
+   *
+   * \since 6.1.0
+   */
+  explicit sensor_low_pass(const milliseconds<float> timeConstant) noexcept
+      : m_timeConstant{timeConstant.count() * 1e-3f}
+  {
+    assert(timeConstant.count() > 0);
+  }
+
+  /**
+   * \brief Adds a reading to the filter.
+   *
+   * \details The first reading initializes the output.
+   *
+   * \param sample the sensor reading.
+   *
+   * \return the filtered value.
+   *
+   * \since 6.1.0
+   */
+  auto add(const sensor_sample& sample) noexcept -> vector3<float>
+  {
+    const auto input = sample.xyz();
+
+    if (!m_hasPrevious)
+    {
+      m_value = input;
+    }
+    else if (sample.timestamp > m_previousTime)
+    {
+      const auto elapsed = sample.timestamp - m_previousTime;
+      const auto dt = static_cast<float>(elapsed.count()) * 1e-6f;
+      const auto alpha = dt / (m_timeConstant + dt);
+
+      m_value.x += (input.x - m_value.x) * alpha;
+      m_value.y += (input.y - m_value.y) * alpha;
+      m_value.z += (input.z - m_value.z) * alpha;
+    }
+
+    m_previousTime = sample.timestamp;
+    m_hasPrevious = true;
+
+    return m_value;
+  }
+
+  /**
+   * \brief Discards the filtered value.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_value = {};
+    m_hasPrevious = false;
+  }
+
+  /**
+   * \brief Returns the filtered value.
+   *
+   * \return the filtered value; zero if no readings have been added.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto value() const noexcept -> vector3<float>
+  {
+    return m_value;
+  }
+
+ private:
+  float m_timeConstant{};  // In seconds
+  vector3<float> m_value;
+  microseconds<u64> m_previousTime{};
+  bool m_hasPrevious{};
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SENSOR
+#endif  // CENTURION_SENSOR_STREAM_HEADER
@@ -0,0 +1,414 @@
+#ifndef CENTURION_VIRTUAL_CONTROLLER_HEADER
+#define CENTURION_VIRTUAL_CONTROLLER_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // is_sorted
+#include <cstddef>    // size_t
+#include <optional>   // optional
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "controller_snapshot.hpp"
+#include "joystick.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+namespace cen {
+
+/// \addtogroup input
+/// \{
+
+/**
+ * \class virtual_controller
+ *
+ * \brief A virtual game controller, whose state is set from controller snapshots.
+ *
+ * \details The virtual device is attached as a joystick of type `game_controller`, with
+ * one axis per controller axis and one button per controller button, where axis and
+ * button N correspond to the controller axis and button with the value N. The device is
+ * detached when the instance is destroyed.
+ *
+ * \details Setting the state of a virtual joystick value by value involves locking the
+ * joysticks for every value. The `apply()` function instead locks the joysticks once,
+ * and only updates the values that differ from the previously applied snapshot. Use
+ * `apply_snapshots()` to update many virtual controllers while locking only once.
+ * \code{cpp}
+ *   cen::virtual_controller bot;
+ *
+ *   cen::controller_snapshot input;
+ *   input.buttons |= 1u << cen::to_underlying(cen::controller_button::a);
+ *   input.axes[SDL_CONTROLLER_AXIS_LEFTX] = 20'000;
+ *
+ *   bot.apply(input);
+ * \endcode
+ *
+ * \note The new state is reported the next time that the joysticks are updated, e.g.
+ * when events are polled.
+ *
+ * \see `controller_replay`
+ *
+ * \since 6.1.0
+ */
+class virtual_controller final
+{
+ public:
+  /**
+   * \brief Attaches and opens a virtual game controller.
+   *
+   * \throws sdl_error if the virtual device couldn't be attached or opened.
+   *
+   * \since 6.1.0
+   */
+  virtual_controller() : m_joystick{attach()}, m_id{m_joystick.instance_id()}
+  {}
+
+  virtual_controller(const virtual_controller&) = delete;
+
+  auto operator=(const virtual_controller&) -> virtual_controller& = delete;
+
+  /**
+   * \brief Detaches the virtual device.
+   *
+   * \since 6.1.0
+   */
+  ~virtual_controller() noexcept
+  {
+    // The device index of the virtual joystick changes as other devices are removed
+    const auto count = SDL_NumJoysticks();
+    for (int index = 0; index < count; ++index)
+    {
+      if (SDL_JoystickGetDeviceInstanceID(index) == m_id)
+      {
+        SDL_JoystickDetachVirtual(index);
+        break;
+      }
+    }
+  }
+
+  /**
+   * \brief Sets the state of the virtual device.
+   *
+   * \details Only the axes and buttons that differ from the previously applied snapshot
+   * are updated, with the joysticks locked once.
+   *
+   * \param snapshot the new state of the device, the `attached` member is ignored.
+   *
+   * \return `success` if all values were updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto apply(const controller_snapshot& snapshot) noexcept -> result
+  {
+    const detail::joystick_lock lock;
+    return apply_unlocked(snapshot);
+  }
+
+  /**
+   * \brief Returns the most recently applied state.
+   *
+   * \return the snapshot that was last applied.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto state() const noexcept -> const controller_snapshot&
+  {
+    return m_state;
+  }
+
+  /**
+   * \brief Returns the instance ID of the virtual device.
+   *
+   * \details This is the identifier used by the events of the device.
+   *
+   * \return the joystick instance ID.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto instance_id() const noexcept -> SDL_JoystickID
+  {
+    return m_id;
+  }
+
+  /**
+   * \brief Returns a handle to the joystick of the virtual device.
+   *
+   * \return a joystick handle.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_joystick() const noexcept -> joystick_handle
+  {
+    return joystick_handle{m_joystick};
+  }
+
+  /// \cond FALSE
+
+  template <typename InputIt, typename SnapshotIt>
+  friend auto apply_snapshots(InputIt first, InputIt last, SnapshotIt snapshots)
+      -> result;
+
+  /// \endcond
+
+ private:
+  joystick m_joystick;
+  SDL_JoystickID m_id{};
+  controller_snapshot m_state;
+  bool m_synced{};
+
+  // The joysticks must be locked by the caller
+  auto apply_unlocked(const controller_snapshot& snapshot) noexcept -> result
+  {
+    auto* ptr = m_joystick.get();
+    bool ok = true;
+
+    for (int axis = 0; axis < controller_snapshot::axis_count; ++axis)
+    {
+      const auto value = snapshot.axes[static_cast<std::size_t>(axis)];
+      if (!m_synced || value != m_state.axes[static_cast<std::size_t>(axis)])
+      {
+        ok &= SDL_JoystickSetVirtualAxis(ptr, axis, value) == 0;
+      }
+    }
+
+    const auto changed = m_synced ? (snapshot.buttons ^ m_state.buttons) : ~u32{0};
+    for (int button = 0; button < controller_snapshot::button_count; ++button)
+    {
+      const auto bit = u32{1} << static_cast<u32>(button);
+      if (changed & bit)
+      {
+        const u8 state = (snapshot.buttons & bit) ? SDL_PRESSED : SDL_RELEASED;
+        ok &= SDL_JoystickSetVirtualButton(ptr, button, state) == 0;
+      }
+    }
+
+    // Everything is set again after a failure, since the state of the device is unknown
+    m_state = snapshot;
+    m_synced = ok;
+
+    return ok;
+  }
+
+  [[nodiscard]] static auto attach() -> joystick
+  {
+    const int index = SDL_JoystickAttachVirtual(SDL_JOYSTICK_TYPE_GAMECONTROLLER,
+                                                controller_snapshot::axis_count,
+                                                controller_snapshot::button_count,
+                                                0);
+    if (index == -1)
+    {
+      throw sdl_error{};
+    }
+
+    if (SDL_Joystick* ptr = SDL_JoystickOpen(index))
+    {
+      return joystick{ptr};
+    }
+    else
+    {
+      sdl_error error;
+      SDL_JoystickDetachVirtual(index);
+      throw error;
+    }
+  }
+};
+
+/**
+ * \brief Sets the state of several virtual controllers, while the joysticks are locked
+ * once.
+ *
+ * \tparam InputIt the type of the virtual controller iterator.
+ * \tparam SnapshotIt the type of the snapshot iterator.
+ *
+ * \param first the first virtual controller.
+ * \param last the end of the range of virtual controllers.
+ * \param snapshots the snapshots, one per virtual controller, in the same order.
+ *
+ * \return `success` if all values were updated; `failure` otherwise.
+ *
+ * \since 6.1.0
+ */
+template <typename InputIt, typename SnapshotIt>
+auto apply_snapshots(InputIt first, const InputIt last, SnapshotIt snapshots) -> result
+{
+  const detail::joystick_lock lock;
+
+  bool ok = true;
+  for (; first != last; ++first, ++snapshots)
+  {
+    ok &= static_cast<bool>(first->apply_unlocked(*snapshots));
+  }
+
+  return ok;
+}
+
+/**
+ * \struct controller_track_frame
+ *
+ * \brief A recorded controller state, along with the time at which it was recorded.
+ *
+ * \see `controller_track`
+ *
+ * \since 6.1.0
+ */
+struct controller_track_frame final
+{
+  milliseconds<u32> time{};      ///< The time since the start of the recording.
+  controller_snapshot snapshot;  ///< The state of the controller.
+};
+
+/// A recording of a controller, as frames ordered by time.
+using controller_track = std::vector<controller_track_frame>;
+
+/**
+ * \class controller_replay
+ *
+ * \brief Replays a recorded controller track on a virtual controller.
+ *
+ * \details Tracks are recorded by capturing snapshots of a controller, e.g. once per
+ * frame, along with the elapsed time.
+ * \code{cpp}
+ *   track.push_back({elapsed, cen::capture_snapshot(controller)});
+ * \endcode
+ *
+ * \details When the replay is updated, the latest frame that has been reached is applied
+ * to the virtual controller. Frames that are skipped over within a single update are
+ * never applied, i.e. very short button presses can be lost if the replay is updated less
+ * frequently than the track was recorded.
+ * \code{cpp}
+ *   cen::virtual_controller bot;
+ *   cen::controller_replay replay{bot, load_track("bot.track")};
+ *
+ *   // Every frame
+ *   replay.update(delta);
+ * \endcode
+ *
+ * \note The virtual controller must outlive the replay.
+ *
+ * \since 6.1.0
+ */
+class controller_replay final
+{
+ public:
+  using size_type = std::size_t;
+  using duration_type = milliseconds<u32>;
+
+  /**
+   * \brief Creates a replay that starts at the beginning of a track.
+   *
+   * \param target the virtual controller that the track is replayed on.
+   * \param track the recorded controller track.
+   *
+   * \throws cen_error if the frames of the track aren't ordered by time.
+   *
+   * \since 6.1.0
+   */
+  controller_replay(virtual_controller& target, controller_track track)
+      : m_target{&target}
+      , m_track{std::move(track)}
+  {
+    const auto earlier = [](const controller_track_frame& a,
+                            const controller_track_frame& b) noexcept {
+      return a.time < b.time;
+    };
+
+    if (!std::is_sorted(m_track.begin(), m_track.end(), earlier))
+    {
+      throw cen_error{"Controller track frames aren't ordered by time!"};
+    }
+  }
+
+  /**
+   * \brief Advances the replay, and applies the latest reached frame.
+   *
+   * \param elapsed the time since the previous update.
+   *
+   * \return `success` if no frame was reached, or if the reached frame was applied;
+   * `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update(const duration_type elapsed) noexcept -> result
+  {
+    m_position += elapsed;
+
+    std::optional<size_type> reached;
+    while (m_next < m_track.size() && m_track[m_next].time <= m_position)
+    {
+      reached = m_next++;
+    }
+
+    if (reached)
+    {
+      return m_target->apply(m_track[*reached].snapshot);
+    }
+    else
+    {
+      return success;
+    }
+  }
+
+  /**
+   * \brief Restarts the replay from the beginning of the track.
+   *
+   * \since 6.1.0
+   */
+  void restart() noexcept
+  {
+    m_position = duration_type::zero();
+    m_next = 0;
+  }
+
+  /**
+   * \brief Indicates whether or not all frames of the track have been applied.
+   *
+   * \return `true` if the replay has reached the end of the track; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_finished() const noexcept -> bool
+  {
+    return m_next == m_track.size();
+  }
+
+  /**
+   * \brief Returns the current position in the track.
+   *
+   * \return the time since the start of the replay.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto position() const noexcept -> duration_type
+  {
+    return m_position;
+  }
+
+  /**
+   * \brief Returns the replayed track.
+   *
+   * \return the controller track.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto track() const noexcept -> const controller_track&
+  {
+    return m_track;
+  }
+
+ private:
+  virtual_controller* m_target{};
+  controller_track m_track;
+  duration_type m_position{};
+  size_type m_next{};  // The index of the first frame that hasn't been reached
+};
+
+/// \} End of group input
+
+}  // namespace cen
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+#endif  // CENTURION_VIRTUAL_CONTROLLER_HEADER
@@ -0,0 +1,26 @@
+#ifndef CENTURION_MATH_SUBSYSTEM_HEADER
+#define CENTURION_MATH_SUBSYSTEM_HEADER
+
+/**
+ * \file math.hpp
+ *
+ * \brief Includes all headers of the math subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "math/area.hpp"
+#include "math/point.hpp"
+#include "math/point_array.hpp"
+#include "math/rect.hpp"
+#include "math/rect_array.hpp"
+#include "math/rect_bvh.hpp"
+#include "math/spatial_hash_grid.hpp"
+#include "math/sweep_and_prune.hpp"
+#include "math/transform2d.hpp"
+#include "math/vector3.hpp"
+
+#endif  // CENTURION_MATH_SUBSYSTEM_HEADER
@@ -1,12 +1,14 @@
 #ifndef CENTURION_AREA_HEADER
 #define CENTURION_AREA_HEADER
 
+#include <cstddef>      // size_t
 #include <ostream>      // ostream
 #include <string>       // string
 #include <type_traits>  // is_integral_v, is_floating_point_v, is_same_v
 
 #include "../core/cast.hpp"
-#include "../detail/to_string.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/format_writer.hpp"
 
 namespace cen {
 
@@ -129,6 +131,19 @@ void serialize(Archive& archive, basic_area<T>& area)
   archive(area.width, area.height);
 }
 
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+struct binary_layout<basic_area<T>> final
+{
+  inline constexpr static std::size_t components = 2;
+  inline constexpr static std::size_t component_size = sizeof(T);
+};
+
+}  // namespace detail
+/// \endcond
+
 /// \name Area cast specializations
 /// \{
 
@@ -209,6 +224,28 @@ template <typename T>
 
 /// \} End of area comparison operators
 
+/**
+ * \brief Writes a textual representation of an area to a buffer.
+ *
+ * \tparam T the type of the area components.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param area the area that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer, const std::size_t size, const basic_area<T>& area) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("area{width: ", area.width, ", height: ", area.height, "}");
+}
+
 /**
  * \brief Returns a textual representation of an area.
  *
@@ -223,8 +260,7 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto to_string(const basic_area<T>& area) -> std::string
 {
-  return "area{width: " + detail::to_string(area.width).value() +
-         ", height: " + detail::to_string(area.height).value() + "}";
+  return detail::format_string(area);
 }
 
 /**
@@ -4,13 +4,15 @@
 #include <SDL.h>
 
 #include <cmath>        // sqrt, abs, round
+#include <cstddef>      // size_t
 #include <ostream>      // ostream
 #include <string>       // string
 #include <type_traits>  // conditional_t, is_integral_v, is_floating_point_v, ...
 
 #include "../core/cast.hpp"
 #include "../core/sfinae.hpp"
-#include "../detail/to_string.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/format_writer.hpp"
 
 namespace cen {
 
@@ -306,6 +308,20 @@ class basic_point final
   point_type m_point{0, 0};
 };
 
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+struct binary_layout<basic_point<T>> final
+{
+  inline constexpr static std::size_t components = 2;
+  inline constexpr static std::size_t component_size =
+      sizeof(typename basic_point<T>::value_type);
+};
+
+}  // namespace detail
+/// \endcond
+
 /// \name Point-related functions
 /// \{
 
@@ -364,16 +380,28 @@ template <typename T>
 
 /// \} End of point-related functions
 
+inline auto format_to(char* buffer, const std::size_t size, const ipoint point) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("ipoint{x: ", point.x(), ", y: ", point.y(), "}");
+}
+
+inline auto format_to(char* buffer, const std::size_t size, const fpoint point) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("fpoint{x: ", point.x(), ", y: ", point.y(), "}");
+}
+
 [[nodiscard]] inline auto to_string(const ipoint point) -> std::string
 {
-  return "ipoint{x: " + detail::to_string(point.x()).value() +
-         ", y: " + detail::to_string(point.y()).value() + "}";
+  return detail::format_string(point);
 }
 
 [[nodiscard]] inline auto to_string(const fpoint point) -> std::string
 {
-  return "fpoint{x: " + detail::to_string(point.x()).value() +
-         ", y: " + detail::to_string(point.y()).value() + "}";
+  return detail::format_string(point);
 }
 
 template <typename T>
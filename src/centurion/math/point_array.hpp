@@ -0,0 +1,322 @@
+#ifndef CENTURION_POINT_ARRAY_HEADER
+#define CENTURION_POINT_ARRAY_HEADER
+
+#include <SDL.h>
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <type_traits>  // is_same_v
+
+#include "../core/integers.hpp"
+#include "../detail/rect_kernels.hpp"
+#include "../system/simd_vector.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+#include "transform2d.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class point_array
+ *
+ * \brief A sequence of points, stored as separate arrays of coordinates.
+ *
+ * \details Points are stored in a structure-of-arrays layout, which makes it possible to
+ * test lots of points at once with vector instructions. The instruction set is chosen at
+ * runtime, based on the features of the CPU. Each array is a `simd_vector`, so the
+ * coordinates are aligned and padded for vector instructions.
+ *
+ * \note Only points with floating-point coordinates use vector instructions.
+ *
+ * \tparam T the representation type, `int` or `float`.
+ *
+ * \see `rect_array`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class point_array final
+{
+ public:
+  using point_type = basic_point<T>;
+  using value_type = typename point_type::value_type;
+  using rect_type = basic_rect<value_type>;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Adds a point to the end of the array.
+   *
+   * \param point the point that will be added.
+   *
+   * \since 6.1.0
+   */
+  void push_back(const point_type& point)
+  {
+    m_xs.push_back(point.x());
+    m_ys.push_back(point.y());
+  }
+
+  /**
+   * \brief Replaces a point.
+   *
+   * \param index the index of the point.
+   * \param point the new point.
+   *
+   * \since 6.1.0
+   */
+  void set(const size_type index, const point_type& point) noexcept
+  {
+    assert(index < size());
+    m_xs[index] = point.x();
+    m_ys[index] = point.y();
+  }
+
+  /**
+   * \brief Removes a point, by replacing it with the last point.
+   *
+   * \note This changes the index of the last point.
+   *
+   * \param index the index of the point.
+   *
+   * \since 6.1.0
+   */
+  void swap_remove(const size_type index) noexcept
+  {
+    assert(index < size());
+
+    set(index, (*this)[size() - 1]);
+
+    m_xs.pop_back();
+    m_ys.pop_back();
+  }
+
+  /**
+   * \brief Reserves memory for a number of points.
+   *
+   * \param capacity the amount of points.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_xs.reserve(capacity);
+    m_ys.reserve(capacity);
+  }
+
+  /**
+   * \brief Removes all points.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_xs.clear();
+    m_ys.clear();
+  }
+
+  /**
+   * \brief Offsets all points.
+   *
+   * \param dx the offset along the x-axis.
+   * \param dy the offset along the y-axis.
+   *
+   * \since 6.1.0
+   */
+  void translate(const value_type dx, const value_type dy) noexcept
+  {
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      detail::translate_coordinates(detail::get_simd_level(),
+                                    m_xs.data(),
+                                    m_ys.data(),
+                                    size(),
+                                    dx,
+                                    dy);
+    }
+    else
+    {
+      detail::translate_scalar(m_xs.data(), m_ys.data(), size(), dx, dy);
+    }
+  }
+
+  /**
+   * \brief Applies an affine transform to all points.
+   *
+   * \note This function is only available for points with floating-point coordinates.
+   *
+   * \param transform the transform that will be applied.
+   *
+   * \see `transform2d::apply()`
+   *
+   * \since 6.1.0
+   */
+  void transform(const transform2d& transform) noexcept
+  {
+    static_assert(std::is_same_v<value_type, float>,
+                  "Only floating-point points can be transformed!");
+
+    detail::transform_coordinates(detail::get_simd_level(),
+                                  m_xs.data(),
+                                  m_ys.data(),
+                                  size(),
+                                  transform.coefficients());
+  }
+
+  /**
+   * \brief Tests which points are contained in a rectangle.
+   *
+   * \param rect the rectangle that the points are tested against.
+   * \param[out] results the buffer that receives one byte per point, which is 1 if the
+   * rectangle contains the point and 0 otherwise. Must hold at least `size()` bytes.
+   *
+   * \return the amount of contained points.
+   *
+   * \see `basic_rect::contains()`
+   *
+   * \since 6.1.0
+   */
+  auto contained_in(const rect_type& rect, u8* results) const noexcept -> size_type
+  {
+    assert(results || empty());
+
+    const detail::rect_extent<value_type> area{rect.x(),
+                                               rect.y(),
+                                               rect.max_x(),
+                                               rect.max_y()};
+
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      return detail::points_within(detail::get_simd_level(),
+                                   m_xs.data(),
+                                   m_ys.data(),
+                                   size(),
+                                   area,
+                                   results);
+    }
+    else
+    {
+      return detail::points_within_scalar(m_xs.data(),
+                                          m_ys.data(),
+                                          size(),
+                                          area,
+                                          results);
+    }
+  }
+
+  /**
+   * \brief Returns the bounding rectangle of the points.
+   *
+   * \details The points with the largest coordinates are on the borders of the
+   * rectangle, which `basic_rect::contains()` considers to be inside of the rectangle.
+   *
+   * \return the smallest rectangle that contains all points; an empty rectangle if there
+   * are no points.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> rect_type
+  {
+    if (empty())
+    {
+      return {};
+    }
+
+    auto extent = detail::empty_extent<value_type>();
+
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      detail::point_bounds(detail::get_simd_level(),
+                           m_xs.data(),
+                           m_ys.data(),
+                           size(),
+                           extent);
+    }
+    else
+    {
+      detail::point_bounds_scalar(m_xs.data(), m_ys.data(), size(), extent);
+    }
+
+    return {extent.x, extent.y, extent.maxX - extent.x, extent.maxY - extent.y};
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a point.
+   *
+   * \param index the index of the point.
+   *
+   * \return the point at the index.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> point_type
+  {
+    assert(index < size());
+    return {m_xs[index], m_ys[index]};
+  }
+
+  /**
+   * \brief Returns the amount of points.
+   *
+   * \return the amount of points.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_xs.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are no points.
+   *
+   * \return `true` if there are no points; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_xs.empty();
+  }
+
+  /**
+   * \brief Returns the x-coordinates of the points.
+   *
+   * \return a pointer to `size()` x-coordinates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto xs() const noexcept -> const value_type*
+  {
+    return m_xs.data();
+  }
+
+  /**
+   * \brief Returns the y-coordinates of the points.
+   *
+   * \return a pointer to `size()` y-coordinates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto ys() const noexcept -> const value_type*
+  {
+    return m_ys.data();
+  }
+
+  /// \} End of queries
+
+ private:
+  simd_vector<value_type> m_xs;
+  simd_vector<value_type> m_ys;
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_POINT_ARRAY_HEADER
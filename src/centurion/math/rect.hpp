@@ -3,15 +3,17 @@
 
 #include <SDL.h>
 
+#include <cstddef>      // size_t
 #include <ostream>      // ostream
 #include <string>       // string
 #include <type_traits>  // conditional_t, is_integral_v, is_floating_point_v, ...
 
 #include "../core/cast.hpp"
 #include "../core/sfinae.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/max.hpp"
 #include "../detail/min.hpp"
-#include "../detail/to_string.hpp"
 #include "area.hpp"
 #include "point.hpp"
 
@@ -639,6 +641,20 @@ class basic_rect final
   rect_type m_rect{0, 0, 0, 0};
 };
 
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+struct binary_layout<basic_rect<T>> final
+{
+  inline constexpr static std::size_t components = 4;
+  inline constexpr static std::size_t component_size =
+      sizeof(typename basic_rect<T>::value_type);
+};
+
+}  // namespace detail
+/// \endcond
+
 /// \name Rectangle functions
 /// \{
 
@@ -834,6 +850,36 @@ template <>
 
 /// \} End of rectangle cast specializations
 
+/**
+ * \brief Writes a textual representation of a rectangle to a buffer.
+ *
+ * \tparam T the representation type used by the rectangle.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param rect the rectangle that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer, const std::size_t size, const basic_rect<T>& rect) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("rect{x: ",
+                      rect.x(),
+                      ", y: ",
+                      rect.y(),
+                      ", width: ",
+                      rect.width(),
+                      ", height: ",
+                      rect.height(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a rectangle.
  *
@@ -848,10 +894,7 @@ template <>
 template <typename T>
 [[nodiscard]] auto to_string(const basic_rect<T>& rect) -> std::string
 {
-  return "rect{x: " + detail::to_string(rect.x()).value() +
-         ", y: " + detail::to_string(rect.y()).value() +
-         ", width: " + detail::to_string(rect.width()).value() +
-         ", height: " + detail::to_string(rect.height()).value() + "}";
+  return detail::format_string(rect);
 }
 
 /**
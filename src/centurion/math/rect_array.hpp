@@ -0,0 +1,371 @@
+#ifndef CENTURION_RECT_ARRAY_HEADER
+#define CENTURION_RECT_ARRAY_HEADER
+
+#include <SDL.h>
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <type_traits>  // is_same_v
+
+#include "../core/integers.hpp"
+#include "../detail/rect_kernels.hpp"
+#include "../system/simd_vector.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class rect_array
+ *
+ * \brief A sequence of rectangles, stored as separate arrays of coordinates and sizes.
+ *
+ * \details Rectangles are stored in a structure-of-arrays layout, which makes it possible
+ * to test lots of rectangles at once with vector instructions, e.g. to cull the objects
+ * that aren't visible. The instruction set is chosen at runtime, based on the features of
+ * the CPU. The batch operations have the same semantics as `intersects()`,
+ * `basic_rect::contains()` and `get_union()`. Each array is a `simd_vector`, so the
+ * coordinates are aligned and padded for vector instructions.
+ * \code{cpp}
+ *   cen::rect_array<float> bounds;
+ *   std::vector<cen::u8> visible;
+ *
+ *   visible.resize(bounds.size());
+ *   bounds.intersects(camera, visible.data());
+ * \endcode
+ *
+ * \note Only rectangles with floating-point coordinates use vector instructions.
+ *
+ * \tparam T the representation type, `int` or `float`.
+ *
+ * \see `point_array`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class rect_array final
+{
+ public:
+  using rect_type = basic_rect<T>;
+  using value_type = typename rect_type::value_type;
+  using point_type = typename rect_type::point_type;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Adds a rectangle to the end of the array.
+   *
+   * \param rect the rectangle that will be added.
+   *
+   * \since 6.1.0
+   */
+  void push_back(const rect_type& rect)
+  {
+    m_xs.push_back(rect.x());
+    m_ys.push_back(rect.y());
+    m_widths.push_back(rect.width());
+    m_heights.push_back(rect.height());
+  }
+
+  /**
+   * \brief Replaces a rectangle.
+   *
+   * \param index the index of the rectangle.
+   * \param rect the new rectangle.
+   *
+   * \since 6.1.0
+   */
+  void set(const size_type index, const rect_type& rect) noexcept
+  {
+    assert(index < size());
+    m_xs[index] = rect.x();
+    m_ys[index] = rect.y();
+    m_widths[index] = rect.width();
+    m_heights[index] = rect.height();
+  }
+
+  /**
+   * \brief Removes a rectangle, by replacing it with the last rectangle.
+   *
+   * \note This changes the index of the last rectangle.
+   *
+   * \param index the index of the rectangle.
+   *
+   * \since 6.1.0
+   */
+  void swap_remove(const size_type index) noexcept
+  {
+    assert(index < size());
+
+    set(index, (*this)[size() - 1]);
+
+    m_xs.pop_back();
+    m_ys.pop_back();
+    m_widths.pop_back();
+    m_heights.pop_back();
+  }
+
+  /**
+   * \brief Reserves memory for a number of rectangles.
+   *
+   * \param capacity the amount of rectangles.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_xs.reserve(capacity);
+    m_ys.reserve(capacity);
+    m_widths.reserve(capacity);
+    m_heights.reserve(capacity);
+  }
+
+  /**
+   * \brief Removes all rectangles.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_xs.clear();
+    m_ys.clear();
+    m_widths.clear();
+    m_heights.clear();
+  }
+
+  /**
+   * \brief Offsets all rectangles.
+   *
+   * \param dx the offset along the x-axis.
+   * \param dy the offset along the y-axis.
+   *
+   * \since 6.1.0
+   */
+  void translate(const value_type dx, const value_type dy) noexcept
+  {
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      detail::translate_coordinates(detail::get_simd_level(),
+                                    m_xs.data(),
+                                    m_ys.data(),
+                                    size(),
+                                    dx,
+                                    dy);
+    }
+    else
+    {
+      detail::translate_scalar(m_xs.data(), m_ys.data(), size(), dx, dy);
+    }
+  }
+
+  /**
+   * \brief Tests which rectangles intersect another rectangle.
+   *
+   * \param rect the rectangle that the rectangles are tested against.
+   * \param[out] results the buffer that receives one byte per rectangle, which is 1 if
+   * the rectangle intersects `rect` and 0 otherwise. Must hold at least `size()` bytes.
+   *
+   * \return the amount of intersecting rectangles.
+   *
+   * \see `intersects()`
+   *
+   * \since 6.1.0
+   */
+  auto intersects(const rect_type& rect, u8* results) const noexcept -> size_type
+  {
+    assert(results || empty());
+
+    const detail::rect_extent<value_type> area{rect.x(),
+                                               rect.y(),
+                                               rect.max_x(),
+                                               rect.max_y()};
+
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      return detail::rects_intersect_kernel(columns(), size(), area, results);
+    }
+    else
+    {
+      return detail::rects_intersect_scalar(columns(), size(), area, results);
+    }
+  }
+
+  /**
+   * \brief Tests which rectangles contain a point.
+   *
+   * \param point the point that the rectangles are tested against.
+   * \param[out] results the buffer that receives one byte per rectangle, which is 1 if
+   * the rectangle contains the point and 0 otherwise. Must hold at least `size()` bytes.
+   *
+   * \return the amount of rectangles that contain the point.
+   *
+   * \see `basic_rect::contains()`
+   *
+   * \since 6.1.0
+   */
+  auto contains(const point_type& point, u8* results) const noexcept -> size_type
+  {
+    assert(results || empty());
+
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      return detail::rects_contain(detail::get_simd_level(),
+                                   columns(),
+                                   size(),
+                                   point.x(),
+                                   point.y(),
+                                   results);
+    }
+    else
+    {
+      return detail::rects_contain_scalar(columns(),
+                                          size(),
+                                          point.x(),
+                                          point.y(),
+                                          results);
+    }
+  }
+
+  /**
+   * \brief Returns the union of all rectangles.
+   *
+   * \details Rectangles without an area are ignored, like in `get_union()`.
+   *
+   * \return the smallest rectangle that contains all rectangles with an area; an empty
+   * rectangle if there are no such rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> rect_type
+  {
+    auto extent = detail::empty_extent<value_type>();
+
+    if constexpr (std::is_same_v<value_type, float>)
+    {
+      detail::rect_bounds(detail::get_simd_level(), columns(), size(), extent);
+    }
+    else
+    {
+      detail::rect_bounds_scalar(columns(), size(), extent);
+    }
+
+    if (extent.x < extent.maxX && extent.y < extent.maxY)
+    {
+      return {extent.x, extent.y, extent.maxX - extent.x, extent.maxY - extent.y};
+    }
+    else
+    {
+      return {};
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a rectangle.
+   *
+   * \param index the index of the rectangle.
+   *
+   * \return the rectangle at the index.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> rect_type
+  {
+    assert(index < size());
+    return {m_xs[index], m_ys[index], m_widths[index], m_heights[index]};
+  }
+
+  /**
+   * \brief Returns the amount of rectangles.
+   *
+   * \return the amount of rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_xs.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are no rectangles.
+   *
+   * \return `true` if there are no rectangles; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_xs.empty();
+  }
+
+  /**
+   * \brief Returns the x-coordinates of the rectangles.
+   *
+   * \return a pointer to `size()` x-coordinates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto xs() const noexcept -> const value_type*
+  {
+    return m_xs.data();
+  }
+
+  /**
+   * \brief Returns the y-coordinates of the rectangles.
+   *
+   * \return a pointer to `size()` y-coordinates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto ys() const noexcept -> const value_type*
+  {
+    return m_ys.data();
+  }
+
+  /**
+   * \brief Returns the widths of the rectangles.
+   *
+   * \return a pointer to `size()` widths.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto widths() const noexcept -> const value_type*
+  {
+    return m_widths.data();
+  }
+
+  /**
+   * \brief Returns the heights of the rectangles.
+   *
+   * \return a pointer to `size()` heights.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto heights() const noexcept -> const value_type*
+  {
+    return m_heights.data();
+  }
+
+  /// \} End of queries
+
+ private:
+  simd_vector<value_type> m_xs;
+  simd_vector<value_type> m_ys;
+  simd_vector<value_type> m_widths;
+  simd_vector<value_type> m_heights;
+
+  [[nodiscard]] auto columns() const noexcept -> detail::rect_columns<value_type>
+  {
+    return {m_xs.data(), m_ys.data(), m_widths.data(), m_heights.data()};
+  }
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_RECT_ARRAY_HEADER
@@ -0,0 +1,468 @@
+#ifndef CENTURION_RECT_BVH_HEADER
+#define CENTURION_RECT_BVH_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // nth_element
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <limits>     // numeric_limits
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "point.hpp"
+#include "rect.hpp"
+#include "rect_array.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class rect_bvh
+ *
+ * \brief A bounding volume hierarchy over static rectangles, for fast range and point
+ * queries.
+ *
+ * \details The hierarchy is built at once, by recursively splitting the rectangles at
+ * the median of their centers along the longer axis, so the tree is balanced no matter
+ * how the rectangles are distributed. All nodes are stored in a single array in
+ * depth-first order, where the left child of a node directly follows it, and the
+ * rectangles of each leaf are stored next to each other, which keeps queries cache
+ * friendly. Rebuilding is required if the rectangles change, see `spatial_hash_grid`
+ * for rectangles that move.
+ * \code{cpp}
+ *   cen::rect_bvh tiles;
+ *   tiles.build(rects.data(), rects.size());
+ *
+ *   // Every frame
+ *   tiles.visit(camera, [&](const cen::u32 index) { draw_tile(index); });
+ * \endcode
+ *
+ * \see `spatial_hash_grid`
+ *
+ * \since 6.1.0
+ */
+class rect_bvh final
+{
+ public:
+  using size_type = std::size_t;
+  using index_type = u32;  ///< The index of a rectangle in the input of `build()`.
+
+  /**
+   * \brief Creates an empty hierarchy.
+   *
+   * \param leafSize the maximum amount of rectangles in each leaf, must be at least 1.
+   *
+   * \since 6.1.0
+   */
+  explicit rect_bvh(const size_type leafSize = 4) noexcept : m_leafSize{leafSize}
+  {
+    assert(leafSize != 0);
+  }
+
+  /**
+   * \brief Builds the hierarchy from a sequence of rectangles, replacing the previous
+   * rectangles.
+   *
+   * \param rects the rectangles, can be null if the count is zero.
+   * \param count the amount of rectangles.
+   *
+   * \since 6.1.0
+   */
+  void build(const frect* rects, const size_type count)
+  {
+    assert(rects || count == 0);
+    assert(count <= (std::numeric_limits<index_type>::max)());
+
+    m_items.resize(count);
+    for (size_type index = 0; index < count; ++index)
+    {
+      const auto& rect = rects[index];
+      m_items[index] = {rect.x(),
+                        rect.y(),
+                        rect.max_x(),
+                        rect.max_y(),
+                        static_cast<index_type>(index)};
+    }
+
+    build_nodes();
+  }
+
+  /**
+   * \brief Builds the hierarchy from an array of rectangles, replacing the previous
+   * rectangles.
+   *
+   * \param rects the rectangles.
+   *
+   * \since 6.1.0
+   */
+  void build(const rect_array<float>& rects)
+  {
+    const auto count = rects.size();
+    assert(count <= (std::numeric_limits<index_type>::max)());
+
+    m_items.resize(count);
+    for (size_type index = 0; index < count; ++index)
+    {
+      const auto x = rects.xs()[index];
+      const auto y = rects.ys()[index];
+      m_items[index] = {x,
+                        y,
+                        x + rects.widths()[index],
+                        y + rects.heights()[index],
+                        static_cast<index_type>(index)};
+    }
+
+    build_nodes();
+  }
+
+  /**
+   * \brief Removes all rectangles.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_nodes.clear();
+    m_items.clear();
+  }
+
+  /**
+   * \brief Invokes a function object for each rectangle that intersects an area.
+   *
+   * \details Rectangles that only touch the area are ignored, see `intersects()`.
+   *
+   * \tparam F the type of the function object.
+   *
+   * \param area the area that will be searched.
+   * \param callable the function object that is invoked with the index of each
+   * intersecting rectangle, in no particular order.
+   *
+   * \since 6.1.0
+   */
+  template <typename F>
+  void visit(const frect& area, F&& callable) const
+  {
+    const auto minX = area.x();
+    const auto minY = area.y();
+    const auto maxX = area.max_x();
+    const auto maxY = area.max_y();
+
+    traverse(
+        [=](const node& n) noexcept {
+          return !(n.minX >= maxX || n.maxX <= minX || n.minY >= maxY || n.maxY <= minY);
+        },
+        [&](const item& i) {
+          if (!(i.minX >= maxX || i.maxX <= minX || i.minY >= maxY || i.maxY <= minY))
+          {
+            callable(i.index);
+          }
+        });
+  }
+
+  /**
+   * \brief Invokes a function object for each rectangle that contains a point.
+   *
+   * \details Points on the borders of a rectangle are contained by it, see
+   * `basic_rect::contains()`.
+   *
+   * \tparam F the type of the function object.
+   *
+   * \param point the point that will be searched for.
+   * \param callable the function object that is invoked with the index of each
+   * rectangle that contains the point, in no particular order.
+   *
+   * \since 6.1.0
+   */
+  template <typename F>
+  void visit(const fpoint& point, F&& callable) const
+  {
+    const auto px = point.x();
+    const auto py = point.y();
+
+    traverse(
+        [=](const node& n) noexcept {
+          return !(px < n.minX || py < n.minY || px > n.maxX || py > n.maxY);
+        },
+        [&](const item& i) {
+          if (!(px < i.minX || py < i.minY || px > i.maxX || py > i.maxY))
+          {
+            callable(i.index);
+          }
+        });
+  }
+
+  /**
+   * \brief Finds the rectangles that intersect an area.
+   *
+   * \param area the area that will be searched.
+   * \param[out] out the buffer that receives the indices of the rectangles.
+   * \param capacity the maximum amount of indices that are written to the buffer.
+   *
+   * \return the amount of intersecting rectangles, which might be greater than the
+   * capacity, in which case only the first `capacity` indices were written.
+   *
+   * \since 6.1.0
+   */
+  auto query(const frect& area, index_type* out, const size_type capacity) const noexcept
+      -> size_type
+  {
+    assert(out || capacity == 0);
+
+    size_type count = 0;
+    visit(area, [&](const index_type index) noexcept {
+      if (count < capacity)
+      {
+        out[count] = index;
+      }
+
+      ++count;
+    });
+
+    return count;
+  }
+
+  /**
+   * \brief Finds the rectangles that contain a point.
+   *
+   * \param point the point that will be searched for.
+   * \param[out] out the buffer that receives the indices of the rectangles.
+   * \param capacity the maximum amount of indices that are written to the buffer.
+   *
+   * \return the amount of rectangles that contain the point, which might be greater than
+   * the capacity, in which case only the first `capacity` indices were written.
+   *
+   * \since 6.1.0
+   */
+  auto query(const fpoint& point,
+             index_type* out,
+             const size_type capacity) const noexcept -> size_type
+  {
+    assert(out || capacity == 0);
+
+    size_type count = 0;
+    visit(point, [&](const index_type index) noexcept {
+      if (count < capacity)
+      {
+        out[count] = index;
+      }
+
+      ++count;
+    });
+
+    return count;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the bounds of all rectangles.
+   *
+   * \return the bounding rectangle; an empty rectangle if there are no rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> frect
+  {
+    if (m_nodes.empty())
+    {
+      return {};
+    }
+
+    const auto& root = m_nodes.front();
+    return {root.minX, root.minY, root.maxX - root.minX, root.maxY - root.minY};
+  }
+
+  /**
+   * \brief Returns the amount of rectangles.
+   *
+   * \return the amount of rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_items.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are no rectangles.
+   *
+   * \return `true` if there are no rectangles; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_items.empty();
+  }
+
+  /**
+   * \brief Returns the amount of nodes in the hierarchy.
+   *
+   * \return the amount of nodes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto node_count() const noexcept -> size_type
+  {
+    return m_nodes.size();
+  }
+
+  /**
+   * \brief Returns the maximum amount of rectangles in each leaf.
+   *
+   * \return the leaf size.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto leaf_size() const noexcept -> size_type
+  {
+    return m_leafSize;
+  }
+
+  /// \} End of queries
+
+ private:
+  // The maximum depth of a tree with median splits is log2(2^32), plus the leaves
+  inline constexpr static size_type max_depth = 64;
+
+  struct node final
+  {
+    float minX{};
+    float minY{};
+    float maxX{};
+    float maxY{};
+    u32 offset{};  // The first item of leaves, the right child of inner nodes
+    u32 count{};   // The amount of items of leaves, zero for inner nodes
+  };
+
+  struct item final
+  {
+    float minX{};
+    float minY{};
+    float maxX{};
+    float maxY{};
+    index_type index{};
+  };
+
+  std::vector<node> m_nodes;
+  std::vector<item> m_items;
+  size_type m_leafSize{};
+
+  void build_nodes()
+  {
+    m_nodes.clear();
+
+    if (!m_items.empty())
+    {
+      // A balanced tree has less than twice as many nodes as leaves
+      m_nodes.reserve(2 * (m_items.size() / m_leafSize + 1));
+      build_node(0, m_items.size());
+    }
+  }
+
+  void build_node(const size_type first, const size_type last)
+  {
+    const auto index = m_nodes.size();
+    m_nodes.emplace_back();
+
+    auto bounds = bounds_of(first, last);
+
+    const auto count = last - first;
+    if (count <= m_leafSize)
+    {
+      bounds.offset = static_cast<u32>(first);
+      bounds.count = static_cast<u32>(count);
+      m_nodes[index] = bounds;
+      return;
+    }
+
+    // The items are split at the median of their centers along the longer axis
+    const auto horizontal = (bounds.maxX - bounds.minX) >= (bounds.maxY - bounds.minY);
+    const auto middle = first + count / 2;
+
+    std::nth_element(m_items.begin() + static_cast<std::ptrdiff_t>(first),
+                     m_items.begin() + static_cast<std::ptrdiff_t>(middle),
+                     m_items.begin() + static_cast<std::ptrdiff_t>(last),
+                     [horizontal](const item& a, const item& b) noexcept {
+                       return horizontal ? (a.minX + a.maxX) < (b.minX + b.maxX)
+                                         : (a.minY + a.maxY) < (b.minY + b.maxY);
+                     });
+
+    build_node(first, middle);
+
+    bounds.offset = static_cast<u32>(m_nodes.size());
+    build_node(middle, last);
+
+    m_nodes[index] = bounds;
+  }
+
+  [[nodiscard]] auto bounds_of(const size_type first, const size_type last) const noexcept
+      -> node
+  {
+    node result;
+    result.minX = (std::numeric_limits<float>::max)();
+    result.minY = (std::numeric_limits<float>::max)();
+    result.maxX = std::numeric_limits<float>::lowest();
+    result.maxY = std::numeric_limits<float>::lowest();
+
+    for (auto index = first; index < last; ++index)
+    {
+      const auto& i = m_items[index];
+      result.minX = (i.minX < result.minX) ? i.minX : result.minX;
+      result.minY = (i.minY < result.minY) ? i.minY : result.minY;
+      result.maxX = (i.maxX > result.maxX) ? i.maxX : result.maxX;
+      result.maxY = (i.maxY > result.maxY) ? i.maxY : result.maxY;
+    }
+
+    return result;
+  }
+
+  template <typename NodePredicate, typename ItemVisitor>
+  void traverse(NodePredicate&& overlaps, ItemVisitor&& visitor) const
+  {
+    if (m_nodes.empty())
+    {
+      return;
+    }
+
+    u32 stack[max_depth];
+    size_type size = 0;
+    stack[size++] = 0;
+
+    while (size != 0)
+    {
+      const auto& n = m_nodes[stack[--size]];
+      if (!overlaps(n))
+      {
+        continue;
+      }
+
+      if (n.count != 0)
+      {
+        for (auto index = n.offset; index < n.offset + n.count; ++index)
+        {
+          visitor(m_items[index]);
+        }
+      }
+      else
+      {
+        const auto left = static_cast<u32>(&n - m_nodes.data()) + 1u;
+
+        assert(size + 2 <= max_depth);
+        stack[size++] = n.offset;
+        stack[size++] = left;
+      }
+    }
+  }
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_RECT_BVH_HEADER
@@ -0,0 +1,475 @@
+#ifndef CENTURION_SPATIAL_HASH_GRID_HEADER
+#define CENTURION_SPATIAL_HASH_GRID_HEADER
+
+#include <SDL.h>
+
+#include <cassert>        // assert
+#include <cmath>          // floor, ceil
+#include <cstddef>        // size_t
+#include <limits>         // numeric_limits
+#include <type_traits>    // is_integral_v
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class spatial_hash_grid
+ *
+ * \brief A spatial index of rectangles, which finds the rectangles in an area by only
+ * looking at the cells of a uniform grid that overlap the area.
+ *
+ * \details Each rectangle is stored in every cell that it overlaps, and only the cells
+ * that contain rectangles are stored, in a hash table, so the grid is unbounded. Moving a
+ * rectangle only updates the cells if it moves to other cells. Queries write into a
+ * buffer supplied by the caller, and don't allocate memory.
+ *
+ * The cell size should be roughly the size of typical rectangles, or of typical query
+ * areas: smaller cells store larger rectangles in more cells, and larger cells make
+ * queries test more rectangles.
+ * \code{cpp}
+ *   cen::spatial_hash_grid<float> grid{64};
+ *   const auto id = grid.insert(sprite.bounds());
+ *
+ *   // When the sprite moves
+ *   grid.move(id, sprite.bounds());
+ *
+ *   // Before rendering
+ *   std::array<cen::spatial_hash_grid<float>::handle, 1'024> visible;
+ *   const auto count = grid.query_visible(renderer, visible.data(), visible.size());
+ * \endcode
+ *
+ * \note Queries mark the visited rectangles, so a grid mustn't be queried by several
+ * threads at the same time.
+ *
+ * \tparam T the representation type of the rectangles, `int` or `float`.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class spatial_hash_grid final
+{
+ public:
+  using rect_type = basic_rect<T>;
+  using value_type = typename rect_type::value_type;
+  using size_type = std::size_t;
+  using handle = u32;
+
+  /**
+   * \brief Creates an empty grid.
+   *
+   * \param cellSize the width and height of the cells, must be greater than zero.
+   *
+   * \since 6.1.0
+   */
+  explicit spatial_hash_grid(const value_type cellSize) noexcept
+      : m_cellSize{static_cast<float>(cellSize)}
+  {
+    assert(cellSize > 0);
+  }
+
+  /**
+   * \brief Adds a rectangle to the grid.
+   *
+   * \param rect the rectangle that will be added.
+   *
+   * \return the handle of the rectangle, which is valid until the rectangle is removed.
+   *
+   * \since 6.1.0
+   */
+  auto insert(const rect_type& rect) -> handle
+  {
+    handle id{};
+
+    if (!m_free.empty())
+    {
+      id = m_free.back();
+      m_free.pop_back();
+    }
+    else
+    {
+      id = static_cast<handle>(m_entries.size());
+      m_entries.emplace_back();
+    }
+
+    auto& entry = m_entries[id];
+    entry.rect = rect;
+    entry.cells = cells_of(rect);
+    entry.stamp = 0;
+    entry.alive = true;
+
+    add_to_cells(id, entry.cells);
+    ++m_size;
+
+    return id;
+  }
+
+  /**
+   * \brief Changes the rectangle of a handle.
+   *
+   * \details The cells are only updated if the rectangle overlaps other cells than
+   * before, which is cheap for rectangles that move a little each frame.
+   *
+   * \param id the handle of the rectangle, must be valid.
+   * \param rect the new rectangle.
+   *
+   * \since 6.1.0
+   */
+  void move(const handle id, const rect_type& rect)
+  {
+    assert(contains(id));
+
+    auto& entry = m_entries[id];
+    entry.rect = rect;
+
+    const auto cells = cells_of(rect);
+    if (cells != entry.cells)
+    {
+      remove_from_cells(id, entry.cells);
+      add_to_cells(id, cells);
+      entry.cells = cells;
+    }
+  }
+
+  /**
+   * \brief Removes a rectangle from the grid.
+   *
+   * \details The handle may be reused by later insertions.
+   *
+   * \param id the handle of the rectangle, must be valid.
+   *
+   * \since 6.1.0
+   */
+  void remove(const handle id)
+  {
+    assert(contains(id));
+
+    auto& entry = m_entries[id];
+    remove_from_cells(id, entry.cells);
+    entry.alive = false;
+
+    m_free.push_back(id);
+    --m_size;
+  }
+
+  /**
+   * \brief Removes all rectangles.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_cells.clear();
+    m_entries.clear();
+    m_free.clear();
+    m_size = 0;
+    m_stamp = 0;
+  }
+
+  /**
+   * \brief Finds the rectangles that intersect an area.
+   *
+   * \details Each intersecting rectangle is reported once, even if it shares several
+   * cells with the area. Rectangles that only touch the area are ignored, see
+   * `intersects()`.
+   *
+   * \param area the area that will be searched.
+   * \param[out] out the buffer that receives the handles, in no particular order.
+   * \param capacity the maximum amount of handles that are written to the buffer.
+   *
+   * \return the amount of intersecting rectangles, which might be greater than the
+   * capacity, in which case only the first `capacity` handles were written.
+   *
+   * \since 6.1.0
+   */
+  auto query(const rect_type& area, handle* out, const size_type capacity) const noexcept
+      -> size_type
+  {
+    assert(out || capacity == 0);
+
+    next_stamp();
+
+    const auto range = cells_of(area);
+    size_type count = 0;
+
+    for (auto cy = range.minY; cy <= range.maxY; ++cy)
+    {
+      for (auto cx = range.minX; cx <= range.maxX; ++cx)
+      {
+        const auto it = m_cells.find(cell_key(cx, cy));
+        if (it == m_cells.end())
+        {
+          continue;
+        }
+
+        for (const auto id : it->second)
+        {
+          auto& entry = m_entries[id];
+          if (entry.stamp == m_stamp)
+          {
+            continue;
+          }
+
+          entry.stamp = m_stamp;
+
+          if (intersects(entry.rect, area))
+          {
+            if (count < capacity)
+            {
+              out[count] = id;
+            }
+
+            ++count;
+          }
+        }
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Finds the rectangles that are visible through the translation viewport of a
+   * renderer.
+   *
+   * \details The translation viewport is treated as the visible area in world
+   * coordinates. For integer rectangles, the area is extended to whole units, so
+   * partially visible rectangles are included.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer`.
+   *
+   * \param renderer the renderer that provides the translation viewport.
+   * \param[out] out the buffer that receives the handles.
+   * \param capacity the maximum amount of handles that are written to the buffer.
+   *
+   * \return the amount of visible rectangles.
+   *
+   * \see `basic_renderer::translation_viewport()`
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto query_visible(const Renderer& renderer,
+                     handle* out,
+                     const size_type capacity) const noexcept -> size_type
+  {
+    const frect& viewport = renderer.translation_viewport();
+
+    if constexpr (std::is_integral_v<value_type>)
+    {
+      const auto x = std::floor(viewport.x());
+      const auto y = std::floor(viewport.y());
+      const auto maxX = std::ceil(viewport.max_x());
+      const auto maxY = std::ceil(viewport.max_y());
+
+      const rect_type area{static_cast<value_type>(x),
+                           static_cast<value_type>(y),
+                           static_cast<value_type>(maxX - x),
+                           static_cast<value_type>(maxY - y)};
+      return query(area, out, capacity);
+    }
+    else
+    {
+      return query(viewport, out, capacity);
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not a handle refers to a rectangle in the grid.
+   *
+   * \param id the handle that will be checked.
+   *
+   * \return `true` if the handle is valid; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const handle id) const noexcept -> bool
+  {
+    return id < m_entries.size() && m_entries[id].alive;
+  }
+
+  /**
+   * \brief Returns the rectangle of a handle.
+   *
+   * \param id the handle of the rectangle, must be valid.
+   *
+   * \return the rectangle.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get(const handle id) const noexcept -> const rect_type&
+  {
+    assert(contains(id));
+    return m_entries[id].rect;
+  }
+
+  /**
+   * \brief Returns the amount of rectangles in the grid.
+   *
+   * \return the amount of rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Indicates whether or not the grid is empty.
+   *
+   * \return `true` if there are no rectangles; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Returns the amount of cells that contain rectangles.
+   *
+   * \return the amount of occupied cells.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto cell_count() const noexcept -> size_type
+  {
+    return m_cells.size();
+  }
+
+  /**
+   * \brief Returns the size of the cells.
+   *
+   * \return the width and height of the cells.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto cell_size() const noexcept -> value_type
+  {
+    return static_cast<value_type>(m_cellSize);
+  }
+
+  /// \} End of queries
+
+ private:
+  struct cell_range final
+  {
+    i32 minX{};
+    i32 minY{};
+    i32 maxX{};
+    i32 maxY{};
+
+    [[nodiscard]] auto operator!=(const cell_range& other) const noexcept -> bool
+    {
+      return minX != other.minX || minY != other.minY || maxX != other.maxX ||
+             maxY != other.maxY;
+    }
+  };
+
+  struct entry final
+  {
+    rect_type rect;
+    cell_range cells;
+    u32 stamp{};  // The last query that visited the entry
+    bool alive{};
+  };
+
+  float m_cellSize{};
+  std::unordered_map<u64, std::vector<handle>> m_cells;
+  mutable std::vector<entry> m_entries;
+  std::vector<handle> m_free;
+  size_type m_size{};
+  mutable u32 m_stamp{};
+
+  [[nodiscard]] static auto cell_key(const i32 cx, const i32 cy) noexcept -> u64
+  {
+    return (u64{static_cast<u32>(cx)} << 32u) | u64{static_cast<u32>(cy)};
+  }
+
+  [[nodiscard]] auto cell_of(const value_type value) const noexcept -> i32
+  {
+    return static_cast<i32>(std::floor(static_cast<float>(value) / m_cellSize));
+  }
+
+  [[nodiscard]] auto cells_of(const rect_type& rect) const noexcept -> cell_range
+  {
+    // Rectangles without an area are stored in the cell of their position
+    const auto maxX = (rect.width() > 0) ? rect.max_x() : rect.x();
+    const auto maxY = (rect.height() > 0) ? rect.max_y() : rect.y();
+    return {cell_of(rect.x()), cell_of(rect.y()), cell_of(maxX), cell_of(maxY)};
+  }
+
+  void add_to_cells(const handle id, const cell_range& range)
+  {
+    for (auto cy = range.minY; cy <= range.maxY; ++cy)
+    {
+      for (auto cx = range.minX; cx <= range.maxX; ++cx)
+      {
+        m_cells[cell_key(cx, cy)].push_back(id);
+      }
+    }
+  }
+
+  void remove_from_cells(const handle id, const cell_range& range)
+  {
+    for (auto cy = range.minY; cy <= range.maxY; ++cy)
+    {
+      for (auto cx = range.minX; cx <= range.maxX; ++cx)
+      {
+        const auto it = m_cells.find(cell_key(cx, cy));
+        if (it == m_cells.end())
+        {
+          continue;
+        }
+
+        auto& ids = it->second;
+        for (size_type index = 0; index < ids.size(); ++index)
+        {
+          if (ids[index] == id)
+          {
+            ids[index] = ids.back();
+            ids.pop_back();
+            break;
+          }
+        }
+
+        if (ids.empty())
+        {
+          m_cells.erase(it);
+        }
+      }
+    }
+  }
+
+  void next_stamp() const noexcept
+  {
+    if (m_stamp == (std::numeric_limits<u32>::max)())
+    {
+      for (auto& entry : m_entries)
+      {
+        entry.stamp = 0;
+      }
+
+      m_stamp = 0;
+    }
+
+    ++m_stamp;
+  }
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_SPATIAL_HASH_GRID_HEADER
@@ -0,0 +1,398 @@
+#ifndef CENTURION_SWEEP_AND_PRUNE_HEADER
+#define CENTURION_SWEEP_AND_PRUNE_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // sort, remove_if
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "rect.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class sweep_and_prune
+ *
+ * \brief A broadphase that finds all pairs of intersecting rectangles, by sweeping over
+ * the rectangles sorted by their horizontal extents.
+ *
+ * \details The minimum and maximum x-coordinates of the rectangles are kept in a sorted
+ * array of endpoints. Moving rectangles usually only changes the order of a few
+ * endpoints between frames, so the array is sorted again with insertion sort, which is
+ * close to linear for nearly sorted arrays. The sweep then only tests rectangles whose
+ * horizontal extents overlap, instead of testing every pair of rectangles.
+ * \code{cpp}
+ *   cen::sweep_and_prune<float> broadphase;
+ *   const auto id = broadphase.insert(body.bounds());
+ *
+ *   std::vector<cen::sweep_and_prune<float>::overlap> pairs;
+ *
+ *   // Every frame
+ *   broadphase.move(id, body.bounds());
+ *   broadphase.find_pairs(pairs);
+ * \endcode
+ *
+ * \details The pairs have the same semantics as `intersects()`, so rectangles that only
+ * touch are ignored. Since only one axis is swept, the broadphase works best if the
+ * rectangles are spread out horizontally, rather than stacked in columns.
+ *
+ * \tparam T the representation type of the rectangles, `int` or `float`.
+ *
+ * \see `spatial_hash_grid`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class sweep_and_prune final
+{
+ public:
+  using rect_type = basic_rect<T>;
+  using value_type = typename rect_type::value_type;
+  using size_type = std::size_t;
+  using handle = u32;
+
+  /**
+   * \struct overlap
+   *
+   * \brief A pair of intersecting rectangles.
+   *
+   * \since 6.1.0
+   */
+  struct overlap final
+  {
+    handle first{};   ///< The smaller handle of the pair.
+    handle second{};  ///< The larger handle of the pair.
+  };
+
+  /**
+   * \brief Adds a rectangle to the broadphase.
+   *
+   * \param rect the rectangle that will be added.
+   *
+   * \return the handle of the rectangle, which is valid until the rectangle is removed.
+   *
+   * \since 6.1.0
+   */
+  auto insert(const rect_type& rect) -> handle
+  {
+    handle id{};
+
+    if (!m_free.empty())
+    {
+      id = m_free.back();
+      m_free.pop_back();
+    }
+    else
+    {
+      id = static_cast<handle>(m_entries.size());
+      m_entries.emplace_back();
+      m_activeSlots.push_back(inactive);
+    }
+
+    auto& entry = m_entries[id];
+    entry.rect = rect;
+    entry.alive = true;
+
+    m_endpoints.push_back(endpoint{rect.x(), (id << 1u) | 1u});
+    m_endpoints.push_back(endpoint{rect.max_x(), id << 1u});
+    m_inserted += 2;
+
+    ++m_size;
+    return id;
+  }
+
+  /**
+   * \brief Changes the rectangle of a handle.
+   *
+   * \details The endpoints are sorted by the next call to `find_pairs()`, so this is
+   * cheap.
+   *
+   * \param id the handle of the rectangle, must be valid.
+   * \param rect the new rectangle.
+   *
+   * \since 6.1.0
+   */
+  void move(const handle id, const rect_type& rect) noexcept
+  {
+    assert(contains(id));
+    m_entries[id].rect = rect;
+  }
+
+  /**
+   * \brief Removes a rectangle from the broadphase.
+   *
+   * \details The handle may be reused by insertions after the next call to
+   * `find_pairs()`.
+   *
+   * \param id the handle of the rectangle, must be valid.
+   *
+   * \since 6.1.0
+   */
+  void remove(const handle id)
+  {
+    assert(contains(id));
+
+    m_entries[id].alive = false;
+    m_removed.push_back(id);
+
+    --m_size;
+  }
+
+  /**
+   * \brief Removes all rectangles.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_entries.clear();
+    m_endpoints.clear();
+    m_active.clear();
+    m_activeSlots.clear();
+    m_free.clear();
+    m_removed.clear();
+    m_inserted = 0;
+    m_size = 0;
+  }
+
+  /**
+   * \brief Reserves memory for a number of rectangles.
+   *
+   * \param capacity the amount of rectangles to reserve memory for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_entries.reserve(capacity);
+    m_activeSlots.reserve(capacity);
+    m_endpoints.reserve(capacity * 2u);
+  }
+
+  /**
+   * \brief Finds all pairs of intersecting rectangles.
+   *
+   * \details The endpoints are first updated with the current rectangles and sorted
+   * again, after which the rectangles are swept from left to right. The pairs are written
+   * to a buffer supplied by the caller, which keeps its memory between frames, so that
+   * finding pairs doesn't allocate memory once the buffer is large enough.
+   *
+   * \param[out] pairs the buffer that receives the pairs, in no particular order. Any
+   * previous contents are discarded.
+   *
+   * \return the amount of pairs.
+   *
+   * \since 6.1.0
+   */
+  auto find_pairs(std::vector<overlap>& pairs) -> size_type
+  {
+    pairs.clear();
+
+    compact();
+    sort_endpoints();
+
+    m_active.clear();
+
+    for (const auto& point : m_endpoints)
+    {
+      const auto id = static_cast<handle>(point.key >> 1u);
+
+      if (point.key & 1u)
+      {
+        const auto& rect = m_entries[id].rect;
+        const auto maxX = rect.max_x();
+        const auto minY = rect.y();
+        const auto maxY = rect.max_y();
+
+        for (const auto& other : m_active)
+        {
+          if (other.minX < maxX && other.minY < maxY && minY < other.maxY)
+          {
+            pairs.push_back((id < other.id) ? overlap{id, other.id}
+                                            : overlap{other.id, id});
+          }
+        }
+
+        // Rectangles without width end before they start, so they're never active
+        if (rect.x() < maxX)
+        {
+          m_activeSlots[id] = static_cast<u32>(m_active.size());
+          m_active.push_back(active_body{rect.x(), minY, maxY, id});
+        }
+      }
+      else if (const auto slot = m_activeSlots[id]; slot != inactive)
+      {
+        const auto& last = m_active.back();
+        m_activeSlots[last.id] = slot;
+        m_active[slot] = last;
+        m_active.pop_back();
+
+        m_activeSlots[id] = inactive;
+      }
+    }
+
+    return pairs.size();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the rectangle of a handle.
+   *
+   * \param id the handle of the rectangle, must be valid.
+   *
+   * \return the rectangle.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto at(const handle id) const noexcept -> const rect_type&
+  {
+    assert(contains(id));
+    return m_entries[id].rect;
+  }
+
+  /**
+   * \brief Indicates whether or not a handle refers to a rectangle.
+   *
+   * \param id the handle that will be checked.
+   *
+   * \return `true` if the handle is valid; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const handle id) const noexcept -> bool
+  {
+    return id < m_entries.size() && m_entries[id].alive;
+  }
+
+  /**
+   * \brief Returns the amount of rectangles.
+   *
+   * \return the amount of rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Indicates whether or not there are no rectangles.
+   *
+   * \return `true` if there are no rectangles; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /// \} End of queries
+
+ private:
+  inline constexpr static u32 inactive = 0xFFFF'FFFFu;
+
+  struct entry final
+  {
+    rect_type rect;
+    bool alive{};
+  };
+
+  // The key is the handle shifted by one, with the lowest bit set for minimum endpoints
+  struct endpoint final
+  {
+    value_type value{};
+    u32 key{};
+  };
+
+  struct active_body final
+  {
+    value_type minX{};
+    value_type minY{};
+    value_type maxY{};
+    handle id{};
+  };
+
+  std::vector<entry> m_entries;
+  std::vector<endpoint> m_endpoints;  // Sorted by value, maximum endpoints first on ties
+  std::vector<active_body> m_active;
+  std::vector<u32> m_activeSlots;  // The index of every rectangle in the active list
+  std::vector<handle> m_free;
+  std::vector<handle> m_removed;  // Handles that still have endpoints
+  size_type m_inserted{};         // The amount of endpoints added since the last sort
+  size_type m_size{};
+
+  [[nodiscard]] static auto precedes(const endpoint& a, const endpoint& b) noexcept
+      -> bool
+  {
+    // Rectangles that only touch shouldn't be active at the same time
+    return (a.value < b.value) || (!(b.value < a.value) && (a.key & 1u) < (b.key & 1u));
+  }
+
+  void compact()
+  {
+    if (m_removed.empty())
+    {
+      return;
+    }
+
+    const auto last = std::remove_if(m_endpoints.begin(),
+                                     m_endpoints.end(),
+                                     [this](const endpoint& point) noexcept {
+                                       return !m_entries[point.key >> 1u].alive;
+                                     });
+    m_endpoints.erase(last, m_endpoints.end());
+
+    // The handles can only be reused once their old endpoints are gone
+    m_free.insert(m_free.end(), m_removed.begin(), m_removed.end());
+    m_removed.clear();
+  }
+
+  void sort_endpoints() noexcept
+  {
+    for (auto& point : m_endpoints)
+    {
+      const auto& rect = m_entries[point.key >> 1u].rect;
+      point.value = (point.key & 1u) ? rect.x() : rect.max_x();
+    }
+
+    // Insertion sort is slow for lots of new endpoints, which are appended unsorted
+    if (m_inserted > 64u && m_inserted * 8u > m_endpoints.size())
+    {
+      std::sort(m_endpoints.begin(), m_endpoints.end(), &sweep_and_prune::precedes);
+    }
+    else
+    {
+      const auto count = m_endpoints.size();
+      for (size_type i = 1; i < count; ++i)
+      {
+        const auto point = m_endpoints[i];
+
+        auto j = i;
+        for (; j > 0 && precedes(point, m_endpoints[j - 1u]); --j)
+        {
+          m_endpoints[j] = m_endpoints[j - 1u];
+        }
+
+        m_endpoints[j] = point;
+      }
+    }
+
+    m_inserted = 0;
+  }
+};
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_SWEEP_AND_PRUNE_HEADER
@@ -0,0 +1,441 @@
+#ifndef CENTURION_TRANSFORM2D_HEADER
+#define CENTURION_TRANSFORM2D_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cmath>    // cos, sin
+#include <cstddef>  // size_t
+#include <ostream>  // ostream
+#include <string>   // string
+
+#include "../detail/format_writer.hpp"
+#include "../detail/rect_kernels.hpp"
+#include "point.hpp"
+
+namespace cen {
+
+/// \addtogroup math
+/// \{
+
+/**
+ * \class transform2d
+ *
+ * \brief Represents a 2D affine transform, i.e. a combination of translations, rotations,
+ * scalings and shears.
+ *
+ * \details A transform maps a point (x, y) to (a * x + c * y + tx, b * x + d * y + ty).
+ * Transforms are combined with `operator*`, where `lhs * rhs` applies `rhs` first. All
+ * operations except the creation of rotations are `constexpr`.
+ *
+ * \details The coefficients are stored in a 16-byte aligned block, which is passed
+ * directly to the vectorized kernels used by `point_array::transform()`.
+ * \code{cpp}
+ *   // Rotates a sprite by 45 degrees around its center, and then moves it
+ *   const auto transform = cen::transform2d::translation(10, 0) *
+ *                          cen::transform2d::rotation(45, destination.center());
+ * \endcode
+ *
+ * \see `point_array::transform()`
+ * \see `sprite_batch::add()`
+ *
+ * \since 6.1.0
+ */
+class alignas(16) transform2d final
+{
+ public:
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an identity transform.
+   *
+   * \since 6.1.0
+   */
+  constexpr transform2d() noexcept = default;
+
+  /**
+   * \brief Creates a transform from its coefficients.
+   *
+   * \param a the factor of the x-coordinate in the transformed x-coordinate.
+   * \param b the factor of the x-coordinate in the transformed y-coordinate.
+   * \param c the factor of the y-coordinate in the transformed x-coordinate.
+   * \param d the factor of the y-coordinate in the transformed y-coordinate.
+   * \param tx the offset of the transformed x-coordinate.
+   * \param ty the offset of the transformed y-coordinate.
+   *
+   * \since 6.1.0
+   */
+  constexpr transform2d(const float a,
+                        const float b,
+                        const float c,
+                        const float d,
+                        const float tx,
+                        const float ty) noexcept
+      : m_values{a, b, c, d, tx, ty}
+  {}
+
+  /**
+   * \brief Creates a transform that moves points.
+   *
+   * \param dx the offset along the x-axis.
+   * \param dy the offset along the y-axis.
+   *
+   * \return a translation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto translation(const float dx, const float dy) noexcept
+      -> transform2d
+  {
+    return {1, 0, 0, 1, dx, dy};
+  }
+
+  /**
+   * \brief Creates a transform that scales points relative to the origin.
+   *
+   * \param sx the factor along the x-axis.
+   * \param sy the factor along the y-axis.
+   *
+   * \return a scaling.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto scaling(const float sx, const float sy) noexcept
+      -> transform2d
+  {
+    return {sx, 0, 0, sy, 0, 0};
+  }
+
+  /**
+   * \brief Creates a transform that scales points relative to a point.
+   *
+   * \param sx the factor along the x-axis.
+   * \param sy the factor along the y-axis.
+   * \param origin the point that isn't moved by the transform.
+   *
+   * \return a scaling.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto scaling(const float sx,
+                                              const float sy,
+                                              const fpoint origin) noexcept
+      -> transform2d
+  {
+    return {sx, 0, 0, sy, origin.x() - sx * origin.x(), origin.y() - sy * origin.y()};
+  }
+
+  /**
+   * \brief Creates a transform that rotates points around the origin.
+   *
+   * \details Rotations are clockwise on the screen, like `basic_renderer::render()`.
+   *
+   * \param degrees the angle of the rotation, in degrees.
+   *
+   * \return a rotation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto rotation(const float degrees) noexcept -> transform2d
+  {
+    const auto radians = degrees * 0.0174532925f;
+    const auto cosine = std::cos(radians);
+    const auto sine = std::sin(radians);
+    return {cosine, sine, -sine, cosine, 0, 0};
+  }
+
+  /**
+   * \brief Creates a transform that rotates points around a point.
+   *
+   * \param degrees the clockwise angle of the rotation, in degrees.
+   * \param origin the point that the points are rotated around.
+   *
+   * \return a rotation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto rotation(const float degrees, const fpoint origin) noexcept
+      -> transform2d
+  {
+    const auto r = rotation(degrees);
+    const auto x = origin.x();
+    const auto y = origin.y();
+    return {r.a(),
+            r.b(),
+            r.c(),
+            r.d(),
+            x - r.a() * x - r.c() * y,
+            y - r.b() * x - r.d() * y};
+  }
+
+  /// \} End of construction
+
+  /**
+   * \brief Transforms a point.
+   *
+   * \param point the point that will be transformed.
+   *
+   * \return the transformed point.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto apply(const fpoint point) const noexcept -> fpoint
+  {
+    const auto& m = m_values;
+    return {m.a * point.x() + m.c * point.y() + m.tx,
+            m.b * point.x() + m.d * point.y() + m.ty};
+  }
+
+  /**
+   * \brief Returns the inverse of the transform.
+   *
+   * \pre The transform must be invertible.
+   *
+   * \return a transform that undoes this transform.
+   *
+   * \see `is_invertible()`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto inverse() const noexcept -> transform2d
+  {
+    assert(is_invertible());
+
+    const auto& m = m_values;
+    const auto inv = 1.0f / determinant();
+
+    const auto a = m.d * inv;
+    const auto b = -m.b * inv;
+    const auto c = -m.c * inv;
+    const auto d = m.a * inv;
+
+    return {a, b, c, d, -(a * m.tx + c * m.ty), -(b * m.tx + d * m.ty)};
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the determinant of the linear part of the transform.
+   *
+   * \return the factor that areas are scaled by, negative if the transform mirrors.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto determinant() const noexcept -> float
+  {
+    return m_values.a * m_values.d - m_values.b * m_values.c;
+  }
+
+  /**
+   * \brief Indicates whether or not the transform can be inverted.
+   *
+   * \return `true` if the determinant isn't zero; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto is_invertible() const noexcept -> bool
+  {
+    return determinant() != 0;
+  }
+
+  /**
+   * \brief Returns the `a` coefficient.
+   *
+   * \return the factor of the x-coordinate in the transformed x-coordinate.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto a() const noexcept -> float
+  {
+    return m_values.a;
+  }
+
+  /**
+   * \brief Returns the `b` coefficient.
+   *
+   * \return the factor of the x-coordinate in the transformed y-coordinate.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto b() const noexcept -> float
+  {
+    return m_values.b;
+  }
+
+  /**
+   * \brief Returns the `c` coefficient.
+   *
+   * \return the factor of the y-coordinate in the transformed x-coordinate.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto c() const noexcept -> float
+  {
+    return m_values.c;
+  }
+
+  /**
+   * \brief Returns the `d` coefficient.
+   *
+   * \return the factor of the y-coordinate in the transformed y-coordinate.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto d() const noexcept -> float
+  {
+    return m_values.d;
+  }
+
+  /**
+   * \brief Returns the `tx` coefficient.
+   *
+   * \return the offset of the transformed x-coordinate.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto tx() const noexcept -> float
+  {
+    return m_values.tx;
+  }
+
+  /**
+   * \brief Returns the `ty` coefficient.
+   *
+   * \return the offset of the transformed y-coordinate.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto ty() const noexcept -> float
+  {
+    return m_values.ty;
+  }
+
+  /// \} End of queries
+
+  /// \cond FALSE
+
+  [[nodiscard]] constexpr auto coefficients() const noexcept
+      -> const detail::affine_coefficients&
+  {
+    return m_values;
+  }
+
+  /// \endcond
+
+ private:
+  detail::affine_coefficients m_values;
+};
+
+/**
+ * \brief Combines two transforms.
+ *
+ * \param lhs the transform that is applied last.
+ * \param rhs the transform that is applied first.
+ *
+ * \return a transform that applies `rhs` and then `lhs`.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] constexpr auto operator*(const transform2d& lhs,
+                                       const transform2d& rhs) noexcept -> transform2d
+{
+  return {lhs.a() * rhs.a() + lhs.c() * rhs.b(),
+          lhs.b() * rhs.a() + lhs.d() * rhs.b(),
+          lhs.a() * rhs.c() + lhs.c() * rhs.d(),
+          lhs.b() * rhs.c() + lhs.d() * rhs.d(),
+          lhs.a() * rhs.tx() + lhs.c() * rhs.ty() + lhs.tx(),
+          lhs.b() * rhs.tx() + lhs.d() * rhs.ty() + lhs.ty()};
+}
+
+/// \name String conversions
+/// \{
+
+/**
+ * \brief Writes a textual representation of a transform to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param transform the transform that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer,
+                      const std::size_t size,
+                      const transform2d& transform) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("transform2d{a: ",
+                      transform.a(),
+                      ", b: ",
+                      transform.b(),
+                      ", c: ",
+                      transform.c(),
+                      ", d: ",
+                      transform.d(),
+                      ", tx: ",
+                      transform.tx(),
+                      ", ty: ",
+                      transform.ty(),
+                      "}");
+}
+
+/**
+ * \brief Returns a textual representation of a transform.
+ *
+ * \param transform the transform that will be converted.
+ *
+ * \return a string that represents the transform.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto to_string(const transform2d& transform) -> std::string
+{
+  return detail::format_string(transform);
+}
+
+/**
+ * \brief Prints a textual representation of a transform.
+ *
+ * \param stream the stream that will be used.
+ * \param transform the transform that will be printed.
+ *
+ * \return the used stream.
+ *
+ * \since 6.1.0
+ */
+inline auto operator<<(std::ostream& stream, const transform2d& transform)
+    -> std::ostream&
+{
+  return stream << to_string(transform);
+}
+
+/// \} End of string conversions
+
+/// \name Transform comparison operators
+/// \{
+
+[[nodiscard]] constexpr auto operator==(const transform2d& lhs,
+                                        const transform2d& rhs) noexcept -> bool
+{
+  return lhs.a() == rhs.a() && lhs.b() == rhs.b() && lhs.c() == rhs.c() &&
+         lhs.d() == rhs.d() && lhs.tx() == rhs.tx() && lhs.ty() == rhs.ty();
+}
+
+[[nodiscard]] constexpr auto operator!=(const transform2d& lhs,
+                                        const transform2d& rhs) noexcept -> bool
+{
+  return !(lhs == rhs);
+}
+
+/// \} End of transform comparison operators
+
+/// \} End of group math
+
+}  // namespace cen
+
+#endif  // CENTURION_TRANSFORM2D_HEADER
@@ -1,10 +1,12 @@
 #ifndef CENTURION_VECTOR3_HEADER
 #define CENTURION_VECTOR3_HEADER
 
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
-#include "../detail/to_string.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/format_writer.hpp"
 
 namespace cen {
 
@@ -68,6 +70,19 @@ void serialize(Archive& archive, vector3<T>& vector)
   archive(vector.x, vector.y, vector.z);
 }
 
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+struct binary_layout<vector3<T>> final
+{
+  inline constexpr static std::size_t components = 3;
+  inline constexpr static std::size_t component_size = sizeof(T);
+};
+
+}  // namespace detail
+/// \endcond
+
 /// \name Vector3 comparison operators
 /// \{
 
@@ -111,6 +126,28 @@ template <typename T>
 
 /// \} End of vector3 comparison operators
 
+/**
+ * \brief Writes a string that represents a vector to a buffer.
+ *
+ * \tparam T the representation type used by the vector.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param vector the vector that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer, const std::size_t size, const vector3<T>& vector) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("vector3{x: ", vector.x, ", y: ", vector.y, ", z: ", vector.z, "}");
+}
+
 /**
  * \brief Returns a string that represents a vector.
  *
@@ -125,9 +162,7 @@ template <typename T>
 template <typename T>
 [[nodiscard]] auto to_string(const vector3<T>& vector) -> std::string
 {
-  return "vector3{x: " + detail::to_string(vector.x).value() +
-         ", y: " + detail::to_string(vector.y).value() +
-         ", z: " + detail::to_string(vector.z).value() + "}";
+  return detail::format_string(vector);
 }
 
 /**
@@ -0,0 +1,35 @@
+#ifndef CENTURION_SYSTEM_SUBSYSTEM_HEADER
+#define CENTURION_SYSTEM_SUBSYSTEM_HEADER
+
+/**
+ * \file system.hpp
+ *
+ * \brief Includes all headers of the system subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "system/battery.hpp"
+#include "system/byte_order.hpp"
+#include "system/clipboard.hpp"
+#include "system/counter.hpp"
+#include "system/cpu.hpp"
+#include "system/cpu_topology.hpp"
+#include "system/frame_pacer.hpp"
+#include "system/frame_stats.hpp"
+#include "system/game_loop.hpp"
+#include "system/locale.hpp"
+#include "system/platform.hpp"
+#include "system/plugin_host.hpp"
+#include "system/power_policy.hpp"
+#include "system/profiler.hpp"
+#include "system/ram.hpp"
+#include "system/shared_object.hpp"
+#include "system/simd_vector.hpp"
+#include "system/timer_wheel.hpp"
+#include "system/trace_exporter.hpp"
+
+#endif  // CENTURION_SYSTEM_SUBSYSTEM_HEADER
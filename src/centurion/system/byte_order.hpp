@@ -3,7 +3,11 @@
 
 #include <SDL.h>
 
+#include <cstddef>  // size_t
+
 #include "../core/integers.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/byte_swap_kernels.hpp"
 
 namespace cen {
 
@@ -120,6 +124,88 @@ namespace cen {
 }
 
 /// \} End of swap from little endian to native format
+
+/// \name Bulk byte order swapping
+/// \{
+
+/**
+ * \brief Swaps the byte order of an array of values, in place.
+ *
+ * \details The values are swapped with SIMD instructions when they are available, which
+ * is considerably faster than swapping the values one at a time.
+ *
+ * \details Besides arithmetic types, the values can be points, rectangles, areas, 3D
+ * vectors or colors, in which case the byte order of each component is swapped. The
+ * components of colors are single bytes, so they are left as is.
+ *
+ * \tparam T the type of the values, e.g. `float` or `fpoint`.
+ *
+ * \param data the values that will be swapped.
+ * \param count the amount of values.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+void swap_byte_order(T* data, const std::size_t count) noexcept
+{
+  static_assert(detail::has_binary_layout_v<T>,
+                "The values must be arithmetic, or made up of arithmetic components!");
+
+  using layout = detail::binary_layout<T>;
+  if constexpr (layout::component_size != 1)
+  {
+    detail::swap_bytes_kernel<layout::component_size>(reinterpret_cast<u8*>(data),
+                                                      count * layout::components);
+  }
+}
+
+/**
+ * \brief Converts an array of big endian values to the native byte order, in place.
+ *
+ * \details This function does nothing on big endian platforms. The conversion is its own
+ * inverse, so it also converts native values to big endian.
+ *
+ * \tparam T the type of the values, e.g. `float` or `fpoint`.
+ *
+ * \param data the values that will be converted.
+ * \param count the amount of values.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+void swap_big_endian([[maybe_unused]] T* data,
+                     [[maybe_unused]] const std::size_t count) noexcept
+{
+  if constexpr (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+  {
+    swap_byte_order(data, count);
+  }
+}
+
+/**
+ * \brief Converts an array of little endian values to the native byte order, in place.
+ *
+ * \details This function does nothing on little endian platforms. The conversion is its
+ * own inverse, so it also converts native values to little endian.
+ *
+ * \tparam T the type of the values, e.g. `float` or `fpoint`.
+ *
+ * \param data the values that will be converted.
+ * \param count the amount of values.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+void swap_little_endian([[maybe_unused]] T* data,
+                        [[maybe_unused]] const std::size_t count) noexcept
+{
+  if constexpr (SDL_BYTEORDER == SDL_BIG_ENDIAN)
+  {
+    swap_byte_order(data, count);
+  }
+}
+
+/// \} End of bulk byte order swapping
 /// \} End of system group
 
 }  // namespace cen
@@ -3,7 +3,9 @@
 
 #include <SDL.h>
 
+#include "../core/integers.hpp"
 #include "../core/time.hpp"
+#include "../detail/tsc_clock.hpp"
 
 /// \addtogroup system
 /// \{
@@ -59,6 +61,41 @@ template <typename T>
                     static_cast<T>(frequency())};
 }
 
+/**
+ * \brief Returns the value of a monotonic clock, in nanoseconds.
+ *
+ * \details Unlike `ticks()`, the value doesn't wrap in practice, and unlike `now()`,
+ * it's in a fixed unit. If the CPU has an invariant time stamp counter, the counter is
+ * read directly, which avoids the system call behind `now()` on some platforms. The time
+ * stamp counter is calibrated against the high-performance counter on the first call,
+ * which takes a few milliseconds.
+ *
+ * \note The origin of the clock is unspecified, so only differences between values are
+ * meaningful.
+ *
+ * \return the current value of the monotonic clock.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto monotonic() noexcept(noexcept(nanoseconds<u64>{u64{}}))
+    -> nanoseconds<u64>
+{
+  return nanoseconds<u64>{detail::monotonic_nanoseconds()};
+}
+
+/**
+ * \brief Indicates whether or not `monotonic()` reads the time stamp counter directly.
+ *
+ * \return `true` if the CPU has an invariant time stamp counter that was successfully
+ * calibrated; `false` otherwise.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto monotonic_uses_tsc() noexcept -> bool
+{
+  return detail::uses_tsc_clock();
+}
+
 /**
  * \brief Returns the amount of milliseconds since the library was initialized.
  *
@@ -21,6 +21,13 @@ namespace cen {
 class simd_block final
 {
  public:
+  /**
+   * \brief Creates an empty block, i.e. the internal pointer is null.
+   *
+   * \since 6.1.0
+   */
+  simd_block() noexcept = default;
+
   /**
    * \brief Allocates a block of SIMD-friendly memory.
    *
@@ -0,0 +1,503 @@
+#ifndef CENTURION_CPU_TOPOLOGY_HEADER
+#define CENTURION_CPU_TOPOLOGY_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // find
+#include <cstddef>    // size_t
+#include <fstream>    // ifstream
+#include <string>     // string, to_string
+#include <utility>    // pair
+#include <vector>     // vector
+
+#ifdef _WIN32
+#include "../detail/windows_api.hpp"
+#endif  // _WIN32
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "cpu.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class core_mask
+ *
+ * \brief A set of logical CPU cores, e.g. the cores that a thread may run on.
+ *
+ * \details Logical cores are identified by their index, from zero up to (but excluding)
+ * `cpu::cores()`.
+ * \code{cpp}
+ *   auto mask = cen::core_mask::single(2);
+ *   mask.set(3);
+ *
+ *   cen::thread::set_affinity(mask);
+ * \endcode
+ *
+ * \note Only the first 64 logical cores can be represented.
+ *
+ * \since 6.1.0
+ *
+ * \see `cpu_topology`
+ * \see `thread::set_affinity()`
+ */
+class core_mask final
+{
+ public:
+  using mask_type = u64;
+
+  /// The maximum amount of logical cores in a mask.
+  inline constexpr static int max_cores = 64;
+
+  /**
+   * \brief Creates an empty mask.
+   *
+   * \since 6.1.0
+   */
+  constexpr core_mask() noexcept = default;
+
+  /**
+   * \brief Creates a mask from a bit mask.
+   *
+   * \param bits the bit mask, where bit `n` corresponds to the logical core `n`.
+   *
+   * \since 6.1.0
+   */
+  constexpr explicit core_mask(const mask_type bits) noexcept : m_bits{bits}
+  {}
+
+  /**
+   * \brief Returns a mask of all logical cores of the system.
+   *
+   * \return a mask of the first `cpu::cores()` logical cores.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto all() noexcept -> core_mask
+  {
+    const auto cores = cpu::cores();
+    if (cores >= max_cores)
+    {
+      return core_mask{~mask_type{0}};
+    }
+
+    return core_mask{(cores > 0) ? (mask_type{1} << cores) - 1u : mask_type{1}};
+  }
+
+  /**
+   * \brief Returns a mask of a single logical core.
+   *
+   * \param core the index of the logical core, in the range [0, `max_cores`).
+   *
+   * \return a mask that only contains the specified core, or an empty mask if the index
+   * is out of range.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto single(const int core) noexcept -> core_mask
+  {
+    return core_mask{bit(core)};
+  }
+
+  /// \name Mutators
+  /// \{
+
+  /**
+   * \brief Adds a logical core to the mask.
+   *
+   * \param core the index of the logical core, out of range indices are ignored.
+   *
+   * \since 6.1.0
+   */
+  constexpr void set(const int core) noexcept
+  {
+    m_bits |= bit(core);
+  }
+
+  /**
+   * \brief Removes a logical core from the mask.
+   *
+   * \param core the index of the logical core, out of range indices are ignored.
+   *
+   * \since 6.1.0
+   */
+  constexpr void reset(const int core) noexcept
+  {
+    m_bits &= ~bit(core);
+  }
+
+  /// \} End of mutators
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not the mask contains a logical core.
+   *
+   * \param core the index of the logical core.
+   *
+   * \return `true` if the mask contains the core; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto test(const int core) const noexcept -> bool
+  {
+    return (m_bits & bit(core)) != 0;
+  }
+
+  /**
+   * \brief Returns the amount of logical cores in the mask.
+   *
+   * \return the amount of cores in the mask.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto count() const noexcept -> int
+  {
+    int result = 0;
+    for (auto bits = m_bits; bits != 0; bits &= bits - 1u)
+    {
+      ++result;
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Indicates whether or not the mask is empty.
+   *
+   * \return `true` if the mask contains no cores; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool
+  {
+    return m_bits == 0;
+  }
+
+  /**
+   * \brief Returns the underlying bit mask.
+   *
+   * \return the bit mask, where bit `n` corresponds to the logical core `n`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto bits() const noexcept -> mask_type
+  {
+    return m_bits;
+  }
+
+  /// \} End of queries
+
+  [[nodiscard]] constexpr friend auto operator|(const core_mask lhs,
+                                                const core_mask rhs) noexcept
+      -> core_mask
+  {
+    return core_mask{lhs.m_bits | rhs.m_bits};
+  }
+
+  [[nodiscard]] constexpr friend auto operator&(const core_mask lhs,
+                                                const core_mask rhs) noexcept
+      -> core_mask
+  {
+    return core_mask{lhs.m_bits & rhs.m_bits};
+  }
+
+  [[nodiscard]] constexpr friend auto operator==(const core_mask lhs,
+                                                 const core_mask rhs) noexcept -> bool
+  {
+    return lhs.m_bits == rhs.m_bits;
+  }
+
+  [[nodiscard]] constexpr friend auto operator!=(const core_mask lhs,
+                                                 const core_mask rhs) noexcept -> bool
+  {
+    return !(lhs == rhs);
+  }
+
+ private:
+  mask_type m_bits{};
+
+  [[nodiscard]] constexpr static auto bit(const int core) noexcept -> mask_type
+  {
+    return (core >= 0 && core < max_cores) ? mask_type{1} << core : mask_type{0};
+  }
+};
+
+/**
+ * \class cpu_topology
+ *
+ * \brief Describes how the logical cores of the system map to physical cores.
+ *
+ * \details Logical cores that belong to the same physical core share its execution
+ * units, which is the case with simultaneous multithreading (hyper-threading). Threads
+ * that should not disturb each other should be pinned to different physical cores.
+ * \code{cpp}
+ *   const auto topology = cen::cpu_topology::query();
+ *
+ *   // In the render thread
+ *   cen::thread::set_affinity(topology.siblings(0));
+ *
+ *   // In the audio thread
+ *   cen::thread::set_affinity(topology.siblings(1));
+ * \endcode
+ *
+ * \note The topology is read from the operating system on Linux and Windows. On other
+ * platforms, every logical core is reported as a physical core of its own.
+ *
+ * \since 6.1.0
+ *
+ * \see `core_mask`
+ */
+class cpu_topology final
+{
+ public:
+  /**
+   * \brief Queries the topology of the logical cores reported by `cpu::cores()`.
+   *
+   * \return the topology of the system.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto query() -> cpu_topology
+  {
+    const auto keys = physical_keys((cpu::cores() > 0) ? cpu::cores() : 1);
+
+    cpu_topology result;
+    result.m_physical.reserve(keys.size());
+
+    // Physical cores are numbered in the order of their first logical core
+    std::vector<std::pair<int, int>> known;
+    std::vector<int> packages;
+
+    for (std::size_t core = 0; core < keys.size(); ++core)
+    {
+      const auto& key = keys[core];
+
+      std::size_t index = 0;
+      while (index < known.size() && known[index] != key)
+      {
+        ++index;
+      }
+
+      if (index == known.size())
+      {
+        known.push_back(key);
+        result.m_siblings.emplace_back();
+      }
+
+      result.m_physical.push_back(static_cast<int>(index));
+      result.m_siblings[index].set(static_cast<int>(core));
+
+      if (std::find(packages.begin(), packages.end(), key.first) == packages.end())
+      {
+        packages.push_back(key.first);
+      }
+    }
+
+    result.m_packages = static_cast<int>(packages.size());
+    return result;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of logical cores.
+   *
+   * \return the amount of logical cores, which is the same as `cpu::cores()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto logical_cores() const noexcept -> int
+  {
+    return static_cast<int>(m_physical.size());
+  }
+
+  /**
+   * \brief Returns the amount of physical cores.
+   *
+   * \return the amount of physical cores, at most the amount of logical cores.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto physical_cores() const noexcept -> int
+  {
+    return static_cast<int>(m_siblings.size());
+  }
+
+  /**
+   * \brief Returns the amount of physical CPU packages, i.e. sockets.
+   *
+   * \return the amount of CPU packages.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto packages() const noexcept -> int
+  {
+    return m_packages;
+  }
+
+  /**
+   * \brief Returns the physical core that a logical core belongs to.
+   *
+   * \param logical the index of the logical core.
+   *
+   * \return the index of the physical core, in the range [0, `physical_cores()`).
+   *
+   * \throws cen_error if the logical core doesn't exist.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto physical_core(const int logical) const -> int
+  {
+    if (logical < 0 || logical >= logical_cores())
+    {
+      throw cen_error{"Invalid logical core index!"};
+    }
+
+    return m_physical[static_cast<std::size_t>(logical)];
+  }
+
+  /**
+   * \brief Returns the logical cores that belong to a physical core.
+   *
+   * \param physical the index of the physical core.
+   *
+   * \return a mask of the logical cores of the physical core.
+   *
+   * \throws cen_error if the physical core doesn't exist.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto siblings(const int physical) const -> core_mask
+  {
+    if (physical < 0 || physical >= physical_cores())
+    {
+      throw cen_error{"Invalid physical core index!"};
+    }
+
+    return m_siblings[static_cast<std::size_t>(physical)];
+  }
+
+  /**
+   * \brief Returns a mask with one logical core of every physical core.
+   *
+   * \details Running one thread on each of these cores avoids threads competing for the
+   * execution units of the same physical core.
+   *
+   * \return a mask with the first logical core of every physical core.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto one_per_physical_core() const noexcept -> core_mask
+  {
+    core_mask result;
+    for (auto& siblings : m_siblings)
+    {
+      for (int core = 0; core < core_mask::max_cores; ++core)
+      {
+        if (siblings.test(core))
+        {
+          result.set(core);
+          break;
+        }
+      }
+    }
+
+    return result;
+  }
+
+  /// \} End of queries
+
+ private:
+  std::vector<int> m_physical;  // The physical core of every logical core
+  std::vector<core_mask> m_siblings;
+  int m_packages{};
+
+  cpu_topology() = default;
+
+  // Returns (package, core) pairs that identify the physical cores of the logical cores
+  [[nodiscard]] static auto physical_keys(const int logical)
+      -> std::vector<std::pair<int, int>>
+  {
+    // By default, every logical core is considered to be a physical core of its own
+    std::vector<std::pair<int, int>> keys;
+    for (int core = 0; core < logical; ++core)
+    {
+      keys.emplace_back(0, core);
+    }
+
+#if defined(__linux__)
+    for (int core = 0; core < logical; ++core)
+    {
+      const auto directory =
+          "/sys/devices/system/cpu/cpu" + std::to_string(core) + "/topology/";
+
+      int package = 0;
+      int id = -1;
+
+      std::ifstream{directory + "physical_package_id"} >> package;
+      std::ifstream{directory + "core_id"} >> id;
+
+      if (id >= 0)
+      {
+        keys[static_cast<std::size_t>(core)] = {package, id};
+      }
+    }
+#elif defined(_WIN32)
+    DWORD length = 0;
+    GetLogicalProcessorInformation(nullptr, &length);
+
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(
+        length / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+
+    if (info.empty() || !GetLogicalProcessorInformation(info.data(), &length))
+    {
+      return keys;
+    }
+
+    int package = 0;
+    int id = 0;
+
+    for (const auto& entry : info)
+    {
+      for (int core = 0; core < logical && core < core_mask::max_cores; ++core)
+      {
+        if (entry.ProcessorMask & (ULONG_PTR{1} << core))
+        {
+          auto& key = keys[static_cast<std::size_t>(core)];
+          if (entry.Relationship == RelationProcessorPackage)
+          {
+            key.first = package;
+          }
+          else if (entry.Relationship == RelationProcessorCore)
+          {
+            key.second = logical + id;  // Offset to avoid clashing with the defaults
+          }
+        }
+      }
+
+      if (entry.Relationship == RelationProcessorPackage)
+      {
+        ++package;
+      }
+      else if (entry.Relationship == RelationProcessorCore)
+      {
+        ++id;
+      }
+    }
+#endif
+
+    return keys;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_CPU_TOPOLOGY_HEADER
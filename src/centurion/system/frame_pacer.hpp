@@ -0,0 +1,225 @@
+#ifndef CENTURION_FRAME_PACER_HEADER
+#define CENTURION_FRAME_PACER_HEADER
+
+#include <SDL.h>
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../thread/thread.hpp"
+#include "../video/screen.hpp"
+#include "counter.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class frame_pacer
+ *
+ * \brief Limits the frame rate with precise sleeps, as an alternative to VSync.
+ *
+ * \details VSync limits the frame rate by blocking in `present()`, which adds up to a
+ * frame of input latency, and halves the frame rate whenever a frame misses the retrace.
+ * A frame pacer instead sleeps until the deadline of the next frame, so that frames
+ * start at a steady rate. Coarse sleeps are used for most of the remaining time, and the
+ * last part, where the scheduler is too imprecise, is spent polling the high-performance
+ * counter.
+ *
+ * \details The deadlines are spaced evenly, so that an occasional late frame doesn't
+ * shift the following frames. If a frame is more than a whole period late, the schedule
+ * is restarted from the current time instead of rushing to catch up.
+ * \code{cpp}
+ *   auto pacer = cen::frame_pacer::from_refresh_rate();
+ *   renderer.set_present_callback([&pacer] { pacer.wait(); });
+ * \endcode
+ *
+ * \note With OpenGL, `gl::set_adaptive_vsync()` is usually preferable, since it
+ * synchronizes with the display without the stutter of regular VSync.
+ *
+ * \since 6.1.0
+ */
+class frame_pacer final
+{
+ public:
+  /// The default time before a deadline that is spent polling instead of sleeping.
+  inline constexpr static milliseconds<u32> default_spin_time{2};
+
+  /**
+   * \brief Creates a frame pacer.
+   *
+   * \param rate the target amount of frames per second, zero means unlimited.
+   * \param spinTime the time before each deadline that is spent polling the counter.
+   *
+   * \throws cen_error if the rate is negative.
+   *
+   * \since 6.1.0
+   */
+  explicit frame_pacer(const double rate = 0,
+                       const milliseconds<u32> spinTime = default_spin_time)
+      : m_frequency{counter::frequency()}
+      , m_spin{m_frequency * spinTime.count() / 1'000u}
+  {
+    set_target_rate(rate);
+  }
+
+  /**
+   * \brief Creates a frame pacer that targets the refresh rate of a display.
+   *
+   * \param index the index of the display.
+   * \param fallback the rate that is used if the refresh rate is unknown.
+   *
+   * \return a frame pacer for the refresh rate of the display.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto from_refresh_rate(const int index = 0,
+                                              const double fallback = 60) -> frame_pacer
+  {
+    const auto rate = screen::refresh_rate(index);
+    return frame_pacer{(rate && *rate > 0) ? static_cast<double>(*rate) : fallback};
+  }
+
+  /**
+   * \brief Blocks until the deadline of the next frame.
+   *
+   * \details This function should be called once per frame, either right before or right
+   * after presenting. It returns immediately if the rate is unlimited, or if the frame is
+   * already late.
+   *
+   * \return `true` if the function waited; `false` if the deadline had passed.
+   *
+   * \since 6.1.0
+   */
+  auto wait() noexcept -> bool
+  {
+    if (m_period == 0)
+    {
+      return false;
+    }
+
+    auto now = counter::now();
+    if (m_deadline == 0)
+    {
+      m_deadline = now + m_period;  // Starts the schedule
+      return false;
+    }
+    else if (now >= m_deadline)
+    {
+      ++m_missed;
+
+      // Restarts the schedule if the frame is more than a period late
+      m_deadline = (now - m_deadline > m_period) ? now + m_period : m_deadline + m_period;
+      return false;
+    }
+
+    // Sleeps for whole milliseconds, until the deadline is within the spin time
+    if (const auto remaining = m_deadline - now; remaining > m_spin)
+    {
+      const auto ms = (remaining - m_spin) * 1'000u / m_frequency;
+      if (ms != 0)
+      {
+        thread::sleep(milliseconds<u32>{static_cast<u32>(ms)});
+      }
+    }
+
+    do
+    {
+      now = counter::now();
+    } while (now < m_deadline);
+
+    m_deadline += m_period;
+    return true;
+  }
+
+  /**
+   * \brief Restarts the schedule, e.g. after a loading screen or a pause.
+   *
+   * \details The next call to `wait()` returns immediately, and starts a new schedule.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_deadline = 0;
+  }
+
+  /**
+   * \brief Sets the target frame rate.
+   *
+   * \param rate the target amount of frames per second, zero means unlimited.
+   *
+   * \throws cen_error if the rate is negative.
+   *
+   * \since 6.1.0
+   */
+  void set_target_rate(const double rate)
+  {
+    if (rate < 0)
+    {
+      throw cen_error{"The target frame rate can't be negative!"};
+    }
+
+    m_rate = rate;
+    m_period = (rate > 0) ? static_cast<u64>(static_cast<double>(m_frequency) / rate) : 0;
+    reset();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the target frame rate.
+   *
+   * \return the target amount of frames per second; zero if unlimited.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto target_rate() const noexcept -> double
+  {
+    return m_rate;
+  }
+
+  /**
+   * \brief Returns the period between two frame deadlines.
+   *
+   * \return the duration of a frame at the target rate; zero if unlimited.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto period() const noexcept -> seconds<double>
+  {
+    return seconds<double>{static_cast<double>(m_period) /
+                           static_cast<double>(m_frequency)};
+  }
+
+  /**
+   * \brief Returns the amount of frames that missed their deadline.
+   *
+   * \return the amount of calls to `wait()` that were too late to wait, excluding the
+   * first call after construction or a reset.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto missed_deadlines() const noexcept -> u64
+  {
+    return m_missed;
+  }
+
+  /// \} End of queries
+
+ private:
+  u64 m_frequency{};
+  u64 m_spin{};      // In counter units
+  u64 m_period{};    // In counter units, zero if unlimited
+  u64 m_deadline{};  // The counter value of the next deadline, zero if unscheduled
+  u64 m_missed{};
+  double m_rate{};
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_PACER_HEADER
@@ -0,0 +1,324 @@
+#ifndef CENTURION_FRAME_STATS_HEADER
+#define CENTURION_FRAME_STATS_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // nth_element, max_element
+#include <array>      // array
+#include <cstddef>    // size_t, ptrdiff_t
+
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "counter.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct frame_stats_summary
+ *
+ * \brief Statistics about the frames recorded by a `frame_stats` instance.
+ *
+ * \since 6.1.0
+ */
+struct frame_stats_summary final
+{
+  std::size_t frames{};         ///< The amount of frames in the window.
+  milliseconds<double> mean{};  ///< The average frame time.
+  milliseconds<double> p50{};   ///< The median frame time.
+  milliseconds<double> p95{};   ///< The 95th percentile frame time.
+  milliseconds<double> p99{};   ///< The 99th percentile frame time.
+  milliseconds<double> max{};   ///< The longest frame time.
+  std::size_t hitches{};        ///< The amount of frames above the hitch threshold.
+
+  /**
+   * \brief Returns the average amount of frames per second.
+   *
+   * \return the average frame rate, or zero if there are no frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto fps() const noexcept -> double
+  {
+    return (mean.count() > 0) ? 1'000.0 / mean.count() : 0.0;
+  }
+};
+
+/**
+ * \class frame_stats
+ *
+ * \brief Records the durations of the most recent frames, and computes statistics.
+ *
+ * \details The durations are stored in a fixed-size ring, so recording a frame is a
+ * constant-time operation that never allocates memory. The statistics are computed on
+ * demand, by `summary()`, which is linear in the capacity.
+ * \code{cpp}
+ *   cen::frame_stats<> stats;
+ *   renderer.set_present_callback([&stats] { stats.tick(); });
+ *
+ *   // Later
+ *   const auto summary = stats.summary();
+ *   cen::log::info("p99: %f ms", summary.p99.count());
+ * \endcode
+ *
+ * \tparam Capacity the amount of frames that are kept, i.e. the size of the window.
+ *
+ * \since 6.1.0
+ */
+template <std::size_t Capacity = 256>
+class frame_stats final
+{
+  static_assert(Capacity > 0, "The capacity must be positive!");
+
+ public:
+  using size_type = std::size_t;
+  using duration_type = milliseconds<double>;
+
+  /**
+   * \brief Creates an empty instance.
+   *
+   * \param hitchThreshold frames that take longer than this are counted as hitches,
+   * defaults to the duration of a frame at 30 FPS.
+   *
+   * \since 6.1.0
+   */
+  explicit frame_stats(const duration_type hitchThreshold = default_threshold()) noexcept
+      : m_threshold{hitchThreshold}
+  {}
+
+  /**
+   * \brief Records the duration of a frame.
+   *
+   * \param duration the duration of the frame.
+   *
+   * \since 6.1.0
+   */
+  void record(const duration_type duration) noexcept
+  {
+    m_durations[m_next] = duration.count();
+    m_next = (m_next + 1u) % Capacity;
+
+    if (m_size < Capacity)
+    {
+      ++m_size;
+    }
+
+    ++m_totalFrames;
+    if (duration > m_threshold)
+    {
+      ++m_totalHitches;
+    }
+  }
+
+  /**
+   * \brief Records the time elapsed since the previous call as the duration of a frame.
+   *
+   * \details The first call only starts the measurement. Calling this function once per
+   * frame, e.g. after presenting, records the time between frames.
+   *
+   * \since 6.1.0
+   */
+  void tick() noexcept
+  {
+    const auto now = counter::monotonic().count();
+    if (m_last != 0)
+    {
+      const auto nanos = static_cast<double>(now - m_last);
+      record(duration_type{nanos / 1'000'000.0});
+    }
+
+    m_last = now;
+  }
+
+  /**
+   * \brief Removes all recorded frames.
+   *
+   * \details The next call to `tick()` only starts a new measurement.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_next = 0;
+    m_size = 0;
+    m_last = 0;
+    m_totalFrames = 0;
+    m_totalHitches = 0;
+  }
+
+  /**
+   * \brief Sets the threshold for frames that are counted as hitches.
+   *
+   * \param threshold frames longer than this are counted as hitches.
+   *
+   * \since 6.1.0
+   */
+  void set_hitch_threshold(const duration_type threshold) noexcept
+  {
+    m_threshold = threshold;
+  }
+
+  /**
+   * \brief Computes statistics about the frames in the window.
+   *
+   * \details The percentiles use the nearest-rank method, so they are always durations
+   * of recorded frames.
+   *
+   * \return the statistics of the recorded frames, all zero if there are none.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto summary() const noexcept -> frame_stats_summary
+  {
+    frame_stats_summary result;
+    result.frames = m_size;
+
+    if (m_size == 0)
+    {
+      return result;
+    }
+
+    std::array<double, Capacity> sorted;
+    double sum = 0;
+
+    for (size_type index = 0; index < m_size; ++index)
+    {
+      const auto value = m_durations[index];
+      sorted[index] = value;
+      sum += value;
+
+      if (value > m_threshold.count())
+      {
+        ++result.hitches;
+      }
+    }
+
+    const auto begin = sorted.begin();
+    const auto end = begin + static_cast<std::ptrdiff_t>(m_size);
+
+    result.mean = duration_type{sum / static_cast<double>(m_size)};
+    result.max = duration_type{*std::max_element(begin, end)};
+
+    // The percentiles are selected in ascending order, each from the remaining range
+    auto first = begin;
+    const auto select = [&](const size_type percentile) {
+      const auto rank = (percentile * m_size + 99u) / 100u;
+      const auto nth = begin + static_cast<std::ptrdiff_t>((rank > 0) ? rank - 1u : 0u);
+
+      std::nth_element(first, nth, end);
+      first = nth;
+
+      return duration_type{*nth};
+    };
+
+    result.p50 = select(50);
+    result.p95 = select(95);
+    result.p99 = select(99);
+
+    return result;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the duration of the most recently recorded frame.
+   *
+   * \return the duration of the latest frame, or zero if there are no frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto latest() const noexcept -> duration_type
+  {
+    if (m_size == 0)
+    {
+      return duration_type{0};
+    }
+
+    return duration_type{m_durations[(m_next + Capacity - 1u) % Capacity]};
+  }
+
+  /**
+   * \brief Returns the amount of frames in the window.
+   *
+   * \return the amount of recorded frames, at most the capacity.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the maximum amount of frames in the window.
+   *
+   * \return the capacity.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto capacity() noexcept -> size_type
+  {
+    return Capacity;
+  }
+
+  /**
+   * \brief Returns the amount of frames recorded since the last reset.
+   *
+   * \return the total amount of recorded frames, including those outside the window.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto total_frames() const noexcept -> u64
+  {
+    return m_totalFrames;
+  }
+
+  /**
+   * \brief Returns the amount of hitches recorded since the last reset.
+   *
+   * \return the total amount of hitches, including those outside the window.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto total_hitches() const noexcept -> u64
+  {
+    return m_totalHitches;
+  }
+
+  /**
+   * \brief Returns the threshold for frames that are counted as hitches.
+   *
+   * \return the hitch threshold.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto hitch_threshold() const noexcept -> duration_type
+  {
+    return m_threshold;
+  }
+
+  /// \} End of queries
+
+ private:
+  [[nodiscard]] constexpr static auto default_threshold() noexcept -> duration_type
+  {
+    return duration_type{1'000.0 / 30.0};
+  }
+
+  std::array<double, Capacity> m_durations{};  // In milliseconds
+  size_type m_next{};
+  size_type m_size{};
+  u64 m_last{};
+  u64 m_totalFrames{};
+  u64 m_totalHitches{};
+  duration_type m_threshold;
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_STATS_HEADER
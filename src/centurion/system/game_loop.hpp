@@ -0,0 +1,501 @@
+#ifndef CENTURION_GAME_LOOP_HEADER
+#define CENTURION_GAME_LOOP_HEADER
+
+#include <SDL.h>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten.h>
+#endif  // __EMSCRIPTEN__
+
+#include <cmath>        // fmod, lround
+#include <cstddef>      // size_t
+#include <limits>       // numeric_limits
+#include <type_traits>  // is_invocable_v, decay_t
+#include <utility>      // forward
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../video/renderer.hpp"
+#include "../video/renderer_info.hpp"
+#include "../video/screen.hpp"
+#include "counter.hpp"
+#include "frame_pacer.hpp"
+#include "frame_stats.hpp"
+#include "profiler.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct game_loop_settings
+ *
+ * \brief Provides the configuration of a `game_loop` instance.
+ *
+ * \since 6.1.0
+ */
+struct game_loop_settings final
+{
+  double tick_rate{60};                  ///< The amount of simulation updates per second.
+  std::size_t max_updates{8};            ///< The maximum amount of updates per frame.
+  seconds<double> max_frame_time{0.25};  ///< Longer frames are treated as this long.
+  double frame_rate_limit{0};            ///< The maximum frame rate, zero is unlimited.
+};
+
+/// \cond FALSE
+namespace detail {
+
+template <typename Renderer>
+[[nodiscard]] auto has_vsync(const Renderer&) noexcept -> bool
+{
+  return false;
+}
+
+template <typename T>
+[[nodiscard]] auto has_vsync(const basic_renderer<T>& renderer) noexcept -> bool
+{
+  const auto info = get_info(renderer);
+  return info && info->has_vsync();
+}
+
+// Returns the amount of display refreshes per frame that gets closest to a frame rate
+[[nodiscard]] inline auto swap_interval_for(const double limit,
+                                            const double refreshRate) noexcept -> int
+{
+  if (limit <= 0 || refreshRate <= 0 || limit >= refreshRate)
+  {
+    return 1;
+  }
+
+  const auto interval = std::lround(refreshRate / limit);
+  return (interval > 1) ? static_cast<int>(interval) : 1;
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class game_loop
+ *
+ * \brief A game loop driver, with a fixed simulation rate and a variable render rate.
+ *
+ * \details Every frame, the loop polls the events, runs as many fixed-size simulation
+ * updates as the elapsed time calls for, renders and presents. The time that is left
+ * over in the accumulator is passed to the render function as an interpolation factor
+ * in the range [0, 1), which should be used to blend between the two most recent
+ * simulation states.
+ *
+ * The loop protects itself against the "spiral of death", where updates take longer
+ * than the time they simulate, by clamping the frame time and by limiting the amount of
+ * updates per frame. If the limit is hit, the simulation falls behind instead of
+ * stalling the application.
+ * \code{cpp}
+ *   cen::game_loop loop;
+ *   dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { loop.stop(); });
+ *
+ *   loop.run(dispatcher, renderer,
+ *            [&](const cen::seconds<double> dt) { world.update(dt); },
+ *            [&](const double alpha) { world.render(renderer, alpha); });
+ * \endcode
+ *
+ * \note If a frame rate limit is set, the loop paces its frames with a `frame_pacer`,
+ * unless the renderer uses VSync and the limit isn't below the refresh rate, since VSync
+ * already limits the frame rate.
+ *
+ * \note On Emscripten, a loop can't block the browser, so `run()` instead registers its
+ * frames as the main loop of the page, which the browser runs from
+ * `requestAnimationFrame()`, see `run()`.
+ *
+ * \since 6.1.0
+ *
+ * \see `frame_stats`
+ */
+class game_loop final
+{
+ public:
+  using size_type = std::size_t;
+  using duration_type = seconds<double>;
+
+  /**
+   * \brief Creates a game loop.
+   *
+   * \param settings the configuration of the loop.
+   *
+   * \throws cen_error if the tick rate isn't positive or if the maximum amount of updates
+   * is zero.
+   *
+   * \since 6.1.0
+   */
+  explicit game_loop(const game_loop_settings& settings = {})
+      : m_settings{settings}
+      , m_frequency{static_cast<double>(counter::frequency())}
+      , m_pacer{(settings.frame_rate_limit > 0) ? settings.frame_rate_limit : 0}
+  {
+    if (settings.tick_rate <= 0)
+    {
+      throw cen_error{"The tick rate must be positive!"};
+    }
+
+    if (settings.max_updates == 0)
+    {
+      throw cen_error{"The maximum amount of updates must be positive!"};
+    }
+
+    m_tick = duration_type{1.0 / settings.tick_rate};
+    m_settings.frame_rate_limit = m_pacer.target_rate();  // Negative limits are unlimited
+  }
+
+  /**
+   * \brief Runs the loop until `stop()` is called.
+   *
+   * \tparam Dispatcher the type of the event dispatcher, must provide `poll()`.
+   * \tparam Renderer the type of the renderer, must provide `present()`.
+   * \tparam Update the type of the update function object.
+   * \tparam Render the type of the render function object.
+   *
+   * \param dispatcher the event dispatcher that is polled at the start of every frame.
+   * \param renderer the renderer that is presented at the end of every frame.
+   * \param update invoked with the tick duration, for every simulation update.
+   * \param render invoked with the interpolation factor, once per frame.
+   *
+   * \details On Emscripten, the frames are run by the browser, right before the page is
+   * composited, and this function doesn't return. The stack isn't unwound, so the
+   * arguments, and objects in the calling function, remain valid. The update and render
+   * functions are copied. Once `stop()` is called, the main loop is cancelled after the
+   * current frame. Frame rate limits are implemented by skipping display refreshes, so
+   * they are rounded to an integer fraction of the refresh rate, and the loop never
+   * sleeps, which means that it doesn't rely on Asyncify, regardless of
+   * `hint::emscripten::asyncify`.
+   *
+   * \since 6.1.0
+   */
+  template <typename Dispatcher, typename Renderer, typename Update, typename Render>
+  void run(Dispatcher& dispatcher, Renderer& renderer, Update&& update, Render&& render)
+  {
+    m_running = true;
+    m_last = 0;
+
+#ifdef __EMSCRIPTEN__
+    run_in_browser(dispatcher,
+                   renderer,
+                   std::forward<Update>(update),
+                   std::forward<Render>(render));
+#else
+
+    // Looked up once, since querying the renderer information isn't free. VSync already
+    // limits the frame rate to the refresh rate, so only lower limits are paced with it.
+    double vsyncRate = 0;
+    if (detail::has_vsync(renderer))
+    {
+      const auto rate = screen::refresh_rate();
+      vsyncRate = (rate && *rate > 0) ? static_cast<double>(*rate)
+                                      : std::numeric_limits<double>::infinity();
+    }
+
+    m_pacer.reset();
+
+    while (m_running)
+    {
+      step(dispatcher, renderer, update, render);
+
+      const auto limit = m_pacer.target_rate();
+      if (limit > 0 && (vsyncRate == 0 || limit < vsyncRate))
+      {
+        m_pacer.wait();
+      }
+    }
+#endif  // __EMSCRIPTEN__
+  }
+
+  /**
+   * \brief Runs a single frame of the loop.
+   *
+   * \details This is useful when the application needs to control the loop itself. The
+   * first frame doesn't simulate any time, since there is no previous frame.
+   *
+   * \param dispatcher the event dispatcher that will be polled.
+   * \param renderer the renderer that will be presented.
+   * \param update invoked with the tick duration, for every simulation update.
+   * \param render invoked with the interpolation factor.
+   *
+   * \return the amount of simulation updates that were run.
+   *
+   * \since 6.1.0
+   */
+  template <typename Dispatcher, typename Renderer, typename Update, typename Render>
+  auto step(Dispatcher& dispatcher, Renderer& renderer, Update&& update, Render&& render)
+      -> size_type
+  {
+    static_assert(std::is_invocable_v<Update&, duration_type>,
+                  "The update function must be invocable with the tick duration!");
+    static_assert(std::is_invocable_v<Render&, double>,
+                  "The render function must be invocable with the interpolation factor!");
+
+    CENTURION_PROFILE_SCOPE("game_loop::step");
+
+    const auto now = counter::now();
+
+    duration_type elapsed{0};
+    if (m_last != 0)
+    {
+      elapsed = duration_type{static_cast<double>(now - m_last) / m_frequency};
+      m_stats.record(elapsed);
+    }
+
+    m_last = now;
+
+    dispatcher.poll();
+    const auto updates = advance(elapsed, update);
+
+    render(alpha());
+    renderer.present();
+
+    return updates;
+  }
+
+  /**
+   * \brief Advances the simulation by an amount of time.
+   *
+   * \details The elapsed time is added to the accumulator, and an update is run for
+   * every full tick in the accumulator, up to the maximum amount of updates. If the
+   * limit is hit, the time of the extra ticks is discarded.
+   *
+   * \param elapsed the amount of time to simulate, clamped to the maximum frame time.
+   * \param update invoked with the tick duration, for every simulation update.
+   *
+   * \return the amount of simulation updates that were run.
+   *
+   * \since 6.1.0
+   */
+  template <typename Update>
+  auto advance(duration_type elapsed, Update&& update) -> size_type
+  {
+    if (elapsed > m_settings.max_frame_time)
+    {
+      elapsed = m_settings.max_frame_time;
+    }
+
+    m_accumulator += elapsed.count();
+
+    const auto tick = m_tick.count();
+
+    size_type updates = 0;
+    while (m_accumulator >= tick && updates < m_settings.max_updates)
+    {
+      update(m_tick);
+      m_accumulator -= tick;
+      ++updates;
+    }
+
+    if (m_accumulator >= tick)
+    {
+      m_skipped += static_cast<u64>(m_accumulator / tick);
+      m_accumulator = std::fmod(m_accumulator, tick);
+    }
+
+    m_updates += updates;
+    return updates;
+  }
+
+  /**
+   * \brief Changes the frame rate limit of the loop.
+   *
+   * \details This takes effect from the next frame, also while the loop is running. With
+   * VSync, only limits below the refresh rate of the display have an effect.
+   *
+   * \param rate the maximum frame rate, zero is unlimited.
+   *
+   * \throws cen_error if the rate is negative.
+   *
+   * \since 6.1.0
+   */
+  void set_frame_rate_limit(const double rate)
+  {
+    m_pacer.set_target_rate(rate);
+    m_settings.frame_rate_limit = rate;
+  }
+
+  /**
+   * \brief Stops the loop, after the current frame.
+   *
+   * \since 6.1.0
+   */
+  void stop() noexcept
+  {
+    m_running = false;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the interpolation factor between the two latest simulation states.
+   *
+   * \return the fraction of a tick that is left in the accumulator, in the range [0, 1).
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto alpha() const noexcept -> double
+  {
+    return m_accumulator / m_tick.count();
+  }
+
+  /**
+   * \brief Returns the frame rate limit of the loop.
+   *
+   * \return the maximum frame rate, zero if it's unlimited.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_rate_limit() const noexcept -> double
+  {
+    return m_settings.frame_rate_limit;
+  }
+
+  /**
+   * \brief Returns the duration of a simulation update.
+   *
+   * \return the fixed time step.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto tick_duration() const noexcept -> duration_type
+  {
+    return m_tick;
+  }
+
+  /**
+   * \brief Returns the statistics about the frame times of the loop.
+   *
+   * \return the frame statistics.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto stats() const noexcept -> const frame_stats<>&
+  {
+    return m_stats;
+  }
+
+  /**
+   * \brief Returns the total amount of simulation updates that have been run.
+   *
+   * \return the amount of updates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto total_updates() const noexcept -> u64
+  {
+    return m_updates;
+  }
+
+  /**
+   * \brief Returns the amount of updates that were skipped to avoid falling behind.
+   *
+   * \return the amount of discarded ticks, due to the maximum amount of updates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto skipped_updates() const noexcept -> u64
+  {
+    return m_skipped;
+  }
+
+  /**
+   * \brief Indicates whether or not the loop is running.
+   *
+   * \return `true` if `run()` is active and `stop()` hasn't been called; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_running() const noexcept -> bool
+  {
+    return m_running;
+  }
+
+  /// \} End of queries
+
+ private:
+  game_loop_settings m_settings;
+  duration_type m_tick{};
+  double m_accumulator{};  // In seconds
+  double m_frequency{};
+  u64 m_last{};
+  u64 m_updates{};
+  u64 m_skipped{};
+  frame_pacer m_pacer;
+  frame_stats<> m_stats;
+  bool m_running{};
+
+#ifdef __EMSCRIPTEN__
+
+  template <typename Dispatcher, typename Renderer, typename Update, typename Render>
+  struct browser_frame final
+  {
+    game_loop* loop{};
+    Dispatcher* dispatcher{};
+    Renderer* renderer{};
+    Update update;
+    Render render;
+    double limit{-1};  // The limit that the timing of the main loop is based on
+  };
+
+  template <typename Dispatcher, typename Renderer, typename Update, typename Render>
+  void run_in_browser(Dispatcher& dispatcher,
+                      Renderer& renderer,
+                      Update&& update,
+                      Render&& render)
+  {
+    using frame_type = browser_frame<Dispatcher,
+                                     Renderer,
+                                     std::decay_t<Update>,
+                                     std::decay_t<Render>>;
+
+    // Owned by the main loop, and deleted when it's cancelled
+    auto* frame = new frame_type{this,
+                                 &dispatcher,
+                                 &renderer,
+                                 std::forward<Update>(update),
+                                 std::forward<Render>(render)};
+
+    // A frame rate of zero uses requestAnimationFrame, i.e. the display refresh rate
+    emscripten_set_main_loop_arg(&run_browser_frame<frame_type>, frame, 0, true);
+  }
+
+  template <typename Frame>
+  static void run_browser_frame(void* data)
+  {
+    auto* frame = static_cast<Frame*>(data);
+    auto& loop = *frame->loop;
+
+    // The timing can only be changed once the main loop is running
+    const auto limit = loop.m_pacer.target_rate();
+    if (limit != frame->limit)
+    {
+      const auto rate = screen::refresh_rate();
+      const auto refreshRate = (rate && *rate > 0) ? static_cast<double>(*rate) : 60.0;
+
+      emscripten_set_main_loop_timing(EM_TIMING_RAF,
+                                      detail::swap_interval_for(limit, refreshRate));
+      frame->limit = limit;
+    }
+
+    loop.step(*frame->dispatcher, *frame->renderer, frame->update, frame->render);
+
+    if (!loop.m_running)
+    {
+      emscripten_cancel_main_loop();
+      delete frame;
+    }
+  }
+
+#endif  // __EMSCRIPTEN__
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_GAME_LOOP_HEADER
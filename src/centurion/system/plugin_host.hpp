@@ -0,0 +1,433 @@
+#ifndef CENTURION_PLUGIN_HOST_HEADER
+#define CENTURION_PLUGIN_HOST_HEADER
+
+#include <SDL.h>
+
+#include <array>        // array
+#include <atomic>       // atomic, memory_order_acquire, memory_order_release
+#include <cassert>      // assert
+#include <cstdio>       // remove
+#include <memory>       // unique_ptr, make_unique
+#include <optional>     // optional
+#include <string>       // string, to_string
+#include <type_traits>  // is_pointer_v, is_function_v, remove_pointer_t
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../filesystem/directory_watcher.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/join_path.hpp"
+#include "shared_object.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct plugin_symbol
+ *
+ * \brief Describes how a function of a plugin is stored in its interface.
+ *
+ * \details Symbols are usually created with `bind_plugin_symbol()`.
+ *
+ * \tparam Interface the plugin interface, a struct of function pointers.
+ *
+ * \since 6.1.0
+ */
+template <typename Interface>
+struct plugin_symbol final
+{
+  using function_type = void (*)();
+
+  czstring name{};  ///< The name of the function in the shared object.
+  void (*bind)(Interface&, function_type) noexcept {};  ///< Stores the function.
+};
+
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+struct member_pointer_traits;
+
+template <typename Class, typename Member>
+struct member_pointer_traits<Member Class::*> final
+{
+  using class_type = Class;
+  using member_type = Member;
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Creates a symbol that stores a function of a plugin in an interface member.
+ *
+ * \code{cpp}
+ *   struct game_api final {
+ *     void (*update)(float);
+ *     void (*render)(SDL_Renderer*);
+ *   };
+ *
+ *   const auto update = cen::bind_plugin_symbol<&game_api::update>("game_update");
+ * \endcode
+ *
+ * \tparam Member a pointer to a function pointer member of the interface.
+ *
+ * \param name the name of the C-function in the shared object.
+ *
+ * \return a symbol that stores the function in the member.
+ *
+ * \since 6.1.0
+ */
+template <auto Member>
+[[nodiscard]] auto bind_plugin_symbol(const czstring name) noexcept
+    -> plugin_symbol<typename detail::member_pointer_traits<decltype(Member)>::class_type>
+{
+  using traits = detail::member_pointer_traits<decltype(Member)>;
+  using interface_type = typename traits::class_type;
+  using member_type = typename traits::member_type;
+
+  static_assert(std::is_pointer_v<member_type> &&
+                    std::is_function_v<std::remove_pointer_t<member_type>>,
+                "Plugin interface members must be function pointers!");
+
+  using function_type = typename plugin_symbol<interface_type>::function_type;
+  return {name, [](interface_type& api, const function_type function) noexcept {
+            api.*Member = reinterpret_cast<member_type>(function);
+          }};
+}
+
+/**
+ * \class plugin_host
+ *
+ * \brief Loads a shared object as a plugin, and reloads it when the library changes.
+ *
+ * \details The functions of the plugin are resolved once per load into an interface,
+ * i.e. a struct of function pointers, so calling them is as cheap as calling any other
+ * function pointer, rather than looking up symbols by name.
+ * \code{cpp}
+ *   cen::plugin_host<game_api> game{
+ *       "plugins",
+ *       "game.dll",
+ *       {cen::bind_plugin_symbol<&game_api::update>("game_update"),
+ *        cen::bind_plugin_symbol<&game_api::render>("game_render")}};
+ *
+ *   // Once per frame, between frames
+ *   game.update();
+ *
+ *   game->update(dt);
+ *   game->render(renderer);
+ * \endcode
+ *
+ * \details The plugin directory is watched with a `directory_watcher`, so a rebuilt
+ * library is picked up by `update()` once the linker has finished writing it. Every
+ * generation of the library is loaded from a copy, so that the library can be replaced
+ * while it's loaded, and so that the operating system doesn't return the already loaded
+ * library. If the new library can't be loaded, or lacks any of the functions, the old
+ * interface is kept.
+ *
+ * The new interface is published atomically, so other threads see either the old or
+ * the new interface, never a mix of both. The old library stays loaded until the next
+ * call to `update()`, so functions of the old generation that are still running when a
+ * new one is swapped in can return safely.
+ *
+ * \note Plugins are responsible for their own state, since the data of the old library
+ * is unloaded with it, i.e. state that must survive reloads should be owned by the host.
+ *
+ * \tparam Interface the plugin interface, a struct of function pointers.
+ *
+ * \since 6.1.0
+ */
+template <typename Interface>
+class plugin_host final
+{
+ public:
+  using symbol_type = plugin_symbol<Interface>;
+
+  /**
+   * \brief Loads a plugin.
+   *
+   * \param directory the directory that contains the library.
+   * \param library the file name of the library, e.g. `game.dll`.
+   * \param symbols the functions that are resolved into the interface.
+   * \param watch `true` if the library should be reloaded when it changes.
+   *
+   * \throws cen_error if the library can't be loaded, if any of the functions are
+   * missing, or if the directory can't be watched.
+   *
+   * \since 6.1.0
+   */
+  plugin_host(std::string directory,
+              const std::string& library,
+              std::vector<symbol_type> symbols,
+              const bool watch = true)
+      : m_directory{std::move(directory)}
+      , m_symbols{std::move(symbols)}
+  {
+    if (!m_directory.empty() && !detail::is_path_separator(m_directory.back()))
+    {
+      m_directory += path_separator;
+    }
+
+    m_path = m_directory + library;
+
+    if (watch)
+    {
+      m_watcher.emplace(m_directory, false);
+    }
+
+    if (!reload())
+    {
+      throw cen_error{"Failed to load plugin!"};
+    }
+  }
+
+  plugin_host(const plugin_host&) = delete;
+  plugin_host(plugin_host&&) = delete;
+
+  auto operator=(const plugin_host&) -> plugin_host& = delete;
+  auto operator=(plugin_host&&) -> plugin_host& = delete;
+
+  ~plugin_host() noexcept
+  {
+    unload(m_retired);
+    unload(m_current);
+  }
+
+  /**
+   * \brief Reloads the plugin if its library has changed.
+   *
+   * \details This function should be called once per frame, when no functions of the
+   * plugin are running, since it also unloads the previous generation of the library.
+   *
+   * \return `true` if a new generation of the plugin was loaded; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update() -> bool
+  {
+    unload(m_retired);
+
+    if (!m_watcher)
+    {
+      return false;
+    }
+
+    bool changed = false;
+    m_watcher->poll([&](const file_change& change) {
+      if (change.path == m_path && change.type != file_change_type::removed)
+      {
+        changed = true;
+      }
+    });
+
+    return changed && reload();
+  }
+
+  /**
+   * \brief Loads a new generation of the plugin.
+   *
+   * \details The previous generation stays loaded until the next call to `update()`, or
+   * is unloaded immediately if there already is a previous generation.
+   *
+   * \return `true` if the plugin was loaded; `false` if the library couldn't be loaded
+   * or lacks any of the functions, in which case the old interface is kept.
+   *
+   * \since 6.1.0
+   */
+  auto reload() -> bool
+  {
+    auto next = load(m_generation + 1u);
+    if (!next)
+    {
+      return false;
+    }
+
+    m_table.store(&next->table, std::memory_order_release);
+    ++m_generation;
+
+    unload(m_retired);
+    m_retired = std::move(m_current);
+    m_current = std::move(next);
+
+    return true;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the interface of the current generation of the plugin.
+   *
+   * \details The interface may be read by any thread.
+   *
+   * \return the interface of the plugin.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto api() const noexcept -> const Interface&
+  {
+    return *m_table.load(std::memory_order_acquire);
+  }
+
+  /// \copydoc api()
+  [[nodiscard]] auto operator->() const noexcept -> const Interface*
+  {
+    return m_table.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the number of times that the plugin has been loaded.
+   *
+   * \return the generation of the plugin, starting at 1.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto generation() const noexcept -> u32
+  {
+    return m_generation;
+  }
+
+  /**
+   * \brief Returns the path of the library of the plugin.
+   *
+   * \return the path of the library, prefixed by the directory.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto path() const noexcept -> const std::string&
+  {
+    return m_path;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct loaded_plugin final
+  {
+    shared_object object;
+    std::string copy;  // The copy of the library that is loaded
+    Interface table{};
+  };
+
+  std::string m_directory;
+  std::string m_path;
+  std::vector<symbol_type> m_symbols;
+  std::optional<directory_watcher> m_watcher;
+  std::unique_ptr<loaded_plugin> m_current;
+  std::unique_ptr<loaded_plugin> m_retired;
+  std::atomic<const Interface*> m_table{};
+  u32 m_generation{};
+
+  [[nodiscard]] auto load(const u32 generation) const -> std::unique_ptr<loaded_plugin>
+  {
+    const auto copy = copy_path(generation);
+    if (!copy_file(m_path, copy))
+    {
+      return nullptr;
+    }
+
+    std::unique_ptr<loaded_plugin> plugin;
+    try
+    {
+      plugin = std::make_unique<loaded_plugin>(loaded_plugin{shared_object{copy}, copy});
+    }
+    catch (const sdl_error&)
+    {
+      std::remove(copy.c_str());
+      return nullptr;
+    }
+
+    for (const auto& symbol : m_symbols)
+    {
+      assert(symbol.name);
+      assert(symbol.bind);
+
+      const auto function = plugin->object.template load_function<void()>(symbol.name);
+      if (!function)
+      {
+        unload(plugin);
+        return nullptr;
+      }
+
+      symbol.bind(plugin->table, function);
+    }
+
+    return plugin;
+  }
+
+  // Shared objects must be unloaded before their files can be removed on Windows
+  static void unload(std::unique_ptr<loaded_plugin>& plugin) noexcept
+  {
+    if (plugin)
+    {
+      const auto copy = std::move(plugin->copy);
+      plugin.reset();
+      std::remove(copy.c_str());
+    }
+  }
+
+  // The generation is inserted before the extension, e.g. game.hot2.dll
+  [[nodiscard]] auto copy_path(const u32 generation) const -> std::string
+  {
+    auto dot = m_path.find_last_of('.');
+    if (dot == std::string::npos || dot < m_directory.size())
+    {
+      dot = m_path.size();
+    }
+
+    auto copy = m_path.substr(0, dot);
+    copy += ".hot";
+    copy += std::to_string(generation);
+    copy += m_path.substr(dot);
+
+    return copy;
+  }
+
+  [[nodiscard]] static auto copy_file(const std::string& from, const std::string& to)
+      -> bool
+  {
+    file source{from, file_mode::read_existing_binary};
+    if (!source)
+    {
+      return false;
+    }
+
+    bool copied{};
+
+    {
+      file target{to, file_mode::write_binary};
+      if (target)
+      {
+        std::array<u8, 1u << 16u> buffer;  // NOLINT
+
+        copied = true;
+        while (const auto count = source.read_to(buffer.data(), buffer.size()))
+        {
+          if (target.write(buffer.data(), count) != count)
+          {
+            copied = false;
+            break;
+          }
+        }
+      }
+    }
+
+    if (!copied)
+    {
+      std::remove(to.c_str());
+    }
+
+    return copied;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_PLUGIN_HOST_HEADER
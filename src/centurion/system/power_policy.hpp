@@ -0,0 +1,376 @@
+#ifndef CENTURION_POWER_POLICY_HEADER
+#define CENTURION_POWER_POLICY_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max, min
+#include <cmath>      // lround
+#include <cstddef>    // size_t
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+#include "../thread/thread_pool.hpp"
+#include "../video/dynamic_resolution.hpp"
+#include "battery.hpp"
+#include "counter.hpp"
+#include "game_loop.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct power_policy_settings
+ *
+ * \brief Describes how a `power_policy` throttles the application on battery power.
+ *
+ * \since 6.1.0
+ */
+struct power_policy_settings final
+{
+  seconds<double> poll_interval{5};  ///< The time between battery state queries.
+  double battery_frame_rate{30};     ///< The frame rate limit on battery power.
+  float battery_max_scale{0.75f};    ///< The highest resolution scale on battery power.
+  double battery_workers{0.5};       ///< The fraction of workers that stay active.
+};
+
+/**
+ * \class power_policy
+ *
+ * \brief Throttles the frame rate, resolution and background work when the system runs
+ * on battery power, and restores them when it's plugged in.
+ *
+ * \details The policy queries the battery state at a low frequency, since the query can
+ * be slow on some platforms. When the system switches to battery power, the attached
+ * game loop is limited to a lower frame rate, the highest scale of the attached dynamic
+ * resolution controller is lowered, and some of the workers of the attached thread pool
+ * are parked. The original settings, which are captured when the components are
+ * attached, are restored when the system is plugged in again.
+ * \code{cpp}
+ *   cen::power_policy policy;
+ *   policy.attach(loop);
+ *   policy.attach(resolution);
+ *   policy.attach(pool);
+ *
+ *   // Every frame
+ *   policy.poll();
+ * \endcode
+ *
+ * \note The attached components must outlive the policy, or be detached first.
+ *
+ * \since 6.1.0
+ */
+class power_policy final
+{
+ public:
+  using settings_type = power_policy_settings;
+
+  /**
+   * \brief Creates a power policy without any attached components.
+   *
+   * \details The battery state isn't queried until the first call to `poll()`.
+   *
+   * \param settings the settings that control how the application is throttled.
+   *
+   * \throws cen_error if the settings are invalid.
+   *
+   * \since 6.1.0
+   */
+  explicit power_policy(const settings_type& settings = {})
+      : m_settings{checked_settings(settings)}
+      , m_frequency{static_cast<double>(counter::frequency())}
+  {}
+
+  /// \name Components
+  /// \{
+
+  /**
+   * \brief Attaches a game loop, whose current frame rate limit is the full limit.
+   *
+   * \param loop the game loop that will be throttled.
+   *
+   * \since 6.1.0
+   */
+  void attach(game_loop& loop)
+  {
+    detach_loop();
+
+    m_loop = &loop;
+    m_fullFrameRate = loop.frame_rate_limit();
+    apply_loop();
+  }
+
+  /**
+   * \brief Attaches a dynamic resolution controller, whose current highest scale is the
+   * full scale.
+   *
+   * \param resolution the dynamic resolution controller that will be throttled.
+   *
+   * \since 6.1.0
+   */
+  void attach(dynamic_resolution& resolution)
+  {
+    detach_resolution();
+
+    m_resolution = &resolution;
+    m_fullScale = resolution.settings().max_scale;
+    apply_resolution();
+  }
+
+  /**
+   * \brief Attaches a thread pool, whose current amount of active workers is the full
+   * amount.
+   *
+   * \param pool the thread pool that will be throttled.
+   *
+   * \since 6.1.0
+   */
+  void attach(thread_pool& pool)
+  {
+    detach_pool();
+
+    m_pool = &pool;
+    m_fullWorkers = pool.active_workers();
+    apply_pool();
+  }
+
+  /**
+   * \brief Detaches all components, after restoring their original settings.
+   *
+   * \since 6.1.0
+   */
+  void detach_all()
+  {
+    detach_loop();
+    detach_resolution();
+    detach_pool();
+  }
+
+  /// \} End of components
+
+  /// \name Power state
+  /// \{
+
+  /**
+   * \brief Queries the battery state, if the poll interval has passed since the last
+   * query, and throttles or restores the attached components accordingly.
+   *
+   * \details This function is cheap enough to be called every frame.
+   *
+   * \return `true` if the policy switched between battery and full throughput; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto poll() -> bool
+  {
+    const auto now = counter::now();
+    if (m_lastPoll != 0)
+    {
+      const auto elapsed = static_cast<double>(now - m_lastPoll) / m_frequency;
+      if (elapsed < m_settings.poll_interval.count())
+      {
+        return false;
+      }
+    }
+
+    m_lastPoll = now;
+    return update(battery::state());
+  }
+
+  /**
+   * \brief Throttles or restores the attached components based on a power state.
+   *
+   * \details Only `power_state::on_battery` throttles the components, unknown states
+   * are treated like being plugged in.
+   *
+   * \param state the current power state of the system.
+   *
+   * \return `true` if the policy switched between battery and full throughput; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update(const power_state state) -> bool
+  {
+    const auto onBattery = state == power_state::on_battery;
+    if (onBattery == m_onBattery)
+    {
+      return false;
+    }
+
+    m_onBattery = onBattery;
+
+    apply_loop();
+    apply_resolution();
+    apply_pool();
+
+    return true;
+  }
+
+  /// \} End of power state
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not the attached components are throttled.
+   *
+   * \return `true` if the system was running on battery power when last polled; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_on_battery() const noexcept -> bool
+  {
+    return m_onBattery;
+  }
+
+  /**
+   * \brief Returns the settings of the policy.
+   *
+   * \return the settings that control how the application is throttled.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto settings() const noexcept -> const settings_type&
+  {
+    return m_settings;
+  }
+
+  /// \} End of queries
+
+ private:
+  settings_type m_settings;
+  double m_frequency{};
+  u64 m_lastPoll{};
+  bool m_onBattery{};
+
+  game_loop* m_loop{};
+  double m_fullFrameRate{};
+
+  dynamic_resolution* m_resolution{};
+  float m_fullScale{1};
+
+  thread_pool* m_pool{};
+  std::size_t m_fullWorkers{};
+
+  void apply_loop()
+  {
+    if (!m_loop)
+    {
+      return;
+    }
+
+    if (m_onBattery)
+    {
+      // An unlimited frame rate is zero, so it's replaced instead of kept as the minimum
+      const auto limit = m_settings.battery_frame_rate;
+      const auto full = m_fullFrameRate;
+      m_loop->set_frame_rate_limit((full > 0) ? (std::min)(full, limit) : limit);
+    }
+    else
+    {
+      m_loop->set_frame_rate_limit(m_fullFrameRate);
+    }
+  }
+
+  void apply_resolution()
+  {
+    if (!m_resolution)
+    {
+      return;
+    }
+
+    if (m_onBattery)
+    {
+      const auto minScale = m_resolution->settings().min_scale;
+      const auto scale = (std::min)(m_fullScale, m_settings.battery_max_scale);
+      m_resolution->set_max_scale((std::max)(minScale, scale));
+    }
+    else
+    {
+      m_resolution->set_max_scale(m_fullScale);
+    }
+  }
+
+  void apply_pool()
+  {
+    if (!m_pool)
+    {
+      return;
+    }
+
+    if (m_onBattery)
+    {
+      const auto workers = static_cast<double>(m_fullWorkers);
+      const auto active = std::lround(workers * m_settings.battery_workers);
+      m_pool->set_active_workers(static_cast<std::size_t>(active));
+    }
+    else
+    {
+      m_pool->set_active_workers(m_fullWorkers);
+    }
+  }
+
+  void detach_loop()
+  {
+    if (m_loop)
+    {
+      m_loop->set_frame_rate_limit(m_fullFrameRate);
+      m_loop = nullptr;
+    }
+  }
+
+  void detach_resolution()
+  {
+    if (m_resolution)
+    {
+      m_resolution->set_max_scale(m_fullScale);
+      m_resolution = nullptr;
+    }
+  }
+
+  void detach_pool()
+  {
+    if (m_pool)
+    {
+      m_pool->set_active_workers(m_fullWorkers);
+      m_pool = nullptr;
+    }
+  }
+
+  [[nodiscard]] static auto checked_settings(const settings_type& settings)
+      -> const settings_type&
+  {
+    if (settings.poll_interval.count() < 0)
+    {
+      throw cen_error{"Invalid power policy poll interval!"};
+    }
+
+    if (settings.battery_frame_rate <= 0)
+    {
+      throw cen_error{"Invalid power policy frame rate!"};
+    }
+
+    if (settings.battery_max_scale <= 0 || settings.battery_max_scale > 1)
+    {
+      throw cen_error{"Invalid power policy resolution scale!"};
+    }
+
+    if (settings.battery_workers <= 0 || settings.battery_workers > 1)
+    {
+      throw cen_error{"Invalid power policy worker fraction!"};
+    }
+
+    return settings;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_POWER_POLICY_HEADER
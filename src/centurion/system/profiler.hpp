@@ -0,0 +1,731 @@
+#ifndef CENTURION_PROFILER_HEADER
+#define CENTURION_PROFILER_HEADER
+
+#include <SDL.h>
+
+#include <atomic>   // atomic, memory_order_...
+#include <cstddef>  // size_t
+#include <memory>   // unique_ptr, make_unique
+#include <vector>   // vector
+
+#include "../core/czstring.hpp"
+#include "../core/integers.hpp"
+#include "../detail/czstring_eq.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/spin_mutex.hpp"
+#include "counter.hpp"
+
+#ifdef CENTURION_USE_TRACY
+#include <tracy/Tracy.hpp>
+#endif  // CENTURION_USE_TRACY
+
+/**
+ * \def CENTURION_PROFILE_SCOPE
+ *
+ * \brief Records the time spent in the enclosing scope, under the specified name.
+ *
+ * \details Scopes nest, so the profiler can attribute time to the scopes that enclose
+ * them. The name must be a string with static storage duration, e.g. a string literal.
+ * \code{cpp}
+ *   void update_physics()
+ *   {
+ *     CENTURION_PROFILE_SCOPE("physics");
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note This macro expands to nothing unless `CENTURION_ENABLE_PROFILER` is defined.
+ *
+ * \note If `CENTURION_USE_TRACY` is defined, the scope is also streamed to the Tracy
+ * profiler as a zone, in which case the name must be a string literal. The Tracy client
+ * headers must be available as `<tracy/Tracy.hpp>`.
+ *
+ * \since 6.1.0
+ */
+
+/// \cond FALSE
+#define CENTURION_DETAIL_PROFILE_CONCAT_IMPL(a, b) a##b
+#define CENTURION_DETAIL_PROFILE_CONCAT(a, b) CENTURION_DETAIL_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef CENTURION_ENABLE_PROFILER
+#define CENTURION_DETAIL_PROFILE_SCOPE(name)                         \
+  const cen::detail::profile_scope CENTURION_DETAIL_PROFILE_CONCAT( \
+      centurion_profile_scope_,                                     \
+      __LINE__)                                                     \
+  {                                                                 \
+    name                                                            \
+  }
+#else
+#define CENTURION_DETAIL_PROFILE_SCOPE(name) static_cast<void>(0)
+#endif  // CENTURION_ENABLE_PROFILER
+
+#ifdef CENTURION_USE_TRACY
+#define CENTURION_DETAIL_TRACY_ZONE(name) ZoneScopedN(name)
+#define CENTURION_DETAIL_TRACY_FRAME() FrameMark
+#else
+#define CENTURION_DETAIL_TRACY_ZONE(name) static_cast<void>(0)
+#define CENTURION_DETAIL_TRACY_FRAME() static_cast<void>(0)
+#endif  // CENTURION_USE_TRACY
+/// \endcond
+
+#define CENTURION_PROFILE_SCOPE(name) \
+  CENTURION_DETAIL_TRACY_ZONE(name);  \
+  CENTURION_DETAIL_PROFILE_SCOPE(name)
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/// \cond FALSE
+namespace detail {
+class profiler_state;
+}  // namespace detail
+/// \endcond
+
+/**
+ * \enum profile_event_type
+ *
+ * \brief Indicates whether a profiler event marks the beginning or the end of a scope.
+ *
+ * \since 6.1.0
+ */
+enum class profile_event_type : u8
+{
+  begin,  ///< A scope was entered.
+  end     ///< The most recently entered scope was left.
+};
+
+/**
+ * \struct profile_event
+ *
+ * \brief A timestamp recorded by `CENTURION_PROFILE_SCOPE`.
+ *
+ * \since 6.1.0
+ */
+struct profile_event final
+{
+  czstring name{};           ///< The name of the scope.
+  u64 time{};                ///< The value of `counter::monotonic()` when it occurred.
+  profile_event_type type{};  ///< Whether a scope was entered or left.
+};
+
+/**
+ * \struct profile_node
+ *
+ * \brief The aggregated timings of a scope, for a single path in the scope hierarchy.
+ *
+ * \since 6.1.0
+ */
+struct profile_node final
+{
+  /// The parent index of root scopes.
+  inline constexpr static std::size_t npos = static_cast<std::size_t>(-1);
+
+  czstring name{};           ///< The name of the scope.
+  u64 nanoseconds{};         ///< The total time spent in the scope, in nanoseconds.
+  u32 calls{};               ///< The amount of times that the scope was entered.
+  u32 depth{};               ///< The amount of enclosing scopes.
+  std::size_t parent{npos};  ///< The index of the enclosing scope.
+  std::size_t thread{};      ///< The index of the thread in the frame.
+};
+
+/**
+ * \struct profile_thread
+ *
+ * \brief The profiler events recorded by a single thread during a frame.
+ *
+ * \since 6.1.0
+ */
+struct profile_thread final
+{
+  SDL_threadID id{};                  ///< The identifier of the thread.
+  std::vector<profile_event> events;  ///< The events, in the order they occurred.
+};
+
+/**
+ * \class profile_frame
+ *
+ * \brief The profiler data collected during a single frame.
+ *
+ * \details The nodes form a tree for each thread, stored in depth-first order. Scopes
+ * that are entered several times from the same enclosing scope share a node. Scopes that
+ * are still open at the end of a frame only contribute the time spent during the frame.
+ *
+ * \since 6.1.0
+ *
+ * \see `profiler::end_frame()`
+ */
+class profile_frame final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Returns the index of the frame.
+   *
+   * \return the amount of frames that were collected before this one.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto index() const noexcept -> u64
+  {
+    return m_index;
+  }
+
+  /**
+   * \brief Returns the time when the frame started.
+   *
+   * \return the value of `counter::monotonic()` at the end of the previous frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto begin_time() const noexcept -> u64
+  {
+    return m_begin;
+  }
+
+  /**
+   * \brief Returns the time when the frame ended.
+   *
+   * \return the value of `counter::monotonic()` when the frame was collected.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto end_time() const noexcept -> u64
+  {
+    return m_end;
+  }
+
+  /**
+   * \brief Returns the aggregated scopes of the frame.
+   *
+   * \return the scopes of all threads, in depth-first order.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto nodes() const noexcept -> const std::vector<profile_node>&
+  {
+    return m_nodes;
+  }
+
+  /**
+   * \brief Returns the raw events of the frame, for every thread that recorded events.
+   *
+   * \return the threads that recorded events.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto threads() const noexcept -> const std::vector<profile_thread>&
+  {
+    return m_threads;
+  }
+
+  /**
+   * \brief Returns the first node with the specified name.
+   *
+   * \param name the name of the scope.
+   *
+   * \return a pointer to the node; a null pointer if there is no such node.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find(const czstring name) const noexcept -> const profile_node*
+  {
+    for (const auto& node : m_nodes)
+    {
+      if (node.name == name || detail::czstring_eq(node.name, name))
+      {
+        return &node;
+      }
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * \brief Converts a duration in nanoseconds to seconds.
+   *
+   * \param duration the duration, in nanoseconds.
+   *
+   * \return the duration, in seconds.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto to_seconds(const u64 duration) noexcept -> double
+  {
+    return static_cast<double>(duration) / 1'000'000'000.0;
+  }
+
+ private:
+  friend class detail::profiler_state;
+
+  std::vector<profile_node> m_nodes;
+  std::vector<profile_thread> m_threads;
+  u64 m_index{};
+  u64 m_begin{};
+  u64 m_end{};
+};
+
+/// \cond FALSE
+namespace detail {
+
+// The amount of events in the buffer of each thread, must be a power of two
+inline constexpr std::size_t profile_buffer_size = 8'192;
+
+/*
+ * The events of a single thread. The thread is the only writer of the head index, and the
+ * collector is the only writer of the tail index, so recording an event only takes a
+ * couple of atomic loads and stores. A scope is only recorded if there is room for its
+ * end event, along with the end events of all enclosing scopes, so the recorded events
+ * are always balanced.
+ */
+struct profile_buffer final
+{
+  SDL_threadID id{};
+  std::unique_ptr<profile_event[]> events{new profile_event[profile_buffer_size]};
+  std::atomic<std::size_t> head{0};
+  std::atomic<std::size_t> tail{0};
+  std::atomic<u64> dropped{0};
+  std::atomic<bool> retired{false};
+  std::size_t open{0};  // Only used by the owning thread
+
+  // The scopes that were still open at the end of the previous frame
+  std::vector<czstring> pending;
+
+  auto begin(const czstring name) noexcept -> bool
+  {
+    const auto h = head.load(std::memory_order_relaxed);
+    const auto free = profile_buffer_size - (h - tail.load(std::memory_order_acquire));
+
+    if (free < open + 2u)
+    {
+      dropped.store(dropped.load(std::memory_order_relaxed) + 1u,
+                    std::memory_order_relaxed);
+      return false;
+    }
+
+    const auto slot = h & (profile_buffer_size - 1u);
+    events[slot] = {name, counter::monotonic().count(), profile_event_type::begin};
+    head.store(h + 1u, std::memory_order_release);
+    ++open;
+
+    return true;
+  }
+
+  void end(const czstring name) noexcept
+  {
+    const auto time = counter::monotonic().count();
+    const auto h = head.load(std::memory_order_relaxed);
+
+    events[h & (profile_buffer_size - 1u)] = {name, time, profile_event_type::end};
+    head.store(h + 1u, std::memory_order_release);
+    --open;
+  }
+};
+
+class profiler_state final
+{
+ public:
+  [[nodiscard]] static auto get() -> profiler_state&
+  {
+    static profiler_state state;
+    return state;
+  }
+
+  // Called once by every thread that records events
+  [[nodiscard]] auto add_buffer() -> profile_buffer*
+  {
+    auto buffer = std::make_unique<profile_buffer>();
+    buffer->id = SDL_ThreadID();
+
+    scoped_lock lock{m_mutex};
+    m_buffers.push_back(std::move(buffer));
+
+    return m_buffers.back().get();
+  }
+
+  auto end_frame() -> const profile_frame&;
+
+  [[nodiscard]] auto last_frame() const noexcept -> const profile_frame&
+  {
+    return m_frame;
+  }
+
+  [[nodiscard]] auto dropped() -> u64
+  {
+    scoped_lock lock{m_mutex};
+
+    auto total = m_droppedRetired;
+    for (const auto& buffer : m_buffers)
+    {
+      total += buffer->dropped.load(std::memory_order_relaxed);
+    }
+
+    return total;
+  }
+
+ private:
+  struct build_node final
+  {
+    czstring name{};
+    u64 nanoseconds{};
+    u32 calls{};
+    std::size_t firstChild{profile_node::npos};
+    std::size_t nextSibling{profile_node::npos};
+  };
+
+  struct open_scope final
+  {
+    std::size_t node{};
+    u64 begin{};
+  };
+
+  spin_mutex m_mutex;
+  std::vector<std::unique_ptr<profile_buffer>> m_buffers;
+  profile_frame m_frame;
+  u64 m_droppedRetired{};
+  u64 m_frameIndex{};
+  u64 m_frameBegin{counter::monotonic().count()};
+
+  // Scratch storage, kept between frames to avoid allocations
+  std::vector<build_node> m_tree;
+  std::vector<open_scope> m_stack;
+  std::vector<std::size_t> m_roots;
+
+  profiler_state() = default;
+
+  void collect(profile_buffer& buffer, std::size_t thread, u64 now);
+
+  auto child(std::size_t parent, czstring name) -> std::size_t;
+
+  void flatten(std::size_t node, u32 depth, std::size_t parent, std::size_t thread);
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \namespace cen::profiler
+ *
+ * \brief Provides access to the data recorded by `CENTURION_PROFILE_SCOPE`.
+ *
+ * \details Every thread records its events into a buffer of its own, without any locks.
+ * Once per frame, one thread collects the events of all threads and aggregates them.
+ * \code{cpp}
+ *   // At the end of every frame
+ *   const auto& frame = cen::profiler::end_frame();
+ *   for (const auto& node : frame.nodes()) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+namespace profiler {
+
+/**
+ * \brief Indicates whether or not the profiler macros are enabled.
+ *
+ * \return `true` if `CENTURION_ENABLE_PROFILER` is defined; `false` otherwise.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] constexpr auto is_enabled() noexcept -> bool
+{
+#ifdef CENTURION_ENABLE_PROFILER
+  return true;
+#else
+  return false;
+#endif  // CENTURION_ENABLE_PROFILER
+}
+
+/**
+ * \brief Collects the events recorded since the previous frame, and aggregates them.
+ *
+ * \note This function should only be called by a single thread, e.g. the main thread.
+ * If `CENTURION_USE_TRACY` is defined, this function also marks the end of the frame
+ * for Tracy.
+ *
+ * \return the collected frame, which stays valid until the next call.
+ *
+ * \since 6.1.0
+ */
+inline auto end_frame() -> const profile_frame&
+{
+  CENTURION_DETAIL_TRACY_FRAME();
+  return detail::profiler_state::get().end_frame();
+}
+
+/**
+ * \brief Returns the most recently collected frame.
+ *
+ * \return the last frame returned by `end_frame()`.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto last_frame() -> const profile_frame&
+{
+  return detail::profiler_state::get().last_frame();
+}
+
+/**
+ * \brief Returns the amount of scopes that weren't recorded due to full buffers.
+ *
+ * \details Scopes are dropped if a thread records more events than fit in its buffer
+ * between two frames.
+ *
+ * \return the total amount of dropped scopes.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto dropped_scopes() -> u64
+{
+  return detail::profiler_state::get().dropped();
+}
+
+}  // namespace profiler
+
+/// \cond FALSE
+namespace detail {
+
+inline auto profiler_state::end_frame() -> const profile_frame&
+{
+  const auto now = counter::monotonic().count();
+
+  scoped_lock lock{m_mutex};
+
+  m_frame.m_nodes.clear();
+  m_frame.m_threads.resize(m_buffers.size());
+  m_frame.m_index = m_frameIndex++;
+  m_frame.m_begin = m_frameBegin;
+  m_frame.m_end = now;
+
+  for (std::size_t index = 0; index < m_buffers.size(); ++index)
+  {
+    collect(*m_buffers[index], index, now);
+  }
+
+  // Buffers of threads that have exited are released once they have been drained
+  for (std::size_t index = m_buffers.size(); index-- > 0;)
+  {
+    auto& buffer = *m_buffers[index];
+    if (buffer.retired.load(std::memory_order_acquire) &&
+        buffer.head.load(std::memory_order_acquire) ==
+            buffer.tail.load(std::memory_order_relaxed))
+    {
+      m_droppedRetired += buffer.dropped.load(std::memory_order_relaxed);
+      m_buffers.erase(m_buffers.begin() + static_cast<std::ptrdiff_t>(index));
+    }
+  }
+
+  m_frameBegin = now;
+  return m_frame;
+}
+
+inline void profiler_state::collect(profile_buffer& buffer,
+                                    const std::size_t thread,
+                                    const u64 now)
+{
+  auto& record = m_frame.m_threads[thread];
+  record.id = buffer.id;
+  record.events.clear();
+
+  m_tree.clear();
+  m_stack.clear();
+  m_roots.clear();
+
+  // Scopes that were open at the end of the previous frame continue from its end
+  for (const auto name : buffer.pending)
+  {
+    const auto parent = m_stack.empty() ? profile_node::npos : m_stack.back().node;
+    m_stack.push_back(open_scope{child(parent, name), m_frame.begin_time()});
+  }
+
+  const auto head = buffer.head.load(std::memory_order_acquire);
+  for (auto position = buffer.tail.load(std::memory_order_relaxed); position != head;
+       ++position)
+  {
+    const auto& event = buffer.events[position & (profile_buffer_size - 1u)];
+    record.events.push_back(event);
+
+    if (event.type == profile_event_type::begin)
+    {
+      const auto parent = m_stack.empty() ? profile_node::npos : m_stack.back().node;
+      const auto node = child(parent, event.name);
+
+      ++m_tree[node].calls;
+      m_stack.push_back(open_scope{node, event.time});
+    }
+    else if (!m_stack.empty())
+    {
+      const auto& scope = m_stack.back();
+      if (event.time > scope.begin)
+      {
+        m_tree[scope.node].nanoseconds += event.time - scope.begin;
+      }
+
+      m_stack.pop_back();
+    }
+  }
+
+  buffer.tail.store(head, std::memory_order_release);
+
+  buffer.pending.clear();
+  for (const auto& scope : m_stack)
+  {
+    if (now > scope.begin)
+    {
+      m_tree[scope.node].nanoseconds += now - scope.begin;
+    }
+
+    buffer.pending.push_back(m_tree[scope.node].name);
+  }
+
+  for (const auto root : m_roots)
+  {
+    flatten(root, 0, profile_node::npos, thread);
+  }
+}
+
+inline auto profiler_state::child(const std::size_t parent, const czstring name)
+    -> std::size_t
+{
+  auto first = (parent == profile_node::npos) ? profile_node::npos
+                                              : m_tree[parent].firstChild;
+
+  // Scope names are usually literals, so the pointers are compared before the contents
+  if (parent == profile_node::npos)
+  {
+    for (const auto root : m_roots)
+    {
+      if (m_tree[root].name == name || czstring_eq(m_tree[root].name, name))
+      {
+        return root;
+      }
+    }
+  }
+  else
+  {
+    for (auto node = first; node != profile_node::npos; node = m_tree[node].nextSibling)
+    {
+      if (m_tree[node].name == name || czstring_eq(m_tree[node].name, name))
+      {
+        return node;
+      }
+    }
+  }
+
+  const auto index = m_tree.size();
+  m_tree.push_back(build_node{name});
+
+  if (parent == profile_node::npos)
+  {
+    m_roots.push_back(index);
+  }
+  else
+  {
+    // Children are prepended, flatten() restores the order in which they were entered
+    m_tree[index].nextSibling = first;
+    m_tree[parent].firstChild = index;
+  }
+
+  return index;
+}
+
+inline void profiler_state::flatten(const std::size_t node,
+                                    const u32 depth,
+                                    const std::size_t parent,
+                                    const std::size_t thread)
+{
+  const auto& source = m_tree[node];
+  const auto index = m_frame.m_nodes.size();
+
+  m_frame.m_nodes.push_back(
+      profile_node{source.name, source.nanoseconds, source.calls, depth, parent, thread});
+
+  // The children are linked in reverse order
+  const auto count = m_stack.size();
+  for (auto c = source.firstChild; c != profile_node::npos; c = m_tree[c].nextSibling)
+  {
+    m_stack.push_back(open_scope{c, 0});
+  }
+
+  while (m_stack.size() > count)
+  {
+    const auto next = m_stack.back().node;
+    m_stack.pop_back();
+    flatten(next, depth + 1u, index, thread);
+  }
+}
+
+// Retires the buffer of a thread when the thread exits
+struct profile_thread_slot final
+{
+  profile_buffer* buffer{};
+
+  ~profile_thread_slot() noexcept
+  {
+    if (buffer)
+    {
+      buffer->retired.store(true, std::memory_order_release);
+    }
+  }
+};
+
+// Returns the buffer of the calling thread, or null if it couldn't be allocated
+[[nodiscard]] inline auto local_profile_buffer() noexcept -> profile_buffer*
+{
+  thread_local profile_thread_slot slot;
+  if (!slot.buffer)
+  {
+    try
+    {
+      slot.buffer = profiler_state::get().add_buffer();
+    }
+    catch (...)
+    {
+      return nullptr;
+    }
+  }
+
+  return slot.buffer;
+}
+
+class profile_scope final
+{
+ public:
+  explicit profile_scope(const czstring name) noexcept : m_name{name}
+  {
+    auto* buffer = local_profile_buffer();
+    if (buffer && buffer->begin(name))
+    {
+      m_buffer = buffer;
+    }
+  }
+
+  profile_scope(const profile_scope&) = delete;
+
+  auto operator=(const profile_scope&) -> profile_scope& = delete;
+
+  ~profile_scope() noexcept
+  {
+    if (m_buffer)
+    {
+      m_buffer->end(m_name);
+    }
+  }
+
+ private:
+  profile_buffer* m_buffer{};
+  czstring m_name{};
+};
+
+}  // namespace detail
+/// \endcond
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_PROFILER_HEADER
@@ -0,0 +1,615 @@
+#ifndef CENTURION_SIMD_VECTOR_HEADER
+#define CENTURION_SIMD_VECTOR_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>         // fill, max
+#include <cassert>           // assert
+#include <cstddef>           // size_t
+#include <cstdint>           // uintptr_t
+#include <initializer_list>  // initializer_list
+#include <limits>            // numeric_limits
+#include <type_traits>       // is_trivially_copyable_v, is_convertible_v, ...
+#include <utility>           // move, exchange
+
+#include "../core/exception.hpp"
+#include "cpu.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \class simd_span
+ *
+ * \brief A non-owning view of a contiguous sequence of elements, intended to be passed to
+ * SIMD kernels.
+ *
+ * \details Unlike `std::span`, which isn't available in C++17, the span can report
+ * whether or not its data is aligned for SIMD instructions on the current CPU.
+ *
+ * \tparam T the type of the elements, can be const-qualified.
+ *
+ * \see `simd_vector`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class simd_span final
+{
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using size_type = std::size_t;
+  using iterator = T*;
+
+  /**
+   * \brief Creates an empty span.
+   *
+   * \since 6.1.0
+   */
+  constexpr simd_span() noexcept = default;
+
+  /**
+   * \brief Creates a span of a sequence of elements.
+   *
+   * \param data a pointer to the first element, can be null if the size is zero.
+   * \param size the amount of elements.
+   *
+   * \since 6.1.0
+   */
+  constexpr simd_span(T* data, const size_type size) noexcept : m_data{data}, m_size{size}
+  {
+    assert(data || size == 0);
+  }
+
+  /**
+   * \brief Creates a span from a span of compatible elements, e.g. a span of `const T`
+   * from a span of `T`.
+   *
+   * \tparam U the type of the elements of the other span.
+   *
+   * \param other the span that will be copied.
+   *
+   * \since 6.1.0
+   */
+  template <typename U,
+            std::enable_if_t<std::is_convertible_v<U (*)[], T (*)[]>, int> = 0>
+  constexpr simd_span(const simd_span<U>& other) noexcept  // NOLINT implicit
+      : m_data{other.data()}
+      , m_size{other.size()}
+  {}
+
+  /**
+   * \brief Returns a span of a subset of the elements.
+   *
+   * \pre `offset` must not be greater than the size of the span.
+   *
+   * \param offset the index of the first element of the subset.
+   * \param count the maximum amount of elements in the subset.
+   *
+   * \return a span of at most `count` elements, starting at `offset`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto subspan(
+      const size_type offset,
+      const size_type count = (std::numeric_limits<size_type>::max)()) const noexcept
+      -> simd_span
+  {
+    assert(offset <= m_size);
+    const auto remaining = m_size - offset;
+    return {m_data + offset, (count < remaining) ? count : remaining};
+  }
+
+  /**
+   * \brief Returns the element at an index.
+   *
+   * \pre `index` must be less than the size of the span.
+   *
+   * \param index the index of the element.
+   *
+   * \return a reference to the element.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto operator[](const size_type index) const noexcept -> T&
+  {
+    assert(index < m_size);
+    return m_data[index];
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a pointer to the first element.
+   *
+   * \return a pointer to the elements; null for default-constructed spans.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto data() const noexcept -> T*
+  {
+    return m_data;
+  }
+
+  /**
+   * \brief Returns the amount of elements.
+   *
+   * \return the size of the span.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the size of the elements, in bytes.
+   *
+   * \return the amount of bytes that are viewed by the span.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto size_bytes() const noexcept -> size_type
+  {
+    return m_size * sizeof(T);
+  }
+
+  /**
+   * \brief Indicates whether or not the span has no elements.
+   *
+   * \return `true` if the span is empty; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Indicates whether or not the first element is suitably aligned for SIMD
+   * instructions on the current CPU.
+   *
+   * \return `true` if the data is aligned to `cpu::simd_alignment()`; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_aligned() const noexcept -> bool
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(m_data);
+    return address % cpu::simd_alignment() == 0;
+  }
+
+  /// \} End of queries
+
+  /// \name Iteration
+  /// \{
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> iterator
+  {
+    return m_data;
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> iterator
+  {
+    return m_data + m_size;
+  }
+
+  /// \} End of iteration
+
+ private:
+  T* m_data{};
+  size_type m_size{};
+};
+
+/**
+ * \class simd_vector
+ *
+ * \brief A growable array of trivially copyable elements, stored in SIMD-friendly memory.
+ *
+ * \details The elements are stored in a `simd_block`, so the first element is aligned to
+ * `cpu::simd_alignment()`. Every allocation is followed by at least
+ * `cpu::simd_alignment()` bytes of zeroed padding, so kernels may load a full vector
+ * starting at any element, e.g. the last one, without reading past the allocation. The
+ * values of padding bytes and of unused capacity are otherwise unspecified.
+ * \code{cpp}
+ *   cen::simd_vector<float> xs(count);
+ *   process(xs.data(), xs.size());  // Aligned loads are fine here
+ * \endcode
+ *
+ * \tparam T the type of the elements, must be trivially copyable and destructible.
+ *
+ * \see `simd_block`
+ * \see `simd_span`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class simd_vector final
+{
+  static_assert(std::is_trivially_copyable_v<T>, "Elements must be trivially copyable!");
+  static_assert(std::is_trivially_destructible_v<T>,
+                "Elements must be trivially destructible!");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty vector, without allocating any memory.
+   *
+   * \since 6.1.0
+   */
+  simd_vector() noexcept = default;
+
+  /**
+   * \brief Creates a vector of value-initialized elements.
+   *
+   * \param size the amount of elements.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  explicit simd_vector(const size_type size)
+  {
+    resize(size);
+  }
+
+  /**
+   * \brief Creates a vector of copies of a value.
+   *
+   * \param size the amount of elements.
+   * \param value the value of the elements.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  simd_vector(const size_type size, const T& value)
+  {
+    resize(size, value);
+  }
+
+  /**
+   * \brief Creates a vector from a list of values.
+   *
+   * \param values the values of the elements.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  simd_vector(const std::initializer_list<T> values)
+  {
+    assign(values.begin(), values.size());
+  }
+
+  simd_vector(const simd_vector& other)
+  {
+    assign(other.data(), other.size());
+  }
+
+  simd_vector(simd_vector&& other) noexcept
+      : m_block{std::move(other.m_block)}
+      , m_size{std::exchange(other.m_size, 0)}
+      , m_capacity{std::exchange(other.m_capacity, 0)}
+  {}
+
+  /// \} End of construction
+
+  auto operator=(const simd_vector& other) -> simd_vector&
+  {
+    if (this != &other)
+    {
+      assign(other.data(), other.size());
+    }
+
+    return *this;
+  }
+
+  auto operator=(simd_vector&& other) noexcept -> simd_vector&
+  {
+    if (this != &other)
+    {
+      m_block = std::move(other.m_block);
+      m_size = std::exchange(other.m_size, 0);
+      m_capacity = std::exchange(other.m_capacity, 0);
+    }
+
+    return *this;
+  }
+
+  /**
+   * \brief Replaces the elements with copies of a sequence of values.
+   *
+   * \param values the values, must not refer to the elements of the vector.
+   * \param count the amount of values.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  void assign(const T* values, const size_type count)
+  {
+    assert(values || count == 0);
+
+    reserve(count);
+    if (count != 0)
+    {
+      SDL_memcpy(data(), values, count * sizeof(T));
+    }
+
+    m_size = count;
+  }
+
+  /**
+   * \brief Adds an element to the end of the vector.
+   *
+   * \param value the value of the element.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  void push_back(const T& value)
+  {
+    if (m_size == m_capacity)
+    {
+      // The value might be an element, which is invalidated by the reallocation
+      const auto copy = value;
+      reallocate(std::max<size_type>(8, m_capacity * 2));
+      data()[m_size++] = copy;
+    }
+    else
+    {
+      data()[m_size++] = value;
+    }
+  }
+
+  /**
+   * \brief Removes the last element.
+   *
+   * \pre The vector must not be empty.
+   *
+   * \since 6.1.0
+   */
+  void pop_back() noexcept
+  {
+    assert(!empty());
+    --m_size;
+  }
+
+  /**
+   * \brief Changes the amount of elements, new elements are value-initialized.
+   *
+   * \param size the new amount of elements.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  void resize(const size_type size)
+  {
+    resize(size, T{});
+  }
+
+  /**
+   * \brief Changes the amount of elements, new elements are copies of a value.
+   *
+   * \param size the new amount of elements.
+   * \param value the value of new elements.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  void resize(const size_type size, const T& value)
+  {
+    if (size > m_size)
+    {
+      const auto copy = value;
+      reserve(size);
+      std::fill(data() + m_size, data() + size, copy);
+    }
+
+    m_size = size;
+  }
+
+  /**
+   * \brief Ensures that the vector can hold an amount of elements without reallocating.
+   *
+   * \param capacity the minimum capacity.
+   *
+   * \throws sdl_error if the memory couldn't be allocated.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    if (capacity > m_capacity)
+    {
+      reallocate(capacity);
+    }
+  }
+
+  /**
+   * \brief Removes all elements, the capacity is preserved.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_size = 0;
+  }
+
+  /**
+   * \brief Returns the element at an index.
+   *
+   * \pre `index` must be less than the size of the vector.
+   *
+   * \param index the index of the element.
+   *
+   * \return a reference to the element.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) noexcept -> T&
+  {
+    assert(index < m_size);
+    return data()[index];
+  }
+
+  /// \copydoc operator[]()
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> const T&
+  {
+    assert(index < m_size);
+    return data()[index];
+  }
+
+  /**
+   * \brief Returns a span of the elements.
+   *
+   * \return a span that is invalidated when the vector reallocates.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto span() noexcept -> simd_span<T>
+  {
+    return {data(), m_size};
+  }
+
+  /// \copydoc span()
+  [[nodiscard]] auto span() const noexcept -> simd_span<const T>
+  {
+    return {data(), m_size};
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a pointer to the first element.
+   *
+   * \return a pointer to the elements; null if no memory has been allocated.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() noexcept -> T*
+  {
+    return m_block.template cast_data<T>();
+  }
+
+  /// \copydoc data()
+  [[nodiscard]] auto data() const noexcept -> const T*
+  {
+    return m_block.template cast_data<T>();
+  }
+
+  /**
+   * \brief Returns the amount of elements.
+   *
+   * \return the size of the vector.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the amount of elements that fit in the allocated memory.
+   *
+   * \return the capacity of the vector, excluding the padding.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Indicates whether or not the vector has no elements.
+   *
+   * \return `true` if the vector is empty; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /// \} End of queries
+
+  /// \name Iteration
+  /// \{
+
+  [[nodiscard]] auto begin() noexcept -> iterator
+  {
+    return data();
+  }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator
+  {
+    return data();
+  }
+
+  [[nodiscard]] auto end() noexcept -> iterator
+  {
+    return data() + m_size;
+  }
+
+  [[nodiscard]] auto end() const noexcept -> const_iterator
+  {
+    return data() + m_size;
+  }
+
+  /// \} End of iteration
+
+ private:
+  simd_block m_block;
+  size_type m_size{};
+  size_type m_capacity{};
+
+  void reallocate(const size_type capacity)
+  {
+    const auto padding = cpu::simd_alignment();
+    assert(capacity <= ((std::numeric_limits<size_type>::max)() - padding) / sizeof(T));
+
+    const auto bytes = capacity * sizeof(T);
+    simd_block block{bytes + padding};
+    if (!block)
+    {
+      throw sdl_error{};
+    }
+
+    if (m_size != 0)
+    {
+      SDL_memcpy(block.data(), data(), m_size * sizeof(T));
+    }
+
+    SDL_memset(block.cast_data<unsigned char>() + bytes, 0, padding);
+
+    m_block = std::move(block);
+    m_capacity = capacity;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_SIMD_VECTOR_HEADER
@@ -0,0 +1,640 @@
+#ifndef CENTURION_TIMER_WHEEL_HEADER
+#define CENTURION_TIMER_WHEEL_HEADER
+
+#include <algorithm>    // max, min
+#include <array>        // array
+#include <cmath>        // ceil, floor
+#include <cstddef>      // size_t
+#include <functional>   // function
+#include <type_traits>  // is_invocable_v
+#include <utility>      // forward, move
+#include <vector>       // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/time.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/**
+ * \struct timer_handle
+ *
+ * \brief A handle to a timer that is scheduled in a `timer_wheel`.
+ *
+ * \details Handles are small values that can be copied freely. Every timer slot has a
+ * generation, which is incremented when its timer expires or is cancelled, so stale
+ * handles never refer to timers that reuse the slot.
+ *
+ * \since 6.1.0
+ */
+struct timer_handle final
+{
+  u32 index{};       ///< The index of the timer slot.
+  u32 generation{};  ///< The generation of the slot, zero for invalid handles.
+
+  /**
+   * \brief Indicates whether or not the handle was obtained from a timer wheel.
+   *
+   * \note This doesn't indicate whether or not the timer is still pending, see
+   * `timer_wheel::is_pending()`.
+   *
+   * \return `true` if the handle isn't default constructed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return generation != 0;
+  }
+
+  [[nodiscard]] auto operator==(const timer_handle& other) const noexcept -> bool
+  {
+    return index == other.index && generation == other.generation;
+  }
+
+  [[nodiscard]] auto operator!=(const timer_handle& other) const noexcept -> bool
+  {
+    return !(*this == other);
+  }
+};
+
+/**
+ * \class timer_wheel
+ *
+ * \brief Schedules delayed and periodic callbacks, driven by the game loop.
+ *
+ * \details Unlike `SDL_AddTimer()`, which runs every callback on a separate thread,
+ * the callbacks are invoked by `advance()`, on the thread that drives the wheel, so they
+ * may freely access the game state. Time is discretized into ticks of a fixed
+ * resolution, and timers are stored in a hierarchy of four wheels of 256 slots each,
+ * where each wheel covers 256 times the range of the wheel below it. Timers are moved
+ * down the hierarchy as their deadlines approach, so scheduling and cancelling are
+ * constant time, and expiring timers are processed a whole slot at a time.
+ * \code{cpp}
+ *   cen::timer_wheel timers;
+ *
+ *   const auto spawner = timers.schedule_every(cen::seconds<double>{2}, [&] {
+ *     world.spawn_enemy();
+ *   });
+ *
+ *   loop.run(dispatcher, renderer,
+ *            [&](const cen::seconds<double> dt) {
+ *              timers.advance(dt);
+ *              world.update(dt);
+ *            },
+ *            [&](const double alpha) { world.render(renderer, alpha); });
+ * \endcode
+ *
+ * \note Callbacks may schedule and cancel timers, including their own.
+ *
+ * \since 6.1.0
+ */
+class timer_wheel final
+{
+ public:
+  using size_type = std::size_t;
+  using duration_type = seconds<double>;
+  using callback_type = std::function<void()>;
+
+  /**
+   * \brief Creates an empty timer wheel.
+   *
+   * \details With the default resolution of a millisecond, the wheels cover more than
+   * 49 days. Timers with longer delays are supported, but are moved back to the highest
+   * wheel until they are in range.
+   *
+   * \param resolution the duration of a tick, which delays are rounded up to.
+   *
+   * \throws cen_error if the resolution isn't positive.
+   *
+   * \since 6.1.0
+   */
+  explicit timer_wheel(const duration_type resolution = duration_type{0.001})
+      : m_resolution{resolution.count()}
+  {
+    if (!(m_resolution > 0))
+    {
+      throw cen_error{"The timer wheel resolution must be positive!"};
+    }
+
+    m_heads.fill(npos);
+  }
+
+  /// \name Scheduling
+  /// \{
+
+  /**
+   * \brief Schedules a callback that is invoked once, after a delay.
+   *
+   * \tparam Callback the type of the callback, must be invocable without arguments.
+   *
+   * \param delay the delay, which is rounded up to at least one tick.
+   * \param callback the function object that is invoked when the timer expires.
+   *
+   * \return a handle to the timer.
+   *
+   * \since 6.1.0
+   */
+  template <typename Callback>
+  auto schedule(const duration_type delay, Callback&& callback) -> timer_handle
+  {
+    static_assert(std::is_invocable_v<Callback&>, "The callback must take no arguments!");
+    return add(to_ticks(delay), 0, callback_type{std::forward<Callback>(callback)});
+  }
+
+  /**
+   * \brief Schedules a callback that is invoked repeatedly, with a fixed interval.
+   *
+   * \details The deadlines are based on the previous deadlines, not on when the callback
+   * was invoked, so periodic timers don't drift. If an `advance()` call covers several
+   * intervals, the callback is invoked once for each of them.
+   *
+   * \tparam Callback the type of the callback, must be invocable without arguments.
+   *
+   * \param interval the interval, which is rounded up to at least one tick.
+   * \param callback the function object that is invoked every interval.
+   *
+   * \return a handle to the timer, which remains pending until it's cancelled.
+   *
+   * \throws cen_error if the interval isn't positive.
+   *
+   * \since 6.1.0
+   */
+  template <typename Callback>
+  auto schedule_every(const duration_type interval, Callback&& callback) -> timer_handle
+  {
+    static_assert(std::is_invocable_v<Callback&>, "The callback must take no arguments!");
+
+    if (!(interval.count() > 0))
+    {
+      throw cen_error{"The timer interval must be positive!"};
+    }
+
+    const auto ticks = to_ticks(interval);
+    return add(ticks, ticks, callback_type{std::forward<Callback>(callback)});
+  }
+
+  /**
+   * \brief Cancels a pending timer.
+   *
+   * \param handle the handle to the timer.
+   *
+   * \return `true` if the timer was pending; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto cancel(const timer_handle handle) noexcept -> bool
+  {
+    if (!is_pending(handle))
+    {
+      return false;
+    }
+
+    if (m_timers[handle.index].bucket != npos)
+    {
+      unlink(handle.index);
+    }
+
+    release(handle.index);
+    return true;
+  }
+
+  /**
+   * \brief Cancels all pending timers.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    for (u32 index = 0; index < m_timers.size(); ++index)
+    {
+      if (m_timers[index].active)
+      {
+        if (m_timers[index].bucket != npos)
+        {
+          unlink(index);
+        }
+
+        release(index);
+      }
+    }
+  }
+
+  /// \} End of scheduling
+
+  /// \name Time
+  /// \{
+
+  /**
+   * \brief Advances the time, and invokes the callbacks of the expired timers.
+   *
+   * \details Elapsed time that doesn't add up to a whole tick is carried over to the next
+   * call. The callbacks are invoked in the order of their deadlines, and timers with the
+   * same deadline are invoked in an unspecified order.
+   *
+   * \param elapsed the amount of time that has passed since the previous call.
+   *
+   * \return the amount of invoked callbacks.
+   *
+   * \since 6.1.0
+   */
+  auto advance(const duration_type elapsed) -> size_type
+  {
+    if (elapsed.count() > 0)
+    {
+      m_accumulator += elapsed.count();
+    }
+
+    const auto ticks = std::floor(m_accumulator / m_resolution);
+    m_accumulator -= ticks * m_resolution;
+
+    return advance_ticks(static_cast<u64>(ticks));
+  }
+
+  /**
+   * \brief Advances the time by a whole amount of ticks.
+   *
+   * \param ticks the amount of ticks to advance.
+   *
+   * \return the amount of invoked callbacks.
+   *
+   * \since 6.1.0
+   */
+  auto advance_ticks(u64 ticks) -> size_type
+  {
+    size_type invoked = 0;
+
+    while (ticks > 0)
+    {
+      // Nothing happens before the lowest wheel that contains timers is cascaded, so the
+      // ticks up to that point are skipped
+      u32 level = 0;
+      while (level < level_count && m_counts[level] == 0)
+      {
+        ++level;
+      }
+
+      if (level == level_count)
+      {
+        m_now += ticks;
+        break;
+      }
+
+      const auto span = u64{1} << (level * slot_bits);
+      const auto skipped = (std::min)(span - 1u - (m_now & (span - 1u)), ticks - 1u);
+
+      m_now += skipped + 1u;
+      ticks -= skipped + 1u;
+
+      cascade();
+      invoked += expire(level_slot(0, m_now));
+    }
+
+    return invoked;
+  }
+
+  /// \} End of time
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Indicates whether or not a timer is pending.
+   *
+   * \param handle the handle to the timer.
+   *
+   * \return `true` if the timer hasn't expired or been cancelled; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_pending(const timer_handle handle) const noexcept -> bool
+  {
+    return handle && handle.index < m_timers.size() &&
+           m_timers[handle.index].generation == handle.generation &&
+           m_timers[handle.index].active;
+  }
+
+  /**
+   * \brief Returns the time that is left until a timer expires.
+   *
+   * \param handle the handle to the timer.
+   *
+   * \return the time until the next expiry of the timer, zero if it isn't pending.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto remaining(const timer_handle handle) const noexcept -> duration_type
+  {
+    if (!is_pending(handle))
+    {
+      return duration_type::zero();
+    }
+
+    const auto deadline = m_timers[handle.index].deadline;
+    const auto ticks = (deadline > m_now) ? deadline - m_now : 0;
+    const auto time = static_cast<double>(ticks) * m_resolution - m_accumulator;
+    return duration_type{(std::max)(time, 0.0)};
+  }
+
+  /**
+   * \brief Returns the amount of pending timers.
+   *
+   * \return the amount of pending timers.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Indicates whether or not there are no pending timers.
+   *
+   * \return `true` if there are no pending timers; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * \brief Returns the amount of ticks that have passed.
+   *
+   * \return the amount of ticks that the wheel has been advanced.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto now() const noexcept -> u64
+  {
+    return m_now;
+  }
+
+  /**
+   * \brief Returns the duration of a tick.
+   *
+   * \return the resolution of the wheel.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto resolution() const noexcept -> duration_type
+  {
+    return duration_type{m_resolution};
+  }
+
+  /// \} End of queries
+
+ private:
+  inline constexpr static u32 npos = 0xFFFF'FFFFu;
+  inline constexpr static u32 slot_bits = 8;
+  inline constexpr static u32 slot_count = 1u << slot_bits;
+  inline constexpr static u32 level_count = 4;
+  inline constexpr static u32 expired_bucket = level_count * slot_count;
+
+  struct timer final
+  {
+    callback_type callback;
+    u64 deadline{};
+    u64 interval{};  ///< The period in ticks, zero for one-shot timers.
+    u32 prev{npos};
+    u32 next{npos};
+    u32 bucket{npos};  ///< The list that contains the timer, npos while it's invoked.
+    u32 generation{1};
+    bool active{};
+  };
+
+  std::vector<timer> m_timers;
+  std::vector<u32> m_free;
+  std::array<u32, expired_bucket + 1u> m_heads{};  // Heads of the slot lists
+  std::array<size_type, level_count + 1u> m_counts{};  // Timers in each wheel
+  double m_resolution{};
+  double m_accumulator{};
+  u64 m_now{};
+  size_type m_size{};
+
+  [[nodiscard]] auto to_ticks(const duration_type duration) const noexcept -> u64
+  {
+    const auto ticks = std::ceil(duration.count() / m_resolution);
+    return (ticks > 1) ? static_cast<u64>(ticks) : u64{1};
+  }
+
+  [[nodiscard]] constexpr static auto level_slot(const u32 level, const u64 tick) noexcept
+      -> u32
+  {
+    return static_cast<u32>((tick >> (level * slot_bits)) & (slot_count - 1u));
+  }
+
+  auto add(const u64 delay, const u64 interval, callback_type callback) -> timer_handle
+  {
+    u32 index{};
+    if (m_free.empty())
+    {
+      index = static_cast<u32>(m_timers.size());
+      m_timers.emplace_back();
+      m_free.reserve(m_timers.size());  // Room for every timer, so releasing can't throw
+    }
+    else
+    {
+      index = m_free.back();
+      m_free.pop_back();
+    }
+
+    auto& entry = m_timers[index];
+    entry.callback = std::move(callback);
+    entry.deadline = m_now + delay;
+    entry.interval = interval;
+    entry.active = true;
+
+    insert(index);
+    ++m_size;
+
+    return timer_handle{index, entry.generation};
+  }
+
+  void release(const u32 index) noexcept
+  {
+    auto& entry = m_timers[index];
+    entry.callback = nullptr;
+    entry.active = false;
+
+    // Zero is reserved for invalid handles
+    if (++entry.generation == 0)
+    {
+      entry.generation = 1;
+    }
+
+    m_free.push_back(index);
+    --m_size;
+  }
+
+  /// Inserts a timer into the slot of the wheel whose range covers its deadline.
+  void insert(const u32 index) noexcept
+  {
+    const auto deadline = m_timers[index].deadline;
+    const auto delta = deadline - m_now;
+
+    u32 bucket = 0;
+    if (delta < (u64{1} << slot_bits))
+    {
+      bucket = level_slot(0, deadline);
+    }
+    else if (delta < (u64{1} << (2u * slot_bits)))
+    {
+      bucket = slot_count + level_slot(1, deadline);
+    }
+    else if (delta < (u64{1} << (3u * slot_bits)))
+    {
+      bucket = 2u * slot_count + level_slot(2, deadline);
+    }
+    else
+    {
+      // Deadlines beyond the range of the wheels wait in the last slot of the highest
+      // wheel, and are inserted again when that slot is cascaded
+      constexpr u64 range = (u64{1} << (level_count * slot_bits)) - 1u;
+      const auto target = (delta <= range) ? deadline : m_now + range;
+      bucket = 3u * slot_count + level_slot(3, target);
+    }
+
+    link(index, bucket);
+  }
+
+  void link(const u32 index, const u32 bucket) noexcept
+  {
+    auto& entry = m_timers[index];
+    entry.bucket = bucket;
+    entry.prev = npos;
+    entry.next = m_heads[bucket];
+    ++m_counts[bucket / slot_count];
+
+    if (entry.next != npos)
+    {
+      m_timers[entry.next].prev = index;
+    }
+
+    m_heads[bucket] = index;
+  }
+
+  void unlink(const u32 index) noexcept
+  {
+    auto& entry = m_timers[index];
+
+    if (entry.prev != npos)
+    {
+      m_timers[entry.prev].next = entry.next;
+    }
+    else
+    {
+      m_heads[entry.bucket] = entry.next;
+    }
+
+    if (entry.next != npos)
+    {
+      m_timers[entry.next].prev = entry.prev;
+    }
+
+    --m_counts[entry.bucket / slot_count];
+
+    entry.prev = npos;
+    entry.next = npos;
+    entry.bucket = npos;
+  }
+
+  /// Moves the timers of the higher wheels down, when the lower wheels wrap around.
+  void cascade() noexcept
+  {
+    for (u32 level = 1; level < level_count; ++level)
+    {
+      if (level_slot(level - 1u, m_now) != 0)
+      {
+        break;
+      }
+
+      const auto bucket = level * slot_count + level_slot(level, m_now);
+
+      auto index = m_heads[bucket];
+      m_heads[bucket] = npos;
+
+      while (index != npos)
+      {
+        const auto next = m_timers[index].next;
+        --m_counts[level];
+        insert(index);
+        index = next;
+      }
+    }
+  }
+
+  /// Invokes the callbacks of the timers in a slot of the lowest wheel.
+  auto expire(const u32 slot) -> size_type
+  {
+    // The whole slot is moved to a separate list, which callbacks may cancel timers from
+    auto index = m_heads[slot];
+    m_heads[slot] = npos;
+
+    while (index != npos)
+    {
+      const auto next = m_timers[index].next;
+      --m_counts[0];
+      link(index, expired_bucket);
+      index = next;
+    }
+
+    size_type invoked = 0;
+    while (m_heads[expired_bucket] != npos)
+    {
+      index = m_heads[expired_bucket];
+      unlink(index);
+
+      // The callback is moved out, since callbacks may grow the timer storage
+      auto callback = std::move(m_timers[index].callback);
+      const auto generation = m_timers[index].generation;
+
+      try
+      {
+        callback();
+      }
+      catch (...)
+      {
+        finish(index, generation, std::move(callback));
+        throw;
+      }
+
+      finish(index, generation, std::move(callback));
+      ++invoked;
+    }
+
+    return invoked;
+  }
+
+  /// Reschedules a periodic timer after its callback, unless it was cancelled.
+  void finish(const u32 index, const u32 generation, callback_type callback) noexcept
+  {
+    auto& entry = m_timers[index];
+    if (entry.generation != generation || !entry.active)
+    {
+      return;
+    }
+
+    if (entry.interval == 0)
+    {
+      release(index);
+    }
+    else
+    {
+      entry.callback = std::move(callback);
+      entry.deadline += entry.interval;
+      insert(index);
+    }
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_TIMER_WHEEL_HEADER
@@ -0,0 +1,283 @@
+#ifndef CENTURION_TRACE_EXPORTER_HEADER
+#define CENTURION_TRACE_EXPORTER_HEADER
+
+#include <SDL.h>
+
+#include <atomic>   // atomic
+#include <cstddef>  // size_t
+#include <fstream>  // ofstream
+#include <memory>   // unique_ptr, make_unique
+#include <ostream>  // ostream
+#include <string>   // string
+#include <vector>   // vector
+
+#include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../thread/spsc_queue.hpp"
+#include "../thread/thread.hpp"
+#include "profiler.hpp"
+
+namespace cen {
+
+/// \addtogroup system
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+inline void write_json_string(std::ostream& stream, const czstring str)
+{
+  constexpr char digits[] = "0123456789abcdef";
+
+  stream.put('"');
+  for (auto* it = str ? str : ""; *it != '\0'; ++it)
+  {
+    const auto ch = static_cast<unsigned char>(*it);
+    if (ch == '"' || ch == '\\')
+    {
+      stream.put('\\');
+      stream.put(static_cast<char>(ch));
+    }
+    else if (ch < 0x20)
+    {
+      stream << "\\u00" << digits[ch >> 4u] << digits[ch & 0xFu];
+    }
+    else
+    {
+      stream.put(static_cast<char>(ch));
+    }
+  }
+
+  stream.put('"');
+}
+
+// Writes the events of a thread as Chrome trace events, with timestamps in microseconds
+inline void write_chrome_events(std::ostream& stream,
+                                const profile_thread& thread,
+                                const u64 origin,
+                                bool& first)
+{
+  for (const auto& event : thread.events)
+  {
+    const auto ticks = (event.time > origin) ? event.time - origin : u64{0};
+    const auto micros = static_cast<double>(ticks) / 1'000.0;
+
+    stream << (first ? "\n" : ",\n") << "{\"name\":";
+    write_json_string(stream, event.name);
+    stream << ",\"ph\":\"" << (event.type == profile_event_type::begin ? 'B' : 'E')
+           << "\",\"ts\":" << micros << ",\"pid\":0,\"tid\":" << thread.id << '}';
+
+    first = false;
+  }
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Writes the events of a profiler frame as a Chrome trace.
+ *
+ * \details The output is a JSON document in the Trace Event Format, which can be loaded
+ * in `about://tracing` in Chromium-based browsers, or in Perfetto. The timestamps are
+ * relative to the beginning of the frame.
+ *
+ * \param stream the stream that the trace will be written to.
+ * \param frame the frame that will be written.
+ *
+ * \since 6.1.0
+ *
+ * \see `chrome_trace_exporter`
+ */
+inline void write_chrome_trace(std::ostream& stream, const profile_frame& frame)
+{
+  bool first = true;
+  stream << "{\"traceEvents\":[";
+
+  for (const auto& thread : frame.threads())
+  {
+    detail::write_chrome_events(stream, thread, frame.begin_time(), first);
+  }
+
+  stream << "\n]}\n";
+}
+
+/**
+ * \class chrome_trace_exporter
+ *
+ * \brief Writes profiler frames to a Chrome trace file, on a background thread.
+ *
+ * \details Submitting a frame only copies its events, which are then formatted and
+ * written to the file by a worker thread, so that capturing a trace doesn't stall the
+ * frame. If the worker falls behind, frames are dropped instead of blocking.
+ * \code{cpp}
+ *   cen::chrome_trace_exporter exporter{"trace.json"};
+ *
+ *   // At the end of every frame
+ *   exporter.submit(cen::profiler::end_frame());
+ * \endcode
+ *
+ * \note The trace is complete once the exporter has been destroyed.
+ *
+ * \since 6.1.0
+ *
+ * \see `write_chrome_trace()`
+ */
+class chrome_trace_exporter final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// The maximum amount of frames that wait to be written.
+  inline constexpr static size_type max_pending_frames = 64;
+
+  /**
+   * \brief Opens a trace file and starts the worker thread.
+   *
+   * \param path the path of the trace file, which is overwritten.
+   *
+   * \throws cen_error if the file cannot be opened.
+   * \throws sdl_error if the worker thread cannot be created.
+   *
+   * \since 6.1.0
+   */
+  explicit chrome_trace_exporter(const std::string& path)
+      : m_file{path, std::ios::out | std::ios::trunc}
+  {
+    if (!m_file)
+    {
+      throw cen_error{"Failed to open trace file!"};
+    }
+
+    m_file << "{\"traceEvents\":[";
+    m_worker = std::make_unique<cen::thread>(&chrome_trace_exporter::run, "trace", this);
+  }
+
+  chrome_trace_exporter(const chrome_trace_exporter&) = delete;
+
+  auto operator=(const chrome_trace_exporter&) -> chrome_trace_exporter& = delete;
+
+  /**
+   * \brief Writes the pending frames, completes the trace and closes the file.
+   */
+  ~chrome_trace_exporter() noexcept
+  {
+    m_frames.push(nullptr);  // Stops the worker once the other frames have been written
+    m_worker->join();
+
+    m_file << "\n]}\n";
+  }
+
+  /**
+   * \brief Submits a frame that will be written to the trace.
+   *
+   * \param frame the profiler frame, usually obtained from `profiler::end_frame()`.
+   *
+   * \return `true` if the frame will be written; `false` if it was dropped, because the
+   * worker thread has fallen behind.
+   *
+   * \since 6.1.0
+   */
+  auto submit(const profile_frame& frame) -> bool
+  {
+    // The timestamps of the trace are relative to the first submitted frame
+    if (m_origin.load(std::memory_order_relaxed) == 0)
+    {
+      m_origin.store(frame.begin_time(), std::memory_order_relaxed);
+    }
+
+    auto batch = std::make_unique<std::vector<profile_thread>>(frame.threads());
+    if (!m_frames.try_push(std::move(batch)))
+    {
+      m_dropped.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Submits the events of an additional track that will be written to the trace.
+   *
+   * \details This is used to merge events that weren't recorded by the CPU profiler into
+   * the trace, e.g. the results of a `gl::gpu_profiler`. The events are written with the
+   * identifier of the track as the thread identifier, and should use the same clock as
+   * `counter::monotonic()`.
+   *
+   * \param track the events of the track.
+   *
+   * \return `true` if the track will be written; `false` if it was dropped, because the
+   * worker thread has fallen behind.
+   *
+   * \since 6.1.0
+   */
+  auto submit(const profile_thread& track) -> bool
+  {
+    if (track.events.empty())
+    {
+      return true;
+    }
+
+    auto batch = std::make_unique<std::vector<profile_thread>>(1u, track);
+    if (!m_frames.try_push(std::move(batch)))
+    {
+      m_dropped.fetch_add(1u, std::memory_order_relaxed);
+      return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Returns the amount of frames that were dropped.
+   *
+   * \return the amount of frames that were submitted but not written.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dropped_frames() const noexcept -> size_type
+  {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  using batch_type = std::unique_ptr<std::vector<profile_thread>>;
+
+  std::ofstream m_file;
+  spsc_queue<batch_type, max_pending_frames> m_frames;
+  std::unique_ptr<cen::thread> m_worker;
+  std::atomic<std::size_t> m_dropped{0};  // Read by any thread
+  std::atomic<u64> m_origin{0};
+  bool m_first{true};  // Only used by the worker thread
+
+  static auto run(void* data) -> int
+  {
+    auto* self = static_cast<chrome_trace_exporter*>(data);
+
+    for (;;)
+    {
+      batch_type batch;
+      self->m_frames.pop(batch);
+
+      if (!batch)
+      {
+        break;
+      }
+
+      const auto origin = self->m_origin.load(std::memory_order_relaxed);
+      for (const auto& thread : *batch)
+      {
+        detail::write_chrome_events(self->m_file, thread, origin, self->m_first);
+      }
+    }
+
+    self->m_file.flush();
+    return 0;
+  }
+};
+
+/// \} End of group system
+
+}  // namespace cen
+
+#endif  // CENTURION_TRACE_EXPORTER_HEADER
@@ -0,0 +1,33 @@
+#ifndef CENTURION_THREAD_SUBSYSTEM_HEADER
+#define CENTURION_THREAD_SUBSYSTEM_HEADER
+
+/**
+ * \file thread.hpp
+ *
+ * \brief Includes all headers of the thread subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "thread/condition.hpp"
+#include "thread/coroutine.hpp"
+#include "thread/fast_condition.hpp"
+#include "thread/fast_semaphore.hpp"
+#include "thread/job_graph.hpp"
+#include "thread/mpmc_queue.hpp"
+#include "thread/mutex.hpp"
+#include "thread/parallel.hpp"
+#include "thread/scoped_lock.hpp"
+#include "thread/semaphore.hpp"
+#include "thread/shared_mutex.hpp"
+#include "thread/spin_mutex.hpp"
+#include "thread/spsc_queue.hpp"
+#include "thread/thread.hpp"
+#include "thread/thread_pool.hpp"
+#include "thread/triple_buffer.hpp"
+#include "thread/try_lock.hpp"
+
+#endif  // CENTURION_THREAD_SUBSYSTEM_HEADER
@@ -0,0 +1,915 @@
+#ifndef CENTURION_COROUTINE_HEADER
+#define CENTURION_COROUTINE_HEADER
+
+#include "../core/macros.hpp"
+
+#ifdef CENTURION_HAS_COROUTINES
+
+#include <atomic>       // atomic, memory_order_...
+#include <coroutine>    // coroutine_handle, suspend_always, noop_coroutine
+#include <cstddef>      // size_t, max_align_t
+#include <exception>    // exception_ptr, current_exception, rethrow_exception
+#include <new>          // operator new, operator delete
+#include <type_traits>  // invoke_result_t, decay_t, is_void_v
+#include <utility>      // move, exchange, forward
+#include <variant>      // variant, monostate, get
+#include <vector>       // vector
+
+#include "../core/time.hpp"
+#include "../detail/spin_backoff.hpp"
+#include "../system/timer_wheel.hpp"
+#include "scoped_lock.hpp"
+#include "spin_mutex.hpp"
+#include "thread_pool.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/**
+ * Recycles coroutine frames in per-thread free lists, one for each 64-byte size class.
+ * Frames are usually created and destroyed at a high rate, e.g. by every awaited task,
+ * so this avoids most heap allocations. Frames may be released on another thread than
+ * the one that allocated them, in which case the memory moves to that thread's lists.
+ * Every frame is preceded by a header that stores its size class, so that blocks that
+ * weren't allocated with the size of a class, e.g. those allocated after the lists of
+ * the thread were closed, are never recycled.
+ */
+class coroutine_frame_cache final
+{
+ public:
+  inline constexpr static std::size_t granularity = 64;
+  inline constexpr static std::size_t class_count = 16;  // Up to 1 KiB
+
+  [[nodiscard]] static auto allocate(const std::size_t size) -> void*
+  {
+    const auto index = class_of(size);
+    if (index >= class_count || !lists_of_thread())
+    {
+      return tag(::operator new(header_size + size), uncached);
+    }
+
+    auto& lists = t_lists;
+    if (auto* block = lists.heads[index])
+    {
+      lists.heads[index] = block->next;
+      return tag(block, index);
+    }
+
+    return tag(::operator new((index + 1u) * granularity), index);
+  }
+
+  static void deallocate(void* ptr) noexcept
+  {
+    auto* header = static_cast<frame_header*>(ptr) - 1;
+    const auto index = header->size_class;
+
+    // Frames can outlive the lists, e.g. frames that are destroyed by static objects
+    if (index == uncached || t_lists.closed)
+    {
+      ::operator delete(header);
+      return;
+    }
+
+    auto& lists = t_lists;
+
+    auto* block = reinterpret_cast<free_block*>(header);
+    block->next = lists.heads[index];
+    lists.heads[index] = block;
+  }
+
+ private:
+  inline constexpr static std::size_t uncached = class_count;
+
+  struct alignas(std::max_align_t) frame_header final
+  {
+    std::size_t size_class;
+  };
+
+  inline constexpr static std::size_t header_size = sizeof(frame_header);
+
+  struct free_block final
+  {
+    free_block* next;
+  };
+
+  // Trivially destructible, so that it remains usable while thread storage is destroyed
+  struct free_lists final
+  {
+    free_block* heads[class_count];
+    bool closed;
+  };
+
+  // Releases the free lists of a thread when it exits
+  struct reaper final
+  {
+    reaper() = default;
+
+    reaper(const reaper&) = delete;
+    auto operator=(const reaper&) -> reaper& = delete;
+
+    ~reaper() noexcept
+    {
+      for (auto* head : t_lists.heads)
+      {
+        while (head)
+        {
+          auto* next = head->next;
+          ::operator delete(head);
+          head = next;
+        }
+      }
+
+      t_lists = {};
+      t_lists.closed = true;
+    }
+  };
+
+  inline static thread_local free_lists t_lists{};
+
+  [[nodiscard]] static auto lists_of_thread() noexcept -> bool
+  {
+    thread_local reaper cleanup;
+    static_cast<void>(cleanup);
+    return !t_lists.closed;
+  }
+
+  [[nodiscard]] constexpr static auto class_of(const std::size_t size) noexcept
+      -> std::size_t
+  {
+    return (size + header_size - 1u) / granularity;
+  }
+
+  [[nodiscard]] static auto tag(void* block, const std::size_t index) noexcept -> void*
+  {
+    auto* header = ::new (block) frame_header{index};
+    return header + 1;
+  }
+};
+
+/// Base of promise types, which allocates the coroutine frames from the frame cache.
+struct pooled_coroutine_frame
+{
+  [[nodiscard]] static auto operator new(const std::size_t size) -> void*
+  {
+    return coroutine_frame_cache::allocate(size);
+  }
+
+  static void operator delete(void* ptr) noexcept
+  {
+    coroutine_frame_cache::deallocate(ptr);
+  }
+};
+
+/// Stores the result of a coroutine, or the exception that it exited with.
+template <typename T>
+class coroutine_result final
+{
+ public:
+  template <typename U>
+  void set_value(U&& value)
+  {
+    m_state.template emplace<1>(std::forward<U>(value));
+  }
+
+  void set_exception(std::exception_ptr exception) noexcept
+  {
+    m_state.template emplace<2>(std::move(exception));
+  }
+
+  auto get() -> T
+  {
+    if (m_state.index() == 2)
+    {
+      std::rethrow_exception(std::get<2>(m_state));
+    }
+
+    return std::move(std::get<1>(m_state));
+  }
+
+ private:
+  std::variant<std::monostate, T, std::exception_ptr> m_state;
+};
+
+template <>
+class coroutine_result<void> final
+{
+ public:
+  void set_value() noexcept
+  {}
+
+  void set_exception(std::exception_ptr exception) noexcept
+  {
+    m_exception = std::move(exception);
+  }
+
+  void get()
+  {
+    if (m_exception)
+    {
+      std::rethrow_exception(m_exception);
+    }
+  }
+
+ private:
+  std::exception_ptr m_exception;
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+template <typename T>
+class task;
+
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+class task_promise_base : public pooled_coroutine_frame
+{
+ public:
+  struct final_awaiter final
+  {
+    [[nodiscard]] auto await_ready() const noexcept -> bool
+    {
+      return false;
+    }
+
+    template <typename Promise>
+    auto await_suspend(std::coroutine_handle<Promise> handle) const noexcept
+        -> std::coroutine_handle<>
+    {
+      // Transfers control to the awaiting coroutine without growing the stack
+      const auto continuation = handle.promise().m_continuation;
+      return continuation ? continuation : std::noop_coroutine();
+    }
+
+    void await_resume() const noexcept
+    {}
+  };
+
+  auto initial_suspend() const noexcept -> std::suspend_always
+  {
+    return {};
+  }
+
+  auto final_suspend() const noexcept -> final_awaiter
+  {
+    return {};
+  }
+
+  void unhandled_exception() noexcept
+  {
+    m_result.set_exception(std::current_exception());
+  }
+
+  void set_continuation(const std::coroutine_handle<> continuation) noexcept
+  {
+    m_continuation = continuation;
+  }
+
+  auto result() -> T
+  {
+    return m_result.get();
+  }
+
+ protected:
+  coroutine_result<T> m_result;
+
+ private:
+  std::coroutine_handle<> m_continuation;
+};
+
+template <typename T>
+class task_promise final : public task_promise_base<T>
+{
+ public:
+  auto get_return_object() noexcept -> task<T>;
+
+  template <typename U>
+  void return_value(U&& value)
+  {
+    this->m_result.set_value(std::forward<U>(value));
+  }
+};
+
+template <>
+class task_promise<void> final : public task_promise_base<void>
+{
+ public:
+  auto get_return_object() noexcept -> task<void>;
+
+  void return_void() noexcept
+  {}
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class task
+ *
+ * \brief A lazily started coroutine, which produces a value when it's awaited.
+ *
+ * \details A task doesn't run until it's awaited by another coroutine, or spawned in a
+ * `coroutine_scheduler`. When the task finishes, the awaiting coroutine is resumed
+ * directly, without growing the stack. Exceptions that escape the task are rethrown in
+ * the awaiting coroutine. The coroutine frames are recycled by per-thread free lists, so
+ * short-lived tasks rarely allocate memory.
+ *
+ * \note This class is only available if the compiler supports C++20 coroutines, see
+ * `CENTURION_HAS_COROUTINES`.
+ *
+ * \tparam T the type of the result of the task.
+ *
+ * \since 6.1.0
+ */
+template <typename T = void>
+class [[nodiscard]] task final
+{
+ public:
+  using value_type = T;
+  using promise_type = detail::task_promise<T>;
+  using handle_type = std::coroutine_handle<promise_type>;
+
+  task() noexcept = default;
+
+  task(task&& other) noexcept : m_handle{std::exchange(other.m_handle, nullptr)}
+  {}
+
+  auto operator=(task&& other) noexcept -> task&
+  {
+    if (this != &other)
+    {
+      destroy();
+      m_handle = std::exchange(other.m_handle, nullptr);
+    }
+
+    return *this;
+  }
+
+  task(const task&) = delete;
+  auto operator=(const task&) -> task& = delete;
+
+  ~task() noexcept
+  {
+    destroy();
+  }
+
+  auto operator co_await() const noexcept
+  {
+    struct awaiter final
+    {
+      handle_type handle;
+
+      [[nodiscard]] auto await_ready() const noexcept -> bool
+      {
+        return !handle || handle.done();
+      }
+
+      auto await_suspend(const std::coroutine_handle<> continuation) const noexcept
+          -> std::coroutine_handle<>
+      {
+        handle.promise().set_continuation(continuation);
+        return handle;
+      }
+
+      auto await_resume() const -> T
+      {
+        return handle.promise().result();
+      }
+    };
+
+    return awaiter{m_handle};
+  }
+
+  /**
+   * \brief Indicates whether or not the task has finished.
+   *
+   * \return `true` if the task has returned or exited with an exception; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto done() const noexcept -> bool
+  {
+    return !m_handle || m_handle.done();
+  }
+
+  /**
+   * \brief Indicates whether or not the task refers to a coroutine.
+   *
+   * \return `true` if the task refers to a coroutine; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  explicit operator bool() const noexcept
+  {
+    return static_cast<bool>(m_handle);
+  }
+
+ private:
+  handle_type m_handle;
+
+  friend class detail::task_promise<T>;
+  friend class coroutine_scheduler;
+
+  explicit task(const handle_type handle) noexcept : m_handle{handle}
+  {}
+
+  void destroy() noexcept
+  {
+    if (m_handle)
+    {
+      m_handle.destroy();
+      m_handle = nullptr;
+    }
+  }
+};
+
+/// \cond FALSE
+namespace detail {
+
+template <typename T>
+auto task_promise<T>::get_return_object() noexcept -> task<T>
+{
+  return task<T>{std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+inline auto task_promise<void>::get_return_object() noexcept -> task<void>
+{
+  return task<void>{std::coroutine_handle<task_promise>::from_promise(*this)};
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class coroutine_scheduler
+ *
+ * \brief Resumes coroutines that wait for frames, delays and background work.
+ *
+ * \details The scheduler owns the tasks that are spawned in it, and resumes them from
+ * `update()`, which should be called once per frame, e.g. from the update function of a
+ * `game_loop`. Coroutines only ever run on the thread that calls `update()`, also after
+ * awaiting work that runs in a thread pool, so they can access the game state without
+ * synchronization.
+ * \code{cpp}
+ *   cen::coroutine_scheduler scheduler;
+ *
+ *   auto intro(cen::coroutine_scheduler& scheduler) -> cen::task<>
+ *   {
+ *     auto surface = co_await scheduler.async(pool, [] {
+ *       return cen::surface{"images/title.png"};
+ *     });
+ *
+ *     title = cen::texture{renderer, surface};
+ *     co_await scheduler.delay(cen::seconds<double>{2});
+ *
+ *     while (fade > 0)
+ *     {
+ *       fade -= 0.05f;
+ *       co_await scheduler.next_frame();
+ *     }
+ *   }
+ *
+ *   scheduler.spawn(intro(scheduler));
+ *
+ *   loop.run(dispatcher, renderer,
+ *            [&](const cen::seconds<double> dt) { scheduler.update(dt); },
+ *            [&](const double alpha) { world.render(renderer, alpha); });
+ * \endcode
+ *
+ * \note Destroying or clearing the scheduler cancels the work submitted with `async()`
+ * that hasn't started yet, and waits for the work that is running to finish.
+ *
+ * \note This class is only available if the compiler supports C++20 coroutines, see
+ * `CENTURION_HAS_COROUTINES`.
+ *
+ * \since 6.1.0
+ */
+class coroutine_scheduler final
+{
+ public:
+  using size_type = std::size_t;
+  using duration_type = timer_wheel::duration_type;
+
+  /**
+   * \brief Creates a scheduler without any tasks.
+   *
+   * \param resolution the resolution of the timer used by `delay()`.
+   *
+   * \throws cen_error if the resolution isn't positive.
+   *
+   * \since 6.1.0
+   */
+  explicit coroutine_scheduler(const duration_type resolution = duration_type{0.001})
+      : m_timers{resolution}
+  {}
+
+  coroutine_scheduler(const coroutine_scheduler&) = delete;
+  auto operator=(const coroutine_scheduler&) -> coroutine_scheduler& = delete;
+
+  /**
+   * \brief Destroys all tasks, after waiting for their background work.
+   *
+   * \see `clear()`
+   */
+  ~coroutine_scheduler() noexcept
+  {
+    clear();
+  }
+
+  /// \name Tasks
+  /// \{
+
+  /**
+   * \brief Starts a task, which runs until its first suspension point immediately.
+   *
+   * \param work the task, which is owned by the scheduler until it finishes.
+   *
+   * \throws unspecified the exception that the task exited with, if it finished before
+   * its first suspension point.
+   *
+   * \since 6.1.0
+   */
+  void spawn(task<> work)
+  {
+    if (work.done())
+    {
+      return;
+    }
+
+    auto handle = work.m_handle;
+    m_tasks.push_back(std::move(work));
+
+    handle.resume();
+    collect();
+  }
+
+  /**
+   * \brief Resumes the coroutines that are due in this frame.
+   *
+   * \details The coroutines waiting for the next frame are resumed first, followed by
+   * those whose delays have expired, and those whose background work has finished.
+   * Coroutines that await the next frame during this call are resumed in the next call.
+   *
+   * \param elapsed the time that has passed since the previous call.
+   *
+   * \return the amount of resumed coroutines.
+   *
+   * \throws unspecified the exception that a spawned task exited with, after which the
+   * task is removed from the scheduler.
+   *
+   * \since 6.1.0
+   */
+  auto update(const duration_type elapsed) -> size_type
+  {
+    size_type resumed = resume_all(m_nextFrame);
+
+    m_timers.advance(elapsed);
+    resumed += resume_all(m_expired);
+
+    {
+      scoped_lock lock{m_mutex};
+      m_resuming.swap(m_finished);
+    }
+
+    resumed += resume_all(m_resuming);
+
+    collect();
+    return resumed;
+  }
+
+  /**
+   * \brief Destroys all tasks, without resuming them.
+   *
+   * \details Work submitted with `async()` that hasn't started yet is cancelled, and
+   * work that is running is waited for, since it refers to the awaiting coroutines.
+   *
+   * \note This function must not be called from work submitted with `async()`, since it
+   * would wait for itself.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_generation.fetch_add(1u, std::memory_order_acq_rel);
+
+    detail::spin_backoff backoff;
+    while (m_inFlight.load(std::memory_order_acquire) != 0)
+    {
+      backoff();
+    }
+
+    m_timers.clear();
+    m_nextFrame.clear();
+    m_expired.clear();
+    m_resuming.clear();
+
+    {
+      scoped_lock lock{m_mutex};
+      m_finished.clear();
+    }
+
+    m_tasks.clear();
+  }
+
+  /// \} End of tasks
+
+  /// \name Awaitables
+  /// \{
+
+  /**
+   * \brief Returns an awaitable that suspends the coroutine until the next frame.
+   *
+   * \return an awaitable that is resumed by the next call to `update()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto next_frame() noexcept
+  {
+    struct awaiter final
+    {
+      coroutine_scheduler* scheduler;
+
+      [[nodiscard]] auto await_ready() const noexcept -> bool
+      {
+        return false;
+      }
+
+      void await_suspend(const std::coroutine_handle<> handle) const
+      {
+        scheduler->m_nextFrame.push_back(handle);
+      }
+
+      void await_resume() const noexcept
+      {}
+    };
+
+    return awaiter{this};
+  }
+
+  /**
+   * \brief Returns an awaitable that suspends the coroutine for a duration.
+   *
+   * \param duration the delay, which is measured with the elapsed time passed to
+   * `update()`.
+   *
+   * \return an awaitable that is resumed when the delay has passed.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto delay(const duration_type duration) noexcept
+  {
+    struct awaiter final
+    {
+      coroutine_scheduler* scheduler;
+      duration_type duration;
+
+      [[nodiscard]] auto await_ready() const noexcept -> bool
+      {
+        return !(duration.count() > 0);
+      }
+
+      void await_suspend(const std::coroutine_handle<> handle) const
+      {
+        auto* self = scheduler;
+        self->m_timers.schedule(duration, [self, handle] {
+          self->m_expired.push_back(handle);
+        });
+      }
+
+      void await_resume() const noexcept
+      {}
+    };
+
+    return awaiter{this, duration};
+  }
+
+  /**
+   * \brief Returns an awaitable that runs a function in a thread pool, and resumes the
+   * coroutine with its result on the thread that calls `update()`.
+   *
+   * \details Exceptions thrown by the function are rethrown in the coroutine.
+   *
+   * \tparam Function the type of the function object, invocable without arguments.
+   *
+   * \param pool the thread pool that runs the function.
+   * \param function the function object that performs the work.
+   *
+   * \return an awaitable that produces the result of the function.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  [[nodiscard]] auto async(thread_pool& pool, Function&& function)
+  {
+    using function_type = std::decay_t<Function>;
+    using result_type = std::invoke_result_t<function_type&>;
+
+    class awaiter final
+    {
+     public:
+      awaiter(coroutine_scheduler& scheduler, thread_pool& pool, function_type function)
+          : m_scheduler{&scheduler}
+          , m_pool{&pool}
+          , m_function{std::move(function)}
+      {}
+
+      [[nodiscard]] auto await_ready() const noexcept -> bool
+      {
+        return false;
+      }
+
+      void await_suspend(const std::coroutine_handle<> handle)
+      {
+        auto* scheduler = m_scheduler;
+        const auto generation = scheduler->m_generation.load(std::memory_order_acquire);
+
+        // Counted before submitting, so that clear() can't miss work that was submitted
+        scheduler->m_inFlight.fetch_add(1u, std::memory_order_acq_rel);
+        try
+        {
+          // The awaiter lives in the suspended coroutine frame, until it's resumed
+          (void) m_pool->submit([this, scheduler, generation, handle] {
+            run(*scheduler, generation, handle);
+          });
+        }
+        catch (...)
+        {
+          scheduler->m_inFlight.fetch_sub(1u, std::memory_order_acq_rel);
+          throw;
+        }
+      }
+
+      auto await_resume() -> result_type
+      {
+        return m_result.get();
+      }
+
+     private:
+      coroutine_scheduler* m_scheduler;
+      thread_pool* m_pool;
+      function_type m_function;
+      detail::coroutine_result<result_type> m_result;
+
+      void run(coroutine_scheduler& scheduler,
+               const size_type generation,
+               const std::coroutine_handle<> handle) noexcept
+      {
+        // The scheduler was cleared, so the coroutine is about to be destroyed
+        if (scheduler.m_generation.load(std::memory_order_acquire) == generation)
+        {
+          try
+          {
+            if constexpr (std::is_void_v<result_type>)
+            {
+              m_function();
+              m_result.set_value();
+            }
+            else
+            {
+              m_result.set_value(m_function());
+            }
+          }
+          catch (...)
+          {
+            m_result.set_exception(std::current_exception());
+          }
+
+          scheduler.post(handle);
+        }
+
+        // This must be the last access, since the scheduler may be destroyed afterwards
+        scheduler.m_inFlight.fetch_sub(1u, std::memory_order_acq_rel);
+      }
+    };
+
+    return awaiter{*this, pool, std::forward<Function>(function)};
+  }
+
+  /// \} End of awaitables
+
+  /**
+   * \brief Schedules a suspended coroutine to be resumed by the next `update()` call.
+   *
+   * \details This function is thread-safe, and is used to resume coroutines from other
+   * threads, e.g. from completion callbacks of asynchronous operations.
+   *
+   * \param handle the suspended coroutine.
+   *
+   * \since 6.1.0
+   */
+  void post(const std::coroutine_handle<> handle)
+  {
+    scoped_lock lock{m_mutex};
+    m_finished.push_back(handle);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of spawned tasks that haven't finished.
+   *
+   * \return the amount of unfinished tasks.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_tasks.size();
+  }
+
+  /**
+   * \brief Indicates whether or not all spawned tasks have finished.
+   *
+   * \return `true` if there are no unfinished tasks; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_tasks.empty();
+  }
+
+  /// \} End of queries
+
+ private:
+  timer_wheel m_timers;
+  std::vector<task<>> m_tasks;
+  std::vector<std::coroutine_handle<>> m_nextFrame;
+  std::vector<std::coroutine_handle<>> m_expired;
+  std::vector<std::coroutine_handle<>> m_resuming;  // Finished work of the current frame
+  std::vector<std::coroutine_handle<>> m_finished;  // Guarded by the mutex
+  spin_mutex m_mutex;
+  std::atomic<size_type> m_inFlight{0};    // Work submitted with async() that is pending
+  std::atomic<size_type> m_generation{0};  // Incremented by clear() to cancel async work
+
+  static auto resume_all(std::vector<std::coroutine_handle<>>& handles) -> size_type
+  {
+    // Resumed coroutines may suspend again on the same list, so it's moved out first
+    std::vector<std::coroutine_handle<>> batch;
+    batch.swap(handles);
+
+    for (const auto handle : batch)
+    {
+      handle.resume();
+    }
+
+    const auto resumed = batch.size();
+
+    // The capacity is kept, so that steady workloads don't allocate
+    batch.clear();
+    if (handles.empty())
+    {
+      handles.swap(batch);
+    }
+
+    return resumed;
+  }
+
+  /// Removes finished tasks, and rethrows the first exception that a task exited with.
+  void collect()
+  {
+    std::exception_ptr error;
+
+    for (auto index = m_tasks.size(); index-- > 0;)
+    {
+      if (m_tasks[index].done())
+      {
+        if (!error)
+        {
+          try
+          {
+            m_tasks[index].m_handle.promise().result();
+          }
+          catch (...)
+          {
+            error = std::current_exception();
+          }
+        }
+
+        m_tasks[index] = std::move(m_tasks.back());
+        m_tasks.pop_back();
+      }
+    }
+
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_HAS_COROUTINES
+#endif  // CENTURION_COROUTINE_HEADER
@@ -0,0 +1,135 @@
+#ifndef CENTURION_FAST_CONDITION_HEADER
+#define CENTURION_FAST_CONDITION_HEADER
+
+#include <SDL.h>
+
+#include <atomic>  // atomic, memory_order_...
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "condition.hpp"
+#include "mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class fast_condition
+ *
+ * \brief A condition variable that skips the kernel object when nobody is waiting.
+ *
+ * \details The waiting threads are counted with an atomic integer, which is updated
+ * while they hold the mutex, so signalling and broadcasting without waiters only costs
+ * an atomic load instead of a call to `SDL_CondSignal()` or `SDL_CondBroadcast()`. This
+ * is the common case for producer/consumer hand-offs, where the consumer rarely has to
+ * sleep. The interface is the same as that of `condition`.
+ *
+ * \note The state that the waiting threads check must be modified while holding the
+ * mutex, before signalling, which is also required to avoid lost wake-ups with
+ * `condition`.
+ *
+ * \since 6.1.0
+ */
+class fast_condition final
+{
+ public:
+  /**
+   * \brief Creates a condition variable.
+   *
+   * \throws sdl_error if the underlying condition variable cannot be created.
+   *
+   * \since 6.1.0
+   */
+  fast_condition() = default;
+
+  /**
+   * \brief Wakes up one of the threads that are waiting on the condition variable.
+   *
+   * \return `success` if nothing went wrong; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto signal() noexcept -> result
+  {
+    if (m_waiting.load(std::memory_order_seq_cst) == 0)
+    {
+      return success;
+    }
+
+    return m_cond.signal();
+  }
+
+  /**
+   * \brief Wakes up all threads that are waiting on the condition variable.
+   *
+   * \return `success` if nothing went wrong; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto broadcast() noexcept -> result
+  {
+    if (m_waiting.load(std::memory_order_seq_cst) == 0)
+    {
+      return success;
+    }
+
+    return m_cond.broadcast();
+  }
+
+  /**
+   * \brief Waits until the condition variable is signaled.
+   *
+   * \pre The mutex must be locked when the function is called!
+   *
+   * \param mutex the mutex used to coordinate thread access.
+   *
+   * \return `success` if nothing went wrong; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto wait(mutex& mutex) noexcept -> result
+  {
+    m_waiting.fetch_add(1, std::memory_order_seq_cst);
+    const auto status = m_cond.wait(mutex);
+    m_waiting.fetch_sub(1, std::memory_order_relaxed);
+
+    return status;
+  }
+
+  /**
+   * \brief Waits until the condition variable is signaled or if the specified amount of
+   * time has passed.
+   *
+   * \pre The mutex must be locked when the function is called!
+   *
+   * \param mutex the mutex used to coordinate thread access.
+   * \param ms the maximum amount of time to wait.
+   *
+   * \return `success` if the condition variable was signaled; `timed_out` if the time
+   * ran out; `error` if something goes wrong.
+   *
+   * \since 6.1.0
+   */
+  auto wait(mutex& mutex, const milliseconds<u32> ms) noexcept(noexcept(ms.count()))
+      -> lock_status
+  {
+    m_waiting.fetch_add(1, std::memory_order_seq_cst);
+    const auto status = m_cond.wait(mutex, ms);
+    m_waiting.fetch_sub(1, std::memory_order_relaxed);
+
+    return status;
+  }
+
+ private:
+  std::atomic<u32> m_waiting{0};  // Only modified while the mutex is locked
+  condition m_cond;
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_FAST_CONDITION_HEADER
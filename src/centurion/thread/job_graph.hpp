@@ -0,0 +1,420 @@
+#ifndef CENTURION_JOB_GRAPH_HEADER
+#define CENTURION_JOB_GRAPH_HEADER
+
+#include <SDL.h>
+
+#include <atomic>            // atomic, memory_order_...
+#include <cstddef>           // size_t
+#include <exception>         // exception_ptr, current_exception, rethrow_exception
+#include <initializer_list>  // initializer_list
+#include <memory>            // unique_ptr, make_unique
+#include <new>               // placement new
+#include <type_traits>       // decay_t, is_invocable_v
+#include <utility>           // forward
+#include <vector>            // vector
+
+#include "../core/exception.hpp"
+#include "../detail/frame_arena.hpp"
+#include "mpmc_queue.hpp"
+#include "thread_pool.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class job_graph
+ *
+ * \brief A set of jobs with dependencies, which are executed by a thread pool.
+ *
+ * \details Jobs may only depend on jobs that were added before them, which guarantees
+ * that the graph is acyclic. When a graph is run, the jobs without dependencies are
+ * scheduled first. A thread that finishes a job continues directly with one of the jobs
+ * that became ready as a result, and the other ready jobs are scheduled for the other
+ * threads. The calling thread takes part in running the jobs.
+ *
+ * The jobs, and the lists of their dependents, are stored in an arena that is reused
+ * once the graph is reset. As a result, adding and running the jobs of a frame doesn't
+ * allocate memory once the graph has reached its steady size.
+ * \code{cpp}
+ *   cen::job_graph graph;
+ *
+ *   // Every frame
+ *   graph.reset();
+ *
+ *   const auto input = graph.add([&] { update_input(); });
+ *   const auto physics = graph.add([&] { update_physics(); }, {input});
+ *   const auto audio = graph.add([&] { update_audio(); }, {input});
+ *   graph.add([&] { update_camera(); }, {physics, audio});
+ *
+ *   graph.run(pool);
+ * \endcode
+ *
+ * \note A graph may be run any amount of times before it is reset, which is useful for
+ * frames that always consist of the same jobs.
+ *
+ * \since 6.1.0
+ *
+ * \see `thread_pool`
+ */
+class job_graph final
+{
+ public:
+  using size_type = std::size_t;
+  using job_id = size_type;
+
+  /**
+   * \brief Creates an empty job graph.
+   *
+   * \param blockSize the size of the memory blocks used to store the jobs, in bytes.
+   *
+   * \since 6.1.0
+   */
+  explicit job_graph(const size_type blockSize = 16'384) : m_arena{blockSize}
+  {}
+
+  job_graph(const job_graph&) = delete;
+
+  auto operator=(const job_graph&) -> job_graph& = delete;
+
+  ~job_graph() noexcept
+  {
+    reset();
+  }
+
+  /**
+   * \brief Adds a job to the graph.
+   *
+   * \tparam Function the type of the function object, must be invocable without
+   * arguments.
+   *
+   * \param function the function object that will be invoked when the job is run.
+   * \param dependencies the jobs that must finish before the job may start.
+   *
+   * \return the identifier of the job.
+   *
+   * \throws cen_error if a dependency isn't a job that was previously added.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  auto add(Function&& function, std::initializer_list<job_id> dependencies = {})
+      -> job_id
+  {
+    using function_type = std::decay_t<Function>;
+    static_assert(std::is_invocable_v<function_type&>,
+                  "Jobs must be invocable without arguments!");
+
+    for (const auto dependency : dependencies)
+    {
+      if (dependency >= m_jobs.size())
+      {
+        throw cen_error{"Jobs may only depend on previously added jobs!"};
+      }
+    }
+
+    // The function object is stored right after the job, in the same allocation
+    constexpr auto offset =
+        (sizeof(job) + alignof(function_type) - 1) / alignof(function_type) *
+        alignof(function_type);
+    constexpr auto alignment =
+        (alignof(function_type) > alignof(job)) ? alignof(function_type) : alignof(job);
+
+    auto* memory =
+        static_cast<unsigned char*>(m_arena.allocate(offset + sizeof(function_type),
+                                                     alignment));
+
+    auto* callable = ::new (static_cast<void*>(memory + offset))
+        function_type(std::forward<Function>(function));
+
+    auto* added = ::new (static_cast<void*>(memory)) job{};
+    added->callable = callable;
+    added->invoke = [](void* f) { (*static_cast<function_type*>(f))(); };
+    added->destroy = [](void* f) noexcept {
+      static_cast<function_type*>(f)->~function_type();
+    };
+
+    m_jobs.push_back(added);
+
+    const auto id = m_jobs.size() - 1u;
+    for (const auto dependency : dependencies)
+    {
+      link(dependency, id);
+    }
+
+    return id;
+  }
+
+  /**
+   * \brief Adds a dependency to a job.
+   *
+   * \param id the job that will depend on the other job.
+   * \param dependency the job that must finish before the job may start, must have been
+   * added before the dependent job.
+   *
+   * \throws cen_error if the dependency wasn't added before the job.
+   *
+   * \since 6.1.0
+   */
+  void add_dependency(const job_id id, const job_id dependency)
+  {
+    if (id >= m_jobs.size() || dependency >= id)
+    {
+      throw cen_error{"Jobs may only depend on previously added jobs!"};
+    }
+
+    link(dependency, id);
+  }
+
+  /**
+   * \brief Runs all jobs of the graph, and blocks until they have finished.
+   *
+   * \details If a job throws an exception, the jobs that haven't started yet are skipped
+   * and the first exception is rethrown once all running jobs have finished.
+   *
+   * \param pool the thread pool that will be used, the calling thread helps out.
+   *
+   * \throws any exception that was thrown by a job.
+   *
+   * \since 6.1.0
+   */
+  void run(thread_pool& pool)
+  {
+    if (m_jobs.empty())
+    {
+      return;
+    }
+
+    // Every runner is stopped by a null job, so the queue can hold all jobs and those
+    const auto runners = pool.size();
+
+    const auto required = m_jobs.size() + runners + 1u;
+    if (!m_ready || m_ready->capacity() < required)
+    {
+      m_ready = std::make_unique<mpmc_queue<job*>>(required);
+    }
+
+    m_unfinished.store(m_jobs.size(), std::memory_order_relaxed);
+    m_failed.store(false, std::memory_order_relaxed);
+    m_error = nullptr;
+
+    for (auto* j : m_jobs)
+    {
+      j->remaining.store(j->dependencies, std::memory_order_relaxed);
+    }
+
+    m_runners = runners + 1u;
+
+    // The handles are the only memory that is allocated per run, proportional to the
+    // amount of workers rather than the amount of jobs
+    m_handles.clear();
+    for (size_type index = 0; index < runners; ++index)
+    {
+      m_handles.push_back(pool.submit([this] { run_jobs(); }));
+    }
+
+    for (auto* j : m_jobs)
+    {
+      if (j->dependencies == 0)
+      {
+        m_ready->push(j);
+      }
+    }
+
+    run_jobs();
+
+    for (auto& handle : m_handles)
+    {
+      handle.get();
+    }
+
+    m_handles.clear();
+
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  /**
+   * \brief Removes all jobs from the graph.
+   *
+   * \details The memory used by the jobs is kept, and reused by the jobs that are added
+   * after the reset.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    for (auto* j : m_jobs)
+    {
+      j->destroy(j->callable);
+    }
+
+    m_jobs.clear();
+    m_arena.reset();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of jobs in the graph.
+   *
+   * \return the amount of jobs.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_jobs.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the graph has any jobs.
+   *
+   * \return `true` if there are no jobs; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_jobs.empty();
+  }
+
+  /**
+   * \brief Returns the amount of dependencies of a job.
+   *
+   * \param id the job that will be queried.
+   *
+   * \return the amount of jobs that must finish before the job may start.
+   *
+   * \throws cen_error if the job doesn't exist.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dependencies(const job_id id) const -> size_type
+  {
+    if (id >= m_jobs.size())
+    {
+      throw cen_error{"Invalid job identifier!"};
+    }
+
+    return m_jobs[id]->dependencies;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct dependent;
+
+  struct job final
+  {
+    void* callable{};
+    void (*invoke)(void*){};
+    void (*destroy)(void*) noexcept {};
+    dependent* dependents{};
+    size_type dependencies{};
+    std::atomic<size_type> remaining{};
+  };
+
+  // The jobs that depend on a job form a singly linked list, stored in the arena
+  struct dependent final
+  {
+    job* target{};
+    dependent* next{};
+  };
+
+  detail::frame_arena m_arena;
+  std::vector<job*> m_jobs;
+  std::unique_ptr<mpmc_queue<job*>> m_ready;
+  std::vector<task_handle<void>> m_handles;
+  std::atomic<size_type> m_unfinished{};
+  std::atomic<bool> m_failed{};
+  std::exception_ptr m_error;
+  size_type m_runners{};
+
+  void link(const job_id from, const job_id to)
+  {
+    auto* source = m_jobs[from];
+    auto* target = m_jobs[to];
+
+    auto* memory = m_arena.allocate(sizeof(dependent), alignof(dependent));
+    source->dependents = ::new (memory) dependent{target, source->dependents};
+
+    ++target->dependencies;
+  }
+
+  void run_jobs()
+  {
+    for (;;)
+    {
+      job* next{};
+      m_ready->pop(next);
+
+      if (!next)
+      {
+        break;
+      }
+
+      // Continue with a dependent job directly, instead of going through the queue
+      while (next)
+      {
+        next = execute(*next);
+      }
+    }
+  }
+
+  // Runs a job and returns one of the jobs that became ready, if there are any
+  auto execute(job& current) -> job*
+  {
+    if (!m_failed.load(std::memory_order_relaxed))
+    {
+      try
+      {
+        current.invoke(current.callable);
+      }
+      catch (...)
+      {
+        if (!m_failed.exchange(true, std::memory_order_acq_rel))
+        {
+          m_error = std::current_exception();
+        }
+      }
+    }
+
+    job* continuation{};
+    for (auto* d = current.dependents; d; d = d->next)
+    {
+      if (d->target->remaining.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+      {
+        if (continuation)
+        {
+          m_ready->push(d->target);
+        }
+        else
+        {
+          continuation = d->target;
+        }
+      }
+    }
+
+    // The last job stops all runners, the dependents have been counted as unfinished
+    if (m_unfinished.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+    {
+      for (size_type index = 0; index < m_runners; ++index)
+      {
+        m_ready->push(nullptr);
+      }
+    }
+
+    return continuation;
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_JOB_GRAPH_HEADER
@@ -0,0 +1,335 @@
+#ifndef CENTURION_MPMC_QUEUE_HEADER
+#define CENTURION_MPMC_QUEUE_HEADER
+
+#include <SDL.h>
+
+#include <atomic>       // atomic, memory_order_...
+#include <cstddef>      // size_t, ptrdiff_t
+#include <memory>       // unique_ptr, make_unique
+#include <new>          // placement new, launder
+#include <type_traits>  // is_nothrow_move_constructible_v, ...
+#include <utility>      // forward, move
+
+#include "../detail/queue_waiter.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class mpmc_queue
+ *
+ * \brief A bounded lock-free queue that any amount of threads may push to and pop from.
+ *
+ * \details Every slot of the ring buffer has a sequence counter, which tells producers
+ * and consumers whether the slot is free or holds a value, so threads only contend on
+ * the index that they advance. The buffer is allocated once, when the queue is created.
+ * \code{cpp}
+ *   cen::mpmc_queue<load_request> requests{256};
+ *
+ *   // Any thread
+ *   requests.push(load_request{"texture.png"});
+ *
+ *   // Loader threads
+ *   load_request request;
+ *   requests.pop(request);  // Sleeps until there is a request
+ * \endcode
+ *
+ * \note The blocking functions spin briefly, and then sleep on a semaphore until another
+ * thread changes the queue, so idle threads don't consume CPU time.
+ *
+ * \tparam T the type of the values, which must be nothrow move constructible.
+ *
+ * \see `spsc_queue`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class mpmc_queue final
+{
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "Values must be nothrow move constructible!");
+
+  static_assert(std::is_nothrow_destructible_v<T>,
+                "Values must be nothrow destructible!");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty queue.
+   *
+   * \param capacity the maximum amount of values in the queue, which is rounded up to the
+   * next power of two, at least two.
+   *
+   * \throws sdl_error if the semaphores used by the blocking functions can't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit mpmc_queue(const size_type capacity = 1'024)
+      : m_capacity{round_capacity(capacity)}
+      , m_cells{std::make_unique<cell[]>(m_capacity)}
+  {
+    for (size_type index = 0; index < m_capacity; ++index)
+    {
+      m_cells[index].sequence.store(index, std::memory_order_relaxed);
+    }
+  }
+
+  mpmc_queue(const mpmc_queue&) = delete;
+
+  auto operator=(const mpmc_queue&) -> mpmc_queue& = delete;
+
+  ~mpmc_queue() noexcept
+  {
+    while (try_consume([](T&) noexcept {}))
+    {}
+  }
+
+  /**
+   * \brief Attempts to add a value to the queue, from any thread.
+   *
+   * \details If the constructor of the value might throw, the value is constructed
+   * before a slot is claimed, so that an exception leaves the queue untouched.
+   *
+   * \param args the arguments that will be forwarded to the constructor of the value.
+   *
+   * \return `true` if the value was added; `false` if the queue was full.
+   *
+   * \since 6.1.0
+   */
+  template <typename... Args>
+  auto try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+      -> bool
+  {
+    if constexpr (std::is_nothrow_constructible_v<T, Args...>)
+    {
+      auto* target = claim(m_enqueue, 0);
+      if (!target)
+      {
+        return false;
+      }
+
+      ::new (static_cast<void*>(target->storage)) T(std::forward<Args>(args)...);
+      publish(*target, 0);
+
+      return true;
+    }
+    else
+    {
+      T value(std::forward<Args>(args)...);
+      return try_emplace(std::move(value));
+    }
+  }
+
+  /// \copydoc try_emplace()
+  auto try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) -> bool
+  {
+    return try_emplace(value);
+  }
+
+  /// \copydoc try_emplace()
+  auto try_push(T&& value) noexcept -> bool
+  {
+    return try_emplace(std::move(value));
+  }
+
+  /**
+   * \brief Adds a value to the queue, blocking while the queue is full.
+   *
+   * \param value the value that will be added.
+   *
+   * \since 6.1.0
+   */
+  void push(T value)
+  {
+    m_notFull.wait_until([&] { return try_emplace(std::move(value)); });
+  }
+
+  /**
+   * \brief Attempts to remove the value at the front of the queue, from any thread.
+   *
+   * \param[out] value the value that will be assigned the removed value.
+   *
+   * \return `true` if a value was removed; `false` if the queue was empty.
+   *
+   * \since 6.1.0
+   */
+  auto try_pop(T& value) noexcept(std::is_nothrow_move_assignable_v<T>) -> bool
+  {
+    return try_consume([&](T& element) { value = std::move(element); });
+  }
+
+  /**
+   * \brief Attempts to remove the value at the front of the queue, invoking a function
+   * object with the value before it's destroyed, from any thread.
+   *
+   * \details This avoids moving the value out of the queue, and is useful for values that
+   * aren't default constructible.
+   *
+   * \tparam Function the type of the function object, invocable with `T&`.
+   *
+   * \param function the function object that will receive the value.
+   *
+   * \return `true` if a value was removed; `false` if the queue was empty.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  auto try_consume(Function&& function) -> bool
+  {
+    auto* source = claim(m_dequeue, 1);
+    if (!source)
+    {
+      return false;
+    }
+
+    auto* element = std::launder(reinterpret_cast<T*>(source->storage));
+
+    // The cell is released even if the function throws
+    struct release_guard final
+    {
+      mpmc_queue& queue;
+      cell& source;
+      T* element;
+
+      ~release_guard() noexcept
+      {
+        element->~T();
+        queue.publish(source, 1);
+      }
+    } guard{*this, *source, element};
+
+    function(*element);
+    return true;
+  }
+
+  /**
+   * \brief Removes the value at the front of the queue, blocking while the queue is
+   * empty.
+   *
+   * \param[out] value the value that will be assigned the removed value.
+   *
+   * \since 6.1.0
+   */
+  void pop(T& value)
+  {
+    m_notEmpty.wait_until([&] { return try_pop(value); });
+  }
+
+  /**
+   * \brief Returns the maximum amount of values in the queue.
+   *
+   * \return the capacity of the queue.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> size_type
+  {
+    return m_capacity;
+  }
+
+  /**
+   * \brief Returns an approximation of the amount of values in the queue.
+   *
+   * \return the approximate amount of values, which might be outdated immediately.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size_approx() const noexcept -> size_type
+  {
+    const auto enqueue = m_enqueue.load(std::memory_order_relaxed);
+    const auto dequeue = m_dequeue.load(std::memory_order_relaxed);
+    return (enqueue > dequeue) ? enqueue - dequeue : 0u;
+  }
+
+ private:
+  struct cell final
+  {
+    std::atomic<size_type> sequence{};
+    alignas(T) unsigned char storage[sizeof(T)];
+  };
+
+  inline static constexpr size_type cache_line = 64;
+
+  // The indices are kept on separate cache lines to avoid false sharing
+  alignas(cache_line) std::atomic<size_type> m_enqueue{};
+  alignas(cache_line) std::atomic<size_type> m_dequeue{};
+  alignas(cache_line) size_type m_capacity{};
+  std::unique_ptr<cell[]> m_cells;
+  detail::queue_waiter m_notEmpty;
+  detail::queue_waiter m_notFull;
+
+  [[nodiscard]] static auto round_capacity(const size_type capacity) noexcept
+      -> size_type
+  {
+    size_type result = 2;
+    while (result < capacity)
+    {
+      result *= 2u;
+    }
+
+    return result;
+  }
+
+  /*
+   * Claims the next cell of the specified index, where the cell is ready if its sequence
+   * equals the position plus the offset. Producers use an offset of zero (the cell is
+   * free), and consumers use an offset of one (the cell holds a value).
+   */
+  [[nodiscard]] auto claim(std::atomic<size_type>& index, const size_type offset) noexcept
+      -> cell*
+  {
+    auto position = index.load(std::memory_order_relaxed);
+    for (;;)
+    {
+      auto* target = &m_cells[position & (m_capacity - 1u)];
+
+      const auto sequence = target->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                        static_cast<std::ptrdiff_t>(position + offset);
+
+      if (diff == 0)
+      {
+        if (index.compare_exchange_weak(position,
+                                        position + 1u,
+                                        std::memory_order_relaxed))
+        {
+          return target;
+        }
+      }
+      else if (diff < 0)
+      {
+        return nullptr;  // The queue is full (producers) or empty (consumers)
+      }
+      else
+      {
+        position = index.load(std::memory_order_relaxed);  // Another thread was faster
+      }
+    }
+  }
+
+  // Hands over a claimed cell to the other side, with the offset used to claim it
+  void publish(cell& target, const size_type offset) noexcept
+  {
+    const auto position = target.sequence.load(std::memory_order_relaxed);
+    if (offset == 0)
+    {
+      target.sequence.store(position + 1u, std::memory_order_release);
+      m_notEmpty.notify();
+    }
+    else
+    {
+      target.sequence.store(position - 1u + m_capacity, std::memory_order_release);
+      m_notFull.notify();
+    }
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_MPMC_QUEUE_HEADER
@@ -0,0 +1,285 @@
+#ifndef CENTURION_PARALLEL_HEADER
+#define CENTURION_PARALLEL_HEADER
+
+#include <cstddef>      // size_t
+#include <exception>    // exception_ptr, current_exception, rethrow_exception
+#include <limits>       // numeric_limits
+#include <type_traits>  // is_integral_v, is_invocable_v
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "../system/cpu.hpp"
+#include "thread_pool.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+inline constexpr std::size_t chunks_per_worker = 4;
+
+// Returns the size of the chunks that an index range is split into
+template <typename Index>
+[[nodiscard]] auto chunk_size(const thread_pool& pool,
+                              const Index count,
+                              const Index grain) noexcept -> Index
+{
+  if (grain > 0)
+  {
+    return grain;
+  }
+
+  // The divisions are rounded up without adding to the count, which could overflow
+  const auto chunks = static_cast<Index>(pool.size() * chunks_per_worker);
+  auto size = static_cast<Index>(count / chunks + (count % chunks != 0));
+
+  // Chunks are multiples of the cache line size, so that chunks of byte-sized (or
+  // larger) elements don't share cache lines, provided that the first element is aligned
+  const auto line = static_cast<Index>(cpu::cache_line_size());
+  if (line > 0 && size % line != 0 && size <= (std::numeric_limits<Index>::max)() - line)
+  {
+    size = static_cast<Index>(size + (line - size % line));
+  }
+
+  return (size > 0) ? size : Index{1};
+}
+
+// Invokes a function with either a subrange, or every index of the subrange
+template <typename Index, typename Function>
+void invoke_chunk(Function& function, const Index first, const Index last)
+{
+  if constexpr (std::is_invocable_v<Function&, Index, Index>)
+  {
+    function(first, last);
+  }
+  else
+  {
+    for (auto index = first; index < last; ++index)
+    {
+      function(index);
+    }
+  }
+}
+
+// Splits a range into chunks, where all but the first chunk are submitted to the pool
+template <typename Index, typename Chunk>
+void run_chunks(thread_pool& pool,
+                const Index begin,
+                const Index end,
+                const Index grain,
+                Chunk&& chunk)
+{
+  if (begin >= end)
+  {
+    return;
+  }
+
+  const auto count = static_cast<Index>(end - begin);
+  const auto size = chunk_size(pool, count, grain);
+
+  std::vector<task_handle<void>> handles;
+  handles.reserve(static_cast<std::size_t>(count / size + (count % size != 0)));
+
+  try
+  {
+    // The bounds are computed from the remaining count, so that they can't overflow
+    auto first = (count > size) ? static_cast<Index>(begin + size) : end;
+    for (std::size_t index = 1; first != end; ++index)
+    {
+      const auto last = (end - first > size) ? static_cast<Index>(first + size) : end;
+      handles.push_back(pool.submit([&chunk, index, first, last] {
+        chunk(index, first, last);
+      }));
+
+      first = last;
+    }
+  }
+  catch (...)
+  {
+    // The submitted chunks refer to the function object, so they must finish first
+    for (const auto& handle : handles)
+    {
+      handle.wait();
+    }
+
+    throw;
+  }
+
+  std::exception_ptr error;
+
+  try
+  {
+    // The calling thread processes the first chunk instead of waiting idly
+    const auto last = (count > size) ? static_cast<Index>(begin + size) : end;
+    chunk(std::size_t{0}, begin, last);
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  // All chunks must finish before returning, since they refer to the function objects
+  for (auto& handle : handles)
+  {
+    try
+    {
+      handle.get();
+    }
+    catch (...)
+    {
+      if (!error)
+      {
+        error = std::current_exception();
+      }
+    }
+  }
+
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+}
+
+template <typename T>
+struct alignas(64) padded_value final
+{
+  T value;
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Invokes a function for all indices in a range, using a thread pool.
+ *
+ * \details The range is split into chunks that are processed by the workers of the pool,
+ * and by the calling thread. The function object is either invoked with every index, or
+ * with the bounds of each chunk, if it accepts two indices. The latter lets the compiler
+ * vectorize the inner loop.
+ * \code{cpp}
+ *   cen::parallel_for(pool, 0, count, 0, [&](const int first, const int last) {
+ *     for (auto i = first; i < last; ++i) {
+ *       positions[i] += velocities[i] * dt;
+ *     }
+ *   });
+ * \endcode
+ *
+ * \note This function blocks until the entire range has been processed. Any exception
+ * thrown by the function object is rethrown, once all chunks have finished.
+ *
+ * \tparam Index the type of the indices, must be an integral type.
+ * \tparam Function the type of the function object, invocable with either `Index` or
+ * `(Index, Index)`.
+ *
+ * \param pool the thread pool that will be used.
+ * \param begin the first index of the range.
+ * \param end the index one past the last index of the range.
+ * \param grain the amount of indices per chunk, zero selects a chunk size based on the
+ * amount of workers and the cache line size.
+ * \param function the function object that will be invoked.
+ *
+ * \since 6.1.0
+ */
+template <typename Index, typename Function>
+void parallel_for(thread_pool& pool,
+                  const Index begin,
+                  const Index end,
+                  const Index grain,
+                  Function&& function)
+{
+  static_assert(std::is_integral_v<Index>, "Indices must be integers!");
+
+  detail::run_chunks(pool,
+                     begin,
+                     end,
+                     grain,
+                     [&function](std::size_t, const Index first, const Index last) {
+                       detail::invoke_chunk(function, first, last);
+                     });
+}
+
+/**
+ * \brief Reduces a range of indices to a single value, using a thread pool.
+ *
+ * \details Every chunk of the range is reduced to a partial result, starting from the
+ * supplied initial value, which are then combined on the calling thread in the order of
+ * the chunks. As a result, the same chunk size always yields the same result, even for
+ * floating-point values. The partial results are stored on separate cache lines.
+ * \code{cpp}
+ *   const auto total = cen::parallel_reduce(
+ *       pool, std::size_t{0}, values.size(), std::size_t{0}, 0.0,
+ *       [&](const std::size_t first, const std::size_t last, double sum) {
+ *         for (auto i = first; i < last; ++i) {
+ *           sum += values[i];
+ *         }
+ *         return sum;
+ *       },
+ *       std::plus<>{});
+ * \endcode
+ *
+ * \tparam Index the type of the indices, must be an integral type.
+ * \tparam T the type of the result.
+ * \tparam Function the type of the function object that reduces a chunk, invocable as
+ * `T(Index first, Index last, T initial)`.
+ * \tparam Reduce the type of the function object that combines results, invocable as
+ * `T(T, T)`.
+ *
+ * \param pool the thread pool that will be used.
+ * \param begin the first index of the range.
+ * \param end the index one past the last index of the range.
+ * \param grain the amount of indices per chunk, zero selects a chunk size automatically.
+ * \param identity the initial value of every chunk, e.g. zero for sums.
+ * \param function the function object that reduces a chunk.
+ * \param reduce the function object that combines two partial results.
+ *
+ * \return the combined result, or `identity` if the range is empty.
+ *
+ * \since 6.1.0
+ */
+template <typename Index, typename T, typename Function, typename Reduce>
+[[nodiscard]] auto parallel_reduce(thread_pool& pool,
+                                   const Index begin,
+                                   const Index end,
+                                   const Index grain,
+                                   const T& identity,
+                                   Function&& function,
+                                   Reduce&& reduce) -> T
+{
+  static_assert(std::is_integral_v<Index>, "Indices must be integers!");
+
+  if (begin >= end)
+  {
+    return identity;
+  }
+
+  const auto count = static_cast<Index>(end - begin);
+  const auto size = detail::chunk_size(pool, count, grain);
+  const auto chunks = static_cast<std::size_t>((count + size - 1) / size);
+
+  std::vector<detail::padded_value<T>> partial(chunks, detail::padded_value<T>{identity});
+
+  detail::run_chunks(pool,
+                     begin,
+                     end,
+                     size,
+                     [&](const std::size_t index, const Index first, const Index last) {
+                       partial[index].value = function(first, last, identity);
+                     });
+
+  auto result = std::move(partial[0].value);
+  for (std::size_t index = 1; index < chunks; ++index)
+  {
+    result = reduce(std::move(result), std::move(partial[index].value));
+  }
+
+  return result;
+}
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_PARALLEL_HEADER
@@ -17,6 +17,9 @@ namespace cen {
  * \brief Represents an RAII-style blocking lock that automatically unlocks the associated
  * mutex upon destruction.
  *
+ * \details Any mutex type with `lock()` and `unlock()` functions can be used, such as
+ * `mutex`, `spin_mutex` and `shared_mutex`.
+ *
  * \remarks This class is purposefully similar to `std::scoped_lock`.
  *
  * \since 5.0.0
@@ -27,13 +30,18 @@ class scoped_lock final
   /**
    * \brief Attempts to lock the supplied mutex.
    *
+   * \tparam Mutex the type of the mutex, e.g. `mutex` or `spin_mutex`.
+   *
    * \param mutex the mutex that will be locked.
    *
    * \throws sdl_error if the mutex can't be locked.
    *
    * \since 5.0.0
    */
-  explicit scoped_lock(mutex& mutex) : m_mutex{&mutex}
+  template <typename Mutex>
+  explicit scoped_lock(Mutex& mutex)
+      : m_mutex{&mutex}
+      , m_unlock{&unlock_mutex<Mutex>}
   {
     if (!mutex.lock())
     {
@@ -52,11 +60,18 @@ class scoped_lock final
    */
   ~scoped_lock() noexcept
   {
-    m_mutex->unlock();
+    m_unlock(m_mutex);
   }
 
  private:
-  mutex* m_mutex{};
+  void* m_mutex{};
+  void (*m_unlock)(void*) noexcept {};
+
+  template <typename Mutex>
+  static void unlock_mutex(void* mutex) noexcept
+  {
+    static_cast<Mutex*>(mutex)->unlock();
+  }
 };
 
 /// \} End of group thread
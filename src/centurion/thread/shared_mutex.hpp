@@ -0,0 +1,274 @@
+#ifndef CENTURION_SHARED_MUTEX_HEADER
+#define CENTURION_SHARED_MUTEX_HEADER
+
+#include <SDL.h>
+
+#include <atomic>  // atomic, memory_order_...
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/spin_backoff.hpp"
+#include "mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class shared_mutex
+ *
+ * \brief A spinning reader-writer lock, for data that is read by many threads but only
+ * rarely written.
+ *
+ * \details Any amount of threads may hold a shared lock at the same time, whereas an
+ * exclusive lock excludes all other threads. Waiting writers take precedence over new
+ * readers, so that writers can't be starved. Like `spin_mutex`, this mutex spins instead
+ * of blocking, so it should only protect short critical sections.
+ *
+ * \details `scoped_lock` and `try_lock` acquire exclusive locks, and `shared_lock`
+ * acquires shared locks.
+ * \code{cpp}
+ *   cen::shared_mutex mutex;
+ *
+ *   {
+ *     cen::shared_lock lock{mutex};  // Reader
+ *     // ...
+ *   }
+ *
+ *   {
+ *     cen::scoped_lock lock{mutex};  // Writer
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note This mutex isn't recursive, and shared locks can't be upgraded.
+ *
+ * \since 6.1.0
+ *
+ * \see `shared_lock`
+ * \see `spin_mutex`
+ */
+class shared_mutex final
+{
+ public:
+  /**
+   * \brief Creates an unlocked mutex.
+   *
+   * \since 6.1.0
+   */
+  shared_mutex() noexcept = default;
+
+  shared_mutex(const shared_mutex&) = delete;
+
+  auto operator=(const shared_mutex&) -> shared_mutex& = delete;
+
+  /// \name Exclusive locking
+  /// \{
+
+  /**
+   * \brief Acquires an exclusive lock, spins while any other lock is held.
+   *
+   * \return always `success`.
+   *
+   * \since 6.1.0
+   */
+  auto lock() noexcept -> result
+  {
+    detail::spin_backoff backoff;
+    for (;;)
+    {
+      auto state = m_state.load(std::memory_order_relaxed);
+      if ((state & ~writer_pending) == 0)
+      {
+        if (m_state.compare_exchange_weak(state, writer, std::memory_order_acquire))
+        {
+          return success;
+        }
+      }
+      else if (!(state & writer_pending))
+      {
+        // Stops new readers from entering, so that the lock is eventually released
+        m_state.fetch_or(writer_pending, std::memory_order_relaxed);
+      }
+
+      backoff();
+    }
+  }
+
+  /**
+   * \brief Attempts to acquire an exclusive lock, without spinning.
+   *
+   * \return `success` if the lock was acquired; `timed_out` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto try_lock() noexcept -> lock_status
+  {
+    auto state = m_state.load(std::memory_order_relaxed);
+    if ((state & ~writer_pending) == 0 &&
+        m_state.compare_exchange_strong(state, writer, std::memory_order_acquire))
+    {
+      return lock_status::success;
+    }
+    else
+    {
+      return lock_status::timed_out;
+    }
+  }
+
+  /**
+   * \brief Releases an exclusive lock.
+   *
+   * \return always `success`.
+   *
+   * \since 6.1.0
+   */
+  auto unlock() noexcept -> result
+  {
+    m_state.fetch_and(~writer, std::memory_order_release);
+    return success;
+  }
+
+  /// \} End of exclusive locking
+
+  /// \name Shared locking
+  /// \{
+
+  /**
+   * \brief Acquires a shared lock, spins while an exclusive lock is held or requested.
+   *
+   * \return always `success`.
+   *
+   * \since 6.1.0
+   */
+  auto lock_shared() noexcept -> result
+  {
+    detail::spin_backoff backoff;
+    while (try_lock_shared() != lock_status::success)
+    {
+      backoff();
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Attempts to acquire a shared lock, without spinning.
+   *
+   * \return `success` if the lock was acquired; `timed_out` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto try_lock_shared() noexcept -> lock_status
+  {
+    auto state = m_state.load(std::memory_order_relaxed);
+    while (!(state & (writer | writer_pending)))
+    {
+      if (m_state.compare_exchange_weak(state, state + reader, std::memory_order_acquire))
+      {
+        return lock_status::success;
+      }
+    }
+
+    return lock_status::timed_out;
+  }
+
+  /**
+   * \brief Releases a shared lock.
+   *
+   * \return always `success`.
+   *
+   * \since 6.1.0
+   */
+  auto unlock_shared() noexcept -> result
+  {
+    m_state.fetch_sub(reader, std::memory_order_release);
+    return success;
+  }
+
+  /// \} End of shared locking
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of threads that hold a shared lock.
+   *
+   * \return the current amount of readers.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto readers() const noexcept -> u32
+  {
+    return m_state.load(std::memory_order_relaxed) / reader;
+  }
+
+  /**
+   * \brief Indicates whether or not an exclusive lock is held.
+   *
+   * \return `true` if a writer holds the lock; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_locked() const noexcept -> bool
+  {
+    return m_state.load(std::memory_order_relaxed) & writer;
+  }
+
+  /// \} End of queries
+
+ private:
+  // The lowest bits are flags, and the remaining bits hold the amount of readers
+  inline static constexpr u32 writer = 1u;
+  inline static constexpr u32 writer_pending = 2u;
+  inline static constexpr u32 reader = 4u;
+
+  std::atomic<u32> m_state{0};
+};
+
+/**
+ * \class shared_lock
+ *
+ * \brief An RAII-style lock that holds a shared lock of a `shared_mutex`.
+ *
+ * \since 6.1.0
+ */
+class shared_lock final
+{
+ public:
+  /**
+   * \brief Acquires a shared lock of the supplied mutex.
+   *
+   * \param mutex the mutex that will be locked, must outlive the lock.
+   *
+   * \since 6.1.0
+   */
+  explicit shared_lock(shared_mutex& mutex) noexcept : m_mutex{&mutex}
+  {
+    m_mutex->lock_shared();
+  }
+
+  shared_lock(const shared_lock&) = delete;
+
+  auto operator=(const shared_lock&) -> shared_lock& = delete;
+
+  /**
+   * \brief Releases the shared lock.
+   *
+   * \since 6.1.0
+   */
+  ~shared_lock() noexcept
+  {
+    m_mutex->unlock_shared();
+  }
+
+ private:
+  shared_mutex* m_mutex{};
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_SHARED_MUTEX_HEADER
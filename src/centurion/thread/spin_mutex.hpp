@@ -0,0 +1,134 @@
+#ifndef CENTURION_SPIN_MUTEX_HEADER
+#define CENTURION_SPIN_MUTEX_HEADER
+
+#include <SDL.h>
+
+#include <atomic>  // atomic, memory_order_...
+
+#include "../core/result.hpp"
+#include "../detail/spin_backoff.hpp"
+#include "mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class spin_mutex
+ *
+ * \brief A lightweight mutex that spins instead of blocking in the operating system.
+ *
+ * \details Locking and unlocking an uncontended spin mutex only costs an atomic exchange
+ * and store, respectively. A contended lock spins with the CPU pause instruction and an
+ * exponential backoff, before it starts yielding the thread. As a result, spin mutexes
+ * are faster than `mutex` for short critical sections, but waste CPU time if the mutex
+ * is held for long. Spin mutexes can be used with `scoped_lock` and `try_lock`, just like
+ * `mutex`.
+ * \code{cpp}
+ *   cen::spin_mutex mutex;
+ *
+ *   {
+ *     cen::scoped_lock lock{mutex};
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note Unlike `mutex`, this mutex isn't recursive.
+ *
+ * \since 6.1.0
+ *
+ * \see `mutex`
+ * \see `shared_mutex`
+ */
+class spin_mutex final
+{
+ public:
+  /**
+   * \brief Creates an unlocked mutex.
+   *
+   * \since 6.1.0
+   */
+  spin_mutex() noexcept = default;
+
+  spin_mutex(const spin_mutex&) = delete;
+
+  auto operator=(const spin_mutex&) -> spin_mutex& = delete;
+
+  /**
+   * \brief Locks the mutex, spins if the mutex isn't available.
+   *
+   * \return always `success`.
+   *
+   * \since 6.1.0
+   */
+  auto lock() noexcept -> result
+  {
+    detail::spin_backoff backoff;
+
+    // The flag is only read while waiting, which avoids moving the cache line around
+    while (m_locked.exchange(true, std::memory_order_acquire))
+    {
+      while (m_locked.load(std::memory_order_relaxed))
+      {
+        backoff();
+      }
+    }
+
+    return success;
+  }
+
+  /**
+   * \brief Attempts to lock the mutex, returns if the mutex isn't available.
+   *
+   * \return `success` if the mutex was locked; `timed_out` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto try_lock() noexcept -> lock_status
+  {
+    if (!m_locked.load(std::memory_order_relaxed) &&
+        !m_locked.exchange(true, std::memory_order_acquire))
+    {
+      return lock_status::success;
+    }
+    else
+    {
+      return lock_status::timed_out;
+    }
+  }
+
+  /**
+   * \brief Unlocks the mutex.
+   *
+   * \return always `success`.
+   *
+   * \since 6.1.0
+   */
+  auto unlock() noexcept -> result
+  {
+    m_locked.store(false, std::memory_order_release);
+    return success;
+  }
+
+  /**
+   * \brief Indicates whether or not the mutex is currently locked by any thread.
+   *
+   * \return `true` if the mutex is locked; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_locked() const noexcept -> bool
+  {
+    return m_locked.load(std::memory_order_relaxed);
+  }
+
+ private:
+  std::atomic<bool> m_locked{false};
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_SPIN_MUTEX_HEADER
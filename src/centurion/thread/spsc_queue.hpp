@@ -0,0 +1,250 @@
+#ifndef CENTURION_SPSC_QUEUE_HEADER
+#define CENTURION_SPSC_QUEUE_HEADER
+
+#include <SDL.h>
+
+#include <atomic>       // atomic, memory_order_...
+#include <cstddef>      // size_t
+#include <new>          // placement new, launder
+#include <type_traits>  // is_nothrow_move_constructible_v, ...
+#include <utility>      // forward, move
+
+#include "../detail/queue_waiter.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class spsc_queue
+ *
+ * \brief A bounded lock-free queue for passing values from one thread to another.
+ *
+ * \details Exactly one thread may push values, and exactly one other thread may pop
+ * them. In return, pushing and popping only cost a couple of atomic loads and stores,
+ * without any read-modify-write operations. The storage is part of the queue object, so
+ * the queue never allocates memory.
+ * \code{cpp}
+ *   cen::spsc_queue<audio_chunk, 64> chunks;
+ *
+ *   // Decoder thread
+ *   chunks.push(decode_next());  // Blocks if the queue is full
+ *
+ *   // Audio thread
+ *   audio_chunk chunk;
+ *   if (chunks.try_pop(chunk)) {
+ *     // ...
+ *   }
+ * \endcode
+ *
+ * \note The blocking functions spin briefly, and then sleep on a semaphore until the
+ * other thread changes the queue, so idle threads don't consume CPU time.
+ *
+ * \tparam T the type of the values, which must be nothrow move constructible.
+ * \tparam Capacity the maximum amount of values in the queue, must be a power of two.
+ *
+ * \see `mpmc_queue`
+ *
+ * \since 6.1.0
+ */
+template <typename T, std::size_t Capacity>
+class spsc_queue final
+{
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1u)) == 0,
+                "The capacity must be a power of two!");
+
+  static_assert(std::is_nothrow_move_constructible_v<T>,
+                "Values must be nothrow move constructible!");
+
+  static_assert(std::is_nothrow_destructible_v<T>,
+                "Values must be nothrow destructible!");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty queue.
+   *
+   * \throws sdl_error if the semaphores used by the blocking functions can't be created.
+   *
+   * \since 6.1.0
+   */
+  spsc_queue()  // The storage is deliberately left uninitialized
+  {}
+
+  spsc_queue(const spsc_queue&) = delete;
+
+  auto operator=(const spsc_queue&) -> spsc_queue& = delete;
+
+  ~spsc_queue() noexcept
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    for (auto head = m_head.load(std::memory_order_relaxed); head != tail; ++head)
+    {
+      slot(head)->~T();
+    }
+  }
+
+  /**
+   * \brief Attempts to add a value to the queue, from the producer thread only.
+   *
+   * \param args the arguments that will be forwarded to the constructor of the value.
+   *
+   * \return `true` if the value was added; `false` if the queue was full.
+   *
+   * \since 6.1.0
+   */
+  template <typename... Args>
+  auto try_emplace(Args&&... args) noexcept(std::is_nothrow_constructible_v<T, Args...>)
+      -> bool
+  {
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+
+    if (tail - m_cachedHead == Capacity)
+    {
+      // The cached index is only refreshed when the queue seems to be full
+      m_cachedHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_cachedHead == Capacity)
+      {
+        return false;
+      }
+    }
+
+    auto* target = m_storage[tail & mask].bytes;
+    ::new (static_cast<void*>(target)) T(std::forward<Args>(args)...);
+
+    m_tail.store(tail + 1u, std::memory_order_release);
+    m_notEmpty.notify();
+
+    return true;
+  }
+
+  /// \copydoc try_emplace()
+  auto try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>) -> bool
+  {
+    return try_emplace(value);
+  }
+
+  /// \copydoc try_emplace()
+  auto try_push(T&& value) noexcept -> bool
+  {
+    return try_emplace(std::move(value));
+  }
+
+  /**
+   * \brief Adds a value to the queue, blocking while the queue is full.
+   *
+   * \param value the value that will be added.
+   *
+   * \since 6.1.0
+   */
+  void push(T value)
+  {
+    m_notFull.wait_until([&] { return try_emplace(std::move(value)); });
+  }
+
+  /**
+   * \brief Attempts to remove the value at the front of the queue, from the consumer
+   * thread only.
+   *
+   * \param[out] value the value that will be assigned the removed value.
+   *
+   * \return `true` if a value was removed; `false` if the queue was empty.
+   *
+   * \since 6.1.0
+   */
+  auto try_pop(T& value) noexcept(std::is_nothrow_move_assignable_v<T>) -> bool
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cachedTail)
+    {
+      m_cachedTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_cachedTail)
+      {
+        return false;
+      }
+    }
+
+    auto* element = slot(head);
+
+    value = std::move(*element);
+    element->~T();
+
+    m_head.store(head + 1u, std::memory_order_release);
+    m_notFull.notify();
+
+    return true;
+  }
+
+  /**
+   * \brief Removes the value at the front of the queue, blocking while the queue is
+   * empty.
+   *
+   * \param[out] value the value that will be assigned the removed value.
+   *
+   * \since 6.1.0
+   */
+  void pop(T& value)
+  {
+    m_notEmpty.wait_until([&] { return try_pop(value); });
+  }
+
+  /**
+   * \brief Returns the maximum amount of values in the queue.
+   *
+   * \return the capacity of the queue.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto capacity() noexcept -> size_type
+  {
+    return Capacity;
+  }
+
+  /**
+   * \brief Returns an approximation of the amount of values in the queue.
+   *
+   * \return the approximate amount of values, which might be outdated immediately.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size_approx() const noexcept -> size_type
+  {
+    const auto head = m_head.load(std::memory_order_relaxed);
+    const auto tail = m_tail.load(std::memory_order_relaxed);
+    return (tail > head) ? tail - head : 0u;
+  }
+
+ private:
+  inline static constexpr size_type cache_line = 64;
+  inline static constexpr size_type mask = Capacity - 1u;
+
+  struct storage final
+  {
+    alignas(T) unsigned char bytes[sizeof(T)];
+  };
+
+  // The indices are kept on separate cache lines along with the cached index of the other
+  // thread, which avoids false sharing as well as reading the other index on every call
+  alignas(cache_line) std::atomic<size_type> m_head{0};  // Written by the consumer
+  size_type m_cachedTail{0};
+  alignas(cache_line) std::atomic<size_type> m_tail{0};  // Written by the producer
+  size_type m_cachedHead{0};
+  alignas(cache_line) storage m_storage[Capacity];
+  detail::queue_waiter m_notEmpty;
+  detail::queue_waiter m_notFull;
+
+  [[nodiscard]] auto slot(const size_type index) noexcept -> T*
+  {
+    return std::launder(reinterpret_cast<T*>(m_storage[index & mask].bytes));
+  }
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_SPSC_QUEUE_HEADER
@@ -4,17 +4,24 @@
 #include <SDL.h>
 
 #include <cassert>  // assert
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
+#if defined(__linux__)
+#include <sched.h>  // sched_setaffinity, cpu_set_t
+#elif defined(_WIN32)
+#include "../detail/windows_api.hpp"  // SetThreadAffinityMask, GetCurrentThread
+#endif
+
 #include "../core/czstring.hpp"
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/not_null.hpp"
 #include "../core/result.hpp"
 #include "../core/time.hpp"
-#include "../detail/address_of.hpp"
-#include "../detail/to_string.hpp"
+#include "../detail/format_writer.hpp"
+#include "../system/cpu_topology.hpp"
 
 namespace cen {
 
@@ -154,6 +161,53 @@ class thread final
     return SDL_SetThreadPriority(prio) == 0;
   }
 
+  /**
+   * \brief Restricts the current thread to a set of logical CPU cores.
+   *
+   * \details Pinning latency-sensitive threads, e.g. the render and audio threads, to
+   * different physical cores avoids them interrupting each other.
+   * \code{cpp}
+   *   const auto topology = cen::cpu_topology::query();
+   *   cen::thread::set_affinity(topology.siblings(0));
+   * \endcode
+   *
+   * \note Thread affinity is only supported on Linux and Windows, this function always
+   * fails on other platforms.
+   *
+   * \param mask the logical cores that the thread may run on, must not be empty.
+   *
+   * \return `success` if the affinity was successfully set; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  static auto set_affinity(const core_mask mask) noexcept -> result
+  {
+    if (mask.empty())
+    {
+      return failure;
+    }
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    for (int core = 0; core < core_mask::max_cores; ++core)
+    {
+      if (mask.test(core))
+      {
+        CPU_SET(core, &set);
+      }
+    }
+
+    return sched_setaffinity(0, sizeof set, &set) == 0;
+#elif defined(_WIN32)
+    const auto bits = static_cast<DWORD_PTR>(mask.bits());
+    return SetThreadAffinityMask(GetCurrentThread(), bits) != 0;
+#else
+    return failure;
+#endif
+  }
+
   /// \name Mutators
   /// \{
 
@@ -312,6 +366,34 @@ class thread final
   bool m_detached{false};
 };
 
+/**
+ * \brief Writes a textual representation of a thread to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param thread the thread that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer, const std::size_t size, const thread& thread) noexcept
+    -> std::size_t
+{
+  // SDL_GetThreadName() doesn't modify the thread, unlike what its signature suggests
+  auto* ptr = const_cast<SDL_Thread*>(thread.get());
+
+  detail::format_writer writer{buffer, size};
+  return writer.write("thread{data: ",
+                      ptr,
+                      ", name: ",
+                      SDL_GetThreadName(ptr),
+                      ", id: ",
+                      thread.get_id(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a thread.
  *
@@ -323,8 +405,7 @@ class thread final
  */
 [[nodiscard]] inline auto to_string(const thread& thread) -> std::string
 {
-  return "thread{data: " + detail::address_of(thread.get()) + ", name: " + thread.name() +
-         ", id: " + detail::to_string(thread.get_id()).value() + "}";
+  return detail::format_string(thread);
 }
 
 /**
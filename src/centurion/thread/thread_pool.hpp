@@ -0,0 +1,645 @@
+#ifndef CENTURION_THREAD_POOL_HEADER
+#define CENTURION_THREAD_POOL_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>    // clamp
+#include <atomic>       // atomic
+#include <chrono>       // seconds
+#include <cstddef>      // size_t
+#include <deque>        // deque
+#include <future>       // future, packaged_task, future_status
+#include <memory>       // unique_ptr, make_unique
+#include <string>       // string, to_string
+#include <type_traits>  // invoke_result_t, decay_t
+#include <utility>      // move, forward
+#include <vector>       // vector
+
+#include "../core/exception.hpp"
+#include "../system/cpu.hpp"
+#include "../system/cpu_topology.hpp"
+#include "fast_condition.hpp"
+#include "fast_semaphore.hpp"
+#include "mutex.hpp"
+#include "scoped_lock.hpp"
+#include "thread.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+class thread_pool;
+
+/**
+ * \enum worker_affinity
+ *
+ * \brief Determines how the worker threads of a `thread_pool` are pinned to CPU cores.
+ *
+ * \since 6.1.0
+ *
+ * \see `thread::set_affinity()`
+ */
+enum class worker_affinity
+{
+  none,      ///< Workers may run on any core, this is the default.
+  logical,   ///< Every worker is pinned to its own logical core.
+  physical,  ///< Every worker is pinned to the logical cores of its own physical core.
+};
+
+/**
+ * \class task_handle
+ *
+ * \brief A handle to the result of a task that was submitted to a `thread_pool`.
+ *
+ * \details Unlike `std::future`, waiting for a task handle runs other pending tasks of
+ * the pool while the task isn't finished, which means that tasks may wait for tasks that
+ * they submit without deadlocking the pool.
+ *
+ * \tparam T the type of the result of the task.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class task_handle final
+{
+ public:
+  /// Creates an invalid handle.
+  task_handle() noexcept = default;
+
+  /**
+   * \brief Blocks until the task has finished.
+   *
+   * \since 6.1.0
+   */
+  void wait() const;
+
+  /**
+   * \brief Waits for the task to finish and returns its result.
+   *
+   * \details This function may only be called once.
+   *
+   * \return the value returned by the task.
+   *
+   * \throws any exception that was thrown by the task.
+   *
+   * \since 6.1.0
+   */
+  auto get() -> T
+  {
+    wait();
+    return m_future.get();
+  }
+
+  /**
+   * \brief Indicates whether or not the task has finished.
+   *
+   * \return `true` if the task has finished; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_ready() const -> bool
+  {
+    return m_future.wait_for(std::chrono::seconds{0}) == std::future_status::ready;
+  }
+
+  /**
+   * \brief Indicates whether or not the handle refers to a task.
+   *
+   * \return `true` if the handle refers to a task; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto valid() const noexcept -> bool
+  {
+    return m_future.valid();
+  }
+
+ private:
+  friend class thread_pool;
+
+  thread_pool* m_pool{};
+  std::future<T> m_future;
+
+  task_handle(thread_pool& pool, std::future<T> future) noexcept
+      : m_pool{&pool}
+      , m_future{std::move(future)}
+  {}
+};
+
+/**
+ * \class thread_pool
+ *
+ * \brief A set of worker threads that execute submitted tasks.
+ *
+ * \details Every worker has its own task queue. Tasks that are submitted from a worker
+ * are added to the queue of that worker, where they are executed in LIFO order, which
+ * is friendly to the caches. Idle workers steal tasks from the other end of the queues
+ * of other workers, so that the load is balanced. Tasks that are submitted from other
+ * threads are distributed among the workers in a round-robin fashion.
+ * \code{cpp}
+ *   cen::thread_pool pool;
+ *
+ *   auto handle = pool.submit([] { return decode("music.ogg"); });
+ *   // ...
+ *   auto samples = handle.get();
+ * \endcode
+ *
+ * \note Idle workers block on a semaphore that counts the pending tasks, so they don't
+ * consume any CPU time.
+ *
+ * \since 6.1.0
+ */
+class thread_pool final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a thread pool and starts its worker threads.
+   *
+   * \details The worker threads are named "pool-0", "pool-1", and so on. If there are
+   * more workers than cores, the cores are assigned to the workers in a round-robin
+   * fashion. Workers that cannot be pinned to their cores run on any core.
+   *
+   * \param count the amount of worker threads, defaults to the amount of CPU cores.
+   * \param priority the priority of the worker threads.
+   * \param affinity determines how the worker threads are pinned to CPU cores.
+   *
+   * \throws sdl_error if a worker thread cannot be created.
+   *
+   * \since 6.1.0
+   */
+  explicit thread_pool(const size_type count = default_size(),
+                       const thread_priority priority = thread_priority::normal,
+                       const worker_affinity affinity = worker_affinity::none)
+      : m_tasks{0}
+      , m_priority{priority}
+      , m_affinity{affinity}
+  {
+    const auto size = (count == 0) ? size_type{1} : count;
+    m_active.store(size, std::memory_order_relaxed);
+
+    m_workers.reserve(size);
+    for (size_type index = 0; index < size; ++index)
+    {
+      m_workers.push_back(std::make_unique<worker>(*this, index));
+    }
+
+    if (affinity != worker_affinity::none)
+    {
+      assign_cores();
+    }
+
+    // The threads are started once all queues exist, since workers steal from each other
+    try
+    {
+      for (auto& w : m_workers)
+      {
+        w->thread = std::make_unique<cen::thread>(&thread_pool::run,
+                                                  w->name.c_str(),
+                                                  w.get());
+      }
+    }
+    catch (...)
+    {
+      stop();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool&) = delete;
+
+  auto operator=(const thread_pool&) -> thread_pool& = delete;
+
+  /**
+   * \brief Waits for all pending tasks to finish and stops the worker threads.
+   */
+  ~thread_pool() noexcept
+  {
+    wait_idle();
+    stop();
+  }
+
+  /**
+   * \brief Submits a task that will be executed by a worker thread.
+   *
+   * \tparam Function the type of the function object.
+   *
+   * \param function the function object that will be invoked without arguments.
+   *
+   * \return a handle to the result of the task.
+   *
+   * \since 6.1.0
+   */
+  template <typename Function>
+  auto submit(Function&& function)
+      -> task_handle<std::invoke_result_t<std::decay_t<Function>&>>
+  {
+    using result_type = std::invoke_result_t<std::decay_t<Function>&>;
+
+    std::packaged_task<result_type()> task{std::forward<Function>(function)};
+    auto future = task.get_future();
+
+    enqueue(std::make_unique<task_model<std::packaged_task<result_type()>>>(
+        std::move(task)));
+
+    return task_handle<result_type>{*this, std::move(future)};
+  }
+
+  /**
+   * \brief Executes a single pending task on the calling thread, if there is one.
+   *
+   * \return `true` if a task was executed; `false` if there were no pending tasks.
+   *
+   * \since 6.1.0
+   */
+  auto run_pending_task() -> bool
+  {
+    if (m_tasks.try_acquire() != lock_status::success)
+    {
+      return false;
+    }
+
+    // There is a task in one of the queues for every acquired token
+    const auto first = is_worker_thread() ? current_worker->index : size_type{0};
+
+    std::unique_ptr<task_concept> task;
+    while (!task)
+    {
+      task = take(first);
+    }
+
+    execute(*task);
+    return true;
+  }
+
+  /**
+   * \brief Blocks until all submitted tasks have finished.
+   *
+   * \note This function must not be called from a task, since it would wait for itself.
+   *
+   * \since 6.1.0
+   */
+  void wait_idle()
+  {
+    scoped_lock lock{m_idleMutex};
+    while (m_pending.load(std::memory_order_acquire) != 0)
+    {
+      m_idle.wait(m_idleMutex);
+    }
+  }
+
+  /**
+   * \brief Limits the amount of worker threads that execute tasks.
+   *
+   * \details Workers beyond the limit are parked once they finish their current task,
+   * and wake up when the limit is raised again. Tasks that were queued for parked workers
+   * are executed by the active workers. This is useful for reducing the power usage of
+   * background work, e.g. when running on battery.
+   *
+   * \param count the amount of active workers, clamped to [1, `size()`].
+   *
+   * \since 6.1.0
+   */
+  void set_active_workers(const size_type count)
+  {
+    const auto active = std::clamp(count, size_type{1}, m_workers.size());
+
+    scoped_lock lock{m_parkMutex};
+    m_active.store(active, std::memory_order_release);
+    m_unparked.broadcast();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of worker threads that execute tasks.
+   *
+   * \return the amount of active workers, equal to `size()` unless it has been limited.
+   *
+   * \see `set_active_workers()`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto active_workers() const noexcept -> size_type
+  {
+    return m_active.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of worker threads.
+   *
+   * \return the amount of worker threads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_workers.size();
+  }
+
+  /**
+   * \brief Returns the amount of tasks that are queued or running.
+   *
+   * \return the amount of unfinished tasks.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending() const noexcept -> size_type
+  {
+    return m_pending.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the priority of the worker threads.
+   *
+   * \return the priority of the worker threads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto priority() const noexcept -> thread_priority
+  {
+    return m_priority;
+  }
+
+  /**
+   * \brief Returns how the worker threads are pinned to CPU cores.
+   *
+   * \return the affinity of the worker threads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto affinity() const noexcept -> worker_affinity
+  {
+    return m_affinity;
+  }
+
+  /**
+   * \brief Indicates whether or not the calling thread is a worker of this pool.
+   *
+   * \return `true` if the calling thread is a worker of the pool; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_worker_thread() const noexcept -> bool
+  {
+    return current_worker && current_worker->pool == this;
+  }
+
+  /**
+   * \brief Returns the default amount of worker threads.
+   *
+   * \return the amount of CPU cores, at least one.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto default_size() noexcept -> size_type
+  {
+    const auto cores = cpu::cores();
+    return (cores > 0) ? static_cast<size_type>(cores) : size_type{1};
+  }
+
+  /// \} End of queries
+
+ private:
+  struct task_concept
+  {
+    virtual ~task_concept() noexcept = default;
+
+    virtual void run() = 0;
+  };
+
+  template <typename Task>
+  struct task_model final : task_concept
+  {
+    explicit task_model(Task&& task) : task{std::move(task)}
+    {}
+
+    void run() override
+    {
+      task();  // Exceptions are stored in the future of the packaged task
+    }
+
+    Task task;
+  };
+
+  struct worker final
+  {
+    worker(thread_pool& pool, const size_type index)
+        : pool{&pool}
+        , index{index}
+        , name{"pool-" + std::to_string(index)}
+    {}
+
+    thread_pool* pool{};
+    size_type index{};
+    std::string name;
+    core_mask cores;  // Empty if the worker isn't pinned
+    mutex queueMutex;
+    std::deque<std::unique_ptr<task_concept>> queue;
+    std::unique_ptr<cen::thread> thread;
+  };
+
+  inline static thread_local worker* current_worker{};
+
+  std::vector<std::unique_ptr<worker>> m_workers;
+  fast_semaphore m_tasks;  // Has a token for every queued task
+  mutex m_idleMutex;
+  fast_condition m_idle;
+  mutex m_parkMutex;
+  fast_condition m_unparked;  // Signalled when the amount of active workers is raised
+  std::atomic<size_type> m_active{0};
+  std::atomic<size_type> m_pending{0};
+  std::atomic<size_type> m_next{0};
+  std::atomic<bool> m_stopping{false};
+  thread_priority m_priority;
+  worker_affinity m_affinity;
+
+  static auto run(void* data) -> int
+  {
+    auto* self = static_cast<worker*>(data);
+    auto& pool = *self->pool;
+
+    current_worker = self;
+    thread::set_priority(pool.m_priority);
+
+    if (!self->cores.empty())
+    {
+      thread::set_affinity(self->cores);
+    }
+
+    for (;;)
+    {
+      if (self->index >= pool.m_active.load(std::memory_order_acquire))
+      {
+        pool.park(*self);
+      }
+
+      pool.m_tasks.acquire();
+
+      // The search is repeated until a task is found, since other workers might steal
+      // from the queues while they are searched, unless the token was a stop request
+      std::unique_ptr<task_concept> task;
+      while (!task && !pool.m_stopping.load(std::memory_order_acquire))
+      {
+        task = pool.take(self->index);
+      }
+
+      if (!task)
+      {
+        break;
+      }
+
+      pool.execute(*task);
+    }
+
+    current_worker = nullptr;
+    return 0;
+  }
+
+  // Blocks a worker while it's beyond the amount of active workers, or until stopped
+  void park(const worker& w) noexcept
+  {
+    scoped_lock lock{m_parkMutex};
+    while (w.index >= m_active.load(std::memory_order_acquire) &&
+           !m_stopping.load(std::memory_order_acquire))
+    {
+      m_unparked.wait(m_parkMutex);
+    }
+  }
+
+  void assign_cores()
+  {
+    const auto topology = cpu_topology::query();
+    for (auto& w : m_workers)
+    {
+      if (m_affinity == worker_affinity::logical)
+      {
+        const auto cores = static_cast<size_type>(topology.logical_cores());
+        w->cores = core_mask::single(static_cast<int>(w->index % cores));
+      }
+      else
+      {
+        const auto cores = static_cast<size_type>(topology.physical_cores());
+        w->cores = topology.siblings(static_cast<int>(w->index % cores));
+      }
+    }
+  }
+
+  void enqueue(std::unique_ptr<task_concept> task)
+  {
+    // Tasks from other threads are distributed over the active workers
+    auto* target = is_worker_thread()
+                       ? current_worker
+                       : m_workers[m_next.fetch_add(1u, std::memory_order_relaxed) %
+                                   m_active.load(std::memory_order_relaxed)]
+                             .get();
+
+    m_pending.fetch_add(1u, std::memory_order_acq_rel);
+
+    {
+      scoped_lock lock{target->queueMutex};
+      target->queue.push_back(std::move(task));
+    }
+
+    m_tasks.release();
+  }
+
+  // Pops a task from the back of the specified queue, or steals one from another queue
+  auto take(const size_type first) -> std::unique_ptr<task_concept>
+  {
+    {
+      auto& own = *m_workers[first];
+
+      scoped_lock lock{own.queueMutex};
+      if (!own.queue.empty())
+      {
+        auto task = std::move(own.queue.back());
+        own.queue.pop_back();
+        return task;
+      }
+    }
+
+    const auto count = m_workers.size();
+    for (size_type offset = 1; offset < count; ++offset)
+    {
+      auto& victim = *m_workers[(first + offset) % count];
+
+      scoped_lock lock{victim.queueMutex};
+      if (!victim.queue.empty())
+      {
+        auto task = std::move(victim.queue.front());
+        victim.queue.pop_front();
+        return task;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void execute(task_concept& task)
+  {
+    task.run();
+
+    if (m_pending.fetch_sub(1u, std::memory_order_acq_rel) == 1u)
+    {
+      scoped_lock lock{m_idleMutex};
+      m_idle.broadcast();
+    }
+  }
+
+  void stop() noexcept
+  {
+    m_stopping.store(true, std::memory_order_release);
+
+    {
+      scoped_lock lock{m_parkMutex};
+      m_unparked.broadcast();
+    }
+
+    // Every worker consumes one token when it finds out that the pool is stopping
+    for (const auto& w : m_workers)
+    {
+      if (w->thread)
+      {
+        m_tasks.release();
+      }
+    }
+
+    for (auto& w : m_workers)
+    {
+      if (w->thread)
+      {
+        w->thread->join();
+      }
+    }
+  }
+};
+
+template <typename T>
+void task_handle<T>::wait() const
+{
+  if (!m_future.valid())
+  {
+    throw cen_error{"Cannot wait for an invalid task handle!"};
+  }
+
+  // Help out with the pending tasks instead of blocking, the waited task might be queued
+  while (!is_ready())
+  {
+    if (!m_pool->run_pending_task())
+    {
+      // All queued tasks have been claimed, so the task is running on another thread
+      m_future.wait();
+      break;
+    }
+  }
+}
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_THREAD_POOL_HEADER
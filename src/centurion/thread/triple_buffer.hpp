@@ -0,0 +1,134 @@
+#ifndef CENTURION_TRIPLE_BUFFER_HEADER
+#define CENTURION_TRIPLE_BUFFER_HEADER
+
+#include <SDL.h>
+
+#include <array>   // array
+#include <atomic>  // atomic, memory_order_...
+
+#include "../core/integers.hpp"
+
+namespace cen {
+
+/// \addtogroup thread
+/// \{
+
+/**
+ * \class triple_buffer
+ *
+ * \brief Hands values from a single producer thread to a single consumer thread,
+ * without ever blocking either of them.
+ *
+ * \details The buffer has three slots: one that is being written by the producer, one
+ * that is being read by the consumer, and one that holds the most recently published
+ * value. Publishing and acquiring swap a slot with the middle slot using a single atomic
+ * exchange, so the producer can run ahead of the consumer, in which case intermediate
+ * values are overwritten, and the consumer keeps its current value until a newer one is
+ * published. Since the slots are reused, their allocations are kept between values.
+ *
+ * \note Only one thread may call `write()`/`publish()`, and only one thread may call
+ * `read()`/`acquire()`.
+ *
+ * \tparam T the type of the values, which must be default constructible.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class triple_buffer final
+{
+ public:
+  using value_type = T;
+
+  /**
+   * \brief Returns the value that is being written by the producer.
+   *
+   * \return the slot owned by the producer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto write() noexcept -> value_type&
+  {
+    return m_slots[m_back];
+  }
+
+  /**
+   * \brief Makes the written value available to the consumer.
+   *
+   * \details The producer receives a different slot afterwards, which holds an older
+   * value that should be overwritten.
+   *
+   * \return `true` if the previously published value was never acquired, i.e. it was
+   * dropped; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto publish() noexcept -> bool
+  {
+    const auto old = m_middle.exchange(static_cast<u8>(m_back | fresh_bit),
+                                       std::memory_order_acq_rel);
+    m_back = static_cast<u8>(old & index_mask);
+    return (old & fresh_bit) != 0;
+  }
+
+  /**
+   * \brief Obtains the most recently published value, if there is a new one.
+   *
+   * \return `true` if a new value was acquired; `false` if the value returned by `read()`
+   * is unchanged.
+   *
+   * \since 6.1.0
+   */
+  auto acquire() noexcept -> bool
+  {
+    if ((m_middle.load(std::memory_order_relaxed) & fresh_bit) == 0)
+    {
+      return false;
+    }
+
+    const auto old = m_middle.exchange(m_front, std::memory_order_acq_rel);
+    m_front = static_cast<u8>(old & index_mask);
+    return true;
+  }
+
+  /**
+   * \brief Returns the value that is being read by the consumer.
+   *
+   * \details The consumer may modify the value, it isn't touched by the producer until
+   * the next call to `acquire()`.
+   *
+   * \return the slot owned by the consumer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto read() noexcept -> value_type&
+  {
+    return m_slots[m_front];
+  }
+
+  /**
+   * \brief Indicates whether or not a published value is waiting to be acquired.
+   *
+   * \return `true` if `acquire()` would obtain a new value; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has_fresh() const noexcept -> bool
+  {
+    return (m_middle.load(std::memory_order_acquire) & fresh_bit) != 0;
+  }
+
+ private:
+  inline constexpr static u8 index_mask = 0b011;
+  inline constexpr static u8 fresh_bit = 0b100;
+
+  std::array<value_type, 3> m_slots{};
+  std::atomic<u8> m_middle{1};  // Index of the middle slot, and whether it is fresh
+  u8 m_back{0};                 // Only accessed by the producer
+  u8 m_front{2};                // Only accessed by the consumer
+};
+
+/// \} End of group thread
+
+}  // namespace cen
+
+#endif  // CENTURION_TRIPLE_BUFFER_HEADER
@@ -16,6 +16,9 @@ namespace cen {
  * \brief Represents an RAII-style non-blocking lock that automatically unlocks the
  * associated mutex upon destruction.
  *
+ * \details Any mutex type with `try_lock()` and `unlock()` functions can be used, where
+ * `try_lock()` returns a `lock_status`, such as `mutex`, `spin_mutex` and `shared_mutex`.
+ *
  * \since 5.0.0
  */
 class try_lock final
@@ -24,11 +27,17 @@ class try_lock final
   /**
    * \brief Attempts to lock the supplied mutex.
    *
+   * \tparam Mutex the type of the mutex, e.g. `mutex` or `spin_mutex`.
+   *
    * \param mutex the mutex that will be locked.
    *
    * \since 5.0.0
    */
-  explicit try_lock(mutex& mutex) noexcept : m_mutex{&mutex}, m_status{mutex.try_lock()}
+  template <typename Mutex>
+  explicit try_lock(Mutex& mutex) noexcept
+      : m_mutex{&mutex}
+      , m_unlock{&unlock_mutex<Mutex>}
+      , m_status{mutex.try_lock()}
   {}
 
   try_lock(const try_lock&) = delete;
@@ -44,7 +53,7 @@ class try_lock final
   {
     if (m_status == lock_status::success)
     {
-      m_mutex->unlock();
+      m_unlock(m_mutex);
     }
   }
 
@@ -103,8 +112,15 @@ class try_lock final
   }
 
  private:
-  mutex* m_mutex{};
+  void* m_mutex{};
+  void (*m_unlock)(void*) noexcept {};
   lock_status m_status{};
+
+  template <typename Mutex>
+  static void unlock_mutex(void* mutex) noexcept
+  {
+    static_cast<Mutex*>(mutex)->unlock();
+  }
 };
 
 /// \} End of group thread
@@ -0,0 +1,91 @@
+#ifndef CENTURION_VIDEO_SUBSYSTEM_HEADER
+#define CENTURION_VIDEO_SUBSYSTEM_HEADER
+
+/**
+ * \file video.hpp
+ *
+ * \brief Includes all headers of the video subsystem.
+ *
+ * \details This header is much cheaper to parse than `everything.hpp`, which includes
+ * every subsystem.
+ *
+ * \since 6.1.0
+ */
+
+#include "video/async_texture_loader.hpp"
+#include "video/bitmap_font.hpp"
+#include "video/blend_mode.hpp"
+#include "video/blit_batch.hpp"
+#include "video/color.hpp"
+#include "video/color_batch.hpp"
+#include "video/color_ramp.hpp"
+#include "video/colors.hpp"
+#include "video/cursor.hpp"
+#include "video/cursor_cache.hpp"
+#include "video/dirty_region.hpp"
+#include "video/display_cache.hpp"
+#include "video/dynamic_resolution.hpp"
+#include "video/font.hpp"
+#include "video/font_cache.hpp"
+#include "video/font_source.hpp"
+#include "video/frame_capture.hpp"
+#include "video/frame_recorder.hpp"
+#include "video/graphics_drivers.hpp"
+#include "video/hit_mask.hpp"
+#include "video/image_cache.hpp"
+#include "video/indexed_image.hpp"
+#include "video/message_box.hpp"
+#include "video/mouse_latch.hpp"
+#include "video/offscreen_renderer.hpp"
+#include "video/opengl/gl_attribute.hpp"
+#include "video/opengl/gl_context.hpp"
+#include "video/opengl/gl_core.hpp"
+#include "video/opengl/gl_function_table.hpp"
+#include "video/opengl/gl_gpu_profiler.hpp"
+#include "video/opengl/gl_library.hpp"
+#include "video/opengl/gl_post_chain.hpp"
+#include "video/opengl/gl_readback_ring.hpp"
+#include "video/opengl/gl_sprite_renderer.hpp"
+#include "video/opengl/gl_stream_buffer.hpp"
+#include "video/opengl/gl_upload_queue.hpp"
+#include "video/palette.hpp"
+#include "video/palette_lut.hpp"
+#include "video/particle_emitter.hpp"
+#include "video/pixel_conversion.hpp"
+#include "video/pixel_format.hpp"
+#include "video/pixel_view.hpp"
+#include "video/render_command_buffer.hpp"
+#include "video/render_layer.hpp"
+#include "video/render_scaler.hpp"
+#include "video/render_scope.hpp"
+#include "video/render_thread.hpp"
+#include "video/renderer.hpp"
+#include "video/renderer_info.hpp"
+#include "video/resampling.hpp"
+#include "video/scale_mode.hpp"
+#include "video/screen.hpp"
+#include "video/shape_batch.hpp"
+#include "video/shared_surface.hpp"
+#include "video/sprite_animation.hpp"
+#include "video/sprite_batch.hpp"
+#include "video/sprite_queue.hpp"
+#include "video/streaming_texture_ring.hpp"
+#include "video/surface.hpp"
+#include "video/text_layout.hpp"
+#include "video/text_shaper.hpp"
+#include "video/texture.hpp"
+#include "video/texture_access.hpp"
+#include "video/texture_atlas.hpp"
+#include "video/texture_memory.hpp"
+#include "video/texture_pool.hpp"
+#include "video/tilemap_renderer.hpp"
+#include "video/ui_batch.hpp"
+#include "video/unicode_string.hpp"
+#include "video/vulkan/vk_core.hpp"
+#include "video/vulkan/vk_library.hpp"
+#include "video/vulkan/vk_swapchain.hpp"
+#include "video/window.hpp"
+#include "video/window_state.hpp"
+#include "video/window_utils.hpp"
+
+#endif  // CENTURION_VIDEO_SUBSYSTEM_HEADER
@@ -0,0 +1,433 @@
+#ifndef CENTURION_ASYNC_TEXTURE_LOADER_HEADER
+#define CENTURION_ASYNC_TEXTURE_LOADER_HEADER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+#include <SDL.h>
+
+#include <cstddef>        // size_t
+#include <deque>          // deque
+#include <memory>         // unique_ptr, make_unique
+#include <optional>       // optional
+#include <string>         // string
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/exception.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum load_status
+ *
+ * \brief Provides values that describe the progress of an asynchronous load.
+ *
+ * \see `async_texture_loader`
+ *
+ * \since 6.1.0
+ */
+enum class load_status
+{
+  pending,  ///< The image hasn't been decoded and uploaded yet.
+  ready,    ///< The texture is available.
+  failed,   ///< The image couldn't be loaded, or the texture couldn't be created.
+  unknown   ///< The identifier isn't associated with a load, e.g. after `take()`.
+};
+
+/**
+ * \class async_texture_loader
+ *
+ * \brief Loads textures from image files without stalling the render thread.
+ *
+ * \details Decoding image files is by far the most expensive part of loading a texture,
+ * and it doesn't involve the renderer. This class decodes the images into surfaces on a
+ * pool of worker threads, after which the render thread creates the textures by calling
+ * `update()`, typically once per frame. The amount of textures created by each call to
+ * `update()` is bounded, which spreads the upload cost over several frames.
+ *
+ * \details Loads are identified by the values returned from `load()`, which can be used
+ * to query the status of the load and to obtain the texture.
+ *
+ * \note All member functions must be called from the same thread, i.e. the thread that
+ * owns the renderer.
+ *
+ * \since 6.1.0
+ */
+class async_texture_loader final
+{
+ public:
+  using id_type = std::size_t;
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates a loader and starts its worker threads.
+   *
+   * \param workers the amount of worker threads, at least one thread is used.
+   *
+   * \throws sdl_error if the synchronization primitives or threads couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit async_texture_loader(const std::size_t workers = 2)
+      : m_shared{std::make_unique<shared_data>()}
+  {
+    const auto count = (workers != 0) ? workers : 1u;
+
+    m_workers.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto worker = std::make_unique<thread>(&work, "texture_loader", m_shared.get());
+      m_workers.push_back(std::move(worker));
+    }
+  }
+
+  async_texture_loader(const async_texture_loader&) = delete;
+
+  auto operator=(const async_texture_loader&) -> async_texture_loader& = delete;
+
+  /**
+   * \brief Stops and joins the worker threads.
+   *
+   * \details Images that haven't been decoded yet are discarded, images that are being
+   * decoded are finished first.
+   *
+   * \since 6.1.0
+   */
+  ~async_texture_loader() noexcept
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->stopping = true;
+    }
+
+    m_shared->available.broadcast();
+    m_workers.clear();
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Requests that an image file is loaded as a texture.
+   *
+   * \param path the file path of the image.
+   *
+   * \return the identifier associated with the load.
+   *
+   * \since 6.1.0
+   */
+  auto load(std::string path) -> id_type
+  {
+    const auto id = m_nextId++;
+    m_entries.try_emplace(id);
+
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->requests.push_back({id, std::move(path)});
+    }
+
+    m_shared->available.signal();
+    return id;
+  }
+
+  /**
+   * \brief Requests that several image files are loaded as textures.
+   *
+   * \details This is equivalent to calling `load()` for each path, except that the
+   * requests are enqueued at once, e.g. when a folder of images is dropped onto a window.
+   *
+   * \tparam Paths the type of the range of paths, e.g. `std::vector<std::string>`.
+   *
+   * \param paths the file paths of the images.
+   *
+   * \return the identifiers associated with the loads, in the order of the paths.
+   *
+   * \since 6.1.0
+   */
+  template <typename Paths>
+  auto load_all(const Paths& paths) -> std::vector<id_type>
+  {
+    std::vector<id_type> ids;
+
+    {
+      scoped_lock lock{m_shared->mutex};
+      for (const auto& path : paths)
+      {
+        const auto id = m_nextId++;
+        m_entries.try_emplace(id);
+        m_shared->requests.push_back({id, std::string{path}});
+        ids.push_back(id);
+      }
+    }
+
+    m_shared->available.broadcast();
+    return ids;
+  }
+
+  /**
+   * \brief Creates textures from images that have been decoded by the worker threads.
+   *
+   * \pre This function must be called on the thread that owns the renderer.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the textures.
+   * \param maxUploads the maximum amount of textures to create.
+   *
+   * \return the amount of loads that were completed, including failed loads.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto update(const Renderer& renderer, const std::size_t maxUploads = 4) -> std::size_t
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      for (auto& image : m_shared->decoded)
+      {
+        m_decoded.push_back(std::move(image));
+      }
+
+      m_shared->decoded.clear();
+    }
+
+    std::size_t completed = 0;
+    while (!m_decoded.empty() && completed < maxUploads)
+    {
+      auto& image = m_decoded.front();
+
+      // The entry might have been removed by take()
+      if (const auto it = m_entries.find(image.id); it != m_entries.end())
+      {
+        auto& entry = it->second;
+        entry.status = load_status::failed;
+
+        if (image.image)
+        {
+          try
+          {
+            entry.result.emplace(renderer, *image.image);
+            entry.status = load_status::ready;
+          }
+          catch (const sdl_error&)
+          {}
+        }
+
+        ++completed;
+      }
+
+      m_decoded.pop_front();
+    }
+
+    return completed;
+  }
+
+  /**
+   * \brief Returns the texture associated with a load, and forgets about the load.
+   *
+   * \param id the identifier of the load.
+   *
+   * \return the loaded texture; `std::nullopt` if the texture isn't ready.
+   *
+   * \since 6.1.0
+   */
+  auto take(const id_type id) -> std::optional<texture>
+  {
+    if (const auto it = m_entries.find(id); it != m_entries.end())
+    {
+      if (it->second.status != load_status::pending)
+      {
+        auto result = std::move(it->second.result);
+        m_entries.erase(it);
+        return result;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the status of a load.
+   *
+   * \param id the identifier of the load.
+   *
+   * \return the status of the load.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto status(const id_type id) const -> load_status
+  {
+    if (const auto it = m_entries.find(id); it != m_entries.end())
+    {
+      return it->second.status;
+    }
+    else
+    {
+      return load_status::unknown;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not the texture of a load is available.
+   *
+   * \param id the identifier of the load.
+   *
+   * \return `true` if the texture is available; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_ready(const id_type id) const -> bool
+  {
+    return status(id) == load_status::ready;
+  }
+
+  /**
+   * \brief Returns the texture associated with a load, if it is available.
+   *
+   * \param id the identifier of the load.
+   *
+   * \return a pointer to the texture; a null pointer if the texture isn't available.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto try_get(const id_type id) const -> const texture*
+  {
+    if (const auto it = m_entries.find(id); it != m_entries.end() && it->second.result)
+    {
+      return &*it->second.result;
+    }
+    else
+    {
+      return nullptr;
+    }
+  }
+
+  /**
+   * \brief Returns the amount of loads that haven't completed yet.
+   *
+   * \return the amount of pending loads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending_count() const -> std::size_t
+  {
+    std::size_t count = 0;
+    for (const auto& [id, entry] : m_entries)
+    {
+      if (entry.status == load_status::pending)
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Returns the amount of worker threads.
+   *
+   * \return the amount of worker threads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto worker_count() const noexcept -> std::size_t
+  {
+    return m_workers.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct request final
+  {
+    id_type id{};
+    std::string path;
+  };
+
+  struct decoded_image final
+  {
+    id_type id{};
+    std::optional<surface> image;  // Empty if the image couldn't be decoded
+  };
+
+  struct shared_data final
+  {
+    cen::mutex mutex;
+    condition available;
+    std::deque<request> requests;       // Guarded by the mutex
+    std::vector<decoded_image> decoded;  // Guarded by the mutex
+    bool stopping{};                     // Guarded by the mutex
+  };
+
+  struct entry final
+  {
+    load_status status{load_status::pending};
+    std::optional<texture> result;
+  };
+
+  std::unique_ptr<shared_data> m_shared;
+  std::vector<std::unique_ptr<thread>> m_workers;
+  std::unordered_map<id_type, entry> m_entries;
+  std::deque<decoded_image> m_decoded;  // Decoded images waiting to be uploaded
+  id_type m_nextId{};
+
+  static auto work(void* data) -> int
+  {
+    auto& shared = *static_cast<shared_data*>(data);
+
+    while (true)
+    {
+      request next;
+
+      {
+        scoped_lock lock{shared.mutex};
+        while (shared.requests.empty() && !shared.stopping)
+        {
+          shared.available.wait(shared.mutex);
+        }
+
+        if (shared.stopping)
+        {
+          return 0;
+        }
+
+        next = std::move(shared.requests.front());
+        shared.requests.pop_front();
+      }
+
+      decoded_image result{next.id, std::nullopt};
+      try
+      {
+        result.image.emplace(next.path);
+      }
+      catch (...)
+      {
+        // Exceptions must not escape the thread, the load is reported as failed
+      }
+
+      scoped_lock lock{shared.mutex};
+      shared.decoded.push_back(std::move(result));
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_ASYNC_TEXTURE_LOADER_HEADER
@@ -0,0 +1,473 @@
+#ifndef CENTURION_BITMAP_FONT_HEADER
+#define CENTURION_BITMAP_FONT_HEADER
+
+#include <SDL.h>
+
+#ifndef CENTURION_NO_SDL_IMAGE
+#include <SDL_image.h>
+#endif  // CENTURION_NO_SDL_IMAGE
+
+#include <cstddef>        // size_t
+#include <stdexcept>      // out_of_range
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/not_null.hpp"
+#include "../detail/bmfont_format.hpp"
+#include "../detail/glyph_table.hpp"
+#include "../filesystem/asset_pack.hpp"
+#include "../filesystem/mapped_file.hpp"
+#include "../math/rect.hpp"
+#include "texture.hpp"
+#include "unicode_string.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class bitmap_font
+ *
+ * \brief A font with pre-rendered glyphs, loaded from a BMFont (AngelCode) descriptor.
+ *
+ * \details Both the text and the binary (version 3) descriptor formats are supported.
+ * The glyphs are stored in one or more page textures, which are loaded as images, so no
+ * rasterization is performed and SDL_ttf isn't required. Bitmap fonts are rendered with
+ * the same `render_glyph()` and `render_text()` functions of the renderer as font caches.
+ * \code{cpp}
+ *   const cen::bitmap_font font{renderer, "fonts/pixel.fnt"};
+ *   renderer.render_text(font, cen::unicode_string{"Hello"}, {10, 10});
+ * \endcode
+ *
+ * \note Glyphs outside of the Basic Multilingual Plane are ignored, since `unicode` is a
+ * 16-bit type.
+ *
+ * \see `font_cache`
+ *
+ * \since 6.1.0
+ */
+class bitmap_font final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \struct glyph_data
+   *
+   * \brief Simple aggregate that contains the location and metrics of a glyph.
+   *
+   * \since 6.1.0
+   */
+  struct glyph_data final
+  {
+    size_type page{};  ///< The index of the page that contains the glyph.
+    irect source;      ///< The area of the page that contains the glyph.
+    ipoint offset;     ///< The offset of the glyph from the top of the line at the pen.
+    int advance{};     ///< The horizontal distance to the next pen position.
+  };
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Parses a BMFont descriptor in memory, without loading any pages.
+   *
+   * \details The pages must be supplied with `add_page()`, in the order of
+   * `page_files()`, e.g. after loading them with an image cache.
+   *
+   * \param data the contents of a text or binary descriptor.
+   * \param size the amount of bytes.
+   *
+   * \throws cen_error if the descriptor is invalid.
+   *
+   * \since 6.1.0
+   */
+  bitmap_font(const not_null<const void*> data, const size_type size)
+  {
+    parse(data, size);
+  }
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+  /**
+   * \brief Loads a BMFont descriptor and its pages from files.
+   *
+   * \details The descriptor is memory-mapped, and the pages are loaded from paths that
+   * are relative to the directory of the descriptor.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the page textures.
+   * \param path the path of the descriptor.
+   *
+   * \throws cen_error if the descriptor can't be opened, or if it is invalid.
+   * \throws img_error if a page can't be loaded.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  bitmap_font(const Renderer& renderer, const std::string& path)
+  {
+    {
+      const mapped_file source{path};
+      parse(source.data(), source.size());
+    }
+
+    const auto directory = directory_of(path);
+    for (const auto& file : m_pageFiles)
+    {
+      m_pages.emplace_back(renderer, directory + file);
+    }
+  }
+
+  /**
+   * \brief Loads a BMFont descriptor and its pages from an asset pack.
+   *
+   * \details The pages are looked up with names that are relative to the directory of
+   * the descriptor name, and are decoded from the memory of the pack.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the page textures.
+   * \param pack the asset pack that contains the descriptor and the pages.
+   * \param name the name of the descriptor entry.
+   *
+   * \throws cen_error if an entry is missing, or if the descriptor is invalid.
+   * \throws img_error if a page can't be decoded.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  bitmap_font(const Renderer& renderer,
+              const asset_pack& pack,
+              const std::string_view name)
+  {
+    const auto descriptor = pack.find(name);
+    if (!descriptor)
+    {
+      throw cen_error{"There is no asset pack entry with the specified name!"};
+    }
+
+    parse(descriptor->data, descriptor->size);
+
+    const auto directory = directory_of(name);
+    for (const auto& file : m_pageFiles)
+    {
+      const auto page = pack.open(directory + file);
+      if (SDL_Texture* ptr = IMG_LoadTexture_RW(renderer.get(), page.get(), 0))
+      {
+        m_pages.emplace_back(ptr);
+      }
+      else
+      {
+        throw img_error{};
+      }
+    }
+  }
+
+#endif  // CENTURION_NO_SDL_IMAGE
+
+  /// \} End of construction
+
+  /// \name Pages
+  /// \{
+
+  /**
+   * \brief Adds the next page texture.
+   *
+   * \details Glyphs on pages that haven't been added aren't rendered.
+   *
+   * \param page the texture of the page with the index `page_count()`.
+   *
+   * \since 6.1.0
+   */
+  void add_page(texture&& page)
+  {
+    m_pages.push_back(std::move(page));
+  }
+
+  /**
+   * \brief Returns a handle to a page texture.
+   *
+   * \param index the index of the page.
+   *
+   * \return a handle to the page texture.
+   *
+   * \throws std::out_of_range if the page index is invalid.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto page(const size_type index) const -> texture_handle
+  {
+    return texture_handle{m_pages.at(index).get()};
+  }
+
+  /**
+   * \brief Returns the amount of loaded page textures.
+   *
+   * \return the amount of pages that can be rendered.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto page_count() const noexcept -> size_type
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the file names of the pages, as specified by the descriptor.
+   *
+   * \return the page file names, in order.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto page_files() const noexcept -> const std::vector<std::string>&
+  {
+    return m_pageFiles;
+  }
+
+  /// \} End of pages
+
+  /// \name Glyphs
+  /// \{
+
+  /**
+   * \brief Indicates whether or not the font has a glyph.
+   *
+   * \param glyph the glyph that will be checked.
+   *
+   * \return `true` if the font has the glyph; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has(const unicode glyph) const noexcept -> bool
+  {
+    return m_glyphs.contains(glyph);
+  }
+
+  /**
+   * \brief Returns the data associated with a glyph.
+   *
+   * \param glyph the glyph to look up the data for.
+   *
+   * \return the location and metrics of the glyph.
+   *
+   * \throws std::out_of_range if the font doesn't have the glyph.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto at(const unicode glyph) const -> const glyph_data&
+  {
+    if (const auto* data = m_glyphs.find(glyph))
+    {
+      return *data;
+    }
+    else
+    {
+      throw std::out_of_range{"Glyph is not in the font!"};
+    }
+  }
+
+  /// \copydoc at()
+  [[nodiscard]] auto operator[](const unicode glyph) const -> const glyph_data&
+  {
+    return at(glyph);
+  }
+
+  /**
+   * \brief Returns the data associated with a glyph, if it exists.
+   *
+   * \param glyph the glyph to look up the data for.
+   *
+   * \return a pointer to the glyph data; a null pointer if the font doesn't have the
+   * glyph.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto try_at(const unicode glyph) const noexcept -> const glyph_data*
+  {
+    return m_glyphs.find(glyph);
+  }
+
+  /**
+   * \brief Returns the kerning amount between two glyphs.
+   *
+   * \param previous the glyph that is rendered first.
+   * \param next the glyph that is rendered after the previous glyph.
+   *
+   * \return the horizontal adjustment of the pen; zero if there is no kerning pair.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto kerning(const unicode previous, const unicode next) const -> int
+  {
+    if (m_kernings.empty())
+    {
+      return 0;
+    }
+
+    const auto it = m_kernings.find(kerning_key(previous, next));
+    return (it != m_kernings.end()) ? it->second : 0;
+  }
+
+  /// \} End of glyphs
+
+  /// \name Metrics
+  /// \{
+
+  /**
+   * \brief Returns the distance between the tops of two lines of text.
+   *
+   * \return the line height, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto line_height() const noexcept -> int
+  {
+    return m_lineHeight;
+  }
+
+  /**
+   * \brief Returns the distance from the top of a line to the baseline.
+   *
+   * \return the baseline offset, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto base() const noexcept -> int
+  {
+    return m_base;
+  }
+
+  /**
+   * \brief Returns the size of the font that the glyphs were generated from.
+   *
+   * \return the font size, which is negative if it was specified as a character height.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto point_size() const noexcept -> int
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the name of the font face that the glyphs were generated from.
+   *
+   * \return the face name; an empty string if the descriptor doesn't specify it.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto family_name() const noexcept -> const std::string&
+  {
+    return m_face;
+  }
+
+  /**
+   * \brief Returns the amount of glyphs in the font.
+   *
+   * \return the amount of glyphs.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto glyph_count() const noexcept -> size_type
+  {
+    return m_glyphs.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the font has any kerning pairs.
+   *
+   * \return `true` if the font has kerning pairs; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has_kerning() const noexcept -> bool
+  {
+    return !m_kernings.empty();
+  }
+
+  /// \} End of metrics
+
+ private:
+  detail::glyph_table<glyph_data> m_glyphs;
+  std::unordered_map<u32, int> m_kernings;
+  std::vector<std::string> m_pageFiles;
+  std::vector<texture> m_pages;
+  std::string m_face;
+  int m_size{};
+  int m_lineHeight{};
+  int m_base{};
+
+  [[nodiscard]] constexpr static auto kerning_key(const unicode previous,
+                                                  const unicode next) noexcept -> u32
+  {
+    return (u32{previous} << 16u) | u32{next};
+  }
+
+  template <typename String>
+  [[nodiscard]] static auto directory_of(const String& path) -> std::string
+  {
+    const auto separator = path.find_last_of("/\\");
+    if (separator == String::npos)
+    {
+      return std::string{};
+    }
+
+    return std::string{path.substr(0, separator + 1)};
+  }
+
+  void parse(const void* data, const size_type size)
+  {
+    detail::bmfont_description font;
+    if (!detail::parse_bmfont(data, size, font))
+    {
+      throw cen_error{"Invalid BMFont descriptor!"};
+    }
+
+    for (const auto& ch : font.chars)
+    {
+      if (ch.page < 0 || static_cast<size_type>(ch.page) >= font.pages.size())
+      {
+        throw cen_error{"BMFont glyph refers to a missing page!"};
+      }
+
+      if (ch.id <= 0xFFFF)
+      {
+        m_glyphs.try_emplace(static_cast<unicode>(ch.id),
+                             {static_cast<size_type>(ch.page),
+                              irect{ch.x, ch.y, ch.width, ch.height},
+                              ipoint{ch.xOffset, ch.yOffset},
+                              ch.xAdvance});
+      }
+    }
+
+    for (const auto& pair : font.kernings)
+    {
+      if (pair.first <= 0xFFFF && pair.second <= 0xFFFF)
+      {
+        const auto key = kerning_key(static_cast<unicode>(pair.first),
+                                     static_cast<unicode>(pair.second));
+        m_kernings[key] = pair.amount;
+      }
+    }
+
+    m_pageFiles = std::move(font.pages);
+    m_face = std::move(font.face);
+    m_size = font.size;
+    m_lineHeight = font.lineHeight;
+    m_base = font.base;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_BITMAP_FONT_HEADER
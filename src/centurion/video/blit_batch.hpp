@@ -0,0 +1,476 @@
+#ifndef CENTURION_BLIT_BATCH_HEADER
+#define CENTURION_BLIT_BATCH_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // stable_sort, all_of, min, max
+#include <cstddef>    // size_t, ptrdiff_t
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/blit_kernels.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../math/rect.hpp"
+#include "../thread/parallel.hpp"
+#include "../thread/thread_pool.hpp"
+#include "surface.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+inline constexpr int blit_band_height = 32;  // The amount of rows per parallel band
+
+struct blit_item final
+{
+  SDL_Surface* source{};
+  SDL_Rect sourceRect{};
+  SDL_Point position{};
+  int layer{};
+};
+
+// A blit that has been clipped against both the source and the target
+struct clipped_blit final
+{
+  SDL_Surface* source{};
+  SDL_Rect sourceRect{};
+  SDL_Rect targetRect{};
+  int layer{};
+  blit_op op{};
+  bool fast{};      // Composited by the kernels, rather than by SDL_BlitSurface()
+  bool swizzled{};  // The source rows are converted to the target layout first
+  swizzle_plan plan;
+};
+
+[[nodiscard]] inline auto to_blit_op(const SDL_BlendMode mode, blit_op& op) noexcept
+    -> bool
+{
+  switch (mode)
+  {
+    case SDL_BLENDMODE_NONE:
+      op = blit_op::copy;
+      return true;
+
+    case SDL_BLENDMODE_BLEND:
+      op = blit_op::blend;
+      return true;
+
+    case SDL_BLENDMODE_ADD:
+      op = blit_op::add;
+      return true;
+
+    case SDL_BLENDMODE_MOD:
+      op = blit_op::mod;
+      return true;
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+
+    case SDL_BLENDMODE_MUL:
+      op = blit_op::mul;
+      return true;
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+    case SDL_BLENDMODE_INVALID:
+      return false;
+
+    default:  // Custom blend modes are left to SDL_BlitSurface()
+      return false;
+  }
+}
+
+// Clips a blit in the same way as SDL_BlitSurface(), returns false if nothing is left
+[[nodiscard]] inline auto clip_blit(const blit_item& item,
+                                    const SDL_Rect& clip,
+                                    clipped_blit& blit) noexcept -> bool
+{
+  auto src = item.sourceRect;
+  SDL_Point dst = item.position;
+
+  // The source rectangle is clipped against the source, moving the position along
+  const auto clipStart = [](int& start, int& length, int& position, const int bound) {
+    if (start < bound)
+    {
+      length -= bound - start;
+      position += bound - start;
+      start = bound;
+    }
+  };
+
+  clipStart(src.x, src.w, dst.x, 0);
+  clipStart(src.y, src.h, dst.y, 0);
+  src.w = (std::min)(src.w, item.source->w - src.x);
+  src.h = (std::min)(src.h, item.source->h - src.y);
+
+  // The target rectangle is clipped against the clip rectangle of the target
+  clipStart(dst.x, src.w, src.x, clip.x);
+  clipStart(dst.y, src.h, src.y, clip.y);
+  src.w = (std::min)(src.w, clip.x + clip.w - dst.x);
+  src.h = (std::min)(src.h, clip.y + clip.h - dst.y);
+
+  if (src.w <= 0 || src.h <= 0)
+  {
+    return false;
+  }
+
+  blit.source = item.source;
+  blit.sourceRect = src;
+  blit.targetRect = {dst.x, dst.y, src.w, src.h};
+  blit.layer = item.layer;
+
+  return true;
+}
+
+// Determines whether a blit can be composited by the kernels, which don't support
+// color keys, color and alpha modulation, or RLE surfaces
+inline void classify_blit(clipped_blit& blit,
+                          const SDL_Surface* target,
+                          const channel_layout& targetLayout) noexcept
+{
+  auto* source = blit.source;
+
+  channel_layout sourceLayout;
+  if (source == target || !get_channel_layout(source->format->format, sourceLayout) ||
+      SDL_MUSTLOCK(source))
+  {
+    return;
+  }
+
+  u32 key{};
+  u8 red{};
+  u8 green{};
+  u8 blue{};
+  u8 alpha{};
+  SDL_BlendMode mode{};
+
+  if (SDL_GetColorKey(source, &key) == 0 ||
+      SDL_GetSurfaceColorMod(source, &red, &green, &blue) != 0 ||
+      SDL_GetSurfaceAlphaMod(source, &alpha) != 0 ||
+      SDL_GetSurfaceBlendMode(source, &mode) != 0)
+  {
+    return;
+  }
+
+  if (red != 0xFF || green != 0xFF || blue != 0xFF || alpha != 0xFF ||
+      !to_blit_op(mode, blit.op))
+  {
+    return;
+  }
+
+  // The padding bytes of opaque sources are replaced with opaque alpha values
+  blit.fast = true;
+  blit.swizzled = source->format->format != target->format->format || sourceLayout.opaque;
+  if (blit.swizzled)
+  {
+    blit.plan = make_swizzle_plan(sourceLayout, targetLayout);
+  }
+}
+
+[[nodiscard]] inline auto pixel_row(SDL_Surface* surface,
+                                    const int row,
+                                    const int column) noexcept -> u32*
+{
+  const auto offset = static_cast<std::ptrdiff_t>(row) * surface->pitch;
+  return reinterpret_cast<u32*>(static_cast<u8*>(surface->pixels) + offset) + column;
+}
+
+// Composites the rows of a blit that are in [first, last) of the target
+inline void composite_blit(const simd_level level,
+                           const clipped_blit& blit,
+                           const channel_layout& layout,
+                           SDL_Surface* target,
+                           const int first,
+                           const int last,
+                           std::vector<u32>& scratch)
+{
+  const auto& src = blit.sourceRect;
+  const auto& dst = blit.targetRect;
+
+  const auto begin = (std::max)(first, dst.y);
+  const auto end = (std::min)(last, dst.y + dst.h);
+  const auto count = static_cast<std::size_t>(dst.w);
+
+  if (blit.swizzled && scratch.size() < count)
+  {
+    scratch.resize(count);
+  }
+
+  for (auto row = begin; row < end; ++row)
+  {
+    const u32* pixels = pixel_row(blit.source, src.y + (row - dst.y), src.x);
+    if (blit.swizzled)
+    {
+      swizzle_pixels(level, blit.plan, pixels, scratch.data(), count);
+      pixels = scratch.data();
+    }
+
+    blit_pixels(level, blit.op, layout, pixels, pixel_row(target, row, dst.x), count);
+  }
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class blit_batch
+ *
+ * \brief A list of surface blits that are clipped, ordered and composited together.
+ *
+ * \details Blits are recorded with `add()`, and performed with `blit()`. The blits are
+ * clipped against the sources and the clip rectangle of the target once, and are then
+ * performed in order of their layers, where blits in the same layer are performed in the
+ * order that they were added.
+ * \code{cpp}
+ *   cen::blit_batch batch;
+ *
+ *   batch.add(background, {0, 0});
+ *   for (const auto& sprite : sprites) {
+ *     batch.add(sheet, sprite.frame, sprite.position, 1);
+ *   }
+ *
+ *   batch.blit(pool, canvas);
+ * \endcode
+ *
+ * \details Each blit uses the blend mode of its source, like `SDL_BlitSurface()`. Blits
+ * between the 32-bit formats listed in `has_fast_conversion()` are composited with SSE2
+ * or NEON kernels when they are supported. Other blits, including those from sources
+ * with a color key, color or alpha modulation, or RLE acceleration, are forwarded to
+ * `SDL_BlitSurface()`. The kernels round to nearest, so their results might differ from
+ * those of SDL by one unit.
+ *
+ * \note The batch only stores pointers to the sources, which must outlive the blits, and
+ * a source must not be the target of the batch.
+ *
+ * \since 6.1.0
+ */
+class blit_batch final
+{
+ public:
+  /**
+   * \brief Adds a blit of a part of a surface.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param source the surface that will be copied from.
+   * \param sourceRect the part of the source that will be copied.
+   * \param position the position of the copied part, in the target.
+   * \param layer the layer of the blit, lower layers are blitted first.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_surface<T>& source,
+           const irect& sourceRect,
+           const ipoint position,
+           const int layer = 0)
+  {
+    m_items.push_back(
+        {source.get(), sourceRect.get(), {position.x(), position.y()}, layer});
+  }
+
+  /**
+   * \brief Adds a blit of an entire surface.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param source the surface that will be copied.
+   * \param position the position of the copy, in the target.
+   * \param layer the layer of the blit, lower layers are blitted first.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_surface<T>& source, const ipoint position, const int layer = 0)
+  {
+    add(source, irect{0, 0, source.width(), source.height()}, position, layer);
+  }
+
+  /**
+   * \brief Performs all blits.
+   *
+   * \details The batch isn't cleared, so the same blits can be performed again.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param target the surface that will be blitted to.
+   *
+   * \return `success` if all blits were performed; `failure` if any blit that was
+   * forwarded to `SDL_BlitSurface()` failed.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto blit(basic_surface<T>& target) const -> result
+  {
+    return blit_to(nullptr, target.get());
+  }
+
+  /**
+   * \brief Performs all blits, with bands of rows of the target composited in parallel.
+   *
+   * \details The blits are performed sequentially if any of them has to be forwarded to
+   * `SDL_BlitSurface()`.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param pool the thread pool that the work is distributed to.
+   * \param target the surface that will be blitted to.
+   *
+   * \return `success` if all blits were performed; `failure` otherwise.
+   *
+   * \see `blit(basic_surface<T>&)`
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto blit(thread_pool& pool, basic_surface<T>& target) const -> result
+  {
+    return blit_to(&pool, target.get());
+  }
+
+  /**
+   * \brief Removes all blits.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_items.clear();
+  }
+
+  /**
+   * \brief Reserves memory for a number of blits.
+   *
+   * \param count the amount of blits to reserve memory for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const std::size_t count)
+  {
+    m_items.reserve(count);
+  }
+
+  /**
+   * \brief Returns the amount of blits in the batch.
+   *
+   * \return the amount of blits.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_items.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the batch has no blits.
+   *
+   * \return `true` if there are no blits; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_items.empty();
+  }
+
+ private:
+  std::vector<detail::blit_item> m_items;
+
+  [[nodiscard]] auto prepare(SDL_Surface* target,
+                             const detail::channel_layout* layout) const
+      -> std::vector<detail::clipped_blit>
+  {
+    SDL_Rect clip{};
+    SDL_GetClipRect(target, &clip);
+
+    std::vector<detail::clipped_blit> blits;
+    blits.reserve(m_items.size());
+
+    for (const auto& item : m_items)
+    {
+      detail::clipped_blit blit;
+      if (detail::clip_blit(item, clip, blit))
+      {
+        if (layout)
+        {
+          detail::classify_blit(blit, target, *layout);
+        }
+
+        blits.push_back(blit);
+      }
+    }
+
+    std::stable_sort(blits.begin(), blits.end(), [](const auto& a, const auto& b) {
+      return a.layer < b.layer;
+    });
+
+    return blits;
+  }
+
+  auto blit_to(thread_pool* pool, SDL_Surface* target) const -> result
+  {
+    // Targets that require locking are only blitted to by SDL
+    detail::channel_layout layout;
+    const auto fastTarget = detail::get_channel_layout(target->format->format, layout) &&
+                            !SDL_MUSTLOCK(target);
+
+    const auto blits = prepare(target, fastTarget ? &layout : nullptr);
+    const auto level = detail::get_simd_level();
+
+    const auto allFast =
+        std::all_of(blits.begin(), blits.end(), [](const auto& b) { return b.fast; });
+
+    if (pool && allFast && !blits.empty())
+    {
+      SDL_Rect clip{};
+      SDL_GetClipRect(target, &clip);
+
+      // The bands cover disjoint rows, so every band composites its blits in order
+      const auto height = detail::blit_band_height;
+      const auto bands = (clip.h + height - 1) / height;
+      parallel_for(*pool, 0, bands, 1, [&](const int first, const int last) {
+        std::vector<u32> scratch;
+        const auto top = clip.y + first * height;
+        const auto bottom = clip.y + last * height;
+
+        for (const auto& blit : blits)
+        {
+          detail::composite_blit(level, blit, layout, target, top, bottom, scratch);
+        }
+      });
+
+      return success;
+    }
+
+    std::vector<u32> scratch;
+    auto ok = true;
+
+    for (const auto& blit : blits)
+    {
+      if (blit.fast)
+      {
+        detail::composite_blit(level, blit, layout, target, 0, target->h, scratch);
+      }
+      else
+      {
+        auto src = blit.sourceRect;
+        auto dst = blit.targetRect;
+        ok = SDL_BlitSurface(blit.source, &src, target, &dst) == 0 && ok;
+      }
+    }
+
+    return ok;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_BLIT_BATCH_HEADER
@@ -5,11 +5,13 @@
 
 #include <cassert>  // assert
 #include <cmath>    // round, fabs, fmod
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
 #include "../core/integers.hpp"
-#include "../detail/to_string.hpp"
+#include "../detail/binary_layout.hpp"
+#include "../detail/format_writer.hpp"
 
 namespace cen {
 
@@ -494,6 +496,46 @@ class color final
   SDL_Color m_color{0, 0, 0, max()};
 };
 
+/// \cond FALSE
+namespace detail {
+
+template <>
+struct binary_layout<color> final
+{
+  inline constexpr static std::size_t components = 4;
+  inline constexpr static std::size_t component_size = 1;
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Writes a textual representation of the color to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param color the color that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer, const std::size_t size, const color& color) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("color{r: ",
+                      color.red(),
+                      ", g: ",
+                      color.green(),
+                      ", b: ",
+                      color.blue(),
+                      ", a: ",
+                      color.alpha(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of the color.
  *
@@ -505,10 +547,7 @@ class color final
  */
 [[nodiscard]] inline auto to_string(const color& color) -> std::string
 {
-  return "color{r: " + detail::to_string(color.red()).value() +
-         ", g: " + detail::to_string(color.green()).value() +
-         ", b: " + detail::to_string(color.blue()).value() +
-         ", a: " + detail::to_string(color.alpha()).value() + "}";
+  return detail::format_string(color);
 }
 
 /**
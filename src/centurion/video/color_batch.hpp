@@ -0,0 +1,252 @@
+#ifndef CENTURION_COLOR_BATCH_HEADER
+#define CENTURION_COLOR_BATCH_HEADER
+
+#include <SDL.h>
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <type_traits>  // is_standard_layout_v
+
+#include "../core/integers.hpp"
+#include "../detail/color_kernels.hpp"
+#include "color.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/*
+ * The batch functions below use SSE2, AVX2 or NEON instructions when they are supported
+ * by the CPU, which is determined at runtime. In all functions, the output may refer to
+ * the same memory as the inputs, in which case the colors are modified in place.
+ */
+
+/// \cond FALSE
+namespace detail {
+
+static_assert(sizeof(color) == sizeof(SDL_Color));
+static_assert(std::is_standard_layout_v<color>);
+
+[[nodiscard]] inline auto color_bytes(const color* colors) noexcept -> const u8*
+{
+  return reinterpret_cast<const u8*>(colors);
+}
+
+[[nodiscard]] inline auto color_bytes(color* colors) noexcept -> u8*
+{
+  return reinterpret_cast<u8*>(colors);
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \brief Linearly interpolates between two sequences of colors.
+ *
+ * \details This is the batch version of `blend()`, which uses 8-bit fixed-point
+ * arithmetic. The bias is rounded to the nearest multiple of 1/255.
+ *
+ * \pre `bias` must be in the range [0, 1].
+ *
+ * \param a the first colors.
+ * \param b the second colors.
+ * \param[out] out the buffer that receives the blended colors.
+ * \param count the amount of colors in each sequence.
+ * \param bias the bias that determines how the colors are blended, where 0 results in
+ * the first colors and 1 results in the second colors.
+ *
+ * \since 6.1.0
+ */
+inline void lerp_colors(const color* a,
+                        const color* b,
+                        color* out,
+                        const std::size_t count,
+                        const float bias = 0.5f) noexcept
+{
+  assert(bias >= 0);
+  assert(bias <= 1);
+
+  const auto weight = static_cast<u32>(bias * 255.0f + 0.5f);
+  detail::lerp_colors(detail::get_simd_level(),
+                      detail::color_bytes(a),
+                      detail::color_bytes(b),
+                      detail::color_bytes(out),
+                      count,
+                      weight);
+}
+
+/**
+ * \brief Multiplies the channels of two sequences of colors.
+ *
+ * \details Each channel is treated as a value in the range [0, 1], e.g. multiplying by
+ * white leaves a color unchanged, which is useful for tinting.
+ *
+ * \param a the first colors.
+ * \param b the second colors.
+ * \param[out] out the buffer that receives the products.
+ * \param count the amount of colors in each sequence.
+ *
+ * \since 6.1.0
+ */
+inline void multiply_colors(const color* a,
+                            const color* b,
+                            color* out,
+                            const std::size_t count) noexcept
+{
+  detail::multiply_colors(detail::get_simd_level(),
+                          detail::color_bytes(a),
+                          detail::color_bytes(b),
+                          detail::color_bytes(out),
+                          count);
+}
+
+/**
+ * \brief Composites a sequence of colors over another, using premultiplied alpha.
+ *
+ * \details Each result is `source + destination * (1 - source alpha)`, for all four
+ * channels, which is the Porter-Duff "over" operator for premultiplied colors.
+ *
+ * \param source the premultiplied colors that are composited on top.
+ * \param destination the premultiplied colors that are composited below.
+ * \param[out] out the buffer that receives the composited colors.
+ * \param count the amount of colors in each sequence.
+ *
+ * \see `premultiply_pixels()`
+ *
+ * \since 6.1.0
+ */
+inline void composite_colors(const color* source,
+                             const color* destination,
+                             color* out,
+                             const std::size_t count) noexcept
+{
+  detail::composite_kernel(detail::color_bytes(source),
+                           detail::color_bytes(destination),
+                           detail::color_bytes(out),
+                           count);
+}
+
+/**
+ * \brief Creates opaque colors from HSV-encoded values.
+ *
+ * \details This is the batch version of `color::from_hsv()`, which uses single-precision
+ * arithmetic, so the channels might differ by one from that function.
+ *
+ * \pre The hues must be in the range [0, 360].
+ * \pre The saturations and values must be in the range [0, 100].
+ *
+ * \param hues the hues of the colors.
+ * \param saturations the saturations of the colors.
+ * \param values the values of the colors.
+ * \param[out] out the buffer that receives the colors.
+ * \param count the amount of colors.
+ *
+ * \since 6.1.0
+ */
+inline void colors_from_hsv(const float* hues,
+                            const float* saturations,
+                            const float* values,
+                            color* out,
+                            const std::size_t count) noexcept
+{
+  detail::hsv_to_rgb(detail::get_simd_level(),
+                     hues,
+                     saturations,
+                     values,
+                     detail::color_bytes(out),
+                     count);
+}
+
+/**
+ * \brief Creates opaque colors from HSL-encoded values.
+ *
+ * \details This is the batch version of `color::from_hsl()`, which uses single-precision
+ * arithmetic, so the channels might differ by one from that function.
+ *
+ * \pre The hues must be in the range [0, 360].
+ * \pre The saturations and lightnesses must be in the range [0, 100].
+ *
+ * \param hues the hues of the colors.
+ * \param saturations the saturations of the colors.
+ * \param lightnesses the lightnesses of the colors.
+ * \param[out] out the buffer that receives the colors.
+ * \param count the amount of colors.
+ *
+ * \since 6.1.0
+ */
+inline void colors_from_hsl(const float* hues,
+                            const float* saturations,
+                            const float* lightnesses,
+                            color* out,
+                            const std::size_t count) noexcept
+{
+  detail::hsl_to_rgb(detail::get_simd_level(),
+                     hues,
+                     saturations,
+                     lightnesses,
+                     detail::color_bytes(out),
+                     count);
+}
+
+/**
+ * \brief Converts colors to HSV-encoded values.
+ *
+ * \details The hues are in the range [0, 360), and the saturations and values are in the
+ * range [0, 100]. The hue of gray colors is zero. The alpha values are ignored.
+ *
+ * \param colors the colors that will be converted.
+ * \param[out] hues the buffer that receives the hues.
+ * \param[out] saturations the buffer that receives the saturations.
+ * \param[out] values the buffer that receives the values.
+ * \param count the amount of colors.
+ *
+ * \since 6.1.0
+ */
+inline void colors_to_hsv(const color* colors,
+                          float* hues,
+                          float* saturations,
+                          float* values,
+                          const std::size_t count) noexcept
+{
+  detail::rgb_to_hsv(detail::get_simd_level(),
+                     detail::color_bytes(colors),
+                     hues,
+                     saturations,
+                     values,
+                     count);
+}
+
+/**
+ * \brief Converts colors to HSL-encoded values.
+ *
+ * \details The hues are in the range [0, 360), and the saturations and lightnesses are
+ * in the range [0, 100]. The hue of gray colors is zero. The alpha values are ignored.
+ *
+ * \param colors the colors that will be converted.
+ * \param[out] hues the buffer that receives the hues.
+ * \param[out] saturations the buffer that receives the saturations.
+ * \param[out] lightnesses the buffer that receives the lightnesses.
+ * \param count the amount of colors.
+ *
+ * \since 6.1.0
+ */
+inline void colors_to_hsl(const color* colors,
+                          float* hues,
+                          float* saturations,
+                          float* lightnesses,
+                          const std::size_t count) noexcept
+{
+  detail::rgb_to_hsl(detail::get_simd_level(),
+                     detail::color_bytes(colors),
+                     hues,
+                     saturations,
+                     lightnesses,
+                     count);
+}
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_COLOR_BATCH_HEADER
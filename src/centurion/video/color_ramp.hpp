@@ -0,0 +1,269 @@
+#ifndef CENTURION_COLOR_RAMP_HEADER
+#define CENTURION_COLOR_RAMP_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>         // stable_sort
+#include <cassert>           // assert
+#include <cstddef>           // size_t
+#include <initializer_list>  // initializer_list
+#include <vector>            // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "color.hpp"
+#include "palette.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \brief Represents a color at a position in a gradient.
+ *
+ * \since 6.1.0
+ */
+struct color_stop final
+{
+  float position{};  ///< The position in the gradient, in the range [0, 1].
+  color value;       ///< The color at the position.
+};
+
+/**
+ * \class color_ramp
+ *
+ * \brief A gradient that is precomputed into a table of colors.
+ *
+ * \details The gradient is defined by color stops, which are linearly interpolated in
+ * RGBA space when the ramp is created, so that sampling it afterwards is a single table
+ * lookup. The first entry of the table is at position 0 and the last entry at position 1,
+ * positions before the first stop or after the last stop use the color of that stop.
+ * Tables of 256 entries are suitable for 8-bit indices, larger tables such as 4096
+ * entries avoid banding when the ramp is sampled with floating-point values.
+ * \code{cpp}
+ *   const cen::color_ramp heat{{0.0f, cen::colors::black},
+ *                              {0.5f, cen::colors::red},
+ *                              {1.0f, cen::colors::yellow}};
+ * \endcode
+ *
+ * \see `palette_lut`
+ *
+ * \since 6.1.0
+ */
+class color_ramp final
+{
+ public:
+  using size_type = std::size_t;
+  using const_iterator = const color*;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates a ramp from a list of color stops.
+   *
+   * \param stops the color stops, in any order. Stops at the same position create a hard
+   * edge, in the order that they are listed.
+   * \param size the amount of entries in the table, must be at least 2.
+   *
+   * \throws cen_error if there are no color stops.
+   *
+   * \since 6.1.0
+   */
+  explicit color_ramp(const std::initializer_list<color_stop> stops,
+                      const size_type size = 256)
+      : color_ramp{stops.begin(), stops.size(), size}
+  {}
+
+  /**
+   * \brief Creates a ramp from a sequence of color stops.
+   *
+   * \param stops the color stops, in any order.
+   * \param count the amount of color stops.
+   * \param size the amount of entries in the table, must be at least 2.
+   *
+   * \throws cen_error if there are no color stops.
+   *
+   * \since 6.1.0
+   */
+  color_ramp(const color_stop* stops, const size_type count, const size_type size = 256)
+  {
+    assert(size >= 2);
+
+    if (!stops || count == 0)
+    {
+      throw cen_error{"Cannot create color ramp without color stops!"};
+    }
+
+    std::vector<color_stop> sorted(stops, stops + count);
+    std::stable_sort(sorted.begin(),
+                     sorted.end(),
+                     [](const color_stop& a, const color_stop& b) noexcept {
+                       return a.position < b.position;
+                     });
+
+    m_colors.resize(size);
+    bake(sorted);
+  }
+
+  /// \} End of construction
+
+  /**
+   * \brief Returns the color at a position in the gradient.
+   *
+   * \param position the position, clamped to the range [0, 1].
+   *
+   * \return the entry that is nearest to the position.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto sample(const float position) const noexcept -> color
+  {
+    const auto last = static_cast<float>(m_colors.size() - 1);
+    const auto t = position * last;
+    const auto clamped = (t > 0) ? ((t < last) ? t : last) : 0.0f;
+    return m_colors[static_cast<size_type>(clamped + 0.5f)];
+  }
+
+  /**
+   * \brief Creates a palette with 256 colors from the ramp.
+   *
+   * \details The colors are resampled if the ramp doesn't have 256 entries.
+   *
+   * \return a palette where index 0 is the start and index 255 is the end of the ramp.
+   *
+   * \throws sdl_error if the palette couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto to_palette() const -> palette
+  {
+    SDL_Color colors[256];
+    for (int index = 0; index < 256; ++index)
+    {
+      colors[index] = sample(static_cast<float>(index) / 255.0f).get();
+    }
+
+    palette result{256};
+    if (SDL_SetPaletteColors(result.get(), colors, 0, 256) != 0)
+    {
+      throw sdl_error{};
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the entry at an index.
+   *
+   * \pre `index` must be less than the size of the ramp.
+   *
+   * \param index the index of the entry.
+   *
+   * \return the color of the entry.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> const color&
+  {
+    assert(index < m_colors.size());
+    return m_colors[index];
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of entries in the table.
+   *
+   * \return the size of the ramp.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_colors.size();
+  }
+
+  /**
+   * \brief Returns a pointer to the entries of the table.
+   *
+   * \return a pointer to the first entry.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const color*
+  {
+    return m_colors.data();
+  }
+
+  /// \} End of queries
+
+  /// \name Iteration
+  /// \{
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator
+  {
+    return m_colors.data();
+  }
+
+  [[nodiscard]] auto end() const noexcept -> const_iterator
+  {
+    return m_colors.data() + m_colors.size();
+  }
+
+  /// \} End of iteration
+
+ private:
+  std::vector<color> m_colors;
+
+  [[nodiscard]] static auto lerp(const u8 a, const u8 b, const float t) noexcept -> u8
+  {
+    const auto from = static_cast<float>(a);
+    const auto to = static_cast<float>(b);
+    return static_cast<u8>(from + (to - from) * t + 0.5f);
+  }
+
+  void bake(const std::vector<color_stop>& stops) noexcept
+  {
+    const auto last = static_cast<float>(m_colors.size() - 1);
+
+    // The entries are visited in order, so the stops are only traversed once
+    size_type next = 0;
+    for (size_type index = 0; index < m_colors.size(); ++index)
+    {
+      const auto position = static_cast<float>(index) / last;
+      while (next < stops.size() && stops[next].position <= position)
+      {
+        ++next;
+      }
+
+      if (next == 0)
+      {
+        m_colors[index] = stops.front().value;
+      }
+      else if (next == stops.size())
+      {
+        m_colors[index] = stops.back().value;
+      }
+      else
+      {
+        const auto& from = stops[next - 1];
+        const auto& to = stops[next];
+        const auto t = (position - from.position) / (to.position - from.position);
+
+        m_colors[index] = {lerp(from.value.red(), to.value.red(), t),
+                           lerp(from.value.green(), to.value.green(), t),
+                           lerp(from.value.blue(), to.value.blue(), t),
+                           lerp(from.value.alpha(), to.value.alpha(), t)};
+      }
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_COLOR_RAMP_HEADER
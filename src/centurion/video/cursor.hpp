@@ -304,6 +304,13 @@ class basic_cursor final
   detail::pointer_manager<T, SDL_Cursor, deleter> m_cursor;
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_cursor<detail::owning_type>;
+extern template class basic_cursor<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
 /// \name Cursor comparison operators
 /// \{
 
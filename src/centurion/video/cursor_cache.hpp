@@ -0,0 +1,323 @@
+#ifndef CENTURION_CURSOR_CACHE_HEADER
+#define CENTURION_CURSOR_CACHE_HEADER
+
+#include <SDL.h>
+
+#include <array>          // array
+#include <cstddef>        // size_t
+#include <optional>       // optional
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+
+#include "../math/point.hpp"
+#include "cursor.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class cursor_cache
+ *
+ * \brief Creates system and surface cursors once, and switches between them.
+ *
+ * \details Creating cursors is surprisingly expensive on some platforms, in particular
+ * color cursors on X11, so UI code that creates a new cursor whenever the hovered widget
+ * changes can introduce noticeable lag. A cursor cache creates each system cursor on
+ * first use, and stores surface cursors under user-provided identifiers, so that
+ * switching cursors is a lookup followed by `SDL_SetCursor()`. Enabling the cursor that
+ * is already active does nothing, so it's fine to enable a cursor every frame.
+ * \code{cpp}
+ *   cen::cursor_cache cursors;
+ *   cursors.store(crosshair_id, cen::surface{"crosshair.png"}, {16, 16});
+ *
+ *   // Every frame
+ *   if (aiming)
+ *   {
+ *     cursors.enable(crosshair_id);
+ *   }
+ *   else
+ *   {
+ *     cursors.enable(hovering ? cen::system_cursor::hand : cen::system_cursor::arrow);
+ *   }
+ * \endcode
+ *
+ * \note The default cursor is restored when a cache that owns the active cursor is
+ * destroyed.
+ *
+ * \since 6.1.0
+ */
+class cursor_cache final
+{
+ public:
+  using id_type = std::size_t;
+  using size_type = std::size_t;
+
+  cursor_cache() = default;
+
+  cursor_cache(const cursor_cache&) = delete;
+
+  auto operator=(const cursor_cache&) -> cursor_cache& = delete;
+
+  /**
+   * \brief Restores the default cursor if one of the cached cursors is active.
+   *
+   * \since 6.1.0
+   */
+  ~cursor_cache() noexcept
+  {
+    if (owns(SDL_GetCursor()))
+    {
+      cursor::reset();
+    }
+  }
+
+  /// \name System cursors
+  /// \{
+
+  /**
+   * \brief Returns a system cursor, creating it on first use.
+   *
+   * \param type the type of the system cursor.
+   *
+   * \return a handle to the cached system cursor.
+   *
+   * \throws sdl_error if the cursor can't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get(const system_cursor type) -> cursor_handle
+  {
+    auto& entry = m_system.at(static_cast<size_type>(type));
+    if (!entry)
+    {
+      entry.emplace(type);
+    }
+
+    return cursor_handle{*entry};
+  }
+
+  /**
+   * \brief Makes a system cursor the active cursor, creating it on first use.
+   *
+   * \param type the type of the system cursor.
+   *
+   * \throws sdl_error if the cursor can't be created.
+   *
+   * \since 6.1.0
+   */
+  void enable(const system_cursor type)
+  {
+    activate(get(type).get());
+  }
+
+  /// \} End of system cursors
+
+  /// \name Surface cursors
+  /// \{
+
+  /**
+   * \brief Creates and stores a cursor based on a surface.
+   *
+   * \details Any cursor previously stored with the same identifier is replaced.
+   *
+   * \param id the identifier that will be associated with the cursor.
+   * \param surface the icon of the cursor.
+   * \param hotspot the hotspot of the cursor.
+   *
+   * \throws sdl_error if the cursor can't be created.
+   *
+   * \since 6.1.0
+   */
+  void store(const id_type id, const surface& surface, const ipoint hotspot)
+  {
+    cursor created{surface, hotspot};
+
+    if (const auto it = m_stored.find(id); it != m_stored.end())
+    {
+      if (it->second.is_enabled())
+      {
+        created.enable();
+      }
+
+      it->second = std::move(created);
+    }
+    else
+    {
+      m_stored.try_emplace(id, std::move(created));
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not there is a cursor associated with an identifier.
+   *
+   * \param id the identifier that will be checked.
+   *
+   * \return `true` if there is a stored cursor with the identifier; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has_stored(const id_type id) const noexcept -> bool
+  {
+    return m_stored.find(id) != m_stored.end();
+  }
+
+  /**
+   * \brief Returns the cursor associated with an identifier.
+   *
+   * \param id the identifier of the cursor.
+   *
+   * \return a handle to the stored cursor; a null handle if there is no such cursor.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get(const id_type id) const noexcept -> cursor_handle
+  {
+    if (const auto it = m_stored.find(id); it != m_stored.end())
+    {
+      return cursor_handle{it->second};
+    }
+    else
+    {
+      return cursor_handle{nullptr};
+    }
+  }
+
+  /**
+   * \brief Makes a stored cursor the active cursor.
+   *
+   * \param id the identifier of the cursor.
+   *
+   * \return `true` if the cursor is active; `false` if there is no such cursor.
+   *
+   * \since 6.1.0
+   */
+  auto enable(const id_type id) noexcept -> bool
+  {
+    if (const auto handle = get(id))
+    {
+      activate(handle.get());
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Removes a stored cursor.
+   *
+   * \details The default cursor is restored if the removed cursor is active. This
+   * function has no effect if there is no cursor associated with the identifier.
+   *
+   * \param id the identifier of the cursor that will be removed.
+   *
+   * \since 6.1.0
+   */
+  void remove_stored(const id_type id) noexcept
+  {
+    if (const auto it = m_stored.find(id); it != m_stored.end())
+    {
+      if (it->second.is_enabled())
+      {
+        cursor::reset();
+      }
+
+      m_stored.erase(it);
+    }
+  }
+
+  /// \} End of surface cursors
+
+  /**
+   * \brief Destroys all cached cursors.
+   *
+   * \details The default cursor is restored if one of the cached cursors is active.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    if (owns(SDL_GetCursor()))
+    {
+      cursor::reset();
+    }
+
+    for (auto& entry : m_system)
+    {
+      entry.reset();
+    }
+
+    m_stored.clear();
+  }
+
+  /**
+   * \brief Returns the amount of cursors that have been created by the cache.
+   *
+   * \return the amount of cached system and surface cursors.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    size_type count = m_stored.size();
+
+    for (const auto& entry : m_system)
+    {
+      if (entry)
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+ private:
+  std::array<std::optional<cursor>, cursor::count()> m_system;
+  std::unordered_map<id_type, cursor> m_stored;
+
+  static void activate(SDL_Cursor* cursor) noexcept
+  {
+    // Setting a cursor redraws it, even if it's already active
+    if (SDL_GetCursor() != cursor)
+    {
+      SDL_SetCursor(cursor);
+    }
+  }
+
+  [[nodiscard]] auto owns(SDL_Cursor* cursor) const noexcept -> bool
+  {
+    if (!cursor)
+    {
+      return false;
+    }
+
+    for (const auto& entry : m_system)
+    {
+      if (entry && entry->get() == cursor)
+      {
+        return true;
+      }
+    }
+
+    for (const auto& [id, stored] : m_stored)
+    {
+      if (stored.get() == cursor)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_CURSOR_CACHE_HEADER
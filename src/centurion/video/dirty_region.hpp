@@ -0,0 +1,268 @@
+#ifndef CENTURION_DIRTY_REGION_HEADER
+#define CENTURION_DIRTY_REGION_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // min, max
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class dirty_region
+ *
+ * \brief Accumulates the areas of a window surface that need to be presented.
+ *
+ * \details When software rendering to the window surface, see
+ * `basic_window::get_surface()`, it is usually only a small part of the window that
+ * changes from frame to frame. By adding the changed areas to a dirty region and
+ * presenting with `present()`, only those areas are copied to the screen.
+ *
+ * \details Rectangles that overlap are merged, as are rectangles whose union doesn't
+ * cover more pixels than the rectangles themselves, e.g. adjacent rectangles of the same
+ * height. If the amount of rectangles exceeds the limit, the region is collapsed into its
+ * bounding rectangle, which bounds the overhead of presenting many small areas.
+ * \code{cpp}
+ *   cen::dirty_region region;
+ *
+ *   region.add(statusArea);
+ *   region.add(cursorArea);
+ *
+ *   region.present(window);  // Only updates the two areas, then clears the region
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+class dirty_region final
+{
+ public:
+  /**
+   * \brief Creates an empty dirty region.
+   *
+   * \param maxRects the maximum amount of separate rectangles, at least one.
+   *
+   * \since 6.1.0
+   */
+  explicit dirty_region(const std::size_t maxRects = 16)
+      : m_maxRects{(maxRects != 0) ? maxRects : 1u}
+  {
+    m_rects.reserve(m_maxRects + 1u);
+  }
+
+  /**
+   * \brief Adds an area to the region.
+   *
+   * \details Rectangles without an area are ignored.
+   *
+   * \param rect the area that has changed.
+   *
+   * \since 6.1.0
+   */
+  void add(const irect& rect)
+  {
+    if (!rect.has_area())
+    {
+      return;
+    }
+
+    auto merged = rect;
+
+    // Merging can make the rectangle overlap rectangles that were checked earlier
+    for (std::size_t index = 0; index < m_rects.size();)
+    {
+      if (should_merge(m_rects[index], merged))
+      {
+        merged = get_union(m_rects[index], merged);
+
+        m_rects[index] = m_rects.back();
+        m_rects.pop_back();
+
+        index = 0;
+      }
+      else
+      {
+        ++index;
+      }
+    }
+
+    m_rects.push_back(merged);
+
+    if (m_rects.size() > m_maxRects)
+    {
+      const auto all = bounds();
+      m_rects.clear();
+      m_rects.push_back(all);
+    }
+  }
+
+  /**
+   * \brief Marks an entire surface of the specified size as dirty.
+   *
+   * \param size the size of the surface, e.g. after the window has been resized.
+   *
+   * \since 6.1.0
+   */
+  void invalidate(const iarea size)
+  {
+    m_rects.clear();
+    add(irect{{0, 0}, size});
+  }
+
+  /**
+   * \brief Removes all areas from the region.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_rects.clear();
+  }
+
+  /**
+   * \brief Updates the dirty areas of a window surface, and clears the region.
+   *
+   * \details The areas are clipped to the window surface. The region is only cleared if
+   * the surface was successfully updated, so that the areas are presented again later.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the window of which the surface will be updated.
+   *
+   * \return `success` if the surface was updated, or if the region was empty; `failure`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto present(basic_window<T>& window) -> result
+  {
+    if (m_rects.empty())
+    {
+      return success;
+    }
+
+    const auto* surface = SDL_GetWindowSurface(window.get());
+    if (!surface)
+    {
+      return failure;
+    }
+
+    m_clipped.clear();
+    for (const auto& rect : m_rects)
+    {
+      const auto x = (std::max)(rect.x(), 0);
+      const auto y = (std::max)(rect.y(), 0);
+      const auto maxX = (std::min)(rect.max_x(), surface->w);
+      const auto maxY = (std::min)(rect.max_y(), surface->h);
+
+      if (maxX > x && maxY > y)
+      {
+        m_clipped.push_back(irect{x, y, maxX - x, maxY - y});
+      }
+    }
+
+    if (window.update_surface(m_clipped))
+    {
+      m_rects.clear();
+      return success;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the rectangles of the region.
+   *
+   * \return the disjoint rectangles that make up the region, in no particular order.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto rects() const noexcept -> const std::vector<irect>&
+  {
+    return m_rects;
+  }
+
+  /**
+   * \brief Returns the bounding rectangle of the region.
+   *
+   * \return the smallest rectangle that contains the region; an empty rectangle if the
+   * region is empty.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto bounds() const noexcept -> irect
+  {
+    irect result;
+    for (const auto& rect : m_rects)
+    {
+      result = get_union(result, rect);
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Returns the amount of pixels covered by the region.
+   *
+   * \return the total area of the rectangles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto area() const noexcept -> int
+  {
+    int result = 0;
+    for (const auto& rect : m_rects)
+    {
+      result += rect.area();
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_rects.empty();
+  }
+
+  [[nodiscard]] auto count() const noexcept -> std::size_t
+  {
+    return m_rects.size();
+  }
+
+  [[nodiscard]] auto max_rects() const noexcept -> std::size_t
+  {
+    return m_maxRects;
+  }
+
+  /// \} End of queries
+
+ private:
+  std::vector<irect> m_rects;
+  std::vector<irect> m_clipped;  // Reused when presenting
+  std::size_t m_maxRects{};
+
+  [[nodiscard]] static auto should_merge(const irect& a, const irect& b) noexcept -> bool
+  {
+    return intersects(a, b) || get_union(a, b).area() <= a.area() + b.area();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DIRTY_REGION_HEADER
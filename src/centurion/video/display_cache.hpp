@@ -0,0 +1,302 @@
+#ifndef CENTURION_DISPLAY_CACHE_HEADER
+#define CENTURION_DISPLAY_CACHE_HEADER
+
+#include <SDL.h>
+
+#include <atomic>    // atomic
+#include <cstddef>   // size_t
+#include <optional>  // optional
+#include <string>    // string
+#include <vector>    // vector
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "pixel_format.hpp"
+#include "screen.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct display_info
+ *
+ * \brief A snapshot of all of the properties of a display.
+ *
+ * \details Properties that couldn't be queried keep their default values, with the
+ * exception of the DPI, which is absent on platforms that don't report it.
+ *
+ * \see `display_cache`
+ *
+ * \since 6.1.0
+ */
+struct display_info final
+{
+  int index{};                                 ///< The display index.
+  std::string name;                            ///< The display name.
+  iarea size{};                                ///< The desktop resolution.
+  int refresh_rate{};                          ///< The refresh rate, zero if unknown.
+  pixel_format format{pixel_format::unknown};  ///< The desktop pixel format.
+  irect bounds;                                ///< The desktop area.
+  irect usable_bounds;                         ///< The desktop area without task bars.
+  std::optional<dpi_info> dpi;                 ///< The DPI, if reported.
+  screen_orientation orientation{screen_orientation::unknown};  ///< The orientation.
+
+  /**
+   * \brief Queries all of the properties of a display.
+   *
+   * \param index the index of the queried display.
+   *
+   * \return the properties of the display.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto query(const int index) -> display_info
+  {
+    display_info info;
+    info.index = index;
+
+    if (const auto* str = screen::name(index))
+    {
+      info.name = str;
+    }
+
+    if (SDL_DisplayMode mode{}; SDL_GetDesktopDisplayMode(index, &mode) == 0)
+    {
+      info.size = {mode.w, mode.h};
+      info.refresh_rate = mode.refresh_rate;
+      info.format = static_cast<pixel_format>(mode.format);
+    }
+
+    SDL_GetDisplayBounds(index, info.bounds.data());
+    SDL_GetDisplayUsableBounds(index, info.usable_bounds.data());
+
+    info.dpi = screen::dpi(index);
+    info.orientation = screen::get_orientation(index);
+
+    return info;
+  }
+
+  /**
+   * \brief Queries all of the properties of every display.
+   *
+   * \return the properties of all displays, ordered by their index.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto query_all() -> std::vector<display_info>
+  {
+    const auto count = SDL_GetNumVideoDisplays();
+
+    std::vector<display_info> displays;
+    displays.reserve(static_cast<std::size_t>((count > 0) ? count : 0));
+
+    for (int index = 0; index < count; ++index)
+    {
+      displays.push_back(query(index));
+    }
+
+    return displays;
+  }
+};
+
+/**
+ * \class display_cache
+ *
+ * \brief Caches the properties of every display, until the display setup changes.
+ *
+ * \details Display queries call into the video driver, which is too expensive to do
+ * every frame, e.g. for layout code. The cache queries every display once, and then
+ * serves the snapshots until it's invalidated. An event watch invalidates the cache
+ * whenever a display event is pushed, i.e. when a display is connected, disconnected or
+ * reoriented, and when a window is moved or resized, since that can be caused by a
+ * changed resolution or scale.
+ * \code{cpp}
+ *   cen::display_cache displays;
+ *
+ *   // Every frame
+ *   if (const auto* display = displays.find(window.display_index().value_or(0)))
+ *   {
+ *     layout.set_dpi(display->dpi ? display->dpi->diagonal : 96.0f);
+ *   }
+ * \endcode
+ *
+ * \note The cache is only refreshed by the thread that queries it, the event watch only
+ * marks it as invalid, so the event watch is safe to run on any thread.
+ *
+ * \since 6.1.0
+ */
+class display_cache final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates an empty cache and registers its event watch.
+   *
+   * \details The displays are queried on first use.
+   *
+   * \since 6.1.0
+   */
+  display_cache() noexcept
+  {
+    SDL_AddEventWatch(&on_event, this);
+  }
+
+  display_cache(const display_cache&) = delete;
+
+  auto operator=(const display_cache&) -> display_cache& = delete;
+
+  /**
+   * \brief Unregisters the event watch.
+   *
+   * \since 6.1.0
+   */
+  ~display_cache() noexcept
+  {
+    SDL_DelEventWatch(&on_event, this);
+  }
+
+  /**
+   * \brief Returns the properties of every display.
+   *
+   * \details The displays are queried again if the cache has been invalidated.
+   *
+   * \return the snapshots of all displays, ordered by their index.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto displays() -> const std::vector<display_info>&
+  {
+    if (m_dirty.exchange(false, std::memory_order_acquire))
+    {
+      refresh();
+    }
+
+    return m_displays;
+  }
+
+  /**
+   * \brief Returns the properties of a display.
+   *
+   * \param index the index of the display.
+   *
+   * \return a pointer to the snapshot of the display; a null pointer if there is no such
+   * display. The pointer is invalidated by the next refresh.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto find(const int index) -> const display_info*
+  {
+    const auto& all = displays();
+    if (index >= 0 && static_cast<size_type>(index) < all.size())
+    {
+      return &all[static_cast<size_type>(index)];
+    }
+    else
+    {
+      return nullptr;
+    }
+  }
+
+  /**
+   * \brief Marks the cache as outdated, so that the displays are queried on next use.
+   *
+   * \since 6.1.0
+   */
+  void invalidate() noexcept
+  {
+    m_dirty.store(true, std::memory_order_release);
+  }
+
+  /**
+   * \brief Invalidates the cache if an event affects the display setup.
+   *
+   * \details This is what the event watch does, which makes it possible to feed the
+   * cache from other sources, e.g. recorded events.
+   *
+   * \param event the event that will be inspected.
+   *
+   * \return `true` if the cache was invalidated; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto handle(const SDL_Event& event) noexcept -> bool
+  {
+    if (affects_displays(event))
+    {
+      invalidate();
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Returns the amount of times that the displays have been queried.
+   *
+   * \return the amount of refreshes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto refresh_count() const noexcept -> u64
+  {
+    return m_refreshes;
+  }
+
+ private:
+  std::vector<display_info> m_displays;
+  std::atomic<bool> m_dirty{true};
+  u64 m_refreshes{};
+
+  void refresh()
+  {
+    m_displays = display_info::query_all();
+    ++m_refreshes;
+  }
+
+  [[nodiscard]] static auto affects_displays(const SDL_Event& event) noexcept -> bool
+  {
+    if (event.type == SDL_DISPLAYEVENT)
+    {
+      return true;
+    }
+    else if (event.type == SDL_WINDOWEVENT)
+    {
+      switch (event.window.event)
+      {
+        case SDL_WINDOWEVENT_MOVED:
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+        case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+          return true;
+
+        default:
+          return false;
+      }
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    static_cast<display_cache*>(data)->handle(*event);
+    return 0;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DISPLAY_CACHE_HEADER
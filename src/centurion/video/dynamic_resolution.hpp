@@ -0,0 +1,404 @@
+#ifndef CENTURION_DYNAMIC_RESOLUTION_HEADER
+#define CENTURION_DYNAMIC_RESOLUTION_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // clamp, max
+#include <cassert>    // assert
+#include <cmath>      // lround, sqrt, floor
+#include <cstddef>    // size_t
+#include <optional>   // optional
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/time.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/frame_stats.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "scale_mode.hpp"
+#include "texture_access.hpp"
+#include "texture_pool.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct dynamic_resolution_settings
+ *
+ * \brief Describes how a `dynamic_resolution` controller adapts the resolution.
+ *
+ * \since 6.1.0
+ */
+struct dynamic_resolution_settings final
+{
+  milliseconds<double> target{1'000.0 / 60.0};  ///< The frame time to stay below.
+  float min_scale{0.5f};                        ///< The lowest resolution scale.
+  float max_scale{1.0f};                        ///< The highest resolution scale.
+  float step{0.05f};                            ///< The granularity of the scale.
+  double headroom{0.85};                        ///< The fraction to scale up below.
+  double smoothing{0.1};                        ///< The weight of new frame times.
+  u32 cooldown{15};                             ///< The frames between changes.
+};
+
+/**
+ * \class dynamic_resolution
+ *
+ * \brief Renders a scene at a resolution that adapts to keep the frame time below a
+ * target.
+ *
+ * \details The scene is rendered into a target texture, leased from a texture pool,
+ * whose size is the output size of the renderer times the current resolution scale. The
+ * texture is then upscaled to the output with linear filtering. The frame times are fed
+ * to the controller, which lowers the scale when frames take longer than the target,
+ * and raises it again when there's enough headroom.
+ * \code{cpp}
+ *   cen::texture_pool pool;
+ *   cen::frame_stats<> stats;
+ *   cen::dynamic_resolution resolution{renderer, pool};
+ *
+ *   // Every frame
+ *   resolution.begin_frame();
+ *   draw_scene(renderer, resolution.scene_size());
+ *   resolution.end_frame();
+ *
+ *   draw_ui(renderer);
+ *   renderer.present();
+ *
+ *   stats.tick();
+ *   resolution.update(stats);
+ * \endcode
+ *
+ * \details The scale is quantized to the step in the settings, so that the scene is
+ * only rendered at a few distinct sizes, and textures for previously used sizes are
+ * recycled by the pool. Since the rendering cost is roughly proportional to the amount
+ * of pixels, the scale is lowered in proportion to the square root of the overshoot.
+ *
+ * \note The renderer and the pool must outlive the controller.
+ *
+ * \since 6.1.0
+ */
+class dynamic_resolution final
+{
+ public:
+  using settings_type = dynamic_resolution_settings;
+  using duration_type = milliseconds<double>;
+
+  /**
+   * \brief Creates a controller that starts at the highest resolution scale.
+   *
+   * \param renderer the renderer that the scene is rendered with.
+   * \param pool the pool that the scene textures are leased from.
+   * \param settings the settings that control the resolution.
+   *
+   * \throws cen_error if the settings are invalid.
+   *
+   * \since 6.1.0
+   */
+  dynamic_resolution(renderer& renderer,
+                     texture_pool& pool,
+                     const settings_type& settings = {})
+      : m_renderer{&renderer}
+      , m_pool{&pool}
+      , m_settings{checked_settings(settings)}
+      , m_scale{settings.max_scale}
+  {}
+
+  /// \name Rendering
+  /// \{
+
+  /**
+   * \brief Redirects rendering to a scene texture of the current resolution, and clears
+   * it.
+   *
+   * \details Render the scene in the coordinates of `scene_size()`.
+   *
+   * \return `success` if the scene texture is the render target; `failure` otherwise.
+   *
+   * \throws sdl_error if the scene texture can't be created.
+   *
+   * \since 6.1.0
+   */
+  auto begin_frame() -> result
+  {
+    m_outputSize = m_renderer->output_size();
+
+    const iarea size{scaled(m_outputSize.width), scaled(m_outputSize.height)};
+    if (!m_scene || m_scene->key().size != size)
+    {
+      m_scene.reset();
+      m_scene.emplace(m_pool->acquire(*m_renderer,
+                                      pixel_format::rgba8888,
+                                      texture_access::target,
+                                      size));
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+      (*m_scene)->set_scale_mode(scale_mode::linear);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+    }
+
+    if (!m_renderer->set_target(**m_scene))
+    {
+      return failure;
+    }
+
+    return m_renderer->clear();
+  }
+
+  /**
+   * \brief Restores the default render target, and upscales the scene to the output.
+   *
+   * \pre `begin_frame()` must have been called.
+   *
+   * \return `success` if the scene was rendered to the output; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto end_frame() noexcept -> result
+  {
+    assert(m_scene);
+
+    if (!m_renderer->reset_target())
+    {
+      return failure;
+    }
+
+    return m_renderer->render(**m_scene, irect{{0, 0}, m_outputSize});
+  }
+
+  /// \} End of rendering
+
+  /// \name Control
+  /// \{
+
+  /**
+   * \brief Feeds the duration of a frame to the controller.
+   *
+   * \param duration the duration of the most recent frame.
+   *
+   * \return `true` if the resolution scale was changed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto record(const duration_type duration) noexcept -> bool
+  {
+    const auto weight = m_settings.smoothing;
+    m_average = (m_frames == 0)
+                    ? duration.count()
+                    : m_average + (duration.count() - m_average) * weight;
+
+    ++m_frames;
+    if (++m_sinceChange < m_settings.cooldown)
+    {
+      return false;
+    }
+
+    const auto target = m_settings.target.count();
+    auto scale = m_scale;
+
+    if (m_average > target)
+    {
+      const auto factor = static_cast<float>(std::sqrt(target / m_average));
+      scale = quantize_down(m_scale * factor);
+    }
+    else if (m_average < target * m_settings.headroom)
+    {
+      scale = quantize_down(m_scale + m_settings.step * 1.5f);
+    }
+
+    scale = std::clamp(scale, m_settings.min_scale, m_settings.max_scale);
+    if (scale != m_scale)
+    {
+      m_scale = scale;
+      m_sinceChange = 0;
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Feeds the latest frame of a frame statistics instance to the controller.
+   *
+   * \details Nothing happens if no frame has been recorded since the previous call.
+   *
+   * \tparam Capacity the capacity of the frame statistics.
+   *
+   * \param stats the frame statistics that will be read.
+   *
+   * \return `true` if the resolution scale was changed; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <std::size_t Capacity>
+  auto update(const frame_stats<Capacity>& stats) noexcept -> bool
+  {
+    if (stats.total_frames() == m_statsFrames)
+    {
+      return false;
+    }
+
+    m_statsFrames = stats.total_frames();
+    return record(stats.latest());
+  }
+
+  /**
+   * \brief Changes the highest resolution scale.
+   *
+   * \details The current scale is lowered immediately if it exceeds the new maximum. This
+   * can be used to save power, e.g. when running on battery.
+   *
+   * \param scale the highest resolution scale, in the range [`settings().min_scale`, 1].
+   *
+   * \throws cen_error if the scale is outside of the valid range.
+   *
+   * \since 6.1.0
+   */
+  void set_max_scale(const float scale)
+  {
+    if (scale < m_settings.min_scale || scale > 1)
+    {
+      throw cen_error{"Invalid dynamic resolution scale range!"};
+    }
+
+    m_settings.max_scale = scale;
+    if (m_scale > scale)
+    {
+      m_scale = scale;
+      m_sinceChange = 0;
+    }
+  }
+
+  /**
+   * \brief Resets the controller to the highest resolution scale.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_scale = m_settings.max_scale;
+    m_average = 0;
+    m_frames = 0;
+    m_sinceChange = 0;
+  }
+
+  /// \} End of control
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the current resolution scale.
+   *
+   * \return the resolution relative to the output size.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto scale() const noexcept -> float
+  {
+    return m_scale;
+  }
+
+  /**
+   * \brief Returns the size of the scene texture, in pixels.
+   *
+   * \return the size of the current scene texture; a zero size before the first frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto scene_size() const noexcept -> iarea
+  {
+    return m_scene ? m_scene->key().size : iarea{};
+  }
+
+  /**
+   * \brief Returns the smoothed frame time.
+   *
+   * \return the moving average of the recorded frame times.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto average() const noexcept -> duration_type
+  {
+    return duration_type{m_average};
+  }
+
+  /**
+   * \brief Returns the settings of the controller.
+   *
+   * \return the controller settings.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto settings() const noexcept -> const settings_type&
+  {
+    return m_settings;
+  }
+
+  /// \} End of queries
+
+ private:
+  renderer* m_renderer{};
+  texture_pool* m_pool{};
+  settings_type m_settings;
+  float m_scale{1};
+  double m_average{};
+  u64 m_frames{};
+  u64 m_statsFrames{};
+  u32 m_sinceChange{};
+  iarea m_outputSize{};
+  std::optional<texture_pool::lease> m_scene;
+
+  [[nodiscard]] auto quantize_down(const float scale) const noexcept -> float
+  {
+    // The epsilon avoids rounding a scale that is already on a step down to the next one
+    const auto steps = std::floor(scale / m_settings.step + 1e-3f);
+    return steps * m_settings.step;
+  }
+
+  [[nodiscard]] auto scaled(const int pixels) const noexcept -> int
+  {
+    const auto result = std::lround(static_cast<float>(pixels) * m_scale);
+    return (std::max)(1, static_cast<int>(result));
+  }
+
+  [[nodiscard]] static auto checked_settings(const settings_type& settings)
+      -> const settings_type&
+  {
+    if (settings.target.count() <= 0)
+    {
+      throw cen_error{"Invalid dynamic resolution target!"};
+    }
+
+    if (settings.min_scale <= 0 || settings.min_scale > settings.max_scale ||
+        settings.max_scale > 1)
+    {
+      throw cen_error{"Invalid dynamic resolution scale range!"};
+    }
+
+    if (settings.step <= 0)
+    {
+      throw cen_error{"Invalid dynamic resolution step!"};
+    }
+
+    if (settings.headroom <= 0 || settings.headroom >= 1 || settings.smoothing <= 0 ||
+        settings.smoothing > 1)
+    {
+      throw cen_error{"Invalid dynamic resolution smoothing!"};
+    }
+
+    return settings;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_DYNAMIC_RESOLUTION_HEADER
@@ -1,9 +1,12 @@
 #ifndef CENTURION_FONT_HEADER
 #define CENTURION_FONT_HEADER
 
+#ifndef CENTURION_NO_SDL_TTF
+
 #include <SDL_ttf.h>
 
 #include <cassert>   // assert
+#include <cstddef>   // size_t
 #include <memory>    // unique_ptr
 #include <optional>  // optional
 #include <ostream>   // ostream
@@ -13,9 +16,10 @@
 #include "../core/exception.hpp"
 #include "../core/not_null.hpp"
 #include "../core/to_underlying.hpp"
-#include "../detail/address_of.hpp"
-#include "../detail/to_string.hpp"
+#include "../detail/format_writer.hpp"
+#include "../filesystem/file.hpp"
 #include "../math/area.hpp"
+#include "font_source.hpp"
 #include "unicode_string.hpp"
 
 namespace cen {
@@ -113,6 +117,78 @@ class font final
   font(const std::string& file, const int size) : font{file.c_str(), size}
   {}
 
+  /**
+   * \brief Creates a font based on TrueType data read from a file.
+   *
+   * \details Glyphs are read from the file on demand for as long as the font is alive,
+   * so the font claims ownership of the file and closes it when it is destroyed.
+   * \code{cpp}
+   *   const cen::asset_pack pack{"assets.pak"};
+   *   cen::font font{pack.open("fonts/daniel.ttf"), 12};
+   * \endcode
+   *
+   * \param source the file that the font will be read from, ownership is claimed.
+   * \param size the font size, must be greater than zero.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  font(file&& source, const int size) : m_size{size}
+  {
+    if (size <= 0)
+    {
+      throw cen_error{"Bad font size!"};
+    }
+
+    m_font.reset(TTF_OpenFontRW(source.release(), 1, size));
+    if (!m_font)
+    {
+      throw ttf_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a font based on TrueType data stored in a block of memory.
+   *
+   * \details The memory isn't copied, and glyphs are read from it on demand, so the
+   * memory must outlive the font.
+   *
+   * \param data a pointer to the TrueType data, mustn't be null.
+   * \param dataSize the amount of bytes of TrueType data.
+   * \param size the font size, must be greater than zero.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  font(const not_null<const void*> data, const std::size_t dataSize, const int size)
+      : font{file::from_memory(data, dataSize), size}
+  {}
+
+  /**
+   * \brief Creates a font that reads its glyphs from the shared bytes of a font source.
+   *
+   * \details The font shares ownership of the bytes, so the source doesn't have to
+   * outlive the font. Fonts of different sizes that are created from the same source
+   * don't read or copy the font file again.
+   *
+   * \param source the source that contains the TrueType data.
+   * \param size the font size, must be greater than zero.
+   *
+   * \throws cen_error if the supplied size is not greater than zero.
+   * \throws ttf_error if the font cannot be loaded.
+   *
+   * \since 6.1.0
+   */
+  font(const font_source& source, const int size)
+      : font{file::from_memory(source.data(), source.size()), size}
+  {
+    m_source = source;
+  }
+
   /// \} End of construction
 
   /// \name Style functions
@@ -716,6 +792,7 @@ class font final
     }
   };
 
+  std::optional<font_source> m_source;  // Declared first, since it must outlive the font
   std::unique_ptr<TTF_Font, deleter> m_font;
   int m_size{};
 
@@ -752,6 +829,31 @@ class font final
   }
 };
 
+/**
+ * \brief Writes a textual representation of a font instance to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param font the font that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer, const std::size_t size, const font& font) noexcept
+    -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("font{data: ",
+                      font.get(),
+                      ", name: ",
+                      font.family_name(),
+                      ", size: ",
+                      font.size(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a font instance.
  *
@@ -761,9 +863,7 @@ class font final
  */
 [[nodiscard]] inline auto to_string(const font& font) -> std::string
 {
-  return "font{data: " + detail::address_of(font.get()) +
-         ", name: " + std::string{font.family_name()} +
-         ", size: " + detail::to_string(font.size()).value() + "}";
+  return detail::format_string(font);
 }
 
 /**
@@ -785,4 +885,5 @@ inline auto operator<<(std::ostream& stream, const font& font) -> std::ostream&
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_SDL_TTF
 #endif  // CENTURION_FONT_HEADER
\ No newline at end of file
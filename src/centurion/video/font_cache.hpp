@@ -1,18 +1,47 @@
 #ifndef CENTURION_FONT_CACHE_HEADER
 #define CENTURION_FONT_CACHE_HEADER
 
+#ifndef CENTURION_NO_SDL_TTF
+
 #include <SDL_ttf.h>
 
+#include <atomic>         // atomic
 #include <cassert>        // assert
+#include <cstddef>        // size_t, ptrdiff_t
+#include <iterator>       // make_move_iterator
+#include <list>           // list
+#include <memory>         // unique_ptr, make_unique
+#include <optional>       // optional
+#include <stdexcept>      // out_of_range
 #include <string>         // string
 #include <unordered_map>  // unordered_map
 #include <utility>        // move, forward
+#include <vector>         // vector
 
 #include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
 #include "../core/not_null.hpp"
+#include "../core/time.hpp"
+#include "../detail/distance_field.hpp"
+#include "../detail/flat_id_map.hpp"
+#include "../detail/glyph_table.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "../system/counter.hpp"
+#include "../system/profiler.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "color.hpp"
+#include "colors.hpp"
 #include "font.hpp"
+#include "pixel_format.hpp"
+#include "scale_mode.hpp"
 #include "surface.hpp"
 #include "texture.hpp"
+#include "texture_atlas.hpp"
+#include "texture_memory.hpp"
 #include "unicode_string.hpp"
 
 namespace cen {
@@ -40,6 +69,22 @@ namespace cen {
  * render at compile-time. Use this option if you know that you're going to render some
  * specific string a lot.
  *
+ * By default, each cached glyph is stored in a separate texture. Alternatively, the
+ * glyphs can be packed into a few shared atlas textures, see `enable_glyph_atlas()`. This
+ * makes it possible to render a string with very few texture switches.
+ *
+ * Glyphs can also be rasterized on a background thread, see `begin_warm_up()`, in which
+ * case only the texture uploads are performed by the render thread.
+ *
+ * Glyphs that the font doesn't provide can be taken from fallback fonts, e.g. for CJK
+ * characters or emoji, see `add_fallback()`. The font that provides a glyph is resolved
+ * once when the glyph is cached, so rendering never probes the fonts.
+ *
+ * Glyphs are cached with the style and outline that the font has when they are added.
+ * Other variants of the glyphs, e.g. outlined or bold glyphs, can be cached alongside
+ * them, see `glyph_style`, so that differently styled text can be mixed without
+ * reconfiguring the font.
+ *
  * \since 5.0.0
  */
 class font_cache final
@@ -60,6 +105,43 @@ class font_cache final
     glyph_metrics metrics;  ///< The metrics of the glyph.
   };
 
+  /**
+   * \struct atlas_glyph
+   *
+   * \brief Simple aggregate that contains the location and metrics of a glyph that is
+   * stored in a glyph atlas.
+   *
+   * \see `enable_glyph_atlas()`
+   *
+   * \since 6.1.0
+   */
+  struct atlas_glyph final
+  {
+    std::size_t page{};       ///< The index of the atlas page that contains the glyph.
+    irect source;             ///< The area of the atlas page that contains the glyph.
+    glyph_metrics metrics;    ///< The metrics of the glyph.
+    std::size_t fontIndex{};  ///< The index of the font that provided the glyph.
+  };
+
+  /**
+   * \struct glyph_style
+   *
+   * \brief Describes a styled variant of the glyphs of a font cache.
+   *
+   * \details Styled glyphs are stored separately from the glyphs that use the current
+   * style of the font, and are rendered with the style regardless of the configuration
+   * of the font.
+   *
+   * \see `add_glyph(Renderer&, unicode, const glyph_style&)`
+   *
+   * \since 6.1.0
+   */
+  struct glyph_style final
+  {
+    int mask{TTF_STYLE_NORMAL};  ///< The bit mask of `TTF_STYLE_*` flags.
+    int outline{};               ///< The outline size, in pixels.
+  };
+
   /// \name Construction
   /// \{
 
@@ -511,7 +593,7 @@ class font_cache final
    */
   [[nodiscard]] auto has_stored(const id_type id) const noexcept -> bool
   {
-    return m_strings.find(id) != m_strings.end();
+    return m_strings.contains(id);
   }
 
   /**
@@ -545,18 +627,200 @@ class font_cache final
    */
   [[nodiscard]] auto try_get_stored(const id_type id) const noexcept -> const texture*
   {
-    const auto iterator = m_strings.find(id);
-    if (iterator != m_strings.end())
-    {
-      return &iterator->second;
-    }
-    else
+    return m_strings.find(id);
+  }
+
+  /**
+   * \brief Removes the cached string texture associated with the specified ID.
+   *
+   * \details This function has no effect if there is no texture associated with the ID.
+   *
+   * \param id the key of the texture that will be removed.
+   *
+   * \since 6.1.0
+   */
+  void remove_stored(const id_type id) noexcept
+  {
+    m_strings.erase(id);
+  }
+
+  /// \} End of string texture caching
+
+  /// \name Content-keyed string caching
+  /// \{
+
+  /**
+   * \brief Returns a cached texture of a string, rendering it first if needed.
+   *
+   * \details String textures obtained with the `get_or_store_*` functions are keyed by
+   * their content, i.e. the text, the rendering style, the font style and the colors.
+   * Identical text rendered in subsequent frames therefore reuses the same texture. The
+   * amount of such textures can be bounded, see `set_string_cache_capacity()`, in which
+   * case the least recently used textures are evicted first.
+   *
+   * \note The returned reference is invalidated when the texture is evicted, which can
+   * happen on any subsequent call to a `get_or_store_*` function.
+   *
+   * \tparam Renderer the type of the renderer that will be used.
+   *
+   * \param string the string that will be rendered.
+   * \param renderer the renderer that will be used, its color is used for the text.
+   *
+   * \return the cached texture of the string.
+   *
+   * \see `basic_renderer::render_blended_utf8()`
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto get_or_store_blended_utf8(const std::string& string, Renderer& renderer)
+      -> const texture&
+  {
+    return find_or_render('b', string, renderer.get_color(), {}, 0, [&] {
+      return renderer.render_blended_utf8(string.c_str(), get_font());
+    });
+  }
+
+  /**
+   * \copybrief get_or_store_blended_utf8()
+   *
+   * \copydetails get_or_store_blended_utf8()
+   *
+   * \param wrap the width in pixels after which the text will be wrapped.
+   *
+   * \see `basic_renderer::render_blended_wrapped_utf8()`
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto get_or_store_blended_wrapped_utf8(const std::string& string,
+                                         Renderer& renderer,
+                                         const u32 wrap) -> const texture&
+  {
+    return find_or_render('w', string, renderer.get_color(), {}, wrap, [&] {
+      return renderer.render_blended_wrapped_utf8(string.c_str(), get_font(), wrap);
+    });
+  }
+
+  /**
+   * \copybrief get_or_store_blended_utf8()
+   *
+   * \copydetails get_or_store_blended_utf8()
+   *
+   * \param background the color used for the background box.
+   *
+   * \see `basic_renderer::render_shaded_utf8()`
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto get_or_store_shaded_utf8(const std::string& string,
+                                Renderer& renderer,
+                                const color& background) -> const texture&
+  {
+    return find_or_render('s', string, renderer.get_color(), background, 0, [&] {
+      return renderer.render_shaded_utf8(string.c_str(), get_font(), background);
+    });
+  }
+
+  /**
+   * \copybrief get_or_store_blended_utf8()
+   *
+   * \copydetails get_or_store_blended_utf8()
+   *
+   * \see `basic_renderer::render_solid_utf8()`
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto get_or_store_solid_utf8(const std::string& string, Renderer& renderer)
+      -> const texture&
+  {
+    return find_or_render('o', string, renderer.get_color(), {}, 0, [&] {
+      return renderer.render_solid_utf8(string.c_str(), get_font());
+    });
+  }
+
+  /**
+   * \brief Bounds the amount of content-keyed string textures.
+   *
+   * \details When a limit is exceeded, the least recently used textures are evicted
+   * until the cache is within its limits again. The memory usage of a texture is
+   * estimated as four bytes per pixel. Strings cached with an explicit ID are never
+   * evicted.
+   *
+   * \param maxEntries the maximum amount of textures, zero means no limit.
+   * \param maxBytes the maximum estimated memory usage in bytes, zero means no limit.
+   *
+   * \since 6.1.0
+   */
+  void set_string_cache_capacity(const std::size_t maxEntries,
+                                 const std::size_t maxBytes = 0)
+  {
+    m_maxEntries = maxEntries;
+    m_maxBytes = maxBytes;
+    evict(0, 0);
+  }
+
+  /**
+   * \brief Evicts content-keyed string textures until the texture memory budget is met.
+   *
+   * \details The least recently used textures are evicted first. This is intended to be
+   * used by a texture memory budget callback, see `texture_memory::set_budget()`.
+   *
+   * \return the amount of evicted textures.
+   *
+   * \since 6.1.0
+   */
+  auto trim_string_cache_to_budget() -> std::size_t
+  {
+    std::size_t count = 0;
+    while (!m_lru.empty() && texture_memory::over_budget())
     {
-      return nullptr;
+      evict_least_recently_used();
+      ++count;
     }
+
+    return count;
   }
 
-  /// \} End of string texture caching
+  /**
+   * \brief Removes all content-keyed string textures.
+   *
+   * \since 6.1.0
+   */
+  void clear_string_cache() noexcept
+  {
+    m_lru.clear();
+    m_dynamicStrings.clear();
+    m_dynamicBytes = 0;
+  }
+
+  /**
+   * \brief Returns the amount of content-keyed string textures.
+   *
+   * \return the amount of cached textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto string_cache_size() const noexcept -> std::size_t
+  {
+    return m_dynamicStrings.size();
+  }
+
+  /**
+   * \brief Returns the estimated memory usage of the content-keyed string textures.
+   *
+   * \return the estimated memory usage, in bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto string_cache_bytes() const noexcept -> std::size_t
+  {
+    return m_dynamicBytes;
+  }
+
+  /// \} End of content-keyed string caching
 
   /// \name Glyph texture caching
   /// \{
@@ -577,14 +841,8 @@ class font_cache final
   template <typename Renderer>
   void add_glyph(Renderer& renderer, const unicode glyph)
   {
-    if (has(glyph) || !m_font.is_glyph_provided(glyph))
-    {
-      return;
-    }
-
-    glyph_data data{create_glyph_texture(renderer, glyph),
-                    m_font.get_metrics(glyph).value()};
-    m_glyphs.try_emplace(glyph, std::move(data));
+    cache_glyph(renderer, glyph);
+    build_atlas(renderer);
   }
 
   /**
@@ -609,8 +867,10 @@ class font_cache final
   {
     for (auto ch = begin; ch < end; ++ch)
     {
-      add_glyph(renderer, ch);
+      cache_glyph(renderer, ch);
     }
+
+    build_atlas(renderer);
   }
 
   /**
@@ -679,7 +939,7 @@ class font_cache final
    */
   [[nodiscard]] auto has(const unicode glyph) const noexcept -> bool
   {
-    return m_glyphs.count(glyph);
+    return m_glyphs.contains(glyph) || m_atlasGlyphs.contains(glyph);
   }
 
   /**
@@ -687,6 +947,9 @@ class font_cache final
    *
    * \pre `glyph` **must** have been previously cached.
    *
+   * \note This function only considers glyphs that are stored in separate textures, use
+   * `try_at_atlas()` for glyphs stored in a glyph atlas.
+   *
    * \param glyph the desired glyph to lookup the data for.
    *
    * \return the cached texture and metrics associated with the glyph.
@@ -695,7 +958,14 @@ class font_cache final
    */
   [[nodiscard]] auto at(const unicode glyph) const -> const glyph_data&
   {
-    return m_glyphs.at(glyph);
+    if (const auto* data = m_glyphs.find(glyph))
+    {
+      return *data;
+    }
+    else
+    {
+      throw std::out_of_range{"Glyph is not cached!"};
+    }
   }
 
   /**
@@ -732,72 +1002,1180 @@ class font_cache final
    *
    * \since 5.2.0
    */
-  [[nodiscard]] auto try_at(const unicode glyph) const -> const glyph_data*
+  [[nodiscard]] auto try_at(const unicode glyph) const noexcept -> const glyph_data*
+  {
+    return m_glyphs.find(glyph);
+  }
+
+  /// \} End of glyph texture caching
+
+  /// \name Glyph atlas
+  /// \{
+
+  /**
+   * \brief Makes the cache store glyphs in shared atlas textures instead of in one
+   * texture per glyph.
+   *
+   * \details When the glyph atlas is enabled, glyphs added with `add_glyph()` and related
+   * functions are packed into a few shared page textures. The rendered glyphs are then
+   * described by `atlas_glyph` instances, that contain a page index and a source
+   * rectangle, which enables rendering strings with a single texture per page.
+   *
+   * \param pageSize the size of the atlas page textures.
+   *
+   * \throws cen_error if any glyphs have already been cached in separate textures.
+   *
+   * \since 6.1.0
+   */
+  void enable_glyph_atlas(const iarea pageSize = {1024, 1024})
   {
-    if (const auto it = m_glyphs.find(glyph); it != m_glyphs.end())
+    if (!m_glyphs.empty() || !m_styledGlyphs.empty())
     {
-      return &it->second;
+      throw cen_error{"Cannot enable glyph atlas after glyphs have been cached!"};
     }
-    else
+
+    if (!m_atlas)
     {
-      return nullptr;
+      m_atlas.emplace(pageSize);
     }
   }
 
-  /// \} End of glyph texture caching
+  /**
+   * \brief Indicates whether or not the cache stores glyphs in a glyph atlas.
+   *
+   * \return `true` if the glyph atlas is used; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_using_glyph_atlas() const noexcept -> bool
+  {
+    return m_atlas.has_value();
+  }
 
   /**
-   * \brief Returns the font used by the cache.
+   * \brief Returns the atlas data associated with the specified glyph, if it exists.
    *
-   * \return a reference to the internal font.
+   * \param glyph the desired glyph to lookup the data for.
    *
-   * \since 5.0.0
+   * \return a pointer to the associated glyph data; a null pointer if the glyph isn't
+   * stored in the glyph atlas.
+   *
+   * \since 6.1.0
    */
-  [[nodiscard]] auto get_font() noexcept -> font&
+  [[nodiscard]] auto try_at_atlas(const unicode glyph) const noexcept
+      -> const atlas_glyph*
   {
-    return m_font;
+    return m_atlasGlyphs.find(glyph);
   }
 
   /**
-   * \copydoc get_font
+   * \brief Returns a handle to a glyph atlas page texture.
+   *
+   * \pre The glyph atlas must be enabled.
+   *
+   * \param index the index of the page.
+   *
+   * \return a handle to the page texture.
+   *
+   * \throws std::out_of_range if the page index is invalid.
+   *
+   * \since 6.1.0
    */
-  [[nodiscard]] auto get_font() const noexcept -> const font&
+  [[nodiscard]] auto glyph_page(const std::size_t index) const -> texture_handle
   {
-    return m_font;
+    assert(m_atlas);
+    return m_atlas->page(index);
   }
 
- private:
-  font m_font;
-  std::unordered_map<unicode, glyph_data> m_glyphs;
-  std::unordered_map<id_type, texture> m_strings;
+  /**
+   * \brief Returns the amount of glyph atlas pages.
+   *
+   * \return the amount of pages; zero if the glyph atlas isn't used.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto glyph_page_count() const noexcept -> std::size_t
+  {
+    return m_atlas ? m_atlas->page_count() : 0u;
+  }
+
+  /// \} End of glyph atlas
+
+  /// \name Distance field glyphs
+  /// \{
 
   /**
-   * \brief Creates and returns a texture for the specified glyph.
+   * \brief Makes the cache store glyphs as signed distance fields.
    *
-   * \details The glyph is rendered with `TTF_RenderGlyph_Blended`.
+   * \details Distance field glyphs store the distance to the outline of each glyph
+   * instead of its coverage, which means that a single cache can be used to render text
+   * at arbitrary scales, see `basic_renderer::render_text_scaled()`. The distance is
+   * stored in the alpha channel, where a value of 128 corresponds to the outline.
    *
-   * \param renderer the renderer that will be used.
-   * \param glyph the Unicode glyph that will be rendered.
+   * \details The best results are obtained by rendering the glyph textures with an
+   * alpha-threshold shader, e.g. with an OpenGL context. Otherwise, the glyph textures
+   * are rendered as is with linear filtering, which results in slightly soft edges that
+   * keep their shape when scaled.
    *
-   * \return a texture that represents the specified glyph.
+   * \note The glyph textures are larger than the glyphs by the spread on each side, which
+   * the rendering functions of `basic_renderer` account for.
    *
-   * \since 5.0.0
+   * \param spread the maximum represented distance from the outline, in pixels.
+   *
+   * \throws cen_error if any glyphs have already been cached, if a warm-up is in
+   * progress, or if the spread isn't positive.
+   *
+   * \since 6.1.0
    */
-  template <typename Renderer>
-  [[nodiscard]] auto create_glyph_texture(Renderer& renderer, const unicode glyph)
-      -> texture
+  void enable_distance_field_glyphs(const int spread = 4)
   {
-    const auto color = renderer.get_color().get();
-    const surface src{TTF_RenderGlyph_Blended(m_font.get(), glyph, color)};
-    return texture{renderer, src};
+    if (!m_glyphs.empty() || !m_atlasGlyphs.empty() || !m_styles.empty() || m_warmUp)
+    {
+      throw cen_error{"Cannot enable distance field glyphs after caching glyphs!"};
+    }
+
+    if (spread <= 0)
+    {
+      throw cen_error{"Distance field spread must be positive!"};
+    }
+
+    m_spread = spread;
   }
 
-  void store(const id_type id, texture&& texture)
+  /**
+   * \brief Indicates whether or not the cache stores glyphs as signed distance fields.
+   *
+   * \return `true` if distance field glyphs are used; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_using_distance_field_glyphs() const noexcept -> bool
+  {
+    return m_spread != 0;
+  }
+
+  /**
+   * \brief Returns the spread of the distance field glyphs.
+   *
+   * \return the amount of padding on each side of the glyph textures; zero if distance
+   * field glyphs aren't used.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto distance_field_spread() const noexcept -> int
+  {
+    return m_spread;
+  }
+
+  /// \} End of distance field glyphs
+
+  /// \name Asynchronous glyph caching
+  /// \{
+
+  /**
+   * \brief Starts rasterizing glyphs in the specified range on a background thread.
+   *
+   * \details Rendering glyphs with SDL_ttf is by far the most expensive part of caching
+   * them. This function moves that work to a worker thread, so that only the texture
+   * uploads need to happen on the render thread, see `update_warm_up()`. The range is
+   * interpreted as [min, max), like with `add_range()`.
+   *
+   * \note SDL_ttf fonts are not thread-safe. The font of the cache must not be used by
+   * any other thread, e.g. by adding glyphs or storing strings, until `update_warm_up()`
+   * has returned `true`. Rendering previously cached glyphs is fine.
+   *
+   * \param begin the first glyph that will be included.
+   * \param end the "end" glyph in the range, will not be included.
+   * \param color the color of the rendered glyphs.
+   *
+   * \throws cen_error if a warm-up is already in progress.
+   * \throws sdl_error if the worker thread couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  void begin_warm_up(const unicode begin,
+                     const unicode end,
+                     const color& color = colors::white)
+  {
+    if (m_warmUp)
+    {
+      throw cen_error{"Font cache warm-up is already in progress!"};
+    }
+
+    std::vector<TTF_Font*> fonts{m_font.get()};
+    for (const auto& fallback : m_fallbacks)
+    {
+      fonts.push_back(fallback.get());
+    }
+
+    m_warmUp = std::make_unique<warm_up_task>(std::move(fonts),
+                                              begin,
+                                              end,
+                                              color.get(),
+                                              m_spread);
+    m_warmUp->worker.emplace(&warm_up_task::run, "font_cache", m_warmUp.get());
+  }
+
+  /**
+   * \brief Uploads glyphs that have been rasterized by the warm-up thread.
+   *
+   * \details This function is intended to be called once per frame. Glyphs are uploaded
+   * until the time budget has been spent, at least one glyph is uploaded per call if
+   * there is one available. When using a glyph atlas, the pages are updated at most once
+   * per call.
+   *
+   * \pre This function must be called on the thread that owns the renderer.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the glyph textures.
+   * \param budget the maximum amount of time to spend uploading glyphs.
+   *
+   * \return `true` if there is no warm-up in progress, i.e. all glyphs have been cached;
+   * `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto update_warm_up(Renderer& renderer, const milliseconds<u32> budget) -> bool
   {
-    if (const auto it = m_strings.find(id); it != m_strings.end())
+    CENTURION_PROFILE_SCOPE("font_cache::update_warm_up");
+
+    if (!m_warmUp)
+    {
+      return true;
+    }
+
+    auto& task = *m_warmUp;
+
+    // Checked before taking the glyphs, so that no glyphs can be left behind
+    const auto finished = task.finished.load();
+    {
+      scoped_lock lock{task.mutex};
+      task.pending.insert(task.pending.end(),
+                          std::make_move_iterator(task.ready.begin()),
+                          std::make_move_iterator(task.ready.end()));
+      task.ready.clear();
+    }
+
+    const auto start = counter::now();
+    const auto limit = counter::frequency() * budget.count() / 1'000u;
+
+    std::size_t uploaded = 0;
+    while (uploaded < task.pending.size() &&
+           (uploaded == 0 || counter::now() - start < limit))
     {
-      m_strings.erase(it);
+      insert_glyph(renderer, task.pending[uploaded]);
+      ++uploaded;
     }
+
+    const auto first = task.pending.begin();
+    task.pending.erase(first, first + static_cast<std::ptrdiff_t>(uploaded));
+
+    if (uploaded != 0)
+    {
+      build_atlas(renderer);
+    }
+
+    if (finished && task.pending.empty())
+    {
+      m_warmUp.reset();
+      return true;
+    }
+    else
+    {
+      return false;
+    }
+  }
+
+  /**
+   * \brief Indicates whether or not there is a warm-up in progress.
+   *
+   * \return `true` if `begin_warm_up()` has been called and `update_warm_up()` hasn't
+   * uploaded all glyphs yet; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_warming_up() const noexcept -> bool
+  {
+    return m_warmUp != nullptr;
+  }
+
+  /// \} End of asynchronous glyph caching
+
+  /// \name Fallback fonts
+  /// \{
+
+  /**
+   * \brief Adds a font that provides the glyphs that the previous fonts lack.
+   *
+   * \details When a glyph is cached, the main font is checked first, followed by the
+   * fallback fonts in the order that they were added. The first font that provides the
+   * glyph is used to render it, and its index is recorded along with the glyph. Glyphs
+   * that have already been cached aren't affected.
+   *
+   * \details Glyphs of fallback fonts are aligned to the baseline of the main font when
+   * they are rendered, so fallback fonts should have roughly the same size.
+   *
+   * \param fallback the fallback font.
+   *
+   * \throws cen_error if a warm-up is in progress.
+   *
+   * \since 6.1.0
+   */
+  void add_fallback(font&& fallback)
+  {
+    if (m_warmUp)
+    {
+      throw cen_error{"Cannot add fallback fonts during a font cache warm-up!"};
+    }
+
+    m_fallbacks.push_back(std::move(fallback));
+  }
+
+  /**
+   * \brief Creates a fallback font in-place.
+   *
+   * \tparam Args the types of the arguments forwarded to the font constructor.
+   *
+   * \param args the arguments that will be forwarded to the font constructor.
+   *
+   * \throws cen_error if a warm-up is in progress.
+   *
+   * \see `add_fallback()`
+   *
+   * \since 6.1.0
+   */
+  template <typename... Args>
+  void emplace_fallback(Args&&... args)
+  {
+    add_fallback(font{std::forward<Args>(args)...});
+  }
+
+  /**
+   * \brief Returns the amount of fallback fonts.
+   *
+   * \return the amount of fallback fonts.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto fallback_count() const noexcept -> std::size_t
+  {
+    return m_fallbacks.size();
+  }
+
+  /**
+   * \brief Returns the index of the font that provided a cached glyph.
+   *
+   * \param glyph the cached glyph.
+   *
+   * \return zero if the glyph was provided by the main font, or if it hasn't been cached;
+   * the index of the fallback font plus one otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto font_index(const unicode glyph) const noexcept -> std::size_t
+  {
+    if (const auto* atlas = m_atlasGlyphs.find(glyph))
+    {
+      return atlas->fontIndex;
+    }
+    else if (m_glyphFonts.empty())
+    {
+      return 0;
+    }
+    else
+    {
+      const auto* index = m_glyphFonts.find(glyph);
+      return index ? *index : 0u;
+    }
+  }
+
+  /// \} End of fallback fonts
+
+  /// \name Styled glyph variants
+  /// \{
+
+  /**
+   * \brief Adds a styled variant of a glyph to the font cache.
+   *
+   * \details The style is temporarily applied to the font, and the fallback fonts, while
+   * the glyph is rendered. Changing the style of a font discards the internal glyph cache
+   * of SDL_ttf, so prefer `add_range()` when caching many glyphs of a style.
+   *
+   * \details This function has no effect if none of the fonts provide the glyph, or if
+   * the variant has already been cached.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the glyph texture.
+   * \param glyph the glyph that will be cached.
+   * \param style the style of the cached variant.
+   *
+   * \throws cen_error if a warm-up is in progress.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  void add_glyph(Renderer& renderer, const unicode glyph, const glyph_style& style)
+  {
+    cache_styled_range(renderer, glyph, u32{glyph} + 1u, style);
+  }
+
+  /**
+   * \brief Caches styled variants of the glyphs in the specified range.
+   *
+   * \details The style is applied to the fonts once for the entire range, and only if
+   * any glyphs of the range haven't been cached yet. The range is interpreted as
+   * [min, max).
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the glyph textures.
+   * \param begin the first glyph that will be included.
+   * \param end the "end" glyph in the range, will not be included.
+   * \param style the style of the cached variants.
+   *
+   * \throws cen_error if a warm-up is in progress.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  void add_range(Renderer& renderer,
+                 const unicode begin,
+                 const unicode end,
+                 const glyph_style& style)
+  {
+    cache_styled_range(renderer, begin, end, style);
+  }
+
+  /**
+   * \brief Caches styled variants of all printable basic latin characters.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the glyph textures.
+   * \param style the style of the cached variants.
+   *
+   * \throws cen_error if a warm-up is in progress.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  void add_basic_latin(Renderer& renderer, const glyph_style& style)
+  {
+    add_range(renderer, 0x20, 0x7F, style);
+  }
+
+  /**
+   * \brief Indicates whether or not a styled variant of a glyph has been cached.
+   *
+   * \param glyph the glyph that will be checked.
+   * \param style the style of the variant.
+   *
+   * \return `true` if the variant has been cached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has(const unicode glyph, const glyph_style& style) const noexcept
+      -> bool
+  {
+    const auto index = find_style(style);
+    return index && has_styled(styled_key(*index, glyph));
+  }
+
+  /**
+   * \brief Returns the data associated with a styled variant of a glyph, if it exists.
+   *
+   * \note This function only considers glyphs that are stored in separate textures.
+   *
+   * \param glyph the desired glyph to lookup the data for.
+   * \param style the style of the variant.
+   *
+   * \return a pointer to the associated glyph data; a null pointer if the variant isn't
+   * stored in a separate texture.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto try_at(const unicode glyph, const glyph_style& style) const noexcept
+      -> const glyph_data*
+  {
+    if (const auto index = find_style(style))
+    {
+      if (const auto* styled = m_styledGlyphs.find(styled_key(*index, glyph)))
+      {
+        return &styled->data;
+      }
+    }
+
+    return nullptr;
+  }
+
+  /**
+   * \brief Returns the atlas data associated with a styled variant of a glyph, if it
+   * exists.
+   *
+   * \param glyph the desired glyph to lookup the data for.
+   * \param style the style of the variant.
+   *
+   * \return a pointer to the associated glyph data; a null pointer if the variant isn't
+   * stored in the glyph atlas.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto try_at_atlas(const unicode glyph,
+                                  const glyph_style& style) const noexcept
+      -> const atlas_glyph*
+  {
+    const auto index = find_style(style);
+    return index ? m_styledAtlasGlyphs.find(styled_key(*index, glyph)) : nullptr;
+  }
+
+  /**
+   * \brief Returns the index of the font that provided a styled variant of a glyph.
+   *
+   * \param glyph the cached glyph.
+   * \param style the style of the variant.
+   *
+   * \return the index of the font, see `font_index(unicode)`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto font_index(const unicode glyph,
+                                const glyph_style& style) const noexcept -> std::size_t
+  {
+    if (const auto* atlas = try_at_atlas(glyph, style))
+    {
+      return atlas->fontIndex;
+    }
+    else if (const auto index = find_style(style))
+    {
+      const auto* styled = m_styledGlyphs.find(styled_key(*index, glyph));
+      return styled ? styled->fontIndex : 0u;
+    }
+    else
+    {
+      return 0;
+    }
+  }
+
+  /**
+   * \brief Returns the amount of styles that glyph variants have been cached for.
+   *
+   * \return the amount of distinct glyph styles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto style_count() const noexcept -> std::size_t
+  {
+    return m_styles.size();
+  }
+
+  /// \} End of styled glyph variants
+
+  /**
+   * \brief Returns the kerning amount between two glyphs.
+   *
+   * \details The kerning amounts are cached, so that subsequent lookups of the same pair
+   * of glyphs do not need to call into SDL_ttf.
+   *
+   * \note This function modifies the internal kerning cache, so it must not be called
+   * from several threads at the same time.
+   *
+   * \param first the first glyph.
+   * \param second the second glyph.
+   *
+   * \return the kerning amount between the glyphs, in pixels.
+   *
+   * \see `font::kerning_amount()`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto kerning(const unicode first, const unicode second) const -> int
+  {
+    const auto key = (static_cast<u32>(first) << 16u) | static_cast<u32>(second);
+    if (const auto it = m_kerning.find(key); it != m_kerning.end())
+    {
+      return it->second;
+    }
+
+    // Glyphs of different fonts aren't kerned
+    const auto index = font_index(first);
+    const auto amount =
+        (index == font_index(second)) ? get_font(index).kerning_amount(first, second) : 0;
+    m_kerning.try_emplace(key, amount);
+
+    return amount;
+  }
+
+  /**
+   * \brief Returns the font used by the cache.
+   *
+   * \return a reference to the internal font.
+   *
+   * \since 5.0.0
+   */
+  [[nodiscard]] auto get_font() noexcept -> font&
+  {
+    return m_font;
+  }
+
+  /**
+   * \copydoc get_font
+   */
+  [[nodiscard]] auto get_font() const noexcept -> const font&
+  {
+    return m_font;
+  }
+
+  /**
+   * \brief Returns the main font or one of the fallback fonts.
+   *
+   * \param index zero for the main font; the index of a fallback font plus one otherwise.
+   *
+   * \return a reference to the font, see `font_index()`.
+   *
+   * \throws std::out_of_range if the index is invalid.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_font(const std::size_t index) const -> const font&
+  {
+    return (index == 0) ? m_font : m_fallbacks.at(index - 1u);
+  }
+
+ private:
+  font m_font;
+  std::vector<font> m_fallbacks;
+  detail::glyph_table<glyph_data> m_glyphs;
+  detail::glyph_table<std::size_t> m_glyphFonts;  // Fallback glyphs of m_glyphs
+  detail::glyph_table<atlas_glyph> m_atlasGlyphs;
+
+  struct styled_glyph final
+  {
+    glyph_data data;
+    std::size_t fontIndex{};
+  };
+
+  // Styled glyphs are keyed by the index of their style in the upper 16 bits
+  std::vector<glyph_style> m_styles;
+  detail::glyph_table<styled_glyph, u32> m_styledGlyphs;
+  detail::glyph_table<atlas_glyph, u32> m_styledAtlasGlyphs;
+  detail::flat_id_map<id_type, texture> m_strings;
+  std::optional<texture_atlas> m_atlas;
+  int m_spread{};
+  mutable std::unordered_map<u32, int> m_kerning;
+
+  struct string_entry final
+  {
+    texture cached;
+    std::list<const std::string*>::iterator lru;
+    std::size_t bytes{};
+  };
+
+  std::unordered_map<std::string, string_entry> m_dynamicStrings;
+  std::list<const std::string*> m_lru;  // Most recently used first
+  std::string m_key;                    // Reused to avoid allocating keys for lookups
+  std::size_t m_dynamicBytes{};
+  std::size_t m_maxEntries{};
+  std::size_t m_maxBytes{};
+
+  struct pending_glyph final
+  {
+    unicode glyph{};
+    surface image;
+    glyph_metrics metrics;
+    std::size_t fontIndex{};
+    std::optional<u32> styledKey;
+  };
+
+  /// Shared with the worker thread, which only ever touches the font and `ready`.
+  struct warm_up_task final
+  {
+    warm_up_task(std::vector<TTF_Font*> fonts,
+                 const unicode begin,
+                 const unicode end,
+                 const SDL_Color color,
+                 const int spread)
+        : fonts{std::move(fonts)}
+        , begin{begin}
+        , end{end}
+        , color{color}
+        , spread{spread}
+    {}
+
+    ~warm_up_task() noexcept
+    {
+      cancelled = true;
+      worker.reset();  // Joins the worker thread
+    }
+
+    static auto run(void* data) -> int
+    {
+      auto& task = *static_cast<warm_up_task*>(data);
+
+      for (auto glyph = task.begin; glyph < task.end && !task.cancelled; ++glyph)
+      {
+        auto index = task.fonts.size();
+        for (std::size_t candidate = 0; candidate < task.fonts.size(); ++candidate)
+        {
+          if (TTF_GlyphIsProvided(task.fonts[candidate], glyph))
+          {
+            index = candidate;
+            break;
+          }
+        }
+
+        glyph_metrics metrics{};
+        if (index == task.fonts.size() ||
+            TTF_GlyphMetrics(task.fonts[index],
+                             glyph,
+                             &metrics.minX,
+                             &metrics.maxX,
+                             &metrics.minY,
+                             &metrics.maxY,
+                             &metrics.advance) == -1)
+        {
+          continue;
+        }
+
+        try
+        {
+          auto* font = task.fonts[index];
+          auto image = render_glyph_surface(font, glyph, task.color, task.spread);
+
+          scoped_lock lock{task.mutex};
+          task.ready.push_back({glyph, std::move(image), metrics, index, std::nullopt});
+        }
+        catch (...)
+        {
+          // Exceptions must not escape the thread, the glyph is simply skipped
+        }
+      }
+
+      task.finished = true;
+      return 0;
+    }
+
+    std::vector<TTF_Font*> fonts;  // Not the wrappers, since the cache might be moved
+    unicode begin{};
+    unicode end{};
+    SDL_Color color{};
+    int spread{};
+    cen::mutex mutex;
+    std::vector<pending_glyph> ready;    // Guarded by the mutex
+    std::vector<pending_glyph> pending;  // Only used by the render thread
+    std::atomic<bool> cancelled{false};
+    std::atomic<bool> finished{false};
+    std::optional<cen::thread> worker;
+  };
+
+  std::unique_ptr<warm_up_task> m_warmUp;
+
+  template <typename Factory>
+  auto find_or_render(const char mode,
+                      const std::string& string,
+                      const color& fg,
+                      const color& bg,
+                      const u32 wrap,
+                      Factory&& factory) -> const texture&
+  {
+    const u32 header[] = {static_cast<u32>(mode),
+                          static_cast<u32>(TTF_GetFontStyle(m_font.get())),
+                          (u32{fg.red()} << 24u) | (u32{fg.green()} << 16u) |
+                              (u32{fg.blue()} << 8u) | u32{fg.alpha()},
+                          (u32{bg.red()} << 24u) | (u32{bg.green()} << 16u) |
+                              (u32{bg.blue()} << 8u) | u32{bg.alpha()},
+                          wrap};
+
+    m_key.assign(reinterpret_cast<const char*>(header), sizeof header);
+    m_key.append(string);
+
+    if (const auto it = m_dynamicStrings.find(m_key); it != m_dynamicStrings.end())
+    {
+      auto& entry = it->second;
+      m_lru.splice(m_lru.begin(), m_lru, entry.lru);
+      return entry.cached;
+    }
+
+    CENTURION_PROFILE_SCOPE("font_cache::render_string");
+    auto cached = factory();
+
+    const auto size = cached.size();
+    const auto bytes = static_cast<std::size_t>(size.width) *
+                       static_cast<std::size_t>(size.height) * 4u;
+    evict(1, bytes);
+
+    auto [it, inserted] =
+        m_dynamicStrings.try_emplace(m_key, string_entry{std::move(cached), {}, bytes});
+    assert(inserted);
+
+    m_lru.push_front(&it->first);
+    it->second.lru = m_lru.begin();
+    m_dynamicBytes += bytes;
+
+    return it->second.cached;
+  }
+
+  /// Evicts textures until there is room for the specified amount of new textures.
+  void evict(const std::size_t entries, const std::size_t bytes)
+  {
+    while (!m_lru.empty() &&
+           ((m_maxEntries != 0 && m_dynamicStrings.size() + entries > m_maxEntries) ||
+            (m_maxBytes != 0 && m_dynamicBytes + bytes > m_maxBytes)))
+    {
+      evict_least_recently_used();
+    }
+  }
+
+  void evict_least_recently_used() noexcept
+  {
+    const auto it = m_dynamicStrings.find(*m_lru.back());
+    m_dynamicBytes -= it->second.bytes;
+    m_lru.pop_back();
+    m_dynamicStrings.erase(it);
+  }
+
+  template <typename Renderer>
+  void cache_glyph(Renderer& renderer, const unicode glyph)
+  {
+    if (!has(glyph))
+    {
+      rasterize_glyph(renderer, glyph, std::nullopt);
+    }
+  }
+
+  template <typename Renderer>
+  void rasterize_glyph(Renderer& renderer,
+                       const unicode glyph,
+                       const std::optional<u32> styledKey)
+  {
+    const auto index = resolve_font(glyph);
+    if (!index)
+    {
+      return;
+    }
+
+    const auto& source = get_font(*index);
+    const auto color = renderer.get_color().get();
+    pending_glyph data{glyph,
+                       render_glyph_surface(source.get(), glyph, color, m_spread),
+                       source.get_metrics(glyph).value(),
+                       *index,
+                       styledKey};
+    insert_glyph(renderer, data);
+  }
+
+  // The range is [begin, end), with 32-bit bounds so that the last glyph can be included
+  template <typename Renderer>
+  void cache_styled_range(Renderer& renderer,
+                          const u32 begin,
+                          const u32 end,
+                          const glyph_style& style)
+  {
+    if (m_warmUp)
+    {
+      throw cen_error{"Cannot cache styled glyphs during a font cache warm-up!"};
+    }
+
+    const auto index = register_style(style);
+
+    std::optional<style_override> override;
+    for (auto value = begin; value < end; ++value)
+    {
+      const auto glyph = static_cast<unicode>(value);
+      const auto key = styled_key(index, glyph);
+      if (has_styled(key))
+      {
+        continue;
+      }
+
+      if (!override)
+      {
+        override.emplace(*this, style);
+      }
+
+      rasterize_glyph(renderer, glyph, key);
+    }
+
+    build_atlas(renderer);
+  }
+
+  // Temporarily applies a glyph style to all fonts of the cache
+  class style_override final
+  {
+   public:
+    style_override(font_cache& cache, const glyph_style& style)
+    {
+      m_previous.reserve(cache.m_fallbacks.size() + 1u);
+
+      apply(cache.m_font.get(), style);
+      for (auto& fallback : cache.m_fallbacks)
+      {
+        apply(fallback.get(), style);
+      }
+    }
+
+    style_override(const style_override&) = delete;
+    auto operator=(const style_override&) -> style_override& = delete;
+
+    ~style_override() noexcept
+    {
+      for (const auto& [font, mask, outline] : m_previous)
+      {
+        set(font, {mask, outline});
+      }
+    }
+
+   private:
+    struct saved_style final
+    {
+      TTF_Font* font{};
+      int mask{};
+      int outline{};
+    };
+
+    std::vector<saved_style> m_previous;
+
+    void apply(TTF_Font* font, const glyph_style& style)
+    {
+      m_previous.push_back({font, TTF_GetFontStyle(font), TTF_GetFontOutline(font)});
+      set(font, style);
+    }
+
+    // Styles are only set if they differ, since that flushes the glyph cache of SDL_ttf
+    static void set(TTF_Font* font, const glyph_style& style) noexcept
+    {
+      if (TTF_GetFontStyle(font) != style.mask)
+      {
+        TTF_SetFontStyle(font, style.mask);
+      }
+
+      if (TTF_GetFontOutline(font) != style.outline)
+      {
+        TTF_SetFontOutline(font, style.outline);
+      }
+    }
+  };
+
+  [[nodiscard]] auto find_style(const glyph_style& style) const noexcept
+      -> std::optional<std::size_t>
+  {
+    for (std::size_t index = 0; index < m_styles.size(); ++index)
+    {
+      const auto& other = m_styles[index];
+      if (other.mask == style.mask && other.outline == style.outline)
+      {
+        return index;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  auto register_style(const glyph_style& style) -> std::size_t
+  {
+    if (const auto index = find_style(style))
+    {
+      return *index;
+    }
+
+    assert(m_styles.size() <= 0xFFFF && "Too many glyph styles!");
+    m_styles.push_back(style);
+
+    return m_styles.size() - 1u;
+  }
+
+  [[nodiscard]] constexpr static auto styled_key(const std::size_t index,
+                                                 const unicode glyph) noexcept -> u32
+  {
+    return (static_cast<u32>(index) << 16u) | u32{glyph};
+  }
+
+  [[nodiscard]] auto has_styled(const u32 key) const noexcept -> bool
+  {
+    return m_styledGlyphs.contains(key) || m_styledAtlasGlyphs.contains(key);
+  }
+
+  /// Returns the index of the first font that provides the glyph, see `get_font()`.
+  [[nodiscard]] auto resolve_font(const unicode glyph) const noexcept
+      -> std::optional<std::size_t>
+  {
+    if (m_font.is_glyph_provided(glyph))
+    {
+      return 0;
+    }
+
+    for (std::size_t index = 0; index < m_fallbacks.size(); ++index)
+    {
+      if (m_fallbacks[index].is_glyph_provided(glyph))
+      {
+        return index + 1u;
+      }
+    }
+
+    return std::nullopt;
+  }
+
+  template <typename Renderer>
+  void insert_glyph(Renderer& renderer, pending_glyph& pending)
+  {
+    const auto& key = pending.styledKey;
+    if (key ? has_styled(*key) : has(pending.glyph))
+    {
+      return;
+    }
+
+    if (m_atlas)
+    {
+      const auto id = m_atlas->add(pending.image);
+      const auto& [page, source] = m_atlas->location(id);
+      atlas_glyph data{page, source, pending.metrics, pending.fontIndex};
+
+      if (key)
+      {
+        m_styledAtlasGlyphs.try_emplace(*key, std::move(data));
+      }
+      else
+      {
+        m_atlasGlyphs.try_emplace(pending.glyph, std::move(data));
+      }
+    }
+    else if (key)
+    {
+      styled_glyph data{{create_glyph_texture(renderer, pending.image), pending.metrics},
+                        pending.fontIndex};
+      m_styledGlyphs.try_emplace(*key, std::move(data));
+    }
+    else
+    {
+      glyph_data data{create_glyph_texture(renderer, pending.image), pending.metrics};
+      m_glyphs.try_emplace(pending.glyph, std::move(data));
+
+      if (pending.fontIndex != 0)
+      {
+        auto index = pending.fontIndex;
+        m_glyphFonts.try_emplace(pending.glyph, std::move(index));
+      }
+    }
+  }
+
+  template <typename Renderer>
+  void build_atlas(Renderer& renderer)
+  {
+    CENTURION_PROFILE_SCOPE("font_cache::build_atlas");
+
+    if (m_atlas)
+    {
+      const texture_category_scope scope{texture_category::glyphs};
+      m_atlas->build(renderer);
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+      if (m_spread != 0)
+      {
+        for (std::size_t index = 0; index < m_atlas->page_count(); ++index)
+        {
+          m_atlas->page(index).set_scale_mode(scale_mode::linear);
+        }
+      }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+    }
+  }
+
+  /**
+   * \brief Renders a glyph to a surface.
+   *
+   * \details The glyph is rendered with `TTF_RenderGlyph_Blended`. If the spread is
+   * positive, the rendered glyph is then converted to a signed distance field, stored in
+   * the alpha channel of a surface that is larger than the glyph by the spread on each
+   * side.
+   *
+   * \note This function only uses the supplied font, so it may be called by a worker
+   * thread as long as no other thread uses the font at the same time.
+   *
+   * \param font the font that will be used.
+   * \param glyph the Unicode glyph that will be rendered.
+   * \param color the color of the glyph.
+   * \param spread the distance field spread, in pixels; zero for a plain glyph.
+   *
+   * \return a surface that represents the specified glyph.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto render_glyph_surface(TTF_Font* font,
+                                                 const unicode glyph,
+                                                 const SDL_Color& color,
+                                                 const int spread) -> surface
+  {
+    surface image{TTF_RenderGlyph_Blended(font, glyph, color)};
+    if (spread == 0)
+    {
+      return image;
+    }
+
+    // RGBA32 always stores the alpha component in the fourth byte of each pixel
+    const auto converted = image.convert(pixel_format::rgba32);
+    const auto* pixels = static_cast<const u8*>(converted.pixels());
+    const auto size = converted.size();
+
+    const auto field = detail::make_distance_field(pixels + 3,
+                                                   size.width,
+                                                   size.height,
+                                                   converted.pitch(),
+                                                   4,
+                                                   spread);
+
+    const iarea fieldSize{size.width + 2 * spread, size.height + 2 * spread};
+    surface result{fieldSize, pixel_format::rgba32};
+
+    auto* output = static_cast<u8*>(result.pixels());
+    for (int y = 0; y < fieldSize.height; ++y)
+    {
+      auto* row = output + y * result.pitch();
+      for (int x = 0; x < fieldSize.width; ++x)
+      {
+        row[x * 4 + 0] = color.r;
+        row[x * 4 + 1] = color.g;
+        row[x * 4 + 2] = color.b;
+        row[x * 4 + 3] = field[static_cast<std::size_t>(y * fieldSize.width + x)];
+      }
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Creates and returns a texture for the specified glyph surface.
+   *
+   * \details Distance field glyph textures use linear filtering, if it is available.
+   *
+   * \param renderer the renderer that will be used.
+   * \param image the rendered glyph, see `render_glyph_surface()`.
+   *
+   * \return a texture that represents the specified glyph.
+   *
+   * \since 5.0.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto create_glyph_texture(Renderer& renderer, const surface& image)
+      -> texture
+  {
+    const texture_category_scope scope{texture_category::glyphs};
+    texture result{renderer, image};
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+    if (m_spread != 0)
+    {
+      result.set_scale_mode(scale_mode::linear);
+    }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+    return result;
+  }
+
+  void store(const id_type id, texture&& texture)
+  {
+    m_strings.erase(id);
     m_strings.try_emplace(id, std::move(texture));
   }
 };
@@ -806,4 +2184,5 @@ class font_cache final
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_SDL_TTF
 #endif  // CENTURION_FONT_CACHE_HEADER
\ No newline at end of file
@@ -0,0 +1,140 @@
+#ifndef CENTURION_FONT_SOURCE_HEADER
+#define CENTURION_FONT_SOURCE_HEADER
+
+#ifndef CENTURION_NO_SDL_TTF
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t, byte
+#include <cstring>  // memcpy
+#include <memory>   // shared_ptr, make_shared
+#include <string>   // string
+#include <vector>   // vector
+
+#include "../core/czstring.hpp"
+#include "../core/not_null.hpp"
+#include "../filesystem/mapped_file.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class font_source
+ *
+ * \brief The shared bytes of a TrueType font file, which fonts of any size can be opened
+ * from.
+ *
+ * \details Opening a font by path reads and parses the file for every font size, and
+ * each font keeps its own copy of the file. Fonts that are created from a font source
+ * instead read their glyphs from the same bytes, which are either memory-mapped or
+ * copied into memory once. Copies of a source share the bytes, which are released when
+ * the last source and the last font that uses them are destroyed.
+ * \code{cpp}
+ *   const cen::font_source source{"fonts/daniel.ttf"};
+ *
+ *   renderer.emplace_font(small, source, 12);
+ *   renderer.emplace_font(large, source, 24);
+ * \endcode
+ *
+ * \see `font`
+ *
+ * \since 6.1.0
+ */
+class font_source final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Maps a TrueType font file into memory.
+   *
+   * \param path the path of the font file, mustn't be null.
+   *
+   * \throws cen_error if the file couldn't be mapped.
+   *
+   * \since 6.1.0
+   */
+  explicit font_source(const not_null<czstring> path)
+  {
+    assert(path);
+
+    const auto mapped = std::make_shared<const mapped_file>(path);
+    m_data = std::shared_ptr<const std::byte>{mapped, mapped->data()};
+    m_size = mapped->size();
+  }
+
+  /// \copydoc font_source(not_null<czstring>)
+  explicit font_source(const std::string& path) : font_source{path.c_str()}
+  {}
+
+  /**
+   * \brief Copies TrueType font data, e.g. an entry of an asset pack, into memory.
+   *
+   * \param data a pointer to the TrueType data, mustn't be null.
+   * \param size the amount of bytes of TrueType data.
+   *
+   * \since 6.1.0
+   */
+  font_source(const not_null<const void*> data, const size_type size)
+  {
+    assert(data);
+
+    const auto bytes = std::make_shared<std::vector<std::byte>>(size);
+    if (size > 0)
+    {
+      std::memcpy(bytes->data(), data, size);
+    }
+
+    m_data = std::shared_ptr<const std::byte>{bytes, bytes->data()};
+    m_size = size;
+  }
+
+  /**
+   * \brief Returns a pointer to the shared bytes.
+   *
+   * \return a pointer to the TrueType data.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const std::byte*
+  {
+    return m_data.get();
+  }
+
+  /**
+   * \brief Returns the amount of shared bytes.
+   *
+   * \return the size of the TrueType data.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the amount of sources and fonts that share the bytes.
+   *
+   * \return the amount of owners of the bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto use_count() const noexcept -> long
+  {
+    return m_data.use_count();
+  }
+
+ private:
+  std::shared_ptr<const std::byte> m_data;
+  size_type m_size{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_TTF
+
+#endif  // CENTURION_FONT_SOURCE_HEADER
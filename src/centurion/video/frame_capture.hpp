@@ -0,0 +1,235 @@
+#ifndef CENTURION_FRAME_CAPTURE_HEADER
+#define CENTURION_FRAME_CAPTURE_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class frame_capture
+ *
+ * \brief Captures rendered frames with a delayed readback, for recording gameplay.
+ *
+ * \details `basic_renderer::capture()` reads the pixels of the frame that is being
+ * rendered, which makes the CPU wait until the GPU has executed all pending commands.
+ * This class instead renders every frame into the next target texture of a ring, which
+ * is then drawn to the actual render target, and reads back the texture of the frame
+ * that was rendered a few frames earlier, which the GPU has most likely finished by then.
+ * \code{cpp}
+ *   cen::frame_capture capture{renderer, renderer.output_size()};
+ *
+ *   // Every frame
+ *   capture.begin_frame(renderer);
+ *   draw_scene(renderer);
+ *
+ *   auto frame = recorder.acquire(capture.size(), capture.format());
+ *   if (capture.end_frame(renderer, frame)) {
+ *     recorder.submit(std::move(frame));
+ *   }
+ *
+ *   renderer.present();
+ * \endcode
+ *
+ * \note For OpenGL applications that don't use a renderer, see `gl::readback_ring`,
+ * which reads the frames into pixel buffer objects instead.
+ *
+ * \see `frame_recorder`
+ *
+ * \since 6.1.0
+ */
+class frame_capture final
+{
+ public:
+  /**
+   * \brief Creates the target textures of the capture ring.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the textures.
+   * \param size the size of the captured frames.
+   * \param format the pixel format of the captured frames.
+   * \param delay the amount of frames between rendering a frame and reading it back, at
+   * least one.
+   *
+   * \throws sdl_error if the textures couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  frame_capture(const Renderer& renderer,
+                const iarea size,
+                const pixel_format format = pixel_format::rgba32,
+                const std::size_t delay = 2)
+      : m_format{format}
+      , m_size{size}
+  {
+    const auto count = ((delay > 0) ? delay : 1u) + 1u;
+
+    m_textures.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      m_textures.emplace_back(renderer, format, texture_access::target, size);
+    }
+  }
+
+  frame_capture(const frame_capture&) = delete;
+
+  auto operator=(const frame_capture&) -> frame_capture& = delete;
+
+  /**
+   * \brief Redirects rendering to the texture of the next frame.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that the frame is rendered with.
+   *
+   * \return `success` if the texture is the render target; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto begin_frame(Renderer& renderer) noexcept -> result
+  {
+    assert(!m_rendering && "Frame has already been started!");
+
+    m_rendering = static_cast<bool>(renderer.set_target(m_textures[m_next]));
+    return m_rendering;
+  }
+
+  /**
+   * \brief Ends the frame, and reads back the oldest frame of the ring.
+   *
+   * \details The render target is reset, and the texture of the frame is stretched over
+   * the entire output of the renderer. The frame that was rendered `delay()` frames ago
+   * is then read into the surface, which is recreated if its size or pixel format differs
+   * from the frames.
+   *
+   * \pre `begin_frame()` must have succeeded.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that the frame was rendered with.
+   * \param frame the surface that the oldest frame is read into.
+   *
+   * \return `true` if a frame was read into the surface; `false` if fewer than
+   * `delay() + 1` frames have been rendered, or if the readback failed.
+   *
+   * \throws sdl_error if the surface couldn't be recreated.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  auto end_frame(Renderer& renderer, surface& frame) -> bool
+  {
+    assert(m_rendering && "Frame hasn't been started!");
+    m_rendering = false;
+
+    auto& current = m_textures[m_next];
+    renderer.reset_target();
+    renderer.render(current, irect{{}, renderer.output_size()});
+
+    ++m_frames;
+    m_next = (m_next + 1u) % m_textures.size();
+
+    // The texture after the current one holds the oldest frame, once the ring is full
+    if (m_frames < m_textures.size())
+    {
+      return false;
+    }
+
+    return read(renderer, m_textures[m_next], frame);
+  }
+
+  /**
+   * \brief Returns the amount of frames between rendering a frame and reading it back.
+   *
+   * \return the readback delay, in frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto delay() const noexcept -> std::size_t
+  {
+    return m_textures.size() - 1u;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been ended.
+   *
+   * \return the amount of rendered frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> u64
+  {
+    return m_frames;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    return m_format;
+  }
+
+ private:
+  std::vector<texture> m_textures;
+  pixel_format m_format;
+  iarea m_size;
+  std::size_t m_next{};
+  u64 m_frames{};
+  bool m_rendering{};
+
+  template <typename Renderer>
+  auto read(Renderer& renderer, texture& source, surface& frame) -> bool
+  {
+    if (frame.size() != m_size || frame.format_info().format() != m_format)
+    {
+      frame = surface{m_size, m_format};
+    }
+
+    if (!renderer.set_target(source))
+    {
+      return false;
+    }
+
+    auto copied = false;
+    if (frame.lock())
+    {
+      copied = SDL_RenderReadPixels(renderer.get(),
+                                    nullptr,
+                                    static_cast<u32>(m_format),
+                                    frame.pixels(),
+                                    frame.pitch()) == 0;
+      frame.unlock();
+    }
+
+    renderer.reset_target();
+    return copied;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_CAPTURE_HEADER
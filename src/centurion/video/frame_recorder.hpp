@@ -0,0 +1,446 @@
+#ifndef CENTURION_FRAME_RECORDER_HEADER
+#define CENTURION_FRAME_RECORDER_HEADER
+
+#include <SDL.h>
+
+#include <atomic>    // atomic
+#include <cassert>   // assert
+#include <cstddef>   // size_t
+#include <cstdio>    // snprintf
+#include <deque>     // deque
+#include <optional>  // optional
+#include <string>    // string
+#include <utility>   // move
+#include <vector>    // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../filesystem/file.hpp"
+#include "../math/area.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread_pool.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum recording_format
+ *
+ * \brief Provides the formats that recorded frames can be encoded as.
+ *
+ * \see `frame_recorder`
+ *
+ * \since 6.1.0
+ */
+enum class recording_format
+{
+  bmp,  ///< A sequence of BMP images, which are cheap to encode.
+
+#ifndef CENTURION_NO_SDL_IMAGE
+  png,  ///< A sequence of PNG images, which are smaller but slower to encode.
+#endif  // CENTURION_NO_SDL_IMAGE
+
+  raw  ///< A single file with the tightly packed pixels of all frames, one after another.
+};
+
+/**
+ * \class frame_recorder
+ *
+ * \brief Encodes captured frames on the workers of a thread pool.
+ *
+ * \details Frames are surfaces that are acquired from the recorder, which keeps a pool of
+ * surfaces that are reused once their frames have been encoded, so that recording doesn't
+ * allocate a surface for every frame. Submitted frames are encoded in the background, and
+ * frames are dropped instead of stalling the render thread when the workers fall behind.
+ * \code{cpp}
+ *   cen::thread_pool pool;
+ *   cen::frame_recorder recorder{pool, "capture/frame_", cen::recording_format::bmp};
+ *
+ *   // Every frame
+ *   auto frame = recorder.acquire(capture.size(), capture.format());
+ *   if (capture.end_frame(renderer, frame)) {
+ *     recorder.submit(std::move(frame));
+ *   }
+ * \endcode
+ *
+ * \details Image sequences are written to files named after the prefix and the index of
+ * the frame, e.g. "capture/frame_000042.bmp". Raw recordings are written to the file at
+ * the prefix, where every frame occupies `width * height * bytes per pixel` bytes, so all
+ * frames of a raw recording must have the same size and pixel format.
+ *
+ * \note Frames must be acquired and submitted by a single thread, which typically is the
+ * render thread.
+ *
+ * \see `frame_capture`
+ *
+ * \since 6.1.0
+ */
+class frame_recorder final
+{
+ public:
+  using size_type = std::size_t;
+
+  /**
+   * \brief Creates a frame recorder.
+   *
+   * \param pool the thread pool that encodes the frames, which must outlive the recorder.
+   * \param prefix the prefix of the image paths, or the path of the raw recording.
+   * \param format the format that the frames are encoded as.
+   * \param maxPending the maximum amount of frames that are waiting to be encoded, at
+   * least one, before frames are dropped.
+   *
+   * \throws cen_error if the file of a raw recording can't be created.
+   *
+   * \since 6.1.0
+   */
+  frame_recorder(thread_pool& pool,
+                 std::string prefix,
+                 const recording_format format,
+                 const size_type maxPending = 4)
+      : m_pool{&pool}
+      , m_prefix{std::move(prefix)}
+      , m_format{format}
+      , m_maxPending{(maxPending > 0) ? maxPending : 1u}
+  {
+    if (m_format == recording_format::raw)
+    {
+      m_stream.emplace(m_prefix, file_mode::write_binary);
+      if (!*m_stream)
+      {
+        throw cen_error{"Failed to create raw recording file!"};
+      }
+    }
+  }
+
+  frame_recorder(const frame_recorder&) = delete;
+
+  auto operator=(const frame_recorder&) -> frame_recorder& = delete;
+
+  /**
+   * \brief Waits for all submitted frames to be encoded.
+   *
+   * \since 6.1.0
+   */
+  ~frame_recorder() noexcept
+  {
+    try
+    {
+      wait();
+    }
+    catch (...)
+    {
+      // The tasks don't throw, so this only happens if waiting itself fails
+    }
+  }
+
+  /**
+   * \brief Returns a surface that a frame can be captured into.
+   *
+   * \details A surface of a previously encoded frame is reused if there is one with the
+   * requested size and format; otherwise, a new surface is created.
+   *
+   * \param size the size of the frame.
+   * \param format the pixel format of the frame.
+   *
+   * \return a surface with undefined contents.
+   *
+   * \throws sdl_error if a new surface can't be created.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto acquire(const iarea size, const pixel_format format) -> surface
+  {
+    {
+      scoped_lock lock{m_mutex};
+      for (auto it = m_free.begin(); it != m_free.end(); ++it)
+      {
+        if (it->size() == size && it->format_info().format() == format)
+        {
+          auto frame = std::move(*it);
+          m_free.erase(it);
+          return frame;
+        }
+      }
+    }
+
+    return surface{size, format};
+  }
+
+  /**
+   * \brief Submits a frame to be encoded by a worker.
+   *
+   * \details The index of the frame is the amount of frames that have been accepted
+   * before it, so dropped frames don't leave gaps in image sequences.
+   *
+   * \pre The frames of a raw recording must all have the same size and pixel format.
+   *
+   * \param frame the frame that will be encoded, which is reused by `acquire()`
+   * afterwards.
+   *
+   * \return `true` if the frame was accepted; `false` if it was dropped, because there
+   * were too many pending frames.
+   *
+   * \since 6.1.0
+   */
+  auto submit(surface&& frame) -> bool
+  {
+    collect_finished();
+
+    if (m_tasks.size() >= m_maxPending)
+    {
+      ++m_dropped;
+      recycle(std::move(frame));
+      return false;
+    }
+
+    if (m_format == recording_format::raw)
+    {
+      if (m_rawSize.width == 0)
+      {
+        m_rawSize = frame.size();
+        m_rawFormat = frame.format_info().format();
+      }
+
+      assert(frame.size() == m_rawSize && "Raw frames must have the same size!");
+      assert(frame.format_info().format() == m_rawFormat);
+    }
+
+    const auto index = m_accepted++;
+    m_tasks.push_back(m_pool->submit(
+        [this, index, frame = std::move(frame)]() mutable { encode(index, frame); }));
+
+    return true;
+  }
+
+  /**
+   * \brief Blocks until all submitted frames have been encoded.
+   *
+   * \details The calling thread helps the workers with the pending tasks of the pool.
+   *
+   * \since 6.1.0
+   */
+  void wait()
+  {
+    while (!m_tasks.empty())
+    {
+      m_tasks.front().wait();
+      m_tasks.pop_front();
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of frames that have been encoded and written.
+   *
+   * \return the amount of recorded frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto recorded() const noexcept -> size_type
+  {
+    return m_recorded.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of frames that were dropped by `submit()`.
+   *
+   * \return the amount of dropped frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dropped() const noexcept -> size_type
+  {
+    return m_dropped;
+  }
+
+  /**
+   * \brief Returns the amount of frames that couldn't be written.
+   *
+   * \return the amount of frames whose encoding failed, e.g. due to a full disk.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto failed() const noexcept -> size_type
+  {
+    return m_failed.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of submitted frames that haven't been encoded yet.
+   *
+   * \return the amount of pending frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending() -> size_type
+  {
+    collect_finished();
+    return m_tasks.size();
+  }
+
+  /**
+   * \brief Returns the path of an image of the sequence, or of the raw recording.
+   *
+   * \param index the index of the frame, which is ignored by raw recordings.
+   *
+   * \return the path that the frame is written to.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_path(const size_type index) const -> std::string
+  {
+    if (m_format == recording_format::raw)
+    {
+      return m_prefix;
+    }
+
+    char number[24]{};
+    std::snprintf(number, sizeof number, "%06zu", index);
+
+    return m_prefix + number + extension();
+  }
+
+  [[nodiscard]] auto format() const noexcept -> recording_format
+  {
+    return m_format;
+  }
+
+  /// \} End of queries
+
+ private:
+  thread_pool* m_pool{};
+  std::string m_prefix;
+  recording_format m_format;
+  size_type m_maxPending{};
+  std::deque<task_handle<void>> m_tasks;  // Only used by the submitting thread
+  size_type m_accepted{};
+  size_type m_dropped{};
+  std::atomic<size_type> m_recorded{0};
+  std::atomic<size_type> m_failed{0};
+
+  mutex m_mutex;                 // Guards the free surfaces and the raw file
+  std::vector<surface> m_free;   // Surfaces of encoded frames
+  std::optional<file> m_stream;  // The file of a raw recording
+  iarea m_rawSize{};
+  pixel_format m_rawFormat{pixel_format::unknown};
+
+  [[nodiscard]] auto extension() const noexcept -> const char*
+  {
+#ifndef CENTURION_NO_SDL_IMAGE
+    if (m_format == recording_format::png)
+    {
+      return ".png";
+    }
+#endif  // CENTURION_NO_SDL_IMAGE
+
+    return ".bmp";
+  }
+
+  void collect_finished()
+  {
+    // Tasks finish roughly in order, so only the front is checked
+    while (!m_tasks.empty() && m_tasks.front().is_ready())
+    {
+      m_tasks.pop_front();
+    }
+  }
+
+  void recycle(surface&& frame)
+  {
+    scoped_lock lock{m_mutex};
+
+    // Only a few frames are in flight at once, so the pool stays small
+    if (m_free.size() <= m_maxPending)
+    {
+      m_free.push_back(std::move(frame));
+    }
+  }
+
+  // Invoked by the workers
+  void encode(const size_type index, surface& frame) noexcept
+  {
+    try
+    {
+      if (write(index, frame))
+      {
+        m_recorded.fetch_add(1, std::memory_order_acq_rel);
+      }
+      else
+      {
+        m_failed.fetch_add(1, std::memory_order_acq_rel);
+      }
+
+      recycle(std::move(frame));
+    }
+    catch (...)
+    {
+      m_failed.fetch_add(1, std::memory_order_acq_rel);
+    }
+  }
+
+  [[nodiscard]] auto write(const size_type index, surface& frame) -> bool
+  {
+    switch (m_format)
+    {
+      case recording_format::bmp:
+        return static_cast<bool>(frame.save_as_bmp(frame_path(index)));
+
+#ifndef CENTURION_NO_SDL_IMAGE
+      case recording_format::png:
+        return static_cast<bool>(frame.save_as_png(frame_path(index)));
+#endif  // CENTURION_NO_SDL_IMAGE
+
+      case recording_format::raw:
+        return write_raw(index, frame);
+
+      default:
+        return false;
+    }
+  }
+
+  [[nodiscard]] auto write_raw(const size_type index, surface& frame) -> bool
+  {
+    if (!frame.lock())
+    {
+      return false;
+    }
+
+    const auto bytesPerPixel = static_cast<size_type>(frame.get()->format->BytesPerPixel);
+    const auto rowSize = static_cast<size_type>(frame.width()) * bytesPerPixel;
+    const auto frameSize = rowSize * static_cast<size_type>(frame.height());
+    const auto* pixels = static_cast<const u8*>(frame.pixels());
+
+    // Frames have fixed offsets, so they can be written in any order
+    auto written = false;
+    {
+      scoped_lock lock{m_mutex};
+
+      auto& stream = *m_stream;
+      if (stream.seek(static_cast<i64>(index * frameSize), seek_mode::from_beginning))
+      {
+        written = true;
+        for (int y = 0; y < frame.height() && written; ++y)
+        {
+          const auto* row = pixels + static_cast<size_type>(y * frame.pitch());
+          written = stream.write(row, rowSize) == rowSize;
+        }
+      }
+    }
+
+    frame.unlock();
+    return written;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_FRAME_RECORDER_HEADER
@@ -0,0 +1,351 @@
+#ifndef CENTURION_HIT_MASK_HEADER
+#define CENTURION_HIT_MASK_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max, min
+#include <cassert>    // assert
+#include <cstddef>    // size_t, ptrdiff_t
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/bit_mask_kernels.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../detail/surface_read_lock.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "surface.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Reads a pixel of any size, in the native byte order like SDL
+[[nodiscard]] inline auto read_pixel(const u8* pixel, const int bytesPerPixel) noexcept
+    -> u32
+{
+  switch (bytesPerPixel)
+  {
+    case 1:
+      return *pixel;
+
+    case 2: {
+      u16 value{};
+      SDL_memcpy(&value, pixel, sizeof value);
+      return value;
+    }
+
+    case 3:
+      if constexpr (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+      {
+        return u32{pixel[0]} | (u32{pixel[1]} << 8u) | (u32{pixel[2]} << 16u);
+      }
+      else
+      {
+        return (u32{pixel[0]} << 16u) | (u32{pixel[1]} << 8u) | u32{pixel[2]};
+      }
+
+    default: {
+      u32 value{};
+      SDL_memcpy(&value, pixel, sizeof value);
+      return value;
+    }
+  }
+}
+
+[[nodiscard]] constexpr auto floor_divide(const int value, const int divisor) noexcept
+    -> int
+{
+  return (value >= 0) ? value / divisor : -((divisor - 1 - value) / divisor);
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class hit_mask
+ *
+ * \brief A packed bitmask of the opaque pixels of a surface, for pixel-perfect picking
+ * and collision detection.
+ *
+ * \details The mask is built once from a surface, after which point queries only read a
+ * single bit, and overlap tests between two masks compare 64 pixels per instruction, or
+ * 128 pixels with SSE2 or NEON. Neither touches the pixels of the surface, which makes
+ * the masks suitable for picking among many sprites, after their bounding rectangles
+ * have been tested.
+ * \code{cpp}
+ *   const cen::hit_mask mask{sprite};
+ *
+ *   if (mask.contains(mouse - position)) {
+ *     select_sprite();
+ *   }
+ * \endcode
+ *
+ * \details A mask can be downsampled, where every bit covers a square block of pixels
+ * and is set if any pixel in the block is opaque, which makes the masks smaller and the
+ * tests faster, at the cost of precision.
+ *
+ * \since 6.1.0
+ */
+class hit_mask final
+{
+ public:
+  /**
+   * \brief Creates the mask of a surface.
+   *
+   * \details Pixels with an alpha value of at least the threshold are opaque, except for
+   * pixels that match the color key of the surface, if it has one.
+   *
+   * \tparam T the ownership semantics of the surface.
+   *
+   * \param surface the surface that the mask is built from.
+   * \param threshold the minimum alpha value of opaque pixels.
+   * \param scale the width and height of the pixel blocks that are covered by each bit,
+   * must be at least 1.
+   *
+   * \throws cen_error if the scale is less than 1.
+   * \throws sdl_error if the surface couldn't be locked.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  explicit hit_mask(const basic_surface<T>& surface,
+                    const u8 threshold = 1,
+                    const int scale = 1)
+      : m_width{surface.width()}
+      , m_height{surface.height()}
+      , m_scale{scale}
+  {
+    if (scale < 1)
+    {
+      throw cen_error{"Hit mask scale must be at least 1!"};
+    }
+
+    m_columns = (m_width + scale - 1) / scale;
+    m_rows = (m_height + scale - 1) / scale;
+
+    // Every row is padded with a zero word on both sides, for the overlap kernels
+    m_stride = static_cast<std::size_t>((m_columns + 63) / 64) + 2u;
+    m_bits.assign(m_stride * static_cast<std::size_t>(m_rows), 0);
+
+    build(surface.get(), threshold);
+  }
+
+  /**
+   * \brief Indicates whether or not a pixel is opaque.
+   *
+   * \param point the position of the pixel, relative to the top-left corner of the
+   * surface.
+   *
+   * \return `true` if the pixel is opaque, or in a block with an opaque pixel; `false`
+   * if it isn't, or if the point is out of bounds.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto contains(const ipoint point) const noexcept -> bool
+  {
+    if (point.x() < 0 || point.y() < 0 || point.x() >= m_width || point.y() >= m_height)
+    {
+      return false;
+    }
+
+    const auto column = point.x() / m_scale;
+    const auto* row = row_data(point.y() / m_scale);
+
+    return (row[column / 64] >> static_cast<unsigned>(column % 64)) & 1u;
+  }
+
+  /**
+   * \brief Indicates whether or not any opaque pixels of two masks overlap.
+   *
+   * \pre Both masks must have the same scale.
+   *
+   * \param other the other mask.
+   * \param offset the position of the other mask, relative to this mask. The offset is
+   * rounded down to a multiple of the scale.
+   *
+   * \return `true` if the masks overlap; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto overlaps(const hit_mask& other, const ipoint offset) const noexcept
+      -> bool
+  {
+    assert(m_scale == other.m_scale);
+
+    const auto dx = detail::floor_divide(offset.x(), m_scale);
+    const auto dy = detail::floor_divide(offset.y(), m_scale);
+
+    // The other mask is always shifted towards higher bits
+    if (dx >= 0)
+    {
+      return overlaps_cells(other, dx, dy);
+    }
+    else
+    {
+      return other.overlaps_cells(*this, -dx, -dy);
+    }
+  }
+
+  /**
+   * \brief Returns the width of the surface that the mask was built from.
+   *
+   * \return the width of the mask, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return m_width;
+  }
+
+  /**
+   * \brief Returns the height of the surface that the mask was built from.
+   *
+   * \return the height of the mask, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return m_height;
+  }
+
+  /**
+   * \brief Returns the size of the surface that the mask was built from.
+   *
+   * \return the size of the mask, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return {m_width, m_height};
+  }
+
+  /**
+   * \brief Returns the size of the pixel blocks that are covered by each bit.
+   *
+   * \return the scale of the mask.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto scale() const noexcept -> int
+  {
+    return m_scale;
+  }
+
+ private:
+  int m_width{};
+  int m_height{};
+  int m_scale{};
+  int m_columns{};
+  int m_rows{};
+  std::size_t m_stride{};  // The amount of words per row, including the padding
+  std::vector<u64> m_bits;
+
+  [[nodiscard]] auto row_data(const int row) noexcept -> u64*
+  {
+    return m_bits.data() + static_cast<std::size_t>(row) * m_stride + 1u;
+  }
+
+  [[nodiscard]] auto row_data(const int row) const noexcept -> const u64*
+  {
+    return m_bits.data() + static_cast<std::size_t>(row) * m_stride + 1u;
+  }
+
+  void build(SDL_Surface* surface, const u8 threshold)
+  {
+    const detail::surface_read_lock lock{surface};
+
+    const auto* format = surface->format;
+    const auto bytesPerPixel = static_cast<int>(format->BytesPerPixel);
+
+    // Color keys are compared without the alpha bits, like SDL does
+    u32 key{};
+    const auto hasKey = SDL_GetColorKey(surface, &key) == 0;
+    const auto keyMask = ~format->Amask;
+
+    detail::channel_layout layout;
+    const auto hasLayout = detail::get_channel_layout(format->format, layout);
+
+    for (int y = 0; y < m_height; ++y)
+    {
+      const auto offset = static_cast<std::ptrdiff_t>(y) * surface->pitch;
+      const auto* pixels = static_cast<const u8*>(surface->pixels) + offset;
+      auto* row = row_data(y / m_scale);
+
+      for (int x = 0; x < m_width; ++x)
+      {
+        const auto pixel = detail::read_pixel(pixels + x * bytesPerPixel, bytesPerPixel);
+
+        u8 alpha = 0xFF;
+        if (hasLayout)
+        {
+          if (!layout.opaque)
+          {
+            alpha = static_cast<u8>(pixel >> static_cast<u32>(layout.alpha));
+          }
+        }
+        else
+        {
+          u8 red{};
+          u8 green{};
+          u8 blue{};
+          SDL_GetRGBA(pixel, format, &red, &green, &blue, &alpha);
+        }
+
+        if (alpha >= threshold && !(hasKey && (pixel & keyMask) == (key & keyMask)))
+        {
+          const auto column = x / m_scale;
+          row[column / 64] |= u64{1} << static_cast<unsigned>(column % 64);
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] auto overlaps_cells(const hit_mask& other,
+                                    const int dx,
+                                    const int dy) const noexcept -> bool
+  {
+    const auto first = (std::max)(0, dy);
+    const auto last = (std::min)(m_rows, dy + other.m_rows);
+
+    // The shifted words of the other mask cover [skip, skip + words + 1) of this mask
+    const auto skip = static_cast<std::size_t>(dx / 64);
+    const auto shift = static_cast<unsigned>(dx % 64);
+    const auto words = m_stride - 2u;
+    const auto end = (std::min)(words, skip + other.m_stride - 1u);
+
+    if (first >= last || skip >= end)
+    {
+      return false;
+    }
+
+    const auto level = detail::get_simd_level();
+    for (auto row = first; row < last; ++row)
+    {
+      if (detail::rows_overlap(level,
+                               row_data(row) + skip,
+                               other.row_data(row - dy),
+                               end - skip,
+                               shift))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_HIT_MASK_HEADER
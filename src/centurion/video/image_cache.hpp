@@ -0,0 +1,597 @@
+#ifndef CENTURION_IMAGE_CACHE_HEADER
+#define CENTURION_IMAGE_CACHE_HEADER
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+#include <SDL.h>
+
+#if defined(_WIN32)
+#include "../detail/windows_api.hpp"  // GetFileAttributesExA
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/stat.h>  // stat
+#endif
+
+#include <cstddef>   // size_t
+#include <cstdio>    // remove, rename
+#include <cstring>   // memcpy, memcmp
+#include <optional>  // optional, nullopt
+#include <string>    // string, to_string
+#include <utility>   // move
+#include <vector>    // vector
+
+#include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/asset_pack_format.hpp"
+#include "../detail/block_compression.hpp"
+#include "../detail/surface_read_lock.hpp"
+#include "../filesystem/file.hpp"
+#include "../filesystem/join_path.hpp"
+#include "../filesystem/mapped_file.hpp"
+#include "../math/area.hpp"
+#include "blend_mode.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+/*
+ * Cache entries consist of a header followed by the pixels, which are stored as tightly
+ * packed rows and compressed as a single LZ4 block. All values are stored in
+ * little-endian byte order.
+ *
+ *   u8[4]  magic, "CENI"
+ *   u32    format version
+ *   u64    modification time of the source image
+ *   u64    size of the source image, in bytes
+ *   u64    hash of the key, i.e. the source path and the load options
+ *   u32    pixel format
+ *   u32    flags, bit 0 is set if the pixels are premultiplied
+ *   i32    width
+ *   i32    height
+ *   u32    amount of stored bytes, the high bit is set if the pixels are uncompressed
+ *   u32    amount of uncompressed bytes
+ */
+
+inline constexpr char image_cache_magic[4] = {'C', 'E', 'N', 'I'};
+inline constexpr u32 image_cache_version = 1;
+inline constexpr std::size_t image_cache_header_size = 56;
+inline constexpr u32 image_cache_stored_flag = 0x8000'0000u;
+inline constexpr u32 image_cache_premultiplied_flag = 1u;
+
+// Identifies a version of a file, without reading it
+struct file_stamp final
+{
+  u64 modified{};
+  u64 size{};
+};
+
+[[nodiscard]] inline auto get_file_stamp(const czstring path, file_stamp& stamp) noexcept
+    -> bool
+{
+#if defined(_WIN32)
+  WIN32_FILE_ATTRIBUTE_DATA data{};
+  if (!GetFileAttributesExA(path, GetFileExInfoStandard, &data))
+  {
+    return false;
+  }
+
+  stamp.modified = (u64{data.ftLastWriteTime.dwHighDateTime} << 32u) |
+                   data.ftLastWriteTime.dwLowDateTime;
+  stamp.size = (u64{data.nFileSizeHigh} << 32u) | data.nFileSizeLow;
+  return true;
+#elif defined(__unix__) || defined(__APPLE__)
+  struct stat info{};
+  if (stat(path, &info) != 0)
+  {
+    return false;
+  }
+
+#if defined(__APPLE__)
+  const auto nanoseconds = info.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+  const auto nanoseconds = info.st_mtim.tv_nsec;
+#else
+  const long nanoseconds = 0;
+#endif
+
+  stamp.modified = static_cast<u64>(info.st_mtime) * 1'000'000'000u +
+                   static_cast<u64>(nanoseconds);
+  stamp.size = static_cast<u64>(info.st_size);
+  return true;
+#else
+  static_cast<void>(path);
+  static_cast<void>(stamp);
+  return false;
+#endif
+}
+
+// The pixels of a valid cache entry, which might be compressed
+struct image_cache_entry final
+{
+  mapped_file source;
+  iarea size{};
+  const u8* data{};
+  std::size_t storedSize{};
+  std::size_t rawSize{};
+  bool compressed{};
+
+  // Decodes the pixels into rows with the specified pitch
+  [[nodiscard]] auto decode(u8* pixels, const std::size_t pitch) const -> bool
+  {
+    const auto rowSize = rawSize / static_cast<std::size_t>(size.height);
+    if (rowSize == pitch)
+    {
+      if (compressed)
+      {
+        return decompress_block(data, storedSize, pixels, rawSize);
+      }
+
+      std::memcpy(pixels, data, rawSize);
+      return true;
+    }
+
+    std::vector<u8> packed;
+    const u8* rows = data;
+
+    if (compressed)
+    {
+      packed.resize(rawSize);
+      if (!decompress_block(data, storedSize, packed.data(), rawSize))
+      {
+        return false;
+      }
+
+      rows = packed.data();
+    }
+
+    for (int row = 0; row < size.height; ++row)
+    {
+      const auto index = static_cast<std::size_t>(row);
+      std::memcpy(pixels + index * pitch, rows + index * rowSize, rowSize);
+    }
+
+    return true;
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class image_cache
+ *
+ * \brief An on-disk cache of decoded images, which avoids decoding the same PNG and JPG
+ * files through SDL_image on every launch.
+ *
+ * \details The first time that an image is loaded, it's decoded and converted to the
+ * requested pixel format, and the pixels are written to the cache directory, compressed
+ * with LZ4. Subsequent loads map the cache entry into memory, and decompress the pixels
+ * straight into the surface or texture, which is typically several times faster than
+ * decoding a PNG file.
+ * \code{cpp}
+ *   cen::image_cache cache{"cache/images"};
+ *
+ *   auto sheet = cache.load_texture(renderer, "sheet.png", cen::pixel_format::rgba8888);
+ * \endcode
+ *
+ * \details An entry is only used if the modification time and size of the source image
+ * match the values recorded in the entry, so edited images are decoded again. Entries
+ * are replaced atomically, so a cache that was interrupted while writing is still valid.
+ *
+ * \note The cache directory must exist. Failing to write an entry isn't an error, the
+ * image is just decoded again the next time. An image cache must not be used by several
+ * threads at the same time.
+ *
+ * \since 6.1.0
+ */
+class image_cache final
+{
+ public:
+  /**
+   * \brief Creates an image cache that stores its entries in a directory.
+   *
+   * \param directory the path of the cache directory, which must exist.
+   *
+   * \since 6.1.0
+   */
+  explicit image_cache(std::string directory) : m_directory{std::move(directory)}
+  {
+    if (!m_directory.empty() && !detail::is_path_separator(m_directory.back()))
+    {
+      m_directory += path_separator;
+    }
+  }
+
+  /**
+   * \brief Loads an image as a surface, using the cache if possible.
+   *
+   * \param path the path of the image.
+   * \param format the pixel format of the surface.
+   * \param mode the blend mode of the surface.
+   * \param premultiplied `true` if the color channels should be multiplied by the alpha
+   * values, see `basic_surface::with_format()`.
+   *
+   * \return a surface with the decoded image.
+   *
+   * \throws img_error if the image had to be decoded, and couldn't be loaded.
+   * \throws sdl_error if the surface couldn't be created or converted.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto load_surface(const std::string& path,
+                                  const pixel_format format,
+                                  const blend_mode mode = blend_mode::blend,
+                                  const bool premultiplied = false) -> surface
+  {
+    detail::file_stamp stamp;
+    const auto stamped = detail::get_file_stamp(path.c_str(), stamp);
+    const auto key = make_key(path, format, premultiplied);
+
+    if (stamped)
+    {
+      if (const auto entry = find(key, stamp, format, premultiplied))
+      {
+        surface result{entry->size, format};
+        result.set_blend_mode(mode);
+
+        const detail::surface_read_lock lock{result.get()};
+        auto* pixels = static_cast<u8*>(result.pixels());
+        if (entry->decode(pixels, static_cast<std::size_t>(result.pitch())))
+        {
+          ++m_hits;
+          return result;
+        }
+      }
+    }
+
+    ++m_misses;
+    auto result = surface::with_format(path, mode, format, premultiplied);
+
+    if (stamped)
+    {
+      store(key, stamp, format, premultiplied, result);
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Loads an image as a texture, using the cache if possible.
+   *
+   * \details The texture is created with the requested pixel format, and is updated
+   * from the cached pixels.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the texture.
+   * \param path the path of the image.
+   * \param format the pixel format of the texture.
+   * \param mode the blend mode of the texture.
+   * \param premultiplied `true` if the color channels should be multiplied by the alpha
+   * values.
+   *
+   * \return a texture with the decoded image.
+   *
+   * \throws img_error if the image had to be decoded, and couldn't be loaded.
+   * \throws sdl_error if the texture couldn't be created or updated.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto load_texture(const Renderer& renderer,
+                                  const std::string& path,
+                                  const pixel_format format,
+                                  const blend_mode mode = blend_mode::blend,
+                                  const bool premultiplied = false) -> texture
+  {
+    detail::file_stamp stamp;
+    const auto key = make_key(path, format, premultiplied);
+
+    if (detail::get_file_stamp(path.c_str(), stamp))
+    {
+      if (const auto entry = find(key, stamp, format, premultiplied))
+      {
+        const auto pitch = entry->rawSize / static_cast<std::size_t>(entry->size.height);
+
+        // Uncompressed pixels are uploaded straight from the mapped file
+        const u8* pixels = entry->data;
+        std::vector<u8> buffer;
+
+        if (entry->compressed)
+        {
+          buffer.resize(entry->rawSize);
+          pixels = entry->decode(buffer.data(), pitch) ? buffer.data() : nullptr;
+        }
+
+        if (pixels)
+        {
+          ++m_hits;
+          return make_texture(renderer, format, mode, entry->size, pixels, pitch);
+        }
+      }
+    }
+
+    // The surface is decoded and stored by the surface overload
+    const auto source = load_surface(path, format, mode, premultiplied);
+    const detail::surface_read_lock lock{source.get()};
+
+    return make_texture(renderer,
+                        format,
+                        mode,
+                        source.size(),
+                        source.pixels(),
+                        static_cast<std::size_t>(source.pitch()));
+  }
+
+  /**
+   * \brief Returns the path of the cache entry of an image.
+   *
+   * \param path the path of the image.
+   * \param format the pixel format of the cached pixels.
+   * \param premultiplied `true` if the cached pixels are premultiplied.
+   *
+   * \return the path of the cache entry, which might not exist.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto entry_path(const std::string& path,
+                                const pixel_format format,
+                                const bool premultiplied = false) const -> std::string
+  {
+    return entry_path(make_key(path, format, premultiplied));
+  }
+
+  /**
+   * \brief Returns the amount of images that were loaded from the cache.
+   *
+   * \return the amount of cache hits.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto hits() const noexcept -> std::size_t
+  {
+    return m_hits;
+  }
+
+  /**
+   * \brief Returns the amount of images that had to be decoded.
+   *
+   * \return the amount of cache misses.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto misses() const noexcept -> std::size_t
+  {
+    return m_misses;
+  }
+
+  /**
+   * \brief Returns the path of the cache directory.
+   *
+   * \return the cache directory, with a trailing path separator.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto directory() const noexcept -> const std::string&
+  {
+    return m_directory;
+  }
+
+ private:
+  std::string m_directory;
+  std::size_t m_hits{};
+  std::size_t m_misses{};
+
+  [[nodiscard]] static auto make_key(const std::string& path,
+                                     const pixel_format format,
+                                     const bool premultiplied) -> u64
+  {
+    auto key = path;
+    key += '#';
+    key += std::to_string(to_underlying(format));
+    key += premultiplied ? "p" : "";
+
+    return detail::asset_name_hash(key);
+  }
+
+  [[nodiscard]] auto entry_path(const u64 key) const -> std::string
+  {
+    constexpr char digits[] = "0123456789abcdef";
+
+    std::string result = m_directory;
+    for (int shift = 60; shift >= 0; shift -= 4)
+    {
+      result += digits[(key >> static_cast<u64>(shift)) & 0xFu];
+    }
+
+    result += ".img";
+    return result;
+  }
+
+  [[nodiscard]] auto find(const u64 key,
+                          const detail::file_stamp& stamp,
+                          const pixel_format format,
+                          const bool premultiplied) const
+      -> std::optional<detail::image_cache_entry>
+  {
+    using detail::load_little_endian;
+
+    const auto path = entry_path(key);
+
+    // Looking up the file first avoids throwing exceptions for missing entries
+    detail::file_stamp entryStamp;
+    if (!detail::get_file_stamp(path.c_str(), entryStamp) ||
+        entryStamp.size < detail::image_cache_header_size)
+    {
+      return std::nullopt;
+    }
+
+    try
+    {
+      detail::image_cache_entry entry{mapped_file{path}};
+
+      const auto* header = reinterpret_cast<const u8*>(entry.source.data());
+      const auto flags = premultiplied ? detail::image_cache_premultiplied_flag : 0u;
+
+      if (entry.source.size() < detail::image_cache_header_size ||
+          std::memcmp(header, detail::image_cache_magic, 4) != 0 ||
+          load_little_endian<u32>(header + 4) != detail::image_cache_version ||
+          load_little_endian<u64>(header + 8) != stamp.modified ||
+          load_little_endian<u64>(header + 16) != stamp.size ||
+          load_little_endian<u64>(header + 24) != key ||
+          load_little_endian<u32>(header + 32) != to_underlying(format) ||
+          load_little_endian<u32>(header + 36) != flags)
+      {
+        return std::nullopt;
+      }
+
+      const auto width = static_cast<i32>(load_little_endian<u32>(header + 40));
+      const auto height = static_cast<i32>(load_little_endian<u32>(header + 44));
+      const auto stored = load_little_endian<u32>(header + 48);
+
+      entry.size = {width, height};
+      entry.data = header + detail::image_cache_header_size;
+      entry.storedSize = stored & ~detail::image_cache_stored_flag;
+      entry.rawSize = load_little_endian<u32>(header + 52);
+      entry.compressed = !(stored & detail::image_cache_stored_flag);
+
+      const auto bytesPerPixel = SDL_BYTESPERPIXEL(to_underlying(format));
+      const auto expected = static_cast<std::size_t>(width) *
+                            static_cast<std::size_t>(height) * bytesPerPixel;
+
+      if (width < 1 || height < 1 || entry.rawSize != expected ||
+          entry.source.size() != detail::image_cache_header_size + entry.storedSize ||
+          (!entry.compressed && entry.storedSize != entry.rawSize))
+      {
+        return std::nullopt;
+      }
+
+      return entry;
+    }
+    catch (const cen_error&)
+    {
+      return std::nullopt;
+    }
+  }
+
+  // Writes an entry to a temporary file, which then replaces the previous entry
+  auto store(const u64 key,
+             const detail::file_stamp& stamp,
+             const pixel_format format,
+             const bool premultiplied,
+             const surface& source) const -> bool
+  {
+    using detail::store_little_endian;
+
+    const detail::surface_read_lock lock{source.get()};
+
+    const auto width = static_cast<std::size_t>(source.width());
+    const auto height = static_cast<std::size_t>(source.height());
+    const auto rowSize = width * SDL_BYTESPERPIXEL(to_underlying(format));
+    const auto rawSize = rowSize * height;
+
+    if (rawSize == 0 || rawSize >= detail::image_cache_stored_flag)
+    {
+      return false;
+    }
+
+    // The compressor needs tightly packed rows
+    const auto* pixels = static_cast<const u8*>(source.pixels());
+    const auto pitch = static_cast<std::size_t>(source.pitch());
+
+    std::vector<u8> packed;
+    if (pitch != rowSize)
+    {
+      packed.resize(rawSize);
+      for (std::size_t row = 0; row < height; ++row)
+      {
+        std::memcpy(packed.data() + row * rowSize, pixels + row * pitch, rowSize);
+      }
+
+      pixels = packed.data();
+    }
+
+    std::vector<u8> buffer(detail::image_cache_header_size + rawSize);
+    auto* out = buffer.data() + detail::image_cache_header_size;
+
+    // Pixels that don't compress are stored as they are
+    auto stored = detail::compress_block(pixels, rawSize, out, rawSize);
+    auto storedField = static_cast<u32>(stored);
+    if (stored == 0)
+    {
+      std::memcpy(out, pixels, rawSize);
+      stored = rawSize;
+      storedField = static_cast<u32>(rawSize) | detail::image_cache_stored_flag;
+    }
+
+    auto* header = buffer.data();
+    std::memcpy(header, detail::image_cache_magic, 4);
+    store_little_endian<u32>(header + 4, detail::image_cache_version);
+    store_little_endian<u64>(header + 8, stamp.modified);
+    store_little_endian<u64>(header + 16, stamp.size);
+    store_little_endian<u64>(header + 24, key);
+    store_little_endian<u32>(header + 32, to_underlying(format));
+    store_little_endian<u32>(header + 36,
+                             premultiplied ? detail::image_cache_premultiplied_flag : 0u);
+    store_little_endian<u32>(header + 40, static_cast<u32>(width));
+    store_little_endian<u32>(header + 44, static_cast<u32>(height));
+    store_little_endian<u32>(header + 48, storedField);
+    store_little_endian<u32>(header + 52, static_cast<u32>(rawSize));
+
+    const auto path = entry_path(key);
+    const auto temporary = path + ".tmp";
+    const auto size = detail::image_cache_header_size + stored;
+
+    bool written{};
+    {
+      file target{temporary, file_mode::write_binary};
+      written = target && target.write(buffer.data(), size) == size;
+    }
+
+    if (!written)
+    {
+      std::remove(temporary.c_str());
+      return false;
+    }
+
+    // Renaming doesn't replace existing files on all platforms
+    std::remove(path.c_str());
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+  }
+
+  template <typename Renderer>
+  [[nodiscard]] static auto make_texture(const Renderer& renderer,
+                                         const pixel_format format,
+                                         const blend_mode mode,
+                                         const iarea size,
+                                         const void* pixels,
+                                         const std::size_t pitch) -> texture
+  {
+    texture result{renderer, format, texture_access::no_lock, size};
+    result.set_blend_mode(mode);
+
+    if (!result.update(pixels, static_cast<int>(pitch)))
+    {
+      throw sdl_error{};
+    }
+
+    return result;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_IMAGE
+#endif  // CENTURION_IMAGE_CACHE_HEADER
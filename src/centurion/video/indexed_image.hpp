@@ -0,0 +1,461 @@
+#ifndef CENTURION_INDEXED_IMAGE_HEADER
+#define CENTURION_INDEXED_IMAGE_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>  // size_t
+#include <string>   // string
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/to_underlying.hpp"
+#include "../math/area.hpp"
+#include "color.hpp"
+#include "palette.hpp"
+#include "palette_lut.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Maps colors to the nearest colors of a palette. The results are cached for each cell of
+// a grid with five bits per channel, where alpha only distinguishes between opaque and
+// transparent colors, so that each cell only searches the palette once.
+class palette_quantizer final
+{
+ public:
+  explicit palette_quantizer(const palette& palette) : m_cache(1u << 16u, unmapped)
+  {
+    m_colors.reserve(static_cast<std::size_t>(palette.size()));
+    for (int index = 0; index < palette.size(); ++index)
+    {
+      m_colors.push_back(palette[index]);
+    }
+  }
+
+  [[nodiscard]] auto operator()(const u8 r, const u8 g, const u8 b, const u8 a) -> u8
+  {
+    const u32 red = r >> 3u;
+    const u32 green = g >> 3u;
+    const u32 blue = b >> 3u;
+    const u32 opaque = (a >= 128u) ? 1u : 0u;
+    const auto key = (opaque << 15u) | (red << 10u) | (green << 5u) | blue;
+
+    auto& entry = m_cache[key];
+    if (entry == unmapped)
+    {
+      // The center of the cell, so that the result doesn't depend on the pixel order
+      entry = nearest((red << 3u) | 4u,
+                      (green << 3u) | 4u,
+                      (blue << 3u) | 4u,
+                      opaque * 255u);
+    }
+
+    return static_cast<u8>(entry);
+  }
+
+ private:
+  inline constexpr static u16 unmapped = 0xFFFF;
+
+  std::vector<color> m_colors;
+  std::vector<u16> m_cache;
+
+  [[nodiscard]] auto nearest(const u32 r, const u32 g, const u32 b, const u32 a) const
+      -> u16
+  {
+    u16 best = 0;
+    u32 bestDistance = 0xFFFF'FFFFu;
+
+    for (std::size_t index = 0; index < m_colors.size(); ++index)
+    {
+      const auto& color = m_colors[index];
+      const auto dr = static_cast<i32>(r) - color.red();
+      const auto dg = static_cast<i32>(g) - color.green();
+      const auto db = static_cast<i32>(b) - color.blue();
+      const auto da = static_cast<i32>(a) - color.alpha();
+
+      // Approximates the perceived difference, where alpha outweighs the colors, so that
+      // transparent pixels prefer transparent entries
+      const auto distance = static_cast<u32>((2 * dr * dr) + (4 * dg * dg) +
+                                             (3 * db * db) + (16 * da * da));
+
+      if (distance < bestDistance)
+      {
+        best = static_cast<u16>(index);
+        bestDistance = distance;
+      }
+    }
+
+    return best;
+  }
+};
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class indexed_image
+ *
+ * \brief An image that keeps its pixels as 8-bit palette indices, and only expands them
+ * to 32-bit pixels when they're uploaded to a texture.
+ *
+ * \details Compared to decoded 32-bit images, indexed images use a quarter of the memory
+ * for their pixels, which matters on memory-constrained targets that keep lots of images
+ * resident. The indices are expanded with a `palette_lut`, i.e. one table lookup per
+ * pixel, straight into the locked memory of a streaming texture.
+ * \code{cpp}
+ *   cen::indexed_image sprite{"player.png"};
+ *   auto texture = sprite.upload(renderer);
+ *
+ *   // Palette swaps only expand the indices again, the image isn't decoded again
+ *   sprite.set_palette(teamColors);
+ *   sprite.update(texture);
+ * \endcode
+ *
+ * \details Several textures with different palettes can share the same indices, by
+ * expanding the image with other lookup tables, see `update(basic_texture<T>&, const
+ * palette_lut&)`. True color images can be converted with `quantize()`.
+ *
+ * \see `palette_lut`
+ *
+ * \since 6.1.0
+ */
+class indexed_image final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an indexed image from an indexed surface.
+   *
+   * \param pixels the surface that provides the indices and the palette, must use the
+   * `index8` format.
+   * \param format the format of the expanded pixels, one of the 32-bit formats supported
+   * by `palette_lut`.
+   *
+   * \throws cen_error if the surface isn't indexed or if the format isn't supported.
+   *
+   * \since 6.1.0
+   */
+  explicit indexed_image(surface pixels,
+                         const pixel_format format = pixel_format::argb8888)
+      : m_lut{palette_of(pixels), format}
+      , m_pixels{std::move(pixels)}
+  {}
+
+  /**
+   * \brief Loads an indexed image, e.g. a PNG file with a palette.
+   *
+   * \param file the file path of the image, which must be decoded to an 8-bit surface.
+   * \param format the format of the expanded pixels.
+   *
+   * \throws sdl_error if the image can't be loaded.
+   * \throws cen_error if the decoded image isn't indexed or if the format isn't
+   * supported.
+   *
+   * \since 6.1.0
+   */
+  explicit indexed_image(const std::string& file,
+                         const pixel_format format = pixel_format::argb8888)
+      : indexed_image{surface{file}, format}
+  {}
+
+  /**
+   * \brief Converts a true color image to an indexed image, by mapping every pixel to
+   * the nearest color of a palette.
+   *
+   * \details Colors are matched with five bits of precision per channel, and alpha
+   * values only distinguish between opaque and transparent colors. Dithering isn't
+   * applied, so the palette should be a good fit for the image.
+   *
+   * \tparam T the ownership semantics of the source image.
+   *
+   * \param image the image that will be converted, in any format.
+   * \param palette the palette that the image is mapped to, with at most 256 colors.
+   * \param format the format of the expanded pixels.
+   *
+   * \return the quantized image.
+   *
+   * \throws sdl_error if the image can't be converted.
+   * \throws cen_error if the palette is empty or too large.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  [[nodiscard]] static auto quantize(const basic_surface<T>& image,
+                                     const palette& palette,
+                                     const pixel_format format = pixel_format::argb8888)
+      -> indexed_image
+  {
+    if (palette.size() <= 0 || palette.size() > 256)
+    {
+      throw cen_error{"Cannot quantize image with invalid palette!"};
+    }
+
+    auto* converted =
+        SDL_ConvertSurfaceFormat(image.get(), to_underlying(pixel_format::rgba32), 0);
+    if (!converted)
+    {
+      throw sdl_error{};
+    }
+
+    const surface source{converted};
+    surface indices{source.size(), pixel_format::index8};
+
+    if (SDL_SetSurfacePalette(indices.get(), palette.get()) != 0)
+    {
+      throw sdl_error{};
+    }
+
+    detail::palette_quantizer quantizer{palette};
+
+    // Neither surface is RLE accelerated, so they don't need to be locked
+    const auto* src = static_cast<const u8*>(source.get()->pixels);
+    auto* dst = static_cast<u8*>(indices.pixels());
+
+    for (int row = 0; row < source.height(); ++row)
+    {
+      const auto* in = src + row * source.pitch();
+      auto* out = dst + row * indices.pitch();
+
+      // The rgba32 format always stores its channels in this byte order
+      for (int column = 0; column < source.width(); ++column, in += 4)
+      {
+        out[column] = quantizer(in[0], in[1], in[2], in[3]);
+      }
+    }
+
+    return indexed_image{std::move(indices), format};
+  }
+
+  /// \} End of construction
+
+  /**
+   * \brief Replaces the palette of the image.
+   *
+   * \details The indices are left untouched, so textures only need to be updated to show
+   * the new colors, see `update()`.
+   *
+   * \param palette the new palette, with at most 256 colors.
+   *
+   * \return `success` if the palette was replaced; `failure` otherwise.
+   *
+   * \throws cen_error if the palette is empty.
+   *
+   * \since 6.1.0
+   */
+  auto set_palette(const palette& palette) -> result
+  {
+    m_lut = palette_lut{palette, m_lut.format()};
+    return SDL_SetSurfacePalette(m_pixels.get(), palette.get()) == 0;
+  }
+
+  /// \name Uploads
+  /// \{
+
+  /**
+   * \brief Creates a streaming texture with the expanded pixels of the image.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will own the texture.
+   *
+   * \return a streaming texture that uses the format of the lookup table.
+   *
+   * \throws sdl_error if the texture can't be created or updated.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto upload(const Renderer& renderer) const -> texture
+  {
+    texture result{renderer, m_lut.format(), texture_access::streaming, size()};
+
+    if (!update(result))
+    {
+      throw sdl_error{};
+    }
+
+    return result;
+  }
+
+  /**
+   * \brief Expands the image into a texture with the current palette.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param target a streaming texture with the size of the image and the format of the
+   * lookup table, e.g. a texture created by `upload()`.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto update(basic_texture<T>& target) const -> result
+  {
+    return update(target, m_lut);
+  }
+
+  /**
+   * \brief Expands the image into a texture with another lookup table.
+   *
+   * \details This makes it possible to create several palette-swapped variants of the
+   * image without storing the indices more than once.
+   *
+   * \tparam T the ownership semantics of the texture.
+   *
+   * \param target a streaming texture with the size of the image and the format of the
+   * lookup table.
+   * \param lut the lookup table that provides the colors.
+   *
+   * \return `success` if the texture was updated; `failure` if the texture doesn't match
+   * the image or the lookup table, or if something else went wrong.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto update(basic_texture<T>& target, const palette_lut& lut) const -> result
+  {
+    if (!target.is_streaming() || target.format() != lut.format() ||
+        target.size() != size())
+    {
+      return failure;
+    }
+
+    if (SDL_LockSurface(m_pixels.get()) != 0)
+    {
+      return failure;
+    }
+
+    const auto* src = static_cast<const u8*>(m_pixels.get()->pixels);
+    const auto srcPitch = m_pixels.pitch();
+    const auto width = static_cast<size_type>(m_pixels.width());
+    const auto height = m_pixels.height();
+
+    const auto res = target.write_pixels([&](void* pixels, const int pitch) {
+      auto* dst = static_cast<u8*>(pixels);
+      for (int row = 0; row < height; ++row)
+      {
+        lut.map(src + row * srcPitch, dst + row * pitch, width);
+      }
+    });
+
+    SDL_UnlockSurface(m_pixels.get());
+    return res;
+  }
+
+  /// \} End of uploads
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the surface that stores the indices and the palette.
+   *
+   * \return the indexed surface.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pixels() const noexcept -> const surface&
+  {
+    return m_pixels;
+  }
+
+  /**
+   * \brief Returns the lookup table that maps the indices to pixels.
+   *
+   * \return the lookup table of the current palette.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto lut() const noexcept -> const palette_lut&
+  {
+    return m_lut;
+  }
+
+  /**
+   * \brief Returns the format of the expanded pixels.
+   *
+   * \return the format used by uploaded textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    return m_lut.format();
+  }
+
+  /**
+   * \brief Returns the size of the image.
+   *
+   * \return the size of the image, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_pixels.size();
+  }
+
+  /**
+   * \brief Returns the amount of memory used by the indices.
+   *
+   * \return the size of the indices in bytes, including row padding.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto memory_size() const noexcept -> size_type
+  {
+    return static_cast<size_type>(m_pixels.pitch()) *
+           static_cast<size_type>(m_pixels.height());
+  }
+
+  /// \} End of queries
+
+ private:
+  palette_lut m_lut;
+  surface m_pixels;
+
+  [[nodiscard]] static auto palette_of(const surface& pixels) -> palette
+  {
+    if (pixels.format_info().format() != pixel_format::index8)
+    {
+      throw cen_error{"Cannot create indexed image from surface without indices!"};
+    }
+
+    const auto* source = pixels.get()->format->palette;
+    if (!source || source->ncolors <= 0)
+    {
+      throw cen_error{"Cannot create indexed image from surface without palette!"};
+    }
+
+    cen::palette colors{source->ncolors};
+    for (int index = 0; index < source->ncolors; ++index)
+    {
+      colors.set_color(index, color{source->colors[index]});
+    }
+
+    return colors;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_INDEXED_IMAGE_HEADER
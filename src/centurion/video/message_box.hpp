@@ -1,6 +1,8 @@
 #ifndef CENTURION_MESSAGE_BOX_HEADER
 #define CENTURION_MESSAGE_BOX_HEADER
 
+#ifndef CENTURION_NO_MESSAGE_BOX
+
 #include <SDL.h>
 
 #include <algorithm>    // max, any_of
@@ -13,8 +15,8 @@
 
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
+#include "../core/memory_resource.hpp"
 #include "../core/to_underlying.hpp"
-#include "../detail/stack_resource.hpp"
 #include "color.hpp"
 #include "colors.hpp"
 #include "window.hpp"
@@ -528,7 +530,7 @@ class message_box final
 
 #ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
     // Realistically 1-3 buttons, stack buffer for 8 buttons, just in case.
-    detail::stack_resource<8 * sizeof(SDL_MessageBoxButtonData)> resource;
+    stack_resource<8 * sizeof(SDL_MessageBoxButtonData)> resource;
     std::pmr::vector<SDL_MessageBoxButtonData> buttonData{resource.get()};
 #else
     std::vector<SDL_MessageBoxButtonData> buttonData;
@@ -667,4 +669,5 @@ class message_box final
 
 }  // namespace cen
 
+#endif  // CENTURION_NO_MESSAGE_BOX
 #endif  // CENTURION_MESSAGE_BOX_HEADER
@@ -0,0 +1,201 @@
+#ifndef CENTURION_MOUSE_LATCH_HEADER
+#define CENTURION_MOUSE_LATCH_HEADER
+
+#include <SDL.h>
+
+#include "../core/result.hpp"
+#include "../math/point.hpp"
+#include "render_command_buffer.hpp"
+#include "renderer.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class mouse_latch
+ *
+ * \brief Moves cursor-attached draw commands to the latest mouse position, just before a
+ * frame is rendered.
+ *
+ * \details The mouse position used by the game logic is sampled at the start of the
+ * frame, e.g. by `mouse::update()`, so everything that follows the cursor is drawn where
+ * the cursor was when the frame started. This class samples the position at the same
+ * time, then samples it again right before the frame is submitted and presented, and
+ * moves all latched commands (see `render_command_buffer::latch_last()`) by the
+ * difference, which hides a frame of input latency for cursor sprites and drag previews.
+ *
+ * \details The position is obtained with `SDL_GetGlobalMouseState()`, since
+ * `SDL_GetMouseState()` only changes when events are pumped. Only the difference between
+ * the two samples is used, so the position of the window doesn't matter, but the
+ * difference is scaled by `scale()` to match the logical size of the renderer.
+ *
+ * \code{cpp}
+ *   latch.sample();
+ *   buffer.render(cursor, {mouse.position(), cursorSize});
+ *   buffer.latch_last();
+ *   // ...
+ *   latch.present(renderer, buffer);
+ * \endcode
+ *
+ * \see `render_command_buffer`
+ * \see `render_thread`
+ *
+ * \since 6.1.0
+ */
+class mouse_latch final
+{
+ public:
+  /**
+   * \brief Samples the mouse position used to record the latched commands.
+   *
+   * \details This should be called when the game logic samples the mouse, e.g. right
+   * after `mouse::update()`.
+   *
+   * \since 6.1.0
+   */
+  void sample() noexcept
+  {
+    m_sampled = read();
+    m_hasSample = true;
+  }
+
+  /**
+   * \brief Discards the sampled position, which disables the latch.
+   *
+   * \since 6.1.0
+   */
+  void reset() noexcept
+  {
+    m_hasSample = false;
+  }
+
+  /**
+   * \brief Returns how far the mouse has moved since it was sampled.
+   *
+   * \return the scaled offset of the mouse; a zero offset if there is no sample.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto offset() const noexcept -> fpoint
+  {
+    if (!m_hasSample)
+    {
+      return {};
+    }
+
+    const auto current = read();
+    return {(current.x() - m_sampled.x()) * m_scale.x(),
+            (current.y() - m_sampled.y()) * m_scale.y()};
+  }
+
+  /**
+   * \brief Moves the latched commands of a buffer to the latest mouse position.
+   *
+   * \details The sample is consumed, so applying the latch twice has no effect.
+   *
+   * \param buffer the buffer that contains the latched commands.
+   *
+   * \return the offset that was applied.
+   *
+   * \since 6.1.0
+   */
+  auto apply(render_command_buffer& buffer) noexcept -> fpoint
+  {
+    const auto delta = offset();
+    if (delta != fpoint{})
+    {
+      buffer.offset_latched(delta);
+    }
+
+    m_hasSample = false;
+    return delta;
+  }
+
+  /**
+   * \brief Applies the latch, then submits the buffer and presents the frame.
+   *
+   * \details This function is meant to replace the usual combination of `submit()` and
+   * `present()`, so the mouse is sampled as late as possible.
+   *
+   * \pre This function must be called on the thread that owns the renderer.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   * \param buffer the buffer that will be submitted.
+   *
+   * \return `success` if all commands were rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto present(basic_renderer<T>& renderer, render_command_buffer& buffer) -> result
+  {
+    apply(buffer);
+
+    const auto res = buffer.submit(renderer);
+    renderer.present();
+
+    return res;
+  }
+
+  /**
+   * \brief Sets the factor by which mouse movement is scaled.
+   *
+   * \details The scale should be the ratio of the logical size of the renderer to the
+   * size of the window, and is 1 by default.
+   *
+   * \param scale the scale of the x- and y-axis.
+   *
+   * \since 6.1.0
+   */
+  void set_scale(const fpoint scale) noexcept
+  {
+    m_scale = scale;
+  }
+
+  /**
+   * \brief Returns the factor by which mouse movement is scaled.
+   *
+   * \return the scale of the x- and y-axis.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto scale() const noexcept -> fpoint
+  {
+    return m_scale;
+  }
+
+  /**
+   * \brief Indicates whether or not the mouse has been sampled for the current frame.
+   *
+   * \return `true` if the latch will move commands; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has_sample() const noexcept -> bool
+  {
+    return m_hasSample;
+  }
+
+ private:
+  fpoint m_sampled;
+  fpoint m_scale{1, 1};
+  bool m_hasSample{};
+
+  [[nodiscard]] static auto read() noexcept -> fpoint
+  {
+    int x{};
+    int y{};
+    SDL_GetGlobalMouseState(&x, &y);
+    return {static_cast<float>(x), static_cast<float>(y)};
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_MOUSE_LATCH_HEADER
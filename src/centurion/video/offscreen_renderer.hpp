@@ -0,0 +1,164 @@
+#ifndef CENTURION_OFFSCREEN_RENDERER_HEADER
+#define CENTURION_OFFSCREEN_RENDERER_HEADER
+
+#include <SDL.h>
+
+#include "../core/exception.hpp"
+#include "../math/area.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class offscreen_renderer
+ *
+ * \brief A software renderer that draws into a surface, without any window.
+ *
+ * \details Offscreen renderers don't depend on a display or a video driver, which makes
+ * them suitable for servers, e.g. for generating thumbnails, and for unattended tests and
+ * benchmarks. Everything that is rendered ends up directly in the target surface, so
+ * there's no need to capture the output.
+ * \code{cpp}
+ *   cen::offscreen_renderer offscreen{{256, 256}};
+ *
+ *   auto& renderer = offscreen.get();
+ *   renderer.clear_with(cen::colors::white);
+ *   renderer.render(texture, cen::irect{0, 0, 256, 256});
+ *
+ *   offscreen.target().save_as_bmp("thumbnail.bmp");
+ * \endcode
+ *
+ * \note Code that requires a window can run without a display by using the "dummy"
+ * video driver, i.e. by setting the `SDL_VIDEODRIVER` environment variable before SDL is
+ * initialized, and creating renderers with `renderer::software`.
+ *
+ * \see `SDL_CreateSoftwareRenderer()`
+ *
+ * \since 6.1.0
+ */
+class offscreen_renderer final
+{
+ public:
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an offscreen renderer and its target surface.
+   *
+   * \param size the size of the target surface.
+   * \param format the pixel format of the target surface.
+   *
+   * \throws cen_error if the size isn't positive.
+   * \throws sdl_error if the surface or the renderer can't be created.
+   *
+   * \since 6.1.0
+   */
+  explicit offscreen_renderer(const iarea size,
+                              const pixel_format format = pixel_format::rgba32)
+      : m_target{checked_size(size), format}
+      , m_renderer{create_renderer(m_target)}
+  {}
+
+  offscreen_renderer(const offscreen_renderer&) = delete;
+
+  offscreen_renderer(offscreen_renderer&&) noexcept = default;
+
+  auto operator=(const offscreen_renderer&) -> offscreen_renderer& = delete;
+
+  // The renderer would briefly refer to a destroyed surface during a move assignment
+  auto operator=(offscreen_renderer&&) -> offscreen_renderer& = delete;
+
+  /// \} End of construction
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the renderer that draws into the target surface.
+   *
+   * \return the associated renderer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() noexcept -> renderer&
+  {
+    return m_renderer;
+  }
+
+  /// \copydoc get()
+  [[nodiscard]] auto get() const noexcept -> const renderer&
+  {
+    return m_renderer;
+  }
+
+  /**
+   * \brief Returns the surface that the renderer draws into.
+   *
+   * \note The surface must not be replaced, since the renderer refers to it.
+   *
+   * \return the target surface.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto target() noexcept -> surface&
+  {
+    return m_target;
+  }
+
+  /// \copydoc target()
+  [[nodiscard]] auto target() const noexcept -> const surface&
+  {
+    return m_target;
+  }
+
+  /**
+   * \brief Returns the size of the target surface.
+   *
+   * \return the size of the target.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_target.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  surface m_target;
+  renderer m_renderer;
+
+  [[nodiscard]] static auto checked_size(const iarea size) -> iarea
+  {
+    if (size.width < 1 || size.height < 1)
+    {
+      throw cen_error{"Bad offscreen renderer size!"};
+    }
+
+    return size;
+  }
+
+  [[nodiscard]] static auto create_renderer(surface& target) -> renderer
+  {
+    if (auto* ptr = SDL_CreateSoftwareRenderer(target.get()))
+    {
+      return renderer{ptr};
+    }
+    else
+    {
+      throw sdl_error{};
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_OFFSCREEN_RENDERER_HEADER
@@ -12,8 +12,10 @@
 #include "../../core/exception.hpp"
 #include "../../core/owner.hpp"
 #include "../../core/result.hpp"
+#include "../../core/to_underlying.hpp"
 #include "../../detail/owner_handle_api.hpp"
 #include "../window.hpp"
+#include "gl_attribute.hpp"
 
 /// \addtogroup video
 /// \{
@@ -95,6 +97,72 @@ class basic_context final
     }
   }
 
+  /**
+   * \brief Creates a context that shares objects with the current context.
+   *
+   * \details Contexts in the same share group share textures, buffers, shaders and sync
+   * objects, but not container objects such as vertex arrays and framebuffers. This makes
+   * it possible to create resources on a worker thread, by making the shared context
+   * current on that thread.
+   *
+   * \details The `share_with_current_context` attribute is only enabled while the context
+   * is created, and the current context of the calling thread is restored afterwards,
+   * since SDL makes new contexts current.
+   * \code{cpp}
+   *   cen::gl::context context{window};
+   *   auto shared = cen::gl::context::shared(window);
+   *
+   *   // On a worker thread
+   *   shared.make_current(window);
+   * \endcode
+   *
+   * \pre `window` must be an OpenGL window.
+   *
+   * \tparam U the ownership semantics of the window.
+   *
+   * \param window the OpenGL window that the context is created for.
+   *
+   * \return an owning context in the share group of the current context.
+   *
+   * \throws cen_error if there is no current OpenGL context.
+   * \throws sdl_error if the context couldn't be created.
+   *
+   * \see `gl::upload_queue`
+   *
+   * \since 6.1.0
+   */
+  template <typename U, typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto shared(basic_window<U>& window) -> basic_context
+  {
+    assert(window.is_opengl());
+
+    auto* currentWindow = SDL_GL_GetCurrentWindow();
+    auto* currentContext = SDL_GL_GetCurrentContext();
+    if (!currentContext)
+    {
+      throw cen_error{"No current OpenGL context to share objects with!"};
+    }
+
+    constexpr auto attribute = static_cast<SDL_GLattr>(
+        to_underlying(gl_attribute::share_with_current_context));
+
+    int previous{};
+    SDL_GL_GetAttribute(attribute, &previous);
+    SDL_GL_SetAttribute(attribute, 1);
+
+    auto* context = SDL_GL_CreateContext(window.get());
+
+    SDL_GL_SetAttribute(attribute, previous);
+    SDL_GL_MakeCurrent(currentWindow, currentContext);
+
+    if (!context)
+    {
+      throw sdl_error{};
+    }
+
+    return basic_context{context};
+  }
+
   /// \} End of construction
 
   /**
@@ -117,6 +185,21 @@ class basic_context final
     return SDL_GL_MakeCurrent(window.get(), m_context.get()) == 0;
   }
 
+  /**
+   * \brief Unbinds the current OpenGL context from the calling thread.
+   *
+   * \details A context can only be current on one thread at a time, so contexts should
+   * be released before they are made current on another thread.
+   *
+   * \return `success` if the operation was successful; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  static auto release_current() noexcept -> result
+  {
+    return SDL_GL_MakeCurrent(SDL_GL_GetCurrentWindow(), nullptr) == 0;
+  }
+
   /**
    * \brief Returns the associated OpenGL context.
    *
@@ -141,6 +224,13 @@ class basic_context final
   std::unique_ptr<void, deleter> m_context;
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_context<detail::owning_type>;
+extern template class basic_context<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
 }  // namespace cen::gl
 
 /// \} End of group video
@@ -174,6 +174,35 @@ inline auto set_swap_interval(const gl_swap_interval interval) noexcept -> resul
   return gl_swap_interval{SDL_GL_GetSwapInterval()};
 }
 
+/**
+ * \brief Enables adaptive VSync, or regular VSync if adaptive VSync isn't supported.
+ *
+ * \details Adaptive VSync synchronizes with the vertical retrace as long as frames are
+ * on time, but swaps immediately when a frame misses the retrace, instead of waiting for
+ * the next one. This avoids the stutter of halving the frame rate, at the cost of some
+ * tearing when frames are late.
+ *
+ * \return the swap interval that is used; `gl_swap_interval::immediate` if VSync
+ * couldn't be enabled at all.
+ *
+ * \since 6.1.0
+ */
+inline auto set_adaptive_vsync() noexcept -> gl_swap_interval
+{
+  if (set_swap_interval(gl_swap_interval::late_immediate))
+  {
+    return gl_swap_interval::late_immediate;
+  }
+  else if (set_swap_interval(gl_swap_interval::synchronized))
+  {
+    return gl_swap_interval::synchronized;
+  }
+  else
+  {
+    return gl_swap_interval::immediate;
+  }
+}
+
 /**
  * \brief Returns a handle to the currently active OpenGL window.
  *
@@ -0,0 +1,295 @@
+#ifndef CENTURION_GL_FUNCTION_TABLE_HEADER
+#define CENTURION_GL_FUNCTION_TABLE_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "../../core/czstring.hpp"
+#include "../../core/exception.hpp"
+#include "gl_library.hpp"
+
+/// \cond FALSE
+
+// clang-format off
+
+/*
+ * The entry points of the function table, as (type, member, name, required). Functions
+ * from OpenGL 1.1 have no pointer typedefs, so their types are taken from the
+ * declarations. All required functions are part of OpenGL 3.3, the others are optional,
+ * and are null if the context doesn't provide them.
+ */
+#define CENTURION_DETAIL_GL_FUNCTIONS(X)                                                \
+  X(decltype(&glClear), clear, glClear, true)                                           \
+  X(decltype(&glClearColor), clear_color, glClearColor, true)                           \
+  X(decltype(&glViewport), viewport, glViewport, true)                                  \
+  X(decltype(&glScissor), scissor, glScissor, true)                                     \
+  X(decltype(&glEnable), enable, glEnable, true)                                        \
+  X(decltype(&glDisable), disable, glDisable, true)                                     \
+  X(decltype(&glBlendFunc), blend_func, glBlendFunc, true)                              \
+  X(decltype(&glDrawArrays), draw_arrays, glDrawArrays, true)                           \
+  X(decltype(&glDrawElements), draw_elements, glDrawElements, true)                     \
+  X(decltype(&glGenTextures), gen_textures, glGenTextures, true)                        \
+  X(decltype(&glDeleteTextures), delete_textures, glDeleteTextures, true)               \
+  X(decltype(&glBindTexture), bind_texture, glBindTexture, true)                        \
+  X(decltype(&glTexImage2D), tex_image_2d, glTexImage2D, true)                          \
+  X(decltype(&glTexSubImage2D), tex_sub_image_2d, glTexSubImage2D, true)                \
+  X(decltype(&glTexParameteri), tex_parameter_i, glTexParameteri, true)                 \
+  X(decltype(&glPixelStorei), pixel_store_i, glPixelStorei, true)                       \
+  X(decltype(&glGetError), get_error, glGetError, true)                                 \
+  X(decltype(&glGetIntegerv), get_integer_v, glGetIntegerv, true)                       \
+  X(decltype(&glFlush), flush, glFlush, true)                                           \
+  X(decltype(&glFinish), finish, glFinish, true)                                        \
+  X(PFNGLACTIVETEXTUREPROC, active_texture, glActiveTexture, true)                      \
+  X(PFNGLGENERATEMIPMAPPROC, generate_mipmap, glGenerateMipmap, true)                   \
+  X(PFNGLGENBUFFERSPROC, gen_buffers, glGenBuffers, true)                               \
+  X(PFNGLDELETEBUFFERSPROC, delete_buffers, glDeleteBuffers, true)                      \
+  X(PFNGLBINDBUFFERPROC, bind_buffer, glBindBuffer, true)                               \
+  X(PFNGLBUFFERDATAPROC, buffer_data, glBufferData, true)                               \
+  X(PFNGLBUFFERSUBDATAPROC, buffer_sub_data, glBufferSubData, true)                     \
+  X(PFNGLMAPBUFFERRANGEPROC, map_buffer_range, glMapBufferRange, true)                  \
+  X(PFNGLUNMAPBUFFERPROC, unmap_buffer, glUnmapBuffer, true)                            \
+  X(PFNGLGENVERTEXARRAYSPROC, gen_vertex_arrays, glGenVertexArrays, true)               \
+  X(PFNGLDELETEVERTEXARRAYSPROC, delete_vertex_arrays, glDeleteVertexArrays, true)      \
+  X(PFNGLBINDVERTEXARRAYPROC, bind_vertex_array, glBindVertexArray, true)               \
+  X(PFNGLENABLEVERTEXATTRIBARRAYPROC, enable_vertex_attrib_array,                       \
+    glEnableVertexAttribArray, true)                                                    \
+  X(PFNGLDISABLEVERTEXATTRIBARRAYPROC, disable_vertex_attrib_array,                     \
+    glDisableVertexAttribArray, true)                                                   \
+  X(PFNGLVERTEXATTRIBPOINTERPROC, vertex_attrib_pointer, glVertexAttribPointer, true)   \
+  X(PFNGLVERTEXATTRIBDIVISORPROC, vertex_attrib_divisor, glVertexAttribDivisor, true)   \
+  X(PFNGLDRAWARRAYSINSTANCEDPROC, draw_arrays_instanced, glDrawArraysInstanced, true)   \
+  X(PFNGLDRAWELEMENTSINSTANCEDPROC, draw_elements_instanced,                            \
+    glDrawElementsInstanced, true)                                                      \
+  X(PFNGLCREATESHADERPROC, create_shader, glCreateShader, true)                         \
+  X(PFNGLDELETESHADERPROC, delete_shader, glDeleteShader, true)                         \
+  X(PFNGLSHADERSOURCEPROC, shader_source, glShaderSource, true)                         \
+  X(PFNGLCOMPILESHADERPROC, compile_shader, glCompileShader, true)                      \
+  X(PFNGLGETSHADERIVPROC, get_shader_iv, glGetShaderiv, true)                           \
+  X(PFNGLGETSHADERINFOLOGPROC, get_shader_info_log, glGetShaderInfoLog, true)           \
+  X(PFNGLCREATEPROGRAMPROC, create_program, glCreateProgram, true)                      \
+  X(PFNGLDELETEPROGRAMPROC, delete_program, glDeleteProgram, true)                      \
+  X(PFNGLATTACHSHADERPROC, attach_shader, glAttachShader, true)                         \
+  X(PFNGLDETACHSHADERPROC, detach_shader, glDetachShader, true)                         \
+  X(PFNGLLINKPROGRAMPROC, link_program, glLinkProgram, true)                            \
+  X(PFNGLGETPROGRAMIVPROC, get_program_iv, glGetProgramiv, true)                        \
+  X(PFNGLGETPROGRAMINFOLOGPROC, get_program_info_log, glGetProgramInfoLog, true)        \
+  X(PFNGLUSEPROGRAMPROC, use_program, glUseProgram, true)                               \
+  X(PFNGLGETUNIFORMLOCATIONPROC, get_uniform_location, glGetUniformLocation, true)      \
+  X(PFNGLUNIFORM1IPROC, uniform_1i, glUniform1i, true)                                  \
+  X(PFNGLUNIFORM1FPROC, uniform_1f, glUniform1f, true)                                  \
+  X(PFNGLUNIFORM2FPROC, uniform_2f, glUniform2f, true)                                  \
+  X(PFNGLUNIFORM4FPROC, uniform_4f, glUniform4f, true)                                  \
+  X(PFNGLUNIFORMMATRIX4FVPROC, uniform_matrix_4fv, glUniformMatrix4fv, true)            \
+  X(PFNGLGENFRAMEBUFFERSPROC, gen_framebuffers, glGenFramebuffers, true)                \
+  X(PFNGLDELETEFRAMEBUFFERSPROC, delete_framebuffers, glDeleteFramebuffers, true)       \
+  X(PFNGLBINDFRAMEBUFFERPROC, bind_framebuffer, glBindFramebuffer, true)                \
+  X(PFNGLFRAMEBUFFERTEXTURE2DPROC, framebuffer_texture_2d,                              \
+    glFramebufferTexture2D, true)                                                       \
+  X(PFNGLCHECKFRAMEBUFFERSTATUSPROC, check_framebuffer_status,                          \
+    glCheckFramebufferStatus, true)                                                     \
+  X(PFNGLBLITFRAMEBUFFERPROC, blit_framebuffer, glBlitFramebuffer, true)                \
+  X(PFNGLFENCESYNCPROC, fence_sync, glFenceSync, true)                                  \
+  X(PFNGLCLIENTWAITSYNCPROC, client_wait_sync, glClientWaitSync, true)                  \
+  X(PFNGLDELETESYNCPROC, delete_sync, glDeleteSync, true)                               \
+  X(PFNGLTEXSTORAGE2DPROC, tex_storage_2d, glTexStorage2D, false)                       \
+  X(PFNGLDEBUGMESSAGECALLBACKPROC, debug_message_callback,                              \
+    glDebugMessageCallback, false)                                                      \
+  X(PFNGLBUFFERSTORAGEPROC, buffer_storage, glBufferStorage, false)
+
+// clang-format on
+
+/// \endcond
+
+namespace cen::gl {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class function_table
+ *
+ * \brief A flat table of OpenGL function pointers, resolved once per context.
+ *
+ * \details Looking up functions by name is slow, since every lookup is a string search
+ * in the driver. This table resolves all of its entry points at once, which should be
+ * done right after a context has been created, and the pointers are then used directly,
+ * without an extension loader such as GLEW.
+ * \code{cpp}
+ *   const cen::gl::context context{window};
+ *
+ *   const auto gl = cen::gl::function_table::load();
+ *   if (!gl.is_complete())
+ *   {
+ *     for (const auto* name : gl.missing()) {
+ *       cen::log::error("Missing OpenGL function: %s", name);
+ *     }
+ *   }
+ *
+ *   GLuint buffer{};
+ *   gl.gen_buffers(1, &buffer);
+ * \endcode
+ *
+ * \details The table contains the OpenGL 3.3 functions that are commonly used for
+ * rendering, which are required, along with a few optional functions from later
+ * versions, i.e. `tex_storage_2d`, `debug_message_callback` and `buffer_storage`.
+ * Optional functions are null if they aren't supported, and must be checked before
+ * they're used.
+ *
+ * \note The function pointers are only guaranteed to be valid for the context that was
+ * current when the table was loaded, and for other contexts with the same pixel format,
+ * so applications with several kinds of contexts need one table per context.
+ *
+ * \see `gl_library::address_of()`
+ *
+ * \since 6.1.0
+ */
+class function_table final
+{
+ public:
+  /// \cond FALSE
+#define CENTURION_DETAIL_GL_MEMBER(type, member, name, required) type member{};
+  CENTURION_DETAIL_GL_FUNCTIONS(CENTURION_DETAIL_GL_MEMBER)
+#undef CENTURION_DETAIL_GL_MEMBER
+  /// \endcond
+
+  /**
+   * \brief Resolves the functions of the current OpenGL context.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \return a function table, which might be incomplete.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto load() noexcept -> function_table
+  {
+    return load_with([](const czstring name) { return SDL_GL_GetProcAddress(name); });
+  }
+
+  /**
+   * \brief Resolves the functions of the current OpenGL context with a loaded library.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \param library the OpenGL library that the functions are resolved with.
+   *
+   * \return a function table, which might be incomplete.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto load(const gl_library& library) noexcept -> function_table
+  {
+    return load_with([&](const czstring name) { return library.address_of(name); });
+  }
+
+  /**
+   * \brief Resolves the functions of the current context, and checks that it's complete.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \return a function table with all of the required functions.
+   *
+   * \throws cen_error if any required function is missing.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto load_required() -> function_table
+  {
+    auto table = load();
+    if (!table.is_complete())
+    {
+      throw cen_error{"The OpenGL context lacks required functions!"};
+    }
+
+    return table;
+  }
+
+  /**
+   * \brief Indicates whether or not all of the required functions were resolved.
+   *
+   * \return `true` if no required function is missing; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_complete() const noexcept -> bool
+  {
+#define CENTURION_DETAIL_GL_CHECK(type, member, name, required) \
+  if (required && !member)                                      \
+  {                                                             \
+    return false;                                               \
+  }
+    CENTURION_DETAIL_GL_FUNCTIONS(CENTURION_DETAIL_GL_CHECK)
+#undef CENTURION_DETAIL_GL_CHECK
+
+    return true;
+  }
+
+  /**
+   * \brief Returns the names of the required functions that couldn't be resolved.
+   *
+   * \return the names of the missing functions, e.g. "glGenVertexArrays".
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto missing() const -> std::vector<czstring>
+  {
+    std::vector<czstring> names;
+
+#define CENTURION_DETAIL_GL_MISSING(type, member, name, required) \
+  if (required && !member)                                        \
+  {                                                               \
+    names.push_back(#name);                                       \
+  }
+    CENTURION_DETAIL_GL_FUNCTIONS(CENTURION_DETAIL_GL_MISSING)
+#undef CENTURION_DETAIL_GL_MISSING
+
+    return names;
+  }
+
+  /**
+   * \brief Returns the amount of resolved functions, including optional functions.
+   *
+   * \return the amount of non-null function pointers.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto loaded_count() const noexcept -> std::size_t
+  {
+    std::size_t count = 0;
+
+#define CENTURION_DETAIL_GL_COUNT(type, member, name, required) \
+  count += member ? 1u : 0u;
+    CENTURION_DETAIL_GL_FUNCTIONS(CENTURION_DETAIL_GL_COUNT)
+#undef CENTURION_DETAIL_GL_COUNT
+
+    return count;
+  }
+
+ private:
+  template <typename Loader>
+  [[nodiscard]] static auto load_with(Loader&& loader) noexcept -> function_table
+  {
+    function_table table;
+
+#define CENTURION_DETAIL_GL_LOAD(type, member, name, required) \
+  table.member = reinterpret_cast<type>(loader(#name));
+    CENTURION_DETAIL_GL_FUNCTIONS(CENTURION_DETAIL_GL_LOAD)
+#undef CENTURION_DETAIL_GL_LOAD
+
+    return table;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen::gl
+
+#undef CENTURION_DETAIL_GL_FUNCTIONS
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_FUNCTION_TABLE_HEADER
@@ -0,0 +1,380 @@
+#ifndef CENTURION_GL_GPU_PROFILER_HEADER
+#define CENTURION_GL_GPU_PROFILER_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "../../core/czstring.hpp"
+#include "../../core/exception.hpp"
+#include "../../core/integers.hpp"
+#include "../../detail/gl_functions.hpp"
+#include "../../system/counter.hpp"
+#include "../../system/profiler.hpp"
+
+/// \addtogroup video
+/// \{
+
+namespace cen::gl {
+
+/**
+ * \class gpu_profiler
+ *
+ * \brief Measures the GPU time of scopes with timer queries, without stalling the CPU.
+ *
+ * \details Every scope issues a `GL_TIME_ELAPSED` query, which is resolved by the GPU
+ * once it has executed the enclosed commands. The queries of each frame are kept in a
+ * ring, and are only read `delay()` frames later, by which point the results are almost
+ * always available, so reading them doesn't wait for the GPU. If the results of a frame
+ * still aren't available, the frame is dropped instead.
+ * \code{cpp}
+ *   cen::gl::gpu_profiler gpu;
+ *
+ *   {
+ *     cen::gl::gpu_profile_scope scope{gpu, "scene"};
+ *     // ...
+ *   }
+ *
+ *   // Every frame, after the last scope
+ *   exporter.submit(cen::profiler::end_frame());
+ *   exporter.submit(gpu.end_frame());
+ * \endcode
+ *
+ * \details The results are provided as a `profile_thread` with the identifier
+ * `gpu_thread_id`, which is what makes them show up as a separate track next to the
+ * CPU threads in a `chrome_trace_exporter` trace. Each scope starts at the CPU time when
+ * it was entered, and lasts for the measured GPU time, so the durations are exact, but
+ * the GPU work usually happens somewhat later than it's shown.
+ *
+ * \note `GL_TIME_ELAPSED` queries can't be nested, so scopes that are entered while
+ * another scope is active are ignored, see `skipped_scopes()`.
+ *
+ * \note The profiler must be created, used and destroyed while the same context, or a
+ * context in its share group, is current.
+ *
+ * \see `chrome_trace_exporter`
+ *
+ * \since 6.1.0
+ */
+class gpu_profiler final
+{
+ public:
+  /// The thread identifier of the profile frames returned by `end_frame()`.
+  inline constexpr static SDL_threadID gpu_thread_id = static_cast<SDL_threadID>(-1);
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates the timer queries of the ring.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \param delay the amount of frames between recording and reading a frame, at least
+   * one.
+   * \param maxScopes the maximum amount of scopes per frame, at least one.
+   *
+   * \throws cen_error if the timer query functions can't be loaded, i.e. if the context
+   * doesn't support OpenGL 3.3 or `GL_ARB_timer_query`.
+   *
+   * \since 6.1.0
+   */
+  explicit gpu_profiler(const std::size_t delay = 3, const std::size_t maxScopes = 64)
+      : m_maxScopes{(maxScopes > 0) ? maxScopes : 1u}
+  {
+    if (!m_functions.is_complete())
+    {
+      throw cen_error{"Failed to load the OpenGL timer query functions!"};
+    }
+
+    m_frames.resize(((delay > 0) ? delay : 1u) + 1u);
+    m_queries.resize(m_frames.size() * m_maxScopes);
+
+    m_functions.genQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data());
+    for (auto& frame : m_frames)
+    {
+      frame.reserve(m_maxScopes);
+    }
+
+    m_result.id = gpu_thread_id;
+  }
+
+  gpu_profiler(const gpu_profiler&) = delete;
+
+  auto operator=(const gpu_profiler&) -> gpu_profiler& = delete;
+
+  /**
+   * \brief Deletes the timer queries.
+   *
+   * \since 6.1.0
+   */
+  ~gpu_profiler() noexcept
+  {
+    if (m_active)
+    {
+      m_functions.endQuery(GL_TIME_ELAPSED);
+    }
+
+    m_functions.deleteQueries(static_cast<GLsizei>(m_queries.size()), m_queries.data());
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Starts measuring a scope.
+   *
+   * \details Prefer `gpu_profile_scope` over calling this function directly.
+   *
+   * \param name the name of the scope, which must outlive the results of the frame,
+   * e.g. a string literal.
+   *
+   * \return `true` if the scope is measured, in which case `end()` must be called;
+   * `false` if another scope is active, or if the frame has no queries left.
+   *
+   * \since 6.1.0
+   */
+  auto begin(const czstring name) noexcept -> bool
+  {
+    auto& frame = m_frames[m_current];
+    if (m_active || frame.size() == m_maxScopes)
+    {
+      ++m_skipped;
+      return false;
+    }
+
+    const auto query = m_queries[m_current * m_maxScopes + frame.size()];
+    frame.push_back(scope_record{name, counter::monotonic().count(), query});
+
+    m_functions.beginQuery(GL_TIME_ELAPSED, query);
+    m_active = true;
+
+    return true;
+  }
+
+  /**
+   * \brief Stops measuring the active scope.
+   *
+   * \since 6.1.0
+   */
+  void end() noexcept
+  {
+    if (m_active)
+    {
+      m_functions.endQuery(GL_TIME_ELAPSED);
+      m_active = false;
+    }
+  }
+
+  /**
+   * \brief Finishes the current frame, and reads the results of the oldest frame.
+   *
+   * \details The returned events describe the frame that was recorded `delay()` frames
+   * ago, and are empty until that many frames have been recorded, or if the results of
+   * the frame weren't available yet.
+   *
+   * \return the measured scopes, which stay valid until the next call.
+   *
+   * \since 6.1.0
+   */
+  auto end_frame() -> const profile_thread&
+  {
+    end();
+
+    ++m_frameCount;
+    m_current = (m_current + 1u) % m_frames.size();
+
+    // Once the ring is full, the next frame is the oldest one
+    auto& oldest = m_frames[m_current];
+    read(oldest);
+    oldest.clear();
+
+    return m_result;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of frames between recording a frame and reading it.
+   *
+   * \return the delay, in frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto delay() const noexcept -> std::size_t
+  {
+    return m_frames.size() - 1u;
+  }
+
+  /**
+   * \brief Returns the maximum amount of scopes that are measured in a frame.
+   *
+   * \return the amount of queries per frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto max_scopes() const noexcept -> std::size_t
+  {
+    return m_maxScopes;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been finished.
+   *
+   * \return the amount of `end_frame()` calls.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> u64
+  {
+    return m_frameCount;
+  }
+
+  /**
+   * \brief Returns the amount of frames whose results weren't available in time.
+   *
+   * \return the amount of dropped frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dropped_frames() const noexcept -> u64
+  {
+    return m_dropped;
+  }
+
+  /**
+   * \brief Returns the amount of scopes that weren't measured.
+   *
+   * \details Scopes are skipped if they are nested in another scope, or if the frame
+   * has more than `max_scopes()` scopes.
+   *
+   * \return the amount of skipped scopes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto skipped_scopes() const noexcept -> u64
+  {
+    return m_skipped;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct query_functions final
+  {
+    PFNGLGENQUERIESPROC genQueries{
+        detail::load_gl_function<PFNGLGENQUERIESPROC>("glGenQueries")};
+    PFNGLDELETEQUERIESPROC deleteQueries{
+        detail::load_gl_function<PFNGLDELETEQUERIESPROC>("glDeleteQueries")};
+    PFNGLBEGINQUERYPROC beginQuery{
+        detail::load_gl_function<PFNGLBEGINQUERYPROC>("glBeginQuery")};
+    PFNGLENDQUERYPROC endQuery{
+        detail::load_gl_function<PFNGLENDQUERYPROC>("glEndQuery")};
+    PFNGLGETQUERYOBJECTIVPROC getQueryObjectiv{
+        detail::load_gl_function<PFNGLGETQUERYOBJECTIVPROC>("glGetQueryObjectiv")};
+    PFNGLGETQUERYOBJECTUI64VPROC getQueryObjectui64v{
+        detail::load_gl_function<PFNGLGETQUERYOBJECTUI64VPROC>("glGetQueryObjectui64v")};
+
+    [[nodiscard]] auto is_complete() const noexcept -> bool
+    {
+      return genQueries && deleteQueries && beginQuery && endQuery && getQueryObjectiv &&
+             getQueryObjectui64v;
+    }
+  };
+
+  struct scope_record final
+  {
+    czstring name{};
+    u64 begin{};  // CPU time, in nanoseconds
+    GLuint query{};
+  };
+
+  query_functions m_functions;
+  std::vector<GLuint> m_queries;  // max_scopes() queries for every frame of the ring
+  std::vector<std::vector<scope_record>> m_frames;
+  profile_thread m_result;
+  std::size_t m_maxScopes{};
+  std::size_t m_current{};
+  u64 m_frameCount{};
+  u64 m_dropped{};
+  u64 m_skipped{};
+  bool m_active{};
+
+  void read(const std::vector<scope_record>& frame)
+  {
+    m_result.events.clear();
+    if (frame.empty())
+    {
+      return;
+    }
+
+    // Queries complete in order, so the whole frame is available if its last query is
+    GLint available{};
+    const auto last = frame.back().query;
+    m_functions.getQueryObjectiv(last, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (available == GL_FALSE)
+    {
+      ++m_dropped;
+      return;
+    }
+
+    for (const auto& scope : frame)
+    {
+      GLuint64 elapsed{};
+      m_functions.getQueryObjectui64v(scope.query, GL_QUERY_RESULT, &elapsed);
+
+      m_result.events.push_back({scope.name, scope.begin, profile_event_type::begin});
+      m_result.events.push_back(
+          {scope.name, scope.begin + static_cast<u64>(elapsed), profile_event_type::end});
+    }
+  }
+};
+
+/**
+ * \class gpu_profile_scope
+ *
+ * \brief Measures the GPU time of the enclosing scope with a `gpu_profiler`.
+ *
+ * \since 6.1.0
+ */
+class gpu_profile_scope final
+{
+ public:
+  /**
+   * \brief Starts measuring a scope.
+   *
+   * \param profiler the profiler that will measure the scope.
+   * \param name the name of the scope, e.g. a string literal.
+   *
+   * \since 6.1.0
+   */
+  gpu_profile_scope(gpu_profiler& profiler, const czstring name) noexcept
+      : m_profiler{profiler.begin(name) ? &profiler : nullptr}
+  {}
+
+  gpu_profile_scope(const gpu_profile_scope&) = delete;
+
+  auto operator=(const gpu_profile_scope&) -> gpu_profile_scope& = delete;
+
+  ~gpu_profile_scope() noexcept
+  {
+    if (m_profiler)
+    {
+      m_profiler->end();
+    }
+  }
+
+ private:
+  gpu_profiler* m_profiler{};
+};
+
+}  // namespace cen::gl
+
+/// \} End of group video
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_GPU_PROFILER_HEADER
@@ -0,0 +1,828 @@
+#ifndef CENTURION_GL_POST_CHAIN_HEADER
+#define CENTURION_GL_POST_CHAIN_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <algorithm>  // clamp, max
+#include <cmath>      // lround
+#include <cstddef>    // size_t
+#include <memory>     // unique_ptr, make_unique
+#include <string>     // string, to_string
+#include <utility>    // move
+#include <vector>     // vector
+
+#include "../../core/exception.hpp"
+#include "../../core/result.hpp"
+#include "../../math/area.hpp"
+#include "gl_function_table.hpp"
+
+/// \addtogroup video
+/// \{
+
+namespace cen::gl {
+
+/**
+ * \enum post_pass_kind
+ *
+ * \brief Describes how a post-processing pass reads its input.
+ *
+ * \see `post_pass`
+ *
+ * \since 6.1.0
+ */
+enum class post_pass_kind
+{
+  pixel,   ///< Only transforms the color of each pixel, e.g. tonemapping or grading.
+  sampled  ///< Samples the input freely, e.g. blurs, bloom or FXAA.
+};
+
+/**
+ * \struct post_pass
+ *
+ * \brief Describes a single fullscreen pass of a `post_chain`.
+ *
+ * \details The source of a pass is GLSL 3.30 code, which is compiled after a prelude
+ * that declares the following.
+ * \code{glsl}
+ *   in vec2 v_uv;               // The texture coordinates of the pixel
+ *   out vec4 o_color;           // The output color
+ *   uniform sampler2D u_source; // The output of the previous pass, or the scene
+ *   uniform sampler2D u_scene;  // The scene, e.g. for compositing bloom
+ *   uniform vec2 u_texel;       // The size of a texel of u_source
+ * \endcode
+ *
+ * \details The source of a sampled pass is a complete fragment shader, i.e. it defines
+ * `main()`. The source of a pixel pass is the body of a function with the signature
+ * `vec4 f(vec4 color, vec2 uv)`, which returns the transformed color. Consecutive pixel
+ * passes are fused into a single shader, so they cost a single fullscreen draw.
+ * \code{cpp}
+ *   const cen::gl::post_pass tonemap{"tonemap",
+ *                                    "return vec4(color.rgb / (color.rgb + 1.0), 1.0);",
+ *                                    cen::gl::post_pass_kind::pixel};
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+struct post_pass final
+{
+  std::string name;                              ///< Used in error messages.
+  std::string source;                            ///< The GLSL source, see above.
+  post_pass_kind kind{post_pass_kind::sampled};  ///< How the input is read.
+  float scale{1.0f};  ///< The output size relative to the scene, e.g. 0.5 for half-res.
+};
+
+}  // namespace cen::gl
+
+/// \cond FALSE
+namespace cen::detail {
+
+// A fullscreen draw, which runs either a single sampled pass or several pixel passes
+struct post_stage_plan final
+{
+  std::size_t first{};  // The index of the first pass
+  std::size_t count{};  // The amount of consecutive passes, more than one if fused
+  float scale{1.0f};    // The size of the output relative to the scene
+};
+
+[[nodiscard]] inline auto plan_post_stages(const std::vector<gl::post_pass>& passes)
+    -> std::vector<post_stage_plan>
+{
+  std::vector<post_stage_plan> stages;
+
+  // Pixel passes don't resample, so they keep the size of their input
+  float inputScale = 1.0f;
+
+  for (std::size_t index = 0; index < passes.size(); ++index)
+  {
+    const auto& pass = passes[index];
+    if (pass.kind == gl::post_pass_kind::pixel)
+    {
+      if (!stages.empty())
+      {
+        auto& previous = stages.back();
+        if (passes[previous.first].kind == gl::post_pass_kind::pixel)
+        {
+          ++previous.count;
+          continue;
+        }
+      }
+
+      stages.push_back(post_stage_plan{index, 1, inputScale});
+    }
+    else
+    {
+      inputScale = (pass.scale > 0) ? pass.scale : 1.0f;
+      stages.push_back(post_stage_plan{index, 1, inputScale});
+    }
+  }
+
+  return stages;
+}
+
+inline constexpr auto post_vertex_source =
+    "#version 330 core\n"
+    "out vec2 v_uv;\n"
+    "void main() {\n"
+    "  vec2 p = vec2(float((gl_VertexID << 1) & 2), float(gl_VertexID & 2));\n"
+    "  v_uv = p;\n"
+    "  gl_Position = vec4(p * 2.0 - 1.0, 0.0, 1.0);\n"
+    "}\n";
+
+inline constexpr auto post_fragment_prelude =
+    "#version 330 core\n"
+    "in vec2 v_uv;\n"
+    "out vec4 o_color;\n"
+    "uniform sampler2D u_source;\n"
+    "uniform sampler2D u_scene;\n"
+    "uniform vec2 u_texel;\n";
+
+[[nodiscard]] inline auto make_post_fragment(const std::vector<gl::post_pass>& passes,
+                                             const post_stage_plan& stage) -> std::string
+{
+  std::string source{post_fragment_prelude};
+
+  const auto& first = passes[stage.first];
+  if (first.kind == gl::post_pass_kind::sampled)
+  {
+    source += first.source;
+    source += '\n';
+    return source;
+  }
+
+  for (std::size_t i = 0; i < stage.count; ++i)
+  {
+    source += "vec4 post_pass_" + std::to_string(i) + "(vec4 color, vec2 uv) {\n";
+    source += passes[stage.first + i].source;
+    source += "\n}\n";
+  }
+
+  source += "void main() {\n  vec4 color = texture(u_source, v_uv);\n";
+  for (std::size_t i = 0; i < stage.count; ++i)
+  {
+    source += "  color = post_pass_" + std::to_string(i) + "(color, v_uv);\n";
+  }
+
+  source += "  o_color = color;\n}\n";
+  return source;
+}
+
+[[nodiscard]] inline auto scaled_post_size(const iarea size, const float scale) noexcept
+    -> iarea
+{
+  const auto scaled = [scale](const int value) {
+    const auto result = std::lround(static_cast<float>(value) * scale);
+    return (std::max)(static_cast<int>(result), 1);
+  };
+
+  return {scaled(size.width), scaled(size.height)};
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen::gl {
+
+/**
+ * \class post_chain
+ *
+ * \brief Runs a chain of fullscreen post-processing passes, such as bloom, tonemapping
+ * and FXAA, on the OpenGL backend.
+ *
+ * \details The scene is rendered into an offscreen framebuffer, which is bound by
+ * `begin_scene()`. `apply()` then runs the passes, where each pass reads the output of
+ * the previous pass, and the last pass writes to the output framebuffer, at the output
+ * size. The intermediate framebuffers are leased from a pool, keyed by their size, so
+ * passes ping-pong between a few framebuffers, and downsampled passes such as bloom
+ * blurs use smaller framebuffers. Consecutive pixel passes are fused into one shader.
+ * \code{cpp}
+ *   cen::gl::post_chain chain{window.size()};
+ *   chain.add({"bright", brightSource, cen::gl::post_pass_kind::sampled, 0.5f});
+ *   chain.add({"blur", blurSource, cen::gl::post_pass_kind::sampled, 0.5f});
+ *   chain.add({"composite", compositeSource});
+ *   chain.add({"tonemap", tonemapSource, cen::gl::post_pass_kind::pixel});
+ *   chain.add({"fxaa", fxaaSource});
+ *   chain.build();
+ *
+ *   // Every frame
+ *   chain.set_resolution_scale(resolution.scale());
+ *   chain.begin_scene();
+ *   draw_scene(chain.scene_size());
+ *   chain.apply();
+ *   cen::gl::swap(window);
+ * \endcode
+ *
+ * \details The scene is rendered at the output size multiplied by the resolution scale,
+ * and the scales of the passes are relative to the scene, which is what makes the chain
+ * work with dynamic resolution. The last pass always upscales to the output size.
+ *
+ * \note The chain leaves the output framebuffer bound, and resets the bound program,
+ * vertex array and textures. It must be created, used and destroyed while the same
+ * context, or a context in its share group, is current.
+ *
+ * \see `dynamic_resolution`
+ *
+ * \since 6.1.0
+ */
+class post_chain final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// The smallest allowed resolution scale.
+  inline constexpr static float min_resolution_scale = 0.1f;
+
+  /// The largest allowed resolution scale, i.e. supersampling.
+  inline constexpr static float max_resolution_scale = 2.0f;
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates an empty chain.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \param outputSize the size of the output framebuffer, usually the window size.
+   * \param format the internal format of the framebuffers, e.g. `GL_RGBA16F` for HDR.
+   *
+   * \throws cen_error if the output size isn't positive, or if the context lacks
+   * required functions.
+   *
+   * \since 6.1.0
+   */
+  explicit post_chain(const iarea outputSize, const GLenum format = GL_RGBA16F)
+      : m_gl{function_table::load_required()}
+      , m_output{outputSize}
+      , m_format{format}
+  {
+    if (m_output.width <= 0 || m_output.height <= 0)
+    {
+      throw cen_error{"The output of a post-processing chain must have a positive size!"};
+    }
+
+    m_gl.gen_vertex_arrays(1, &m_vertexArray);
+  }
+
+  post_chain(const post_chain&) = delete;
+
+  auto operator=(const post_chain&) -> post_chain& = delete;
+
+  /**
+   * \brief Deletes the shaders and framebuffers.
+   *
+   * \since 6.1.0
+   */
+  ~post_chain() noexcept
+  {
+    release_programs();
+
+    for (const auto& target : m_targets)
+    {
+      delete_target(*target);
+    }
+
+    m_gl.delete_vertex_arrays(1, &m_vertexArray);
+  }
+
+  /// \} End of construction/destruction
+
+  /// \name Setup
+  /// \{
+
+  /**
+   * \brief Adds a pass to the end of the chain.
+   *
+   * \details The chain must be rebuilt before it's applied again.
+   *
+   * \param pass the pass that will be added.
+   *
+   * \since 6.1.0
+   */
+  void add(post_pass pass)
+  {
+    m_passes.push_back(std::move(pass));
+    release_programs();
+  }
+
+  /**
+   * \brief Removes all passes.
+   *
+   * \details An empty chain copies the scene to the output, which is still scaled.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_passes.clear();
+    release_programs();
+    m_built = true;
+  }
+
+  /**
+   * \brief Fuses the passes into stages, and compiles their shaders.
+   *
+   * \throws cen_error if a shader can't be compiled or linked, see `log()`.
+   *
+   * \since 6.1.0
+   */
+  void build()
+  {
+    release_programs();
+
+    const auto vertex = compile(GL_VERTEX_SHADER, detail::post_vertex_source, "vertex");
+
+    try
+    {
+      for (const auto& plan : detail::plan_post_stages(m_passes))
+      {
+        const auto source = detail::make_post_fragment(m_passes, plan);
+        const auto fragment =
+            compile(GL_FRAGMENT_SHADER, source.c_str(), m_passes[plan.first].name);
+
+        auto& stage = m_stages.emplace_back();
+        stage.plan = plan;
+        stage.program = link(vertex, fragment, m_passes[plan.first].name);
+        stage.source = m_gl.get_uniform_location(stage.program, "u_source");
+        stage.scene = m_gl.get_uniform_location(stage.program, "u_scene");
+        stage.texel = m_gl.get_uniform_location(stage.program, "u_texel");
+      }
+    }
+    catch (...)
+    {
+      m_gl.delete_shader(vertex);
+      release_programs();
+      throw;
+    }
+
+    m_gl.delete_shader(vertex);
+    m_built = true;
+  }
+
+  /**
+   * \brief Sets the size of the output framebuffer, e.g. when the window is resized.
+   *
+   * \param size the new output size, ignored unless it's positive.
+   *
+   * \since 6.1.0
+   */
+  void set_output_size(const iarea size) noexcept
+  {
+    if (size.width > 0 && size.height > 0)
+    {
+      m_output = size;
+    }
+  }
+
+  /**
+   * \brief Sets the scale of the scene resolution relative to the output size.
+   *
+   * \details This is intended to be driven by `dynamic_resolution::scale()`. The
+   * framebuffers of previously used scales are kept in the pool, see `trim()`.
+   *
+   * \param scale the resolution scale, which is clamped to `[min_resolution_scale,
+   * max_resolution_scale]`.
+   *
+   * \since 6.1.0
+   */
+  void set_resolution_scale(const float scale) noexcept
+  {
+    m_scale = std::clamp(scale, min_resolution_scale, max_resolution_scale);
+  }
+
+  /// \} End of setup
+
+  /// \name Rendering
+  /// \{
+
+  /**
+   * \brief Binds the scene framebuffer and sets the viewport to the scene size.
+   *
+   * \return `success` if the scene framebuffer is bound; `failure` if it couldn't be
+   * created, or if the previous scene hasn't been applied.
+   *
+   * \since 6.1.0
+   */
+  auto begin_scene() -> result
+  {
+    if (m_scene)
+    {
+      return failure;
+    }
+
+    m_scene = acquire(scene_size());
+    if (!m_scene)
+    {
+      return failure;
+    }
+
+    bind(*m_scene);
+    return success;
+  }
+
+  /**
+   * \brief Runs the passes, and writes the result to the output framebuffer.
+   *
+   * \param framebuffer the output framebuffer, 0 for the default framebuffer.
+   *
+   * \return `success` if the passes were run; `failure` if there is no scene, if the
+   * chain hasn't been built, or if an intermediate framebuffer couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  auto apply(const GLuint framebuffer = 0) -> result
+  {
+    if (!m_scene)
+    {
+      return failure;
+    }
+
+    auto ok = m_built;
+    if (ok && m_stages.empty())
+    {
+      blit(*m_scene, framebuffer);
+    }
+    else if (ok)
+    {
+      ok = run_stages(framebuffer);
+    }
+
+    m_scene->busy = false;
+    m_scene = nullptr;
+
+    m_gl.use_program(0);
+    m_gl.bind_vertex_array(0);
+    m_gl.active_texture(GL_TEXTURE1);
+    m_gl.bind_texture(GL_TEXTURE_2D, 0);
+    m_gl.active_texture(GL_TEXTURE0);
+    m_gl.bind_texture(GL_TEXTURE_2D, 0);
+
+    return ok;
+  }
+
+  /**
+   * \brief Deletes all pooled framebuffers that aren't in use.
+   *
+   * \details This should be called after the output size changed, since the
+   * framebuffers of the previous size are never used again.
+   *
+   * \since 6.1.0
+   */
+  void trim() noexcept
+  {
+    auto it = m_targets.begin();
+    while (it != m_targets.end())
+    {
+      if (!(*it)->busy)
+      {
+        delete_target(**it);
+        it = m_targets.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  /// \} End of rendering
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the size that the scene is rendered at.
+   *
+   * \return the output size multiplied by the resolution scale.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto scene_size() const noexcept -> iarea
+  {
+    return detail::scaled_post_size(m_output, m_scale);
+  }
+
+  [[nodiscard]] auto output_size() const noexcept -> iarea
+  {
+    return m_output;
+  }
+
+  [[nodiscard]] auto resolution_scale() const noexcept -> float
+  {
+    return m_scale;
+  }
+
+  /**
+   * \brief Returns the texture of the scene framebuffer.
+   *
+   * \return the scene texture; 0 outside of `begin_scene()` and `apply()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto scene_texture() const noexcept -> GLuint
+  {
+    return m_scene ? m_scene->texture : 0;
+  }
+
+  [[nodiscard]] auto pass_count() const noexcept -> size_type
+  {
+    return m_passes.size();
+  }
+
+  /**
+   * \brief Returns the amount of fullscreen draws per frame, after fusing passes.
+   *
+   * \return the amount of compiled stages; zero if the chain hasn't been built.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto stage_count() const noexcept -> size_type
+  {
+    return m_stages.size();
+  }
+
+  /**
+   * \brief Returns the amount of pooled framebuffers, including the scene.
+   *
+   * \return the amount of framebuffers.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto framebuffer_count() const noexcept -> size_type
+  {
+    return m_targets.size();
+  }
+
+  [[nodiscard]] auto is_built() const noexcept -> bool
+  {
+    return m_built;
+  }
+
+  /**
+   * \brief Returns the info log of the shader that failed to build.
+   *
+   * \return the info log, prefixed by the name of the pass; an empty string if the last
+   * build succeeded.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto log() const noexcept -> const std::string&
+  {
+    return m_log;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct render_target final
+  {
+    GLuint framebuffer{};
+    GLuint texture{};
+    iarea size{};
+    bool busy{};
+  };
+
+  struct stage final
+  {
+    detail::post_stage_plan plan;
+    GLuint program{};
+    GLint source{-1};
+    GLint scene{-1};
+    GLint texel{-1};
+  };
+
+  function_table m_gl;
+  std::vector<post_pass> m_passes;
+  std::vector<stage> m_stages;
+  std::vector<std::unique_ptr<render_target>> m_targets;
+  render_target* m_scene{};
+  std::string m_log;
+  iarea m_output;
+  GLenum m_format{};
+  GLuint m_vertexArray{};
+  float m_scale{1.0f};
+  bool m_built{true};
+
+  void release_programs() noexcept
+  {
+    for (const auto& stage : m_stages)
+    {
+      m_gl.delete_program(stage.program);
+    }
+
+    m_stages.clear();
+    m_built = false;
+  }
+
+  [[nodiscard]] auto compile(const GLenum type,
+                             const char* source,
+                             const std::string& name) -> GLuint
+  {
+    const auto shader = m_gl.create_shader(type);
+    m_gl.shader_source(shader, 1, &source, nullptr);
+    m_gl.compile_shader(shader);
+
+    GLint status{};
+    m_gl.get_shader_iv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+      m_log =
+          name + ": " + info_log(shader, m_gl.get_shader_iv, m_gl.get_shader_info_log);
+      m_gl.delete_shader(shader);
+      throw cen_error{"Failed to compile a post-processing shader!"};
+    }
+
+    m_log.clear();
+    return shader;
+  }
+
+  [[nodiscard]] auto link(const GLuint vertex,
+                          const GLuint fragment,
+                          const std::string& name) -> GLuint
+  {
+    const auto program = m_gl.create_program();
+    m_gl.attach_shader(program, vertex);
+    m_gl.attach_shader(program, fragment);
+    m_gl.link_program(program);
+    m_gl.detach_shader(program, vertex);
+    m_gl.detach_shader(program, fragment);
+    m_gl.delete_shader(fragment);
+
+    GLint status{};
+    m_gl.get_program_iv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+      m_log =
+          name + ": " + info_log(program, m_gl.get_program_iv, m_gl.get_program_info_log);
+      m_gl.delete_program(program);
+      throw cen_error{"Failed to link a post-processing shader!"};
+    }
+
+    return program;
+  }
+
+  template <typename Query, typename Log>
+  [[nodiscard]] static auto info_log(const GLuint object, Query query, Log log)
+      -> std::string
+  {
+    GLint length{};
+    query(object, GL_INFO_LOG_LENGTH, &length);
+
+    std::string text(static_cast<std::size_t>((std::max)(length, 1)), '\0');
+    log(object, static_cast<GLsizei>(text.size()), nullptr, text.data());
+
+    text.resize(text.find('\0'));
+    return text;
+  }
+
+  [[nodiscard]] auto acquire(const iarea size) -> render_target*
+  {
+    for (const auto& target : m_targets)
+    {
+      if (!target->busy && target->size == size)
+      {
+        target->busy = true;
+        return target.get();
+      }
+    }
+
+    auto target = std::make_unique<render_target>();
+    target->size = size;
+
+    m_gl.gen_textures(1, &target->texture);
+    m_gl.bind_texture(GL_TEXTURE_2D, target->texture);
+    m_gl.tex_image_2d(GL_TEXTURE_2D,
+                      0,
+                      static_cast<GLint>(m_format),
+                      size.width,
+                      size.height,
+                      0,
+                      GL_RGBA,
+                      GL_UNSIGNED_BYTE,
+                      nullptr);
+    m_gl.tex_parameter_i(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    m_gl.tex_parameter_i(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    m_gl.tex_parameter_i(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    m_gl.tex_parameter_i(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    m_gl.bind_texture(GL_TEXTURE_2D, 0);
+
+    m_gl.gen_framebuffers(1, &target->framebuffer);
+    m_gl.bind_framebuffer(GL_FRAMEBUFFER, target->framebuffer);
+    m_gl.framebuffer_texture_2d(GL_FRAMEBUFFER,
+                                GL_COLOR_ATTACHMENT0,
+                                GL_TEXTURE_2D,
+                                target->texture,
+                                0);
+
+    const auto status = m_gl.check_framebuffer_status(GL_FRAMEBUFFER);
+    m_gl.bind_framebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE)
+    {
+      delete_target(*target);
+      return nullptr;
+    }
+
+    target->busy = true;
+    m_targets.push_back(std::move(target));
+
+    return m_targets.back().get();
+  }
+
+  void delete_target(const render_target& target) noexcept
+  {
+    m_gl.delete_framebuffers(1, &target.framebuffer);
+    m_gl.delete_textures(1, &target.texture);
+  }
+
+  void bind(const render_target& target) noexcept
+  {
+    m_gl.bind_framebuffer(GL_FRAMEBUFFER, target.framebuffer);
+    m_gl.viewport(0, 0, target.size.width, target.size.height);
+  }
+
+  void blit(const render_target& source, const GLuint framebuffer) noexcept
+  {
+    m_gl.bind_framebuffer(GL_READ_FRAMEBUFFER, source.framebuffer);
+    m_gl.bind_framebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);
+    m_gl.blit_framebuffer(0,
+                          0,
+                          source.size.width,
+                          source.size.height,
+                          0,
+                          0,
+                          m_output.width,
+                          m_output.height,
+                          GL_COLOR_BUFFER_BIT,
+                          GL_LINEAR);
+    m_gl.bind_framebuffer(GL_FRAMEBUFFER, framebuffer);
+  }
+
+  auto run_stages(const GLuint framebuffer) -> bool
+  {
+    m_gl.bind_vertex_array(m_vertexArray);
+    m_gl.disable(GL_BLEND);
+
+    // The scene is always bound to the second texture unit
+    m_gl.active_texture(GL_TEXTURE1);
+    m_gl.bind_texture(GL_TEXTURE_2D, m_scene->texture);
+    m_gl.active_texture(GL_TEXTURE0);
+
+    auto* input = m_scene;
+    for (std::size_t index = 0; index < m_stages.size(); ++index)
+    {
+      const auto& current = m_stages[index];
+
+      render_target* output{};
+      if (index + 1u == m_stages.size())
+      {
+        m_gl.bind_framebuffer(GL_FRAMEBUFFER, framebuffer);
+        m_gl.viewport(0, 0, m_output.width, m_output.height);
+      }
+      else
+      {
+        output = acquire(detail::scaled_post_size(scene_size(), current.plan.scale));
+        if (!output)
+        {
+          release(input);
+          return false;
+        }
+
+        bind(*output);
+      }
+
+      m_gl.use_program(current.program);
+      m_gl.uniform_1i(current.source, 0);
+      m_gl.uniform_1i(current.scene, 1);
+      m_gl.uniform_2f(current.texel,
+                      1.0f / static_cast<float>(input->size.width),
+                      1.0f / static_cast<float>(input->size.height));
+
+      m_gl.bind_texture(GL_TEXTURE_2D, input->texture);
+      m_gl.draw_arrays(GL_TRIANGLES, 0, 3);
+
+      release(input);
+      input = output;
+    }
+
+    return true;
+  }
+
+  // Returns an intermediate framebuffer to the pool, the scene is released by apply()
+  void release(render_target* target) noexcept
+  {
+    if (target && target != m_scene)
+    {
+      target->busy = false;
+    }
+  }
+};
+
+}  // namespace cen::gl
+
+/// \} End of group video
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_POST_CHAIN_HEADER
@@ -0,0 +1,342 @@
+#ifndef CENTURION_GL_READBACK_RING_HEADER
+#define CENTURION_GL_READBACK_RING_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <cstddef>  // size_t
+#include <cstring>  // memcpy
+#include <vector>   // vector
+
+#include "../../core/exception.hpp"
+#include "../../core/integers.hpp"
+#include "../../detail/gl_functions.hpp"
+#include "../../math/area.hpp"
+#include "../pixel_format.hpp"
+#include "../surface.hpp"
+
+/// \addtogroup video
+/// \{
+
+namespace cen::gl {
+
+/**
+ * \class readback_ring
+ *
+ * \brief Reads frames back from the GPU asynchronously, with pixel buffer objects.
+ *
+ * \details Reading pixels into client memory makes the CPU wait until the GPU has
+ * rendered the frame. This class instead reads every frame into the next pixel buffer
+ * object of a ring, which returns immediately, since the copy is executed by the GPU
+ * along with the other commands. A fence is inserted after the copy, and the buffer is
+ * mapped a few frames later, by which point the copy has most likely finished.
+ * \code{cpp}
+ *   cen::gl::readback_ring readback{window.size()};
+ *
+ *   // Every frame, after rendering and before swapping
+ *   auto frame = recorder.acquire(readback.size(), readback.format());
+ *   if (readback.capture(frame)) {
+ *     recorder.submit(std::move(frame));
+ *   }
+ *
+ *   cen::gl::swap(window);
+ * \endcode
+ *
+ * \details The pixels are read from the current read framebuffer, which is the back
+ * buffer of the default framebuffer unless another framebuffer is bound. Rows are
+ * flipped while they are copied into the surface, since OpenGL stores the bottom row
+ * first.
+ *
+ * \note The ring must be created, used and destroyed while the same context, or a
+ * context in its share group, is current.
+ *
+ * \see `frame_capture`
+ * \see `frame_recorder`
+ *
+ * \since 6.1.0
+ */
+class readback_ring final
+{
+ public:
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates the pixel buffer objects of the ring.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \param size the size of the captured frames.
+   * \param delay the amount of frames between capturing a frame and reading it, at least
+   * one.
+   *
+   * \throws cen_error if the size isn't positive, or if the buffer functions can't be
+   * loaded.
+   *
+   * \since 6.1.0
+   */
+  explicit readback_ring(const iarea size, const std::size_t delay = 2)
+      : m_size{size}
+  {
+    if (m_size.width <= 0 || m_size.height <= 0)
+    {
+      throw cen_error{"Readback frames must have a positive size!"};
+    }
+
+    if (!m_functions.is_complete())
+    {
+      throw cen_error{"Failed to load the OpenGL pixel buffer functions!"};
+    }
+
+    const auto count = ((delay > 0) ? delay : 1u) + 1u;
+    m_buffers.resize(count);
+    m_fences.resize(count);
+
+    m_functions.genBuffers(static_cast<GLsizei>(count), m_buffers.data());
+    for (const auto buffer : m_buffers)
+    {
+      m_functions.bindBuffer(GL_PIXEL_PACK_BUFFER, buffer);
+      m_functions.bufferData(GL_PIXEL_PACK_BUFFER,
+                             static_cast<GLsizeiptr>(frame_size()),
+                             nullptr,
+                             GL_STREAM_READ);
+    }
+
+    m_functions.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+  }
+
+  readback_ring(const readback_ring&) = delete;
+
+  auto operator=(const readback_ring&) -> readback_ring& = delete;
+
+  /**
+   * \brief Deletes the pixel buffer objects and any pending fences.
+   *
+   * \since 6.1.0
+   */
+  ~readback_ring() noexcept
+  {
+    for (auto& fence : m_fences)
+    {
+      if (fence && m_sync.has_sync())
+      {
+        m_sync.deleteSync(fence);
+      }
+    }
+
+    m_functions.deleteBuffers(static_cast<GLsizei>(m_buffers.size()), m_buffers.data());
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Starts reading the current frame, and reads the oldest frame of the ring.
+   *
+   * \details The frame that was captured `delay()` frames ago is copied into the surface,
+   * which is recreated if its size or pixel format differs from the frames. Mapping the
+   * buffer only blocks if the GPU is more than `delay()` frames behind.
+   *
+   * \param frame the surface that the oldest frame is read into.
+   *
+   * \return `true` if a frame was read into the surface; `false` if fewer than
+   * `delay() + 1` frames have been captured, if waiting for the GPU failed, or if the
+   * buffer couldn't be mapped.
+   *
+   * \throws sdl_error if the surface couldn't be recreated.
+   *
+   * \since 6.1.0
+   */
+  auto capture(surface& frame) -> bool
+  {
+    start_read(m_next);
+
+    ++m_frames;
+    m_next = (m_next + 1u) % m_buffers.size();
+
+    // The buffer after the current one holds the oldest frame, once the ring is full
+    if (m_frames < m_buffers.size())
+    {
+      return false;
+    }
+
+    return finish_read(m_next, frame);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of frames between capturing a frame and reading it.
+   *
+   * \return the readback delay, in frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto delay() const noexcept -> std::size_t
+  {
+    return m_buffers.size() - 1u;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been captured.
+   *
+   * \return the amount of `capture()` calls.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> u64
+  {
+    return m_frames;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the pixel format of the read frames.
+   *
+   * \return the format that matches `GL_RGBA` and `GL_UNSIGNED_BYTE`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto format() noexcept -> pixel_format
+  {
+    return pixel_format::rgba32;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct pack_functions final
+  {
+    using read_pixels_function = decltype(&glReadPixels);
+    using pixel_store_function = decltype(&glPixelStorei);
+
+    PFNGLGENBUFFERSPROC genBuffers{
+        detail::load_gl_function<PFNGLGENBUFFERSPROC>("glGenBuffers")};
+    PFNGLDELETEBUFFERSPROC deleteBuffers{
+        detail::load_gl_function<PFNGLDELETEBUFFERSPROC>("glDeleteBuffers")};
+    PFNGLBINDBUFFERPROC bindBuffer{
+        detail::load_gl_function<PFNGLBINDBUFFERPROC>("glBindBuffer")};
+    PFNGLBUFFERDATAPROC bufferData{
+        detail::load_gl_function<PFNGLBUFFERDATAPROC>("glBufferData")};
+    PFNGLMAPBUFFERRANGEPROC mapBufferRange{
+        detail::load_gl_function<PFNGLMAPBUFFERRANGEPROC>("glMapBufferRange")};
+    PFNGLUNMAPBUFFERPROC unmapBuffer{
+        detail::load_gl_function<PFNGLUNMAPBUFFERPROC>("glUnmapBuffer")};
+    read_pixels_function readPixels{
+        detail::load_gl_function<read_pixels_function>("glReadPixels")};
+    pixel_store_function pixelStore{
+        detail::load_gl_function<pixel_store_function>("glPixelStorei")};
+
+    [[nodiscard]] auto is_complete() const noexcept -> bool
+    {
+      return genBuffers && deleteBuffers && bindBuffer && bufferData && mapBufferRange &&
+             unmapBuffer && readPixels && pixelStore;
+    }
+  };
+
+  pack_functions m_functions;
+  detail::gl_sync_functions m_sync;
+  std::vector<GLuint> m_buffers;
+  std::vector<GLsync> m_fences;  // Null without sync support, or after the frame is read
+  iarea m_size;
+  std::size_t m_next{};
+  u64 m_frames{};
+
+  [[nodiscard]] auto row_size() const noexcept -> std::size_t
+  {
+    return static_cast<std::size_t>(m_size.width) * 4u;
+  }
+
+  [[nodiscard]] auto frame_size() const noexcept -> std::size_t
+  {
+    return row_size() * static_cast<std::size_t>(m_size.height);
+  }
+
+  void start_read(const std::size_t index) noexcept
+  {
+    m_functions.bindBuffer(GL_PIXEL_PACK_BUFFER, m_buffers[index]);
+
+    // With a buffer bound, the pointer is an offset into the buffer
+    m_functions.pixelStore(GL_PACK_ALIGNMENT, 1);
+    m_functions.readPixels(0,
+                           0,
+                           m_size.width,
+                           m_size.height,
+                           GL_RGBA,
+                           GL_UNSIGNED_BYTE,
+                           nullptr);
+
+    m_functions.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (m_sync.has_sync())
+    {
+      m_fences[index] = m_sync.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+  }
+
+  auto finish_read(const std::size_t index, surface& frame) -> bool
+  {
+    if (auto& fence = m_fences[index])
+    {
+      const auto signaled = m_sync.wait(fence);
+
+      m_sync.deleteSync(fence);
+      fence = nullptr;
+
+      if (!signaled)
+      {
+        return false;
+      }
+    }
+
+    if (frame.size() != m_size || frame.format_info().format() != format())
+    {
+      frame = surface{m_size, format()};
+    }
+
+    m_functions.bindBuffer(GL_PIXEL_PACK_BUFFER, m_buffers[index]);
+
+    const auto size = static_cast<GLsizeiptr>(frame_size());
+    const auto* mapped = static_cast<const u8*>(
+        m_functions.mapBufferRange(GL_PIXEL_PACK_BUFFER, 0, size, GL_MAP_READ_BIT));
+
+    auto copied = false;
+    if (mapped && frame.lock())
+    {
+      auto* pixels = static_cast<u8*>(frame.pixels());
+      const auto rowSize = row_size();
+
+      for (int y = 0; y < m_size.height; ++y)
+      {
+        const auto source = static_cast<std::size_t>(m_size.height - 1 - y) * rowSize;
+        std::memcpy(pixels + static_cast<std::ptrdiff_t>(y) * frame.pitch(),
+                    mapped + source,
+                    rowSize);
+      }
+
+      frame.unlock();
+      copied = true;
+    }
+
+    if (mapped)
+    {
+      m_functions.unmapBuffer(GL_PIXEL_PACK_BUFFER);
+    }
+
+    m_functions.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    return copied;
+  }
+};
+
+}  // namespace cen::gl
+
+/// \} End of group video
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_READBACK_RING_HEADER
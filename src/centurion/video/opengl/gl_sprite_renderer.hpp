@@ -0,0 +1,726 @@
+#ifndef CENTURION_GL_SPRITE_RENDERER_HEADER
+#define CENTURION_GL_SPRITE_RENDERER_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <algorithm>  // max
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../../core/exception.hpp"
+#include "../../core/result.hpp"
+#include "../../math/area.hpp"
+#include "../../math/rect.hpp"
+#include "../../math/transform2d.hpp"
+#include "../blend_mode.hpp"
+#include "../color.hpp"
+#include "../colors.hpp"
+#include "../sprite_batch.hpp"
+#include "gl_function_table.hpp"
+#include "gl_stream_buffer.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+/// \addtogroup video
+/// \{
+
+namespace cen::gl {
+
+/**
+ * \struct sprite_texture
+ *
+ * \brief Identifies a layer of a texture array that is used by a `sprite_renderer`.
+ *
+ * \details Sprites that use different layers of the same array are drawn together, so
+ * sprite sheets and atlas pages should be stored as layers of a single array. A plain
+ * texture is represented by an array with one layer.
+ *
+ * \since 6.1.0
+ */
+struct sprite_texture final
+{
+  GLuint array{};  ///< The name of a `GL_TEXTURE_2D_ARRAY` texture.
+  GLint layer{};   ///< The layer of the array that is sampled.
+  iarea size{};    ///< The size of each layer, in pixels.
+};
+
+}  // namespace cen::gl
+
+/// \cond FALSE
+namespace cen::detail {
+
+// The per-instance data, which maps the unit square to the corners of the sprite
+struct gl_sprite_instance final
+{
+  float row0[3];  // a, c, tx
+  float row1[3];  // b, d, ty
+  float uv[4];    // u0, v0, u1, v1
+  float layer;
+  SDL_Color colors[4];  // Top-left, top-right, bottom-right, bottom-left
+};
+
+static_assert(sizeof(gl_sprite_instance) == 60);
+
+[[nodiscard]] inline auto make_gl_sprite_instance(const frect& dst,
+                                                  const transform2d& transform,
+                                                  const float (&uv)[4],
+                                                  const GLint layer,
+                                                  const corner_colors& tints) noexcept
+    -> gl_sprite_instance
+{
+  const auto origin = transform.apply({dst.x(), dst.y()});
+
+  gl_sprite_instance instance{};
+  instance.row0[0] = transform.a() * dst.width();
+  instance.row0[1] = transform.c() * dst.height();
+  instance.row0[2] = origin.x();
+  instance.row1[0] = transform.b() * dst.width();
+  instance.row1[1] = transform.d() * dst.height();
+  instance.row1[2] = origin.y();
+
+  for (int index = 0; index < 4; ++index)
+  {
+    instance.uv[index] = uv[index];
+  }
+
+  instance.layer = static_cast<float>(layer);
+  instance.colors[0] = tints.topLeft.get();
+  instance.colors[1] = tints.topRight.get();
+  instance.colors[2] = tints.bottomRight.get();
+  instance.colors[3] = tints.bottomLeft.get();
+
+  return instance;
+}
+
+struct gl_blend_factors final
+{
+  bool enabled{};
+  GLenum source{GL_ONE};
+  GLenum destination{GL_ZERO};
+};
+
+// Matches the blend functions that SDL uses for its blend modes
+[[nodiscard]] constexpr auto to_gl_blend_factors(const blend_mode mode) noexcept
+    -> gl_blend_factors
+{
+  switch (mode)
+  {
+    case blend_mode::none:
+    case blend_mode::invalid:
+      return {};
+
+    case blend_mode::blend:
+      return {true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA};
+
+    case blend_mode::add:
+      return {true, GL_SRC_ALPHA, GL_ONE};
+
+    case blend_mode::mod:
+      return {true, GL_ZERO, GL_SRC_COLOR};
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+
+    case blend_mode::mul:
+      return {true, GL_DST_COLOR, GL_ONE_MINUS_SRC_ALPHA};
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+
+    default:  // Custom blend modes are rendered without blending
+      return {};
+  }
+}
+
+inline constexpr auto gl_sprite_vertex_source =
+    "#version 330 core\n"
+    "layout(location = 0) in vec3 a_row0;\n"
+    "layout(location = 1) in vec3 a_row1;\n"
+    "layout(location = 2) in vec4 a_uv;\n"
+    "layout(location = 3) in float a_layer;\n"
+    "layout(location = 4) in vec4 a_color0;\n"
+    "layout(location = 5) in vec4 a_color1;\n"
+    "layout(location = 6) in vec4 a_color2;\n"
+    "layout(location = 7) in vec4 a_color3;\n"
+    "uniform vec2 u_scale;\n"
+    "out vec3 v_uv;\n"
+    "out vec4 v_color;\n"
+    "void main() {\n"
+    "  vec3 corner = vec3(gl_VertexID & 1, gl_VertexID >> 1, 1.0);\n"
+    "  vec2 position = vec2(dot(a_row0, corner), dot(a_row1, corner));\n"
+    "  gl_Position = vec4(position * u_scale + vec2(-1.0, 1.0), 0.0, 1.0);\n"
+    "  v_uv = vec3(mix(a_uv.xy, a_uv.zw, corner.xy), a_layer);\n"
+    "  vec4 colors[4] = vec4[4](a_color0, a_color1, a_color3, a_color2);\n"
+    "  v_color = colors[gl_VertexID];\n"
+    "}\n";
+
+inline constexpr auto gl_sprite_fragment_source =
+    "#version 330 core\n"
+    "uniform sampler2DArray u_texture;\n"
+    "in vec3 v_uv;\n"
+    "in vec4 v_color;\n"
+    "out vec4 o_color;\n"
+    "void main() {\n"
+    "  o_color = texture(u_texture, v_uv) * v_color;\n"
+    "}\n";
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen::gl {
+
+/**
+ * \class sprite_renderer
+ *
+ * \brief Draws sprites with instanced rendering, for applications that use OpenGL
+ * directly instead of `basic_renderer`.
+ *
+ * \details This class provides the same batching API as `sprite_batch`, with
+ * `sprite_texture` in place of textures, so gameplay rendering can be written once
+ * against either backend. Instead of four vertices, each sprite is stored as a single
+ * instance of 60 bytes, which contains the transform, texture coordinates, layer and
+ * corner colors of the sprite. The instances are written into a persistently mapped
+ * `stream_buffer`, and the quads are expanded by the vertex shader, so each run of
+ * sprites that share a texture array and blend mode is drawn with one
+ * `glDrawArraysInstanced()` call.
+ * \code{cpp}
+ *   cen::gl::sprite_renderer sprites;
+ *
+ *   // Every frame
+ *   sprites.add(atlas, source, destination, cen::colors::white);
+ *   sprites.submit(windowSize);
+ *
+ *   sprites.end_frame();
+ *   cen::gl::swap(window);
+ * \endcode
+ *
+ * \details The destination rectangles use the same coordinate system as `basic_renderer`,
+ * i.e. pixels with the origin in the top-left corner of the viewport.
+ *
+ * \note The renderer must be created, used and destroyed while the same context, or a
+ * context in its share group, is current.
+ *
+ * \see `sprite_batch`
+ * \see `stream_buffer`
+ *
+ * \since 6.1.0
+ */
+class sprite_renderer final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// The size of the data of each sprite in the stream buffer, in bytes.
+  inline constexpr static size_type instance_size = sizeof(detail::gl_sprite_instance);
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates a sprite renderer and compiles its shader.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \param maxSprites the maximum amount of sprites that can be submitted each frame.
+   *
+   * \throws cen_error if the context lacks required functions, or if the shader can't be
+   * compiled, i.e. if the context doesn't support GLSL 3.30.
+   *
+   * \since 6.1.0
+   */
+  explicit sprite_renderer(const size_type maxSprites = 16'384)
+      : m_gl{function_table::load_required()}
+      , m_instances{GL_ARRAY_BUFFER, (std::max)(maxSprites, size_type{1}) * instance_size}
+  {
+    const auto vertex = compile(GL_VERTEX_SHADER, detail::gl_sprite_vertex_source);
+    const auto fragment = compile(GL_FRAGMENT_SHADER, detail::gl_sprite_fragment_source);
+    if (!fragment)
+    {
+      m_gl.delete_shader(vertex);
+    }
+
+    if (!vertex || !fragment)
+    {
+      throw cen_error{"Failed to compile the sprite shader!"};
+    }
+
+    m_program = link(vertex, fragment);
+    if (!m_program)
+    {
+      throw cen_error{"Failed to link the sprite shader!"};
+    }
+
+    m_scale = m_gl.get_uniform_location(m_program, "u_scale");
+
+    m_gl.use_program(m_program);
+    m_gl.uniform_1i(m_gl.get_uniform_location(m_program, "u_texture"), 0);
+    m_gl.use_program(0);
+
+    m_gl.gen_vertex_arrays(1, &m_vertexArray);
+    m_gl.bind_vertex_array(m_vertexArray);
+    for (GLuint location = 0; location < 8; ++location)
+    {
+      m_gl.enable_vertex_attrib_array(location);
+      m_gl.vertex_attrib_divisor(location, 1);
+    }
+
+    m_gl.bind_vertex_array(0);
+  }
+
+  sprite_renderer(const sprite_renderer&) = delete;
+
+  auto operator=(const sprite_renderer&) -> sprite_renderer& = delete;
+
+  /**
+   * \brief Deletes the shader and the vertex array.
+   *
+   * \since 6.1.0
+   */
+  ~sprite_renderer() noexcept
+  {
+    m_gl.delete_vertex_arrays(1, &m_vertexArray);
+    m_gl.delete_program(m_program);
+  }
+
+  /// \} End of construction/destruction
+
+  /// \name Batching
+  /// \{
+
+  /**
+   * \brief Adds a sprite.
+   *
+   * \param texture the texture layer that will be used by the sprite.
+   * \param source the cutout of the layer that will be rendered.
+   * \param destination the position and size of the rendered sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  void add(const sprite_texture& texture,
+           const irect& source,
+           const frect& destination,
+           const color& tint = colors::white)
+  {
+    push(texture, source, destination, {}, {tint, tint, tint, tint});
+  }
+
+  /**
+   * \brief Adds a sprite with a separate tint for each corner.
+   *
+   * \param texture the texture layer that will be used by the sprite.
+   * \param source the cutout of the layer that will be rendered.
+   * \param destination the position and size of the rendered sprite.
+   * \param tints the colors that will be multiplied with the corners of the texture.
+   *
+   * \since 6.1.0
+   */
+  void add(const sprite_texture& texture,
+           const irect& source,
+           const frect& destination,
+           const corner_colors& tints)
+  {
+    push(texture, source, destination, {}, tints);
+  }
+
+  /**
+   * \brief Adds a transformed sprite.
+   *
+   * \details The transform is applied to the corners of the destination rectangle.
+   *
+   * \param texture the texture layer that will be used by the sprite.
+   * \param source the cutout of the layer that will be rendered.
+   * \param destination the position and size of the sprite, before the transform.
+   * \param transform the transform that will be applied to the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  void add(const sprite_texture& texture,
+           const irect& source,
+           const frect& destination,
+           const transform2d& transform,
+           const color& tint = colors::white)
+  {
+    push(texture, source, destination, transform, {tint, tint, tint, tint});
+  }
+
+  /**
+   * \brief Adds several sprites that use the same texture layer.
+   *
+   * \param texture the texture layer that will be used by the sprites.
+   * \param sources the cutouts of the layer, one for each sprite.
+   * \param destinations the positions and sizes of the rendered sprites.
+   * \param count the amount of sprites.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  void add(const sprite_texture& texture,
+           const irect* sources,
+           const frect* destinations,
+           const size_type count,
+           const color& tint = colors::white)
+  {
+    assert(count == 0 || (sources && destinations));
+
+    m_sprites.reserve(m_sprites.size() + count);
+    for (size_type index = 0; index < count; ++index)
+    {
+      push(texture, sources[index], destinations[index], {}, {tint, tint, tint, tint});
+    }
+  }
+
+  /**
+   * \brief Adds a sprite that renders an entire texture layer.
+   *
+   * \param texture the texture layer that will be used by the sprite.
+   * \param destination the position and size of the rendered sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  void add(const sprite_texture& texture,
+           const frect& destination,
+           const color& tint = colors::white)
+  {
+    add(texture, {{0, 0}, texture.size}, destination, tint);
+  }
+
+  /**
+   * \brief Adds a transformed sprite that renders an entire texture layer.
+   *
+   * \param texture the texture layer that will be used by the sprite.
+   * \param destination the position and size of the sprite, before the transform.
+   * \param transform the transform that will be applied to the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  void add(const sprite_texture& texture,
+           const frect& destination,
+           const transform2d& transform,
+           const color& tint = colors::white)
+  {
+    add(texture, {{0, 0}, texture.size}, destination, transform, tint);
+  }
+
+  /**
+   * \brief Draws all added sprites and clears the renderer.
+   *
+   * \details One instanced draw call is made for each texture array/blend mode run. The
+   * shader, vertex array, texture and blend state are changed by this function, and the
+   * shader and vertex array are unbound afterwards.
+   *
+   * \param viewport the size of the viewport, which maps destination coordinates to
+   * pixels.
+   *
+   * \return `success` if all runs were drawn; `failure` if the stream buffer ran out of
+   * room for some of the sprites of this frame, see the constructor.
+   *
+   * \since 6.1.0
+   */
+  auto submit(const iarea viewport) -> result
+  {
+    bool ok = true;
+
+    m_gl.use_program(m_program);
+    m_gl.uniform_2f(m_scale,
+                    2.0f / static_cast<float>((std::max)(viewport.width, 1)),
+                    -2.0f / static_cast<float>((std::max)(viewport.height, 1)));
+    m_gl.bind_vertex_array(m_vertexArray);
+    m_gl.active_texture(GL_TEXTURE0);
+
+    for (const auto& run : m_runs)
+    {
+      const auto offset = m_instances.write(m_sprites.data() + run.first,
+                                            run.count * instance_size);
+      if (!offset)
+      {
+        ok = false;
+        continue;
+      }
+
+      m_instances.bind();
+      set_attributes(*offset);
+
+      const auto factors = detail::to_gl_blend_factors(run.mode);
+      if (factors.enabled)
+      {
+        m_gl.enable(GL_BLEND);
+        m_gl.blend_func(factors.source, factors.destination);
+      }
+      else
+      {
+        m_gl.disable(GL_BLEND);
+      }
+
+      m_gl.bind_texture(GL_TEXTURE_2D_ARRAY, run.array);
+      m_gl.draw_arrays_instanced(GL_TRIANGLE_STRIP,
+                                 0,
+                                 4,
+                                 static_cast<GLsizei>(run.count));
+    }
+
+    m_gl.bind_vertex_array(0);
+    m_gl.use_program(0);
+
+    clear();
+    return ok;
+  }
+
+  /**
+   * \brief Marks the end of the frame, after the last `submit()` of the frame.
+   *
+   * \see `stream_buffer::end_frame()`
+   *
+   * \since 6.1.0
+   */
+  void end_frame() noexcept
+  {
+    m_instances.end_frame();
+  }
+
+  /**
+   * \brief Removes all sprites, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_sprites.clear();
+    m_runs.clear();
+  }
+
+  /**
+   * \brief Reserves space for a number of sprites.
+   *
+   * \param capacity the amount of sprites to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_sprites.reserve(capacity);
+  }
+
+  /// \} End of batching
+
+  /// \name Setters
+  /// \{
+
+  /**
+   * \brief Sets the blend mode used by subsequently added sprites.
+   *
+   * \details Changing the blend mode starts a new run, even if the texture array is the
+   * same.
+   *
+   * \param mode the blend mode that will be used.
+   *
+   * \since 6.1.0
+   */
+  void set_blend_mode(const blend_mode mode) noexcept
+  {
+    m_mode = mode;
+  }
+
+  /// \} End of setters
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the blend mode used by subsequently added sprites.
+   *
+   * \details The default blend mode is `blend_mode::blend`.
+   *
+   * \return the current blend mode.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_blend_mode() const noexcept -> blend_mode
+  {
+    return m_mode;
+  }
+
+  /**
+   * \brief Returns the amount of added sprites.
+   *
+   * \return the amount of sprites that will be drawn by `submit()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_sprites.size();
+  }
+
+  /**
+   * \brief Indicates whether or not any sprites have been added.
+   *
+   * \return `true` if there are no sprites; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_sprites.empty();
+  }
+
+  /**
+   * \brief Returns the amount of draw calls that would be made by `submit()`.
+   *
+   * \return the amount of texture array/blend mode runs.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto run_count() const noexcept -> size_type
+  {
+    return m_runs.size();
+  }
+
+  /**
+   * \brief Returns the stream buffer that the sprites are written to.
+   *
+   * \return the instance buffer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto instances() const noexcept -> const stream_buffer&
+  {
+    return m_instances;
+  }
+  /// \} End of queries
+
+ private:
+  struct run_data final
+  {
+    GLuint array{};
+    blend_mode mode{blend_mode::blend};
+    size_type first{};
+    size_type count{};
+  };
+
+  function_table m_gl;
+  stream_buffer m_instances;
+  std::vector<detail::gl_sprite_instance> m_sprites;
+  std::vector<run_data> m_runs;
+  GLuint m_program{};
+  GLuint m_vertexArray{};
+  GLint m_scale{-1};
+  blend_mode m_mode{blend_mode::blend};
+
+  void push(const sprite_texture& texture,
+            const irect& source,
+            const frect& destination,
+            const transform2d& transform,
+            const corner_colors& tints)
+  {
+    if (m_runs.empty() || m_runs.back().array != texture.array ||
+        m_runs.back().mode != m_mode)
+    {
+      m_runs.push_back(run_data{texture.array, m_mode, m_sprites.size(), 0});
+    }
+
+    const auto inverseWidth =
+        1.0f / static_cast<float>((std::max)(texture.size.width, 1));
+    const auto inverseHeight =
+        1.0f / static_cast<float>((std::max)(texture.size.height, 1));
+
+    const float uv[4]{static_cast<float>(source.x()) * inverseWidth,
+                      static_cast<float>(source.y()) * inverseHeight,
+                      static_cast<float>(source.max_x()) * inverseWidth,
+                      static_cast<float>(source.max_y()) * inverseHeight};
+
+    const auto layer = texture.layer;
+    m_sprites.push_back(
+        detail::make_gl_sprite_instance(destination, transform, uv, layer, tints));
+    ++m_runs.back().count;
+  }
+
+  // The attributes are respecified for each run, since base instances require GL 4.2
+  void set_attributes(const size_type offset) noexcept
+  {
+    using instance = detail::gl_sprite_instance;
+    const auto stride = static_cast<GLsizei>(instance_size);
+
+    const auto pointer = [&](const GLuint location,
+                             const GLint size,
+                             const GLenum type,
+                             const GLboolean normalized,
+                             const size_type member) {
+      m_gl.vertex_attrib_pointer(location,
+                                 size,
+                                 type,
+                                 normalized,
+                                 stride,
+                                 reinterpret_cast<const void*>(offset + member));
+    };
+
+    pointer(0, 3, GL_FLOAT, GL_FALSE, offsetof(instance, row0));
+    pointer(1, 3, GL_FLOAT, GL_FALSE, offsetof(instance, row1));
+    pointer(2, 4, GL_FLOAT, GL_FALSE, offsetof(instance, uv));
+    pointer(3, 1, GL_FLOAT, GL_FALSE, offsetof(instance, layer));
+
+    for (GLuint corner = 0; corner < 4; ++corner)
+    {
+      pointer(4 + corner,
+              4,
+              GL_UNSIGNED_BYTE,
+              GL_TRUE,
+              offsetof(instance, colors) + corner * sizeof(SDL_Color));
+    }
+  }
+
+  // Returns zero if the shader can't be compiled
+  [[nodiscard]] auto compile(const GLenum type, const char* source) noexcept -> GLuint
+  {
+    const auto shader = m_gl.create_shader(type);
+    m_gl.shader_source(shader, 1, &source, nullptr);
+    m_gl.compile_shader(shader);
+
+    GLint status{};
+    m_gl.get_shader_iv(shader, GL_COMPILE_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+      m_gl.delete_shader(shader);
+      return 0;
+    }
+
+    return shader;
+  }
+
+  // Returns zero if the program can't be linked, the shaders are deleted either way
+  [[nodiscard]] auto link(const GLuint vertex, const GLuint fragment) noexcept -> GLuint
+  {
+    const auto program = m_gl.create_program();
+    m_gl.attach_shader(program, vertex);
+    m_gl.attach_shader(program, fragment);
+    m_gl.link_program(program);
+    m_gl.detach_shader(program, vertex);
+    m_gl.detach_shader(program, fragment);
+    m_gl.delete_shader(vertex);
+    m_gl.delete_shader(fragment);
+
+    GLint status{};
+    m_gl.get_program_iv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+      m_gl.delete_program(program);
+      return 0;
+    }
+
+    return program;
+  }
+};
+
+}  // namespace cen::gl
+
+/// \} End of group video
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_SPRITE_RENDERER_HEADER
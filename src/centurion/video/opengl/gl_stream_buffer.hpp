@@ -0,0 +1,416 @@
+#ifndef CENTURION_GL_STREAM_BUFFER_HEADER
+#define CENTURION_GL_STREAM_BUFFER_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <array>        // array
+#include <cstddef>      // size_t
+#include <cstring>      // memcpy
+#include <optional>     // optional
+#include <type_traits>  // is_trivially_copyable_v
+
+#include "../../core/exception.hpp"
+#include "../../detail/gl_functions.hpp"
+#include "gl_core.hpp"
+
+/// \addtogroup video
+/// \{
+
+namespace cen::gl {
+
+/**
+ * \enum stream_buffer_mode
+ *
+ * \brief Provides the strategies used by stream buffers to avoid synchronization.
+ *
+ * \see `gl::stream_buffer`
+ *
+ * \since 6.1.0
+ */
+enum class stream_buffer_mode
+{
+  persistent,  ///< A persistently mapped ring of regions, guarded by fences.
+  orphaning    ///< The buffer storage is reallocated at the start of every frame.
+};
+
+/**
+ * \class stream_buffer
+ *
+ * \brief A buffer object for data that is replaced every frame, e.g. vertices.
+ *
+ * \details Updating a buffer that is still in use by the GPU makes the driver either
+ * stall or copy the data. If `GL_ARB_buffer_storage` is supported, this class instead
+ * allocates immutable storage for three regions, which is mapped once with persistent
+ * and coherent access. Each frame writes into its own region, and a fence is inserted
+ * when the frame ends, so that the region is only written again once the GPU has
+ * finished reading it, three frames later.
+ *
+ * \details Without the extension, the buffer falls back to orphaning, i.e. the storage
+ * is reallocated at the start of every frame, and the data is uploaded with
+ * `glBufferSubData()` into the fresh storage.
+ * \code{cpp}
+ *   cen::gl::stream_buffer vertices{GL_ARRAY_BUFFER, 1 << 20};
+ *
+ *   // Every frame
+ *   if (const auto offset = vertices.write(batch.data(), batch.size() * sizeof(vertex)))
+ *   {
+ *     vertices.bind();
+ *     glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(vertex), nullptr);
+ *     glDrawArrays(GL_TRIANGLES, *offset / sizeof(vertex), batch.size());
+ *   }
+ *
+ *   vertices.end_frame();
+ *   cen::gl::swap(window);
+ * \endcode
+ *
+ * \note The buffer must be created, used and destroyed while the same context, or a
+ * context in its share group, is current.
+ *
+ * \since 6.1.0
+ */
+class stream_buffer final
+{
+ public:
+  /// The amount of frames that can be in flight at once.
+  inline constexpr static std::size_t region_count = 3;
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates a stream buffer.
+   *
+   * \pre An OpenGL context must be current.
+   *
+   * \param target the target that the buffer is bound to, e.g. `GL_ARRAY_BUFFER`.
+   * \param regionSize the maximum amount of bytes that can be written each frame.
+   * \param allowPersistent `false` if orphaning should be used regardless of whether or
+   * not persistent mapping is supported.
+   *
+   * \throws cen_error if the region size is zero, or if the buffer functions can't be
+   * loaded.
+   *
+   * \since 6.1.0
+   */
+  stream_buffer(const GLenum target,
+                const std::size_t regionSize,
+                const bool allowPersistent = true)
+      : m_target{target}
+      , m_regionSize{regionSize}
+  {
+    if (m_regionSize == 0)
+    {
+      throw cen_error{"Stream buffer regions can't be empty!"};
+    }
+
+    if (!m_functions.has_buffers())
+    {
+      throw cen_error{"Failed to load the OpenGL buffer functions!"};
+    }
+
+    m_functions.genBuffers(1, &m_buffer);
+    m_functions.bindBuffer(m_target, m_buffer);
+
+    if (allowPersistent && m_functions.has_storage() && m_sync.has_sync() &&
+        is_extension_supported("GL_ARB_buffer_storage"))
+    {
+      constexpr GLbitfield flags =
+          GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+      const auto size = static_cast<GLsizeiptr>(m_regionSize * region_count);
+
+      m_functions.bufferStorage(m_target, size, nullptr, flags);
+      m_mapped = static_cast<unsigned char*>(
+          m_functions.mapBufferRange(m_target, 0, size, flags));
+    }
+
+    if (m_mapped)
+    {
+      m_mode = stream_buffer_mode::persistent;
+    }
+    else
+    {
+      // Immutable storage can't be reallocated, so the buffer is recreated
+      m_functions.deleteBuffers(1, &m_buffer);
+      m_functions.genBuffers(1, &m_buffer);
+      m_mode = stream_buffer_mode::orphaning;
+    }
+  }
+
+  stream_buffer(const stream_buffer&) = delete;
+
+  auto operator=(const stream_buffer&) -> stream_buffer& = delete;
+
+  /**
+   * \brief Deletes the buffer and any pending fences.
+   *
+   * \since 6.1.0
+   */
+  ~stream_buffer() noexcept
+  {
+    for (auto& fence : m_fences)
+    {
+      if (fence)
+      {
+        m_sync.deleteSync(fence);
+      }
+    }
+
+    if (m_mapped)
+    {
+      m_functions.bindBuffer(m_target, m_buffer);
+      m_functions.unmapBuffer(m_target);
+    }
+
+    m_functions.deleteBuffers(1, &m_buffer);
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Writes data to the region of the current frame.
+   *
+   * \details The first write of each frame waits for the GPU to finish reading the
+   * region, which only blocks if the GPU is more than two frames behind. In orphaning
+   * mode, the buffer is bound to its target by this function.
+   *
+   * \param data the data that will be written.
+   * \param size the amount of bytes that will be written.
+   * \param alignment the alignment of the offset, must be a power of two.
+   *
+   * \return the offset of the written data in the buffer, e.g. for
+   * `glVertexAttribPointer()`; `std::nullopt` if there isn't enough room left in the
+   * region.
+   *
+   * \throws cen_error if waiting for the GPU fails, e.g. because the context was lost.
+   *
+   * \since 6.1.0
+   */
+  auto write(const void* data, const std::size_t size, const std::size_t alignment = 16)
+      -> std::optional<std::size_t>
+  {
+    const auto offset = (m_used + alignment - 1u) & ~(alignment - 1u);
+    if (offset > m_regionSize || size > m_regionSize - offset)
+    {
+      return std::nullopt;
+    }
+
+    if (!m_started)
+    {
+      begin_frame();
+    }
+
+    if (m_mode == stream_buffer_mode::persistent)
+    {
+      const auto absolute = (m_region * m_regionSize) + offset;
+      std::memcpy(m_mapped + absolute, data, size);
+
+      m_used = offset + size;
+      return absolute;
+    }
+    else
+    {
+      m_functions.bindBuffer(m_target, m_buffer);
+      m_functions.bufferSubData(m_target,
+                                static_cast<GLintptr>(offset),
+                                static_cast<GLsizeiptr>(size),
+                                data);
+
+      m_used = offset + size;
+      return offset;
+    }
+  }
+
+  /**
+   * \brief Writes the contents of a contiguous container to the current region.
+   *
+   * \tparam Container the type of the container, such as `std::vector` or `std::array`,
+   * whose elements must be trivially copyable.
+   *
+   * \param container the elements that will be written.
+   *
+   * \return the offset of the first element in the buffer; `std::nullopt` if there isn't
+   * enough room left in the region.
+   *
+   * \throws cen_error if waiting for the GPU fails, e.g. because the context was lost.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto write(const Container& container) -> std::optional<std::size_t>
+  {
+    using value_type = typename Container::value_type;
+    static_assert(std::is_trivially_copyable_v<value_type>);
+
+    return write(container.data(),
+                 container.size() * sizeof(value_type),
+                 alignof(value_type));
+  }
+
+  /**
+   * \brief Marks the end of the frame, after all draw calls that read the frame's data.
+   *
+   * \details In persistent mode, a fence is inserted for the region of the frame, and
+   * the next frame writes to the next region.
+   *
+   * \since 6.1.0
+   */
+  void end_frame() noexcept
+  {
+    if (m_started && m_mode == stream_buffer_mode::persistent)
+    {
+      m_fences[m_region] = m_sync.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      m_region = (m_region + 1u) % region_count;
+    }
+
+    m_used = 0;
+    m_started = false;
+  }
+
+  /**
+   * \brief Binds the buffer to its target.
+   *
+   * \since 6.1.0
+   */
+  void bind() const noexcept
+  {
+    m_functions.bindBuffer(m_target, m_buffer);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the name of the buffer object.
+   *
+   * \note The name changes if the buffer falls back to orphaning during construction.
+   *
+   * \return the buffer object name.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto id() const noexcept -> GLuint
+  {
+    return m_buffer;
+  }
+
+  /**
+   * \brief Returns the strategy used by the buffer.
+   *
+   * \return the mode of the buffer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto mode() const noexcept -> stream_buffer_mode
+  {
+    return m_mode;
+  }
+
+  /**
+   * \brief Returns the maximum amount of bytes that can be written each frame.
+   *
+   * \return the size of each region, in bytes.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto region_size() const noexcept -> std::size_t
+  {
+    return m_regionSize;
+  }
+
+  /**
+   * \brief Returns the amount of bytes written during the current frame.
+   *
+   * \return the used size of the current region, including alignment padding.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto used() const noexcept -> std::size_t
+  {
+    return m_used;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct buffer_functions final
+  {
+    PFNGLGENBUFFERSPROC genBuffers{
+        detail::load_gl_function<PFNGLGENBUFFERSPROC>("glGenBuffers")};
+    PFNGLDELETEBUFFERSPROC deleteBuffers{
+        detail::load_gl_function<PFNGLDELETEBUFFERSPROC>("glDeleteBuffers")};
+    PFNGLBINDBUFFERPROC bindBuffer{
+        detail::load_gl_function<PFNGLBINDBUFFERPROC>("glBindBuffer")};
+    PFNGLBUFFERDATAPROC bufferData{
+        detail::load_gl_function<PFNGLBUFFERDATAPROC>("glBufferData")};
+    PFNGLBUFFERSUBDATAPROC bufferSubData{
+        detail::load_gl_function<PFNGLBUFFERSUBDATAPROC>("glBufferSubData")};
+    PFNGLBUFFERSTORAGEPROC bufferStorage{
+        detail::load_gl_function<PFNGLBUFFERSTORAGEPROC>("glBufferStorage")};
+    PFNGLMAPBUFFERRANGEPROC mapBufferRange{
+        detail::load_gl_function<PFNGLMAPBUFFERRANGEPROC>("glMapBufferRange")};
+    PFNGLUNMAPBUFFERPROC unmapBuffer{
+        detail::load_gl_function<PFNGLUNMAPBUFFERPROC>("glUnmapBuffer")};
+
+    [[nodiscard]] auto has_buffers() const noexcept -> bool
+    {
+      return genBuffers && deleteBuffers && bindBuffer && bufferData && bufferSubData;
+    }
+
+    [[nodiscard]] auto has_storage() const noexcept -> bool
+    {
+      return bufferStorage && mapBufferRange && unmapBuffer;
+    }
+  };
+
+  buffer_functions m_functions;
+  detail::gl_sync_functions m_sync;
+  std::array<GLsync, region_count> m_fences{};
+  unsigned char* m_mapped{};  // Null in orphaning mode
+  GLenum m_target{};
+  GLuint m_buffer{};
+  std::size_t m_regionSize{};
+  std::size_t m_region{};
+  std::size_t m_used{};
+  stream_buffer_mode m_mode{stream_buffer_mode::orphaning};
+  bool m_started{};
+
+  void begin_frame()
+  {
+    if (m_mode == stream_buffer_mode::persistent)
+    {
+      if (auto& fence = m_fences[m_region])
+      {
+        const auto signaled = m_sync.wait(fence);
+
+        m_sync.deleteSync(fence);
+        fence = nullptr;
+
+        if (!signaled)
+        {
+          throw cen_error{"Failed to wait for the GPU to release the stream region!"};
+        }
+      }
+    }
+    else
+    {
+      // Orphans the previous storage, which the driver frees once the GPU is done with it
+      m_functions.bindBuffer(m_target, m_buffer);
+      m_functions.bufferData(m_target,
+                             static_cast<GLsizeiptr>(m_regionSize),
+                             nullptr,
+                             GL_STREAM_DRAW);
+    }
+
+    m_started = true;
+  }
+};
+
+}  // namespace cen::gl
+
+/// \} End of group video
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_STREAM_BUFFER_HEADER
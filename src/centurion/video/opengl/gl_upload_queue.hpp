@@ -0,0 +1,483 @@
+#ifndef CENTURION_GL_UPLOAD_QUEUE_HEADER
+#define CENTURION_GL_UPLOAD_QUEUE_HEADER
+
+#ifndef CENTURION_NO_OPENGL
+
+#include <SDL.h>
+#include <SDL_opengl.h>
+
+#include <cstddef>        // size_t
+#include <deque>          // deque
+#include <memory>         // unique_ptr, make_unique
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+#include <vector>         // vector
+
+#include "../../core/delegate.hpp"
+#include "../../core/exception.hpp"
+#include "../../detail/gl_functions.hpp"
+#include "../../thread/condition.hpp"
+#include "../../thread/mutex.hpp"
+#include "../../thread/scoped_lock.hpp"
+#include "../../thread/thread.hpp"
+#include "../window.hpp"
+#include "gl_context.hpp"
+
+/// \addtogroup video
+/// \{
+
+namespace cen::gl {
+
+/**
+ * \enum upload_status
+ *
+ * \brief Provides values that describe the progress of a background upload.
+ *
+ * \see `gl::upload_queue`
+ *
+ * \since 6.1.0
+ */
+enum class upload_status
+{
+  pending,   ///< The upload hasn't been executed, or the GPU hasn't finished it yet.
+  complete,  ///< The uploaded resources can be used by the render thread.
+  failed,    ///< The upload threw an exception, or the worker context is unusable.
+  unknown    ///< The identifier isn't associated with an upload, e.g. after `poll()`.
+};
+
+/**
+ * \class upload_queue
+ *
+ * \brief Creates OpenGL resources on a worker thread, with a shared context.
+ *
+ * \details Uploading large textures and buffers stalls the thread that issues the
+ * commands. This class executes upload tasks on a worker thread, with a context in the
+ * share group of the render context, so that the render thread keeps drawing. A fence is
+ * inserted after every task, and the render thread calls `poll()`, typically once per
+ * frame, which invokes the completion callbacks of the tasks whose commands have been
+ * executed by the GPU. Only then are the created objects safe to use.
+ * \code{cpp}
+ *   cen::gl::upload_queue uploads{window};  // The render context must be current
+ *
+ *   GLuint texture{};
+ *   uploads.submit(
+ *       [&texture, pixels = std::move(pixels)] {
+ *         glGenTextures(1, &texture);
+ *         glBindTexture(GL_TEXTURE_2D, texture);
+ *         glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1024, 1024, 0, ...);
+ *       },
+ *       [&] { ready = true; });
+ *
+ *   // Every frame, on the render thread
+ *   uploads.poll();
+ * \endcode
+ *
+ * \details Fences require OpenGL 3.2 or `GL_ARB_sync`. Otherwise, the worker thread
+ * waits for the GPU after every task with `glFinish()`, which is slower, but still
+ * doesn't block the render thread.
+ *
+ * \note Only sharable objects, such as textures, buffers and shaders, should be created
+ * by the tasks. Container objects like vertex arrays and framebuffers are specific to
+ * each context.
+ *
+ * \note All member functions must be called from the render thread, i.e. the thread
+ * with the current context that the worker context shares objects with.
+ *
+ * \note The worker thread makes its context current with the supplied window. Some
+ * platforms don't allow a window to be used by several threads at once, in which case a
+ * separate hidden OpenGL window, with the same pixel format, should be used.
+ *
+ * \since 6.1.0
+ */
+class upload_queue final
+{
+ public:
+  using id_type = std::size_t;
+  using task_type = delegate<void()>;
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates a shared context and starts the worker thread.
+   *
+   * \pre The render context must be current on the calling thread.
+   * \pre `window` must be an OpenGL window.
+   *
+   * \tparam U the ownership semantics of the window.
+   *
+   * \param window the window that the worker context is made current with.
+   *
+   * \throws cen_error if there is no current OpenGL context.
+   * \throws sdl_error if the shared context, the synchronization primitives or the thread
+   * couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename U>
+  explicit upload_queue(basic_window<U>& window)
+      : m_shared{std::make_unique<shared_data>(window.get(), context::shared(window))}
+  {
+    m_worker = std::make_unique<thread>(&work, "gl_upload", m_shared.get());
+  }
+
+  upload_queue(const upload_queue&) = delete;
+
+  auto operator=(const upload_queue&) -> upload_queue& = delete;
+
+  /**
+   * \brief Stops and joins the worker thread.
+   *
+   * \details Tasks that haven't been started yet are discarded, the task that is being
+   * executed is finished first. Completion callbacks aren't invoked.
+   *
+   * \since 6.1.0
+   */
+  ~upload_queue() noexcept
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->stopping = true;
+    }
+
+    m_shared->available.broadcast();
+    m_worker.reset();
+
+    // The fences belong to the share group, so they can be deleted by the render thread
+    for (const auto& upload : m_shared->finished)
+    {
+      delete_fence(upload.fence);
+    }
+
+    for (const auto& upload : m_finished)
+    {
+      delete_fence(upload.fence);
+    }
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Schedules a task for execution on the worker thread.
+   *
+   * \param task the function object that issues the upload commands.
+   * \param done a function object invoked by `poll()` on the render thread, after the GPU
+   * has executed the commands of the task. It isn't invoked if the task fails.
+   *
+   * \return the identifier associated with the upload.
+   *
+   * \since 6.1.0
+   */
+  auto submit(task_type task, task_type done = {}) -> id_type
+  {
+    const auto id = m_nextId++;
+    m_entries.try_emplace(id, entry{upload_status::pending, std::move(done)});
+
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->requests.push_back({id, std::move(task)});
+    }
+
+    m_shared->available.signal();
+    return id;
+  }
+
+  /**
+   * \brief Completes the uploads that have been executed by the GPU.
+   *
+   * \details The completion callbacks are invoked in submission order. Completed and
+   * failed uploads are forgotten by the queue afterwards, i.e. their status becomes
+   * `unknown` on the next call.
+   *
+   * \pre This function must be called on the render thread.
+   *
+   * \return the amount of completed uploads, including failed uploads.
+   *
+   * \since 6.1.0
+   */
+  auto poll() -> std::size_t
+  {
+    forget_completed();
+
+    {
+      scoped_lock lock{m_shared->mutex};
+      for (auto& upload : m_shared->finished)
+      {
+        m_finished.push_back(upload);
+      }
+
+      m_shared->finished.clear();
+    }
+
+    std::size_t completed = 0;
+    while (!m_finished.empty())
+    {
+      const auto& upload = m_finished.front();
+      if (!is_signaled(upload.fence))
+      {
+        break;  // Later fences can't have been signaled before earlier ones
+      }
+
+      delete_fence(upload.fence);
+
+      auto& entry = m_entries.at(upload.id);
+      entry.status = upload.failed ? upload_status::failed : upload_status::complete;
+
+      if (!upload.failed && entry.done)
+      {
+        entry.done();
+      }
+
+      m_completed.push_back(upload.id);
+      m_finished.pop_front();
+      ++completed;
+    }
+
+    return completed;
+  }
+
+  /**
+   * \brief Blocks until every submitted upload has been completed.
+   *
+   * \details This is useful when the uploaded resources are needed right away, e.g.
+   * at the end of a loading screen.
+   *
+   * \pre This function must be called on the render thread.
+   *
+   * \return the amount of completed uploads, including failed uploads.
+   *
+   * \since 6.1.0
+   */
+  auto finish() -> std::size_t
+  {
+    std::size_t completed = 0;
+    while (pending_count() != 0)
+    {
+      {
+        scoped_lock lock{m_shared->mutex};
+        while (m_shared->finished.empty() && m_finished.empty())
+        {
+          m_shared->done.wait(m_shared->mutex);
+        }
+      }
+
+      wait_for_oldest_fence();
+      completed += poll();
+    }
+
+    return completed;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the status of an upload.
+   *
+   * \param id the identifier of the upload.
+   *
+   * \return the status of the upload.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto status(const id_type id) const -> upload_status
+  {
+    if (const auto it = m_entries.find(id); it != m_entries.end())
+    {
+      return it->second.status;
+    }
+    else
+    {
+      return upload_status::unknown;
+    }
+  }
+
+  /**
+   * \brief Returns the amount of uploads that haven't completed yet.
+   *
+   * \return the amount of pending uploads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pending_count() const noexcept -> std::size_t
+  {
+    return m_entries.size() - m_completed.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the worker thread uses fences.
+   *
+   * \return `true` if fences are used; `false` if the worker waits with `glFinish()`.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto uses_fences() const noexcept -> bool
+  {
+    return m_shared->functions.has_sync();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct request final
+  {
+    id_type id{};
+    task_type task;
+  };
+
+  struct finished_upload final
+  {
+    id_type id{};
+    GLsync fence{};  // Null if fences aren't available, or if the context is unusable
+    bool failed{};
+  };
+
+  struct shared_data final
+  {
+    shared_data(SDL_Window* window, context&& shared)
+        : window{window}
+        , workerContext{std::move(shared)}
+    {}
+
+    window_handle window;
+    context workerContext;
+    detail::gl_sync_functions functions;  // Loaded while the render context is current
+    cen::mutex mutex;
+    condition available;
+    condition done;
+    std::deque<request> requests;          // Guarded by the mutex
+    std::vector<finished_upload> finished;  // Guarded by the mutex
+    bool stopping{};                        // Guarded by the mutex
+  };
+
+  struct entry final
+  {
+    upload_status status{upload_status::pending};
+    task_type done;
+  };
+
+  std::unique_ptr<shared_data> m_shared;
+  std::unique_ptr<thread> m_worker;
+  std::unordered_map<id_type, entry> m_entries;
+  std::deque<finished_upload> m_finished;  // Executed uploads, in submission order
+  std::vector<id_type> m_completed;        // Reported by the previous call to poll()
+  id_type m_nextId{};
+
+  void forget_completed()
+  {
+    for (const auto id : m_completed)
+    {
+      m_entries.erase(id);
+    }
+
+    m_completed.clear();
+  }
+
+  [[nodiscard]] auto is_signaled(const GLsync fence) const noexcept -> bool
+  {
+    return !fence || m_shared->functions.is_signaled(fence);
+  }
+
+  void wait_for_oldest_fence() noexcept
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      for (auto& upload : m_shared->finished)
+      {
+        m_finished.push_back(upload);
+      }
+
+      m_shared->finished.clear();
+    }
+
+    if (!m_finished.empty() && m_finished.front().fence)
+    {
+      // A failed wait is ignored, the fence is polled again by is_signaled()
+      constexpr GLuint64 timeout = 1'000'000'000;  // One second, in nanoseconds
+      m_shared->functions.wait(m_finished.front().fence, timeout);
+    }
+  }
+
+  void delete_fence(const GLsync fence) const noexcept
+  {
+    if (fence)
+    {
+      m_shared->functions.deleteSync(fence);
+    }
+  }
+
+  static auto work(void* data) -> int
+  {
+    auto& shared = *static_cast<shared_data*>(data);
+    const auto& functions = shared.functions;
+
+    const bool usable =
+        shared.workerContext.make_current(shared.window) && functions.flush;
+
+    while (true)
+    {
+      request next;
+
+      {
+        scoped_lock lock{shared.mutex};
+        while (shared.requests.empty() && !shared.stopping)
+        {
+          shared.available.wait(shared.mutex);
+        }
+
+        if (shared.stopping)
+        {
+          break;
+        }
+
+        next = std::move(shared.requests.front());
+        shared.requests.pop_front();
+      }
+
+      finished_upload result{next.id, nullptr, !usable};
+      if (usable)
+      {
+        try
+        {
+          next.task();
+        }
+        catch (...)
+        {
+          // Exceptions must not escape the thread, the upload is reported as failed
+          result.failed = true;
+        }
+
+        if (functions.has_sync())
+        {
+          result.fence = functions.fenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+          functions.flush();  // Ensures that the fence is eventually signaled
+        }
+        else if (functions.finish)
+        {
+          functions.finish();
+        }
+      }
+
+      {
+        scoped_lock lock{shared.mutex};
+        shared.finished.push_back(result);
+      }
+
+      shared.done.signal();
+    }
+
+    if (usable)
+    {
+      context::release_current();
+    }
+
+    return 0;
+  }
+};
+
+}  // namespace cen::gl
+
+/// \} End of group video
+
+#endif  // CENTURION_NO_OPENGL
+#endif  // CENTURION_GL_UPLOAD_QUEUE_HEADER
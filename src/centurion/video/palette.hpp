@@ -4,6 +4,7 @@
 #include <SDL.h>
 
 #include <cassert>  // assert
+#include <cstddef>  // size_t
 #include <memory>   // unique_ptr
 #include <ostream>  // ostream
 #include <string>   // string
@@ -11,8 +12,7 @@
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
 #include "../core/result.hpp"
-#include "../detail/address_of.hpp"
-#include "../detail/to_string.hpp"
+#include "../detail/format_writer.hpp"
 #include "color.hpp"
 
 namespace cen {
@@ -204,6 +204,26 @@ class palette final
   std::unique_ptr<SDL_Palette, deleter> m_palette;
 };
 
+/**
+ * \brief Writes a textual representation of a palette to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param palette the palette that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer,
+                      const std::size_t size,
+                      const palette& palette) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("palette{data: ", palette.get(), ", size: ", palette.size(), "}");
+}
+
 /**
  * \brief Returns a textual representation of a palette.
  *
@@ -215,8 +235,7 @@ class palette final
  */
 [[nodiscard]] inline auto to_string(const palette& palette) -> std::string
 {
-  return "palette{data: " + detail::address_of(palette.get()) +
-         ", size: " + detail::to_string(palette.size()).value() + "}";
+  return detail::format_string(palette);
 }
 
 /**
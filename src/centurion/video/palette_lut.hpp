@@ -0,0 +1,366 @@
+#ifndef CENTURION_PALETTE_LUT_HEADER
+#define CENTURION_PALETTE_LUT_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // min
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/lut_kernels.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "color.hpp"
+#include "color_ramp.hpp"
+#include "palette.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class palette_lut
+ *
+ * \brief A lookup table that maps indices or values to pixels of a 32-bit format.
+ *
+ * \details The colors of a ramp or palette are packed into pixels once, so that mapping
+ * indexed pixels, grayscale pixels or floating-point data such as heatmaps becomes a
+ * single table lookup per pixel. Lookups use AVX2 gather instructions when they are
+ * supported by the CPU, and SSE2 or NEON instructions to compute the indices of
+ * floating-point values.
+ *
+ * \details The table used by 8-bit indices always has 256 entries, larger ramps are
+ * resampled for it, whereas floating-point values use all entries of the ramp.
+ * \code{cpp}
+ *   const cen::palette_lut lut{ramp, cen::pixel_format::argb8888};
+ *   lut.apply(grayscale, target);
+ * \endcode
+ *
+ * \see `color_ramp`
+ *
+ * \since 6.1.0
+ */
+class palette_lut final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates a lookup table from a color ramp.
+   *
+   * \param ramp the ramp that provides the colors.
+   * \param format the format of the mapped pixels, one of the 32-bit formats listed in
+   * `has_fast_conversion()`. The alpha values of the ramp are ignored by opaque formats.
+   *
+   * \throws cen_error if the pixel format isn't supported.
+   *
+   * \since 6.1.0
+   */
+  palette_lut(const color_ramp& ramp, const pixel_format format)
+      : m_layout{get_layout(format)}
+      , m_format{format}
+  {
+    m_table.reserve(ramp.size());
+    for (const auto& color : ramp)
+    {
+      m_table.push_back(pack(color));
+    }
+
+    m_bytes.resize(256);
+    for (size_type index = 0; index < 256; ++index)
+    {
+      m_bytes[index] = pack(ramp.sample(static_cast<float>(index) / 255.0f));
+    }
+  }
+
+  /**
+   * \brief Creates a lookup table from a palette.
+   *
+   * \details Indices that are outside of the palette are mapped to zero.
+   *
+   * \param palette the palette that provides the colors, with at most 256 colors.
+   * \param format the format of the mapped pixels, one of the 32-bit formats listed in
+   * `has_fast_conversion()`.
+   *
+   * \throws cen_error if the pixel format isn't supported or if the palette is empty.
+   *
+   * \since 6.1.0
+   */
+  palette_lut(const palette& palette, const pixel_format format)
+      : m_layout{get_layout(format)}
+      , m_format{format}
+  {
+    if (palette.size() <= 0)
+    {
+      throw cen_error{"Cannot create lookup table from empty palette!"};
+    }
+
+    assert(palette.size() <= 256);
+
+    m_table.reserve(static_cast<size_type>(palette.size()));
+    for (int index = 0; index < palette.size(); ++index)
+    {
+      m_table.push_back(pack(palette[index]));
+    }
+
+    m_bytes.assign(256, 0);
+    for (size_type index = 0; index < m_table.size() && index < 256; ++index)
+    {
+      m_bytes[index] = m_table[index];
+    }
+  }
+
+  /// \} End of construction
+
+  /**
+   * \brief Maps 8-bit indices to pixels.
+   *
+   * \param indices the indices, where grayscale values are indices as well.
+   * \param[out] out the buffer that receives the pixels.
+   * \param count the amount of indices.
+   *
+   * \since 6.1.0
+   */
+  void map(const u8* indices, void* out, const size_type count) const noexcept
+  {
+    detail::lookup_bytes(detail::get_simd_level(),
+                         m_bytes.data(),
+                         indices,
+                         static_cast<u32*>(out),
+                         count);
+  }
+
+  /**
+   * \brief Maps floating-point values to pixels.
+   *
+   * \details The values are scaled so that the minimum maps to the first entry and the
+   * maximum maps to the last entry, values outside of that range are clamped. NaN values
+   * map to the first entry.
+   *
+   * \pre `min` must be less than `max`.
+   *
+   * \param values the values that will be mapped.
+   * \param[out] out the buffer that receives the pixels.
+   * \param count the amount of values.
+   * \param min the value that maps to the first entry.
+   * \param max the value that maps to the last entry.
+   *
+   * \since 6.1.0
+   */
+  void map(const float* values,
+           void* out,
+           const size_type count,
+           const float min = 0,
+           const float max = 1) const noexcept
+  {
+    assert(min < max);
+
+    const auto last = static_cast<float>(m_table.size() - 1);
+    const detail::lut_range range{min, last / (max - min), last};
+
+    detail::lookup_values(detail::get_simd_level(),
+                          m_table.data(),
+                          range,
+                          values,
+                          static_cast<u32*>(out),
+                          count);
+  }
+
+  /**
+   * \brief Maps the pixels of an indexed or grayscale surface to another surface.
+   *
+   * \tparam T the ownership semantics of the source surface.
+   * \tparam U the ownership semantics of the target surface.
+   *
+   * \param source the source surface, must use one of the `index1lsb`, `index1msb`,
+   * `index4lsb`, `index4msb` and `index8` formats. Its palette is ignored.
+   * \param target the target surface, must use the format of the lookup table and have
+   * the same size as the source surface.
+   *
+   * \return `success` if the pixels were mapped; `failure` if the formats or sizes don't
+   * match or if the surfaces couldn't be locked.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename U>
+  auto apply(const basic_surface<T>& source, basic_surface<U>& target) const noexcept
+      -> result
+  {
+    const auto sourceFormat = source.format_info().format();
+    const auto bits = index_bits(sourceFormat);
+    if (bits == 0 || target.format_info().format() != m_format ||
+        source.size() != target.size())
+    {
+      return failure;
+    }
+
+    if (SDL_LockSurface(source.get()) != 0)
+    {
+      return failure;
+    }
+
+    if (!target.lock())
+    {
+      SDL_UnlockSurface(source.get());
+      return failure;
+    }
+
+    const auto* src = static_cast<const u8*>(source.get()->pixels);
+    auto* dst = static_cast<u8*>(target.pixels());
+    const auto width = static_cast<size_type>(source.width());
+
+    const auto msbFirst = sourceFormat == pixel_format::index1msb ||
+                          sourceFormat == pixel_format::index4msb;
+
+    for (int row = 0; row < source.height(); ++row)
+    {
+      const auto* indices = src + row * source.pitch();
+      auto* pixels = dst + row * target.pitch();
+
+      if (bits == 8)
+      {
+        map(indices, pixels, width);
+      }
+      else
+      {
+        map_packed(indices, reinterpret_cast<u32*>(pixels), width, bits, msbFirst);
+      }
+    }
+
+    target.unlock();
+    SDL_UnlockSurface(source.get());
+
+    return success;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of entries used by floating-point values.
+   *
+   * \return the size of the table.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_table.size();
+  }
+
+  /**
+   * \brief Returns the format of the mapped pixels.
+   *
+   * \return the pixel format.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    return m_format;
+  }
+
+  /**
+   * \brief Returns the packed entries used by floating-point values.
+   *
+   * \return a pointer to the first entry.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto data() const noexcept -> const u32*
+  {
+    return m_table.data();
+  }
+
+  /// \} End of queries
+
+ private:
+  detail::channel_layout m_layout;
+  pixel_format m_format;
+  std::vector<u32> m_table;
+  std::vector<u32> m_bytes;
+
+  [[nodiscard]] static auto get_layout(const pixel_format format)
+      -> detail::channel_layout
+  {
+    detail::channel_layout layout;
+    if (!detail::get_channel_layout(to_underlying(format), layout))
+    {
+      throw cen_error{"Unsupported pixel format for lookup table!"};
+    }
+
+    return layout;
+  }
+
+  // Returns the amount of bits per index of an indexed format, or zero for other formats
+  [[nodiscard]] static auto index_bits(const pixel_format format) noexcept -> int
+  {
+    if (format == pixel_format::index1lsb || format == pixel_format::index1msb)
+    {
+      return 1;
+    }
+    else if (format == pixel_format::index4lsb || format == pixel_format::index4msb)
+    {
+      return 4;
+    }
+    else if (format == pixel_format::index8)
+    {
+      return 8;
+    }
+    else
+    {
+      return 0;
+    }
+  }
+
+  // Unpacks indices smaller than a byte in chunks, so that they can use the byte lookups
+  void map_packed(const u8* packed,
+                  u32* out,
+                  const size_type count,
+                  const int bits,
+                  const bool msbFirst) const noexcept
+  {
+    constexpr size_type chunkSize = 256;
+
+    const auto perByte = static_cast<size_type>(8 / bits);
+    const auto mask = static_cast<unsigned>((1 << bits) - 1);
+
+    u8 indices[chunkSize];
+    for (size_type first = 0; first < count; first += chunkSize)
+    {
+      const auto chunk = (std::min)(chunkSize, count - first);
+      for (size_type offset = 0; offset < chunk; ++offset)
+      {
+        const auto index = first + offset;
+        const auto slot = static_cast<int>(index % perByte);
+        const auto shift = msbFirst ? 8 - bits * (slot + 1) : bits * slot;
+        indices[offset] = static_cast<u8>((packed[index / perByte] >> shift) & mask);
+      }
+
+      map(indices, out + first, chunk);
+    }
+  }
+
+  [[nodiscard]] auto pack(const color& color) const noexcept -> u32
+  {
+    const auto alpha = m_layout.opaque ? u32{0xFF} : u32{color.alpha()};
+    return (u32{color.red()} << m_layout.red) | (u32{color.green()} << m_layout.green) |
+           (u32{color.blue()} << m_layout.blue) | (alpha << m_layout.alpha);
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PALETTE_LUT_HEADER
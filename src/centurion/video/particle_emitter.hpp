@@ -0,0 +1,513 @@
+#ifndef CENTURION_PARTICLE_EMITTER_HEADER
+#define CENTURION_PARTICLE_EMITTER_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/particle_kernels.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/simd_vector.hpp"
+#include "../thread/parallel.hpp"
+#include "../thread/thread_pool.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct particle
+ *
+ * \brief Describes the initial state of an emitted particle.
+ *
+ * \see `particle_emitter`
+ *
+ * \since 6.1.0
+ */
+struct particle final
+{
+  fpoint position;            ///< The position of the center of the particle.
+  fpoint velocity;            ///< The velocity, in units per second.
+  color tint{colors::white};  ///< The color and alpha multiplied with the texture.
+  float lifetime{1};          ///< The amount of seconds that the particle lives.
+  float size{1};              ///< The width and height of the particle.
+};
+
+/**
+ * \class particle_emitter
+ *
+ * \brief Simulates particles and renders them with a single geometry call.
+ *
+ * \details Particles are stored in a structure-of-arrays layout, where the positions,
+ * velocities, ages, lifetimes, sizes and colors are kept in separate `simd_vector`s. The
+ * positions, velocities and ages are advanced with vector instructions, which are chosen
+ * at runtime based on the features of the CPU, and large emitters can also be updated on
+ * the workers of a thread pool.
+ * \code{cpp}
+ *   cen::particle_emitter sparks{1'024};
+ *   sparks.set_acceleration({0, 400});
+ *
+ *   // When something explodes
+ *   for (int i = 0; i < 64; ++i) {
+ *     sparks.emit({origin, random_velocity(), cen::colors::orange, 0.8f, 4});
+ *   }
+ *
+ *   // Every frame
+ *   sparks.update(dt);
+ *   sparks.render(renderer, sparkTexture);
+ * \endcode
+ *
+ * \details All particles of an emitter are rendered as textured quads with per-vertex
+ * colors, in one `SDL_RenderGeometry` call, instead of one render call and color
+ * modulation change per particle. Particles may optionally fade out, in which case the
+ * alpha of each particle decreases linearly over its lifetime.
+ *
+ * \note Particles that have exceeded their lifetime are removed by `update()`. The
+ * removal preserves the order of the remaining particles, so newer particles are always
+ * drawn on top of older particles.
+ *
+ * \since 6.1.0
+ */
+class particle_emitter final
+{
+ public:
+  using size_type = std::size_t;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an emitter without any particles.
+   *
+   * \since 6.1.0
+   */
+  particle_emitter() = default;
+
+  /**
+   * \brief Creates an emitter with space reserved for a number of particles.
+   *
+   * \param capacity the amount of particles to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  explicit particle_emitter(const size_type capacity)
+  {
+    reserve(capacity);
+  }
+
+  /// \} End of construction
+
+  /// \name Simulation
+  /// \{
+
+  /**
+   * \brief Adds a particle to the emitter.
+   *
+   * \param state the initial state of the particle, which must have a positive lifetime.
+   *
+   * \since 6.1.0
+   */
+  void emit(const particle& state)
+  {
+    assert(state.lifetime > 0 && "Particles must have a positive lifetime!");
+
+    m_xs.push_back(state.position.x());
+    m_ys.push_back(state.position.y());
+    m_vxs.push_back(state.velocity.x());
+    m_vys.push_back(state.velocity.y());
+    m_ages.push_back(0);
+    m_lifetimes.push_back(state.lifetime);
+    m_sizes.push_back(state.size);
+    m_colors.push_back(state.tint.get());
+  }
+
+  /**
+   * \brief Advances all particles, and removes the particles that have expired.
+   *
+   * \param dt the time step, in seconds.
+   *
+   * \since 6.1.0
+   */
+  void update(const float dt)
+  {
+    detail::integrate_particles(detail::get_simd_level(), columns(), 0, size(), step(dt));
+    remove_expired();
+  }
+
+  /**
+   * \brief Advances all particles on the workers of a thread pool, and removes the
+   * particles that have expired.
+   *
+   * \details The particles are split into chunks that are advanced in parallel, which is
+   * only worthwhile for emitters with many thousands of particles. Expired particles are
+   * removed by the calling thread afterwards.
+   *
+   * \param pool the thread pool that will be used.
+   * \param dt the time step, in seconds.
+   *
+   * \since 6.1.0
+   */
+  void update(thread_pool& pool, const float dt)
+  {
+    const auto level = detail::get_simd_level();
+    const auto particles = columns();
+    const auto parameters = step(dt);
+
+    parallel_for(pool,
+                 size_type{0},
+                 size(),
+                 size_type{0},
+                 [&](const size_type first, const size_type last) {
+                   detail::integrate_particles(level, particles, first, last, parameters);
+                 });
+
+    remove_expired();
+  }
+
+  /**
+   * \brief Removes all particles, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_xs.clear();
+    m_ys.clear();
+    m_vxs.clear();
+    m_vys.clear();
+    m_ages.clear();
+    m_lifetimes.clear();
+    m_sizes.clear();
+    m_colors.clear();
+  }
+
+  /**
+   * \brief Reserves space for a number of particles.
+   *
+   * \param capacity the amount of particles to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_xs.reserve(capacity);
+    m_ys.reserve(capacity);
+    m_vxs.reserve(capacity);
+    m_vys.reserve(capacity);
+    m_ages.reserve(capacity);
+    m_lifetimes.reserve(capacity);
+    m_sizes.reserve(capacity);
+    m_colors.reserve(capacity);
+  }
+
+  /// \} End of simulation
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /// \name Rendering
+  /// \{
+
+  /**
+   * \brief Renders all particles with a cutout of a texture.
+   *
+   * \tparam T the ownership tag of the renderer.
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param renderer the renderer that will be used.
+   * \param texture the texture that is rendered by the particles.
+   * \param source the cutout of the texture that is rendered by each particle.
+   *
+   * \return `success` if the particles were rendered, or if there are no particles;
+   * `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename U>
+  auto render(basic_renderer<T>& renderer,
+              const basic_texture<U>& texture,
+              const irect& source) -> result
+  {
+    if (empty())
+    {
+      return success;
+    }
+
+    const auto textureSize = texture.size();
+    const auto width = static_cast<float>(textureSize.width);
+    const auto height = static_cast<float>(textureSize.height);
+
+    build_vertices(static_cast<float>(source.x()) / width,
+                   static_cast<float>(source.y()) / height,
+                   static_cast<float>(source.max_x()) / width,
+                   static_cast<float>(source.max_y()) / height);
+
+    return renderer.render_geometry(texture.get(),
+                                    m_vertices.data(),
+                                    isize(m_vertices),
+                                    m_indices.data(),
+                                    static_cast<int>(size() * 6u));
+  }
+
+  /**
+   * \brief Renders all particles with an entire texture.
+   *
+   * \tparam T the ownership tag of the renderer.
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param renderer the renderer that will be used.
+   * \param texture the texture that is rendered by the particles.
+   *
+   * \return `success` if the particles were rendered, or if there are no particles;
+   * `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename U>
+  auto render(basic_renderer<T>& renderer, const basic_texture<U>& texture) -> result
+  {
+    return render(renderer, texture, irect{{}, texture.size()});
+  }
+
+  /// \} End of rendering
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /// \name Setters
+  /// \{
+
+  /**
+   * \brief Sets the acceleration that is applied to all particles, e.g. gravity.
+   *
+   * \param acceleration the acceleration, in units per second squared.
+   *
+   * \since 6.1.0
+   */
+  void set_acceleration(const fpoint acceleration) noexcept
+  {
+    m_acceleration = acceleration;
+  }
+
+  /**
+   * \brief Sets whether or not particles fade out over their lifetime.
+   *
+   * \param fade `true` if the alpha of particles should decrease with their age; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  void set_fade_out(const bool fade) noexcept
+  {
+    m_fadeOut = fade;
+  }
+
+  /// \} End of setters
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the acceleration that is applied to all particles.
+   *
+   * \details The default acceleration is zero.
+   *
+   * \return the acceleration, in units per second squared.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto acceleration() const noexcept -> fpoint
+  {
+    return m_acceleration;
+  }
+
+  /**
+   * \brief Indicates whether or not particles fade out over their lifetime.
+   *
+   * \details Particles don't fade out by default.
+   *
+   * \return `true` if particles fade out; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto fades_out() const noexcept -> bool
+  {
+    return m_fadeOut;
+  }
+
+  /**
+   * \brief Returns the current position of a particle.
+   *
+   * \param index the index of the particle, particles are ordered by their emission.
+   *
+   * \return the position of the center of the particle.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto position(const size_type index) const noexcept -> fpoint
+  {
+    assert(index < size());
+    return {m_xs[index], m_ys[index]};
+  }
+
+  /**
+   * \brief Returns the current velocity of a particle.
+   *
+   * \param index the index of the particle, particles are ordered by their emission.
+   *
+   * \return the velocity of the particle, in units per second.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto velocity(const size_type index) const noexcept -> fpoint
+  {
+    assert(index < size());
+    return {m_vxs[index], m_vys[index]};
+  }
+
+  /**
+   * \brief Returns the amount of particles that are alive.
+   *
+   * \return the amount of particles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_xs.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are no particles.
+   *
+   * \return `true` if there are no particles; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_xs.empty();
+  }
+
+  /// \} End of queries
+
+ private:
+  simd_vector<float> m_xs;
+  simd_vector<float> m_ys;
+  simd_vector<float> m_vxs;
+  simd_vector<float> m_vys;
+  simd_vector<float> m_ages;
+  simd_vector<float> m_lifetimes;
+  simd_vector<float> m_sizes;
+  simd_vector<SDL_Color> m_colors;
+  std::vector<SDL_Vertex> m_vertices;  // Reused between frames
+  std::vector<int> m_indices;          // Only grows, since the pattern never changes
+  fpoint m_acceleration;
+  bool m_fadeOut{};
+
+  [[nodiscard]] auto columns() noexcept -> detail::particle_columns
+  {
+    return {m_xs.data(), m_ys.data(), m_vxs.data(), m_vys.data(), m_ages.data()};
+  }
+
+  [[nodiscard]] auto step(const float dt) const noexcept -> detail::particle_step
+  {
+    return {dt, m_acceleration.x(), m_acceleration.y()};
+  }
+
+  void remove_expired() noexcept
+  {
+    const auto count = size();
+
+    // Compacts the live particles in place, which preserves their order
+    size_type live = 0;
+    for (size_type index = 0; index < count; ++index)
+    {
+      if (m_ages[index] >= m_lifetimes[index])
+      {
+        continue;
+      }
+
+      if (live != index)
+      {
+        m_xs[live] = m_xs[index];
+        m_ys[live] = m_ys[index];
+        m_vxs[live] = m_vxs[index];
+        m_vys[live] = m_vys[index];
+        m_ages[live] = m_ages[index];
+        m_lifetimes[live] = m_lifetimes[index];
+        m_sizes[live] = m_sizes[index];
+        m_colors[live] = m_colors[index];
+      }
+
+      ++live;
+    }
+
+    while (size() > live)
+    {
+      m_xs.pop_back();
+      m_ys.pop_back();
+      m_vxs.pop_back();
+      m_vys.pop_back();
+      m_ages.pop_back();
+      m_lifetimes.pop_back();
+      m_sizes.pop_back();
+      m_colors.pop_back();
+    }
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  void build_vertices(const float u0, const float v0, const float u1, const float v1)
+  {
+    const auto count = size();
+
+    m_vertices.resize(count * 4u);
+
+    for (size_type index = m_indices.size() / 6u; index < count; ++index)
+    {
+      const auto base = static_cast<int>(index * 4u);
+      m_indices.insert(m_indices.end(),
+                       {base, base + 1, base + 2, base + 2, base + 3, base});
+    }
+
+    for (size_type index = 0; index < count; ++index)
+    {
+      const auto half = m_sizes[index] * 0.5f;
+      const auto x0 = m_xs[index] - half;
+      const auto y0 = m_ys[index] - half;
+      const auto x1 = m_xs[index] + half;
+      const auto y1 = m_ys[index] + half;
+
+      auto tint = m_colors[index];
+      if (m_fadeOut)
+      {
+        const auto remaining = 1.0f - m_ages[index] / m_lifetimes[index];
+        tint.a = static_cast<u8>(static_cast<float>(tint.a) * remaining);
+      }
+
+      auto* quad = m_vertices.data() + index * 4u;
+      quad[0] = {{x0, y0}, tint, {u0, v0}};
+      quad[1] = {{x1, y0}, tint, {u1, v0}};
+      quad[2] = {{x1, y1}, tint, {u1, v1}};
+      quad[3] = {{x0, y1}, tint, {u0, v1}};
+    }
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PARTICLE_EMITTER_HEADER
@@ -0,0 +1,234 @@
+#ifndef CENTURION_PIXEL_CONVERSION_HEADER
+#define CENTURION_PIXEL_CONVERSION_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>  // size_t
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../math/area.hpp"
+#include "pixel_format.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \brief Indicates whether or not there is a fast conversion between two pixel formats.
+ *
+ * \details Fast conversions are provided between the 32-bit formats with 8-bit channels,
+ * i.e. `rgba8888`, `argb8888`, `abgr8888`, `bgra8888`, `rgb888`, `bgr888`, `rgbx8888` and
+ * `bgrx8888`. These conversions use SSE2, AVX2 or NEON instructions when they are
+ * supported by the CPU, which is determined at runtime.
+ *
+ * \param from the source pixel format.
+ * \param to the destination pixel format.
+ *
+ * \return `true` if `convert_pixels()` can convert between the formats without SDL;
+ * `false` otherwise.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto has_fast_conversion(const pixel_format from,
+                                              const pixel_format to) noexcept -> bool
+{
+  detail::channel_layout layout;
+  return detail::get_channel_layout(to_underlying(from), layout) &&
+         detail::get_channel_layout(to_underlying(to), layout);
+}
+
+/**
+ * \brief Converts a contiguous sequence of pixels between two pixel formats.
+ *
+ * \details The source and destination may refer to the same memory, in which case the
+ * pixels are converted in place. Conversions to formats without alpha drop the alpha
+ * values, and conversions from such formats produce opaque pixels.
+ *
+ * \param source the source pixels.
+ * \param sourceFormat the pixel format of the source pixels.
+ * \param destination the destination pixels, must be able to hold `count` pixels.
+ * \param destinationFormat the pixel format of the destination pixels.
+ * \param count the amount of pixels that will be converted.
+ *
+ * \return `success` if the pixels were converted; `failure` if there is no fast
+ * conversion between the formats.
+ *
+ * \see `has_fast_conversion()`
+ *
+ * \since 6.1.0
+ */
+inline auto convert_pixels(const void* source,
+                           const pixel_format sourceFormat,
+                           void* destination,
+                           const pixel_format destinationFormat,
+                           const std::size_t count) noexcept -> result
+{
+  detail::channel_layout from;
+  detail::channel_layout to;
+
+  if (!detail::get_channel_layout(to_underlying(sourceFormat), from) ||
+      !detail::get_channel_layout(to_underlying(destinationFormat), to))
+  {
+    return failure;
+  }
+
+  const auto* src = static_cast<const u32*>(source);
+  auto* dst = static_cast<u32*>(destination);
+
+  if (sourceFormat == destinationFormat)
+  {
+    if (src != dst)
+    {
+      SDL_memmove(dst, src, count * sizeof(u32));
+    }
+  }
+  else
+  {
+    const auto plan = detail::make_swizzle_plan(from, to);
+    detail::swizzle_kernel(plan, src, dst, count);
+  }
+
+  return success;
+}
+
+/**
+ * \brief Converts a block of pixels between two pixel formats.
+ *
+ * \details Fast conversions are used when available, see `has_fast_conversion()`, other
+ * formats are converted with `SDL_ConvertPixels()`.
+ *
+ * \param size the size of the block, in pixels.
+ * \param source the source pixels.
+ * \param sourcePitch the amount of bytes between consecutive rows of source pixels.
+ * \param sourceFormat the pixel format of the source pixels.
+ * \param destination the destination pixels.
+ * \param destinationPitch the amount of bytes between consecutive rows of destination
+ * pixels.
+ * \param destinationFormat the pixel format of the destination pixels.
+ *
+ * \return `success` if the pixels were converted; `failure` otherwise.
+ *
+ * \since 6.1.0
+ */
+inline auto convert_pixels(const iarea size,
+                           const void* source,
+                           const int sourcePitch,
+                           const pixel_format sourceFormat,
+                           void* destination,
+                           const int destinationPitch,
+                           const pixel_format destinationFormat) noexcept -> result
+{
+  if (!has_fast_conversion(sourceFormat, destinationFormat))
+  {
+    return SDL_ConvertPixels(size.width,
+                             size.height,
+                             to_underlying(sourceFormat),
+                             source,
+                             sourcePitch,
+                             to_underlying(destinationFormat),
+                             destination,
+                             destinationPitch) == 0;
+  }
+
+  const auto* src = static_cast<const u8*>(source);
+  auto* dst = static_cast<u8*>(destination);
+  const auto width = static_cast<std::size_t>(size.width);
+
+  for (int row = 0; row < size.height; ++row)
+  {
+    convert_pixels(src + row * sourcePitch,
+                   sourceFormat,
+                   dst + row * destinationPitch,
+                   destinationFormat,
+                   width);
+  }
+
+  return success;
+}
+
+/**
+ * \brief Multiplies the color channels of pixels by their alpha values, in place.
+ *
+ * \details Premultiplied alpha is required for correct filtering and blending of
+ * translucent images with some blend modes. Pixel formats without alpha are left
+ * untouched.
+ *
+ * \param pixels the pixels that will be modified.
+ * \param format the pixel format of the pixels, one of the 32-bit formats listed in
+ * `has_fast_conversion()`.
+ * \param count the amount of pixels.
+ *
+ * \return `success` if the pixels were premultiplied; `failure` if the pixel format
+ * isn't supported.
+ *
+ * \see `unpremultiply_alpha()`
+ *
+ * \since 6.1.0
+ */
+inline auto premultiply_alpha(void* pixels,
+                              const pixel_format format,
+                              const std::size_t count) noexcept -> result
+{
+  detail::channel_layout layout;
+  if (!detail::get_channel_layout(to_underlying(format), layout))
+  {
+    return failure;
+  }
+
+  if (!layout.opaque)
+  {
+    detail::premultiply_pixels(detail::get_simd_level(),
+                               layout,
+                               static_cast<u32*>(pixels),
+                               count);
+  }
+
+  return success;
+}
+
+/**
+ * \brief Divides the color channels of premultiplied pixels by their alpha values, in
+ * place.
+ *
+ * \details This reverts `premultiply_alpha()`, apart from the precision that was lost
+ * when premultiplying. Fully transparent pixels become transparent black.
+ *
+ * \param pixels the pixels that will be modified.
+ * \param format the pixel format of the pixels, one of the 32-bit formats listed in
+ * `has_fast_conversion()`.
+ * \param count the amount of pixels.
+ *
+ * \return `success` if the pixels were modified; `failure` if the pixel format isn't
+ * supported.
+ *
+ * \see `premultiply_alpha()`
+ *
+ * \since 6.1.0
+ */
+inline auto unpremultiply_alpha(void* pixels,
+                                const pixel_format format,
+                                const std::size_t count) noexcept -> result
+{
+  detail::channel_layout layout;
+  if (!detail::get_channel_layout(to_underlying(format), layout))
+  {
+    return failure;
+  }
+
+  if (!layout.opaque)
+  {
+    detail::unpremultiply_pixels(layout, static_cast<u32*>(pixels), count);
+  }
+
+  return success;
+}
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PIXEL_CONVERSION_HEADER
@@ -3,6 +3,8 @@
 
 #include <SDL.h>
 
+#include <cstddef>  // size_t
+
 #include "../core/czstring.hpp"
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
@@ -286,6 +288,80 @@ class basic_pixel_format_info final
     return SDL_MapRGBA(m_format, color.red(), color.green(), color.blue(), color.alpha());
   }
 
+  /**
+   * \brief Converts a sequence of colors to masked pixel values.
+   *
+   * \details For 32-bit formats with 8-bit components, the conversion is performed with
+   * plain shifts and masks instead of calling `SDL_MapRGBA()` for each color.
+   *
+   * \param colors the colors that will be converted.
+   * \param pixels the output pixel values, must have room for `count` values.
+   * \param count the amount of colors to convert.
+   *
+   * \since 6.1.0
+   */
+  void rgba_to_pixels(const color* colors, u32* pixels, const std::size_t count) const
+      noexcept
+  {
+    if (has_byte_components())
+    {
+      const auto& fmt = *m_format;
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const auto& c = colors[i];
+        pixels[i] = (u32{c.red()} << fmt.Rshift) | (u32{c.green()} << fmt.Gshift) |
+                    (u32{c.blue()} << fmt.Bshift) |
+                    ((u32{c.alpha()} << fmt.Ashift) & fmt.Amask);
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        pixels[i] = rgba_to_pixel(colors[i]);
+      }
+    }
+  }
+
+  /**
+   * \brief Converts a sequence of masked pixel values to colors.
+   *
+   * \details For 32-bit formats with 8-bit components, the conversion is performed with
+   * plain shifts and masks instead of calling `SDL_GetRGBA()` for each pixel. Formats
+   * without an alpha component result in opaque colors.
+   *
+   * \param pixels the pixel values that will be converted.
+   * \param colors the output colors, must have room for `count` colors.
+   * \param count the amount of pixels to convert.
+   *
+   * \since 6.1.0
+   */
+  void pixels_to_rgba(const u32* pixels, color* colors, const std::size_t count) const
+      noexcept
+  {
+    if (has_byte_components())
+    {
+      const auto& fmt = *m_format;
+      const auto opaque = (fmt.Amask == 0u);
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        const auto pixel = pixels[i];
+        colors[i] = color{static_cast<u8>((pixel & fmt.Rmask) >> fmt.Rshift),
+                          static_cast<u8>((pixel & fmt.Gmask) >> fmt.Gshift),
+                          static_cast<u8>((pixel & fmt.Bmask) >> fmt.Bshift),
+                          opaque ? u8{0xFF}
+                                 : static_cast<u8>((pixel & fmt.Amask) >> fmt.Ashift)};
+      }
+    }
+    else
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        colors[i] = pixel_to_rgba(pixels[i]);
+      }
+    }
+  }
+
   /// \} End of pixel/RGB/RGBA conversions
 
   /// \name Queries
@@ -361,8 +437,23 @@ class basic_pixel_format_info final
     }
   };
   detail::pointer_manager<B, SDL_PixelFormat, deleter> m_format;
+
+  /// Indicates whether pixels are 32-bit values with 8-bit components, ignoring padding.
+  [[nodiscard]] auto has_byte_components() const noexcept -> bool
+  {
+    const auto& fmt = *m_format;
+    return fmt.BytesPerPixel == 4 && fmt.Rloss == 0 && fmt.Gloss == 0 && fmt.Bloss == 0 &&
+           (fmt.Amask == 0u || fmt.Aloss == 0);
+  }
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_pixel_format_info<detail::owning_type>;
+extern template class basic_pixel_format_info<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
 /// \name Pixel format comparison operators
 /// \{
 
@@ -0,0 +1,722 @@
+#ifndef CENTURION_PIXEL_VIEW_HEADER
+#define CENTURION_PIXEL_VIEW_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // fill_n, min, max
+#include <cassert>    // assert
+#include <cstddef>    // size_t
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/// \cond FALSE
+namespace detail {
+
+// Converts colors to pixel values like SDL_MapRGBA, with the channel layout of the format
+// resolved once, so that non-indexed formats are converted inline
+struct pixel_encoder final
+{
+  const SDL_PixelFormat* format{};
+  u32 aMask{};
+  u8 rLoss{};
+  u8 gLoss{};
+  u8 bLoss{};
+  u8 aLoss{};
+  u8 rShift{};
+  u8 gShift{};
+  u8 bShift{};
+  u8 aShift{};
+  bool indexed{};
+
+  explicit pixel_encoder(const SDL_PixelFormat* fmt) noexcept
+      : format{fmt}
+      , aMask{fmt->Amask}
+      , rLoss{fmt->Rloss}
+      , gLoss{fmt->Gloss}
+      , bLoss{fmt->Bloss}
+      , aLoss{fmt->Aloss}
+      , rShift{fmt->Rshift}
+      , gShift{fmt->Gshift}
+      , bShift{fmt->Bshift}
+      , aShift{fmt->Ashift}
+      , indexed{fmt->palette != nullptr}
+  {}
+
+  [[nodiscard]] auto encode(const color& c) const noexcept -> u32
+  {
+    return indexed ? SDL_MapRGBA(format, c.red(), c.green(), c.blue(), c.alpha())
+                   : encode_direct(c);
+  }
+
+  // Only valid for formats without a palette
+  [[nodiscard]] auto encode_direct(const color& c) const noexcept -> u32
+  {
+    return (u32{static_cast<u8>(c.red() >> rLoss)} << rShift) |
+           (u32{static_cast<u8>(c.green() >> gLoss)} << gShift) |
+           (u32{static_cast<u8>(c.blue() >> bLoss)} << bShift) |
+           ((u32{static_cast<u8>(c.alpha() >> aLoss)} << aShift) & aMask);
+  }
+};
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class pixel_row
+ *
+ * \brief A non-owning view of a single row of pixels.
+ *
+ * \tparam Pixel the type of the pixel values, e.g. `u32` for 32-bit formats.
+ *
+ * \see `pixel_view`
+ *
+ * \since 6.1.0
+ */
+template <typename Pixel>
+class pixel_row final
+{
+ public:
+  using value_type = Pixel;
+  using iterator = Pixel*;
+
+  constexpr pixel_row(Pixel* data, const int width) noexcept
+      : m_data{data}
+      , m_width{width}
+  {}
+
+  [[nodiscard]] constexpr auto operator[](const int x) const noexcept -> Pixel&
+  {
+    assert(x >= 0 && x < m_width);
+    return m_data[x];
+  }
+
+  [[nodiscard]] constexpr auto begin() const noexcept -> iterator
+  {
+    return m_data;
+  }
+
+  [[nodiscard]] constexpr auto end() const noexcept -> iterator
+  {
+    return m_data + m_width;
+  }
+
+  [[nodiscard]] constexpr auto data() const noexcept -> Pixel*
+  {
+    return m_data;
+  }
+
+  [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+  {
+    return static_cast<std::size_t>(m_width);
+  }
+
+ private:
+  Pixel* m_data{};
+  int m_width{};
+};
+
+/**
+ * \class pixel_view
+ *
+ * \brief Provides efficient access to the pixels of a surface or streaming texture.
+ *
+ * \details A pixel view locks its surface or texture once upon construction and unlocks
+ * it upon destruction, so that any amount of pixels can be accessed in between. This is
+ * much faster than repeated calls to `set_pixel()`, which locks, converts and unlocks for
+ * every pixel.
+ *
+ * \details Rows are exposed as typed spans that honor the pitch of the pixel data, and
+ * the view provides bulk operations such as `fill()`, `copy_rect()` and `write_row()`.
+ *
+ * \details The channel layout of the pixel format is resolved when the view is created,
+ * after which colors are converted inline, without calling into SDL, unless the format
+ * is indexed. Procedural content is best written with `generate()`, which selects a
+ * writer for the size of the pixels once, rather than for every pixel.
+ *
+ * \note Locked texture memory is write-only, so the pixels of a texture view must not be
+ * read before they have been written.
+ *
+ * \since 6.1.0
+ */
+class pixel_view final
+{
+ public:
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Locks a surface and creates a view of its pixels.
+   *
+   * \tparam T the ownership tag of the surface.
+   *
+   * \param surface the surface that will be locked, must outlive the view.
+   *
+   * \throws sdl_error if the surface couldn't be locked.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  explicit pixel_view(basic_surface<T>& surface)
+      : m_info{surface.format_info().format()}
+      , m_encoder{m_info.get()}
+      , m_size{surface.size()}
+  {
+    auto* ptr = surface.get();
+    if (SDL_MUSTLOCK(ptr))
+    {
+      if (SDL_LockSurface(ptr) != 0)
+      {
+        throw sdl_error{};
+      }
+
+      m_surface = ptr;
+    }
+
+    m_pixels = static_cast<u8*>(ptr->pixels);
+    m_pitch = ptr->pitch;
+  }
+
+  /**
+   * \brief Locks a streaming texture and creates a view of its pixels.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be locked, must outlive the view.
+   *
+   * \throws sdl_error if the texture couldn't be locked, e.g. if it doesn't have
+   * `streaming` texture access.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  explicit pixel_view(basic_texture<T>& texture)
+      : m_info{texture.format()}
+      , m_encoder{m_info.get()}
+      , m_size{texture.size()}
+  {
+    void* pixels{};
+    if (SDL_LockTexture(texture.get(), nullptr, &pixels, &m_pitch) != 0)
+    {
+      throw sdl_error{};
+    }
+
+    m_texture = texture.get();
+    m_pixels = static_cast<u8*>(pixels);
+  }
+
+  pixel_view(const pixel_view&) = delete;
+
+  auto operator=(const pixel_view&) -> pixel_view& = delete;
+
+  /**
+   * \brief Unlocks the associated surface or texture.
+   *
+   * \since 6.1.0
+   */
+  ~pixel_view() noexcept
+  {
+    if (m_texture)
+    {
+      SDL_UnlockTexture(m_texture);
+    }
+    else if (m_surface)
+    {
+      SDL_UnlockSurface(m_surface);
+    }
+  }
+
+  /// \} End of construction/destruction
+
+  /// \name Pixel access
+  /// \{
+
+  /**
+   * \brief Returns a view of a row of pixels.
+   *
+   * \pre The size of the pixel type must match the amount of bytes per pixel.
+   * \pre The row index must be in the range [0, height).
+   *
+   * \tparam Pixel the type of the pixel values, e.g. `u32` for 32-bit formats.
+   *
+   * \param y the index of the row.
+   *
+   * \return a view of the row.
+   *
+   * \since 6.1.0
+   */
+  template <typename Pixel = u32>
+  [[nodiscard]] auto row(const int y) noexcept -> pixel_row<Pixel>
+  {
+    assert(sizeof(Pixel) == bytes_per_pixel());
+    assert(y >= 0 && y < m_size.height);
+    return {reinterpret_cast<Pixel*>(m_pixels + y * m_pitch), m_size.width};
+  }
+
+  /// \copydoc row()
+  template <typename Pixel = u32>
+  [[nodiscard]] auto row(const int y) const noexcept -> pixel_row<const Pixel>
+  {
+    assert(sizeof(Pixel) == bytes_per_pixel());
+    assert(y >= 0 && y < m_size.height);
+    return {reinterpret_cast<const Pixel*>(m_pixels + y * m_pitch), m_size.width};
+  }
+
+  /**
+   * \brief Sets the color of a pixel.
+   *
+   * \pre The pixel must be within the bounds of the view.
+   *
+   * \param pixel the coordinate of the pixel.
+   * \param color the new color of the pixel.
+   *
+   * \since 6.1.0
+   */
+  void set_pixel(const ipoint pixel, const color& color) noexcept
+  {
+    assert(in_bounds(pixel));
+    store(address(pixel.x(), pixel.y()), m_encoder.encode(color));
+  }
+
+  /**
+   * \brief Returns the color of a pixel.
+   *
+   * \pre The pixel must be within the bounds of the view.
+   *
+   * \param pixel the coordinate of the pixel.
+   *
+   * \return the color of the pixel.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_pixel(const ipoint pixel) const noexcept -> color
+  {
+    assert(in_bounds(pixel));
+    return m_info.pixel_to_rgba(load(address(pixel.x(), pixel.y())));
+  }
+
+  /// \} End of pixel access
+
+  /// \name Bulk operations
+  /// \{
+
+  /**
+   * \brief Sets the color of all pixels in an area.
+   *
+   * \details The area is clipped to the bounds of the view. The color is converted once,
+   * after which the pixel value is written to every pixel in the area.
+   *
+   * \param area the area that will be filled.
+   * \param color the color that will be used.
+   *
+   * \since 6.1.0
+   */
+  void fill(const irect& area, const color& color) noexcept
+  {
+    const auto clipped = clip(area);
+    if (!clipped.has_area())
+    {
+      return;
+    }
+
+    const auto value = m_encoder.encode(color);
+    for (auto y = clipped.y(); y < clipped.max_y(); ++y)
+    {
+      if (bytes_per_pixel() == 4)
+      {
+        std::fill_n(reinterpret_cast<u32*>(address(clipped.x(), y)),
+                    clipped.width(),
+                    value);
+      }
+      else
+      {
+        for (auto x = clipped.x(); x < clipped.max_x(); ++x)
+        {
+          store(address(x, y), value);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Sets the color of all pixels.
+   *
+   * \param color the color that will be used.
+   *
+   * \since 6.1.0
+   */
+  void fill(const color& color) noexcept
+  {
+    fill(irect{{0, 0}, m_size}, color);
+  }
+
+  /**
+   * \brief Sets the color of every pixel in an area to the color returned by a function.
+   *
+   * \details This is the fastest way to write procedural content, since the writer for
+   * the size of the pixels is selected once, and the colors are converted inline without
+   * any locking or format lookups, see `pixel_view`. The area is clipped to the bounds of
+   * the view, and the pixels are visited row by row.
+   * \code{cpp}
+   *   cen::pixel_view view{surface};
+   *   view.generate([](const cen::ipoint pixel) {
+   *     const auto shade = static_cast<cen::u8>(pixel.x() ^ pixel.y());
+   *     return cen::color{shade, shade, shade};
+   *   });
+   * \endcode
+   *
+   * \tparam Generator the type of the function object, invocable with an `ipoint` and
+   * returning a `color`.
+   *
+   * \param area the area that will be written.
+   * \param generator the function object that returns the color of a pixel.
+   *
+   * \since 6.1.0
+   */
+  template <typename Generator>
+  void generate(const irect& area, Generator&& generator)
+  {
+    const auto clipped = clip(area);
+    if (!clipped.has_area())
+    {
+      return;
+    }
+
+    switch (bytes_per_pixel())
+    {
+      case 1:
+        generate_with<1>(clipped, generator);
+        break;
+
+      case 2:
+        generate_with<2>(clipped, generator);
+        break;
+
+      case 3:
+        generate_with<3>(clipped, generator);
+        break;
+
+      default:
+        generate_with<4>(clipped, generator);
+        break;
+    }
+  }
+
+  /**
+   * \brief Sets the color of every pixel to the color returned by a function.
+   *
+   * \copydetails generate(const irect&, Generator&&)
+   *
+   * \tparam Generator the type of the function object, invocable with an `ipoint` and
+   * returning a `color`.
+   *
+   * \param generator the function object that returns the color of a pixel.
+   *
+   * \since 6.1.0
+   */
+  template <typename Generator>
+  void generate(Generator&& generator)
+  {
+    generate(irect{{0, 0}, m_size}, generator);
+  }
+
+  /**
+   * \brief Copies an area of pixels from another view.
+   *
+   * \details The pixels are copied row by row, without any blending or conversion. The
+   * area is clipped to the bounds of both views.
+   *
+   * \pre The views must have the same pixel format.
+   *
+   * \param source the view that will be copied from, may be the same view as long as the
+   * areas don't overlap.
+   * \param area the area of the source view that will be copied.
+   * \param position the position in this view that the area will be copied to.
+   *
+   * \since 6.1.0
+   */
+  void copy_rect(const pixel_view& source, irect area, ipoint position) noexcept
+  {
+    assert(format() == source.format());
+
+    // Clip against the destination view, then against the source view
+    area = source.clip(area);
+
+    const auto dst = clip(irect{position, area.size()});
+    const ipoint offset{dst.x() - position.x(), dst.y() - position.y()};
+    area = irect{{area.x() + offset.x(), area.y() + offset.y()}, dst.size()};
+
+    if (!area.has_area())
+    {
+      return;
+    }
+
+    const auto bytes = static_cast<std::size_t>(area.width()) * bytes_per_pixel();
+    for (int row = 0; row < area.height(); ++row)
+    {
+      SDL_memcpy(address(dst.x(), dst.y() + row),
+                 source.address(area.x(), area.y() + row),
+                 bytes);
+    }
+  }
+
+  /**
+   * \brief Writes a sequence of colors to a row, starting at the specified pixel.
+   *
+   * \details The colors are converted in bulk, see `pixel_format_info::rgba_to_pixels()`.
+   * Colors that would end up outside of the row are ignored.
+   *
+   * \pre The pixel format must use 32-bit pixels.
+   *
+   * \param position the first pixel that will be written.
+   * \param colors the colors that will be written.
+   * \param count the amount of colors.
+   *
+   * \since 6.1.0
+   */
+  void write_row(const ipoint position, const color* colors, std::size_t count) noexcept
+  {
+    assert(bytes_per_pixel() == 4);
+
+    if (position.y() < 0 || position.y() >= m_size.height || position.x() < 0 ||
+        position.x() >= m_size.width)
+    {
+      return;
+    }
+
+    const auto available = static_cast<std::size_t>(m_size.width - position.x());
+    count = (std::min)(count, available);
+
+    auto* pixels = reinterpret_cast<u32*>(address(position.x(), position.y()));
+    m_info.rgba_to_pixels(colors, pixels, count);
+  }
+
+  /**
+   * \brief Reads a sequence of colors from a row, starting at the specified pixel.
+   *
+   * \pre The pixel format must use 32-bit pixels.
+   * \pre The pixels must be within the bounds of the view.
+   *
+   * \param position the first pixel that will be read.
+   * \param colors the output colors, must have room for `count` colors.
+   * \param count the amount of colors.
+   *
+   * \since 6.1.0
+   */
+  void read_row(const ipoint position, color* colors, const std::size_t count) const
+      noexcept
+  {
+    assert(bytes_per_pixel() == 4);
+    assert(in_bounds(position));
+    assert(static_cast<std::size_t>(m_size.width - position.x()) >= count);
+
+    const auto* src = address(position.x(), position.y());
+    const auto* pixels = reinterpret_cast<const u32*>(src);
+    m_info.pixels_to_rgba(pixels, colors, count);
+  }
+
+  /// \} End of bulk operations
+
+  /// \name Queries
+  /// \{
+
+  [[nodiscard]] auto data() noexcept -> void*
+  {
+    return m_pixels;
+  }
+
+  [[nodiscard]] auto data() const noexcept -> const void*
+  {
+    return m_pixels;
+  }
+
+  [[nodiscard]] auto pitch() const noexcept -> int
+  {
+    return m_pitch;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return m_size.width;
+  }
+
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return m_size.height;
+  }
+
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    return m_info.format();
+  }
+
+  [[nodiscard]] auto bytes_per_pixel() const noexcept -> std::size_t
+  {
+    return m_info.get()->BytesPerPixel;
+  }
+
+  [[nodiscard]] auto in_bounds(const ipoint pixel) const noexcept -> bool
+  {
+    return pixel.x() >= 0 && pixel.y() >= 0 && pixel.x() < m_size.width &&
+           pixel.y() < m_size.height;
+  }
+
+  /// \} End of queries
+
+ private:
+  pixel_format_info m_info;
+  detail::pixel_encoder m_encoder;
+  iarea m_size;
+  u8* m_pixels{};
+  int m_pitch{};
+  SDL_Surface* m_surface{};  // Only set if the surface had to be locked
+  SDL_Texture* m_texture{};
+
+  [[nodiscard]] auto address(const int x, const int y) const noexcept -> u8*
+  {
+    return m_pixels + y * m_pitch + x * static_cast<int>(bytes_per_pixel());
+  }
+
+  [[nodiscard]] auto clip(const irect& area) const noexcept -> irect
+  {
+    const auto x = (std::max)(area.x(), 0);
+    const auto y = (std::max)(area.y(), 0);
+    const auto maxX = (std::min)(area.max_x(), m_size.width);
+    const auto maxY = (std::min)(area.max_y(), m_size.height);
+    return irect{{x, y}, {(std::max)(maxX - x, 0), (std::max)(maxY - y, 0)}};
+  }
+
+  template <std::size_t Bytes>
+  static void store_as(u8* dst, const u32 value) noexcept
+  {
+    if constexpr (Bytes == 1)
+    {
+      *dst = static_cast<u8>(value);
+    }
+    else if constexpr (Bytes == 2)
+    {
+      *reinterpret_cast<u16*>(dst) = static_cast<u16>(value);
+    }
+    else if constexpr (Bytes == 3)
+    {
+      if constexpr (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+      {
+        dst[0] = static_cast<u8>(value);
+        dst[1] = static_cast<u8>(value >> 8u);
+        dst[2] = static_cast<u8>(value >> 16u);
+      }
+      else
+      {
+        dst[0] = static_cast<u8>(value >> 16u);
+        dst[1] = static_cast<u8>(value >> 8u);
+        dst[2] = static_cast<u8>(value);
+      }
+    }
+    else
+    {
+      *reinterpret_cast<u32*>(dst) = value;
+    }
+  }
+
+  void store(u8* dst, const u32 value) const noexcept
+  {
+    switch (bytes_per_pixel())
+    {
+      case 1:
+        store_as<1>(dst, value);
+        break;
+
+      case 2:
+        store_as<2>(dst, value);
+        break;
+
+      case 3:
+        store_as<3>(dst, value);
+        break;
+
+      default:
+        store_as<4>(dst, value);
+        break;
+    }
+  }
+
+  template <std::size_t Bytes, typename Generator>
+  void generate_with(const irect& area, Generator& generator)
+  {
+    // The encoder is copied, since the pixel stores could otherwise alias its fields
+    const auto encoder = m_encoder;
+    if (encoder.indexed)
+    {
+      generate_rows<Bytes>(area, generator, [&encoder](const color& c) noexcept {
+        return encoder.encode(c);
+      });
+    }
+    else
+    {
+      generate_rows<Bytes>(area, generator, [&encoder](const color& c) noexcept {
+        return encoder.encode_direct(c);
+      });
+    }
+  }
+
+  template <std::size_t Bytes, typename Generator, typename Encode>
+  void generate_rows(const irect& area, Generator& generator, const Encode& encode)
+  {
+    for (auto y = area.y(); y < area.max_y(); ++y)
+    {
+      auto* dst = address(area.x(), y);
+      for (auto x = area.x(); x < area.max_x(); ++x, dst += Bytes)
+      {
+        store_as<Bytes>(dst, encode(generator(ipoint{x, y})));
+      }
+    }
+  }
+
+  [[nodiscard]] auto load(const u8* src) const noexcept -> u32
+  {
+    switch (bytes_per_pixel())
+    {
+      case 1:
+        return *src;
+
+      case 2:
+        return *reinterpret_cast<const u16*>(src);
+
+      case 3:
+        if constexpr (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+        {
+          return u32{src[0]} | (u32{src[1]} << 8u) | (u32{src[2]} << 16u);
+        }
+        else
+        {
+          return (u32{src[0]} << 16u) | (u32{src[1]} << 8u) | u32{src[2]};
+        }
+
+      default:
+        return *reinterpret_cast<const u32*>(src);
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_PIXEL_VIEW_HEADER
@@ -0,0 +1,667 @@
+#ifndef CENTURION_RENDER_COMMAND_BUFFER_HEADER
+#define CENTURION_RENDER_COMMAND_BUFFER_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>   // stable_sort
+#include <cassert>     // assert
+#include <cmath>       // hypot, atan2
+#include <cstddef>     // size_t
+#include <functional>  // less
+#include <vector>      // vector
+
+#include "../core/integers.hpp"
+#include "../core/macros.hpp"
+#include "../core/result.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../math/transform2d.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+#include <memory_resource>  // memory_resource, polymorphic_allocator
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum render_command_type
+ *
+ * \brief Provides identifiers for the different kinds of recorded render commands.
+ *
+ * \see `render_command`
+ *
+ * \since 6.1.0
+ */
+enum class render_command_type : u8
+{
+  texture,    ///< Renders (a part of) a texture.
+  fill_rect,  ///< Renders a filled rectangle.
+  draw_rect,  ///< Renders the outline of a rectangle.
+  draw_line   ///< Renders a line.
+};
+
+/**
+ * \struct render_command
+ *
+ * \brief Represents a single recorded draw command.
+ *
+ * \details Commands are plain data, they only store the texture pointer and never call
+ * into SDL, which is what makes it possible to record them on any thread. Lines store
+ * their start point as the position and their end point as the size of `destination`.
+ *
+ * \note Tinted textures have their previous color and alpha modulation restored after
+ * being rendered.
+ *
+ * \see `render_command_buffer`
+ *
+ * \since 6.1.0
+ */
+struct render_command final
+{
+  render_command_type type{render_command_type::texture};  ///< The kind of command.
+  int layer{};                          ///< Lower layers are rendered first.
+  SDL_Texture* texture{};               ///< The texture, null for primitives.
+  blend_mode mode{blend_mode::blend};   ///< The blend mode used by the command.
+  irect source{};                       ///< The texture cutout, empty for all of it.
+  frect destination{};                  ///< The destination, or the line end points.
+  color tint{colors::white};            ///< The draw color, or the texture modulation.
+  double angle{};                       ///< The clockwise rotation, in degrees.
+  SDL_RendererFlip flip{SDL_FLIP_NONE};  ///< The flip of rendered textures.
+  bool latched{};                       ///< Follows the mouse, see `mouse_latch`.
+};
+
+/**
+ * \class render_command_buffer
+ *
+ * \brief A list of deferred draw commands that can be recorded without touching SDL.
+ *
+ * \details A render command buffer records draw commands into its own storage, without
+ * calling any SDL functions. As a result, worker threads can each fill a separate
+ * buffer in parallel, e.g. as part of scene traversal and culling. The render thread
+ * then appends the buffers into a single buffer, sorts it, and replays it with
+ * `submit()`.
+ *
+ * \note A single buffer must not be modified by several threads at the same time, use
+ * one buffer per thread instead.
+ *
+ * \details Textures referenced by recorded commands must outlive the submission of the
+ * buffer.
+ *
+ * \details The commands are stored in memory allocated from a
+ * `std::pmr::memory_resource`, which defaults to `std::pmr::get_default_resource()`. Like
+ * the `std::pmr` containers, copies use the default resource, whereas moves keep the
+ * resource of the moved buffer.
+ *
+ * \details Recorded buffers are usually discarded after each frame, which makes them a
+ * good fit for arenas. Since arenas aren't thread-safe, each worker thread should record
+ * into buffers backed by an arena of its own, which is reset once the buffers of the
+ * frame have been destroyed.
+ * \code{cpp}
+ *   // Owned by each worker thread, and reused between frames
+ *   cen::frame_resource arena;
+ *
+ *   {
+ *     cen::render_command_buffer commands{&arena};
+ *     // Record commands and hand the buffer over to the render thread...
+ *   }
+ *
+ *   arena.reset();
+ * \endcode
+ *
+ * \note Memory resources are only available if `CENTURION_HAS_STD_MEMORY_RESOURCE` is
+ * defined, otherwise the commands are stored on the global heap.
+ *
+ * \see `render_command`
+ *
+ * \since 6.1.0
+ */
+class render_command_buffer final
+{
+ public:
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  using command_list = std::pmr::vector<render_command>;
+#else
+  using command_list = std::vector<render_command>;
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  using value_type = render_command;
+  using size_type = std::size_t;
+  using const_iterator = command_list::const_iterator;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty command buffer.
+   *
+   * \since 6.1.0
+   */
+  render_command_buffer() = default;
+
+  /**
+   * \brief Creates an empty command buffer with space reserved for a number of commands.
+   *
+   * \param capacity the amount of commands to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  explicit render_command_buffer(const size_type capacity)
+  {
+    m_commands.reserve(capacity);
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Creates an empty command buffer that allocates memory from a resource.
+   *
+   * \param resource the memory resource, must outlive the buffer.
+   *
+   * \since 6.1.0
+   */
+  explicit render_command_buffer(std::pmr::memory_resource* resource) noexcept
+      : m_commands{resource}
+  {
+    assert(resource);
+  }
+
+  /**
+   * \brief Creates an empty command buffer that allocates memory from a resource, with
+   * space reserved for a number of commands.
+   *
+   * \param capacity the amount of commands to reserve space for.
+   * \param resource the memory resource, must outlive the buffer.
+   *
+   * \since 6.1.0
+   */
+  render_command_buffer(const size_type capacity, std::pmr::memory_resource* resource)
+      : m_commands{resource}
+  {
+    assert(resource);
+    m_commands.reserve(capacity);
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /// \} End of construction
+
+  /// \name Recording
+  /// \{
+
+  /**
+   * \brief Records the rendering of a part of a texture.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param source the cutout of the texture that will be rendered.
+   * \param destination the position and size of the rendered texture.
+   * \param mode the blend mode that will be applied to the texture.
+   * \param layer the layer of the command, lower layers are rendered first.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void render(const basic_texture<T>& texture,
+              const irect& source,
+              const frect& destination,
+              const blend_mode mode = blend_mode::blend,
+              const int layer = 0)
+  {
+    auto& cmd = m_commands.emplace_back();
+    cmd.type = render_command_type::texture;
+    cmd.layer = layer;
+    cmd.texture = texture.get();
+    cmd.mode = mode;
+    cmd.source = source;
+    cmd.destination = destination;
+  }
+
+  /**
+   * \brief Records the rendering of an entire texture.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param destination the position and size of the rendered texture.
+   * \param mode the blend mode that will be applied to the texture.
+   * \param layer the layer of the command, lower layers are rendered first.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void render(const basic_texture<T>& texture,
+              const frect& destination,
+              const blend_mode mode = blend_mode::blend,
+              const int layer = 0)
+  {
+    render(texture, irect{}, destination, mode, layer);
+  }
+
+  /**
+   * \brief Records an arbitrary command.
+   *
+   * \details This function can be used to record rotated, flipped or tinted textures.
+   *
+   * \param command the command that will be recorded.
+   *
+   * \since 6.1.0
+   */
+  void push(const render_command& command)
+  {
+    m_commands.push_back(command);
+  }
+
+  /**
+   * \brief Records the rendering of a filled rectangle.
+   *
+   * \param rect the rectangle that will be rendered.
+   * \param color the color of the rectangle.
+   * \param layer the layer of the command, lower layers are rendered first.
+   *
+   * \since 6.1.0
+   */
+  void fill_rect(const frect& rect, const color& color, const int layer = 0)
+  {
+    push_primitive(render_command_type::fill_rect, rect, color, layer);
+  }
+
+  /**
+   * \brief Records the rendering of the outline of a rectangle.
+   *
+   * \param rect the rectangle that will be rendered.
+   * \param color the color of the rectangle.
+   * \param layer the layer of the command, lower layers are rendered first.
+   *
+   * \since 6.1.0
+   */
+  void draw_rect(const frect& rect, const color& color, const int layer = 0)
+  {
+    push_primitive(render_command_type::draw_rect, rect, color, layer);
+  }
+
+  /**
+   * \brief Records the rendering of a line.
+   *
+   * \param start the start point of the line.
+   * \param end the end point of the line.
+   * \param color the color of the line.
+   * \param layer the layer of the command, lower layers are rendered first.
+   *
+   * \since 6.1.0
+   */
+  void draw_line(const fpoint start,
+                 const fpoint end,
+                 const color& color,
+                 const int layer = 0)
+  {
+    const frect points{{start.x(), start.y()}, {end.x(), end.y()}};
+    push_primitive(render_command_type::draw_line, points, color, layer);
+  }
+
+  /**
+   * \brief Appends all commands of another buffer to this buffer.
+   *
+   * \details This is intended to be used by the render thread to gather the buffers
+   * that were recorded by worker threads.
+   *
+   * \param other the buffer that will be appended.
+   *
+   * \since 6.1.0
+   */
+  void append(const render_command_buffer& other)
+  {
+    m_commands.insert(m_commands.end(), other.m_commands.begin(), other.m_commands.end());
+  }
+
+  /**
+   * \brief Sorts the commands by layer, texture and blend mode.
+   *
+   * \details The sort is stable, so commands with the same key keep their recorded order.
+   * Since the texture pointer is part of the key, commands in the same layer are assumed
+   * not to depend on each others draw order.
+   *
+   * \since 6.1.0
+   */
+  void sort()
+  {
+    std::stable_sort(m_commands.begin(), m_commands.end(), precedes);
+  }
+
+  /**
+   * \brief Applies a transform to the destinations of all commands, e.g. a camera.
+   *
+   * \details Line end points are transformed exactly. Rectangles keep their orientation,
+   * their centers are transformed and their sizes are scaled by the axis scales of the
+   * transform. The rotation of the transform is added to the angle of texture commands,
+   * whereas filled and outlined rectangles can't be rotated. Shears are ignored.
+   *
+   * \param transform the transform that will be applied.
+   *
+   * \since 6.1.0
+   */
+  void transform(const transform2d& transform)
+  {
+    if (transform == transform2d{})
+    {
+      return;
+    }
+
+    const auto scaleX = std::hypot(transform.a(), transform.b());
+    const auto scaleY = std::hypot(transform.c(), transform.d());
+    constexpr auto degrees_per_radian = 57.2957795f;
+    const auto degrees = std::atan2(transform.b(), transform.a()) * degrees_per_radian;
+
+    for (auto& cmd : m_commands)
+    {
+      auto& dst = cmd.destination;
+      if (cmd.type == render_command_type::draw_line)
+      {
+        const auto from = transform.apply({dst.x(), dst.y()});
+        const auto to = transform.apply({dst.width(), dst.height()});
+        dst = frect{from.x(), from.y(), to.x(), to.y()};
+      }
+      else
+      {
+        const auto center = transform.apply(dst.center());
+        const auto width = dst.width() * scaleX;
+        const auto height = dst.height() * scaleY;
+        dst = frect{center.x() - (width / 2.0f),
+                    center.y() - (height / 2.0f),
+                    width,
+                    height};
+
+        if (cmd.type == render_command_type::texture)
+        {
+          cmd.angle += static_cast<double>(degrees);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Marks the most recently recorded command as attached to the mouse cursor.
+   *
+   * \details Latched commands are moved by `offset_latched()`, which is used by
+   * `mouse_latch` to move them to the latest mouse position just before rendering, e.g.
+   * for cursor sprites and drag previews. This function has no effect if the buffer is
+   * empty.
+   *
+   * \since 6.1.0
+   */
+  void latch_last() noexcept
+  {
+    if (!m_commands.empty())
+    {
+      m_commands.back().latched = true;
+    }
+  }
+
+  /**
+   * \brief Moves the destinations of all latched commands.
+   *
+   * \param offset the offset that will be added to the destinations.
+   *
+   * \return the amount of moved commands.
+   *
+   * \see `latch_last()`
+   *
+   * \since 6.1.0
+   */
+  auto offset_latched(const fpoint offset) noexcept -> size_type
+  {
+    size_type count = 0;
+    for (auto& cmd : m_commands)
+    {
+      if (cmd.latched)
+      {
+        auto& dst = cmd.destination;
+        dst.set_x(dst.x() + offset.x());
+        dst.set_y(dst.y() + offset.y());
+
+        // Lines store their end point as the size
+        if (cmd.type == render_command_type::draw_line)
+        {
+          dst.set_width(dst.width() + offset.x());
+          dst.set_height(dst.height() + offset.y());
+        }
+
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Removes all commands, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_commands.clear();
+  }
+
+  /// \} End of recording
+
+  /**
+   * \brief Replays the recorded commands using a renderer.
+   *
+   * \details The commands are rendered in their current order, call `sort()` first to
+   * minimize the amount of texture and blend mode changes. The draw color and blend mode
+   * of the renderer are restored afterwards.
+   *
+   * \pre This function must be called on the thread that owns the renderer.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all commands were rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto submit(basic_renderer<T>& renderer) const -> result
+  {
+    const auto oldColor = renderer.get_color();
+    const auto oldMode = renderer.get_blend_mode();
+
+    bool ok = true;
+    SDL_Texture* texture{};
+    auto mode = blend_mode::invalid;
+
+    for (const auto& cmd : m_commands)
+    {
+      if (cmd.type == render_command_type::texture)
+      {
+        if (cmd.texture != texture || cmd.mode != mode)
+        {
+          texture = cmd.texture;
+          mode = cmd.mode;
+          SDL_SetTextureBlendMode(texture, static_cast<SDL_BlendMode>(mode));
+        }
+
+        ok &= submit_texture(renderer, cmd);
+      }
+      else
+      {
+        texture = nullptr;
+        renderer.set_color(cmd.tint);
+        renderer.set_blend_mode(cmd.mode);
+        ok &= static_cast<bool>(submit_primitive(renderer, cmd));
+      }
+    }
+
+    renderer.set_color(oldColor);
+    renderer.set_blend_mode(oldMode);
+
+    return ok;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of recorded commands.
+   *
+   * \return the amount of commands.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_commands.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the buffer is empty.
+   *
+   * \return `true` if there are no recorded commands; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_commands.empty();
+  }
+
+  [[nodiscard]] auto begin() const noexcept -> const_iterator
+  {
+    return m_commands.begin();
+  }
+
+  [[nodiscard]] auto end() const noexcept -> const_iterator
+  {
+    return m_commands.end();
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Returns the memory resource that the commands are allocated from.
+   *
+   * \return a pointer to the memory resource.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_resource() const noexcept -> std::pmr::memory_resource*
+  {
+    return m_commands.get_allocator().resource();
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /// \} End of queries
+
+ private:
+  command_list m_commands;
+
+  // Unrelated pointers can't be compared with the built-in operators
+  [[nodiscard]] static auto precedes(const render_command& a,
+                                     const render_command& b) noexcept -> bool
+  {
+    if (a.layer != b.layer)
+    {
+      return a.layer < b.layer;
+    }
+    else if (a.texture != b.texture)
+    {
+      return std::less<const SDL_Texture*>{}(a.texture, b.texture);
+    }
+    else
+    {
+      return a.mode < b.mode;
+    }
+  }
+
+  void push_primitive(const render_command_type type,
+                      const frect& rect,
+                      const color& color,
+                      const int layer)
+  {
+    auto& cmd = m_commands.emplace_back();
+    cmd.type = type;
+    cmd.layer = layer;
+    cmd.destination = rect;
+    cmd.tint = color;
+  }
+
+  template <typename T>
+  [[nodiscard]] static auto submit_texture(basic_renderer<T>& renderer,
+                                           const render_command& cmd) -> bool
+  {
+    const auto* source = cmd.source.has_area() ? cmd.source.data() : nullptr;
+
+    u8 red = 0xFF;
+    u8 green = 0xFF;
+    u8 blue = 0xFF;
+    u8 alpha = 0xFF;
+
+    const auto tinted = cmd.tint != colors::white;
+    if (tinted)
+    {
+      SDL_GetTextureColorMod(cmd.texture, &red, &green, &blue);
+      SDL_GetTextureAlphaMod(cmd.texture, &alpha);
+      const auto& tint = cmd.tint;
+      SDL_SetTextureColorMod(cmd.texture, tint.red(), tint.green(), tint.blue());
+      SDL_SetTextureAlphaMod(cmd.texture, tint.alpha());
+    }
+
+    const auto res = SDL_RenderCopyExF(renderer.get(),
+                                       cmd.texture,
+                                       source,
+                                       cmd.destination.data(),
+                                       cmd.angle,
+                                       nullptr,
+                                       cmd.flip) == 0;
+    if (tinted)
+    {
+      SDL_SetTextureColorMod(cmd.texture, red, green, blue);
+      SDL_SetTextureAlphaMod(cmd.texture, alpha);
+    }
+
+    return res;
+  }
+
+  template <typename T>
+  [[nodiscard]] static auto submit_primitive(basic_renderer<T>& renderer,
+                                             const render_command& cmd) -> result
+  {
+    const auto& dst = cmd.destination;
+    switch (cmd.type)
+    {
+      case render_command_type::fill_rect:
+        return renderer.fill_rect(dst);
+
+      case render_command_type::draw_rect:
+        return renderer.draw_rect(dst);
+
+      case render_command_type::draw_line:
+        return renderer.draw_line(fpoint{dst.x(), dst.y()},
+                                  fpoint{dst.width(), dst.height()});
+
+      case render_command_type::texture:  // Textures are rendered by submit_texture()
+        return failure;
+
+      default:
+        assert(false);
+        return failure;
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_COMMAND_BUFFER_HEADER
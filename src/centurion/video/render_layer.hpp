@@ -0,0 +1,261 @@
+#ifndef CENTURION_RENDER_LAYER_HEADER
+#define CENTURION_RENDER_LAYER_HEADER
+
+#include <SDL.h>
+
+#include <type_traits>  // is_invocable_v
+#include <utility>      // forward
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/render_target_scope.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "blend_mode.hpp"
+#include "colors.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+/// \cond FALSE
+namespace cen::detail {
+
+// Content rendered with alpha blending onto a transparent target is premultiplied
+[[nodiscard]] inline auto premultiplied_blend_mode() noexcept -> SDL_BlendMode
+{
+  return SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE,
+                                    SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                                    SDL_BLENDOPERATION_ADD,
+                                    SDL_BLENDFACTOR_ONE,
+                                    SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                                    SDL_BLENDOPERATION_ADD);
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class render_layer
+ *
+ * \brief A retained layer that caches its contents in a target texture.
+ *
+ * \details UI panels, such as menus and inventories, often consist of many rectangles,
+ * icons and strings that rarely change. A render layer records such contents into a
+ * target texture by invoking a paint function, and then composites the texture with a
+ * single render call every frame. The paint function is only invoked again after the
+ * layer has been invalidated.
+ * \code{cpp}
+ *   cen::render_layer inventory{renderer, {400, 300}};
+ *
+ *   // Every frame
+ *   inventory.render(renderer, cen::ipoint{20, 20}, [&](cen::renderer& target) {
+ *     target.set_color(cen::colors::dim_gray);
+ *     target.fill_rect(cen::irect{0, 0, 400, 300});
+ *     target.render_text(cache, "Inventory", {8, 8});
+ *     // ...
+ *   });
+ *
+ *   // When an item is added or removed
+ *   inventory.invalidate();
+ * \endcode
+ *
+ * \details The contents are painted onto a transparent texture with the usual blend
+ * modes, which leaves the texture with premultiplied colors. Where the renderer supports
+ * custom blend modes, the texture is composited with a premultiplied blend mode, so that
+ * translucent contents look the same as when they're rendered directly. Otherwise, plain
+ * alpha blending is used, which slightly darkens translucent edges.
+ *
+ * \note The paint function renders in the coordinates of the layer, i.e. the top-left
+ * corner of the layer is the origin. The render target of the renderer is restored
+ * afterwards.
+ *
+ * \since 6.1.0
+ */
+class render_layer final
+{
+ public:
+  /**
+   * \brief Creates an invalidated layer.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer used to create the target texture.
+   * \param size the size of the layer.
+   * \param format the pixel format of the target texture.
+   *
+   * \throws sdl_error if the texture couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  render_layer(const Renderer& renderer,
+               const iarea size,
+               const pixel_format format = pixel_format::rgba8888)
+      : m_texture{renderer, format, texture_access::target, size}
+  {
+    if (SDL_SetTextureBlendMode(m_texture.get(), detail::premultiplied_blend_mode()) != 0)
+    {
+      m_texture.set_blend_mode(blend_mode::blend);
+    }
+  }
+
+  /**
+   * \brief Marks the contents as outdated, so that they're painted by the next render.
+   *
+   * \since 6.1.0
+   */
+  void invalidate() noexcept
+  {
+    m_valid = false;
+  }
+
+  /**
+   * \brief Paints the contents into the texture, if the layer has been invalidated.
+   *
+   * \tparam T the ownership tag of the renderer.
+   * \tparam Painter the type of the paint function, which is invoked with the renderer.
+   *
+   * \param renderer the renderer that is used to paint the contents.
+   * \param paint the function that renders the contents of the layer.
+   *
+   * \return `success` if the contents are up to date; `failure` if the texture couldn't
+   * be made the render target.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename Painter>
+  auto update(basic_renderer<T>& renderer, Painter&& paint) -> result
+  {
+    static_assert(std::is_invocable_v<Painter&, basic_renderer<T>&>,
+                  "The paint function must accept the renderer!");
+
+    if (m_valid)
+    {
+      return success;
+    }
+
+    {
+      const detail::render_target_scope scope{renderer, m_texture};
+      if (!scope.is_active())
+      {
+        return failure;
+      }
+
+      renderer.clear_with(colors::transparent);
+      paint(renderer);
+    }
+
+    m_valid = true;
+    ++m_paintCount;
+
+    return success;
+  }
+
+  /**
+   * \brief Composites the layer, after painting its contents if it has been invalidated.
+   *
+   * \tparam T the ownership tag of the renderer.
+   * \tparam P the representation type of the position.
+   * \tparam Painter the type of the paint function, which is invoked with the renderer.
+   *
+   * \param renderer the renderer that is used to paint and render the layer.
+   * \param position the position of the top-left corner of the layer.
+   * \param paint the function that renders the contents of the layer.
+   *
+   * \return `success` if the layer was rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename P, typename Painter>
+  auto render(basic_renderer<T>& renderer,
+              const basic_point<P>& position,
+              Painter&& paint) -> result
+  {
+    if (!update(renderer, std::forward<Painter>(paint)))
+    {
+      return failure;
+    }
+
+    return renderer.render(m_texture, position);
+  }
+
+  /**
+   * \brief Composites the contents that were painted most recently.
+   *
+   * \tparam T the ownership tag of the renderer.
+   * \tparam P the representation type of the position.
+   *
+   * \param renderer the renderer that is used to render the layer.
+   * \param position the position of the top-left corner of the layer.
+   *
+   * \return `success` if the layer was rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T, typename P>
+  auto render(basic_renderer<T>& renderer, const basic_point<P>& position) noexcept
+      -> result
+  {
+    return renderer.render(m_texture, position);
+  }
+
+  /**
+   * \brief Indicates whether or not the contents are up to date.
+   *
+   * \return `true` if the contents have been painted since the last invalidation; `false`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_valid() const noexcept -> bool
+  {
+    return m_valid;
+  }
+
+  /**
+   * \brief Returns the amount of times that the contents have been painted.
+   *
+   * \return the amount of paint function invocations.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto paint_count() const noexcept -> u64
+  {
+    return m_paintCount;
+  }
+
+  /**
+   * \brief Returns the texture that holds the contents of the layer.
+   *
+   * \return the target texture of the layer.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() const noexcept -> const texture&
+  {
+    return m_texture;
+  }
+
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_texture.size();
+  }
+
+ private:
+  texture m_texture;
+  u64 m_paintCount{};
+  bool m_valid{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_LAYER_HEADER
@@ -0,0 +1,403 @@
+#ifndef CENTURION_RENDER_SCALER_HEADER
+#define CENTURION_RENDER_SCALER_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max
+#include <cassert>    // assert
+#include <cmath>      // lround
+#include <limits>     // numeric_limits
+#include <optional>   // optional
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../events/event_signal.hpp"
+#include "../events/window_event.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "scale_mode.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class render_scaler
+ *
+ * \brief Renders the world at a reduced internal resolution, and the UI at the native
+ * pixel density of the display.
+ *
+ * \details On high-DPI displays, the output of a renderer has more pixels than the
+ * window has screen coordinates, and rendering a world layer at the full output
+ * resolution is often more than the GPU can keep up with, e.g. on laptops with 4K
+ * displays. The scaler renders the world layer into a target texture that's a fraction
+ * of the output size, and upscales it to the output. The UI is then rendered on top in
+ * window coordinates, scaled to the native pixel density, which keeps text and icons
+ * sharp.
+ * \code{cpp}
+ *   cen::render_scaler scaler{renderer, 0.5f};
+ *   scaler.connect(dispatcher);
+ *
+ *   // Every frame
+ *   scaler.begin_world();
+ *   draw_world(renderer, scaler.world_size());
+ *   scaler.end_world();
+ *
+ *   scaler.begin_ui();
+ *   draw_ui(renderer);  // In window coordinates
+ *   scaler.end_ui();
+ *
+ *   renderer.present();
+ * \endcode
+ *
+ * \details The output size and the pixel density are queried again whenever the window
+ * is resized or moved to another display. Feed the scaler with window events, either
+ * with `handle()` or by connecting it to a dispatcher.
+ *
+ * \note The renderer must outlive the scaler, and must not have a render target set
+ * when the world layer is begun.
+ *
+ * \since 6.1.0
+ */
+class render_scaler final
+{
+ public:
+  /**
+   * \brief Creates a scaler for a window renderer.
+   *
+   * \details The world texture is created on first use.
+   *
+   * \param renderer the renderer of the window.
+   * \param worldScale the resolution of the world layer, relative to the output size.
+   *
+   * \throws cen_error if the world scale isn't in the range (0, 1].
+   *
+   * \since 6.1.0
+   */
+  explicit render_scaler(renderer& renderer, const float worldScale = 1.0f)
+      : m_renderer{&renderer}
+      , m_windowId{SDL_GetWindowID(SDL_RenderGetWindow(renderer.get()))}
+      , m_worldScale{checked_scale(worldScale)}
+  {}
+
+  /// \name Rendering
+  /// \{
+
+  /**
+   * \brief Redirects rendering to the world texture, and clears it.
+   *
+   * \details The world texture is recreated if the output size or the world scale has
+   * changed. Render the world in the coordinates of `world_size()`.
+   *
+   * \return `success` if the world texture is the render target; `failure` otherwise.
+   *
+   * \throws sdl_error if the world texture can't be created.
+   *
+   * \since 6.1.0
+   */
+  auto begin_world() -> result
+  {
+    update();
+
+    if (!m_renderer->set_target(*m_world) || !m_renderer->set_scale(1.0f, 1.0f))
+    {
+      return failure;
+    }
+
+    return m_renderer->clear();
+  }
+
+  /**
+   * \brief Restores the default render target, and upscales the world to the output.
+   *
+   * \pre `begin_world()` must have been called.
+   *
+   * \return `success` if the world was rendered to the output; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto end_world() noexcept -> result
+  {
+    assert(m_world);
+
+    if (!m_renderer->reset_target())
+    {
+      return failure;
+    }
+
+    return m_renderer->render(*m_world, irect{{0, 0}, m_outputSize});
+  }
+
+  /**
+   * \brief Scales rendering so that window coordinates map to native pixels.
+   *
+   * \return `success` if the scale was applied; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto begin_ui() noexcept -> result
+  {
+    update_metrics();
+    return m_renderer->set_scale(m_pixelRatio.width, m_pixelRatio.height);
+  }
+
+  /**
+   * \brief Restores the default rendering scale.
+   *
+   * \return `success` if the scale was restored; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto end_ui() noexcept -> result
+  {
+    return m_renderer->set_scale(1.0f, 1.0f);
+  }
+
+  /// \} End of rendering
+
+  /// \name Events
+  /// \{
+
+  /**
+   * \brief Updates the scaler according to a window event.
+   *
+   * \details The output metrics are queried again when the window is resized or moved
+   * to another display. Events that belong to other windows are ignored.
+   *
+   * \param event the window event that will be handled.
+   *
+   * \since 6.1.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    const auto& raw = event.get();
+    if (raw.windowID != m_windowId)
+    {
+      return;
+    }
+
+    switch (raw.event)
+    {
+      case SDL_WINDOWEVENT_RESIZED:
+      case SDL_WINDOWEVENT_SIZE_CHANGED:
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+      case SDL_WINDOWEVENT_DISPLAY_CHANGED:
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+        m_dirty = true;
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  /**
+   * \brief Connects the scaler to the window events of a dispatcher.
+   *
+   * \details The handler never consumes the events.
+   *
+   * \tparam Dispatcher the type of the event dispatcher.
+   *
+   * \param dispatcher the dispatcher that will update the scaler, must handle
+   * `window_event`.
+   *
+   * \return the connection of the handler, see `event_sink::disconnect()`.
+   *
+   * \since 6.1.0
+   */
+  template <typename Dispatcher>
+  auto connect(Dispatcher& dispatcher) -> event_connection
+  {
+    constexpr auto priority = (std::numeric_limits<int>::max)();
+    return dispatcher.template bind<window_event>()
+        .template connect<&render_scaler::handle>(this, priority);
+  }
+
+  /**
+   * \brief Marks the output metrics as outdated, so that they're queried on next use.
+   *
+   * \since 6.1.0
+   */
+  void invalidate() noexcept
+  {
+    m_dirty = true;
+  }
+
+  /// \} End of events
+
+  /// \name Settings
+  /// \{
+
+  /**
+   * \brief Sets the resolution of the world layer, relative to the output size.
+   *
+   * \details Lower scales trade resolution for throughput, e.g. 0.5 renders a quarter of
+   * the pixels. The world texture is recreated by the next `begin_world()` call.
+   *
+   * \param scale the new world scale.
+   *
+   * \throws cen_error if the scale isn't in the range (0, 1].
+   *
+   * \since 6.1.0
+   */
+  void set_world_scale(const float scale)
+  {
+    m_worldScale = checked_scale(scale);
+    m_dirty = true;
+  }
+
+  /**
+   * \brief Returns the resolution of the world layer, relative to the output size.
+   *
+   * \return the world scale.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto world_scale() const noexcept -> float
+  {
+    return m_worldScale;
+  }
+
+  /// \} End of settings
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the size of the world layer, in pixels.
+   *
+   * \return the size of the world texture; a zero size before the first frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto world_size() const noexcept -> iarea
+  {
+    return m_worldSize;
+  }
+
+  /**
+   * \brief Returns the size of the renderer output, in pixels.
+   *
+   * \return the output size, as of the last update.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto output_size() const noexcept -> iarea
+  {
+    return m_outputSize;
+  }
+
+  /**
+   * \brief Returns the amount of pixels per window coordinate.
+   *
+   * \return the pixel ratio of the output, e.g. 2 on typical high-DPI displays.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pixel_ratio() const noexcept -> farea
+  {
+    return m_pixelRatio;
+  }
+
+  /**
+   * \brief Returns the texture that the world is rendered to.
+   *
+   * \return a pointer to the world texture; a null pointer before the first frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto world_texture() noexcept -> texture*
+  {
+    return m_world ? &*m_world : nullptr;
+  }
+
+  /// \} End of queries
+
+ private:
+  renderer* m_renderer{};
+  u32 m_windowId{};
+  float m_worldScale{1};
+  iarea m_outputSize{};
+  iarea m_worldSize{};
+  farea m_pixelRatio{1, 1};
+  std::optional<texture> m_world;
+  bool m_dirty{true};
+
+  void update()
+  {
+    update_metrics();
+
+    if (!m_world || m_world->size() != m_worldSize)
+    {
+      m_world.reset();
+      m_world.emplace(*m_renderer,
+                      pixel_format::rgba8888,
+                      texture_access::target,
+                      m_worldSize);
+
+#if SDL_VERSION_ATLEAST(2, 0, 12)
+      m_world->set_scale_mode(scale_mode::linear);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 12)
+    }
+  }
+
+  void update_metrics() noexcept
+  {
+    if (!m_dirty)
+    {
+      return;
+    }
+
+    m_outputSize = m_renderer->output_size();
+
+    int width{};
+    int height{};
+    SDL_GetWindowSize(SDL_RenderGetWindow(m_renderer->get()), &width, &height);
+
+    m_pixelRatio.width = (width > 0) ? ratio(m_outputSize.width, width) : 1.0f;
+    m_pixelRatio.height = (height > 0) ? ratio(m_outputSize.height, height) : 1.0f;
+
+    m_worldSize.width = scaled(m_outputSize.width);
+    m_worldSize.height = scaled(m_outputSize.height);
+
+    m_dirty = false;
+  }
+
+  [[nodiscard]] auto scaled(const int pixels) const noexcept -> int
+  {
+    const auto result = std::lround(static_cast<float>(pixels) * m_worldScale);
+    return (std::max)(1, static_cast<int>(result));
+  }
+
+  [[nodiscard]] static auto ratio(const int pixels, const int coordinates) noexcept
+      -> float
+  {
+    return static_cast<float>(pixels) / static_cast<float>(coordinates);
+  }
+
+  [[nodiscard]] static auto checked_scale(const float scale) -> float
+  {
+    if (scale > 0 && scale <= 1)
+    {
+      return scale;
+    }
+    else
+    {
+      throw cen_error{"Invalid world scale!"};
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_SCALER_HEADER
@@ -0,0 +1,160 @@
+#ifndef CENTURION_RENDER_SCOPE_HEADER
+#define CENTURION_RENDER_SCOPE_HEADER
+
+#include <SDL.h>
+
+#include "../core/result.hpp"
+#include "../math/rect.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class clip_scope
+ *
+ * \brief Clips rendering to a rectangle in a scope, intersected with any outer scopes.
+ *
+ * \details The scope pushes the clip on the clip stack of the renderer when it's
+ * created, and pops it when it's destroyed. Nested widgets can therefore restrict
+ * rendering to their bounds without querying and restoring the clip themselves, and
+ * without redundant clip changes.
+ * \code{cpp}
+ *   const cen::clip_scope panel{renderer, panelBounds};
+ *   {
+ *     const cen::clip_scope list{renderer, listBounds};  // Clipped to both rectangles
+ *     render_items(renderer);
+ *   }
+ * \endcode
+ *
+ * \tparam T the ownership tag of the renderer.
+ *
+ * \see `basic_renderer::push_clip()`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class clip_scope final
+{
+ public:
+  /**
+   * \brief Pushes a clip rectangle.
+   *
+   * \param renderer the renderer that will be clipped, which must outlive the scope.
+   * \param area the clip rectangle.
+   *
+   * \since 6.1.0
+   */
+  clip_scope(basic_renderer<T>& renderer, const irect& area)
+      : m_renderer{renderer}
+      , m_result{renderer.push_clip(area)}
+  {}
+
+  clip_scope(const clip_scope&) = delete;
+
+  auto operator=(const clip_scope&) -> clip_scope& = delete;
+
+  /// Pops the clip rectangle, restoring the clip of the enclosing scope.
+  ~clip_scope() noexcept
+  {
+    m_renderer.pop_clip();
+  }
+
+  /**
+   * \brief Indicates whether or not the clip was successfully applied.
+   *
+   * \return `true` if the clip is active; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_active() const noexcept -> bool
+  {
+    return static_cast<bool>(m_result);
+  }
+
+ private:
+  basic_renderer<T>& m_renderer;
+  result m_result;
+};
+
+/**
+ * \class target_scope
+ *
+ * \brief Redirects rendering to a texture in a scope.
+ *
+ * \details The scope pushes the target on the target stack of the renderer when it's
+ * created, and pops it when it's destroyed, which restores the previous target along
+ * with its clip. Targets that are already active aren't applied again.
+ * \code{cpp}
+ *   {
+ *     const cen::target_scope scope{renderer, minimap};
+ *     renderer.clear_with(cen::colors::black);
+ *     render_terrain(renderer);
+ *   }
+ *
+ *   renderer.render(minimap, cen::ipoint{8, 8});
+ * \endcode
+ *
+ * \note Clip scopes that are created inside the scope must end before it.
+ *
+ * \tparam T the ownership tag of the renderer.
+ *
+ * \see `basic_renderer::push_target()`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+class target_scope final
+{
+ public:
+  /**
+   * \brief Pushes a render target.
+   *
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param renderer the renderer that will be redirected, which must outlive the scope.
+   * \param target the texture that will be rendered to, which must be a render target.
+   *
+   * \since 6.1.0
+   */
+  template <typename U>
+  target_scope(basic_renderer<T>& renderer, basic_texture<U>& target)
+      : m_renderer{renderer}
+      , m_result{renderer.push_target(target)}
+  {}
+
+  target_scope(const target_scope&) = delete;
+
+  auto operator=(const target_scope&) -> target_scope& = delete;
+
+  /// Pops the render target, restoring the previous target.
+  ~target_scope() noexcept
+  {
+    m_renderer.pop_target();
+  }
+
+  /**
+   * \brief Indicates whether or not the target was successfully applied.
+   *
+   * \return `true` if the target is active; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_active() const noexcept -> bool
+  {
+    return static_cast<bool>(m_result);
+  }
+
+ private:
+  basic_renderer<T>& m_renderer;
+  result m_result;
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_SCOPE_HEADER
@@ -0,0 +1,377 @@
+#ifndef CENTURION_RENDER_THREAD_HEADER
+#define CENTURION_RENDER_THREAD_HEADER
+
+#include <SDL.h>
+
+#include <atomic>      // atomic, memory_order_...
+#include <functional>  // function
+#include <memory>      // unique_ptr, make_unique
+#include <optional>    // optional
+#include <string>      // string
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../math/transform2d.hpp"
+#include "../thread/condition.hpp"
+#include "../thread/mutex.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/thread.hpp"
+#include "../thread/triple_buffer.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "mouse_latch.hpp"
+#include "render_command_buffer.hpp"
+#include "renderer.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct render_snapshot
+ *
+ * \brief An immutable description of a frame, which is rendered by a `render_thread`.
+ *
+ * \see `render_thread`
+ *
+ * \since 6.1.0
+ */
+struct render_snapshot final
+{
+  render_command_buffer commands;  ///< The draw commands of the frame.
+  transform2d view;                ///< Applied to all commands, e.g. a camera.
+  color background{colors::black};  ///< The color that the frame is cleared with.
+  mouse_latch latch;               ///< Moves latched commands before rendering.
+  u64 frame{};                     ///< The index of the frame, assigned by `publish()`.
+};
+
+/**
+ * \class render_thread
+ *
+ * \brief A dedicated thread that owns a renderer and renders frames recorded by the game
+ * thread.
+ *
+ * \details The game thread records each frame into a `render_snapshot`, obtained with
+ * `snapshot()`, and hands it over with `publish()`. The snapshots are exchanged through
+ * a `triple_buffer`, so neither thread ever waits for the other: if the game thread
+ * publishes faster than the display refreshes, the older frames are dropped, and if it
+ * is slower, the render thread waits for the next frame instead of presenting the same
+ * frame again. Submission and presentation, which can block for a long time when vsync
+ * is enabled, thus no longer stall the simulation.
+ *
+ * \details The renderer is created on the render thread, since most rendering backends
+ * require that a renderer is only used by the thread that created it. For the same
+ * reason, textures are created with `execute()`, which runs a function on the render
+ * thread before the next frame is rendered.
+ *
+ * \note The event loop, e.g. `event_dispatcher::poll()`, must stay on the main thread,
+ * which is also the thread that should create the window. The window must outlive the
+ * render thread.
+ *
+ * \note Textures referenced by published snapshots must stay alive until a later frame
+ * has been rendered, see `rendered_frames()`.
+ *
+ * \since 6.1.0
+ */
+class render_thread final
+{
+ public:
+  using job_type = std::function<void(renderer&)>;
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Starts a render thread that renders to a window.
+   *
+   * \details This function blocks until the renderer has been created.
+   *
+   * \tparam Window the type of the window, e.g. `window` or `window_handle`.
+   *
+   * \param window the window that will be rendered to.
+   * \param flags the renderer flags that will be used, see `renderer_flags`.
+   *
+   * \throws sdl_error if the thread or the renderer couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename Window>
+  explicit render_thread(const Window& window,
+                         const u32 flags = renderer::default_flags())
+      : m_shared{std::make_unique<shared_data>()}
+  {
+    m_shared->window = window.get();
+    m_shared->flags = flags;
+
+    m_thread.emplace(&run, "render_thread", m_shared.get());
+
+    scoped_lock lock{m_shared->mutex};
+    while (!m_shared->started)
+    {
+      m_shared->wake.wait(m_shared->mutex);
+    }
+
+    if (m_shared->failed)
+    {
+      // SDL errors are thread-local, so the message is moved to this thread
+      SDL_SetError("%s", m_shared->error.c_str());
+      throw sdl_error{};
+    }
+  }
+
+  render_thread(const render_thread&) = delete;
+
+  auto operator=(const render_thread&) -> render_thread& = delete;
+
+  /**
+   * \brief Stops and joins the render thread, which destroys the renderer.
+   *
+   * \details Pending jobs are run, but a published frame that hasn't been rendered yet
+   * is discarded.
+   *
+   * \since 6.1.0
+   */
+  ~render_thread() noexcept
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->stopping = true;
+    }
+
+    m_shared->wake.signal();
+    m_thread.reset();
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Returns the snapshot that is being recorded by the game thread.
+   *
+   * \details The snapshot is empty at the start of each frame, apart from the view,
+   * background and latch scale, which are carried over from the previously published
+   * snapshot.
+   *
+   * \pre This function must be called on the game thread.
+   *
+   * \return the snapshot of the current frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto snapshot() noexcept -> render_snapshot&
+  {
+    return m_shared->snapshots.write();
+  }
+
+  /**
+   * \brief Hands the recorded snapshot over to the render thread.
+   *
+   * \details This function never waits for the render thread.
+   *
+   * \pre This function must be called on the game thread.
+   *
+   * \return the index of the published frame.
+   *
+   * \since 6.1.0
+   */
+  auto publish() -> u64
+  {
+    auto& published = m_shared->snapshots.write();
+
+    const auto frame = m_published++;
+    const auto view = published.view;
+    const auto background = published.background;
+    const auto latchScale = published.latch.scale();
+    published.frame = frame;
+
+    if (m_shared->snapshots.publish())
+    {
+      m_shared->dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    auto& next = m_shared->snapshots.write();
+    next.commands.clear();
+    next.view = view;
+    next.background = background;
+    next.latch.reset();
+    next.latch.set_scale(latchScale);
+
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->pending = true;
+    }
+
+    m_shared->wake.signal();
+    return frame;
+  }
+
+  /**
+   * \brief Runs a function on the render thread, before the next frame is rendered.
+   *
+   * \details This is how textures should be created and destroyed, since they belong to
+   * the renderer. Jobs are run in the order in which they were submitted.
+   *
+   * \param job the function that will be called with the renderer.
+   *
+   * \since 6.1.0
+   */
+  void execute(job_type job)
+  {
+    {
+      scoped_lock lock{m_shared->mutex};
+      m_shared->jobs.push_back(std::move(job));
+    }
+
+    m_shared->wake.signal();
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of frames that have been published.
+   *
+   * \return the amount of published frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto published_frames() const noexcept -> u64
+  {
+    return m_published;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been rendered and presented.
+   *
+   * \return the amount of rendered frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto rendered_frames() const noexcept -> u64
+  {
+    return m_shared->rendered.load(std::memory_order_acquire);
+  }
+
+  /**
+   * \brief Returns the amount of published frames that were replaced by a newer frame
+   * before they could be rendered.
+   *
+   * \return the amount of dropped frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto dropped_frames() const noexcept -> u64
+  {
+    return m_shared->dropped.load(std::memory_order_relaxed);
+  }
+
+  /// \} End of queries
+
+ private:
+  struct shared_data final
+  {
+    SDL_Window* window{};
+    u32 flags{};
+
+    triple_buffer<render_snapshot> snapshots;
+    std::atomic<u64> rendered{0};
+    std::atomic<u64> dropped{0};
+
+    cen::mutex mutex;
+    condition wake;
+    std::vector<job_type> jobs;  // Guarded by the mutex
+    std::string error;           // Guarded by the mutex
+    bool pending{};              // Guarded by the mutex
+    bool started{};              // Guarded by the mutex
+    bool failed{};               // Guarded by the mutex
+    bool stopping{};             // Guarded by the mutex
+  };
+
+  std::unique_ptr<shared_data> m_shared;
+  std::optional<thread> m_thread;
+  u64 m_published{};
+
+  static auto run(void* data) -> int
+  {
+    auto& shared = *static_cast<shared_data*>(data);
+
+    std::optional<renderer> target;
+    try
+    {
+      target.emplace(window_handle{shared.window}, shared.flags);
+    }
+    catch (const sdl_error& e)
+    {
+      scoped_lock lock{shared.mutex};
+      shared.error = e.what();
+      shared.failed = true;
+    }
+
+    {
+      scoped_lock lock{shared.mutex};
+      shared.started = true;
+    }
+
+    shared.wake.signal();
+    if (!target)
+    {
+      return -1;
+    }
+
+    std::vector<job_type> jobs;
+    while (true)
+    {
+      bool stopping{};
+
+      {
+        scoped_lock lock{shared.mutex};
+        while (!shared.pending && shared.jobs.empty() && !shared.stopping)
+        {
+          shared.wake.wait(shared.mutex);
+        }
+
+        jobs.swap(shared.jobs);
+        shared.pending = false;
+        stopping = shared.stopping;
+      }
+
+      for (auto& job : jobs)
+      {
+        job(*target);
+      }
+
+      jobs.clear();
+
+      if (stopping)
+      {
+        return 0;
+      }
+
+      if (shared.snapshots.acquire())
+      {
+        render(*target, shared.snapshots.read());
+        shared.rendered.fetch_add(1, std::memory_order_release);
+      }
+    }
+  }
+
+  static void render(renderer& target, render_snapshot& snapshot)
+  {
+    // The snapshot belongs to this thread until the next frame is acquired
+    snapshot.commands.transform(snapshot.view);
+    snapshot.latch.apply(snapshot.commands);
+
+    target.clear_with(snapshot.background);
+    snapshot.commands.submit(target);
+    target.present();
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RENDER_THREAD_HEADER
@@ -3,33 +3,42 @@
 
 #include <SDL.h>
 
+#include <algorithm>      // min, max
 #include <cassert>        // assert
 #include <cmath>          // floor, sqrt
 #include <cstddef>        // size_t
-#include <memory>         // unique_ptr
+#include <memory>         // unique_ptr, make_unique
 #include <optional>       // optional
 #include <ostream>        // ostream
 #include <string>         // string
 #include <type_traits>    // conditional_t
-#include <unordered_map>  // unordered_map
 #include <utility>        // move, forward, pair
+#include <vector>         // vector
 
 #include "../core/czstring.hpp"
+#include "../core/delegate.hpp"
 #include "../core/integers.hpp"
+#include "../core/memory_resource.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
-#include "../detail/address_of.hpp"
 #include "../detail/convert_bool.hpp"
+#include "../detail/flat_id_map.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/owner_handle_api.hpp"
 #include "../math/rect.hpp"
+#include "../system/profiler.hpp"
+#include "bitmap_font.hpp"
 #include "blend_mode.hpp"
 #include "color.hpp"
 #include "colors.hpp"
 #include "font.hpp"
 #include "font_cache.hpp"
 #include "surface.hpp"
+#include "text_layout.hpp"
+#include "text_shaper.hpp"
 #include "texture.hpp"
+#include "texture_memory.hpp"
 #include "unicode_string.hpp"
 
 namespace cen {
@@ -40,6 +49,126 @@ namespace cen {
 template <typename T>
 class basic_renderer;
 
+/**
+ * \struct rendered_text
+ *
+ * \brief Describes the result of rendering a string with a font cache or a bitmap font.
+ *
+ * \see `basic_renderer::render_text_batched()`
+ *
+ * \since 6.1.0
+ */
+struct rendered_text final
+{
+  ipoint pen;    ///< The position where subsequent text would be rendered.
+  irect bounds;  ///< The area covered by the rendered glyphs.
+};
+
+/**
+ * \struct render_stats
+ *
+ * \brief Provides the amount of SDL calls made by a renderer during a frame.
+ *
+ * \details The statistics are only collected by owning renderers, and only if
+ * `CENTURION_ENABLE_RENDER_STATS` is defined. Otherwise, the instrumentation is compiled
+ * out and all of the counters remain zero. State changes are only counted when they
+ * actually reach SDL, i.e. redundant changes filtered by the state cache aren't counted.
+ *
+ * \details Vertices are counted as one per point, one per line endpoint and four per
+ * rectangle or texture copy. Texture switches are counted whenever a texture copy or
+ * geometry call uses a different texture than the previous one, the first texture of
+ * each frame included.
+ *
+ * \details Flushes are only counted for renderers that batch their draw calls, and only
+ * if there are commands that haven't been submitted yet, since flushing an empty batch
+ * is free. The implicit flushes point out where a frame breaks its batches, e.g. by
+ * switching render targets, reading pixels, or mixing in native rendering calls.
+ *
+ * \see `basic_renderer::stats()`
+ *
+ * \since 6.1.0
+ */
+struct render_stats final
+{
+  u32 clears{};            ///< The amount of calls to `clear()`.
+  u32 point_calls{};       ///< The amount of point draw calls.
+  u32 line_calls{};        ///< The amount of line draw calls.
+  u32 rect_calls{};        ///< The amount of rectangle outline draw calls.
+  u32 fill_calls{};        ///< The amount of filled rectangle draw calls.
+  u32 copy_calls{};        ///< The amount of texture copies.
+  u32 geometry_calls{};    ///< The amount of geometry draw calls.
+  u32 texture_switches{};  ///< The amount of times a different texture was used.
+  u32 color_changes{};     ///< The amount of draw color changes.
+  u32 blend_changes{};     ///< The amount of blend mode changes.
+  u32 target_changes{};    ///< The amount of render target changes.
+  u32 clip_changes{};      ///< The amount of clip rectangle changes.
+  u32 viewport_changes{};  ///< The amount of viewport changes.
+  u32 vertices{};          ///< The amount of submitted vertices.
+  u32 text_textures{};     ///< The amount of textures created for rendered text.
+  u32 flushes{};           ///< The amount of explicit flushes, see `flush()`.
+  u32 target_flushes{};    ///< The amount of flushes caused by target changes.
+  u32 readback_flushes{};  ///< The amount of flushes caused by reading pixels.
+  u32 native_flushes{};    ///< The amount of flushes caused by native rendering.
+
+  /// Returns the total amount of draw calls, excluding clears.
+  [[nodiscard]] constexpr auto draw_calls() const noexcept -> u32
+  {
+    return point_calls + line_calls + rect_calls + fill_calls + copy_calls +
+           geometry_calls;
+  }
+
+  /// Returns the total amount of state changes, excluding texture switches.
+  [[nodiscard]] constexpr auto state_changes() const noexcept -> u32
+  {
+    return color_changes + blend_changes + target_changes + clip_changes +
+           viewport_changes;
+  }
+
+  /// Returns the total amount of flushes that weren't requested explicitly.
+  [[nodiscard]] constexpr auto implicit_flushes() const noexcept -> u32
+  {
+    return target_flushes + readback_flushes + native_flushes;
+  }
+
+  /**
+   * \brief Indicates whether or not the statistics are collected.
+   *
+   * \return `true` if `CENTURION_ENABLE_RENDER_STATS` is defined; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] constexpr static auto is_enabled() noexcept -> bool
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    return true;
+#else
+    return false;
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+};
+
+/**
+ * \enum batching_policy
+ *
+ * \brief Determines whether or not a renderer batches its draw calls.
+ *
+ * \details Batching renderers queue draw calls and submit them to the GPU in large
+ * chunks, which is much faster than submitting every call on its own. However, raw
+ * rendering API calls, e.g. OpenGL calls, can only be mixed with batching renderers if
+ * the queued commands are flushed before each native call.
+ *
+ * \see `hint::render_batching`
+ * \see `basic_renderer::flush()`
+ *
+ * \since 6.1.0
+ */
+enum class batching_policy
+{
+  automatic,  ///< Let SDL decide, i.e. batch unless a render driver was requested.
+  enabled,    ///< Always batch the draw calls.
+  disabled    ///< Never batch the draw calls.
+};
+
 /**
  * \typedef renderer
  *
@@ -158,6 +287,37 @@ class basic_renderer final
     {
       throw sdl_error{};
     }
+
+    m_renderer.batching = detect_batching(batching_policy::automatic);
+  }
+
+  /**
+   * \brief Creates an owning renderer with an explicit batching policy.
+   *
+   * \details The batching hint is only overridden while the renderer is created, i.e.
+   * the previous value of the hint is restored afterwards, with normal priority. Before
+   * SDL 2.24, the restored value keeps the override priority, since SDL can't lower it.
+   *
+   * \param window the associated window instance.
+   * \param batching determines whether or not the renderer batches its draw calls.
+   * \param flags the renderer flags that will be used, see `renderer_flags`.
+   *
+   * \throws sdl_error if something goes wrong when creating the renderer.
+   *
+   * \since 6.1.0
+   */
+  template <typename Window, typename TT = T, detail::is_owner<TT> = 0>
+  basic_renderer(const Window& window,
+                 const batching_policy batching,
+                 const u32 flags = default_flags())
+      : m_renderer{create(window.get(), batching, flags)}
+  {
+    if (!get())
+    {
+      throw sdl_error{};
+    }
+
+    m_renderer.batching = detect_batching(batching);
   }
 
   template <typename TT = T, detail::is_handle<TT> = 0>
@@ -176,6 +336,7 @@ class basic_renderer final
    */
   auto clear() noexcept -> result
   {
+    count_draw(&render_stats::clears, 0);
     return SDL_RenderClear(get()) == 0;
   }
 
@@ -204,7 +365,189 @@ class basic_renderer final
    */
   void present() noexcept
   {
+    CENTURION_PROFILE_SCOPE("renderer::present");
     SDL_RenderPresent(get());
+
+    if constexpr (detail::is_owning<T>())
+    {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+      m_renderer.lastStats = m_renderer.stats;
+      m_renderer.stats = render_stats{};
+      m_renderer.lastTexture = nullptr;
+      m_renderer.pendingCommands = false;
+#endif  // CENTURION_ENABLE_RENDER_STATS
+
+      if (m_renderer.presentCallback)
+      {
+        m_renderer.presentCallback();
+      }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+      if (m_renderer.frameResource)
+      {
+        m_renderer.frameResource->reset();
+      }
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+    }
+  }
+
+  /**
+   * \brief Submits the queued draw calls to the GPU.
+   *
+   * \details Batching renderers queue their draw calls until they're flushed, which
+   * happens automatically when the frame is presented, when the render target changes
+   * and when pixels are read. Explicit flushes are only needed before calls to the
+   * underlying rendering API, see `prepare_native_rendering()`. This function has no
+   * effect if the renderer doesn't batch its draw calls.
+   *
+   * \return `success` if the draw calls were flushed; `failure` otherwise.
+   *
+   * \see `render_stats::flushes`
+   *
+   * \since 6.1.0
+   */
+  auto flush() noexcept -> result
+  {
+    count_flush(&render_stats::flushes);
+    return SDL_RenderFlush(get()) == 0;
+  }
+
+  /**
+   * \brief Prepares the renderer for calls to the underlying rendering API.
+   *
+   * \details This function should be called before mixing raw OpenGL or Direct3D calls
+   * with the renderer. The queued draw calls are flushed, and the state cache is cleared,
+   * since native calls may modify the state behind the back of the renderer.
+   *
+   * \details Native rendering with a batching renderer is one of the most common reasons
+   * for broken batches, so these flushes are counted separately.
+   *
+   * \return `success` if the draw calls were flushed; `failure` otherwise.
+   *
+   * \see `render_stats::native_flushes`
+   *
+   * \since 6.1.0
+   */
+  auto prepare_native_rendering() noexcept -> result
+  {
+    count_flush(&render_stats::native_flushes);
+
+    if (auto* cache = state_cache())
+    {
+      *cache = render_state{};
+      cache->enabled = true;
+    }
+
+    return SDL_RenderFlush(get()) == 0;
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Returns an arena for allocations that only live until the end of the frame.
+   *
+   * \details The arena is reset after every call to `present()`, after the present
+   * callback has been invoked. It is created on demand, and its address is stable for the
+   * lifetime of the renderer.
+   * \code{cpp}
+   *   std::pmr::vector<cen::fpoint> points{&renderer.frame_resource()};
+   * \endcode
+   *
+   * \return the frame arena of the renderer.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto frame_resource() -> cen::frame_resource&
+  {
+    if (!m_renderer.frameResource)
+    {
+      m_renderer.frameResource = std::make_unique<cen::frame_resource>();
+    }
+
+    return *m_renderer.frameResource;
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Sets a function object that is invoked after every call to `present()`.
+   *
+   * \details This is useful for hooking up frame timing, e.g. with `frame_stats`.
+   * \code{cpp}
+   *   cen::frame_stats<> stats;
+   *   renderer.set_present_callback([&stats] { stats.tick(); });
+   * \endcode
+   *
+   * \note The callback must not throw, since `present()` is `noexcept`.
+   *
+   * \param callback the function object that will be invoked, or null to remove it.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void set_present_callback(delegate<void()> callback) noexcept
+  {
+    m_renderer.presentCallback = std::move(callback);
+  }
+
+  /**
+   * \brief Returns the statistics of the most recently presented frame.
+   *
+   * \details The statistics are gathered between two calls to `present()`, including
+   * the calls made by the present callback of the previous frame.
+   *
+   * \return the statistics of the previous frame; all zeros if
+   * `CENTURION_ENABLE_RENDER_STATS` isn't defined.
+   *
+   * \see `render_stats`
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto stats() const noexcept -> render_stats
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    return m_renderer.lastStats;
+#else
+    return {};
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+
+  /**
+   * \brief Returns the statistics gathered since the last call to `present()`.
+   *
+   * \return the statistics of the current frame; all zeros if
+   * `CENTURION_ENABLE_RENDER_STATS` isn't defined.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto current_stats() const noexcept -> render_stats
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    return m_renderer.stats;
+#else
+    return {};
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+
+  /**
+   * \brief Indicates whether or not the renderer batches its draw calls.
+   *
+   * \details Renderers that were created from existing SDL renderers are assumed to
+   * batch, since SDL doesn't expose the batching state of a renderer.
+   *
+   * \return `true` if the draw calls are batched; `false` otherwise.
+   *
+   * \see `batching_policy`
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto is_batching() const noexcept -> bool
+  {
+    return m_renderer.batching;
   }
 
   /**
@@ -225,18 +568,49 @@ class basic_renderer final
   {
     surface image{output_size(), format};
 
-    if (!image.lock())
+    if (!capture(image))
     {
       throw sdl_error{};
     }
 
-    if (SDL_RenderReadPixels(get(), nullptr, 0, image.pixels(), image.pitch()) == -1)
+    return image;
+  }
+
+  /**
+   * \brief Captures a snapshot of the current rendering target into an existing surface.
+   *
+   * \details This function reuses the pixel memory of the surface, which avoids
+   * allocating a new surface for every snapshot when capturing repeatedly, e.g. when
+   * generating thumbnails or recording frames. The surface is only recreated, with its
+   * current pixel format, if its size differs from the output size of the renderer.
+   *
+   * \param image the surface that will receive the pixel data.
+   *
+   * \return `success` if the pixels were captured; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto capture(surface& image) const -> result
+  {
+    const auto size = output_size();
+    if (image.size() != size)
     {
-      throw sdl_error{};
+      image = surface{size, image.format_info().format()};
+    }
+
+    if (!image.lock())
+    {
+      return failure;
     }
 
+    count_flush(&render_stats::readback_flushes);
+
+    const auto format = static_cast<u32>(image.format_info().format());
+    const auto read =
+        SDL_RenderReadPixels(get(), nullptr, format, image.pixels(), image.pitch()) == 0;
     image.unlock();
-    return image;
+
+    return read;
   }
 
   /// \name Primitive rendering
@@ -288,6 +662,8 @@ class basic_renderer final
   template <typename U>
   auto draw_rect(const basic_rect<U>& rect) noexcept -> result
   {
+    count_draw(&render_stats::rect_calls, 4);
+
     if constexpr (basic_rect<U>::isIntegral)
     {
       return SDL_RenderDrawRect(get(), rect.data()) == 0;
@@ -312,6 +688,8 @@ class basic_renderer final
   template <typename U>
   auto fill_rect(const basic_rect<U>& rect) noexcept -> result
   {
+    count_draw(&render_stats::fill_calls, 4);
+
     if constexpr (basic_rect<U>::isIntegral)
     {
       return SDL_RenderFillRect(get(), rect.data()) == 0;
@@ -322,6 +700,89 @@ class basic_renderer final
     }
   }
 
+  /**
+   * \brief Renders the outlines of a collection of rectangles in the currently selected
+   * color.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store `irect` or `frect` instances
+   * contiguously, such as `std::vector` or `std::array`.
+   *
+   * \param container the rectangles that will be rendered.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto draw_rects(const Container& container) noexcept -> result
+  {
+    using rect_t = typename Container::value_type;  // a rectangle of int or float
+
+    if (!container.empty())
+    {
+      const auto* first = container.front().data();
+
+      count_draw(&render_stats::rect_calls, 4 * isize(container));
+
+      if constexpr (rect_t::isIntegral)
+      {
+        return SDL_RenderDrawRects(get(), first, isize(container)) == 0;
+      }
+      else
+      {
+        return SDL_RenderDrawRectsF(get(), first, isize(container)) == 0;
+      }
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+  /**
+   * \brief Renders a collection of filled rectangles in the currently selected color.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store `irect` or `frect` instances
+   * contiguously, such as `std::vector` or `std::array`.
+   *
+   * \param container the rectangles that will be rendered.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto fill_rects(const Container& container) noexcept -> result
+  {
+    using rect_t = typename Container::value_type;  // a rectangle of int or float
+
+    if (!container.empty())
+    {
+      const auto* first = container.front().data();
+
+      count_draw(&render_stats::fill_calls, 4 * isize(container));
+
+      if constexpr (rect_t::isIntegral)
+      {
+        return SDL_RenderFillRects(get(), first, isize(container)) == 0;
+      }
+      else
+      {
+        return SDL_RenderFillRectsF(get(), first, isize(container)) == 0;
+      }
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
   /**
    * \brief Renders a line between the supplied points, in the currently selected color.
    *
@@ -338,6 +799,8 @@ class basic_renderer final
   auto draw_line(const basic_point<U>& start, const basic_point<U>& end) noexcept
       -> result
   {
+    count_draw(&render_stats::line_calls, 2);
+
     if constexpr (basic_point<U>::isIntegral)
     {
       return SDL_RenderDrawLine(get(), start.x(), start.y(), end.x(), end.y()) == 0;
@@ -380,6 +843,8 @@ class basic_renderer final
       const auto& front = container.front();
       const auto* first = front.data();
 
+      count_draw(&render_stats::line_calls, isize(container));
+
       if constexpr (std::is_same_v<value_t, int>)
       {
         return SDL_RenderDrawLines(get(), first, isize(container)) == 0;
@@ -409,6 +874,8 @@ class basic_renderer final
   template <typename U>
   auto draw_point(const basic_point<U>& point) noexcept -> result
   {
+    count_draw(&render_stats::point_calls, 1);
+
     if constexpr (basic_point<U>::isIntegral)
     {
       return SDL_RenderDrawPoint(get(), point.x(), point.y()) == 0;
@@ -420,66 +887,103 @@ class basic_renderer final
   }
 
   /**
-   * \brief Renders a circle using the currently selected color.
+   * \brief Renders a collection of points using the currently selected color.
    *
-   * \tparam U the representation type used by the point.
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
    *
-   * \param position the position of the rendered circle.
-   * \param radius the radius of the rendered circle.
+   * \tparam Container the container type. Must store `ipoint` or `fpoint` instances
+   * contiguously, such as `std::vector` or `std::array`.
    *
-   * \since 6.0.0
+   * \param container the points that will be rendered.
+   *
+   * \return `success` if the points were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
    */
-  template <typename U>
-  void draw_circle(const basic_point<U>& position, const float radius) noexcept
+  template <typename Container>
+  auto draw_points(const Container& container) noexcept -> result
   {
-    using value_t = typename basic_point<U>::value_type;
-
-    auto error = -radius;
-    auto x = radius - 0.5f;
-    auto y = 0.5f;
-
-    const auto cx = static_cast<float>(position.x()) - 0.5f;
-    const auto cy = static_cast<float>(position.y()) - 0.5f;
+    using point_t = typename Container::value_type;  // a point of int or float
 
-    while (x >= y)
+    if (!container.empty())
     {
-      draw_point<value_t>({static_cast<value_t>(cx + x), static_cast<value_t>(cy + y)});
-      draw_point<value_t>({static_cast<value_t>(cx + y), static_cast<value_t>(cy + x)});
+      const auto* first = container.front().data();
 
-      if (x != 0)
-      {
-        draw_point<value_t>({static_cast<value_t>(cx - x), static_cast<value_t>(cy + y)});
-        draw_point<value_t>({static_cast<value_t>(cx + y), static_cast<value_t>(cy - x)});
-      }
+      count_draw(&render_stats::point_calls, isize(container));
 
-      if (y != 0)
+      if constexpr (point_t::isIntegral)
       {
-        draw_point<value_t>({static_cast<value_t>(cx + x), static_cast<value_t>(cy - y)});
-        draw_point<value_t>({static_cast<value_t>(cx - y), static_cast<value_t>(cy + x)});
+        return SDL_RenderDrawPoints(get(), first, isize(container)) == 0;
       }
-
-      if (x != 0 && y != 0)
+      else
       {
-        draw_point<value_t>({static_cast<value_t>(cx - x), static_cast<value_t>(cy - y)});
-        draw_point<value_t>({static_cast<value_t>(cx - y), static_cast<value_t>(cy - x)});
+        return SDL_RenderDrawPointsF(get(), first, isize(container)) == 0;
       }
+    }
+    else
+    {
+      return failure;
+    }
+  }
 
-      error += y;
-      ++y;
-      error += y;
+  /**
+   * \brief Renders a circle using the currently selected color.
+   *
+   * \details The points of the circle are submitted to SDL in a single call.
+   *
+   * \tparam U the representation type used by the point.
+   *
+   * \param position the position of the rendered circle.
+   * \param radius the radius of the rendered circle.
+   *
+   * \since 6.0.0
+   */
+  template <typename U>
+  void draw_circle(const basic_point<U>& position, const float radius)
+  {
+    auto& points = scratch_points();
+    points.clear();
 
-      if (error >= 0)
-      {
-        --x;
-        error -= x;
-        error -= x;
-      }
+    append_circle_points(points, position, radius);
+    submit_points(points);
+  }
+
+  /**
+   * \brief Renders several circles with the same radius using the currently selected
+   * color.
+   *
+   * \details The points of all circles are submitted to SDL in a single call.
+   *
+   * \tparam Container the container type. Must store its elements contiguously, such as
+   * `std::vector` or `std::array`, and the elements must be either `ipoint` or `fpoint`.
+   *
+   * \param centers the positions of the rendered circles.
+   * \param radius the radius of the rendered circles.
+   *
+   * \return `success` if the circles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto draw_circles(const Container& centers, const float radius) -> result
+  {
+    auto& points = scratch_points();
+    points.clear();
+
+    for (const auto& center : centers)
+    {
+      append_circle_points(points, center, radius);
     }
+
+    return submit_points(points);
   }
 
   /**
    * \brief Renders a filled circle using the currently selected color.
    *
+   * \details The rows of the circle are submitted to SDL in a single call.
+   *
    * \param center the position of the rendered circle.
    * \param radius the radius of the rendered circle.
    *
@@ -487,15 +991,41 @@ class basic_renderer final
    */
   void fill_circle(const fpoint center, const float radius)
   {
-    const auto cx = center.x();
-    const auto cy = center.y();
+    auto& rows = scratch_rects();
+    rows.clear();
 
-    for (auto dy = 1.0f; dy <= radius; dy += 1.0f)
+    append_circle_rows(rows, center, radius);
+    submit_rects(rows);
+  }
+
+  /**
+   * \brief Renders several filled circles with the same radius using the currently
+   * selected color.
+   *
+   * \details The rows of all circles are submitted to SDL in a single call.
+   *
+   * \tparam Container the container type. Must store `fpoint` instances contiguously,
+   * such as `std::vector` or `std::array`.
+   *
+   * \param centers the positions of the rendered circles.
+   * \param radius the radius of the rendered circles.
+   *
+   * \return `success` if the circles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto fill_circles(const Container& centers, const float radius) -> result
+  {
+    auto& rows = scratch_rects();
+    rows.clear();
+
+    for (const auto& center : centers)
     {
-      const auto dx = std::floor(std::sqrt((2.0f * radius * dy) - (dy * dy)));
-      draw_line<float>({cx - dx, cy + dy - radius}, {cx + dx, cy + dy - radius});
-      draw_line<float>({cx - dx, cy - dy + radius}, {cx + dx, cy - dy + radius});
+      append_circle_rows(rows, center, radius);
     }
+
+    return submit_rects(rows);
   }
 
   /// \} End of primitive rendering
@@ -563,6 +1093,89 @@ class basic_renderer final
     return draw_point(translate(point));
   }
 
+  /**
+   * \brief Renders the outlines of a collection of rectangles in the currently selected
+   * color.
+   *
+   * \details The rendered rectangles will be translated using the current translation
+   * viewport. The translation is applied in a single pass into an internal buffer, which
+   * is then submitted in one call.
+   *
+   * \tparam Container the container type. Must store `irect` or `frect` instances, such
+   * as `std::vector` or `std::array`.
+   *
+   * \param container the rectangles that will be rendered.
+   *
+   * \return `success` if the rectangles were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto draw_rects_t(const Container& container) -> result
+  {
+    const auto& rects = translate_rects(container);
+    if (!rects.empty())
+    {
+      count_draw(&render_stats::rect_calls, 4 * isize(rects));
+      return SDL_RenderDrawRectsF(get(), rects.data(), isize(rects)) == 0;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+  /**
+   * \brief Renders a collection of filled rectangles in the currently selected color.
+   *
+   * \copydetails draw_rects_t()
+   */
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto fill_rects_t(const Container& container) -> result
+  {
+    const auto& rects = translate_rects(container);
+    if (!rects.empty())
+    {
+      count_draw(&render_stats::fill_calls, 4 * isize(rects));
+      return SDL_RenderFillRectsF(get(), rects.data(), isize(rects)) == 0;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+  /**
+   * \brief Renders a collection of points using the currently selected color.
+   *
+   * \details The rendered points will be translated using the current translation
+   * viewport. The translation is applied in a single pass into an internal buffer, which
+   * is then submitted in one call.
+   *
+   * \tparam Container the container type. Must store `ipoint` or `fpoint` instances,
+   * such as `std::vector` or `std::array`.
+   *
+   * \param container the points that will be rendered.
+   *
+   * \return `success` if the points were successfully rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto draw_points_t(const Container& container) -> result
+  {
+    const auto& points = translate_points(container);
+    if (!points.empty())
+    {
+      count_draw(&render_stats::point_calls, isize(points));
+      return SDL_RenderDrawPointsF(get(), points.data(), isize(points)) == 0;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
   /**
    * \brief Renders a circle with the currently selected color.
    *
@@ -577,7 +1190,7 @@ class basic_renderer final
    * \since 6.0.0
    */
   template <typename U, typename TT = T, detail::is_owner<TT> = 0>
-  void draw_circle_t(const basic_point<U>& position, const float radius) noexcept
+  void draw_circle_t(const basic_point<U>& position, const float radius)
   {
     draw_circle(translate(position), radius);
   }
@@ -601,6 +1214,8 @@ class basic_renderer final
 
   /// \} End of translated primitive rendering
 
+#ifndef CENTURION_NO_SDL_TTF
+
   /// \name Text rendering
   /// \{
 
@@ -1077,24 +1692,30 @@ class basic_renderer final
   auto render_glyph(const font_cache& cache, const unicode glyph, const ipoint position)
       -> int
   {
-    if (const auto* data = cache.try_at(glyph))
-    {
-      const auto& [texture, metrics] = *data;
-
-      const auto outline = cache.get_font().outline();
-
-      // SDL_ttf handles the y-axis alignment
-      const auto x = position.x() + metrics.minX - outline;
-      const auto y = position.y() - outline;
-
-      render(texture, ipoint{x, y});
+    return render_cached_glyph(cache, find_glyph(cache, glyph, nullptr), position);
+  }
 
-      return x + metrics.advance;
-    }
-    else
-    {
-      return position.x();
-    }
+  /**
+   * \brief Renders a styled variant of a glyph at the specified position.
+   *
+   * \note This function has no effect if the variant doesn't exist in the cache.
+   *
+   * \param cache the font cache that will be used.
+   * \param glyph the glyph, in unicode, that will be rendered.
+   * \param position the position of the rendered glyph.
+   * \param style the style of the variant, see `font_cache::add_glyph()`.
+   *
+   * \return the x-coordinate of the next glyph to be rendered after the current glyph, or
+   * the same x-coordinate if no glyph was rendered.
+   *
+   * \since 6.1.0
+   */
+  auto render_glyph(const font_cache& cache,
+                    const unicode glyph,
+                    const ipoint position,
+                    const font_cache::glyph_style& style) -> int
+  {
+    return render_cached_glyph(cache, find_glyph(cache, glyph, &style), position);
   }
 
   /**
@@ -1109,6 +1730,9 @@ class basic_renderer final
    * \note This function is sensitive to newline-characters, and will render strings that
    * contain such characters appropriately.
    *
+   * \note If the font cache uses a glyph atlas, the glyphs are submitted with a single
+   * geometry call per atlas page, if SDL 2.0.18 or later is available.
+   *
    * \tparam String the type of the string, must be iterable and provide `unicode`
    * characters.
    *
@@ -1121,6 +1745,16 @@ class basic_renderer final
   template <typename String>
   void render_text(const font_cache& cache, const String& str, ipoint position)
   {
+    CENTURION_PROFILE_SCOPE("renderer::render_text");
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (cache.is_using_glyph_atlas())
+    {
+      render_atlas_text(cache, str, position, false, nullptr);
+      return;
+    }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
     const auto& font = cache.get_font();
 
     const auto originalX = position.x();
@@ -1141,127 +1775,463 @@ class basic_renderer final
     }
   }
 
-  /// \} End of text rendering
-
-  /// \name Texture rendering
-  /// \{
-
   /**
-   * \brief Renders a texture at the specified position.
+   * \brief Renders a string, with kerning, using as few render calls as possible.
    *
-   * \tparam P the representation type used by the point.
-   * \tparam U the ownership tag of the texture.
+   * \details All glyphs are resolved in a single pass, and the kerning between each pair
+   * of glyphs is applied if the font has kerning enabled. The kerning amounts are cached
+   * by the font cache.
    *
-   * \param texture the texture that will be rendered.
-   * \param position the position of the rendered texture.
+   * \details If the font cache uses a glyph atlas and SDL 2.0.18 or later is available,
+   * all glyphs are submitted with a single geometry call per atlas page. Otherwise, each
+   * glyph is rendered separately.
    *
-   * \return `success` if the rendering was successful; `failure` otherwise.
+   * \note This function is sensitive to newline-characters.
    *
-   * \since 4.0.0
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters.
+   *
+   * \param cache the font cache that will be used.
+   * \param str the string that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \return the final pen position and the bounding box of the rendered glyphs.
+   *
+   * \since 6.1.0
    */
-  template <typename P, typename U>
-  auto render(const basic_texture<U>& texture, const basic_point<P>& position) noexcept
-      -> result
+  template <typename String>
+  auto render_text_batched(const font_cache& cache,
+                           const String& str,
+                           const ipoint position) -> rendered_text
   {
-    if constexpr (basic_point<P>::isFloating)
-    {
-      const auto size = cast<cen::farea>(texture.size());
-      const SDL_FRect dst{position.x(), position.y(), size.width, size.height};
-      return SDL_RenderCopyF(get(), texture.get(), nullptr, &dst) == 0;
-    }
-    else
-    {
-      const SDL_Rect dst{position.x(), position.y(), texture.width(), texture.height()};
-      return SDL_RenderCopy(get(), texture.get(), nullptr, &dst) == 0;
-    }
+    return render_cached_text(cache, str, position, nullptr);
   }
 
   /**
-   * \brief Renders a texture according to the specified rectangle.
+   * \brief Renders a string with styled glyph variants, with kerning.
    *
-   * \tparam P the representation type used by the rectangle.
-   * \tparam U the ownership tag of the texture.
+   * \details This function behaves like `render_text_batched()`, but uses the glyph
+   * variants of the specified style, which makes it possible to mix e.g. outlined and
+   * plain text without reconfiguring the font.
    *
-   * \param texture the texture that will be rendered.
-   * \param destination the position and size of the rendered texture.
+   * \note Glyphs whose variants haven't been cached are skipped.
    *
-   * \return `success` if the rendering was successful; `failure` otherwise.
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters.
    *
-   * \since 4.0.0
+   * \param cache the font cache that will be used.
+   * \param str the string that will be rendered.
+   * \param position the position of the rendered text.
+   * \param style the style of the glyph variants, see `font_cache::add_range()`.
+   *
+   * \return the final pen position and the bounding box of the rendered glyphs.
+   *
+   * \since 6.1.0
    */
-  template <typename P, typename U>
-  auto render(const basic_texture<U>& texture, const basic_rect<P>& destination) noexcept
-      -> result
+  template <typename String>
+  auto render_text_batched(const font_cache& cache,
+                           const String& str,
+                           const ipoint position,
+                           const font_cache::glyph_style& style) -> rendered_text
   {
-    if constexpr (basic_rect<P>::isFloating)
-    {
-      return SDL_RenderCopyF(get(), texture.get(), nullptr, destination.data()) == 0;
-    }
-    else
-    {
-      return SDL_RenderCopy(get(), texture.get(), nullptr, destination.data()) == 0;
-    }
+    return render_cached_text(cache, str, position, &style);
   }
 
   /**
-   * \brief Renders a texture.
+   * \brief Renders a string at an arbitrary scale.
    *
-   * \remarks This should be your preferred function of rendering textures. This function
-   * is efficient and simple.
+   * \details The string is laid out like with `render_text_batched()`, after which the
+   * positions and sizes of all glyphs are scaled. This is intended to be used with font
+   * caches that store distance field glyphs, which makes it possible to use a single
+   * cache for all text sizes. Plain glyphs can be scaled as well, but they become blurry
+   * or pixelated when magnified.
    *
-   * \tparam P the representation type used by the rectangle.
-   * \tparam U the ownership tag of the texture.
+   * \see `font_cache::enable_distance_field_glyphs()`
    *
-   * \param texture the texture that will be rendered.
-   * \param source the cutout out of the texture that will be rendered.
-   * \param destination the position and size of the rendered texture.
+   * \note This function is sensitive to newline-characters.
    *
-   * \return `success` if the rendering was successful; `failure` otherwise.
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters.
    *
-   * \since 4.0.0
+   * \param cache the font cache that will be used.
+   * \param str the string that will be rendered.
+   * \param position the position of the rendered text.
+   * \param scale the scale factor, relative to the point size of the font.
+   *
+   * \return the bounding box of the rendered glyphs.
+   *
+   * \since 6.1.0
    */
-  template <typename P, typename U>
-  auto render(const basic_texture<U>& texture,
-              const irect& source,
-              const basic_rect<P>& destination) noexcept -> result
+  template <typename String>
+  auto render_text_scaled(const font_cache& cache,
+                          const String& str,
+                          const fpoint position,
+                          const float scale) -> frect
   {
-    if constexpr (basic_rect<P>::isFloating)
-    {
-      return SDL_RenderCopyF(get(), texture.get(), source.data(), destination.data()) ==
-             0;
-    }
-    else
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (cache.is_using_glyph_atlas())
     {
-      return SDL_RenderCopy(get(), texture.get(), source.data(), destination.data()) == 0;
+      const auto layout =
+          render_atlas_text(cache, str, {}, true, nullptr, position, scale);
+      return scale_rect(layout.bounds, position, scale);
     }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+    const auto render_scaled = [&](const placed_glyph& glyph) {
+      const auto dst = scale_rect(glyph.dst, position, scale);
+      if (glyph.atlas)
+      {
+        render(cache.glyph_page(glyph.atlas->page), glyph.atlas->source, dst);
+      }
+      else
+      {
+        render(glyph.data->cached, dst);
+      }
+    };
+
+    const auto layout = layout_text(cache, str, {}, true, nullptr, render_scaled);
+
+    return scale_rect(layout.bounds, position, scale);
   }
 
   /**
-   * \brief Renders a texture.
+   * \brief Renders a previously computed text layout.
    *
-   * \tparam P the representation type used by the rectangle.
-   * \tparam U the ownership tag of the texture.
+   * \details Each glyph of the layout is rendered at its precomputed position, so no
+   * layout work is performed by this function.
    *
-   * \param texture the texture that will be rendered.
-   * \param source the cutout out of the texture that will be rendered.
-   * \param destination the position and size of the rendered texture.
-   * \param angle the clockwise angle, in degrees, with which the rendered texture will be
-   * rotated.
+   * \pre The layout should have been computed with the font of the cache.
+   * \pre The layout mustn't be shaped, see `text_layout::is_shaped()`.
    *
-   * \return `success` if the rendering was successful; `failure` otherwise.
+   * \note Glyphs that aren't stored in the cache are skipped.
    *
-   * \since 4.0.0
+   * \param cache the font cache that will be used.
+   * \param layout the layout that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \see `text_layout_cache`
+   *
+   * \since 6.1.0
    */
-  template <typename P, typename U>
-  auto render(const basic_texture<U>& texture,
-              const irect& source,
-              const basic_rect<P>& destination,
-              const double angle) noexcept -> result
+  void render_layout(const font_cache& cache,
+                     const text_layout& layout,
+                     const ipoint position)
   {
-    if constexpr (basic_rect<P>::isFloating)
+    CENTURION_PROFILE_SCOPE("renderer::render_layout");
+    assert(!layout.is_shaped() && "Shaped layouts must be rendered with their shaper!");
+
+    for (const auto& info : layout.glyphs())
     {
-      return SDL_RenderCopyExF(get(),
-                               texture.get(),
+      if (info.glyph != ' ')
+      {
+        render_glyph(cache, info.glyph, position + info.position);
+      }
+    }
+  }
+
+#ifdef CENTURION_USE_HARFBUZZ
+
+  /**
+   * \brief Renders a shaped text layout.
+   *
+   * \details The glyphs are submitted with a single geometry call per atlas page, if SDL
+   * 2.0.18 or later is available.
+   *
+   * \pre The layout must have been shaped with the shaper, see `text_shaper::shape()`.
+   *
+   * \note Glyphs that haven't been added to the shaper are skipped, see
+   * `text_shaper::add_glyphs()`.
+   *
+   * \param shaper the text shaper that will be used.
+   * \param layout the shaped layout that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \see `text_layout_cache`
+   *
+   * \since 6.1.0
+   */
+  void render_layout(const text_shaper& shaper,
+                     const text_layout& layout,
+                     const ipoint position)
+  {
+    CENTURION_PROFILE_SCOPE("renderer::render_layout");
+    assert(layout.is_shaped() && "Only shaped layouts can be rendered with a shaper!");
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    const SDL_Color white{0xFF, 0xFF, 0xFF, 0xFF};
+
+    auto& vertices = scratch_vertices();
+    auto& indices = scratch_indices();
+
+    for (std::size_t page = 0; page < shaper.glyph_page_count(); ++page)
+    {
+      vertices.clear();
+      indices.clear();
+
+      const auto texture = shaper.glyph_page(page);
+      const auto textureSize = texture.size();
+
+      for (const auto& info : layout.glyphs())
+      {
+        const auto* image = shaper.try_at(info.glyph);
+        if (image && image->page == page && image->source.has_area())
+        {
+          const irect dst{position + info.position + image->offset, image->source.size()};
+          append_quad(vertices,
+                      indices,
+                      cast<frect>(dst),
+                      image->source,
+                      textureSize,
+                      white);
+        }
+      }
+
+      if (!indices.empty())
+      {
+        render_geometry(texture.get(),
+                        vertices.data(),
+                        isize(vertices),
+                        indices.data(),
+                        isize(indices));
+      }
+    }
+#else
+    for (const auto& info : layout.glyphs())
+    {
+      const auto* image = shaper.try_at(info.glyph);
+      if (image && image->source.has_area())
+      {
+        const irect dst{position + info.position + image->offset, image->source.size()};
+        render(shaper.glyph_page(image->page), image->source, dst);
+      }
+    }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+  }
+
+#endif  // CENTURION_USE_HARFBUZZ
+
+  /// \} End of text rendering
+
+#endif  // CENTURION_NO_SDL_TTF
+
+  /// \name Bitmap text rendering
+  /// \{
+
+  /**
+   * \brief Renders a glyph of a bitmap font at the specified position.
+   *
+   * \note This function has no effect if the font doesn't have the glyph.
+   *
+   * \param font the bitmap font that will be used.
+   * \param glyph the glyph, in unicode, that will be rendered.
+   * \param position the position of the top of the line.
+   *
+   * \return the x-coordinate of the next glyph to be rendered after the current glyph, or
+   * the same x-coordinate if the font doesn't have the glyph.
+   *
+   * \since 6.1.0
+   */
+  auto render_glyph(const bitmap_font& font, const unicode glyph, const ipoint position)
+      -> int
+  {
+    if (const auto* data = font.try_at(glyph))
+    {
+      if (data->page < font.page_count())
+      {
+        const irect dst{position + data->offset, data->source.size()};
+        render(font.page(data->page), data->source, dst);
+      }
+
+      return position.x() + data->advance;
+    }
+    else
+    {
+      return position.x();
+    }
+  }
+
+  /**
+   * \brief Renders a string with a bitmap font.
+   *
+   * \details The glyphs are submitted with a single geometry call per page, if SDL
+   * 2.0.18 or later is available. Kerning isn't applied, see `render_text_batched()`.
+   *
+   * \note This function is sensitive to newline-characters.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters.
+   *
+   * \param font the bitmap font that will be used.
+   * \param str the string that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \since 6.1.0
+   */
+  template <typename String>
+  void render_text(const bitmap_font& font, const String& str, const ipoint position)
+  {
+    CENTURION_PROFILE_SCOPE("renderer::render_text");
+    render_bitmap_text(font, str, position, false);
+  }
+
+  /**
+   * \brief Renders a string with a bitmap font, with kerning.
+   *
+   * \details The glyphs are submitted with a single geometry call per page, if SDL
+   * 2.0.18 or later is available. Otherwise, each glyph is rendered separately.
+   *
+   * \note This function is sensitive to newline-characters.
+   *
+   * \tparam String the type of the string, must be iterable and provide `unicode`
+   * characters.
+   *
+   * \param font the bitmap font that will be used.
+   * \param str the string that will be rendered.
+   * \param position the position of the rendered text.
+   *
+   * \return the final pen position and the bounding box of the rendered glyphs.
+   *
+   * \since 6.1.0
+   */
+  template <typename String>
+  auto render_text_batched(const bitmap_font& font,
+                           const String& str,
+                           const ipoint position) -> rendered_text
+  {
+    CENTURION_PROFILE_SCOPE("renderer::render_text_batched");
+    return render_bitmap_text(font, str, position, true);
+  }
+
+  /// \} End of bitmap text rendering
+
+  /// \name Texture rendering
+  /// \{
+
+  /**
+   * \brief Renders a texture at the specified position.
+   *
+   * \tparam P the representation type used by the point.
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param position the position of the rendered texture.
+   *
+   * \return `success` if the rendering was successful; `failure` otherwise.
+   *
+   * \since 4.0.0
+   */
+  template <typename P, typename U>
+  auto render(const basic_texture<U>& texture, const basic_point<P>& position) noexcept
+      -> result
+  {
+    count_copy(texture.get());
+
+    if constexpr (basic_point<P>::isFloating)
+    {
+      const auto size = cast<cen::farea>(texture.size());
+      const SDL_FRect dst{position.x(), position.y(), size.width, size.height};
+      return SDL_RenderCopyF(get(), texture.get(), nullptr, &dst) == 0;
+    }
+    else
+    {
+      const auto size = texture.size();
+      const SDL_Rect dst{position.x(), position.y(), size.width, size.height};
+      return SDL_RenderCopy(get(), texture.get(), nullptr, &dst) == 0;
+    }
+  }
+
+  /**
+   * \brief Renders a texture according to the specified rectangle.
+   *
+   * \tparam P the representation type used by the rectangle.
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param destination the position and size of the rendered texture.
+   *
+   * \return `success` if the rendering was successful; `failure` otherwise.
+   *
+   * \since 4.0.0
+   */
+  template <typename P, typename U>
+  auto render(const basic_texture<U>& texture, const basic_rect<P>& destination) noexcept
+      -> result
+  {
+    count_copy(texture.get());
+
+    if constexpr (basic_rect<P>::isFloating)
+    {
+      return SDL_RenderCopyF(get(), texture.get(), nullptr, destination.data()) == 0;
+    }
+    else
+    {
+      return SDL_RenderCopy(get(), texture.get(), nullptr, destination.data()) == 0;
+    }
+  }
+
+  /**
+   * \brief Renders a texture.
+   *
+   * \remarks This should be your preferred function of rendering textures. This function
+   * is efficient and simple.
+   *
+   * \tparam P the representation type used by the rectangle.
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param source the cutout out of the texture that will be rendered.
+   * \param destination the position and size of the rendered texture.
+   *
+   * \return `success` if the rendering was successful; `failure` otherwise.
+   *
+   * \since 4.0.0
+   */
+  template <typename P, typename U>
+  auto render(const basic_texture<U>& texture,
+              const irect& source,
+              const basic_rect<P>& destination) noexcept -> result
+  {
+    count_copy(texture.get());
+
+    if constexpr (basic_rect<P>::isFloating)
+    {
+      return SDL_RenderCopyF(get(), texture.get(), source.data(), destination.data()) ==
+             0;
+    }
+    else
+    {
+      return SDL_RenderCopy(get(), texture.get(), source.data(), destination.data()) == 0;
+    }
+  }
+
+  /**
+   * \brief Renders a texture.
+   *
+   * \tparam P the representation type used by the rectangle.
+   * \tparam U the ownership tag of the texture.
+   *
+   * \param texture the texture that will be rendered.
+   * \param source the cutout out of the texture that will be rendered.
+   * \param destination the position and size of the rendered texture.
+   * \param angle the clockwise angle, in degrees, with which the rendered texture will be
+   * rotated.
+   *
+   * \return `success` if the rendering was successful; `failure` otherwise.
+   *
+   * \since 4.0.0
+   */
+  template <typename P, typename U>
+  auto render(const basic_texture<U>& texture,
+              const irect& source,
+              const basic_rect<P>& destination,
+              const double angle) noexcept -> result
+  {
+    count_copy(texture.get());
+
+    if constexpr (basic_rect<P>::isFloating)
+    {
+      return SDL_RenderCopyExF(get(),
+                               texture.get(),
                                source.data(),
                                destination.data(),
                                angle,
@@ -1310,6 +2280,8 @@ class basic_renderer final
                   "Destination rectangle and center point must have the same "
                   "value types (int or float)!");
 
+    count_copy(texture.get());
+
     if constexpr (basic_rect<R>::isFloating)
     {
       return SDL_RenderCopyExF(get(),
@@ -1364,6 +2336,8 @@ class basic_renderer final
                   "Destination rectangle and center point must have the same "
                   "value types (int or float)!");
 
+    count_copy(texture.get());
+
     if constexpr (basic_rect<R>::isFloating)
     {
       return SDL_RenderCopyExF(get(),
@@ -1386,6 +2360,59 @@ class basic_renderer final
     }
   }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Renders a list of triangles, optionally textured.
+   *
+   * \details If `indices` is null, the vertices are rendered in sequence, i.e. every
+   * three consecutive vertices form a triangle.
+   *
+   * \param texture the texture used by the triangles, can safely be null.
+   * \param vertices the vertices that will be rendered.
+   * \param nVertices the amount of vertices.
+   * \param indices optional indices into the vertex array, can safely be null.
+   * \param nIndices the amount of indices.
+   *
+   * \return `success` if the rendering was successful; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto render_geometry(SDL_Texture* texture,
+                       const SDL_Vertex* vertices,
+                       const int nVertices,
+                       const int* indices = nullptr,
+                       const int nIndices = 0) noexcept -> result
+  {
+    count_draw(&render_stats::geometry_calls, nVertices);
+    count_texture(texture);
+
+    return SDL_RenderGeometry(get(), texture, vertices, nVertices, indices, nIndices) == 0;
+  }
+
+  /**
+   * \brief Renders a list of textured triangles.
+   *
+   * \tparam U the ownership tag of the texture.
+   * \tparam Container the type of the vertex container, must store `SDL_Vertex`
+   * instances contiguously.
+   *
+   * \param texture the texture used by the triangles.
+   * \param vertices the vertices that will be rendered, in sequence.
+   *
+   * \return `success` if the rendering was successful; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename U, typename Container>
+  auto render_geometry(const basic_texture<U>& texture,
+                       const Container& vertices) noexcept -> result
+  {
+    return render_geometry(texture.get(), vertices.data(), isize(vertices));
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
   /// \} End of texture rendering
 
   /// \name Translated texture rendering.
@@ -1587,6 +2614,8 @@ class basic_renderer final
 
   /// \} End of translation viewport
 
+#ifndef CENTURION_NO_SDL_TTF
+
   /// \name Font handling
   /// \{
 
@@ -1605,10 +2634,7 @@ class basic_renderer final
   void add_font(const std::size_t id, font&& font)
   {
     auto& fonts = m_renderer.fonts;
-    if (const auto it = fonts.find(id); it != fonts.end())
-    {
-      fonts.erase(it);
-    }
+    fonts.erase(id);
     fonts.try_emplace(id, std::move(font));
   }
 
@@ -1629,10 +2655,7 @@ class basic_renderer final
   void emplace_font(const std::size_t id, Args&&... args)
   {
     auto& fonts = m_renderer.fonts;
-    if (const auto it = fonts.find(id); it != fonts.end())
-    {
-      fonts.erase(it);
-    }
+    fonts.erase(id);
     fonts.try_emplace(id, std::forward<Args>(args)...);
   }
 
@@ -1689,11 +2712,13 @@ class basic_renderer final
   template <typename TT = T, detail::is_owner<TT> = 0>
   [[nodiscard]] auto has_font(const std::size_t id) const -> bool
   {
-    return m_renderer.fonts.find(id) != m_renderer.fonts.end();
+    return m_renderer.fonts.contains(id);
   }
 
   /// \} // end of font handling
 
+#endif  // CENTURION_NO_SDL_TTF
+
   /// \name Setters
   /// \{
 
@@ -1708,11 +2733,24 @@ class basic_renderer final
    */
   auto set_color(const color& color) noexcept -> result
   {
-    return SDL_SetRenderDrawColor(get(),
-                                  color.red(),
-                                  color.green(),
-                                  color.blue(),
-                                  color.alpha()) == 0;
+    auto* cache = state_cache();
+    if (cache && cache->drawColor == color)
+    {
+      return success;
+    }
+
+    count(&render_stats::color_changes);
+    const auto res = SDL_SetRenderDrawColor(get(),
+                                            color.red(),
+                                            color.green(),
+                                            color.blue(),
+                                            color.alpha()) == 0;
+    if (cache)
+    {
+      cache->drawColor = res ? std::optional<cen::color>{color} : std::nullopt;
+    }
+
+    return res;
   }
 
   /**
@@ -1728,8 +2766,22 @@ class basic_renderer final
    */
   auto set_clip(const std::optional<irect> area) noexcept -> result
   {
-    return SDL_RenderSetClipRect(get(), area ? area->data() : nullptr) == 0;
-  }
+    auto* cache = state_cache();
+    if (cache && cache->clip == area)
+    {
+      return success;
+    }
+
+    count(&render_stats::clip_changes);
+    const auto res = SDL_RenderSetClipRect(get(), area ? area->data() : nullptr) == 0;
+    if (cache)
+    {
+      // The area is wrapped explicitly, since disabling clipping isn't an unknown state
+      cache->clip = res ? std::optional<std::optional<irect>>{area} : std::nullopt;
+    }
+
+    return res;
+  }
 
   /**
    * \brief Sets the viewport that will be used by the renderer.
@@ -1742,7 +2794,20 @@ class basic_renderer final
    */
   auto set_viewport(const irect viewport) noexcept -> result
   {
-    return SDL_RenderSetViewport(get(), viewport.data()) == 0;
+    auto* cache = state_cache();
+    if (cache && cache->viewport == viewport)
+    {
+      return success;
+    }
+
+    count(&render_stats::viewport_changes);
+    const auto res = SDL_RenderSetViewport(get(), viewport.data()) == 0;
+    if (cache)
+    {
+      cache->viewport = res ? std::optional{viewport} : std::nullopt;
+    }
+
+    return res;
   }
 
   /**
@@ -1756,7 +2821,21 @@ class basic_renderer final
    */
   auto set_blend_mode(const blend_mode mode) noexcept -> result
   {
-    return SDL_SetRenderDrawBlendMode(get(), static_cast<SDL_BlendMode>(mode)) == 0;
+    auto* cache = state_cache();
+    if (cache && cache->blendMode == mode)
+    {
+      return success;
+    }
+
+    count(&render_stats::blend_changes);
+    const auto res =
+        SDL_SetRenderDrawBlendMode(get(), static_cast<SDL_BlendMode>(mode)) == 0;
+    if (cache)
+    {
+      cache->blendMode = res ? std::optional{mode} : std::nullopt;
+    }
+
+    return res;
   }
 
   /**
@@ -1774,7 +2853,7 @@ class basic_renderer final
   auto set_target(basic_texture<U>& target) noexcept -> result
   {
     assert(target.is_target());
-    return SDL_SetRenderTarget(get(), target.get()) == 0;
+    return change_target(target.get());
   }
 
   /**
@@ -1787,7 +2866,7 @@ class basic_renderer final
    */
   auto reset_target() noexcept -> result
   {
-    return SDL_SetRenderTarget(get(), nullptr) == 0;
+    return change_target(nullptr);
   }
 
   /**
@@ -1807,6 +2886,7 @@ class basic_renderer final
   {
     assert(xScale > 0);
     assert(yScale > 0);
+    invalidate_viewport_and_clip();
     return SDL_RenderSetScale(get(), xScale, yScale) == 0;
   }
 
@@ -1829,6 +2909,7 @@ class basic_renderer final
   {
     assert(size.width >= 0);
     assert(size.height >= 0);
+    invalidate_viewport_and_clip();
     return SDL_RenderSetLogicalSize(get(), size.width, size.height) == 0;
   }
 
@@ -1846,11 +2927,265 @@ class basic_renderer final
    */
   auto set_logical_integer_scaling(const bool enabled) noexcept -> result
   {
+    invalidate_viewport_and_clip();
     return SDL_RenderSetIntegerScale(get(), detail::convert_bool(enabled)) == 0;
   }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Toggles VSync after the renderer has been created.
+   *
+   * \details Renderers don't support adaptive VSync, so applications that want to avoid
+   * the latency of VSync can disable it and limit the frame rate with a `frame_pacer`
+   * instead.
+   *
+   * \param enabled `true` if presenting should be synchronized with the vertical
+   * retrace; `false` otherwise.
+   *
+   * \return `success` if VSync was toggled; `failure` if the renderer doesn't support it.
+   *
+   * \see `frame_pacer`
+   *
+   * \since 6.1.0
+   */
+  auto set_vsync(const bool enabled) noexcept -> result
+  {
+    return SDL_RenderSetVSync(get(), enabled ? 1 : 0) == 0;
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  /**
+   * \brief Sets whether or not the renderer should cache its rendering state.
+   *
+   * \details When enabled, the renderer remembers the draw color, blend mode, viewport
+   * and clip rectangle it last set. Setters that would apply the value that is already
+   * active skip the SDL call, and the corresponding queries don't call into SDL at all.
+   *
+   * \details The cache is disabled by default, and is cleared when the cache is toggled.
+   *
+   * \warning The cache is only aware of changes made through this renderer. Call
+   * `reset_state_cache()` after modifying the state through the raw SDL renderer, or
+   * when the window has been resized, since SDL resets the viewport in that case.
+   *
+   * \param enabled `true` if the state should be cached; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void set_state_caching(const bool enabled) noexcept
+  {
+    m_renderer.cache = render_state{};
+    m_renderer.cache.enabled = enabled;
+  }
+
+  /**
+   * \brief Clears the cached rendering state, forcing the next setters to call into SDL.
+   *
+   * \details This function has no effect if the state cache is disabled.
+   *
+   * \see `set_state_caching()`
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  void reset_state_cache() noexcept
+  {
+    set_state_caching(m_renderer.cache.enabled);
+  }
+
   /// \} End of setters
 
+  /// \name Clip and target stacks
+  /// \{
+
+  /**
+   * \brief Pushes a clip rectangle, which is intersected with the active clip.
+   *
+   * \details The stack keeps the effective clip rectangles, so the intersections are
+   * computed on the CPU, and SDL is only called when the effective clip changes. This
+   * matters since changing the clip flushes the batched draw calls on several backends.
+   * An empty intersection results in a clip rectangle without area, which clips
+   * everything.
+   *
+   * \details The clip that was active before the first push of a render target is
+   * queried once, and restored when the last clip of the target is popped. Don't call
+   * `set_clip()` while clips are pushed, since the stack would be out of sync with SDL.
+   *
+   * \param area the clip rectangle that will be pushed.
+   *
+   * \return `success` if the effective clip was applied; `failure` otherwise. The clip
+   * is pushed either way, and must be popped.
+   *
+   * \see `clip_scope`
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  auto push_clip(const irect& area) -> result
+  {
+    auto& stack = m_renderer.clipStack;
+    if (stack.size() == clip_base())
+    {
+      stack.push_back(clip());
+    }
+
+    const auto previous = stack.back();
+    const auto next = previous ? intersect_clips(*previous, area) : area;
+    stack.push_back(next);
+
+    return (previous == next) ? success : set_clip(next);
+  }
+
+  /**
+   * \brief Pops the last pushed clip rectangle, restoring the previous clip.
+   *
+   * \details SDL is only called if the restored clip differs from the popped clip.
+   *
+   * \return `success` if the previous clip was restored; `failure` if it couldn't be
+   * restored, or if there are no pushed clips for the current render target.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  auto pop_clip() noexcept -> result
+  {
+    auto& stack = m_renderer.clipStack;
+
+    const auto base = clip_base();
+    if (stack.size() <= base)
+    {
+      return failure;
+    }
+
+    const auto current = stack.back();
+    stack.pop_back();
+
+    const auto previous = stack.back();
+    if (stack.size() == base + 1)
+    {
+      stack.pop_back();
+    }
+
+    return (previous == current) ? success : set_clip(previous);
+  }
+
+  /**
+   * \brief Pushes a render target, which is used until it is popped.
+   *
+   * \details SDL is only called if the target differs from the current target. Clips
+   * that are pushed while the target is active are independent of the clips of the
+   * previous target, since SDL keeps a clip rectangle for every target.
+   *
+   * \pre `target` must be a texture that can be used as a render target.
+   *
+   * \param target the texture that will be used as a rendering target.
+   *
+   * \return `success` if the target was applied; `failure` otherwise. The target is
+   * pushed either way, and must be popped.
+   *
+   * \see `target_scope`
+   *
+   * \since 6.1.0
+   */
+  template <typename U, typename TT = T, detail::is_owner<TT> = 0>
+  auto push_target(basic_texture<U>& target) -> result
+  {
+    assert(target.is_target());
+
+    auto* previous = SDL_GetRenderTarget(get());
+    m_renderer.targetStack.push_back({previous, m_renderer.clipStack.size()});
+
+    return (previous == target.get()) ? success : change_target(target.get());
+  }
+
+  /**
+   * \brief Pops the last pushed render target, restoring the previous target.
+   *
+   * \details Any clips that are still pushed for the popped target are discarded. The
+   * active clip of the restored target is applied again, since SDL doesn't keep the clip
+   * rectangles of texture targets.
+   *
+   * \return `success` if the previous target was restored; `failure` if it couldn't be
+   * restored, or if there are no pushed targets.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  auto pop_target() noexcept -> result
+  {
+    auto& targets = m_renderer.targetStack;
+    if (targets.empty())
+    {
+      return failure;
+    }
+
+    const auto level = targets.back();
+    targets.pop_back();
+
+    auto& clips = m_renderer.clipStack;
+    assert(clips.size() == level.clipBase &&
+           "Clips must be popped before their render target!");
+    clips.resize((std::min)(clips.size(), level.clipBase));
+
+    if (SDL_GetRenderTarget(get()) == level.previous)
+    {
+      return success;
+    }
+
+    auto res = change_target(level.previous);
+    if (res && level.previous && clips.size() > clip_base())
+    {
+      res = set_clip(clips.back());
+    }
+
+    return res;
+  }
+
+  /**
+   * \brief Returns the amount of pushed clip rectangles, for all render targets.
+   *
+   * \return the depth of the clip stack.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto clip_depth() const noexcept -> std::size_t
+  {
+    std::size_t depth = m_renderer.clipStack.size();
+
+    // Every target with pushed clips also holds its original clip
+    std::size_t end = depth;
+    for (auto it = m_renderer.targetStack.rbegin(); it != m_renderer.targetStack.rend();
+         ++it)
+    {
+      if (end > it->clipBase)
+      {
+        --depth;
+      }
+
+      end = it->clipBase;
+    }
+
+    return (end > 0) ? depth - 1 : depth;
+  }
+
+  /**
+   * \brief Returns the amount of pushed render targets.
+   *
+   * \return the depth of the target stack.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto target_depth() const noexcept -> std::size_t
+  {
+    return m_renderer.targetStack.size();
+  }
+
+  /// \} End of clip and target stacks
+
   /// \name Queries
   /// \{
 
@@ -1974,6 +3309,11 @@ class basic_renderer final
    */
   [[nodiscard]] auto clip() const noexcept -> std::optional<irect>
   {
+    if (const auto* cache = state_cache(); cache && cache->clip)
+    {
+      return *cache->clip;
+    }
+
     irect rect{};
     SDL_RenderGetClipRect(get(), rect.data());
     if (!rect.has_area())
@@ -2040,6 +3380,11 @@ class basic_renderer final
    */
   [[nodiscard]] auto get_blend_mode() const noexcept -> blend_mode
   {
+    if (const auto* cache = state_cache(); cache && cache->blendMode)
+    {
+      return *cache->blendMode;
+    }
+
     SDL_BlendMode mode{};
     SDL_GetRenderDrawBlendMode(get(), &mode);
     return static_cast<blend_mode>(mode);
@@ -2061,6 +3406,21 @@ class basic_renderer final
     return SDL_RenderGetIntegerScale(get());
   }
 
+  /**
+   * \brief Indicates whether or not the renderer caches its rendering state.
+   *
+   * \return `true` if the rendering state is cached; `false` otherwise.
+   *
+   * \see `set_state_caching()`
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto is_state_caching() const noexcept -> bool
+  {
+    return m_renderer.cache.enabled;
+  }
+
   /**
    * \brief Indicates whether or not clipping is enabled.
    *
@@ -2084,10 +3444,16 @@ class basic_renderer final
    */
   [[nodiscard]] auto get_color() const noexcept -> color
   {
+    if (const auto* cache = state_cache(); cache && cache->drawColor)
+    {
+      return *cache->drawColor;
+    }
+
     u8 red{};
     u8 green{};
     u8 blue{};
     u8 alpha{};
+
     SDL_GetRenderDrawColor(get(), &red, &green, &blue, &alpha);
     return {red, green, blue, alpha};
   }
@@ -2101,6 +3467,11 @@ class basic_renderer final
    */
   [[nodiscard]] auto viewport() const noexcept -> irect
   {
+    if (const auto* cache = state_cache(); cache && cache->viewport)
+    {
+      return *cache->viewport;
+    }
+
     irect viewport{};
     SDL_RenderGetViewport(get(), viewport.data());
     return viewport;
@@ -2171,6 +3542,21 @@ class basic_renderer final
     }
   };
 
+  struct render_state final
+  {
+    bool enabled{};
+    std::optional<color> drawColor;
+    std::optional<blend_mode> blendMode;
+    std::optional<irect> viewport;
+    std::optional<std::optional<irect>> clip;
+  };
+
+  struct target_level final
+  {
+    SDL_Texture* previous{};
+    std::size_t clipBase{};  // The size of the clip stack when the target was pushed
+  };
+
   struct owning_data final
   {
     /*implicit*/ owning_data(SDL_Renderer* ptr) : ptr{ptr}  // NOLINT
@@ -2178,42 +3564,916 @@ class basic_renderer final
 
     std::unique_ptr<SDL_Renderer, deleter> ptr;
     frect translation{};
-    std::unordered_map<std::size_t, font> fonts{};
+
+#ifndef CENTURION_NO_SDL_TTF
+    detail::flat_id_map<std::size_t, font> fonts{};
+#endif  // CENTURION_NO_SDL_TTF
+
+    render_state cache{};
+    std::vector<std::optional<irect>> clipStack{};
+    std::vector<target_level> targetStack{};
+    std::vector<SDL_FPoint> scratchPoints{};
+    std::vector<SDL_FRect> scratchRects{};
+    delegate<void()> presentCallback{};
+
+    bool batching{true};
+
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    mutable render_stats stats{};  // Reading pixels is const, but may flush the batch
+    render_stats lastStats{};
+    const SDL_Texture* lastTexture{};
+    mutable bool pendingCommands{};  // Whether there are draw calls since the last flush
+#endif  // CENTURION_ENABLE_RENDER_STATS
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+    std::unique_ptr<cen::frame_resource> frameResource{};
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    std::vector<SDL_Vertex> scratchVertices{};
+    std::vector<int> scratchIndices{};
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
   };
 
   std::conditional_t<T::value, owning_data, SDL_Renderer*> m_renderer;
 
-  [[nodiscard]] auto render_text(owner<SDL_Surface*> s) -> texture
+  [[nodiscard]] auto state_cache() noexcept -> render_state*
   {
-    surface surface{s};
-    texture texture{SDL_CreateTextureFromSurface(get(), surface.get())};
-    return texture;
+    if constexpr (detail::is_owning<T>())
+    {
+      return m_renderer.cache.enabled ? &m_renderer.cache : nullptr;
+    }
+    else
+    {
+      return nullptr;
+    }
   }
 
-  template <typename U, typename TT = T, detail::is_owner<TT> = 0>
-  [[nodiscard]] auto translate(const basic_point<U>& point) const noexcept
-      -> basic_point<U>
+  [[nodiscard]] auto state_cache() const noexcept -> const render_state*
   {
-    using value_type = typename basic_point<U>::value_type;
+    if constexpr (detail::is_owning<T>())
+    {
+      return m_renderer.cache.enabled ? &m_renderer.cache : nullptr;
+    }
+    else
+    {
+      return nullptr;
+    }
+  }
 
-    const auto& translation = m_renderer.translation;
-    const auto x = point.x() - static_cast<value_type>(translation.x());
-    const auto y = point.y() - static_cast<value_type>(translation.y());
+  [[nodiscard]] auto scratch_points() noexcept -> std::vector<SDL_FPoint>&
+  {
+    if constexpr (detail::is_owning<T>())
+    {
+      return m_renderer.scratchPoints;
+    }
+    else
+    {
+      thread_local std::vector<SDL_FPoint> points;
+      return points;
+    }
+  }
 
-    return basic_point<U>{x, y};
+  [[nodiscard]] auto scratch_rects() noexcept -> std::vector<SDL_FRect>&
+  {
+    if constexpr (detail::is_owning<T>())
+    {
+      return m_renderer.scratchRects;
+    }
+    else
+    {
+      thread_local std::vector<SDL_FRect> rects;
+      return rects;
+    }
   }
 
-  template <typename U, typename TT = T, detail::is_owner<TT> = 0>
-  [[nodiscard]] auto translate(const basic_rect<U>& rect) const noexcept -> basic_rect<U>
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+  [[nodiscard]] auto scratch_vertices() noexcept -> std::vector<SDL_Vertex>&
   {
-    return basic_rect<U>{translate(rect.position()), rect.size()};
+    if constexpr (detail::is_owning<T>())
+    {
+      return m_renderer.scratchVertices;
+    }
+    else
+    {
+      thread_local std::vector<SDL_Vertex> vertices;
+      return vertices;
+    }
   }
-};
+
+  [[nodiscard]] auto scratch_indices() noexcept -> std::vector<int>&
+  {
+    if constexpr (detail::is_owning<T>())
+    {
+      return m_renderer.scratchIndices;
+    }
+    else
+    {
+      thread_local std::vector<int> indices;
+      return indices;
+    }
+  }
+
+  static void append_quad(std::vector<SDL_Vertex>& vertices,
+                          std::vector<int>& indices,
+                          const frect& dst,
+                          const irect& src,
+                          const iarea textureSize,
+                          const SDL_Color& color)
+  {
+    const auto width = static_cast<float>(textureSize.width);
+    const auto height = static_cast<float>(textureSize.height);
+
+    const auto u0 = static_cast<float>(src.x()) / width;
+    const auto v0 = static_cast<float>(src.y()) / height;
+    const auto u1 = static_cast<float>(src.max_x()) / width;
+    const auto v1 = static_cast<float>(src.max_y()) / height;
+
+    const auto base = isize(vertices);
+
+    vertices.push_back({{dst.x(), dst.y()}, color, {u0, v0}});
+    vertices.push_back({{dst.max_x(), dst.y()}, color, {u1, v0}});
+    vertices.push_back({{dst.max_x(), dst.max_y()}, color, {u1, v1}});
+    vertices.push_back({{dst.x(), dst.max_y()}, color, {u0, v1}});
+
+    indices.insert(indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+  }
+
+#ifndef CENTURION_NO_SDL_TTF
+
+  template <typename String>
+  auto render_atlas_text(const font_cache& cache,
+                         const String& str,
+                         const ipoint position,
+                         const bool kerning,
+                         const font_cache::glyph_style* style,
+                         const fpoint origin = {},
+                         const float scale = 1) -> rendered_text
+  {
+    const SDL_Color white{0xFF, 0xFF, 0xFF, 0xFF};
+
+    auto& vertices = scratch_vertices();
+    auto& indices = scratch_indices();
+
+    rendered_text layout{position, {}};
+
+    // Glyphs are usually stored in a single page, so this loop is typically a single pass
+    for (std::size_t page = 0; page < cache.glyph_page_count(); ++page)
+    {
+      vertices.clear();
+      indices.clear();
+
+      const auto texture = cache.glyph_page(page);
+      const auto textureSize = texture.size();
+
+      const auto append = [&](const placed_glyph& glyph) {
+        if (glyph.atlas->page == page)
+        {
+          append_quad(vertices,
+                      indices,
+                      scale_rect(glyph.dst, origin, scale),
+                      glyph.atlas->source,
+                      textureSize,
+                      white);
+        }
+      };
+
+      layout = layout_text(cache, str, position, kerning, style, append);
+
+      if (!indices.empty())
+      {
+        render_geometry(texture.get(),
+                        vertices.data(),
+                        isize(vertices),
+                        indices.data(),
+                        isize(indices));
+      }
+    }
+
+    return layout;
+  }
+
+#endif  // CENTURION_NO_SDL_TTF
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+#ifndef CENTURION_NO_SDL_TTF
+
+  [[nodiscard]] static auto scale_rect(const irect& rect,
+                                       const fpoint origin,
+                                       const float scale) noexcept -> frect
+  {
+    return frect{{origin.x() + static_cast<float>(rect.x()) * scale,
+                  origin.y() + static_cast<float>(rect.y()) * scale},
+                 {static_cast<float>(rect.width()) * scale,
+                  static_cast<float>(rect.height()) * scale}};
+  }
+
+  // Offsets glyphs by their outline, and aligns the glyphs of fallback fonts to the
+  // baseline of the main font
+  [[nodiscard]] static auto glyph_offset(const font_cache& cache,
+                                         const std::size_t fontIndex,
+                                         const int outline) -> ipoint
+  {
+    if (fontIndex == 0)
+    {
+      return {-outline, -outline};
+    }
+
+    const auto baseline = cache.get_font().ascent() - cache.get_font(fontIndex).ascent();
+    return {-outline, baseline - outline};
+  }
+
+  struct placed_glyph final
+  {
+    irect dst;
+    const font_cache::atlas_glyph* atlas{};
+    const font_cache::glyph_data* data{};
+  };
+
+  struct cached_glyph final
+  {
+    const font_cache::atlas_glyph* atlas{};
+    const font_cache::glyph_data* data{};
+    ipoint offset;  // The offset of the glyph from the pen, see glyph_offset()
+  };
+
+  // Looks up a glyph, or a styled variant of it if the style isn't null
+  [[nodiscard]] static auto find_glyph(const font_cache& cache,
+                                       const unicode glyph,
+                                       const font_cache::glyph_style* style)
+      -> cached_glyph
+  {
+    cached_glyph found;
+
+    if (style)
+    {
+      found.atlas = cache.try_at_atlas(glyph, *style);
+      found.data = found.atlas ? nullptr : cache.try_at(glyph, *style);
+    }
+    else
+    {
+      found.atlas = cache.try_at_atlas(glyph);
+      found.data = found.atlas ? nullptr : cache.try_at(glyph);
+    }
+
+    if (found.atlas || found.data)
+    {
+      const auto fontIndex = found.atlas ? found.atlas->fontIndex
+                             : style     ? cache.font_index(glyph, *style)
+                                         : cache.font_index(glyph);
+      const auto outline = style ? style->outline : cache.get_font(fontIndex).outline();
+      found.offset = glyph_offset(cache, fontIndex, outline);
+    }
+
+    return found;
+  }
+
+  auto render_cached_glyph(const font_cache& cache,
+                           const cached_glyph& found,
+                           const ipoint position) -> int
+  {
+    const auto spread = cache.distance_field_spread();
+
+    if (const auto* data = found.atlas)
+    {
+      const auto& [page, source, metrics, fontIndex] = *data;
+
+      const auto x = position.x() + metrics.minX + found.offset.x();
+      const auto y = position.y() + found.offset.y();
+
+      const irect dst{{x - spread, y - spread}, source.size()};
+      render(cache.glyph_page(page), source, dst);
+
+      return x + metrics.advance;
+    }
+    else if (const auto* data = found.data)
+    {
+      const auto& [texture, metrics] = *data;
+
+      // SDL_ttf handles the y-axis alignment
+      const auto x = position.x() + metrics.minX + found.offset.x();
+      const auto y = position.y() + found.offset.y();
+
+      render(texture, ipoint{x - spread, y - spread});
+
+      return x + metrics.advance;
+    }
+    else
+    {
+      return position.x();
+    }
+  }
+
+  template <typename String>
+  auto render_cached_text(const font_cache& cache,
+                          const String& str,
+                          const ipoint position,
+                          const font_cache::glyph_style* style) -> rendered_text
+  {
+    CENTURION_PROFILE_SCOPE("renderer::render_text_batched");
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (cache.is_using_glyph_atlas())
+    {
+      return render_atlas_text(cache, str, position, true, style);
+    }
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+    return layout_text(cache, str, position, true, style, [&](const placed_glyph& glyph) {
+      if (glyph.atlas)
+      {
+        render(cache.glyph_page(glyph.atlas->page), glyph.atlas->source, glyph.dst);
+      }
+      else
+      {
+        render(glyph.data->cached, glyph.dst);
+      }
+    });
+  }
+
+  template <typename String, typename Callable>
+  static auto layout_text(const font_cache& cache,
+                          const String& str,
+                          const ipoint position,
+                          const bool kerning,
+                          const font_cache::glyph_style* style,
+                          Callable&& callable) -> rendered_text
+  {
+    const auto& font = cache.get_font();
+    const auto spread = cache.distance_field_spread();
+    const auto lineSkip = font.line_skip();
+    const auto useKerning = kerning && font.has_kerning();
+
+    auto pen = position;
+    auto previous = unicode{};
+
+    auto minX = position.x();
+    auto minY = position.y();
+    auto maxX = position.x();
+    auto maxY = position.y();
+    bool empty = true;
+
+    for (const unicode glyph : str)
+    {
+      if (glyph == '\n')
+      {
+        pen.set_x(position.x());
+        pen.set_y(pen.y() + lineSkip);
+        previous = 0;
+        continue;
+      }
+
+      const auto found = find_glyph(cache, glyph, style);
+
+      placed_glyph placed;
+      glyph_metrics metrics{};
+      iarea size{};
+
+      if (const auto* atlas = found.atlas)
+      {
+        placed.atlas = atlas;
+        metrics = atlas->metrics;
+        size = atlas->source.size();
+      }
+      else if (const auto* data = found.data)
+      {
+        placed.data = data;
+        metrics = data->metrics;
+        size = data->cached.size();
+      }
+      else
+      {
+        continue;
+      }
+
+      if (useKerning && previous != 0)
+      {
+        pen.set_x(pen.x() + cache.kerning(previous, glyph));
+      }
+
+      // SDL_ttf handles the y-axis alignment
+      // Distance field glyphs are padded by the spread on each side
+      const auto x = pen.x() + metrics.minX + found.offset.x();
+      const auto y = pen.y() + found.offset.y();
+      placed.dst = irect{{x - spread, y - spread}, size};
+
+      callable(placed);
+
+      if (empty || placed.dst.x() < minX)
+      {
+        minX = placed.dst.x();
+      }
+
+      if (empty || placed.dst.y() < minY)
+      {
+        minY = placed.dst.y();
+      }
+
+      if (empty || placed.dst.max_x() > maxX)
+      {
+        maxX = placed.dst.max_x();
+      }
+
+      if (empty || placed.dst.max_y() > maxY)
+      {
+        maxY = placed.dst.max_y();
+      }
+
+      empty = false;
+      pen.set_x(x + metrics.advance);
+      previous = glyph;
+    }
+
+    if (empty)
+    {
+      return {pen, irect{position, {}}};
+    }
+    else
+    {
+      return {pen, irect{{minX, minY}, {maxX - minX, maxY - minY}}};
+    }
+  }
+
+#endif  // CENTURION_NO_SDL_TTF
+
+  struct placed_bitmap_glyph final
+  {
+    irect dst;
+    const bitmap_font::glyph_data* data{};
+  };
+
+  template <typename String, typename Callable>
+  static auto layout_bitmap_text(const bitmap_font& font,
+                                 const String& str,
+                                 const ipoint position,
+                                 const bool kerning,
+                                 Callable&& callable) -> rendered_text
+  {
+    const auto useKerning = kerning && font.has_kerning();
+
+    auto pen = position;
+    auto previous = unicode{};
+
+    irect bounds{position, {}};
+    bool empty = true;
+
+    for (const unicode glyph : str)
+    {
+      if (glyph == '\n')
+      {
+        pen.set_x(position.x());
+        pen.set_y(pen.y() + font.line_height());
+        previous = 0;
+        continue;
+      }
+
+      const auto* data = font.try_at(glyph);
+      if (!data)
+      {
+        continue;
+      }
+
+      if (useKerning && previous != 0)
+      {
+        pen.set_x(pen.x() + font.kerning(previous, glyph));
+      }
+
+      const placed_bitmap_glyph placed{{pen + data->offset, data->source.size()}, data};
+      callable(placed);
+
+      if (placed.dst.has_area())
+      {
+        bounds = empty ? placed.dst : get_union(bounds, placed.dst);
+        empty = false;
+      }
+
+      pen.set_x(pen.x() + data->advance);
+      previous = glyph;
+    }
+
+    return {pen, bounds};
+  }
+
+  template <typename String>
+  auto render_bitmap_text(const bitmap_font& font,
+                          const String& str,
+                          const ipoint position,
+                          const bool kerning) -> rendered_text
+  {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (font.page_count() == 0)
+    {
+      return layout_bitmap_text(font, str, position, kerning, [](const auto&) {});
+    }
+
+    const SDL_Color white{0xFF, 0xFF, 0xFF, 0xFF};
+
+    auto& vertices = scratch_vertices();
+    auto& indices = scratch_indices();
+
+    rendered_text layout{position, {}};
+
+    // Bitmap fonts usually have a single page, so this loop is typically a single pass
+    for (std::size_t page = 0; page < font.page_count(); ++page)
+    {
+      vertices.clear();
+      indices.clear();
+
+      const auto texture = font.page(page);
+      const auto textureSize = texture.size();
+
+      const auto append = [&](const placed_bitmap_glyph& glyph) {
+        if (glyph.data->page == page)
+        {
+          append_quad(vertices,
+                      indices,
+                      cast<frect>(glyph.dst),
+                      glyph.data->source,
+                      textureSize,
+                      white);
+        }
+      };
+
+      layout = layout_bitmap_text(font, str, position, kerning, append);
+
+      if (!indices.empty())
+      {
+        render_geometry(texture.get(),
+                        vertices.data(),
+                        isize(vertices),
+                        indices.data(),
+                        isize(indices));
+      }
+    }
+
+    return layout;
+#else
+    const auto renderGlyph = [&](const placed_bitmap_glyph& glyph) {
+      if (glyph.data->page < font.page_count())
+      {
+        render(font.page(glyph.data->page), glyph.data->source, glyph.dst);
+      }
+    };
+
+    return layout_bitmap_text(font, str, position, kerning, renderGlyph);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+  }
+
+  auto submit_points(const std::vector<SDL_FPoint>& points) noexcept -> result
+  {
+    if (points.empty())
+    {
+      return success;
+    }
+
+    count_draw(&render_stats::point_calls, isize(points));
+    return SDL_RenderDrawPointsF(get(), points.data(), isize(points)) == 0;
+  }
+
+  auto submit_rects(const std::vector<SDL_FRect>& rects) noexcept -> result
+  {
+    if (rects.empty())
+    {
+      return success;
+    }
+
+    count_draw(&render_stats::fill_calls, 4 * isize(rects));
+    return SDL_RenderFillRectsF(get(), rects.data(), isize(rects)) == 0;
+  }
+
+  template <typename U>
+  static void append_circle_points(std::vector<SDL_FPoint>& points,
+                                   const basic_point<U>& position,
+                                   const float radius)
+  {
+    using value_t = typename basic_point<U>::value_type;
+
+    const auto cx = static_cast<float>(position.x()) - 0.5f;
+    const auto cy = static_cast<float>(position.y()) - 0.5f;
+
+    // Truncates the coordinates in the same way as integral points would
+    const auto add = [&](const float px, const float py) {
+      points.push_back({static_cast<float>(static_cast<value_t>(px)),
+                        static_cast<float>(static_cast<value_t>(py))});
+    };
+
+    auto error = -radius;
+    auto x = radius - 0.5f;
+    auto y = 0.5f;
+
+    while (x >= y)
+    {
+      add(cx + x, cy + y);
+      add(cx + y, cy + x);
+
+      if (x != 0)
+      {
+        add(cx - x, cy + y);
+        add(cx + y, cy - x);
+      }
+
+      if (y != 0)
+      {
+        add(cx + x, cy - y);
+        add(cx - y, cy + x);
+      }
+
+      if (x != 0 && y != 0)
+      {
+        add(cx - x, cy - y);
+        add(cx - y, cy - x);
+      }
+
+      error += y;
+      ++y;
+      error += y;
+
+      if (error >= 0)
+      {
+        --x;
+        error -= x;
+        error -= x;
+      }
+    }
+  }
+
+  static void append_circle_rows(std::vector<SDL_FRect>& rows,
+                                 const fpoint center,
+                                 const float radius)
+  {
+    const auto cx = center.x();
+    const auto cy = center.y();
+
+    for (auto dy = 1.0f; dy <= radius; dy += 1.0f)
+    {
+      const auto dx = std::floor(std::sqrt((2.0f * radius * dy) - (dy * dy)));
+      const auto width = (2.0f * dx) + 1.0f;
+
+      rows.push_back({cx - dx, cy + dy - radius, width, 1.0f});
+      rows.push_back({cx - dx, cy - dy + radius, width, 1.0f});
+    }
+  }
+
+  void count([[maybe_unused]] u32 render_stats::*counter) noexcept
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    if constexpr (detail::is_owning<T>())
+    {
+      ++(m_renderer.stats.*counter);
+    }
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+
+  void count_draw([[maybe_unused]] u32 render_stats::*kind,
+                  [[maybe_unused]] const int vertices) noexcept
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    if constexpr (detail::is_owning<T>())
+    {
+      ++(m_renderer.stats.*kind);
+      m_renderer.stats.vertices += static_cast<u32>(vertices);
+      m_renderer.pendingCommands = true;
+    }
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+
+  void count_flush([[maybe_unused]] u32 render_stats::*cause) const noexcept
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    if constexpr (detail::is_owning<T>())
+    {
+      if (m_renderer.batching && m_renderer.pendingCommands)
+      {
+        ++(m_renderer.stats.*cause);
+        m_renderer.pendingCommands = false;
+      }
+    }
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+
+  void count_texture([[maybe_unused]] const SDL_Texture* texture) noexcept
+  {
+#ifdef CENTURION_ENABLE_RENDER_STATS
+    if constexpr (detail::is_owning<T>())
+    {
+      if (texture != m_renderer.lastTexture || m_renderer.stats.texture_switches == 0)
+      {
+        ++m_renderer.stats.texture_switches;
+        m_renderer.lastTexture = texture;
+      }
+    }
+#endif  // CENTURION_ENABLE_RENDER_STATS
+  }
+
+  void count_copy(const SDL_Texture* texture) noexcept
+  {
+    count_draw(&render_stats::copy_calls, 4);
+    count_texture(texture);
+  }
+
+  void invalidate_viewport_and_clip() noexcept
+  {
+    if (auto* cache = state_cache())
+    {
+      cache->viewport.reset();
+      cache->clip.reset();
+    }
+  }
+
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto clip_base() const noexcept -> std::size_t
+  {
+    const auto& targets = m_renderer.targetStack;
+    return targets.empty() ? 0 : targets.back().clipBase;
+  }
+
+  [[nodiscard]] static auto intersect_clips(const irect& fst, const irect& snd) noexcept
+      -> irect
+  {
+    const auto x = (std::max)(fst.x(), snd.x());
+    const auto y = (std::max)(fst.y(), snd.y());
+    const auto maxX = (std::min)(fst.max_x(), snd.max_x());
+    const auto maxY = (std::min)(fst.max_y(), snd.max_y());
+    return {x, y, (std::max)(maxX - x, 0), (std::max)(maxY - y, 0)};
+  }
+
+  auto change_target(SDL_Texture* target) noexcept -> result
+  {
+    // SDL keeps separate viewports and clip rectangles for each render target
+    invalidate_viewport_and_clip();
+
+    count(&render_stats::target_changes);
+    count_flush(&render_stats::target_flushes);
+
+    return SDL_SetRenderTarget(get(), target) == 0;
+  }
+
+  // Overrides the batching hint while the renderer is created, and restores it afterwards
+  [[nodiscard]] static auto create(SDL_Window* window,
+                                   const batching_policy batching,
+                                   const u32 flags) -> SDL_Renderer*
+  {
+    if (batching == batching_policy::automatic)
+    {
+      return SDL_CreateRenderer(window, -1, flags);
+    }
+
+    const auto* previous = SDL_GetHint(SDL_HINT_RENDER_BATCHING);
+    const std::optional<std::string> old = previous ? std::optional{std::string{previous}}
+                                                    : std::nullopt;
+
+    const auto* value = (batching == batching_policy::enabled) ? "1" : "0";
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING, value, SDL_HINT_OVERRIDE);
+
+    auto* renderer = SDL_CreateRenderer(window, -1, flags);
+
+#if SDL_VERSION_ATLEAST(2, 24, 0)
+    // Drops the override, so that the application can still change the hint afterwards
+    SDL_ResetHint(SDL_HINT_RENDER_BATCHING);
+    if (old)
+    {
+      SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING, old->c_str(), SDL_HINT_NORMAL);
+    }
+#else
+    // The priority of a hint can't be lowered before SDL 2.24, so it stays overridden.
+    // SDL treats an empty hint as unset, which enables batching by default.
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING,
+                            old ? old->c_str() : "",
+                            SDL_HINT_OVERRIDE);
+#endif  // SDL_VERSION_ATLEAST(2, 24, 0)
+
+    return renderer;
+  }
+
+  // Mirrors the logic that SDL uses to decide whether or not a new renderer batches
+  [[nodiscard]] auto detect_batching(const batching_policy batching) const noexcept
+      -> bool
+  {
+    if (batching != batching_policy::automatic)
+    {
+      return batching == batching_policy::enabled;
+    }
+
+    if (const auto* hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING); hint && *hint)
+    {
+      return SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_TRUE) == SDL_TRUE;
+    }
+
+    // Applications that request a specific driver may make their own API calls
+    if (const auto* driver = SDL_GetHint(SDL_HINT_RENDER_DRIVER); driver && *driver)
+    {
+      SDL_RendererInfo info{};
+      if (SDL_GetRendererInfo(get(), &info) == 0 && info.name &&
+          SDL_strcasecmp(driver, info.name) == 0)
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+#ifndef CENTURION_NO_SDL_TTF
+
+  [[nodiscard]] auto render_text(owner<SDL_Surface*> s) -> texture
+  {
+    surface surface{s};
+
+    const texture_category_scope scope{texture_category::text};
+    texture texture{SDL_CreateTextureFromSurface(get(), surface.get())};
+
+    count(&render_stats::text_textures);
+    return texture;
+  }
+
+#endif  // CENTURION_NO_SDL_TTF
+
+  template <typename U, typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto translate(const basic_point<U>& point) const noexcept
+      -> basic_point<U>
+  {
+    using value_type = typename basic_point<U>::value_type;
+
+    const auto& translation = m_renderer.translation;
+    const auto x = point.x() - static_cast<value_type>(translation.x());
+    const auto y = point.y() - static_cast<value_type>(translation.y());
+
+    return basic_point<U>{x, y};
+  }
+
+  template <typename U, typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto translate(const basic_rect<U>& rect) const noexcept -> basic_rect<U>
+  {
+    return basic_rect<U>{translate(rect.position()), rect.size()};
+  }
+
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto translate_rects(const Container& container) -> const std::vector<SDL_FRect>&
+  {
+    using value_t = typename Container::value_type::value_type;
+
+    // Integral rectangles are translated by truncated offsets, just like translate()
+    const auto dx = static_cast<float>(static_cast<value_t>(m_renderer.translation.x()));
+    const auto dy = static_cast<float>(static_cast<value_t>(m_renderer.translation.y()));
+
+    auto& rects = m_renderer.scratchRects;
+    rects.resize(container.size());
+
+    auto* out = rects.data();
+    for (const auto& rect : container)
+    {
+      *out++ = {static_cast<float>(rect.x()) - dx,
+                static_cast<float>(rect.y()) - dy,
+                static_cast<float>(rect.width()),
+                static_cast<float>(rect.height())};
+    }
+
+    return rects;
+  }
+
+  template <typename Container, typename TT = T, detail::is_owner<TT> = 0>
+  auto translate_points(const Container& container) -> const std::vector<SDL_FPoint>&
+  {
+    using value_t = typename Container::value_type::value_type;
+
+    const auto dx = static_cast<float>(static_cast<value_t>(m_renderer.translation.x()));
+    const auto dy = static_cast<float>(static_cast<value_t>(m_renderer.translation.y()));
+
+    auto& points = m_renderer.scratchPoints;
+    points.resize(container.size());
+
+    auto* out = points.data();
+    for (const auto& point : container)
+    {
+      *out++ = {static_cast<float>(point.x()) - dx, static_cast<float>(point.y()) - dy};
+    }
+
+    return points;
+  }
+};
+
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_renderer<detail::owning_type>;
+extern template class basic_renderer<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
+template <typename T>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_renderer<T>& renderer) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("renderer{data: ", renderer.get(), "}");
+}
 
 template <typename T>
 [[nodiscard]] auto to_string(const basic_renderer<T>& renderer) -> std::string
 {
-  return "renderer{data: " + detail::address_of(renderer.get()) + "}";
+  return detail::format_string(renderer);
 }
 
 template <typename T>
@@ -7,11 +7,12 @@
 #include <cstddef>   // size_t
 #include <optional>  // optional
 #include <ostream>   // ostream
-#include <string>    // string, string_literals
+#include <string>    // string
 
 #include "../core/czstring.hpp"
 #include "../core/exception.hpp"
 #include "../core/integers.hpp"
+#include "../detail/format_writer.hpp"
 #include "../math/area.hpp"
 #include "pixel_format.hpp"
 #include "renderer.hpp"
@@ -190,6 +191,26 @@ class renderer_info final
   {}
 };
 
+/**
+ * \brief Writes a textual representation of a `renderer_info` instance to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param info the renderer info instance that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+inline auto format_to(char* buffer,
+                      const std::size_t size,
+                      const renderer_info& info) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("renderer_info{name: ", str_or_na(info.name()), "}");
+}
+
 /**
  * \brief Returns a textual representation of a `renderer_info` instance.
  *
@@ -201,8 +222,7 @@ class renderer_info final
  */
 [[nodiscard]] inline auto to_string(const renderer_info& info) -> std::string
 {
-  using namespace std::string_literals;
-  return "renderer_info{name: "s + str_or_na(info.name()) + "}";
+  return detail::format_string(info);
 }
 
 /**
@@ -0,0 +1,373 @@
+#ifndef CENTURION_RESAMPLING_HEADER
+#define CENTURION_RESAMPLING_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t, ptrdiff_t
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../detail/resample_kernels.hpp"
+#include "../detail/surface_read_lock.hpp"
+#include "../math/area.hpp"
+#include "../thread/parallel.hpp"
+#include "../thread/thread_pool.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum resample_filter
+ *
+ * \brief Provides values for the filters that are used to resize surfaces.
+ *
+ * \see `resize()`
+ *
+ * \since 6.1.0
+ */
+enum class resample_filter
+{
+  box,       ///< Averages the covered pixels, fast and suitable for large reductions.
+  bilinear,  ///< A triangle filter, the default trade-off between speed and quality.
+  lanczos    ///< A three-lobed Lanczos filter, the sharpest but slowest filter.
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+/// \cond FALSE
+namespace cen::detail {
+
+inline constexpr int resample_grain = 16;  // The amount of rows per parallel chunk
+
+[[nodiscard]] constexpr auto to_resample_kernel(const resample_filter filter) noexcept
+    -> resample_kernel
+{
+  switch (filter)
+  {
+    case resample_filter::box:
+      return resample_kernel::box;
+
+    case resample_filter::bilinear:
+      return resample_kernel::triangle;
+
+    case resample_filter::lanczos:
+      return resample_kernel::lanczos3;
+
+    default:
+      assert(false);
+      return resample_kernel::box;
+  }
+}
+
+// Invokes a function with ranges of rows, on the pool if there is one
+template <typename Function>
+void for_each_row(thread_pool* pool, const int rows, Function&& function)
+{
+  if (pool && rows > resample_grain)
+  {
+    parallel_for(*pool, 0, rows, resample_grain, function);
+  }
+  else
+  {
+    function(0, rows);
+  }
+}
+
+[[nodiscard]] inline auto row_of(SDL_Surface* surface, const int row) noexcept -> u8*
+{
+  const auto offset = static_cast<std::ptrdiff_t>(row) * surface->pitch;
+  return static_cast<u8*>(surface->pixels) + offset;
+}
+
+// Resamples a surface in one of the formats supported by the pixel kernels
+inline void resample_surface(thread_pool* pool,
+                             SDL_Surface* source,
+                             SDL_Surface* target,
+                             const resample_kernel kernel)
+{
+  const surface_read_lock lock{source};
+
+  const auto level = get_simd_level();
+  const int sourceWidth = source->w;
+  const int sourceHeight = source->h;
+  const int targetWidth = target->w;
+  const int targetHeight = target->h;
+
+  // The horizontal pass produces full-height rows with the target width
+  std::vector<u8> middle;
+  const u8* middleBase = static_cast<const u8*>(source->pixels);
+  std::size_t middlePitch = static_cast<std::size_t>(source->pitch);
+
+  if (sourceWidth != targetWidth)
+  {
+    const auto taps = make_resample_taps(kernel, sourceWidth, targetWidth);
+    const auto padded = taps.count > sourceWidth;
+
+    middlePitch = static_cast<std::size_t>(targetWidth) * 4;
+    middle.resize(middlePitch * static_cast<std::size_t>(sourceHeight));
+
+    for_each_row(pool, sourceHeight, [&](const int first, const int last) {
+      // The padding taps of tiny sources would read past the end of the rows
+      std::vector<u8> scratch;
+      if (padded)
+      {
+        scratch.resize(static_cast<std::size_t>(taps.count) * 4);
+      }
+
+      for (int row = first; row < last; ++row)
+      {
+        const u8* src = row_of(source, row);
+        if (padded)
+        {
+          SDL_memcpy(scratch.data(), src, static_cast<std::size_t>(sourceWidth) * 4);
+          src = scratch.data();
+        }
+
+        resample_row(level, taps, src, middle.data() + row * middlePitch, targetWidth);
+      }
+    });
+
+    middleBase = middle.data();
+  }
+
+  const auto taps = make_resample_taps(kernel, sourceHeight, targetHeight);
+  const auto bytes = static_cast<std::size_t>(targetWidth) * 4;
+
+  for_each_row(pool, targetHeight, [&](const int first, const int last) {
+    std::vector<const u8*> rows(static_cast<std::size_t>(taps.count));
+
+    for (int row = first; row < last; ++row)
+    {
+      const auto start = taps.first[static_cast<std::size_t>(row)];
+      for (int tap = 0; tap < taps.count; ++tap)
+      {
+        const auto index = (start + tap < sourceHeight) ? start + tap : sourceHeight - 1;
+        rows[static_cast<std::size_t>(tap)] = middleBase + index * middlePitch;
+      }
+
+      const auto* weights =
+          taps.weights.data() + static_cast<std::size_t>(row) * taps.count;
+      auto* dst = row_of(target, row);
+      resample_column(level, rows.data(), weights, taps.count, dst, bytes);
+    }
+  });
+}
+
+// Averages 2x2 blocks, the source dimensions must be twice the target dimensions
+inline void halve_surface(thread_pool* pool, SDL_Surface* source, SDL_Surface* target)
+{
+  const surface_read_lock lock{source};
+  const auto level = get_simd_level();
+
+  for_each_row(pool, target->h, [&](const int first, const int last) {
+    for (int row = first; row < last; ++row)
+    {
+      halve_row(level,
+                row_of(source, row * 2),
+                row_of(source, row * 2 + 1),
+                row_of(target, row),
+                target->w);
+    }
+  });
+}
+
+[[nodiscard]] inline auto is_resample_format(const u32 format) noexcept -> bool
+{
+  channel_layout layout;
+  return get_channel_layout(format, layout);
+}
+
+template <typename T>
+[[nodiscard]] auto resize_impl(thread_pool* pool,
+                               const basic_surface<T>& source,
+                               const iarea size,
+                               const resample_filter filter) -> surface
+{
+  if (size.width < 1 || size.height < 1)
+  {
+    throw cen_error{"Cannot resize surface to an empty size!"};
+  }
+
+  // Other formats are converted to a format supported by the kernels first
+  const auto format = source.format_info().format();
+  if (!is_resample_format(to_underlying(format)))
+  {
+    return resize_impl(pool, source.convert(pixel_format::argb8888), size, filter);
+  }
+
+  surface result{size, format};
+  resample_surface(pool, source.get(), result.get(), to_resample_kernel(filter));
+  result.set_blend_mode(source.get_blend_mode());
+
+  return result;
+}
+
+template <typename T>
+[[nodiscard]] auto make_mipmaps_impl(thread_pool* pool, const basic_surface<T>& source)
+    -> std::vector<surface>
+{
+  const auto format = source.format_info().format();
+  if (!is_resample_format(to_underlying(format)))
+  {
+    return make_mipmaps_impl(pool, source.convert(pixel_format::argb8888));
+  }
+
+  std::vector<surface> levels;
+
+  auto* previous = source.get();
+  while (previous->w > 1 || previous->h > 1)
+  {
+    const iarea size{(previous->w > 1) ? previous->w / 2 : 1,
+                     (previous->h > 1) ? previous->h / 2 : 1};
+
+    surface level{size, format};
+    if (previous->w == size.width * 2 && previous->h == size.height * 2)
+    {
+      halve_surface(pool, previous, level.get());
+    }
+    else
+    {
+      resample_surface(pool, previous, level.get(), resample_kernel::box);
+    }
+
+    level.set_blend_mode(source.get_blend_mode());
+    levels.push_back(std::move(level));
+    previous = levels.back().get();
+  }
+
+  return levels;
+}
+
+}  // namespace cen::detail
+/// \endcond
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \brief Creates a resized copy of a surface.
+ *
+ * \details Surfaces are resampled with a separable filter, which is applied horizontally
+ * and then vertically with fixed-point arithmetic, using SSE2 or NEON instructions when
+ * they are supported. All four channels are filtered independently, so translucent
+ * images should have premultiplied alpha for correct results, see
+ * `basic_surface::premultiply_alpha()`.
+ *
+ * \details The 32-bit formats listed in `has_fast_conversion()` are resampled directly,
+ * other surfaces are converted to `pixel_format::argb8888` first, which is then the
+ * format of the result.
+ *
+ * \tparam T the ownership semantics of the surface.
+ *
+ * \param source the surface that will be resized.
+ * \param size the size of the resized surface, must be at least 1x1.
+ * \param filter the filter that will be used.
+ *
+ * \return the resized surface, with the blend mode of the source.
+ *
+ * \throws cen_error if the size is empty.
+ * \throws sdl_error if a surface couldn't be created or locked.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+[[nodiscard]] auto resize(const basic_surface<T>& source,
+                          const iarea size,
+                          const resample_filter filter = resample_filter::bilinear)
+    -> surface
+{
+  return detail::resize_impl(nullptr, source, size, filter);
+}
+
+/**
+ * \brief Creates a resized copy of a surface, with the rows processed in parallel.
+ *
+ * \param pool the thread pool that the work is distributed to.
+ * \param source the surface that will be resized.
+ * \param size the size of the resized surface, must be at least 1x1.
+ * \param filter the filter that will be used.
+ *
+ * \return the resized surface, with the blend mode of the source.
+ *
+ * \throws cen_error if the size is empty.
+ * \throws sdl_error if a surface couldn't be created or locked.
+ *
+ * \see `resize(const basic_surface<T>&, iarea, resample_filter)`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+[[nodiscard]] auto resize(thread_pool& pool,
+                          const basic_surface<T>& source,
+                          const iarea size,
+                          const resample_filter filter = resample_filter::bilinear)
+    -> surface
+{
+  return detail::resize_impl(&pool, source, size, filter);
+}
+
+/**
+ * \brief Creates the mipmap chain of a surface.
+ *
+ * \details Every level is half the size of the previous level, rounded down, until the
+ * 1x1 level is reached. Levels with even dimensions are produced by averaging 2x2 blocks
+ * of the previous level, other levels use the box filter. The format of the levels is
+ * chosen in the same way as by `resize()`.
+ *
+ * \tparam T the ownership semantics of the surface.
+ *
+ * \param source the surface that will be downscaled, i.e. the base level.
+ *
+ * \return the levels below the base level, from the largest to the smallest; an empty
+ * vector if the surface is 1x1.
+ *
+ * \throws sdl_error if a surface couldn't be created or locked.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+[[nodiscard]] auto make_mipmaps(const basic_surface<T>& source) -> std::vector<surface>
+{
+  return detail::make_mipmaps_impl(nullptr, source);
+}
+
+/**
+ * \brief Creates the mipmap chain of a surface, with the rows of every level processed
+ * in parallel.
+ *
+ * \param pool the thread pool that the work is distributed to.
+ * \param source the surface that will be downscaled, i.e. the base level.
+ *
+ * \return the levels below the base level, from the largest to the smallest.
+ *
+ * \throws sdl_error if a surface couldn't be created or locked.
+ *
+ * \see `make_mipmaps(const basic_surface<T>&)`
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+[[nodiscard]] auto make_mipmaps(thread_pool& pool, const basic_surface<T>& source)
+    -> std::vector<surface>
+{
+  return detail::make_mipmaps_impl(&pool, source);
+}
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_RESAMPLING_HEADER
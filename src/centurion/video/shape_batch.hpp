@@ -0,0 +1,735 @@
+#ifndef CENTURION_SHAPE_BATCH_HEADER
+#define CENTURION_SHAPE_BATCH_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max, min
+#include <cmath>      // sqrt, atan2, cos, sin, ceil
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/polygon_triangulation.hpp"
+#include "../math/point.hpp"
+#include "color.hpp"
+#include "renderer.hpp"
+
+namespace cen {
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum line_join
+ *
+ * \brief Provides the shapes of the corners between the segments of thick polylines.
+ *
+ * \see `stroke`
+ *
+ * \since 6.1.0
+ */
+enum class line_join
+{
+  miter,  ///< Sharp corners, that are beveled beyond the miter limit.
+  bevel,  ///< Corners that are cut off.
+  round   ///< Rounded corners.
+};
+
+/**
+ * \enum line_cap
+ *
+ * \brief Provides the shapes of the ends of thick open polylines.
+ *
+ * \see `stroke`
+ *
+ * \since 6.1.0
+ */
+enum class line_cap
+{
+  butt,    ///< Lines end exactly at their end points.
+  square,  ///< Lines are extended by half their width.
+  round    ///< Lines end with half circles.
+};
+
+/**
+ * \struct stroke
+ *
+ * \brief Describes how thick lines and polylines are drawn.
+ *
+ * \since 6.1.0
+ */
+struct stroke final
+{
+  float width{1};                    ///< The thickness of the line.
+  line_join join{line_join::miter};  ///< The shape of the corners.
+  line_cap cap{line_cap::butt};      ///< The shape of the ends of open lines.
+  float miterLimit{4};               ///< The maximum miter length, relative to the width.
+};
+
+/**
+ * \class polygon_mesh
+ *
+ * \brief A polygon that has been triangulated, so that it can be filled repeatedly.
+ *
+ * \details Concave polygons are triangulated by ear clipping, which takes quadratic time
+ * in the amount of vertices. Meshes should therefore be created once and reused, e.g.
+ * for the areas of a chart, which can then be filled at different offsets every frame.
+ *
+ * \see `shape_batch`
+ *
+ * \since 6.1.0
+ */
+class polygon_mesh final
+{
+ public:
+  /**
+   * \brief Triangulates a polygon.
+   *
+   * \tparam Container the container type, must store `fpoint` instances contiguously.
+   *
+   * \param points the vertices of the polygon, in either winding order.
+   *
+   * \throws cen_error if the polygon has fewer than three vertices, no area, or
+   * intersects itself.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  explicit polygon_mesh(const Container& points)
+      : m_points{points.data(), points.data() + points.size()}
+  {
+    if (!detail::triangulate_polygon(m_points.data(), m_points.size(), m_indices))
+    {
+      throw cen_error{"Failed to triangulate polygon!"};
+    }
+  }
+
+  [[nodiscard]] auto points() const noexcept -> const std::vector<fpoint>&
+  {
+    return m_points;
+  }
+
+  /**
+   * \brief Returns the indices of the triangles, three per triangle.
+   *
+   * \return the indices into the vertices of the polygon.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto indices() const noexcept -> const std::vector<int>&
+  {
+    return m_indices;
+  }
+
+  [[nodiscard]] auto triangle_count() const noexcept -> std::size_t
+  {
+    return m_indices.size() / 3u;
+  }
+
+ private:
+  std::vector<fpoint> m_points;
+  std::vector<int> m_indices;
+};
+
+/**
+ * \class shape_batch
+ *
+ * \brief Collects untextured shapes, and renders them with a single geometry call.
+ *
+ * \details The renderer only provides one pixel wide lines, and circles that consist of
+ * many individual points. This class instead turns shapes into triangles, which makes it
+ * possible to draw thick polylines with joins and caps, filled concave polygons and
+ * anti-aliased circles. All shapes that are added to the batch are submitted with one
+ * `SDL_RenderGeometry` call.
+ * \code{cpp}
+ *   cen::shape_batch shapes;
+ *
+ *   shapes.add_polyline(samples, {2.5f, cen::line_join::round}, cen::colors::orange);
+ *   shapes.add_polygon(areaMesh, cen::colors::steel_blue.with_alpha(0x60));
+ *   for (const auto& sample : samples) {
+ *     shapes.add_circle(sample, 4, cen::colors::white);
+ *   }
+ *
+ *   shapes.submit(renderer);
+ * \endcode
+ *
+ * \details Circles are anti-aliased by surrounding them with a thin band of triangles,
+ * whose outer vertices are transparent, so that the edge is blended smoothly with the
+ * background. This requires blending to be enabled, i.e. the draw blend mode of the
+ * renderer, which is used by untextured geometry, must not be `blend_mode::none`.
+ *
+ * \note The segments of translucent polylines overlap at the inner side of their joins,
+ * which makes the overlapping areas slightly more opaque.
+ *
+ * \details The internal buffers are reused between frames, like those of `sprite_batch`.
+ *
+ * \since 6.1.0
+ */
+class shape_batch final
+{
+ public:
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty shape batch.
+   *
+   * \since 6.1.0
+   */
+  shape_batch() = default;
+
+  /// \} End of construction
+
+  /// \name Batching
+  /// \{
+
+  /**
+   * \brief Adds a thick line segment to the batch.
+   *
+   * \param start the start point of the line.
+   * \param end the end point of the line.
+   * \param style the width and cap of the line.
+   * \param tint the color of the line.
+   *
+   * \since 6.1.0
+   */
+  void add_line(const fpoint start,
+                const fpoint end,
+                const stroke& style,
+                const color& tint)
+  {
+    const fpoint points[] = {start, end};
+    add_polyline(points, 2, style, tint, false);
+  }
+
+  /**
+   * \brief Adds a thick polyline to the batch.
+   *
+   * \tparam Container the container type, must store `fpoint` instances contiguously.
+   *
+   * \param points the vertices of the polyline.
+   * \param style the width, joins and caps of the polyline.
+   * \param tint the color of the polyline.
+   * \param closed `true` if the last vertex should be connected to the first vertex;
+   * `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  void add_polyline(const Container& points,
+                    const stroke& style,
+                    const color& tint,
+                    const bool closed = false)
+  {
+    add_polyline(points.data(), points.size(), style, tint, closed);
+  }
+
+  /**
+   * \brief Adds a thick polyline to the batch.
+   *
+   * \details Consecutive duplicate vertices are ignored.
+   *
+   * \param points the vertices of the polyline.
+   * \param count the amount of vertices, lines with fewer than two distinct vertices are
+   * ignored.
+   * \param style the width, joins and caps of the polyline.
+   * \param tint the color of the polyline.
+   * \param closed `true` if the last vertex should be connected to the first vertex;
+   * `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  void add_polyline(const fpoint* points,
+                    const std::size_t count,
+                    const stroke& style,
+                    const color& tint,
+                    const bool closed = false)
+  {
+    m_points.clear();
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      if (m_points.empty() || m_points.back() != points[index])
+      {
+        m_points.push_back(points[index]);
+      }
+    }
+
+    if (closed && m_points.size() > 2 && m_points.front() == m_points.back())
+    {
+      m_points.pop_back();
+    }
+
+    const auto n = m_points.size();
+    if (n < 2 || style.width <= 0)
+    {
+      return;
+    }
+
+    const auto& c = tint.get();
+    const auto half = style.width * 0.5f;
+    const auto isClosed = closed && n > 2;
+    const auto segments = isClosed ? n : n - 1;
+
+    for (std::size_t index = 0; index < segments; ++index)
+    {
+      auto a = m_points[index];
+      auto b = m_points[(index + 1) % n];
+      const auto d = direction(a, b);
+      const fpoint normal{-d.y() * half, d.x() * half};
+
+      if (!isClosed && style.cap == line_cap::square)
+      {
+        if (index == 0)
+        {
+          a = offset(a, d, -half);
+        }
+
+        if (index == segments - 1)
+        {
+          b = offset(b, d, half);
+        }
+      }
+
+      push_quad(a + normal, b + normal, b - normal, a - normal, c);
+    }
+
+    const auto firstJoint = isClosed ? 0u : 1u;
+    const auto lastJoint = isClosed ? n : n - 1;
+    for (auto index = firstJoint; index < lastJoint; ++index)
+    {
+      const auto& prev = m_points[(index + n - 1) % n];
+      const auto& point = m_points[index];
+      const auto& next = m_points[(index + 1) % n];
+      push_join(point, direction(prev, point), direction(point, next), half, style, c);
+    }
+
+    if (!isClosed && style.cap == line_cap::round)
+    {
+      const auto first = direction(m_points[0], m_points[1]);
+      const auto last = direction(m_points[n - 2], m_points[n - 1]);
+
+      push_fan(m_points[0], half, angle_of({-first.y(), first.x()}), pi, c);
+      push_fan(m_points[n - 1], half, angle_of({-last.y(), last.x()}), -pi, c);
+    }
+  }
+
+  /**
+   * \brief Adds a filled polygon that has already been triangulated to the batch.
+   *
+   * \param mesh the triangulated polygon.
+   * \param tint the color of the polygon.
+   * \param offset the offset that is added to the vertices of the polygon.
+   *
+   * \since 6.1.0
+   */
+  void add_polygon(const polygon_mesh& mesh, const color& tint, const fpoint offset = {})
+  {
+    const auto base = isize(m_vertices);
+    for (const auto& point : mesh.points())
+    {
+      push_vertex(point + offset, tint.get());
+    }
+
+    for (const auto index : mesh.indices())
+    {
+      m_indices.push_back(base + index);
+    }
+  }
+
+  /**
+   * \brief Triangulates a polygon and adds it to the batch.
+   *
+   * \details Use `polygon_mesh` for polygons that are filled repeatedly, in order to
+   * avoid triangulating them every time.
+   *
+   * \tparam Container the container type, must store `fpoint` instances contiguously.
+   *
+   * \param points the vertices of the polygon, which may be concave, in either winding
+   * order.
+   * \param tint the color of the polygon.
+   *
+   * \return `true` if the polygon was added; `false` if it couldn't be triangulated.
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto add_polygon(const Container& points, const color& tint) -> bool
+  {
+    const auto base = isize(m_vertices);
+    const auto firstIndex = m_indices.size();
+
+    if (!detail::triangulate_polygon(points.data(), points.size(), m_indices))
+    {
+      return false;
+    }
+
+    for (auto index = firstIndex; index < m_indices.size(); ++index)
+    {
+      m_indices[index] += base;
+    }
+
+    for (const auto& point : points)
+    {
+      push_vertex(point, tint.get());
+    }
+
+    return true;
+  }
+
+  /**
+   * \brief Adds an anti-aliased filled circle to the batch.
+   *
+   * \param center the center of the circle.
+   * \param radius the radius of the circle.
+   * \param tint the color of the circle.
+   * \param feather the width of the band over which the edge fades out, in pixels.
+   *
+   * \since 6.1.0
+   */
+  void add_circle(const fpoint center,
+                  const float radius,
+                  const color& tint,
+                  const float feather = 1)
+  {
+    if (radius <= 0)
+    {
+      return;
+    }
+
+    const auto& c = tint.get();
+    const SDL_Color clear{c.r, c.g, c.b, 0};
+
+    const auto halfFeather = feather * 0.5f;
+    const auto inner = (std::max)(radius - halfFeather, 0.0f);
+    const auto outer = radius + halfFeather;
+    const auto segments = circle_segments(outer);
+
+    const auto centerIndex = push_vertex(center, c);
+    const auto innerBase = push_ring(center, inner, segments, c);
+    const auto outerBase = push_ring(center, outer, segments, clear);
+
+    for (int index = 0; index < segments; ++index)
+    {
+      const auto next = (index + 1) % segments;
+      m_indices.insert(m_indices.end(),
+                       {centerIndex, innerBase + index, innerBase + next});
+    }
+
+    connect_rings(innerBase, outerBase, segments);
+  }
+
+  /**
+   * \brief Adds an anti-aliased circle outline to the batch.
+   *
+   * \param center the center of the circle.
+   * \param radius the radius of the circle, measured to the middle of the outline.
+   * \param width the thickness of the outline.
+   * \param tint the color of the outline.
+   * \param feather the width of the bands over which the edges fade out, in pixels.
+   *
+   * \since 6.1.0
+   */
+  void add_ring(const fpoint center,
+                const float radius,
+                const float width,
+                const color& tint,
+                const float feather = 1)
+  {
+    if (radius <= 0 || width <= 0)
+    {
+      return;
+    }
+
+    const auto& c = tint.get();
+    const SDL_Color clear{c.r, c.g, c.b, 0};
+
+    // Thin outlines are faded towards the middle, instead of having a solid core
+    const auto halfWidth = width * 0.5f;
+    const auto halfFeather = (std::min)(feather * 0.5f, halfWidth);
+    const auto outer = radius + halfWidth + halfFeather;
+    const auto segments = circle_segments(outer);
+
+    const auto innerEdge = push_ring(center,
+                                     (std::max)(radius - halfWidth - halfFeather, 0.0f),
+                                     segments,
+                                     clear);
+    const auto innerSolid = push_ring(center,
+                                      (std::max)(radius - halfWidth + halfFeather, 0.0f),
+                                      segments,
+                                      c);
+    const auto outerSolid =
+        push_ring(center, radius + halfWidth - halfFeather, segments, c);
+    const auto outerEdge = push_ring(center, outer, segments, clear);
+
+    connect_rings(innerEdge, innerSolid, segments);
+    connect_rings(innerSolid, outerSolid, segments);
+    connect_rings(outerSolid, outerEdge, segments);
+  }
+
+  /**
+   * \brief Renders all batched shapes with one geometry call, and clears the batch.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if the shapes were rendered, or if the batch is empty; `failure`
+   * otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto submit(basic_renderer<T>& renderer) noexcept -> result
+  {
+    if (m_indices.empty())
+    {
+      clear();
+      return success;
+    }
+
+    const auto ok = renderer.render_geometry(nullptr,
+                                             m_vertices.data(),
+                                             isize(m_vertices),
+                                             m_indices.data(),
+                                             isize(m_indices));
+    clear();
+    return ok;
+  }
+
+  /**
+   * \brief Removes all shapes from the batch, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_vertices.clear();
+    m_indices.clear();
+  }
+
+  /**
+   * \brief Reserves space for an amount of vertices and indices.
+   *
+   * \param vertices the amount of vertices to reserve space for.
+   * \param indices the amount of indices to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const std::size_t vertices, const std::size_t indices)
+  {
+    m_vertices.reserve(vertices);
+    m_indices.reserve(indices);
+  }
+
+  /// \} End of batching
+
+  /// \name Queries
+  /// \{
+
+  [[nodiscard]] auto vertex_count() const noexcept -> std::size_t
+  {
+    return m_vertices.size();
+  }
+
+  [[nodiscard]] auto triangle_count() const noexcept -> std::size_t
+  {
+    return m_indices.size() / 3u;
+  }
+
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_indices.empty();
+  }
+
+  /// \} End of queries
+
+ private:
+  inline constexpr static float pi = 3.14159265358979323846f;
+  inline constexpr static float max_arc_length = 3;  // The maximum length of an edge
+
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+  std::vector<fpoint> m_points;  // The deduplicated vertices of the current polyline
+
+  [[nodiscard]] static auto direction(const fpoint from, const fpoint to) noexcept
+      -> fpoint
+  {
+    const auto dx = to.x() - from.x();
+    const auto dy = to.y() - from.y();
+    const auto length = std::sqrt(dx * dx + dy * dy);
+    return {dx / length, dy / length};
+  }
+
+  [[nodiscard]] static auto offset(const fpoint point,
+                                   const fpoint direction,
+                                   const float distance) noexcept -> fpoint
+  {
+    return {point.x() + direction.x() * distance, point.y() + direction.y() * distance};
+  }
+
+  [[nodiscard]] static auto angle_of(const fpoint vector) noexcept -> float
+  {
+    return std::atan2(vector.y(), vector.x());
+  }
+
+  [[nodiscard]] static auto arc_segments(const float radius, const float sweep) noexcept
+      -> int
+  {
+    const auto length = radius * (sweep < 0 ? -sweep : sweep);
+    return (std::max)(static_cast<int>(std::ceil(length / max_arc_length)), 1);
+  }
+
+  [[nodiscard]] static auto circle_segments(const float radius) noexcept -> int
+  {
+    return (std::min)((std::max)(arc_segments(radius, 2 * pi), 12), 1'024);
+  }
+
+  auto push_vertex(const fpoint position, const SDL_Color& tint) -> int
+  {
+    m_vertices.push_back({position.get(), tint, {0, 0}});
+    return isize(m_vertices) - 1;
+  }
+
+  void push_quad(const fpoint a,
+                 const fpoint b,
+                 const fpoint c,
+                 const fpoint d,
+                 const SDL_Color& tint)
+  {
+    const auto base = push_vertex(a, tint);
+    push_vertex(b, tint);
+    push_vertex(c, tint);
+    push_vertex(d, tint);
+
+    m_indices.insert(m_indices.end(),
+                     {base, base + 1, base + 2, base + 2, base + 3, base});
+  }
+
+  // Adds a fan of triangles around the center, from the start angle over the sweep
+  void push_fan(const fpoint center,
+                const float radius,
+                const float start,
+                const float sweep,
+                const SDL_Color& tint)
+  {
+    const auto segments = arc_segments(radius, sweep);
+    const auto centerIndex = push_vertex(center, tint);
+
+    for (int index = 0; index <= segments; ++index)
+    {
+      const auto angle = start + sweep * static_cast<float>(index) /
+                                     static_cast<float>(segments);
+      push_vertex({center.x() + std::cos(angle) * radius,
+                   center.y() + std::sin(angle) * radius},
+                  tint);
+
+      if (index > 0)
+      {
+        m_indices.insert(m_indices.end(),
+                         {centerIndex, centerIndex + index, centerIndex + index + 1});
+      }
+    }
+  }
+
+  // Fills the gap on the outer side of the corner between two segments
+  void push_join(const fpoint point,
+                 const fpoint incoming,
+                 const fpoint outgoing,
+                 const float half,
+                 const stroke& style,
+                 const SDL_Color& tint)
+  {
+    const auto turn = incoming.x() * outgoing.y() - incoming.y() * outgoing.x();
+    const auto dot = incoming.x() * outgoing.x() + incoming.y() * outgoing.y();
+    if (turn == 0 && dot > 0)
+    {
+      return;
+    }
+
+    // The outer side is opposite to the direction of the turn
+    const auto side = (turn > 0) ? -1.0f : 1.0f;
+    const fpoint first{-incoming.y() * side, incoming.x() * side};
+    const fpoint second{-outgoing.y() * side, outgoing.x() * side};
+
+    if (style.join == line_join::round)
+    {
+      const auto sweep = std::atan2(first.x() * second.y() - first.y() * second.x(),
+                                    first.x() * second.x() + first.y() * second.y());
+      push_fan(point, half, angle_of(first), sweep, tint);
+      return;
+    }
+
+    const auto base = push_vertex(point, tint);
+    push_vertex(offset(point, first, half), tint);
+    push_vertex(offset(point, second, half), tint);
+
+    const auto mx = first.x() + second.x();
+    const auto my = first.y() + second.y();
+    const auto length = std::sqrt(mx * mx + my * my);
+
+    if (style.join == line_join::miter && length > 0)
+    {
+      // The miter extends to where the outer edges of the segments intersect
+      const fpoint miter{mx / length, my / length};
+      const auto cosine = miter.x() * first.x() + miter.y() * first.y();
+      const auto miterLength = half / cosine;
+
+      if (miterLength <= style.miterLimit * half)
+      {
+        push_vertex(offset(point, miter, miterLength), tint);
+        m_indices.insert(m_indices.end(),
+                         {base, base + 1, base + 3, base, base + 3, base + 2});
+        return;
+      }
+    }
+
+    m_indices.insert(m_indices.end(), {base, base + 1, base + 2});
+  }
+
+  // Adds a ring of vertices, and returns the index of the first one
+  auto push_ring(const fpoint center,
+                 const float radius,
+                 const int segments,
+                 const SDL_Color& tint) -> int
+  {
+    const auto base = isize(m_vertices);
+    for (int index = 0; index < segments; ++index)
+    {
+      const auto angle =
+          2 * pi * static_cast<float>(index) / static_cast<float>(segments);
+      push_vertex({center.x() + std::cos(angle) * radius,
+                   center.y() + std::sin(angle) * radius},
+                  tint);
+    }
+
+    return base;
+  }
+
+  // Fills the band between two rings with the same amount of vertices
+  void connect_rings(const int inner, const int outer, const int segments)
+  {
+    for (int index = 0; index < segments; ++index)
+    {
+      const auto next = (index + 1) % segments;
+      m_indices.insert(m_indices.end(),
+                       {inner + index,
+                        outer + index,
+                        outer + next,
+                        outer + next,
+                        inner + next,
+                        inner + index});
+    }
+  }
+};
+
+/// \} End of group video
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+}  // namespace cen
+
+#endif  // CENTURION_SHAPE_BATCH_HEADER
@@ -0,0 +1,412 @@
+#ifndef CENTURION_SHARED_SURFACE_HEADER
+#define CENTURION_SHARED_SURFACE_HEADER
+
+#include <SDL.h>
+
+#include <string>   // string
+#include <utility>  // exchange, swap
+
+#include "../core/czstring.hpp"
+#include "../core/exception.hpp"
+#include "../core/not_null.hpp"
+#include "../core/owner.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class shared_surface
+ *
+ * \brief A reference-counted surface with copy-on-write semantics.
+ *
+ * \details Copying a shared surface only increments the reference count of the
+ * underlying `SDL_Surface`, so shared surfaces can be passed around by value without
+ * copying any pixels. The pixels are copied the first time that a shared copy is
+ * modified, through `lock()`, `set_pixel()`, `pixels()` or `edit()`, after which the
+ * modified surface is no longer shared.
+ * \code{cpp}
+ *   cen::shared_surface original{"sheet.png"};
+ *   cen::shared_surface copy = original;  // No pixels are copied
+ *
+ *   copy.set_pixel({0, 0}, cen::colors::red);  // Copies the pixels of the sheet
+ * \endcode
+ *
+ * \details The non-mutating functions, e.g. `view()` and the const overload of
+ * `pixels()`, never copy the surface, and must not be used to modify it.
+ *
+ * \note The reference count of an SDL surface isn't atomic, so copies of a shared
+ * surface must not be created or destroyed concurrently.
+ *
+ * \see `surface`
+ *
+ * \since 6.1.0
+ */
+class shared_surface final
+{
+ public:
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Takes ownership of a surface.
+   *
+   * \param surface the surface that will be shared, can't be null.
+   *
+   * \throws cen_error if the surface is null.
+   *
+   * \since 6.1.0
+   */
+  explicit shared_surface(owner<SDL_Surface*> surface) : m_surface{surface}
+  {
+    if (!m_surface)
+    {
+      throw cen_error{"Cannot create shared surface from null pointer!"};
+    }
+  }
+
+  /**
+   * \brief Takes ownership of the SDL surface of an owning surface.
+   *
+   * \param source the surface that will be shared, is left empty.
+   *
+   * \since 6.1.0
+   */
+  explicit shared_surface(surface&& source) : shared_surface{source.release()}
+  {}
+
+#ifndef CENTURION_NO_SDL_IMAGE
+
+  /**
+   * \brief Loads the image at the specified path.
+   *
+   * \param file the file path of the image, can't be null.
+   *
+   * \throws img_error if the image couldn't be loaded.
+   *
+   * \since 6.1.0
+   */
+  explicit shared_surface(const not_null<czstring> file) : shared_surface{surface{file}}
+  {}
+
+  /// \copydoc shared_surface(not_null<czstring>)
+  explicit shared_surface(const std::string& file) : shared_surface{file.c_str()}
+  {}
+
+#endif  // CENTURION_NO_SDL_IMAGE
+
+  /**
+   * \brief Shares the surface of another shared surface.
+   *
+   * \param other the shared surface whose surface will be shared.
+   *
+   * \since 6.1.0
+   */
+  shared_surface(const shared_surface& other) noexcept : m_surface{other.m_surface}
+  {
+    ++m_surface->refcount;
+  }
+
+  /**
+   * \brief Takes over the surface of another shared surface.
+   *
+   * \param other the shared surface that will be moved, is left empty.
+   *
+   * \since 6.1.0
+   */
+  shared_surface(shared_surface&& other) noexcept
+      : m_surface{std::exchange(other.m_surface, nullptr)}
+  {}
+
+  ~shared_surface() noexcept
+  {
+    // Decrements the reference count, and frees the surface if it's no longer shared
+    SDL_FreeSurface(m_surface);
+  }
+
+  auto operator=(shared_surface other) noexcept -> shared_surface&
+  {
+    std::swap(m_surface, other.m_surface);
+    return *this;
+  }
+
+  /// \} End of construction
+
+  /// \name Copy-on-write
+  /// \{
+
+  /**
+   * \brief Makes sure that the surface isn't shared with any other shared surface.
+   *
+   * \details The pixels are copied if the surface is shared, otherwise this function has
+   * no effect.
+   *
+   * \return `success` if the surface is no longer shared; `failure` if the surface
+   * couldn't be copied.
+   *
+   * \since 6.1.0
+   */
+  auto detach() noexcept -> result
+  {
+    if (is_unique())
+    {
+      return success;
+    }
+
+    if (auto* copy = SDL_DuplicateSurface(m_surface))
+    {
+      SDL_FreeSurface(m_surface);
+      m_surface = copy;
+      return success;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+  /**
+   * \brief Returns a handle that can be used to modify the surface.
+   *
+   * \details The surface is detached first, so modifications through the handle don't
+   * affect other copies. The handle is invalidated by operations on the shared surface
+   * that might replace the underlying surface, i.e. copies followed by modifications.
+   *
+   * \return a handle to the unshared surface.
+   *
+   * \throws sdl_error if the surface couldn't be copied.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto edit() -> surface_handle
+  {
+    if (!detach())
+    {
+      throw sdl_error{};
+    }
+
+    return surface_handle{m_surface};
+  }
+
+  /**
+   * \brief Detaches and locks the surface, so that its pixels can be modified.
+   *
+   * \return `success` if the surface was detached and locked, or if locking isn't
+   * required; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto lock() noexcept -> result
+  {
+    return detach() && surface_handle{m_surface}.lock();
+  }
+
+  /**
+   * \brief Unlocks the surface.
+   *
+   * \since 6.1.0
+   */
+  void unlock() noexcept
+  {
+    surface_handle{m_surface}.unlock();
+  }
+
+  /**
+   * \brief Detaches the surface, and sets the color of a pixel.
+   *
+   * \details This function has no effect if the surface couldn't be detached, or if the
+   * pixel is out of bounds.
+   *
+   * \param pixel the position of the pixel.
+   * \param color the new color of the pixel.
+   *
+   * \since 6.1.0
+   */
+  void set_pixel(const ipoint pixel, const color& color) noexcept
+  {
+    if (detach())
+    {
+      surface_handle{m_surface}.set_pixel(pixel, color);
+    }
+  }
+
+  /**
+   * \brief Detaches the surface, and returns a pointer to its pixels.
+   *
+   * \return a pointer to the pixels; a null pointer if the surface couldn't be detached.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pixels() noexcept -> void*
+  {
+    return detach() ? m_surface->pixels : nullptr;
+  }
+
+  /// \} End of copy-on-write
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns a pointer to the pixels, without detaching the surface.
+   *
+   * \return a pointer to the pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pixels() const noexcept -> const void*
+  {
+    return m_surface->pixels;
+  }
+
+  /**
+   * \brief Returns a handle to the surface, without detaching it.
+   *
+   * \details This is useful for reading the surface, or creating textures from it.
+   *
+   * \warning The surface must not be modified through the handle.
+   *
+   * \return a handle to the possibly shared surface.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto view() const noexcept -> surface_handle
+  {
+    return surface_handle{m_surface};
+  }
+
+  /**
+   * \brief Creates a deep copy of the surface.
+   *
+   * \return an owning copy of the surface.
+   *
+   * \throws sdl_error if the surface couldn't be copied.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto to_surface() const -> surface
+  {
+    if (auto* copy = SDL_DuplicateSurface(m_surface))
+    {
+      return surface{copy};
+    }
+    else
+    {
+      throw sdl_error{};
+    }
+  }
+
+  /**
+   * \brief Returns the amount of shared surfaces that refer to the surface.
+   *
+   * \return the reference count of the surface.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto use_count() const noexcept -> int
+  {
+    return m_surface->refcount;
+  }
+
+  /**
+   * \brief Indicates whether or not the surface is shared with other shared surfaces.
+   *
+   * \return `true` if the surface isn't shared; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_unique() const noexcept -> bool
+  {
+    return m_surface->refcount == 1;
+  }
+
+  /**
+   * \brief Returns the width of the surface.
+   *
+   * \return the width of the surface, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return m_surface->w;
+  }
+
+  /**
+   * \brief Returns the height of the surface.
+   *
+   * \return the height of the surface, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return m_surface->h;
+  }
+
+  /**
+   * \brief Returns the size of the surface.
+   *
+   * \return the size of the surface, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return {width(), height()};
+  }
+
+  /**
+   * \brief Returns the pitch of the surface.
+   *
+   * \return the amount of bytes in a row of pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto pitch() const noexcept -> int
+  {
+    return m_surface->pitch;
+  }
+
+  /**
+   * \brief Returns the pixel format of the surface.
+   *
+   * \return a handle to the pixel format information.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto format_info() const noexcept -> pixel_format_info_handle
+  {
+    return pixel_format_info_handle{m_surface->format};
+  }
+
+  /**
+   * \brief Returns a pointer to the associated surface.
+   *
+   * \return a pointer to the possibly shared surface.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() const noexcept -> const SDL_Surface*
+  {
+    return m_surface;
+  }
+
+  /// \} End of queries
+
+ private:
+  SDL_Surface* m_surface{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_SHARED_SURFACE_HEADER
@@ -0,0 +1,785 @@
+#ifndef CENTURION_SPRITE_ANIMATION_HEADER
+#define CENTURION_SPRITE_ANIMATION_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max, min, upper_bound
+#include <cassert>    // assert
+#include <cmath>      // fmod
+#include <cstddef>    // size_t
+#include <vector>     // vector
+
+#include "../core/integers.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../system/simd_vector.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct animation_frame
+ *
+ * \brief Describes a single frame of a sprite animation.
+ *
+ * \see `sprite_sheet`
+ *
+ * \since 6.1.0
+ */
+struct animation_frame final
+{
+  irect source;          ///< The area of the texture that contains the frame.
+  float duration{0.1f};  ///< The amount of seconds that the frame is shown.
+};
+
+/**
+ * \class sprite_sheet
+ *
+ * \brief Describes the frames and animations of a texture that is divided into a grid
+ * of equally sized frames.
+ *
+ * \details The source rectangles and durations of the frames of all animations are
+ * precomputed when the animations are added, and are stored contiguously, so that the
+ * frames of each animation occupy a consecutive range. As a result, animators never
+ * compute source rectangles from the layout of the sheet.
+ * \code{cpp}
+ *   cen::sprite_sheet sheet{texture, {32, 32}};
+ *
+ *   const auto idle = sheet.add_animation(0, 4, 0.2f);
+ *   const auto run = sheet.add_animation(8, 6, 0.08f);
+ *   const auto jump = sheet.add_animation(16, 3, 0.1f, false);
+ * \endcode
+ *
+ * \see `sprite_animator`
+ *
+ * \since 6.1.0
+ */
+class sprite_sheet final
+{
+ public:
+  using size_type = std::size_t;
+  using id_type = std::size_t;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates a sprite sheet with a grid layout.
+   *
+   * \details The cells of the grid are numbered row by row, starting with the top-left
+   * cell. Partial cells at the right and bottom edges of the texture are ignored.
+   *
+   * \param textureSize the size of the sprite sheet texture.
+   * \param frameSize the size of the cells of the grid, must be positive.
+   * \param spacing the horizontal and vertical gap between the cells.
+   * \param margin the position of the top-left cell.
+   *
+   * \since 6.1.0
+   */
+  sprite_sheet(const iarea textureSize,
+               const iarea frameSize,
+               const iarea spacing = {0, 0},
+               const ipoint margin = {0, 0})
+      : m_frameSize{frameSize}
+      , m_spacing{spacing}
+      , m_margin{margin}
+  {
+    assert(frameSize.width > 0 && frameSize.height > 0 && "Invalid frame size!");
+
+    const auto strideX = frameSize.width + spacing.width;
+    const auto strideY = frameSize.height + spacing.height;
+
+    m_columns = (std::max)(0, (textureSize.width - margin.x() + spacing.width) / strideX);
+    m_rows = (std::max)(0, (textureSize.height - margin.y() + spacing.height) / strideY);
+  }
+
+  /**
+   * \brief Creates a sprite sheet with a grid layout, that covers a texture.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the sprite sheet texture.
+   * \param frameSize the size of the cells of the grid, must be positive.
+   * \param spacing the horizontal and vertical gap between the cells.
+   * \param margin the position of the top-left cell.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  sprite_sheet(const basic_texture<T>& texture,
+               const iarea frameSize,
+               const iarea spacing = {0, 0},
+               const ipoint margin = {0, 0})
+      : sprite_sheet{texture.size(), frameSize, spacing, margin}
+  {}
+
+  /// \} End of construction
+
+  /// \name Animations
+  /// \{
+
+  /**
+   * \brief Adds an animation that consists of consecutive cells of the grid.
+   *
+   * \param firstCell the index of the first cell of the animation.
+   * \param count the amount of frames, must be positive.
+   * \param frameDuration the amount of seconds that each frame is shown, must be
+   * positive.
+   * \param loop `true` if the animation restarts after its last frame; `false` if it
+   * stops on its last frame.
+   *
+   * \return the ID of the animation.
+   *
+   * \since 6.1.0
+   */
+  auto add_animation(const size_type firstCell,
+                     const size_type count,
+                     const float frameDuration,
+                     const bool loop = true) -> id_type
+  {
+    assert(count > 0 && "Animations must have at least one frame!");
+    assert(firstCell + count <= cell_count() && "Invalid cell range!");
+    assert(frameDuration > 0 && "Frames must have a positive duration!");
+
+    const auto first = m_sources.size();
+    m_sources.reserve(first + count);
+    m_ends.reserve(first + count);
+
+    for (size_type index = 0; index < count; ++index)
+    {
+      m_sources.push_back(cell(firstCell + index));
+      m_ends.push_back(frameDuration * static_cast<float>(index + 1u));
+    }
+
+    return push_animation(first, count, 1.0f / frameDuration, loop);
+  }
+
+  /**
+   * \brief Adds an animation with arbitrary frames.
+   *
+   * \details The frames don't have to be cells of the grid, and may have different
+   * durations.
+   *
+   * \param frames the frames of the animation, mustn't be empty.
+   * \param loop `true` if the animation restarts after its last frame; `false` if it
+   * stops on its last frame.
+   *
+   * \return the ID of the animation.
+   *
+   * \since 6.1.0
+   */
+  auto add_animation(const std::vector<animation_frame>& frames, const bool loop = true)
+      -> id_type
+  {
+    assert(!frames.empty() && "Animations must have at least one frame!");
+
+    const auto first = m_sources.size();
+    m_sources.reserve(first + frames.size());
+    m_ends.reserve(first + frames.size());
+
+    float end = 0;
+    bool uniform = true;
+    for (const auto& frame : frames)
+    {
+      assert(frame.duration > 0 && "Frames must have a positive duration!");
+      uniform &= frame.duration == frames.front().duration;
+
+      end += frame.duration;
+      m_sources.push_back(frame.source);
+      m_ends.push_back(end);
+    }
+
+    const auto inverse = uniform ? 1.0f / frames.front().duration : 0.0f;
+    return push_animation(first, frames.size(), inverse, loop);
+  }
+
+  /// \} End of animations
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the source rectangle of a cell of the grid.
+   *
+   * \param index the index of the cell, the cells are numbered row by row.
+   *
+   * \return the area of the texture that contains the cell.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto cell(const size_type index) const noexcept -> irect
+  {
+    assert(index < cell_count());
+
+    const auto column = static_cast<int>(index % static_cast<size_type>(m_columns));
+    const auto row = static_cast<int>(index / static_cast<size_type>(m_columns));
+
+    return {m_margin.x() + column * (m_frameSize.width + m_spacing.width),
+            m_margin.y() + row * (m_frameSize.height + m_spacing.height),
+            m_frameSize.width,
+            m_frameSize.height};
+  }
+
+  /**
+   * \brief Returns the source rectangle of a frame of an animation.
+   *
+   * \param id the ID of the animation.
+   * \param frame the index of the frame within the animation.
+   *
+   * \return the area of the texture that contains the frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_source(const id_type id, const size_type frame) const noexcept
+      -> const irect&
+  {
+    assert(frame < frame_count(id));
+    return m_sources[m_animations[id].first + frame];
+  }
+
+  /**
+   * \brief Returns the amount of frames of an animation.
+   *
+   * \param id the ID of the animation.
+   *
+   * \return the amount of frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_count(const id_type id) const noexcept -> size_type
+  {
+    assert(id < m_animations.size());
+    return m_animations[id].count;
+  }
+
+  /**
+   * \brief Returns the total duration of an animation.
+   *
+   * \param id the ID of the animation.
+   *
+   * \return the sum of the durations of the frames, in seconds.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto duration(const id_type id) const noexcept -> float
+  {
+    assert(id < m_animations.size());
+    return m_animations[id].duration;
+  }
+
+  /**
+   * \brief Indicates whether or not an animation restarts after its last frame.
+   *
+   * \param id the ID of the animation.
+   *
+   * \return `true` if the animation loops; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_looping(const id_type id) const noexcept -> bool
+  {
+    assert(id < m_animations.size());
+    return m_animations[id].loop;
+  }
+
+  /**
+   * \brief Returns the frame of an animation that is shown at a point in time.
+   *
+   * \param id the ID of the animation.
+   * \param time the amount of seconds since the start of the animation, in the range
+   * [0, `duration(id)`].
+   *
+   * \return the index of the frame within the animation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_at(const id_type id, const float time) const noexcept
+      -> size_type
+  {
+    assert(id < m_animations.size());
+    return locate(m_animations[id], time);
+  }
+
+  /**
+   * \brief Returns the amount of cells in each row of the grid.
+   *
+   * \return the amount of columns.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto columns() const noexcept -> int
+  {
+    return m_columns;
+  }
+
+  /**
+   * \brief Returns the amount of rows of the grid.
+   *
+   * \return the amount of rows.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto rows() const noexcept -> int
+  {
+    return m_rows;
+  }
+
+  /**
+   * \brief Returns the amount of cells of the grid.
+   *
+   * \return the amount of cells.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto cell_count() const noexcept -> size_type
+  {
+    return static_cast<size_type>(m_columns) * static_cast<size_type>(m_rows);
+  }
+
+  /**
+   * \brief Returns the amount of animations.
+   *
+   * \return the amount of added animations.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto animation_count() const noexcept -> size_type
+  {
+    return m_animations.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  friend class sprite_animator;
+
+  struct animation_data final
+  {
+    size_type first{};             // The index of the first frame in the frame tables
+    size_type count{};             // The amount of frames
+    float duration{};              // The sum of the frame durations
+    float inverseFrameDuration{};  // Zero if the frames have different durations
+    bool loop{};
+  };
+
+  std::vector<irect> m_sources;  // The source rectangles of all frames
+  std::vector<float> m_ends;     // The end times of the frames, within their animation
+  std::vector<animation_data> m_animations;
+  iarea m_frameSize;
+  iarea m_spacing;
+  ipoint m_margin;
+  int m_columns{};
+  int m_rows{};
+
+  auto push_animation(const size_type first,
+                      const size_type count,
+                      const float inverseFrameDuration,
+                      const bool loop) -> id_type
+  {
+    const auto duration = m_ends[first + count - 1u];
+    m_animations.push_back({first, count, duration, inverseFrameDuration, loop});
+    return m_animations.size() - 1u;
+  }
+
+  [[nodiscard]] auto locate(const animation_data& animation, const float time) const
+      noexcept -> size_type
+  {
+    const auto last = animation.count - 1u;
+
+    if (animation.inverseFrameDuration != 0)
+    {
+      const auto frame = static_cast<size_type>(time * animation.inverseFrameDuration);
+      return (std::min)(frame, last);
+    }
+    else
+    {
+      const auto* ends = m_ends.data() + animation.first;
+      const auto* end = std::upper_bound(ends, ends + last, time);
+      return static_cast<size_type>(end - ends);
+    }
+  }
+};
+
+/**
+ * \class sprite_animator
+ *
+ * \brief Advances many instances of the animations of a sprite sheet at once.
+ *
+ * \details The state of the instances is stored in a structure-of-arrays layout, so that
+ * a single update advances the clocks of all instances in a loop that the compiler can
+ * vectorize, after which the current frame of each instance is looked up in the
+ * precomputed frame tables of the sheet. The source rectangles of the current frames
+ * are stored in a contiguous array, in the same order as the instances, which can be
+ * passed directly to `sprite_batch::add()`.
+ * \code{cpp}
+ *   cen::sprite_animator animator{sheet};
+ *
+ *   for (auto& enemy : enemies) {
+ *     enemy.animation = animator.play(run);
+ *   }
+ *
+ *   // Every frame
+ *   animator.update(dt);
+ *   batch.add(texture, animator.sources(), destinations.data(), animator.size());
+ * \endcode
+ *
+ * \note Removing an instance moves the last instance into its index, in order to keep
+ * the arrays dense.
+ *
+ * \note The sprite sheet must outlive the animator, and animations mustn't be added to
+ * the sheet while the animator is in use.
+ *
+ * \see `sprite_sheet`
+ *
+ * \since 6.1.0
+ */
+class sprite_animator final
+{
+ public:
+  using size_type = std::size_t;
+  using id_type = sprite_sheet::id_type;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an animator without any instances.
+   *
+   * \param sheet the sprite sheet that provides the animations.
+   * \param capacity the amount of instances to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  explicit sprite_animator(const sprite_sheet& sheet, const size_type capacity = 0)
+      : m_sheet{&sheet}
+  {
+    reserve(capacity);
+  }
+
+  /// \} End of construction
+
+  /// \name Instances
+  /// \{
+
+  /**
+   * \brief Adds an instance that plays an animation from its first frame.
+   *
+   * \param animation the ID of the animation.
+   * \param speed the factor that the time steps are multiplied with for the instance,
+   * mustn't be negative.
+   *
+   * \return the index of the instance.
+   *
+   * \since 6.1.0
+   */
+  auto play(const id_type animation, const float speed = 1) -> size_type
+  {
+    assert(animation < m_sheet->animation_count() && "Invalid animation!");
+    assert(speed >= 0 && "Animation speeds cannot be negative!");
+
+    m_times.push_back(0);
+    m_speeds.push_back(speed);
+    m_animations.push_back(animation);
+    m_frames.push_back(0);
+    m_sources.push_back(m_sheet->frame_source(animation, 0));
+
+    return size() - 1u;
+  }
+
+  /**
+   * \brief Changes the animation of an instance.
+   *
+   * \details The instance is restarted if the animation differs from its current
+   * animation, otherwise this function has no effect. This makes it possible to select
+   * the animation of a sprite based on its state every frame.
+   *
+   * \param index the index of the instance.
+   * \param animation the ID of the animation.
+   *
+   * \since 6.1.0
+   */
+  void switch_to(const size_type index, const id_type animation) noexcept
+  {
+    assert(index < size());
+    assert(animation < m_sheet->animation_count() && "Invalid animation!");
+
+    if (m_animations[index] != animation)
+    {
+      m_animations[index] = animation;
+      restart(index);
+    }
+  }
+
+  /**
+   * \brief Restarts the animation of an instance from its first frame.
+   *
+   * \param index the index of the instance.
+   *
+   * \since 6.1.0
+   */
+  void restart(const size_type index) noexcept
+  {
+    assert(index < size());
+
+    m_times[index] = 0;
+    m_frames[index] = 0;
+    m_sources[index] = m_sheet->frame_source(m_animations[index], 0);
+  }
+
+  /**
+   * \brief Sets the playback speed of an instance.
+   *
+   * \param index the index of the instance.
+   * \param speed the factor that the time steps are multiplied with, zero pauses the
+   * instance and negative speeds aren't allowed.
+   *
+   * \since 6.1.0
+   */
+  void set_speed(const size_type index, const float speed) noexcept
+  {
+    assert(index < size());
+    assert(speed >= 0 && "Animation speeds cannot be negative!");
+    m_speeds[index] = speed;
+  }
+
+  /**
+   * \brief Removes an instance, by moving the last instance into its index.
+   *
+   * \param index the index of the instance.
+   *
+   * \since 6.1.0
+   */
+  void remove(const size_type index) noexcept
+  {
+    assert(index < size());
+
+    const auto last = size() - 1u;
+    if (index != last)
+    {
+      m_times[index] = m_times[last];
+      m_speeds[index] = m_speeds[last];
+      m_animations[index] = m_animations[last];
+      m_frames[index] = m_frames[last];
+      m_sources[index] = m_sources[last];
+    }
+
+    m_times.pop_back();
+    m_speeds.pop_back();
+    m_animations.pop_back();
+    m_frames.pop_back();
+    m_sources.pop_back();
+  }
+
+  /**
+   * \brief Removes all instances, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_times.clear();
+    m_speeds.clear();
+    m_animations.clear();
+    m_frames.clear();
+    m_sources.clear();
+  }
+
+  /**
+   * \brief Reserves space for a number of instances.
+   *
+   * \param capacity the amount of instances to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const size_type capacity)
+  {
+    m_times.reserve(capacity);
+    m_speeds.reserve(capacity);
+    m_animations.reserve(capacity);
+    m_frames.reserve(capacity);
+    m_sources.reserve(capacity);
+  }
+
+  /// \} End of instances
+
+  /// \name Simulation
+  /// \{
+
+  /**
+   * \brief Advances all instances, and updates their source rectangles.
+   *
+   * \details Looping animations wrap around, and other animations stop on their last
+   * frame.
+   *
+   * \param dt the time step, in seconds.
+   *
+   * \since 6.1.0
+   */
+  void update(const float dt) noexcept
+  {
+    const auto count = size();
+    auto* times = m_times.data();
+    const auto* speeds = m_speeds.data();
+
+    // Kept free of branches and lookups, so that the loop is vectorized
+    for (size_type index = 0; index < count; ++index)
+    {
+      times[index] += dt * speeds[index];
+    }
+
+    for (size_type index = 0; index < count; ++index)
+    {
+      const auto& animation = m_sheet->m_animations[m_animations[index]];
+
+      auto& time = times[index];
+      if (time >= animation.duration)
+      {
+        time = animation.loop ? std::fmod(time, animation.duration) : animation.duration;
+      }
+
+      const auto frame = m_sheet->locate(animation, time);
+      m_frames[index] = frame;
+      m_sources[index] = m_sheet->m_sources[animation.first + frame];
+    }
+  }
+
+  /// \} End of simulation
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the source rectangles of the current frames of all instances.
+   *
+   * \return a pointer to the first of `size()` source rectangles, in the same order as
+   * the instances.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto sources() const noexcept -> const irect*
+  {
+    return m_sources.data();
+  }
+
+  /**
+   * \brief Returns the source rectangle of the current frame of an instance.
+   *
+   * \param index the index of the instance.
+   *
+   * \return the area of the sprite sheet that contains the current frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto source(const size_type index) const noexcept -> const irect&
+  {
+    assert(index < size());
+    return m_sources[index];
+  }
+
+  /**
+   * \brief Returns the current frame of an instance.
+   *
+   * \param index the index of the instance.
+   *
+   * \return the index of the frame within the animation of the instance.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame(const size_type index) const noexcept -> size_type
+  {
+    assert(index < size());
+    return m_frames[index];
+  }
+
+  /**
+   * \brief Returns the animation of an instance.
+   *
+   * \param index the index of the instance.
+   *
+   * \return the ID of the animation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto animation(const size_type index) const noexcept -> id_type
+  {
+    assert(index < size());
+    return m_animations[index];
+  }
+
+  /**
+   * \brief Returns the amount of time that an instance has been playing its animation.
+   *
+   * \param index the index of the instance.
+   *
+   * \return the amount of seconds since the start of the current loop of the animation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto time(const size_type index) const noexcept -> float
+  {
+    assert(index < size());
+    return m_times[index];
+  }
+
+  /**
+   * \brief Indicates whether or not an instance has reached the end of an animation that
+   * doesn't loop.
+   *
+   * \param index the index of the instance.
+   *
+   * \return `true` if the animation has finished; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_finished(const size_type index) const noexcept -> bool
+  {
+    assert(index < size());
+
+    const auto& animation = m_sheet->m_animations[m_animations[index]];
+    return !animation.loop && m_times[index] >= animation.duration;
+  }
+
+  /**
+   * \brief Returns the amount of instances.
+   *
+   * \return the amount of instances.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> size_type
+  {
+    return m_times.size();
+  }
+
+  /**
+   * \brief Indicates whether or not there are no instances.
+   *
+   * \return `true` if there are no instances; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_times.empty();
+  }
+
+  /// \} End of queries
+
+ private:
+  const sprite_sheet* m_sheet{};
+  simd_vector<float> m_times;
+  simd_vector<float> m_speeds;
+  std::vector<id_type> m_animations;
+  std::vector<size_type> m_frames;
+  std::vector<irect> m_sources;
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_SPRITE_ANIMATION_HEADER
@@ -0,0 +1,630 @@
+#ifndef CENTURION_SPRITE_BATCH_HEADER
+#define CENTURION_SPRITE_BATCH_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cmath>    // atan2, hypot, lround
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "../math/transform2d.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct corner_colors
+ *
+ * \brief The colors of the corners of a sprite, which are interpolated across it.
+ *
+ * \see `sprite_batch`
+ *
+ * \since 6.1.0
+ */
+struct corner_colors final
+{
+  color topLeft;
+  color topRight;
+  color bottomRight;
+  color bottomLeft;
+};
+
+/**
+ * \class sprite_batch
+ *
+ * \brief Collects textured quads and submits them using as few render calls as possible.
+ *
+ * \details Sprites are stored as vertices and indices in contiguous arrays. Consecutive
+ * sprites that share the same texture and blend mode are merged into a single run, which
+ * is submitted with one `SDL_RenderGeometry` call. As a result, the sprites should be
+ * added in an order that keeps sprites that use the same texture together.
+ *
+ * \details Sprites can be rotated, scaled or sheared with a `transform2d`, which is
+ * applied to the corners of the sprite when it is added. This makes it possible to batch
+ * transformed sprites, which would otherwise require individual `SDL_RenderCopyEx` calls.
+ *
+ * \details Tints are stored as vertex colors, so sprites that share a texture are batched
+ * regardless of their color and alpha. Avoid `basic_texture::set_color_mod()` and
+ * `basic_texture::set_alpha()` for tinting batched sprites, since those change the state
+ * of the texture and therefore apply to all sprites that use it.
+ *
+ * \details The internal buffers are reused between frames, so a batch that is cleared
+ * or submitted every frame will not allocate once it has reached its peak size.
+ *
+ * \note The blend mode of each run is applied to its texture upon submission.
+ *
+ * \note If the renderer fails to render the geometry of a run, e.g. because its backend
+ * doesn't support geometry, the sprites of the run are rendered one by one instead, with
+ * the tints applied as texture color and alpha modulation. The previous modulation of
+ * the texture is restored afterwards. Sheared sprites can't be represented by individual
+ * render calls, and are rendered as rotated rectangles by the fallback, which also uses
+ * the tint of the top-left corner for the entire sprite.
+ *
+ * \see `basic_renderer::render_geometry()`
+ *
+ * \since 6.1.0
+ */
+class sprite_batch final
+{
+ public:
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty sprite batch.
+   *
+   * \since 6.1.0
+   */
+  sprite_batch() = default;
+
+  /**
+   * \brief Creates an empty sprite batch with space reserved for a number of sprites.
+   *
+   * \param capacity the amount of sprites to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  explicit sprite_batch(const std::size_t capacity)
+  {
+    reserve(capacity);
+  }
+
+  /// \} End of construction
+
+  /// \name Batching
+  /// \{
+
+  /**
+   * \brief Adds a sprite to the batch.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param source the cutout of the texture that will be rendered.
+   * \param destination the position and size of the rendered sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect& source,
+           const frect& destination,
+           const color& tint = colors::white)
+  {
+    auto& run = run_for(texture.get());
+
+    const auto width = static_cast<float>(run.size.width);
+    const auto height = static_cast<float>(run.size.height);
+
+    const auto u0 = static_cast<float>(source.x()) / width;
+    const auto v0 = static_cast<float>(source.y()) / height;
+    const auto u1 = static_cast<float>(source.max_x()) / width;
+    const auto v1 = static_cast<float>(source.max_y()) / height;
+
+    push_quad(run, destination, {u0, v0, u1, v1}, tint.get());
+  }
+
+  /**
+   * \brief Adds a sprite with a separate tint for each corner to the batch.
+   *
+   * \details The tints are interpolated across the sprite, which makes it possible to
+   * render gradients, e.g. by using a white cutout of the texture.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param source the cutout of the texture that will be rendered.
+   * \param destination the position and size of the rendered sprite.
+   * \param tints the colors that will be multiplied with the corners of the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect& source,
+           const frect& destination,
+           const corner_colors& tints)
+  {
+    auto& run = run_for(texture.get());
+
+    const auto width = static_cast<float>(run.size.width);
+    const auto height = static_cast<float>(run.size.height);
+
+    const auto u0 = static_cast<float>(source.x()) / width;
+    const auto v0 = static_cast<float>(source.y()) / height;
+    const auto u1 = static_cast<float>(source.max_x()) / width;
+    const auto v1 = static_cast<float>(source.max_y()) / height;
+
+    push_corners(run,
+                 {{destination.x(), destination.y()},
+                  {destination.max_x(), destination.y()},
+                  {destination.max_x(), destination.max_y()},
+                  {destination.x(), destination.max_y()}},
+                 {u0, v0, u1, v1},
+                 tints);
+  }
+
+  /**
+   * \brief Adds a transformed sprite to the batch.
+   *
+   * \details The transform is applied to the corners of the destination rectangle.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param source the cutout of the texture that will be rendered.
+   * \param destination the position and size of the sprite, before the transform.
+   * \param transform the transform that will be applied to the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect& source,
+           const frect& destination,
+           const transform2d& transform,
+           const color& tint = colors::white)
+  {
+    auto& run = run_for(texture.get());
+
+    const auto width = static_cast<float>(run.size.width);
+    const auto height = static_cast<float>(run.size.height);
+
+    const auto u0 = static_cast<float>(source.x()) / width;
+    const auto v0 = static_cast<float>(source.y()) / height;
+    const auto u1 = static_cast<float>(source.max_x()) / width;
+    const auto v1 = static_cast<float>(source.max_y()) / height;
+
+    push_quad(run, destination, transform, {u0, v0, u1, v1}, tint.get());
+  }
+
+  /**
+   * \brief Adds several sprites that use the same texture to the batch.
+   *
+   * \details This is equivalent to adding the sprites one by one, but the texture is
+   * only looked up once. The source rectangles can be obtained from a
+   * `sprite_animator`.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprites.
+   * \param sources the cutouts of the texture, one for each sprite.
+   * \param destinations the positions and sizes of the rendered sprites.
+   * \param count the amount of sprites.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect* sources,
+           const frect* destinations,
+           const std::size_t count,
+           const color& tint = colors::white)
+  {
+    assert(count == 0 || (sources && destinations));
+
+    auto& run = run_for(texture.get());
+    reserve(size() + count);
+
+    const auto inverseWidth = 1.0f / static_cast<float>(run.size.width);
+    const auto inverseHeight = 1.0f / static_cast<float>(run.size.height);
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      const auto& source = sources[index];
+
+      const auto u0 = static_cast<float>(source.x()) * inverseWidth;
+      const auto v0 = static_cast<float>(source.y()) * inverseHeight;
+      const auto u1 = static_cast<float>(source.max_x()) * inverseWidth;
+      const auto v1 = static_cast<float>(source.max_y()) * inverseHeight;
+
+      push_quad(run, destinations[index], {u0, v0, u1, v1}, tint.get());
+    }
+  }
+
+  /**
+   * \brief Adds a sprite that renders an entire texture to the batch.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param destination the position and size of the rendered sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const frect& destination,
+           const color& tint = colors::white)
+  {
+    auto& run = run_for(texture.get());
+    push_quad(run, destination, {0, 0, 1, 1}, tint.get());
+  }
+
+  /**
+   * \brief Adds a transformed sprite that renders an entire texture to the batch.
+   *
+   * \details The transform is applied to the corners of the destination rectangle.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param destination the position and size of the sprite, before the transform.
+   * \param transform the transform that will be applied to the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const frect& destination,
+           const transform2d& transform,
+           const color& tint = colors::white)
+  {
+    auto& run = run_for(texture.get());
+    push_quad(run, destination, transform, {0, 0, 1, 1}, tint.get());
+  }
+
+  /**
+   * \brief Submits all batched sprites and clears the batch.
+   *
+   * \details One render call is made for each texture/blend mode run, unless the renderer
+   * fails to render the geometry of a run, in which case the sprites of that run are
+   * rendered individually.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all runs were rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto submit(basic_renderer<T>& renderer) noexcept -> result
+  {
+    bool ok = true;
+
+    for (const auto& run : m_runs)
+    {
+      SDL_SetTextureBlendMode(run.texture, static_cast<SDL_BlendMode>(run.mode));
+      if (!renderer.render_geometry(run.texture,
+                                    m_vertices.data() + run.firstVertex,
+                                    run.nVertices,
+                                    m_indices.data() + run.firstIndex,
+                                    run.nIndices))
+      {
+        ok &= render_copies(renderer, run);
+      }
+    }
+
+    clear();
+    return ok;
+  }
+
+  /**
+   * \brief Removes all sprites from the batch, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_vertices.clear();
+    m_indices.clear();
+    m_runs.clear();
+  }
+
+  /**
+   * \brief Reserves space for a number of sprites.
+   *
+   * \param capacity the amount of sprites to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const std::size_t capacity)
+  {
+    m_vertices.reserve(capacity * 4u);
+    m_indices.reserve(capacity * 6u);
+  }
+
+  /// \} End of batching
+
+  /// \name Setters
+  /// \{
+
+  /**
+   * \brief Sets the blend mode used by subsequently added sprites.
+   *
+   * \details Changing the blend mode starts a new run, even if the texture is the same.
+   *
+   * \param mode the blend mode that will be used.
+   *
+   * \since 6.1.0
+   */
+  void set_blend_mode(const blend_mode mode) noexcept
+  {
+    m_mode = mode;
+  }
+
+  /// \} End of setters
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the blend mode used by subsequently added sprites.
+   *
+   * \details The default blend mode is `blend_mode::blend`.
+   *
+   * \return the current blend mode.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_blend_mode() const noexcept -> blend_mode
+  {
+    return m_mode;
+  }
+
+  /**
+   * \brief Returns the amount of sprites in the batch.
+   *
+   * \return the amount of batched sprites.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_vertices.size() / 4u;
+  }
+
+  /**
+   * \brief Indicates whether or not the batch is empty.
+   *
+   * \return `true` if there are no batched sprites; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_vertices.empty();
+  }
+
+  /**
+   * \brief Returns the amount of render calls that would be made by `submit()`.
+   *
+   * \return the amount of texture/blend mode runs.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto run_count() const noexcept -> std::size_t
+  {
+    return m_runs.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct run_data final
+  {
+    SDL_Texture* texture{};
+    blend_mode mode{blend_mode::blend};
+    iarea size{};
+    int firstVertex{};
+    int nVertices{};
+    int firstIndex{};
+    int nIndices{};
+  };
+
+  struct tex_coords final
+  {
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+  };
+
+  struct quad_corners final
+  {
+    fpoint topLeft;
+    fpoint topRight;
+    fpoint bottomRight;
+    fpoint bottomLeft;
+  };
+
+  std::vector<SDL_Vertex> m_vertices;
+  std::vector<int> m_indices;
+  std::vector<run_data> m_runs;
+  blend_mode m_mode{blend_mode::blend};
+
+  [[nodiscard]] auto run_for(SDL_Texture* texture) -> run_data&
+  {
+    if (!m_runs.empty())
+    {
+      auto& back = m_runs.back();
+      if (back.texture == texture && back.mode == m_mode)
+      {
+        return back;
+      }
+    }
+
+    auto& run = m_runs.emplace_back();
+    run.texture = texture;
+    run.mode = m_mode;
+    run.firstVertex = isize(m_vertices);
+    run.firstIndex = isize(m_indices);
+
+    SDL_QueryTexture(texture, nullptr, nullptr, &run.size.width, &run.size.height);
+
+    return run;
+  }
+
+  // Renders the quads of a run individually, with the tints as texture modulation
+  template <typename T>
+  [[nodiscard]] auto render_copies(basic_renderer<T>& renderer, const run_data& run)
+      -> bool
+  {
+    texture_handle texture{run.texture};
+
+    const auto previousColor = texture.color_mod();
+    const auto previousAlpha = texture.alpha();
+
+    const auto width = static_cast<float>(run.size.width);
+    const auto height = static_cast<float>(run.size.height);
+
+    bool ok = true;
+    const auto end = run.firstVertex + run.nVertices;
+    for (auto index = run.firstVertex; index < end; index += 4)
+    {
+      const auto* quad = m_vertices.data() + index;
+
+      // The corners are in clockwise order, starting with the top-left corner
+      const auto& topLeft = quad[0].position;
+      const auto& topRight = quad[1].position;
+      const auto& bottomRight = quad[2].position;
+      const auto& bottomLeft = quad[3].position;
+
+      const auto dx = topRight.x - topLeft.x;
+      const auto dy = topRight.y - topLeft.y;
+      const auto quadWidth = std::hypot(dx, dy);
+      const auto quadHeight =
+          std::hypot(bottomLeft.x - topLeft.x, bottomLeft.y - topLeft.y);
+      const auto centerX = (topLeft.x + bottomRight.x) * 0.5f;
+      const auto centerY = (topLeft.y + bottomRight.y) * 0.5f;
+
+      const auto& uv0 = quad[0].tex_coord;
+      const auto& uv1 = quad[2].tex_coord;
+      const auto x0 = static_cast<int>(std::lround(uv0.x * width));
+      const auto y0 = static_cast<int>(std::lround(uv0.y * height));
+      const auto x1 = static_cast<int>(std::lround(uv1.x * width));
+      const auto y1 = static_cast<int>(std::lround(uv1.y * height));
+
+      const auto& tint = quad[0].color;
+      texture.set_color_mod({tint.r, tint.g, tint.b});
+      texture.set_alpha(tint.a);
+
+      const irect source{x0, y0, x1 - x0, y1 - y0};
+      const frect destination{centerX - quadWidth * 0.5f,
+                              centerY - quadHeight * 0.5f,
+                              quadWidth,
+                              quadHeight};
+
+      constexpr auto degrees = 180.0 / 3.14159265358979323846;
+      const auto angle = std::atan2(static_cast<double>(dy), static_cast<double>(dx));
+
+      ok &= static_cast<bool>(
+          renderer.render(texture, source, destination, angle * degrees));
+    }
+
+    texture.set_color_mod(previousColor);
+    texture.set_alpha(previousAlpha);
+
+    return ok;
+  }
+
+  void push_quad(run_data& run,
+                 const frect& dst,
+                 const tex_coords& uv,
+                 const SDL_Color& tint)
+  {
+    push_corners(run,
+                 {{dst.x(), dst.y()},
+                  {dst.max_x(), dst.y()},
+                  {dst.max_x(), dst.max_y()},
+                  {dst.x(), dst.max_y()}},
+                 uv,
+                 tint);
+  }
+
+  void push_quad(run_data& run,
+                 const frect& dst,
+                 const transform2d& transform,
+                 const tex_coords& uv,
+                 const SDL_Color& tint)
+  {
+    push_corners(run,
+                 {transform.apply({dst.x(), dst.y()}),
+                  transform.apply({dst.max_x(), dst.y()}),
+                  transform.apply({dst.max_x(), dst.max_y()}),
+                  transform.apply({dst.x(), dst.max_y()})},
+                 uv,
+                 tint);
+  }
+
+  // The corners are given in clockwise order, starting with the top-left corner
+  void push_corners(run_data& run,
+                    const quad_corners& corners,
+                    const tex_coords& uv,
+                    const SDL_Color& tint)
+  {
+    const color same{tint};
+    push_corners(run, corners, uv, {same, same, same, same});
+  }
+
+  void push_corners(run_data& run,
+                    const quad_corners& corners,
+                    const tex_coords& uv,
+                    const corner_colors& colors)
+  {
+    const auto base = run.nVertices;
+
+    m_vertices.push_back({corners.topLeft.get(), colors.topLeft.get(), {uv.u0, uv.v0}});
+    m_vertices.push_back({corners.topRight.get(), colors.topRight.get(), {uv.u1, uv.v0}});
+    m_vertices.push_back(
+        {corners.bottomRight.get(), colors.bottomRight.get(), {uv.u1, uv.v1}});
+    m_vertices.push_back(
+        {corners.bottomLeft.get(), colors.bottomLeft.get(), {uv.u0, uv.v1}});
+
+    m_indices.insert(m_indices.end(),
+                     {base, base + 1, base + 2, base + 2, base + 3, base});
+
+    run.nVertices += 4;
+    run.nIndices += 6;
+  }
+};
+
+/// \} End of group video
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+}  // namespace cen
+
+#endif  // CENTURION_SPRITE_BATCH_HEADER
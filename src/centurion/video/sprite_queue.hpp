@@ -0,0 +1,450 @@
+#ifndef CENTURION_SPRITE_QUEUE_HEADER
+#define CENTURION_SPRITE_QUEUE_HEADER
+
+#include <SDL.h>
+
+#include <cassert>        // assert
+#include <cstddef>        // size_t
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../detail/radix_sort.hpp"
+#include "../math/rect.hpp"
+#include "../math/transform2d.hpp"
+#include "blend_mode.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "renderer.hpp"
+#include "sprite_batch.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct sprite_order
+ *
+ * \brief Specifies where a queued sprite is drawn, relative to the other sprites.
+ *
+ * \details Sprites are drawn in order of increasing layer, and sprites of the same layer
+ * in order of increasing depth. The depth is typically the bottom edge of a sprite, which
+ * makes sprites that are further down the screen appear in front.
+ *
+ * \see `sprite_queue`
+ *
+ * \since 6.1.0
+ */
+struct sprite_order final
+{
+  u16 layer{};  ///< The layer of the sprite, e.g. background, entities or effects.
+  u16 depth{};  ///< The order of the sprite within its layer.
+};
+
+/**
+ * \class sprite_queue
+ *
+ * \brief Collects sprites in any order, and sorts them before they're batched.
+ *
+ * \details Every queued sprite is given a 64-bit sort key, which consists of the layer,
+ * the depth, the blend mode and the texture of the sprite, from the most to the least
+ * significant bits. The keys are sorted with a linear time radix sort upon submission,
+ * and the sprites are then added to a sprite batch in that order. Sprites of the same
+ * layer and depth are therefore grouped by blend mode and texture, which makes the batch
+ * merge them into as few runs as possible.
+ * \code{cpp}
+ *   cen::sprite_queue queue;
+ *
+ *   // Every frame, in any order
+ *   queue.add(tiles, tileSource, tileDestination, {0});
+ *   for (const auto& entity : entities) {
+ *     queue.add(sheet, entity.source, entity.bounds, {1, entity.bottom()});
+ *   }
+ *
+ *   queue.submit(renderer);
+ * \endcode
+ *
+ * \details The sort is stable, so sprites with equal keys, i.e. sprites with the same
+ * order, blend mode and texture, are drawn in the order that they were added. Sprites of
+ * the same layer and depth that use different textures may be reordered, so sprites that
+ * overlap should be given different depths.
+ *
+ * \details Textures and blend modes are replaced by small indices in the keys, which are
+ * assigned in the order that they are first used after the queue has been cleared. The
+ * internal buffers are reused between frames, like those of `sprite_batch`.
+ *
+ * \see `sprite_batch`
+ *
+ * \since 6.1.0
+ */
+class sprite_queue final
+{
+ public:
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty sprite queue.
+   *
+   * \since 6.1.0
+   */
+  sprite_queue() = default;
+
+  /**
+   * \brief Creates an empty sprite queue with space reserved for a number of sprites.
+   *
+   * \param capacity the amount of sprites to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  explicit sprite_queue(const std::size_t capacity)
+  {
+    reserve(capacity);
+  }
+
+  /// \} End of construction
+
+  /// \name Queueing
+  /// \{
+
+  /**
+   * \brief Adds a sprite to the queue.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param source the cutout of the texture that will be rendered.
+   * \param destination the position and size of the rendered sprite.
+   * \param order the layer and depth of the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect& source,
+           const frect& destination,
+           const sprite_order order,
+           const color& tint = colors::white)
+  {
+    push(texture.get(), source, destination, nullptr, order, tint);
+  }
+
+  /**
+   * \brief Adds a transformed sprite to the queue.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param source the cutout of the texture that will be rendered.
+   * \param destination the position and size of the sprite, before the transform.
+   * \param transform the transform that will be applied to the sprite.
+   * \param order the layer and depth of the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const irect& source,
+           const frect& destination,
+           const transform2d& transform,
+           const sprite_order order,
+           const color& tint = colors::white)
+  {
+    push(texture.get(), source, destination, &transform, order, tint);
+  }
+
+  /**
+   * \brief Adds a sprite that renders an entire texture to the queue.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param destination the position and size of the rendered sprite.
+   * \param order the layer and depth of the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const frect& destination,
+           const sprite_order order,
+           const color& tint = colors::white)
+  {
+    push(texture.get(), irect{{}, texture.size()}, destination, nullptr, order, tint);
+  }
+
+  /**
+   * \brief Adds a transformed sprite that renders an entire texture to the queue.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param texture the texture that will be used by the sprite.
+   * \param destination the position and size of the sprite, before the transform.
+   * \param transform the transform that will be applied to the sprite.
+   * \param order the layer and depth of the sprite.
+   * \param tint the color and alpha that will be multiplied with the texture.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void add(const basic_texture<T>& texture,
+           const frect& destination,
+           const transform2d& transform,
+           const sprite_order order,
+           const color& tint = colors::white)
+  {
+    push(texture.get(), irect{{}, texture.size()}, destination, &transform, order, tint);
+  }
+
+  /**
+   * \brief Sorts the queued sprites, adds them to a batch and clears the queue.
+   *
+   * \details The sprites are appended to any sprites that are already in the batch. The
+   * blend mode of the batch is restored afterwards.
+   *
+   * \param batch the batch that the sorted sprites are added to.
+   *
+   * \since 6.1.0
+   */
+  void submit(sprite_batch& batch)
+  {
+    detail::radix_sort(m_keys, m_scratch);
+
+    const auto previous = batch.get_blend_mode();
+    for (const auto& pair : m_keys)
+    {
+      const auto& sprite = m_sprites[pair.index];
+      const texture_handle texture{sprite.texture};
+
+      batch.set_blend_mode(sprite.mode);
+      if (sprite.transformed)
+      {
+        batch.add(texture,
+                  sprite.source,
+                  sprite.destination,
+                  sprite.transform,
+                  sprite.tint);
+      }
+      else
+      {
+        batch.add(texture, sprite.source, sprite.destination, sprite.tint);
+      }
+    }
+
+    batch.set_blend_mode(previous);
+    clear();
+  }
+
+  /**
+   * \brief Sorts and renders the queued sprites, and clears the queue.
+   *
+   * \details The sprites are batched with an internal sprite batch, which is then
+   * submitted to the renderer.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all runs were rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto submit(basic_renderer<T>& renderer) -> result
+  {
+    submit(m_batch);
+    return m_batch.submit(renderer);
+  }
+
+  /**
+   * \brief Removes all sprites from the queue, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_sprites.clear();
+    m_keys.clear();
+    m_textures.clear();
+    m_modes.clear();
+  }
+
+  /**
+   * \brief Reserves space for a number of sprites.
+   *
+   * \param capacity the amount of sprites to reserve space for.
+   *
+   * \since 6.1.0
+   */
+  void reserve(const std::size_t capacity)
+  {
+    m_sprites.reserve(capacity);
+    m_keys.reserve(capacity);
+    m_scratch.reserve(capacity);
+    m_batch.reserve(capacity);
+  }
+
+  /// \} End of queueing
+
+  /// \name Setters
+  /// \{
+
+  /**
+   * \brief Sets the blend mode used by subsequently added sprites.
+   *
+   * \param mode the blend mode that will be used.
+   *
+   * \since 6.1.0
+   */
+  void set_blend_mode(const blend_mode mode) noexcept
+  {
+    m_mode = mode;
+  }
+
+  /// \} End of setters
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the blend mode used by subsequently added sprites.
+   *
+   * \details The default blend mode is `blend_mode::blend`.
+   *
+   * \return the current blend mode.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_blend_mode() const noexcept -> blend_mode
+  {
+    return m_mode;
+  }
+
+  /**
+   * \brief Returns the amount of sprites in the queue.
+   *
+   * \return the amount of queued sprites.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_sprites.size();
+  }
+
+  /**
+   * \brief Indicates whether or not the queue is empty.
+   *
+   * \return `true` if there are no queued sprites; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto empty() const noexcept -> bool
+  {
+    return m_sprites.empty();
+  }
+
+  /**
+   * \brief Returns the amount of distinct textures used by the queued sprites.
+   *
+   * \return the amount of textures since the queue was last cleared.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto texture_count() const noexcept -> std::size_t
+  {
+    return m_textures.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct sprite_data final
+  {
+    SDL_Texture* texture{};
+    irect source;
+    frect destination;
+    transform2d transform;
+    color tint;
+    blend_mode mode{blend_mode::blend};
+    bool transformed{};
+  };
+
+  std::vector<sprite_data> m_sprites;
+  std::vector<detail::sort_pair> m_keys;
+  std::vector<detail::sort_pair> m_scratch;
+  std::unordered_map<SDL_Texture*, u32> m_textures;  // Texture indices of the keys
+  std::vector<blend_mode> m_modes;                   // Blend mode indices of the keys
+  sprite_batch m_batch;                              // Only used to submit to a renderer
+  blend_mode m_mode{blend_mode::blend};
+
+  void push(SDL_Texture* texture,
+            const irect& source,
+            const frect& destination,
+            const transform2d* transform,
+            const sprite_order order,
+            const color& tint)
+  {
+    auto& sprite = m_sprites.emplace_back();
+    sprite.texture = texture;
+    sprite.source = source;
+    sprite.destination = destination;
+    sprite.tint = tint;
+    sprite.mode = m_mode;
+
+    if (transform)
+    {
+      sprite.transform = *transform;
+      sprite.transformed = true;
+    }
+
+    // Layer and depth occupy the high 32 bits, followed by 8 bits of blend mode index
+    // and 24 bits of texture index
+    const auto key = (u64{order.layer} << 48u) | (u64{order.depth} << 32u) |
+                     (u64{mode_index()} << 24u) | u64{texture_index(texture)};
+
+    m_keys.push_back({key, static_cast<u32>(m_sprites.size() - 1u)});
+  }
+
+  [[nodiscard]] auto texture_index(SDL_Texture* texture) -> u32
+  {
+    const auto it =
+        m_textures.try_emplace(texture, static_cast<u32>(m_textures.size())).first;
+
+    assert(it->second < (1u << 24u) && "Too many distinct textures in sprite queue!");
+    return it->second;
+  }
+
+  [[nodiscard]] auto mode_index() -> u32
+  {
+    // Only a handful of blend modes are used at once, so a linear search is fine
+    for (std::size_t index = 0; index < m_modes.size(); ++index)
+    {
+      if (m_modes[index] == m_mode)
+      {
+        return static_cast<u32>(index);
+      }
+    }
+
+    assert(m_modes.size() < 256u && "Too many distinct blend modes in sprite queue!");
+
+    m_modes.push_back(m_mode);
+    return static_cast<u32>(m_modes.size() - 1u);
+  }
+};
+
+/// \} End of group video
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+}  // namespace cen
+
+#endif  // CENTURION_SPRITE_QUEUE_HEADER
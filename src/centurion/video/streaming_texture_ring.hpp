@@ -0,0 +1,419 @@
+#ifndef CENTURION_STREAMING_TEXTURE_RING_HEADER
+#define CENTURION_STREAMING_TEXTURE_RING_HEADER
+
+#include <SDL.h>
+
+#include <cassert>  // assert
+#include <cstddef>  // size_t
+#include <utility>  // exchange
+#include <vector>   // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../core/result.hpp"
+#include "../math/area.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class streaming_texture_ring
+ *
+ * \brief Rotates a set of streaming textures, for pushing CPU generated frames.
+ *
+ * \details Locking a streaming texture that is still used by pending draw calls may stall
+ * until the GPU has finished with it. This class avoids that by writing each frame into
+ * the next texture in a ring, while the texture that was written most recently, the
+ * front texture, is the one that is rendered. With three textures, a texture isn't
+ * written again until two more frames have been produced.
+ *
+ * \details Frames are written through a `write_guard`, which keeps the texture locked for
+ * as long as it exists, and makes the texture the new front texture when it is
+ * destroyed. Frames of YUV rings, such as decoded video frames, can instead be uploaded
+ * from their planes with `write_yuv()` or `write_nv()`, so that the GPU does the color
+ * conversion.
+ * \code{cpp}
+ *   cen::streaming_texture_ring ring{renderer, cen::pixel_format::rgba8888, {256, 256}};
+ *
+ *   {
+ *     auto guard = ring.begin_write();
+ *     for (int y = 0; y < guard.height(); ++y)
+ *     {
+ *       auto* row = guard.row(y);
+ *       // ...
+ *     }
+ *   }
+ *
+ *   renderer.render(ring.front(), cen::ipoint{0, 0});
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+class streaming_texture_ring final
+{
+ public:
+  /**
+   * \class write_guard
+   *
+   * \brief Keeps a texture of the ring locked for writing.
+   *
+   * \details The locked memory is write-only, and its previous contents are undefined, so
+   * the entire texture should be written.
+   *
+   * \since 6.1.0
+   */
+  class write_guard final
+  {
+   public:
+    write_guard(const write_guard&) = delete;
+
+    auto operator=(const write_guard&) -> write_guard& = delete;
+
+    write_guard(write_guard&& other) noexcept
+        : m_ring{std::exchange(other.m_ring, nullptr)}
+        , m_index{other.m_index}
+        , m_pixels{other.m_pixels}
+        , m_pitch{other.m_pitch}
+    {}
+
+    auto operator=(write_guard&&) -> write_guard& = delete;
+
+    /**
+     * \brief Unlocks the texture and makes it the front texture of the ring.
+     *
+     * \since 6.1.0
+     */
+    ~write_guard() noexcept
+    {
+      if (m_ring)
+      {
+        m_ring->commit(m_index);
+      }
+    }
+
+    /**
+     * \brief Returns a pointer to the first byte of a row of the locked pixels.
+     *
+     * \pre The row index must be in the range [0, height).
+     *
+     * \tparam Pixel the type of the pixel values, e.g. `u32` for 32-bit formats.
+     *
+     * \param y the index of the row.
+     *
+     * \return a pointer to the first pixel of the row.
+     *
+     * \since 6.1.0
+     */
+    template <typename Pixel = u32>
+    [[nodiscard]] auto row(const int y) const noexcept -> Pixel*
+    {
+      assert(y >= 0 && y < height());
+      return reinterpret_cast<Pixel*>(static_cast<u8*>(m_pixels) + y * m_pitch);
+    }
+
+    /**
+     * \brief Returns a pointer to the locked pixels.
+     *
+     * \return a pointer to the first byte of the locked pixels.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto data() const noexcept -> void*
+    {
+      return m_pixels;
+    }
+
+    /**
+     * \brief Returns the amount of bytes between consecutive rows of locked pixels.
+     *
+     * \return the pitch of the locked pixels.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto pitch() const noexcept -> int
+    {
+      return m_pitch;
+    }
+
+    [[nodiscard]] auto width() const noexcept -> int
+    {
+      return m_ring->m_size.width;
+    }
+
+    [[nodiscard]] auto height() const noexcept -> int
+    {
+      return m_ring->m_size.height;
+    }
+
+    [[nodiscard]] auto format() const noexcept -> pixel_format
+    {
+      return m_ring->m_format;
+    }
+
+   private:
+    friend class streaming_texture_ring;
+
+    streaming_texture_ring* m_ring{};
+    std::size_t m_index{};
+    void* m_pixels{};
+    int m_pitch{};
+
+    write_guard(streaming_texture_ring& ring,
+                const std::size_t index,
+                void* pixels,
+                const int pitch) noexcept
+        : m_ring{&ring}
+        , m_index{index}
+        , m_pixels{pixels}
+        , m_pitch{pitch}
+    {}
+  };
+
+  /**
+   * \brief Creates a ring of streaming textures.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the textures.
+   * \param format the pixel format of the textures.
+   * \param size the size of the textures.
+   * \param count the amount of textures, at least two textures are used.
+   *
+   * \throws sdl_error if the textures couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  streaming_texture_ring(const Renderer& renderer,
+                         const pixel_format format,
+                         const iarea size,
+                         const std::size_t count = 3)
+      : m_format{format}
+      , m_size{size}
+  {
+    const auto n = (count > 2u) ? count : 2u;
+
+    m_textures.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      m_textures.emplace_back(renderer, format, texture_access::streaming, size);
+    }
+  }
+
+  streaming_texture_ring(const streaming_texture_ring&) = delete;
+
+  auto operator=(const streaming_texture_ring&) -> streaming_texture_ring& = delete;
+
+  /**
+   * \brief Locks the next texture of the ring for writing.
+   *
+   * \pre There must not be another write guard of this ring.
+   *
+   * \return a guard that keeps the texture locked.
+   *
+   * \throws sdl_error if the texture couldn't be locked.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto begin_write() -> write_guard
+  {
+    assert(!m_writing && "Only one write guard can exist at a time!");
+
+    const auto index = next_index();
+
+    void* pixels{};
+    int pitch{};
+    if (SDL_LockTexture(m_textures[index].get(), nullptr, &pixels, &pitch) != 0)
+    {
+      throw sdl_error{};
+    }
+
+    m_writing = true;
+    return write_guard{*this, index, pixels, pitch};
+  }
+
+  /**
+   * \brief Uploads a frame of planar YUV data to the next texture of the ring.
+   *
+   * \details The ring must use the `iyuv` or `yv12` format. The texture becomes the front
+   * texture if the upload succeeded.
+   *
+   * \pre There must not be a write guard of this ring.
+   *
+   * \param y the luma plane.
+   * \param u the blue-difference chroma plane.
+   * \param v the red-difference chroma plane.
+   *
+   * \return `success` if the frame was uploaded; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto write_yuv(const yuv_plane& y, const yuv_plane& u, const yuv_plane& v) noexcept
+      -> result
+  {
+    assert(!m_writing && "Can't upload frames while a write guard exists!");
+
+    const auto index = next_index();
+    if (m_textures[index].update_yuv(y, u, v))
+    {
+      advance(index);
+      return success;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Uploads a frame of semi-planar YUV data to the next texture of the ring.
+   *
+   * \details The ring must use the `nv12` or `nv21` format. The texture becomes the front
+   * texture if the upload succeeded.
+   *
+   * \pre There must not be a write guard of this ring.
+   *
+   * \param y the luma plane.
+   * \param uv the interleaved chroma plane.
+   *
+   * \return `success` if the frame was uploaded; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto write_nv(const yuv_plane& y, const yuv_plane& uv) noexcept -> result
+  {
+    assert(!m_writing && "Can't upload frames while a write guard exists!");
+
+    const auto index = next_index();
+    if (m_textures[index].update_nv(y, uv))
+    {
+      advance(index);
+      return success;
+    }
+    else
+    {
+      return failure;
+    }
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Returns the texture that was written most recently.
+   *
+   * \details Before the first write guard has been destroyed, this is a texture with
+   * undefined contents, see `has_frame()`.
+   *
+   * \return the front texture.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto front() noexcept -> texture&
+  {
+    return m_textures[m_front];
+  }
+
+  /// \copydoc front()
+  [[nodiscard]] auto front() const noexcept -> const texture&
+  {
+    return m_textures[m_front];
+  }
+
+  /**
+   * \brief Indicates whether or not a frame has been written to the ring.
+   *
+   * \return `true` if the front texture holds a complete frame; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto has_frame() const noexcept -> bool
+  {
+    return m_frames != 0;
+  }
+
+  /**
+   * \brief Returns the amount of frames that have been written to the ring.
+   *
+   * \return the amount of destroyed write guards and uploaded frames.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frame_count() const noexcept -> u64
+  {
+    return m_frames;
+  }
+
+  /**
+   * \brief Indicates whether or not a texture of the ring is currently locked.
+   *
+   * \return `true` if a write guard exists; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_writing() const noexcept -> bool
+  {
+    return m_writing;
+  }
+
+  /**
+   * \brief Returns the amount of textures in the ring.
+   *
+   * \return the amount of textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto count() const noexcept -> std::size_t
+  {
+    return m_textures.size();
+  }
+
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] auto format() const noexcept -> pixel_format
+  {
+    return m_format;
+  }
+
+ private:
+  std::vector<texture> m_textures;
+  pixel_format m_format;
+  iarea m_size;
+  std::size_t m_front{};
+  u64 m_frames{};
+  bool m_writing{};
+
+  [[nodiscard]] auto next_index() const noexcept -> std::size_t
+  {
+    return (m_front + 1u) % m_textures.size();
+  }
+
+  void advance(const std::size_t index) noexcept
+  {
+    m_front = index;
+    ++m_frames;
+  }
+
+  void commit(const std::size_t index) noexcept
+  {
+    SDL_UnlockTexture(m_textures[index].get());
+
+    m_writing = false;
+    advance(index);
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_STREAMING_TEXTURE_RING_HEADER
@@ -2,9 +2,13 @@
 #define CENTURION_SURFACE_HEADER
 
 #include <SDL.h>
+
+#ifndef CENTURION_NO_SDL_IMAGE
 #include <SDL_image.h>
+#endif  // CENTURION_NO_SDL_IMAGE
 
 #include <cassert>  // assert
+#include <cstddef>  // size_t
 #include <ostream>  // ostream
 #include <string>   // string
 
@@ -15,13 +19,14 @@
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
 #include "../core/to_underlying.hpp"
-#include "../detail/address_of.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/owner_handle_api.hpp"
-#include "../detail/to_string.hpp"
+#include "../filesystem/file.hpp"
 #include "../math/area.hpp"
 #include "../math/rect.hpp"
 #include "blend_mode.hpp"
 #include "color.hpp"
+#include "pixel_conversion.hpp"
 #include "pixel_format.hpp"
 
 namespace cen {
@@ -102,6 +107,8 @@ class basic_surface final
 
   // clang-format on
 
+#ifndef CENTURION_NO_SDL_IMAGE
+
   /**
    * \brief Creates a surface based on the image at the specified path.
    *
@@ -138,6 +145,56 @@ class basic_surface final
   explicit basic_surface(const std::string& file) : basic_surface{file.c_str()}
   {}
 
+  /**
+   * \brief Creates a surface by decoding the image read from a file.
+   *
+   * \details The image is decoded from the current offset of the file, which is left
+   * open. The file is not needed after the surface has been created.
+   *
+   * \tparam BB dummy parameter for SFINAE.
+   *
+   * \param source the file that the image will be read from.
+   *
+   * \throws img_error if the surface cannot be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  explicit basic_surface(file& source) : m_surface{IMG_Load_RW(source.get(), 0)}
+  {
+    if (!m_surface)
+    {
+      throw img_error{};
+    }
+  }
+
+  /**
+   * \brief Creates a surface by decoding the image stored in a block of memory.
+   *
+   * \details The memory is decoded in place, without being copied first, and is not
+   * needed after the surface has been created.
+   *
+   * \tparam BB dummy parameter for SFINAE.
+   *
+   * \param data a pointer to the encoded image data.
+   * \param size the amount of bytes of encoded image data.
+   *
+   * \throws img_error if the surface cannot be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  basic_surface(const not_null<const void*> data, const std::size_t size)
+      : m_surface{IMG_Load_RW(file::from_memory(data, size).release(), 1)}
+  {
+    if (!m_surface)
+    {
+      throw img_error{};
+    }
+  }
+
+#endif  // CENTURION_NO_SDL_IMAGE
+
   /**
    * \brief Creates a surface with the specified dimensions and pixel format.
    *
@@ -169,25 +226,45 @@ class basic_surface final
    *
    * \tparam BB dummy parameter for SFINAE.
    *
+   * \details The decoded image is converted in place when possible, see
+   * `convert_in_place()`, so that only one copy of the pixels is allocated.
+   *
    * \param file the file path of the image that the surface will be based on.
    * \param blendMode the blend mode that will be used.
    * \param pixelFormat the pixel format that will be used.
+   * \param premultiplied `true` if the color channels should be multiplied by the alpha
+   * values, which requires one of the formats listed in `has_fast_conversion()`.
    *
    * \return an owning surface, with the specified blend mode and pixel format.
    *
+   * \throws img_error if the image couldn't be loaded.
+   * \throws sdl_error if the surface couldn't be converted.
+   * \throws cen_error if the pixels couldn't be premultiplied.
+   *
    * \since 5.2.0
    */
   template <typename TT = T, detail::is_owner<TT> = 0>
   [[nodiscard]] static auto with_format(const not_null<czstring> file,
                                         const blend_mode blendMode,
-                                        const pixel_format pixelFormat) -> basic_surface
+                                        const pixel_format pixelFormat,
+                                        const bool premultiplied = false) -> basic_surface
   {
     assert(file);
 
     basic_surface source{file};
     source.set_blend_mode(blendMode);
 
-    return source.convert(pixelFormat);
+    if (!source.convert_in_place(pixelFormat))
+    {
+      throw sdl_error{};
+    }
+
+    if (premultiplied && !source.premultiply_alpha())
+    {
+      throw cen_error{"Failed to premultiply surface pixels!"};
+    }
+
+    return source;
   }
 
   /**
@@ -196,9 +273,10 @@ class basic_surface final
   template <typename TT = T, detail::is_owner<TT> = 0>
   [[nodiscard]] static auto with_format(const std::string& file,
                                         const blend_mode blendMode,
-                                        const pixel_format pixelFormat) -> basic_surface
+                                        const pixel_format pixelFormat,
+                                        const bool premultiplied = false) -> basic_surface
   {
-    return with_format(file.c_str(), blendMode, pixelFormat);
+    return with_format(file.c_str(), blendMode, pixelFormat, premultiplied);
   }
 
   /**
@@ -230,6 +308,27 @@ class basic_surface final
     return from_bmp(file.c_str());
   }
 
+  /**
+   * \brief Creates and returns a surface based on BMP data read from a file.
+   *
+   * \details The data is read from the current offset of the file, which is left open.
+   *
+   * \tparam BB dummy parameter for SFINAE.
+   *
+   * \param source the file that contains the surface data.
+   *
+   * \return the created surface.
+   *
+   * \throws cen_error if the surface couldn't be loaded.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] static auto from_bmp(file& source) -> basic_surface
+  {
+    return basic_surface{SDL_LoadBMP_RW(source.get(), 0)};
+  }
+
   /**
    * \brief Creates a copy of the supplied surface.
    *
@@ -245,7 +344,7 @@ class basic_surface final
     }
     else
     {
-      m_surface = other.get();
+      m_surface = other.m_surface;
     }
   }
 
@@ -280,7 +379,7 @@ class basic_surface final
       }
       else
       {
-        m_surface = other.get();
+        m_surface = other.m_surface;
       }
     }
     return *this;
@@ -324,6 +423,8 @@ class basic_surface final
     return save_as_bmp(file.c_str());
   }
 
+#ifndef CENTURION_NO_SDL_IMAGE
+
   /**
    * \brief Saves the surface as a PNG image.
    *
@@ -378,6 +479,8 @@ class basic_surface final
     return save_as_jpg(file.c_str(), quality);
   }
 
+#endif  // CENTURION_NO_SDL_IMAGE
+
   /// \} End of save functions
 
   /// \name Locking
@@ -447,6 +550,9 @@ class basic_surface final
    * \details This method has no effect if the coordinate is out-of-bounds or if
    * something goes wrong when attempting to modify the pixel data.
    *
+   * \note Use `pixel_view` when modifying many pixels, since this function locks and
+   * unlocks the surface for every pixel.
+   *
    * \param pixel the pixel that will be changed.
    * \param color the new color of the pixel.
    *
@@ -472,6 +578,36 @@ class basic_surface final
     unlock();
   }
 
+  /**
+   * \brief Multiplies the color channels of all pixels by their alpha values.
+   *
+   * \return `success` if the pixels were premultiplied; `failure` if the pixel format
+   * isn't supported or if the surface couldn't be locked.
+   *
+   * \see `cen::premultiply_alpha()`
+   *
+   * \since 6.1.0
+   */
+  auto premultiply_alpha() noexcept -> result
+  {
+    return modify_rows(&cen::premultiply_alpha);
+  }
+
+  /**
+   * \brief Divides the color channels of all pixels by their alpha values.
+   *
+   * \return `success` if the pixels were modified; `failure` if the pixel format isn't
+   * supported or if the surface couldn't be locked.
+   *
+   * \see `cen::unpremultiply_alpha()`
+   *
+   * \since 6.1.0
+   */
+  auto unpremultiply_alpha() noexcept -> result
+  {
+    return modify_rows(&cen::unpremultiply_alpha);
+  }
+
   /**
    * \brief Sets the alpha component modulation value.
    *
@@ -579,6 +715,9 @@ class basic_surface final
    * \brief Creates and returns a surface based on this surface with the
    * specified pixel format.
    *
+   * \details Conversions between the common 32-bit formats use the vectorized kernels
+   * described in `has_fast_conversion()`, other conversions are performed by SDL.
+   *
    * \param format the pixel format that will be used by the new surface.
    *
    * \return a surface based on this surface with the specified
@@ -590,7 +729,7 @@ class basic_surface final
    */
   [[nodiscard]] auto convert(const pixel_format format) const -> basic_surface
   {
-    if (auto* converted = SDL_ConvertSurfaceFormat(m_surface, to_underlying(format), 0))
+    if (auto* converted = convert_surface(format))
     {
       basic_surface result{converted};
       result.set_blend_mode(get_blend_mode());
@@ -602,6 +741,43 @@ class basic_surface final
     }
   }
 
+  /**
+   * \brief Changes the pixel format of the surface, reusing its pixel memory when
+   * possible.
+   *
+   * \details Conversions between the formats listed in `has_fast_conversion()` rewrite
+   * the pixels in place, without allocating a second set of pixels, unless the surface
+   * doesn't own its pixels, is shared, has a color key or must be locked. Other
+   * conversions fall back to `convert()`. The blend mode and modulation are preserved.
+   *
+   * \param format the new pixel format of the surface.
+   *
+   * \return `success` if the surface was converted; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  auto convert_in_place(const pixel_format format) noexcept -> result
+  {
+    const auto current = static_cast<pixel_format>(m_surface->format->format);
+    if (current == format)
+    {
+      return success;
+    }
+
+    auto* converted = can_convert_in_place(format) ? adopt_pixels(format)
+                                                   : convert_surface(format);
+    if (!converted)
+    {
+      return failure;
+    }
+
+    SDL_SetSurfaceBlendMode(converted, static_cast<SDL_BlendMode>(get_blend_mode()));
+    m_surface.reset(converted);
+
+    return success;
+  }
+
   /**
    * \brief Returns the width of the surface.
    *
@@ -738,6 +914,22 @@ class basic_surface final
 
 #endif  // SDL_VERSION_ATLEAST(2, 0, 14)
 
+  /**
+   * \brief Releases ownership of the associated SDL surface and returns a pointer to it.
+   *
+   * \warning You **must** call `SDL_FreeSurface` on the returned pointer to free the
+   * associated memory.
+   *
+   * \return a pointer to the associated SDL surface.
+   *
+   * \since 6.1.0
+   */
+  template <typename TT = T, detail::is_owner<TT> = 0>
+  [[nodiscard]] auto release() noexcept -> owner<SDL_Surface*>
+  {
+    return m_surface.release();
+  }
+
   /**
    * \brief Returns a pointer to the associated `SDL_Surface`.
    *
@@ -819,11 +1011,144 @@ class basic_surface final
    *
    * \since 4.0.0
    */
+  template <typename TT = T, detail::is_owner<TT> = 0>
   void copy(const basic_surface& other)
   {
     m_surface.reset(other.copy_surface());
   }
 
+  /// Applies a function to every row of pixels, stops if the function fails.
+  template <typename Function>
+  auto modify_rows(Function function) noexcept -> result
+  {
+    if (!lock())
+    {
+      return failure;
+    }
+
+    const auto format = static_cast<pixel_format>(m_surface->format->format);
+    auto* pixels = static_cast<u8*>(m_surface->pixels);
+
+    result status = success;
+    for (int row = 0; row < height() && status; ++row)
+    {
+      const auto count = static_cast<std::size_t>(width());
+      status = function(pixels + row * pitch(), format, count);
+    }
+
+    unlock();
+    return status;
+  }
+
+  /**
+   * \brief Creates a copy of the associated surface with another pixel format.
+   *
+   * \note The fast path isn't used for surfaces with color keys, since SDL converts the
+   * color key as well.
+   *
+   * \param format the pixel format of the copy.
+   *
+   * \return the converted surface; a null pointer if something went wrong.
+   */
+  [[nodiscard]] auto convert_surface(const pixel_format format) const noexcept
+      -> owner<SDL_Surface*>
+  {
+    const auto current = static_cast<pixel_format>(m_surface->format->format);
+    if (!has_fast_conversion(current, format) || SDL_HasColorKey(m_surface))
+    {
+      return SDL_ConvertSurfaceFormat(m_surface, to_underlying(format), 0);
+    }
+
+    auto* converted =
+        SDL_CreateRGBSurfaceWithFormat(0, width(), height(), 32, to_underlying(format));
+    if (!converted)
+    {
+      return nullptr;
+    }
+
+    if (SDL_LockSurface(m_surface) != 0)
+    {
+      SDL_FreeSurface(converted);
+      return nullptr;
+    }
+
+    convert_pixels(size(),
+                   m_surface->pixels,
+                   m_surface->pitch,
+                   current,
+                   converted->pixels,
+                   converted->pitch,
+                   format);
+
+    SDL_UnlockSurface(m_surface);
+
+    copy_modulation(converted);
+    return converted;
+  }
+
+  /// Indicates whether the pixels can be converted without allocating new pixels.
+  [[nodiscard]] auto can_convert_in_place(const pixel_format format) const noexcept
+      -> bool
+  {
+    const auto current = static_cast<pixel_format>(m_surface->format->format);
+    return has_fast_conversion(current, format) && !SDL_HasColorKey(m_surface) &&
+           !SDL_MUSTLOCK(m_surface) && !(m_surface->flags & SDL_PREALLOC) &&
+           m_surface->refcount == 1;
+  }
+
+  /**
+   * \brief Converts the pixels in place, and moves them to a new surface.
+   *
+   * \details The old surface is left without pixels, and must be freed by the caller.
+   *
+   * \param format the pixel format of the new surface.
+   *
+   * \return the surface that owns the converted pixels; a null pointer if something
+   * went wrong, in which case the old surface is untouched.
+   */
+  [[nodiscard]] auto adopt_pixels(const pixel_format format) noexcept
+      -> owner<SDL_Surface*>
+  {
+    auto* converted = SDL_CreateRGBSurfaceWithFormatFrom(m_surface->pixels,
+                                                         width(),
+                                                         height(),
+                                                         32,
+                                                         pitch(),
+                                                         to_underlying(format));
+    if (!converted)
+    {
+      return nullptr;
+    }
+
+    convert_pixels(size(),
+                   m_surface->pixels,
+                   pitch(),
+                   static_cast<pixel_format>(m_surface->format->format),
+                   converted->pixels,
+                   pitch(),
+                   format);
+
+    // The new surface frees the pixels the same way that the old surface would have
+    converted->flags &= ~u32{SDL_PREALLOC};
+    converted->flags |= m_surface->flags & u32{SDL_SIMD_ALIGNED};
+    m_surface->flags |= SDL_PREALLOC;
+
+    copy_modulation(converted);
+    SDL_SetClipRect(converted, &m_surface->clip_rect);
+
+    return converted;
+  }
+
+  /// Copies the color and alpha modulation, like SDL does when converting surfaces.
+  void copy_modulation(SDL_Surface* target) const noexcept
+  {
+    u8 red{}, green{}, blue{}, alpha{};
+    SDL_GetSurfaceColorMod(m_surface, &red, &green, &blue);
+    SDL_GetSurfaceAlphaMod(m_surface, &alpha);
+    SDL_SetSurfaceColorMod(target, red, green, blue);
+    SDL_SetSurfaceAlphaMod(target, alpha);
+  }
+
   /**
    * \brief Indicates whether or not the supplied point is within the bounds of
    * the surface.
@@ -869,6 +1194,40 @@ class basic_surface final
 #endif  // CENTURION_MOCK_FRIENDLY_MODE
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_surface<detail::owning_type>;
+extern template class basic_surface<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
+/**
+ * \brief Writes a textual representation of a surface to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param surface the surface that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_surface<T>& surface) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("surface{data: ",
+                      surface.get(),
+                      ", width: ",
+                      surface.width(),
+                      ", height: ",
+                      surface.height(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a surface.
  *
@@ -881,9 +1240,7 @@ class basic_surface final
 template <typename T>
 [[nodiscard]] auto to_string(const basic_surface<T>& surface) -> std::string
 {
-  return "surface{data: " + detail::address_of(surface.get()) +
-         ", width: " + detail::to_string(surface.width()).value() +
-         ", height: " + detail::to_string(surface.height()).value() + "}";
+  return detail::format_string(surface);
 }
 
 /**
@@ -0,0 +1,603 @@
+#ifndef CENTURION_TEXT_LAYOUT_HEADER
+#define CENTURION_TEXT_LAYOUT_HEADER
+
+#ifndef CENTURION_NO_SDL_TTF
+
+#include <SDL_ttf.h>
+
+#include <cassert>        // assert
+#include <cstddef>        // size_t
+#include <cstdint>        // uintptr_t
+#include <string>         // string
+#include <string_view>    // string_view
+#include <unordered_map>  // unordered_map
+#include <vector>         // vector
+
+#include "../core/integers.hpp"
+#include "../core/macros.hpp"
+#include "../detail/utf8.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "font.hpp"
+#include "unicode_string.hpp"
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+#include <memory_resource>  // memory_resource, polymorphic_allocator
+
+#include "../core/memory_resource.hpp"
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+namespace cen {
+
+#ifdef CENTURION_USE_HARFBUZZ
+class text_shaper;
+#endif  // CENTURION_USE_HARFBUZZ
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class text_layout
+ *
+ * \brief Represents the line breaks, glyph positions and bounds of a piece of text.
+ *
+ * \details A text layout is computed once from the glyph metrics of a font, after which
+ * it can be used to measure the text and to render it, see
+ * `basic_renderer::render_layout()`, without calling into SDL_ttf again. This is useful
+ * for user interfaces, where the same labels tend to be measured many times per frame.
+ *
+ * \details Text is broken into lines at newline characters, and optionally at the last
+ * space before a line exceeds the wrap width. Words that are wider than the wrap width
+ * are broken between glyphs.
+ *
+ * \note Since the layout is based on the advance of each glyph, the measured width may
+ * differ by a few pixels from the width reported by `font::string_width()`.
+ *
+ * \note Layouts can also be shaped by a `text_shaper`, if `CENTURION_USE_HARFBUZZ` is
+ * defined. The glyphs of shaped layouts are glyph indices of the font instead of code
+ * points, see `is_shaped()`.
+ *
+ * \note The glyphs and lines are allocated from a `std::pmr::memory_resource` if
+ * `CENTURION_HAS_STD_MEMORY_RESOURCE` is defined. Like the `std::pmr` containers, copies
+ * use the default resource, whereas moves keep the resource of the moved layout.
+ *
+ * \see `text_layout_cache`
+ *
+ * \since 6.1.0
+ */
+class text_layout final
+{
+ public:
+  /**
+   * \struct glyph_info
+   *
+   * \brief Describes the position of a single glyph in a layout.
+   *
+   * \since 6.1.0
+   */
+  struct glyph_info final
+  {
+    unicode glyph{};  ///< The glyph.
+    ipoint position;  ///< The pen position of the glyph, relative to the layout origin.
+    int advance{};    ///< The horizontal advance of the glyph.
+  };
+
+  /**
+   * \struct line_info
+   *
+   * \brief Describes a single line in a layout.
+   *
+   * \since 6.1.0
+   */
+  struct line_info final
+  {
+    std::size_t first{};  ///< The index of the first glyph in the line.
+    std::size_t count{};  ///< The amount of glyphs in the line.
+    int width{};          ///< The width of the line, excluding trailing spaces.
+  };
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  using glyph_list = std::pmr::vector<glyph_info>;
+  using line_list = std::pmr::vector<line_info>;
+#else
+  using glyph_list = std::vector<glyph_info>;
+  using line_list = std::vector<line_info>;
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty layout.
+   *
+   * \since 6.1.0
+   */
+  text_layout() = default;
+
+  /**
+   * \brief Computes the layout of a UTF-8 encoded string.
+   *
+   * \note Code points outside of the basic multilingual plane, and glyphs that aren't
+   * provided by the font, are laid out with a zero advance.
+   *
+   * \param font the font that will be used to measure the glyphs.
+   * \param text the UTF-8 encoded text.
+   * \param wrap the width in pixels after which the text will be wrapped; zero to only
+   * break lines at newline characters.
+   *
+   * \since 6.1.0
+   */
+  text_layout(const font& font, const std::string_view text, const int wrap = 0)
+  {
+    compute(font, text, wrap);
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Creates an empty layout that allocates memory from a resource.
+   *
+   * \param resource the memory resource, must outlive the layout.
+   *
+   * \since 6.1.0
+   */
+  explicit text_layout(std::pmr::memory_resource* resource) noexcept
+      : m_glyphs{resource}
+      , m_lines{resource}
+  {
+    assert(resource);
+  }
+
+  /**
+   * \brief Computes the layout of a UTF-8 encoded string, allocating memory from a
+   * resource.
+   *
+   * \param font the font that will be used to measure the glyphs.
+   * \param text the UTF-8 encoded text.
+   * \param wrap the width in pixels after which the text will be wrapped; zero to only
+   * break lines at newline characters.
+   * \param resource the memory resource, must outlive the layout.
+   *
+   * \see `text_layout(const font&, std::string_view, int)`
+   *
+   * \since 6.1.0
+   */
+  text_layout(const font& font,
+              const std::string_view text,
+              const int wrap,
+              std::pmr::memory_resource* resource)
+      : text_layout{resource}
+  {
+    compute(font, text, wrap);
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /// \} End of construction
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the positioned glyphs of the layout.
+   *
+   * \details Newline characters are not included.
+   *
+   * \return the glyphs, in the order they appear in the text.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto glyphs() const noexcept -> const glyph_list&
+  {
+    return m_glyphs;
+  }
+
+  /**
+   * \brief Returns the lines of the layout.
+   *
+   * \return the lines, from top to bottom.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto lines() const noexcept -> const line_list&
+  {
+    return m_lines;
+  }
+
+  /**
+   * \brief Returns the size of the layout.
+   *
+   * \details The width is the width of the widest line, and the height is the height of
+   * all lines, including the line spacing between them.
+   *
+   * \return the size of the laid out text; an empty area for empty text.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    if (m_lines.empty())
+    {
+      return {0, 0};
+    }
+
+    int width = 0;
+    for (const auto& line : m_lines)
+    {
+      width = (line.width > width) ? line.width : width;
+    }
+
+    const auto height = static_cast<int>(m_lines.size() - 1u) * m_lineSkip + m_height;
+    return {width, height};
+  }
+
+  /**
+   * \brief Indicates whether or not the layout was shaped by a text shaper.
+   *
+   * \details The glyphs of shaped layouts are glyph indices of the font, which can only
+   * be rendered with the shaper, see `basic_renderer::render_layout()`.
+   *
+   * \return `true` if the layout is shaped; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_shaped() const noexcept -> bool
+  {
+    return m_shaped;
+  }
+
+  /**
+   * \brief Returns the width of the layout.
+   *
+   * \return the width of the widest line.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return size().width;
+  }
+
+  /**
+   * \brief Returns the height of the layout.
+   *
+   * \return the height of all lines.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return size().height;
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Returns the memory resource that the glyphs and lines are allocated from.
+   *
+   * \return a pointer to the memory resource.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_resource() const noexcept -> std::pmr::memory_resource*
+  {
+    return m_glyphs.get_allocator().resource();
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /// \} End of queries
+
+ private:
+#ifdef CENTURION_USE_HARFBUZZ
+  friend class text_shaper;
+#endif  // CENTURION_USE_HARFBUZZ
+
+  glyph_list m_glyphs;
+  line_list m_lines;
+  std::size_t m_lineStart{};
+  int m_lineSkip{};
+  int m_height{};
+  bool m_shaped{};
+
+  /// Computes the layout of the text, which is assumed to be empty.
+  void compute(const font& font, const std::string_view text, const int wrap)
+  {
+    m_lineSkip = font.line_skip();
+    m_height = font.height();
+
+    const auto useKerning = font.has_kerning();
+
+    int pen = 0;
+    unicode previous = 0;
+    std::size_t breakIndex = 0;  // The first glyph after the last space in the line
+
+    for (std::size_t index = 0; index < text.size();)
+    {
+      const auto code = detail::next_code_point(text, index);
+      if (code == '\n')
+      {
+        end_line(m_glyphs.size());
+        pen = 0;
+        previous = 0;
+        breakIndex = m_glyphs.size();
+        continue;
+      }
+
+      const auto glyph = static_cast<unicode>(code <= 0xFFFFu ? code : 0u);
+
+      int advance = 0;
+      if (glyph != 0)
+      {
+        int minX{}, maxX{}, minY{}, maxY{};
+        TTF_GlyphMetrics(font.get(), glyph, &minX, &maxX, &minY, &maxY, &advance);
+      }
+
+      auto x = pen;
+      if (useKerning && previous != 0 && glyph != 0)
+      {
+        x += font.kerning_amount(previous, glyph);
+      }
+
+      // Spaces are allowed to hang past the wrap width, they don't affect the line width
+      if (wrap > 0 && glyph != ' ' && x + advance > wrap && m_glyphs.size() > m_lineStart)
+      {
+        if (breakIndex > m_lineStart && breakIndex < m_glyphs.size())
+        {
+          // Move the last word to the next line
+          end_line(breakIndex);
+          pen = shift_line();
+          x = pen + (useKerning ? font.kerning_amount(previous, glyph) : 0);
+        }
+        else
+        {
+          end_line(m_glyphs.size());
+          pen = 0;
+          x = 0;
+        }
+
+        breakIndex = m_lineStart;
+      }
+
+      m_glyphs.push_back({glyph, {x, current_line_y()}, advance});
+
+      pen = x + advance;
+      previous = glyph;
+
+      if (glyph == ' ')
+      {
+        breakIndex = m_glyphs.size();
+      }
+    }
+
+    if (!text.empty())
+    {
+      end_line(m_glyphs.size());
+    }
+  }
+
+  [[nodiscard]] auto current_line_y() const noexcept -> int
+  {
+    return static_cast<int>(m_lines.size()) * m_lineSkip;
+  }
+
+  /// Ends the current line before the specified glyph.
+  void end_line(const std::size_t end)
+  {
+    auto width = 0;
+    for (auto index = end; index > m_lineStart; --index)
+    {
+      const auto& info = m_glyphs[index - 1u];
+      if (info.glyph != ' ')
+      {
+        width = info.position.x() + info.advance;
+        break;
+      }
+    }
+
+    m_lines.push_back({m_lineStart, end - m_lineStart, width});
+    m_lineStart = end;
+  }
+
+  /// Moves the glyphs that follow the last line to a new line, returns the new pen.
+  auto shift_line() noexcept -> int
+  {
+    const auto offset = m_glyphs[m_lineStart].position.x();
+    const auto y = current_line_y();
+
+    int pen = 0;
+    for (auto index = m_lineStart; index < m_glyphs.size(); ++index)
+    {
+      auto& info = m_glyphs[index];
+      info.position = {info.position.x() - offset, y};
+      pen = info.position.x() + info.advance;
+    }
+
+    return pen;
+  }
+};
+
+/**
+ * \class text_layout_cache
+ *
+ * \brief Memoizes text layouts by font, text and wrap width.
+ *
+ * \details The font is identified by its address and style, so changing the style of a
+ * font results in new layouts. The cache is cleared when it reaches its capacity, which
+ * keeps lookups cheap when the same set of labels is measured over and over.
+ *
+ * \details Since the layouts are always removed at once, they are allocated from an arena
+ * owned by the cache if `CENTURION_HAS_STD_MEMORY_RESOURCE` is defined, which is reset
+ * whenever the cache is cleared. Layouts that are copied out of the cache use the
+ * default memory resource.
+ *
+ * \note Caches can't be copied or moved, since the cached layouts refer to the arena.
+ *
+ * \note Layouts of destroyed fonts are not removed automatically, call `clear()` when a
+ * font is destroyed, since its address could be reused by another font.
+ *
+ * \see `text_layout`
+ *
+ * \since 6.1.0
+ */
+class text_layout_cache final
+{
+ public:
+  /**
+   * \brief Creates an empty layout cache.
+   *
+   * \param capacity the maximum amount of cached layouts.
+   *
+   * \since 6.1.0
+   */
+  explicit text_layout_cache(const std::size_t capacity = 1'024) : m_capacity{capacity}
+  {}
+
+  text_layout_cache(const text_layout_cache&) = delete;
+  text_layout_cache(text_layout_cache&&) = delete;
+
+  auto operator=(const text_layout_cache&) -> text_layout_cache& = delete;
+  auto operator=(text_layout_cache&&) -> text_layout_cache& = delete;
+
+  /**
+   * \brief Returns the layout of a UTF-8 encoded string, computing it if necessary.
+   *
+   * \note The returned reference is invalidated by subsequent calls that compute a new
+   * layout.
+   *
+   * \param font the font that will be used to measure the glyphs.
+   * \param text the UTF-8 encoded text.
+   * \param wrap the width in pixels after which the text will be wrapped; zero to only
+   * break lines at newline characters.
+   *
+   * \return the layout of the text.
+   *
+   * \since 6.1.0
+   */
+  auto get(const font& font, const std::string_view text, const int wrap = 0)
+      -> const text_layout&
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(font.get());
+    const auto style = static_cast<u64>(TTF_GetFontStyle(font.get()));
+
+    const u64 header[] = {static_cast<u64>(address),
+                          (style << 32u) | static_cast<u32>(wrap)};
+
+    m_key.assign(reinterpret_cast<const char*>(header), sizeof header);
+    m_key.append(text);
+
+    if (const auto it = m_layouts.find(m_key); it != m_layouts.end())
+    {
+      return it->second;
+    }
+
+    if (m_layouts.size() >= m_capacity)
+    {
+      clear();
+    }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+    return m_layouts.try_emplace(m_key, font, text, wrap, &m_arena).first->second;
+#else
+    return m_layouts.try_emplace(m_key, font, text, wrap).first->second;
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+  }
+
+#ifdef CENTURION_USE_HARFBUZZ
+
+  /**
+   * \brief Returns the shaped layout of a UTF-8 encoded string, shaping it if necessary.
+   *
+   * \details Shaping is far more expensive than computing plain layouts, so shaped
+   * layouts should always be obtained from a cache. Layouts are keyed by the address of
+   * the shaper and the text.
+   *
+   * \note The returned reference is invalidated by subsequent calls that compute a new
+   * layout.
+   *
+   * \note This function is defined in `text_shaper.hpp`.
+   *
+   * \param shaper the shaper that will be used to shape the text.
+   * \param text the UTF-8 encoded text.
+   *
+   * \return the shaped layout of the text.
+   *
+   * \since 6.1.0
+   */
+  auto get(const text_shaper& shaper, std::string_view text) -> const text_layout&;
+
+#endif  // CENTURION_USE_HARFBUZZ
+
+  /**
+   * \brief Returns the size of a UTF-8 encoded string, when rendered with a font.
+   *
+   * \param font the font that will be used to measure the glyphs.
+   * \param text the UTF-8 encoded text.
+   * \param wrap the width in pixels after which the text will be wrapped; zero to only
+   * break lines at newline characters.
+   *
+   * \return the size of the text.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto measure(const font& font,
+                             const std::string_view text,
+                             const int wrap = 0) -> iarea
+  {
+    return get(font, text, wrap).size();
+  }
+
+  /**
+   * \brief Removes all cached layouts.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_layouts.clear();
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+    m_arena.reset();
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+  }
+
+  /**
+   * \brief Returns the amount of cached layouts.
+   *
+   * \return the amount of cached layouts.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_layouts.size();
+  }
+
+  /**
+   * \brief Returns the maximum amount of cached layouts.
+   *
+   * \return the capacity of the cache.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto capacity() const noexcept -> std::size_t
+  {
+    return m_capacity;
+  }
+
+ private:
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  frame_resource m_arena;  // Must outlive the layouts
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  std::unordered_map<std::string, text_layout> m_layouts;
+  std::string m_key;  // Reused to avoid allocating keys for lookups
+  std::size_t m_capacity{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_NO_SDL_TTF
+#endif  // CENTURION_TEXT_LAYOUT_HEADER
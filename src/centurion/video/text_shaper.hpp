@@ -0,0 +1,525 @@
+#ifndef CENTURION_TEXT_SHAPER_HEADER
+#define CENTURION_TEXT_SHAPER_HEADER
+
+#if !defined(CENTURION_NO_SDL_TTF) && defined(CENTURION_USE_HARFBUZZ)
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <hb-ft.h>
+#include <hb.h>
+
+#include <cassert>      // assert
+#include <cstddef>      // size_t
+#include <cstdint>      // uintptr_t
+#include <memory>       // unique_ptr
+#include <string_view>  // string_view
+#include <utility>      // move
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/glyph_table.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "font_source.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "text_layout.hpp"
+#include "texture.hpp"
+#include "texture_atlas.hpp"
+#include "texture_memory.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class text_shaper
+ *
+ * \brief Shapes text with HarfBuzz, and caches the shaped glyphs in a glyph atlas.
+ *
+ * \details Font caches assume that every code point corresponds to a single glyph, which
+ * breaks ligatures and scripts such as Arabic and Devanagari, where the glyphs depend
+ * on the surrounding characters. A text shaper instead converts strings into shaped
+ * text layouts, whose glyphs are glyph indices of the font, positioned by HarfBuzz. The
+ * script, direction and language of each line are guessed from its contents.
+ *
+ * \details Shaping is expensive, so shaped layouts should be computed once and reused,
+ * e.g. with `text_layout_cache::get(text_shaper&, std::string_view)`. The glyphs of a
+ * layout are rasterized with FreeType and packed into the atlas of the shaper by
+ * `add_glyphs()`, after which the layout can be rendered with
+ * `basic_renderer::render_layout()`.
+ * \code{cpp}
+ *   cen::text_shaper shaper{cen::font_source{"fonts/noto_naskh.ttf"}, 24};
+ *   cen::text_layout_cache layouts;
+ *
+ *   const auto& layout = layouts.get(shaper, "مرحبا بالعالم");
+ *   shaper.add_glyphs(renderer, layout);
+ *
+ *   renderer.render_layout(shaper, layout, {10, 10});
+ * \endcode
+ *
+ * \note This class is only available if `CENTURION_USE_HARFBUZZ` is defined, in which
+ * case HarfBuzz and FreeType must be linked.
+ *
+ * \note Shaped layouts are only broken into lines at newline characters.
+ *
+ * \see `text_layout`
+ *
+ * \since 6.1.0
+ */
+class text_shaper final
+{
+ public:
+  /**
+   * \struct glyph_image
+   *
+   * \brief The location of a rasterized glyph in the atlas of a shaper.
+   *
+   * \since 6.1.0
+   */
+  struct glyph_image final
+  {
+    std::size_t page{};  ///< The index of the atlas page that contains the glyph.
+    irect source;        ///< The area of the page, empty for glyphs without pixels.
+    ipoint offset;       ///< The offset of the glyph image from its pen position.
+  };
+
+  /**
+   * \brief Opens a font for shaping.
+   *
+   * \details The font is sized like fonts opened by SDL_ttf, so layouts of a shaper and
+   * a font of the same size and file have the same line metrics.
+   *
+   * \param source the TrueType data, which is shared with the shaper.
+   * \param size the point size of the font, must be greater than zero.
+   * \param pageSize the size of the glyph atlas pages.
+   *
+   * \throws cen_error if the size isn't positive, or if the font couldn't be opened.
+   *
+   * \since 6.1.0
+   */
+  text_shaper(font_source source, const int size, const iarea pageSize = {1024, 1024})
+      : m_source{std::move(source)}
+      , m_atlas{pageSize}
+  {
+    if (size <= 0)
+    {
+      throw cen_error{"Bad font size!"};
+    }
+
+    FT_Library library{};
+    if (FT_Init_FreeType(&library) != 0)
+    {
+      throw cen_error{"Failed to initialize FreeType!"};
+    }
+
+    m_library.reset(library);
+
+    FT_Face face{};
+    if (FT_New_Memory_Face(m_library.get(),
+                           reinterpret_cast<const FT_Byte*>(m_source.data()),
+                           static_cast<FT_Long>(m_source.size()),
+                           0,
+                           &face) != 0)
+    {
+      throw cen_error{"Failed to open font face!"};
+    }
+
+    m_face.reset(face);
+
+    // SDL_ttf uses 72 DPI by default, i.e. one pixel per point
+    if (FT_Set_Char_Size(m_face.get(), 0, static_cast<FT_F26Dot6>(size) * 64, 0, 0) != 0)
+    {
+      throw cen_error{"Failed to set font size!"};
+    }
+
+    m_font.reset(hb_ft_font_create_referenced(m_face.get()));
+    m_buffer.reset(hb_buffer_create());
+
+    // The line metrics are rounded up like in SDL_ttf
+    const auto scale = m_face->size->metrics.y_scale;
+    m_ascent = ceil_26_6(FT_MulFix(m_face->ascender, scale));
+    m_height = ceil_26_6(FT_MulFix(m_face->ascender - m_face->descender, scale));
+    m_lineSkip = ceil_26_6(FT_MulFix(m_face->height, scale));
+    m_size = size;
+  }
+
+  /// \name Shaping
+  /// \{
+
+  /**
+   * \brief Shapes a UTF-8 encoded string.
+   *
+   * \details Each line is shaped separately, the glyphs of the returned layout are
+   * glyph indices of the font, in visual order.
+   *
+   * \param text the UTF-8 encoded text.
+   *
+   * \return a shaped layout of the text.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto shape(const std::string_view text) const -> text_layout
+  {
+    text_layout layout;
+    shape(text, layout);
+    return layout;
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Shapes a UTF-8 encoded string, allocating the layout from a memory resource.
+   *
+   * \param text the UTF-8 encoded text.
+   * \param resource the memory resource, must outlive the layout.
+   *
+   * \return a shaped layout of the text.
+   *
+   * \see `shape(std::string_view)`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto shape(const std::string_view text,
+                           std::pmr::memory_resource* resource) const -> text_layout
+  {
+    text_layout layout{resource};
+    shape(text, layout);
+    return layout;
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /// \} End of shaping
+
+  /// \name Glyph atlas
+  /// \{
+
+  /**
+   * \brief Rasterizes the glyphs of a shaped layout that haven't been cached yet.
+   *
+   * \details The glyphs are rendered with the current color of the renderer. This
+   * function has no effect if all glyphs of the layout have already been cached.
+   *
+   * \note Adding glyphs rebuilds the atlas pages, which invalidates previously obtained
+   * page handles.
+   *
+   * \tparam Renderer the type of the renderer.
+   *
+   * \param renderer the renderer that will be used to create the page textures.
+   * \param layout a layout that was shaped with this shaper.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  void add_glyphs(Renderer& renderer, const text_layout& layout)
+  {
+    assert(layout.is_shaped() && "Only shaped layouts can be added to a text shaper!");
+
+    const auto color = renderer.get_color();
+
+    bool added = false;
+    for (const auto& info : layout.glyphs())
+    {
+      if (!m_images.contains(info.glyph))
+      {
+        added = rasterize(info.glyph, color) || added;
+      }
+    }
+
+    if (added)
+    {
+      const texture_category_scope scope{texture_category::glyphs};
+      m_atlas.build(renderer);
+    }
+  }
+
+  /**
+   * \brief Returns the atlas location of a rasterized glyph, if it exists.
+   *
+   * \param index the glyph index.
+   *
+   * \return a pointer to the glyph image; a null pointer if the glyph hasn't been
+   * rasterized.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto try_at(const unicode index) const noexcept -> const glyph_image*
+  {
+    return m_images.find(index);
+  }
+
+  /**
+   * \brief Returns a handle to a glyph atlas page texture.
+   *
+   * \param index the index of the page.
+   *
+   * \return a handle to the page texture.
+   *
+   * \throws std::out_of_range if the page index is invalid.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto glyph_page(const std::size_t index) const -> texture_handle
+  {
+    return m_atlas.page(index);
+  }
+
+  /**
+   * \brief Returns the amount of glyph atlas pages.
+   *
+   * \return the amount of atlas pages.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto glyph_page_count() const noexcept -> std::size_t
+  {
+    return m_atlas.page_count();
+  }
+
+  /**
+   * \brief Returns the amount of rasterized glyphs.
+   *
+   * \return the amount of cached glyphs.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto glyph_count() const noexcept -> std::size_t
+  {
+    return m_images.size();
+  }
+
+  /// \} End of glyph atlas
+
+  /// \name Metrics
+  /// \{
+
+  /**
+   * \brief Returns the point size of the font.
+   *
+   * \return the size of the font.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> int
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the distance from the top of a line to the baseline.
+   *
+   * \return the ascent of the font, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto ascent() const noexcept -> int
+  {
+    return m_ascent;
+  }
+
+  /**
+   * \brief Returns the recommended distance between two lines.
+   *
+   * \return the line skip of the font, in pixels.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto line_skip() const noexcept -> int
+  {
+    return m_lineSkip;
+  }
+
+  /// \} End of metrics
+
+ private:
+  struct library_deleter final
+  {
+    void operator()(FT_Library library) noexcept
+    {
+      FT_Done_FreeType(library);
+    }
+  };
+
+  struct face_deleter final
+  {
+    void operator()(FT_Face face) noexcept
+    {
+      FT_Done_Face(face);
+    }
+  };
+
+  struct font_deleter final
+  {
+    void operator()(hb_font_t* font) noexcept
+    {
+      hb_font_destroy(font);
+    }
+  };
+
+  struct buffer_deleter final
+  {
+    void operator()(hb_buffer_t* buffer) noexcept
+    {
+      hb_buffer_destroy(buffer);
+    }
+  };
+
+  // Declared in order of dependency, e.g. the face must outlive the HarfBuzz font
+  font_source m_source;
+  std::unique_ptr<FT_LibraryRec_, library_deleter> m_library;
+  std::unique_ptr<FT_FaceRec_, face_deleter> m_face;
+  std::unique_ptr<hb_font_t, font_deleter> m_font;
+  std::unique_ptr<hb_buffer_t, buffer_deleter> m_buffer;  // Reused between shapes
+
+  texture_atlas m_atlas;
+  detail::glyph_table<glyph_image> m_images;
+
+  int m_size{};
+  int m_ascent{};
+  int m_height{};
+  int m_lineSkip{};
+
+  [[nodiscard]] constexpr static auto from_26_6(const long value) noexcept -> int
+  {
+    return static_cast<int>((value + 32) >> 6);
+  }
+
+  [[nodiscard]] constexpr static auto ceil_26_6(const long value) noexcept -> int
+  {
+    return static_cast<int>((value + 63) >> 6);
+  }
+
+  /// Shapes the text into a layout, which is assumed to be empty.
+  void shape(std::string_view text, text_layout& layout) const
+  {
+    layout.m_shaped = true;
+    layout.m_lineSkip = m_lineSkip;
+    layout.m_height = m_height;
+
+    auto* buffer = m_buffer.get();
+    while (!text.empty())
+    {
+      const auto newline = text.find('\n');
+      const auto line = text.substr(0, newline);
+      text.remove_prefix((newline == std::string_view::npos) ? text.size() : newline + 1);
+
+      hb_buffer_clear_contents(buffer);
+      hb_buffer_add_utf8(buffer,
+                         line.data(),
+                         static_cast<int>(line.size()),
+                         0,
+                         static_cast<int>(line.size()));
+      hb_buffer_guess_segment_properties(buffer);
+      hb_shape(m_font.get(), buffer, nullptr, 0);
+
+      unsigned count{};
+      const auto* infos = hb_buffer_get_glyph_infos(buffer, &count);
+      const auto* positions = hb_buffer_get_glyph_positions(buffer, &count);
+
+      const auto first = layout.m_glyphs.size();
+      const auto y = layout.current_line_y();
+
+      // The pen is kept in 26.6 fixed point, so that rounding errors don't accumulate
+      hb_position_t pen = 0;
+      for (unsigned index = 0; index < count; ++index)
+      {
+        const auto& position = positions[index];
+        layout.m_glyphs.push_back({static_cast<unicode>(infos[index].codepoint),
+                                   {from_26_6(pen + position.x_offset),
+                                    y - from_26_6(position.y_offset)},
+                                   from_26_6(position.x_advance)});
+
+        pen += position.x_advance;
+      }
+
+      layout.m_lines.push_back({first, layout.m_glyphs.size() - first, from_26_6(pen)});
+    }
+  }
+
+  /// Renders a glyph to the atlas, returns true if an image was added to the atlas.
+  auto rasterize(const unicode index, const color& color) -> bool
+  {
+    auto* slot = m_face->glyph;
+    if (FT_Load_Glyph(m_face.get(), index, FT_LOAD_DEFAULT) != 0 ||
+        FT_Render_Glyph(slot, FT_RENDER_MODE_NORMAL) != 0)
+    {
+      // Glyphs that can't be rendered are cached as empty, so they are only tried once
+      m_images.try_emplace(index, glyph_image{});
+      return false;
+    }
+
+    const auto& bitmap = slot->bitmap;
+    const ipoint offset{slot->bitmap_left, m_ascent - slot->bitmap_top};
+
+    const auto width = static_cast<int>(bitmap.width);
+    const auto height = static_cast<int>(bitmap.rows);
+    if (width == 0 || height == 0 || bitmap.pixel_mode != FT_PIXEL_MODE_GRAY)
+    {
+      m_images.try_emplace(index, glyph_image{0, {}, offset});
+      return false;
+    }
+
+    surface image{iarea{width, height}, pixel_format::rgba32};
+
+    // RGBA32 always stores the alpha component in the fourth byte of each pixel
+    auto* output = static_cast<u8*>(image.pixels());
+    for (int y = 0; y < height; ++y)
+    {
+      const auto* row = bitmap.buffer + y * bitmap.pitch;
+      auto* pixel = output + y * image.pitch();
+
+      for (int x = 0; x < width; ++x, pixel += 4)
+      {
+        pixel[0] = color.red();
+        pixel[1] = color.green();
+        pixel[2] = color.blue();
+        pixel[3] = row[x];
+      }
+    }
+
+    const auto id = m_atlas.add(image);
+    const auto& [page, source] = m_atlas.location(id);
+    m_images.try_emplace(index, glyph_image{page, source, offset});
+
+    return true;
+  }
+};
+
+inline auto text_layout_cache::get(const text_shaper& shaper, const std::string_view text)
+    -> const text_layout&
+{
+  // The second word can't be produced by plain layouts, which store a wrap width there
+  const u64 header[] = {static_cast<u64>(reinterpret_cast<std::uintptr_t>(&shaper)),
+                        ~u64{0}};
+
+  m_key.assign(reinterpret_cast<const char*>(header), sizeof header);
+  m_key.append(text);
+
+  if (const auto it = m_layouts.find(m_key); it != m_layouts.end())
+  {
+    return it->second;
+  }
+
+  if (m_layouts.size() >= m_capacity)
+  {
+    clear();
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  return m_layouts.try_emplace(m_key, shaper.shape(text, &m_arena)).first->second;
+#else
+  return m_layouts.try_emplace(m_key, shaper.shape(text)).first->second;
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+}
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // !defined(CENTURION_NO_SDL_TTF) && defined(CENTURION_USE_HARFBUZZ)
+
+#endif  // CENTURION_TEXT_SHAPER_HEADER
@@ -2,7 +2,10 @@
 #define CENTURION_TEXTURE_HEADER
 
 #include <SDL.h>
+
+#ifndef CENTURION_NO_SDL_IMAGE
 #include <SDL_image.h>
+#endif  // CENTURION_NO_SDL_IMAGE
 
 #include <cassert>  // assert
 #include <cstddef>  // size_t
@@ -11,20 +14,23 @@
 
 #include "../core/czstring.hpp"
 #include "../core/exception.hpp"
+#include "../core/integers.hpp"
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
+#include "../core/resource_traits.hpp"
 #include "../core/result.hpp"
-#include "../detail/address_of.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/owner_handle_api.hpp"
-#include "../detail/to_string.hpp"
 #include "../math/area.hpp"
 #include "../math/point.hpp"
+#include "../math/rect.hpp"
 #include "blend_mode.hpp"
 #include "color.hpp"
 #include "pixel_format.hpp"
 #include "scale_mode.hpp"
 #include "surface.hpp"
 #include "texture_access.hpp"
+#include "texture_memory.hpp"
 
 namespace cen {
 
@@ -34,15 +40,52 @@ namespace cen {
 template <typename T>
 class basic_texture;
 
+/**
+ * \struct yuv_plane
+ *
+ * \brief A view of a plane of planar or semi-planar YUV pixel data.
+ *
+ * \details The chroma planes of the 4:2:0 formats are half as wide and half as tall as
+ * the luma plane, rounded up.
+ *
+ * \since 6.1.0
+ */
+struct yuv_plane final
+{
+  const u8* data{};  ///< The first byte of the plane.
+  int pitch{};       ///< The amount of bytes between consecutive rows of the plane.
+};
+
 using texture = basic_texture<detail::owning_type>;
 using texture_handle = basic_texture<detail::handle_type>;
 
+/// \cond FALSE
+namespace detail {
+
+// The attributes are immutable, so they're queried once, when the texture is created
+struct texture_attributes final
+{
+  u32 format{};
+  int access{};
+  iarea size{};
+  bool cached{};
+};
+
+}  // namespace detail
+/// \endcond
+
 /**
  * \class basic_texture
  *
  * \brief Represents an hardware-accelerated image, intended to be rendered using the
  * `basic_renderer` class.
  *
+ * \details The memory used by owning textures is accounted for, see `texture_memory`.
+ *
+ * \details The size, format and access of a texture never change, so owning textures,
+ * and handles created from them, store these attributes when they are created, instead
+ * of querying SDL every time they are used, e.g. when a texture is rendered.
+ *
  * \since 3.0.0
  *
  * \see `texture`
@@ -75,6 +118,9 @@ class basic_texture final
       {
         throw cen_error{"Cannot create texture from null pointer!"};
       }
+
+      detail::track_texture(m_texture.get());
+      cache_attributes();
     }
   }
 
@@ -88,9 +134,13 @@ class basic_texture final
    * \since 5.0.0
    */
   template <typename TT = T, detail::is_handle<TT> = 0>
-  explicit basic_texture(texture& owner) noexcept : m_texture{owner.get()}
+  explicit basic_texture(texture& owner) noexcept
+      : m_texture{owner.get()}
+      , m_attributes{owner.m_attributes}
   {}
 
+#ifndef CENTURION_NO_SDL_IMAGE
+
   /**
    * \brief Creates a texture based the image at the specified path.
    *
@@ -111,6 +161,9 @@ class basic_texture final
     {
       throw img_error{};
     }
+
+    detail::track_texture(m_texture.get());
+    cache_attributes();
   }
 
   /**
@@ -130,10 +183,13 @@ class basic_texture final
       : basic_texture{renderer, path.c_str()}
   {}
 
+#endif  // CENTURION_NO_SDL_IMAGE
+
   /**
    * \brief Creates an texture that is a copy of the supplied surface.
    *
    * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   * \tparam U the ownership semantics of the surface.
    *
    * \param renderer the renderer that will be used to create the texture.
    * \param surface the surface that the texture will be based on.
@@ -142,14 +198,17 @@ class basic_texture final
    *
    * \since 4.0.0
    */
-  template <typename Renderer, typename TT = T, detail::is_owner<TT> = 0>
-  basic_texture(const Renderer& renderer, const surface& surface)
+  template <typename Renderer, typename U, typename TT = T, detail::is_owner<TT> = 0>
+  basic_texture(const Renderer& renderer, const basic_surface<U>& surface)
       : m_texture{SDL_CreateTextureFromSurface(renderer.get(), surface.get())}
   {
     if (!m_texture)
     {
       throw sdl_error{};
     }
+
+    detail::track_texture(m_texture.get());
+    cache_attributes();
   }
 
   /**
@@ -181,6 +240,9 @@ class basic_texture final
     {
       throw sdl_error{};
     }
+
+    detail::track_texture(m_texture.get());
+    cache_attributes();
   }
 
   /**
@@ -214,18 +276,12 @@ class basic_texture final
     basic_texture texture{renderer, format, texture_access::streaming, surface.size()};
     texture.set_blend_mode(blendMode);
 
-    u32* pixels{};
-    if (!texture.lock(&pixels))
+    // The pitch of the texture memory may differ from the pitch of the surface
+    if (!texture.update(surface))
     {
       throw sdl_error{};
     }
 
-    const auto maxCount = static_cast<std::size_t>(surface.pitch()) *
-                          static_cast<std::size_t>(surface.height());
-    SDL_memcpy(pixels, surface.pixels(), maxCount);
-
-    texture.unlock();
-
     return texture;
   }
 
@@ -340,6 +396,237 @@ class basic_texture final
 
   /// \} End of setters
 
+  /// \name Pixel updates
+  /// \{
+
+  /**
+   * \brief Replaces the pixels of an area of the texture.
+   *
+   * \details The pixel data is copied by SDL, which takes care of any difference between
+   * the supplied pitch and the pitch of the texture. This function works with all texture
+   * access modes, but it is mostly intended for `static` textures. For `streaming`
+   * textures, prefer `write_pixels()` when the pixels can be generated in place.
+   *
+   * \param area the area of the texture that will be updated.
+   * \param pixels the new pixel data, in the pixel format of the texture.
+   * \param pitch the amount of bytes between consecutive rows in the pixel data.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update(const irect& area, const void* pixels, const int pitch) noexcept -> result
+  {
+    return SDL_UpdateTexture(m_texture, area.data(), pixels, pitch) == 0;
+  }
+
+  /**
+   * \brief Replaces all pixels of the texture.
+   *
+   * \param pixels the new pixel data, in the pixel format of the texture.
+   * \param pitch the amount of bytes between consecutive rows in the pixel data.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update(const void* pixels, const int pitch) noexcept -> result
+  {
+    return SDL_UpdateTexture(m_texture, nullptr, pixels, pitch) == 0;
+  }
+
+  /**
+   * \brief Copies the pixels of a surface into the texture.
+   *
+   * \details The surface is copied to the area of the texture that starts at the
+   * specified position and has the size of the surface. The pitch of the surface is
+   * honored, so it doesn't need to match the pitch of the texture.
+   *
+   * \pre The pixel format of the surface must be the same as the texture pixel format.
+   * \pre The surface must fit in the texture at the specified position.
+   *
+   * \tparam U the ownership tag of the surface.
+   *
+   * \param surface the surface that will be copied.
+   * \param position the position of the top-left corner of the updated area.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename U>
+  auto update(const basic_surface<U>& surface, const ipoint position = {}) noexcept
+      -> result
+  {
+    assert(surface.format_info().format() == format());
+
+    auto* source = surface.get();
+    const auto mustLock = SDL_MUSTLOCK(source);
+
+    if (mustLock && SDL_LockSurface(source) != 0)
+    {
+      return failure;
+    }
+
+    const irect area{position, surface.size()};
+    const auto res = update(area, source->pixels, source->pitch);
+
+    if (mustLock)
+    {
+      SDL_UnlockSurface(source);
+    }
+
+    return res;
+  }
+
+  /**
+   * \brief Replaces the pixels of an area of a planar YUV texture.
+   *
+   * \details This is intended for `iyuv` and `yv12` textures, where the planes are
+   * converted to RGB by the GPU, which avoids converting the frames on the CPU. The
+   * planes are always supplied in Y, U, V order, regardless of the order of the texture
+   * format.
+   *
+   * \param area the area of the texture that will be updated.
+   * \param y the luma plane.
+   * \param u the blue-difference chroma plane.
+   * \param v the red-difference chroma plane.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update_yuv(const irect& area,
+                  const yuv_plane& y,
+                  const yuv_plane& u,
+                  const yuv_plane& v) noexcept -> result
+  {
+    return SDL_UpdateYUVTexture(m_texture,
+                                area.data(),
+                                y.data,
+                                y.pitch,
+                                u.data,
+                                u.pitch,
+                                v.data,
+                                v.pitch) == 0;
+  }
+
+  /**
+   * \brief Replaces all pixels of a planar YUV texture.
+   *
+   * \param y the luma plane.
+   * \param u the blue-difference chroma plane.
+   * \param v the red-difference chroma plane.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update_yuv(const yuv_plane& y, const yuv_plane& u, const yuv_plane& v) noexcept
+      -> result
+  {
+    return SDL_UpdateYUVTexture(m_texture,
+                                nullptr,
+                                y.data,
+                                y.pitch,
+                                u.data,
+                                u.pitch,
+                                v.data,
+                                v.pitch) == 0;
+  }
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Replaces the pixels of an area of a semi-planar YUV texture.
+   *
+   * \details This is intended for `nv12` and `nv21` textures, which store the chroma
+   * samples interleaved in a single plane.
+   *
+   * \param area the area of the texture that will be updated.
+   * \param y the luma plane.
+   * \param uv the interleaved chroma plane.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update_nv(const irect& area, const yuv_plane& y, const yuv_plane& uv) noexcept
+      -> result
+  {
+    const auto res =
+        SDL_UpdateNVTexture(m_texture, area.data(), y.data, y.pitch, uv.data, uv.pitch);
+    return res == 0;
+  }
+
+  /**
+   * \brief Replaces all pixels of a semi-planar YUV texture.
+   *
+   * \param y the luma plane.
+   * \param uv the interleaved chroma plane.
+   *
+   * \return `success` if the texture was updated; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto update_nv(const yuv_plane& y, const yuv_plane& uv) noexcept -> result
+  {
+    const auto res =
+        SDL_UpdateNVTexture(m_texture, nullptr, y.data, y.pitch, uv.data, uv.pitch);
+    return res == 0;
+  }
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+
+  /**
+   * \brief Writes pixels directly into the memory of a locked area of the texture.
+   *
+   * \details The area is locked, after which the callable is invoked with a pointer to
+   * the first byte of the area and the pitch of the locked memory, i.e. the callable
+   * must honor the pitch when writing rows. This avoids the intermediate copy of
+   * `update()` when the pixels are generated or decoded on the fly. The locked memory is
+   * write-only, and its previous contents are undefined.
+   *
+   * \pre The texture must have `streaming` texture access.
+   *
+   * \tparam Callable the type of the callable, with the signature `void(void*, int)`.
+   *
+   * \param area the area of the texture that will be locked.
+   * \param callable the callable that will write the pixels.
+   *
+   * \return `success` if the texture was locked; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename Callable>
+  auto write_pixels(const irect& area, Callable&& callable) -> result
+  {
+    return write_locked(area.data(), callable);
+  }
+
+  /**
+   * \brief Writes pixels directly into the memory of the entire locked texture.
+   *
+   * \pre The texture must have `streaming` texture access.
+   *
+   * \tparam Callable the type of the callable, with the signature `void(void*, int)`.
+   *
+   * \param callable the callable that will write the pixels.
+   *
+   * \return `success` if the texture was locked; `failure` otherwise.
+   *
+   * \see `write_pixels(const irect&, Callable&&)`
+   *
+   * \since 6.1.0
+   */
+  template <typename Callable>
+  auto write_pixels(Callable&& callable) -> result
+  {
+    return write_locked(nullptr, callable);
+  }
+
+  /// \} End of pixel updates
+
   /// \name Getters
   /// \{
 
@@ -352,9 +639,7 @@ class basic_texture final
    */
   [[nodiscard]] auto format() const noexcept -> pixel_format
   {
-    u32 format{};
-    SDL_QueryTexture(m_texture, &format, nullptr, nullptr, nullptr);
-    return static_cast<pixel_format>(format);
+    return static_cast<pixel_format>(attributes().format);
   }
 
   /**
@@ -366,9 +651,7 @@ class basic_texture final
    */
   [[nodiscard]] auto access() const noexcept -> texture_access
   {
-    int access{};
-    SDL_QueryTexture(m_texture, nullptr, &access, nullptr, nullptr);
-    return static_cast<texture_access>(access);
+    return static_cast<texture_access>(attributes().access);
   }
 
   /**
@@ -406,10 +689,7 @@ class basic_texture final
    */
   [[nodiscard]] auto size() const noexcept -> iarea
   {
-    int width{};
-    int height{};
-    SDL_QueryTexture(m_texture, nullptr, nullptr, &width, &height);
-    return {width, height};
+    return attributes().size;
   }
 
   /**
@@ -517,6 +797,8 @@ class basic_texture final
    * into memory leak issues. You **must** call `SDL_DestroyTexture` on the returned
    * pointer to free the associated memory.
    *
+   * \note The memory of a released texture is no longer accounted for.
+   *
    * \return a pointer to the associated SDL texture.
    *
    * \since 5.0.0
@@ -524,6 +806,8 @@ class basic_texture final
   template <typename TT = T, detail::is_owner<TT> = 0>
   [[nodiscard]] auto release() noexcept -> owner<SDL_Texture*>
   {
+    detail::untrack_texture(m_texture.get());
+    m_attributes = {};
     return m_texture.release();
   }
 
@@ -588,10 +872,38 @@ class basic_texture final
   {
     void operator()(SDL_Texture* texture) noexcept
     {
+      detail::untrack_texture(texture);
       SDL_DestroyTexture(texture);
     }
   };
   detail::pointer_manager<T, SDL_Texture, deleter> m_texture;
+  detail::texture_attributes m_attributes;
+
+  template <typename>
+  friend class basic_texture;
+
+  void cache_attributes() noexcept
+  {
+    m_attributes = query_attributes();
+    m_attributes.cached = true;
+  }
+
+  [[nodiscard]] auto query_attributes() const noexcept -> detail::texture_attributes
+  {
+    detail::texture_attributes attributes;
+    SDL_QueryTexture(m_texture,
+                     &attributes.format,
+                     &attributes.access,
+                     &attributes.size.width,
+                     &attributes.size.height);
+    return attributes;
+  }
+
+  // Handles to textures that weren't created by an owning texture query SDL every time
+  [[nodiscard]] auto attributes() const noexcept -> detail::texture_attributes
+  {
+    return m_attributes.cached ? m_attributes : query_attributes();
+  }
 
   /**
    * \brief Locks the texture for write-only pixel access.
@@ -635,8 +947,58 @@ class basic_texture final
   {
     SDL_UnlockTexture(m_texture);
   }
+
+  template <typename Callable>
+  auto write_locked(const SDL_Rect* area, Callable& callable) -> result
+  {
+    void* pixels{};
+    int pitch{};
+    if (SDL_LockTexture(m_texture, area, &pixels, &pitch) != 0)
+    {
+      return failure;
+    }
+
+    callable(pixels, pitch);
+
+    unlock();
+    return success;
+  }
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_texture<detail::owning_type>;
+extern template class basic_texture<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
+/**
+ * \brief Writes a textual representation of a texture to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param texture the texture that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_texture<T>& texture) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("texture{data: ",
+                      texture.get(),
+                      ", width: ",
+                      texture.width(),
+                      ", height: ",
+                      texture.height(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a texture.
  *
@@ -649,9 +1011,7 @@ class basic_texture final
 template <typename T>
 [[nodiscard]] auto to_string(const basic_texture<T>& texture) -> std::string
 {
-  return "texture{data: " + detail::address_of(texture.get()) +
-         ", width: " + detail::to_string(texture.width()).value() +
-         ", height: " + detail::to_string(texture.height()).value() + "}";
+  return detail::format_string(texture);
 }
 
 /**
@@ -670,6 +1030,45 @@ auto operator<<(std::ostream& stream, const basic_texture<T>& texture) -> std::o
   return stream << to_string(texture);
 }
 
+/**
+ * \brief Provides the memory usage of owning textures to resource managers.
+ *
+ * \details The budget of texture managers defaults to the texture memory budget, if
+ * there is one, and unused textures are also evicted while the texture memory budget is
+ * exceeded.
+ *
+ * \see `texture_memory::set_budget()`
+ *
+ * \since 6.1.0
+ */
+template <>
+struct resource_traits<texture>
+{
+  [[nodiscard]] static auto bytes(const texture& texture) noexcept -> std::size_t
+  {
+    return detail::texture_bytes(static_cast<u32>(texture.format()),
+                                 texture.width(),
+                                 texture.height());
+  }
+
+  [[nodiscard]] static auto default_budget() -> std::size_t
+  {
+    if (const auto budget = texture_memory::budget(); budget != 0)
+    {
+      return budget;
+    }
+    else
+    {
+      return detail::default_resource_budget();
+    }
+  }
+
+  [[nodiscard]] static auto over_budget() -> bool
+  {
+    return texture_memory::over_budget();
+  }
+};
+
 /// \}
 
 }  // namespace cen
@@ -0,0 +1,351 @@
+#ifndef CENTURION_TEXTURE_ATLAS_HEADER
+#define CENTURION_TEXTURE_ATLAS_HEADER
+
+#include <SDL.h>
+
+#include <cstddef>   // size_t
+#include <optional>  // optional
+#include <utility>   // pair
+#include <vector>    // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/skyline_packer.hpp"
+#include "../math/area.hpp"
+#include "../math/rect.hpp"
+#include "blend_mode.hpp"
+#include "pixel_format.hpp"
+#include "surface.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct atlas_region
+ *
+ * \brief Represents an image that has been packed into a texture atlas.
+ *
+ * \details Atlas regions are cheap to copy, and are intended to be used with the
+ * `basic_renderer::render()` overloads that accept a source rectangle, e.g.
+ * `renderer.render(region.texture, region.source, destination)`.
+ *
+ * \see `texture_atlas`
+ *
+ * \since 6.1.0
+ */
+struct atlas_region final
+{
+  texture_handle texture;  ///< The page texture that contains the image.
+  irect source;            ///< The area of the page texture that contains the image.
+  std::size_t page{};      ///< The index of the page texture.
+};
+
+/**
+ * \class texture_atlas
+ *
+ * \brief Packs many small images into a few large textures.
+ *
+ * \details Rendering images from a single texture avoids texture switches, and makes it
+ * possible to batch the rendering of many images, e.g. using `sprite_batch`. Images are
+ * packed into pages of a fixed size as they are added, using a skyline packer. When a
+ * page is full, a new page is created.
+ *
+ * \details Images are added as surfaces, and the page textures are created when `build()`
+ * is called. Regions can only be obtained once the atlas has been built.
+ *
+ * \note Calling `build()` again after adding more images only uploads the modified areas
+ * of the existing page textures, so previously obtained regions remain valid.
+ *
+ * \see `atlas_region`
+ *
+ * \since 6.1.0
+ */
+class texture_atlas final
+{
+ public:
+  /**
+   * \typedef id_type
+   *
+   * \brief The type of the identifiers of images added to the atlas.
+   *
+   * \since 6.1.0
+   */
+  using id_type = std::size_t;
+
+  /// \name Construction
+  /// \{
+
+  /**
+   * \brief Creates an empty texture atlas.
+   *
+   * \param pageSize the size of each page texture.
+   * \param padding the amount of empty pixels between packed images, which prevents
+   * bleeding between neighbouring images when using linear filtering.
+   *
+   * \since 6.1.0
+   */
+  explicit texture_atlas(const iarea pageSize = {2048, 2048}, const int padding = 1)
+      : m_pageSize{pageSize}
+      , m_padding{padding}
+  {}
+
+  /// \} End of construction
+
+  /**
+   * \brief Packs an image into the atlas.
+   *
+   * \details The pixels of the image are copied, so the surface can be destroyed after
+   * this call.
+   *
+   * \tparam T the ownership tag of the surface.
+   *
+   * \param image the image that will be added.
+   *
+   * \return the identifier associated with the image.
+   *
+   * \throws cen_error if the image is larger than a page.
+   * \throws sdl_error if the image couldn't be copied.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto add(const basic_surface<T>& image) -> id_type
+  {
+    const auto size = image.size();
+    const iarea padded{size.width + m_padding, size.height + m_padding};
+
+    if (padded.width > m_pageSize.width || padded.height > m_pageSize.height)
+    {
+      throw cen_error{"Image is too large for the texture atlas pages!"};
+    }
+
+    auto [index, position] = allocate(padded);
+    auto& target = m_pages.at(index);
+
+    SDL_Rect dst{position.x(), position.y(), size.width, size.height};
+
+    // Copies the pixels as is, instead of blending them with the empty page
+    SDL_BlendMode mode{};
+    SDL_GetSurfaceBlendMode(image.get(), &mode);
+    SDL_SetSurfaceBlendMode(image.get(), SDL_BLENDMODE_NONE);
+
+    const auto blitted = SDL_BlitSurface(image.get(), nullptr, target.image.get(), &dst);
+
+    SDL_SetSurfaceBlendMode(image.get(), mode);
+
+    if (blitted != 0)
+    {
+      throw sdl_error{};
+    }
+
+    const irect source{position, size};
+    target.dirty = target.dirty ? get_union(*target.dirty, source) : source;
+    m_entries.push_back({index, source});
+
+    return m_entries.size() - 1u;
+  }
+
+  /**
+   * \brief Uploads the pages that have been modified since the last build.
+   *
+   * \details The texture of a page is created the first time the page is built. After
+   * that, only the area of the page that contains the newly added images is uploaded.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer that will be used to create the textures.
+   *
+   * \throws sdl_error if a texture couldn't be created or updated.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  void build(const Renderer& renderer)
+  {
+    for (auto& page : m_pages)
+    {
+      if (!page.texture)
+      {
+        auto& texture = page.texture.emplace(renderer,
+                                             pixel_format::rgba32,
+                                             texture_access::no_lock,
+                                             m_pageSize);
+        texture.set_blend_mode(blend_mode::blend);
+        page.dirty = irect{{0, 0}, m_pageSize};
+      }
+
+      if (page.dirty)
+      {
+        const auto& area = *page.dirty;
+        const auto* pixels = static_cast<const u8*>(page.image.pixels()) +
+                             area.y() * page.image.pitch() + area.x() * bytes_per_pixel;
+
+        if (!page.texture->update(area, pixels, page.image.pitch()))
+        {
+          throw sdl_error{};
+        }
+
+        page.dirty.reset();
+      }
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the region associated with a previously added image.
+   *
+   * \pre The atlas must have been built since the image was added.
+   *
+   * \param id the identifier of the image.
+   *
+   * \return the region that contains the image.
+   *
+   * \throws cen_error if the identifier is invalid, or if the atlas hasn't been built.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto region(const id_type id) const -> atlas_region
+  {
+    if (id >= m_entries.size())
+    {
+      throw cen_error{"Invalid texture atlas identifier!"};
+    }
+
+    const auto& entry = m_entries[id];
+    const auto& data = m_pages[entry.page];
+
+    if (!data.texture || data.dirty)
+    {
+      throw cen_error{"Texture atlas must be built before obtaining regions!"};
+    }
+
+    return atlas_region{texture_handle{data.texture->get()}, entry.source, entry.page};
+  }
+
+  /**
+   * \brief Returns the page index and source rectangle of a previously added image.
+   *
+   * \details Unlike `region()`, this function can be used before the atlas is built.
+   *
+   * \param id the identifier of the image.
+   *
+   * \return the page index and the area of the page that contains the image.
+   *
+   * \throws std::out_of_range if the identifier is invalid.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto location(const id_type id) const -> std::pair<std::size_t, irect>
+  {
+    const auto& entry = m_entries.at(id);
+    return {entry.page, entry.source};
+  }
+
+  /**
+   * \brief Returns a handle to a page texture.
+   *
+   * \param index the index of the page.
+   *
+   * \return a handle to the page texture; a null handle if the page hasn't been built.
+   *
+   * \throws std::out_of_range if the page index is invalid.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto page(const std::size_t index) const -> texture_handle
+  {
+    const auto& data = m_pages.at(index);
+    return texture_handle{data.texture ? data.texture->get() : nullptr};
+  }
+
+  /**
+   * \brief Returns the amount of pages in the atlas.
+   *
+   * \return the amount of pages.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto page_count() const noexcept -> std::size_t
+  {
+    return m_pages.size();
+  }
+
+  /**
+   * \brief Returns the amount of images that have been added to the atlas.
+   *
+   * \return the amount of images.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * \brief Returns the size of the page textures.
+   *
+   * \return the page size.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto page_size() const noexcept -> iarea
+  {
+    return m_pageSize;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct page_data final
+  {
+    explicit page_data(const iarea size)
+        : image{size, pixel_format::rgba32}
+        , packer{size}
+    {}
+
+    surface image;
+    detail::skyline_packer packer;
+    std::optional<cen::texture> texture;
+    std::optional<irect> dirty;  ///< The area that hasn't been uploaded yet.
+  };
+
+  struct entry final
+  {
+    std::size_t page{};
+    irect source;
+  };
+
+  inline constexpr static int bytes_per_pixel = 4;  // The pages use the RGBA32 format
+
+  std::vector<page_data> m_pages;
+  std::vector<entry> m_entries;
+  iarea m_pageSize;
+  int m_padding{};
+
+  [[nodiscard]] auto allocate(const iarea size) -> std::pair<std::size_t, ipoint>
+  {
+    for (std::size_t index = 0; index < m_pages.size(); ++index)
+    {
+      if (const auto position = m_pages[index].packer.insert(size))
+      {
+        return {index, *position};
+      }
+    }
+
+    auto& data = m_pages.emplace_back(m_pageSize);
+    return {m_pages.size() - 1u, data.packer.insert(size).value()};
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_ATLAS_HEADER
@@ -0,0 +1,448 @@
+#ifndef CENTURION_TEXTURE_MEMORY_HEADER
+#define CENTURION_TEXTURE_MEMORY_HEADER
+
+#include <SDL.h>
+
+#include <array>          // array
+#include <cassert>        // assert
+#include <cstddef>        // size_t
+#include <unordered_map>  // unordered_map
+#include <utility>        // move
+
+#include "../core/delegate.hpp"
+#include "../core/integers.hpp"
+#include "../core/to_underlying.hpp"
+#include "../thread/scoped_lock.hpp"
+#include "../thread/spin_mutex.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \enum texture_category
+ *
+ * \brief Provides the categories that texture memory is accounted under.
+ *
+ * \details The category of a texture is determined when it is created, either by an
+ * active `texture_category_scope`, or by its texture access.
+ *
+ * \see `texture_memory::usage()`
+ *
+ * \since 6.1.0
+ */
+enum class texture_category
+{
+  general,    ///< Any texture that isn't covered by another category.
+  text,       ///< Textures of rendered text.
+  glyphs,     ///< Glyph textures and glyph atlases of font caches.
+  targets,    ///< Textures with `target` access.
+  streaming,  ///< Textures with `streaming` access.
+  user        ///< Available for use by applications.
+};
+
+/// The amount of texture categories.
+inline constexpr std::size_t texture_category_count = 6;
+
+/**
+ * \struct texture_memory_usage
+ *
+ * \brief Describes the memory used by textures.
+ *
+ * \details The memory of a texture is computed from its pixel format and size, i.e. it
+ * doesn't include any padding or driver overhead, so it's a lower bound of the actual
+ * video memory usage.
+ *
+ * \since 6.1.0
+ */
+struct texture_memory_usage final
+{
+  std::size_t bytes{};       ///< The amount of bytes used by live textures.
+  std::size_t peak_bytes{};  ///< The highest amount of used bytes, see `reset_peaks()`.
+  std::size_t textures{};    ///< The amount of live textures.
+};
+
+/**
+ * \brief Signature of functions invoked when the texture memory budget is exceeded.
+ *
+ * \details The first argument is the amount of used bytes, and the second argument is the
+ * budget.
+ *
+ * \since 6.1.0
+ */
+using texture_budget_callback = delegate<void(std::size_t, std::size_t)>;
+
+/// \cond FALSE
+namespace detail {
+
+// Planar YUV formats store a full resolution Y plane along with two quarter resolution
+// chroma planes, all of the other formats are packed
+[[nodiscard]] inline auto texture_bytes(const u32 format,
+                                        const int width,
+                                        const int height) noexcept -> std::size_t
+{
+  const auto pixels = static_cast<std::size_t>(width) * static_cast<std::size_t>(height);
+  switch (format)
+  {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+      return pixels + (pixels / 2u);
+
+    default:
+      return pixels * SDL_BYTESPERPIXEL(format);
+  }
+}
+
+class texture_memory_state final
+{
+ public:
+  [[nodiscard]] static auto get() -> texture_memory_state&
+  {
+    static texture_memory_state state;
+    return state;
+  }
+
+  void track(SDL_Texture* texture, const texture_category category)
+  {
+    u32 format{};
+    int access{};
+    int width{};
+    int height{};
+    if (!texture || SDL_QueryTexture(texture, &format, &access, &width, &height) != 0)
+    {
+      return;
+    }
+
+    const auto bytes = texture_bytes(format, width, height);
+
+    std::size_t used{};
+    std::size_t budget{};
+    texture_budget_callback callback;
+    {
+      scoped_lock lock{m_mutex};
+
+      auto [it, inserted] = m_textures.try_emplace(texture);
+      auto& entry = it->second;
+      if (!inserted)
+      {
+        remove(entry);  // Tracked again, e.g. after being released
+      }
+
+      entry.bytes = bytes;
+      entry.category = (category == texture_category::general)
+                           ? category_of(static_cast<SDL_TextureAccess>(access))
+                           : category;
+      add(entry);
+
+      used = m_total.bytes;
+      budget = m_budget;
+      if (m_budget != 0 && m_total.bytes > m_budget)
+      {
+        callback = m_callback;
+      }
+    }
+
+    // Invoked without holding the lock, so that the callback can destroy textures
+    if (callback)
+    {
+      callback(used, budget);
+    }
+  }
+
+  void untrack(SDL_Texture* texture) noexcept
+  {
+    scoped_lock lock{m_mutex};
+
+    if (const auto it = m_textures.find(texture); it != m_textures.end())
+    {
+      remove(it->second);
+      m_textures.erase(it);
+    }
+  }
+
+  [[nodiscard]] auto usage() -> texture_memory_usage
+  {
+    scoped_lock lock{m_mutex};
+    return m_total;
+  }
+
+  [[nodiscard]] auto usage(const texture_category category) -> texture_memory_usage
+  {
+    scoped_lock lock{m_mutex};
+    return m_categories.at(index_of(category));
+  }
+
+  void reset_peaks()
+  {
+    scoped_lock lock{m_mutex};
+
+    m_total.peak_bytes = m_total.bytes;
+    for (auto& category : m_categories)
+    {
+      category.peak_bytes = category.bytes;
+    }
+  }
+
+  void set_budget(const std::size_t bytes, texture_budget_callback callback)
+  {
+    scoped_lock lock{m_mutex};
+    m_budget = bytes;
+    m_callback = std::move(callback);
+  }
+
+  [[nodiscard]] auto budget() -> std::size_t
+  {
+    scoped_lock lock{m_mutex};
+    return m_budget;
+  }
+
+  [[nodiscard]] static auto current_category() noexcept -> texture_category&
+  {
+    thread_local texture_category category{texture_category::general};
+    return category;
+  }
+
+ private:
+  struct entry final
+  {
+    std::size_t bytes{};
+    texture_category category{texture_category::general};
+  };
+
+  spin_mutex m_mutex;
+  std::unordered_map<const SDL_Texture*, entry> m_textures;
+  std::array<texture_memory_usage, texture_category_count> m_categories{};
+  texture_memory_usage m_total;
+  std::size_t m_budget{};
+  texture_budget_callback m_callback;
+
+  [[nodiscard]] static auto index_of(const texture_category category) noexcept
+      -> std::size_t
+  {
+    return static_cast<std::size_t>(to_underlying(category));
+  }
+
+  [[nodiscard]] static auto category_of(const SDL_TextureAccess access) noexcept
+      -> texture_category
+  {
+    switch (access)
+    {
+      case SDL_TEXTUREACCESS_STATIC:
+        return texture_category::general;
+
+      case SDL_TEXTUREACCESS_STREAMING:
+        return texture_category::streaming;
+
+      case SDL_TEXTUREACCESS_TARGET:
+        return texture_category::targets;
+
+      default:
+        assert(false);
+        return texture_category::general;
+    }
+  }
+
+  static void add(texture_memory_usage& usage, const std::size_t bytes) noexcept
+  {
+    usage.bytes += bytes;
+    ++usage.textures;
+
+    if (usage.bytes > usage.peak_bytes)
+    {
+      usage.peak_bytes = usage.bytes;
+    }
+  }
+
+  static void remove(texture_memory_usage& usage, const std::size_t bytes) noexcept
+  {
+    usage.bytes -= bytes;
+    --usage.textures;
+  }
+
+  void add(const entry& e) noexcept
+  {
+    add(m_total, e.bytes);
+    add(m_categories[index_of(e.category)], e.bytes);
+  }
+
+  void remove(const entry& e) noexcept
+  {
+    remove(m_total, e.bytes);
+    remove(m_categories[index_of(e.category)], e.bytes);
+  }
+};
+
+// Called by owning textures, the category is taken from the active scope
+inline void track_texture(SDL_Texture* texture)
+{
+  auto& state = texture_memory_state::get();
+  state.track(texture, texture_memory_state::current_category());
+}
+
+inline void untrack_texture(SDL_Texture* texture) noexcept
+{
+  texture_memory_state::get().untrack(texture);
+}
+
+}  // namespace detail
+/// \endcond
+
+/**
+ * \class texture_category_scope
+ *
+ * \brief Assigns a category to all textures created by the current thread in a scope.
+ *
+ * \details Scopes can be nested, the innermost scope takes precedence. Textures created
+ * outside of any scope, or in a `general` scope, are categorized by their texture access.
+ * \code{cpp}
+ *   {
+ *     const cen::texture_category_scope scope{cen::texture_category::user};
+ *     cen::texture background{renderer, "background.png"};  // Accounted as "user"
+ *   }
+ * \endcode
+ *
+ * \since 6.1.0
+ */
+class texture_category_scope final
+{
+ public:
+  /**
+   * \brief Makes a category the current category of the calling thread.
+   *
+   * \param category the category of textures created in the scope.
+   *
+   * \since 6.1.0
+   */
+  explicit texture_category_scope(const texture_category category) noexcept
+      : m_previous{detail::texture_memory_state::current_category()}
+  {
+    detail::texture_memory_state::current_category() = category;
+  }
+
+  texture_category_scope(const texture_category_scope&) = delete;
+
+  auto operator=(const texture_category_scope&) -> texture_category_scope& = delete;
+
+  /// Restores the previous category of the calling thread.
+  ~texture_category_scope() noexcept
+  {
+    detail::texture_memory_state::current_category() = m_previous;
+  }
+
+ private:
+  texture_category m_previous;
+};
+
+/**
+ * \namespace cen::texture_memory
+ *
+ * \brief Provides the accounting of the memory used by owning textures.
+ *
+ * \details Every owning texture registers its memory when it's created, and unregisters
+ * it when it's destroyed or released. The memory can be limited with a budget, in which
+ * case a callback is notified whenever a new texture exceeds it. The callback can then
+ * free memory, e.g. with `texture_pool::trim_to_budget()` and
+ * `font_cache::trim_string_cache_to_budget()`.
+ * \code{cpp}
+ *   cen::texture_memory::set_budget(64'000'000, [](std::size_t used, std::size_t) {
+ *     cen::log::warn("Texture memory usage exceeds budget: %zu", used);
+ *   });
+ * \endcode
+ *
+ * \note All of the functions in this namespace are thread-safe.
+ *
+ * \since 6.1.0
+ */
+namespace texture_memory {
+
+/**
+ * \brief Returns the memory used by all owning textures.
+ *
+ * \return the total texture memory usage.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto usage() -> texture_memory_usage
+{
+  return detail::texture_memory_state::get().usage();
+}
+
+/**
+ * \brief Returns the memory used by the owning textures in a category.
+ *
+ * \param category the category that will be queried.
+ *
+ * \return the texture memory usage of the category.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto usage(const texture_category category) -> texture_memory_usage
+{
+  return detail::texture_memory_state::get().usage(category);
+}
+
+/**
+ * \brief Resets the high-water marks to the current usage.
+ *
+ * \since 6.1.0
+ */
+inline void reset_peaks()
+{
+  detail::texture_memory_state::get().reset_peaks();
+}
+
+/**
+ * \brief Sets the texture memory budget.
+ *
+ * \details The callback is invoked on the thread that created a texture, after the
+ * texture pushed the memory usage above the budget. The callback is invoked for every
+ * such texture, until the usage is within the budget again.
+ *
+ * \note The callback must not throw, and is invoked while the new texture is being
+ * constructed, i.e. it must not destroy the texture that exceeded the budget.
+ *
+ * \param bytes the budget in bytes, zero means no budget.
+ * \param callback the function object that will be invoked, can be null.
+ *
+ * \since 6.1.0
+ */
+inline void set_budget(const std::size_t bytes, texture_budget_callback callback = {})
+{
+  detail::texture_memory_state::get().set_budget(bytes, std::move(callback));
+}
+
+/**
+ * \brief Returns the texture memory budget.
+ *
+ * \return the budget in bytes; zero if there is no budget.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto budget() -> std::size_t
+{
+  return detail::texture_memory_state::get().budget();
+}
+
+/**
+ * \brief Indicates whether or not the texture memory usage exceeds the budget.
+ *
+ * \return `true` if there is a budget and it's exceeded; `false` otherwise.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto over_budget() -> bool
+{
+  const auto limit = budget();
+  return limit != 0 && usage().bytes > limit;
+}
+
+}  // namespace texture_memory
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_MEMORY_HEADER
@@ -0,0 +1,463 @@
+#ifndef CENTURION_TEXTURE_POOL_HEADER
+#define CENTURION_TEXTURE_POOL_HEADER
+
+#include <SDL.h>
+
+#include <cassert>   // assert
+#include <cstddef>   // size_t, ptrdiff_t
+#include <optional>  // optional
+#include <utility>   // move, exchange
+#include <vector>    // vector
+
+#include "../math/area.hpp"
+#include "blend_mode.hpp"
+#include "colors.hpp"
+#include "pixel_format.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "texture_memory.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class texture_pool
+ *
+ * \brief Recycles textures by pixel format, texture access and size.
+ *
+ * \details Creating textures is expensive with several render backends, which makes it
+ * wasteful to create and destroy intermediate textures, e.g. render targets used by
+ * post-processing passes, every frame. Textures obtained from a pool are handed out as
+ * leases, which return the texture to the pool when they are destroyed, so that
+ * subsequent requests for an equivalent texture reuse it.
+ *
+ * \details Idle textures are kept until `trim()` is called, which destroys the idle
+ * textures that were returned the longest time ago.
+ * \code{cpp}
+ *   cen::texture_pool pool;
+ *
+ *   {
+ *     auto target = pool.acquire(renderer,
+ *                                cen::pixel_format::rgba8888,
+ *                                cen::texture_access::target,
+ *                                {512, 512});
+ *     renderer.set_target(*target);
+ *     // ...
+ *   }
+ *
+ *   pool.trim(8);  // Keep at most eight idle textures
+ * \endcode
+ *
+ * \note The pool must outlive all of its leases.
+ *
+ * \note The blend mode, color and alpha modulation of returned textures are reset, but
+ * their pixels are not, i.e. an acquired texture has undefined contents.
+ *
+ * \since 6.1.0
+ */
+class texture_pool final
+{
+ public:
+  /**
+   * \struct key_type
+   *
+   * \brief Describes the properties that the pool uses to match textures.
+   *
+   * \since 6.1.0
+   */
+  struct key_type final
+  {
+    pixel_format format{};
+    texture_access access{};
+    iarea size{};
+
+    [[nodiscard]] auto operator==(const key_type& other) const noexcept -> bool
+    {
+      return format == other.format && access == other.access && size == other.size;
+    }
+  };
+
+  /**
+   * \class lease
+   *
+   * \brief Provides temporary ownership of a pooled texture.
+   *
+   * \details The texture is returned to the pool when the lease is destroyed, unless it
+   * has been released from the pool with `release()`.
+   *
+   * \since 6.1.0
+   */
+  class lease final
+  {
+   public:
+    lease(const lease&) = delete;
+
+    auto operator=(const lease&) -> lease& = delete;
+
+    lease(lease&& other) noexcept
+        : m_pool{std::exchange(other.m_pool, nullptr)}
+        , m_key{other.m_key}
+        , m_texture{std::move(other.m_texture)}
+    {
+      other.m_texture.reset();
+    }
+
+    auto operator=(lease&& other) noexcept -> lease&
+    {
+      if (this != &other)
+      {
+        give_back();
+
+        m_pool = std::exchange(other.m_pool, nullptr);
+        m_key = other.m_key;
+        m_texture = std::move(other.m_texture);
+        other.m_texture.reset();
+      }
+
+      return *this;
+    }
+
+    /**
+     * \brief Returns the texture to the pool.
+     *
+     * \since 6.1.0
+     */
+    ~lease() noexcept
+    {
+      give_back();
+    }
+
+    /**
+     * \brief Takes ownership of the texture, which will not be returned to the pool.
+     *
+     * \pre The lease must hold a texture.
+     *
+     * \return the leased texture.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto release() -> texture
+    {
+      assert(m_texture);
+
+      auto result = std::move(*m_texture);
+      m_texture.reset();
+
+      if (m_pool)
+      {
+        --m_pool->m_leased;
+        m_pool = nullptr;
+      }
+
+      return result;
+    }
+
+    /**
+     * \brief Returns the leased texture.
+     *
+     * \pre The lease must hold a texture.
+     *
+     * \return the leased texture.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto get() noexcept -> texture&
+    {
+      assert(m_texture);
+      return *m_texture;
+    }
+
+    /// \copydoc get()
+    [[nodiscard]] auto get() const noexcept -> const texture&
+    {
+      assert(m_texture);
+      return *m_texture;
+    }
+
+    [[nodiscard]] auto operator*() noexcept -> texture&
+    {
+      return get();
+    }
+
+    [[nodiscard]] auto operator*() const noexcept -> const texture&
+    {
+      return get();
+    }
+
+    [[nodiscard]] auto operator->() noexcept -> texture*
+    {
+      return &get();
+    }
+
+    [[nodiscard]] auto operator->() const noexcept -> const texture*
+    {
+      return &get();
+    }
+
+    /**
+     * \brief Returns the properties of the leased texture.
+     *
+     * \return the pool key of the texture.
+     *
+     * \since 6.1.0
+     */
+    [[nodiscard]] auto key() const noexcept -> const key_type&
+    {
+      return m_key;
+    }
+
+    /**
+     * \brief Indicates whether or not the lease holds a texture.
+     *
+     * \return `true` if the lease holds a texture; `false` if it was moved from or
+     * released.
+     *
+     * \since 6.1.0
+     */
+    explicit operator bool() const noexcept
+    {
+      return m_texture.has_value();
+    }
+
+   private:
+    friend class texture_pool;
+
+    texture_pool* m_pool{};
+    key_type m_key;
+    std::optional<texture> m_texture;
+
+    lease(texture_pool& pool, const key_type& key, texture&& leased) noexcept
+        : m_pool{&pool}
+        , m_key{key}
+        , m_texture{std::move(leased)}
+    {}
+
+    void give_back() noexcept
+    {
+      if (m_pool && m_texture)
+      {
+        m_pool->give_back(m_key, std::move(*m_texture));
+      }
+
+      m_texture.reset();
+      m_pool = nullptr;
+    }
+  };
+
+  texture_pool() = default;
+
+  texture_pool(const texture_pool&) = delete;
+
+  auto operator=(const texture_pool&) -> texture_pool& = delete;
+
+  /**
+   * \brief Returns a texture with the specified properties.
+   *
+   * \details An idle texture is reused if there is one with the same properties,
+   * otherwise a new texture is created.
+   *
+   * \tparam Renderer the type of the renderer, e.g. `renderer` or `renderer_handle`.
+   *
+   * \param renderer the renderer used to create a texture, if necessary. The pool should
+   * only be used with a single renderer.
+   * \param format the pixel format of the texture.
+   * \param access the texture access of the texture.
+   * \param size the size of the texture.
+   *
+   * \return a lease of the texture.
+   *
+   * \throws sdl_error if a new texture couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename Renderer>
+  [[nodiscard]] auto acquire(const Renderer& renderer,
+                             const pixel_format format,
+                             const texture_access access,
+                             const iarea size) -> lease
+  {
+    const key_type key{format, access, size};
+
+    // Search from the back, to reuse the most recently returned texture
+    for (auto index = m_idle.size(); index > 0; --index)
+    {
+      auto& entry = m_idle[index - 1u];
+      if (entry.key == key)
+      {
+        auto reused = std::move(entry.texture);
+        m_idle.erase(m_idle.begin() + static_cast<std::ptrdiff_t>(index - 1u));
+
+        ++m_leased;
+        ++m_reused;
+        return lease{*this, key, std::move(reused)};
+      }
+    }
+
+    texture created{renderer, format, access, size};
+
+    ++m_leased;
+    ++m_created;
+    return lease{*this, key, std::move(created)};
+  }
+
+  /**
+   * \brief Destroys idle textures, starting with those returned the longest time ago.
+   *
+   * \param keep the maximum amount of idle textures that will be kept.
+   *
+   * \return the amount of destroyed textures.
+   *
+   * \since 6.1.0
+   */
+  auto trim(const std::size_t keep = 0) noexcept -> std::size_t
+  {
+    if (m_idle.size() <= keep)
+    {
+      return 0;
+    }
+
+    const auto count = m_idle.size() - keep;
+    m_idle.erase(m_idle.begin(), m_idle.begin() + static_cast<std::ptrdiff_t>(count));
+
+    return count;
+  }
+
+  /**
+   * \brief Destroys idle textures until the texture memory budget is met.
+   *
+   * \details Idle textures are destroyed in the same order as with `trim()`. This is
+   * intended to be used by a texture memory budget callback, see
+   * `texture_memory::set_budget()`.
+   *
+   * \return the amount of destroyed textures.
+   *
+   * \since 6.1.0
+   */
+  auto trim_to_budget() -> std::size_t
+  {
+    std::size_t count = 0;
+    while (!m_idle.empty() && texture_memory::over_budget())
+    {
+      m_idle.erase(m_idle.begin());
+      ++count;
+    }
+
+    return count;
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of textures that are waiting to be reused.
+   *
+   * \return the amount of idle textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto idle_count() const noexcept -> std::size_t
+  {
+    return m_idle.size();
+  }
+
+  /**
+   * \brief Returns the amount of textures that are currently leased.
+   *
+   * \details Textures that have been released from their leases are not included.
+   *
+   * \return the amount of leased textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto leased_count() const noexcept -> std::size_t
+  {
+    return m_leased;
+  }
+
+  /**
+   * \brief Returns the amount of textures that have been created by the pool.
+   *
+   * \return the total amount of created textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto created_count() const noexcept -> std::size_t
+  {
+    return m_created;
+  }
+
+  /**
+   * \brief Returns the amount of requests that were served by an idle texture.
+   *
+   * \return the total amount of reused textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto reused_count() const noexcept -> std::size_t
+  {
+    return m_reused;
+  }
+
+  /**
+   * \brief Returns the memory used by the idle textures.
+   *
+   * \return the memory used by the idle textures, in bytes.
+   *
+   * \see `texture_memory_usage`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto idle_bytes() const noexcept -> std::size_t
+  {
+    std::size_t bytes = 0;
+    for (const auto& entry : m_idle)
+    {
+      const auto& key = entry.key;
+      bytes += detail::texture_bytes(to_underlying(key.format),
+                                     key.size.width,
+                                     key.size.height);
+    }
+
+    return bytes;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct idle_texture final
+  {
+    key_type key;
+    cen::texture texture;
+  };
+
+  std::vector<idle_texture> m_idle;  // Ordered by the time the textures were returned
+  std::size_t m_leased{};
+  std::size_t m_created{};
+  std::size_t m_reused{};
+
+  void give_back(const key_type& key, texture&& returned) noexcept
+  {
+    returned.set_blend_mode(blend_mode::none);
+    returned.set_color_mod(colors::white);
+    returned.set_alpha(0xFF);
+
+    --m_leased;
+
+    try
+    {
+      m_idle.push_back({key, std::move(returned)});
+    }
+    catch (...)
+    {
+      // The texture is simply destroyed if it can't be stored
+    }
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TEXTURE_POOL_HEADER
@@ -0,0 +1,462 @@
+#ifndef CENTURION_TILEMAP_RENDERER_HEADER
+#define CENTURION_TILEMAP_RENDERER_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // max, min
+#include <cassert>    // assert
+#include <cmath>      // floor, ceil
+#include <cstddef>    // size_t
+#include <optional>   // optional
+#include <vector>     // vector
+
+#include "../core/exception.hpp"
+#include "../core/integers.hpp"
+#include "../detail/render_target_scope.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "../math/rect.hpp"
+#include "blend_mode.hpp"
+#include "colors.hpp"
+#include "pixel_format.hpp"
+#include "renderer.hpp"
+#include "texture.hpp"
+#include "texture_access.hpp"
+#include "texture_pool.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class tilemap_renderer
+ *
+ * \brief Renders a large tile map as a grid of baked chunk textures.
+ *
+ * \details Rendering every tile of a map with its own render call scales with the amount
+ * of tiles on the screen. This class instead divides the map into square chunks of
+ * tiles, which are rendered once into target textures that are leased from a texture
+ * pool. Every frame, only the chunks that intersect the viewport are drawn, with one
+ * render call per chunk. Changing a tile marks its chunk as dirty, and dirty chunks are
+ * rendered again, i.e. baked, the next time they're visible.
+ * \code{cpp}
+ *   cen::tilemap_renderer map{tileset, {16, 16}, {1024, 1024}};
+ *   map.set_tile({3, 7}, 42);
+ *
+ *   // Every frame
+ *   renderer.set_translation_viewport(camera);
+ *   map.render(renderer, pool);
+ * \endcode
+ *
+ * \details Tiles are identified by their one-based index in the tileset, in row-major
+ * order, where zero denotes an empty tile. Since the tiles of a chunk don't overlap,
+ * they are baked without blending, which preserves their alpha values, and the chunks
+ * are then rendered with alpha blending.
+ *
+ * \note The tileset must outlive the tilemap renderer. Call `invalidate()` if the pixels
+ * of the tileset change.
+ *
+ * \since 6.1.0
+ */
+class tilemap_renderer final
+{
+ public:
+  using tile_type = u32;
+  using size_type = std::size_t;
+
+  /// The tile that denotes an empty cell.
+  inline constexpr static tile_type empty_tile = 0;
+
+  /**
+   * \brief Creates a tile map where all cells are empty.
+   *
+   * \tparam T the ownership tag of the tileset.
+   *
+   * \param tileset the texture that contains the tiles, in rows.
+   * \param tileSize the size of each tile, in pixels.
+   * \param size the size of the map, in tiles.
+   * \param chunkSize the width and height of the chunks, in tiles.
+   *
+   * \throws cen_error if any of the sizes isn't positive, or if the tileset is smaller
+   * than a tile.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  tilemap_renderer(const basic_texture<T>& tileset,
+                   const iarea tileSize,
+                   const iarea size,
+                   const int chunkSize = 16)
+      : m_tileset{tileset.get()}
+      , m_tileSize{tileSize}
+      , m_size{size}
+      , m_chunkSize{chunkSize}
+  {
+    if (tileSize.width <= 0 || tileSize.height <= 0 || size.width <= 0 ||
+        size.height <= 0 || chunkSize <= 0)
+    {
+      throw cen_error{"Tile map sizes must be positive!"};
+    }
+
+    m_columns = tileset.width() / tileSize.width;
+    if (m_columns == 0 || tileset.height() < tileSize.height)
+    {
+      throw cen_error{"Tileset is smaller than a tile!"};
+    }
+
+    m_chunkColumns = (size.width + chunkSize - 1) / chunkSize;
+    m_chunkRows = (size.height + chunkSize - 1) / chunkSize;
+
+    const auto width = static_cast<size_type>(size.width);
+    m_tiles.assign(width * static_cast<size_type>(size.height), empty_tile);
+    m_chunks.resize(static_cast<size_type>(m_chunkColumns) *
+                    static_cast<size_type>(m_chunkRows));
+  }
+
+  /// \name Tiles
+  /// \{
+
+  /**
+   * \brief Changes a tile, and marks its chunk as dirty if the tile changed.
+   *
+   * \pre The position must be inside the map.
+   *
+   * \param position the position of the cell, in tiles.
+   * \param tile the new tile, which must be in the tileset, or `empty_tile`.
+   *
+   * \since 6.1.0
+   */
+  void set_tile(const ipoint position, const tile_type tile) noexcept
+  {
+    auto& cell = m_tiles[tile_index(position)];
+    if (cell != tile)
+    {
+      cell = tile;
+      chunk_at(position.x() / m_chunkSize, position.y() / m_chunkSize).dirty = true;
+    }
+  }
+
+  /**
+   * \brief Returns the tile in a cell.
+   *
+   * \pre The position must be inside the map.
+   *
+   * \param position the position of the cell, in tiles.
+   *
+   * \return the tile in the cell; `empty_tile` if the cell is empty.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto tile(const ipoint position) const noexcept -> tile_type
+  {
+    return m_tiles[tile_index(position)];
+  }
+
+  /**
+   * \brief Marks all chunks as dirty, e.g. after the tileset has been modified.
+   *
+   * \since 6.1.0
+   */
+  void invalidate() noexcept
+  {
+    for (auto& chunk : m_chunks)
+    {
+      chunk.dirty = true;
+    }
+  }
+
+  /// \} End of tiles
+
+  /// \name Rendering
+  /// \{
+
+  /**
+   * \brief Renders the chunks that intersect a viewport.
+   *
+   * \details Visible chunks without a texture lease a target texture from the pool, and
+   * are baked along with the visible dirty chunks. The render target of the renderer is
+   * restored after baking.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that is used to bake and render the chunks.
+   * \param pool the pool that provides the chunk textures, which must outlive the leases,
+   * see `release_hidden()`.
+   * \param viewport the area of the map that is rendered to the top-left corner of the
+   * render target, in pixels.
+   *
+   * \throws sdl_error if a chunk texture couldn't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  void render(basic_renderer<T>& renderer, texture_pool& pool, const frect& viewport)
+  {
+    ++m_frame;
+    m_drawn = 0;
+    m_baked = 0;
+
+    const auto chunkWidth = static_cast<float>(m_chunkSize * m_tileSize.width);
+    const auto chunkHeight = static_cast<float>(m_chunkSize * m_tileSize.height);
+
+    const auto first = [](const float value, const float size) {
+      return static_cast<int>(std::floor(value / size));
+    };
+
+    const auto last = [](const float value, const float size) {
+      return static_cast<int>(std::ceil(value / size));
+    };
+
+    const auto minX = (std::max)(0, first(viewport.x(), chunkWidth));
+    const auto minY = (std::max)(0, first(viewport.y(), chunkHeight));
+    const auto maxX = (std::min)(m_chunkColumns, last(viewport.max_x(), chunkWidth));
+    const auto maxY = (std::min)(m_chunkRows, last(viewport.max_y(), chunkHeight));
+
+    for (auto y = minY; y < maxY; ++y)
+    {
+      for (auto x = minX; x < maxX; ++x)
+      {
+        auto& chunk = chunk_at(x, y);
+        if (!chunk.texture || chunk.dirty)
+        {
+          bake(renderer, pool, chunk, x, y);
+        }
+
+        const frect destination{static_cast<float>(x) * chunkWidth - viewport.x(),
+                                static_cast<float>(y) * chunkHeight - viewport.y(),
+                                chunkWidth,
+                                chunkHeight};
+        renderer.render(chunk.texture->get(), destination);
+
+        chunk.lastDrawn = m_frame;
+        ++m_drawn;
+      }
+    }
+  }
+
+  /**
+   * \brief Renders the chunks that intersect the translation viewport of a renderer.
+   *
+   * \param renderer the renderer that is used to bake and render the chunks.
+   * \param pool the pool that provides the chunk textures.
+   *
+   * \throws sdl_error if a chunk texture couldn't be created.
+   *
+   * \see `basic_renderer::set_translation_viewport()`
+   *
+   * \since 6.1.0
+   */
+  void render(renderer& renderer, texture_pool& pool)
+  {
+    render(renderer, pool, renderer.translation_viewport());
+  }
+
+  /**
+   * \brief Returns the textures of chunks that weren't drawn by the last render call.
+   *
+   * \details The chunks are baked again once they become visible. This is useful to
+   * bound the texture memory used by very large maps, e.g. when the camera moves far.
+   *
+   * \return the amount of returned textures.
+   *
+   * \since 6.1.0
+   */
+  auto release_hidden() noexcept -> size_type
+  {
+    size_type count = 0;
+    for (auto& chunk : m_chunks)
+    {
+      if (chunk.texture && chunk.lastDrawn != m_frame)
+      {
+        chunk.texture.reset();
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /// \} End of rendering
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the amount of chunks drawn by the last render call.
+   *
+   * \return the amount of render calls made for the last frame.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto drawn_chunks() const noexcept -> size_type
+  {
+    return m_drawn;
+  }
+
+  /**
+   * \brief Returns the amount of chunks baked by the last render call.
+   *
+   * \return the amount of chunks that were rendered into their textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto baked_chunks() const noexcept -> size_type
+  {
+    return m_baked;
+  }
+
+  /**
+   * \brief Returns the amount of chunks that currently hold a texture.
+   *
+   * \return the amount of leased chunk textures.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto cached_chunks() const noexcept -> size_type
+  {
+    size_type count = 0;
+    for (const auto& chunk : m_chunks)
+    {
+      count += chunk.texture ? 1u : 0u;
+    }
+
+    return count;
+  }
+
+  /**
+   * \brief Returns the size of the map.
+   *
+   * \return the size of the map, in tiles.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  [[nodiscard]] auto tile_size() const noexcept -> iarea
+  {
+    return m_tileSize;
+  }
+
+  [[nodiscard]] auto chunk_size() const noexcept -> int
+  {
+    return m_chunkSize;
+  }
+
+  [[nodiscard]] auto chunk_count() const noexcept -> size_type
+  {
+    return m_chunks.size();
+  }
+
+  /// \} End of queries
+
+ private:
+  struct chunk final
+  {
+    std::optional<texture_pool::lease> texture;
+    u64 lastDrawn{};
+    bool dirty{true};
+  };
+
+  SDL_Texture* m_tileset{};
+  iarea m_tileSize;
+  iarea m_size;
+  int m_chunkSize{};
+  int m_columns{};  // The amount of tiles in each row of the tileset
+  int m_chunkColumns{};
+  int m_chunkRows{};
+  std::vector<tile_type> m_tiles;
+  std::vector<chunk> m_chunks;
+  u64 m_frame{};
+  size_type m_drawn{};
+  size_type m_baked{};
+
+  [[nodiscard]] auto tile_index(const ipoint position) const noexcept -> size_type
+  {
+    assert(position.x() >= 0 && position.x() < m_size.width);
+    assert(position.y() >= 0 && position.y() < m_size.height);
+
+    return static_cast<size_type>(position.y()) * static_cast<size_type>(m_size.width) +
+           static_cast<size_type>(position.x());
+  }
+
+  [[nodiscard]] auto chunk_at(const int x, const int y) noexcept -> chunk&
+  {
+    return m_chunks[static_cast<size_type>(y) * static_cast<size_type>(m_chunkColumns) +
+                    static_cast<size_type>(x)];
+  }
+
+  template <typename T>
+  void bake(basic_renderer<T>& renderer,
+            texture_pool& pool,
+            chunk& chunk,
+            const int chunkX,
+            const int chunkY)
+  {
+    if (!chunk.texture)
+    {
+      const iarea size{m_chunkSize * m_tileSize.width, m_chunkSize * m_tileSize.height};
+      chunk.texture.emplace(pool.acquire(renderer,
+                                         pixel_format::rgba8888,
+                                         texture_access::target,
+                                         size));
+      chunk.texture->get().set_blend_mode(blend_mode::blend);
+    }
+
+    const detail::render_target_scope scope{renderer, chunk.texture->get()};
+    if (!scope.is_active())
+    {
+      return;  // The chunk stays dirty, so baking is attempted again next frame
+    }
+
+    renderer.clear_with(colors::transparent);
+
+    // The tiles of a chunk don't overlap, so they're copied without blending
+    texture_handle tileset{m_tileset};
+    const auto tilesetBlending = tileset.get_blend_mode();
+    tileset.set_blend_mode(blend_mode::none);
+
+    const auto firstX = chunkX * m_chunkSize;
+    const auto firstY = chunkY * m_chunkSize;
+    const auto lastX = (std::min)(firstX + m_chunkSize, m_size.width);
+    const auto lastY = (std::min)(firstY + m_chunkSize, m_size.height);
+
+    for (auto y = firstY; y < lastY; ++y)
+    {
+      for (auto x = firstX; x < lastX; ++x)
+      {
+        const auto tile = m_tiles[tile_index({x, y})];
+        if (tile == empty_tile)
+        {
+          continue;
+        }
+
+        const auto index = static_cast<int>(tile - 1u);
+        const irect source{(index % m_columns) * m_tileSize.width,
+                           (index / m_columns) * m_tileSize.height,
+                           m_tileSize.width,
+                           m_tileSize.height};
+        const irect destination{(x - firstX) * m_tileSize.width,
+                                (y - firstY) * m_tileSize.height,
+                                m_tileSize.width,
+                                m_tileSize.height};
+
+        renderer.render(tileset, source, destination);
+      }
+    }
+
+    tileset.set_blend_mode(tilesetBlending);
+
+    chunk.dirty = false;
+    ++m_baked;
+  }
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_TILEMAP_RENDERER_HEADER
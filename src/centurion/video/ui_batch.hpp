@@ -0,0 +1,350 @@
+#ifndef CENTURION_UI_BATCH_HEADER
+#define CENTURION_UI_BATCH_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>  // min
+#include <cstddef>    // size_t
+
+#include "../core/result.hpp"
+#include "../math/rect.hpp"
+#include "color.hpp"
+#include "colors.hpp"
+#include "renderer.hpp"
+#include "sprite_batch.hpp"
+#include "texture.hpp"
+
+namespace cen {
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \struct nine_slice
+ *
+ * \brief Describes a scalable panel image, whose corners keep their size.
+ *
+ * \details The source cutout is split into nine cells by the insets. The corners are
+ * rendered at their original size, the edges are stretched along one axis, and the
+ * center is stretched along both axes.
+ *
+ * \see `ui_batch`
+ *
+ * \since 6.1.0
+ */
+struct nine_slice final
+{
+  irect source;  ///< The cutout of the entire panel image.
+  int left{};    ///< The width of the left border, in pixels.
+  int top{};     ///< The height of the top border, in pixels.
+  int right{};   ///< The width of the right border, in pixels.
+  int bottom{};  ///< The height of the bottom border, in pixels.
+};
+
+/**
+ * \class ui_batch
+ *
+ * \brief Batches the panels, images, borders and fills of a user interface.
+ *
+ * \details All primitives are added as quads to a sprite batch, using a single texture
+ * atlas. Untextured primitives, i.e. fills, gradients and borders, use a white cutout of
+ * the atlas, which is tinted with vertex colors. As a result, an entire tree of panels
+ * that only uses the atlas is rendered with a single geometry call, instead of nine
+ * render calls per panel plus a draw call for every border.
+ * \code{cpp}
+ *   cen::ui_batch ui{atlas, whiteCutout};
+ *
+ *   ui.add_panel(windowSlice, {{20, 20}, {300, 200}});
+ *   ui.fill_gradient({{24, 24}, {292, 24}}, cen::colors::navy, cen::colors::royal_blue);
+ *   ui.draw_border({{40, 60}, {120, 32}}, 2, cen::colors::gold);
+ *   ui.add_image(iconSource, {{44, 64}, {24, 24}});
+ *
+ *   ui.submit(renderer);
+ * \endcode
+ *
+ * \note The white cutout should be at least 3x3 pixels, since its border pixels aren't
+ * sampled, which avoids bleeding of neighbouring pixels of the atlas due to filtering.
+ *
+ * \see `sprite_batch`
+ *
+ * \since 6.1.0
+ */
+class ui_batch final
+{
+ public:
+  /**
+   * \brief Creates an empty UI batch.
+   *
+   * \tparam T the ownership tag of the texture.
+   *
+   * \param atlas the texture that the primitives are rendered with, which must outlive
+   * the batch.
+   * \param white a cutout of the atlas that only contains opaque white pixels.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  ui_batch(const basic_texture<T>& atlas, const irect& white) noexcept
+      : m_atlas{atlas.get()}
+      , m_white{inner_cutout(white)}
+  {}
+
+  /// \name Primitives
+  /// \{
+
+  /**
+   * \brief Adds a nine-slice panel.
+   *
+   * \details If the destination is smaller than the borders, the borders are shrunk
+   * proportionally, so that the panel never overlaps itself.
+   *
+   * \param slice the panel image.
+   * \param destination the position and size of the panel.
+   * \param tint the color and alpha that will be multiplied with the panel.
+   *
+   * \since 6.1.0
+   */
+  void add_panel(const nine_slice& slice,
+                 const frect& destination,
+                 const color& tint = colors::white)
+  {
+    const auto& src = slice.source;
+
+    const int srcXs[] = {src.x(),
+                         src.x() + slice.left,
+                         src.max_x() - slice.right,
+                         src.max_x()};
+    const int srcYs[] = {src.y(),
+                         src.y() + slice.top,
+                         src.max_y() - slice.bottom,
+                         src.max_y()};
+
+    const auto [left, right] = fit_borders(static_cast<float>(slice.left),
+                                           static_cast<float>(slice.right),
+                                           destination.width());
+    const auto [top, bottom] = fit_borders(static_cast<float>(slice.top),
+                                           static_cast<float>(slice.bottom),
+                                           destination.height());
+
+    const float dstXs[] = {destination.x(),
+                           destination.x() + left,
+                           destination.max_x() - right,
+                           destination.max_x()};
+    const float dstYs[] = {destination.y(),
+                           destination.y() + top,
+                           destination.max_y() - bottom,
+                           destination.max_y()};
+
+    for (int row = 0; row < 3; ++row)
+    {
+      for (int column = 0; column < 3; ++column)
+      {
+        const irect cellSource{srcXs[column],
+                               srcYs[row],
+                               srcXs[column + 1] - srcXs[column],
+                               srcYs[row + 1] - srcYs[row]};
+        const frect cellDestination{dstXs[column],
+                                    dstYs[row],
+                                    dstXs[column + 1] - dstXs[column],
+                                    dstYs[row + 1] - dstYs[row]};
+
+        if (cellSource.has_area() && cellDestination.has_area())
+        {
+          m_batch.add(m_atlas, cellSource, cellDestination, tint);
+        }
+      }
+    }
+  }
+
+  /**
+   * \brief Adds an image from the atlas.
+   *
+   * \param source the cutout of the atlas that will be rendered.
+   * \param destination the position and size of the image.
+   * \param tint the color and alpha that will be multiplied with the image.
+   *
+   * \since 6.1.0
+   */
+  void add_image(const irect& source,
+                 const frect& destination,
+                 const color& tint = colors::white)
+  {
+    m_batch.add(m_atlas, source, destination, tint);
+  }
+
+  /**
+   * \brief Adds a filled rectangle.
+   *
+   * \param rect the rectangle that will be filled.
+   * \param fill the color of the rectangle.
+   *
+   * \since 6.1.0
+   */
+  void fill_rect(const frect& rect, const color& fill)
+  {
+    m_batch.add(m_atlas, m_white, rect, fill);
+  }
+
+  /**
+   * \brief Adds a rectangle that is filled with a gradient between its corners.
+   *
+   * \param rect the rectangle that will be filled.
+   * \param fill the colors of the corners of the rectangle.
+   *
+   * \since 6.1.0
+   */
+  void fill_gradient(const frect& rect, const corner_colors& fill)
+  {
+    m_batch.add(m_atlas, m_white, rect, fill);
+  }
+
+  /**
+   * \brief Adds a rectangle that is filled with a vertical gradient.
+   *
+   * \param rect the rectangle that will be filled.
+   * \param top the color of the top edge.
+   * \param bottom the color of the bottom edge.
+   *
+   * \since 6.1.0
+   */
+  void fill_gradient(const frect& rect, const color& top, const color& bottom)
+  {
+    fill_gradient(rect, {top, top, bottom, bottom});
+  }
+
+  /**
+   * \brief Adds the border of a rectangle.
+   *
+   * \details The border is drawn inside the rectangle, with four quads that don't
+   * overlap, so translucent borders have an even alpha.
+   *
+   * \param rect the outer bounds of the border.
+   * \param thickness the width of the border.
+   * \param tint the color of the border.
+   *
+   * \since 6.1.0
+   */
+  void draw_border(const frect& rect, const float thickness, const color& tint)
+  {
+    const auto horizontal = (std::min)(thickness, rect.height() * 0.5f);
+    const auto vertical = (std::min)(thickness, rect.width() * 0.5f);
+    const auto innerHeight = rect.height() - 2 * horizontal;
+
+    fill_rect({rect.x(), rect.y(), rect.width(), horizontal}, tint);
+    fill_rect({rect.x(), rect.max_y() - horizontal, rect.width(), horizontal}, tint);
+
+    if (innerHeight > 0)
+    {
+      const auto y = rect.y() + horizontal;
+      fill_rect({rect.x(), y, vertical, innerHeight}, tint);
+      fill_rect({rect.max_x() - vertical, y, vertical, innerHeight}, tint);
+    }
+  }
+
+  /// \} End of primitives
+
+  /**
+   * \brief Renders all primitives and clears the batch.
+   *
+   * \tparam T the ownership tag of the renderer.
+   *
+   * \param renderer the renderer that will be used.
+   *
+   * \return `success` if all primitives were rendered; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  auto submit(basic_renderer<T>& renderer) noexcept -> result
+  {
+    return m_batch.submit(renderer);
+  }
+
+  /**
+   * \brief Removes all primitives from the batch, the allocated memory is kept.
+   *
+   * \since 6.1.0
+   */
+  void clear() noexcept
+  {
+    m_batch.clear();
+  }
+
+  /**
+   * \brief Returns the sprite batch that holds the quads of the primitives.
+   *
+   * \details Sprites from other textures can be added between primitives, at the cost
+   * of additional runs, e.g. in order to render text on top of a panel.
+   *
+   * \return the underlying sprite batch.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto batch() noexcept -> sprite_batch&
+  {
+    return m_batch;
+  }
+
+  /**
+   * \brief Returns the amount of quads in the batch.
+   *
+   * \return the amount of batched quads.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> std::size_t
+  {
+    return m_batch.size();
+  }
+
+  [[nodiscard]] auto run_count() const noexcept -> std::size_t
+  {
+    return m_batch.run_count();
+  }
+
+ private:
+  struct border_pair final
+  {
+    float first{};
+    float second{};
+  };
+
+  texture_handle m_atlas;
+  irect m_white;
+  sprite_batch m_batch;
+
+  [[nodiscard]] static auto inner_cutout(const irect& cutout) noexcept -> irect
+  {
+    if (cutout.width() >= 3 && cutout.height() >= 3)
+    {
+      return {cutout.x() + 1, cutout.y() + 1, cutout.width() - 2, cutout.height() - 2};
+    }
+
+    return cutout;
+  }
+
+  // Shrinks two opposite borders proportionally, so that they fit in the length
+  [[nodiscard]] static auto fit_borders(const float first,
+                                        const float second,
+                                        const float length) noexcept -> border_pair
+  {
+    const auto total = first + second;
+    if (total <= length || total <= 0)
+    {
+      return {first, second};
+    }
+
+    const auto scale = (length > 0) ? length / total : 0.0f;
+    return {first * scale, second * scale};
+  }
+};
+
+/// \} End of group video
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+}  // namespace cen
+
+#endif  // CENTURION_UI_BATCH_HEADER
@@ -1,13 +1,24 @@
 #ifndef CENTURION_UNICODE_STRING_HEADER
 #define CENTURION_UNICODE_STRING_HEADER
 
+#include <algorithm>         // copy, equal
 #include <cassert>           // assert
+#include <cstddef>           // size_t, ptrdiff_t
 #include <initializer_list>  // initializer_list
+#include <iterator>          // reverse_iterator
+#include <stdexcept>         // out_of_range
+#include <string_view>       // string_view
 #include <type_traits>       // is_same_v, decay_t
 #include <vector>            // vector
 
-#include "../compiler/compiler.hpp"
 #include "../core/integers.hpp"
+#include "../core/macros.hpp"
+#include "../detail/pixel_kernels.hpp"
+#include "../detail/utf8_kernels.hpp"
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+#include <memory_resource>  // memory_resource, get_default_resource
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
 
 namespace cen {
 
@@ -28,28 +39,42 @@ using unicode = u16;
  *
  * \brief Represents a null-terminated string encoded in unicode.
  *
- * \details This class is a wrapper around a `std::vector<unicode>`, that provides a
- * similar interface to that of `std::string`.
+ * \details This class provides a similar interface to that of `std::string`. Strings of
+ * up to `small_capacity - 1` glyphs are stored in an inline buffer, so short labels
+ * don't allocate any memory. Longer strings allocate their buffer from a
+ * `std::pmr::memory_resource`, which defaults to `std::pmr::get_default_resource()`,
+ * e.g. a frame arena can be supplied for strings that only live for a frame. Like the
+ * `std::pmr` containers, copies use the default resource, whereas moves keep the
+ * resource of the moved string.
+ * \code{cpp}
+ *   const auto label = cen::unicode_string::from_utf8("Hello, world!");
+ * \endcode
+ *
+ * \note Memory resources are only available if `CENTURION_HAS_STD_MEMORY_RESOURCE` is
+ * defined, otherwise longer strings use the global heap.
  */
 class unicode_string final
 {
  public:
-  using value_type = std::vector<unicode>::value_type;
+  using value_type = unicode;
+
+  using pointer = unicode*;
+  using const_pointer = const unicode*;
 
-  using pointer = std::vector<unicode>::pointer;
-  using const_pointer = std::vector<unicode>::const_pointer;
+  using reference = unicode&;
+  using const_reference = const unicode&;
 
-  using reference = std::vector<unicode>::reference;
-  using const_reference = std::vector<unicode>::const_reference;
+  using iterator = unicode*;
+  using const_iterator = const unicode*;
 
-  using iterator = std::vector<unicode>::iterator;
-  using const_iterator = std::vector<unicode>::const_iterator;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
-  using reverse_iterator = std::vector<unicode>::reverse_iterator;
-  using const_reverse_iterator = std::vector<unicode>::const_reverse_iterator;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
 
-  using size_type = std::vector<unicode>::size_type;
-  using difference_type = std::vector<unicode>::difference_type;
+  /// The capacity of the inline buffer, including the null-terminator.
+  inline constexpr static size_type small_capacity = 8;
 
   /// \name Construction
   /// \{
@@ -59,10 +84,7 @@ class unicode_string final
    *
    * \since 5.0.0
    */
-  unicode_string()
-  {
-    m_data.push_back(0);
-  }
+  unicode_string() noexcept = default;
 
   /**
    * \brief Creates a Unicode string based on the supplied values.
@@ -73,13 +95,139 @@ class unicode_string final
    */
   unicode_string(std::initializer_list<unicode> codes)
   {
-    reserve(codes.size() + 1);
-    m_data.insert(m_data.end(), codes.begin(), codes.end());
-    m_data.push_back(0);
+    assign(codes.begin(), codes.size());
   }
 
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Creates an empty Unicode string that allocates memory from a resource.
+   *
+   * \param resource the memory resource, must outlive the string.
+   *
+   * \since 6.1.0
+   */
+  explicit unicode_string(std::pmr::memory_resource* resource) noexcept
+      : m_resource{resource}
+  {
+    assert(resource);
+  }
+
+  /**
+   * \brief Creates a Unicode string that allocates memory from a resource.
+   *
+   * \param codes the list of glyphs that will be used.
+   * \param resource the memory resource, must outlive the string.
+   *
+   * \since 6.1.0
+   */
+  unicode_string(std::initializer_list<unicode> codes,
+                 std::pmr::memory_resource* resource)
+      : m_resource{resource}
+  {
+    assert(resource);
+    assign(codes.begin(), codes.size());
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  unicode_string(const unicode_string& other)
+  {
+    assign(other.data(), other.size());
+  }
+
+  unicode_string(unicode_string&& other) noexcept
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+      : m_resource{other.m_resource}
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+  {
+    steal(other);
+  }
+
+  /**
+   * \brief Creates a Unicode string from a UTF-8 encoded string.
+   *
+   * \details Runs of ASCII characters are converted with SSE2, AVX2 or NEON instructions
+   * when they are supported by the CPU, which is determined at runtime. Invalid sequences
+   * and code points that don't fit in a single `unicode` value, i.e. outside of the Basic
+   * Multilingual Plane, are decoded as the replacement character U+FFFD.
+   *
+   * \param str the UTF-8 encoded string.
+   *
+   * \return the decoded string.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto from_utf8(const std::string_view str) -> unicode_string
+  {
+    unicode_string result;
+    result.decode(str);
+    return result;
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Creates a Unicode string from a UTF-8 encoded string, that allocates memory
+   * from a resource.
+   *
+   * \param str the UTF-8 encoded string.
+   * \param resource the memory resource, must outlive the string.
+   *
+   * \return the decoded string.
+   *
+   * \see `from_utf8(std::string_view)`
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] static auto from_utf8(const std::string_view str,
+                                      std::pmr::memory_resource* resource)
+      -> unicode_string
+  {
+    unicode_string result{resource};
+    result.decode(str);
+    return result;
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
   /// \} End of construction
 
+  ~unicode_string() noexcept
+  {
+    release();
+  }
+
+  auto operator=(const unicode_string& other) -> unicode_string&
+  {
+    if (this != &other)
+    {
+      assign(other.data(), other.size());
+    }
+
+    return *this;
+  }
+
+  auto operator=(unicode_string&& other) -> unicode_string&
+  {
+    if (this != &other)
+    {
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+      // Memory can only be taken over if it can be released by our resource
+      if (!m_resource->is_equal(*other.m_resource))
+      {
+        assign(other.data(), other.size());
+        return *this;
+      }
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+      release();
+      steal(other);
+    }
+
+    return *this;
+  }
+
   /**
    * \brief Reserves enough memory to hold the specified amount of elements.
    *
@@ -87,13 +235,17 @@ class unicode_string final
    * approximate the amount of elements that will be added. This can reduce the amount of
    * unnecessary allocations and copies of the underlying array.
    *
-   * \param n the amount of elements to allocate memory for.
+   * \param n the amount of elements to allocate memory for, including the
+   * null-terminator.
    *
    * \since 5.0.0
    */
   void reserve(const size_type n)
   {
-    m_data.reserve(n);
+    if (n > m_capacity)
+    {
+      reallocate(n);
+    }
   }
 
   /**
@@ -105,7 +257,14 @@ class unicode_string final
    */
   void append(const unicode ch)
   {
-    m_data.insert(m_data.end() - 1, ch);
+    if (m_size + 2u > m_capacity)
+    {
+      const auto doubled = m_capacity * 2u;
+      reallocate((doubled > m_size + 2u) ? doubled : m_size + 2u);
+    }
+
+    m_data[m_size++] = ch;
+    m_data[m_size] = 0;
   }
 
   /**
@@ -140,11 +299,11 @@ class unicode_string final
    *
    * \since 5.0.0
    */
-  void pop_back()
+  void pop_back() noexcept
   {
     if (!empty())
     {
-      m_data.erase(m_data.end() - 2);
+      m_data[--m_size] = 0;
     }
   }
 
@@ -159,20 +318,20 @@ class unicode_string final
    */
   [[nodiscard]] auto size() const noexcept -> size_type
   {
-    return m_data.size() - 1;
+    return m_size;
   }
 
   /**
    * \brief Returns the capacity of the string.
    *
    * \return the capacity of the string (the amount of elements that can be stored before
-   * needing to allocate more memory).
+   * needing to allocate more memory), including the null-terminator.
    *
    * \since 5.0.0
    */
   [[nodiscard]] auto capacity() const noexcept -> size_type
   {
-    return m_data.capacity();
+    return m_capacity;
   }
 
   /**
@@ -186,9 +345,37 @@ class unicode_string final
    */
   [[nodiscard]] auto empty() const noexcept -> bool
   {
-    return m_data.size() == 1;
+    return m_size == 0;
   }
 
+  /**
+   * \brief Indicates whether or not the string is stored in the inline buffer.
+   *
+   * \return `true` if the string doesn't use any allocated memory; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto is_small() const noexcept -> bool
+  {
+    return m_data == m_small;
+  }
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  /**
+   * \brief Returns the memory resource used by the string.
+   *
+   * \return the memory resource that provides the memory of longer strings.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get_resource() const noexcept -> std::pmr::memory_resource*
+  {
+    return m_resource;
+  }
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
   /**
    * \brief Returns a pointer to the first glyph.
    *
@@ -198,13 +385,13 @@ class unicode_string final
    */
   [[nodiscard]] auto data() noexcept -> pointer
   {
-    return m_data.data();
+    return m_data;
   }
 
   /// \copydoc data
   [[nodiscard]] auto data() const noexcept -> const_pointer
   {
-    return m_data.data();
+    return m_data;
   }
 
   /**
@@ -218,13 +405,13 @@ class unicode_string final
    */
   [[nodiscard]] auto begin() noexcept -> iterator
   {
-    return m_data.begin();
+    return m_data;
   }
 
   /// \copydoc begin
   [[nodiscard]] auto begin() const noexcept -> const_iterator
   {
-    return m_data.begin();
+    return m_data;
   }
 
   /**
@@ -238,41 +425,46 @@ class unicode_string final
    */
   [[nodiscard]] auto end() noexcept -> iterator
   {
-    return m_data.end() - 1;
+    return m_data + m_size;
   }
 
   /// \copydoc end
   [[nodiscard]] auto end() const noexcept -> const_iterator
   {
-    return m_data.end() - 1;
+    return m_data + m_size;
   }
 
   /**
    * \brief Returns the element at the specified index.
    *
    * \details This method will throw an exception if the supplied index is out-of-bounds.
+   * The null-terminator can be accessed with an index equal to the size of the string.
    *
    * \param index the index of the desired element.
    *
    * \return the element at the specified index.
    *
+   * \throws std::out_of_range if the index is out-of-bounds.
+   *
    * \since 5.0.0
    */
   [[nodiscard]] auto at(const size_type index) -> reference
   {
-    return m_data.at(index);
+    check_index(index);
+    return m_data[index];
   }
 
   /// \copydoc at
   [[nodiscard]] auto at(const size_type index) const -> const_reference
   {
-    return m_data.at(index);
+    check_index(index);
+    return m_data[index];
   }
 
   /**
    * \brief Returns the element at the specified index.
    *
-   * \pre `index` **must** be in the range [0, `size()`);
+   * \pre `index` **must** be in the range [0, `size()`];
    *
    * \details This method will does *not* perform bounds-checking. However, in debug-mode,
    * an assertion will abort the program if the supplied index is out-of-bounds.
@@ -283,17 +475,16 @@ class unicode_string final
    *
    * \since 5.0.0
    */
-  [[nodiscard]] auto operator[](const size_type index) noexcept(on_msvc()) -> reference
+  [[nodiscard]] auto operator[](const size_type index) noexcept -> reference
   {
-    assert(index < m_data.size());
+    assert(index <= m_size);
     return m_data[index];
   }
 
   /// \copydoc operator[]
-  [[nodiscard]] auto operator[](const size_type index) const noexcept(on_msvc())
-      -> const_reference
+  [[nodiscard]] auto operator[](const size_type index) const noexcept -> const_reference
   {
-    assert(index < m_data.size());
+    assert(index <= m_size);
     return m_data[index];
   }
 
@@ -312,11 +503,117 @@ class unicode_string final
   template <typename Archive>
   void serialize(Archive& archive)
   {
-    archive(m_data);
+    // The glyphs are archived as a vector with the null-terminator, like in earlier
+    // versions, and the same code is used for both saving and loading
+    std::vector<unicode> codes(m_data, m_data + m_size + 1u);
+    archive(codes);
+
+    const auto terminated = !codes.empty() && codes.back() == 0;
+    assign(codes.data(), terminated ? codes.size() - 1u : codes.size());
   }
 
  private:
-  std::vector<unicode> m_data;
+  unicode* m_data{m_small};
+  size_type m_size{};
+  size_type m_capacity{small_capacity};
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+  std::pmr::memory_resource* m_resource{std::pmr::get_default_resource()};
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+  unicode m_small[small_capacity]{};
+
+  void check_index(const size_type index) const
+  {
+    if (index > m_size)
+    {
+      throw std::out_of_range{"Unicode string index out of bounds!"};
+    }
+  }
+
+  [[nodiscard]] auto allocate(const size_type capacity) -> unicode*
+  {
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+    return static_cast<unicode*>(
+        m_resource->allocate(capacity * sizeof(unicode), alignof(unicode)));
+#else
+    return new unicode[capacity];
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+  }
+
+  void release() noexcept
+  {
+    if (!is_small())
+    {
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+      m_resource->deallocate(m_data, m_capacity * sizeof(unicode), alignof(unicode));
+#else
+      delete[] m_data;
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+      m_data = m_small;
+      m_capacity = small_capacity;
+    }
+  }
+
+  // Moves the glyphs or the buffer of another string, which becomes empty
+  void steal(unicode_string& other) noexcept
+  {
+    if (other.is_small())
+    {
+      std::copy(other.m_small, other.m_small + small_capacity, m_small);
+      m_data = m_small;
+      m_capacity = small_capacity;
+    }
+    else
+    {
+      m_data = other.m_data;
+      m_capacity = other.m_capacity;
+      other.m_data = other.m_small;
+      other.m_capacity = small_capacity;
+    }
+
+    m_size = other.m_size;
+    other.m_size = 0;
+    other.m_small[0] = 0;
+  }
+
+  // Grows the buffer to the specified capacity, preserving the glyphs
+  void reallocate(const size_type capacity)
+  {
+    auto* data = allocate(capacity);
+    std::copy(m_data, m_data + m_size + 1u, data);
+
+    release();
+    m_data = data;
+    m_capacity = capacity;
+  }
+
+  // Replaces the glyphs, which must not be stored in this string
+  void assign(const unicode* codes, const size_type count)
+  {
+    if (count + 1u > m_capacity)
+    {
+      auto* data = allocate(count + 1u);
+      release();
+      m_data = data;
+      m_capacity = count + 1u;
+    }
+
+    std::copy(codes, codes + count, m_data);
+    m_size = count;
+    m_data[m_size] = 0;
+  }
+
+  void decode(const std::string_view str)
+  {
+    // Each byte results in at most one glyph
+    m_size = 0;
+    reserve(str.size() + 1u);
+
+    m_size = detail::decode_utf8(detail::get_simd_level(), str, m_data);
+    m_data[m_size] = 0;
+  }
 };
 
 /**
@@ -337,17 +634,7 @@ class unicode_string final
     return false;
   }
 
-  for (unicode_string::size_type index = 0; index < lhs.size(); ++index)
-  {
-    const auto a = lhs.at(index);
-    const auto b = rhs.at(index);
-    if (a != b)
-    {
-      return false;
-    }
-  }
-
-  return true;
+  return std::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
 /**
@@ -0,0 +1,828 @@
+#ifndef CENTURION_VK_SWAPCHAIN_HEADER
+#define CENTURION_VK_SWAPCHAIN_HEADER
+
+#ifndef CENTURION_NO_VULKAN
+
+// Unlike the rest of the Vulkan support, the swapchain needs the full Vulkan headers
+#if __has_include(<vulkan/vulkan.h>)
+
+#include <SDL.h>
+#include <SDL_vulkan.h>
+#include <vulkan/vulkan.h>
+
+#include <algorithm>  // clamp, find
+#include <cstddef>    // size_t
+#include <optional>   // optional
+#include <vector>     // vector
+
+#include "../../core/exception.hpp"
+#include "../../core/integers.hpp"
+#include "../../core/result.hpp"
+#include "../../detail/max.hpp"
+#include "../../events/window_event.hpp"
+#include "../../math/area.hpp"
+#include "../window.hpp"
+#include "vk_core.hpp"
+
+/// \addtogroup video
+/// \{
+
+namespace cen::vk {
+
+/**
+ * \struct swapchain_settings
+ *
+ * \brief Provides the configuration of a `vk::swapchain` instance.
+ *
+ * \since 6.1.0
+ */
+struct swapchain_settings final
+{
+  u32 frames_in_flight{2};  ///< The amount of frames that can be recorded ahead.
+  bool low_latency{true};   ///< Prefer mailbox presentation over FIFO.
+  bool srgb{true};          ///< Prefer sRGB surface formats.
+  VkImageUsageFlags image_usage{VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT};  ///< Image usage.
+};
+
+/**
+ * \brief Selects the present mode of a swapchain.
+ *
+ * \details Mailbox presentation doesn't tear, and always displays the latest frame, so
+ * it has the lowest latency of the modes that are synchronized with the display. FIFO
+ * is the fallback, since it's the only mode that is guaranteed to be supported.
+ *
+ * \param available the present modes supported by the surface.
+ * \param lowLatency `true` if mailbox presentation should be used, if available.
+ *
+ * \return the selected present mode.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto choose_present_mode(
+    const std::vector<VkPresentModeKHR>& available,
+    const bool lowLatency = true) noexcept -> VkPresentModeKHR
+{
+  const auto mailbox = VK_PRESENT_MODE_MAILBOX_KHR;
+  const auto end = available.end();
+  if (lowLatency && std::find(available.begin(), end, mailbox) != end)
+  {
+    return mailbox;
+  }
+  else
+  {
+    return VK_PRESENT_MODE_FIFO_KHR;
+  }
+}
+
+/**
+ * \brief Selects the surface format of a swapchain.
+ *
+ * \param available the surface formats supported by the surface, must not be empty.
+ * \param srgb `true` if an 8-bit sRGB format is preferred; `false` if an 8-bit UNORM
+ * format is preferred.
+ *
+ * \return the preferred format, if available; the first available format otherwise.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto choose_surface_format(
+    const std::vector<VkSurfaceFormatKHR>& available,
+    const bool srgb = true) noexcept -> VkSurfaceFormatKHR
+{
+  const auto bgra = srgb ? VK_FORMAT_B8G8R8A8_SRGB : VK_FORMAT_B8G8R8A8_UNORM;
+  const auto rgba = srgb ? VK_FORMAT_R8G8B8A8_SRGB : VK_FORMAT_R8G8B8A8_UNORM;
+
+  for (const auto& candidate : available)
+  {
+    if ((candidate.format == bgra || candidate.format == rgba) &&
+        candidate.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR)
+    {
+      return candidate;
+    }
+  }
+
+  return available.front();
+}
+
+/**
+ * \brief Selects the extent of a swapchain.
+ *
+ * \details The current extent of the surface is used if the surface has one, otherwise
+ * the drawable size of the window is clamped to the extents supported by the surface.
+ *
+ * \param caps the capabilities of the surface.
+ * \param drawable the drawable size of the window, in pixels.
+ *
+ * \return the selected extent.
+ *
+ * \since 6.1.0
+ */
+[[nodiscard]] inline auto choose_extent(const VkSurfaceCapabilitiesKHR& caps,
+                                        const iarea drawable) noexcept -> VkExtent2D
+{
+  // A current extent of 0xFFFFFFFF means that the surface size follows the swapchain
+  if (caps.currentExtent.width != UINT32_MAX)
+  {
+    return caps.currentExtent;
+  }
+
+  VkExtent2D extent;
+  extent.width = std::clamp(static_cast<u32>(detail::max(drawable.width, 0)),
+                            caps.minImageExtent.width,
+                            caps.maxImageExtent.width);
+  extent.height = std::clamp(static_cast<u32>(detail::max(drawable.height, 0)),
+                             caps.minImageExtent.height,
+                             caps.maxImageExtent.height);
+  return extent;
+}
+
+/**
+ * \class swapchain
+ *
+ * \brief Manages a swapchain, along with the synchronization of its frames in flight.
+ *
+ * \details The swapchain selects its present mode with `choose_present_mode()`, and
+ * keeps a configurable amount of frames in flight, each with its own semaphores and
+ * fence. Acquiring a frame only waits for the fence of the same frame slot, i.e. for the
+ * frame that was submitted `frames_in_flight` frames earlier, so the CPU keeps recording
+ * while the GPU renders.
+ *
+ * \details When the window is resized, or when the surface becomes out of date, the
+ * swapchain is recreated with the previous swapchain as its `oldSwapchain`, without
+ * waiting for the device to become idle. The retired swapchain is destroyed once every
+ * frame that might still use it has completed.
+ * \code{cpp}
+ *   cen::vk::swapchain swapchain{window, instance, gpu, device, surface};
+ *   dispatcher.bind<cen::window_event>().to(
+ *       [&](const cen::window_event& event) { swapchain.handle(event); });
+ *
+ *   // Every frame
+ *   if (const auto frame = swapchain.acquire())
+ *   {
+ *     record(commands[frame->slot], frame->image_view);
+ *     submit(queue, frame->image_available, frame->render_finished, frame->in_flight);
+ *     swapchain.present(queue, *frame);
+ *   }
+ * \endcode
+ *
+ * \note Submissions that use an acquired frame must wait on its `image_available`
+ * semaphore, signal its `render_finished` semaphore, and signal its `in_flight` fence.
+ *
+ * \note The Vulkan functions are loaded with the `vkGetInstanceProcAddr` function
+ * provided by SDL, so the application doesn't need to link against a Vulkan loader.
+ *
+ * \since 6.1.0
+ */
+class swapchain final
+{
+ public:
+  /**
+   * \struct frame
+   *
+   * \brief Describes an acquired swapchain image, and its synchronization objects.
+   *
+   * \since 6.1.0
+   */
+  struct frame final
+  {
+    u32 slot{};                      ///< The frame in flight index.
+    u32 image_index{};               ///< The index of the acquired swapchain image.
+    VkImage image{};                 ///< The acquired swapchain image.
+    VkImageView image_view{};        ///< A color view of the acquired image.
+    VkSemaphore image_available{};   ///< Signaled when the image can be rendered to.
+    VkSemaphore render_finished{};   ///< Should be signaled when rendering has finished.
+    VkFence in_flight{};             ///< Should be signaled by the frame's submission.
+  };
+
+  /// \name Construction/Destruction
+  /// \{
+
+  /**
+   * \brief Creates a swapchain for a window surface.
+   *
+   * \pre `window` must be a Vulkan window.
+   * \pre `device` must have been created with the `VK_KHR_swapchain` extension.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the window that the surface belongs to, used to determine the extent.
+   * \param instance the Vulkan instance.
+   * \param physicalDevice the physical device that the device was created from.
+   * \param device the logical device that the swapchain is created with.
+   * \param surface the surface that will be presented to.
+   * \param settings the configuration of the swapchain.
+   *
+   * \throws cen_error if the Vulkan functions can't be loaded, or if the swapchain or the
+   * synchronization objects can't be created.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  swapchain(const basic_window<T>& window,
+            VkInstance instance,
+            VkPhysicalDevice physicalDevice,
+            VkDevice device,
+            VkSurfaceKHR surface,
+            const swapchain_settings& settings = {})
+      : m_window{window.get()}
+      , m_windowId{window.id()}
+      , m_physicalDevice{physicalDevice}
+      , m_device{device}
+      , m_surface{surface}
+      , m_settings{settings}
+  {
+    if (m_settings.frames_in_flight == 0)
+    {
+      throw cen_error{"A swapchain needs at least one frame in flight!"};
+    }
+
+    load_functions(instance);
+    create_sync_objects();
+    rebuild();
+  }
+
+  swapchain(const swapchain&) = delete;
+
+  auto operator=(const swapchain&) -> swapchain& = delete;
+
+  /**
+   * \brief Destroys the swapchain, after its frames in flight have completed.
+   *
+   * \since 6.1.0
+   */
+  ~swapchain() noexcept
+  {
+    if (!m_fences.empty())
+    {
+      m_vk.waitForFences(m_device,
+                         static_cast<u32>(m_fences.size()),
+                         m_fences.data(),
+                         VK_TRUE,
+                         UINT64_MAX);
+    }
+
+    for (auto& retired : m_retired)
+    {
+      destroy(retired);
+    }
+
+    destroy(m_current);
+
+    for (u32 slot = 0; slot < m_fences.size(); ++slot)
+    {
+      m_vk.destroySemaphore(m_device, m_imageAvailable[slot], nullptr);
+      m_vk.destroySemaphore(m_device, m_renderFinished[slot], nullptr);
+      m_vk.destroyFence(m_device, m_fences[slot], nullptr);
+    }
+  }
+
+  /// \} End of construction/destruction
+
+  /**
+   * \brief Acquires the next swapchain image.
+   *
+   * \details The swapchain is recreated first if a resize is pending. If the surface is
+   * out of date, the swapchain is recreated and no frame is returned, so the frame should
+   * be skipped.
+   *
+   * \return the acquired frame; `std::nullopt` if the window is minimized or if the
+   * swapchain was recreated.
+   *
+   * \throws cen_error if the image can't be acquired or if recreating fails.
+   *
+   * \since 6.1.0
+   */
+  auto acquire() -> std::optional<frame>
+  {
+    if (m_resizePending && !rebuild())
+    {
+      return std::nullopt;
+    }
+
+    auto& fence = m_fences[m_slot];
+    m_vk.waitForFences(m_device, 1, &fence, VK_TRUE, UINT64_MAX);
+
+    destroy_completed_swapchains();
+
+    u32 index{};
+    const auto res = m_vk.acquireNextImage(m_device,
+                                           m_current.handle,
+                                           UINT64_MAX,
+                                           m_imageAvailable[m_slot],
+                                           VK_NULL_HANDLE,
+                                           &index);
+
+    if (res == VK_ERROR_OUT_OF_DATE_KHR)
+    {
+      rebuild();
+      return std::nullopt;
+    }
+    else if (res != VK_SUCCESS && res != VK_SUBOPTIMAL_KHR)
+    {
+      throw cen_error{"Failed to acquire swapchain image!"};
+    }
+
+    m_resizePending = m_resizePending || res == VK_SUBOPTIMAL_KHR;
+
+    // Only reset once it's certain that the fence will be signaled by a submission
+    m_vk.resetFences(m_device, 1, &fence);
+
+    frame result;
+    result.slot = m_slot;
+    result.image_index = index;
+    result.image = m_current.images.at(index);
+    result.image_view = m_current.views.at(index);
+    result.image_available = m_imageAvailable[m_slot];
+    result.render_finished = m_renderFinished[m_slot];
+    result.in_flight = fence;
+
+    return result;
+  }
+
+  /**
+   * \brief Presents an acquired frame, and advances to the next frame slot.
+   *
+   * \details The presentation waits on the `render_finished` semaphore of the frame. If
+   * the surface is out of date or suboptimal, the swapchain is recreated before the next
+   * frame is acquired.
+   *
+   * \param queue a queue that supports presentation to the surface.
+   * \param acquired the frame returned by the latest call to `acquire()`.
+   *
+   * \return `success` if the frame was presented; `failure` otherwise.
+   *
+   * \since 6.1.0
+   */
+  auto present(VkQueue queue, const frame& acquired) noexcept -> result
+  {
+    VkPresentInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_PRESENT_INFO_KHR;
+    info.waitSemaphoreCount = 1;
+    info.pWaitSemaphores = &acquired.render_finished;
+    info.swapchainCount = 1;
+    info.pSwapchains = &m_current.handle;
+    info.pImageIndices = &acquired.image_index;
+
+    const auto res = m_vk.queuePresent(queue, &info);
+    if (res == VK_ERROR_OUT_OF_DATE_KHR || res == VK_SUBOPTIMAL_KHR)
+    {
+      m_resizePending = true;
+    }
+
+    m_slot = (m_slot + 1u) % m_settings.frames_in_flight;
+    ++m_frameNumber;
+
+    return res == VK_SUCCESS || res == VK_SUBOPTIMAL_KHR;
+  }
+
+  /**
+   * \brief Handles a window event, scheduling a rebuild if the window was resized.
+   *
+   * \details Events for other windows are ignored. The swapchain is recreated by the next
+   * call to `acquire()`, so that several resize events in a frame only cause one rebuild.
+   *
+   * \param event the window event that will be handled.
+   *
+   * \since 6.1.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    if (event.get().windowID != m_windowId)
+    {
+      return;
+    }
+
+    switch (event.event_id())
+    {
+      case window_event_id::resized:
+      case window_event_id::size_changed:
+      case window_event_id::restored:
+      case window_event_id::maximized:
+        m_resizePending = true;
+        break;
+
+      case window_event_id::none:
+      case window_event_id::shown:
+      case window_event_id::hidden:
+      case window_event_id::exposed:
+      case window_event_id::moved:
+      case window_event_id::minimized:
+      case window_event_id::enter:
+      case window_event_id::leave:
+      case window_event_id::focus_gained:
+      case window_event_id::focus_lost:
+      case window_event_id::close:
+      case window_event_id::take_focus:
+      case window_event_id::hit_test:
+        break;
+
+      default:  // Newer versions of SDL may emit events without an enumerator
+        break;
+    }
+  }
+
+  /**
+   * \brief Schedules a rebuild, e.g. after changing the settings.
+   *
+   * \since 6.1.0
+   */
+  void invalidate() noexcept
+  {
+    m_resizePending = true;
+  }
+
+  /**
+   * \brief Sets whether or not mailbox presentation is preferred.
+   *
+   * \details The swapchain is recreated by the next call to `acquire()`.
+   *
+   * \param enabled `true` for mailbox presentation if available; `false` for FIFO.
+   *
+   * \since 6.1.0
+   */
+  void set_low_latency(const bool enabled) noexcept
+  {
+    if (m_settings.low_latency != enabled)
+    {
+      m_settings.low_latency = enabled;
+      invalidate();
+    }
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the swapchain handle.
+   *
+   * \return the current swapchain.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto get() const noexcept -> VkSwapchainKHR
+  {
+    return m_current.handle;
+  }
+
+  /**
+   * \brief Returns the size of the swapchain images.
+   *
+   * \return the extent of the swapchain.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto extent() const noexcept -> VkExtent2D
+  {
+    return m_extent;
+  }
+
+  /**
+   * \brief Returns the format of the swapchain images.
+   *
+   * \return the surface format of the swapchain.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto format() const noexcept -> VkSurfaceFormatKHR
+  {
+    return m_format;
+  }
+
+  /**
+   * \brief Returns the present mode of the swapchain.
+   *
+   * \return the present mode that is used.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto present_mode() const noexcept -> VkPresentModeKHR
+  {
+    return m_presentMode;
+  }
+
+  /**
+   * \brief Returns the amount of swapchain images.
+   *
+   * \return the amount of images.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto image_count() const noexcept -> std::size_t
+  {
+    return m_current.images.size();
+  }
+
+  /**
+   * \brief Returns the amount of frames that can be in flight at once.
+   *
+   * \return the amount of frame slots.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto frames_in_flight() const noexcept -> u32
+  {
+    return m_settings.frames_in_flight;
+  }
+
+  /**
+   * \brief Returns the amount of times that the swapchain has been created.
+   *
+   * \return the amount of swapchain rebuilds, including the initial creation.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto generation() const noexcept -> u64
+  {
+    return m_generation;
+  }
+
+  /// \} End of queries
+
+ private:
+  struct functions final
+  {
+    PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR getSurfaceCapabilities{};
+    PFN_vkGetPhysicalDeviceSurfaceFormatsKHR getSurfaceFormats{};
+    PFN_vkGetPhysicalDeviceSurfacePresentModesKHR getPresentModes{};
+    PFN_vkCreateSwapchainKHR createSwapchain{};
+    PFN_vkDestroySwapchainKHR destroySwapchain{};
+    PFN_vkGetSwapchainImagesKHR getSwapchainImages{};
+    PFN_vkAcquireNextImageKHR acquireNextImage{};
+    PFN_vkQueuePresentKHR queuePresent{};
+    PFN_vkCreateImageView createImageView{};
+    PFN_vkDestroyImageView destroyImageView{};
+    PFN_vkCreateSemaphore createSemaphore{};
+    PFN_vkDestroySemaphore destroySemaphore{};
+    PFN_vkCreateFence createFence{};
+    PFN_vkDestroyFence destroyFence{};
+    PFN_vkWaitForFences waitForFences{};
+    PFN_vkResetFences resetFences{};
+  };
+
+  struct chain final
+  {
+    VkSwapchainKHR handle{VK_NULL_HANDLE};
+    std::vector<VkImage> images;
+    std::vector<VkImageView> views;
+    u64 retiredAt{};  // The frame number when the swapchain was replaced
+  };
+
+  SDL_Window* m_window{};
+  u32 m_windowId{};
+  VkPhysicalDevice m_physicalDevice{};
+  VkDevice m_device{};
+  VkSurfaceKHR m_surface{};
+  swapchain_settings m_settings;
+  functions m_vk;
+  chain m_current;
+  std::vector<chain> m_retired;
+  std::vector<VkSemaphore> m_imageAvailable;
+  std::vector<VkSemaphore> m_renderFinished;
+  std::vector<VkFence> m_fences;
+  VkExtent2D m_extent{};
+  VkSurfaceFormatKHR m_format{};
+  VkPresentModeKHR m_presentMode{VK_PRESENT_MODE_FIFO_KHR};
+  u32 m_slot{};
+  u64 m_frameNumber{};
+  u64 m_generation{};
+  bool m_resizePending{};
+
+  // Works with both vkGetInstanceProcAddr and vkGetDeviceProcAddr
+  template <typename F, typename Loader, typename Handle>
+  static void load(F& function, const Loader loader, Handle handle, const char* name)
+  {
+    function = reinterpret_cast<F>(loader(handle, name));
+    if (!function)
+    {
+      throw cen_error{"Failed to load Vulkan function!"};
+    }
+  }
+
+  void load_functions(VkInstance instance)
+  {
+    const auto getInstanceProc =
+        reinterpret_cast<PFN_vkGetInstanceProcAddr>(get_instance_proc_addr());
+    if (!getInstanceProc)
+    {
+      throw cen_error{"Failed to obtain vkGetInstanceProcAddr!"};
+    }
+
+    PFN_vkGetDeviceProcAddr getDeviceProc{};
+    load(getDeviceProc, getInstanceProc, instance, "vkGetDeviceProcAddr");
+
+    load(m_vk.getSurfaceCapabilities,
+         getInstanceProc,
+         instance,
+         "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    load(m_vk.getSurfaceFormats,
+         getInstanceProc,
+         instance,
+         "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    load(m_vk.getPresentModes,
+         getInstanceProc,
+         instance,
+         "vkGetPhysicalDeviceSurfacePresentModesKHR");
+
+    // Device functions skip the dispatch of the loader
+    load(m_vk.createSwapchain, getDeviceProc, m_device, "vkCreateSwapchainKHR");
+    load(m_vk.destroySwapchain, getDeviceProc, m_device, "vkDestroySwapchainKHR");
+    load(m_vk.getSwapchainImages, getDeviceProc, m_device, "vkGetSwapchainImagesKHR");
+    load(m_vk.acquireNextImage, getDeviceProc, m_device, "vkAcquireNextImageKHR");
+    load(m_vk.queuePresent, getDeviceProc, m_device, "vkQueuePresentKHR");
+    load(m_vk.createImageView, getDeviceProc, m_device, "vkCreateImageView");
+    load(m_vk.destroyImageView, getDeviceProc, m_device, "vkDestroyImageView");
+    load(m_vk.createSemaphore, getDeviceProc, m_device, "vkCreateSemaphore");
+    load(m_vk.destroySemaphore, getDeviceProc, m_device, "vkDestroySemaphore");
+    load(m_vk.createFence, getDeviceProc, m_device, "vkCreateFence");
+    load(m_vk.destroyFence, getDeviceProc, m_device, "vkDestroyFence");
+    load(m_vk.waitForFences, getDeviceProc, m_device, "vkWaitForFences");
+    load(m_vk.resetFences, getDeviceProc, m_device, "vkResetFences");
+  }
+
+  void create_sync_objects()
+  {
+    VkSemaphoreCreateInfo semaphoreInfo{};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+
+    // Fences start signaled, so that the first wait of every slot returns immediately
+    VkFenceCreateInfo fenceInfo{};
+    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
+    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT;
+
+    const auto count = m_settings.frames_in_flight;
+    m_imageAvailable.reserve(count);
+    m_renderFinished.reserve(count);
+    m_fences.reserve(count);
+
+    for (u32 slot = 0; slot < count; ++slot)
+    {
+      VkSemaphore available{};
+      VkSemaphore finished{};
+      VkFence fence{};
+
+      const auto& info = semaphoreInfo;
+      if (m_vk.createSemaphore(m_device, &info, nullptr, &available) != VK_SUCCESS ||
+          m_vk.createSemaphore(m_device, &info, nullptr, &finished) != VK_SUCCESS ||
+          m_vk.createFence(m_device, &fenceInfo, nullptr, &fence) != VK_SUCCESS)
+      {
+        throw cen_error{"Failed to create swapchain synchronization objects!"};
+      }
+
+      m_imageAvailable.push_back(available);
+      m_renderFinished.push_back(finished);
+      m_fences.push_back(fence);
+    }
+  }
+
+  // Returns false if the surface has no area, e.g. while the window is minimized
+  auto rebuild() -> bool
+  {
+    VkSurfaceCapabilitiesKHR caps{};
+    if (m_vk.getSurfaceCapabilities(m_physicalDevice, m_surface, &caps) != VK_SUCCESS)
+    {
+      throw cen_error{"Failed to query surface capabilities!"};
+    }
+
+    iarea drawable;
+    SDL_Vulkan_GetDrawableSize(m_window, &drawable.width, &drawable.height);
+
+    const auto extent = choose_extent(caps, drawable);
+    if (extent.width == 0 || extent.height == 0)
+    {
+      m_resizePending = true;  // Retried once the window is restored
+      return false;
+    }
+
+    u32 count{};
+    m_vk.getSurfaceFormats(m_physicalDevice, m_surface, &count, nullptr);
+    std::vector<VkSurfaceFormatKHR> formats(count);
+    m_vk.getSurfaceFormats(m_physicalDevice, m_surface, &count, formats.data());
+
+    m_vk.getPresentModes(m_physicalDevice, m_surface, &count, nullptr);
+    std::vector<VkPresentModeKHR> modes(count);
+    m_vk.getPresentModes(m_physicalDevice, m_surface, &count, modes.data());
+
+    if (formats.empty())
+    {
+      throw cen_error{"The surface has no formats!"};
+    }
+
+    // One image more than the minimum avoids waiting for the driver to release an image
+    auto imageCount = caps.minImageCount + 1u;
+    if (caps.maxImageCount != 0 && imageCount > caps.maxImageCount)
+    {
+      imageCount = caps.maxImageCount;
+    }
+
+    m_format = choose_surface_format(formats, m_settings.srgb);
+    m_presentMode = choose_present_mode(modes, m_settings.low_latency);
+    m_extent = extent;
+
+    VkSwapchainCreateInfoKHR info{};
+    info.sType = VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR;
+    info.surface = m_surface;
+    info.minImageCount = imageCount;
+    info.imageFormat = m_format.format;
+    info.imageColorSpace = m_format.colorSpace;
+    info.imageExtent = m_extent;
+    info.imageArrayLayers = 1;
+    info.imageUsage = m_settings.image_usage;
+    info.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    info.preTransform = caps.currentTransform;
+    info.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    info.presentMode = m_presentMode;
+    info.clipped = VK_TRUE;
+    info.oldSwapchain = m_current.handle;
+
+    chain next;
+    if (m_vk.createSwapchain(m_device, &info, nullptr, &next.handle) != VK_SUCCESS)
+    {
+      throw cen_error{"Failed to create Vulkan swapchain!"};
+    }
+
+    m_vk.getSwapchainImages(m_device, next.handle, &count, nullptr);
+    next.images.resize(count);
+    m_vk.getSwapchainImages(m_device, next.handle, &count, next.images.data());
+
+    next.views.reserve(count);
+    for (const auto image : next.images)
+    {
+      VkImageViewCreateInfo viewInfo{};
+      viewInfo.sType = VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO;
+      viewInfo.image = image;
+      viewInfo.viewType = VK_IMAGE_VIEW_TYPE_2D;
+      viewInfo.format = m_format.format;
+      viewInfo.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+      viewInfo.subresourceRange.levelCount = 1;
+      viewInfo.subresourceRange.layerCount = 1;
+
+      VkImageView view{};
+      if (m_vk.createImageView(m_device, &viewInfo, nullptr, &view) != VK_SUCCESS)
+      {
+        destroy(next);
+        throw cen_error{"Failed to create swapchain image view!"};
+      }
+
+      next.views.push_back(view);
+    }
+
+    // The old swapchain might still be used by frames in flight
+    if (m_current.handle != VK_NULL_HANDLE)
+    {
+      m_current.retiredAt = m_frameNumber;
+      m_retired.push_back(std::move(m_current));
+    }
+
+    m_current = std::move(next);
+    m_resizePending = false;
+    ++m_generation;
+
+    return true;
+  }
+
+  // Called after waiting for the fence of the current slot, which guarantees that every
+  // frame submitted at least `frames_in_flight` frames ago has completed
+  void destroy_completed_swapchains() noexcept
+  {
+    const auto completed = [this](const chain& retired) {
+      return m_frameNumber >= retired.retiredAt + m_settings.frames_in_flight;
+    };
+
+    auto it = m_retired.begin();
+    while (it != m_retired.end())
+    {
+      if (completed(*it))
+      {
+        destroy(*it);
+        it = m_retired.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+  }
+
+  void destroy(chain& target) noexcept
+  {
+    for (const auto view : target.views)
+    {
+      m_vk.destroyImageView(m_device, view, nullptr);
+    }
+
+    if (target.handle != VK_NULL_HANDLE)
+    {
+      m_vk.destroySwapchain(m_device, target.handle, nullptr);
+    }
+
+    target = chain{};
+  }
+};
+
+}  // namespace cen::vk
+
+/// \} End of group video
+
+#endif  // __has_include(<vulkan/vulkan.h>)
+#endif  // CENTURION_NO_VULKAN
+#endif  // CENTURION_VK_SWAPCHAIN_HEADER
@@ -4,6 +4,7 @@
 #include <SDL.h>
 
 #include <cassert>   // assert
+#include <cstddef>   // size_t
 #include <optional>  // optional
 #include <ostream>   // ostream
 #include <string>    // string
@@ -14,12 +15,11 @@
 #include "../core/not_null.hpp"
 #include "../core/owner.hpp"
 #include "../core/result.hpp"
-#include "../detail/address_of.hpp"
 #include "../detail/clamp.hpp"
 #include "../detail/convert_bool.hpp"
+#include "../detail/format_writer.hpp"
 #include "../detail/max.hpp"
 #include "../detail/owner_handle_api.hpp"
-#include "../detail/to_string.hpp"
 #include "../math/area.hpp"
 #include "../math/rect.hpp"
 #include "pixel_format.hpp"
@@ -310,6 +310,40 @@ class basic_window final
     return SDL_UpdateWindowSurface(m_window) == 0;
   }
 
+  /**
+   * \brief Updates areas of the window surface.
+   *
+   * \details Only the specified areas are copied to the screen, which is considerably
+   * cheaper than `update_surface()` when only small parts of the window have changed.
+   *
+   * \warning `Container` *must* be a collection that stores its data contiguously! The
+   * behaviour of this function is undefined if this condition isn't met.
+   *
+   * \tparam Container the container type. Must store `irect` instances contiguously, such
+   * as `std::vector` or `std::array`.
+   *
+   * \param rects the areas of the window surface that will be updated.
+   *
+   * \return `success` if the surface was successfully updated; `failure` otherwise.
+   *
+   * \see `dirty_region`
+   *
+   * \since 6.1.0
+   */
+  template <typename Container>
+  auto update_surface(const Container& rects) noexcept -> result
+  {
+    if (!rects.empty())
+    {
+      const auto* first = rects.front().data();
+      return SDL_UpdateWindowSurfaceRects(m_window, first, isize(rects)) == 0;
+    }
+    else
+    {
+      return success;
+    }
+  }
+
   /// \} End of mutators
 
   /// \name Setters
@@ -1294,6 +1328,40 @@ class basic_window final
   detail::pointer_manager<T, SDL_Window, deleter> m_window;
 };
 
+#ifdef CENTURION_COMPILED_LIBRARY
+
+extern template class basic_window<detail::owning_type>;
+extern template class basic_window<detail::handle_type>;
+
+#endif  // CENTURION_COMPILED_LIBRARY
+
+/**
+ * \brief Writes a textual representation of a window to a buffer.
+ *
+ * \param buffer the buffer that receives the null-terminated string.
+ * \param size the size of the buffer.
+ * \param window the window that will be converted.
+ *
+ * \return the length of the complete representation, excluding the null-terminator. The
+ * output is truncated if it doesn't fit in the buffer.
+ *
+ * \since 6.1.0
+ */
+template <typename T>
+auto format_to(char* buffer,
+               const std::size_t size,
+               const basic_window<T>& window) noexcept -> std::size_t
+{
+  detail::format_writer writer{buffer, size};
+  return writer.write("window{data: ",
+                      window.get(),
+                      ", width: ",
+                      window.width(),
+                      ", height: ",
+                      window.height(),
+                      "}");
+}
+
 /**
  * \brief Returns a textual representation of a window.
  *
@@ -1306,9 +1374,7 @@ class basic_window final
 template <typename T>
 [[nodiscard]] auto to_string(const basic_window<T>& window) -> std::string
 {
-  return "window{data: " + detail::address_of(window.get()) +
-         ", width: " + detail::to_string(window.width()).value() +
-         ", height: " + detail::to_string(window.height()).value() + "}";
+  return detail::format_string(window);
 }
 
 /**
@@ -0,0 +1,306 @@
+#ifndef CENTURION_WINDOW_STATE_HEADER
+#define CENTURION_WINDOW_STATE_HEADER
+
+#include <SDL.h>
+
+#include <limits>  // numeric_limits
+
+#include "../core/integers.hpp"
+#include "../events/event_signal.hpp"
+#include "../events/window_event.hpp"
+#include "../math/area.hpp"
+#include "../math/point.hpp"
+#include "window.hpp"
+
+namespace cen {
+
+/// \addtogroup video
+/// \{
+
+/**
+ * \class window_state
+ *
+ * \brief Caches the size, position and flags of a window, updated by window events.
+ *
+ * \details The window queries call into SDL every time, which adds up for code that
+ * reads the window size many times per frame, e.g. layout and mouse mapping code. A
+ * window state queries the window once, and is then kept up to date by the window
+ * events of the window, so that its queries are plain loads.
+ * \code{cpp}
+ *   cen::window_state state{window};
+ *   state.connect(dispatcher);
+ *
+ *   // Every frame, without any SDL calls
+ *   const auto [width, height] = state.size();
+ * \endcode
+ *
+ * \details The size and position are taken directly from the events. The flags are
+ * queried again whenever the window receives an event, since some of them, such as
+ * fullscreen, change without a dedicated event.
+ *
+ * \note Changes made through the window, e.g. with `set_size()`, are only visible once
+ * the corresponding events have been dispatched. Call `refresh()` to update the state
+ * right away.
+ *
+ * \since 6.1.0
+ */
+class window_state final
+{
+ public:
+  /**
+   * \brief Creates a state cache for a window, and queries the current state.
+   *
+   * \details The window must outlive the state.
+   *
+   * \tparam T the ownership semantics of the window.
+   *
+   * \param window the window that will be tracked.
+   *
+   * \since 6.1.0
+   */
+  template <typename T>
+  explicit window_state(const basic_window<T>& window) noexcept
+      : m_window{window.get()}
+      , m_id{window.id()}
+  {
+    refresh();
+  }
+
+  /**
+   * \brief Queries the current state of the window.
+   *
+   * \since 6.1.0
+   */
+  void refresh() noexcept
+  {
+    SDL_GetWindowSize(m_window, &m_size.width, &m_size.height);
+
+    int x{};
+    int y{};
+    SDL_GetWindowPosition(m_window, &x, &y);
+    m_position = {x, y};
+
+    m_flags = SDL_GetWindowFlags(m_window);
+  }
+
+  /**
+   * \brief Updates the state according to a window event.
+   *
+   * \details Events that belong to other windows are ignored.
+   *
+   * \param event the window event that will be handled.
+   *
+   * \since 6.1.0
+   */
+  void handle(const window_event& event) noexcept
+  {
+    const auto& raw = event.get();
+    if (raw.windowID != m_id)
+    {
+      return;
+    }
+
+    switch (event.event_id())
+    {
+      case window_event_id::moved:
+        m_position = {raw.data1, raw.data2};
+        break;
+
+      case window_event_id::resized:
+      case window_event_id::size_changed:
+        m_size = {raw.data1, raw.data2};
+        break;
+
+      case window_event_id::none:
+      case window_event_id::shown:
+      case window_event_id::hidden:
+      case window_event_id::exposed:
+      case window_event_id::minimized:
+      case window_event_id::maximized:
+      case window_event_id::restored:
+      case window_event_id::enter:
+      case window_event_id::leave:
+      case window_event_id::focus_gained:
+      case window_event_id::focus_lost:
+      case window_event_id::close:
+      case window_event_id::take_focus:
+      case window_event_id::hit_test:
+        break;
+
+      default:  // Newer versions of SDL may emit events without an enumerator
+        break;
+    }
+
+    m_flags = SDL_GetWindowFlags(m_window);
+  }
+
+  /**
+   * \brief Connects the state to the window events of a dispatcher.
+   *
+   * \details The handler is connected with the highest priority, and never consumes the
+   * events, so the state is updated before any other handler is invoked.
+   *
+   * \tparam Dispatcher the type of the event dispatcher.
+   *
+   * \param dispatcher the dispatcher that will update the state, must handle
+   * `window_event`.
+   *
+   * \return the connection of the handler, see `event_sink::disconnect()`.
+   *
+   * \since 6.1.0
+   */
+  template <typename Dispatcher>
+  auto connect(Dispatcher& dispatcher) -> event_connection
+  {
+    constexpr auto priority = (std::numeric_limits<int>::max)();
+    return dispatcher.template bind<window_event>()
+        .template connect<&window_state::handle>(this, priority);
+  }
+
+  /// \name Queries
+  /// \{
+
+  /**
+   * \brief Returns the size of the window.
+   *
+   * \return the cached window size.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto size() const noexcept -> iarea
+  {
+    return m_size;
+  }
+
+  /**
+   * \brief Returns the width of the window.
+   *
+   * \return the cached window width.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto width() const noexcept -> int
+  {
+    return m_size.width;
+  }
+
+  /**
+   * \brief Returns the height of the window.
+   *
+   * \return the cached window height.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto height() const noexcept -> int
+  {
+    return m_size.height;
+  }
+
+  /**
+   * \brief Returns the position of the window.
+   *
+   * \return the cached window position.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto position() const noexcept -> ipoint
+  {
+    return m_position;
+  }
+
+  /**
+   * \brief Returns the flags of the window.
+   *
+   * \return the cached window flags.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto flags() const noexcept -> u32
+  {
+    return m_flags;
+  }
+
+  /**
+   * \brief Indicates whether or not a flag is set.
+   *
+   * \param flag the flag that will be tested, e.g. `SDL_WINDOW_FULLSCREEN` or
+   * `window::fullscreen`.
+   *
+   * \return `true` if the flag is set; `false` otherwise.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto check_flag(const u32 flag) const noexcept -> bool
+  {
+    return (m_flags & flag) != 0;
+  }
+
+  /// \copydoc basic_window::is_visible()
+  [[nodiscard]] auto is_visible() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_SHOWN);
+  }
+
+  /// \copydoc basic_window::is_minimized()
+  [[nodiscard]] auto is_minimized() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_MINIMIZED);
+  }
+
+  /// \copydoc basic_window::is_maximized()
+  [[nodiscard]] auto is_maximized() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_MAXIMIZED);
+  }
+
+  /// \copydoc basic_window::is_fullscreen()
+  [[nodiscard]] auto is_fullscreen() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_FULLSCREEN);
+  }
+
+  /// \copydoc basic_window::is_resizable()
+  [[nodiscard]] auto is_resizable() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_RESIZABLE);
+  }
+
+  /// \copydoc basic_window::has_input_focus()
+  [[nodiscard]] auto has_input_focus() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_INPUT_FOCUS);
+  }
+
+  /// \copydoc basic_window::has_mouse_focus()
+  [[nodiscard]] auto has_mouse_focus() const noexcept -> bool
+  {
+    return check_flag(SDL_WINDOW_MOUSE_FOCUS);
+  }
+
+  /**
+   * \brief Returns the ID of the tracked window.
+   *
+   * \return the window ID.
+   *
+   * \since 6.1.0
+   */
+  [[nodiscard]] auto id() const noexcept -> u32
+  {
+    return m_id;
+  }
+
+  /// \} End of queries
+
+ private:
+  SDL_Window* m_window{};
+  u32 m_id{};
+  iarea m_size{};
+  ipoint m_position;
+  u32 m_flags{};
+};
+
+/// \} End of group video
+
+}  // namespace cen
+
+#endif  // CENTURION_WINDOW_STATE_HEADER
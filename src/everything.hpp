@@ -30,139 +30,57 @@
 #include "centurion/core/macros.hpp"
 // clang-format on
 
-#include "centurion/audio/channels.hpp"
-#include "centurion/audio/music.hpp"
-#include "centurion/audio/sound_effect.hpp"
-#include "centurion/audio/sound_fonts.hpp"
-#include "centurion/compiler/compiler.hpp"
-#include "centurion/core/cast.hpp"
-#include "centurion/core/czstring.hpp"
-#include "centurion/core/exception.hpp"
-#include "centurion/core/integers.hpp"
-#include "centurion/core/library.hpp"
-#include "centurion/core/log.hpp"
-#include "centurion/core/not_null.hpp"
-#include "centurion/core/owner.hpp"
-#include "centurion/core/result.hpp"
-#include "centurion/core/sdl_string.hpp"
-#include "centurion/core/sfinae.hpp"
-#include "centurion/core/time.hpp"
-#include "centurion/core/to_underlying.hpp"
-#include "centurion/core/version.hpp"
+#include "centurion/audio.hpp"
+#include "centurion/compiler.hpp"
+#include "centurion/core.hpp"
+#include "centurion/events.hpp"
+#include "centurion/filesystem.hpp"
+#include "centurion/hints.hpp"
+#include "centurion/input.hpp"
+#include "centurion/math.hpp"
+#include "centurion/system.hpp"
+#include "centurion/thread.hpp"
+#include "centurion/video.hpp"
+
 #include "centurion/detail/address_of.hpp"
 #include "centurion/detail/any_eq.hpp"
+#include "centurion/detail/asset_pack_format.hpp"
+#include "centurion/detail/block_compression.hpp"
+#include "centurion/detail/byte_swap_kernels.hpp"
 #include "centurion/detail/clamp.hpp"
+#include "centurion/detail/color_kernels.hpp"
 #include "centurion/detail/convert_bool.hpp"
 #include "centurion/detail/czstring_compare.hpp"
 #include "centurion/detail/czstring_eq.hpp"
+#include "centurion/detail/deferred_format.hpp"
+#include "centurion/detail/distance_field.hpp"
+#include "centurion/detail/event_record_format.hpp"
+#include "centurion/detail/event_traits.hpp"
+#include "centurion/detail/flat_id_map.hpp"
+#include "centurion/detail/format_writer.hpp"
+#include "centurion/detail/frame_arena.hpp"
+#include "centurion/detail/gl_functions.hpp"
+#include "centurion/detail/glyph_table.hpp"
 #include "centurion/detail/hints_impl.hpp"
+#include "centurion/detail/key_name_table.hpp"
+#include "centurion/detail/lut_kernels.hpp"
 #include "centurion/detail/max.hpp"
 #include "centurion/detail/min.hpp"
 #include "centurion/detail/owner_handle_api.hpp"
+#include "centurion/detail/pixel_kernels.hpp"
+#include "centurion/detail/queue_waiter.hpp"
+#include "centurion/detail/rect_kernels.hpp"
+#include "centurion/detail/rwops_adapter.hpp"
+#include "centurion/detail/sample_kernels.hpp"
 #include "centurion/detail/sdl_deleter.hpp"
 #include "centurion/detail/sdl_version_at_least.hpp"
-#include "centurion/detail/stack_resource.hpp"
+#include "centurion/detail/simd_dispatch.hpp"
+#include "centurion/detail/skyline_packer.hpp"
+#include "centurion/detail/spatial_kernels.hpp"
+#include "centurion/detail/spin_backoff.hpp"
 #include "centurion/detail/static_bimap.hpp"
 #include "centurion/detail/to_string.hpp"
+#include "centurion/detail/tsc_clock.hpp"
 #include "centurion/detail/tuple_type_index.hpp"
-#include "centurion/events/audio_device_event.hpp"
-#include "centurion/events/common_event.hpp"
-#include "centurion/events/controller_axis_event.hpp"
-#include "centurion/events/controller_button_event.hpp"
-#include "centurion/events/controller_device_event.hpp"
-#include "centurion/events/dollar_gesture_event.hpp"
-#include "centurion/events/drop_event.hpp"
-#include "centurion/events/event.hpp"
-#include "centurion/events/event_dispatcher.hpp"
-#include "centurion/events/event_type.hpp"
-#include "centurion/events/joy_axis_event.hpp"
-#include "centurion/events/joy_ball_event.hpp"
-#include "centurion/events/joy_button_event.hpp"
-#include "centurion/events/joy_device_event.hpp"
-#include "centurion/events/joy_hat_event.hpp"
-#include "centurion/events/keyboard_event.hpp"
-#include "centurion/events/mouse_button_event.hpp"
-#include "centurion/events/mouse_motion_event.hpp"
-#include "centurion/events/mouse_wheel_event.hpp"
-#include "centurion/events/multi_gesture_event.hpp"
-#include "centurion/events/quit_event.hpp"
-#include "centurion/events/text_editing_event.hpp"
-#include "centurion/events/text_input_event.hpp"
-#include "centurion/events/touch_finger_event.hpp"
-#include "centurion/events/window_event.hpp"
-#include "centurion/filesystem/base_path.hpp"
-#include "centurion/filesystem/file.hpp"
-#include "centurion/filesystem/preferred_path.hpp"
-#include "centurion/hints/android_hints.hpp"
-#include "centurion/hints/apple_tv_hints.hpp"
-#include "centurion/hints/common_hints.hpp"
-#include "centurion/hints/controller_hints.hpp"
-#include "centurion/hints/d3d_hints.hpp"
-#include "centurion/hints/emscripten_hints.hpp"
-#include "centurion/hints/enum_hint.hpp"
-#include "centurion/hints/hints.hpp"
-#include "centurion/hints/joystick_hints.hpp"
-#include "centurion/hints/mac_hints.hpp"
-#include "centurion/hints/mouse_hints.hpp"
-#include "centurion/hints/qtwayland_hints.hpp"
-#include "centurion/hints/raspberry_pi_hints.hpp"
-#include "centurion/hints/windows_hints.hpp"
-#include "centurion/hints/winrt_hints.hpp"
-#include "centurion/hints/x11_hints.hpp"
-#include "centurion/hints/xinput_hints.hpp"
-#include "centurion/input/button_state.hpp"
-#include "centurion/input/controller.hpp"
-#include "centurion/input/haptic.hpp"
-#include "centurion/input/joystick.hpp"
-#include "centurion/input/key_code.hpp"
-#include "centurion/input/key_modifier.hpp"
-#include "centurion/input/keyboard.hpp"
-#include "centurion/input/mouse.hpp"
-#include "centurion/input/scan_code.hpp"
-#include "centurion/input/sensor.hpp"
-#include "centurion/input/touch.hpp"
-#include "centurion/math/area.hpp"
-#include "centurion/math/point.hpp"
-#include "centurion/math/rect.hpp"
-#include "centurion/math/vector3.hpp"
-#include "centurion/system/battery.hpp"
-#include "centurion/system/byte_order.hpp"
-#include "centurion/system/clipboard.hpp"
-#include "centurion/system/counter.hpp"
-#include "centurion/system/cpu.hpp"
-#include "centurion/system/locale.hpp"
-#include "centurion/system/platform.hpp"
-#include "centurion/system/ram.hpp"
-#include "centurion/system/shared_object.hpp"
-#include "centurion/thread/condition.hpp"
-#include "centurion/thread/mutex.hpp"
-#include "centurion/thread/scoped_lock.hpp"
-#include "centurion/thread/semaphore.hpp"
-#include "centurion/thread/thread.hpp"
-#include "centurion/thread/try_lock.hpp"
-#include "centurion/video/blend_mode.hpp"
-#include "centurion/video/color.hpp"
-#include "centurion/video/colors.hpp"
-#include "centurion/video/cursor.hpp"
-#include "centurion/video/font.hpp"
-#include "centurion/video/font_cache.hpp"
-#include "centurion/video/graphics_drivers.hpp"
-#include "centurion/video/message_box.hpp"
-#include "centurion/video/opengl/gl_attribute.hpp"
-#include "centurion/video/opengl/gl_context.hpp"
-#include "centurion/video/opengl/gl_core.hpp"
-#include "centurion/video/opengl/gl_library.hpp"
-#include "centurion/video/palette.hpp"
-#include "centurion/video/pixel_format.hpp"
-#include "centurion/video/renderer.hpp"
-#include "centurion/video/renderer_info.hpp"
-#include "centurion/video/scale_mode.hpp"
-#include "centurion/video/screen.hpp"
-#include "centurion/video/surface.hpp"
-#include "centurion/video/texture.hpp"
-#include "centurion/video/texture_access.hpp"
-#include "centurion/video/unicode_string.hpp"
-#include "centurion/video/vulkan/vk_core.hpp"
-#include "centurion/video/vulkan/vk_library.hpp"
-#include "centurion/video/window.hpp"
-#include "centurion/video/window_utils.hpp"
+#include "centurion/detail/utf8.hpp"
+#include "centurion/detail/utf8_kernels.hpp"
@@ -0,0 +1,27 @@
+#include <benchmark/benchmark.h>
+
+#include "core/library.hpp"
+
+int main(int argc, char* argv[])
+{
+  // The benchmarks render offscreen, so they don't need a display
+  SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+
+  cen::config cfg;
+
+  cfg.coreFlags = SDL_INIT_VIDEO | SDL_INIT_EVENTS;
+  cfg.initMixer = false;
+
+  const cen::library lib{cfg};
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+  {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
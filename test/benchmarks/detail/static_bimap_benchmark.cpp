@@ -0,0 +1,93 @@
+#include "detail/static_bimap.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <utility>  // make_pair
+
+#include "detail/czstring_compare.hpp"
+
+namespace {
+
+template <std::size_t Size>
+using map_for = cen::detail::static_bimap_for<int,
+                                              cen::czstring,
+                                              cen::detail::czstring_compare,
+                                              cen::detail::czstring_less,
+                                              Size>;
+
+// Small enough for linear searches
+constexpr map_for<4> small{std::make_pair(0, "zero"),
+                           std::make_pair(1, "one"),
+                           std::make_pair(2, "two"),
+                           std::make_pair(3, "three")};
+
+// Large enough for binary searches
+constexpr map_for<20> large{std::make_pair(0, "alpha"),
+                            std::make_pair(1, "bravo"),
+                            std::make_pair(2, "charlie"),
+                            std::make_pair(3, "delta"),
+                            std::make_pair(4, "echo"),
+                            std::make_pair(5, "foxtrot"),
+                            std::make_pair(6, "golf"),
+                            std::make_pair(7, "hotel"),
+                            std::make_pair(8, "india"),
+                            std::make_pair(9, "juliett"),
+                            std::make_pair(10, "kilo"),
+                            std::make_pair(11, "lima"),
+                            std::make_pair(12, "mike"),
+                            std::make_pair(13, "november"),
+                            std::make_pair(14, "oscar"),
+                            std::make_pair(15, "papa"),
+                            std::make_pair(16, "quebec"),
+                            std::make_pair(17, "romeo"),
+                            std::make_pair(18, "sierra"),
+                            std::make_pair(19, "tango")};
+
+template <typename Map>
+void find_all(benchmark::State& state, const Map& map, const int size)
+{
+  int key = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(map.find(key));
+    key = (key + 1) % size;
+  }
+}
+
+template <typename Map>
+void key_from_all(benchmark::State& state, const Map& map, const int size)
+{
+  int key = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(map.key_from(map.find(key)));
+    key = (key + 1) % size;
+  }
+}
+
+void StaticBimapFindSmall(benchmark::State& state)
+{
+  find_all(state, small, 4);
+}
+
+void StaticBimapFindLarge(benchmark::State& state)
+{
+  find_all(state, large, 20);
+}
+
+void StaticBimapKeyFromSmall(benchmark::State& state)
+{
+  key_from_all(state, small, 4);
+}
+
+void StaticBimapKeyFromLarge(benchmark::State& state)
+{
+  key_from_all(state, large, 20);
+}
+
+}  // namespace
+
+BENCHMARK(StaticBimapFindSmall);
+BENCHMARK(StaticBimapFindLarge);
+BENCHMARK(StaticBimapKeyFromSmall);
+BENCHMARK(StaticBimapKeyFromLarge);
@@ -0,0 +1,68 @@
+#include "events/event_dispatcher.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "events/event.hpp"
+
+namespace {
+
+using event_dispatcher = cen::
+    event_dispatcher<cen::quit_event, cen::keyboard_event, cen::window_event>;
+
+void push_events(const long long count)
+{
+  cen::keyboard_event keyboardEvent;
+  cen::window_event windowEvent;
+
+  for (long long index = 0; index < count; ++index)
+  {
+    if (index % 2 == 0)
+    {
+      cen::event::push(keyboardEvent);
+    }
+    else
+    {
+      cen::event::push(windowEvent);
+    }
+  }
+}
+
+template <bool Batched>
+void Poll(benchmark::State& state)
+{
+  cen::event::flush_all();
+
+  int handled = 0;
+
+  event_dispatcher dispatcher;
+  dispatcher.bind<cen::keyboard_event>().to([&](const cen::keyboard_event&) {
+    ++handled;
+  });
+  dispatcher.bind<cen::window_event>().to([&](const cen::window_event&) {
+    ++handled;
+  });
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    push_events(state.range(0));
+    state.ResumeTiming();
+
+    if constexpr (Batched)
+    {
+      dispatcher.poll_batched();
+    }
+    else
+    {
+      dispatcher.poll();
+    }
+  }
+
+  benchmark::DoNotOptimize(handled);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(Poll, false)->Range(8, 1'024);
+BENCHMARK_TEMPLATE(Poll, true)->Range(8, 1'024);
@@ -0,0 +1,64 @@
+#include "filesystem/file.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>  // vector
+
+#include "core/integers.hpp"
+
+namespace {
+
+// Reads from memory, so that the benchmarks measure the file API rather than the disk
+[[nodiscard]] auto make_data(const benchmark::State& state) -> std::vector<cen::u32>
+{
+  return std::vector<cen::u32>(static_cast<std::size_t>(state.range(0)), 0xDEAD'BEEFu);
+}
+
+void FileReadLittleEndian(benchmark::State& state)
+{
+  const auto data = make_data(state);
+  cen::file file{SDL_RWFromConstMem(data.data(), static_cast<int>(data.size() * 4u))};
+
+  for (auto _ : state)
+  {
+    if (!file.seek(0, cen::seek_mode::from_beginning))
+    {
+      state.SkipWithError("Failed to rewind the file!");
+      break;
+    }
+
+    for (std::size_t index = 0; index < data.size(); ++index)
+    {
+      benchmark::DoNotOptimize(file.read_little_endian_u32());
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+void FileReadTo(benchmark::State& state)
+{
+  const auto data = make_data(state);
+  cen::file file{SDL_RWFromConstMem(data.data(), static_cast<int>(data.size() * 4u))};
+
+  std::vector<cen::u32> buffer(data.size());
+
+  for (auto _ : state)
+  {
+    if (!file.seek(0, cen::seek_mode::from_beginning))
+    {
+      state.SkipWithError("Failed to rewind the file!");
+      break;
+    }
+
+    benchmark::DoNotOptimize(file.read_to(buffer));
+    benchmark::ClobberMemory();
+  }
+
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+}  // namespace
+
+BENCHMARK(FileReadLittleEndian)->Range(64, 65'536);
+BENCHMARK(FileReadTo)->Range(64, 65'536);
@@ -0,0 +1,40 @@
+#ifndef CENTURION_BENCHMARKS_HEADLESS_HEADER
+#define CENTURION_BENCHMARKS_HEADLESS_HEADER
+
+#include <benchmark/benchmark.h>
+
+#include <optional>  // optional
+
+#include "video/offscreen_renderer.hpp"
+#include "video/renderer.hpp"
+
+// The rendering benchmarks use an offscreen renderer, so they don't need a display. The
+// renderer only lives for the duration of each benchmark, so it is always destroyed
+// before the library is shut down.
+class headless_fixture : public benchmark::Fixture
+{
+ public:
+  using benchmark::Fixture::SetUp;
+  using benchmark::Fixture::TearDown;
+
+  void SetUp(const benchmark::State&) override
+  {
+    m_offscreen.emplace(cen::iarea{800, 600}, cen::pixel_format::argb8888);
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    m_offscreen.reset();
+  }
+
+ protected:
+  [[nodiscard]] auto headless_renderer() -> cen::renderer&
+  {
+    return m_offscreen->get();
+  }
+
+ private:
+  std::optional<cen::offscreen_renderer> m_offscreen;
+};
+
+#endif  // CENTURION_BENCHMARKS_HEADLESS_HEADER
@@ -0,0 +1,35 @@
+#include "input/keyboard.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "input/scan_code.hpp"
+
+namespace {
+
+void KeyboardUpdate(benchmark::State& state)
+{
+  cen::keyboard keyboard;
+
+  for (auto _ : state)
+  {
+    keyboard.update();
+    benchmark::ClobberMemory();
+  }
+}
+
+void KeyboardIsPressed(benchmark::State& state)
+{
+  cen::keyboard keyboard;
+  keyboard.update();
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(keyboard.is_pressed(cen::scancodes::a));
+    benchmark::DoNotOptimize(keyboard.is_pressed(cen::scancodes::space));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(KeyboardUpdate);
+BENCHMARK(KeyboardIsPressed);
@@ -0,0 +1,59 @@
+#include "thread/mutex.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "thread/scoped_lock.hpp"
+#include "thread/shared_mutex.hpp"
+#include "thread/spin_mutex.hpp"
+
+namespace {
+
+// The critical sections only increment a counter, which is the case that spin mutexes
+// are meant for. The mutex is shared by all threads of a benchmark.
+template <typename Mutex>
+void lock_unlock(benchmark::State& state)
+{
+  static Mutex mutex;
+  static long counter = 0;
+
+  for (auto _ : state)
+  {
+    cen::scoped_lock lock{mutex};
+    benchmark::DoNotOptimize(++counter);
+  }
+}
+
+void MutexLockUnlock(benchmark::State& state)
+{
+  lock_unlock<cen::mutex>(state);
+}
+
+void SpinMutexLockUnlock(benchmark::State& state)
+{
+  lock_unlock<cen::spin_mutex>(state);
+}
+
+void SharedMutexLockUnlock(benchmark::State& state)
+{
+  lock_unlock<cen::shared_mutex>(state);
+}
+
+// Readers don't exclude each other, so this should scale with the amount of threads
+void SharedMutexLockShared(benchmark::State& state)
+{
+  static cen::shared_mutex mutex;
+  static long value = 42;
+
+  for (auto _ : state)
+  {
+    cen::shared_lock lock{mutex};
+    benchmark::DoNotOptimize(value);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(MutexLockUnlock)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(SpinMutexLockUnlock)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(SharedMutexLockUnlock)->ThreadRange(1, 4)->UseRealTime();
+BENCHMARK(SharedMutexLockShared)->ThreadRange(1, 4)->UseRealTime();
@@ -0,0 +1,102 @@
+#include "video/color.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>  // vector
+
+#include "video/color_batch.hpp"
+#include "video/colors.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_hues(const benchmark::State& state) -> std::vector<float>
+{
+  std::vector<float> hues(static_cast<std::size_t>(state.range(0)));
+  for (std::size_t index = 0; index < hues.size(); ++index)
+  {
+    hues[index] = static_cast<float>(index % 360u);
+  }
+
+  return hues;
+}
+
+void ColorFromHsv(benchmark::State& state)
+{
+  const auto hues = make_hues(state);
+  std::vector<cen::color> out(hues.size());
+
+  for (auto _ : state)
+  {
+    for (std::size_t index = 0; index < hues.size(); ++index)
+    {
+      out[index] = cen::color::from_hsv(hues[index], 75, 50);
+    }
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void ColorsFromHsv(benchmark::State& state)
+{
+  const auto hues = make_hues(state);
+  const std::vector<float> saturations(hues.size(), 75.0f);
+  const std::vector<float> values(hues.size(), 50.0f);
+  std::vector<cen::color> out(hues.size());
+
+  for (auto _ : state)
+  {
+    cen::colors_from_hsv(hues.data(),
+                         saturations.data(),
+                         values.data(),
+                         out.data(),
+                         out.size());
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void ColorBlend(benchmark::State& state)
+{
+  const std::vector<cen::color> a(static_cast<std::size_t>(state.range(0)),
+                                  cen::colors::red);
+  const std::vector<cen::color> b(a.size(), cen::colors::blue);
+  std::vector<cen::color> out(a.size());
+
+  for (auto _ : state)
+  {
+    for (std::size_t index = 0; index < a.size(); ++index)
+    {
+      out[index] = cen::blend(a[index], b[index], 0.25);
+    }
+
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void LerpColors(benchmark::State& state)
+{
+  const std::vector<cen::color> a(static_cast<std::size_t>(state.range(0)),
+                                  cen::colors::red);
+  const std::vector<cen::color> b(a.size(), cen::colors::blue);
+  std::vector<cen::color> out(a.size());
+
+  for (auto _ : state)
+  {
+    cen::lerp_colors(a.data(), b.data(), out.data(), out.size(), 0.25f);
+    benchmark::ClobberMemory();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(ColorFromHsv)->Range(64, 16'384);
+BENCHMARK(ColorsFromHsv)->Range(64, 16'384);
+BENCHMARK(ColorBlend)->Range(64, 16'384);
+BENCHMARK(LerpColors)->Range(64, 16'384);
@@ -0,0 +1,76 @@
+#include "video/font_cache.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string_view>  // string_view
+
+#include "headless.hpp"
+#include "video/colors.hpp"
+
+namespace {
+
+inline constexpr std::string_view text = "The quick brown fox jumps over the lazy dog";
+
+[[nodiscard]] auto make_cache(cen::renderer& renderer, const bool atlas)
+    -> cen::font_cache
+{
+  renderer.set_color(cen::colors::white);
+
+  cen::font_cache cache{"resources/fira_code.ttf", 16};
+  if (atlas)
+  {
+    cache.enable_glyph_atlas();
+  }
+
+  cache.add_basic_latin(renderer);
+  return cache;
+}
+
+BENCHMARK_DEFINE_F(headless_fixture, GlyphLookup)(benchmark::State& state)
+{
+  const auto cache = make_cache(headless_renderer(), false);
+
+  for (auto _ : state)
+  {
+    for (const auto ch : text)
+    {
+      benchmark::DoNotOptimize(cache.try_at(static_cast<cen::unicode>(ch)));
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(text.size()));
+}
+
+BENCHMARK_DEFINE_F(headless_fixture, RenderText)(benchmark::State& state)
+{
+  auto& renderer = headless_renderer();
+  const auto cache = make_cache(renderer, state.range(0) != 0);
+
+  for (auto _ : state)
+  {
+    renderer.render_text(cache, text, {10, 10});
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(text.size()));
+}
+
+BENCHMARK_DEFINE_F(headless_fixture, RenderTextBatched)(benchmark::State& state)
+{
+  auto& renderer = headless_renderer();
+  const auto cache = make_cache(renderer, state.range(0) != 0);
+
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(renderer.render_text_batched(cache, text, {10, 10}));
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<long long>(text.size()));
+}
+
+}  // namespace
+
+BENCHMARK_REGISTER_F(headless_fixture, GlyphLookup);
+
+// The argument determines whether or not the glyph atlas is used
+BENCHMARK_REGISTER_F(headless_fixture, RenderText)->Arg(0)->Arg(1);
+BENCHMARK_REGISTER_F(headless_fixture, RenderTextBatched)->Arg(0)->Arg(1);
@@ -0,0 +1,121 @@
+#include "video/renderer.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>  // vector
+
+#include "headless.hpp"
+#include "math/rect.hpp"
+#include "video/colors.hpp"
+#include "video/sprite_batch.hpp"
+#include "video/surface.hpp"
+#include "video/texture.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_rects(const int count) -> std::vector<cen::irect>
+{
+  std::vector<cen::irect> rects;
+  rects.reserve(static_cast<std::size_t>(count));
+
+  for (int index = 0; index < count; ++index)
+  {
+    rects.emplace_back((index * 7) % 780, (index * 13) % 580, 16, 16);
+  }
+
+  return rects;
+}
+
+BENCHMARK_DEFINE_F(headless_fixture, FillRectSingle)(benchmark::State& state)
+{
+  auto& renderer = headless_renderer();
+  renderer.set_color(cen::colors::red);
+
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    for (const auto& rect : rects)
+    {
+      renderer.fill_rect(rect);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(headless_fixture, FillRectBatched)(benchmark::State& state)
+{
+  auto& renderer = headless_renderer();
+  renderer.set_color(cen::colors::red);
+
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    renderer.fill_rects(rects);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+BENCHMARK_DEFINE_F(headless_fixture, RenderTextureSingle)(benchmark::State& state)
+{
+  auto& renderer = headless_renderer();
+
+  const cen::surface surface{{16, 16}, cen::pixel_format::rgba8888};
+  const cen::texture texture{renderer, surface};
+
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+  const cen::irect source{0, 0, 16, 16};
+
+  for (auto _ : state)
+  {
+    for (const auto& rect : rects)
+    {
+      renderer.render(texture, source, rect);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+BENCHMARK_DEFINE_F(headless_fixture, RenderTextureBatched)(benchmark::State& state)
+{
+  auto& renderer = headless_renderer();
+
+  const cen::surface surface{{16, 16}, cen::pixel_format::rgba8888};
+  const cen::texture texture{renderer, surface};
+
+  const auto rects = make_rects(static_cast<int>(state.range(0)));
+  const cen::irect source{0, 0, 16, 16};
+
+  cen::sprite_batch batch{rects.size()};
+
+  for (auto _ : state)
+  {
+    for (const auto& rect : rects)
+    {
+      batch.add(texture, source, cen::cast<cen::frect>(rect));
+    }
+
+    batch.submit(renderer);
+    batch.clear();
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+}  // namespace
+
+BENCHMARK_REGISTER_F(headless_fixture, FillRectSingle)->Range(64, 4'096);
+BENCHMARK_REGISTER_F(headless_fixture, FillRectBatched)->Range(64, 4'096);
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+BENCHMARK_REGISTER_F(headless_fixture, RenderTextureSingle)->Range(64, 4'096);
+BENCHMARK_REGISTER_F(headless_fixture, RenderTextureBatched)->Range(64, 4'096);
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,72 @@
+#include "video/surface.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "video/colors.hpp"
+#include "video/pixel_view.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_surface(const benchmark::State& state) -> cen::surface
+{
+  const auto size = static_cast<int>(state.range(0));
+  return cen::surface{{size, size}, cen::pixel_format::rgba8888};
+}
+
+void SurfaceSetPixel(benchmark::State& state)
+{
+  auto surface = make_surface(state);
+  const auto size = surface.size();
+
+  for (auto _ : state)
+  {
+    for (int y = 0; y < size.height; ++y)
+    {
+      for (int x = 0; x < size.width; ++x)
+      {
+        surface.set_pixel({x, y}, cen::colors::orange);
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void PixelViewSetPixel(benchmark::State& state)
+{
+  auto surface = make_surface(state);
+  const auto size = surface.size();
+
+  for (auto _ : state)
+  {
+    cen::pixel_view view{surface};
+    for (int y = 0; y < size.height; ++y)
+    {
+      for (int x = 0; x < size.width; ++x)
+      {
+        view.set_pixel({x, y}, cen::colors::orange);
+      }
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+void PixelViewFill(benchmark::State& state)
+{
+  auto surface = make_surface(state);
+
+  for (auto _ : state)
+  {
+    cen::pixel_view view{surface};
+    view.fill(cen::colors::orange);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK(SurfaceSetPixel)->Range(32, 512);
+BENCHMARK(PixelViewSetPixel)->Range(32, 512);
+BENCHMARK(PixelViewFill)->Range(32, 512);
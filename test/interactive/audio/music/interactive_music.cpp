@@ -2,6 +2,7 @@
 #include <utility>  // move
 
 #include "centurion.hpp"
+#include "scripted_session.hpp"
 
 namespace {
 
@@ -79,12 +80,12 @@ class interactive_music final
     // clang-format on
   }
 
-  auto run() -> int
+  auto run(scripted_session& session) -> int
   {
     const auto messages = messages::make(m_renderer);
     m_window.show();
 
-    while (m_running)
+    while (m_running && session.next_frame(m_renderer))
     {
       m_dispatcher.poll();
       render(messages);
@@ -178,9 +179,12 @@ class interactive_music final
 
 }  // namespace
 
-auto main(int, char**) -> int
+auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   const cen::library centurion;
   interactive_music demo;
-  return demo.run();
+
+  const auto result = demo.run(session);
+  return (result == 0) ? session.finish("music") : result;
 }
\ No newline at end of file
@@ -1,7 +1,9 @@
-#include <array>    // array
-#include <cstddef>  // size_t
+#include <array>     // array
+#include <cstddef>   // size_t
+#include <optional>  // optional
 
 #include "centurion.hpp"
+#include "scripted_session.hpp"
 
 namespace {
 
@@ -39,17 +41,25 @@ class interactive_controller final
     // clang-format on
   }
 
-  auto run() -> int
+  auto run(scripted_session& session) -> int
   {
-    cen::controller controller;
+    // Scripted runs replay the controller input, so they don't need a controller
+    std::optional<cen::controller> controller;
+    if (cen::controller::count() > 0)
+    {
+      controller.emplace();
+    }
 
     m_window.show();
 
-    while (m_running)
+    while (m_running && session.next_frame(m_renderer))
     {
       m_dispatcher.poll();
 
-      controller.set_led(m_currentColor);
+      if (controller)
+      {
+        controller->set_led(m_currentColor);
+      }
 
       m_rect.set_x(m_rect.x() + m_dx);
       m_rect.set_y(m_rect.y() + m_dy);
@@ -128,9 +138,12 @@ class interactive_controller final
 
 }  // namespace
 
-auto main(int, char**) -> int
+auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   const cen::library lib;
   interactive_controller demo;
-  return demo.run();
+
+  const auto result = demo.run(session);
+  return (result == 0) ? session.finish("controller") : result;
 }
\ No newline at end of file
@@ -0,0 +1,576 @@
+#ifndef CENTURION_INTERACTIVE_SCRIPTED_SESSION_HEADER
+#define CENTURION_INTERACTIVE_SCRIPTED_SESSION_HEADER
+
+#include <SDL.h>
+
+#include <algorithm>    // stable_sort
+#include <cstddef>      // size_t
+#include <cstdlib>      // strtod, strtoul
+#include <cstring>      // strcmp, strncpy
+#include <fstream>      // ifstream, ofstream
+#include <iomanip>      // setprecision
+#include <sstream>      // istringstream
+#include <string>       // string, getline
+#include <string_view>  // string_view
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "centurion.hpp"
+
+/*
+ * Runs the interactive tests as scripted performance tests, which don't need a user.
+ *
+ * Without arguments, the tests remain manual. The following arguments are recognized:
+ *
+ *   --frames <n>           Stops after n frames, which enables the scripted mode.
+ *   --warmup <n>           Excludes the first n frames from the results, 10 by default.
+ *   --headless             Uses the dummy video and audio drivers.
+ *   --video-driver <name>  Uses another video driver, e.g. "offscreen" for OpenGL.
+ *   --replay <file>        Replays recorded input.
+ *   --record <file>        Records the input of a manual run, for later replay.
+ *   --baseline <file>      Compares the results with a baseline, created if missing.
+ *   --update-baseline      Overwrites the baseline with the results.
+ *   --time-tolerance <f>   The allowed relative increase of frame times, 0.25 by default.
+ *   --count-tolerance <f>  The allowed relative increase of counters, 0 by default.
+ *
+ * Every line of a replay is an input event, prefixed by the frame in which it's
+ * handled, e.g. "12 key_down 4 0". Baselines contain one "name value" pair per line.
+ * The renderer counters are only collected if CENTURION_ENABLE_RENDER_STATS is defined.
+ *
+ * Replayed input is pushed to the event queue, so it doesn't affect the state of the
+ * keyboard and mouse, which is fine since the scenes only react to events.
+ */
+class scripted_session final
+{
+ public:
+  scripted_session(const int argc, char** argv)
+  {
+    const char* videoDriver{};
+
+    for (auto i = 1; i < argc; ++i)
+    {
+      const std::string_view arg{argv[i]};
+      const auto hasValue = i + 1 < argc;
+
+      if (arg == "--headless")
+      {
+        videoDriver = (videoDriver) ? videoDriver : "dummy";
+        SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+      }
+      else if (arg == "--update-baseline")
+      {
+        m_updateBaseline = true;
+      }
+      else if (!hasValue)
+      {
+        continue;
+      }
+      else if (arg == "--frames")
+      {
+        m_frames = std::strtoul(argv[++i], nullptr, 10);
+        m_scripted = true;
+      }
+      else if (arg == "--warmup")
+      {
+        m_warmup = std::strtoul(argv[++i], nullptr, 10);
+      }
+      else if (arg == "--video-driver")
+      {
+        videoDriver = argv[++i];
+      }
+      else if (arg == "--replay")
+      {
+        load_replay(argv[++i]);
+      }
+      else if (arg == "--record")
+      {
+        m_recordPath = argv[++i];
+      }
+      else if (arg == "--baseline")
+      {
+        m_baselinePath = argv[++i];
+      }
+      else if (arg == "--time-tolerance")
+      {
+        m_timeTolerance = std::strtod(argv[++i], nullptr);
+      }
+      else if (arg == "--count-tolerance")
+      {
+        m_countTolerance = std::strtod(argv[++i], nullptr);
+      }
+    }
+
+    if (videoDriver)
+    {
+      SDL_setenv("SDL_VIDEODRIVER", videoDriver, 1);
+    }
+
+    // The frame times are meaningless if presenting waits for the display
+    if (m_scripted)
+    {
+      cen::set_hint<cen::hint::vsync>(false);
+    }
+  }
+
+  scripted_session(const scripted_session&) = delete;
+  auto operator=(const scripted_session&) -> scripted_session& = delete;
+
+  ~scripted_session() noexcept
+  {
+    SDL_DelEventWatch(&on_event, this);
+  }
+
+  // Starts the next frame, call at the start of every iteration of the game loop
+  [[nodiscard]] auto next_frame() -> bool
+  {
+    if (m_frame == 0 && !m_recordPath.empty())
+    {
+      SDL_AddEventWatch(&on_event, this);
+    }
+
+    if (m_frame >= m_warmup)
+    {
+      m_stats.tick();
+    }
+
+    if (m_scripted && m_frame == m_frames)
+    {
+      return false;
+    }
+
+    for (; m_nextInput < m_replay.size(); ++m_nextInput)
+    {
+      auto& input = m_replay[m_nextInput];
+      if (input.frame != m_frame)
+      {
+        break;
+      }
+
+      SDL_PushEvent(&input.event);
+    }
+
+    ++m_frame;
+    return true;
+  }
+
+  // Also collects the renderer counters of the previous frame
+  template <typename Renderer>
+  [[nodiscard]] auto next_frame(const Renderer& renderer) -> bool
+  {
+    if (m_frame > m_warmup)
+    {
+      const auto stats = renderer.stats();
+      m_counters.clears += stats.clears;
+      m_counters.draw_calls += stats.draw_calls();
+      m_counters.texture_switches += stats.texture_switches;
+      m_counters.state_changes += stats.color_changes + stats.blend_changes +
+                                  stats.target_changes + stats.clip_changes +
+                                  stats.viewport_changes;
+      m_counters.vertices += stats.vertices;
+      m_counters.text_textures += stats.text_textures;
+    }
+
+    return next_frame();
+  }
+
+  // Reports the results, and returns the exit code of the test
+  [[nodiscard]] auto finish(const char* scene) -> int
+  {
+    SDL_DelEventWatch(&on_event, this);
+    save_recording();
+
+    const auto summary = m_stats.summary();
+    const auto measured = (m_frame > m_warmup) ? m_frame - m_warmup : 0u;
+
+    const std::vector<metric> results{
+        {"frames", static_cast<double>(measured), metric_kind::exact},
+        {"mean_ms", summary.mean.count(), metric_kind::time},
+        {"p95_ms", summary.p95.count(), metric_kind::time},
+        {"p99_ms", summary.p99.count(), metric_kind::time},
+        {"clears", static_cast<double>(m_counters.clears), metric_kind::count},
+        {"draw_calls", static_cast<double>(m_counters.draw_calls), metric_kind::count},
+        {"texture_switches",
+         static_cast<double>(m_counters.texture_switches),
+         metric_kind::count},
+        {"state_changes",
+         static_cast<double>(m_counters.state_changes),
+         metric_kind::count},
+        {"vertices", static_cast<double>(m_counters.vertices), metric_kind::count},
+        {"text_textures",
+         static_cast<double>(m_counters.text_textures),
+         metric_kind::count}};
+
+    cen::log::info("Results of scene '%s':", scene);
+    for (const auto& result : results)
+    {
+      cen::log::info("  %s: %f", result.name, result.value);
+    }
+
+    if (m_baselinePath.empty())
+    {
+      return m_failed ? 1 : 0;
+    }
+
+    std::vector<stored_metric> baseline;
+    if (m_updateBaseline || !load_baseline(baseline))
+    {
+      save_baseline(results);
+      cen::log::info("Wrote baseline '%s'", m_baselinePath.c_str());
+      return m_failed ? 1 : 0;
+    }
+
+    for (const auto& result : results)
+    {
+      const auto* expected = find(baseline, result.name);
+      if (!expected)
+      {
+        cen::log::warn("  %s: missing from the baseline", result.name);
+        continue;
+      }
+
+      if (!within_tolerance(result, expected->value))
+      {
+        cen::log::warn("  %s: regressed from %f to %f",
+                       result.name,
+                       expected->value,
+                       result.value);
+        m_failed = true;
+      }
+    }
+
+    return m_failed ? 1 : 0;
+  }
+
+  [[nodiscard]] auto is_scripted() const noexcept -> bool
+  {
+    return m_scripted;
+  }
+
+ private:
+  enum class metric_kind
+  {
+    exact,  // Must match the baseline
+    time,   // May increase by the time tolerance
+    count   // May increase by the count tolerance
+  };
+
+  struct metric final
+  {
+    const char* name{};
+    double value{};
+    metric_kind kind{};
+  };
+
+  struct stored_metric final
+  {
+    std::string name;
+    double value{};
+  };
+
+  struct counters final
+  {
+    cen::u64 clears{};
+    cen::u64 draw_calls{};
+    cen::u64 texture_switches{};
+    cen::u64 state_changes{};
+    cen::u64 vertices{};
+    cen::u64 text_textures{};
+  };
+
+  struct replayed_input final
+  {
+    std::size_t frame{};
+    SDL_Event event{};
+  };
+
+  std::vector<replayed_input> m_replay;  // Sorted by frame
+  std::size_t m_nextInput{};
+  std::vector<std::string> m_recording;
+  std::string m_recordPath;
+  std::string m_baselinePath;
+  cen::frame_stats<1024> m_stats;
+  counters m_counters;
+  std::size_t m_frame{};
+  std::size_t m_frames{};
+  std::size_t m_warmup{10};
+  double m_timeTolerance{0.25};
+  double m_countTolerance{0.0};
+  bool m_scripted{};
+  bool m_updateBaseline{};
+  bool m_failed{};
+
+  [[nodiscard]] auto within_tolerance(const metric& result, const double expected) const
+      -> bool
+  {
+    switch (result.kind)
+    {
+      case metric_kind::exact:
+        return result.value == expected;
+
+      case metric_kind::time:
+        return result.value <= expected * (1.0 + m_timeTolerance);
+
+      case metric_kind::count:
+        return result.value <= expected * (1.0 + m_countTolerance);
+    }
+
+    return false;
+  }
+
+  [[nodiscard]] static auto find(const std::vector<stored_metric>& metrics,
+                                 const std::string_view name) -> const stored_metric*
+  {
+    for (const auto& stored : metrics)
+    {
+      if (name == stored.name)
+      {
+        return &stored;
+      }
+    }
+
+    return nullptr;
+  }
+
+  void load_replay(const char* path)
+  {
+    std::ifstream stream{path};
+    if (!stream)
+    {
+      cen::log::warn("Failed to open replay '%s'", path);
+      m_failed = true;
+      return;
+    }
+
+    std::string line;
+    while (std::getline(stream, line))
+    {
+      if (line.empty() || line.front() == '#')
+      {
+        continue;
+      }
+
+      replayed_input input;
+      if (parse_input(line, input))
+      {
+        m_replay.push_back(input);
+      }
+      else
+      {
+        cen::log::warn("Invalid replay line: '%s'", line.c_str());
+        m_failed = true;
+      }
+    }
+
+    // Inputs of the same frame keep their order
+    std::stable_sort(m_replay.begin(),
+                     m_replay.end(),
+                     [](const replayed_input& a, const replayed_input& b) noexcept {
+                       return a.frame < b.frame;
+                     });
+  }
+
+  [[nodiscard]] static auto parse_input(const std::string& line, replayed_input& input)
+      -> bool
+  {
+    std::istringstream stream{line};
+
+    std::string kind;
+    if (!(stream >> input.frame >> kind))
+    {
+      return false;
+    }
+
+    auto& event = input.event;
+
+    if (kind == "quit")
+    {
+      event.type = SDL_QUIT;
+    }
+    else if (kind == "key_down" || kind == "key_up")
+    {
+      int scancode{};
+      int mod{};
+      stream >> scancode >> mod;
+
+      const auto pressed = kind == "key_down";
+      event.type = pressed ? SDL_KEYDOWN : SDL_KEYUP;
+      event.key.state = pressed ? SDL_PRESSED : SDL_RELEASED;
+      event.key.keysym.scancode = static_cast<SDL_Scancode>(scancode);
+      event.key.keysym.sym = SDL_GetKeyFromScancode(event.key.keysym.scancode);
+      event.key.keysym.mod = static_cast<Uint16>(mod);
+    }
+    else if (kind == "text")
+    {
+      // The text is the rest of the line, spaces included
+      std::string text;
+      stream.get();
+      std::getline(stream, text);
+
+      event.type = SDL_TEXTINPUT;
+      std::strncpy(event.text.text, text.c_str(), sizeof event.text.text - 1u);
+    }
+    else if (kind == "mouse_motion")
+    {
+      event.type = SDL_MOUSEMOTION;
+      stream >> event.motion.x >> event.motion.y;
+    }
+    else if (kind == "mouse_down" || kind == "mouse_up")
+    {
+      int button{};
+      stream >> button >> event.button.x >> event.button.y;
+
+      const auto pressed = kind == "mouse_down";
+      event.type = pressed ? SDL_MOUSEBUTTONDOWN : SDL_MOUSEBUTTONUP;
+      event.button.state = pressed ? SDL_PRESSED : SDL_RELEASED;
+      event.button.button = static_cast<Uint8>(button);
+      event.button.clicks = 1;
+    }
+    else if (kind == "wheel")
+    {
+      event.type = SDL_MOUSEWHEEL;
+      stream >> event.wheel.x >> event.wheel.y;
+    }
+    else if (kind == "axis")
+    {
+      int axis{};
+      int value{};
+      stream >> axis >> value;
+
+      event.type = SDL_CONTROLLERAXISMOTION;
+      event.caxis.axis = static_cast<Uint8>(axis);
+      event.caxis.value = static_cast<Sint16>(value);
+    }
+    else if (kind == "button_down" || kind == "button_up")
+    {
+      int button{};
+      stream >> button;
+
+      const auto pressed = kind == "button_down";
+      event.type = pressed ? SDL_CONTROLLERBUTTONDOWN : SDL_CONTROLLERBUTTONUP;
+      event.cbutton.state = pressed ? SDL_PRESSED : SDL_RELEASED;
+      event.cbutton.button = static_cast<Uint8>(button);
+    }
+    else
+    {
+      return false;
+    }
+
+    return !stream.fail();
+  }
+
+  void record(const SDL_Event& event)
+  {
+    // The event is handled by the frame that is currently running
+    auto line = std::to_string(m_frame - 1u) + ' ';
+
+    switch (event.type)
+    {
+      case SDL_QUIT:
+        line += "quit";
+        break;
+
+      case SDL_KEYDOWN:
+      case SDL_KEYUP:
+        if (event.key.repeat)
+        {
+          return;
+        }
+
+        line += (event.type == SDL_KEYDOWN) ? "key_down " : "key_up ";
+        line += std::to_string(event.key.keysym.scancode) + ' ';
+        line += std::to_string(event.key.keysym.mod);
+        break;
+
+      case SDL_TEXTINPUT:
+        line += "text ";
+        line += event.text.text;
+        break;
+
+      case SDL_MOUSEMOTION:
+        line += "mouse_motion " + std::to_string(event.motion.x) + ' ' +
+                std::to_string(event.motion.y);
+        break;
+
+      case SDL_MOUSEBUTTONDOWN:
+      case SDL_MOUSEBUTTONUP:
+        line += (event.type == SDL_MOUSEBUTTONDOWN) ? "mouse_down " : "mouse_up ";
+        line += std::to_string(event.button.button) + ' ' +
+                std::to_string(event.button.x) + ' ' + std::to_string(event.button.y);
+        break;
+
+      case SDL_MOUSEWHEEL:
+        line += "wheel " + std::to_string(event.wheel.x) + ' ' +
+                std::to_string(event.wheel.y);
+        break;
+
+      case SDL_CONTROLLERAXISMOTION:
+        line += "axis " + std::to_string(event.caxis.axis) + ' ' +
+                std::to_string(event.caxis.value);
+        break;
+
+      case SDL_CONTROLLERBUTTONDOWN:
+      case SDL_CONTROLLERBUTTONUP:
+        line += (event.type == SDL_CONTROLLERBUTTONDOWN) ? "button_down "
+                                                         : "button_up ";
+        line += std::to_string(event.cbutton.button);
+        break;
+
+      default:
+        return;
+    }
+
+    m_recording.push_back(std::move(line));
+  }
+
+  void save_recording() const
+  {
+    if (m_recordPath.empty())
+    {
+      return;
+    }
+
+    std::ofstream stream{m_recordPath};
+    for (const auto& line : m_recording)
+    {
+      stream << line << '\n';
+    }
+
+    cen::log::info("Wrote %zu inputs to '%s'", m_recording.size(), m_recordPath.c_str());
+  }
+
+  [[nodiscard]] auto load_baseline(std::vector<stored_metric>& baseline) const -> bool
+  {
+    std::ifstream stream{m_baselinePath};
+    if (!stream)
+    {
+      return false;
+    }
+
+    stored_metric stored;
+    while (stream >> stored.name >> stored.value)
+    {
+      baseline.push_back(stored);
+    }
+
+    return true;
+  }
+
+  void save_baseline(const std::vector<metric>& results) const
+  {
+    std::ofstream stream{m_baselinePath};
+    stream << std::fixed << std::setprecision(4);
+
+    for (const auto& result : results)
+    {
+      stream << result.name << ' ' << result.value << '\n';
+    }
+  }
+
+  static auto SDLCALL on_event(void* data, SDL_Event* event) noexcept -> int
+  {
+    static_cast<scripted_session*>(data)->record(*event);
+    return 0;
+  }
+};
+
+#endif  // CENTURION_INTERACTIVE_SCRIPTED_SESSION_HEADER
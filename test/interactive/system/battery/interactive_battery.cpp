@@ -1,4 +1,5 @@
 #include "centurion.hpp"
+#include "scripted_session.hpp"
 
 namespace {
 
@@ -99,12 +100,12 @@ class battery_demo final
     store(id_state_charged, msg_state_charged);
   }
 
-  auto run() -> int
+  auto run(scripted_session& session) -> int
   {
     m_window.show();
 
     cen::event event;
-    while (m_running)
+    while (m_running && session.next_frame(m_renderer))
     {
       while (event.poll())
       {
@@ -194,9 +195,12 @@ class battery_demo final
 
 }  // namespace
 
-auto main(int, char**) -> int
+auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   cen::library centurion;
   battery_demo demo;
-  return demo.run();
+
+  const auto result = demo.run(session);
+  return (result == 0) ? session.finish("battery") : result;
 }
@@ -1,4 +1,5 @@
 #include "centurion.hpp"
+#include "scripted_session.hpp"
 
 namespace {
 
@@ -47,12 +48,12 @@ class cpu_demo final
                                m_renderer);
   }
 
-  auto run() -> int
+  auto run(scripted_session& session) -> int
   {
     cen::event event;
     m_window.show();
 
-    while (m_running)
+    while (m_running && session.next_frame(m_renderer))
     {
       while (event.poll())
       {
@@ -93,9 +94,12 @@ class cpu_demo final
 
 }  // namespace
 
-auto main(int, char**) -> int
+auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   cen::library centurion;
   cpu_demo demo;
-  return demo.run();
+
+  const auto result = demo.run(session);
+  return (result == 0) ? session.finish("cpu") : result;
 }
\ No newline at end of file
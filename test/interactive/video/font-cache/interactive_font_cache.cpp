@@ -2,6 +2,8 @@
 #include <string>       // string
 #include <string_view>  // sv
 
+#include "scripted_session.hpp"
+
 using namespace std::string_view_literals;
 
 namespace {
@@ -41,11 +43,11 @@ class interactive_font_cache final
     m_text.reserve(100u);
   }
 
-  auto run() -> int
+  auto run(scripted_session& session) -> int
   {
     m_window.show();
 
-    while (m_running)
+    while (m_running && session.next_frame(m_renderer))
     {
       m_dispatcher.poll();
       render();
@@ -129,9 +131,12 @@ class interactive_font_cache final
 
 }  // namespace
 
-auto main(int, char**) -> int
+auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   const cen::library centurion;
   interactive_font_cache demo;
-  return demo.run();
+
+  const auto result = demo.run(session);
+  return (result == 0) ? session.finish("font-cache") : result;
 }
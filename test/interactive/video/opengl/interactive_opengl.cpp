@@ -1,10 +1,11 @@
 #include <GL/glew.h>
 
 #include "centurion.hpp"
+#include "scripted_session.hpp"
 
 namespace {
 
-auto run() -> int
+auto run(scripted_session& session) -> int
 {
   cen::gl::set(cen::gl_attribute::context_major_version, 4);
   cen::gl::set(cen::gl_attribute::context_minor_version, 1);
@@ -21,7 +22,7 @@ auto run() -> int
   cen::event event;
   bool running{true};
 
-  while (running)
+  while (running && session.next_frame())
   {
     while (event.poll())
     {
@@ -47,7 +48,10 @@ auto run() -> int
 
 auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   cen::library centurion;
   cen::gl_library opengl;
-  return run();
+
+  const auto result = run(session);
+  return (result == 0) ? session.finish("opengl") : result;
 }
@@ -1,8 +1,9 @@
 #include "centurion.hpp"
+#include "scripted_session.hpp"
 
 namespace {
 
-auto run() -> int
+auto run(scripted_session& session) -> int
 {
   cen::window window{"Renderer demo"};
   cen::renderer renderer{window};
@@ -17,7 +18,7 @@ auto run() -> int
 
   window.show();
 
-  while (running)
+  while (running && session.next_frame(renderer))
   {
     while (event.poll())
     {
@@ -59,6 +60,9 @@ auto run() -> int
 
 auto main(int argc, char** argv) -> int
 {
+  scripted_session session{argc, argv};
   const cen::library centurion;
-  return run();
+
+  const auto result = run(session);
+  return (result == 0) ? session.finish("renderer") : result;
 }
@@ -17,6 +17,7 @@ class CenturionTest : public testing::Test
     IMG_Init_fake.return_val = cfg.imageFlags;
     Mix_Init_fake.return_val = cfg.mixerFlags;
     Mix_OpenAudio_fake.return_val = 0;
+    SDL_GetPerformanceFrequency_fake.return_val = 1'000;
   }
 };
 
@@ -75,3 +76,69 @@ TEST_F(CenturionTest, SDLMixOpenFailure)
   Mix_OpenAudio_fake.return_val = -1;
   ASSERT_THROW(cen::library{}, cen::mix_error);
 }
+
+TEST_F(CenturionTest, Timings)
+{
+  const cen::library library;
+
+  const auto& timings = library.timings();
+  ASSERT_EQ(4u, timings.size());
+  ASSERT_STREQ("SDL", timings.at(0).name);
+  ASSERT_STREQ("SDL_image", timings.at(1).name);
+  ASSERT_STREQ("SDL_ttf", timings.at(2).name);
+  ASSERT_STREQ("SDL_mixer", timings.at(3).name);
+
+  constexpr cen::config cfg;
+  ASSERT_EQ(cfg.coreFlags, timings.at(0).flags);
+}
+
+TEST_F(CenturionTest, DeferredSubsystems)
+{
+  cen::config cfg;
+  cfg.deferredFlags = SDL_INIT_GAMECONTROLLER | SDL_INIT_HAPTIC;
+
+  cen::library library{cfg};
+  ASSERT_EQ(cfg.coreFlags & ~cfg.deferredFlags, SDL_Init_fake.arg0_val);
+  ASSERT_EQ(0u, SDL_InitSubSystem_fake.call_count);
+
+  library.require(SDL_INIT_GAMECONTROLLER | SDL_INIT_HAPTIC);
+  ASSERT_EQ(2u, SDL_InitSubSystem_fake.call_count);
+  ASSERT_EQ(static_cast<Uint32>(SDL_INIT_HAPTIC), SDL_InitSubSystem_fake.arg0_history[0]);
+  ASSERT_EQ(static_cast<Uint32>(SDL_INIT_GAMECONTROLLER),
+            SDL_InitSubSystem_fake.arg0_history[1]);
+
+  ASSERT_EQ(6u, library.timings().size());
+  ASSERT_STREQ("game controller", library.timings().back().name);
+
+  // Subsystems that are already initialized are skipped
+  SDL_WasInit_fake.return_val = SDL_INIT_VIDEO;
+  library.require(SDL_INIT_VIDEO);
+  ASSERT_EQ(2u, SDL_InitSubSystem_fake.call_count);
+}
+
+TEST_F(CenturionTest, DeferredSubsystemFailure)
+{
+  cen::config cfg;
+  cfg.deferredFlags = SDL_INIT_SENSOR;
+
+  cen::library library{cfg};
+
+  SDL_InitSubSystem_fake.return_val = -1;
+  ASSERT_THROW(library.require(SDL_INIT_SENSOR), cen::sdl_error);
+}
+
+TEST_F(CenturionTest, DeferredMixer)
+{
+  cen::config cfg;
+  cfg.deferMixer = true;
+
+  cen::library library{cfg};
+  ASSERT_EQ(0u, Mix_Init_fake.call_count);
+  ASSERT_EQ(0u, Mix_OpenAudio_fake.call_count);
+
+  library.require_mixer();
+  library.require_mixer();
+  ASSERT_EQ(1u, Mix_Init_fake.call_count);
+  ASSERT_EQ(1u, Mix_OpenAudio_fake.call_count);
+  ASSERT_STREQ("SDL_mixer", library.timings().back().name);
+}
@@ -7,6 +7,8 @@
 // clang-format off
 extern "C" {
 DEFINE_FAKE_VALUE_FUNC(int, SDL_Init, Uint32)
+DEFINE_FAKE_VALUE_FUNC(int, SDL_InitSubSystem, Uint32)
+DEFINE_FAKE_VALUE_FUNC(Uint32, SDL_WasInit, Uint32)
 DEFINE_FAKE_VALUE_FUNC(int, TTF_Init)
 DEFINE_FAKE_VALUE_FUNC(int, IMG_Init, int)
 DEFINE_FAKE_VALUE_FUNC(int, Mix_Init, int)
@@ -23,6 +25,8 @@ DEFINE_FAKE_VOID_FUNC(SDL_DestroyWindow, SDL_Window*)
 DEFINE_FAKE_VOID_FUNC(SDL_FreeSurface, SDL_Surface*)
 
 DEFINE_FAKE_VALUE_FUNC(const char*, SDL_GetError);
+DEFINE_FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceCounter)
+DEFINE_FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceFrequency)
 DEFINE_FAKE_VALUE_FUNC(SDL_RWops*, SDL_RWFromFile, const char*, const char*)
 
 DEFINE_FAKE_VALUE_FUNC(Uint32, SDL_GetWindowFlags, SDL_Window*)
@@ -34,6 +38,10 @@ namespace mocks {
 void reset_core()
 {
   RESET_FAKE(SDL_Init)
+  RESET_FAKE(SDL_InitSubSystem)
+  RESET_FAKE(SDL_WasInit)
+  RESET_FAKE(SDL_GetPerformanceCounter)
+  RESET_FAKE(SDL_GetPerformanceFrequency)
   RESET_FAKE(TTF_Init)
   RESET_FAKE(IMG_Init)
   RESET_FAKE(Mix_OpenAudio)
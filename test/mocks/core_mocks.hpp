@@ -7,6 +7,8 @@
 extern "C" {
 // Initialization
 DECLARE_FAKE_VALUE_FUNC(int, SDL_Init, Uint32)
+DECLARE_FAKE_VALUE_FUNC(int, SDL_InitSubSystem, Uint32)
+DECLARE_FAKE_VALUE_FUNC(Uint32, SDL_WasInit, Uint32)
 DECLARE_FAKE_VALUE_FUNC(int, TTF_Init)
 DECLARE_FAKE_VALUE_FUNC(int, IMG_Init, int)
 DECLARE_FAKE_VALUE_FUNC(int, Mix_Init, int)
@@ -24,6 +26,8 @@ DECLARE_FAKE_VOID_FUNC(SDL_DestroyWindow, SDL_Window*)
 DECLARE_FAKE_VOID_FUNC(SDL_FreeSurface, SDL_Surface*)
 
 // Misc
+DECLARE_FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceCounter)
+DECLARE_FAKE_VALUE_FUNC(Uint64, SDL_GetPerformanceFrequency)
 DECLARE_FAKE_VALUE_FUNC(const char*, SDL_GetError)
 DECLARE_FAKE_VALUE_FUNC(SDL_RWops*, SDL_RWFromFile, const char*, const char*)
 
@@ -8,6 +8,7 @@
 #include "core/exception.hpp"
 #include "core/integers.hpp"
 #include "core_mocks.hpp"
+#include "input/controller_snapshot.hpp"
 #include "video/colors.hpp"
 
 using namespace cen::literals;
@@ -73,6 +74,12 @@ FAKE_VALUE_FUNC(SDL_bool, SDL_GameControllerHasLED, SDL_GameController*)
 }
 // clang-format on
 
+// Defined by the joystick tests
+extern "C" {
+DECLARE_FAKE_VOID_FUNC(SDL_LockJoysticks)
+DECLARE_FAKE_VOID_FUNC(SDL_UnlockJoysticks)
+}
+
 class ControllerTest : public testing::Test
 {
  protected:
@@ -119,6 +126,8 @@ class ControllerTest : public testing::Test
     RESET_FAKE(SDL_GameControllerGetSensorData)
     RESET_FAKE(SDL_GameControllerSetLED)
     RESET_FAKE(SDL_GameControllerHasLED)
+    RESET_FAKE(SDL_LockJoysticks)
+    RESET_FAKE(SDL_UnlockJoysticks)
 
 #if SDL_VERSION_ATLEAST(2, 0, 12)
     RESET_FAKE(SDL_GameControllerGetType)
@@ -558,3 +567,66 @@ TEST_F(ControllerTest, HasLED)
 }
 
 #endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+TEST_F(ControllerTest, CaptureSnapshot)
+{
+  SDL_GameControllerGetAttached_fake.return_val = SDL_TRUE;
+  SDL_GameControllerGetButton_fake.custom_fake =
+      [](SDL_GameController*, const SDL_GameControllerButton button) -> Uint8 {
+    return (button == SDL_CONTROLLER_BUTTON_A || button == SDL_CONTROLLER_BUTTON_X)
+               ? SDL_PRESSED
+               : SDL_RELEASED;
+  };
+  SDL_GameControllerGetAxis_fake.custom_fake =
+      [](SDL_GameController*, const SDL_GameControllerAxis axis) -> Sint16 {
+    return static_cast<Sint16>(axis * 100);
+  };
+
+  const auto snapshot = cen::capture_snapshot(m_controller);
+  ASSERT_EQ(1, SDL_LockJoysticks_fake.call_count);
+  ASSERT_EQ(1, SDL_UnlockJoysticks_fake.call_count);
+  ASSERT_EQ(SDL_CONTROLLER_BUTTON_MAX, SDL_GameControllerGetButton_fake.call_count);
+  ASSERT_EQ(SDL_CONTROLLER_AXIS_MAX, SDL_GameControllerGetAxis_fake.call_count);
+
+  ASSERT_TRUE(snapshot.attached);
+  ASSERT_TRUE(snapshot.is_pressed(cen::controller_button::a));
+  ASSERT_TRUE(snapshot.is_pressed(cen::controller_button::x));
+  ASSERT_TRUE(snapshot.is_released(cen::controller_button::b));
+  ASSERT_EQ(0, snapshot.axis(cen::controller_axis::left_x));
+  ASSERT_EQ(300, snapshot.axis(cen::controller_axis::right_y));
+}
+
+TEST_F(ControllerTest, CaptureSnapshots)
+{
+  std::array<cen::controller_handle, 3> controllers{cen::controller_handle{nullptr},
+                                                    cen::controller_handle{nullptr},
+                                                    cen::controller_handle{nullptr}};
+  std::array<cen::controller_snapshot, 3> snapshots;
+
+  const auto end =
+      cen::capture_snapshots(controllers.begin(), controllers.end(), snapshots.begin());
+  ASSERT_EQ(snapshots.end(), end);
+
+  // The joysticks are only locked once for all controllers
+  ASSERT_EQ(1, SDL_LockJoysticks_fake.call_count);
+  ASSERT_EQ(1, SDL_UnlockJoysticks_fake.call_count);
+  ASSERT_EQ(3 * SDL_CONTROLLER_BUTTON_MAX, SDL_GameControllerGetButton_fake.call_count);
+}
+
+TEST_F(ControllerTest, DiffSnapshots)
+{
+  cen::controller_snapshot previous;
+  previous.buttons = (1u << SDL_CONTROLLER_BUTTON_A) | (1u << SDL_CONTROLLER_BUTTON_B);
+
+  cen::controller_snapshot current;
+  current.buttons = (1u << SDL_CONTROLLER_BUTTON_B) | (1u << SDL_CONTROLLER_BUTTON_Y);
+
+  const auto diff = cen::diff_snapshots(previous, current);
+  ASSERT_TRUE(diff.any());
+  ASSERT_TRUE(diff.just_pressed(cen::controller_button::y));
+  ASSERT_TRUE(diff.just_released(cen::controller_button::a));
+  ASSERT_FALSE(diff.just_pressed(cen::controller_button::b));
+  ASSERT_FALSE(diff.just_released(cen::controller_button::b));
+
+  ASSERT_FALSE(cen::diff_snapshots(current, current).any());
+}
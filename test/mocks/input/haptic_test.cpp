@@ -7,6 +7,7 @@
 #include <iostream>  // cout
 
 #include "core_mocks.hpp"
+#include "input/haptic_effect_cache.hpp"
 
 extern "C" {
 // clang-format off
@@ -585,3 +586,136 @@ TEST_F(HapticTest, StreamOperator)
   SDL_HapticName_fake.return_val = "foo";
   std::cout << "COUT: " << m_haptic << '\n';
 }
+
+TEST_F(HapticTest, EffectCacheReuse)
+{
+  SDL_HapticNumEffects_fake.return_val = 8;
+
+  std::array ids{4, 7};
+  SET_RETURN_SEQ(SDL_HapticNewEffect, ids.data(), cen::isize(ids));
+
+  cen::haptic_effect_cache cache{m_haptic};
+  ASSERT_EQ(8u, cache.capacity());
+
+  cen::haptic_constant hit;
+  hit.representation().level = 1'000;
+
+  // Identical effects are only uploaded once
+  ASSERT_EQ(4, cache.play(hit));
+  ASSERT_EQ(4, cache.play(hit));
+  ASSERT_EQ(1, SDL_HapticNewEffect_fake.call_count);
+  ASSERT_EQ(2, SDL_HapticRunEffect_fake.call_count);
+
+  cen::haptic_constant stronger;
+  stronger.representation().level = 2'000;
+
+  ASSERT_EQ(7, cache.play(stronger));
+  ASSERT_EQ(4, cache.acquire(hit));
+  ASSERT_EQ(2, SDL_HapticNewEffect_fake.call_count);
+  ASSERT_EQ(0, SDL_HapticUpdateEffect_fake.call_count);
+  ASSERT_EQ(2u, cache.size());
+
+  cache.clear();
+  ASSERT_EQ(0u, cache.size());
+  ASSERT_EQ(2, SDL_HapticDestroyEffect_fake.call_count);
+}
+
+TEST_F(HapticTest, EffectCacheKeys)
+{
+  SDL_HapticNumEffects_fake.return_val = 8;
+
+  std::array ids{1, 2};
+  SET_RETURN_SEQ(SDL_HapticNewEffect, ids.data(), cen::isize(ids));
+
+  cen::haptic_effect_cache cache{m_haptic};
+
+  cen::haptic_left_right rumble;
+  rumble.set_large_magnitude(100);
+  ASSERT_EQ(1, cache.acquire(42, rumble));
+
+  // Changed parameters are updated in place
+  rumble.set_large_magnitude(200);
+  ASSERT_EQ(1, cache.play(42, rumble));
+  ASSERT_EQ(1, SDL_HapticUpdateEffect_fake.call_count);
+  ASSERT_EQ(1, SDL_HapticUpdateEffect_fake.arg1_val);
+
+  // The type of an uploaded effect can't be changed
+  cen::haptic_periodic periodic;
+  ASSERT_EQ(2, cache.acquire(42, periodic));
+  ASSERT_EQ(1, SDL_HapticUpdateEffect_fake.call_count);
+  ASSERT_EQ(1, SDL_HapticDestroyEffect_fake.call_count);
+  ASSERT_EQ(1u, cache.size());
+
+  ASSERT_TRUE(cache.release(42));
+  ASSERT_FALSE(cache.release(42));
+  ASSERT_EQ(0u, cache.size());
+}
+
+TEST_F(HapticTest, EffectCacheFull)
+{
+  SDL_HapticNumEffects_fake.return_val = 8;
+
+  std::array ids{3, 5};
+  SET_RETURN_SEQ(SDL_HapticNewEffect, ids.data(), cen::isize(ids));
+
+  cen::haptic_effect_cache cache{m_haptic, 2};
+  ASSERT_EQ(2u, cache.capacity());
+
+  cen::haptic_constant first;
+  first.representation().level = 1;
+
+  cen::haptic_ramp second;
+
+  cen::haptic_constant third;
+  third.representation().level = 3;
+
+  ASSERT_EQ(3, cache.acquire(first));
+  ASSERT_EQ(5, cache.acquire(second));
+  ASSERT_EQ(3, cache.acquire(first));
+
+  // The least recently used effect is the ramp, but the constant effect can be updated
+  ASSERT_EQ(3, cache.acquire(third));
+  ASSERT_EQ(2, SDL_HapticNewEffect_fake.call_count);
+  ASSERT_EQ(1, SDL_HapticUpdateEffect_fake.call_count);
+  ASSERT_EQ(2u, cache.size());
+}
+
+TEST_F(HapticTest, Timeline)
+{
+  SDL_HapticNumEffects_fake.return_val = 8;
+
+  std::array ids{0, 1};
+  SET_RETURN_SEQ(SDL_HapticNewEffect, ids.data(), cen::isize(ids));
+
+  cen::haptic_effect_cache cache{m_haptic};
+  cen::haptic_timeline timeline{cache};
+
+  cen::haptic_constant blast;
+  cen::haptic_left_right rumble;
+
+  timeline.add(100_ms, rumble, 3);
+  timeline.add(0_ms, blast);
+  timeline.add(100_ms, blast);
+  ASSERT_EQ(3u, timeline.size());
+
+  ASSERT_TRUE(timeline.preload());
+  ASSERT_EQ(2, SDL_HapticNewEffect_fake.call_count);
+
+  ASSERT_EQ(1u, timeline.advance(50_ms));
+  ASSERT_EQ(0, SDL_HapticRunEffect_fake.arg1_val);
+  ASSERT_FALSE(timeline.is_finished());
+
+  ASSERT_EQ(2u, timeline.advance(50_ms));
+  ASSERT_EQ(100_ms, timeline.elapsed());
+  ASSERT_TRUE(timeline.is_finished());
+
+  // Effects with the same offset are run in the order that they were added
+  ASSERT_EQ(1, SDL_HapticRunEffect_fake.arg1_history[1]);
+  ASSERT_EQ(3u, SDL_HapticRunEffect_fake.arg2_history[1]);
+  ASSERT_EQ(0, SDL_HapticRunEffect_fake.arg1_history[2]);
+  ASSERT_EQ(2, SDL_HapticNewEffect_fake.call_count);
+
+  timeline.restart();
+  ASSERT_FALSE(timeline.is_finished());
+  ASSERT_EQ(1u, timeline.advance(0_ms));
+}
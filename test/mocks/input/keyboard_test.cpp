@@ -9,16 +9,57 @@
 extern "C" {
 FAKE_VALUE_FUNC(const Uint8*, SDL_GetKeyboardState, int*)
 FAKE_VALUE_FUNC(SDL_bool, SDL_HasScreenKeyboardSupport)
+FAKE_VALUE_FUNC(SDL_Keycode, SDL_GetKeyFromScancode, SDL_Scancode)
+FAKE_VOID_FUNC(SDL_AddEventWatch, SDL_EventFilter, void*)
+FAKE_VOID_FUNC(SDL_DelEventWatch, SDL_EventFilter, void*)
 }
 // clang-format on
 
-TEST(Keyboard, Constructor)
+class KeyboardTest : public testing::Test
 {
-  [[maybe_unused]] cen::keyboard state;
-  ASSERT_EQ(1, SDL_GetKeyboardState_fake.call_count);
+ protected:
+  void SetUp() override
+  {
+    RESET_FAKE(SDL_GetKeyboardState)
+    RESET_FAKE(SDL_HasScreenKeyboardSupport)
+    RESET_FAKE(SDL_GetKeyFromScancode)
+    RESET_FAKE(SDL_AddEventWatch)
+    RESET_FAKE(SDL_DelEventWatch)
+  }
+};
+
+TEST_F(KeyboardTest, Constructor)
+{
+  {
+    [[maybe_unused]] cen::keyboard state;
+    ASSERT_EQ(1, SDL_GetKeyboardState_fake.call_count);
+    ASSERT_EQ(SDL_NUM_SCANCODES, SDL_GetKeyFromScancode_fake.call_count);
+    ASSERT_EQ(1, SDL_AddEventWatch_fake.call_count);
+  }
+
+  ASSERT_EQ(1, SDL_DelEventWatch_fake.call_count);
+  ASSERT_EQ(SDL_AddEventWatch_fake.arg1_val, SDL_DelEventWatch_fake.arg1_val);
+}
+
+TEST_F(KeyboardTest, KeymapChanged)
+{
+  cen::keyboard state;
+  ASSERT_EQ(SDL_NUM_SCANCODES, SDL_GetKeyFromScancode_fake.call_count);
+
+  // The watch only marks the table as stale, it's rebuilt by the next update
+  SDL_Event event{};
+  event.type = SDL_KEYMAPCHANGED;
+  SDL_AddEventWatch_fake.arg0_val(SDL_AddEventWatch_fake.arg1_val, &event);
+  ASSERT_EQ(SDL_NUM_SCANCODES, SDL_GetKeyFromScancode_fake.call_count);
+
+  state.update();
+  ASSERT_EQ(2 * SDL_NUM_SCANCODES, SDL_GetKeyFromScancode_fake.call_count);
+
+  state.update();
+  ASSERT_EQ(2 * SDL_NUM_SCANCODES, SDL_GetKeyFromScancode_fake.call_count);
 }
 
-TEST(Keyboard, HasScreenKeyboard)
+TEST_F(KeyboardTest, HasScreenKeyboard)
 {
   std::array values{SDL_FALSE, SDL_TRUE};
   SET_RETURN_SEQ(SDL_HasScreenKeyboardSupport, values.data(), cen::isize(values));
@@ -9,6 +9,16 @@
 
 extern "C" {
 FAKE_VALUE_FUNC(int, SDL_GL_MakeCurrent, SDL_Window*, SDL_GLContext)
+FAKE_VALUE_FUNC(SDL_GLContext, SDL_GL_CreateContext, SDL_Window*)
+}
+
+// Defined by the core tests
+extern "C" {
+DECLARE_FAKE_VOID_FUNC(SDL_GL_DeleteContext, void*)
+DECLARE_FAKE_VALUE_FUNC(int, SDL_GL_SetAttribute, SDL_GLattr, int)
+DECLARE_FAKE_VALUE_FUNC(int, SDL_GL_GetAttribute, SDL_GLattr, int*)
+DECLARE_FAKE_VALUE_FUNC(SDL_Window*, SDL_GL_GetCurrentWindow)
+DECLARE_FAKE_VALUE_FUNC(void*, SDL_GL_GetCurrentContext)
 }
 
 class OpenGLContextTest : public testing::Test
@@ -19,6 +29,12 @@ class OpenGLContextTest : public testing::Test
     mocks::reset_core();
 
     RESET_FAKE(SDL_GL_MakeCurrent)
+    RESET_FAKE(SDL_GL_CreateContext)
+    RESET_FAKE(SDL_GL_DeleteContext)
+    RESET_FAKE(SDL_GL_SetAttribute)
+    RESET_FAKE(SDL_GL_GetAttribute)
+    RESET_FAKE(SDL_GL_GetCurrentWindow)
+    RESET_FAKE(SDL_GL_GetCurrentContext)
   }
 
   cen::gl::context_handle m_context{nullptr};
@@ -43,3 +59,47 @@ TEST_F(OpenGLContextTest, MakeCurrent)
   ASSERT_EQ(cen::success, m_context.make_current(window));
   ASSERT_EQ(2, SDL_GL_MakeCurrent_fake.call_count);
 }
+
+TEST_F(OpenGLContextTest, Shared)
+{
+  std::array flags{cen::u32{cen::window::opengl}};
+  SET_RETURN_SEQ(SDL_GetWindowFlags, flags.data(), cen::isize(flags));
+
+  cen::window_handle window{nullptr};
+  ASSERT_THROW(cen::gl::context::shared(window), cen::cen_error);
+  ASSERT_EQ(0, SDL_GL_CreateContext_fake.call_count);
+
+  int current{};
+  SDL_GL_GetCurrentContext_fake.return_val = &current;
+  ASSERT_THROW(cen::gl::context::shared(window), cen::sdl_error);
+
+  int created{};
+  SDL_GL_CreateContext_fake.return_val = &created;
+  {
+    const auto context = cen::gl::context::shared(window);
+    ASSERT_EQ(&created, context.get());
+  }
+
+  ASSERT_EQ(2, SDL_GL_CreateContext_fake.call_count);
+  ASSERT_EQ(1, SDL_GL_DeleteContext_fake.call_count);
+
+  // The attribute is only enabled while the context is created
+  ASSERT_EQ(4, SDL_GL_SetAttribute_fake.call_count);
+  ASSERT_EQ(SDL_GL_SHARE_WITH_CURRENT_CONTEXT, SDL_GL_SetAttribute_fake.arg0_history[0]);
+  ASSERT_EQ(1, SDL_GL_SetAttribute_fake.arg1_history[0]);
+  ASSERT_EQ(0, SDL_GL_SetAttribute_fake.arg1_history[1]);
+
+  // The previously current context is restored
+  ASSERT_EQ(2, SDL_GL_MakeCurrent_fake.call_count);
+  ASSERT_EQ(&current, SDL_GL_MakeCurrent_fake.arg1_val);
+}
+
+TEST_F(OpenGLContextTest, ReleaseCurrent)
+{
+  std::array values{-1, 0};
+  SET_RETURN_SEQ(SDL_GL_MakeCurrent, values.data(), cen::isize(values));
+
+  ASSERT_EQ(cen::failure, cen::gl::context::release_current());
+  ASSERT_EQ(cen::success, cen::gl::context::release_current());
+  ASSERT_EQ(nullptr, SDL_GL_MakeCurrent_fake.arg1_val);
+}
@@ -7,6 +7,7 @@
 
 #include "core/integers.hpp"
 #include "core_mocks.hpp"
+#include "video/opengl/gl_function_table.hpp"
 
 extern "C" {
 FAKE_VALUE_FUNC(int, SDL_GL_LoadLibrary, const char*)
@@ -45,4 +46,31 @@ TEST_F(OpenGLLibraryTest, AddressOf)
   const auto* address [[maybe_unused]] = library.address_of("foo");
 
   ASSERT_EQ(1, SDL_GL_GetProcAddress_fake.call_count);
-}
\ No newline at end of file
+}
+
+TEST_F(OpenGLLibraryTest, FunctionTable)
+{
+  const auto empty = cen::gl::function_table::load();
+  ASSERT_FALSE(empty.is_complete());
+  ASSERT_FALSE(empty.missing().empty());
+  ASSERT_EQ(0u, empty.loaded_count());
+
+  // Every entry point is resolved exactly once
+  const auto entries = SDL_GL_GetProcAddress_fake.call_count;
+  ASSERT_NE(0u, entries);
+
+  int dummy{};
+  SDL_GL_GetProcAddress_fake.return_val = &dummy;
+
+  const auto table = cen::gl::function_table::load();
+  ASSERT_TRUE(table.is_complete());
+  ASSERT_TRUE(table.missing().empty());
+  ASSERT_EQ(entries, table.loaded_count());
+  ASSERT_NE(nullptr, table.gen_buffers);
+  ASSERT_NE(nullptr, table.buffer_storage);
+
+  ASSERT_NO_THROW(cen::gl::function_table::load_required());
+
+  SDL_GL_GetProcAddress_fake.return_val = nullptr;
+  ASSERT_THROW(cen::gl::function_table::load_required(), cen::cen_error);
+}
@@ -0,0 +1,67 @@
+#include "video/vulkan/vk_swapchain.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#if __has_include(<vulkan/vulkan.h>)
+
+TEST(VulkanSwapchain, ChoosePresentMode)
+{
+  const std::vector modes{VK_PRESENT_MODE_FIFO_KHR, VK_PRESENT_MODE_MAILBOX_KHR};
+  ASSERT_EQ(VK_PRESENT_MODE_MAILBOX_KHR, cen::vk::choose_present_mode(modes));
+  ASSERT_EQ(VK_PRESENT_MODE_FIFO_KHR, cen::vk::choose_present_mode(modes, false));
+
+  // FIFO is always supported, so it's used even if it isn't listed
+  const std::vector immediate{VK_PRESENT_MODE_IMMEDIATE_KHR};
+  ASSERT_EQ(VK_PRESENT_MODE_FIFO_KHR, cen::vk::choose_present_mode(immediate));
+  ASSERT_EQ(VK_PRESENT_MODE_FIFO_KHR, cen::vk::choose_present_mode({}));
+}
+
+TEST(VulkanSwapchain, ChooseSurfaceFormat)
+{
+  const VkSurfaceFormatKHR unorm{VK_FORMAT_B8G8R8A8_UNORM,
+                                 VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+  const VkSurfaceFormatKHR srgb{VK_FORMAT_R8G8B8A8_SRGB,
+                                VK_COLOR_SPACE_SRGB_NONLINEAR_KHR};
+  const VkSurfaceFormatKHR hdr{VK_FORMAT_A2B10G10R10_UNORM_PACK32,
+                               VK_COLOR_SPACE_HDR10_ST2084_EXT};
+
+  const std::vector formats{hdr, unorm, srgb};
+  ASSERT_EQ(srgb.format, cen::vk::choose_surface_format(formats).format);
+  ASSERT_EQ(unorm.format, cen::vk::choose_surface_format(formats, false).format);
+
+  // The color space must match as well
+  const VkSurfaceFormatKHR linear{VK_FORMAT_B8G8R8A8_SRGB,
+                                  VK_COLOR_SPACE_EXTENDED_SRGB_LINEAR_EXT};
+  const std::vector others{hdr, linear};
+  ASSERT_EQ(hdr.format, cen::vk::choose_surface_format(others).format);
+}
+
+TEST(VulkanSwapchain, ChooseExtent)
+{
+  VkSurfaceCapabilitiesKHR caps{};
+  caps.minImageExtent = {64, 32};
+  caps.maxImageExtent = {1'024, 512};
+
+  // The current extent of the surface takes precedence over the window
+  caps.currentExtent = {800, 400};
+  auto extent = cen::vk::choose_extent(caps, {100, 100});
+  ASSERT_EQ(800u, extent.width);
+  ASSERT_EQ(400u, extent.height);
+
+  caps.currentExtent = {UINT32_MAX, UINT32_MAX};
+  extent = cen::vk::choose_extent(caps, {640, 480});
+  ASSERT_EQ(640u, extent.width);
+  ASSERT_EQ(480u, extent.height);
+
+  extent = cen::vk::choose_extent(caps, {2'000, 10});
+  ASSERT_EQ(1'024u, extent.width);
+  ASSERT_EQ(32u, extent.height);
+
+  extent = cen::vk::choose_extent(caps, {-1, 0});
+  ASSERT_EQ(64u, extent.width);
+  ASSERT_EQ(32u, extent.height);
+}
+
+#endif  // __has_include(<vulkan/vulkan.h>)
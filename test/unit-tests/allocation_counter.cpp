@@ -0,0 +1,100 @@
+#include "allocation_counter.hpp"
+
+#include <cstdlib>  // malloc, free, aligned_alloc
+#include <new>      // bad_alloc, align_val_t
+
+#ifdef _WIN32
+#include <malloc.h>  // _aligned_malloc, _aligned_free
+#endif  // _WIN32
+
+// The global allocation functions are replaced, so that tests can check that code
+// doesn't allocate memory. The default array and nothrow forms call the basic forms,
+// so those aren't replaced.
+
+namespace {
+
+thread_local std::size_t heapAllocations = 0;
+thread_local int countingDepth = 0;
+
+void count_allocation() noexcept
+{
+  if (countingDepth > 0)
+  {
+    ++heapAllocations;
+  }
+}
+
+}  // namespace
+
+auto counted_heap_allocations() noexcept -> std::size_t
+{
+  return heapAllocations;
+}
+
+void begin_counting_heap_allocations() noexcept
+{
+  ++countingDepth;
+}
+
+void end_counting_heap_allocations() noexcept
+{
+  --countingDepth;
+}
+
+auto operator new(const std::size_t size) -> void*
+{
+  count_allocation();
+
+  if (auto* memory = std::malloc(size != 0 ? size : 1))
+  {
+    return memory;
+  }
+
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* memory) noexcept
+{
+  std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+  std::free(memory);
+}
+
+auto operator new(const std::size_t size, const std::align_val_t alignment) -> void*
+{
+  count_allocation();
+
+  const auto align = static_cast<std::size_t>(alignment);
+
+#ifdef _WIN32
+  auto* memory = _aligned_malloc(size != 0 ? size : 1, align);
+#else
+  // The size must be a multiple of the alignment
+  const auto padded = (size + align - 1u) / align * align;
+  auto* memory = std::aligned_alloc(align, padded != 0 ? padded : align);
+#endif  // _WIN32
+
+  if (memory)
+  {
+    return memory;
+  }
+
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* memory, const std::align_val_t) noexcept
+{
+#ifdef _WIN32
+  _aligned_free(memory);
+#else
+  std::free(memory);
+#endif  // _WIN32
+}
+
+void operator delete(void* memory, std::size_t, const std::align_val_t alignment) noexcept
+{
+  operator delete(memory, alignment);
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <cstddef>   // size_t
+#include <optional>  // optional
+
+#ifndef CEN_MOCKED_SDL
+#include "core/memory_functions.hpp"
+#endif  // CEN_MOCKED_SDL
+
+// The amount of calls to the global operator new made by the current thread while it's
+// counting, see allocation_counter.cpp
+[[nodiscard]] auto counted_heap_allocations() noexcept -> std::size_t;
+
+void begin_counting_heap_allocations() noexcept;
+void end_counting_heap_allocations() noexcept;
+
+// Counts the allocations made with operator new by the current thread, and the
+// allocations made through the SDL memory functions by any thread. The SDL memory
+// functions are faked by the mocks, so only operator new is counted there. Counters
+// can't be nested, since there can only be one allocation tracker at a time.
+class allocation_counter final
+{
+ public:
+  allocation_counter()
+  {
+#ifndef CEN_MOCKED_SDL
+    m_tracker.emplace();
+#endif  // CEN_MOCKED_SDL
+
+    begin_counting_heap_allocations();
+  }
+
+  allocation_counter(const allocation_counter&) = delete;
+  auto operator=(const allocation_counter&) -> allocation_counter& = delete;
+
+  ~allocation_counter() noexcept
+  {
+    end_counting_heap_allocations();
+  }
+
+  // The amount of calls to operator new
+  [[nodiscard]] auto heap_allocations() const noexcept -> std::size_t
+  {
+    return counted_heap_allocations() - m_heapOffset;
+  }
+
+  // The amount of calls to SDL_malloc(), SDL_calloc() and SDL_realloc()
+  [[nodiscard]] auto sdl_allocations() const noexcept -> std::size_t
+  {
+#ifndef CEN_MOCKED_SDL
+    const auto stats = m_tracker->stats();
+    return static_cast<std::size_t>(stats.allocations + stats.reallocations);
+#else
+    return 0;
+#endif  // CEN_MOCKED_SDL
+  }
+
+  [[nodiscard]] auto total() const noexcept -> std::size_t
+  {
+    return heap_allocations() + sdl_allocations();
+  }
+
+ private:
+#ifndef CEN_MOCKED_SDL
+  std::optional<cen::allocation_tracker> m_tracker;
+#endif  // CEN_MOCKED_SDL
+  std::size_t m_heapOffset{counted_heap_allocations()};
+};
+
+// Checks that a statement doesn't allocate any memory, e.g.
+//   EXPECT_NO_ALLOCATIONS({ dispatcher.dispatch(event); });
+#define CENTURION_CHECK_NO_ALLOCATIONS(Check, ...)                                      \
+  do                                                                                    \
+  {                                                                                     \
+    std::size_t cenHeapAllocations{};                                                   \
+    std::size_t cenSDLAllocations{};                                                    \
+    {                                                                                   \
+      const allocation_counter cenCounter;                                              \
+      __VA_ARGS__;                                                                      \
+      cenHeapAllocations = cenCounter.heap_allocations();                               \
+      cenSDLAllocations = cenCounter.sdl_allocations();                                 \
+    }                                                                                   \
+    Check(0u, cenHeapAllocations + cenSDLAllocations)                                   \
+        << "Allocations in: " #__VA_ARGS__ << "\n  operator new: " << cenHeapAllocations \
+        << "\n  SDL: " << cenSDLAllocations;                                            \
+  } while (false)
+
+#define EXPECT_NO_ALLOCATIONS(...) CENTURION_CHECK_NO_ALLOCATIONS(EXPECT_EQ, __VA_ARGS__)
+#define ASSERT_NO_ALLOCATIONS(...) CENTURION_CHECK_NO_ALLOCATIONS(ASSERT_EQ, __VA_ARGS__)
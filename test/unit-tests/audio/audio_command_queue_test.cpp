@@ -0,0 +1,80 @@
+#include "audio/audio_command_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+class AudioCommandQueueTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_sound = std::make_unique<cen::sound_effect>("resources/click.wav");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_sound.reset();
+  }
+
+  void TearDown() override
+  {
+    Mix_HaltChannel(-1);
+  }
+
+  inline static std::unique_ptr<cen::sound_effect> m_sound;
+};
+
+TEST_F(AudioCommandQueueTest, Defaults)
+{
+  const cen::audio_command_queue queue{100};
+  ASSERT_EQ(128u, queue.capacity());
+  ASSERT_EQ(0u, queue.size_approx());
+  ASSERT_FALSE(queue.is_attached());
+}
+
+TEST_F(AudioCommandQueueTest, Flush)
+{
+  cen::audio_command_queue queue;
+
+  // Nothing happens until the commands are applied
+  ASSERT_TRUE(queue.play(0, *m_sound, cen::sound_effect::forever));
+  ASSERT_TRUE(queue.set_volume(0, 64));
+  ASSERT_EQ(2u, queue.size_approx());
+  ASSERT_FALSE(Mix_Playing(0));
+
+  ASSERT_EQ(2u, queue.flush());
+  ASSERT_TRUE(Mix_Playing(0));
+
+  ASSERT_TRUE(queue.halt(0));
+  ASSERT_TRUE(Mix_Playing(0));
+
+  ASSERT_EQ(1u, queue.flush());
+  ASSERT_FALSE(Mix_Playing(0));
+
+  ASSERT_EQ(0u, queue.flush());
+}
+
+TEST_F(AudioCommandQueueTest, Full)
+{
+  cen::audio_command_queue queue{2};
+  ASSERT_TRUE(queue.pause(-1));
+  ASSERT_TRUE(queue.resume(-1));
+  ASSERT_FALSE(queue.halt(-1));
+
+  ASSERT_EQ(2u, queue.flush());
+  ASSERT_TRUE(queue.halt(-1));
+}
+
+TEST_F(AudioCommandQueueTest, Attach)
+{
+  cen::audio_command_queue queue;
+
+  ASSERT_TRUE(queue.attach());
+  ASSERT_TRUE(queue.is_attached());
+  ASSERT_FALSE(queue.attach());
+
+  ASSERT_TRUE(queue.detach());
+  ASSERT_FALSE(queue.is_attached());
+  ASSERT_FALSE(queue.detach());
+}
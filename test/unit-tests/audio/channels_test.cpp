@@ -0,0 +1,63 @@
+#include "audio/channels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+class SpatializerTest : public testing::Test
+{
+ protected:
+  [[nodiscard]] auto emitters() const noexcept -> cen::spatial_emitters
+  {
+    return {m_channels.data(), m_x.data(), m_y.data(), m_z.data(), m_channels.size()};
+  }
+
+  std::array<cen::channel_index, 4> m_channels{0, 1, 2, 3};
+  std::array<float, 4> m_x{0, 10, -10, 0};
+  std::array<float, 4> m_y{};
+  std::array<float, 4> m_z{0, 0, 0, 20};
+};
+
+TEST_F(SpatializerTest, Defaults)
+{
+  const cen::spatializer spatializer{50.0f};
+  ASSERT_EQ(50.0f, spatializer.range());
+  ASSERT_EQ(2, spatializer.threshold());
+}
+
+TEST_F(SpatializerTest, Update)
+{
+  cen::spatializer spatializer{50.0f};
+  const cen::spatial_listener listener;
+
+  ASSERT_EQ(4u, spatializer.update(listener, emitters()));
+
+  // Nothing moved
+  ASSERT_EQ(0u, spatializer.update(listener, emitters()));
+
+  // A change of the distance by less than the threshold is ignored
+  m_z[3] = 20.3f;
+  ASSERT_EQ(0u, spatializer.update(listener, emitters()));
+
+  m_z[3] = 40.0f;
+  ASSERT_EQ(1u, spatializer.update(listener, emitters()));
+
+  // Moving the listener affects every emitter
+  const cen::spatial_listener moved{{0, 0, 30}};
+  ASSERT_EQ(4u, spatializer.update(moved, emitters()));
+}
+
+TEST_F(SpatializerTest, Invalidate)
+{
+  cen::spatializer spatializer{50.0f};
+  const cen::spatial_listener listener;
+
+  ASSERT_EQ(4u, spatializer.update(listener, emitters()));
+
+  spatializer.invalidate(2);
+  spatializer.invalidate(42);  // Unknown channels are ignored
+  ASSERT_EQ(1u, spatializer.update(listener, emitters()));
+
+  spatializer.invalidate_all();
+  ASSERT_EQ(4u, spatializer.update(listener, emitters()));
+}
@@ -0,0 +1,98 @@
+#include "audio/effect_chain.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+TEST(GainEffect, Constant)
+{
+  cen::gain_effect gain{0.5f};
+  ASSERT_EQ(0.5f, gain.gain());
+
+  std::vector<float> samples = {1.0f, -1.0f, 0.5f, 0.25f};
+  gain(cen::audio_block{samples.data(), 2, 2, 44'100});
+
+  ASSERT_EQ((std::vector<float>{0.5f, -0.5f, 0.25f, 0.125f}), samples);
+}
+
+TEST(GainEffect, Ramp)
+{
+  cen::gain_effect gain;
+  gain.set_gain(0.0f);
+  ASSERT_EQ(0.0f, gain.gain());
+
+  // The gain is interpolated over the four frames of the first block
+  std::vector<float> samples(8, 1.0f);
+  gain(cen::audio_block{samples.data(), 4, 2, 44'100});
+
+  ASSERT_EQ((std::vector<float>{0.75f, 0.75f, 0.5f, 0.5f, 0.25f, 0.25f, 0.0f, 0.0f}),
+            samples);
+
+  std::vector<float> silenced(8, 1.0f);
+  gain(cen::audio_block{silenced.data(), 4, 2, 44'100});
+  ASSERT_EQ(std::vector<float>(8, 0.0f), silenced);
+}
+
+TEST(EffectChain, Attach)
+{
+  cen::gain_effect gain;
+
+  cen::effect_chain chain;
+  chain.add(gain);
+  ASSERT_EQ(1u, chain.size());
+  ASSERT_FALSE(chain.is_attached());
+  ASSERT_FALSE(chain.detach());
+
+  ASSERT_TRUE(chain.attach_post_mix());
+  ASSERT_TRUE(chain.is_attached());
+  ASSERT_FALSE(chain.attach_post_mix());
+
+  ASSERT_TRUE(chain.detach());
+  ASSERT_FALSE(chain.is_attached());
+}
+
+TEST(EffectChain, Apply)
+{
+  int frequency{};
+  cen::u16 format{};
+  int channels{};
+  ASSERT_TRUE(Mix_QuerySpec(&frequency, &format, &channels));
+
+  std::size_t calls = 0;
+  std::size_t frames = 0;
+  auto counter = [&](const cen::audio_block& block) noexcept {
+    ++calls;
+    frames += block.frames;
+    ASSERT_EQ(channels, block.channels);
+    ASSERT_EQ(frequency, block.frequency);
+  };
+
+  cen::gain_effect gain{0.5f};
+
+  // The small blocks make the chain process the buffer in several steps
+  cen::effect_chain chain{64};
+  chain.add(gain);
+  chain.add(counter);
+  ASSERT_TRUE(chain.prepare());
+
+  const auto count = 200 * static_cast<std::size_t>(channels);
+  if (format == AUDIO_S16SYS)
+  {
+    std::vector<cen::i16> samples(count, 1'000);
+    chain.apply(samples.data(), samples.size() * sizeof(cen::i16));
+
+    ASSERT_EQ(std::vector<cen::i16>(count, 500), samples);
+    ASSERT_EQ(4u, calls);
+  }
+  else
+  {
+    std::vector<float> samples(count, 0.5f);
+    chain.apply(samples.data(), samples.size() * sizeof(float));
+
+    ASSERT_EQ(std::vector<float>(count, 0.25f), samples);
+    ASSERT_EQ(1u, calls);
+  }
+
+  ASSERT_EQ(200u, frames);
+}
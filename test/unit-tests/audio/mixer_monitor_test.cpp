@@ -0,0 +1,85 @@
+#include "audio/mixer_monitor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "thread/thread.hpp"
+
+TEST(MixerMonitor, Attach)
+{
+  cen::mixer_monitor monitor;
+  ASSERT_FALSE(monitor.is_attached());
+  ASSERT_FALSE(monitor.detach());
+
+  ASSERT_TRUE(monitor.attach());
+  ASSERT_TRUE(monitor.is_attached());
+  ASSERT_FALSE(monitor.attach());
+
+  ASSERT_TRUE(monitor.detach());
+  ASSERT_FALSE(monitor.is_attached());
+}
+
+TEST(MixerMonitor, Record)
+{
+  int frequency{};
+  cen::u16 format{};
+  int channels{};
+  ASSERT_TRUE(Mix_QuerySpec(&frequency, &format, &channels));
+
+  cen::mixer_monitor monitor;
+  ASSERT_TRUE(monitor.prepare());
+
+  const auto frames = 512u;
+  const auto count = frames * static_cast<std::size_t>(channels);
+  auto record = [&](const float sample) {
+    if (format == AUDIO_S16SYS)
+    {
+      std::vector<cen::i16> samples(count, static_cast<cen::i16>(sample * 32'767.0f));
+      monitor.record(samples.data(), samples.size() * sizeof(cen::i16), 3);
+    }
+    else
+    {
+      std::vector<float> samples(count, sample);
+      monitor.record(samples.data(), samples.size() * sizeof(float), 3);
+    }
+  };
+
+  record(-0.5f);
+  {
+    const auto stats = monitor.stats();
+    ASSERT_EQ(1u, stats.callbacks);
+    ASSERT_EQ(0u, stats.underruns);
+    ASSERT_EQ(frames, stats.buffer_frames);
+    ASSERT_DOUBLE_EQ(frames * 1'000.0 / frequency, stats.buffer_duration.count());
+    ASSERT_EQ(3, stats.active_channels);
+    ASSERT_NEAR(0.5f, stats.peak_level, 0.001f);
+    ASSERT_EQ(0u, stats.clipped_samples);
+    ASSERT_EQ(0.0, stats.load());
+  }
+
+  // The buffer is much shorter than the delay, so the second buffer is an underrun
+  cen::thread::sleep(cen::milliseconds<cen::u32>{100});
+  record(1.0f);
+  {
+    const auto stats = monitor.stats();
+    ASSERT_EQ(2u, stats.callbacks);
+    ASSERT_EQ(1u, stats.underruns);
+    ASSERT_GE(stats.max_interval.count(), 90.0);
+    ASSERT_EQ(stats.max_interval, stats.mean_interval);
+    ASSERT_GT(stats.load(), 1.5);
+    ASSERT_NEAR(1.0f, stats.peak_level, 0.001f);
+    ASSERT_EQ(count, stats.clipped_samples);
+  }
+
+  monitor.reset();
+  {
+    const auto stats = monitor.stats();
+    ASSERT_EQ(0u, stats.callbacks);
+    ASSERT_EQ(0u, stats.underruns);
+    ASSERT_EQ(0.0f, stats.peak_level);
+    ASSERT_EQ(0u, stats.clipped_samples);
+    ASSERT_EQ(0.0, stats.max_interval.count());
+  }
+}
@@ -2,11 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>   // byte
 #include <iostream>  // cout
 #include <memory>    // unique_ptr
 #include <type_traits>
+#include <utility>  // move
+#include <vector>   // vector
 
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
 
 static_assert(std::is_final_v<cen::music>);
 
@@ -44,6 +48,28 @@ TEST_F(MusicTest, Constructor)
   ASSERT_THROW(cen::music{"foobar"s}, cen::mix_error);
 }
 
+TEST_F(MusicTest, FileConstructor)
+{
+  cen::file file{"resources/hiddenPond.mp3", cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  ASSERT_NO_THROW(cen::music{std::move(file)});
+
+  // The music claimed ownership of the file
+  ASSERT_FALSE(file);
+}
+
+TEST_F(MusicTest, MemoryConstructor)
+{
+  cen::file file{"resources/hiddenPond.mp3", cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  std::vector<std::byte> data(file.size().value());
+  ASSERT_EQ(data.size(), file.read_to(data));
+
+  ASSERT_NO_THROW(cen::music(data.data(), data.size()));
+}
+
 TEST_F(MusicTest, Play)
 {
   m_music->play();
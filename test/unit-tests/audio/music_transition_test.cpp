@@ -0,0 +1,75 @@
+#include "audio/music_transition.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+class MusicTransitionTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_first = std::make_unique<cen::music>("resources/hiddenPond.mp3");
+    m_second = std::make_unique<cen::music>("resources/hiddenPond.mp3");
+  }
+
+  static void TearDownTestSuite()
+  {
+    cen::music::halt();
+
+    m_first.reset();
+    m_second.reset();
+  }
+
+  void SetUp() override
+  {
+    cen::music::halt();
+  }
+
+  inline static std::unique_ptr<cen::music> m_first;
+  inline static std::unique_ptr<cen::music> m_second;
+};
+
+TEST_F(MusicTransitionTest, StartWithoutMusic)
+{
+  cen::music_transition transition;
+  ASSERT_FALSE(transition.is_pending());
+
+  // The track is faded in immediately, since there is nothing to fade out
+  ASSERT_TRUE(transition.start(*m_first, cen::milliseconds<int>{100}));
+  ASSERT_FALSE(transition.is_pending());
+  ASSERT_TRUE(cen::music::is_playing());
+  ASSERT_FALSE(transition.update());
+}
+
+TEST_F(MusicTransitionTest, Start)
+{
+  cen::music_transition transition;
+  ASSERT_TRUE(transition.start(*m_first, cen::milliseconds<int>{100}));
+
+  ASSERT_TRUE(transition.start(*m_second, cen::milliseconds<int>{100}));
+  ASSERT_TRUE(transition.is_pending());
+
+  // The next track waits for the current track to stop
+  ASSERT_FALSE(transition.update());
+  ASSERT_TRUE(transition.is_pending());
+
+  cen::music::halt();
+
+  ASSERT_TRUE(transition.update());
+  ASSERT_FALSE(transition.is_pending());
+  ASSERT_TRUE(cen::music::is_playing());
+}
+
+TEST_F(MusicTransitionTest, Cancel)
+{
+  cen::music_transition transition;
+  ASSERT_TRUE(transition.start(*m_first, cen::milliseconds<int>{100}));
+  ASSERT_TRUE(transition.start(*m_second, cen::milliseconds<int>{100}));
+
+  transition.cancel();
+  ASSERT_FALSE(transition.is_pending());
+
+  cen::music::halt();
+  ASSERT_FALSE(transition.update());
+}
@@ -0,0 +1,147 @@
+#include "audio/sound_bank.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>      // byte
+#include <type_traits>  // is_nothrow_...
+#include <utility>      // move
+#include <vector>       // vector
+
+#include "core/exception.hpp"
+#include "filesystem/preferred_path.hpp"
+
+static_assert(std::is_nothrow_copy_constructible_v<cen::sound_bank::shared_sound>);
+static_assert(std::is_nothrow_move_constructible_v<cen::sound_bank::shared_sound>);
+
+class SoundBankTest : public testing::Test
+{
+ protected:
+  inline static const auto path = "resources/click.wav";
+  inline static const auto packPath =
+      cen::preferred_path("centurion", "tests").copy() + "sound_bank.pak";
+
+  static void SetUpTestSuite()
+  {
+    cen::asset_pack_writer writer{packPath};
+    ASSERT_TRUE(writer.add_file("click", path));
+    ASSERT_TRUE(writer.finish());
+  }
+
+  [[nodiscard]] static auto read_bytes() -> std::vector<std::byte>
+  {
+    cen::file file{path, cen::file_mode::read_existing_binary};
+
+    std::vector<std::byte> bytes(file.size().value());
+    file.read_to(bytes);
+
+    return bytes;
+  }
+};
+
+TEST_F(SoundBankTest, Errors)
+{
+  cen::sound_bank bank;
+  ASSERT_THROW(bank.load("foobar.wav"), cen::cen_error);
+
+  const cen::asset_pack pack{packPath};
+  ASSERT_THROW(bank.load(pack, "foobar"), cen::cen_error);
+
+  const char garbage[] = "not a sound";
+  ASSERT_THROW(bank.load(garbage, sizeof garbage), cen::mix_error);
+
+  ASSERT_TRUE(bank.empty());
+}
+
+TEST_F(SoundBankTest, LoadPath)
+{
+  cen::sound_bank bank;
+
+  const auto first = bank.load(path);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(bank.contains(path));
+  ASSERT_EQ(1u, first.use_count());
+
+  const auto second = bank.load(path);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(2u, first.use_count());
+  ASSERT_EQ(first.get().get(), second.get().get());
+
+  ASSERT_EQ(1u, bank.size());
+}
+
+TEST_F(SoundBankTest, DeduplicatesContents)
+{
+  cen::sound_bank bank;
+  const cen::asset_pack pack{packPath};
+
+  const auto fromPath = bank.load(path);
+  const auto fromPack = bank.load(pack, "click");
+
+  const auto bytes = read_bytes();
+  const auto fromMemory = bank.load(bytes.data(), bytes.size());
+
+  ASSERT_EQ(fromPath, fromPack);
+  ASSERT_EQ(fromPath, fromMemory);
+  ASSERT_EQ(3u, fromPath.use_count());
+  ASSERT_EQ(1u, bank.size());
+}
+
+TEST_F(SoundBankTest, DistinguishesContents)
+{
+  cen::sound_bank bank;
+
+  auto bytes = read_bytes();
+  const auto original = bank.load(bytes.data(), bytes.size());
+
+  // The same size, but a different sample at the end
+  bytes.back() = ~bytes.back();
+  const auto modified = bank.load(bytes.data(), bytes.size());
+
+  ASSERT_NE(original, modified);
+  ASSERT_EQ(2u, bank.size());
+}
+
+TEST_F(SoundBankTest, Handles)
+{
+  cen::sound_bank bank;
+
+  auto sound = bank.load(path);
+
+  cen::sound_bank::shared_sound copy{sound};
+  ASSERT_EQ(2u, sound.use_count());
+
+  cen::sound_bank::shared_sound moved{std::move(copy)};
+  ASSERT_FALSE(copy);
+  ASSERT_EQ(0u, copy.use_count());
+  ASSERT_EQ(2u, sound.use_count());
+
+  copy = moved;
+  ASSERT_EQ(3u, sound.use_count());
+
+  moved = cen::sound_bank::shared_sound{};
+  ASSERT_FALSE(moved);
+  ASSERT_EQ(2u, sound.use_count());
+}
+
+TEST_F(SoundBankTest, Trim)
+{
+  cen::sound_bank bank;
+
+  {
+    const auto sound = bank.load(path);
+    ASSERT_EQ(0u, bank.trim());
+    ASSERT_EQ(1u, bank.size());
+  }
+
+  // Unreferenced sounds are kept until the bank is trimmed
+  ASSERT_EQ(1u, bank.size());
+  ASSERT_TRUE(bank.contains(path));
+
+  ASSERT_EQ(1u, bank.trim());
+  ASSERT_TRUE(bank.empty());
+  ASSERT_FALSE(bank.contains(path));
+
+  const auto reloaded = bank.load(path);
+  ASSERT_TRUE(reloaded);
+  ASSERT_EQ(1u, bank.size());
+}
@@ -2,12 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>   // byte
 #include <iostream>  // cout
 #include <memory>    // unique_ptr
 #include <type_traits>
+#include <vector>  // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
 
 static_assert(std::is_final_v<cen::sound_effect>);
 static_assert(!std::is_default_constructible_v<cen::sound_effect>);
@@ -46,6 +49,29 @@ TEST_F(SoundEffect, Constructor)
   ASSERT_THROW(cen::sound_effect("foobar"s), cen::mix_error);
 }
 
+TEST_F(SoundEffect, FileConstructor)
+{
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  ASSERT_NO_THROW(cen::sound_effect{file});
+
+  // The file is still owned by the caller
+  ASSERT_TRUE(file);
+}
+
+TEST_F(SoundEffect, MemoryConstructor)
+{
+  cen::file file{path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  std::vector<std::byte> data(file.size().value());
+  ASSERT_EQ(data.size(), file.read_to(data));
+
+  ASSERT_NO_THROW(cen::sound_effect(data.data(), data.size()));
+  ASSERT_THROW(cen::sound_effect(data.data(), 4), cen::mix_error);
+}
+
 TEST_F(SoundEffect, PlayAndStop)
 {
   ASSERT_FALSE(m_sound->is_playing());
@@ -0,0 +1,128 @@
+#include "audio/voice_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "core/exception.hpp"
+
+class VoicePoolTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_sound = std::make_unique<cen::sound_effect>("resources/click.wav");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_sound.reset();
+  }
+
+  // The sounds are looped, so that they don't end during the tests
+  static auto play(cen::voice_pool& pool,
+                   const cen::voice_pool::category_type category = 0,
+                   const cen::voice_pool::priority_type priority = 0)
+  {
+    return pool.play(*m_sound, category, priority, cen::sound_effect::forever);
+  }
+
+  inline static std::unique_ptr<cen::sound_effect> m_sound;
+};
+
+TEST_F(VoicePoolTest, Constructor)
+{
+  ASSERT_THROW(cen::voice_pool{0}, cen::cen_error);
+  ASSERT_THROW(cen::voice_pool(4, -1), cen::cen_error);
+
+  const cen::voice_pool pool{4, 2};
+  ASSERT_EQ(4u, pool.size());
+  ASSERT_GE(cen::channels::allocate(-1), 6);
+}
+
+TEST_F(VoicePoolTest, PlayAndStop)
+{
+  cen::voice_pool pool{2};
+
+  const auto voice = play(pool);
+  ASSERT_TRUE(voice);
+  ASSERT_TRUE(pool.is_playing(*voice));
+  ASSERT_EQ(1u, pool.active_count());
+
+  ASSERT_TRUE(pool.stop(*voice));
+  ASSERT_FALSE(pool.is_playing(*voice));
+  ASSERT_FALSE(pool.stop(*voice));
+  ASSERT_EQ(0u, pool.active_count());
+
+  ASSERT_FALSE(pool.is_playing(cen::voice{}));
+}
+
+TEST_F(VoicePoolTest, StealsOldestVoice)
+{
+  cen::voice_pool pool{2};
+
+  const auto first = play(pool);
+  const auto second = play(pool);
+  const auto third = play(pool);
+
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+  ASSERT_TRUE(third);
+
+  ASSERT_FALSE(pool.is_playing(*first));
+  ASSERT_TRUE(pool.is_playing(*second));
+  ASSERT_TRUE(pool.is_playing(*third));
+  ASSERT_EQ(first->channel, third->channel);
+
+  pool.stop_all();
+  ASSERT_EQ(0u, pool.active_count());
+}
+
+TEST_F(VoicePoolTest, StealsLeastImportantVoice)
+{
+  cen::voice_pool pool{2};
+
+  const auto important = play(pool, 0, 10);
+  const auto unimportant = play(pool, 0, 1);
+
+  // Every voice is more important than the new sound, so it's dropped
+  ASSERT_FALSE(play(pool, 0, 0));
+
+  const auto stealer = play(pool, 0, 5);
+  ASSERT_TRUE(stealer);
+  ASSERT_TRUE(pool.is_playing(*important));
+  ASSERT_FALSE(pool.is_playing(*unimportant));
+
+  pool.stop_all();
+}
+
+TEST_F(VoicePoolTest, CategoryLimits)
+{
+  constexpr cen::voice_pool::category_type effects = 0;
+  constexpr cen::voice_pool::category_type footsteps = 1;
+
+  cen::voice_pool pool{4};
+  ASSERT_EQ(cen::voice_pool::unlimited, pool.limit(footsteps));
+
+  pool.set_limit(footsteps, 2);
+  ASSERT_EQ(2, pool.limit(footsteps));
+
+  const auto first = play(pool, footsteps);
+  const auto second = play(pool, footsteps);
+  const auto third = play(pool, footsteps);
+
+  // The category is at its limit, so one of its own voices is stolen
+  ASSERT_FALSE(pool.is_playing(*first));
+  ASSERT_TRUE(pool.is_playing(*second));
+  ASSERT_TRUE(pool.is_playing(*third));
+  ASSERT_EQ(2u, pool.active_count(footsteps));
+
+  ASSERT_TRUE(play(pool, effects));
+  ASSERT_TRUE(play(pool, effects));
+  ASSERT_EQ(4u, pool.active_count());
+
+  pool.set_limit(effects, 0);
+  ASSERT_FALSE(play(pool, effects, 100));
+
+  pool.stop_all();
+}
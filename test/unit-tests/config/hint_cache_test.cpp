@@ -0,0 +1,66 @@
+#include "hints/hint_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>  // string
+
+#include "hints/common_hints.hpp"
+#include "hints/enum_hint.hpp"
+
+TEST(CachedHint, Get)
+{
+  using cen::hint::vsync;
+  ASSERT_TRUE(cen::set_hint<vsync>(false));
+
+  const cen::cached_hint<vsync> cache;
+  ASSERT_EQ(false, cache.get());
+
+  ASSERT_TRUE(cen::set_hint<vsync>(true));
+  ASSERT_EQ(true, cache.get());
+  ASSERT_EQ(true, cache.get());
+}
+
+TEST(CachedHint, EnumHint)
+{
+  using cen::hint::render_driver;
+  ASSERT_TRUE(cen::set_hint<render_driver>(render_driver::value::software));
+
+  const cen::cached_hint<render_driver> cache;
+  ASSERT_EQ(render_driver::value::software, cache.get());
+
+  ASSERT_TRUE(cen::set_hint<render_driver>(render_driver::value::opengl));
+  ASSERT_EQ(render_driver::value::opengl, cache.get());
+}
+
+TEST(CachedHint, StringHint)
+{
+  using cen::hint::orientations;
+  ASSERT_TRUE(cen::set_hint<orientations>("LandscapeLeft"));
+
+  const cen::cached_hint<orientations> cache;
+  const auto first = cache.get();
+  ASSERT_TRUE(first);
+  ASSERT_EQ(std::string{"LandscapeLeft"}, *first);
+
+  // The cached string outlives the previous value of the hint
+  ASSERT_TRUE(cen::set_hint<orientations>("Portrait"));
+  const auto second = cache.get();
+  ASSERT_TRUE(second);
+  ASSERT_EQ(std::string{"Portrait"}, *second);
+}
+
+TEST(CachedHint, Invalidate)
+{
+  using cen::hint::event_logging;
+  ASSERT_TRUE(cen::set_hint<event_logging>(1));
+
+  cen::cached_hint<event_logging> cache;
+  ASSERT_EQ(1, cache.get());
+
+  // Bypasses the hint callbacks
+  cache.invalidate();
+  ASSERT_EQ(1, cache.get());
+
+  ASSERT_TRUE(cen::set_hint<event_logging>(0));
+  ASSERT_EQ(0, cache.get());
+}
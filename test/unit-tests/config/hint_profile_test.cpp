@@ -0,0 +1,37 @@
+#include "hints/hint_profile.hpp"
+
+#include <gtest/gtest.h>
+
+#include "hints/common_hints.hpp"
+#include "hints/enum_hint.hpp"
+
+TEST(HintProfile, Defaults)
+{
+  const cen::hint_profile profile;
+  ASSERT_TRUE(profile.empty());
+  ASSERT_EQ(0u, profile.size());
+  ASSERT_TRUE(profile.apply());
+}
+
+TEST(HintProfile, Apply)
+{
+  using cen::hint::event_logging;
+  using cen::hint::render_driver;
+  using cen::hint::vsync;
+
+  cen::hint_profile profile;
+  profile.set<render_driver>(render_driver::value::software)
+      .set<vsync>(false)
+      .set<event_logging>(1)
+      .set<vsync, cen::hint_priority::normal>(true);
+
+  ASSERT_EQ(3u, profile.size());
+  ASSERT_TRUE(profile.apply());
+
+  ASSERT_EQ(render_driver::value::software, cen::get_hint<render_driver>());
+  ASSERT_EQ(true, cen::get_hint<vsync>());
+  ASSERT_EQ(1, cen::get_hint<event_logging>());
+
+  profile.clear();
+  ASSERT_TRUE(profile.empty());
+}
@@ -0,0 +1,60 @@
+#include "allocation_counter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // make_unique, unique_ptr
+#include <vector>  // vector
+
+namespace {
+
+struct alignas(64) aligned_value final
+{
+  int value{};
+};
+
+}  // namespace
+
+TEST(AllocationCounter, HeapAllocations)
+{
+  const allocation_counter counter;
+  ASSERT_EQ(0u, counter.total());
+
+  {
+    auto value = std::make_unique<int>(42);
+    auto array = std::make_unique<int[]>(8);
+    auto aligned = std::make_unique<aligned_value>();
+  }
+
+  std::vector<int> values;
+  values.reserve(16);
+
+  ASSERT_EQ(4u, counter.heap_allocations());
+  ASSERT_EQ(4u, counter.total());
+}
+
+TEST(AllocationCounter, SDLAllocations)
+{
+  const allocation_counter counter;
+
+  SDL_free(SDL_malloc(16));
+  SDL_free(SDL_calloc(2, 8));
+
+  ASSERT_EQ(0u, counter.heap_allocations());
+  ASSERT_EQ(2u, counter.sdl_allocations());
+  ASSERT_EQ(2u, counter.total());
+}
+
+TEST(AllocationCounter, NoAllocations)
+{
+  int value = 0;
+  EXPECT_NO_ALLOCATIONS({
+    int values[4]{1, 2, 3, 4};
+    for (const auto x : values)
+    {
+      value += x;
+    }
+  });
+
+  ASSERT_EQ(10, value);
+  ASSERT_NO_ALLOCATIONS(++value);
+}
@@ -0,0 +1,192 @@
+#include "core/async_log.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>  // atomic
+#include <string>  // string
+#include <thread>  // thread
+#include <vector>  // vector
+
+#include "math/point.hpp"
+
+namespace {
+
+// Only accessed by the background thread, and by the test after a flush
+inline std::vector<std::string> messages;
+
+void collect(const cen::log_record& record)
+{
+  messages.emplace_back(record.message());
+}
+
+}  // namespace
+
+TEST(AsyncLog, Defaults)
+{
+  cen::async_log log{cen::log_sink::from<&collect>()};
+  ASSERT_EQ(1'024u, log.capacity());
+  ASSERT_EQ(cen::log_overflow::drop, log.overflow());
+  ASSERT_EQ(0u, log.dropped());
+}
+
+TEST(AsyncLog, Messages)
+{
+  messages.clear();
+
+  cen::async_log log{cen::log_sink::from<&collect>(), 64};
+
+  constexpr auto category = cen::log_category::app;
+  ASSERT_TRUE(log.msg(cen::log_priority::info, category, "%s %i", "foo", 42));
+  ASSERT_TRUE(log.put(cen::log_priority::warn, category, "bar"));
+  ASSERT_TRUE(log.put(cen::log_priority::error, category, cen::ipoint{1, 2}));
+
+  log.flush();
+
+  const std::vector<std::string> expected = {"foo 42", "bar", "ipoint{x: 1, y: 2}"};
+  ASSERT_EQ(expected, messages);
+}
+
+TEST(AsyncLog, Truncation)
+{
+  messages.clear();
+
+  cen::async_log log{cen::log_sink::from<&collect>()};
+
+  const std::string str(1'000, 'x');
+  log.put(cen::log_priority::info, cen::log_category::app, str);
+  log.flush();
+
+  ASSERT_EQ(1u, messages.size());
+  ASSERT_EQ(str.substr(0, cen::log_record::max_length), messages.front());
+}
+
+TEST(AsyncLog, Priorities)
+{
+  messages.clear();
+
+  cen::async_log log{cen::log_sink::from<&collect>()};
+  cen::log::set_priority(cen::log_category::app, cen::log_priority::warn);
+
+  log.put(cen::log_priority::verbose, cen::log_category::app, "verbose");
+  log.put(cen::log_priority::critical, cen::log_category::app, "critical");
+  log.flush();
+
+  ASSERT_EQ(std::vector<std::string>{"critical"}, messages);
+  cen::log::reset_priorities();
+}
+
+TEST(AsyncLog, MultipleThreads)
+{
+  messages.clear();
+
+  constexpr int count = 500;
+
+  {
+    cen::async_log log{cen::log_sink::from<&collect>(), 16, cen::log_overflow::block};
+
+    std::vector<std::thread> threads;
+    for (int index = 0; index < 4; ++index)
+    {
+      threads.emplace_back([&] {
+        for (int message = 0; message < count; ++message)
+        {
+          log.msg(cen::log_priority::info, cen::log_category::app, "%i", message);
+        }
+      });
+    }
+
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  // The destructor writes every pending record
+  ASSERT_EQ(4u * count, messages.size());
+}
+
+TEST(AsyncLog, DropWhenFull)
+{
+  std::atomic<bool> blocked{true};
+  std::atomic<int> written{0};
+
+  cen::async_log log{[&](const cen::log_record&) {
+                       while (blocked.load())
+                       {
+                         std::this_thread::yield();
+                       }
+
+                       ++written;
+                     },
+                     4,
+                     cen::log_overflow::drop};
+
+  int submitted = 0;
+  for (int index = 0; index < 16; ++index)
+  {
+    if (log.put(cen::log_priority::info, cen::log_category::app, "message"))
+    {
+      ++submitted;
+    }
+  }
+
+  // Unblock the sink before any assertion, so that the destructor can't hang
+  blocked = false;
+  log.flush();
+
+  ASSERT_LT(submitted, 16);
+  ASSERT_EQ(16u - static_cast<std::size_t>(submitted), log.dropped());
+  ASSERT_EQ(submitted, written.load());
+}
+
+TEST(AsyncLog, CaptureSdlOutput)
+{
+  messages.clear();
+
+  cen::async_log log{cen::log_sink::from<&collect>()};
+  log.capture_sdl_output();
+
+  cen::log::warn("Captured %i", 7);
+  log.flush();
+
+  log.release_sdl_output();
+  cen::log::warn("Not captured");
+  log.flush();
+
+  ASSERT_EQ(std::vector<std::string>{"Captured 7"}, messages);
+}
+
+TEST(AsyncLog, CrashHandler)
+{
+  cen::async_log first{cen::log_sink::from<&collect>()};
+  cen::async_log second{cen::log_sink::from<&collect>()};
+
+  ASSERT_TRUE(first.install_crash_handler());
+  ASSERT_TRUE(first.install_crash_handler());
+  ASSERT_FALSE(second.install_crash_handler());
+
+  first.uninstall_crash_handler();
+  ASSERT_TRUE(second.install_crash_handler());
+}
+
+TEST(AsyncLog, Defer)
+{
+  messages.clear();
+
+  cen::async_log log{cen::log_sink::from<&collect>()};
+
+  std::string name = "foo";
+  ASSERT_TRUE(log.defer(cen::log_priority::info,
+                        cen::log_category::app,
+                        "%s: %i %.1f",
+                        name.c_str(),
+                        42,
+                        1.5));
+  name = "bar";
+
+  ASSERT_TRUE(log.defer(cen::log_priority::warn, cen::log_category::app, "No arguments"));
+  log.flush();
+
+  const std::vector<std::string> expected = {"foo: 42 1.5", "No arguments"};
+  ASSERT_EQ(expected, messages);
+}
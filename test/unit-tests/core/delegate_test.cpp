@@ -0,0 +1,173 @@
+#include "core/delegate.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <memory>  // make_shared
+#include <string>  // string
+#include <type_traits>
+#include <utility>  // move
+
+using delegate_type = cen::delegate<int(int)>;
+
+static_assert(std::is_nothrow_move_constructible_v<delegate_type>);
+static_assert(std::is_nothrow_move_assignable_v<delegate_type>);
+static_assert(std::is_copy_constructible_v<delegate_type>);
+static_assert(std::is_copy_assignable_v<delegate_type>);
+
+namespace {
+
+auto twice(const int value) -> int
+{
+  return 2 * value;
+}
+
+struct counter final
+{
+  auto add(const int value) -> int
+  {
+    total += value;
+    return total;
+  }
+
+  [[nodiscard]] auto peek(const int value) const -> int
+  {
+    return total + value;
+  }
+
+  int total{};
+};
+
+}  // namespace
+
+TEST(Delegate, Defaults)
+{
+  const delegate_type delegate;
+  ASSERT_FALSE(delegate);
+  ASSERT_FALSE(delegate.is_allocated());
+
+  const delegate_type null{nullptr};
+  ASSERT_FALSE(null);
+}
+
+TEST(Delegate, FreeFunction)
+{
+  const auto delegate = delegate_type::from<&twice>();
+  ASSERT_TRUE(delegate);
+  ASSERT_FALSE(delegate.is_allocated());
+  ASSERT_EQ(14, delegate(7));
+}
+
+TEST(Delegate, MemberFunction)
+{
+  counter counter;
+
+  const auto add = delegate_type::from<&counter::add>(&counter);
+  ASSERT_EQ(3, add(3));
+  ASSERT_EQ(5, add(2));
+  ASSERT_EQ(5, counter.total);
+
+  const auto peek = delegate_type::from<&counter::peek>(&counter);
+  ASSERT_EQ(15, peek(10));
+}
+
+TEST(Delegate, SmallLambda)
+{
+  int calls = 0;
+  const delegate_type delegate = [&calls](const int value) {
+    ++calls;
+    return value + 1;
+  };
+
+  ASSERT_FALSE(delegate.is_allocated());
+  ASSERT_EQ(2, delegate(1));
+  ASSERT_EQ(1, calls);
+}
+
+TEST(Delegate, MutableLambda)
+{
+  const delegate_type delegate = [sum = 0](const int value) mutable {
+    sum += value;
+    return sum;
+  };
+
+  ASSERT_EQ(1, delegate(1));
+  ASSERT_EQ(3, delegate(2));
+}
+
+TEST(Delegate, NonTrivialLambda)
+{
+  auto shared = std::make_shared<int>(42);
+  const std::weak_ptr<int> weak = shared;
+
+  {
+    delegate_type delegate = [shared](const int value) {
+      return *shared + value;
+    };
+    shared.reset();
+
+    ASSERT_FALSE(weak.expired());
+    ASSERT_EQ(43, delegate(1));
+
+    auto copy = delegate;
+    auto moved = std::move(delegate);
+    ASSERT_FALSE(delegate);
+    ASSERT_EQ(44, copy(2));
+    ASSERT_EQ(45, moved(3));
+  }
+
+  // All copies have been destroyed
+  ASSERT_TRUE(weak.expired());
+}
+
+TEST(Delegate, LargeLambda)
+{
+  std::array<int, 32> values{};
+  values.back() = 10;
+
+  delegate_type delegate = [values](const int value) {
+    return values.back() + value;
+  };
+
+  ASSERT_TRUE(delegate.is_allocated());
+  ASSERT_EQ(11, delegate(1));
+
+  const auto copy = delegate;
+  ASSERT_TRUE(copy.is_allocated());
+  ASSERT_EQ(12, copy(2));
+
+  delegate = nullptr;
+  ASSERT_FALSE(delegate);
+  ASSERT_FALSE(delegate.is_allocated());
+  ASSERT_EQ(13, copy(3));
+}
+
+TEST(Delegate, Assignment)
+{
+  delegate_type delegate = [](const int value) {
+    return value;
+  };
+
+  const std::string str = "foo";
+  delegate = [str](const int value) {
+    return static_cast<int>(str.size()) + value;
+  };
+  ASSERT_EQ(4, delegate(1));
+
+  delegate = delegate_type::from<&twice>();
+  ASSERT_EQ(2, delegate(1));
+
+  delegate.reset();
+  ASSERT_FALSE(delegate);
+}
+
+TEST(Delegate, VoidReturn)
+{
+  int result = 0;
+  const cen::delegate<void(const int&)> delegate = [&](const int& value) {
+    result = value;
+  };
+
+  delegate(5);
+  ASSERT_EQ(5, result);
+}
@@ -2,6 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <string>  // string
+
+#include "math/rect.hpp"
+
 TEST(Log, SetPriorityAllCategories)
 {
   const auto priority = cen::log_priority::critical;
@@ -120,3 +124,68 @@ TEST(Log, Macros)
   CENTURION_LOG_CRITICAL("%s", "This is for debug only...");
   CENTURION_LOG_ERROR("%s", "This is for debug only...");
 }
+
+TEST(Log, IsCompiled)
+{
+  // Nothing is removed by default
+  ASSERT_EQ(cen::log_priority::verbose, cen::log::min_priority);
+
+  static_assert(cen::log::is_compiled(cen::log_priority::verbose));
+  static_assert(cen::log::is_compiled(cen::log_priority::debug));
+  static_assert(cen::log::is_compiled(cen::log_priority::info));
+  static_assert(cen::log::is_compiled(cen::log_priority::warn));
+  static_assert(cen::log::is_compiled(cen::log_priority::error));
+  static_assert(cen::log::is_compiled(cen::log_priority::critical));
+}
+
+TEST(Log, LogMacro)
+{
+  int evaluated = 0;
+  CENTURION_LOG(cen::log_priority::info, cen::log_category::test, "%i", ++evaluated);
+  ASSERT_EQ(1, evaluated);
+}
+
+TEST(Log, MsgWithConstantPriority)
+{
+  SDL_LogOutputFunction function{};
+  void* data{};
+  SDL_LogGetOutputFunction(&function, &data);
+
+  std::string message;
+  SDL_LogSetOutputFunction(
+      [](void* userdata, int, SDL_LogPriority, const char* msg) {
+        *static_cast<std::string*>(userdata) = msg;
+      },
+      &message);
+
+  cen::log::msg<cen::log_priority::critical>(cen::log_category::test, "%i", 42);
+  ASSERT_EQ("42", message);
+
+  SDL_LogSetOutputFunction(function, data);
+}
+
+TEST(Log, PutFormattable)
+{
+  SDL_LogOutputFunction function{};
+  void* data{};
+  SDL_LogGetOutputFunction(&function, &data);
+
+  std::string message;
+  SDL_LogSetOutputFunction(
+      [](void* userdata, int, SDL_LogPriority, const char* msg) {
+        *static_cast<std::string*>(userdata) = msg;
+      },
+      &message);
+
+  const cen::irect rect{1, 2, 3, 4};
+
+  cen::log::set_priority(cen::log_category::render, cen::log_priority::info);
+  cen::log::put(cen::log_priority::verbose, cen::log_category::render, rect);
+  ASSERT_TRUE(message.empty());
+
+  cen::log::put(cen::log_priority::warn, cen::log_category::render, rect);
+  ASSERT_EQ(cen::to_string(rect), message);
+
+  SDL_LogSetOutputFunction(function, data);
+  cen::log::reset_priorities();
+}
@@ -0,0 +1,64 @@
+#include "core/memory_functions.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+
+TEST(MemoryFunctions, GetAndSet)
+{
+  const auto functions = cen::get_memory_functions();
+  ASSERT_TRUE(functions.mallocFunc);
+  ASSERT_TRUE(functions.callocFunc);
+  ASSERT_TRUE(functions.reallocFunc);
+  ASSERT_TRUE(functions.freeFunc);
+
+  ASSERT_FALSE(cen::set_memory_functions({}));
+  ASSERT_TRUE(cen::set_memory_functions(functions));
+
+  const auto current = cen::get_memory_functions();
+  ASSERT_EQ(functions.mallocFunc, current.mallocFunc);
+  ASSERT_EQ(functions.freeFunc, current.freeFunc);
+}
+
+TEST(AllocationTracker, Stats)
+{
+  const auto previous = cen::get_memory_functions();
+
+  {
+    cen::allocation_tracker tracker;
+    ASSERT_THROW(cen::allocation_tracker{}, cen::cen_error);
+
+    const auto before = tracker.stats();
+
+    void* memory = SDL_malloc(64);
+    memory = SDL_realloc(memory, 128);
+    SDL_free(memory);
+    SDL_free(SDL_calloc(4, 8));
+    SDL_free(nullptr);
+
+    const auto stats = tracker.stats() - before;
+    ASSERT_EQ(2u, stats.allocations);
+    ASSERT_EQ(1u, stats.reallocations);
+    ASSERT_EQ(2u, stats.deallocations);
+    ASSERT_EQ(64u + 128u + 32u, stats.bytes);
+
+    tracker.reset();
+    ASSERT_EQ(0u, tracker.stats().allocations);
+    ASSERT_EQ(0u, tracker.stats().bytes);
+  }
+
+  // The previous memory functions are restored
+  ASSERT_EQ(previous.mallocFunc, cen::get_memory_functions().mallocFunc);
+  ASSERT_NO_THROW(cen::allocation_tracker{});
+}
+
+TEST(AllocationCount, Usage)
+{
+  const auto count = cen::allocation_count();
+
+  void* memory = SDL_malloc(16);
+  ASSERT_EQ(count + 1, cen::allocation_count());
+
+  SDL_free(memory);
+  ASSERT_EQ(count, cen::allocation_count());
+}
@@ -0,0 +1,132 @@
+#include "core/memory_resource.hpp"
+
+#include <gtest/gtest.h>
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+#include <cstddef>  // max_align_t
+#include <cstdint>  // uintptr_t
+#include <list>     // list
+#include <vector>   // vector
+
+TEST(StackResource, Usage)
+{
+  cen::stack_resource<64> resource;
+
+  std::pmr::vector<int> values{resource.get()};
+  values.reserve(4);
+  values.push_back(42);
+  ASSERT_EQ(42, values.front());
+
+  // Allocations that don't fit in the buffer use the default resource
+  std::pmr::vector<int> large(1'000, resource.get());
+  ASSERT_EQ(1'000u, large.size());
+}
+
+TEST(FrameResource, Reset)
+{
+  cen::frame_resource resource{256};
+  ASSERT_EQ(0u, resource.capacity());
+
+  auto* first = resource.allocate(64, 16);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(first) % 16u);
+  ASSERT_EQ(256u, resource.capacity());
+
+  (void) resource.allocate(128, 8);
+  resource.deallocate(first, 64, 16);
+
+  // Deallocations have no effect, but resetting reuses the memory
+  resource.reset();
+  ASSERT_EQ(first, resource.allocate(64, 16));
+  ASSERT_EQ(256u, resource.capacity());
+
+  ASSERT_TRUE(resource.is_equal(resource));
+  cen::frame_resource other;
+  ASSERT_FALSE(resource.is_equal(other));
+}
+
+TEST(FrameResource, Containers)
+{
+  cen::frame_resource resource{128};
+
+  std::pmr::vector<int> values{&resource};
+  for (int value = 0; value < 100; ++value)
+  {
+    values.push_back(value);
+  }
+
+  ASSERT_EQ(99, values.back());
+  ASSERT_GE(resource.capacity(), 100 * sizeof(int));
+}
+
+TEST(ScratchScope, Rewind)
+{
+  auto& resource = cen::scratch_resource();
+  ASSERT_EQ(&resource, &cen::scratch_resource());
+
+  void* outer{};
+  {
+    cen::scratch_scope scope;
+    ASSERT_EQ(&resource, scope.get());
+    outer = scope.get()->allocate(32, 8);
+
+    void* inner{};
+    {
+      cen::scratch_scope nested;
+      inner = nested.get()->allocate(32, 8);
+      ASSERT_NE(outer, inner);
+    }
+
+    // The nested scope only releases its own allocations
+    ASSERT_EQ(inner, scope.get()->allocate(32, 8));
+  }
+
+  cen::scratch_scope scope;
+  ASSERT_EQ(outer, scope.get()->allocate(32, 8));
+}
+
+TEST(PoolResource, Blocks)
+{
+  cen::pool_resource pool{10, 4};
+  ASSERT_EQ(0u, pool.block_size() % alignof(std::max_align_t));
+  ASSERT_GE(pool.block_size(), 10u);
+  ASSERT_EQ(0u, pool.chunk_count());
+
+  std::vector<void*> blocks;
+  for (int i = 0; i < 5; ++i)
+  {
+    blocks.push_back(pool.allocate(8, 8));
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(blocks.back()) % 8u);
+  }
+
+  ASSERT_EQ(2u, pool.chunk_count());
+
+  // Deallocated blocks are reused first
+  pool.deallocate(blocks[2], 8, 8);
+  ASSERT_EQ(blocks[2], pool.allocate(8, 8));
+
+  // Large allocations are forwarded to the upstream resource
+  auto* large = pool.allocate(1'000, 8);
+  pool.deallocate(large, 1'000, 8);
+  ASSERT_EQ(2u, pool.chunk_count());
+
+  pool.release();
+  ASSERT_EQ(0u, pool.chunk_count());
+}
+
+TEST(PoolResource, Containers)
+{
+  cen::pool_resource pool{64};
+
+  std::pmr::list<int> values{&pool};
+  for (int value = 0; value < 200; ++value)
+  {
+    values.push_back(value);
+  }
+
+  values.remove_if([](const int value) { return value % 2 == 0; });
+  ASSERT_EQ(100u, values.size());
+  ASSERT_EQ(199, values.back());
+}
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
@@ -0,0 +1,206 @@
+#include "core/resource_manager.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>    // size_t
+#include <stdexcept>  // out_of_range, runtime_error
+#include <string>     // string
+
+namespace {
+
+struct fake_resource final
+{
+  std::string path;
+  std::size_t size{};
+};
+
+}  // namespace
+
+template <>
+struct cen::resource_traits<fake_resource>
+{
+  [[nodiscard]] static auto bytes(const fake_resource& resource) noexcept -> std::size_t
+  {
+    return resource.size;
+  }
+
+  [[nodiscard]] static auto default_budget() noexcept -> std::size_t
+  {
+    return 1'000;
+  }
+
+  [[nodiscard]] static auto over_budget() -> bool
+  {
+    return false;
+  }
+};
+
+using manager_type = cen::resource_manager<fake_resource>;
+
+namespace {
+
+struct loader final
+{
+  int* loads{};
+  std::size_t size{100};
+
+  auto operator()(const std::string& path) const -> fake_resource
+  {
+    ++*loads;
+    return fake_resource{path, size};
+  }
+};
+
+}  // namespace
+
+TEST(ResourceManager, Defaults)
+{
+  const manager_type manager;
+  ASSERT_EQ(1'000u, manager.budget());
+  ASSERT_EQ(0u, manager.bytes());
+  ASSERT_EQ(0u, manager.size());
+  ASSERT_EQ(0u, manager.unused_count());
+
+  ASSERT_FALSE(manager.is_valid({}));
+  ASSERT_FALSE(manager.try_get({}));
+  ASSERT_THROW((void) manager.at({}), std::out_of_range);
+}
+
+TEST(ResourceManager, Deduplication)
+{
+  manager_type manager;
+
+  int loads = 0;
+  const auto a = manager.acquire("a", loader{&loads});
+  const auto b = manager.acquire("a", loader{&loads});
+
+  ASSERT_TRUE(a);
+  ASSERT_EQ(a, b);
+  ASSERT_EQ(1, loads);
+  ASSERT_EQ(2u, manager.use_count(a));
+  ASSERT_EQ(1u, manager.size());
+  ASSERT_EQ(100u, manager.bytes());
+  ASSERT_TRUE(manager.contains("a"));
+  ASSERT_EQ("a", manager.at(a).path);
+
+  const auto c = manager.acquire("c", loader{&loads});
+  ASSERT_NE(a, c);
+  ASSERT_EQ(2, loads);
+  ASSERT_EQ(200u, manager.bytes());
+}
+
+TEST(ResourceManager, ReferenceCounting)
+{
+  manager_type manager;
+
+  int loads = 0;
+  const auto handle = manager.acquire("a", loader{&loads});
+  ASSERT_TRUE(manager.retain(handle));
+  ASSERT_EQ(2u, manager.use_count(handle));
+
+  manager.release(handle);
+  ASSERT_EQ(1u, manager.use_count(handle));
+  ASSERT_EQ(0u, manager.unused_count());
+
+  manager.release(handle);
+  ASSERT_TRUE(manager.is_valid(handle));
+  ASSERT_EQ(0u, manager.use_count(handle));
+  ASSERT_EQ(1u, manager.unused_count());
+
+  // Releasing an unused resource has no effect
+  manager.release(handle);
+  ASSERT_EQ(1u, manager.unused_count());
+
+  // Reacquiring an unused resource doesn't reload it
+  ASSERT_EQ(handle, manager.acquire("a", loader{&loads}));
+  ASSERT_EQ(1, loads);
+  ASSERT_EQ(0u, manager.unused_count());
+}
+
+TEST(ResourceManager, StaleHandles)
+{
+  manager_type manager;
+
+  int loads = 0;
+  const auto a = manager.acquire("a", loader{&loads});
+  manager.release(a);
+
+  ASSERT_EQ(1u, manager.clear_unused());
+  ASSERT_FALSE(manager.is_valid(a));
+  ASSERT_FALSE(manager.contains("a"));
+  ASSERT_FALSE(manager.retain(a));
+  ASSERT_EQ(0u, manager.use_count(a));
+  ASSERT_THROW((void) manager.at(a), std::out_of_range);
+  ASSERT_EQ(0u, manager.size());
+  ASSERT_EQ(0u, manager.bytes());
+
+  // The slot is reused with a new generation
+  const auto b = manager.acquire("b", loader{&loads});
+  ASSERT_EQ(a.index, b.index);
+  ASSERT_NE(a, b);
+  ASSERT_FALSE(manager.is_valid(a));
+  ASSERT_TRUE(manager.is_valid(b));
+}
+
+TEST(ResourceManager, BudgetEvictsLeastRecentlyReleased)
+{
+  manager_type manager{300};
+
+  int loads = 0;
+  const auto a = manager.acquire("a", loader{&loads});
+  const auto b = manager.acquire("b", loader{&loads});
+  const auto c = manager.acquire("c", loader{&loads});
+
+  manager.release(b);
+  manager.release(a);
+  manager.release(c);
+  ASSERT_EQ(3u, manager.unused_count());
+
+  // Loading a fourth resource exceeds the budget, so the first released goes
+  const auto d = manager.acquire("d", loader{&loads});
+  ASSERT_FALSE(manager.is_valid(b));
+  ASSERT_TRUE(manager.is_valid(a));
+  ASSERT_TRUE(manager.is_valid(c));
+  ASSERT_TRUE(manager.is_valid(d));
+  ASSERT_EQ(300u, manager.bytes());
+
+  // Reacquiring a resource protects it from eviction
+  ASSERT_EQ(a, manager.acquire("a", loader{&loads}));
+
+  manager.set_budget(200);
+  ASSERT_FALSE(manager.is_valid(c));
+  ASSERT_TRUE(manager.is_valid(a));
+  ASSERT_TRUE(manager.is_valid(d));
+}
+
+TEST(ResourceManager, ResourcesInUseAreNeverEvicted)
+{
+  manager_type manager{100};
+
+  int loads = 0;
+  const auto a = manager.acquire("a", loader{&loads});
+  const auto b = manager.acquire("b", loader{&loads});
+
+  ASSERT_TRUE(manager.is_valid(a));
+  ASSERT_TRUE(manager.is_valid(b));
+  ASSERT_EQ(200u, manager.bytes());
+  ASSERT_EQ(0u, manager.trim());
+
+  // Released resources are evicted immediately while the budget is exceeded
+  manager.release(a);
+  ASSERT_FALSE(manager.is_valid(a));
+  ASSERT_EQ(100u, manager.bytes());
+}
+
+TEST(ResourceManager, LoaderFailure)
+{
+  manager_type manager;
+
+  const auto failing = [](const std::string&) -> fake_resource {
+    throw std::runtime_error{"Failed to load!"};
+  };
+
+  ASSERT_THROW(manager.acquire("a", failing), std::runtime_error);
+  ASSERT_FALSE(manager.contains("a"));
+  ASSERT_EQ(0u, manager.size());
+}
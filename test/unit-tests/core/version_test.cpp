@@ -53,6 +53,8 @@ TEST(Version, SDLImageLinkedVersion)
   ASSERT_EQ(expected.patch, version.patch);
 }
 
+#ifndef CENTURION_NO_SDL_MIXER
+
 TEST(Version, SDLMixerLinkedVersion)
 {
   const auto expected = *Mix_Linked_Version();
@@ -62,6 +64,8 @@ TEST(Version, SDLMixerLinkedVersion)
   ASSERT_EQ(expected.patch, version.patch);
 }
 
+#endif  // CENTURION_NO_SDL_MIXER
+
 TEST(Version, SDLTTFLinkedVersion)
 {
   const auto expected = *TTF_Linked_Version();
@@ -87,6 +91,8 @@ TEST(Version, SDLImageVersion)
   ASSERT_EQ(SDL_IMAGE_PATCHLEVEL, version.patch);
 }
 
+#ifndef CENTURION_NO_SDL_MIXER
+
 TEST(Version, SDLMixerVersion)
 {
   constexpr auto version = cen::sdl_mixer_version();
@@ -95,6 +101,8 @@ TEST(Version, SDLMixerVersion)
   ASSERT_EQ(SDL_MIXER_PATCHLEVEL, version.patch);
 }
 
+#endif  // CENTURION_NO_SDL_MIXER
+
 TEST(Version, SDLTTFVersion)
 {
   constexpr auto version = cen::sdl_ttf_version();
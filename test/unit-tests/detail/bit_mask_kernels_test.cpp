@@ -0,0 +1,68 @@
+#include "detail/bit_mask_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+// An odd amount of words, so that every kernel also runs its scalar tail
+inline constexpr std::size_t count = 7;
+
+// Returns a row with a zero word on both sides, and a single set bit
+[[nodiscard]] auto make_row(const std::size_t bit) -> std::vector<cen::u64>
+{
+  std::vector<cen::u64> row(count + 2u);
+  row[1u + bit / 64u] = cen::u64{1} << (bit % 64u);
+  return row;
+}
+
+}  // namespace
+
+TEST(BitMaskKernels, Overlaps)
+{
+  for (const std::size_t a : {0u, 5u, 63u, 64u, 200u, 447u})
+  {
+    for (const std::size_t b : {0u, 1u, 60u, 130u, 447u})
+    {
+      for (unsigned shift = 0; shift < 64u; ++shift)
+      {
+        const auto x = make_row(a);
+        const auto y = make_row(b);
+        const auto expected = a == b + shift;
+
+        for (const auto level : simd_levels)
+        {
+          if (!cen::detail::is_simd_level_available(level))
+          {
+            continue;
+          }
+
+          const auto result =
+              cen::detail::rows_overlap(level, x.data() + 1, y.data() + 1, count, shift);
+          ASSERT_EQ(expected, result)
+              << "A: " << a << ", B: " << b << ", shift: " << shift;
+        }
+      }
+    }
+  }
+}
+
+TEST(BitMaskKernels, Empty)
+{
+  const std::vector<cen::u64> x(count + 2u, ~cen::u64{0});
+  const std::vector<cen::u64> y(count + 2u, 0);
+
+  for (const auto level : simd_levels)
+  {
+    if (cen::detail::is_simd_level_available(level))
+    {
+      const auto* a = x.data() + 1;
+      const auto* b = y.data() + 1;
+      ASSERT_FALSE(cen::detail::rows_overlap(level, a, b, count, 3));
+      ASSERT_FALSE(cen::detail::rows_overlap(level, a, a, 0, 0));
+    }
+  }
+}
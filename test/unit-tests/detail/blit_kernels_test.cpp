@@ -0,0 +1,108 @@
+#include "detail/blit_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <vector>  // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+inline constexpr std::array ops = {cen::detail::blit_op::copy,
+                                   cen::detail::blit_op::blend,
+                                   cen::detail::blit_op::add,
+                                   cen::detail::blit_op::mod,
+                                   cen::detail::blit_op::mul};
+
+// An odd amount of pixels, so that every kernel also runs its scalar tail
+inline constexpr std::size_t count = 53;
+
+[[nodiscard]] auto make_pixels(const unsigned seed) -> std::vector<cen::u32>
+{
+  std::vector<cen::u32> pixels(count);
+
+  lcg random{seed};
+  for (auto& pixel : pixels)
+  {
+    pixel = random.next();
+  }
+
+  // Include fully transparent and fully opaque pixels
+  pixels[0] = 0;
+  pixels[1] = 0xFFFF'FFFFu;
+
+  return pixels;
+}
+
+}  // namespace
+
+TEST(BlitKernels, Blend)
+{
+  using cen::detail::blit_op;
+
+  // Opaque sources replace the destination, transparent sources keep it
+  ASSERT_EQ(0xFF10'2030u, cen::detail::blit_pixel<blit_op::blend>(24, 0xFF10'2030u, 0));
+  ASSERT_EQ(0x8040'6080u,
+            cen::detail::blit_pixel<blit_op::blend>(24, 0x0010'2030u, 0x8040'6080u));
+
+  // The alpha values are composited with the "over" operator
+  ASSERT_EQ(0xFF80'8080u,
+            cen::detail::blit_pixel<blit_op::blend>(24, 0x80FF'FFFFu, 0xFF00'0000u));
+}
+
+TEST(BlitKernels, Channels)
+{
+  using cen::detail::blit_op;
+
+  // Additive blending scales the source by its alpha and keeps the destination alpha
+  ASSERT_EQ(0x40FF'9000u,
+            cen::detail::blit_pixel<blit_op::add>(24, 0x80FF'4000u, 0x40C0'7000u));
+
+  // Modulation multiplies the colors and ignores the source alpha
+  ASSERT_EQ(0x4080'0000u,
+            cen::detail::blit_pixel<blit_op::mod>(24, 0x00FF'8000u, 0x4080'00FFu));
+
+  // Multiplication of an opaque source is the same as modulation
+  ASSERT_EQ(0x4080'0000u,
+            cen::detail::blit_pixel<blit_op::mul>(24, 0xFFFF'8000u, 0x4080'00FFu));
+
+  // A transparent black source leaves the destination unchanged
+  ASSERT_EQ(0x4080'20FFu,
+            cen::detail::blit_pixel<blit_op::mul>(24, 0x0000'0000u, 0x4080'20FFu));
+}
+
+TEST(BlitKernels, LevelsMatchScalar)
+{
+  const auto src = make_pixels(1);
+  const auto dst = make_pixels(2);
+
+  for (const auto alpha : {0, 8, 16, 24})
+  {
+    cen::detail::channel_layout layout;
+    layout.alpha = alpha;
+
+    for (const auto op : ops)
+    {
+      auto expected = dst;
+      cen::detail::blit_pixels(cen::detail::simd_level::none,
+                               op,
+                               layout,
+                               src.data(),
+                               expected.data(),
+                               count);
+
+      for (const auto level : simd_levels)
+      {
+        if (!cen::detail::is_simd_level_available(level))
+        {
+          continue;
+        }
+
+        auto result = dst;
+        cen::detail::blit_pixels(level, op, layout, src.data(), result.data(), count);
+        ASSERT_EQ(expected, result) << "Alpha: " << alpha;
+      }
+    }
+  }
+}
@@ -0,0 +1,116 @@
+#include "detail/block_compression.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+namespace {
+
+/// Creates a deterministic sequence of bytes, which repeats more often for larger spans.
+[[nodiscard]] auto make_bytes(const std::size_t count, const cen::u32 span)
+    -> std::vector<cen::u8>
+{
+  std::vector<cen::u8> bytes(count);
+
+  cen::u32 state = 0x12345678u;
+  for (auto& byte : bytes)
+  {
+    state = state * 1'664'525u + 1'013'904'223u;
+    byte = static_cast<cen::u8>((state >> 24u) % span);
+  }
+
+  return bytes;
+}
+
+[[nodiscard]] auto compress(const std::vector<cen::u8>& data) -> std::vector<cen::u8>
+{
+  std::vector<cen::u8> result(cen::detail::block_compress_bound(data.size()));
+  const auto size =
+      cen::detail::compress_block(data.data(), data.size(), result.data(), result.size());
+
+  result.resize(size);
+  return result;
+}
+
+[[nodiscard]] auto round_trip(const std::vector<cen::u8>& data) -> bool
+{
+  const auto compressed = compress(data);
+  if (compressed.empty())
+  {
+    return false;
+  }
+
+  std::vector<cen::u8> result(data.size());
+  return cen::detail::decompress_block(compressed.data(),
+                                       compressed.size(),
+                                       result.data(),
+                                       result.size()) &&
+         result == data;
+}
+
+}  // namespace
+
+TEST(BlockCompression, RoundTrip)
+{
+  ASSERT_TRUE(round_trip({}));
+  ASSERT_TRUE(round_trip(make_bytes(1, 256)));
+  ASSERT_TRUE(round_trip(make_bytes(13, 2)));
+
+  for (const auto span : {1u, 4u, 16u, 256u})
+  {
+    ASSERT_TRUE(round_trip(make_bytes(65'536, span))) << span;
+  }
+}
+
+TEST(BlockCompression, CompressesRepetitiveData)
+{
+  const std::vector<cen::u8> zeros(65'536, 0);
+  ASSERT_LT(compress(zeros).size(), 300u);
+
+  // Random data expands slightly, but stays within the bound
+  const auto random = make_bytes(65'536, 256);
+  ASSERT_LE(compress(random).size(), cen::detail::block_compress_bound(random.size()));
+}
+
+TEST(BlockCompression, SmallOutputBuffer)
+{
+  const auto data = make_bytes(1'024, 256);
+
+  std::vector<cen::u8> result(512);
+  ASSERT_EQ(0u,
+            cen::detail::compress_block(data.data(),
+                                        data.size(),
+                                        result.data(),
+                                        result.size()));
+}
+
+TEST(BlockCompression, RejectsMalformedData)
+{
+  const auto data = make_bytes(4'096, 8);
+  const auto compressed = compress(data);
+
+  std::vector<cen::u8> result(data.size());
+
+  // Truncated input
+  ASSERT_FALSE(cen::detail::decompress_block(compressed.data(),
+                                             compressed.size() / 2,
+                                             result.data(),
+                                             result.size()));
+
+  // Wrong uncompressed size
+  ASSERT_FALSE(cen::detail::decompress_block(compressed.data(),
+                                             compressed.size(),
+                                             result.data(),
+                                             result.size() - 1));
+
+  // A match that refers to bytes before the start of the output
+  const cen::u8 invalid[] = {0x10, 'a', 0x10, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f'};
+  ASSERT_FALSE(cen::detail::decompress_block(invalid, sizeof invalid, result.data(), 11));
+
+  // The same block, with a valid offset
+  const cen::u8 valid[] = {0x10, 'a', 0x01, 0x00, 0x50, 'b', 'c', 'd', 'e', 'f'};
+  ASSERT_TRUE(cen::detail::decompress_block(valid, sizeof valid, result.data(), 10));
+  ASSERT_EQ((std::vector<cen::u8>{'a', 'a', 'a', 'a', 'a', 'b', 'c', 'd', 'e', 'f'}),
+            std::vector<cen::u8>(result.begin(), result.begin() + 10));
+}
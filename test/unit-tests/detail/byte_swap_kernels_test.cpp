@@ -0,0 +1,70 @@
+#include "detail/byte_swap_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+/// Creates a deterministic sequence of bytes, with an odd size to exercise the tails.
+[[nodiscard]] auto make_bytes(const std::size_t count = 8 * 131 + 3)
+    -> std::vector<cen::u8>
+{
+  std::vector<cen::u8> bytes(count);
+
+  lcg random{0x12345678u};
+  for (auto& byte : bytes)
+  {
+    byte = static_cast<cen::u8>(random.next() >> 24u);
+  }
+
+  return bytes;
+}
+
+template <std::size_t Size>
+void check_levels()
+{
+  const auto source = make_bytes();
+  const auto count = source.size() / Size;
+
+  // The bytes of every element are reversed, the trailing bytes are left as they are
+  auto expected = source;
+  for (std::size_t index = 0; index < count * Size; ++index)
+  {
+    expected[index] = source[index - index % Size + (Size - 1u - index % Size)];
+  }
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    auto result = source;
+    cen::detail::swap_bytes<Size>(level, result.data(), count);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+}  // namespace
+
+TEST(ByteSwapKernels, IsByteSwappable)
+{
+  ASSERT_TRUE(cen::detail::is_byte_swappable_v<cen::u16>);
+  ASSERT_TRUE(cen::detail::is_byte_swappable_v<cen::i32>);
+  ASSERT_TRUE(cen::detail::is_byte_swappable_v<double>);
+
+  ASSERT_FALSE(cen::detail::is_byte_swappable_v<cen::u8>);
+  ASSERT_FALSE(cen::detail::is_byte_swappable_v<int*>);
+}
+
+TEST(ByteSwapKernels, LevelsMatchScalar)
+{
+  check_levels<2>();
+  check_levels<4>();
+  check_levels<8>();
+}
@@ -0,0 +1,234 @@
+#include "detail/color_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>  // abs
+#include <vector>   // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+// An odd amount of colors, so that every kernel also runs its scalar tail
+inline constexpr std::size_t count = 53;
+
+[[nodiscard]] auto make_colors(const unsigned seed) -> std::vector<cen::u8>
+{
+  std::vector<cen::u8> bytes(count * 4u);
+
+  lcg random{seed};
+  for (auto& byte : bytes)
+  {
+    byte = static_cast<cen::u8>(random.next() >> 24u);
+  }
+
+  // Include some gray, black and white colors
+  for (std::size_t channel = 0; channel < 3u; ++channel)
+  {
+    bytes[channel] = 0;
+    bytes[4u + channel] = 0xFF;
+    bytes[8u + channel] = 0x80;
+  }
+
+  return bytes;
+}
+
+// Premultiplies the colors, so that no channel is greater than the alpha
+[[nodiscard]] auto make_premultiplied(const unsigned seed) -> std::vector<cen::u8>
+{
+  auto bytes = make_colors(seed);
+
+  for (std::size_t index = 0; index < bytes.size(); index += 4u)
+  {
+    for (std::size_t channel = 0; channel < 3u; ++channel)
+    {
+      bytes[index + channel] = static_cast<cen::u8>(
+          cen::detail::multiply_255(bytes[index + channel], bytes[index + 3u]));
+    }
+  }
+
+  return bytes;
+}
+
+void assert_near(const std::vector<cen::u8>& expected,
+                 const std::vector<cen::u8>& actual,
+                 const int tolerance)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (std::size_t index = 0; index < expected.size(); ++index)
+  {
+    ASSERT_LE(std::abs(expected[index] - actual[index]), tolerance) << "Index: " << index;
+  }
+}
+
+}  // namespace
+
+TEST(ColorKernels, Lerp)
+{
+  const auto a = make_colors(1);
+  const auto b = make_colors(2);
+
+  ASSERT_EQ(0u, cen::detail::lerp_255(0, 255, 0));
+  ASSERT_EQ(255u, cen::detail::lerp_255(0, 255, 255));
+  ASSERT_EQ(128u, cen::detail::lerp_255(0, 255, 128));
+  ASSERT_EQ(77u, cen::detail::lerp_255(77, 77, 200));
+
+  for (const cen::u32 weight : {0u, 1u, 128u, 254u, 255u})
+  {
+    std::vector<cen::u8> expected(a.size());
+    cen::detail::lerp_colors_scalar(a.data(), b.data(), expected.data(), count, weight);
+
+    for (const auto level : simd_levels)
+    {
+      if (!cen::detail::is_simd_level_available(level))
+      {
+        continue;
+      }
+
+      std::vector<cen::u8> result(a.size());
+      cen::detail::lerp_colors(level, a.data(), b.data(), result.data(), count, weight);
+      ASSERT_EQ(expected, result);
+    }
+  }
+}
+
+TEST(ColorKernels, Multiply)
+{
+  const auto a = make_colors(3);
+  const auto b = make_colors(4);
+
+  std::vector<cen::u8> expected(a.size());
+  cen::detail::multiply_colors_scalar(a.data(), b.data(), expected.data(), count);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> result(a.size());
+    cen::detail::multiply_colors(level, a.data(), b.data(), result.data(), count);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+TEST(ColorKernels, Composite)
+{
+  const auto src = make_premultiplied(5);
+  const auto dst = make_premultiplied(6);
+
+  // Opaque sources replace the destination, transparent sources keep it
+  ASSERT_EQ(10u, cen::detail::composite_255(10, 255, 200));
+  ASSERT_EQ(200u, cen::detail::composite_255(0, 0, 200));
+
+  std::vector<cen::u8> expected(src.size());
+  cen::detail::composite_colors_scalar(src.data(), dst.data(), expected.data(), count);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> result(src.size());
+    cen::detail::composite_colors(level, src.data(), dst.data(), result.data(), count);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+TEST(ColorKernels, RoundTrips)
+{
+  const auto colors = make_colors(7);
+
+  std::vector<float> hues(count);
+  std::vector<float> saturations(count);
+  std::vector<float> values(count);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> opaque = colors;
+    for (std::size_t index = 3; index < opaque.size(); index += 4u)
+    {
+      opaque[index] = 0xFF;
+    }
+
+    std::vector<cen::u8> result(colors.size());
+
+    cen::detail::rgb_to_hsv(level,
+                            colors.data(),
+                            hues.data(),
+                            saturations.data(),
+                            values.data(),
+                            count);
+    cen::detail::hsv_to_rgb(level,
+                            hues.data(),
+                            saturations.data(),
+                            values.data(),
+                            result.data(),
+                            count);
+    assert_near(opaque, result, 1);
+
+    cen::detail::rgb_to_hsl(level,
+                            colors.data(),
+                            hues.data(),
+                            saturations.data(),
+                            values.data(),
+                            count);
+    cen::detail::hsl_to_rgb(level,
+                            hues.data(),
+                            saturations.data(),
+                            values.data(),
+                            result.data(),
+                            count);
+    assert_near(opaque, result, 1);
+  }
+}
+
+TEST(ColorKernels, ToHsv)
+{
+  const auto colors = make_colors(8);
+
+  std::vector<float> hues(count);
+  std::vector<float> saturations(count);
+  std::vector<float> values(count);
+  cen::detail::rgb_to_hsv_scalar(colors.data(),
+                                 hues.data(),
+                                 saturations.data(),
+                                 values.data(),
+                                 count);
+
+  // Black, white and gray
+  ASSERT_EQ(0.0f, hues[0]);
+  ASSERT_EQ(0.0f, saturations[0]);
+  ASSERT_EQ(0.0f, values[0]);
+  ASSERT_EQ(0.0f, saturations[1]);
+  ASSERT_FLOAT_EQ(100.0f, values[1]);
+  ASSERT_EQ(0.0f, hues[2]);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<float> h(count);
+    std::vector<float> s(count);
+    std::vector<float> v(count);
+    cen::detail::rgb_to_hsv(level, colors.data(), h.data(), s.data(), v.data(), count);
+
+    for (std::size_t index = 0; index < count; ++index)
+    {
+      ASSERT_NEAR(hues[index], h[index], 1e-3f);
+      ASSERT_NEAR(saturations[index], s[index], 1e-3f);
+      ASSERT_NEAR(values[index], v[index], 1e-3f);
+    }
+  }
+}
@@ -0,0 +1,80 @@
+#include "detail/deferred_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <string>  // string
+
+#include "core/integers.hpp"
+
+namespace {
+
+template <typename... Args>
+[[nodiscard]] auto roundtrip(const cen::czstring fmt, const Args&... args) -> std::string
+{
+  std::array<char, 64> arguments{};
+  cen::detail::encode_arguments(arguments.data(), arguments.size(), args...);
+
+  std::array<char, 128> buffer{};
+  const auto formatter = &cen::detail::format_arguments<cen::detail::deferred_t<Args>...>;
+  const auto length = formatter(fmt, arguments.data(), buffer.data(), buffer.size());
+
+  return std::string{buffer.data(), static_cast<std::size_t>(length)};
+}
+
+}  // namespace
+
+TEST(DeferredFormat, Types)
+{
+  static_assert(cen::detail::is_deferred_string_v<char*>);
+  static_assert(cen::detail::is_deferred_string_v<const char*>);
+  static_assert(cen::detail::is_deferred_string_v<char[8]>);
+  static_assert(!cen::detail::is_deferred_string_v<const void*>);
+
+  static_assert(cen::detail::is_deferrable_v<int>);
+  static_assert(cen::detail::is_deferrable_v<double>);
+  static_assert(cen::detail::is_deferrable_v<const char[8]>);
+  static_assert(cen::detail::is_deferrable_v<void*>);
+  static_assert(!cen::detail::is_deferrable_v<std::string>);
+
+  static_assert(cen::detail::deferred_min_size<> == 0);
+  static_assert(cen::detail::deferred_min_size<cen::u8, cen::u32, const char*> == 6);
+}
+
+TEST(DeferredFormat, NoArguments)
+{
+  ASSERT_EQ("foo", roundtrip("foo"));
+}
+
+TEST(DeferredFormat, Numbers)
+{
+  ASSERT_EQ("1 -2 3.50 x", roundtrip("%i %lli %.2f %c", 1, -2ll, 3.5f, 'x'));
+}
+
+TEST(DeferredFormat, Strings)
+{
+  std::string str = "bar";
+  const cen::czstring null = nullptr;
+  const auto result = roundtrip("%s-%s-%i-%s", "foo", str.data(), 7, null);
+
+  // The copy is independent of the original string
+  str = "baz";
+  ASSERT_EQ("foo-bar-7-", result);
+}
+
+TEST(DeferredFormat, TruncatesStrings)
+{
+  const std::string str(100, 'a');
+
+  std::array<char, 16> arguments{};
+  const auto size =
+      cen::detail::encode_arguments(arguments.data(), arguments.size(), str.c_str(), 42);
+  ASSERT_EQ(arguments.size(), size);
+
+  std::array<char, 64> buffer{};
+  const auto formatter = &cen::detail::format_arguments<cen::czstring, int>;
+  formatter("%s %i", arguments.data(), buffer.data(), buffer.size());
+
+  // Eleven characters, the null-terminator and the four bytes of the integer
+  ASSERT_STREQ("aaaaaaaaaaa 42", buffer.data());
+}
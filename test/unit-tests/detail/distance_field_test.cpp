@@ -0,0 +1,67 @@
+#include "detail/distance_field.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+TEST(DistanceField, Size)
+{
+  const std::vector<cen::u8> coverage(4 * 3, 0xFF);
+  const auto field = cen::detail::make_distance_field(coverage.data(), 4, 3, 4, 1, 2);
+  ASSERT_EQ((4u + 4u) * (3u + 4u), field.size());
+}
+
+TEST(DistanceField, Square)
+{
+  // A 4x4 filled square in the middle of an 8x8 mask
+  std::vector<cen::u8> coverage(8 * 8, 0);
+  for (int y = 2; y < 6; ++y)
+  {
+    for (int x = 2; x < 6; ++x)
+    {
+      coverage[y * 8 + x] = 0xFF;
+    }
+  }
+
+  constexpr int spread = 4;
+  constexpr int width = 8 + 2 * spread;
+
+  const auto field = cen::detail::make_distance_field(coverage.data(), 8, 8, 8, 1, spread);
+  const auto at = [&](const int x, const int y) {
+    return field[(y + spread) * width + (x + spread)];
+  };
+
+  // Pixels next to the outline are close to the middle value
+  ASSERT_NEAR(128, at(2, 3), 20);
+  ASSERT_NEAR(128, at(1, 3), 20);
+  ASSERT_GT(at(2, 3), 128);
+  ASSERT_LT(at(1, 3), 128);
+
+  // Values increase towards the center, and decrease away from the shape
+  ASSERT_GT(at(3, 3), at(2, 3));
+  ASSERT_LT(at(0, 3), at(1, 3));
+
+  // Distances beyond the spread are clamped
+  ASSERT_EQ(0, field[0]);
+}
+
+TEST(DistanceField, Stride)
+{
+  // Only every other byte is part of the mask
+  const std::vector<cen::u8> coverage{0xFF, 0, 0xFF, 0, 0, 0xFF, 0xFF, 0};
+  const std::vector<cen::u8> packed{0xFF, 0xFF, 0, 0xFF};
+
+  ASSERT_EQ(cen::detail::make_distance_field(packed.data(), 2, 2, 2, 1, 3),
+            cen::detail::make_distance_field(coverage.data(), 2, 2, 4, 2, 3));
+}
+
+TEST(DistanceField, Empty)
+{
+  const std::vector<cen::u8> coverage(4, 0);
+  const auto field = cen::detail::make_distance_field(coverage.data(), 2, 2, 2, 1, 1);
+
+  for (const auto value : field)
+  {
+    ASSERT_EQ(0, value);
+  }
+}
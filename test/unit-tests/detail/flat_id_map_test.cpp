@@ -0,0 +1,131 @@
+#include "detail/flat_id_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>    // size_t
+#include <memory>     // unique_ptr, make_unique
+#include <stdexcept>  // out_of_range
+#include <utility>    // move
+
+using map_type = cen::detail::flat_id_map<std::size_t, int>;
+
+TEST(FlatIdMap, Defaults)
+{
+  const map_type map;
+  ASSERT_TRUE(map.empty());
+  ASSERT_EQ(0u, map.size());
+  ASSERT_FALSE(map.contains(0));
+  ASSERT_EQ(nullptr, map.find(42));
+  ASSERT_THROW((void) map.at(42), std::out_of_range);
+}
+
+TEST(FlatIdMap, TryEmplace)
+{
+  map_type map;
+
+  const auto [value, inserted] = map.try_emplace(7, 1);
+  ASSERT_TRUE(inserted);
+  ASSERT_EQ(1, *value);
+
+  const auto [existing, reinserted] = map.try_emplace(7, 2);
+  ASSERT_FALSE(reinserted);
+  ASSERT_EQ(value, existing);
+  ASSERT_EQ(1, map.at(7));
+
+  ASSERT_EQ(1u, map.size());
+  ASSERT_TRUE(map.contains(7));
+}
+
+TEST(FlatIdMap, StableReferences)
+{
+  map_type map;
+
+  const auto* first = map.try_emplace(0, 123).first;
+
+  // Enough values to force the table and the value storage to grow several times
+  for (std::size_t id = 1; id < 1'000; ++id)
+  {
+    ASSERT_TRUE(map.try_emplace(id, static_cast<int>(id)).second);
+  }
+
+  ASSERT_EQ(1'000u, map.size());
+  ASSERT_EQ(first, map.find(0));
+  ASSERT_EQ(123, *first);
+
+  for (std::size_t id = 1; id < 1'000; ++id)
+  {
+    ASSERT_EQ(static_cast<int>(id), map.at(id));
+  }
+}
+
+TEST(FlatIdMap, Erase)
+{
+  map_type map;
+
+  for (std::size_t id = 0; id < 100; ++id)
+  {
+    map.try_emplace(id * 1'000, static_cast<int>(id));
+  }
+
+  const auto* kept = map.find(99'000);
+
+  // Erasing every other value must keep the remaining values reachable
+  for (std::size_t id = 0; id < 100; id += 2)
+  {
+    ASSERT_EQ(1u, map.erase(id * 1'000));
+  }
+
+  ASSERT_EQ(0u, map.erase(0));
+  ASSERT_EQ(50u, map.size());
+
+  for (std::size_t id = 0; id < 100; ++id)
+  {
+    ASSERT_EQ(id % 2 != 0, map.contains(id * 1'000));
+  }
+
+  ASSERT_EQ(kept, map.find(99'000));
+
+  // The slots of erased values are reused
+  ASSERT_TRUE(map.try_emplace(5, 5).second);
+  ASSERT_EQ(5, map.at(5));
+  ASSERT_EQ(51u, map.size());
+
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_FALSE(map.contains(99'000));
+}
+
+TEST(FlatIdMap, StrideAlignedIds)
+{
+  map_type map;
+
+  // IDs whose low bits are all zero, e.g. indices shifted above a generation counter
+  for (std::size_t id = 0; id < 1'000; ++id)
+  {
+    ASSERT_TRUE(map.try_emplace(id << 20u, static_cast<int>(id)).second);
+  }
+
+  ASSERT_EQ(1'000u, map.size());
+
+  for (std::size_t id = 0; id < 1'000; id += 3)
+  {
+    ASSERT_EQ(1u, map.erase(id << 20u));
+  }
+
+  for (std::size_t id = 0; id < 1'000; ++id)
+  {
+    ASSERT_EQ(id % 3 != 0, map.contains(id << 20u));
+    ASSERT_FALSE(map.contains((id << 20u) + 1u));
+  }
+}
+
+TEST(FlatIdMap, MoveOnlyValues)
+{
+  cen::detail::flat_id_map<std::size_t, std::unique_ptr<int>> map;
+
+  ASSERT_TRUE(map.try_emplace(1, std::make_unique<int>(10)).second);
+  ASSERT_EQ(10, *map.at(1));
+
+  auto moved = std::move(map);
+  ASSERT_EQ(10, *moved.at(1));
+}
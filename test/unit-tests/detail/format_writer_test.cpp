@@ -0,0 +1,66 @@
+#include "detail/format_writer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <string>  // string
+
+#include "core/integers.hpp"
+#include "detail/to_string.hpp"
+
+TEST(FormatWriter, Write)
+{
+  std::array<char, 64> buffer{};
+  cen::detail::format_writer writer{buffer.data(), buffer.size()};
+
+  const cen::czstring null{};
+  const std::string str = "string";
+
+  const auto length =
+      writer.write("abc ", str, ' ', null, 42, ' ', -7, ' ', cen::u8{200});
+  ASSERT_EQ(20u, length);
+  ASSERT_STREQ("abc string 42 -7 200", buffer.data());
+}
+
+TEST(FormatWriter, Numbers)
+{
+  std::array<char, 64> buffer{};
+
+  cen::detail::format_writer{buffer.data(), buffer.size()}.write(12.5f);
+  ASSERT_EQ(cen::detail::to_string(12.5f).value(), std::string{buffer.data()});
+
+  cen::detail::format_writer{buffer.data(), buffer.size()}.write(-0.25);
+  ASSERT_EQ(cen::detail::to_string(-0.25).value(), std::string{buffer.data()});
+
+  cen::detail::format_writer{buffer.data(), buffer.size()}.write(2'147'483'647);
+  ASSERT_STREQ("2147483647", buffer.data());
+}
+
+TEST(FormatWriter, Truncation)
+{
+  std::array<char, 8> buffer{};
+
+  cen::detail::format_writer writer{buffer.data(), buffer.size()};
+  ASSERT_EQ(15u, writer.write("truncated", 123456));
+  ASSERT_STREQ("truncat", buffer.data());
+
+  // A zero-sized buffer is never written to
+  buffer[0] = 'x';
+  ASSERT_EQ(3u, cen::detail::format_writer(buffer.data(), 0).write("foo"));
+  ASSERT_EQ('x', buffer[0]);
+}
+
+TEST(FormatWriter, Pointers)
+{
+  std::array<char, 32> buffer{};
+
+  const void* null{};
+  ASSERT_EQ(0u, cen::detail::format_writer(buffer.data(), buffer.size()).write(null));
+  ASSERT_STREQ("", buffer.data());
+
+  const int value = 0;
+  const auto length =
+      cen::detail::format_writer(buffer.data(), buffer.size()).write(&value);
+  ASSERT_NE(0u, length);
+  ASSERT_EQ(length, std::string{buffer.data()}.size());
+}
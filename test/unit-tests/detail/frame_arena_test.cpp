@@ -0,0 +1,63 @@
+#include "detail/frame_arena.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // uintptr_t
+
+TEST(FrameArena, Allocate)
+{
+  cen::detail::frame_arena arena{128};
+  ASSERT_EQ(0u, arena.capacity());
+
+  auto* a = arena.allocate(10, 1);
+  auto* b = arena.allocate(8, 8);
+
+  ASSERT_NE(a, b);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(b) % 8u);
+  ASSERT_EQ(128u, arena.capacity());
+
+  // Allocations that don't fit in a block get a block of their own
+  ASSERT_NE(nullptr, arena.allocate(500, 16));
+  ASSERT_GE(arena.capacity(), 128u + 500u);
+}
+
+TEST(FrameArena, Reset)
+{
+  cen::detail::frame_arena arena{64};
+
+  auto* first = arena.allocate(32, 8);
+  for (int i = 0; i < 10; ++i)
+  {
+    (void) arena.allocate(32, 8);
+  }
+
+  const auto capacity = arena.capacity();
+
+  // The blocks are reused after a reset, so the capacity stays the same
+  arena.reset();
+  ASSERT_EQ(first, arena.allocate(32, 8));
+
+  for (int i = 0; i < 10; ++i)
+  {
+    (void) arena.allocate(32, 8);
+  }
+
+  ASSERT_EQ(capacity, arena.capacity());
+}
+
+TEST(FrameArena, Rewind)
+{
+  cen::detail::frame_arena arena{64};
+  (void) arena.allocate(16, 8);
+
+  const auto marker = arena.mark();
+  auto* first = arena.allocate(16, 8);
+  for (int i = 0; i < 10; ++i)
+  {
+    (void) arena.allocate(32, 8);
+  }
+
+  // Only the memory allocated after the marker is reused
+  arena.rewind(marker);
+  ASSERT_EQ(first, arena.allocate(16, 8));
+}
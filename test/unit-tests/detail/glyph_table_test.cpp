@@ -0,0 +1,78 @@
+#include "detail/glyph_table.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr, make_unique
+
+TEST(GlyphTable, Defaults)
+{
+  const cen::detail::glyph_table<int> table;
+  ASSERT_TRUE(table.empty());
+  ASSERT_EQ(0u, table.size());
+  ASSERT_FALSE(table.contains('a'));
+  ASSERT_FALSE(table.contains(0x4E2D));
+}
+
+TEST(GlyphTable, DenseRange)
+{
+  cen::detail::glyph_table<int> table;
+
+  ASSERT_TRUE(table.try_emplace('a', 1));
+  ASSERT_FALSE(table.try_emplace('a', 2));
+  ASSERT_TRUE(table.try_emplace(0xFF, 3));
+
+  ASSERT_EQ(2u, table.size());
+  ASSERT_EQ(1, *table.find('a'));
+  ASSERT_EQ(3, *table.find(0xFF));
+  ASSERT_EQ(nullptr, table.find('b'));
+}
+
+TEST(GlyphTable, SparseRange)
+{
+  cen::detail::glyph_table<int> table;
+
+  // Enough glyphs to force the sparse table to grow several times
+  for (cen::u16 glyph = 0x400; glyph < 0x600; ++glyph)
+  {
+    ASSERT_TRUE(table.try_emplace(glyph, glyph * 2));
+  }
+
+  ASSERT_FALSE(table.try_emplace(0x400, 0));
+  ASSERT_EQ(0x200u, table.size());
+
+  for (cen::u16 glyph = 0x400; glyph < 0x600; ++glyph)
+  {
+    ASSERT_EQ(glyph * 2, *table.find(glyph));
+  }
+
+  ASSERT_FALSE(table.contains(0x600));
+  ASSERT_FALSE(table.contains(0xFFFF));
+}
+
+TEST(GlyphTable, MoveOnlyValues)
+{
+  cen::detail::glyph_table<std::unique_ptr<int>> table;
+
+  for (cen::u16 glyph = 0x1000; glyph < 0x1040; ++glyph)
+  {
+    ASSERT_TRUE(table.try_emplace(glyph, std::make_unique<int>(glyph)));
+  }
+
+  ASSERT_EQ(0x1020, **table.find(0x1020));
+}
+
+TEST(GlyphTable, WideKeys)
+{
+  cen::detail::glyph_table<int, cen::u32> table;
+
+  // Keys that only differ in the upper bits refer to different glyph variants
+  ASSERT_TRUE(table.try_emplace('a', 1));
+  ASSERT_TRUE(table.try_emplace(0x10000u | 'a', 2));
+  ASSERT_TRUE(table.try_emplace(0x20000u | 'a', 3));
+
+  ASSERT_EQ(3u, table.size());
+  ASSERT_EQ(1, *table.find('a'));
+  ASSERT_EQ(2, *table.find(0x10000u | 'a'));
+  ASSERT_EQ(3, *table.find(0x20000u | 'a'));
+  ASSERT_FALSE(table.contains(0x30000u | 'a'));
+}
@@ -0,0 +1,29 @@
+#include "detail/key_name_table.hpp"
+
+#include <gtest/gtest.h>
+
+using cen::detail::key_name_eq;
+using cen::detail::key_name_hash;
+
+static_assert(key_name_hash("Escape") == key_name_hash("escape"));
+static_assert(key_name_eq("Left Shift", "left shift"));
+
+TEST(KeyNameTable, Hash)
+{
+  ASSERT_EQ(key_name_hash("Return"), key_name_hash("RETURN"));
+  ASSERT_EQ(key_name_hash("Keypad 1"), key_name_hash("keypad 1"));
+
+  ASSERT_NE(key_name_hash("A"), key_name_hash("B"));
+  ASSERT_NE(key_name_hash("Left Alt"), key_name_hash("Right Alt"));
+}
+
+TEST(KeyNameTable, Equality)
+{
+  ASSERT_TRUE(key_name_eq("", ""));
+  ASSERT_TRUE(key_name_eq("Space", "SPACE"));
+  ASSERT_TRUE(key_name_eq("Keypad +", "keypad +"));
+
+  ASSERT_FALSE(key_name_eq("Space", "Spac"));
+  ASSERT_FALSE(key_name_eq("Spac", "Space"));
+  ASSERT_FALSE(key_name_eq("F1", "F2"));
+}
@@ -0,0 +1,39 @@
+#include "detail/keymap_table.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(KeymapTable, MatchesSDL)
+{
+  const cen::detail::keymap_table table;
+
+  for (int code = 0; code < SDL_NUM_SCANCODES; ++code)
+  {
+    const auto key = SDL_GetKeyFromScancode(static_cast<SDL_Scancode>(code));
+    ASSERT_EQ(SDL_GetScancodeFromKey(key), table.to_scan_code(key));
+  }
+
+  const SDL_Keycode keys[] = {
+      SDLK_UNKNOWN,
+      SDLK_a,
+      SDLK_RETURN,
+      SDLK_LEFT,
+      SDLK_KP_ENTER,
+      SDLK_SCANCODE_MASK | SDL_NUM_SCANCODES,
+      0xE9,    // Latin small letter e with acute
+      0x0436,  // Cyrillic small letter zhe
+  };
+
+  for (const auto key : keys)
+  {
+    ASSERT_EQ(SDL_GetScancodeFromKey(key), table.to_scan_code(key));
+  }
+}
+
+TEST(KeymapTable, Copy)
+{
+  const cen::detail::keymap_table table;
+  const cen::detail::keymap_table copy{table};  // NOLINT
+
+  ASSERT_EQ(table.to_scan_code(SDLK_w), copy.to_scan_code(SDLK_w));
+  ASSERT_EQ(table.to_scan_code(SDLK_ESCAPE), copy.to_scan_code(SDLK_ESCAPE));
+}
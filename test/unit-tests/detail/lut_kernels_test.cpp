@@ -0,0 +1,114 @@
+#include "detail/lut_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <limits>  // numeric_limits
+#include <vector>  // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+// An odd amount of values, so that every kernel also runs its scalar tail
+inline constexpr std::size_t count = 53;
+
+[[nodiscard]] auto make_table(const std::size_t size) -> std::vector<cen::u32>
+{
+  std::vector<cen::u32> table(size);
+  for (std::size_t index = 0; index < size; ++index)
+  {
+    table[index] = static_cast<cen::u32>(index) * 2'654'435'761u;
+  }
+
+  return table;
+}
+
+}  // namespace
+
+TEST(LutKernels, Index)
+{
+  const cen::detail::lut_range range{-1, 10, 20};
+
+  ASSERT_EQ(0u, cen::detail::lut_index(range, -1));
+  ASSERT_EQ(0u, cen::detail::lut_index(range, -5));
+  ASSERT_EQ(10u, cen::detail::lut_index(range, 0));
+  ASSERT_EQ(11u, cen::detail::lut_index(range, 0.06f));
+  ASSERT_EQ(20u, cen::detail::lut_index(range, 1));
+  ASSERT_EQ(20u, cen::detail::lut_index(range, 100));
+  ASSERT_EQ(0u, cen::detail::lut_index(range, std::numeric_limits<float>::quiet_NaN()));
+}
+
+TEST(LutKernels, LookupBytes)
+{
+  const auto table = make_table(256);
+
+  std::vector<cen::u8> in(count);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    in[index] = static_cast<cen::u8>(index * 37u + 200u);
+  }
+
+  std::vector<cen::u32> expected(count);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    expected[index] = table[in[index]];
+  }
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u32> result(count);
+    cen::detail::lookup_bytes(level, table.data(), in.data(), result.data(), count);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+TEST(LutKernels, LookupValues)
+{
+  const auto table = make_table(4096);
+  const cen::detail::lut_range range{-2, 4095.0f / 4.0f, 4095};
+
+  std::vector<float> in(count);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    in[index] = -3 + static_cast<float>(index) * 0.11f;
+  }
+
+  in[7] = std::numeric_limits<float>::quiet_NaN();
+  in[8] = std::numeric_limits<float>::infinity();
+  in[9] = -std::numeric_limits<float>::infinity();
+
+  std::vector<cen::u32> expected(count);
+  cen::detail::lookup_values_scalar(table.data(),
+                                    range,
+                                    in.data(),
+                                    expected.data(),
+                                    count);
+
+  ASSERT_EQ(table.front(), expected[0]);
+  ASSERT_EQ(table.front(), expected[7]);
+  ASSERT_EQ(table.back(), expected[8]);
+  ASSERT_EQ(table.front(), expected[9]);
+  ASSERT_EQ(table.back(), expected.back());
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u32> result(count);
+    cen::detail::lookup_values(level,
+                               table.data(),
+                               range,
+                               in.data(),
+                               result.data(),
+                               count);
+    ASSERT_EQ(expected, result);
+  }
+}
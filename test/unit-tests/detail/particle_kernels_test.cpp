@@ -0,0 +1,86 @@
+#include "detail/particle_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+// An odd amount of particles, so that every kernel has a scalar tail
+struct particle_set final
+{
+  particle_set()
+  {
+    for (int index = 0; index < 37; ++index)
+    {
+      xs.push_back(static_cast<float>(index));
+      ys.push_back(static_cast<float>(-index));
+      vxs.push_back(static_cast<float>(index % 5) * 2.0f);
+      vys.push_back(static_cast<float>(index % 3) - 1.0f);
+      ages.push_back(static_cast<float>(index) * 0.25f);
+    }
+  }
+
+  [[nodiscard]] auto columns() -> cen::detail::particle_columns
+  {
+    return {xs.data(), ys.data(), vxs.data(), vys.data(), ages.data()};
+  }
+
+  std::vector<float> xs;
+  std::vector<float> ys;
+  std::vector<float> vxs;
+  std::vector<float> vys;
+  std::vector<float> ages;
+};
+
+}  // namespace
+
+TEST(ParticleKernels, Integrate)
+{
+  const cen::detail::particle_step step{0.5f, 0.0f, 10.0f};
+
+  particle_set expected;
+  cen::detail::integrate_particles_scalar(expected.columns(), 0, 37, step);
+
+  ASSERT_FLOAT_EQ(2.0f, expected.xs[1]);   // 1 + 2 * 0.5
+  ASSERT_FLOAT_EQ(5.0f, expected.vys[1]);  // 0 + 10 * 0.5
+  ASSERT_FLOAT_EQ(1.5f, expected.ys[1]);   // -1 + 5 * 0.5
+  ASSERT_FLOAT_EQ(0.75f, expected.ages[1]);
+
+  for (const auto level : simd_levels)
+  {
+    particle_set actual;
+    cen::detail::integrate_particles(level, actual.columns(), 0, 37, step);
+
+    for (std::size_t index = 0; index < expected.xs.size(); ++index)
+    {
+      ASSERT_FLOAT_EQ(expected.xs[index], actual.xs[index]);
+      ASSERT_FLOAT_EQ(expected.ys[index], actual.ys[index]);
+      ASSERT_FLOAT_EQ(expected.vxs[index], actual.vxs[index]);
+      ASSERT_FLOAT_EQ(expected.vys[index], actual.vys[index]);
+      ASSERT_FLOAT_EQ(expected.ages[index], actual.ages[index]);
+    }
+  }
+}
+
+TEST(ParticleKernels, IntegrateRange)
+{
+  const cen::detail::particle_step step{1.0f, 1.0f, 0.0f};
+
+  for (const auto level : simd_levels)
+  {
+    particle_set particles;
+    cen::detail::integrate_particles(level, particles.columns(), 3, 14, step);
+
+    ASSERT_FLOAT_EQ(2.0f, particles.xs[2]);
+    ASSERT_FLOAT_EQ(0.5f, particles.ages[2]);
+    ASSERT_FLOAT_EQ(14.0f, particles.xs[14]);
+
+    // Particle 3 has a velocity of 6, which becomes 7
+    ASSERT_FLOAT_EQ(10.0f, particles.xs[3]);
+    ASSERT_FLOAT_EQ(7.0f, particles.vxs[3]);
+  }
+}
@@ -0,0 +1,203 @@
+#include "detail/pixel_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>    // array
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+/// Creates a deterministic sequence of pixels, with an odd size to exercise the tails.
+[[nodiscard]] auto make_pixels(const std::size_t count = 1'027) -> std::vector<cen::u32>
+{
+  std::vector<cen::u32> pixels(count);
+
+  lcg random{0x12345678u};
+  for (auto& pixel : pixels)
+  {
+    pixel = random.next();
+  }
+
+  return pixels;
+}
+
+[[nodiscard]] auto layout_of(const cen::u32 format) -> cen::detail::channel_layout
+{
+  cen::detail::channel_layout layout;
+  EXPECT_TRUE(cen::detail::get_channel_layout(format, layout));
+  return layout;
+}
+
+}  // namespace
+
+TEST(PixelKernels, GetChannelLayout)
+{
+  cen::detail::channel_layout layout;
+  ASSERT_FALSE(cen::detail::get_channel_layout(SDL_PIXELFORMAT_RGB565, layout));
+  ASSERT_FALSE(cen::detail::get_channel_layout(SDL_PIXELFORMAT_RGB24, layout));
+
+  ASSERT_TRUE(cen::detail::get_channel_layout(SDL_PIXELFORMAT_ARGB8888, layout));
+  ASSERT_EQ(16, layout.red);
+  ASSERT_EQ(8, layout.green);
+  ASSERT_EQ(0, layout.blue);
+  ASSERT_EQ(24, layout.alpha);
+  ASSERT_FALSE(layout.opaque);
+
+  ASSERT_TRUE(cen::detail::get_channel_layout(SDL_PIXELFORMAT_RGB888, layout));
+  ASSERT_TRUE(layout.opaque);
+}
+
+TEST(PixelKernels, Swizzle)
+{
+  const auto plan = cen::detail::make_swizzle_plan(layout_of(SDL_PIXELFORMAT_RGBA8888),
+                                                   layout_of(SDL_PIXELFORMAT_ARGB8888));
+  ASSERT_EQ(0x44112233u, cen::detail::swizzle(plan, 0x11223344u));
+
+  const auto abgr = cen::detail::make_swizzle_plan(layout_of(SDL_PIXELFORMAT_RGBA8888),
+                                                   layout_of(SDL_PIXELFORMAT_ABGR8888));
+  ASSERT_EQ(0x44332211u, cen::detail::swizzle(abgr, 0x11223344u));
+}
+
+TEST(PixelKernels, SwizzleOpaque)
+{
+  // The padding byte of the source is ignored, and the result is opaque
+  const auto from = cen::detail::make_swizzle_plan(layout_of(SDL_PIXELFORMAT_RGB888),
+                                                   layout_of(SDL_PIXELFORMAT_RGBA8888));
+  ASSERT_EQ(0x112233FFu, cen::detail::swizzle(from, 0x00112233u));
+
+  // The alpha values are dropped, and the padding bytes are filled
+  const auto to = cen::detail::make_swizzle_plan(layout_of(SDL_PIXELFORMAT_RGBA8888),
+                                                 layout_of(SDL_PIXELFORMAT_BGR888));
+  ASSERT_EQ(0xFF332211u, cen::detail::swizzle(to, 0x11223344u));
+}
+
+TEST(PixelKernels, SwizzleLevelsMatchScalar)
+{
+  const auto source = make_pixels();
+  const std::array formats = {SDL_PIXELFORMAT_RGBA8888,
+                              SDL_PIXELFORMAT_ARGB8888,
+                              SDL_PIXELFORMAT_ABGR8888,
+                              SDL_PIXELFORMAT_BGRA8888,
+                              SDL_PIXELFORMAT_RGB888,
+                              SDL_PIXELFORMAT_BGRX8888};
+
+  for (const auto from : formats)
+  {
+    for (const auto to : formats)
+    {
+      const auto plan = cen::detail::make_swizzle_plan(layout_of(from), layout_of(to));
+
+      std::vector<cen::u32> expected(source.size());
+      cen::detail::swizzle_scalar(plan, source.data(), expected.data(), source.size());
+
+      for (const auto level : simd_levels)
+      {
+        if (!cen::detail::is_simd_level_available(level))
+        {
+          continue;
+        }
+
+        std::vector<cen::u32> result(source.size());
+        cen::detail::swizzle_pixels(level,
+                                    plan,
+                                    source.data(),
+                                    result.data(),
+                                    source.size());
+        ASSERT_EQ(expected, result);
+
+        // In-place conversions must also work
+        auto inPlace = source;
+        cen::detail::swizzle_pixels(level,
+                                    plan,
+                                    inPlace.data(),
+                                    inPlace.data(),
+                                    inPlace.size());
+        ASSERT_EQ(expected, inPlace);
+      }
+    }
+  }
+}
+
+TEST(PixelKernels, Premultiply)
+{
+  const auto layout = layout_of(SDL_PIXELFORMAT_RGBA8888);
+
+  ASSERT_EQ(0x80808080u, cen::detail::premultiply(layout, 0xFFFFFF80u));
+  ASSERT_EQ(0x00000000u, cen::detail::premultiply(layout, 0xFFFFFF00u));
+  ASSERT_EQ(0x112233FFu, cen::detail::premultiply(layout, 0x112233FFu));
+}
+
+TEST(PixelKernels, MultiplyIsExact)
+{
+  for (cen::u32 a = 0; a < 256; ++a)
+  {
+    for (cen::u32 b = 0; b < 256; ++b)
+    {
+      const auto expected = (a * b * 2u + 255u) / 510u;  // Round half up
+      ASSERT_EQ(expected, cen::detail::multiply_255(a, b));
+    }
+  }
+}
+
+TEST(PixelKernels, PremultiplyLevelsMatchScalar)
+{
+  const auto source = make_pixels();
+  const std::array formats = {SDL_PIXELFORMAT_RGBA8888,
+                              SDL_PIXELFORMAT_ARGB8888,
+                              SDL_PIXELFORMAT_ABGR8888,
+                              SDL_PIXELFORMAT_BGRA8888};
+
+  for (const auto format : formats)
+  {
+    const auto layout = layout_of(format);
+
+    auto expected = source;
+    cen::detail::premultiply_scalar(layout, expected.data(), expected.size());
+
+    for (const auto level : simd_levels)
+    {
+      if (cen::detail::is_simd_level_available(level))
+      {
+        auto result = source;
+        cen::detail::premultiply_pixels(level, layout, result.data(), result.size());
+        ASSERT_EQ(expected, result);
+      }
+    }
+  }
+}
+
+TEST(PixelKernels, Unpremultiply)
+{
+  const auto layout = layout_of(SDL_PIXELFORMAT_ARGB8888);
+
+  ASSERT_EQ(0x00000000u, cen::detail::unpremultiply(layout, 0x00112233u));
+  ASSERT_EQ(0xFF112233u, cen::detail::unpremultiply(layout, 0xFF112233u));
+  ASSERT_EQ(0x80FFFFFFu, cen::detail::unpremultiply(layout, 0x80808080u));
+
+  // Values that are larger than the alpha value are clamped
+  ASSERT_EQ(0x10FFFFFFu, cen::detail::unpremultiply(layout, 0x10FFFFFFu));
+}
+
+TEST(PixelKernels, RoundTrip)
+{
+  const auto layout = layout_of(SDL_PIXELFORMAT_RGBA8888);
+
+  auto pixels = make_pixels();
+  for (auto& pixel : pixels)
+  {
+    pixel |= 0xFFu;  // Opaque pixels survive premultiplication unchanged
+  }
+
+  const auto original = pixels;
+  cen::detail::premultiply_pixels(cen::detail::get_simd_level(),
+                                  layout,
+                                  pixels.data(),
+                                  pixels.size());
+  ASSERT_EQ(original, pixels);
+
+  cen::detail::unpremultiply_pixels(layout, pixels.data(), pixels.size());
+  ASSERT_EQ(original, pixels);
+}
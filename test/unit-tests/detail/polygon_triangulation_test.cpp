@@ -0,0 +1,76 @@
+#include "detail/polygon_triangulation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>    // fabs
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "math/point.hpp"
+
+namespace {
+
+// Returns the total area of the triangles
+[[nodiscard]] auto triangle_area(const std::vector<cen::fpoint>& points,
+                                 const std::vector<int>& indices) -> float
+{
+  float area = 0;
+  for (std::size_t index = 0; index + 2 < indices.size(); index += 3)
+  {
+    area += std::fabs(cen::detail::cross_product(points[indices[index]],
+                                                 points[indices[index + 1]],
+                                                 points[indices[index + 2]]));
+  }
+
+  return area * 0.5f;
+}
+
+}  // namespace
+
+TEST(PolygonTriangulation, Convex)
+{
+  const std::vector<cen::fpoint> square{{0, 0}, {10, 0}, {10, 10}, {0, 10}};
+
+  std::vector<int> indices;
+  ASSERT_TRUE(cen::detail::triangulate_polygon(square.data(), square.size(), indices));
+  ASSERT_EQ(6u, indices.size());
+  ASSERT_FLOAT_EQ(100.0f, triangle_area(square, indices));
+}
+
+TEST(PolygonTriangulation, Concave)
+{
+  // An L-shape, in the opposite winding order
+  const std::vector<cen::fpoint> shape{{0, 0},
+                                       {0, 20},
+                                       {20, 20},
+                                       {20, 10},
+                                       {10, 10},
+                                       {10, 0}};
+
+  std::vector<int> indices;
+  ASSERT_TRUE(cen::detail::triangulate_polygon(shape.data(), shape.size(), indices));
+  ASSERT_EQ(12u, indices.size());
+  ASSERT_FLOAT_EQ(300.0f, triangle_area(shape, indices));
+}
+
+TEST(PolygonTriangulation, CollinearPoints)
+{
+  const std::vector<cen::fpoint> shape{{0, 0}, {5, 0}, {10, 0}, {10, 10}, {0, 10}};
+
+  std::vector<int> indices;
+  ASSERT_TRUE(cen::detail::triangulate_polygon(shape.data(), shape.size(), indices));
+  ASSERT_FLOAT_EQ(100.0f, triangle_area(shape, indices));
+}
+
+TEST(PolygonTriangulation, Degenerate)
+{
+  std::vector<int> indices{1, 2, 3};
+
+  const std::vector<cen::fpoint> line{{0, 0}, {10, 0}};
+  ASSERT_FALSE(cen::detail::triangulate_polygon(line.data(), line.size(), indices));
+
+  const std::vector<cen::fpoint> flat{{0, 0}, {5, 0}, {10, 0}};
+  ASSERT_FALSE(cen::detail::triangulate_polygon(flat.data(), flat.size(), indices));
+
+  ASSERT_EQ(3u, indices.size());
+}
@@ -0,0 +1,61 @@
+#include "detail/radix_sort.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // stable_sort, is_sorted
+#include <random>     // mt19937_64
+#include <vector>     // vector
+
+TEST(RadixSort, Empty)
+{
+  std::vector<cen::detail::sort_pair> pairs;
+  std::vector<cen::detail::sort_pair> scratch;
+
+  cen::detail::radix_sort(pairs, scratch);
+  ASSERT_TRUE(pairs.empty());
+}
+
+TEST(RadixSort, MatchesStableSort)
+{
+  std::mt19937_64 engine{42};
+
+  std::vector<cen::detail::sort_pair> pairs;
+  for (cen::u32 index = 0; index < 1'000; ++index)
+  {
+    // Only a few distinct high and low bits, so that passes are skipped
+    const auto key = ((engine() % 4u) << 48u) | (engine() % 16u);
+    pairs.push_back({key, index});
+  }
+
+  auto expected = pairs;
+  std::stable_sort(expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+    return a.key < b.key;
+  });
+
+  std::vector<cen::detail::sort_pair> scratch;
+  cen::detail::radix_sort(pairs, scratch);
+
+  ASSERT_EQ(expected.size(), pairs.size());
+  for (std::size_t i = 0; i < pairs.size(); ++i)
+  {
+    ASSERT_EQ(expected[i].key, pairs[i].key);
+    ASSERT_EQ(expected[i].index, pairs[i].index);
+  }
+}
+
+TEST(RadixSort, FullKeys)
+{
+  std::mt19937_64 engine{7};
+
+  std::vector<cen::detail::sort_pair> pairs;
+  for (cen::u32 index = 0; index < 500; ++index)
+  {
+    pairs.push_back({engine(), index});
+  }
+
+  std::vector<cen::detail::sort_pair> scratch;
+  cen::detail::radix_sort(pairs, scratch);
+
+  const auto byKey = [](const auto& a, const auto& b) { return a.key < b.key; };
+  ASSERT_TRUE(std::is_sorted(pairs.begin(), pairs.end(), byKey));
+}
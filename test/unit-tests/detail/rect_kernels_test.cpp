@@ -0,0 +1,229 @@
+#include "detail/rect_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+// A grid of rectangles of various sizes, some without an area, and an odd count
+struct rect_grid final
+{
+  rect_grid()
+  {
+    for (int index = 0; index < 37; ++index)
+    {
+      xs.push_back(static_cast<float>(index % 6) * 10.0f - 20.0f);
+      ys.push_back(static_cast<float>(index / 6) * 10.0f - 20.0f);
+      widths.push_back(static_cast<float>(index % 5) * 5.0f);
+      heights.push_back(static_cast<float>(index % 7) * 4.0f);
+    }
+  }
+
+  [[nodiscard]] auto columns() const -> cen::detail::rect_columns<float>
+  {
+    return {xs.data(), ys.data(), widths.data(), heights.data()};
+  }
+
+  [[nodiscard]] auto size() const -> std::size_t
+  {
+    return xs.size();
+  }
+
+  std::vector<float> xs;
+  std::vector<float> ys;
+  std::vector<float> widths;
+  std::vector<float> heights;
+};
+
+}  // namespace
+
+TEST(RectKernels, Intersect)
+{
+  const rect_grid grid;
+  const cen::detail::rect_extent<float> area{-5, -5, 15, 12};
+
+  std::vector<cen::u8> expected(grid.size());
+  const auto expectedHits = cen::detail::rects_intersect_scalar(grid.columns(),
+                                                                grid.size(),
+                                                                area,
+                                                                expected.data());
+
+  ASSERT_GT(expectedHits, 0u);
+  ASSERT_LT(expectedHits, grid.size());
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> result(grid.size());
+    const auto hits = cen::detail::rects_intersect(level,
+                                                   grid.columns(),
+                                                   grid.size(),
+                                                   area,
+                                                   result.data());
+
+    ASSERT_EQ(expectedHits, hits);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+TEST(RectKernels, Contain)
+{
+  const rect_grid grid;
+
+  std::vector<cen::u8> expected(grid.size());
+  const auto expectedHits = cen::detail::rects_contain_scalar(grid.columns(),
+                                                              grid.size(),
+                                                              0.0f,
+                                                              0.0f,
+                                                              expected.data());
+  ASSERT_GT(expectedHits, 0u);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> result(grid.size());
+    const auto hits = cen::detail::rects_contain(level,
+                                                 grid.columns(),
+                                                 grid.size(),
+                                                 0.0f,
+                                                 0.0f,
+                                                 result.data());
+
+    ASSERT_EQ(expectedHits, hits);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+TEST(RectKernels, PointsWithin)
+{
+  const rect_grid grid;
+  const cen::detail::rect_extent<float> area{-10, -10, 10, 10};
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    // Points on the borders are contained
+    std::vector<cen::u8> result(grid.size());
+    const auto hits = cen::detail::points_within(level,
+                                                 grid.xs.data(),
+                                                 grid.ys.data(),
+                                                 grid.size(),
+                                                 area,
+                                                 result.data());
+
+    ASSERT_EQ(9u, hits);
+    ASSERT_EQ(1, result.at(7));   // (-10, -10)
+    ASSERT_EQ(0, result.at(12));  // (-20, 0)
+  }
+}
+
+TEST(RectKernels, Bounds)
+{
+  const rect_grid grid;
+
+  auto expected = cen::detail::empty_extent<float>();
+  cen::detail::rect_bounds_scalar(grid.columns(), grid.size(), expected);
+
+  auto expectedPoints = cen::detail::empty_extent<float>();
+  cen::detail::point_bounds_scalar(grid.xs.data(),
+                                   grid.ys.data(),
+                                   grid.size(),
+                                   expectedPoints);
+
+  ASSERT_FLOAT_EQ(-20, expectedPoints.x);
+  ASSERT_FLOAT_EQ(30, expectedPoints.maxX);
+  ASSERT_FLOAT_EQ(40, expectedPoints.maxY);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    auto extent = cen::detail::empty_extent<float>();
+    cen::detail::rect_bounds(level, grid.columns(), grid.size(), extent);
+
+    ASSERT_EQ(expected.x, extent.x);
+    ASSERT_EQ(expected.y, extent.y);
+    ASSERT_EQ(expected.maxX, extent.maxX);
+    ASSERT_EQ(expected.maxY, extent.maxY);
+
+    auto points = cen::detail::empty_extent<float>();
+    cen::detail::point_bounds(level, grid.xs.data(), grid.ys.data(), grid.size(), points);
+
+    ASSERT_EQ(expectedPoints.x, points.x);
+    ASSERT_EQ(expectedPoints.y, points.y);
+    ASSERT_EQ(expectedPoints.maxX, points.maxX);
+    ASSERT_EQ(expectedPoints.maxY, points.maxY);
+  }
+}
+
+TEST(RectKernels, Translate)
+{
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    rect_grid grid;
+    cen::detail::translate_coordinates(level,
+                                       grid.xs.data(),
+                                       grid.ys.data(),
+                                       grid.size(),
+                                       1.5f,
+                                       -2.0f);
+
+    for (std::size_t index = 0; index < grid.size(); ++index)
+    {
+      ASSERT_FLOAT_EQ(static_cast<float>(index % 6) * 10.0f - 18.5f, grid.xs.at(index));
+      ASSERT_FLOAT_EQ(static_cast<float>(index / 6) * 10.0f - 22.0f, grid.ys.at(index));
+    }
+  }
+}
+
+TEST(RectKernels, Transform)
+{
+  const cen::detail::affine_coefficients m{0.5f, -1.25f, 2.0f, 0.75f, 3.0f, -4.0f};
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    rect_grid grid;
+    cen::detail::transform_coordinates(level,
+                                       grid.xs.data(),
+                                       grid.ys.data(),
+                                       grid.size(),
+                                       m);
+
+    for (std::size_t index = 0; index < grid.size(); ++index)
+    {
+      const auto x = static_cast<float>(index % 6) * 10.0f - 20.0f;
+      const auto y = static_cast<float>(index / 6) * 10.0f - 20.0f;
+
+      ASSERT_NEAR(m.a * x + m.c * y + m.tx, grid.xs.at(index), 1e-4f);
+      ASSERT_NEAR(m.b * x + m.d * y + m.ty, grid.ys.at(index), 1e-4f);
+    }
+  }
+}
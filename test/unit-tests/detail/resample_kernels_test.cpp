@@ -0,0 +1,162 @@
+#include "detail/resample_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>    // array
+#include <cstddef>  // size_t
+#include <vector>   // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+inline constexpr std::array kernels = {cen::detail::resample_kernel::box,
+                                       cen::detail::resample_kernel::triangle,
+                                       cen::detail::resample_kernel::lanczos3};
+
+[[nodiscard]] auto make_bytes(const std::size_t count) -> std::vector<cen::u8>
+{
+  std::vector<cen::u8> bytes(count);
+
+  lcg random{0x9E3779B9u};
+  for (auto& byte : bytes)
+  {
+    byte = static_cast<cen::u8>(random.next() >> 24u);
+  }
+
+  return bytes;
+}
+
+}  // namespace
+
+TEST(ResampleKernels, WeightsAddUpToOne)
+{
+  for (const auto kernel : kernels)
+  {
+    for (const auto [from, to] : {std::array{100, 37}, {37, 100}, {3, 1}, {1, 5}, {8, 8}})
+    {
+      const auto taps = cen::detail::make_resample_taps(kernel, from, to);
+      ASSERT_EQ(0, taps.count % 2);
+      ASSERT_EQ(static_cast<std::size_t>(to), taps.first.size());
+
+      for (int target = 0; target < to; ++target)
+      {
+        int sum = 0;
+        for (int tap = 0; tap < taps.count; ++tap)
+        {
+          sum += taps.weights[static_cast<std::size_t>(target * taps.count + tap)];
+        }
+
+        ASSERT_EQ(cen::detail::resample_one, sum);
+        ASSERT_GE(taps.first[static_cast<std::size_t>(target)], 0);
+      }
+    }
+  }
+}
+
+TEST(ResampleKernels, IdentityTaps)
+{
+  // Resampling to the same size must not blur the samples
+  const auto taps =
+      cen::detail::make_resample_taps(cen::detail::resample_kernel::lanczos3, 16, 16);
+
+  const auto source = make_bytes(16 * 4);
+  std::vector<cen::u8> result(source.size());
+  cen::detail::resample_row_scalar(taps, source.data(), result.data(), 16);
+
+  ASSERT_EQ(source, result);
+}
+
+TEST(ResampleKernels, RowLevelsMatchScalar)
+{
+  constexpr int sourceWidth = 101;
+  constexpr int targetWidth = 29;
+
+  const auto source = make_bytes(sourceWidth * 4);
+
+  for (const auto kernel : kernels)
+  {
+    const auto taps = cen::detail::make_resample_taps(kernel, sourceWidth, targetWidth);
+
+    std::vector<cen::u8> expected(targetWidth * 4);
+    cen::detail::resample_row_scalar(taps, source.data(), expected.data(), targetWidth);
+
+    for (const auto level : simd_levels)
+    {
+      if (!cen::detail::is_simd_level_available(level))
+      {
+        continue;
+      }
+
+      std::vector<cen::u8> result(expected.size());
+      cen::detail::resample_row(level, taps, source.data(), result.data(), targetWidth);
+      ASSERT_EQ(expected, result);
+    }
+  }
+}
+
+TEST(ResampleKernels, ColumnLevelsMatchScalar)
+{
+  constexpr std::size_t bytes = 123;
+  constexpr int count = 6;
+
+  const auto source = make_bytes(bytes * count);
+  std::array<const cen::u8*, count> rows{};
+  for (int row = 0; row < count; ++row)
+  {
+    rows[static_cast<std::size_t>(row)] = source.data() + row * bytes;
+  }
+
+  // Includes a negative lobe, which requires clamping
+  const std::array<cen::i16, count> weights = {-1'000, 3'000, 9'000, 6'000, -1'000, 384};
+
+  std::vector<cen::u8> expected(bytes);
+  cen::detail::resample_column_scalar(rows.data(),
+                                      weights.data(),
+                                      count,
+                                      expected.data(),
+                                      0,
+                                      bytes);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> result(bytes);
+    cen::detail::resample_column(level,
+                                 rows.data(),
+                                 weights.data(),
+                                 count,
+                                 result.data(),
+                                 bytes);
+    ASSERT_EQ(expected, result);
+  }
+}
+
+TEST(ResampleKernels, HalveLevelsMatchScalar)
+{
+  constexpr int width = 37;
+
+  const auto top = make_bytes(width * 8);
+  const auto bottom = make_bytes(width * 8 + 3);
+
+  std::vector<cen::u8> expected(width * 4);
+  cen::detail::halve_scalar(top.data(), bottom.data() + 3, expected.data(), width);
+
+  ASSERT_EQ((top[0] + top[4] + bottom[3] + bottom[7] + 2) / 4, expected[0]);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u8> result(expected.size());
+    cen::detail::halve_row(level, top.data(), bottom.data() + 3, result.data(), width);
+    ASSERT_EQ(expected, result);
+  }
+}
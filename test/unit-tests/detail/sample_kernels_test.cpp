@@ -0,0 +1,74 @@
+#include "detail/sample_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+/// Creates every 16-bit sample, the size isn't a multiple of the SIMD width.
+[[nodiscard]] auto make_samples() -> std::vector<cen::i16>
+{
+  std::vector<cen::i16> samples;
+  for (int value = -32'768; value <= 32'767; ++value)
+  {
+    samples.push_back(static_cast<cen::i16>(value));
+  }
+
+  samples.push_back(0);
+  return samples;
+}
+
+}  // namespace
+
+TEST(SampleKernels, RoundTrip)
+{
+  const auto source = make_samples();
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<float> floats(source.size());
+    cen::detail::s16_to_float(level, source.data(), floats.data(), source.size());
+
+    ASSERT_EQ(-1.0f, floats.front());
+    ASSERT_EQ(0.0f, floats.at(32'768));
+    ASSERT_EQ(32'767.0f / 32'768.0f, floats.at(65'535));
+
+    std::vector<cen::i16> result(source.size());
+    cen::detail::float_to_s16(level, floats.data(), result.data(), floats.size());
+
+    ASSERT_EQ(source, result);
+  }
+}
+
+TEST(SampleKernels, RoundingAndSaturation)
+{
+  // Some values are repeated, so that every kernel processes them
+  const std::vector<float> source = {
+      2.0f,  -2.0f, 1.0f,  -1.0f, 0.5f / 32'768.0f, 1.5f / 32'768.0f, -0.5f / 32'768.0f,
+      1e9f,  -1e9f, 0.25f, 2.0f,  -2.0f,            1.0f,             -1.0f,
+      1e9f,  -1e9f, 0.25f, 0.0f};
+  const std::vector<cen::i16> expected = {
+      32'767, -32'768, 32'767, -32'768, 0, 2, 0, 32'767, -32'768, 8'192, 32'767, -32'768,
+      32'767, -32'768, 32'767, -32'768, 8'192, 0};
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::i16> result(source.size());
+    cen::detail::float_to_s16(level, source.data(), result.data(), source.size());
+
+    ASSERT_EQ(expected, result);
+  }
+}
@@ -0,0 +1,94 @@
+#include "detail/simd_dispatch.hpp"
+
+#include <gtest/gtest.h>
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+using kernel_function = auto(int) noexcept -> int;
+
+auto scalar_kernel(const int value) noexcept -> int
+{
+  return value;
+}
+
+auto sse2_kernel(const int value) noexcept -> int
+{
+  return value + 1;
+}
+
+auto neon_kernel(const int value) noexcept -> int
+{
+  return value + 3;
+}
+
+// The AVX2 implementation is missing, so the scalar implementation is used instead
+inline constexpr cen::detail::simd_kernel<kernel_function> kernel{&scalar_kernel,
+                                                                 &sse2_kernel,
+                                                                 nullptr,
+                                                                 &neon_kernel};
+
+}  // namespace
+
+TEST(SimdDispatch, DetectedLevelIsSupported)
+{
+  const auto level = cen::detail::detect_simd_level();
+  ASSERT_TRUE(cen::detail::is_simd_level_available(level));
+  ASSERT_TRUE(cen::detail::is_simd_level_supported(level));
+  ASSERT_EQ(level, cen::detail::get_simd_level());
+}
+
+TEST(SimdDispatch, Override)
+{
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_supported(level))
+    {
+      ASSERT_FALSE(cen::detail::set_simd_level(level));
+      continue;
+    }
+
+    ASSERT_TRUE(cen::detail::set_simd_level(level));
+    ASSERT_EQ(level, cen::detail::get_simd_level());
+  }
+
+  cen::detail::reset_simd_level();
+  ASSERT_EQ(cen::detail::detect_simd_level(), cen::detail::get_simd_level());
+}
+
+TEST(SimdDispatch, ScopedOverride)
+{
+  const auto detected = cen::detail::get_simd_level();
+
+  {
+    const cen::detail::scoped_simd_level scope{cen::detail::simd_level::none};
+    ASSERT_TRUE(scope.active());
+    ASSERT_EQ(cen::detail::simd_level::none, cen::detail::get_simd_level());
+  }
+
+  ASSERT_EQ(detected, cen::detail::get_simd_level());
+}
+
+TEST(SimdDispatch, KernelTable)
+{
+  static_assert(kernel.get(cen::detail::simd_level::none) == &scalar_kernel);
+  static_assert(kernel.get(cen::detail::simd_level::sse2) == &sse2_kernel);
+  static_assert(kernel.get(cen::detail::simd_level::avx2) == &scalar_kernel);
+  static_assert(kernel.get(cen::detail::simd_level::neon) == &neon_kernel);
+
+  for (const auto level : simd_levels)
+  {
+    const cen::detail::scoped_simd_level scope{level};
+    if (!scope.active())
+    {
+      continue;
+    }
+
+    ASSERT_EQ(kernel.get(level), kernel.get());
+    ASSERT_EQ(kernel.get(level)(10), kernel(10));
+  }
+
+  const cen::detail::scoped_simd_level scope{cen::detail::simd_level::none};
+  ASSERT_EQ(10, kernel(10));
+}
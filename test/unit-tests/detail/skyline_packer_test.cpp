@@ -0,0 +1,69 @@
+#include "detail/skyline_packer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "math/rect.hpp"
+
+TEST(SkylinePacker, Insert)
+{
+  cen::detail::skyline_packer packer{{100, 100}};
+
+  const auto first = packer.insert({50, 50});
+  ASSERT_TRUE(first.has_value());
+  ASSERT_EQ(0, first->x());
+  ASSERT_EQ(0, first->y());
+
+  const auto second = packer.insert({50, 20});
+  ASSERT_TRUE(second.has_value());
+  ASSERT_EQ(50, second->x());
+  ASSERT_EQ(0, second->y());
+
+  const auto third = packer.insert({50, 10});
+  ASSERT_TRUE(third.has_value());
+  ASSERT_EQ(50, third->x());
+  ASSERT_EQ(20, third->y());
+
+  ASSERT_FALSE(packer.insert({101, 10}).has_value());
+  ASSERT_FALSE(packer.insert({10, 101}).has_value());
+  ASSERT_FALSE(packer.insert({0, 10}).has_value());
+}
+
+TEST(SkylinePacker, NoOverlap)
+{
+  cen::detail::skyline_packer packer{{256, 256}};
+  std::vector<cen::irect> packed;
+
+  for (auto i = 0; i < 200; ++i)
+  {
+    const cen::iarea size{4 + (i * 7) % 29, 3 + (i * 11) % 23};
+    if (const auto pos = packer.insert(size))
+    {
+      const cen::irect rect{*pos, size};
+      ASSERT_LE(0, rect.x());
+      ASSERT_LE(0, rect.y());
+      ASSERT_GE(256, rect.max_x());
+      ASSERT_GE(256, rect.max_y());
+
+      for (const auto& other : packed)
+      {
+        ASSERT_FALSE(cen::intersects(rect, other));
+      }
+
+      packed.push_back(rect);
+    }
+  }
+
+  ASSERT_FALSE(packed.empty());
+  ASSERT_LT(0.0f, packer.occupancy());
+  ASSERT_GE(1.0f, packer.occupancy());
+}
+
+TEST(SkylinePacker, Full)
+{
+  cen::detail::skyline_packer packer{{10, 10}};
+  ASSERT_TRUE(packer.insert({10, 10}).has_value());
+  ASSERT_FALSE(packer.insert({1, 1}).has_value());
+  ASSERT_FLOAT_EQ(1.0f, packer.occupancy());
+}
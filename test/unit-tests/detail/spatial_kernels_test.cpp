@@ -0,0 +1,119 @@
+#include "detail/spatial_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>  // abs
+#include <vector>   // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+// A listener at (1, 2, 3) that faces along the z-axis, with a range of 10
+inline constexpr cen::detail::spatial_params params{1, 2, 3, 1, 0, 0, 0.1f};
+
+struct spatialized final
+{
+  std::vector<cen::u8> left;
+  std::vector<cen::u8> right;
+  std::vector<cen::u8> distance;
+};
+
+[[nodiscard]] auto spatialize(const cen::detail::simd_level level,
+                              const std::vector<float>& xs,
+                              const std::vector<float>& ys,
+                              const std::vector<float>& zs) -> spatialized
+{
+  spatialized result;
+  result.left.resize(xs.size());
+  result.right.resize(xs.size());
+  result.distance.resize(xs.size());
+
+  const cen::detail::spatial_output out{result.left.data(),
+                                        result.right.data(),
+                                        result.distance.data()};
+  cen::detail::spatialize(level, params, xs.data(), ys.data(), zs.data(), out, xs.size());
+
+  return result;
+}
+
+}  // namespace
+
+TEST(SpatialKernels, KnownValues)
+{
+  // Some values are repeated, so that every kernel processes them
+  const std::vector<float> xs = {1, 11, -9, 1, 1, 6, 1, 11, -9, 1, 1, 6, 1};
+  const std::vector<float> ys = {2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2};
+  const std::vector<float> zs = {3, 3, 3, 8, 1'003, 3, 3, 3, 3, 8, 1'003, 3, 3};
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    const auto result = spatialize(level, xs, ys, zs);
+    for (std::size_t offset = 0; offset <= 6; offset += 6)
+    {
+      // At the position of the listener
+      ASSERT_EQ(180, result.left.at(offset));
+      ASSERT_EQ(180, result.right.at(offset));
+      ASSERT_EQ(0, result.distance.at(offset));
+
+      // To the right, at the range
+      ASSERT_EQ(0, result.left.at(offset + 1));
+      ASSERT_EQ(255, result.right.at(offset + 1));
+      ASSERT_EQ(255, result.distance.at(offset + 1));
+
+      // To the left, at the range
+      ASSERT_EQ(255, result.left.at(offset + 2));
+      ASSERT_EQ(0, result.right.at(offset + 2));
+      ASSERT_EQ(255, result.distance.at(offset + 2));
+
+      // In front, at half the range
+      ASSERT_EQ(180, result.left.at(offset + 3));
+      ASSERT_EQ(180, result.right.at(offset + 3));
+      ASSERT_EQ(128, result.distance.at(offset + 3));
+
+      // Beyond the range
+      ASSERT_EQ(255, result.distance.at(offset + 4));
+
+      // To the right, at half the range
+      ASSERT_EQ(0, result.left.at(offset + 5));
+      ASSERT_EQ(128, result.distance.at(offset + 5));
+    }
+  }
+}
+
+TEST(SpatialKernels, Consistency)
+{
+  std::vector<float> xs;
+  std::vector<float> ys;
+  std::vector<float> zs;
+  for (int index = 0; index < 1'001; ++index)
+  {
+    xs.push_back(static_cast<float>(index % 23) - 11.5f);
+    ys.push_back(static_cast<float>(index % 7) * 0.7f);
+    zs.push_back(static_cast<float>(index % 13) * -1.3f);
+  }
+
+  const auto expected = spatialize(cen::detail::simd_level::none, xs, ys, zs);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    // The scalar kernel may have been compiled with fused multiply-add instructions
+    const auto result = spatialize(level, xs, ys, zs);
+    for (std::size_t index = 0; index < xs.size(); ++index)
+    {
+      ASSERT_LE(std::abs(expected.left[index] - result.left[index]), 1);
+      ASSERT_LE(std::abs(expected.right[index] - result.right[index]), 1);
+      ASSERT_LE(std::abs(expected.distance[index] - result.distance[index]), 1);
+    }
+  }
+}
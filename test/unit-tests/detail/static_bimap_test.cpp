@@ -0,0 +1,116 @@
+#include "detail/static_bimap.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_same_v
+
+#include "detail/czstring_compare.hpp"
+
+namespace {
+
+enum class color
+{
+  red,
+  green,
+  blue
+};
+
+template <std::size_t Size>
+using map_for = cen::detail::static_bimap_for<int,
+                                              cen::czstring,
+                                              cen::detail::czstring_compare,
+                                              cen::detail::czstring_less,
+                                              Size>;
+
+using sorted_map = cen::detail::
+    sorted_static_bimap<color, cen::czstring, cen::detail::czstring_less, 3>;
+
+// The pairs aren't supplied in order, to make sure that the index tables are sorted
+constexpr sorted_map colors{std::make_pair(color::green, "green"),
+                            std::make_pair(color::blue, "blue"),
+                            std::make_pair(color::red, "red")};
+
+static_assert(colors.find(color::red)[0] == 'r');
+static_assert(colors.find(color::blue)[0] == 'b');
+static_assert(colors.key_from("green") == color::green);
+
+}  // namespace
+
+static_assert(std::is_same_v<map_for<4>,
+                             cen::detail::static_bimap<int,
+                                                       cen::czstring,
+                                                       cen::detail::czstring_compare,
+                                                       4>>);
+
+static_assert(std::is_same_v<map_for<cen::detail::sorted_static_bimap_threshold>,
+                             cen::detail::sorted_static_bimap<
+                                 int,
+                                 cen::czstring,
+                                 cen::detail::czstring_less,
+                                 cen::detail::sorted_static_bimap_threshold>>);
+
+TEST(StaticBimap, Find)
+{
+  constexpr cen::detail::static_bimap<int, cen::czstring, cen::detail::czstring_compare, 2>
+      map{std::make_pair(1, "one"), std::make_pair(2, "two")};
+
+  ASSERT_STREQ("one", map.find(1));
+  ASSERT_STREQ("two", map.find(2));
+  ASSERT_EQ(2, map.key_from("two"));
+
+  ASSERT_THROW(map.find(3), cen::cen_error);
+  ASSERT_THROW(map.key_from("three"), cen::cen_error);
+}
+
+TEST(SortedStaticBimap, Find)
+{
+  ASSERT_STREQ("red", colors.find(color::red));
+  ASSERT_STREQ("green", colors.find(color::green));
+  ASSERT_STREQ("blue", colors.find(color::blue));
+
+  ASSERT_EQ(color::red, colors.key_from("red"));
+  ASSERT_EQ(color::green, colors.key_from("green"));
+  ASSERT_EQ(color::blue, colors.key_from("blue"));
+
+  ASSERT_THROW(colors.find(static_cast<color>(42)), cen::cen_error);
+  ASSERT_THROW(colors.key_from("yellow"), cen::cen_error);
+  ASSERT_THROW(colors.key_from("gree"), cen::cen_error);
+  ASSERT_THROW(colors.key_from(nullptr), cen::cen_error);
+}
+
+TEST(SortedStaticBimap, Large)
+{
+  constexpr map_for<20> map{
+      std::make_pair(19, "t"), std::make_pair(3, "d"),  std::make_pair(7, "h"),
+      std::make_pair(0, "a"),  std::make_pair(12, "m"), std::make_pair(5, "f"),
+      std::make_pair(16, "q"), std::make_pair(1, "b"),  std::make_pair(10, "k"),
+      std::make_pair(14, "o"), std::make_pair(2, "c"),  std::make_pair(18, "s"),
+      std::make_pair(8, "i"),  std::make_pair(4, "e"),  std::make_pair(11, "l"),
+      std::make_pair(17, "r"), std::make_pair(6, "g"),  std::make_pair(13, "n"),
+      std::make_pair(9, "j"),  std::make_pair(15, "p")};
+
+  for (int key = 0; key < 20; ++key)
+  {
+    const char name[] = {static_cast<char>('a' + key), '\0'};
+    ASSERT_STREQ(name, map.find(key));
+    ASSERT_EQ(key, map.key_from(name));
+  }
+
+  ASSERT_THROW(map.find(20), cen::cen_error);
+  ASSERT_THROW(map.key_from("u"), cen::cen_error);
+}
+
+TEST(CZStringLess, Correctness)
+{
+  constexpr cen::detail::czstring_less less;
+
+  static_assert(less("a", "b"));
+  static_assert(!less("b", "a"));
+  static_assert(!less("a", "a"));
+  static_assert(less("ab", "abc"));
+  static_assert(!less("abc", "ab"));
+
+  ASSERT_TRUE(less(nullptr, ""));
+  ASSERT_FALSE(less("", nullptr));
+  ASSERT_FALSE(less(nullptr, nullptr));
+}
@@ -0,0 +1,111 @@
+#include "detail/utf8_kernels.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>       // string
+#include <string_view>  // string_view
+#include <vector>       // vector
+
+#include "kernel_test_utils.hpp"
+
+namespace {
+
+[[nodiscard]] auto decode(const cen::detail::simd_level level, const std::string_view str)
+    -> std::vector<cen::u16>
+{
+  std::vector<cen::u16> result(str.size());
+  result.resize(cen::detail::decode_utf8(level, str, result.data()));
+  return result;
+}
+
+}  // namespace
+
+TEST(Utf8Kernels, WidenAscii)
+{
+  // An odd amount of characters, so that every kernel also runs its scalar tail
+  std::string in;
+  for (int index = 0; index < 75; ++index)
+  {
+    in += static_cast<char>('!' + index);
+  }
+
+  const auto* bytes = reinterpret_cast<const cen::u8*>(in.data());
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u16> out(in.size());
+    ASSERT_EQ(in.size(), cen::detail::widen_ascii(level, bytes, out.data(), in.size()));
+
+    for (std::size_t index = 0; index < in.size(); ++index)
+    {
+      ASSERT_EQ(static_cast<cen::u16>(in[index]), out[index]);
+    }
+  }
+}
+
+TEST(Utf8Kernels, WidenAsciiStopsAtMultiByteSequence)
+{
+  const std::string in = std::string(40, 'a') + "\xC3\xA9" + std::string(40, 'b');
+  const auto* bytes = reinterpret_cast<const cen::u8*>(in.data());
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    std::vector<cen::u16> out(in.size());
+    ASSERT_EQ(40u, cen::detail::widen_ascii(level, bytes, out.data(), in.size()));
+  }
+}
+
+TEST(Utf8Kernels, DecodeUtf8)
+{
+  // ASCII runs of different lengths, interleaved with two and three byte sequences
+  const std::string in = std::string(37, 'x') + "\xC3\xA9" + std::string(5, 'y') +
+                         "\xE2\x82\xAC" + std::string(70, 'z') + "\xC3\xA5";
+
+  std::vector<cen::u16> expected;
+  expected.insert(expected.end(), 37, 'x');
+  expected.push_back(0xE9);
+  expected.insert(expected.end(), 5, 'y');
+  expected.push_back(0x20AC);
+  expected.insert(expected.end(), 70, 'z');
+  expected.push_back(0xE5);
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    ASSERT_EQ(expected, decode(level, in));
+  }
+}
+
+TEST(Utf8Kernels, DecodeUtf8ReplacesUnsupportedCodePoints)
+{
+  // A code point outside of the Basic Multilingual Plane and a stray continuation byte
+  const std::string in = "a\xF0\x9F\x8C\x88" "b\x80";
+  const std::vector<cen::u16> expected = {'a',
+                                          cen::detail::replacement_character,
+                                          'b',
+                                          cen::detail::replacement_character};
+
+  for (const auto level : simd_levels)
+  {
+    if (!cen::detail::is_simd_level_available(level))
+    {
+      continue;
+    }
+
+    ASSERT_EQ(expected, decode(level, in));
+  }
+}
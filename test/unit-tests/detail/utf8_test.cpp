@@ -0,0 +1,55 @@
+#include "detail/utf8.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>      // size_t
+#include <string_view>  // string_view
+
+using namespace std::string_view_literals;
+
+TEST(NextCodePoint, ASCII)
+{
+  std::size_t index = 0;
+  ASSERT_EQ(cen::u32{'a'}, cen::detail::next_code_point("ab"sv, index));
+  ASSERT_EQ(1u, index);
+  ASSERT_EQ(cen::u32{'b'}, cen::detail::next_code_point("ab"sv, index));
+  ASSERT_EQ(2u, index);
+}
+
+TEST(NextCodePoint, MultiByte)
+{
+  // "å€😀"
+  const auto str = "\xC3\xA5\xE2\x82\xAC\xF0\x9F\x98\x80"sv;
+
+  std::size_t index = 0;
+  ASSERT_EQ(0xE5u, cen::detail::next_code_point(str, index));
+  ASSERT_EQ(2u, index);
+
+  ASSERT_EQ(0x20ACu, cen::detail::next_code_point(str, index));
+  ASSERT_EQ(5u, index);
+
+  ASSERT_EQ(0x1F600u, cen::detail::next_code_point(str, index));
+  ASSERT_EQ(9u, index);
+}
+
+TEST(NextCodePoint, Invalid)
+{
+  std::size_t index = 0;
+
+  // Unexpected continuation byte
+  ASSERT_EQ(cen::detail::replacement_character,
+            cen::detail::next_code_point("\x80"sv, index));
+  ASSERT_EQ(1u, index);
+
+  // Truncated sequence
+  index = 0;
+  ASSERT_EQ(cen::detail::replacement_character,
+            cen::detail::next_code_point("\xE2\x82"sv, index));
+  ASSERT_EQ(1u, index);
+
+  // Invalid continuation byte
+  index = 0;
+  ASSERT_EQ(cen::detail::replacement_character,
+            cen::detail::next_code_point("\xC3" "a"sv, index));
+  ASSERT_EQ(1u, index);
+}
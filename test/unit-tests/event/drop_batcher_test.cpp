@@ -0,0 +1,148 @@
+#include "events/drop_batcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>    // array
+#include <cstring>  // strlen, memcpy
+
+#include "events/event.hpp"
+#include "events/quit_event.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_drop(const cen::u32 type,
+                             const char* file = nullptr,
+                             const cen::u32 window = 1) -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = type;
+  event.drop.windowID = window;
+
+  if (file)
+  {
+    const auto size = std::strlen(file) + 1;
+    event.drop.file = static_cast<char*>(SDL_malloc(size));
+    std::memcpy(event.drop.file, file, size);
+  }
+
+  return event;
+}
+
+}  // namespace
+
+TEST(DropBatcher, Defaults)
+{
+  cen::drop_batcher batcher;
+  ASSERT_EQ(0u, batcher.ready_count());
+  ASSERT_FALSE(batcher.is_dropping());
+  ASSERT_FALSE(batcher.next());
+}
+
+TEST(DropBatcher, Sequence)
+{
+  cen::drop_batcher batcher;
+
+  auto begin = make_drop(SDL_DROPBEGIN);
+  auto a = make_drop(SDL_DROPFILE, "a.png");
+  auto b = make_drop(SDL_DROPFILE, "b.png");
+  auto text = make_drop(SDL_DROPTEXT, "foo");
+  auto complete = make_drop(SDL_DROPCOMPLETE);
+
+  ASSERT_TRUE(batcher.feed(begin));
+  ASSERT_TRUE(batcher.feed(a));
+  ASSERT_TRUE(batcher.feed(b));
+  ASSERT_TRUE(batcher.feed(text));
+
+  ASSERT_FALSE(a.drop.file);
+  ASSERT_TRUE(batcher.is_dropping());
+  ASSERT_EQ(0u, batcher.ready_count());
+
+  ASSERT_TRUE(batcher.feed(complete));
+  ASSERT_FALSE(batcher.is_dropping());
+  ASSERT_EQ(1u, batcher.ready_count());
+
+  const auto batch = batcher.next();
+  ASSERT_TRUE(batch);
+  ASSERT_EQ(1u, batch->window_id);
+  ASSERT_EQ(2u, batch->files.size());
+  ASSERT_EQ("a.png", batch->files.at(0));
+  ASSERT_EQ("b.png", batch->files.at(1));
+  ASSERT_EQ(1u, batch->texts.size());
+  ASSERT_EQ("foo", batch->texts.at(0));
+
+  ASSERT_FALSE(batcher.next());
+}
+
+TEST(DropBatcher, EmptySequence)
+{
+  cen::drop_batcher batcher;
+
+  auto begin = make_drop(SDL_DROPBEGIN);
+  auto complete = make_drop(SDL_DROPCOMPLETE);
+  batcher.feed(begin);
+  batcher.feed(complete);
+
+  ASSERT_EQ(0u, batcher.ready_count());
+}
+
+TEST(DropBatcher, Standalone)
+{
+  cen::drop_batcher batcher;
+
+  auto file = make_drop(SDL_DROPFILE, "a.png", 7);
+  ASSERT_TRUE(batcher.feed(file));
+  ASSERT_EQ(1u, batcher.ready_count());
+
+  const auto batch = batcher.next();
+  ASSERT_TRUE(batch);
+  ASSERT_EQ(7u, batch->window_id);
+  ASSERT_EQ(1u, batch->files.size());
+}
+
+TEST(DropBatcher, Windows)
+{
+  cen::drop_batcher batcher;
+
+  std::array events{make_drop(SDL_DROPBEGIN, nullptr, 1),
+                    make_drop(SDL_DROPBEGIN, nullptr, 2),
+                    make_drop(SDL_DROPFILE, "a", 1),
+                    make_drop(SDL_DROPFILE, "b", 2),
+                    make_drop(SDL_DROPCOMPLETE, nullptr, 2),
+                    SDL_Event{},
+                    make_drop(SDL_DROPCOMPLETE, nullptr, 1)};
+
+  ASSERT_EQ(6, batcher.feed(events.data(), static_cast<int>(events.size())));
+  ASSERT_EQ(2u, batcher.ready_count());
+
+  const auto first = batcher.next();
+  ASSERT_EQ(2u, first->window_id);
+  ASSERT_EQ("b", first->files.at(0));
+
+  const auto second = batcher.next();
+  ASSERT_EQ(1u, second->window_id);
+  ASSERT_EQ("a", second->files.at(0));
+}
+
+TEST(DropBatcher, Collect)
+{
+  cen::event::flush_all();
+
+  auto begin = make_drop(SDL_DROPBEGIN);
+  auto file = make_drop(SDL_DROPFILE, "a.png");
+  auto complete = make_drop(SDL_DROPCOMPLETE);
+
+  SDL_PushEvent(&begin);
+  cen::event::push(cen::quit_event{});
+  SDL_PushEvent(&file);
+  SDL_PushEvent(&complete);
+
+  cen::drop_batcher batcher;
+  ASSERT_EQ(3, batcher.collect());
+  ASSERT_EQ(1u, batcher.ready_count());
+  ASSERT_EQ(1, cen::event::queue_count().value_or(0));
+
+  batcher.clear();
+  ASSERT_EQ(0u, batcher.ready_count());
+
+  cen::event::flush_all();
+}
@@ -0,0 +1,170 @@
+#include "events/event_channel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr, make_unique
+#include <thread>  // thread
+#include <vector>  // vector
+
+namespace {
+
+struct message final
+{
+  int producer{};
+  int value{};
+};
+
+}  // namespace
+
+TEST(EventChannel, Capacity)
+{
+  ASSERT_EQ(2u, cen::event_channel<int>{0}.capacity());
+  ASSERT_EQ(2u, cen::event_channel<int>{2}.capacity());
+  ASSERT_EQ(8u, cen::event_channel<int>{5}.capacity());
+  ASSERT_EQ(1'024u, cen::event_channel<int>{}.capacity());
+}
+
+TEST(EventChannel, PushAndPop)
+{
+  cen::event_channel<int> channel{4};
+  ASSERT_EQ(0u, channel.size_approx());
+
+  ASSERT_TRUE(channel.try_push(1));
+  ASSERT_TRUE(channel.try_push(2));
+  ASSERT_TRUE(channel.try_emplace(3));
+  ASSERT_TRUE(channel.try_emplace(4));
+  ASSERT_FALSE(channel.try_push(5));
+  ASSERT_EQ(4u, channel.size_approx());
+
+  int value{};
+  for (int expected = 1; expected <= 4; ++expected)
+  {
+    ASSERT_TRUE(channel.try_pop(value));
+    ASSERT_EQ(expected, value);
+  }
+
+  ASSERT_FALSE(channel.try_pop(value));
+
+  // The slots are reused after wrapping around
+  ASSERT_TRUE(channel.try_push(6));
+  ASSERT_TRUE(channel.try_pop(value));
+  ASSERT_EQ(6, value);
+}
+
+TEST(EventChannel, Drain)
+{
+  cen::event_channel<std::unique_ptr<int>> channel{8};
+
+  for (int i = 0; i < 5; ++i)
+  {
+    ASSERT_TRUE(channel.try_emplace(std::make_unique<int>(i)));
+  }
+
+  std::vector<int> received;
+  const auto count = channel.drain([&](std::unique_ptr<int>& ptr) {
+    received.push_back(*ptr);
+  });
+
+  ASSERT_EQ(5u, count);
+  ASSERT_EQ((std::vector<int>{0, 1, 2, 3, 4}), received);
+  ASSERT_EQ(0u, channel.drain([](std::unique_ptr<int>&) {}));
+}
+
+TEST(EventChannel, ClearDestroysMessages)
+{
+  auto shared = std::make_shared<int>(42);
+
+  {
+    cen::event_channel<std::shared_ptr<int>> channel{4};
+    ASSERT_TRUE(channel.try_push(shared));
+    ASSERT_TRUE(channel.try_push(shared));
+    ASSERT_EQ(3, shared.use_count());
+
+    channel.clear();
+    ASSERT_EQ(1, shared.use_count());
+
+    ASSERT_TRUE(channel.try_push(shared));
+  }
+
+  ASSERT_EQ(1, shared.use_count());
+}
+
+TEST(EventChannel, MultipleProducers)
+{
+  constexpr int producers = 4;
+  constexpr int messages = 10'000;
+
+  cen::event_channel<message> channel{256};
+
+  std::vector<std::thread> threads;
+  for (int producer = 0; producer < producers; ++producer)
+  {
+    threads.emplace_back([&channel, producer] {
+      for (int value = 0; value < messages;)
+      {
+        if (channel.try_push(message{producer, value}))
+        {
+          ++value;
+        }
+        else
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+
+  // Messages from each producer must be received in the order they were sent
+  std::vector<int> next(producers, 0);
+  int total = 0;
+
+  while (total < producers * messages)
+  {
+    channel.drain([&](const message& m) {
+      ASSERT_EQ(next.at(m.producer), m.value);
+      ++next.at(m.producer);
+      ++total;
+    });
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  ASSERT_EQ(0u, channel.size_approx());
+}
+
+TEST(EventChannel, ThrowingConstructor)
+{
+  struct throwing final
+  {
+    explicit throwing(const bool fail) : value{fail ? throw 1 : 7}
+    {}
+
+    throwing(throwing&&) noexcept = default;
+    auto operator=(throwing&&) noexcept -> throwing& = default;
+
+    int value{};
+  };
+
+  cen::event_channel<throwing> channel{2};
+
+  ASSERT_ANY_THROW(channel.try_emplace(true));
+  ASSERT_EQ(0u, channel.size_approx());
+
+  // The failed message doesn't occupy a slot, so producers can't lap the consumer
+  ASSERT_TRUE(channel.try_emplace(false));
+  ASSERT_TRUE(channel.try_emplace(false));
+  ASSERT_FALSE(channel.try_emplace(false));
+
+  int count = 0;
+  channel.drain([&](const throwing& t) {
+    ASSERT_EQ(7, t.value);
+    ++count;
+  });
+
+  ASSERT_EQ(2, count);
+  ASSERT_TRUE(channel.try_emplace(false));
+  ASSERT_EQ(1u, channel.drain([](throwing&) {}));
+}
@@ -0,0 +1,114 @@
+#include "events/event_coalescing.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+#include "core/integers.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_motion(const int x, const int dx, const cen::u32 window = 1)
+    -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_MOUSEMOTION;
+  event.motion.windowID = window;
+  event.motion.x = x;
+  event.motion.xrel = dx;
+  return event;
+}
+
+[[nodiscard]] auto make_axis(const cen::u8 axis, const cen::i16 value) -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_CONTROLLERAXISMOTION;
+  event.caxis.axis = axis;
+  event.caxis.value = value;
+  return event;
+}
+
+[[nodiscard]] auto make_button() -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_MOUSEBUTTONDOWN;
+  return event;
+}
+
+}  // namespace
+
+TEST(CoalesceEvents, Empty)
+{
+  ASSERT_EQ(0, cen::coalesce_events(nullptr, 0));
+}
+
+TEST(CoalesceEvents, MouseMotion)
+{
+  std::array<SDL_Event, 4> events{make_motion(10, 2),
+                                  make_motion(13, 3),
+                                  make_motion(50, 7, 2),
+                                  make_motion(18, 5)};
+
+  ASSERT_EQ(2, cen::coalesce_events(events, 4));
+
+  ASSERT_EQ(SDL_MOUSEMOTION, events[0].type);
+  ASSERT_EQ(18, events[0].motion.x);
+  ASSERT_EQ(10, events[0].motion.xrel);
+  ASSERT_EQ(1u, events[0].motion.windowID);
+
+  // Motion in another window has a different source
+  ASSERT_EQ(50, events[1].motion.x);
+  ASSERT_EQ(7, events[1].motion.xrel);
+}
+
+TEST(CoalesceEvents, Axes)
+{
+  std::array<SDL_Event, 4> events{make_axis(0, 100),
+                                  make_axis(1, 200),
+                                  make_axis(0, 300),
+                                  make_axis(1, -400)};
+
+  ASSERT_EQ(2, cen::coalesce_events(events, 4));
+
+  ASSERT_EQ(0, events[0].caxis.axis);
+  ASSERT_EQ(300, events[0].caxis.value);
+
+  ASSERT_EQ(1, events[1].caxis.axis);
+  ASSERT_EQ(-400, events[1].caxis.value);
+}
+
+TEST(CoalesceEvents, KeepsOrderAroundOtherEvents)
+{
+  std::array<SDL_Event, 6> events{make_motion(1, 1),
+                                  make_motion(2, 1),
+                                  make_button(),
+                                  make_motion(3, 1),
+                                  make_motion(4, 1),
+                                  make_button()};
+
+  ASSERT_EQ(4, cen::coalesce_events(events, 6));
+
+  ASSERT_EQ(SDL_MOUSEMOTION, events[0].type);
+  ASSERT_EQ(2, events[0].motion.x);
+  ASSERT_EQ(2, events[0].motion.xrel);
+
+  ASSERT_EQ(SDL_MOUSEBUTTONDOWN, events[1].type);
+
+  ASSERT_EQ(SDL_MOUSEMOTION, events[2].type);
+  ASSERT_EQ(4, events[2].motion.x);
+  ASSERT_EQ(2, events[2].motion.xrel);
+
+  ASSERT_EQ(SDL_MOUSEBUTTONDOWN, events[3].type);
+}
+
+TEST(CoalesceEvents, PartialArray)
+{
+  std::array<SDL_Event, 4> events{make_motion(1, 1),
+                                  make_motion(2, 1),
+                                  make_motion(3, 1),
+                                  make_motion(4, 1)};
+
+  ASSERT_EQ(1, cen::coalesce_events(events, 2));
+  ASSERT_EQ(2, events[0].motion.x);
+  ASSERT_EQ(3, events[2].motion.x);
+}
@@ -4,6 +4,7 @@
 
 #include <iostream>  // cout
 
+#include "allocation_counter.hpp"
 #include "core/log.hpp"
 
 using event_dispatcher = cen::
@@ -67,6 +68,197 @@ TEST(EventDispatcher, Bind)
   ASSERT_TRUE(visitedLambda);
 }
 
+TEST(EventDispatcher, HandlersAreNotAllocated)
+{
+  button_handler buttonHandler;
+  event_dispatcher dispatcher;
+
+  dispatcher.bind<cen::quit_event>().to<&on_quit>();
+  dispatcher.bind<cen::controller_button_event>()
+      .to<&button_handler::on_event>(&buttonHandler);
+
+  int count = 0;
+  dispatcher.bind<cen::window_event>().to([&count](const cen::window_event&) {
+    ++count;
+  });
+
+  ASSERT_FALSE(dispatcher.bind<cen::quit_event>().function().is_allocated());
+  ASSERT_FALSE(dispatcher.bind<cen::controller_button_event>().function().is_allocated());
+  ASSERT_FALSE(dispatcher.bind<cen::window_event>().function().is_allocated());
+
+  dispatcher.bind<cen::window_event>().function()(cen::window_event{});
+  ASSERT_EQ(1, count);
+
+  SDL_Event event{};
+  event.type = SDL_WINDOWEVENT;
+
+  EXPECT_NO_ALLOCATIONS({ dispatcher.dispatch(event); });
+  ASSERT_EQ(2, count);
+}
+
+TEST(EventDispatcher, Dispatch)
+{
+  event_dispatcher dispatcher;
+
+  int quitCount = 0;
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++quitCount; });
+
+  int buttonCount = 0;
+  dispatcher.bind<cen::controller_button_event>().to(
+      [&](const cen::controller_button_event& event) {
+        ASSERT_EQ(cen::button_state::released, event.state());
+        ++buttonCount;
+      });
+
+  SDL_Event event{};
+
+  event.type = SDL_KEYDOWN;
+  ASSERT_FALSE(dispatcher.dispatch(event));
+
+  event.type = SDL_QUIT;
+  ASSERT_TRUE(dispatcher.dispatch(event));
+  ASSERT_EQ(1, quitCount);
+
+  event.type = SDL_CONTROLLERBUTTONUP;
+  event.cbutton.state = SDL_RELEASED;
+  ASSERT_TRUE(dispatcher.dispatch(event));
+  ASSERT_EQ(1, buttonCount);
+
+  // Subscribed events without a handler are still recognized
+  event.type = SDL_WINDOWEVENT;
+  ASSERT_TRUE(dispatcher.dispatch(event));
+
+  ASSERT_EQ(1, quitCount);
+  ASSERT_EQ(1, buttonCount);
+}
+
+TEST(EventDispatcher, PollBatched)
+{
+  cen::event::flush_all();
+
+  event_dispatcher dispatcher;
+
+  int count = 0;
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++count; });
+
+  // More events than the batch size, to check that all batches are dispatched
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+    ASSERT_TRUE(cen::event::push(cen::window_event{}));
+  }
+
+  dispatcher.poll_batched<4>();
+  ASSERT_EQ(10, count);
+  ASSERT_EQ(0, cen::event::queue_count());
+}
+
+TEST(EventDispatcher, PollBatchedDispatchesPushedEvents)
+{
+  cen::event::flush_all();
+
+  event_dispatcher dispatcher;
+
+  int quitCount = 0;
+  dispatcher.bind<cen::quit_event>().to([&](const cen::quit_event&) { ++quitCount; });
+
+  // The handler pushes a quit event while the (non-full) first batch is dispatched
+  int windowCount = 0;
+  dispatcher.bind<cen::window_event>().to([&](const cen::window_event&) {
+    ++windowCount;
+    ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  });
+
+  ASSERT_TRUE(cen::event::push(cen::window_event{}));
+
+  dispatcher.poll_batched<4>();
+  ASSERT_EQ(1, windowCount);
+  ASSERT_EQ(1, quitCount);
+  ASSERT_EQ(0, cen::event::queue_count());
+}
+
+TEST(EventDispatcher, Connect)
+{
+  event_dispatcher dispatcher;
+  auto& sink = dispatcher.bind<cen::quit_event>();
+
+  int primary = 0;
+  sink.to([&](const cen::quit_event&) { ++primary; });
+
+  int layer = 0;
+  bool consume = true;
+  const auto connection = sink.connect(
+      [&](const cen::quit_event&) {
+        ++layer;
+        return consume;
+      },
+      10);
+
+  ASSERT_EQ(2u, dispatcher.active_count());
+
+  SDL_Event event{};
+  event.type = SDL_QUIT;
+
+  ASSERT_TRUE(dispatcher.dispatch(event));
+  ASSERT_EQ(1, layer);
+  ASSERT_EQ(0, primary);
+
+  consume = false;
+  ASSERT_TRUE(dispatcher.dispatch(event));
+  ASSERT_EQ(2, layer);
+  ASSERT_EQ(1, primary);
+
+  ASSERT_TRUE(sink.disconnect(connection));
+  ASSERT_EQ(1u, dispatcher.active_count());
+
+  dispatcher.reset();
+  ASSERT_EQ(0u, dispatcher.active_count());
+}
+
+TEST(EventDispatcher, Channels)
+{
+  event_dispatcher dispatcher;
+  cen::event_channel<int> channel{8};
+
+  int sum = 0;
+  dispatcher.attach(channel, [&](const int value) { sum += value; });
+
+  ASSERT_TRUE(channel.try_push(1));
+  ASSERT_TRUE(channel.try_push(2));
+  ASSERT_EQ(2u, dispatcher.poll_channels());
+  ASSERT_EQ(3, sum);
+
+  ASSERT_TRUE(dispatcher.detach(channel));
+  ASSERT_FALSE(dispatcher.detach(channel));
+
+  ASSERT_TRUE(channel.try_push(4));
+  ASSERT_EQ(0u, dispatcher.poll_channels());
+  ASSERT_EQ(3, sum);
+}
+
+TEST(EventDispatcher, Recorder)
+{
+  cen::event::flush_all();
+
+  cen::event_recorder recorder;
+  event_dispatcher dispatcher;
+
+  ASSERT_EQ(nullptr, dispatcher.recorder());
+  dispatcher.set_recorder(&recorder);
+  ASSERT_EQ(&recorder, dispatcher.recorder());
+
+  ASSERT_TRUE(cen::event::push(cen::quit_event{}));
+  ASSERT_TRUE(cen::event::push(cen::window_event{}));
+  dispatcher.poll();
+
+  ASSERT_EQ(2u, recorder.count());
+  ASSERT_EQ(1u, recorder.frame_count());
+
+  dispatcher.set_recorder(nullptr);
+  dispatcher.poll();
+  ASSERT_EQ(1u, recorder.frame_count());
+}
+
 TEST(EventDispatcher, Reset)
 {
   event_dispatcher dispatcher;
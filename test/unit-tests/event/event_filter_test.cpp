@@ -0,0 +1,193 @@
+#include "events/event_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include "events/event.hpp"
+#include "events/keyboard_event.hpp"
+#include "events/quit_event.hpp"
+#include "events/window_event.hpp"
+
+namespace {
+
+void push_quit()
+{
+  cen::event::push(cen::quit_event{});
+}
+
+[[nodiscard]] auto count_quit_events() -> int
+{
+  return cen::event::queue_count(cen::event_type::quit).value_or(0);
+}
+
+}  // namespace
+
+TEST(EventFilter, SetEventEnabled)
+{
+  cen::event::flush_all();
+
+  cen::set_event_enabled(cen::event_type::quit, false);
+  ASSERT_FALSE(cen::is_event_enabled(cen::event_type::quit));
+
+  push_quit();
+  ASSERT_EQ(0, count_quit_events());
+
+  cen::set_event_enabled(cen::event_type::quit, true);
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::quit));
+
+  push_quit();
+  ASSERT_EQ(1, count_quit_events());
+
+  cen::event::flush_all();
+}
+
+TEST(EventFilter, SetEventsEnabled)
+{
+  cen::set_events_enabled<cen::keyboard_event>(false);
+  ASSERT_FALSE(cen::is_event_enabled(cen::event_type::key_down));
+  ASSERT_FALSE(cen::is_event_enabled(cen::event_type::key_up));
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::quit));
+
+  cen::set_events_enabled<cen::keyboard_event>(true);
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::key_down));
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::key_up));
+}
+
+TEST(EventFilter, EnableOnly)
+{
+  cen::enable_only<cen::quit_event, cen::window_event>();
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::quit));
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::window));
+  ASSERT_FALSE(cen::is_event_enabled(cen::event_type::key_down));
+  ASSERT_FALSE(cen::is_event_enabled(cen::event_type::mouse_motion));
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::user));
+
+  // Types without a corresponding enumerator are disabled as well
+  ASSERT_EQ(SDL_IGNORE, SDL_EventState(SDL_USEREVENT - 1, SDL_QUERY));
+
+  for (cen::u32 type = SDL_FIRSTEVENT + 1; type < SDL_USEREVENT; ++type)
+  {
+    SDL_EventState(type, SDL_ENABLE);
+  }
+
+  ASSERT_TRUE(cen::is_event_enabled(cen::event_type::key_down));
+}
+
+TEST(EventFilter, EnableOnlyKeepsQueuedEvents)
+{
+  cen::event::flush_all();
+
+  push_quit();
+  cen::enable_only<cen::quit_event>();
+  ASSERT_EQ(1, count_quit_events());
+
+  for (cen::u32 type = SDL_FIRSTEVENT + 1; type < SDL_USEREVENT; ++type)
+  {
+    SDL_EventState(type, SDL_ENABLE);
+  }
+
+  cen::event::flush_all();
+}
+
+TEST(EventFilter, Filter)
+{
+  cen::event::flush_all();
+
+  int calls = 0;
+
+  {
+    cen::event_filter<cen::quit_event> filter{[&](const SDL_Event&) {
+      ++calls;
+      return false;
+    }};
+
+    push_quit();
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(0, count_quit_events());
+  }
+
+  push_quit();
+  ASSERT_EQ(1, calls);
+  ASSERT_EQ(1, count_quit_events());
+
+  cen::event::flush_all();
+}
+
+TEST(EventFilter, FilterChainsToPreviousFilter)
+{
+  cen::event::flush_all();
+
+  int previousCalls = 0;
+  cen::event_filter<> previous{[&](const SDL_Event&) {
+    ++previousCalls;
+    return false;
+  }};
+
+  {
+    int calls = 0;
+    cen::event_filter<cen::quit_event> filter{[&](const SDL_Event&) {
+      ++calls;
+      return true;
+    }};
+
+    // Kept by the current filter, but dropped by the previous one
+    push_quit();
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(1, previousCalls);
+    ASSERT_EQ(0, count_quit_events());
+  }
+
+  cen::event::flush_all();
+}
+
+TEST(EventFilter, FilterIgnoresOtherEvents)
+{
+  cen::event::flush_all();
+
+  int calls = 0;
+  cen::event_filter<cen::keyboard_event> filter{[&](const SDL_Event&) {
+    ++calls;
+    return false;
+  }};
+
+  push_quit();
+  ASSERT_EQ(0, calls);
+  ASSERT_EQ(1, count_quit_events());
+
+  cen::event::flush_all();
+}
+
+TEST(EventFilter, Apply)
+{
+  cen::event::flush_all();
+
+  push_quit();
+  ASSERT_EQ(1, count_quit_events());
+
+  cen::event_filter<> filter{[](const SDL_Event&) { return false; }};
+  filter.apply();
+
+  ASSERT_EQ(0, count_quit_events());
+}
+
+TEST(EventFilter, Watch)
+{
+  cen::event::flush_all();
+
+  int calls = 0;
+
+  {
+    cen::event_watch<cen::quit_event> watch{[&](const SDL_Event& event) {
+      ASSERT_EQ(SDL_QUIT, event.type);
+      ++calls;
+    }};
+
+    push_quit();
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(1, count_quit_events());
+  }
+
+  push_quit();
+  ASSERT_EQ(1, calls);
+
+  cen::event::flush_all();
+}
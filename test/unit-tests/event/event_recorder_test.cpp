@@ -0,0 +1,153 @@
+#include "events/event_recorder.hpp"
+
+#include <gtest/gtest.h>
+
+#include "events/event_player.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_key(const SDL_Scancode scancode) -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_KEYDOWN;
+  event.key.keysym.scancode = scancode;
+  return event;
+}
+
+}  // namespace
+
+TEST(EventRecorder, Defaults)
+{
+  const cen::event_recorder recorder;
+  ASSERT_EQ(0u, recorder.count());
+  ASSERT_EQ(0u, recorder.frame_count());
+  ASSERT_EQ(16u, recorder.data().size());
+}
+
+TEST(EventRecorder, Record)
+{
+  cen::event_recorder recorder;
+
+  recorder.mark_frame();
+  recorder.record(make_key(SDL_SCANCODE_A));
+
+  SDL_Event quit{};
+  quit.type = SDL_QUIT;
+  recorder.record(cen::event{quit});
+
+  // Empty events and window manager events aren't recorded
+  recorder.record(cen::event{});
+
+  SDL_Event wm{};
+  wm.type = SDL_SYSWMEVENT;
+  recorder.record(wm);
+
+  ASSERT_EQ(2u, recorder.count());
+  ASSERT_EQ(1u, recorder.frame_count());
+
+  // Each record only stores the struct of its event type
+  ASSERT_EQ(16u + 6u + (6u + sizeof(SDL_KeyboardEvent)) + (6u + sizeof(SDL_QuitEvent)),
+            recorder.data().size());
+
+  recorder.clear();
+  ASSERT_EQ(0u, recorder.count());
+  ASSERT_EQ(16u, recorder.data().size());
+}
+
+TEST(EventPlayer, InvalidData)
+{
+  ASSERT_THROW(cen::event_player{std::vector<cen::u8>{}}, cen::cen_error);
+  ASSERT_THROW(cen::event_player{std::vector<cen::u8>(32, 0)}, cen::cen_error);
+  ASSERT_THROW(cen::event_player{"foo.cenrec"}, cen::cen_error);
+}
+
+TEST(EventPlayer, FrameLocked)
+{
+  cen::event_recorder recorder;
+
+  recorder.mark_frame();
+  recorder.record(make_key(SDL_SCANCODE_A));
+  recorder.record(make_key(SDL_SCANCODE_B));
+  recorder.mark_frame();
+  recorder.mark_frame();
+  recorder.record(make_key(SDL_SCANCODE_C));
+
+  cen::event_player player{recorder.data(), cen::playback_mode::frame_locked};
+  ASSERT_EQ(cen::playback_mode::frame_locked, player.mode());
+  ASSERT_FALSE(player.is_finished());
+
+  SDL_Event event;
+
+  // First frame
+  player.next_frame();
+  ASSERT_TRUE(player.poll(event));
+  ASSERT_EQ(SDL_KEYDOWN, event.type);
+  ASSERT_EQ(SDL_SCANCODE_A, event.key.keysym.scancode);
+
+  ASSERT_TRUE(player.poll(event));
+  ASSERT_EQ(SDL_SCANCODE_B, event.key.keysym.scancode);
+  ASSERT_FALSE(player.poll(event));
+
+  // Second frame, which is empty
+  player.next_frame();
+  ASSERT_FALSE(player.poll(event));
+
+  // Third frame
+  player.next_frame();
+  ASSERT_TRUE(player.poll(event));
+  ASSERT_EQ(SDL_SCANCODE_C, event.key.keysym.scancode);
+  ASSERT_FALSE(player.poll(event));
+
+  ASSERT_TRUE(player.is_finished());
+  ASSERT_EQ(3u, player.played_count());
+
+  player.restart();
+  ASSERT_FALSE(player.is_finished());
+  ASSERT_EQ(0u, player.played_count());
+}
+
+TEST(EventPlayer, Update)
+{
+  cen::event::flush_all();
+
+  cen::event_recorder recorder;
+  recorder.mark_frame();
+  recorder.record(make_key(SDL_SCANCODE_A));
+  recorder.mark_frame();
+  recorder.record(make_key(SDL_SCANCODE_B));
+  recorder.record(make_key(SDL_SCANCODE_C));
+
+  cen::event_player player{recorder.data(), cen::playback_mode::frame_locked};
+
+  ASSERT_EQ(1, player.update());
+  ASSERT_EQ(1, cen::event::queue_count());
+
+  ASSERT_EQ(2, player.update());
+  ASSERT_EQ(3, cen::event::queue_count());
+  ASSERT_TRUE(player.is_finished());
+
+  cen::event::flush_all();
+}
+
+TEST(EventPlayer, Realtime)
+{
+  cen::event_recorder recorder;
+  recorder.record(make_key(SDL_SCANCODE_A));
+
+  cen::event_player player{recorder.data()};
+  ASSERT_EQ(cen::playback_mode::realtime, player.mode());
+
+  // The first poll starts the clock, the event was recorded almost immediately
+  SDL_Event event;
+  const auto polled = player.poll(event);
+
+  if (!polled)
+  {
+    SDL_Delay(10);
+    ASSERT_TRUE(player.poll(event));
+  }
+
+  ASSERT_EQ(SDL_SCANCODE_A, event.key.keysym.scancode);
+  ASSERT_FALSE(player.poll(event));
+  ASSERT_TRUE(player.is_finished());
+}
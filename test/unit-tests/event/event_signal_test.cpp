@@ -0,0 +1,165 @@
+#include "events/event_signal.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "events/quit_event.hpp"
+
+using signal_type = cen::event_signal<cen::quit_event>;
+
+namespace {
+
+inline int freeFunctionCount{};
+
+void on_quit(const cen::quit_event&)
+{
+  ++freeFunctionCount;
+}
+
+struct quit_handler final
+{
+  auto on_event(const cen::quit_event&) -> bool
+  {
+    ++count;
+    return consume;
+  }
+
+  int count{};
+  bool consume{};
+};
+
+}  // namespace
+
+TEST(EventSignal, Defaults)
+{
+  const signal_type signal;
+  ASSERT_TRUE(signal.empty());
+  ASSERT_EQ(0u, signal.size());
+  ASSERT_FALSE(signal.is_connected(cen::event_connection{}));
+}
+
+TEST(EventSignal, Connect)
+{
+  signal_type signal;
+  quit_handler handler;
+
+  freeFunctionCount = 0;
+  int lambdaCount = 0;
+
+  const auto a = signal.connect<&on_quit>();
+  const auto b = signal.connect<&quit_handler::on_event>(&handler);
+  const auto c = signal.connect([&](const cen::quit_event&) { ++lambdaCount; });
+
+  ASSERT_EQ(3u, signal.size());
+  ASSERT_TRUE(signal.is_connected(a));
+  ASSERT_TRUE(signal.is_connected(b));
+  ASSERT_TRUE(signal.is_connected(c));
+
+  ASSERT_FALSE(signal.emit(cen::quit_event{}));
+  ASSERT_EQ(1, freeFunctionCount);
+  ASSERT_EQ(1, handler.count);
+  ASSERT_EQ(1, lambdaCount);
+}
+
+TEST(EventSignal, Priority)
+{
+  signal_type signal;
+  std::vector<int> order;
+
+  signal.connect([&](const cen::quit_event&) { order.push_back(1); }, 0);
+  signal.connect([&](const cen::quit_event&) { order.push_back(2); }, 10);
+  signal.connect([&](const cen::quit_event&) { order.push_back(3); }, 0);
+  signal.connect([&](const cen::quit_event&) { order.push_back(4); }, -5);
+  signal.connect([&](const cen::quit_event&) { order.push_back(5); }, 10);
+
+  signal.emit(cen::quit_event{});
+  ASSERT_EQ((std::vector<int>{2, 5, 1, 3, 4}), order);
+}
+
+TEST(EventSignal, Consume)
+{
+  signal_type signal;
+  quit_handler handler;
+  handler.consume = true;
+
+  int lowCount = 0;
+  signal.connect([&](const cen::quit_event&) { ++lowCount; }, -1);
+  signal.connect<&quit_handler::on_event>(&handler, 1);
+
+  ASSERT_TRUE(signal.emit(cen::quit_event{}));
+  ASSERT_EQ(1, handler.count);
+  ASSERT_EQ(0, lowCount);
+
+  handler.consume = false;
+  ASSERT_FALSE(signal.emit(cen::quit_event{}));
+  ASSERT_EQ(2, handler.count);
+  ASSERT_EQ(1, lowCount);
+}
+
+TEST(EventSignal, Disconnect)
+{
+  signal_type signal;
+
+  int a = 0;
+  int b = 0;
+  const auto first = signal.connect([&](const cen::quit_event&) { ++a; });
+  const auto second = signal.connect([&](const cen::quit_event&) { ++b; });
+
+  ASSERT_TRUE(signal.disconnect(first));
+  ASSERT_FALSE(signal.disconnect(first));
+  ASSERT_FALSE(signal.is_connected(first));
+  ASSERT_TRUE(signal.is_connected(second));
+  ASSERT_EQ(1u, signal.size());
+
+  signal.emit(cen::quit_event{});
+  ASSERT_EQ(0, a);
+  ASSERT_EQ(1, b);
+
+  // Reused slots must not make old connections valid again
+  const auto third = signal.connect([](const cen::quit_event&) {});
+  ASSERT_EQ(first.index, third.index);
+  ASSERT_NE(first, third);
+  ASSERT_FALSE(signal.is_connected(first));
+  ASSERT_TRUE(signal.is_connected(third));
+}
+
+TEST(EventSignal, ModifyDuringEmission)
+{
+  signal_type signal;
+
+  int selfCount = 0;
+  int addedCount = 0;
+  cen::event_connection self;
+
+  self = signal.connect([&](const cen::quit_event&) {
+    ++selfCount;
+    signal.disconnect(self);
+    signal.connect([&](const cen::quit_event&) { ++addedCount; });
+  });
+
+  ASSERT_FALSE(signal.emit(cen::quit_event{}));
+  ASSERT_EQ(1, selfCount);
+  ASSERT_EQ(0, addedCount);
+  ASSERT_EQ(1u, signal.size());
+
+  ASSERT_FALSE(signal.emit(cen::quit_event{}));
+  ASSERT_EQ(1, selfCount);
+  ASSERT_EQ(1, addedCount);
+}
+
+TEST(EventSignal, Clear)
+{
+  signal_type signal;
+
+  int count = 0;
+  const auto connection = signal.connect([&](const cen::quit_event&) { ++count; });
+  signal.connect([&](const cen::quit_event&) { ++count; });
+
+  signal.clear();
+  ASSERT_TRUE(signal.empty());
+  ASSERT_FALSE(signal.is_connected(connection));
+
+  signal.emit(cen::quit_event{});
+  ASSERT_EQ(0, count);
+}
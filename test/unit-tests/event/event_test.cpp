@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
 #include <type_traits>
 
 namespace {
@@ -130,6 +131,26 @@ TEST(Event, Poll)
   cen::event::flush_all();
 }
 
+TEST(Event, Drain)
+{
+  cen::event::flush_all();
+
+  for (int i = 0; i < 3; ++i)
+  {
+    auto event = create_event(SDL_QUIT);
+    cen::event::push(event);
+  }
+
+  std::array<SDL_Event, 2> events{};
+  ASSERT_EQ(2, cen::event::drain(events));
+  ASSERT_EQ(SDL_QUIT, events.at(0).type);
+  ASSERT_EQ(SDL_QUIT, events.at(1).type);
+
+  ASSERT_EQ(1, cen::event::drain(events));
+  ASSERT_EQ(0, cen::event::drain(events));
+  ASSERT_EQ(0, cen::event::queue_count());
+}
+
 TEST(Event, QueueCount)
 {
   cen::event::flush_all();
@@ -403,3 +424,49 @@ TEST(Event, TryGet)
   ASSERT_TRUE(cEvent.try_get<cen::mouse_motion_event>());
   ASSERT_FALSE(cEvent.try_get<cen::window_event>());
 }
+
+TEST(Event, TryView)
+{
+  SDL_Event sdl{};
+  sdl.type = SDL_KEYDOWN;
+  sdl.key.keysym.scancode = SDL_SCANCODE_W;
+
+  const cen::event event{sdl};
+
+  const auto* key = event.try_view<cen::keyboard_event>();
+  ASSERT_TRUE(key);
+  ASSERT_EQ(&event.data().key, key);
+  ASSERT_EQ(SDL_SCANCODE_W, key->keysym.scancode);
+
+  ASSERT_FALSE(event.try_view<cen::mouse_motion_event>());
+  ASSERT_FALSE(cen::event{}.try_view<cen::keyboard_event>());
+}
+
+TEST(Event, LazyWrapper)
+{
+  SDL_Event sdl{};
+  sdl.type = SDL_MOUSEMOTION;
+  sdl.motion.x = 12;
+
+  cen::event::flush_all();
+  SDL_PushEvent(&sdl);
+
+  cen::event event;
+  ASSERT_TRUE(event.poll());
+  ASSERT_TRUE(event.is<cen::mouse_motion_event>());
+  ASSERT_EQ(12, event.get<cen::mouse_motion_event>().x());
+
+  // The wrapper must be recreated for the next polled event
+  sdl.type = SDL_QUIT;
+  SDL_PushEvent(&sdl);
+
+  ASSERT_TRUE(event.poll());
+  ASSERT_FALSE(event.try_get<cen::mouse_motion_event>());
+  ASSERT_TRUE(event.try_get<cen::quit_event>());
+
+  ASSERT_FALSE(event.poll());
+  ASSERT_TRUE(event.is_empty());
+  ASSERT_FALSE(event.try_get<cen::quit_event>());
+
+  cen::event::flush_all();
+}
@@ -0,0 +1,123 @@
+#include "events/text_input_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>    // array
+#include <cstring>  // strcpy
+
+#include "allocation_counter.hpp"
+#include "events/event.hpp"
+#include "events/quit_event.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_input(const char* text) -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_TEXTINPUT;
+  std::strcpy(event.text.text, text);
+  return event;
+}
+
+[[nodiscard]] auto make_editing(const char* text, const int start, const int length)
+    -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_TEXTEDITING;
+  std::strcpy(event.edit.text, text);
+  event.edit.start = start;
+  event.edit.length = length;
+  return event;
+}
+
+}  // namespace
+
+TEST(TextInputBuffer, Defaults)
+{
+  const cen::text_input_buffer buffer;
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_TRUE(buffer.text().empty());
+  ASSERT_TRUE(buffer.composition().empty());
+  ASSERT_FALSE(buffer.is_composing());
+  ASSERT_EQ(0, buffer.composition_cursor());
+  ASSERT_EQ(0, buffer.composition_length());
+}
+
+TEST(TextInputBuffer, Capacity)
+{
+  const cen::text_input_buffer buffer{256};
+  ASSERT_GE(buffer.capacity(), 256u);
+}
+
+TEST(TextInputBuffer, Feed)
+{
+  cen::text_input_buffer buffer;
+
+  ASSERT_TRUE(buffer.feed(make_input("ab")));
+  ASSERT_TRUE(buffer.feed(make_input("c")));
+  ASSERT_FALSE(buffer.feed(SDL_Event{}));
+  ASSERT_EQ("abc", buffer.text());
+
+  ASSERT_TRUE(buffer.feed(make_editing("de", 1, 1)));
+  ASSERT_EQ("abc", buffer.text());
+  ASSERT_EQ("de", buffer.composition());
+  ASSERT_TRUE(buffer.is_composing());
+  ASSERT_EQ(1, buffer.composition_cursor());
+  ASSERT_EQ(1, buffer.composition_length());
+
+  ASSERT_TRUE(buffer.feed(make_input("de")));
+  ASSERT_EQ("abcde", buffer.text());
+  ASSERT_FALSE(buffer.is_composing());
+
+  const auto capacity = buffer.capacity();
+  buffer.clear();
+
+  const auto input = make_input("fgh");
+  EXPECT_NO_ALLOCATIONS({ buffer.feed(input); });
+  ASSERT_EQ("fgh", buffer.text());
+
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(capacity, buffer.capacity());
+}
+
+TEST(TextInputBuffer, FeedFullArray)
+{
+  SDL_Event event{};
+  event.type = SDL_TEXTINPUT;
+  for (auto& ch : event.text.text)
+  {
+    ch = 'x';
+  }
+
+  cen::text_input_buffer buffer;
+  buffer.feed(event);
+  ASSERT_EQ(sizeof event.text.text, buffer.text().size());
+}
+
+TEST(TextInputBuffer, FeedSequence)
+{
+  const std::array events{make_input("a"), SDL_Event{}, make_input("b")};
+
+  cen::text_input_buffer buffer;
+  ASSERT_EQ(2, buffer.feed(events.data(), static_cast<int>(events.size())));
+  ASSERT_EQ("ab", buffer.text());
+}
+
+TEST(TextInputBuffer, Collect)
+{
+  cen::event::flush_all();
+
+  auto first = make_input("foo");
+  auto second = make_input("bar");
+  SDL_PushEvent(&first);
+  cen::event::push(cen::quit_event{});
+  SDL_PushEvent(&second);
+
+  cen::text_input_buffer buffer;
+  ASSERT_EQ(2, buffer.collect());
+  ASSERT_EQ("foobar", buffer.text());
+  ASSERT_EQ(1, cen::event::queue_count().value_or(0));
+
+  cen::event::flush_all();
+}
@@ -0,0 +1,206 @@
+#include "input/action_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <string>  // to_string
+
+namespace {
+
+class ActionMapTest : public testing::Test
+{
+ protected:
+  [[nodiscard]] auto input() const -> cen::action_input
+  {
+    cen::action_input result;
+    result.keys = m_keys.data();
+    result.key_count = static_cast<int>(m_keys.size());
+    result.mouse_buttons = m_mouse;
+    result.controller = m_controller;
+    return result;
+  }
+
+  void set_button(const cen::controller_button button, const bool pressed)
+  {
+    const auto bit = cen::u32{1} << static_cast<cen::u32>(button);
+    if (pressed)
+    {
+      m_controller.buttons |= bit;
+    }
+    else
+    {
+      m_controller.buttons &= ~bit;
+    }
+  }
+
+  void set_axis(const cen::controller_axis axis, const cen::i16 value)
+  {
+    m_controller.axes[static_cast<std::size_t>(axis)] = value;
+  }
+
+  std::array<cen::u8, SDL_NUM_SCANCODES> m_keys{};
+  cen::u32 m_mouse{};
+  cen::controller_snapshot m_controller{};
+};
+
+}  // namespace
+
+TEST_F(ActionMapTest, Names)
+{
+  cen::action_map_builder builder;
+
+  const auto jump = builder.add_action("jump");
+  const auto fire = builder.add_action("fire");
+
+  ASSERT_EQ(0, jump);
+  ASSERT_EQ(1, fire);
+  ASSERT_EQ(fire, builder.find("fire"));
+  ASSERT_FALSE(builder.find("crouch"));
+  ASSERT_THROW(builder.add_action("jump"), cen::cen_error);
+
+  const auto actions = builder.compile();
+  ASSERT_EQ(2u, actions.action_count());
+  ASSERT_EQ(jump, actions.find("jump"));
+  ASSERT_EQ("fire", actions.name(fire));
+}
+
+TEST_F(ActionMapTest, Keys)
+{
+  cen::action_map_builder builder;
+
+  const auto jump = builder.add_action("jump");
+  builder.bind(jump, cen::scancodes::space);
+
+  auto actions = builder.compile();
+
+  m_keys[SDL_SCANCODE_SPACE] = 1;
+  actions.update(input());
+
+  ASSERT_TRUE(actions.is_pressed(jump));
+  ASSERT_TRUE(actions.just_pressed(jump));
+  ASSERT_FLOAT_EQ(1.0f, actions.value(jump));
+
+  actions.update(input());
+  ASSERT_TRUE(actions.is_pressed(jump));
+  ASSERT_FALSE(actions.just_pressed(jump));
+
+  m_keys[SDL_SCANCODE_SPACE] = 0;
+  actions.update(input());
+
+  ASSERT_FALSE(actions.is_pressed(jump));
+  ASSERT_TRUE(actions.just_released(jump));
+  ASSERT_FLOAT_EQ(0.0f, actions.value(jump));
+}
+
+TEST_F(ActionMapTest, MouseAndButtons)
+{
+  cen::action_map_builder builder;
+
+  const auto fire = builder.add_action("fire");
+  builder.bind(fire, cen::mouse_button::left);
+  builder.bind(fire, cen::controller_button::right_shoulder);
+
+  auto actions = builder.compile();
+  ASSERT_EQ(2u, actions.binding_count());
+
+  m_mouse = SDL_BUTTON(SDL_BUTTON_LEFT);
+  actions.update(input());
+  ASSERT_TRUE(actions.is_pressed(fire));
+
+  m_mouse = 0;
+  set_button(cen::controller_button::right_shoulder, true);
+  actions.update(input());
+  ASSERT_TRUE(actions.is_pressed(fire));
+  ASSERT_FALSE(actions.just_pressed(fire));
+
+  set_button(cen::controller_button::right_shoulder, false);
+  actions.update(input());
+  ASSERT_TRUE(actions.just_released(fire));
+}
+
+TEST_F(ActionMapTest, Axes)
+{
+  cen::action_map_builder builder;
+
+  const auto left = builder.add_action("left");
+  const auto right = builder.add_action("right");
+  builder.bind(left,
+               cen::controller_axis::left_x,
+               cen::axis_direction::negative,
+               0.5f);
+  builder.bind(right, cen::controller_axis::left_x, cen::axis_direction::positive, 0.5f);
+  builder.bind(right, cen::scancodes::d);
+
+  auto actions = builder.compile();
+
+  set_axis(cen::controller_axis::left_x, 10'000);  // Inside of the deadzone
+  actions.update(input());
+  ASSERT_FALSE(actions.is_pressed(left));
+  ASSERT_FALSE(actions.is_pressed(right));
+
+  set_axis(cen::controller_axis::left_x, -32'768);
+  actions.update(input());
+  ASSERT_TRUE(actions.is_pressed(left));
+  ASSERT_FLOAT_EQ(1.0f, actions.value(left));
+  ASSERT_FALSE(actions.is_pressed(right));
+
+  set_axis(cen::controller_axis::left_x, 24'575);
+  actions.update(input());
+  ASSERT_FALSE(actions.is_pressed(left));
+  ASSERT_NEAR(0.5f, actions.value(right), 0.001f);
+
+  // The largest value of the active bindings is used
+  m_keys[SDL_SCANCODE_D] = 1;
+  actions.update(input());
+  ASSERT_FLOAT_EQ(1.0f, actions.value(right));
+}
+
+TEST_F(ActionMapTest, Contexts)
+{
+  constexpr cen::action_context gameplay = 0;
+  constexpr cen::action_context menu = 1;
+
+  cen::action_map_builder builder;
+
+  const auto jump = builder.add_action("jump");
+  const auto confirm = builder.add_action("confirm");
+  builder.bind(jump, cen::controller_button::a, gameplay);
+  builder.bind(confirm, cen::controller_button::a, menu);
+
+  auto actions = builder.compile();
+  actions.disable(menu);
+  ASSERT_TRUE(actions.is_enabled(gameplay));
+  ASSERT_FALSE(actions.is_enabled(menu));
+
+  set_button(cen::controller_button::a, true);
+  actions.update(input());
+  ASSERT_TRUE(actions.is_pressed(jump));
+  ASSERT_FALSE(actions.is_pressed(confirm));
+
+  actions.disable(gameplay);
+  actions.enable(menu);
+  actions.update(input());
+  ASSERT_TRUE(actions.just_released(jump));
+  ASSERT_TRUE(actions.just_pressed(confirm));
+}
+
+TEST_F(ActionMapTest, ManyActions)
+{
+  cen::action_map_builder builder;
+
+  for (int index = 0; index < 300; ++index)
+  {
+    const auto id = builder.add_action("action" + std::to_string(index));
+    builder.bind(id, cen::scan_code{static_cast<SDL_Scancode>(4 + index % 200)});
+  }
+
+  auto actions = builder.compile();
+
+  m_keys[4] = 1;  // Bound to the first and the 201st action
+  actions.update(input());
+
+  ASSERT_TRUE(actions.is_pressed(0));
+  ASSERT_TRUE(actions.is_pressed(200));
+  ASSERT_FALSE(actions.is_pressed(1));
+  ASSERT_FALSE(actions.is_pressed(299));
+}
@@ -0,0 +1,103 @@
+#include "input/device_registry.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(DeviceRegistry, Defaults)
+{
+  const cen::controller_registry registry;
+  ASSERT_TRUE(registry.empty());
+  ASSERT_EQ(0u, registry.size());
+  ASSERT_EQ(registry.begin(), registry.end());
+  ASSERT_FALSE(registry.contains(0));
+  ASSERT_FALSE(registry.find(0));
+  ASSERT_FALSE(registry.index_of(0));
+}
+
+TEST(DeviceRegistry, IgnoresOtherEvents)
+{
+  cen::joystick_registry registry;
+
+  SDL_Event event{};
+  event.type = SDL_QUIT;
+  ASSERT_FALSE(registry.feed(event));
+
+  // Controller events aren't handled by joystick registries
+  event.type = SDL_CONTROLLERDEVICEREMOVED;
+  ASSERT_FALSE(registry.feed(event));
+}
+
+TEST(DeviceRegistry, CloseUnknownDevice)
+{
+  cen::controller_registry registry;
+  ASSERT_FALSE(registry.close(42));
+  ASSERT_FALSE(registry.open(-1));
+}
+
+#if !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+TEST(DeviceRegistry, CaptureSensor)
+{
+  cen::controller_registry registry;
+  ASSERT_EQ(0u, registry.capture_sensor(cen::sensor_type::gyroscope));
+  ASSERT_EQ(0u, registry.capture_sensor(cen::sensor_type::unknown));
+  ASSERT_FALSE(registry.find_sensor_stream(0, cen::sensor_type::gyroscope));
+
+  bool invoked = false;
+  ASSERT_EQ(0u,
+            registry.drain_sensor(0, cen::sensor_type::gyroscope, [&](const auto&) {
+              invoked = true;
+            }));
+  ASSERT_FALSE(invoked);
+
+  registry.release_sensor(cen::sensor_type::gyroscope);
+}
+
+#endif  // !defined(CENTURION_NO_SENSOR) && SDL_VERSION_ATLEAST(2, 0, 14)
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+TEST(DeviceRegistry, HotPlug)
+{
+  const auto type = cen::joystick_type::game_controller;
+  const auto first = cen::joystick::attach_virtual(type, 1, 1, 0);
+  const auto second = cen::joystick::attach_virtual(type, 1, 1, 0);
+  ASSERT_TRUE(first);
+  ASSERT_TRUE(second);
+
+  cen::joystick_registry registry;
+
+  SDL_Event added{};
+  added.type = SDL_JOYDEVICEADDED;
+  added.jdevice.which = *first;
+  ASSERT_TRUE(registry.feed(added));
+  ASSERT_FALSE(registry.feed(added));
+
+  ASSERT_EQ(1u, registry.open_all());
+  ASSERT_EQ(2u, registry.size());
+
+  const auto firstId = registry.instance_id(0);
+  const auto secondId = registry.instance_id(1);
+  ASSERT_TRUE(registry.contains(firstId));
+  ASSERT_EQ(registry[1].instance_id(), secondId);
+  ASSERT_EQ(&registry[0], registry.find(firstId));
+
+  SDL_Event removed{};
+  removed.type = SDL_JOYDEVICEREMOVED;
+  removed.jdevice.which = firstId;
+  ASSERT_TRUE(registry.feed(removed));
+  ASSERT_FALSE(registry.feed(removed));
+
+  // The last device is moved into the freed slot
+  ASSERT_EQ(1u, registry.size());
+  ASSERT_EQ(secondId, registry.instance_id(0));
+  ASSERT_EQ(0u, registry.index_of(secondId));
+  ASSERT_FALSE(registry.contains(firstId));
+
+  registry.clear();
+  ASSERT_TRUE(registry.empty());
+
+  ASSERT_TRUE(cen::joystick::detach_virtual(*second));
+  ASSERT_TRUE(cen::joystick::detach_virtual(*first));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
@@ -0,0 +1,213 @@
+#include "input/gesture_recognizer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+namespace {
+
+[[nodiscard]] auto make_event(const cen::event_type type,
+                              const SDL_FingerID finger,
+                              const float x,
+                              const float y,
+                              const cen::u32 time) -> cen::touch_finger_event
+{
+  cen::touch_finger_event event;
+  event.set_type(type);
+  event.set_touch_id(1);
+  event.set_finger_id(finger);
+  event.set_x(x);
+  event.set_y(y);
+  event.set_time(time);
+  return event;
+}
+
+class GestureRecognizerTest : public testing::Test
+{
+ protected:
+  void down(const SDL_FingerID finger, const float x, const float y, const cen::u32 time)
+  {
+    send(make_event(cen::event_type::touch_down, finger, x, y, time));
+  }
+
+  void move(const SDL_FingerID finger, const float x, const float y, const cen::u32 time)
+  {
+    send(make_event(cen::event_type::touch_motion, finger, x, y, time));
+  }
+
+  void up(const SDL_FingerID finger, const float x, const float y, const cen::u32 time)
+  {
+    send(make_event(cen::event_type::touch_up, finger, x, y, time));
+  }
+
+  void send(const cen::touch_finger_event& event)
+  {
+    m_recognizer.process(event, [this](const cen::gesture& gesture) {
+      m_gestures.push_back(gesture);
+    });
+  }
+
+  [[nodiscard]] auto types() const -> std::vector<cen::gesture_type>
+  {
+    std::vector<cen::gesture_type> result;
+    for (const auto& gesture : m_gestures)
+    {
+      result.push_back(gesture.type);
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] auto of_type(const cen::gesture_type type) const
+      -> std::vector<cen::gesture>
+  {
+    std::vector<cen::gesture> result;
+    for (const auto& gesture : m_gestures)
+    {
+      if (gesture.type == type)
+      {
+        result.push_back(gesture);
+      }
+    }
+
+    return result;
+  }
+
+  cen::gesture_recognizer<4> m_recognizer;
+  std::vector<cen::gesture> m_gestures;
+};
+
+using cen::gesture_type;
+
+}  // namespace
+
+TEST_F(GestureRecognizerTest, Tap)
+{
+  down(1, 0.5f, 0.5f, 100);
+  ASSERT_EQ(1u, m_recognizer.finger_count());
+
+  // Small movements don't prevent taps
+  move(1, 0.505f, 0.5f, 120);
+  up(1, 0.505f, 0.5f, 150);
+
+  ASSERT_EQ(0u, m_recognizer.finger_count());
+  ASSERT_EQ(std::vector{gesture_type::tap}, types());
+  ASSERT_FLOAT_EQ(0.505f, m_gestures.at(0).x);
+  ASSERT_EQ(150u, m_gestures.at(0).time);
+
+  // Long touches aren't taps
+  down(1, 0.5f, 0.5f, 1'000);
+  up(1, 0.5f, 0.5f, 1'500);
+  ASSERT_EQ(1u, m_gestures.size());
+}
+
+TEST_F(GestureRecognizerTest, DoubleTap)
+{
+  down(1, 0.5f, 0.5f, 0);
+  up(1, 0.5f, 0.5f, 50);
+  down(2, 0.51f, 0.5f, 200);
+  up(2, 0.51f, 0.5f, 250);
+
+  // A third tap doesn't complete another double tap
+  down(3, 0.51f, 0.5f, 400);
+  up(3, 0.51f, 0.5f, 450);
+
+  const std::vector expected{gesture_type::tap,
+                             gesture_type::tap,
+                             gesture_type::double_tap,
+                             gesture_type::tap};
+  ASSERT_EQ(expected, types());
+
+  // Taps that are far apart aren't double taps
+  m_gestures.clear();
+  m_recognizer.reset();
+  down(1, 0.1f, 0.1f, 1'000);
+  up(1, 0.1f, 0.1f, 1'050);
+  down(1, 0.9f, 0.9f, 1'100);
+  up(1, 0.9f, 0.9f, 1'150);
+  ASSERT_EQ((std::vector{gesture_type::tap, gesture_type::tap}), types());
+}
+
+TEST_F(GestureRecognizerTest, Pan)
+{
+  down(1, 0.5f, 0.5f, 0);
+  move(1, 0.51f, 0.5f, 10);  // Below the threshold
+  ASSERT_TRUE(m_gestures.empty());
+
+  move(1, 0.6f, 0.5f, 20);
+  move(1, 0.6f, 0.55f, 30);
+  up(1, 0.6f, 0.55f, 40);
+
+  ASSERT_EQ((std::vector{gesture_type::pan, gesture_type::pan}), types());
+  ASSERT_NEAR(0.1f, m_gestures.at(0).dx, 1e-6f);
+  ASSERT_NEAR(0.0f, m_gestures.at(0).dy, 1e-6f);
+  ASSERT_NEAR(0.0f, m_gestures.at(1).dx, 1e-6f);
+  ASSERT_NEAR(0.05f, m_gestures.at(1).dy, 1e-6f);
+}
+
+TEST_F(GestureRecognizerTest, Pinch)
+{
+  down(1, 0.4f, 0.5f, 0);
+  down(2, 0.6f, 0.5f, 0);
+  ASSERT_EQ(2u, m_recognizer.finger_count());
+
+  move(1, 0.3f, 0.5f, 10);
+  move(2, 0.7f, 0.5f, 20);
+
+  // The center moves with each finger, so the pinches are accompanied by pans
+  const auto pinches = of_type(gesture_type::pinch);
+  ASSERT_EQ(2u, pinches.size());
+  ASSERT_FLOAT_EQ(1.5f, pinches.at(0).scale);
+  ASSERT_FLOAT_EQ(4.0f / 3.0f, pinches.at(1).scale);
+  ASSERT_EQ(2, pinches.at(1).fingers);
+  ASSERT_FLOAT_EQ(0.5f, pinches.at(1).x);
+  ASSERT_TRUE(of_type(gesture_type::rotate).empty());
+}
+
+TEST_F(GestureRecognizerTest, Rotate)
+{
+  down(1, 0.4f, 0.5f, 0);
+  down(2, 0.6f, 0.5f, 0);
+
+  // Rotates the second finger by 90 degrees around the first one, at the same distance
+  move(2, 0.4f, 0.7f, 10);
+
+  // The center of the fingers moves as well, but their distance doesn't
+  ASSERT_EQ((std::vector{gesture_type::pan, gesture_type::rotate}), types());
+  ASSERT_NEAR(1.5707963f, m_gestures.at(1).rotation, 1e-5f);
+}
+
+TEST_F(GestureRecognizerTest, Capacity)
+{
+  for (SDL_FingerID finger = 0; finger < 6; ++finger)
+  {
+    down(finger, 0.1f * static_cast<float>(finger), 0.5f, 0);
+  }
+
+  ASSERT_EQ(4u, m_recognizer.finger_count());
+
+  // Untracked fingers are ignored
+  up(5, 0.5f, 0.5f, 10);
+  ASSERT_EQ(4u, m_recognizer.finger_count());
+
+  up(0, 0.0f, 0.5f, 10);
+  ASSERT_EQ(3u, m_recognizer.finger_count());
+  ASSERT_TRUE(m_gestures.empty());
+}
+
+TEST_F(GestureRecognizerTest, Batch)
+{
+  const std::vector events{make_event(cen::event_type::touch_down, 1, 0.5f, 0.5f, 0),
+                           make_event(cen::event_type::touch_up, 1, 0.5f, 0.5f, 10),
+                           make_event(cen::event_type::touch_down, 1, 0.5f, 0.5f, 20),
+                           make_event(cen::event_type::touch_up, 1, 0.5f, 0.5f, 30)};
+
+  std::size_t calls = 0;
+  const auto count =
+      m_recognizer.process(events.data(), events.size(), [&](const cen::gesture&) {
+        ++calls;
+      });
+
+  ASSERT_EQ(3u, count);
+  ASSERT_EQ(3u, calls);
+}
@@ -64,6 +64,21 @@ TEST(KeyCode, StdStringConstructor)
   }
 }
 
+TEST(KeyCode, NameLookupMatchesSDL)
+{
+  for (int index = 0; index < SDL_NUM_SCANCODES; ++index)
+  {
+    const auto* name = SDL_GetScancodeName(static_cast<SDL_Scancode>(index));
+    ASSERT_EQ(SDL_GetKeyFromName(name), cen::key_code{name}.get());
+  }
+
+  ASSERT_EQ(SDLK_a, cen::key_code{"A"}.get());
+  ASSERT_EQ(SDLK_a, cen::key_code{"a"}.get());
+  ASSERT_EQ(SDLK_RETURN, cen::key_code{"return"}.get());
+  ASSERT_EQ(SDLK_UNKNOWN, cen::key_code{""}.get());
+  ASSERT_EQ(SDLK_UNKNOWN, cen::key_code{"foobar"}.get());
+}
+
 TEST(KeyCode, SDLKeycodeAssignmentOperator)
 {
   cen::key_code code;
@@ -69,6 +69,33 @@ TEST(Keyboard, JustReleased)
   ASSERT_FALSE(keyboard.just_released(cen::scan_code{SDL_NUM_SCANCODES + 1}));
 }
 
+TEST(Keyboard, ChangedKeys)
+{
+  cen::keyboard keyboard;
+  ASSERT_TRUE(keyboard.changed_keys().empty());
+
+  keyboard.update();
+  keyboard.update();
+
+  const auto changes = keyboard.changed_keys();
+  ASSERT_TRUE(changes.empty());
+  ASSERT_EQ(0u, changes.size());
+  ASSERT_EQ(changes.begin(), changes.end());
+}
+
+TEST(Keyboard, WasPressed)
+{
+  cen::keyboard keyboard;
+  keyboard.update();
+
+  ASSERT_FALSE(keyboard.was_pressed(SDL_SCANCODE_W));
+  ASSERT_FALSE(keyboard.was_pressed(SDLK_w));
+
+  ASSERT_FALSE(keyboard.was_pressed(cen::scan_code{-1}));
+  ASSERT_FALSE(keyboard.was_pressed(cen::scan_code{SDL_NUM_SCANCODES}));
+  ASSERT_FALSE(keyboard.was_pressed(cen::scan_code{SDL_NUM_SCANCODES + 1}));
+}
+
 TEST(Keyboard, IsActive)
 {
   // If this test fails, make sure that CAPS isn't enabled on your computer :)
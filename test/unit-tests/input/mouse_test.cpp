@@ -116,3 +116,38 @@ TEST(Mouse, WasMoved)
   const cen::mouse mouse;
   ASSERT_FALSE(mouse.was_moved());
 }
+
+TEST(Mouse, Accumulate)
+{
+  cen::mouse mouse;
+  mouse.set_logical_size({400, 300});
+
+  SDL_Event motion{};
+  motion.type = SDL_MOUSEMOTION;
+  motion.motion.xrel = 3;
+  motion.motion.yrel = -2;
+
+  SDL_Event wheel{};
+  wheel.type = SDL_MOUSEWHEEL;
+  wheel.wheel.y = 1;
+  wheel.wheel.direction = SDL_MOUSEWHEEL_FLIPPED;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+  wheel.wheel.preciseY = 1.0f;
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
+
+  const SDL_Event events[] = {motion, motion, wheel, motion};
+  mouse.accumulate(events, 4);
+
+  // The logical size is half of the window size
+  mouse.update(800, 600);
+  ASSERT_FLOAT_EQ(4.5f, mouse.motion().x());
+  ASSERT_FLOAT_EQ(-3.0f, mouse.motion().y());
+  ASSERT_FLOAT_EQ(0.0f, mouse.wheel().x());
+  ASSERT_FLOAT_EQ(-1.0f, mouse.wheel().y());
+
+  // The accumulated values are reset by each update
+  mouse.update(800, 600);
+  ASSERT_EQ(cen::fpoint{}, mouse.motion());
+  ASSERT_EQ(cen::fpoint{}, mouse.wheel());
+}
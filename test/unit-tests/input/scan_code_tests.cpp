@@ -46,6 +46,20 @@ TEST(ScanCode, StringConstructor)
   }
 }
 
+TEST(ScanCode, NameLookupMatchesSDL)
+{
+  for (int index = 0; index < cen::scan_code::count(); ++index)
+  {
+    const auto* name = SDL_GetScancodeName(static_cast<SDL_Scancode>(index));
+    ASSERT_EQ(SDL_GetScancodeFromName(name), cen::scan_code{name}.get());
+  }
+
+  // Names are case-insensitive
+  ASSERT_EQ(SDL_SCANCODE_ESCAPE, cen::scan_code{"eSCAPE"}.get());
+  ASSERT_EQ(SDL_SCANCODE_KP_ENTER, cen::scan_code{"keypad enter"}.get());
+  ASSERT_EQ(SDL_SCANCODE_UNKNOWN, cen::scan_code{""}.get());
+}
+
 TEST(ScanCode, SDLScancodeAssignmentOperator)
 {
   cen::scan_code code;
@@ -0,0 +1,154 @@
+#include "input/sensor_stream.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+namespace {
+
+[[nodiscard]] auto make_event(const cen::sensor_id id,
+                              const cen::u32 timestamp,
+                              const float x,
+                              const float y = 0,
+                              const float z = 0) -> SDL_SensorEvent
+{
+  SDL_SensorEvent event{};
+  event.type = SDL_SENSORUPDATE;
+  event.timestamp = timestamp;
+  event.which = id;
+  event.data[0] = x;
+  event.data[1] = y;
+  event.data[2] = z;
+
+#if SDL_VERSION_ATLEAST(2, 26, 0)
+  event.timestamp_us = cen::u64{timestamp} * 1'000u;
+#endif  // SDL_VERSION_ATLEAST(2, 26, 0)
+
+  return event;
+}
+
+[[nodiscard]] auto make_sample(const cen::u64 ms, const float x) -> cen::sensor_sample
+{
+  cen::sensor_sample sample;
+  sample.timestamp = cen::microseconds<cen::u64>{ms * 1'000u};
+  sample.values[0] = x;
+  return sample;
+}
+
+}  // namespace
+
+TEST(SensorStream, Record)
+{
+  cen::sensor_stream<4> stream{7};
+  ASSERT_EQ(7, stream.id());
+  ASSERT_EQ(4u, stream.capacity());
+
+  ASSERT_FALSE(stream.record(make_event(8, 10, 1.0f)));
+
+  for (cen::u32 index = 0; index < 5; ++index)
+  {
+    const auto event = make_event(7, 10 + index, static_cast<float>(index));
+    ASSERT_EQ(index < 4, stream.record(event));
+  }
+
+  ASSERT_EQ(1u, stream.dropped());
+
+  cen::sensor_sample first;
+  ASSERT_TRUE(stream.try_pop(first));
+  ASSERT_EQ(10'000u, first.timestamp.count());
+  ASSERT_EQ(0.0f, first.values[0]);
+
+  std::vector<float> values;
+  ASSERT_EQ(3u, stream.drain([&](const cen::sensor_sample& sample) {
+    values.push_back(sample.values[0]);
+  }));
+
+  ASSERT_EQ((std::vector<float>{1.0f, 2.0f, 3.0f}), values);
+  ASSERT_FALSE(stream.try_pop(first));
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+TEST(ControllerSensorStream, Record)
+{
+  cen::controller_sensor_stream<4> stream{3, cen::sensor_type::gyroscope};
+  ASSERT_EQ(3, stream.id());
+  ASSERT_EQ(cen::sensor_type::gyroscope, stream.type());
+
+  SDL_ControllerSensorEvent event{};
+  event.type = SDL_CONTROLLERSENSORUPDATE;
+  event.timestamp = 20;
+  event.which = 3;
+  event.sensor = SDL_SENSOR_GYRO;
+  event.data[0] = 1.0f;
+  event.data[1] = 2.0f;
+  event.data[2] = 3.0f;
+
+#if SDL_VERSION_ATLEAST(2, 26, 0)
+  event.timestamp_us = 20'000u;
+#endif  // SDL_VERSION_ATLEAST(2, 26, 0)
+
+  ASSERT_TRUE(stream.record(event));
+
+  // Readings of other controllers and sensors are ignored
+  event.which = 4;
+  ASSERT_FALSE(stream.record(event));
+
+  event.which = 3;
+  event.sensor = SDL_SENSOR_ACCEL;
+  ASSERT_FALSE(stream.record(event));
+
+  std::vector<cen::sensor_sample> samples;
+  ASSERT_EQ(1u, stream.drain([&](const cen::sensor_sample& sample) {
+    samples.push_back(sample);
+  }));
+
+  ASSERT_EQ(20'000u, samples.at(0).timestamp.count());
+  ASSERT_EQ(2.0f, samples.at(0).xyz().y);
+  ASSERT_EQ(0.0f, samples.at(0).values[3]);
+  ASSERT_EQ(0u, stream.dropped());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
+
+TEST(GyroIntegrator, Integrate)
+{
+  cen::gyro_integrator integrator;
+
+  // The first reading is the starting point, then 1 rad/s for 500 ms, ramping to 3 rad/s
+  integrator.add(make_sample(0, 1.0f));
+  ASSERT_EQ(0.0f, integrator.angle().x);
+
+  integrator.add(make_sample(500, 1.0f));
+  ASSERT_FLOAT_EQ(0.5f, integrator.angle().x);
+
+  integrator.add(make_sample(1'000, 3.0f));
+  ASSERT_FLOAT_EQ(1.5f, integrator.angle().x);
+
+  ASSERT_FLOAT_EQ(1.5f, integrator.consume().x);
+  ASSERT_EQ(0.0f, integrator.angle().x);
+
+  integrator.add(make_sample(1'100, 3.0f));
+  ASSERT_FLOAT_EQ(0.3f, integrator.angle().x);
+
+  integrator.reset();
+  integrator.add(make_sample(2'000, 5.0f));
+  ASSERT_EQ(0.0f, integrator.angle().x);
+}
+
+TEST(SensorLowPass, Filter)
+{
+  cen::sensor_low_pass filter{cen::milliseconds<float>{100}};
+
+  ASSERT_EQ(2.0f, filter.add(make_sample(0, 2.0f)).x);
+
+  // With a time step equal to the time constant, the output moves halfway to the input
+  ASSERT_FLOAT_EQ(3.0f, filter.add(make_sample(100, 4.0f)).x);
+  ASSERT_FLOAT_EQ(3.0f, filter.value().x);
+
+  // Readings with the same timestamp are ignored
+  ASSERT_FLOAT_EQ(3.0f, filter.add(make_sample(100, 100.0f)).x);
+
+  filter.reset();
+  ASSERT_EQ(0.0f, filter.value().x);
+}
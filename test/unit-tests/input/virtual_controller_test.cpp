@@ -0,0 +1,100 @@
+#include "input/virtual_controller.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>  // array
+
+#if SDL_VERSION_ATLEAST(2, 0, 14)
+
+namespace {
+
+[[nodiscard]] auto make_snapshot(const cen::controller_button button, const cen::i16 x)
+    -> cen::controller_snapshot
+{
+  cen::controller_snapshot snapshot;
+  snapshot.buttons = cen::detail::controller_bit(button);
+  snapshot.axes[SDL_CONTROLLER_AXIS_LEFTX] = x;
+  return snapshot;
+}
+
+}  // namespace
+
+TEST(VirtualController, Construction)
+{
+  const cen::virtual_controller controller;
+  const auto joystick = controller.get_joystick();
+  ASSERT_TRUE(joystick);
+  ASSERT_EQ(controller.instance_id(), joystick.instance_id());
+  ASSERT_EQ(SDL_CONTROLLER_AXIS_MAX, joystick.axis_count());
+  ASSERT_EQ(SDL_CONTROLLER_BUTTON_MAX, joystick.button_count());
+}
+
+TEST(VirtualController, Apply)
+{
+  cen::virtual_controller controller;
+
+  const auto snapshot = make_snapshot(cen::controller_button::a, 12'345);
+  ASSERT_TRUE(controller.apply(snapshot));
+  ASSERT_TRUE(controller.state().is_pressed(cen::controller_button::a));
+  ASSERT_EQ(12'345, controller.state().axis(cen::controller_axis::left_x));
+
+  SDL_JoystickUpdate();
+
+  auto joystick = controller.get_joystick();
+  ASSERT_EQ(12'345, joystick.axis_pos(SDL_CONTROLLER_AXIS_LEFTX));
+  ASSERT_EQ(cen::button_state::pressed,
+            joystick.get_button_state(SDL_CONTROLLER_BUTTON_A));
+}
+
+TEST(VirtualController, ApplySnapshots)
+{
+  std::array<cen::virtual_controller, 2> controllers;
+  const std::array snapshots{make_snapshot(cen::controller_button::a, 1),
+                             make_snapshot(cen::controller_button::b, 2)};
+
+  ASSERT_TRUE(
+      cen::apply_snapshots(controllers.begin(), controllers.end(), snapshots.begin()));
+  ASSERT_TRUE(controllers[0].state().is_pressed(cen::controller_button::a));
+  ASSERT_TRUE(controllers[1].state().is_pressed(cen::controller_button::b));
+}
+
+TEST(ControllerReplay, Unsorted)
+{
+  cen::virtual_controller controller;
+  cen::controller_track track{{cen::milliseconds<cen::u32>{10}, {}},
+                              {cen::milliseconds<cen::u32>{5}, {}}};
+
+  ASSERT_THROW(cen::controller_replay(controller, std::move(track)), cen::cen_error);
+}
+
+TEST(ControllerReplay, Update)
+{
+  using ms = cen::milliseconds<cen::u32>;
+
+  cen::virtual_controller controller;
+  cen::controller_track track{{ms{0}, make_snapshot(cen::controller_button::a, 1)},
+                              {ms{10}, make_snapshot(cen::controller_button::b, 2)},
+                              {ms{20}, make_snapshot(cen::controller_button::x, 3)}};
+
+  cen::controller_replay replay{controller, std::move(track)};
+  ASSERT_FALSE(replay.is_finished());
+  ASSERT_EQ(3u, replay.track().size());
+
+  ASSERT_TRUE(replay.update(ms{0}));
+  ASSERT_EQ(1, controller.state().axis(cen::controller_axis::left_x));
+
+  ASSERT_TRUE(replay.update(ms{5}));
+  ASSERT_EQ(1, controller.state().axis(cen::controller_axis::left_x));
+
+  // The second frame is skipped over
+  ASSERT_TRUE(replay.update(ms{20}));
+  ASSERT_EQ(ms{25}, replay.position());
+  ASSERT_EQ(3, controller.state().axis(cen::controller_axis::left_x));
+  ASSERT_TRUE(replay.is_finished());
+
+  replay.restart();
+  ASSERT_FALSE(replay.is_finished());
+  ASSERT_EQ(ms{0}, replay.position());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 14)
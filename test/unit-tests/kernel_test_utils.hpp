@@ -0,0 +1,30 @@
+#pragma once
+
+#include <array>  // array
+
+#include "core/integers.hpp"
+#include "detail/simd_dispatch.hpp"
+
+// Every SIMD level, kernels that aren't available for a level fall back to the scalar
+// kernels, so kernel tests can compare the results of all levels on any platform
+inline constexpr std::array simd_levels = {cen::detail::simd_level::none,
+                                           cen::detail::simd_level::sse2,
+                                           cen::detail::simd_level::avx2,
+                                           cen::detail::simd_level::neon};
+
+// A linear congruential generator, used to create deterministic test data
+class lcg final
+{
+ public:
+  explicit lcg(const cen::u32 seed) noexcept : m_state{seed}
+  {}
+
+  [[nodiscard]] auto next() noexcept -> cen::u32
+  {
+    m_state = m_state * 1'664'525u + 1'013'904'223u;
+    return m_state;
+  }
+
+ private:
+  cen::u32 m_state;
+};
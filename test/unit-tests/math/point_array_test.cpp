@@ -0,0 +1,79 @@
+#include "math/point_array.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+TEST(PointArray, PushBackAndRemove)
+{
+  cen::point_array<int> points;
+  ASSERT_TRUE(points.empty());
+
+  points.push_back({1, 2});
+  points.push_back({3, 4});
+  points.push_back({5, 6});
+  ASSERT_EQ(3u, points.size());
+  ASSERT_EQ(cen::ipoint(3, 4), points[1]);
+
+  points.swap_remove(0);
+  ASSERT_EQ(2u, points.size());
+  ASSERT_EQ(cen::ipoint(5, 6), points[0]);
+}
+
+TEST(PointArray, ContainedIn)
+{
+  cen::point_array<float> points;
+  for (int index = 0; index < 19; ++index)
+  {
+    points.push_back({static_cast<float>(index), static_cast<float>(index % 3)});
+  }
+
+  const cen::frect area{2, 0, 8, 1};
+
+  std::vector<cen::u8> results(points.size());
+  const auto hits = points.contained_in(area, results.data());
+
+  std::size_t expected = 0;
+  for (std::size_t index = 0; index < points.size(); ++index)
+  {
+    ASSERT_EQ(area.contains(points[index]), results.at(index) == 1);
+    expected += results.at(index);
+  }
+
+  ASSERT_EQ(expected, hits);
+  ASSERT_EQ(6u, hits);
+}
+
+TEST(PointArray, TranslateAndBounds)
+{
+  cen::point_array<float> points;
+  ASSERT_EQ(cen::frect{}, points.bounds());
+
+  for (int index = 0; index < 11; ++index)
+  {
+    points.push_back({static_cast<float>(index), static_cast<float>(-index)});
+  }
+
+  points.translate(1, 2);
+  ASSERT_EQ(cen::fpoint(11, -8), points[10]);
+  ASSERT_EQ(cen::frect(1, -8, 10, 10), points.bounds());
+}
+
+TEST(PointArray, Transform)
+{
+  cen::point_array<float> points;
+  for (int index = 0; index < 13; ++index)
+  {
+    points.push_back({static_cast<float>(index), 1});
+  }
+
+  const auto transform =
+      cen::transform2d::translation(5, 0) * cen::transform2d::scaling(2, -1);
+  points.transform(transform);
+
+  for (int index = 0; index < 13; ++index)
+  {
+    const auto expected = transform.apply({static_cast<float>(index), 1});
+    ASSERT_EQ(expected, points[static_cast<std::size_t>(index)]);
+  }
+}
@@ -2,6 +2,7 @@
 
 #include <gtest/gtest.h>
 
+#include <array>        // array
 #include <cmath>        // abs, sqrt
 #include <iostream>     // cout
 #include <type_traits>  // ...
@@ -206,6 +207,25 @@ TEST(Point, ToString)
   cen::log::put(cen::to_string(fp));
 }
 
+TEST(Point, FormatTo)
+{
+  const cen::ipoint ip{123, 456};
+
+  std::array<char, 64> buffer{};
+  ASSERT_EQ(22u, cen::format_to(buffer.data(), buffer.size(), ip));
+  ASSERT_STREQ("ipoint{x: 123, y: 456}", buffer.data());
+  ASSERT_EQ(cen::to_string(ip), buffer.data());
+
+  const cen::fpoint fp{12.3f, 45.6f};
+  const auto length = cen::format_to(buffer.data(), buffer.size(), fp);
+  ASSERT_EQ(cen::to_string(fp).size(), length);
+  ASSERT_EQ(cen::to_string(fp), buffer.data());
+
+  std::array<char, 8> small{};
+  ASSERT_EQ(22u, cen::format_to(small.data(), small.size(), ip));
+  ASSERT_STREQ("ipoint{", small.data());
+}
+
 TEST(Point, StreamOperator)
 {
   const cen::ipoint ip{123, 456};
@@ -0,0 +1,98 @@
+#include "math/rect_array.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+TEST(RectArray, Defaults)
+{
+  const cen::rect_array<float> rects;
+  ASSERT_TRUE(rects.empty());
+  ASSERT_EQ(0u, rects.size());
+  ASSERT_EQ(cen::frect{}, rects.bounds());
+}
+
+TEST(RectArray, PushBackAndRemove)
+{
+  cen::rect_array<int> rects;
+
+  rects.push_back({1, 2, 3, 4});
+  rects.push_back({5, 6, 7, 8});
+  rects.push_back({9, 10, 11, 12});
+  ASSERT_EQ(3u, rects.size());
+  ASSERT_EQ(cen::irect(5, 6, 7, 8), rects[1]);
+
+  rects.set(0, {0, 0, 1, 1});
+  ASSERT_EQ(cen::irect(0, 0, 1, 1), rects[0]);
+
+  rects.swap_remove(0);
+  ASSERT_EQ(2u, rects.size());
+  ASSERT_EQ(cen::irect(9, 10, 11, 12), rects[0]);
+
+  rects.clear();
+  ASSERT_TRUE(rects.empty());
+}
+
+TEST(RectArray, Intersects)
+{
+  cen::rect_array<float> rects;
+
+  const cen::frect camera{0, 0, 100, 100};
+  for (int index = 0; index < 21; ++index)
+  {
+    rects.push_back({static_cast<float>(index) * 10.0f, 50, 10, 10});
+  }
+
+  std::vector<cen::u8> results(rects.size());
+  ASSERT_EQ(10u, rects.intersects(camera, results.data()));
+
+  for (std::size_t index = 0; index < rects.size(); ++index)
+  {
+    ASSERT_EQ(cen::intersects(camera, rects[index]), results.at(index) == 1);
+  }
+}
+
+TEST(RectArray, Contains)
+{
+  cen::rect_array<int> rects;
+  rects.push_back({0, 0, 10, 10});
+  rects.push_back({10, 10, 10, 10});
+  rects.push_back({20, 20, 10, 10});
+
+  std::vector<cen::u8> results(rects.size());
+  ASSERT_EQ(2u, rects.contains({10, 10}, results.data()));
+  ASSERT_EQ((std::vector<cen::u8>{1, 1, 0}), results);
+}
+
+TEST(RectArray, Translate)
+{
+  cen::rect_array<float> rects;
+  for (int index = 0; index < 9; ++index)
+  {
+    rects.push_back({static_cast<float>(index), 0, 1, 1});
+  }
+
+  rects.translate(10, 20);
+
+  for (std::size_t index = 0; index < rects.size(); ++index)
+  {
+    ASSERT_EQ(cen::frect(static_cast<float>(index) + 10.0f, 20, 1, 1), rects[index]);
+  }
+}
+
+TEST(RectArray, Bounds)
+{
+  cen::rect_array<float> rects;
+  rects.push_back({10, 10, 10, 10});
+  rects.push_back({-100, -100, 0, 500});  // Without an area
+  rects.push_back({30, -5, 5, 5});
+
+  cen::frect expected;
+  for (std::size_t index = 0; index < rects.size(); ++index)
+  {
+    expected = cen::get_union(expected, rects[index]);
+  }
+
+  ASSERT_EQ(expected, rects.bounds());
+  ASSERT_EQ(cen::frect(10, -5, 25, 25), rects.bounds());
+}
@@ -0,0 +1,137 @@
+#include "math/rect_bvh.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // sort
+#include <vector>     // vector
+
+namespace {
+
+// A deterministic scattering of rectangles of various sizes
+[[nodiscard]] auto make_rects(const int count) -> std::vector<cen::frect>
+{
+  std::vector<cen::frect> rects;
+  cen::u32 state = 12'345;
+
+  const auto next = [&] {
+    state = state * 1'664'525u + 1'013'904'223u;
+    return static_cast<float>(state >> 8u) / static_cast<float>(1u << 24u);
+  };
+
+  for (int index = 0; index < count; ++index)
+  {
+    const auto x = next() * 1'000.0f;
+    const auto y = next() * 500.0f;
+    rects.emplace_back(x, y, next() * 40.0f, next() * 20.0f);
+  }
+
+  return rects;
+}
+
+[[nodiscard]] auto sorted(std::vector<cen::u32> indices) -> std::vector<cen::u32>
+{
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+}  // namespace
+
+TEST(RectBVH, Empty)
+{
+  cen::rect_bvh bvh;
+  ASSERT_TRUE(bvh.empty());
+  ASSERT_EQ(0u, bvh.node_count());
+  ASSERT_EQ(cen::frect{}, bvh.bounds());
+
+  cen::u32 index{};
+  ASSERT_EQ(0u, bvh.query(cen::frect{0, 0, 10, 10}, &index, 1));
+
+  bvh.build(nullptr, 0);
+  ASSERT_TRUE(bvh.empty());
+}
+
+TEST(RectBVH, RangeQueries)
+{
+  const auto rects = make_rects(1'000);
+
+  cen::rect_bvh bvh;
+  bvh.build(rects.data(), rects.size());
+
+  ASSERT_EQ(rects.size(), bvh.size());
+  ASSERT_GT(bvh.node_count(), rects.size() / bvh.leaf_size());
+
+  const std::vector<cen::frect> areas = {{0, 0, 100, 100},
+                                         {500, 200, 250, 50},
+                                         {-50, -50, 10, 10},
+                                         {0, 0, 2'000, 1'000}};
+
+  for (const auto& area : areas)
+  {
+    std::vector<cen::u32> expected;
+    for (cen::u32 index = 0; index < rects.size(); ++index)
+    {
+      if (cen::intersects(area, rects[index]))
+      {
+        expected.push_back(index);
+      }
+    }
+
+    std::vector<cen::u32> result(rects.size());
+    result.resize(bvh.query(area, result.data(), result.size()));
+
+    ASSERT_EQ(expected, sorted(result));
+  }
+}
+
+TEST(RectBVH, PointQueries)
+{
+  const auto rects = make_rects(500);
+
+  cen::rect_array<float> array;
+  for (const auto& rect : rects)
+  {
+    array.push_back(rect);
+  }
+
+  cen::rect_bvh bvh{8};
+  bvh.build(array);
+
+  for (const auto& point : {cen::fpoint{100, 100}, cen::fpoint{rects[42].position()}})
+  {
+    std::vector<cen::u32> expected;
+    for (cen::u32 index = 0; index < rects.size(); ++index)
+    {
+      if (rects[index].contains(point))
+      {
+        expected.push_back(index);
+      }
+    }
+
+    std::vector<cen::u32> result;
+    bvh.visit(point, [&](const cen::u32 index) { result.push_back(index); });
+
+    ASSERT_EQ(expected, sorted(result));
+  }
+}
+
+TEST(RectBVH, Bounds)
+{
+  const std::vector<cen::frect> rects = {{10, 10, 5, 5}, {-10, 0, 2, 2}, {0, 30, 1, 1}};
+
+  cen::rect_bvh bvh{1};
+  bvh.build(rects.data(), rects.size());
+
+  ASSERT_EQ(5u, bvh.node_count());
+  ASSERT_EQ(cen::frect(-10, 0, 25, 31), bvh.bounds());
+}
+
+TEST(RectBVH, Capacity)
+{
+  const std::vector<cen::frect> rects(10, cen::frect{0, 0, 10, 10});
+
+  cen::rect_bvh bvh;
+  bvh.build(rects.data(), rects.size());
+
+  std::vector<cen::u32> buffer(3);
+  ASSERT_EQ(10u, bvh.query(cen::frect{5, 5, 1, 1}, buffer.data(), buffer.size()));
+}
@@ -0,0 +1,121 @@
+#include "math/spatial_hash_grid.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // sort
+#include <array>      // array
+#include <vector>     // vector
+
+namespace {
+
+using grid_type = cen::spatial_hash_grid<float>;
+
+// Mimics the translation viewport of a renderer
+struct fake_renderer final
+{
+  [[nodiscard]] auto translation_viewport() const noexcept -> const cen::frect&
+  {
+    return viewport;
+  }
+
+  cen::frect viewport;
+};
+
+[[nodiscard]] auto query(const grid_type& grid, const cen::frect& area)
+    -> std::vector<grid_type::handle>
+{
+  std::array<grid_type::handle, 16> buffer{};
+  const auto count = grid.query(area, buffer.data(), buffer.size());
+
+  std::vector<grid_type::handle> result(buffer.begin(), buffer.begin() + count);
+  std::sort(result.begin(), result.end());
+
+  return result;
+}
+
+}  // namespace
+
+TEST(SpatialHashGrid, Defaults)
+{
+  const grid_type grid{32};
+  ASSERT_TRUE(grid.empty());
+  ASSERT_EQ(0u, grid.cell_count());
+  ASSERT_FLOAT_EQ(32, grid.cell_size());
+  ASSERT_FALSE(grid.contains(0));
+}
+
+TEST(SpatialHashGrid, InsertAndQuery)
+{
+  grid_type grid{10};
+
+  const auto a = grid.insert({5, 5, 2, 2});
+  const auto b = grid.insert({-15, -15, 30, 30});  // Spans 16 cells
+  const auto c = grid.insert({100, 100, 5, 5});
+
+  ASSERT_EQ(3u, grid.size());
+  ASSERT_EQ(cen::frect(5, 5, 2, 2), grid.get(a));
+
+  ASSERT_EQ((std::vector{a, b}), query(grid, {0, 0, 10, 10}));
+  ASSERT_EQ((std::vector{c}), query(grid, {90, 90, 20, 20}));
+  ASSERT_TRUE(query(grid, {50, 50, 10, 10}).empty());
+
+  // Rectangles that only touch the area aren't reported
+  ASSERT_TRUE(query(grid, {105, 90, 10, 10}).empty());
+
+  // Each rectangle is reported once, even if it's found in several cells
+  ASSERT_EQ((std::vector{a, b}), query(grid, {-20, -20, 40, 40}));
+}
+
+TEST(SpatialHashGrid, Capacity)
+{
+  grid_type grid{10};
+  for (int index = 0; index < 5; ++index)
+  {
+    grid.insert({static_cast<float>(index), 0, 1, 1});
+  }
+
+  std::array<grid_type::handle, 2> buffer{};
+  ASSERT_EQ(5u, grid.query({0, 0, 10, 10}, buffer.data(), buffer.size()));
+}
+
+TEST(SpatialHashGrid, MoveAndRemove)
+{
+  grid_type grid{10};
+
+  const auto a = grid.insert({1, 1, 2, 2});
+  const auto b = grid.insert({2, 2, 2, 2});
+
+  // Within the same cell
+  grid.move(a, {3, 3, 2, 2});
+  ASSERT_EQ(1u, grid.cell_count());
+  ASSERT_EQ(cen::frect(3, 3, 2, 2), grid.get(a));
+
+  // To another cell
+  grid.move(a, {51, 51, 2, 2});
+  ASSERT_EQ(2u, grid.cell_count());
+  ASSERT_EQ((std::vector{b}), query(grid, {0, 0, 10, 10}));
+  ASSERT_EQ((std::vector{a}), query(grid, {50, 50, 10, 10}));
+
+  grid.remove(b);
+  ASSERT_FALSE(grid.contains(b));
+  ASSERT_EQ(1u, grid.size());
+  ASSERT_EQ(1u, grid.cell_count());
+  ASSERT_TRUE(query(grid, {0, 0, 10, 10}).empty());
+
+  // Handles are reused
+  ASSERT_EQ(b, grid.insert({0, 0, 1, 1}));
+}
+
+TEST(SpatialHashGrid, QueryVisible)
+{
+  fake_renderer renderer;
+  renderer.viewport = {95.5f, 0, 10, 10};
+
+  cen::spatial_hash_grid<int> grid{16};
+  const auto visible = grid.insert({90, 5, 6, 1});  // Partially visible
+  grid.insert({120, 5, 6, 1});
+
+  std::array<cen::spatial_hash_grid<int>::handle, 4> buffer{};
+  ASSERT_EQ(1u, grid.query_visible(renderer, buffer.data(), buffer.size()));
+  ASSERT_EQ(visible, buffer.at(0));
+}
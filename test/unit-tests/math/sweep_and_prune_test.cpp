@@ -0,0 +1,148 @@
+#include "math/sweep_and_prune.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // sort
+#include <random>     // mt19937, uniform_real_distribution
+#include <utility>    // pair
+#include <vector>     // vector
+
+namespace {
+
+using broadphase_type = cen::sweep_and_prune<float>;
+using handle_type = broadphase_type::handle;
+using pair_list = std::vector<std::pair<handle_type, handle_type>>;
+
+[[nodiscard]] auto find_pairs(broadphase_type& broadphase) -> pair_list
+{
+  std::vector<broadphase_type::overlap> buffer;
+  const auto count = broadphase.find_pairs(buffer);
+  EXPECT_EQ(count, buffer.size());
+
+  pair_list result;
+  for (const auto& [first, second] : buffer)
+  {
+    EXPECT_LT(first, second);
+    result.emplace_back(first, second);
+  }
+
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+[[nodiscard]] auto brute_force(const broadphase_type& broadphase,
+                               const std::vector<handle_type>& handles)
+    -> pair_list
+{
+  pair_list result;
+  for (const auto a : handles)
+  {
+    for (const auto b : handles)
+    {
+      if (a < b && cen::intersects(broadphase.at(a), broadphase.at(b)))
+      {
+        result.emplace_back(a, b);
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  return result;
+}
+
+}  // namespace
+
+TEST(SweepAndPrune, Defaults)
+{
+  broadphase_type broadphase;
+  ASSERT_TRUE(broadphase.empty());
+  ASSERT_EQ(0u, broadphase.size());
+  ASSERT_FALSE(broadphase.contains(0));
+
+  std::vector<broadphase_type::overlap> pairs(3);
+  ASSERT_EQ(0u, broadphase.find_pairs(pairs));
+  ASSERT_TRUE(pairs.empty());
+}
+
+TEST(SweepAndPrune, Pairs)
+{
+  broadphase_type broadphase;
+
+  const auto a = broadphase.insert({0, 0, 10, 10});
+  const auto b = broadphase.insert({5, 5, 10, 10});
+  const auto c = broadphase.insert({10, 0, 10, 10});  // Only touches a
+  const auto d = broadphase.insert({6, 30, 2, 2});    // Overlaps a and b horizontally
+  ASSERT_EQ(4u, broadphase.size());
+
+  ASSERT_EQ((pair_list{{a, b}, {b, c}}), find_pairs(broadphase));
+
+  broadphase.move(d, {7, 7, 2, 2});
+  ASSERT_EQ((pair_list{{a, b}, {a, d}, {b, c}, {b, d}}), find_pairs(broadphase));
+
+  broadphase.remove(b);
+  ASSERT_FALSE(broadphase.contains(b));
+  ASSERT_EQ((pair_list{{a, d}}), find_pairs(broadphase));
+
+  // The handle is reused once the old endpoints are gone
+  ASSERT_EQ(b, broadphase.insert({15, 5, 1, 1}));
+  ASSERT_EQ((pair_list{{a, d}, {b, c}}), find_pairs(broadphase));
+
+  broadphase.clear();
+  ASSERT_TRUE(broadphase.empty());
+  ASSERT_TRUE(find_pairs(broadphase).empty());
+}
+
+TEST(SweepAndPrune, EmptyRectangles)
+{
+  broadphase_type broadphase;
+
+  const auto a = broadphase.insert({0, 0, 10, 10});
+  const auto b = broadphase.insert({5, 5, 0, 2});  // Inside a, but without width
+  broadphase.insert({5, 5, 0, 2});
+  broadphase.insert({0, 0, 0, 0});
+
+  ASSERT_EQ((pair_list{{a, b}, {a, b + 1}}), find_pairs(broadphase));
+}
+
+TEST(SweepAndPrune, MatchesBruteForce)
+{
+  std::mt19937 engine{42};
+  std::uniform_real_distribution<float> position{0, 500};
+  std::uniform_real_distribution<float> extent{1, 40};
+  std::uniform_real_distribution<float> velocity{-4, 4};
+
+  broadphase_type broadphase;
+  std::vector<handle_type> handles;
+
+  for (int i = 0; i < 300; ++i)
+  {
+    const cen::fpoint pos{position(engine), position(engine)};
+    const cen::farea size{extent(engine), extent(engine)};
+    handles.push_back(broadphase.insert({pos, size}));
+  }
+
+  // Integral coordinates make touching edges and equal endpoints common
+  handles.push_back(broadphase.insert({100, 100, 20, 20}));
+  handles.push_back(broadphase.insert({120, 100, 20, 20}));
+  handles.push_back(broadphase.insert({100, 120, 20, 20}));
+
+  for (int frame = 0; frame < 30; ++frame)
+  {
+    for (const auto id : handles)
+    {
+      auto rect = broadphase.at(id);
+      rect.offset_x(velocity(engine));
+      rect.offset_y(velocity(engine));
+      broadphase.move(id, rect);
+    }
+
+    if (frame % 5 == 4)
+    {
+      broadphase.remove(handles.back());
+      handles.pop_back();
+      handles.push_back(broadphase.insert({position(engine), position(engine), 30, 30}));
+    }
+
+    ASSERT_EQ(brute_force(broadphase, handles), find_pairs(broadphase));
+  }
+}
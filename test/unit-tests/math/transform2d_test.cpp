@@ -0,0 +1,82 @@
+#include "math/transform2d.hpp"
+
+#include <gtest/gtest.h>
+
+#include <iostream>  // cout
+
+TEST(Transform2D, Defaults)
+{
+  constexpr cen::transform2d identity;
+  static_assert(identity.a() == 1 && identity.d() == 1);
+  static_assert(identity.b() == 0 && identity.c() == 0);
+  static_assert(identity.tx() == 0 && identity.ty() == 0);
+
+  ASSERT_EQ(cen::fpoint(12, -3), identity.apply({12, -3}));
+  ASSERT_TRUE(identity.is_invertible());
+}
+
+TEST(Transform2D, Constexpr)
+{
+  constexpr auto transform =
+      cen::transform2d::translation(10, 20) * cen::transform2d::scaling(2, 3);
+  constexpr auto point = transform.apply({1, 1});
+
+  static_assert(point.x() == 12);
+  static_assert(point.y() == 23);
+  static_assert(transform.determinant() == 6);
+}
+
+TEST(Transform2D, Composition)
+{
+  const auto scale = cen::transform2d::scaling(2, 2);
+  const auto move = cen::transform2d::translation(5, 0);
+
+  // The right-hand side transform is applied first
+  ASSERT_EQ(cen::fpoint(7, 2), (move * scale).apply({1, 1}));
+  ASSERT_EQ(cen::fpoint(12, 2), (scale * move).apply({1, 1}));
+}
+
+TEST(Transform2D, ScalingAroundPoint)
+{
+  const auto transform = cen::transform2d::scaling(2, 4, {10, 10});
+  ASSERT_EQ(cen::fpoint(10, 10), transform.apply({10, 10}));
+  ASSERT_EQ(cen::fpoint(12, 14), transform.apply({11, 11}));
+}
+
+TEST(Transform2D, Rotation)
+{
+  // Rotations are clockwise on the screen, where the y-axis points down
+  const auto quarter = cen::transform2d::rotation(90);
+  const auto point = quarter.apply({1, 0});
+  ASSERT_NEAR(0.0f, point.x(), 1e-6f);
+  ASSERT_NEAR(1.0f, point.y(), 1e-6f);
+
+  const auto around = cen::transform2d::rotation(180, {5, 5});
+  const auto rotated = around.apply({6, 5});
+  ASSERT_NEAR(4.0f, rotated.x(), 1e-5f);
+  ASSERT_NEAR(5.0f, rotated.y(), 1e-5f);
+}
+
+TEST(Transform2D, Inverse)
+{
+  const auto transform = cen::transform2d::translation(3, -7) *
+                         cen::transform2d::rotation(30) *
+                         cen::transform2d::scaling(2, 0.5f);
+  const auto inverse = transform.inverse();
+
+  const auto point = inverse.apply(transform.apply({4, 9}));
+  ASSERT_NEAR(4.0f, point.x(), 1e-4f);
+  ASSERT_NEAR(9.0f, point.y(), 1e-4f);
+
+  ASSERT_FALSE(cen::transform2d::scaling(0, 1).is_invertible());
+}
+
+TEST(Transform2D, Alignment)
+{
+  static_assert(alignof(cen::transform2d) == 16);
+}
+
+TEST(Transform2D, ToString)
+{
+  std::cout << cen::transform2d::translation(1, 2) << '\n';
+}
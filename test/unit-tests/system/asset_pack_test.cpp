@@ -0,0 +1,120 @@
+#include "filesystem/asset_pack.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // uintptr_t
+#include <cstring>  // memcmp
+#include <string>   // string, to_string
+
+#include "filesystem/preferred_path.hpp"
+
+class AssetPackTest : public testing::Test
+{
+ protected:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "asset_pack";
+  inline static const auto source = prefs + "asset_pack_source";
+};
+
+TEST_F(AssetPackTest, InvalidAlignment)
+{
+  ASSERT_THROW(cen::asset_pack_writer(path, 0), cen::cen_error);
+  ASSERT_THROW(cen::asset_pack_writer(path, 24), cen::cen_error);
+}
+
+TEST_F(AssetPackTest, WriteAndRead)
+{
+  {
+    cen::file file{source, cen::file_mode::write_binary};
+    ASSERT_TRUE(file);
+    ASSERT_EQ(6u, file.write("hello"));
+  }
+
+  {
+    cen::asset_pack_writer writer{path, 64};
+
+    for (int index = 0; index < 100; ++index)
+    {
+      const auto value = std::to_string(index);
+      ASSERT_TRUE(writer.add("numbers/" + value, value.data(), value.size()));
+    }
+
+    ASSERT_TRUE(writer.add_file("greeting", source));
+    ASSERT_TRUE(writer.add("empty", nullptr, 0));
+
+    ASSERT_FALSE(writer.add("greeting", "x", 1));  // Duplicate names are rejected
+    ASSERT_FALSE(writer.add_file("missing", prefs + "asset_pack_missing"));
+
+    ASSERT_EQ(102u, writer.size());
+    ASSERT_TRUE(writer.finish());
+
+    ASSERT_FALSE(writer.add("late", "x", 1));
+    ASSERT_FALSE(writer.finish());
+  }
+
+  const cen::asset_pack pack{path};
+  ASSERT_EQ(102u, pack.size());
+  ASSERT_FALSE(pack.empty());
+
+  for (int index = 0; index < 100; ++index)
+  {
+    const auto value = std::to_string(index);
+    const auto entry = pack.find("numbers/" + value);
+    ASSERT_TRUE(entry);
+    ASSERT_EQ("numbers/" + value, entry->name);
+    ASSERT_EQ(value.size(), entry->size);
+    ASSERT_EQ(0, std::memcmp(value.data(), entry->data, value.size()));
+
+    // The entries are aligned within the file
+    ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(entry->data) % 64u);
+  }
+
+  ASSERT_TRUE(pack.contains("empty"));
+  ASSERT_EQ(0u, pack.find("empty")->size);
+
+  ASSERT_FALSE(pack.contains("numbers/100"));
+  ASSERT_FALSE(pack.find("numbers"));
+
+  auto greeting = pack.open("greeting");
+  ASSERT_EQ(6u, greeting.size());
+
+  char buffer[6]{};
+  ASSERT_EQ(6u, greeting.read_to(buffer));
+  ASSERT_STREQ("hello", buffer);
+
+  ASSERT_THROW((void) pack.open("missing"), cen::cen_error);
+}
+
+TEST_F(AssetPackTest, EmptyPack)
+{
+  {
+    cen::asset_pack_writer writer{path};
+  }
+
+  const cen::asset_pack pack{path};
+  ASSERT_TRUE(pack.empty());
+  ASSERT_FALSE(pack.contains("foo"));
+}
+
+TEST_F(AssetPackTest, FromMappedFile)
+{
+  {
+    cen::asset_pack_writer writer{path};
+    ASSERT_TRUE(writer.add("greeting", "hello", 6));
+  }
+
+  const cen::asset_pack pack{cen::mapped_file{path}};
+  ASSERT_EQ(1u, pack.size());
+  ASSERT_TRUE(pack.contains("greeting"));
+}
+
+TEST_F(AssetPackTest, InvalidPack)
+{
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_TRUE(file);
+    ASSERT_EQ(36u, file.write("This is not an asset pack, at all!!"));
+  }
+
+  ASSERT_THROW(cen::asset_pack{path}, cen::cen_error);
+}
@@ -0,0 +1,134 @@
+#include "filesystem/async_file_io.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // byte
+#include <string>   // string, to_string
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "filesystem/preferred_path.hpp"
+#include "thread/thread.hpp"
+
+namespace {
+
+// Polls the service until the specified amount of completions have been received
+auto wait_for(cen::async_file_io& io, const std::size_t count)
+    -> std::vector<cen::file_completion>
+{
+  std::vector<cen::file_completion> completions;
+  while (completions.size() < count)
+  {
+    io.poll([&](cen::file_completion& completion) {
+      completions.push_back(std::move(completion));
+    });
+
+    cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+  }
+
+  return completions;
+}
+
+auto make_bytes(const std::size_t count) -> std::vector<std::byte>
+{
+  std::vector<std::byte> bytes(count);
+  for (std::size_t index = 0; index < count; ++index)
+  {
+    bytes[index] = static_cast<std::byte>(index * 7u);
+  }
+
+  return bytes;
+}
+
+}  // namespace
+
+class AsyncFileIOTest : public testing::Test
+{
+ protected:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "async_file_io";
+};
+
+TEST_F(AsyncFileIOTest, WriteAndRead)
+{
+  cen::thread_pool pool{2};
+  cen::async_file_io io{pool};
+
+  const auto bytes = make_bytes(100'000);
+
+  const auto writeId = io.write(path, bytes);
+  {
+    const auto completions = wait_for(io, 1);
+    ASSERT_EQ(writeId, completions.at(0).id);
+    ASSERT_EQ(cen::file_operation::write, completions.at(0).operation);
+    ASSERT_TRUE(completions.at(0).succeeded);
+    ASSERT_EQ(path, completions.at(0).path);
+
+    // The written buffer is handed back
+    ASSERT_EQ(bytes, completions.at(0).data);
+  }
+
+  const auto appendId = io.append(path, make_bytes(10));
+  ASSERT_NE(writeId, appendId);
+  ASSERT_TRUE(wait_for(io, 1).at(0).succeeded);
+
+  const auto readId = io.read(path);
+  {
+    const auto completions = wait_for(io, 1);
+    ASSERT_EQ(readId, completions.at(0).id);
+    ASSERT_EQ(cen::file_operation::read, completions.at(0).operation);
+    ASSERT_TRUE(completions.at(0).succeeded);
+
+    auto expected = bytes;
+    const auto appended = make_bytes(10);
+    expected.insert(expected.end(), appended.begin(), appended.end());
+    ASSERT_EQ(expected, completions.at(0).data);
+  }
+
+  ASSERT_EQ(0u, io.pending());
+}
+
+TEST_F(AsyncFileIOTest, Failure)
+{
+  cen::thread_pool pool{1};
+  cen::async_file_io io{pool};
+
+  io.read(prefs + "async_file_io_missing");
+
+  const auto completions = wait_for(io, 1);
+  ASSERT_FALSE(completions.at(0).succeeded);
+  ASSERT_TRUE(completions.at(0).data.empty());
+}
+
+TEST_F(AsyncFileIOTest, FullChannel)
+{
+  cen::thread_pool pool{2};
+  cen::async_file_io io{pool, 2};
+
+  // The workers have to wait for the completions to be received
+  for (int index = 0; index < 8; ++index)
+  {
+    io.write(path + std::to_string(index), make_bytes(16));
+  }
+
+  const auto completions = wait_for(io, 8);
+  for (const auto& completion : completions)
+  {
+    ASSERT_TRUE(completion.succeeded);
+  }
+}
+
+TEST_F(AsyncFileIOTest, DestroyWithPendingOperations)
+{
+  cen::thread_pool pool{1};
+
+  {
+    cen::async_file_io io{pool, 2};
+    for (int index = 0; index < 8; ++index)
+    {
+      io.write(path + std::to_string(index), make_bytes(16));
+    }
+  }
+
+  pool.wait_idle();
+}
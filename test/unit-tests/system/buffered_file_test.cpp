@@ -0,0 +1,151 @@
+#include "filesystem/buffered_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <vector>  // vector
+
+#include "filesystem/preferred_path.hpp"
+#include "math/point.hpp"
+#include "math/rect.hpp"
+#include "video/color.hpp"
+
+using namespace cen::literals;
+
+class BufferedFileTest : public testing::Test
+{
+ public:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "buffered_file";
+};
+
+TEST_F(BufferedFileTest, InvalidBufferSize)
+{
+  cen::file file{path, cen::file_mode::read_write_replace_binary};
+  ASSERT_TRUE(file);
+
+  ASSERT_THROW(cen::buffered_reader(file, 7), cen::cen_error);
+  ASSERT_THROW(cen::buffered_writer(file, 7), cen::cen_error);
+}
+
+TEST_F(BufferedFileTest, WriteAndRead)
+{
+  {
+    cen::file file{path, cen::file_mode::read_write_replace_binary};
+    ASSERT_TRUE(file);
+
+    cen::buffered_writer writer{file, 16};
+    ASSERT_EQ(16u, writer.buffer_size());
+
+    ASSERT_TRUE(writer.write_byte(42u));
+    ASSERT_EQ(1u, writer.pending());
+
+    ASSERT_TRUE(writer.write_as_big_endian(12_u16));
+    ASSERT_TRUE(writer.write_as_big_endian(34_u32));
+    ASSERT_TRUE(writer.write_as_big_endian(56_u64));
+
+    ASSERT_TRUE(writer.write_as_little_endian(78_u16));
+    ASSERT_TRUE(writer.write_as_little_endian(90_u32));
+    ASSERT_TRUE(writer.write_as_little_endian(123_u64));
+
+    // Larger than the buffer, so this is written directly
+    std::array<int, 8> values{1, 2, 3, 4, 5, 6, 7, 8};
+    ASSERT_TRUE(writer.write_bytes(values.data(), sizeof values));
+    ASSERT_EQ(0u, writer.pending());
+
+    ASSERT_TRUE(writer.write(3.5f));
+    ASSERT_TRUE(writer.flush());
+    ASSERT_EQ(0u, writer.pending());
+  }
+
+  {
+    cen::file file{path, cen::file_mode::read_existing_binary};
+    ASSERT_TRUE(file);
+
+    cen::buffered_reader reader{file, 16};
+    ASSERT_EQ(16u, reader.buffer_size());
+
+    ASSERT_EQ(42u, reader.read_byte());
+    ASSERT_EQ(1, reader.offset());
+
+    ASSERT_EQ(12u, reader.read_big_endian_u16());
+    ASSERT_EQ(34u, reader.read_big_endian_u32());
+    ASSERT_EQ(56u, reader.read_big_endian_u64());
+
+    ASSERT_EQ(78u, reader.read_little_endian_u16());
+    ASSERT_EQ(90u, reader.read_little_endian_u32());
+    ASSERT_EQ(123u, reader.read_little_endian_u64());
+
+    std::array<int, 8> values{};
+    ASSERT_EQ(sizeof values, reader.read_bytes(values.data(), sizeof values));
+    ASSERT_EQ(1, values.front());
+    ASSERT_EQ(8, values.back());
+
+    ASSERT_EQ(3.5f, reader.read<float>());
+    ASSERT_FALSE(reader.eof());
+
+    ASSERT_EQ(0u, reader.read_little_endian_u32());
+    ASSERT_TRUE(reader.eof());
+
+    // Seeking back into, and before, the buffered block
+    ASSERT_EQ(1, reader.seek(1, cen::seek_mode::from_beginning));
+    ASSERT_FALSE(reader.eof());
+    ASSERT_EQ(12u, reader.read_big_endian_u16());
+
+    ASSERT_EQ(7, reader.seek(4, cen::seek_mode::relative_to_current));
+    ASSERT_EQ(56u, reader.read_big_endian_u64());
+  }
+}
+
+TEST_F(BufferedFileTest, WriteAndReadComponents)
+{
+  std::vector<cen::fpoint> points(100);
+  for (std::size_t index = 0; index < points.size(); ++index)
+  {
+    points[index] = {static_cast<float>(index), -static_cast<float>(index) * 0.5f};
+  }
+
+  const std::vector<cen::irect> rects{{1, 2, 3, 4}, {-5, 6, 7, 8}};
+  const std::vector<cen::color> colors{{10, 20, 30, 40}, {50, 60, 70, 80}};
+
+  {
+    cen::file file{path, cen::file_mode::read_write_replace_binary};
+    ASSERT_TRUE(file);
+
+    // The buffer is smaller than the points, which are swapped in several blocks
+    cen::buffered_writer writer{file, 60};
+    ASSERT_TRUE(writer.write_as_big_endian(rects));
+    ASSERT_TRUE(writer.write_as_big_endian(points));
+    ASSERT_TRUE(writer.write_as_little_endian(colors));
+    ASSERT_TRUE(writer.write_as_little_endian(points.data(), 3));
+  }
+
+  {
+    cen::file file{path, cen::file_mode::read_existing_binary};
+    ASSERT_TRUE(file);
+
+    cen::buffered_reader reader{file, 16};
+
+    // The first value of the file is the x-coordinate of the first rectangle
+    ASSERT_EQ(1u, reader.read_big_endian_u32());
+    ASSERT_EQ(0, reader.seek(0, cen::seek_mode::from_beginning));
+
+    std::vector<cen::irect> readRects(rects.size());
+    ASSERT_EQ(rects.size(), reader.read_big_endian_to(readRects));
+    ASSERT_EQ(rects, readRects);
+
+    std::vector<cen::fpoint> readPoints(points.size());
+    ASSERT_EQ(points.size(), reader.read_big_endian_to(readPoints));
+    ASSERT_EQ(points, readPoints);
+
+    std::vector<cen::color> readColors(colors.size());
+    ASSERT_EQ(colors.size(), reader.read_little_endian_to(readColors));
+    ASSERT_EQ(colors, readColors);
+
+    // Only three points are left
+    std::vector<cen::fpoint> tail(5);
+    ASSERT_EQ(3u, reader.read_little_endian_to(tail));
+    ASSERT_EQ(points[2], tail[2]);
+    ASSERT_TRUE(reader.eof());
+  }
+}
@@ -2,6 +2,12 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>  // vector
+
+#include "math/point.hpp"
+#include "math/rect.hpp"
+#include "video/color.hpp"
+
 using namespace cen::literals;
 
 TEST(SwapByteOrder, U16)
@@ -74,4 +80,71 @@ TEST(SwapLittleEndian, Float)
 {
   const auto source = 123.4f;
   ASSERT_EQ(SDL_SwapFloatLE(source), cen::swap_little_endian(source));
-}
\ No newline at end of file
+}
+
+TEST(SwapByteOrder, Bulk)
+{
+  std::vector<cen::u32> values(1'027);
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    values[index] = static_cast<cen::u32>(index * 2'654'435'761u);
+  }
+
+  auto swapped = values;
+  cen::swap_byte_order(swapped.data(), swapped.size());
+
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    ASSERT_EQ(SDL_Swap32(values[index]), swapped[index]);
+  }
+}
+
+TEST(SwapBigEndian, Bulk)
+{
+  std::vector<cen::u16> values{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto swapped = values;
+  cen::swap_big_endian(swapped.data(), swapped.size());
+
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    ASSERT_EQ(SDL_SwapBE16(values[index]), swapped[index]);
+  }
+}
+
+TEST(SwapLittleEndian, Bulk)
+{
+  std::vector<cen::u64> values{1, 2, 3, 4, 5};
+
+  auto swapped = values;
+  cen::swap_little_endian(swapped.data(), swapped.size());
+
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    ASSERT_EQ(SDL_SwapLE64(values[index]), swapped[index]);
+  }
+}
+
+TEST(SwapByteOrder, Components)
+{
+  std::vector<cen::irect> rects{{1, 2, 3, 4}, {5, 6, 7, 8}};
+  cen::swap_byte_order(rects.data(), rects.size());
+
+  const auto swap = [](const int value) {
+    return static_cast<int>(SDL_Swap32(static_cast<cen::u32>(value)));
+  };
+
+  ASSERT_EQ(swap(1), rects[0].x());
+  ASSERT_EQ(swap(4), rects[0].height());
+  ASSERT_EQ(swap(8), rects[1].height());
+
+  std::vector<cen::fpoint> points{{1.5f, -2.0f}};
+  cen::swap_byte_order(points.data(), points.size());
+  ASSERT_EQ(SDL_SwapFloat(1.5f), points[0].x());
+  ASSERT_EQ(SDL_SwapFloat(-2.0f), points[0].y());
+
+  // The components of colors are single bytes
+  std::vector<cen::color> colors{{1, 2, 3, 4}};
+  cen::swap_byte_order(colors.data(), colors.size());
+  ASSERT_EQ(cen::color(1, 2, 3, 4), colors[0]);
+}
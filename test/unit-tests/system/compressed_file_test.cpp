@@ -0,0 +1,122 @@
+#include "filesystem/compressed_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "filesystem/preferred_path.hpp"
+
+class CompressedFileTest : public testing::Test
+{
+ protected:
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "compressed_file";
+};
+
+TEST_F(CompressedFileTest, WriteAndRead)
+{
+  std::vector<cen::u32> values(100'000);
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    values[index] = static_cast<cen::u32>(index / 16u);
+  }
+
+  {
+    auto file = cen::make_compressed_writer({path, cen::file_mode::write_binary}, 4'096);
+    ASSERT_TRUE(file);
+
+    ASSERT_TRUE(file.write_as_big_endian(cen::u16{0xCAFE}));
+    ASSERT_EQ(values.size(), file.write_as_little_endian(values));
+    ASSERT_EQ(static_cast<cen::i64>(2u + values.size() * 4u), file.offset());
+
+    ASSERT_EQ(0u, file.read_byte());
+    ASSERT_FALSE(file.seek(0, cen::seek_mode::from_beginning));
+  }
+
+  // The repetitive values compress well
+  const cen::file raw{path, cen::file_mode::read_existing_binary};
+  ASSERT_LT(raw.size().value(), values.size());
+
+  auto file = cen::make_compressed_reader({path, cen::file_mode::read_existing_binary});
+  ASSERT_TRUE(file);
+
+  ASSERT_EQ(0xCAFE, file.read_big_endian_u16());
+
+  std::vector<cen::u32> result(values.size());
+  ASSERT_EQ(result.size(), file.read_little_endian_to(result));
+  ASSERT_EQ(values, result);
+
+  // There is nothing left to read
+  ASSERT_EQ(0u, file.read_to(result));
+  ASSERT_FALSE(file.write_byte(42));
+
+  // Seeking decompresses the data up to the new offset
+  ASSERT_EQ(2 + 4 * 50'000, file.seek(2 + 4 * 50'000, cen::seek_mode::from_beginning));
+  ASSERT_EQ(values[50'000], file.read_little_endian_u32());
+
+  ASSERT_EQ(6 + 4 * 10, file.seek(6 + 4 * 10, cen::seek_mode::from_beginning));
+  ASSERT_EQ(values[11], file.read_little_endian_u32());
+
+  ASSERT_EQ(2 + 4 * 20, file.seek(4 * 8, cen::seek_mode::relative_to_current));
+  ASSERT_EQ(values[20], file.read_little_endian_u32());
+
+  ASSERT_FALSE(file.seek(0, cen::seek_mode::relative_to_end));
+}
+
+TEST_F(CompressedFileTest, SeekBackwardWithinBlock)
+{
+  std::vector<cen::u32> values(1'000);
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    values[index] = static_cast<cen::u32>(index);
+  }
+
+  {
+    auto file = cen::make_compressed_writer({path, cen::file_mode::write_binary}, 4'096);
+    ASSERT_TRUE(file);
+    ASSERT_EQ(values.size(), file.write_as_little_endian(values));
+  }
+
+  auto file = cen::make_compressed_reader({path, cen::file_mode::read_existing_binary});
+  ASSERT_TRUE(file);
+
+  ASSERT_EQ(4 * 500, file.seek(4 * 500, cen::seek_mode::from_beginning));
+  ASSERT_EQ(values[500], file.read_little_endian_u32());
+
+  // Both offsets are in the first block, which doesn't have to be decoded again
+  ASSERT_EQ(4 * 100, file.seek(4 * 100, cen::seek_mode::from_beginning));
+  ASSERT_EQ(4 * 100, file.offset());
+  ASSERT_EQ(values[100], file.read_little_endian_u32());
+
+  ASSERT_EQ(4 * 51, file.seek(-4 * 50, cen::seek_mode::relative_to_current));
+  ASSERT_EQ(values[51], file.read_little_endian_u32());
+  ASSERT_EQ(values[52], file.read_little_endian_u32());
+}
+
+TEST_F(CompressedFileTest, Empty)
+{
+  {
+    auto file = cen::make_compressed_writer({path, cen::file_mode::write_binary});
+    ASSERT_TRUE(file);
+  }
+
+  auto file = cen::make_compressed_reader({path, cen::file_mode::read_existing_binary});
+  ASSERT_TRUE(file);
+  ASSERT_EQ(0u, file.read_byte());
+  ASSERT_EQ(0, file.offset());
+}
+
+TEST_F(CompressedFileTest, InvalidFiles)
+{
+  ASSERT_FALSE(cen::make_compressed_writer(cen::file{nullptr}));
+  ASSERT_FALSE(cen::make_compressed_writer({path, cen::file_mode::write_binary}, 0));
+  ASSERT_FALSE(cen::make_compressed_reader(cen::file{nullptr}));
+
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_TRUE(file);
+    ASSERT_TRUE(file.write_as_little_endian(cen::u64{42}));
+  }
+
+  ASSERT_FALSE(cen::make_compressed_reader({path, cen::file_mode::read_existing_binary}));
+}
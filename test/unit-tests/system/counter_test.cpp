@@ -21,3 +21,26 @@ TEST(Counter, Ticks)
 {
   ASSERT_NO_THROW(cen::counter::ticks());
 }
+
+TEST(Counter, Monotonic)
+{
+  const auto first = cen::counter::monotonic();
+  const auto second = cen::counter::monotonic();
+  ASSERT_LE(first, second);
+}
+
+TEST(Counter, MonotonicUsesTsc)
+{
+  [[maybe_unused]] const auto uses = cen::counter::monotonic_uses_tsc();
+}
+
+TEST(Counter, CounterToNanoseconds)
+{
+  ASSERT_EQ(0u, cen::detail::counter_to_nanoseconds(123, 0));
+  ASSERT_EQ(1'500'000'000u, cen::detail::counter_to_nanoseconds(15'000'000, 10'000'000));
+
+  // Large values must not overflow in the intermediate multiplication
+  const cen::u64 day = cen::u64{86'400} * 10'000'000u;
+  ASSERT_EQ(cen::u64{400} * 86'400'000'000'000u,
+            cen::detail::counter_to_nanoseconds(400u * day, 10'000'000));
+}
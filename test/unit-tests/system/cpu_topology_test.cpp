@@ -0,0 +1,86 @@
+#include "system/cpu_topology.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(CoreMask, Defaults)
+{
+  constexpr cen::core_mask mask;
+  static_assert(mask.empty());
+  static_assert(mask.count() == 0);
+  static_assert(mask.bits() == 0);
+}
+
+TEST(CoreMask, SetAndReset)
+{
+  auto mask = cen::core_mask::single(3);
+  ASSERT_TRUE(mask.test(3));
+  ASSERT_FALSE(mask.test(2));
+  ASSERT_EQ(1, mask.count());
+
+  mask.set(5);
+  ASSERT_EQ(0b101000u, mask.bits());
+  ASSERT_EQ(2, mask.count());
+
+  mask.reset(3);
+  ASSERT_EQ(cen::core_mask::single(5), mask);
+
+  // Out of range indices are ignored
+  mask.set(-1);
+  mask.set(cen::core_mask::max_cores);
+  ASSERT_EQ(cen::core_mask::single(5), mask);
+  ASSERT_FALSE(mask.test(cen::core_mask::max_cores));
+  ASSERT_TRUE(cen::core_mask::single(64).empty());
+}
+
+TEST(CoreMask, Operators)
+{
+  const auto a = cen::core_mask{0b0110u};
+  const auto b = cen::core_mask{0b0011u};
+
+  ASSERT_EQ(cen::core_mask{0b0111u}, a | b);
+  ASSERT_EQ(cen::core_mask{0b0010u}, a & b);
+  ASSERT_NE(a, b);
+}
+
+TEST(CoreMask, All)
+{
+  const auto all = cen::core_mask::all();
+  ASSERT_EQ(cen::cpu::cores(), all.count());
+  ASSERT_TRUE(all.test(0));
+}
+
+TEST(CPUTopology, Query)
+{
+  const auto topology = cen::cpu_topology::query();
+
+  ASSERT_EQ(cen::cpu::cores(), topology.logical_cores());
+  ASSERT_GE(topology.physical_cores(), 1);
+  ASSERT_LE(topology.physical_cores(), topology.logical_cores());
+  ASSERT_GE(topology.packages(), 1);
+  ASSERT_LE(topology.packages(), topology.physical_cores());
+
+  // Every logical core belongs to exactly one physical core
+  cen::core_mask covered;
+  for (int physical = 0; physical < topology.physical_cores(); ++physical)
+  {
+    const auto siblings = topology.siblings(physical);
+    ASSERT_FALSE(siblings.empty());
+    ASSERT_TRUE((covered & siblings).empty());
+
+    covered = covered | siblings;
+  }
+
+  ASSERT_EQ(cen::core_mask::all(), covered);
+
+  for (int logical = 0; logical < topology.logical_cores(); ++logical)
+  {
+    const auto physical = topology.physical_core(logical);
+    ASSERT_TRUE(topology.siblings(physical).test(logical));
+  }
+
+  ASSERT_EQ(topology.physical_cores(), topology.one_per_physical_core().count());
+
+  ASSERT_THROW((void) topology.physical_core(-1), cen::cen_error);
+  ASSERT_THROW((void) topology.physical_core(topology.logical_cores()), cen::cen_error);
+  ASSERT_THROW((void) topology.siblings(topology.physical_cores()), cen::cen_error);
+}
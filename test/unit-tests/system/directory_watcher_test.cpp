@@ -0,0 +1,124 @@
+#include "filesystem/directory_watcher.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>  // remove
+#include <string>  // string
+#include <vector>  // vector
+
+#include "filesystem/file.hpp"
+#include "filesystem/preferred_path.hpp"
+
+namespace {
+
+using namespace cen::literals;
+
+void write_file(const std::string& path)
+{
+  cen::file file{path, cen::file_mode::write_binary};
+  ASSERT_TRUE(file);
+  ASSERT_TRUE(file.write("centurion"));
+}
+
+auto collect(cen::directory_watcher& watcher, const cen::milliseconds<cen::u32> now)
+    -> std::vector<cen::file_change>
+{
+  std::vector<cen::file_change> changes;
+
+  watcher.update(now);
+  watcher.channel().drain(
+      [&](cen::file_change& change) { changes.push_back(std::move(change)); });
+
+  return changes;
+}
+
+}  // namespace
+
+TEST(DirectoryWatcher, Constructor)
+{
+  ASSERT_THROW(cen::directory_watcher{"foobar/"}, cen::cen_error);
+
+  const auto dir = cen::preferred_path("centurion", "watcher").copy();
+  ASSERT_NO_THROW(cen::directory_watcher{dir});
+}
+
+TEST(DirectoryWatcher, Changes)
+{
+  const auto dir = cen::preferred_path("centurion", "watcher").copy();
+  const auto path = dir + "changes.txt";
+  std::remove(path.c_str());
+
+  cen::directory_watcher watcher{dir, false, 50_ms};
+  ASSERT_EQ(dir, watcher.directory());
+
+  write_file(path);
+
+  // The change hasn't settled yet
+  ASSERT_TRUE(collect(watcher, 1'000_ms).empty());
+  ASSERT_EQ(1u, watcher.pending());
+  ASSERT_TRUE(collect(watcher, 1'040_ms).empty());
+
+  {
+    const auto changes = collect(watcher, 1'050_ms);
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(path, changes.at(0).path);
+    ASSERT_EQ(cen::file_change_type::created, changes.at(0).type);
+    ASSERT_EQ(0u, watcher.pending());
+  }
+
+  write_file(path);
+
+  {
+    ASSERT_TRUE(collect(watcher, 2'000_ms).empty());
+
+    const auto changes = collect(watcher, 2'100_ms);
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(cen::file_change_type::modified, changes.at(0).type);
+  }
+
+  ASSERT_EQ(0, std::remove(path.c_str()));
+
+  {
+    ASSERT_TRUE(collect(watcher, 3'000_ms).empty());
+
+    const auto changes = collect(watcher, 3'100_ms);
+    ASSERT_EQ(1u, changes.size());
+    ASSERT_EQ(path, changes.at(0).path);
+    ASSERT_EQ(cen::file_change_type::removed, changes.at(0).type);
+  }
+}
+
+TEST(DirectoryWatcher, TemporaryFile)
+{
+  const auto dir = cen::preferred_path("centurion", "watcher").copy();
+  const auto path = dir + "temporary.txt";
+
+  cen::directory_watcher watcher{dir, false, 50_ms};
+
+  write_file(path);
+  ASSERT_TRUE(collect(watcher, 1'000_ms).empty());
+
+  ASSERT_EQ(0, std::remove(path.c_str()));
+  ASSERT_TRUE(collect(watcher, 1'010_ms).empty());
+
+  ASSERT_EQ(0u, watcher.pending());
+  ASSERT_TRUE(collect(watcher, 2'000_ms).empty());
+}
+
+TEST(DirectoryWatcher, Poll)
+{
+  const auto dir = cen::preferred_path("centurion", "watcher").copy();
+  const auto path = dir + "poll.txt";
+
+  cen::directory_watcher watcher{dir, false, 0_ms};
+
+  write_file(path);
+
+  std::vector<std::string> paths;
+  watcher.poll([&](const cen::file_change& change) { paths.push_back(change.path); });
+
+  ASSERT_EQ(1u, paths.size());
+  ASSERT_EQ(path, paths.at(0));
+
+  std::remove(path.c_str());
+}
@@ -2,10 +2,13 @@
 
 #include <gtest/gtest.h>
 
-#include <array>   // array
-#include <vector>  // vector
+#include <algorithm>  // equal
+#include <array>      // array
+#include <vector>     // vector
 
 #include "filesystem/preferred_path.hpp"
+#include "math/area.hpp"
+#include "math/rect.hpp"
 
 using namespace cen::literals;
 
@@ -97,6 +100,88 @@ TEST_F(FileTest, WriteAndRead)
   }
 }
 
+TEST_F(FileTest, BulkEndianWriteAndRead)
+{
+  std::vector<cen::u32> values(1'500);
+  for (std::size_t index = 0; index < values.size(); ++index)
+  {
+    values[index] = static_cast<cen::u32>(index * 2'654'435'761u);
+  }
+
+  const cen::u16 shorts[] = {1u, 2u, 3u};
+
+  {
+    cen::file file{path, cen::file_mode::read_write_replace_binary};
+    ASSERT_TRUE(file);
+
+    ASSERT_EQ(values.size(), file.write_as_big_endian(values));
+    ASSERT_EQ(values.size(), file.write_as_little_endian(values.data(), values.size()));
+    ASSERT_EQ(3u, file.write_as_big_endian(shorts));
+  }
+
+  {
+    cen::file file{path, cen::file_mode::read_existing_binary};
+    ASSERT_TRUE(file);
+
+    // The first values are compared with the scalar functions
+    ASSERT_EQ(values.at(0), file.read_big_endian_u32());
+    ASSERT_EQ(values.at(1), file.read_big_endian_u32());
+
+    std::vector<cen::u32> big(values.size() - 2u);
+    ASSERT_EQ(big.size(), file.read_big_endian_to(big));
+    ASSERT_TRUE(std::equal(big.begin(), big.end(), values.begin() + 2));
+
+    std::vector<cen::u32> little(values.size());
+    ASSERT_EQ(little.size(), file.read_little_endian_to(little.data(), little.size()));
+    ASSERT_EQ(values, little);
+
+    cen::u16 result[3]{};
+    ASSERT_EQ(3u, file.read_big_endian_to(result));
+    ASSERT_EQ(1u, result[0]);
+    ASSERT_EQ(3u, result[2]);
+
+    ASSERT_EQ(0u, file.read_big_endian_to(result));
+  }
+}
+
+TEST_F(FileTest, BulkComponentWriteAndRead)
+{
+  std::vector<cen::frect> rects(700);
+  for (std::size_t index = 0; index < rects.size(); ++index)
+  {
+    const auto value = static_cast<float>(index);
+    rects[index] = {value, -value, value * 0.5f, 2.0f};
+  }
+
+  const cen::iarea areas[] = {{640, 480}, {1920, 1080}};
+
+  {
+    cen::file file{path, cen::file_mode::read_write_replace_binary};
+    ASSERT_TRUE(file);
+
+    ASSERT_EQ(rects.size(), file.write_as_big_endian(rects));
+    ASSERT_EQ(2u, file.write_as_little_endian(areas));
+  }
+
+  {
+    cen::file file{path, cen::file_mode::read_existing_binary};
+    ASSERT_TRUE(file);
+
+    std::vector<cen::frect> readRects(rects.size());
+    ASSERT_EQ(rects.size(), file.read_big_endian_to(readRects));
+    ASSERT_EQ(rects, readRects);
+
+    // The areas are stored as little endian components, i.e. width before height
+    ASSERT_EQ(640u, file.read_little_endian_u32());
+    ASSERT_EQ(480u, file.read_little_endian_u32());
+
+    cen::iarea area{};
+    ASSERT_EQ(1u, file.read_little_endian_to(&area, 1));
+    ASSERT_EQ(1920, area.width);
+    ASSERT_EQ(1080, area.height);
+  }
+}
+
 TEST_F(FileTest, Queries)
 {
   const cen::file file{path, cen::file_mode::read_existing_binary};
@@ -105,6 +190,36 @@ TEST_F(FileTest, Queries)
   ASSERT_EQ(file.get()->type, static_cast<cen::u32>(file.type()));
 }
 
+TEST_F(FileTest, FromMemory)
+{
+  const char data[] = {1, 2, 3, 4, 5, 6, 7, 8};
+
+  auto file = cen::file::from_memory(data, sizeof data);
+  ASSERT_TRUE(file);
+  ASSERT_EQ(cen::file_type::memory_ro, file.type());
+  ASSERT_EQ(sizeof data, file.size());
+
+  ASSERT_EQ(1u, file.read_byte());
+  ASSERT_EQ(0x0504'0302u, file.read_little_endian_u32());
+
+  // The memory is read-only
+  ASSERT_FALSE(file.write_byte(42));
+}
+
+TEST_F(FileTest, Release)
+{
+  const char data[] = {1, 2, 3, 4};
+
+  auto file = cen::file::from_memory(data, sizeof data);
+  auto* context = file.get();
+
+  auto* released = file.release();
+  ASSERT_EQ(context, released);
+  ASSERT_FALSE(file);
+
+  SDL_RWclose(released);
+}
+
 TEST_F(FileTest, IsPNG)
 {
   cen::file file{"resources/panda.png", cen::file_mode::read_existing};
@@ -113,6 +228,19 @@ TEST_F(FileTest, IsPNG)
   ASSERT_TRUE(file.is_png());
 }
 
+TEST_F(FileTest, Probe)
+{
+  cen::file file{"resources/panda.png", cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  ASSERT_EQ(cen::image_format::png, file.probe());
+  ASSERT_EQ(0, file.offset());
+
+  cen::file other{"resources/click.wav", cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(other);
+  ASSERT_EQ(cen::image_format::unknown, other.probe());
+}
+
 TEST_F(FileTest, SeekModeEnum)
 {
   ASSERT_EQ(RW_SEEK_SET, static_cast<int>(cen::seek_mode::from_beginning));
@@ -0,0 +1,66 @@
+#include "system/frame_pacer.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(FramePacer, Defaults)
+{
+  const cen::frame_pacer pacer;
+  ASSERT_EQ(0.0, pacer.target_rate());
+  ASSERT_EQ(0.0, pacer.period().count());
+  ASSERT_EQ(0u, pacer.missed_deadlines());
+}
+
+TEST(FramePacer, InvalidRate)
+{
+  ASSERT_THROW(cen::frame_pacer{-1}, cen::cen_error);
+
+  cen::frame_pacer pacer;
+  ASSERT_THROW(pacer.set_target_rate(-30), cen::cen_error);
+}
+
+TEST(FramePacer, Unlimited)
+{
+  cen::frame_pacer pacer;
+  ASSERT_FALSE(pacer.wait());
+  ASSERT_FALSE(pacer.wait());
+  ASSERT_EQ(0u, pacer.missed_deadlines());
+}
+
+TEST(FramePacer, SetTargetRate)
+{
+  cen::frame_pacer pacer;
+
+  pacer.set_target_rate(50);
+  ASSERT_EQ(50.0, pacer.target_rate());
+  ASSERT_NEAR(0.02, pacer.period().count(), 1e-6);
+}
+
+TEST(FramePacer, Wait)
+{
+  cen::frame_pacer pacer{200};
+
+  // The first call only starts the schedule
+  ASSERT_FALSE(pacer.wait());
+
+  const auto start = cen::counter::now();
+  for (int i = 0; i < 4; ++i)
+  {
+    pacer.wait();
+  }
+
+  const auto elapsed = static_cast<double>(cen::counter::now() - start) /
+                       static_cast<double>(cen::counter::frequency());
+
+  // Four deadlines, of which the first is a period after the schedule was started
+  ASSERT_GE(elapsed, 3 * pacer.period().count());
+}
+
+TEST(FramePacer, Reset)
+{
+  cen::frame_pacer pacer{1'000};
+  ASSERT_FALSE(pacer.wait());
+
+  pacer.reset();
+  ASSERT_FALSE(pacer.wait());
+  ASSERT_EQ(0u, pacer.missed_deadlines());
+}
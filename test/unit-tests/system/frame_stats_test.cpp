@@ -0,0 +1,96 @@
+#include "system/frame_stats.hpp"
+
+#include <gtest/gtest.h>
+
+#include "allocation_counter.hpp"
+
+using ms = cen::milliseconds<double>;
+
+TEST(FrameStats, Defaults)
+{
+  const cen::frame_stats<> stats;
+  ASSERT_EQ(256u, stats.capacity());
+  ASSERT_EQ(0u, stats.size());
+  ASSERT_EQ(0u, stats.total_frames());
+  ASSERT_EQ(ms{0}, stats.latest());
+  ASSERT_DOUBLE_EQ(1'000.0 / 30.0, stats.hitch_threshold().count());
+
+  const auto summary = stats.summary();
+  ASSERT_EQ(0u, summary.frames);
+  ASSERT_EQ(0.0, summary.fps());
+}
+
+TEST(FrameStats, Summary)
+{
+  cen::frame_stats<100> stats{ms{50}};
+
+  // The durations 1, 2, ..., 100 in a shuffled order
+  for (int i = 0; i < 100; ++i)
+  {
+    stats.record(ms{static_cast<double>((i * 37) % 100 + 1)});
+  }
+
+  ASSERT_EQ(100u, stats.size());
+  ASSERT_EQ(ms{(99 * 37) % 100 + 1}, stats.latest());
+
+  const auto summary = stats.summary();
+  ASSERT_EQ(100u, summary.frames);
+  ASSERT_DOUBLE_EQ(50.5, summary.mean.count());
+  ASSERT_EQ(ms{50}, summary.p50);
+  ASSERT_EQ(ms{95}, summary.p95);
+  ASSERT_EQ(ms{99}, summary.p99);
+  ASSERT_EQ(ms{100}, summary.max);
+  ASSERT_EQ(50u, summary.hitches);
+  ASSERT_DOUBLE_EQ(1'000.0 / 50.5, summary.fps());
+
+  ASSERT_EQ(50u, stats.total_hitches());
+
+  EXPECT_NO_ALLOCATIONS({
+    stats.record(ms{16});
+    stats.tick();
+  });
+}
+
+TEST(FrameStats, Window)
+{
+  cen::frame_stats<4> stats{ms{10}};
+
+  for (int i = 0; i < 4; ++i)
+  {
+    stats.record(ms{20});
+  }
+
+  for (int i = 0; i < 4; ++i)
+  {
+    stats.record(ms{5});
+  }
+
+  // Only the most recent frames are in the window, but the totals include all frames
+  const auto summary = stats.summary();
+  ASSERT_EQ(4u, summary.frames);
+  ASSERT_EQ(ms{5}, summary.max);
+  ASSERT_EQ(0u, summary.hitches);
+
+  ASSERT_EQ(8u, stats.total_frames());
+  ASSERT_EQ(4u, stats.total_hitches());
+
+  stats.set_hitch_threshold(ms{1});
+  ASSERT_EQ(4u, stats.summary().hitches);
+
+  stats.reset();
+  ASSERT_EQ(0u, stats.size());
+  ASSERT_EQ(0u, stats.total_frames());
+}
+
+TEST(FrameStats, Tick)
+{
+  cen::frame_stats<> stats;
+
+  stats.tick();  // Only starts the measurement
+  ASSERT_EQ(0u, stats.size());
+
+  stats.tick();
+  stats.tick();
+  ASSERT_EQ(2u, stats.size());
+  ASSERT_GT(stats.latest(), ms{0});
+}
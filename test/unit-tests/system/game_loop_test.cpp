@@ -0,0 +1,170 @@
+#include "system/game_loop.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+namespace {
+
+struct dummy_dispatcher final
+{
+  int polls{};
+
+  void poll() noexcept
+  {
+    ++polls;
+  }
+};
+
+struct dummy_renderer final
+{
+  int presents{};
+
+  void present() noexcept
+  {
+    ++presents;
+  }
+};
+
+}  // namespace
+
+TEST(GameLoop, Defaults)
+{
+  const cen::game_loop loop;
+  ASSERT_DOUBLE_EQ(1.0 / 60.0, loop.tick_duration().count());
+  ASSERT_EQ(0.0, loop.alpha());
+  ASSERT_EQ(0u, loop.total_updates());
+  ASSERT_EQ(0u, loop.skipped_updates());
+  ASSERT_FALSE(loop.is_running());
+}
+
+TEST(GameLoop, InvalidSettings)
+{
+  cen::game_loop_settings settings;
+  settings.tick_rate = 0;
+  ASSERT_THROW(cen::game_loop{settings}, cen::cen_error);
+
+  settings.tick_rate = 60;
+  settings.max_updates = 0;
+  ASSERT_THROW(cen::game_loop{settings}, cen::cen_error);
+}
+
+TEST(GameLoop, FrameRateLimit)
+{
+  cen::game_loop_settings settings;
+  settings.frame_rate_limit = 60;
+
+  cen::game_loop loop{settings};
+  ASSERT_EQ(60.0, loop.frame_rate_limit());
+
+  loop.set_frame_rate_limit(30);
+  ASSERT_EQ(30.0, loop.frame_rate_limit());
+
+  loop.set_frame_rate_limit(0);
+  ASSERT_EQ(0.0, loop.frame_rate_limit());
+
+  ASSERT_THROW(loop.set_frame_rate_limit(-1), cen::cen_error);
+  ASSERT_EQ(0.0, loop.frame_rate_limit());
+}
+
+TEST(GameLoop, Advance)
+{
+  cen::game_loop_settings settings;
+  settings.tick_rate = 10;
+
+  cen::game_loop loop{settings};
+
+  std::vector<double> steps;
+  const auto update = [&](const cen::seconds<double> dt) { steps.push_back(dt.count()); };
+
+  ASSERT_EQ(0u, loop.advance(cen::seconds<double>{0.05}, update));
+  ASSERT_NEAR(0.5, loop.alpha(), 1e-9);
+
+  ASSERT_EQ(2u, loop.advance(cen::seconds<double>{0.175}, update));
+  ASSERT_NEAR(0.25, loop.alpha(), 1e-9);
+
+  ASSERT_EQ(2u, steps.size());
+  ASSERT_DOUBLE_EQ(0.1, steps.front());
+  ASSERT_EQ(2u, loop.total_updates());
+}
+
+TEST(GameLoop, SpiralOfDeathProtection)
+{
+  cen::game_loop_settings settings;
+  settings.tick_rate = 100;
+  settings.max_updates = 5;
+  settings.max_frame_time = cen::seconds<double>{1};
+
+  cen::game_loop loop{settings};
+
+  int updates = 0;
+  const auto update = [&](cen::seconds<double>) { ++updates; };
+
+  // The frame time is clamped to one second, of which only five ticks are simulated
+  ASSERT_EQ(5u, loop.advance(cen::seconds<double>{10}, update));
+  ASSERT_EQ(5, updates);
+  ASSERT_EQ(95u, loop.skipped_updates());
+  ASSERT_GE(loop.alpha(), 0.0);
+  ASSERT_LT(loop.alpha(), 1.0);
+}
+
+TEST(GameLoop, Step)
+{
+  cen::game_loop loop;
+  dummy_dispatcher dispatcher;
+  dummy_renderer renderer;
+
+  int renders = 0;
+  const auto update = [](cen::seconds<double>) {};
+  const auto render = [&](const double alpha) {
+    ASSERT_GE(alpha, 0.0);
+    ASSERT_LT(alpha, 1.0);
+    ++renders;
+  };
+
+  loop.step(dispatcher, renderer, update, render);
+  loop.step(dispatcher, renderer, update, render);
+
+  ASSERT_EQ(2, dispatcher.polls);
+  ASSERT_EQ(2, renderer.presents);
+  ASSERT_EQ(2, renders);
+
+  // The first frame only starts the measurement
+  ASSERT_EQ(1u, loop.stats().size());
+}
+
+TEST(GameLoop, Run)
+{
+  cen::game_loop loop;
+  dummy_dispatcher dispatcher;
+  dummy_renderer renderer;
+
+  const auto update = [](cen::seconds<double>) {};
+  const auto render = [&](double) {
+    ASSERT_TRUE(loop.is_running());
+    if (renderer.presents == 2)
+    {
+      loop.stop();
+    }
+  };
+
+  loop.run(dispatcher, renderer, update, render);
+
+  ASSERT_FALSE(loop.is_running());
+  ASSERT_EQ(3, dispatcher.polls);
+  ASSERT_EQ(3, renderer.presents);
+}
+
+TEST(GameLoop, SwapInterval)
+{
+  // Unlimited, or limits at or above the refresh rate, present on every refresh
+  ASSERT_EQ(1, cen::detail::swap_interval_for(0, 60));
+  ASSERT_EQ(1, cen::detail::swap_interval_for(60, 60));
+  ASSERT_EQ(1, cen::detail::swap_interval_for(144, 60));
+  ASSERT_EQ(1, cen::detail::swap_interval_for(30, 0));
+
+  ASSERT_EQ(2, cen::detail::swap_interval_for(30, 60));
+  ASSERT_EQ(5, cen::detail::swap_interval_for(24, 120));
+  ASSERT_EQ(2, cen::detail::swap_interval_for(60, 144));
+  ASSERT_EQ(1, cen::detail::swap_interval_for(50, 60));
+}
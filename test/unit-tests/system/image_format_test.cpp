@@ -0,0 +1,51 @@
+#include "filesystem/image_format.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string_view>  // string_view
+
+namespace {
+
+[[nodiscard]] auto probe(const std::string_view header) -> cen::image_format
+{
+  return cen::probe_image(header.data(), header.size());
+}
+
+}  // namespace
+
+TEST(ImageFormat, ProbeImage)
+{
+  using namespace std::string_view_literals;
+
+  ASSERT_EQ(cen::image_format::png, probe("\x89PNG\r\n\x1A\n\0\0\0\x0DIHDR"sv));
+  ASSERT_EQ(cen::image_format::jpg, probe("\xFF\xD8\xFF\xE0\0\x10JFIF"sv));
+  ASSERT_EQ(cen::image_format::gif, probe("GIF89a\x01\0\x01\0"sv));
+  ASSERT_EQ(cen::image_format::gif, probe("GIF87a"sv));
+  ASSERT_EQ(cen::image_format::bmp, probe("BM\x36\0\0\0"sv));
+  ASSERT_EQ(cen::image_format::ico, probe("\0\0\x01\0\x01\0"sv));
+  ASSERT_EQ(cen::image_format::cur, probe("\0\0\x02\0\x01\0"sv));
+  ASSERT_EQ(cen::image_format::lbm, probe("FORM\0\0\0\0ILBM"sv));
+  ASSERT_EQ(cen::image_format::pcx, probe("\x0A\x05\x01\x08"sv));
+  ASSERT_EQ(cen::image_format::pnm, probe("P6\n32 32\n255\n"sv));
+  ASSERT_EQ(cen::image_format::xv, probe("P7 332\n"sv));
+  ASSERT_EQ(cen::image_format::tif, probe("II*\0\x08\0\0\0"sv));
+  ASSERT_EQ(cen::image_format::tif, probe("MM\0*\0\0\0\x08"sv));
+  ASSERT_EQ(cen::image_format::webp, probe("RIFF\0\0\0\0WEBPVP8 "sv));
+  ASSERT_EQ(cen::image_format::xcf, probe("gimp xcf v011"sv));
+  ASSERT_EQ(cen::image_format::xpm, probe("/* XPM */\nstatic char"sv));
+  ASSERT_EQ(cen::image_format::svg, probe("<?xml version=\"1.0\"?>\n<svg width=\"16\">"sv));
+}
+
+TEST(ImageFormat, ProbeUnknown)
+{
+  using namespace std::string_view_literals;
+
+  ASSERT_EQ(cen::image_format::unknown, cen::probe_image(nullptr, 0));
+  ASSERT_EQ(cen::image_format::unknown, probe("B"sv));
+  ASSERT_EQ(cen::image_format::unknown, probe("\x89PNG"sv));
+  ASSERT_EQ(cen::image_format::unknown, probe("GIF90a"sv));
+  ASSERT_EQ(cen::image_format::unknown, probe("\0\0\x01\0\0\0"sv));
+  ASSERT_EQ(cen::image_format::unknown, probe("\x0A\x03\x01"sv));
+  ASSERT_EQ(cen::image_format::unknown, probe("RIFF\0\0\0\0WAVEfmt "sv));
+  ASSERT_EQ(cen::image_format::unknown, probe("plain text"sv));
+}
@@ -0,0 +1,58 @@
+#include "filesystem/join_path.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string_view>  // string_view
+
+#include "allocation_counter.hpp"
+
+using namespace std::string_view_literals;
+
+TEST(JoinPath, InsertsSeparators)
+{
+  char buffer[64];
+
+  const auto path = cen::join_path(buffer, {"foo", "bar", "baz.png"});
+  ASSERT_TRUE(path);
+
+  const auto sep = cen::path_separator;
+  const std::string expected = std::string{"foo"} + sep + "bar" + sep + "baz.png";
+
+  ASSERT_EQ(expected, *path);
+  ASSERT_EQ(expected, buffer);
+}
+
+TEST(JoinPath, ExistingSeparators)
+{
+  char buffer[64];
+
+  ASSERT_EQ("foo/bar/baz"sv, cen::join_path(buffer, {"foo/", "bar", "/baz"}));
+  ASSERT_EQ("foo/bar"sv, cen::join_path(buffer, {"foo/", "/bar"}));
+  ASSERT_EQ("/foo"sv, cen::join_path(buffer, {"/foo"}));
+
+  EXPECT_NO_ALLOCATIONS({ cen::join_path(buffer, {"foo/", "bar", "/baz"}); });
+}
+
+TEST(JoinPath, EmptyComponents)
+{
+  char buffer[16];
+
+  ASSERT_EQ(""sv, cen::join_path(buffer, {}));
+  ASSERT_EQ(""sv, cen::join_path(buffer, {"", ""}));
+  ASSERT_EQ("foo/"sv, cen::join_path(buffer, {"", "foo/", ""}));
+}
+
+TEST(JoinPath, Overflow)
+{
+  char buffer[8];
+
+  ASSERT_EQ("foo/bar"sv, cen::join_path(buffer, {"foo/", "bar"}));
+
+  ASSERT_FALSE(cen::join_path(buffer, {"foo/", "barn"}));
+  ASSERT_STREQ("", buffer);
+
+  ASSERT_FALSE(cen::join_path(buffer, {"foooooo", "b"}));
+  ASSERT_STREQ("", buffer);
+
+  ASSERT_FALSE(cen::join_path(buffer, 0, {"a"}));
+}
@@ -0,0 +1,94 @@
+#include "filesystem/mapped_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>  // memcmp
+#include <utility>  // move
+
+#include "filesystem/preferred_path.hpp"
+
+class MappedFileTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_TRUE(file);
+    ASSERT_EQ(sizeof contents, file.write(contents));
+
+    cen::file empty{emptyPath, cen::file_mode::write_binary};
+    ASSERT_TRUE(empty);
+  }
+
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "mapped_file";
+  inline static const auto emptyPath = prefs + "mapped_file_empty";
+  inline static const char contents[] = "The quick brown fox jumps over the lazy dog";
+};
+
+TEST_F(MappedFileTest, Construction)
+{
+  ASSERT_THROW(cen::mapped_file{prefs + "mapped_file_missing"}, cen::cen_error);
+
+  const cen::mapped_file mapped{path};
+  ASSERT_EQ(sizeof contents, mapped.size());
+  ASSERT_FALSE(mapped.empty());
+  ASSERT_EQ(0, std::memcmp(contents, mapped.data(), sizeof contents));
+  ASSERT_EQ(static_cast<std::ptrdiff_t>(mapped.size()), mapped.end() - mapped.begin());
+
+  const cen::mapped_file empty{emptyPath};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.begin(), empty.end());
+}
+
+TEST_F(MappedFileTest, Move)
+{
+  cen::mapped_file mapped{path};
+  const auto* data = mapped.data();
+
+  cen::mapped_file other{std::move(mapped)};
+  ASSERT_EQ(data, other.data());
+  ASSERT_EQ(sizeof contents, other.size());
+  ASSERT_TRUE(mapped.empty());  // NOLINT use after move
+
+  mapped = std::move(other);
+  ASSERT_EQ(data, mapped.data());
+}
+
+TEST_F(MappedFileTest, Open)
+{
+  const cen::mapped_file mapped{path};
+
+  auto whole = mapped.open();
+  ASSERT_TRUE(whole);
+  ASSERT_EQ(sizeof contents, whole.size());
+
+  // A range of the mapped bytes, i.e. "brown"
+  auto range = mapped.open(10, 5);
+  ASSERT_EQ(5u, range.size());
+
+  char word[6]{};
+  ASSERT_EQ(5u, range.read_to(word, 5));
+  ASSERT_STREQ("brown", word);
+
+  ASSERT_THROW((void) mapped.open(mapped.size(), 1), cen::cen_error);
+  ASSERT_THROW((void) mapped.open(10, mapped.size()), cen::cen_error);
+}
+
+TEST_F(MappedFileTest, OpenEmpty)
+{
+  const cen::mapped_file empty{emptyPath};
+
+  auto file = empty.open();
+  ASSERT_TRUE(file);
+  ASSERT_EQ(0u, file.size());
+
+  char byte{};
+  ASSERT_EQ(0u, file.read_to(&byte, 1));
+
+  // An empty range of a file that isn't empty
+  const cen::mapped_file mapped{path};
+  auto range = mapped.open(mapped.size(), 0);
+  ASSERT_TRUE(range);
+  ASSERT_EQ(0u, range.size());
+}
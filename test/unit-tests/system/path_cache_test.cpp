@@ -0,0 +1,51 @@
+#include "filesystem/path_cache.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(PathCache, CachedBasePath)
+{
+  const auto& first = cen::cached_base_path();
+  const auto& second = cen::cached_base_path();
+
+  ASSERT_EQ(&first, &second);
+
+  const auto path = cen::base_path();
+  ASSERT_TRUE(path);
+  ASSERT_EQ(path.copy(), first);
+}
+
+TEST(PathCache, CachedPreferredPath)
+{
+  const auto& first = cen::cached_preferred_path("centurion", "tests");
+  const auto& second = cen::cached_preferred_path(std::string{"centurion"}, "tests");
+
+  ASSERT_EQ(&first, &second);
+  ASSERT_EQ(cen::preferred_path("centurion", "tests").copy(), first);
+
+  const auto& other = cen::cached_preferred_path("centurion", "other");
+  ASSERT_NE(&first, &other);
+}
+
+TEST(PathCache, Invalidate)
+{
+  const auto& base = cen::cached_base_path();
+  const auto& preferred = cen::cached_preferred_path("centurion", "tests");
+
+  const auto baseCopy = base;
+  const auto preferredCopy = preferred;
+
+  cen::invalidate_path_cache();
+
+  const auto& newBase = cen::cached_base_path();
+  const auto& newPreferred = cen::cached_preferred_path("centurion", "tests");
+
+  ASSERT_NE(&base, &newBase);
+  ASSERT_NE(&preferred, &newPreferred);
+
+  // The old references are still valid
+  ASSERT_EQ(baseCopy, base);
+  ASSERT_EQ(preferredCopy, preferred);
+
+  ASSERT_EQ(base, newBase);
+  ASSERT_EQ(preferred, newPreferred);
+}
@@ -0,0 +1,37 @@
+#include "system/plugin_host.hpp"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+struct test_api final
+{
+  int (*add)(int, int);
+};
+
+auto add(const int a, const int b) -> int
+{
+  return a + b;
+}
+
+}  // namespace
+
+TEST(PluginHost, BindPluginSymbol)
+{
+  const auto symbol = cen::bind_plugin_symbol<&test_api::add>("add");
+  ASSERT_STREQ("add", symbol.name);
+
+  test_api api{};
+  symbol.bind(api, reinterpret_cast<void (*)()>(&add));
+
+  ASSERT_EQ(&add, api.add);
+  ASSERT_EQ(42, api.add(40, 2));
+}
+
+TEST(PluginHost, Constructor)
+{
+  using host = cen::plugin_host<test_api>;
+  const auto symbol = cen::bind_plugin_symbol<&test_api::add>("add");
+
+  ASSERT_THROW(host(".", "foo", {symbol}, false), cen::cen_error);
+}
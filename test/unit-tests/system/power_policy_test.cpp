@@ -0,0 +1,131 @@
+#include "system/power_policy.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+#include "video/window.hpp"
+
+TEST(PowerPolicy, Defaults)
+{
+  const cen::power_policy policy;
+  ASSERT_FALSE(policy.is_on_battery());
+  ASSERT_EQ(30.0, policy.settings().battery_frame_rate);
+}
+
+TEST(PowerPolicy, InvalidSettings)
+{
+  {
+    cen::power_policy_settings settings;
+    settings.battery_frame_rate = 0;
+    ASSERT_THROW(cen::power_policy{settings}, cen::cen_error);
+  }
+
+  {
+    cen::power_policy_settings settings;
+    settings.battery_max_scale = 1.5f;
+    ASSERT_THROW(cen::power_policy{settings}, cen::cen_error);
+  }
+
+  {
+    cen::power_policy_settings settings;
+    settings.battery_workers = 0;
+    ASSERT_THROW(cen::power_policy{settings}, cen::cen_error);
+  }
+}
+
+TEST(PowerPolicy, GameLoop)
+{
+  cen::game_loop_settings settings;
+  settings.frame_rate_limit = 144;
+
+  cen::game_loop loop{settings};
+  cen::power_policy policy;
+  policy.attach(loop);
+
+  ASSERT_FALSE(policy.update(cen::power_state::charged));
+  ASSERT_EQ(144.0, loop.frame_rate_limit());
+
+  ASSERT_TRUE(policy.update(cen::power_state::on_battery));
+  ASSERT_TRUE(policy.is_on_battery());
+  ASSERT_EQ(30.0, loop.frame_rate_limit());
+
+  ASSERT_TRUE(policy.update(cen::power_state::charging));
+  ASSERT_EQ(144.0, loop.frame_rate_limit());
+}
+
+TEST(PowerPolicy, UnlimitedGameLoop)
+{
+  cen::game_loop loop;
+  cen::power_policy policy;
+
+  // Components attached on battery power are throttled immediately
+  policy.update(cen::power_state::on_battery);
+  policy.attach(loop);
+  ASSERT_EQ(30.0, loop.frame_rate_limit());
+
+  policy.detach_all();
+  ASSERT_EQ(0.0, loop.frame_rate_limit());
+
+  policy.update(cen::power_state::no_battery);
+  ASSERT_EQ(0.0, loop.frame_rate_limit());
+}
+
+TEST(PowerPolicy, ThreadPool)
+{
+  cen::thread_pool pool{4};
+  cen::power_policy policy;
+  policy.attach(pool);
+
+  policy.update(cen::power_state::on_battery);
+  ASSERT_EQ(2u, pool.active_workers());
+  ASSERT_EQ(4u, pool.size());
+
+  // Parked workers don't prevent the remaining workers from running all tasks
+  for (int i = 0; i < 32; ++i)
+  {
+    pool.submit([] {});
+  }
+
+  pool.wait_idle();
+  ASSERT_EQ(0u, pool.pending());
+
+  policy.update(cen::power_state::unknown);
+  ASSERT_EQ(4u, pool.active_workers());
+}
+
+TEST(PowerPolicy, DynamicResolution)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+  cen::texture_pool texturePool;
+
+  cen::dynamic_resolution_settings settings;
+  settings.min_scale = 0.8f;
+
+  cen::dynamic_resolution resolution{renderer, texturePool, settings};
+  cen::power_policy policy;
+  policy.attach(resolution);
+
+  // The battery scale is clamped to the lowest scale of the controller
+  policy.update(cen::power_state::on_battery);
+  ASSERT_EQ(0.8f, resolution.settings().max_scale);
+  ASSERT_EQ(0.8f, resolution.scale());
+
+  policy.update(cen::power_state::charged);
+  ASSERT_EQ(1.0f, resolution.settings().max_scale);
+}
+
+TEST(PowerPolicy, Poll)
+{
+  cen::power_policy_settings settings;
+  settings.poll_interval = cen::seconds<double>{60};
+
+  cen::power_policy policy{settings};
+
+  const auto onBattery = cen::battery::state() == cen::power_state::on_battery;
+  ASSERT_EQ(onBattery, policy.poll());
+  ASSERT_EQ(onBattery, policy.is_on_battery());
+
+  // The battery isn't queried again until the interval has passed
+  ASSERT_FALSE(policy.poll());
+}
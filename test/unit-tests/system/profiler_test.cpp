@@ -0,0 +1,161 @@
+#define CENTURION_ENABLE_PROFILER
+#include "system/profiler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>  // thread
+
+namespace {
+
+void leaf()
+{
+  CENTURION_PROFILE_SCOPE("leaf");
+}
+
+void branch()
+{
+  CENTURION_PROFILE_SCOPE("branch");
+  leaf();
+  leaf();
+}
+
+}  // namespace
+
+TEST(Profiler, IsEnabled)
+{
+  static_assert(cen::profiler::is_enabled());
+}
+
+TEST(Profiler, Hierarchy)
+{
+  (void) cen::profiler::end_frame();
+
+  {
+    CENTURION_PROFILE_SCOPE("root");
+    branch();
+    branch();
+    leaf();
+  }
+
+  const auto& frame = cen::profiler::end_frame();
+  ASSERT_EQ(&frame, &cen::profiler::last_frame());
+  ASSERT_LE(frame.begin_time(), frame.end_time());
+
+  // root -> (branch -> leaf), leaf
+  const auto& nodes = frame.nodes();
+  ASSERT_EQ(4u, nodes.size());
+
+  ASSERT_STREQ("root", nodes[0].name);
+  ASSERT_EQ(1u, nodes[0].calls);
+  ASSERT_EQ(0u, nodes[0].depth);
+  ASSERT_EQ(cen::profile_node::npos, nodes[0].parent);
+
+  ASSERT_STREQ("branch", nodes[1].name);
+  ASSERT_EQ(2u, nodes[1].calls);
+  ASSERT_EQ(1u, nodes[1].depth);
+  ASSERT_EQ(0u, nodes[1].parent);
+
+  ASSERT_STREQ("leaf", nodes[2].name);
+  ASSERT_EQ(4u, nodes[2].calls);
+  ASSERT_EQ(2u, nodes[2].depth);
+  ASSERT_EQ(1u, nodes[2].parent);
+
+  ASSERT_STREQ("leaf", nodes[3].name);
+  ASSERT_EQ(1u, nodes[3].calls);
+  ASSERT_EQ(0u, nodes[3].parent);
+
+  // Enclosing scopes take at least as long as the scopes they contain
+  ASSERT_GE(nodes[0].nanoseconds, nodes[1].nanoseconds + nodes[3].nanoseconds);
+  ASSERT_GE(nodes[1].nanoseconds, nodes[2].nanoseconds);
+
+  ASSERT_EQ(&nodes[0], frame.find("root"));
+  ASSERT_EQ(nullptr, frame.find("foo"));
+
+  ASSERT_FALSE(frame.threads().empty());
+  ASSERT_EQ(16u, frame.threads()[nodes[0].thread].events.size());
+}
+
+TEST(Profiler, OpenScopesSpanFrames)
+{
+  (void) cen::profiler::end_frame();
+
+  {
+    CENTURION_PROFILE_SCOPE("outer");
+
+    const auto& first = cen::profiler::end_frame();
+    ASSERT_EQ(1u, first.nodes().size());
+    ASSERT_EQ(1u, first.nodes()[0].calls);
+
+    const auto index = first.index();
+
+    leaf();
+
+    const auto& second = cen::profiler::end_frame();
+    ASSERT_EQ(index + 1u, second.index());
+    ASSERT_EQ(2u, second.nodes().size());
+
+    // The scope was entered in the previous frame, but still encloses the leaf
+    ASSERT_STREQ("outer", second.nodes()[0].name);
+    ASSERT_EQ(0u, second.nodes()[0].calls);
+    ASSERT_STREQ("leaf", second.nodes()[1].name);
+    ASSERT_EQ(0u, second.nodes()[1].parent);
+  }
+
+  const auto& last = cen::profiler::end_frame();
+  ASSERT_EQ(1u, last.nodes().size());
+  ASSERT_STREQ("outer", last.nodes()[0].name);
+
+  ASSERT_TRUE(cen::profiler::end_frame().nodes().empty());
+}
+
+TEST(Profiler, Threads)
+{
+  (void) cen::profiler::end_frame();
+
+  std::thread worker{[] {
+    for (int i = 0; i < 10; ++i)
+    {
+      branch();
+    }
+  }};
+
+  worker.join();
+  leaf();
+
+  const auto& frame = cen::profiler::end_frame();
+
+  const auto* b = frame.find("branch");
+  ASSERT_TRUE(b);
+  ASSERT_EQ(10u, b->calls);
+
+  std::size_t threads = 0;
+  for (const auto& thread : frame.threads())
+  {
+    threads += thread.events.empty() ? 0u : 1u;
+  }
+
+  ASSERT_EQ(2u, threads);
+
+  // The buffer of the exited thread is released after it has been drained
+  (void) cen::profiler::end_frame();
+  ASSERT_EQ(1u, cen::profiler::end_frame().threads().size());
+}
+
+TEST(Profiler, DroppedScopes)
+{
+  (void) cen::profiler::end_frame();
+  const auto dropped = cen::profiler::dropped_scopes();
+
+  for (std::size_t i = 0; i < cen::detail::profile_buffer_size; ++i)
+  {
+    leaf();
+  }
+
+  ASSERT_EQ(dropped + cen::detail::profile_buffer_size / 2u,
+            cen::profiler::dropped_scopes());
+
+  // The recorded events are balanced, even though the buffer was full
+  const auto& frame = cen::profiler::end_frame();
+  ASSERT_EQ(1u, frame.nodes().size());
+  ASSERT_EQ(cen::detail::profile_buffer_size / 2u, frame.nodes()[0].calls);
+}
@@ -0,0 +1,93 @@
+#include "filesystem/read_ahead_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+#include "filesystem/preferred_path.hpp"
+
+class ReadAheadFileTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    values.resize(100'000);
+    for (std::size_t index = 0; index < values.size(); ++index)
+    {
+      values[index] = static_cast<cen::u32>(index * 2'654'435'761u);
+    }
+
+    cen::file file{path, cen::file_mode::write_binary};
+    ASSERT_EQ(values.size(), file.write(values));
+  }
+
+  [[nodiscard]] static auto open(const std::size_t bufferSize = 4'096) -> cen::file
+  {
+    return cen::make_read_ahead_file({path, cen::file_mode::read_existing_binary},
+                                     bufferSize);
+  }
+
+  inline static const auto prefs = cen::preferred_path("centurion", "tests").copy();
+  inline static const auto path = prefs + "read_ahead_file";
+  inline static std::vector<cen::u32> values;
+};
+
+TEST_F(ReadAheadFileTest, InvalidArguments)
+{
+  ASSERT_FALSE(cen::make_read_ahead_file(cen::file{nullptr}));
+  ASSERT_FALSE(
+      cen::make_read_ahead_file({path, cen::file_mode::read_existing_binary}, 0));
+}
+
+TEST_F(ReadAheadFileTest, Read)
+{
+  auto file = open();
+  ASSERT_TRUE(file);
+
+  ASSERT_EQ(static_cast<cen::i64>(values.size() * 4u), file.size().value());
+
+  // The buffer is smaller than the file, so the reader has to wait for the worker
+  std::vector<cen::u32> contents(values.size() + 1);
+  ASSERT_EQ(values.size(), file.read_to(contents));
+
+  contents.pop_back();
+  ASSERT_EQ(values, contents);
+  ASSERT_EQ(static_cast<cen::i64>(values.size() * 4u), file.offset());
+
+  ASSERT_EQ(0u, file.read_to(contents));
+  ASSERT_FALSE(file.write(values));
+}
+
+TEST_F(ReadAheadFileTest, Seek)
+{
+  auto file = open();
+  ASSERT_TRUE(file);
+
+  ASSERT_EQ(400, file.seek(400, cen::seek_mode::from_beginning));
+  ASSERT_EQ(values[100], file.read_little_endian_u32());
+
+  ASSERT_EQ(408, file.seek(4, cen::seek_mode::relative_to_current));
+  ASSERT_EQ(values[102], file.read_little_endian_u32());
+
+  // Seeking backwards discards the buffered bytes
+  ASSERT_EQ(4, file.seek(4, cen::seek_mode::from_beginning));
+  ASSERT_EQ(values[1], file.read_little_endian_u32());
+
+  ASSERT_EQ(static_cast<cen::i64>(values.size() * 4u - 4u),
+            file.seek(-4, cen::seek_mode::relative_to_end));
+  ASSERT_EQ(values.back(), file.read_little_endian_u32());
+
+  ASSERT_FALSE(file.seek(-1, cen::seek_mode::from_beginning));
+}
+
+TEST_F(ReadAheadFileTest, ReadFromMemory)
+{
+  auto file = cen::make_read_ahead_file(
+      cen::file::from_memory(values.data(), values.size() * sizeof(cen::u32)),
+      1'000);
+  ASSERT_TRUE(file);
+
+  std::vector<cen::u32> contents(values.size());
+  ASSERT_EQ(values.size(), file.read_to(contents));
+  ASSERT_EQ(values, contents);
+}
@@ -0,0 +1,161 @@
+#include "system/simd_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>  // uintptr_t
+
+#include "core/integers.hpp"
+
+namespace {
+
+[[nodiscard]] auto is_aligned(const void* ptr) -> bool
+{
+  return reinterpret_cast<std::uintptr_t>(ptr) % cen::cpu::simd_alignment() == 0;
+}
+
+}  // namespace
+
+TEST(SIMDVector, Defaults)
+{
+  const cen::simd_vector<float> vector;
+  ASSERT_TRUE(vector.empty());
+  ASSERT_EQ(0u, vector.size());
+  ASSERT_EQ(0u, vector.capacity());
+  ASSERT_FALSE(vector.data());
+  ASSERT_EQ(vector.begin(), vector.end());
+}
+
+TEST(SIMDVector, Construction)
+{
+  const cen::simd_vector<int> zeros(5);
+  ASSERT_EQ(5u, zeros.size());
+  for (const auto value : zeros)
+  {
+    ASSERT_EQ(0, value);
+  }
+
+  const cen::simd_vector<int> sevens(3, 7);
+  ASSERT_EQ(3u, sevens.size());
+  ASSERT_EQ(7, sevens[2]);
+
+  const cen::simd_vector<int> list{1, 2, 3};
+  ASSERT_EQ(3u, list.size());
+  ASSERT_EQ(1, list[0]);
+  ASSERT_EQ(3, list[2]);
+  ASSERT_TRUE(is_aligned(list.data()));
+}
+
+TEST(SIMDVector, PushBack)
+{
+  cen::simd_vector<cen::u32> vector;
+
+  for (cen::u32 value = 0; value < 100; ++value)
+  {
+    vector.push_back(value);
+    ASSERT_TRUE(is_aligned(vector.data()));
+  }
+
+  ASSERT_EQ(100u, vector.size());
+  ASSERT_GE(vector.capacity(), vector.size());
+
+  for (cen::u32 value = 0; value < 100; ++value)
+  {
+    ASSERT_EQ(value, vector[value]);
+  }
+
+  // Pushing an element of the vector itself must survive the reallocation
+  vector.reserve(vector.size());
+  while (vector.size() != vector.capacity())
+  {
+    vector.push_back(0);
+  }
+
+  vector.push_back(vector[1]);
+  ASSERT_EQ(1u, vector[vector.size() - 1]);
+
+  vector.pop_back();
+  ASSERT_EQ(0u, vector[vector.size() - 1]);
+}
+
+TEST(SIMDVector, Resize)
+{
+  cen::simd_vector<float> vector{1, 2};
+
+  vector.resize(4, 5);
+  ASSERT_EQ(4u, vector.size());
+  ASSERT_EQ(2, vector[1]);
+  ASSERT_EQ(5, vector[3]);
+
+  vector.resize(1);
+  ASSERT_EQ(1u, vector.size());
+
+  const auto capacity = vector.capacity();
+  vector.clear();
+  ASSERT_TRUE(vector.empty());
+  ASSERT_EQ(capacity, vector.capacity());
+}
+
+TEST(SIMDVector, Padding)
+{
+  cen::simd_vector<cen::u8> vector(3, 0xFF);
+
+  // The padding after the capacity is zeroed, and may be read by kernels
+  const auto* bytes = vector.data();
+  for (std::size_t index = 0; index < cen::cpu::simd_alignment(); ++index)
+  {
+    ASSERT_EQ(0u, bytes[vector.capacity() + index]);
+  }
+}
+
+TEST(SIMDVector, CopyAndMove)
+{
+  cen::simd_vector<int> vector{1, 2, 3};
+
+  cen::simd_vector<int> copy{vector};
+  ASSERT_EQ(3u, copy.size());
+  ASSERT_NE(vector.data(), copy.data());
+  ASSERT_EQ(3, copy[2]);
+
+  copy = cen::simd_vector<int>{4};
+  ASSERT_EQ(1u, copy.size());
+  ASSERT_EQ(4, copy[0]);
+
+  const auto* data = vector.data();
+  cen::simd_vector<int> moved{std::move(vector)};
+  ASSERT_EQ(data, moved.data());
+  ASSERT_EQ(3u, moved.size());
+  ASSERT_TRUE(vector.empty());  // NOLINT use after move
+
+  copy = moved;
+  ASSERT_EQ(3u, copy.size());
+  ASSERT_EQ(2, copy[1]);
+}
+
+TEST(SIMDSpan, Usage)
+{
+  cen::simd_vector<int> vector{1, 2, 3, 4};
+
+  const auto span = vector.span();
+  ASSERT_EQ(4u, span.size());
+  ASSERT_EQ(4 * sizeof(int), span.size_bytes());
+  ASSERT_EQ(vector.data(), span.data());
+  ASSERT_TRUE(span.is_aligned());
+
+  span[0] = 10;
+  ASSERT_EQ(10, vector[0]);
+
+  const cen::simd_span<const int> view = span;
+  ASSERT_EQ(span.data(), view.data());
+
+  const auto tail = view.subspan(1);
+  ASSERT_EQ(3u, tail.size());
+  ASSERT_EQ(2, tail[0]);
+  ASSERT_FALSE(tail.is_aligned());
+
+  const auto middle = view.subspan(1, 2);
+  ASSERT_EQ(2u, middle.size());
+  ASSERT_EQ(3, *(middle.end() - 1));
+
+  ASSERT_TRUE(view.subspan(4).empty());
+  ASSERT_TRUE(cen::simd_span<int>{}.empty());
+}
@@ -0,0 +1,162 @@
+#include "system/timer_wheel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+using seconds = cen::timer_wheel::duration_type;
+
+TEST(TimerWheel, Defaults)
+{
+  const cen::timer_wheel wheel;
+  ASSERT_TRUE(wheel.empty());
+  ASSERT_EQ(0u, wheel.size());
+  ASSERT_EQ(0u, wheel.now());
+  ASSERT_EQ(seconds{0.001}, wheel.resolution());
+  ASSERT_FALSE(wheel.is_pending({}));
+
+  ASSERT_THROW(cen::timer_wheel{seconds{0}}, cen::cen_error);
+  ASSERT_THROW(cen::timer_wheel{seconds{-1}}, cen::cen_error);
+}
+
+TEST(TimerWheel, Schedule)
+{
+  cen::timer_wheel wheel{seconds{1}};
+
+  int fired = 0;
+  const auto handle = wheel.schedule(seconds{3}, [&] { ++fired; });
+  ASSERT_TRUE(handle);
+  ASSERT_TRUE(wheel.is_pending(handle));
+  ASSERT_EQ(1u, wheel.size());
+  ASSERT_EQ(seconds{3}, wheel.remaining(handle));
+
+  ASSERT_EQ(0u, wheel.advance(seconds{2.5}));
+  ASSERT_EQ(0, fired);
+  ASSERT_EQ(seconds{0.5}, wheel.remaining(handle));
+
+  ASSERT_EQ(1u, wheel.advance(seconds{0.5}));
+  ASSERT_EQ(1, fired);
+  ASSERT_FALSE(wheel.is_pending(handle));
+  ASSERT_TRUE(wheel.empty());
+
+  // A zero delay is rounded up to one tick
+  wheel.schedule(seconds{0}, [&] { ++fired; });
+  ASSERT_EQ(1u, wheel.advance_ticks(1));
+  ASSERT_EQ(2, fired);
+}
+
+TEST(TimerWheel, Order)
+{
+  cen::timer_wheel wheel;
+
+  std::vector<cen::u64> order;
+  for (const cen::u64 delay : {70'000u, 5u, 300u, 1u, 20'000'000u, 256u})
+  {
+    wheel.schedule(seconds{static_cast<double>(delay) * 0.001}, [&, delay] {
+      ASSERT_EQ(delay, wheel.now());
+      order.push_back(delay);
+    });
+  }
+
+  ASSERT_EQ(6u, wheel.advance_ticks(20'000'000));
+  ASSERT_EQ((std::vector<cen::u64>{1, 5, 256, 300, 70'000, 20'000'000}), order);
+}
+
+TEST(TimerWheel, BeyondRange)
+{
+  cen::timer_wheel wheel;
+
+  const cen::u64 delay = (cen::u64{1} << 32u) + 12'345u;
+
+  bool fired = false;
+  wheel.schedule(seconds{static_cast<double>(delay) * 0.001}, [&] {
+    ASSERT_EQ(delay, wheel.now());
+    fired = true;
+  });
+
+  wheel.advance_ticks(delay - 1u);
+  ASSERT_FALSE(fired);
+
+  wheel.advance_ticks(1);
+  ASSERT_TRUE(fired);
+}
+
+TEST(TimerWheel, Cancel)
+{
+  cen::timer_wheel wheel{seconds{1}};
+
+  int fired = 0;
+  const auto a = wheel.schedule(seconds{1}, [&] { ++fired; });
+  const auto b = wheel.schedule(seconds{1}, [&] { ++fired; });
+
+  ASSERT_TRUE(wheel.cancel(a));
+  ASSERT_FALSE(wheel.cancel(a));
+  ASSERT_FALSE(wheel.is_pending(a));
+  ASSERT_EQ(1u, wheel.size());
+
+  // The slot is reused with a new generation
+  const auto c = wheel.schedule(seconds{1}, [&] { fired += 10; });
+  ASSERT_EQ(a.index, c.index);
+  ASSERT_NE(a, c);
+  ASSERT_FALSE(wheel.cancel(a));
+
+  ASSERT_EQ(2u, wheel.advance_ticks(1));
+  ASSERT_EQ(11, fired);
+  ASSERT_FALSE(wheel.is_pending(b));
+  ASSERT_FALSE(wheel.is_pending(c));
+}
+
+TEST(TimerWheel, Periodic)
+{
+  cen::timer_wheel wheel{seconds{1}};
+
+  std::vector<cen::u64> times;
+  const auto handle =
+      wheel.schedule_every(seconds{3}, [&] { times.push_back(wheel.now()); });
+
+  ASSERT_EQ(3u, wheel.advance_ticks(10));
+  ASSERT_EQ((std::vector<cen::u64>{3, 6, 9}), times);
+  ASSERT_TRUE(wheel.is_pending(handle));
+
+  ASSERT_TRUE(wheel.cancel(handle));
+  ASSERT_EQ(0u, wheel.advance_ticks(10));
+
+  ASSERT_THROW(wheel.schedule_every(seconds{0}, [] {}), cen::cen_error);
+}
+
+TEST(TimerWheel, CallbacksModifyTheWheel)
+{
+  cen::timer_wheel wheel{seconds{1}};
+
+  int fired = 0;
+  cen::timer_handle periodic;
+  cen::timer_handle later;
+
+  periodic = wheel.schedule_every(seconds{1}, [&] {
+    ++fired;
+
+    // Cancelling itself stops the timer, and cancels another timer before it expires
+    if (fired == 2)
+    {
+      wheel.cancel(periodic);
+      wheel.cancel(later);
+    }
+
+    // Enough timers to grow the storage while the callback runs
+    for (int index = 0; index < 100; ++index)
+    {
+      wheel.schedule(seconds{100}, [] {});
+    }
+  });
+
+  later = wheel.schedule(seconds{3}, [&] { fired += 100; });
+
+  wheel.advance_ticks(5);
+  ASSERT_EQ(2, fired);
+  ASSERT_FALSE(wheel.is_pending(periodic));
+  ASSERT_EQ(200u, wheel.size());
+
+  wheel.clear();
+  ASSERT_TRUE(wheel.empty());
+  ASSERT_EQ(0u, wheel.advance_ticks(200));
+}
@@ -0,0 +1,120 @@
+#define CENTURION_ENABLE_PROFILER
+#include "system/trace_exporter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>    // remove
+#include <fstream>   // ifstream
+#include <iterator>  // istreambuf_iterator
+#include <sstream>   // stringstream
+#include <string>    // string
+
+#include "filesystem/preferred_path.hpp"
+
+namespace {
+
+[[nodiscard]] auto trace_path(const char* name) -> std::string
+{
+  return cen::preferred_path("centurion", "tests").copy() + name;
+}
+
+void traced()
+{
+  CENTURION_PROFILE_SCOPE("traced \"scope\"");
+}
+
+[[nodiscard]] auto count(const std::string& str, const std::string& pattern)
+    -> std::size_t
+{
+  std::size_t result = 0;
+  for (auto pos = str.find(pattern); pos != std::string::npos;
+       pos = str.find(pattern, pos + 1))
+  {
+    ++result;
+  }
+
+  return result;
+}
+
+}  // namespace
+
+TEST(ChromeTrace, WriteFrame)
+{
+  (void) cen::profiler::end_frame();
+
+  traced();
+  traced();
+
+  std::stringstream stream;
+  cen::write_chrome_trace(stream, cen::profiler::end_frame());
+
+  const auto trace = stream.str();
+  ASSERT_EQ(0u, trace.find("{\"traceEvents\":["));
+  ASSERT_EQ("]}\n", trace.substr(trace.size() - 3));
+
+  // The quotes in the name are escaped
+  ASSERT_EQ(4u, count(trace, "\"name\":\"traced \\\"scope\\\"\""));
+  ASSERT_EQ(2u, count(trace, "\"ph\":\"B\""));
+  ASSERT_EQ(2u, count(trace, "\"ph\":\"E\""));
+}
+
+TEST(ChromeTrace, Exporter)
+{
+  const auto path = trace_path("chrome_trace_exporter_test.json");
+
+  (void) cen::profiler::end_frame();
+
+  {
+    cen::chrome_trace_exporter exporter{path};
+    for (int frame = 0; frame < 10; ++frame)
+    {
+      traced();
+      ASSERT_TRUE(exporter.submit(cen::profiler::end_frame()));
+    }
+
+    ASSERT_EQ(0u, exporter.dropped_frames());
+  }
+
+  std::ifstream file{path};
+  const std::string trace{std::istreambuf_iterator<char>{file},
+                          std::istreambuf_iterator<char>{}};
+
+  ASSERT_EQ(0u, trace.find("{\"traceEvents\":["));
+  ASSERT_EQ("]}\n", trace.substr(trace.size() - 3));
+  ASSERT_EQ(10u, count(trace, "\"ph\":\"B\""));
+  ASSERT_EQ(10u, count(trace, "\"ph\":\"E\""));
+  ASSERT_EQ(19u, count(trace, "},\n{"));
+
+  ASSERT_THROW(cen::chrome_trace_exporter{"missing-directory/trace.json"},
+               cen::cen_error);
+
+  file.close();
+  ASSERT_EQ(0, std::remove(path.c_str()));
+}
+
+TEST(ChromeTrace, ExporterTracks)
+{
+  const auto path = trace_path("chrome_trace_exporter_tracks_test.json");
+
+  {
+    cen::chrome_trace_exporter exporter{path};
+
+    cen::profile_thread track;
+    track.id = 42;
+    ASSERT_TRUE(exporter.submit(track));  // Empty tracks are ignored
+
+    track.events.push_back({"gpu", 1'000, cen::profile_event_type::begin});
+    track.events.push_back({"gpu", 3'000, cen::profile_event_type::end});
+    ASSERT_TRUE(exporter.submit(track));
+  }
+
+  std::ifstream file{path};
+  const std::string trace{std::istreambuf_iterator<char>{file},
+                          std::istreambuf_iterator<char>{}};
+
+  ASSERT_EQ(2u, count(trace, "\"name\":\"gpu\""));
+  ASSERT_EQ(2u, count(trace, "\"tid\":42"));
+
+  file.close();
+  ASSERT_EQ(0, std::remove(path.c_str()));
+}
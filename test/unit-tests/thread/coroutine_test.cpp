@@ -0,0 +1,257 @@
+#include "thread/coroutine.hpp"
+#include "thread/thread.hpp"
+
+#include <gtest/gtest.h>
+
+#ifdef CENTURION_HAS_COROUTINES
+
+#include <atomic>     // atomic
+#include <memory>     // unique_ptr, make_unique
+#include <stdexcept>  // runtime_error
+#include <thread>     // thread
+#include <vector>     // vector
+
+using seconds = cen::coroutine_scheduler::duration_type;
+
+namespace {
+
+auto add(const int a, const int b) -> cen::task<int>
+{
+  co_return a + b;
+}
+
+auto sum(const int count) -> cen::task<int>
+{
+  int result = 0;
+  for (int index = 0; index < count; ++index)
+  {
+    result = co_await add(result, index);
+  }
+
+  co_return result;
+}
+
+auto fail() -> cen::task<int>
+{
+  throw std::runtime_error{"Failed!"};
+  co_return 0;
+}
+
+auto move_only() -> cen::task<std::unique_ptr<int>>
+{
+  co_return std::make_unique<int>(42);
+}
+
+}  // namespace
+
+TEST(Coroutine, AwaitTasks)
+{
+  cen::coroutine_scheduler scheduler;
+
+  int result = 0;
+  scheduler.spawn([](int& result) -> cen::task<> {
+    result = co_await sum(100);
+  }(result));
+
+  ASSERT_TRUE(scheduler.empty());
+  ASSERT_EQ(4'950, result);
+}
+
+TEST(Coroutine, Exceptions)
+{
+  cen::coroutine_scheduler scheduler;
+
+  bool caught = false;
+  scheduler.spawn([](bool& caught) -> cen::task<> {
+    try
+    {
+      co_await fail();
+    }
+    catch (const std::runtime_error&)
+    {
+      caught = true;
+    }
+  }(caught));
+
+  ASSERT_TRUE(caught);
+
+  // Exceptions that escape spawned tasks are rethrown by the scheduler
+  ASSERT_THROW(scheduler.spawn([]() -> cen::task<> { co_await fail(); }()),
+               std::runtime_error);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, MoveOnlyResults)
+{
+  cen::coroutine_scheduler scheduler;
+
+  int value = 0;
+  scheduler.spawn([](int& value) -> cen::task<> {
+    const auto ptr = co_await move_only();
+    value = *ptr;
+  }(value));
+
+  ASSERT_EQ(42, value);
+}
+
+TEST(Coroutine, NextFrame)
+{
+  cen::coroutine_scheduler scheduler;
+
+  std::vector<int> frames;
+  scheduler.spawn([](cen::coroutine_scheduler& scheduler,
+                     std::vector<int>& frames) -> cen::task<> {
+    for (int frame = 0; frame < 3; ++frame)
+    {
+      frames.push_back(frame);
+      co_await scheduler.next_frame();
+    }
+  }(scheduler, frames));
+
+  ASSERT_EQ(1u, frames.size());
+  ASSERT_EQ(1u, scheduler.size());
+
+  // Each update resumes the coroutine once, even though it awaits the next frame again
+  ASSERT_EQ(1u, scheduler.update(seconds{0}));
+  ASSERT_EQ(2u, frames.size());
+
+  scheduler.update(seconds{0});
+  scheduler.update(seconds{0});
+  ASSERT_EQ((std::vector<int>{0, 1, 2}), frames);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Delay)
+{
+  cen::coroutine_scheduler scheduler;
+
+  bool done = false;
+  scheduler.spawn([](cen::coroutine_scheduler& scheduler, bool& done) -> cen::task<> {
+    co_await scheduler.delay(seconds{0.5});
+    done = true;
+  }(scheduler, done));
+
+  scheduler.update(seconds{0.25});
+  ASSERT_FALSE(done);
+
+  scheduler.update(seconds{0.25});
+  ASSERT_TRUE(done);
+  ASSERT_TRUE(scheduler.empty());
+}
+
+TEST(Coroutine, Post)
+{
+  cen::coroutine_scheduler scheduler;
+
+  struct resume_later final
+  {
+    std::coroutine_handle<>* out;
+
+    auto await_ready() const noexcept -> bool
+    {
+      return false;
+    }
+
+    void await_suspend(const std::coroutine_handle<> handle) const noexcept
+    {
+      *out = handle;
+    }
+
+    void await_resume() const noexcept
+    {}
+  };
+
+  std::coroutine_handle<> handle;
+  bool done = false;
+  scheduler.spawn([](std::coroutine_handle<>& handle, bool& done) -> cen::task<> {
+    co_await resume_later{&handle};
+    done = true;
+  }(handle, done));
+
+  ASSERT_FALSE(done);
+
+  scheduler.post(handle);
+  ASSERT_FALSE(done);
+
+  ASSERT_EQ(1u, scheduler.update(seconds{0}));
+  ASSERT_TRUE(done);
+}
+
+TEST(Coroutine, Clear)
+{
+  cen::coroutine_scheduler scheduler;
+
+  scheduler.spawn([](cen::coroutine_scheduler& scheduler) -> cen::task<> {
+    co_await scheduler.delay(seconds{10});
+  }(scheduler));
+
+  ASSERT_EQ(1u, scheduler.size());
+
+  scheduler.clear();
+  ASSERT_TRUE(scheduler.empty());
+  ASSERT_EQ(0u, scheduler.update(seconds{20}));
+}
+
+TEST(Coroutine, ClearWaitsForAsyncWork)
+{
+  cen::thread_pool pool{1};
+  cen::coroutine_scheduler scheduler;
+
+  std::atomic<bool> started = false;
+  std::atomic<bool> finished = false;
+
+  scheduler.spawn([](cen::coroutine_scheduler& scheduler,
+                     cen::thread_pool& pool,
+                     std::atomic<bool>& started,
+                     std::atomic<bool>& finished) -> cen::task<> {
+    co_await scheduler.async(pool, [&] {
+      started = true;
+      cen::thread::sleep(cen::milliseconds<cen::u32>{50});
+      finished = true;
+    });
+  }(scheduler, pool, started, finished));
+
+  while (!started)
+  {}
+
+  // The coroutine frame can't be destroyed while the work refers to it
+  scheduler.clear();
+  ASSERT_TRUE(finished);
+  ASSERT_TRUE(scheduler.empty());
+  ASSERT_EQ(0u, scheduler.update(seconds{0}));
+}
+
+TEST(Coroutine, ClearCancelsPendingAsyncWork)
+{
+  cen::thread_pool pool{1};
+  cen::coroutine_scheduler scheduler;
+
+  // Occupies the only worker, so that the work of the coroutine stays queued
+  std::atomic<bool> release = false;
+  auto blocker = pool.submit([&] {
+    while (!release)
+    {}
+  });
+
+  bool invoked = false;
+  scheduler.spawn([](cen::coroutine_scheduler& scheduler,
+                     cen::thread_pool& pool,
+                     bool& invoked) -> cen::task<> {
+    co_await scheduler.async(pool, [&] { invoked = true; });
+  }(scheduler, pool, invoked));
+
+  std::thread releaser{[&] {
+    cen::thread::sleep(cen::milliseconds<cen::u32>{50});
+    release = true;
+  }};
+
+  scheduler.clear();
+  releaser.join();
+  blocker.wait();
+
+  ASSERT_FALSE(invoked);
+  ASSERT_TRUE(scheduler.empty());
+  ASSERT_EQ(0u, scheduler.update(seconds{0}));
+}
+
+#endif  // CENTURION_HAS_COROUTINES
@@ -0,0 +1,51 @@
+#include "thread/fast_condition.hpp"
+
+#include <gtest/gtest.h>
+
+#include "thread/thread.hpp"
+
+TEST(FastCondition, SignalWithoutWaiters)
+{
+  cen::fast_condition cond;
+  ASSERT_TRUE(cond.signal());
+  ASSERT_TRUE(cond.broadcast());
+}
+
+TEST(FastCondition, Wait)
+{
+  cen::mutex mutex;
+  cen::fast_condition cond;
+
+  ASSERT_TRUE(mutex.lock());
+
+  cen::thread thread{[](void* data) {
+                       auto* cond = reinterpret_cast<cen::fast_condition*>(data);
+
+                       using ms = cen::milliseconds<cen::u32>;
+                       cen::thread::sleep(ms{50});
+
+                       cond->signal();
+
+                       return 0;
+                     },
+                     "thread",
+                     &cond};
+
+  ASSERT_TRUE(cond.wait(mutex));
+  ASSERT_TRUE(mutex.unlock());
+}
+
+TEST(FastCondition, WaitTimeout)
+{
+  using ms = cen::milliseconds<cen::u32>;
+
+  cen::mutex mutex;
+  cen::fast_condition cond;
+
+  ASSERT_TRUE(mutex.lock());
+  ASSERT_EQ(cen::lock_status::timed_out, cond.wait(mutex, ms{1}));
+  ASSERT_TRUE(mutex.unlock());
+
+  // The waiter is unregistered after timing out, so signals take the fast path again
+  ASSERT_TRUE(cond.signal());
+}
@@ -0,0 +1,73 @@
+#include "thread/fast_semaphore.hpp"
+
+#include <gtest/gtest.h>
+
+#include "thread/thread.hpp"
+
+TEST(FastSemaphore, Acquire)
+{
+  cen::fast_semaphore semaphore{1};
+
+  ASSERT_TRUE(semaphore.acquire());
+  ASSERT_EQ(0u, semaphore.tokens());
+
+  ASSERT_TRUE(semaphore.release());
+  ASSERT_EQ(1u, semaphore.tokens());
+}
+
+TEST(FastSemaphore, AcquireMilliseconds)
+{
+  using ms = cen::milliseconds<cen::u32>;
+
+  cen::fast_semaphore semaphore{0};
+
+  ASSERT_EQ(cen::lock_status::timed_out, semaphore.acquire(ms{1}));
+  ASSERT_EQ(0u, semaphore.tokens());
+
+  // A timed out waiter must not consume the next token
+  ASSERT_TRUE(semaphore.release());
+  ASSERT_EQ(1u, semaphore.tokens());
+
+  ASSERT_EQ(cen::lock_status::success, semaphore.acquire(ms{1}));
+  ASSERT_EQ(0u, semaphore.tokens());
+}
+
+TEST(FastSemaphore, TryAcquire)
+{
+  cen::fast_semaphore semaphore{0};
+
+  ASSERT_EQ(cen::lock_status::timed_out, semaphore.try_acquire());
+  ASSERT_TRUE(semaphore.release());
+
+  ASSERT_EQ(cen::lock_status::success, semaphore.try_acquire());
+  ASSERT_EQ(cen::lock_status::timed_out, semaphore.try_acquire());
+}
+
+TEST(FastSemaphore, Tokens)
+{
+  constexpr cen::u32 tokens = 32;
+
+  cen::fast_semaphore semaphore{tokens};
+  ASSERT_EQ(tokens, semaphore.tokens());
+}
+
+TEST(FastSemaphore, BlockingHandOff)
+{
+  cen::fast_semaphore semaphore{0};
+
+  cen::thread thread{[](void* data) {
+                       auto* semaphore = reinterpret_cast<cen::fast_semaphore*>(data);
+
+                       using ms = cen::milliseconds<cen::u32>;
+                       cen::thread::sleep(ms{50});
+
+                       semaphore->release();
+
+                       return 0;
+                     },
+                     "thread",
+                     &semaphore};
+
+  ASSERT_TRUE(semaphore.acquire());
+  ASSERT_EQ(0u, semaphore.tokens());
+}
@@ -0,0 +1,155 @@
+#include "thread/job_graph.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>     // atomic
+#include <memory>     // make_shared
+#include <stdexcept>  // runtime_error
+#include <vector>     // vector
+
+TEST(JobGraph, Defaults)
+{
+  cen::job_graph graph;
+  ASSERT_TRUE(graph.empty());
+  ASSERT_EQ(0u, graph.size());
+
+  cen::thread_pool pool{2};
+  ASSERT_NO_THROW(graph.run(pool));
+}
+
+TEST(JobGraph, Dependencies)
+{
+  cen::thread_pool pool{4};
+  cen::job_graph graph;
+
+  std::atomic<int> counter{0};
+  std::vector<int> order(4, -1);
+
+  const auto a = graph.add([&] { order[0] = counter++; });
+  const auto b = graph.add([&] { order[1] = counter++; }, {a});
+  const auto c = graph.add([&] { order[2] = counter++; }, {a});
+  const auto d = graph.add([&] { order[3] = counter++; }, {b, c});
+
+  ASSERT_EQ(4u, graph.size());
+  ASSERT_EQ(0u, graph.dependencies(a));
+  ASSERT_EQ(1u, graph.dependencies(b));
+  ASSERT_EQ(2u, graph.dependencies(d));
+  ASSERT_THROW((void) graph.dependencies(4), cen::cen_error);
+
+  graph.run(pool);
+
+  ASSERT_EQ(4, counter);
+  ASSERT_EQ(0, order[0]);
+  ASSERT_LT(order[1], order[3]);
+  ASSERT_LT(order[2], order[3]);
+  ASSERT_EQ(3, order[3]);
+}
+
+TEST(JobGraph, InvalidDependencies)
+{
+  cen::job_graph graph;
+
+  ASSERT_THROW(graph.add([] {}, {0}), cen::cen_error);
+
+  const auto a = graph.add([] {});
+  const auto b = graph.add([] {});
+
+  ASSERT_THROW(graph.add_dependency(a, b), cen::cen_error);
+  ASSERT_THROW(graph.add_dependency(a, a), cen::cen_error);
+  ASSERT_THROW(graph.add_dependency(5, a), cen::cen_error);
+
+  ASSERT_NO_THROW(graph.add_dependency(b, a));
+  ASSERT_EQ(1u, graph.dependencies(b));
+}
+
+TEST(JobGraph, ManyJobs)
+{
+  constexpr int count = 400;
+
+  cen::thread_pool pool{4};
+  cen::job_graph graph;
+
+  std::atomic<int> counter{0};
+  std::vector<int> finished(count, -1);
+
+  // Every job depends on a couple of earlier jobs, computed from its index
+  for (int i = 0; i < count; ++i)
+  {
+    const auto id = graph.add([&, i] { finished[i] = counter++; });
+    if (i > 0)
+    {
+      graph.add_dependency(id, static_cast<cen::job_graph::job_id>(i / 2));
+    }
+
+    if (i > 3)
+    {
+      graph.add_dependency(id, static_cast<cen::job_graph::job_id>(i - 3));
+    }
+  }
+
+  for (int frame = 0; frame < 3; ++frame)
+  {
+    counter = 0;
+    graph.run(pool);
+
+    ASSERT_EQ(count, counter);
+    for (int i = 1; i < count; ++i)
+    {
+      ASSERT_LT(finished[i / 2], finished[i]);
+      if (i > 3)
+      {
+        ASSERT_LT(finished[i - 3], finished[i]);
+      }
+    }
+  }
+}
+
+TEST(JobGraph, Reset)
+{
+  cen::thread_pool pool{2};
+  cen::job_graph graph{256};
+
+  auto resource = std::make_shared<int>(42);
+  for (int frame = 0; frame < 10; ++frame)
+  {
+    graph.reset();
+
+    std::atomic<int> sum{0};
+    for (int i = 0; i < 50; ++i)
+    {
+      graph.add([&sum, resource] { sum += *resource; });
+    }
+
+    ASSERT_EQ(50u, graph.size());
+    ASSERT_EQ(51, resource.use_count());
+
+    graph.run(pool);
+    ASSERT_EQ(50 * 42, sum);
+  }
+
+  // Resetting the graph destroys the stored function objects
+  graph.reset();
+  ASSERT_TRUE(graph.empty());
+  ASSERT_EQ(1, resource.use_count());
+}
+
+TEST(JobGraph, Exceptions)
+{
+  cen::thread_pool pool{2};
+  cen::job_graph graph;
+
+  std::atomic<bool> dependent{false};
+
+  const auto a = graph.add([] { throw std::runtime_error{"foo"}; });
+  graph.add([&] { dependent = true; }, {a});
+
+  ASSERT_THROW(graph.run(pool), std::runtime_error);
+  ASSERT_FALSE(dependent);
+
+  // The graph can be run again after a failure
+  graph.reset();
+  graph.add([&] { dependent = true; });
+
+  ASSERT_NO_THROW(graph.run(pool));
+  ASSERT_TRUE(dependent);
+}
@@ -0,0 +1,121 @@
+#include "thread/mpmc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>     // atomic
+#include <memory>     // unique_ptr, make_unique
+#include <stdexcept>  // runtime_error
+#include <thread>     // thread
+#include <vector>     // vector
+
+namespace {
+
+struct throwing final
+{
+  explicit throwing(const bool fail)
+  {
+    if (fail)
+    {
+      throw std::runtime_error{"foo"};
+    }
+  }
+
+  throwing() noexcept = default;
+  throwing(throwing&&) noexcept = default;
+  auto operator=(throwing&&) noexcept -> throwing& = default;
+};
+
+}  // namespace
+
+TEST(MPMCQueue, Capacity)
+{
+  ASSERT_EQ(2u, cen::mpmc_queue<int>{0}.capacity());
+  ASSERT_EQ(16u, cen::mpmc_queue<int>{10}.capacity());
+  ASSERT_EQ(1'024u, cen::mpmc_queue<int>{}.capacity());
+}
+
+TEST(MPMCQueue, TryPushAndTryPop)
+{
+  cen::mpmc_queue<int> queue{4};
+
+  int value{};
+  ASSERT_FALSE(queue.try_pop(value));
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.try_push(i));
+  }
+
+  ASSERT_FALSE(queue.try_push(4));
+  ASSERT_EQ(4u, queue.size_approx());
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(i, value);
+  }
+
+  ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(MPMCQueue, ThrowingConstructor)
+{
+  cen::mpmc_queue<throwing> queue{2};
+
+  ASSERT_THROW(queue.try_emplace(true), std::runtime_error);
+  ASSERT_EQ(0u, queue.size_approx());
+
+  ASSERT_TRUE(queue.try_emplace(false));
+
+  throwing value;
+  ASSERT_TRUE(queue.try_pop(value));
+  ASSERT_FALSE(queue.try_pop(value));
+}
+
+TEST(MPMCQueue, MoveOnlyValues)
+{
+  cen::mpmc_queue<std::unique_ptr<int>> queue{2};
+  ASSERT_TRUE(queue.try_emplace(std::make_unique<int>(7)));
+  ASSERT_TRUE(queue.try_emplace(std::make_unique<int>(8)));
+
+  std::unique_ptr<int> value;
+  ASSERT_TRUE(queue.try_pop(value));
+  ASSERT_EQ(7, *value);
+}
+
+TEST(MPMCQueue, Blocking)
+{
+  constexpr int threads = 4;
+  constexpr int count = 20'000;
+
+  cen::mpmc_queue<int> queue{64};
+  std::atomic<long long> sum{0};
+
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; ++t)
+  {
+    workers.emplace_back([&] {
+      for (int i = 1; i <= count; ++i)
+      {
+        queue.push(i);
+      }
+    });
+
+    workers.emplace_back([&] {
+      for (int i = 0; i < count; ++i)
+      {
+        int value{};
+        queue.pop(value);
+        sum += value;
+      }
+    });
+  }
+
+  for (auto& worker : workers)
+  {
+    worker.join();
+  }
+
+  ASSERT_EQ(threads * (count * (count + 1ll) / 2), sum.load());
+  ASSERT_EQ(0u, queue.size_approx());
+}
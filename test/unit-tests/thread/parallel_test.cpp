@@ -0,0 +1,116 @@
+#include "thread/parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>      // atomic
+#include <functional>  // plus
+#include <numeric>     // iota
+#include <stdexcept>   // runtime_error
+#include <vector>      // vector
+
+TEST(ParallelFor, Indices)
+{
+  cen::thread_pool pool{4};
+
+  std::vector<int> values(1'000, 0);
+  cen::parallel_for(pool, 0, 1'000, 0, [&](const int index) { values[index] = index * 2; });
+
+  for (int index = 0; index < 1'000; ++index)
+  {
+    ASSERT_EQ(index * 2, values[index]);
+  }
+}
+
+TEST(ParallelFor, Chunks)
+{
+  cen::thread_pool pool{4};
+
+  std::atomic<int> chunks{0};
+  std::vector<int> values(1'003, 0);
+
+  cen::parallel_for(pool, 0, 1'003, 10, [&](const int first, const int last) {
+    ASSERT_LE(last - first, 10);
+    ++chunks;
+
+    for (auto index = first; index < last; ++index)
+    {
+      ++values[index];
+    }
+  });
+
+  ASSERT_EQ(101, chunks.load());
+  for (const auto value : values)
+  {
+    ASSERT_EQ(1, value);
+  }
+}
+
+TEST(ParallelFor, EmptyRange)
+{
+  cen::thread_pool pool{2};
+
+  int calls = 0;
+  cen::parallel_for(pool, 10, 10, 0, [&](int) { ++calls; });
+  cen::parallel_for(pool, 10, 5, 0, [&](int) { ++calls; });
+
+  ASSERT_EQ(0, calls);
+}
+
+TEST(ParallelFor, Exceptions)
+{
+  cen::thread_pool pool{2};
+  std::atomic<int> count{0};
+
+  const auto function = [&](const int index) {
+    ++count;
+    if (index == 50)
+    {
+      throw std::runtime_error{"foo"};
+    }
+  };
+
+  ASSERT_THROW(cen::parallel_for(pool, 0, 100, 1, function), std::runtime_error);
+  ASSERT_EQ(100, count.load());  // All chunks are still processed
+}
+
+TEST(ParallelReduce, Sum)
+{
+  cen::thread_pool pool{4};
+
+  std::vector<long long> values(100'000);
+  std::iota(values.begin(), values.end(), 1);
+
+  const auto sum = cen::parallel_reduce(
+      pool,
+      std::size_t{0},
+      values.size(),
+      std::size_t{0},
+      0ll,
+      [&](const std::size_t first, const std::size_t last, long long partial) {
+        for (auto index = first; index < last; ++index)
+        {
+          partial += values[index];
+        }
+
+        return partial;
+      },
+      std::plus<>{});
+
+  ASSERT_EQ(5'000'050'000ll, sum);
+}
+
+TEST(ParallelReduce, EmptyRange)
+{
+  cen::thread_pool pool{2};
+
+  const auto result = cen::parallel_reduce(
+      pool,
+      0,
+      0,
+      0,
+      7,
+      [](int, int, int) { return 0; },
+      std::plus<>{});
+
+  ASSERT_EQ(7, result);
+}
@@ -0,0 +1,97 @@
+#include "thread/shared_mutex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>       // atomic
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, ...
+#include <vector>       // vector
+
+#include "thread/scoped_lock.hpp"
+#include "thread/try_lock.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::shared_mutex>);
+static_assert(!std::is_copy_assignable_v<cen::shared_mutex>);
+
+static_assert(!std::is_copy_constructible_v<cen::shared_lock>);
+static_assert(!std::is_copy_assignable_v<cen::shared_lock>);
+
+TEST(SharedMutex, ExclusiveLock)
+{
+  cen::shared_mutex mutex;
+  ASSERT_FALSE(mutex.is_locked());
+
+  ASSERT_TRUE(mutex.lock());
+  ASSERT_TRUE(mutex.is_locked());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock_shared());
+
+  ASSERT_TRUE(mutex.unlock());
+  ASSERT_FALSE(mutex.is_locked());
+}
+
+TEST(SharedMutex, SharedLock)
+{
+  cen::shared_mutex mutex;
+
+  {
+    cen::shared_lock first{mutex};
+    cen::shared_lock second{mutex};
+    ASSERT_EQ(2u, mutex.readers());
+
+    ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+
+    cen::try_lock attempt{mutex};
+    ASSERT_FALSE(attempt);
+  }
+
+  ASSERT_EQ(0u, mutex.readers());
+
+  {
+    cen::scoped_lock lock{mutex};
+    ASSERT_TRUE(mutex.is_locked());
+  }
+
+  ASSERT_FALSE(mutex.is_locked());
+}
+
+TEST(SharedMutex, ReadersAndWriters)
+{
+  cen::shared_mutex mutex;
+  int a = 0;
+  int b = 0;
+  std::atomic<bool> consistent{true};
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 2; ++i)
+  {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 10'000; ++j)
+      {
+        cen::scoped_lock lock{mutex};
+        ++a;
+        ++b;
+      }
+    });
+
+    threads.emplace_back([&] {
+      for (int j = 0; j < 10'000; ++j)
+      {
+        cen::shared_lock lock{mutex};
+        if (a != b)
+        {
+          consistent = false;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  ASSERT_TRUE(consistent);
+  ASSERT_EQ(20'000, a);
+  ASSERT_EQ(20'000, b);
+}
@@ -0,0 +1,78 @@
+#include "thread/spin_mutex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>       // thread
+#include <type_traits>  // is_copy_constructible_v, ...
+#include <vector>       // vector
+
+#include "thread/scoped_lock.hpp"
+#include "thread/try_lock.hpp"
+
+static_assert(!std::is_copy_constructible_v<cen::spin_mutex>);
+static_assert(!std::is_copy_assignable_v<cen::spin_mutex>);
+static_assert(std::is_nothrow_default_constructible_v<cen::spin_mutex>);
+
+TEST(SpinMutex, LockUnlock)
+{
+  cen::spin_mutex mutex;
+  ASSERT_FALSE(mutex.is_locked());
+
+  ASSERT_TRUE(mutex.lock());
+  ASSERT_TRUE(mutex.is_locked());
+  ASSERT_EQ(cen::lock_status::timed_out, mutex.try_lock());
+
+  ASSERT_TRUE(mutex.unlock());
+  ASSERT_FALSE(mutex.is_locked());
+
+  ASSERT_EQ(cen::lock_status::success, mutex.try_lock());
+  ASSERT_TRUE(mutex.unlock());
+}
+
+TEST(SpinMutex, Locks)
+{
+  cen::spin_mutex mutex;
+
+  {
+    cen::scoped_lock lock{mutex};
+    ASSERT_TRUE(mutex.is_locked());
+
+    cen::try_lock attempt{mutex};
+    ASSERT_FALSE(attempt);
+  }
+
+  ASSERT_FALSE(mutex.is_locked());
+
+  {
+    cen::try_lock lock{mutex};
+    ASSERT_TRUE(lock);
+    ASSERT_TRUE(mutex.is_locked());
+  }
+
+  ASSERT_FALSE(mutex.is_locked());
+}
+
+TEST(SpinMutex, MutualExclusion)
+{
+  cen::spin_mutex mutex;
+  int counter = 0;
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([&] {
+      for (int j = 0; j < 10'000; ++j)
+      {
+        cen::scoped_lock lock{mutex};
+        ++counter;
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  ASSERT_EQ(40'000, counter);
+}
@@ -0,0 +1,80 @@
+#include "thread/spsc_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr, make_unique
+#include <thread>  // thread
+
+#include "allocation_counter.hpp"
+
+TEST(SPSCQueue, Defaults)
+{
+  const cen::spsc_queue<int, 8> queue;
+  ASSERT_EQ(8u, queue.capacity());
+  ASSERT_EQ(0u, queue.size_approx());
+}
+
+TEST(SPSCQueue, TryPushAndTryPop)
+{
+  cen::spsc_queue<int, 4> queue;
+
+  int value{};
+  ASSERT_FALSE(queue.try_pop(value));
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.try_push(i));
+  }
+
+  ASSERT_FALSE(queue.try_push(4));
+  ASSERT_EQ(4u, queue.size_approx());
+
+  for (int i = 0; i < 4; ++i)
+  {
+    ASSERT_TRUE(queue.try_pop(value));
+    ASSERT_EQ(i, value);
+  }
+
+  ASSERT_FALSE(queue.try_pop(value));
+
+  EXPECT_NO_ALLOCATIONS({
+    queue.try_push(42);
+    queue.try_pop(value);
+  });
+  ASSERT_EQ(42, value);
+}
+
+TEST(SPSCQueue, MoveOnlyValues)
+{
+  cen::spsc_queue<std::unique_ptr<int>, 2> queue;
+  ASSERT_TRUE(queue.try_emplace(std::make_unique<int>(7)));
+  ASSERT_TRUE(queue.try_emplace(std::make_unique<int>(8)));
+
+  std::unique_ptr<int> value;
+  ASSERT_TRUE(queue.try_pop(value));
+  ASSERT_EQ(7, *value);
+
+  // The remaining value is destroyed by the queue
+}
+
+TEST(SPSCQueue, Blocking)
+{
+  constexpr int count = 100'000;
+  cen::spsc_queue<int, 16> queue;
+
+  std::thread producer{[&] {
+    for (int i = 0; i < count; ++i)
+    {
+      queue.push(i);
+    }
+  }};
+
+  for (int i = 0; i < count; ++i)
+  {
+    int value{};
+    queue.pop(value);
+    ASSERT_EQ(i, value);
+  }
+
+  producer.join();
+}
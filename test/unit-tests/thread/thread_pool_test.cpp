@@ -0,0 +1,151 @@
+#include "thread/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>     // atomic
+#include <stdexcept>  // runtime_error
+#include <vector>     // vector
+
+TEST(ThreadPool, Defaults)
+{
+  cen::thread_pool pool;
+  ASSERT_EQ(cen::thread_pool::default_size(), pool.size());
+  ASSERT_EQ(cen::thread_priority::normal, pool.priority());
+  ASSERT_EQ(cen::worker_affinity::none, pool.affinity());
+  ASSERT_EQ(0u, pool.pending());
+  ASSERT_FALSE(pool.is_worker_thread());
+}
+
+TEST(ThreadPool, Submit)
+{
+  cen::thread_pool pool{2, cen::thread_priority::low};
+  ASSERT_EQ(2u, pool.size());
+  ASSERT_EQ(cen::thread_priority::low, pool.priority());
+
+  auto handle = pool.submit([] { return 42; });
+  ASSERT_TRUE(handle.valid());
+  ASSERT_EQ(42, handle.get());
+
+  // Waiting for a handle might run the task on the waiting thread, wait_idle() doesn't
+  auto worker = pool.submit([&pool] { return pool.is_worker_thread(); });
+  pool.wait_idle();
+  ASSERT_TRUE(worker.get());
+}
+
+TEST(ThreadPool, Exceptions)
+{
+  cen::thread_pool pool{1};
+
+  auto handle = pool.submit([]() -> int { throw std::runtime_error{"foo"}; });
+  ASSERT_THROW(handle.get(), std::runtime_error);
+
+  cen::task_handle<int> invalid;
+  ASSERT_FALSE(invalid.valid());
+  ASSERT_THROW(invalid.wait(), cen::cen_error);
+}
+
+TEST(ThreadPool, ManyTasks)
+{
+  cen::thread_pool pool{4};
+  std::atomic<int> sum{0};
+
+  std::vector<cen::task_handle<void>> handles;
+  for (int i = 1; i <= 1'000; ++i)
+  {
+    handles.push_back(pool.submit([&sum, i] { sum += i; }));
+  }
+
+  for (auto& handle : handles)
+  {
+    handle.wait();
+  }
+
+  ASSERT_EQ(500'500, sum.load());
+}
+
+TEST(ThreadPool, NestedTasks)
+{
+  // A single worker must not deadlock when a task waits for a task that it submitted
+  cen::thread_pool pool{1};
+
+  auto outer = pool.submit([&pool] {
+    auto inner = pool.submit([] { return 21; });
+    return inner.get() * 2;
+  });
+
+  ASSERT_EQ(42, outer.get());
+}
+
+TEST(ThreadPool, WaitIdle)
+{
+  std::atomic<int> count{0};
+
+  {
+    cen::thread_pool pool{3};
+    for (int i = 0; i < 100; ++i)
+    {
+      pool.submit([&count] {
+        cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+        ++count;
+      });
+    }
+
+    pool.wait_idle();
+    ASSERT_EQ(100, count.load());
+    ASSERT_EQ(0u, pool.pending());
+
+    for (int i = 0; i < 100; ++i)
+    {
+      pool.submit([&count] { ++count; });
+    }
+  }  // The destructor waits for the remaining tasks
+
+  ASSERT_EQ(200, count.load());
+}
+
+TEST(ThreadPool, Affinity)
+{
+  for (const auto affinity :
+       {cen::worker_affinity::logical, cen::worker_affinity::physical})
+  {
+    cen::thread_pool pool{6, cen::thread_priority::normal, affinity};
+    ASSERT_EQ(affinity, pool.affinity());
+
+    std::atomic<int> sum{0};
+    for (int i = 0; i < 100; ++i)
+    {
+      pool.submit([&sum] { ++sum; });
+    }
+
+    pool.wait_idle();
+    ASSERT_EQ(100, sum);
+  }
+}
+
+TEST(ThreadPool, ActiveWorkers)
+{
+  cen::thread_pool pool{4};
+  ASSERT_EQ(4u, pool.active_workers());
+
+  pool.set_active_workers(0);
+  ASSERT_EQ(1u, pool.active_workers());
+
+  pool.set_active_workers(10);
+  ASSERT_EQ(4u, pool.active_workers());
+
+  pool.set_active_workers(2);
+  ASSERT_EQ(2u, pool.active_workers());
+
+  std::atomic<int> count{0};
+  for (int i = 0; i < 100; ++i)
+  {
+    pool.submit([&count] { ++count; });
+  }
+
+  pool.wait_idle();
+  ASSERT_EQ(100, count.load());
+
+  pool.set_active_workers(4);
+  pool.submit([&count] { ++count; }).wait();
+  ASSERT_EQ(101, count.load());
+}
@@ -6,6 +6,7 @@
 #include <type_traits>
 
 #include "core/log.hpp"
+#include "system/platform.hpp"
 
 namespace {
 
@@ -125,6 +126,17 @@ TEST(Thread, SetPriority)
   ASSERT_TRUE(cen::thread::set_priority(cen::thread_priority::low));
 }
 
+TEST(Thread, SetAffinity)
+{
+  ASSERT_FALSE(cen::thread::set_affinity(cen::core_mask{}));
+
+  if constexpr (cen::ifdef_linux() || cen::ifdef_win32())
+  {
+    ASSERT_TRUE(cen::thread::set_affinity(cen::core_mask::single(0)));
+    ASSERT_TRUE(cen::thread::set_affinity(cen::core_mask::all()));
+  }
+}
+
 TEST(Thread, CurrentId)
 {
   ASSERT_EQ(cen::thread::current_id(), SDL_ThreadID());
@@ -0,0 +1,101 @@
+#include "thread/triple_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include "thread/thread.hpp"
+
+TEST(TripleBuffer, Defaults)
+{
+  cen::triple_buffer<int> buffer;
+  ASSERT_FALSE(buffer.has_fresh());
+  ASSERT_FALSE(buffer.acquire());
+  ASSERT_EQ(0, buffer.read());
+  ASSERT_EQ(0, buffer.write());
+}
+
+TEST(TripleBuffer, PublishAndAcquire)
+{
+  cen::triple_buffer<int> buffer;
+
+  buffer.write() = 7;
+  ASSERT_FALSE(buffer.publish());
+  ASSERT_TRUE(buffer.has_fresh());
+
+  ASSERT_TRUE(buffer.acquire());
+  ASSERT_EQ(7, buffer.read());
+  ASSERT_FALSE(buffer.has_fresh());
+
+  // The value is kept until a newer one is published
+  ASSERT_FALSE(buffer.acquire());
+  ASSERT_EQ(7, buffer.read());
+}
+
+TEST(TripleBuffer, DropsStaleValues)
+{
+  cen::triple_buffer<int> buffer;
+
+  buffer.write() = 1;
+  ASSERT_FALSE(buffer.publish());
+
+  buffer.write() = 2;
+  ASSERT_TRUE(buffer.publish());
+
+  ASSERT_TRUE(buffer.acquire());
+  ASSERT_EQ(2, buffer.read());
+}
+
+TEST(TripleBuffer, SlotsAreDistinct)
+{
+  cen::triple_buffer<int> buffer;
+
+  for (int i = 1; i <= 10; ++i)
+  {
+    buffer.write() = i;
+    buffer.publish();
+
+    ASSERT_NE(&buffer.write(), &buffer.read());
+    ASSERT_TRUE(buffer.acquire());
+    ASSERT_EQ(i, buffer.read());
+    ASSERT_NE(&buffer.write(), &buffer.read());
+  }
+}
+
+TEST(TripleBuffer, Threads)
+{
+  struct shared_data final
+  {
+    cen::triple_buffer<int> buffer;
+    int last{};
+    bool ordered{true};
+  };
+
+  shared_data shared;
+
+  {
+    cen::thread consumer{[](void* data) {
+                           auto& shared = *static_cast<shared_data*>(data);
+                           while (shared.last != 10'000)
+                           {
+                             if (shared.buffer.acquire())
+                             {
+                               const auto value = shared.buffer.read();
+                               shared.ordered &= value > shared.last;
+                               shared.last = value;
+                             }
+                           }
+
+                           return 0;
+                         },
+                         "consumer",
+                         &shared};
+
+    for (int i = 1; i <= 10'000; ++i)
+    {
+      shared.buffer.write() = i;
+      shared.buffer.publish();
+    }
+  }
+
+  ASSERT_TRUE(shared.ordered);
+  ASSERT_EQ(10'000, shared.last);
+}
@@ -0,0 +1,135 @@
+#include "video/async_texture_loader.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <string>  // string
+#include <vector>  // vector
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+class AsyncTextureLoaderTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  /// Updates the loader until the load has completed.
+  static void wait_for(cen::async_texture_loader& loader,
+                       const cen::async_texture_loader::id_type id)
+  {
+    while (loader.status(id) == cen::load_status::pending)
+    {
+      loader.update(*m_renderer);
+      cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+    }
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(AsyncTextureLoaderTest, Construction)
+{
+  const cen::async_texture_loader loader;
+  ASSERT_EQ(2u, loader.worker_count());
+
+  const cen::async_texture_loader single{0};
+  ASSERT_EQ(1u, single.worker_count());
+}
+
+TEST_F(AsyncTextureLoaderTest, Load)
+{
+  cen::async_texture_loader loader;
+
+  const auto id = loader.load("resources/panda.png");
+  ASSERT_EQ(cen::load_status::pending, loader.status(id));
+  ASSERT_EQ(1u, loader.pending_count());
+  ASSERT_FALSE(loader.try_get(id));
+
+  wait_for(loader, id);
+  ASSERT_TRUE(loader.is_ready(id));
+  ASSERT_EQ(0u, loader.pending_count());
+
+  const auto* texture = loader.try_get(id);
+  ASSERT_TRUE(texture);
+  ASSERT_EQ(200, texture->width());
+  ASSERT_EQ(150, texture->height());
+
+  auto taken = loader.take(id);
+  ASSERT_TRUE(taken);
+  ASSERT_EQ(cen::load_status::unknown, loader.status(id));
+  ASSERT_FALSE(loader.take(id));
+}
+
+TEST_F(AsyncTextureLoaderTest, LoadFailure)
+{
+  cen::async_texture_loader loader;
+
+  const auto id = loader.load("foobar.png");
+  wait_for(loader, id);
+
+  ASSERT_EQ(cen::load_status::failed, loader.status(id));
+  ASSERT_FALSE(loader.try_get(id));
+  ASSERT_FALSE(loader.take(id));
+  ASSERT_EQ(cen::load_status::unknown, loader.status(id));
+}
+
+TEST_F(AsyncTextureLoaderTest, LoadAll)
+{
+  cen::async_texture_loader loader;
+
+  const std::vector<std::string> paths{"resources/panda.png", "foobar.png"};
+  const auto ids = loader.load_all(paths);
+  ASSERT_EQ(2u, ids.size());
+  ASSERT_NE(ids.at(0), ids.at(1));
+  ASSERT_EQ(2u, loader.pending_count());
+
+  wait_for(loader, ids.at(0));
+  wait_for(loader, ids.at(1));
+
+  ASSERT_TRUE(loader.is_ready(ids.at(0)));
+  ASSERT_EQ(cen::load_status::failed, loader.status(ids.at(1)));
+}
+
+TEST_F(AsyncTextureLoaderTest, BoundedUploads)
+{
+  cen::async_texture_loader loader;
+
+  const auto a = loader.load("resources/panda.png");
+  const auto b = loader.load("resources/panda.png");
+  const auto c = loader.load("resources/panda.png");
+
+  std::size_t completed = 0;
+  while (completed < 3)
+  {
+    const auto count = loader.update(*m_renderer, 1);
+    ASSERT_GE(1u, count);
+    completed += count;
+  }
+
+  ASSERT_TRUE(loader.is_ready(a));
+  ASSERT_TRUE(loader.is_ready(b));
+  ASSERT_TRUE(loader.is_ready(c));
+}
+
+TEST_F(AsyncTextureLoaderTest, DestroyWithPendingLoads)
+{
+  cen::async_texture_loader loader{1};
+  for (int i = 0; i < 10; ++i)
+  {
+    loader.load("resources/panda.png");
+  }
+
+  ASSERT_EQ(10u, loader.pending_count());
+}
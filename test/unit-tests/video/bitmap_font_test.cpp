@@ -0,0 +1,171 @@
+#include "video/bitmap_font.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstring>    // strlen
+#include <memory>     // unique_ptr
+#include <stdexcept>  // out_of_range
+#include <string>     // string
+#include <type_traits>
+
+#include "core/exception.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::bitmap_font>);
+
+namespace {
+
+inline constexpr auto text_descriptor =
+    "info face=\"Test\" size=-12\n"
+    "common lineHeight=14 base=11 scaleW=64 scaleH=64 pages=1\n"
+    "page id=0 file=\"test_0.png\"\n"
+    "char id=65 x=1 y=2 width=7 height=9 xoffset=1 yoffset=2 xadvance=8 page=0\n"
+    "char id=-1 x=0 y=0 width=0 height=0 xoffset=0 yoffset=0 xadvance=0 page=0\n"
+    "kerning first=65 second=65 amount=-1\n";
+
+}  // namespace
+
+TEST(BitmapFont, ParseText)
+{
+  const cen::bitmap_font font{text_descriptor, std::strlen(text_descriptor)};
+
+  ASSERT_EQ("Test", font.family_name());
+  ASSERT_EQ(-12, font.point_size());
+  ASSERT_EQ(14, font.line_height());
+  ASSERT_EQ(11, font.base());
+  ASSERT_EQ(1u, font.glyph_count());
+  ASSERT_EQ(0u, font.page_count());
+  ASSERT_EQ(1u, font.page_files().size());
+  ASSERT_EQ("test_0.png", font.page_files().front());
+
+  ASSERT_TRUE(font.has('A'));
+  ASSERT_FALSE(font.has('B'));
+  ASSERT_EQ(nullptr, font.try_at('B'));
+  ASSERT_THROW((void) font.at('B'), std::out_of_range);
+
+  const auto& glyph = font['A'];
+  ASSERT_EQ(0u, glyph.page);
+  ASSERT_EQ((cen::irect{1, 2, 7, 9}), glyph.source);
+  ASSERT_EQ((cen::ipoint{1, 2}), glyph.offset);
+  ASSERT_EQ(8, glyph.advance);
+
+  ASSERT_TRUE(font.has_kerning());
+  ASSERT_EQ(-1, font.kerning('A', 'A'));
+  ASSERT_EQ(0, font.kerning('A', 'B'));
+}
+
+TEST(BitmapFont, ParseBinary)
+{
+  // clang-format off
+  const unsigned char descriptor[] = {
+    'B', 'M', 'F', 3,
+    1, 17, 0, 0, 0,  0x10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 'B', 'i', 0,
+    2, 15, 0, 0, 0,  18, 0, 14, 0, 128, 0, 128, 0, 1, 0, 0, 0, 0, 0, 0,
+    3, 6, 0, 0, 0,  'a', '.', 'p', 'n', 'g', 0,
+    4, 20, 0, 0, 0,  66, 0, 0, 0, 3, 0, 4, 0, 5, 0, 6, 0, 0xFF, 0xFF, 2, 0, 7, 0, 0, 15,
+    5, 10, 0, 0, 0,  66, 0, 0, 0, 66, 0, 0, 0, 0xFE, 0xFF,
+  };
+  // clang-format on
+
+  const cen::bitmap_font font{descriptor, sizeof descriptor};
+
+  ASSERT_EQ("Bi", font.family_name());
+  ASSERT_EQ(16, font.point_size());
+  ASSERT_EQ(18, font.line_height());
+  ASSERT_EQ(14, font.base());
+  ASSERT_EQ("a.png", font.page_files().at(0));
+
+  const auto& glyph = font.at('B');
+  ASSERT_EQ((cen::irect{3, 4, 5, 6}), glyph.source);
+  ASSERT_EQ((cen::ipoint{-1, 2}), glyph.offset);
+  ASSERT_EQ(7, glyph.advance);
+  ASSERT_EQ(-2, font.kerning('B', 'B'));
+}
+
+TEST(BitmapFont, InvalidDescriptor)
+{
+  const auto* noCommon = "page id=0 file=\"a.png\"\n";
+  ASSERT_THROW(cen::bitmap_font(noCommon, std::strlen(noCommon)), cen::cen_error);
+
+  const auto* badNumber = "common lineHeight=x pages=0\n";
+  ASSERT_THROW(cen::bitmap_font(badNumber, std::strlen(badNumber)), cen::cen_error);
+
+  const auto* missingPage =
+      "common lineHeight=8 pages=1\n"
+      "page id=0 file=\"a.png\"\n"
+      "char id=65 page=1\n";
+  ASSERT_THROW(cen::bitmap_font(missingPage, std::strlen(missingPage)), cen::cen_error);
+
+  // Page IDs must not exceed the page count, which would allocate as many pages
+  const auto* hugePageId =
+      "common lineHeight=8 pages=1\n"
+      "page id=2000000000 file=\"a.png\"\n";
+  ASSERT_THROW(cen::bitmap_font(hugePageId, std::strlen(hugePageId)), cen::cen_error);
+
+  const auto* hugePageIdWithoutCount =
+      "common lineHeight=8\n"
+      "page id=2000000000 file=\"a.png\"\n";
+  ASSERT_THROW(
+      cen::bitmap_font(hugePageIdWithoutCount, std::strlen(hugePageIdWithoutCount)),
+      cen::cen_error);
+
+  const unsigned char truncated[] = {'B', 'M', 'F', 3, 2, 15, 0, 0, 0, 18};
+  ASSERT_THROW(cen::bitmap_font(truncated, sizeof truncated), cen::cen_error);
+}
+
+class BitmapFontRenderTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_font = std::make_unique<cen::bitmap_font>(*m_renderer, m_path);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_font.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline constexpr static auto m_path = "resources/panda.fnt";
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::bitmap_font> m_font;
+};
+
+TEST_F(BitmapFontRenderTest, Load)
+{
+  ASSERT_EQ(1u, m_font->page_count());
+  ASSERT_EQ((cen::iarea{200, 150}), m_font->page(0).size());
+  ASSERT_THROW((void) m_font->page(1), std::out_of_range);
+  ASSERT_EQ(3u, m_font->glyph_count());
+  ASSERT_EQ(20, m_font->line_height());
+}
+
+TEST_F(BitmapFontRenderTest, RenderGlyph)
+{
+  ASSERT_EQ(22, m_renderer->render_glyph(*m_font, 'A', {10, 0}));
+  ASSERT_EQ(10, m_renderer->render_glyph(*m_font, 'Z', {10, 0}));
+}
+
+TEST_F(BitmapFontRenderTest, RenderText)
+{
+  const cen::unicode_string str{'A', 'V', '\n', 'A', ' ', 'V'};
+  ASSERT_NO_THROW(m_renderer->render_text(*m_font, str, {10, 10}));
+
+  const auto layout = m_renderer->render_text_batched(*m_font, str, {10, 10});
+
+  // The pen ends after "A V" on the second line: 10 + 12 + 6 + 11
+  ASSERT_EQ((cen::ipoint{39, 30}), layout.pen);
+
+  // The first "A" starts at x = 11, the last "V" covers [28, 38)
+  ASSERT_EQ(11, layout.bounds.x());
+  ASSERT_EQ(12, layout.bounds.y());
+  ASSERT_EQ(38 - 11, layout.bounds.width());
+  ASSERT_EQ(48 - 12, layout.bounds.height());
+}
@@ -0,0 +1,204 @@
+#include "video/blit_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>  // abs
+
+#include "thread/thread_pool.hpp"
+#include "video/colors.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_filled(
+    const cen::iarea size,
+    const cen::color& color,
+    const cen::pixel_format format = cen::pixel_format::rgba8888) -> cen::surface
+{
+  cen::surface surface{size, format};
+  for (int y = 0; y < size.height; ++y)
+  {
+    for (int x = 0; x < size.width; ++x)
+    {
+      surface.set_pixel({x, y}, color);
+    }
+  }
+
+  return surface;
+}
+
+[[nodiscard]] auto make_pattern(const cen::iarea size) -> cen::surface
+{
+  cen::surface surface{size, cen::pixel_format::argb8888};
+  for (int y = 0; y < size.height; ++y)
+  {
+    for (int x = 0; x < size.width; ++x)
+    {
+      const auto value = static_cast<cen::u8>((x * 7 + y * 13) & 0xFF);
+      surface.set_pixel({x, y}, cen::color{value, 0x40, 0xC0, value});
+    }
+  }
+
+  return surface;
+}
+
+[[nodiscard]] auto pixel_at(const cen::surface& surface, const cen::ipoint position)
+    -> cen::color
+{
+  const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+  const auto index = position.y() * (surface.pitch() / 4) + position.x();
+  return surface.format_info().pixel_to_rgba(pixels[index]);
+}
+
+// SDL truncates the intermediate products, whereas the kernels round to nearest
+void assert_near(const cen::color& expected, const cen::color& actual)
+{
+  ASSERT_LE(std::abs(expected.red() - actual.red()), 2);
+  ASSERT_LE(std::abs(expected.green() - actual.green()), 2);
+  ASSERT_LE(std::abs(expected.blue() - actual.blue()), 2);
+  ASSERT_LE(std::abs(expected.alpha() - actual.alpha()), 2);
+}
+
+}  // namespace
+
+TEST(BlitBatch, Defaults)
+{
+  cen::blit_batch batch;
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.size());
+
+  auto target = make_filled({8, 8}, cen::colors::black);
+  ASSERT_TRUE(batch.blit(target));
+}
+
+TEST(BlitBatch, Clipping)
+{
+  auto target = make_filled({16, 16}, cen::colors::black);
+  const auto source = make_filled({8, 8}, cen::colors::red);
+
+  cen::blit_batch batch;
+  batch.add(source, {-4, -4});
+  batch.add(source, {12, 12});
+  batch.add(source, {100, 100});
+  ASSERT_EQ(3u, batch.size());
+
+  ASSERT_TRUE(batch.blit(target));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, {0, 0}));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, {3, 3}));
+  ASSERT_EQ(cen::colors::black, pixel_at(target, {4, 4}));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, {15, 15}));
+  ASSERT_EQ(cen::colors::black, pixel_at(target, {11, 11}));
+
+  batch.clear();
+  ASSERT_TRUE(batch.empty());
+}
+
+TEST(BlitBatch, SourceRect)
+{
+  auto target = make_filled({8, 8}, cen::colors::black);
+  const auto source = make_pattern({8, 8});
+
+  cen::blit_batch batch;
+  batch.add(source, cen::irect{2, 2, 4, 4}, {0, 0});
+  ASSERT_TRUE(batch.blit(target));
+
+  auto expected = make_filled({8, 8}, cen::colors::black);
+  SDL_Rect src{2, 2, 4, 4};
+  SDL_Rect dst{0, 0, 4, 4};
+  ASSERT_EQ(0, SDL_BlitSurface(source.get(), &src, expected.get(), &dst));
+
+  for (int y = 0; y < 8; ++y)
+  {
+    for (int x = 0; x < 8; ++x)
+    {
+      assert_near(pixel_at(expected, {x, y}), pixel_at(target, {x, y}));
+    }
+  }
+}
+
+TEST(BlitBatch, Layers)
+{
+  auto target = make_filled({4, 4}, cen::colors::black);
+  auto red = make_filled({4, 4}, cen::colors::red);
+  auto blue = make_filled({4, 4}, cen::colors::blue);
+
+  cen::blit_batch batch;
+  batch.add(red, {0, 0}, 1);
+  batch.add(blue, {0, 0}, 0);
+  ASSERT_TRUE(batch.blit(target));
+  ASSERT_EQ(cen::colors::red, pixel_at(target, {0, 0}));
+
+  // Blits in the same layer are performed in the order that they were added
+  batch.clear();
+  batch.add(red, {0, 0});
+  batch.add(blue, {0, 0});
+  ASSERT_TRUE(batch.blit(target));
+  ASSERT_EQ(cen::colors::blue, pixel_at(target, {0, 0}));
+}
+
+TEST(BlitBatch, BlendModes)
+{
+  const cen::color base{0x40, 0x80, 0xC0, 0xFF};
+  const cen::color overlay{0xFF, 0x40, 0x00, 0x80};
+
+  for (const auto mode : {cen::blend_mode::none,
+                          cen::blend_mode::blend,
+                          cen::blend_mode::add,
+                          cen::blend_mode::mod})
+  {
+    auto source = make_filled({5, 3}, overlay, cen::pixel_format::argb8888);
+    source.set_blend_mode(mode);
+
+    auto target = make_filled({5, 3}, base);
+    auto expected = make_filled({5, 3}, base);
+    ASSERT_EQ(0, SDL_BlitSurface(source.get(), nullptr, expected.get(), nullptr));
+
+    cen::blit_batch batch;
+    batch.add(source, {0, 0});
+    ASSERT_TRUE(batch.blit(target));
+
+    assert_near(pixel_at(expected, {2, 1}), pixel_at(target, {2, 1}));
+  }
+}
+
+TEST(BlitBatch, Fallback)
+{
+  auto target = make_filled({4, 4}, cen::colors::black);
+  auto expected = make_filled({4, 4}, cen::colors::black);
+
+  // Blits with color modulation are forwarded to SDL
+  auto source = make_filled({4, 4}, cen::colors::white);
+  source.set_color_mod(cen::colors::lime);
+  ASSERT_EQ(0, SDL_BlitSurface(source.get(), nullptr, expected.get(), nullptr));
+
+  cen::blit_batch batch;
+  batch.add(source, {0, 0});
+  ASSERT_TRUE(batch.blit(target));
+  ASSERT_EQ(pixel_at(expected, {1, 1}), pixel_at(target, {1, 1}));
+}
+
+TEST(BlitBatch, Parallel)
+{
+  const auto source = make_pattern({40, 70});
+
+  auto serial = make_filled({100, 100}, cen::colors::gray);
+  auto parallel = make_filled({100, 100}, cen::colors::gray);
+
+  cen::blit_batch batch;
+  for (int index = 0; index < 10; ++index)
+  {
+    batch.add(source, {index * 9 - 10, index * 7 - 5}, index % 3);
+  }
+
+  ASSERT_TRUE(batch.blit(serial));
+
+  cen::thread_pool pool{3};
+  ASSERT_TRUE(batch.blit(pool, parallel));
+
+  for (int y = 0; y < 100; ++y)
+  {
+    for (int x = 0; x < 100; ++x)
+    {
+      ASSERT_EQ(pixel_at(serial, {x, y}), pixel_at(parallel, {x, y}));
+    }
+  }
+}
@@ -0,0 +1,146 @@
+#include "video/color_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>  // abs
+#include <vector>   // vector
+
+#include "video/colors.hpp"
+
+namespace {
+
+void assert_near(const cen::color& expected, const cen::color& actual)
+{
+  ASSERT_LE(std::abs(expected.red() - actual.red()), 1);
+  ASSERT_LE(std::abs(expected.green() - actual.green()), 1);
+  ASSERT_LE(std::abs(expected.blue() - actual.blue()), 1);
+  ASSERT_EQ(expected.alpha(), actual.alpha());
+}
+
+}  // namespace
+
+TEST(ColorBatch, LerpColors)
+{
+  const std::vector a(19, cen::colors::red);
+  const std::vector b(19, cen::colors::blue);
+  std::vector<cen::color> out(19);
+
+  cen::lerp_colors(a.data(), b.data(), out.data(), out.size());
+  for (const auto& color : out)
+  {
+    assert_near(cen::blend(cen::colors::red, cen::colors::blue), color);
+  }
+
+  cen::lerp_colors(a.data(), b.data(), out.data(), out.size(), 1.0f);
+  ASSERT_EQ(cen::colors::blue, out.back());
+}
+
+TEST(ColorBatch, MultiplyColors)
+{
+  std::vector colors(13, cen::colors::orange);
+  const std::vector white(13, cen::colors::white);
+  const std::vector black(13, cen::colors::black);
+
+  cen::multiply_colors(colors.data(), white.data(), colors.data(), colors.size());
+  ASSERT_EQ(cen::colors::orange, colors.front());
+
+  cen::multiply_colors(colors.data(), black.data(), colors.data(), colors.size());
+  ASSERT_EQ(cen::colors::black, colors.back());
+}
+
+TEST(ColorBatch, CompositeColors)
+{
+  const std::vector source(11, cen::color{0x40, 0, 0, 0x80});
+  const std::vector destination(11, cen::colors::blue);
+  std::vector<cen::color> out(11);
+
+  cen::composite_colors(source.data(), destination.data(), out.data(), out.size());
+  ASSERT_EQ(cen::color(0x40, 0, 0x7F, 0xFF), out.front());
+  ASSERT_EQ(cen::color(0x40, 0, 0x7F, 0xFF), out.back());
+}
+
+TEST(ColorBatch, FromHsv)
+{
+  std::vector<float> hues;
+  std::vector<float> saturations;
+  std::vector<float> values;
+
+  for (int hue = 0; hue <= 360; hue += 15)
+  {
+    for (int saturation = 0; saturation <= 100; saturation += 25)
+    {
+      hues.push_back(static_cast<float>(hue));
+      saturations.push_back(static_cast<float>(saturation));
+      values.push_back(static_cast<float>((hue + saturation) % 101));
+    }
+  }
+
+  std::vector<cen::color> hsv(hues.size());
+  cen::colors_from_hsv(hues.data(),
+                       saturations.data(),
+                       values.data(),
+                       hsv.data(),
+                       hsv.size());
+
+  std::vector<cen::color> hsl(hues.size());
+  cen::colors_from_hsl(hues.data(),
+                       saturations.data(),
+                       values.data(),
+                       hsl.data(),
+                       hsl.size());
+
+  for (std::size_t index = 0; index < hues.size(); ++index)
+  {
+    assert_near(cen::color::from_hsv(hues[index], saturations[index], values[index]),
+                hsv[index]);
+
+    // A hue of 360 is the same as 0, which color::from_hsl() produces gray for
+    if (hues[index] < 360.0f)
+    {
+      assert_near(cen::color::from_hsl(hues[index], saturations[index], values[index]),
+                  hsl[index]);
+    }
+    else
+    {
+      assert_near(cen::color::from_hsl(0, saturations[index], values[index]),
+                  hsl[index]);
+    }
+  }
+}
+
+TEST(ColorBatch, ToHsv)
+{
+  const std::vector colors = {cen::colors::red,
+                              cen::colors::lime,
+                              cen::colors::blue,
+                              cen::colors::white,
+                              cen::colors::black};
+
+  std::vector<float> hues(colors.size());
+  std::vector<float> saturations(colors.size());
+  std::vector<float> values(colors.size());
+  cen::colors_to_hsv(colors.data(),
+                     hues.data(),
+                     saturations.data(),
+                     values.data(),
+                     colors.size());
+
+  ASSERT_FLOAT_EQ(0.0f, hues[0]);
+  ASSERT_FLOAT_EQ(120.0f, hues[1]);
+  ASSERT_FLOAT_EQ(240.0f, hues[2]);
+  ASSERT_FLOAT_EQ(100.0f, saturations[0]);
+  ASSERT_FLOAT_EQ(0.0f, saturations[3]);
+  ASSERT_FLOAT_EQ(100.0f, values[3]);
+  ASSERT_FLOAT_EQ(0.0f, values[4]);
+
+  cen::colors_to_hsl(colors.data(),
+                     hues.data(),
+                     saturations.data(),
+                     values.data(),
+                     colors.size());
+
+  ASSERT_FLOAT_EQ(240.0f, hues[2]);
+  ASSERT_FLOAT_EQ(100.0f, saturations[2]);
+  ASSERT_FLOAT_EQ(50.0f, values[2]);
+  ASSERT_FLOAT_EQ(100.0f, values[3]);
+}
@@ -0,0 +1,87 @@
+#include "video/color_ramp.hpp"
+
+#include <gtest/gtest.h>
+
+#include "video/colors.hpp"
+
+TEST(ColorRamp, Constructor)
+{
+  ASSERT_THROW(cen::color_ramp(nullptr, 0), cen::cen_error);
+
+  const cen::color_ramp ramp{{0, cen::colors::red}};
+  ASSERT_EQ(256u, ramp.size());
+  ASSERT_EQ(cen::colors::red, ramp[0]);
+  ASSERT_EQ(cen::colors::red, ramp[255]);
+
+  const cen::color_ramp large{{{0, cen::colors::red}}, 4096};
+  ASSERT_EQ(4096u, large.size());
+  ASSERT_EQ(large.size(), static_cast<std::size_t>(large.end() - large.begin()));
+  ASSERT_EQ(large.data(), large.begin());
+}
+
+TEST(ColorRamp, Interpolation)
+{
+  const cen::color_ramp ramp{{1, cen::color{0, 0, 255, 0}},
+                             {0, cen::color{0, 0, 0, 255}},
+                             {0.5f, cen::color{255, 0, 0, 255}}};
+
+  ASSERT_EQ(cen::color(0, 0, 0, 255), ramp[0]);
+  ASSERT_EQ(cen::color(0, 0, 255, 0), ramp[255]);
+
+  // Position 0.25 is halfway between the first two stops
+  const auto quarter = ramp.sample(0.25f);
+  ASSERT_NEAR(128, quarter.red(), 1);
+  ASSERT_EQ(0, quarter.blue());
+  ASSERT_EQ(255, quarter.alpha());
+
+  const auto threeQuarters = ramp.sample(0.75f);
+  ASSERT_NEAR(128, threeQuarters.red(), 1);
+  ASSERT_NEAR(128, threeQuarters.blue(), 1);
+  ASSERT_NEAR(128, threeQuarters.alpha(), 1);
+}
+
+TEST(ColorRamp, HardEdge)
+{
+  const cen::color_ramp ramp{{{0, cen::colors::black},
+                              {0.5f, cen::colors::black},
+                              {0.5f, cen::colors::white},
+                              {1, cen::colors::white}},
+                             5};
+
+  ASSERT_EQ(cen::colors::black, ramp[0]);
+  ASSERT_EQ(cen::colors::black, ramp[1]);
+  ASSERT_EQ(cen::colors::white, ramp[2]);
+  ASSERT_EQ(cen::colors::white, ramp[4]);
+}
+
+TEST(ColorRamp, StopsInside)
+{
+  const cen::color_ramp ramp{{0.25f, cen::colors::red}, {0.75f, cen::colors::blue}};
+
+  ASSERT_EQ(cen::colors::red, ramp[0]);
+  ASSERT_EQ(cen::colors::red, ramp.sample(0.2f));
+  ASSERT_EQ(cen::colors::blue, ramp.sample(0.8f));
+  ASSERT_EQ(cen::colors::blue, ramp[255]);
+}
+
+TEST(ColorRamp, Sample)
+{
+  const cen::color_ramp ramp{{0, cen::colors::black}, {1, cen::colors::white}};
+
+  ASSERT_EQ(ramp[0], ramp.sample(-1));
+  ASSERT_EQ(ramp[0], ramp.sample(0));
+  ASSERT_EQ(ramp[128], ramp.sample(0.5f));
+  ASSERT_EQ(ramp[255], ramp.sample(1));
+  ASSERT_EQ(ramp[255], ramp.sample(2));
+}
+
+TEST(ColorRamp, ToPalette)
+{
+  const cen::color_ramp ramp{{{0, cen::colors::black}, {1, cen::colors::white}}, 4096};
+  const auto palette = ramp.to_palette();
+
+  ASSERT_EQ(256, palette.size());
+  ASSERT_EQ(cen::colors::black, palette[0]);
+  ASSERT_EQ(cen::colors::white, palette[255]);
+  ASSERT_EQ(ramp.sample(128.0f / 255.0f), palette[128]);
+}
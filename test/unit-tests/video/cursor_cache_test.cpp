@@ -0,0 +1,72 @@
+#include "video/cursor_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+
+TEST(CursorCache, SystemCursors)
+{
+  cen::cursor_cache cache;
+  ASSERT_EQ(0u, cache.size());
+
+  // System cursors are only created once
+  const auto hand = cache.get(cen::system_cursor::hand);
+  ASSERT_TRUE(hand);
+  ASSERT_EQ(hand.get(), cache.get(cen::system_cursor::hand).get());
+  ASSERT_EQ(1u, cache.size());
+
+  cache.enable(cen::system_cursor::crosshair);
+  ASSERT_TRUE(cache.get(cen::system_cursor::crosshair).is_enabled());
+  ASSERT_EQ(2u, cache.size());
+
+  cache.enable(cen::system_cursor::hand);
+  ASSERT_TRUE(hand.is_enabled());
+  ASSERT_EQ(2u, cache.size());
+}
+
+TEST(CursorCache, SurfaceCursors)
+{
+  const cen::surface surface{"resources/panda.png"};
+
+  cen::cursor_cache cache;
+  ASSERT_FALSE(cache.has_stored(7));
+  ASSERT_FALSE(cache.get(7));
+  ASSERT_FALSE(cache.enable(7));
+
+  ASSERT_THROW(cache.store(7, surface, {8341, 2342}), cen::sdl_error);
+  ASSERT_FALSE(cache.has_stored(7));
+
+  cache.store(7, surface, {12, 14});
+  ASSERT_TRUE(cache.has_stored(7));
+  ASSERT_TRUE(cache.get(7));
+
+  ASSERT_TRUE(cache.enable(7));
+  ASSERT_TRUE(cache.get(7).is_enabled());
+
+  // Replacing the active cursor keeps the new cursor active
+  cache.store(7, surface, {1, 1});
+  ASSERT_TRUE(cache.get(7).is_enabled());
+  ASSERT_EQ(1u, cache.size());
+
+  cache.remove_stored(7);
+  ASSERT_FALSE(cache.has_stored(7));
+  ASSERT_EQ(cen::cursor::get_default().get(), cen::cursor::get_current().get());
+}
+
+TEST(CursorCache, Clear)
+{
+  {
+    cen::cursor_cache cache;
+    cache.enable(cen::system_cursor::wait);
+    ASSERT_NE(cen::cursor::get_default().get(), cen::cursor::get_current().get());
+
+    cache.clear();
+    ASSERT_EQ(0u, cache.size());
+    ASSERT_EQ(cen::cursor::get_default().get(), cen::cursor::get_current().get());
+
+    cache.enable(cen::system_cursor::wait);
+  }
+
+  // The default cursor is restored by the destructor
+  ASSERT_EQ(cen::cursor::get_default().get(), cen::cursor::get_current().get());
+}
@@ -0,0 +1,127 @@
+#include "video/dirty_region.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+static_assert(std::is_final_v<cen::dirty_region>);
+
+TEST(DirtyRegion, Defaults)
+{
+  const cen::dirty_region region;
+  ASSERT_TRUE(region.empty());
+  ASSERT_EQ(0u, region.count());
+  ASSERT_EQ(0, region.area());
+  ASSERT_EQ(16u, region.max_rects());
+  ASSERT_FALSE(region.bounds().has_area());
+
+  ASSERT_EQ(1u, cen::dirty_region{0}.max_rects());
+}
+
+TEST(DirtyRegion, AddEmpty)
+{
+  cen::dirty_region region;
+  region.add({10, 10, 0, 5});
+  region.add({10, 10, 5, -1});
+  ASSERT_TRUE(region.empty());
+}
+
+TEST(DirtyRegion, AddDisjoint)
+{
+  cen::dirty_region region;
+  region.add({0, 0, 10, 10});
+  region.add({50, 50, 10, 10});
+
+  ASSERT_EQ(2u, region.count());
+  ASSERT_EQ(200, region.area());
+  ASSERT_EQ((cen::irect{0, 0, 60, 60}), region.bounds());
+}
+
+TEST(DirtyRegion, MergeOverlapping)
+{
+  cen::dirty_region region;
+  region.add({0, 0, 10, 10});
+  region.add({5, 5, 10, 10});
+
+  ASSERT_EQ(1u, region.count());
+  ASSERT_EQ((cen::irect{0, 0, 15, 15}), region.rects().front());
+}
+
+TEST(DirtyRegion, MergeAdjacent)
+{
+  cen::dirty_region region;
+  region.add({0, 0, 10, 10});
+  region.add({10, 0, 10, 10});  // Same height, right next to the first one
+
+  ASSERT_EQ(1u, region.count());
+  ASSERT_EQ((cen::irect{0, 0, 20, 10}), region.rects().front());
+
+  // Diagonal neighbours are not merged, since that would cover more pixels
+  region.add({20, 10, 10, 10});
+  ASSERT_EQ(2u, region.count());
+}
+
+TEST(DirtyRegion, MergeCascade)
+{
+  cen::dirty_region region;
+  region.add({0, 0, 10, 10});
+  region.add({20, 0, 10, 10});
+  ASSERT_EQ(2u, region.count());
+
+  // Bridges the two rectangles, which results in a single rectangle
+  region.add({5, 0, 20, 10});
+  ASSERT_EQ(1u, region.count());
+  ASSERT_EQ((cen::irect{0, 0, 30, 10}), region.rects().front());
+}
+
+TEST(DirtyRegion, Contained)
+{
+  cen::dirty_region region;
+  region.add({0, 0, 100, 100});
+  region.add({10, 10, 5, 5});
+
+  ASSERT_EQ(1u, region.count());
+  ASSERT_EQ(100 * 100, region.area());
+}
+
+TEST(DirtyRegion, Collapse)
+{
+  cen::dirty_region region{3};
+  region.add({0, 0, 1, 1});
+  region.add({10, 0, 1, 1});
+  region.add({20, 0, 1, 1});
+  ASSERT_EQ(3u, region.count());
+
+  region.add({30, 0, 1, 1});
+  ASSERT_EQ(1u, region.count());
+  ASSERT_EQ((cen::irect{0, 0, 31, 1}), region.rects().front());
+}
+
+TEST(DirtyRegion, Invalidate)
+{
+  cen::dirty_region region;
+  region.add({0, 0, 10, 10});
+  region.add({50, 50, 10, 10});
+
+  region.invalidate({800, 600});
+  ASSERT_EQ(1u, region.count());
+  ASSERT_EQ((cen::irect{0, 0, 800, 600}), region.rects().front());
+
+  region.clear();
+  ASSERT_TRUE(region.empty());
+}
+
+TEST(DirtyRegion, Present)
+{
+  cen::window window;
+
+  cen::dirty_region region;
+  ASSERT_TRUE(region.present(window));
+
+  ASSERT_TRUE(window.get_surface());
+
+  region.add({-10, -10, 50, 50});  // Clipped to the surface
+  region.add({100, 100, 20, 20});
+  ASSERT_TRUE(region.present(window));
+  ASSERT_TRUE(region.empty());
+}
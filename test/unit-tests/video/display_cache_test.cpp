@@ -0,0 +1,72 @@
+#include "video/display_cache.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(DisplayCache, Displays)
+{
+  cen::display_cache cache;
+  ASSERT_EQ(0u, cache.refresh_count());
+
+  const auto& displays = cache.displays();
+  ASSERT_EQ(cen::screen::count(), static_cast<int>(displays.size()));
+  ASSERT_EQ(1u, cache.refresh_count());
+
+  // The snapshot is reused until the cache is invalidated
+  ASSERT_EQ(&displays, &cache.displays());
+  ASSERT_EQ(1u, cache.refresh_count());
+
+  cache.invalidate();
+  ASSERT_EQ(cen::screen::count(), static_cast<int>(cache.displays().size()));
+  ASSERT_EQ(2u, cache.refresh_count());
+}
+
+TEST(DisplayCache, Find)
+{
+  cen::display_cache cache;
+  ASSERT_FALSE(cache.find(-1));
+  ASSERT_FALSE(cache.find(cen::screen::count()));
+
+  if (const auto* display = cache.find(0))
+  {
+    ASSERT_EQ(0, display->index);
+    ASSERT_EQ(cen::screen::refresh_rate().value_or(0), display->refresh_rate);
+    ASSERT_EQ(cen::screen::bounds().value(), display->bounds);
+  }
+}
+
+TEST(DisplayCache, Handle)
+{
+  cen::display_cache cache;
+  static_cast<void>(cache.displays());
+
+  SDL_Event event{};
+  event.type = SDL_KEYDOWN;
+  ASSERT_FALSE(cache.handle(event));
+
+  event.type = SDL_WINDOWEVENT;
+  event.window.event = SDL_WINDOWEVENT_FOCUS_GAINED;
+  ASSERT_FALSE(cache.handle(event));
+
+  event.window.event = SDL_WINDOWEVENT_SIZE_CHANGED;
+  ASSERT_TRUE(cache.handle(event));
+
+  event.type = SDL_DISPLAYEVENT;
+  ASSERT_TRUE(cache.handle(event));
+
+  static_cast<void>(cache.displays());
+  ASSERT_EQ(2u, cache.refresh_count());
+}
+
+TEST(DisplayCache, EventWatch)
+{
+  cen::display_cache cache;
+  static_cast<void>(cache.displays());
+
+  SDL_Event event{};
+  event.type = SDL_DISPLAYEVENT;
+  SDL_PushEvent(&event);
+  SDL_FlushEvent(SDL_DISPLAYEVENT);
+
+  static_cast<void>(cache.displays());
+  ASSERT_EQ(2u, cache.refresh_count());
+}
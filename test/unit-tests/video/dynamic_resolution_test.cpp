@@ -0,0 +1,129 @@
+#include "video/dynamic_resolution.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+#include "video/window.hpp"
+
+using ms = cen::milliseconds<double>;
+
+class DynamicResolutionTest : public testing::Test
+{
+ protected:
+  cen::window m_window;
+  cen::renderer m_renderer{m_window};
+  cen::texture_pool m_pool;
+};
+
+TEST_F(DynamicResolutionTest, Construction)
+{
+  {
+    cen::dynamic_resolution_settings settings;
+    settings.min_scale = 0;
+    ASSERT_THROW(cen::dynamic_resolution(m_renderer, m_pool, settings), cen::cen_error);
+  }
+
+  {
+    cen::dynamic_resolution_settings settings;
+    settings.max_scale = 1.5f;
+    ASSERT_THROW(cen::dynamic_resolution(m_renderer, m_pool, settings), cen::cen_error);
+  }
+
+  {
+    cen::dynamic_resolution_settings settings;
+    settings.target = ms{0};
+    ASSERT_THROW(cen::dynamic_resolution(m_renderer, m_pool, settings), cen::cen_error);
+  }
+
+  const cen::dynamic_resolution resolution{m_renderer, m_pool};
+  ASSERT_EQ(1.0f, resolution.scale());
+  ASSERT_EQ((cen::iarea{0, 0}), resolution.scene_size());
+}
+
+TEST_F(DynamicResolutionTest, Record)
+{
+  cen::dynamic_resolution_settings settings;
+  settings.target = ms{10};
+  settings.cooldown = 4;
+  settings.smoothing = 1;
+
+  cen::dynamic_resolution resolution{m_renderer, m_pool, settings};
+
+  // Changes are only made once the cooldown has passed
+  ASSERT_FALSE(resolution.record(ms{40}));
+  ASSERT_FALSE(resolution.record(ms{40}));
+  ASSERT_FALSE(resolution.record(ms{40}));
+  ASSERT_TRUE(resolution.record(ms{40}));
+
+  // Four times the target takes half the resolution
+  ASSERT_FLOAT_EQ(0.5f, resolution.scale());
+
+  // The scale never goes below the minimum
+  for (int i = 0; i < 8; ++i)
+  {
+    resolution.record(ms{40});
+  }
+  ASSERT_FLOAT_EQ(settings.min_scale, resolution.scale());
+
+  // The scale is raised one step at a time when there's headroom
+  for (int i = 0; i < 4; ++i)
+  {
+    resolution.record(ms{1});
+  }
+  ASSERT_FLOAT_EQ(0.55f, resolution.scale());
+
+  // Frame times between the headroom and the target keep the scale
+  for (int i = 0; i < 8; ++i)
+  {
+    ASSERT_FALSE(resolution.record(ms{9}));
+  }
+
+  resolution.reset();
+  ASSERT_EQ(1.0f, resolution.scale());
+}
+
+TEST_F(DynamicResolutionTest, Update)
+{
+  cen::dynamic_resolution_settings settings;
+  settings.cooldown = 1;
+  settings.smoothing = 1;
+
+  cen::dynamic_resolution resolution{m_renderer, m_pool, settings};
+  cen::frame_stats<> stats;
+
+  // Nothing is recorded until the stats have a new frame
+  ASSERT_FALSE(resolution.update(stats));
+
+  stats.record(ms{100});
+  ASSERT_TRUE(resolution.update(stats));
+  ASSERT_FALSE(resolution.update(stats));
+  ASSERT_GT(1.0f, resolution.scale());
+}
+
+TEST_F(DynamicResolutionTest, Frame)
+{
+  cen::dynamic_resolution_settings settings;
+  settings.cooldown = 1;
+  settings.smoothing = 1;
+  settings.target = ms{10};
+
+  cen::dynamic_resolution resolution{m_renderer, m_pool, settings};
+
+  ASSERT_TRUE(resolution.begin_frame());
+  ASSERT_TRUE(resolution.end_frame());
+  ASSERT_EQ(m_renderer.output_size(), resolution.scene_size());
+
+  resolution.record(ms{40});
+  ASSERT_TRUE(resolution.begin_frame());
+  ASSERT_TRUE(resolution.end_frame());
+
+  const auto output = m_renderer.output_size();
+  ASSERT_EQ((cen::iarea{output.width / 2, output.height / 2}), resolution.scene_size());
+
+  // Textures of previously used sizes are recycled
+  resolution.reset();
+  ASSERT_TRUE(resolution.begin_frame());
+  ASSERT_TRUE(resolution.end_frame());
+  ASSERT_EQ(2u, m_pool.created_count());
+  ASSERT_EQ(1u, m_pool.reused_count());
+}
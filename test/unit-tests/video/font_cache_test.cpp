@@ -4,6 +4,7 @@
 
 #include <functional>   // function
 #include <memory>       // unique_ptr
+#include <stdexcept>    // out_of_range
 #include <string_view>  // string_view
 
 #include "video/font.hpp"
@@ -12,6 +13,7 @@
 
 namespace {
 inline constexpr auto fontPath = "resources/daniel.ttf";
+inline constexpr auto fallbackPath = "resources/fira_code.ttf";
 }
 
 TEST(FontCache, FontConstructor)
@@ -338,3 +340,312 @@ TEST_F(FontCacheTest, GetFont)
   const auto& font = m_cache.get_font();
   ASSERT_EQ(font.family_name(), std::string("Daniel"));
 }
+
+TEST_F(FontCacheTest, GlyphAtlas)
+{
+  ASSERT_FALSE(m_cache.is_using_glyph_atlas());
+  ASSERT_EQ(0u, m_cache.glyph_page_count());
+
+  m_cache.enable_glyph_atlas({256, 256});
+  ASSERT_TRUE(m_cache.is_using_glyph_atlas());
+
+  m_cache.add_latin1(*m_renderer);
+  ASSERT_TRUE(m_cache.has('a'));
+  ASSERT_FALSE(m_cache.try_at('a'));
+  ASSERT_LE(1u, m_cache.glyph_page_count());
+
+  const auto* a = m_cache.try_at_atlas('a');
+  ASSERT_TRUE(a);
+  ASSERT_TRUE(a->source.has_area());
+  ASSERT_TRUE(m_cache.glyph_page(a->page).get());
+  ASSERT_FALSE(m_cache.try_at_atlas(0x7F));
+
+  const cen::unicode_string str{'a', 'b', '\n', 'c'};
+  ASSERT_NO_THROW(m_renderer->render_text(m_cache, str, {10, 10}));
+  ASSERT_LT(10, m_renderer->render_glyph(m_cache, 'a', {10, 10}));
+}
+
+TEST_F(FontCacheTest, EnableGlyphAtlasAfterCaching)
+{
+  m_cache.add_glyph(*m_renderer, 'a');
+  ASSERT_THROW(m_cache.enable_glyph_atlas(), cen::cen_error);
+}
+
+TEST_F(FontCacheTest, Kerning)
+{
+  const auto amount = m_cache.get_font().kerning_amount('A', 'V');
+  ASSERT_EQ(amount, m_cache.kerning('A', 'V'));
+  ASSERT_EQ(amount, m_cache.kerning('A', 'V'));
+}
+
+TEST_F(FontCacheTest, RenderTextBatched)
+{
+  const cen::unicode_string str{'A', 'V', '\n', 'a'};
+
+  m_cache.add_basic_latin(*m_renderer);
+  const auto layout = m_renderer->render_text_batched(m_cache, str, {10, 20});
+  ASSERT_LT(10, layout.pen.x());
+  ASSERT_LT(20, layout.pen.y());
+  ASSERT_TRUE(layout.bounds.has_area());
+
+  const auto empty =
+      m_renderer->render_text_batched(m_cache, cen::unicode_string{}, {5, 5});
+  ASSERT_EQ(5, empty.pen.x());
+  ASSERT_FALSE(empty.bounds.has_area());
+}
+
+TEST_F(FontCacheTest, RenderTextBatchedWithGlyphAtlas)
+{
+  const cen::unicode_string str{'A', 'V', '\n', 'a'};
+
+  m_cache.add_basic_latin(*m_renderer);
+  const auto expected = m_renderer->render_text_batched(m_cache, str, {10, 20});
+
+  cen::font_cache atlasCache{fontPath, 12};
+  atlasCache.enable_glyph_atlas();
+  atlasCache.add_basic_latin(*m_renderer);
+
+  const auto layout = m_renderer->render_text_batched(atlasCache, str, {10, 20});
+  ASSERT_EQ(expected.pen, layout.pen);
+  ASSERT_EQ(expected.bounds, layout.bounds);
+}
+
+TEST_F(FontCacheTest, GetOrStoreReusesTextures)
+{
+  const auto& first = m_cache.get_or_store_blended_utf8("Score: 42", *m_renderer);
+  const auto* ptr = first.get();
+
+  const auto& second = m_cache.get_or_store_blended_utf8("Score: 42", *m_renderer);
+  ASSERT_EQ(ptr, second.get());
+  ASSERT_EQ(1u, m_cache.string_cache_size());
+
+  // Different styles of the same text use different textures
+  ASSERT_NO_THROW(m_cache.get_or_store_solid_utf8("Score: 42", *m_renderer));
+  ASSERT_NO_THROW(
+      m_cache.get_or_store_shaded_utf8("Score: 42", *m_renderer, cen::colors::black));
+  ASSERT_NO_THROW(
+      m_cache.get_or_store_blended_wrapped_utf8("Score: 42", *m_renderer, 50));
+  ASSERT_EQ(4u, m_cache.string_cache_size());
+  ASSERT_LT(0u, m_cache.string_cache_bytes());
+
+  m_cache.clear_string_cache();
+  ASSERT_EQ(0u, m_cache.string_cache_size());
+  ASSERT_EQ(0u, m_cache.string_cache_bytes());
+}
+
+TEST_F(FontCacheTest, StringCacheCapacity)
+{
+  m_cache.set_string_cache_capacity(2);
+
+  (void) m_cache.get_or_store_blended_utf8("a", *m_renderer);
+  (void) m_cache.get_or_store_blended_utf8("b", *m_renderer);
+  (void) m_cache.get_or_store_blended_utf8("a", *m_renderer);  // "b" is now the LRU entry
+  (void) m_cache.get_or_store_blended_utf8("c", *m_renderer);
+  ASSERT_EQ(2u, m_cache.string_cache_size());
+
+  const auto bytes = m_cache.string_cache_bytes();
+  m_cache.set_string_cache_capacity(0, bytes - 1);
+  ASSERT_EQ(1u, m_cache.string_cache_size());
+
+  m_cache.set_string_cache_capacity(0);
+  (void) m_cache.get_or_store_blended_utf8("d", *m_renderer);
+  (void) m_cache.get_or_store_blended_utf8("e", *m_renderer);
+  ASSERT_EQ(3u, m_cache.string_cache_size());
+}
+
+TEST_F(FontCacheTest, RemoveStored)
+{
+  m_cache.store_blended_utf8(7, "foo", *m_renderer);
+  ASSERT_TRUE(m_cache.has_stored(7));
+
+  m_cache.remove_stored(7);
+  ASSERT_FALSE(m_cache.has_stored(7));
+  ASSERT_NO_THROW(m_cache.remove_stored(7));
+}
+
+TEST_F(FontCacheTest, WarmUp)
+{
+  ASSERT_FALSE(m_cache.is_warming_up());
+  ASSERT_TRUE(m_cache.update_warm_up(*m_renderer, cen::milliseconds<cen::u32>{1}));
+
+  m_cache.begin_warm_up(0x20, 0x7F);
+  ASSERT_TRUE(m_cache.is_warming_up());
+  ASSERT_THROW(m_cache.begin_warm_up(0x20, 0x7F), cen::cen_error);
+
+  while (!m_cache.update_warm_up(*m_renderer, cen::milliseconds<cen::u32>{1}))
+  {
+    cen::thread::sleep(cen::milliseconds<cen::u32>{1});
+  }
+
+  ASSERT_FALSE(m_cache.is_warming_up());
+  ASSERT_TRUE(m_cache.has('a'));
+  ASSERT_TRUE(m_cache.try_at('a'));
+  ASSERT_FALSE(m_cache.has(0x7F));
+}
+
+TEST_F(FontCacheTest, WarmUpWithGlyphAtlas)
+{
+  m_cache.enable_glyph_atlas({256, 256});
+  m_cache.begin_warm_up(0x20, 0x7F);
+
+  while (!m_cache.update_warm_up(*m_renderer, cen::milliseconds<cen::u32>{1}))
+  {}
+
+  ASSERT_TRUE(m_cache.try_at_atlas('a'));
+  ASSERT_TRUE(m_cache.glyph_page(m_cache.try_at_atlas('a')->page).get());
+}
+
+TEST_F(FontCacheTest, DestroyDuringWarmUp)
+{
+  cen::font_cache cache{fontPath, 12};
+  cache.begin_warm_up(0x20, 0x100);
+  ASSERT_TRUE(cache.is_warming_up());
+}
+
+TEST_F(FontCacheTest, DistanceFieldGlyphs)
+{
+  ASSERT_FALSE(m_cache.is_using_distance_field_glyphs());
+  ASSERT_EQ(0, m_cache.distance_field_spread());
+  ASSERT_THROW(m_cache.enable_distance_field_glyphs(0), cen::cen_error);
+
+  m_cache.enable_distance_field_glyphs(4);
+  ASSERT_TRUE(m_cache.is_using_distance_field_glyphs());
+  ASSERT_EQ(4, m_cache.distance_field_spread());
+
+  m_cache.add_basic_latin(*m_renderer);
+  ASSERT_THROW(m_cache.enable_distance_field_glyphs(), cen::cen_error);
+
+  cen::font_cache plain{fontPath, 12};
+  plain.add_basic_latin(*m_renderer);
+
+  // The distance field glyphs are padded by the spread on each side
+  const auto size = m_cache.at('a').cached.size();
+  const auto plainSize = plain.at('a').cached.size();
+  ASSERT_EQ(plainSize.width + 8, size.width);
+  ASSERT_EQ(plainSize.height + 8, size.height);
+
+  // The padding doesn't affect the layout of the text
+  const cen::unicode_string str{'a', 'b'};
+  const auto expected = m_renderer->render_text_batched(plain, str, {10, 10});
+  const auto layout = m_renderer->render_text_batched(m_cache, str, {10, 10});
+  ASSERT_EQ(expected.pen, layout.pen);
+}
+
+TEST_F(FontCacheTest, RenderTextScaled)
+{
+  m_cache.enable_distance_field_glyphs();
+  m_cache.add_basic_latin(*m_renderer);
+
+  const cen::unicode_string str{'a', 'b', '\n', 'c'};
+  const auto normal = m_renderer->render_text_scaled(m_cache, str, {10, 10}, 1);
+  const auto large = m_renderer->render_text_scaled(m_cache, str, {10, 10}, 3);
+
+  ASSERT_TRUE(normal.has_area());
+  ASSERT_FLOAT_EQ(normal.width() * 3, large.width());
+  ASSERT_FLOAT_EQ(normal.height() * 3, large.height());
+}
+
+TEST_F(FontCacheTest, FallbackFonts)
+{
+  constexpr cen::unicode macron = 0x100;  // Not provided by the main font
+
+  ASSERT_EQ(0u, m_cache.fallback_count());
+  ASSERT_THROW((void) m_cache.get_font(1), std::out_of_range);
+
+  m_cache.add_glyph(*m_renderer, macron);
+  ASSERT_FALSE(m_cache.has(macron));
+
+  m_cache.emplace_fallback(fallbackPath, 12);
+  ASSERT_EQ(1u, m_cache.fallback_count());
+  ASSERT_EQ(&m_cache.get_font(), &m_cache.get_font(0));
+  ASSERT_NO_THROW((void) m_cache.get_font(1));
+
+  m_cache.add_glyph(*m_renderer, 'a');
+  m_cache.add_glyph(*m_renderer, macron);
+  ASSERT_TRUE(m_cache.has(macron));
+  ASSERT_EQ(0u, m_cache.font_index('a'));
+  ASSERT_EQ(1u, m_cache.font_index(macron));
+
+  // Glyphs of different fonts aren't kerned
+  ASSERT_EQ(0, m_cache.kerning('a', macron));
+}
+
+TEST_F(FontCacheTest, FallbackFontsAtlas)
+{
+  constexpr cen::unicode macron = 0x100;
+
+  m_cache.emplace_fallback(fallbackPath, 12);
+  m_cache.enable_glyph_atlas({256, 256});
+  m_cache.begin_warm_up(0x20, 0x101);
+  ASSERT_THROW(m_cache.emplace_fallback(fallbackPath, 12), cen::cen_error);
+
+  while (!m_cache.update_warm_up(*m_renderer, cen::milliseconds<cen::u32>{1}))
+  {}
+
+  const auto* glyph = m_cache.try_at_atlas(macron);
+  ASSERT_TRUE(glyph);
+  ASSERT_EQ(1u, glyph->fontIndex);
+  ASSERT_EQ(1u, m_cache.font_index(macron));
+  ASSERT_EQ(0u, m_cache.font_index('a'));
+
+  const cen::unicode_string str{'a', macron};
+  const auto layout = m_renderer->render_text_batched(m_cache, str, {10, 10});
+  ASSERT_TRUE(layout.bounds.has_area());
+}
+
+TEST_F(FontCacheTest, StyledGlyphs)
+{
+  const cen::font_cache::glyph_style outlined{TTF_STYLE_NORMAL, 2};
+  const cen::font_cache::glyph_style bold{TTF_STYLE_BOLD, 0};
+
+  m_cache.add_basic_latin(*m_renderer);
+  ASSERT_FALSE(m_cache.has('a', outlined));
+  ASSERT_FALSE(m_cache.try_at('a', outlined));
+  ASSERT_EQ(0u, m_cache.style_count());
+
+  m_cache.add_basic_latin(*m_renderer, outlined);
+  m_cache.add_glyph(*m_renderer, 'a', bold);
+  ASSERT_EQ(2u, m_cache.style_count());
+
+  ASSERT_TRUE(m_cache.has('a', outlined));
+  ASSERT_TRUE(m_cache.has('a', bold));
+  ASSERT_FALSE(m_cache.has('b', bold));
+
+  // The font is left unchanged
+  const auto& font = m_cache.get_font();
+  ASSERT_EQ(0, font.outline());
+  ASSERT_FALSE(font.is_bold());
+
+  // The outline makes the glyph larger on each side
+  const auto plain = m_cache.at('a').cached.size();
+  const auto* data = m_cache.try_at('a', outlined);
+  ASSERT_TRUE(data);
+  ASSERT_GT(data->cached.size().width, plain.width);
+  ASSERT_GT(data->cached.size().height, plain.height);
+
+  // Plain and outlined text can be mixed without reconfiguring the font
+  const cen::unicode_string str{'a', 'b'};
+  const auto plainText = m_renderer->render_text_batched(m_cache, str, {10, 10});
+  const auto outlinedText =
+      m_renderer->render_text_batched(m_cache, str, {10, 10}, outlined);
+  ASSERT_TRUE(outlinedText.bounds.has_area());
+  ASSERT_LE(outlinedText.bounds.x(), plainText.bounds.x());
+
+  ASSERT_THROW(m_cache.enable_distance_field_glyphs(), cen::cen_error);
+}
+
+TEST_F(FontCacheTest, StyledGlyphsAtlas)
+{
+  const cen::font_cache::glyph_style outlined{TTF_STYLE_NORMAL, 1};
+
+  m_cache.enable_glyph_atlas({256, 256});
+  m_cache.add_range(*m_renderer, 'a', 'd', outlined);
+
+  ASSERT_FALSE(m_cache.try_at_atlas('a'));
+  ASSERT_TRUE(m_cache.try_at_atlas('a', outlined));
+  ASSERT_FALSE(m_cache.try_at('a', outlined));
+  ASSERT_EQ(0u, m_cache.font_index('a', outlined));
+
+  m_cache.begin_warm_up(0x20, 0x7F);
+  ASSERT_THROW(m_cache.add_glyph(*m_renderer, 'd', outlined), cen::cen_error);
+}
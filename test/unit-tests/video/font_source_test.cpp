@@ -0,0 +1,84 @@
+#include "video/font_source.hpp"
+
+#include <gtest/gtest.h>
+
+#include <optional>  // optional
+#include <type_traits>
+#include <vector>  // vector
+
+#include "core/exception.hpp"
+#include "filesystem/mapped_file.hpp"
+#include "video/font.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+namespace {
+
+inline constexpr auto danielPath = "resources/daniel.ttf";
+
+}  // namespace
+
+static_assert(std::is_final_v<cen::font_source>);
+static_assert(std::is_nothrow_move_constructible_v<cen::font_source>);
+static_assert(std::is_copy_constructible_v<cen::font_source>);
+
+static_assert(std::is_constructible_v<cen::font, const cen::font_source&, int>);
+
+TEST(FontSource, MappedFile)
+{
+  ASSERT_THROW(cen::font_source{"foobar.ttf"}, cen::cen_error);
+
+  const cen::font_source source{danielPath};
+  const cen::mapped_file file{danielPath};
+
+  ASSERT_TRUE(source.data());
+  ASSERT_EQ(file.size(), source.size());
+  ASSERT_EQ(1, source.use_count());
+}
+
+TEST(FontSource, Memory)
+{
+  const cen::mapped_file file{danielPath};
+  const cen::font_source source{file.data(), file.size()};
+
+  ASSERT_NE(file.data(), source.data());
+  ASSERT_EQ(file.size(), source.size());
+  ASSERT_EQ(*file.data(), *source.data());
+}
+
+TEST(FontSource, SharedBetweenSizes)
+{
+  std::optional<cen::font_source> source{danielPath};
+  const auto* data = source->data();
+
+  std::vector<cen::font> fonts;
+  fonts.emplace_back(*source, 12);
+  fonts.emplace_back(*source, 16);
+  fonts.emplace_back(*source, 24);
+
+  ASSERT_EQ(4, source->use_count());
+  ASSERT_EQ(12, fonts.at(0).size());
+  ASSERT_EQ(24, fonts.at(2).size());
+
+  // The fonts keep the bytes alive
+  const cen::font_source copy = *source;
+  source.reset();
+  ASSERT_EQ(data, copy.data());
+
+  ASSERT_THROW(cen::font(copy, 0), cen::cen_error);
+  ASSERT_GT(fonts.at(1).height(), 0);
+}
+
+TEST(FontSource, EmplaceFont)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+
+  const cen::font_source source{danielPath};
+  renderer.emplace_font(1, source, 12);
+  renderer.emplace_font(2, source, 24);
+
+  ASSERT_TRUE(renderer.has_font(1));
+  ASSERT_EQ(24, renderer.get_font(2).size());
+  ASSERT_EQ(3, source.use_count());
+}
@@ -2,11 +2,15 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>   // byte
 #include <iostream>  // cout
 #include <type_traits>
+#include <utility>  // move
+#include <vector>   // vector
 
 #include "core/library.hpp"
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
 
 using namespace std::string_literals;
 
@@ -35,6 +39,36 @@ TEST(Font, Constructor)
   ASSERT_THROW(cen::font(std::string{danielPath}, 0), cen::cen_error);
 }
 
+TEST(Font, FileConstructor)
+{
+  cen::file file{danielPath, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  const cen::font font{std::move(file), 12};
+  ASSERT_EQ(12, font.size());
+
+  // The font claimed ownership of the file
+  ASSERT_FALSE(file);
+
+  cen::file other{danielPath, cen::file_mode::read_existing_binary};
+  ASSERT_THROW(cen::font(std::move(other), 0), cen::cen_error);
+}
+
+TEST(Font, MemoryConstructor)
+{
+  cen::file file{danielPath, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  std::vector<std::byte> data(file.size().value());
+  ASSERT_EQ(data.size(), file.read_to(data));
+
+  const cen::font font{data.data(), data.size(), 12};
+  ASSERT_EQ(12, font.size());
+
+  ASSERT_THROW(cen::font(data.data(), 16, 12), cen::ttf_error);
+  ASSERT_THROW(cen::font(data.data(), data.size(), 0), cen::cen_error);
+}
+
 TEST(Font, Reset)
 {
   // We use the std::string constructor here to make sure it works
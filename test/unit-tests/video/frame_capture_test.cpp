@@ -0,0 +1,84 @@
+#include "video/frame_capture.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <type_traits>
+
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::frame_capture>);
+static_assert(!std::is_copy_constructible_v<cen::frame_capture>);
+
+class FrameCaptureTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(FrameCaptureTest, Construction)
+{
+  const cen::frame_capture capture{*m_renderer, {32, 16}};
+  ASSERT_EQ(2u, capture.delay());
+  ASSERT_EQ(0u, capture.frame_count());
+  ASSERT_EQ((cen::iarea{32, 16}), capture.size());
+  ASSERT_EQ(cen::pixel_format::rgba32, capture.format());
+
+  // The delay is at least one frame
+  const cen::frame_capture immediate{*m_renderer, {8, 8}, cen::pixel_format::rgba32, 0};
+  ASSERT_EQ(1u, immediate.delay());
+}
+
+TEST_F(FrameCaptureTest, DelayedReadback)
+{
+  const cen::color colors[] = {cen::colors::red,
+                               cen::colors::lime,
+                               cen::colors::blue,
+                               cen::colors::white};
+
+  cen::frame_capture capture{*m_renderer, {8, 8}};
+  cen::surface frame{{1, 1}, cen::pixel_format::rgba32};
+
+  for (int index = 0; index < 4; ++index)
+  {
+    ASSERT_TRUE(capture.begin_frame(*m_renderer));
+    m_renderer->clear_with(colors[index]);
+
+    const auto read = capture.end_frame(*m_renderer, frame);
+    m_renderer->present();
+
+    // Frames are only read once the ring is full, delay() frames after they're rendered
+    if (index < 2)
+    {
+      ASSERT_FALSE(read);
+      continue;
+    }
+
+    ASSERT_TRUE(read);
+    ASSERT_EQ(capture.size(), frame.size());
+    ASSERT_EQ(cen::pixel_format::rgba32, frame.format_info().format());
+
+    const auto* pixel = static_cast<const cen::u8*>(frame.pixels());
+    const auto& expected = colors[index - 2];
+    ASSERT_EQ(expected.red(), pixel[0]);
+    ASSERT_EQ(expected.green(), pixel[1]);
+    ASSERT_EQ(expected.blue(), pixel[2]);
+  }
+
+  ASSERT_EQ(4u, capture.frame_count());
+}
@@ -0,0 +1,100 @@
+#include "video/frame_recorder.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>  // remove
+#include <type_traits>
+#include <utility>  // move
+
+#include "filesystem/file.hpp"
+
+static_assert(std::is_final_v<cen::frame_recorder>);
+static_assert(!std::is_copy_constructible_v<cen::frame_recorder>);
+
+TEST(FrameRecorder, FramePath)
+{
+  cen::thread_pool pool{1};
+
+  const cen::frame_recorder images{pool, "frame_", cen::recording_format::bmp};
+  ASSERT_EQ("frame_000000.bmp", images.frame_path(0));
+  ASSERT_EQ("frame_000042.bmp", images.frame_path(42));
+
+  const cen::frame_recorder raw{pool, "frames.raw", cen::recording_format::raw};
+  ASSERT_EQ("frames.raw", raw.frame_path(7));
+
+  std::remove("frames.raw");
+}
+
+TEST(FrameRecorder, Acquire)
+{
+  cen::thread_pool pool{1};
+  cen::frame_recorder recorder{pool, "acquire_", cen::recording_format::bmp};
+
+  const auto frame = recorder.acquire({16, 8}, cen::pixel_format::rgba32);
+  ASSERT_EQ((cen::iarea{16, 8}), frame.size());
+  ASSERT_EQ(cen::pixel_format::rgba32, frame.format_info().format());
+}
+
+TEST(FrameRecorder, ImageSequence)
+{
+  cen::thread_pool pool{2};
+
+  {
+    cen::frame_recorder recorder{pool, "sequence_", cen::recording_format::bmp, 8};
+    for (int index = 0; index < 3; ++index)
+    {
+      auto frame = recorder.acquire({16, 8}, cen::pixel_format::rgba32);
+      ASSERT_TRUE(recorder.submit(std::move(frame)));
+    }
+
+    recorder.wait();
+    ASSERT_EQ(0u, recorder.pending());
+    ASSERT_EQ(3u, recorder.recorded());
+    ASSERT_EQ(0u, recorder.dropped());
+    ASSERT_EQ(0u, recorder.failed());
+
+    // The surfaces of encoded frames are reused
+    const auto frame = recorder.acquire({16, 8}, cen::pixel_format::rgba32);
+    ASSERT_TRUE(frame.get());
+  }
+
+  const char* paths[] = {"sequence_000000.bmp",
+                         "sequence_000001.bmp",
+                         "sequence_000002.bmp"};
+
+  for (const auto* path : paths)
+  {
+    const cen::file image{path, cen::file_mode::read_existing_binary};
+    ASSERT_TRUE(image) << path;
+    ASSERT_TRUE(image.is_bmp()) << path;
+  }
+
+  for (const auto* path : paths)
+  {
+    std::remove(path);
+  }
+}
+
+TEST(FrameRecorder, RawStream)
+{
+  cen::thread_pool pool{2};
+
+  {
+    cen::frame_recorder recorder{pool, "stream.raw", cen::recording_format::raw, 8};
+    for (int index = 0; index < 4; ++index)
+    {
+      auto frame = recorder.acquire({10, 5}, cen::pixel_format::rgba32);
+      ASSERT_TRUE(recorder.submit(std::move(frame)));
+    }
+  }
+
+  // The rows are tightly packed, regardless of the pitch of the surfaces
+  const cen::file stream{"stream.raw", cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(stream);
+
+  const auto size = stream.size();
+  ASSERT_TRUE(size);
+  ASSERT_EQ(4u * 10u * 5u * 4u, *size);
+
+  std::remove("stream.raw");
+}
@@ -0,0 +1,72 @@
+#include "video/opengl/gl_post_chain.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+namespace {
+
+[[nodiscard]] auto pixel(const char* name) -> cen::gl::post_pass
+{
+  return {name, "return color;", cen::gl::post_pass_kind::pixel};
+}
+
+[[nodiscard]] auto sampled(const char* name, const float scale = 1.0f)
+    -> cen::gl::post_pass
+{
+  return {name, "void main() {}", cen::gl::post_pass_kind::sampled, scale};
+}
+
+}  // namespace
+
+TEST(PostChain, PlanFusesPixelPasses)
+{
+  const std::vector passes{sampled("bright", 0.5f),
+                           sampled("blur", 0.5f),
+                           pixel("tonemap"),
+                           pixel("grade"),
+                           sampled("fxaa"),
+                           pixel("vignette")};
+
+  const auto stages = cen::detail::plan_post_stages(passes);
+  ASSERT_EQ(5u, stages.size());
+
+  ASSERT_EQ(0u, stages[0].first);
+  ASSERT_FLOAT_EQ(0.5f, stages[0].scale);
+
+  // The fused pixel passes keep the size of their input
+  ASSERT_EQ(2u, stages[2].first);
+  ASSERT_EQ(2u, stages[2].count);
+  ASSERT_FLOAT_EQ(0.5f, stages[2].scale);
+
+  ASSERT_EQ(4u, stages[3].first);
+  ASSERT_FLOAT_EQ(1.0f, stages[3].scale);
+
+  ASSERT_EQ(5u, stages[4].first);
+  ASSERT_EQ(1u, stages[4].count);
+}
+
+TEST(PostChain, PlanEmpty)
+{
+  ASSERT_TRUE(cen::detail::plan_post_stages({}).empty());
+}
+
+TEST(PostChain, FusedFragmentSource)
+{
+  const std::vector passes{pixel("tonemap"), pixel("grade")};
+  const auto stages = cen::detail::plan_post_stages(passes);
+  ASSERT_EQ(1u, stages.size());
+
+  const auto source = cen::detail::make_post_fragment(passes, stages.front());
+  ASSERT_EQ(0u, source.find("#version 330 core"));
+  ASSERT_NE(std::string::npos, source.find("vec4 post_pass_0(vec4 color, vec2 uv)"));
+  ASSERT_NE(std::string::npos, source.find("vec4 post_pass_1(vec4 color, vec2 uv)"));
+  ASSERT_NE(std::string::npos, source.find("color = post_pass_1(color, v_uv);"));
+  ASSERT_NE(std::string::npos, source.find("void main()"));
+}
+
+TEST(PostChain, ScaledSize)
+{
+  ASSERT_EQ((cen::iarea{400, 300}), cen::detail::scaled_post_size({800, 600}, 0.5f));
+  ASSERT_EQ((cen::iarea{1, 1}), cen::detail::scaled_post_size({4, 4}, 0.01f));
+}
@@ -0,0 +1,83 @@
+#include "video/opengl/gl_sprite_renderer.hpp"
+
+#include <gtest/gtest.h>
+
+#include "video/sprite_batch.hpp"
+
+namespace {
+
+[[nodiscard]] auto corner(const cen::detail::gl_sprite_instance& instance,
+                          const float u,
+                          const float v) -> cen::fpoint
+{
+  // Mirrors the vertex shader, which maps the unit square with the instance transform
+  return {instance.row0[0] * u + instance.row0[1] * v + instance.row0[2],
+          instance.row1[0] * u + instance.row1[1] * v + instance.row1[2]};
+}
+
+}  // namespace
+
+TEST(SpriteRenderer, InstanceMatchesCorners)
+{
+  const cen::frect dst{10, 20, 30, 40};
+  const auto transform = cen::transform2d::rotation(30, dst.center());
+  const float uv[4]{0.25f, 0.5f, 0.75f, 1.0f};
+
+  const cen::corner_colors tints{cen::colors::red,
+                                 cen::colors::lime,
+                                 cen::colors::blue,
+                                 cen::colors::white};
+
+  const auto instance =
+      cen::detail::make_gl_sprite_instance(dst, transform, uv, 3, tints);
+
+  const auto expect = [&](const cen::fpoint expected, const cen::fpoint actual) {
+    ASSERT_NEAR(expected.x(), actual.x(), 0.001f);
+    ASSERT_NEAR(expected.y(), actual.y(), 0.001f);
+  };
+
+  expect(transform.apply({dst.x(), dst.y()}), corner(instance, 0, 0));
+  expect(transform.apply({dst.max_x(), dst.y()}), corner(instance, 1, 0));
+  expect(transform.apply({dst.max_x(), dst.max_y()}), corner(instance, 1, 1));
+  expect(transform.apply({dst.x(), dst.max_y()}), corner(instance, 0, 1));
+
+  ASSERT_FLOAT_EQ(0.25f, instance.uv[0]);
+  ASSERT_FLOAT_EQ(1.0f, instance.uv[3]);
+  ASSERT_FLOAT_EQ(3.0f, instance.layer);
+
+  ASSERT_EQ(cen::colors::red, cen::color{instance.colors[0]});
+  ASSERT_EQ(cen::colors::blue, cen::color{instance.colors[2]});
+  ASSERT_EQ(cen::colors::white, cen::color{instance.colors[3]});
+}
+
+TEST(SpriteRenderer, InstanceWithoutTransform)
+{
+  const cen::frect dst{5, 6, 7, 8};
+  const float uv[4]{0, 0, 1, 1};
+  const cen::corner_colors tints{};
+
+  const auto instance = cen::detail::make_gl_sprite_instance(dst, {}, uv, 0, tints);
+
+  ASSERT_FLOAT_EQ(7, instance.row0[0]);
+  ASSERT_FLOAT_EQ(0, instance.row0[1]);
+  ASSERT_FLOAT_EQ(5, instance.row0[2]);
+  ASSERT_FLOAT_EQ(0, instance.row1[0]);
+  ASSERT_FLOAT_EQ(8, instance.row1[1]);
+  ASSERT_FLOAT_EQ(6, instance.row1[2]);
+}
+
+TEST(SpriteRenderer, BlendFactors)
+{
+  using cen::blend_mode;
+
+  const auto none = cen::detail::to_gl_blend_factors(blend_mode::none);
+  ASSERT_FALSE(none.enabled);
+
+  const auto blend = cen::detail::to_gl_blend_factors(blend_mode::blend);
+  ASSERT_TRUE(blend.enabled);
+  ASSERT_EQ(static_cast<GLenum>(GL_SRC_ALPHA), blend.source);
+  ASSERT_EQ(static_cast<GLenum>(GL_ONE_MINUS_SRC_ALPHA), blend.destination);
+
+  const auto add = cen::detail::to_gl_blend_factors(blend_mode::add);
+  ASSERT_EQ(static_cast<GLenum>(GL_ONE), add.destination);
+}
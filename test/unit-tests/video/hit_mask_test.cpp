@@ -0,0 +1,128 @@
+#include "video/hit_mask.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+#include "video/colors.hpp"
+
+namespace {
+
+// Creates a transparent surface with an opaque rectangle
+[[nodiscard]] auto make_sprite(
+    const cen::iarea size,
+    const cen::irect& opaque,
+    const cen::pixel_format format = cen::pixel_format::rgba8888) -> cen::surface
+{
+  cen::surface surface{size, format};
+  for (int y = 0; y < size.height; ++y)
+  {
+    for (int x = 0; x < size.width; ++x)
+    {
+      const auto inside = x >= opaque.x() && x < opaque.max_x() && y >= opaque.y() &&
+                          y < opaque.max_y();
+      surface.set_pixel({x, y}, inside ? cen::colors::red : cen::colors::transparent);
+    }
+  }
+
+  return surface;
+}
+
+}  // namespace
+
+TEST(HitMask, Contains)
+{
+  const auto sprite = make_sprite({100, 10}, {70, 2, 5, 3});
+  const cen::hit_mask mask{sprite};
+
+  ASSERT_EQ(100, mask.width());
+  ASSERT_EQ(10, mask.height());
+  ASSERT_EQ(1, mask.scale());
+
+  ASSERT_TRUE(mask.contains({70, 2}));
+  ASSERT_TRUE(mask.contains({74, 4}));
+  ASSERT_FALSE(mask.contains({69, 2}));
+  ASSERT_FALSE(mask.contains({75, 2}));
+  ASSERT_FALSE(mask.contains({70, 5}));
+
+  ASSERT_FALSE(mask.contains({-1, 3}));
+  ASSERT_FALSE(mask.contains({100, 3}));
+}
+
+TEST(HitMask, Threshold)
+{
+  cen::surface surface{{2, 1}, cen::pixel_format::argb8888};
+  surface.set_pixel({0, 0}, cen::color{0xFF, 0, 0, 0x40});
+  surface.set_pixel({1, 0}, cen::color{0xFF, 0, 0, 0xC0});
+
+  const cen::hit_mask low{surface};
+  ASSERT_TRUE(low.contains({0, 0}));
+  ASSERT_TRUE(low.contains({1, 0}));
+
+  const cen::hit_mask high{surface, 0x80};
+  ASSERT_FALSE(high.contains({0, 0}));
+  ASSERT_TRUE(high.contains({1, 0}));
+}
+
+TEST(HitMask, OtherFormats)
+{
+  auto sprite = make_sprite({8, 8}, {2, 2, 4, 4}, cen::pixel_format::rgb565);
+  SDL_SetColorKey(sprite.get(), SDL_TRUE, SDL_MapRGB(sprite.get()->format, 0, 0, 0));
+
+  // The transparent pixels of an opaque format are black, which is the color key
+  const cen::hit_mask mask{sprite};
+  ASSERT_TRUE(mask.contains({2, 2}));
+  ASSERT_FALSE(mask.contains({1, 1}));
+}
+
+TEST(HitMask, Scale)
+{
+  const auto sprite = make_sprite({10, 10}, {5, 5, 1, 1});
+
+  ASSERT_THROW(cen::hit_mask(sprite, 1, 0), cen::cen_error);
+
+  const cen::hit_mask mask{sprite, 1, 4};
+  ASSERT_EQ(4, mask.scale());
+  ASSERT_TRUE(mask.contains({4, 4}));
+  ASSERT_TRUE(mask.contains({7, 7}));
+  ASSERT_FALSE(mask.contains({3, 3}));
+  ASSERT_FALSE(mask.contains({8, 8}));
+}
+
+TEST(HitMask, Overlaps)
+{
+  const auto sprite = make_sprite({150, 20}, {100, 5, 20, 5});
+  const cen::hit_mask a{sprite};
+  const cen::hit_mask b{sprite};
+
+  ASSERT_TRUE(a.overlaps(b, {0, 0}));
+  ASSERT_TRUE(a.overlaps(b, {19, 4}));
+  ASSERT_TRUE(a.overlaps(b, {-19, -4}));
+  ASSERT_FALSE(a.overlaps(b, {20, 0}));
+  ASSERT_FALSE(a.overlaps(b, {-20, 0}));
+  ASSERT_FALSE(a.overlaps(b, {0, 5}));
+  ASSERT_FALSE(a.overlaps(b, {0, -5}));
+
+  // Far enough apart that the masks don't share any words
+  ASSERT_FALSE(a.overlaps(b, {140, 0}));
+  ASSERT_FALSE(a.overlaps(b, {0, 100}));
+}
+
+TEST(HitMask, OverlapsMatchesContains)
+{
+  const auto first = make_sprite({70, 12}, {3, 1, 60, 2});
+  const auto second = make_sprite({9, 9}, {4, 4, 1, 1});
+
+  const cen::hit_mask a{first};
+  const cen::hit_mask b{second};
+
+  for (int y = -10; y < 14; ++y)
+  {
+    for (int x = -10; x < 72; ++x)
+    {
+      // The only opaque pixel of the second mask is at (4, 4)
+      const auto expected = a.contains({x + 4, y + 4});
+      ASSERT_EQ(expected, a.overlaps(b, {x, y})) << "x: " << x << ", y: " << y;
+      ASSERT_EQ(expected, b.overlaps(a, {-x, -y})) << "x: " << x << ", y: " << y;
+    }
+  }
+}
@@ -0,0 +1,106 @@
+#include "video/image_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>   // remove
+#include <cstring>  // memcmp
+
+#include "core/exception.hpp"
+#include "filesystem/file.hpp"
+
+namespace {
+
+inline constexpr auto path = "resources/panda.png";
+inline constexpr auto format = cen::pixel_format::rgba8888;
+
+[[nodiscard]] auto same_pixels(const cen::surface& a, const cen::surface& b) -> bool
+{
+  if (a.size() != b.size() || a.pitch() != b.pitch())
+  {
+    return false;
+  }
+
+  const auto bytes = static_cast<std::size_t>(a.pitch() * a.height());
+  return std::memcmp(a.pixels(), b.pixels(), bytes) == 0;
+}
+
+}  // namespace
+
+TEST(ImageCache, Directory)
+{
+  const cen::image_cache cache{"cache"};
+  ASSERT_EQ(std::string{"cache"} + cen::path_separator, cache.directory());
+
+  const cen::image_cache withSeparator{"cache/"};
+  ASSERT_EQ("cache/", withSeparator.directory());
+}
+
+TEST(ImageCache, LoadSurface)
+{
+  cen::image_cache cache{"."};
+  const auto entry = cache.entry_path(path, format);
+  std::remove(entry.c_str());
+
+  const auto decoded = cache.load_surface(path, format);
+  ASSERT_EQ(0u, cache.hits());
+  ASSERT_EQ(1u, cache.misses());
+  ASSERT_EQ(format, decoded.format_info().format());
+
+  const auto cached = cache.load_surface(path, format, cen::blend_mode::add);
+  ASSERT_EQ(1u, cache.hits());
+  ASSERT_EQ(1u, cache.misses());
+  ASSERT_EQ(cen::blend_mode::add, cached.get_blend_mode());
+  ASSERT_TRUE(same_pixels(decoded, cached));
+
+  std::remove(entry.c_str());
+}
+
+TEST(ImageCache, Options)
+{
+  cen::image_cache cache{"."};
+
+  // Different formats and premultiplication use different entries
+  ASSERT_NE(cache.entry_path(path, format), cache.entry_path(path, format, true));
+  ASSERT_NE(cache.entry_path(path, format),
+            cache.entry_path(path, cen::pixel_format::argb8888));
+
+  const auto entry = cache.entry_path(path, format, true);
+  std::remove(entry.c_str());
+
+  const auto decoded = cache.load_surface(path, format, cen::blend_mode::blend, true);
+  const auto cached = cache.load_surface(path, format, cen::blend_mode::blend, true);
+  ASSERT_EQ(1u, cache.hits());
+  ASSERT_TRUE(same_pixels(decoded, cached));
+
+  std::remove(entry.c_str());
+}
+
+TEST(ImageCache, InvalidEntry)
+{
+  cen::image_cache cache{"."};
+  const auto entry = cache.entry_path(path, format);
+
+  {
+    cen::file garbage{entry, cen::file_mode::write_binary};
+    ASSERT_TRUE(garbage);
+
+    const char bytes[] = "This is not a cache entry, but it is long enough to be read";
+    ASSERT_TRUE(garbage.write(bytes));
+  }
+
+  // The invalid entry is replaced
+  const auto decoded = cache.load_surface(path, format);
+  ASSERT_EQ(1u, cache.misses());
+
+  const auto cached = cache.load_surface(path, format);
+  ASSERT_EQ(1u, cache.hits());
+  ASSERT_TRUE(same_pixels(decoded, cached));
+
+  std::remove(entry.c_str());
+}
+
+TEST(ImageCache, MissingImage)
+{
+  cen::image_cache cache{"."};
+  ASSERT_THROW(cache.load_surface("resources/missing.png", format), cen::img_error);
+}
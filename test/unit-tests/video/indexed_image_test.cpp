@@ -0,0 +1,122 @@
+#include "video/indexed_image.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>  // move
+
+#include "video/colors.hpp"
+#include "video/offscreen_renderer.hpp"
+#include "video/pixel_view.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_palette(const cen::color& second, const cen::color& third)
+    -> cen::palette
+{
+  cen::palette palette{3};
+  palette.set_color(0, cen::color{0, 0, 0, 0});
+  palette.set_color(1, second);
+  palette.set_color(2, third);
+  return palette;
+}
+
+[[nodiscard]] auto make_image() -> cen::surface
+{
+  cen::surface image{{4, 1}, cen::pixel_format::rgba32};
+
+  cen::pixel_view pixels{image};
+  pixels.set_pixel({0, 0}, cen::color{250, 10, 10});
+  pixels.set_pixel({1, 0}, cen::color{0, 0, 240});
+  pixels.set_pixel({2, 0}, cen::color{255, 255, 255, 0});
+  pixels.set_pixel({3, 0}, cen::color{200, 30, 40});
+
+  return image;
+}
+
+[[nodiscard]] auto index_at(const cen::indexed_image& image, const int x) -> cen::u8
+{
+  return static_cast<const cen::u8*>(image.pixels().pixels())[x];
+}
+
+}  // namespace
+
+TEST(IndexedImage, Constructor)
+{
+  cen::surface rgba{{4, 4}, cen::pixel_format::rgba32};
+  ASSERT_THROW(cen::indexed_image{std::move(rgba)}, cen::cen_error);
+
+  cen::surface indices{{4, 4}, cen::pixel_format::index8};
+  ASSERT_THROW(cen::indexed_image(std::move(indices), cen::pixel_format::rgb565),
+               cen::cen_error);
+}
+
+TEST(IndexedImage, Quantize)
+{
+  const auto palette = make_palette(cen::colors::red, cen::colors::blue);
+  ASSERT_THROW(cen::indexed_image::quantize(make_image(), cen::palette{257}),
+               cen::cen_error);
+
+  const auto image = cen::indexed_image::quantize(make_image(), palette);
+  ASSERT_EQ(cen::pixel_format::index8, image.pixels().format_info().format());
+  ASSERT_EQ(cen::pixel_format::argb8888, image.format());
+  ASSERT_EQ(4, image.size().width);
+  ASSERT_EQ(1, image.size().height);
+  ASSERT_LE(4u, image.memory_size());
+
+  ASSERT_EQ(1u, index_at(image, 0));
+  ASSERT_EQ(2u, index_at(image, 1));
+  ASSERT_EQ(0u, index_at(image, 2));  // Transparent pixels prefer transparent entries
+  ASSERT_EQ(1u, index_at(image, 3));
+
+  ASSERT_EQ(3u, image.lut().size());
+  ASSERT_EQ(0xFFFF'0000u, image.lut().data()[1]);
+}
+
+TEST(IndexedImage, SetPalette)
+{
+  auto image = cen::indexed_image::quantize(make_image(),
+                                            make_palette(cen::colors::red,
+                                                         cen::colors::blue));
+
+  ASSERT_TRUE(image.set_palette(make_palette(cen::colors::lime, cen::colors::red)));
+  ASSERT_THROW(image.set_palette(cen::palette{0}), cen::cen_error);
+
+  // The indices are left untouched
+  ASSERT_EQ(1u, index_at(image, 0));
+  ASSERT_EQ(0xFF00'FF00u, image.lut().data()[1]);
+  ASSERT_EQ(0xFFFF'0000u, image.lut().data()[2]);
+}
+
+TEST(IndexedImage, Upload)
+{
+  cen::offscreen_renderer offscreen{{4, 1}};
+  auto& renderer = offscreen.get();
+
+  auto image = cen::indexed_image::quantize(make_image(),
+                                            make_palette(cen::colors::red,
+                                                         cen::colors::blue));
+
+  auto texture = image.upload(renderer);
+  ASSERT_TRUE(texture.is_streaming());
+  ASSERT_EQ(image.format(), texture.format());
+  ASSERT_EQ(image.size(), texture.size());
+
+  // Palette swaps only expand the indices again
+  ASSERT_TRUE(image.set_palette(make_palette(cen::colors::lime, cen::colors::red)));
+  ASSERT_TRUE(image.update(texture));
+
+  renderer.clear_with(cen::colors::black);
+  renderer.render(texture, cen::ipoint{0, 0});
+
+  cen::surface snapshot{{4, 1}, cen::pixel_format::rgba32};
+  ASSERT_TRUE(renderer.capture(snapshot));
+
+  const cen::pixel_view pixels{snapshot};
+  ASSERT_EQ(cen::colors::lime, pixels.get_pixel({0, 0}));
+  ASSERT_EQ(cen::colors::red, pixels.get_pixel({1, 0}));
+
+  // The lookup table must match the format of the texture
+  const cen::palette_lut other{make_palette(cen::colors::red, cen::colors::blue),
+                               cen::pixel_format::abgr8888};
+  ASSERT_FALSE(image.update(texture, other));
+}
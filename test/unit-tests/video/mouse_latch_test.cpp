@@ -0,0 +1,49 @@
+#include "video/mouse_latch.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(MouseLatch, Defaults)
+{
+  const cen::mouse_latch latch;
+  ASSERT_FALSE(latch.has_sample());
+  ASSERT_EQ(cen::fpoint(1, 1), latch.scale());
+  ASSERT_EQ(cen::fpoint(), latch.offset());
+}
+
+TEST(MouseLatch, Sample)
+{
+  cen::mouse_latch latch;
+
+  latch.sample();
+  ASSERT_TRUE(latch.has_sample());
+
+  latch.reset();
+  ASSERT_FALSE(latch.has_sample());
+}
+
+TEST(MouseLatch, Apply)
+{
+  cen::render_command_buffer buffer;
+  buffer.fill_rect({{10, 10}, {5, 5}}, cen::colors::red);
+  buffer.latch_last();
+
+  cen::mouse_latch latch;
+  latch.sample();
+
+  // The offset is zero unless the mouse moved in the meantime
+  const auto offset = latch.apply(buffer);
+  ASSERT_FALSE(latch.has_sample());
+
+  const auto& dst = buffer.begin()->destination;
+  ASSERT_FLOAT_EQ(10 + offset.x(), dst.x());
+  ASSERT_FLOAT_EQ(10 + offset.y(), dst.y());
+  ASSERT_FLOAT_EQ(5, dst.width());
+}
+
+TEST(MouseLatch, SetScale)
+{
+  cen::mouse_latch latch;
+
+  latch.set_scale({0.5f, 2});
+  ASSERT_EQ(cen::fpoint(0.5f, 2), latch.scale());
+}
@@ -0,0 +1,154 @@
+#include "video/offscreen_renderer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "core/exception.hpp"
+#include "math/rect.hpp"
+#include "video/colors.hpp"
+#include "video/pixel_view.hpp"
+#include "video/texture.hpp"
+
+TEST(OffscreenRenderer, Construction)
+{
+  ASSERT_THROW(cen::offscreen_renderer({0, 10}), cen::cen_error);
+  ASSERT_THROW(cen::offscreen_renderer({10, 0}), cen::cen_error);
+
+  const cen::offscreen_renderer offscreen{{64, 32}};
+  ASSERT_EQ(64, offscreen.size().width);
+  ASSERT_EQ(32, offscreen.size().height);
+  ASSERT_EQ(cen::pixel_format::rgba32, offscreen.target().format_info().format());
+  ASSERT_TRUE(offscreen.get().get());
+}
+
+TEST(OffscreenRenderer, RendersIntoTarget)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+
+  auto& renderer = offscreen.get();
+  renderer.clear_with(cen::colors::white);
+
+  renderer.set_color(cen::colors::red);
+  renderer.fill_rect(cen::irect{0, 0, 8, 16});
+  renderer.present();
+
+  cen::pixel_view view{offscreen.target()};
+  ASSERT_EQ(cen::colors::red, view.get_pixel({2, 5}));
+  ASSERT_EQ(cen::colors::white, view.get_pixel({12, 5}));
+}
+
+TEST(OffscreenRenderer, Move)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  const auto* target = offscreen.target().get();
+
+  cen::offscreen_renderer other{std::move(offscreen)};
+  ASSERT_EQ(target, other.target().get());
+  ASSERT_TRUE(other.get().clear());
+}
+
+TEST(OffscreenRenderer, CaptureReusesSurface)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+
+  auto& renderer = offscreen.get();
+  renderer.clear_with(cen::colors::green);
+
+  cen::surface snapshot{{16, 16}, cen::pixel_format::rgba32};
+  const auto* pixels = snapshot.pixels();
+
+  ASSERT_TRUE(renderer.capture(snapshot));
+  ASSERT_EQ(pixels, snapshot.pixels());
+  ASSERT_EQ(cen::colors::green, cen::pixel_view{snapshot}.get_pixel({4, 4}));
+
+  // The surface is recreated if the size doesn't match
+  cen::surface small{{4, 4}, cen::pixel_format::argb8888};
+  ASSERT_TRUE(renderer.capture(small));
+  ASSERT_EQ(16, small.width());
+  ASSERT_EQ(cen::pixel_format::argb8888, small.format_info().format());
+  ASSERT_EQ(cen::colors::green, cen::pixel_view{small}.get_pixel({8, 8}));
+}
+
+TEST(OffscreenRenderer, RenderStats)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  auto& renderer = offscreen.get();
+
+  const cen::surface image{{4, 4}, cen::pixel_format::rgba32};
+  const cen::texture texture{renderer, image};
+
+  renderer.set_state_caching(true);
+  renderer.set_color(cen::colors::red);
+  renderer.set_color(cen::colors::red);  // Filtered by the state cache
+  renderer.clear();
+  renderer.fill_rect(cen::irect{0, 0, 8, 8});
+  renderer.draw_points(std::vector<cen::ipoint>{{1, 1}, {2, 2}, {3, 3}});
+  renderer.render(texture, cen::ipoint{0, 0});
+  renderer.render(texture, cen::ipoint{4, 4});
+
+  const auto pending = renderer.current_stats();
+  renderer.present();
+
+  const auto stats = renderer.stats();
+  if constexpr (cen::render_stats::is_enabled())
+  {
+    ASSERT_EQ(1u, stats.clears);
+    ASSERT_EQ(1u, stats.fill_calls);
+    ASSERT_EQ(1u, stats.point_calls);
+    ASSERT_EQ(2u, stats.copy_calls);
+    ASSERT_EQ(4u, stats.draw_calls());
+    ASSERT_EQ(1u, stats.texture_switches);
+    ASSERT_EQ(1u, stats.color_changes);
+    ASSERT_EQ(4u + 3u + 8u, stats.vertices);
+    ASSERT_EQ(stats.draw_calls(), pending.draw_calls());
+  }
+  else
+  {
+    ASSERT_EQ(0u, stats.draw_calls());
+    ASSERT_EQ(0u, stats.state_changes());
+  }
+
+  // The counters are reset by every call to present()
+  ASSERT_EQ(0u, renderer.current_stats().draw_calls());
+}
+
+TEST(OffscreenRenderer, FlushDiagnostics)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+
+  auto& renderer = offscreen.get();
+  ASSERT_TRUE(renderer.is_batching());
+
+  // Flushing without pending draw calls is free, so it isn't counted
+  ASSERT_TRUE(renderer.flush());
+
+  renderer.fill_rect(cen::irect{0, 0, 8, 8});
+  ASSERT_TRUE(renderer.flush());
+  ASSERT_TRUE(renderer.flush());
+
+  renderer.fill_rect(cen::irect{0, 0, 4, 4});
+  ASSERT_TRUE(renderer.prepare_native_rendering());
+
+  cen::surface image{offscreen.size(), cen::pixel_format::rgba32};
+  renderer.fill_rect(cen::irect{4, 4, 4, 4});
+  ASSERT_TRUE(renderer.capture(image));
+
+  renderer.present();
+
+  const auto stats = renderer.stats();
+  if constexpr (cen::render_stats::is_enabled())
+  {
+    ASSERT_EQ(1u, stats.flushes);
+    ASSERT_EQ(1u, stats.native_flushes);
+    ASSERT_EQ(1u, stats.readback_flushes);
+    ASSERT_EQ(0u, stats.target_flushes);
+    ASSERT_EQ(2u, stats.implicit_flushes());
+  }
+  else
+  {
+    ASSERT_EQ(0u, stats.flushes);
+    ASSERT_EQ(0u, stats.implicit_flushes());
+  }
+}
@@ -0,0 +1,172 @@
+#include "video/palette_lut.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>    // array
+#include <cstring>  // memcpy
+
+#include "video/colors.hpp"
+
+namespace {
+
+inline const cen::color_ramp gradient{{{0, cen::colors::black}, {1, cen::colors::white}},
+                                      4096};
+
+}  // namespace
+
+TEST(PaletteLut, Constructor)
+{
+  ASSERT_THROW(cen::palette_lut(gradient, cen::pixel_format::rgb565), cen::cen_error);
+  ASSERT_THROW(cen::palette_lut(gradient, cen::pixel_format::index8), cen::cen_error);
+
+  const cen::palette_lut lut{gradient, cen::pixel_format::rgba8888};
+  ASSERT_EQ(gradient.size(), lut.size());
+  ASSERT_EQ(cen::pixel_format::rgba8888, lut.format());
+  ASSERT_EQ(0x0000'00FFu, lut.data()[0]);
+  ASSERT_EQ(0xFFFF'FFFFu, lut.data()[lut.size() - 1]);
+}
+
+TEST(PaletteLut, Packing)
+{
+  const cen::color_ramp ramp{{0, cen::color{0x11, 0x22, 0x33, 0x44}}};
+
+  ASSERT_EQ(0x1122'3344u, cen::palette_lut(ramp, cen::pixel_format::rgba8888).data()[0]);
+  ASSERT_EQ(0x4411'2233u, cen::palette_lut(ramp, cen::pixel_format::argb8888).data()[0]);
+  ASSERT_EQ(0x4433'2211u, cen::palette_lut(ramp, cen::pixel_format::abgr8888).data()[0]);
+  ASSERT_EQ(0xFF11'2233u, cen::palette_lut(ramp, cen::pixel_format::rgb888).data()[0]);
+}
+
+TEST(PaletteLut, MapIndices)
+{
+  const cen::palette_lut lut{gradient, cen::pixel_format::argb8888};
+
+  const std::array<cen::u8, 11> indices =
+      {0, 1, 2, 64, 127, 128, 129, 200, 253, 254, 255};
+  std::array<cen::u32, indices.size()> pixels{};
+  lut.map(indices.data(), pixels.data(), indices.size());
+
+  for (std::size_t index = 0; index < indices.size(); ++index)
+  {
+    const auto expected = gradient.sample(static_cast<float>(indices[index]) / 255.0f);
+    const cen::u32 gray = expected.red();
+    ASSERT_EQ(0xFF00'0000u | (gray << 16u) | (gray << 8u) | gray, pixels[index]);
+  }
+
+  ASSERT_EQ(0xFF00'0000u, pixels.front());
+  ASSERT_EQ(0xFFFF'FFFFu, pixels.back());
+}
+
+TEST(PaletteLut, MapValues)
+{
+  const cen::palette_lut lut{gradient, cen::pixel_format::argb8888};
+
+  const std::array values = {-10.0f, -1.0f, 0.0f, 0.5f, 1.0f, 3.0f};
+  std::array<cen::u32, values.size()> pixels{};
+  lut.map(values.data(), pixels.data(), values.size(), -1, 1);
+
+  ASSERT_EQ(lut.data()[0], pixels[0]);
+  ASSERT_EQ(lut.data()[0], pixels[1]);
+  ASSERT_EQ(lut.data()[2048], pixels[2]);
+  ASSERT_EQ(lut.data()[3071], pixels[3]);
+  ASSERT_EQ(lut.data()[4095], pixels[4]);
+  ASSERT_EQ(lut.data()[4095], pixels[5]);
+}
+
+TEST(PaletteLut, FromPalette)
+{
+  cen::palette palette{2};
+  ASSERT_TRUE(palette.set_color(0, cen::colors::red));
+  ASSERT_TRUE(palette.set_color(1, cen::colors::blue));
+
+  const cen::palette_lut lut{palette, cen::pixel_format::argb8888};
+  ASSERT_EQ(2u, lut.size());
+
+  const std::array<cen::u8, 3> indices = {1, 0, 2};
+  std::array<cen::u32, indices.size()> pixels{};
+  lut.map(indices.data(), pixels.data(), indices.size());
+
+  ASSERT_EQ(0xFF00'00FFu, pixels[0]);
+  ASSERT_EQ(0xFFFF'0000u, pixels[1]);
+  ASSERT_EQ(0u, pixels[2]);
+}
+
+TEST(PaletteLut, Apply)
+{
+  const cen::palette_lut lut{gradient, cen::pixel_format::argb8888};
+
+  cen::surface source{{3, 2}, cen::pixel_format::index8};
+  cen::surface target{{3, 2}, cen::pixel_format::argb8888};
+  cen::surface wrongFormat{{3, 2}, cen::pixel_format::rgba8888};
+  cen::surface wrongSize{{2, 2}, cen::pixel_format::argb8888};
+
+  ASSERT_FALSE(lut.apply(source, wrongFormat));
+  ASSERT_FALSE(lut.apply(source, wrongSize));
+  ASSERT_FALSE(lut.apply(target, target));
+
+  ASSERT_TRUE(source.lock());
+  auto* indices = static_cast<cen::u8*>(source.pixels());
+  for (int row = 0; row < 2; ++row)
+  {
+    for (int column = 0; column < 3; ++column)
+    {
+      indices[row * source.pitch() + column] = static_cast<cen::u8>(row * 255);
+    }
+  }
+  source.unlock();
+
+  ASSERT_TRUE(lut.apply(source, target));
+
+  ASSERT_TRUE(target.lock());
+  const auto* pixels = static_cast<const cen::u8*>(target.pixels());
+  const auto* first = reinterpret_cast<const cen::u32*>(pixels);
+  const auto* second = reinterpret_cast<const cen::u32*>(pixels + target.pitch());
+  for (int column = 0; column < 3; ++column)
+  {
+    ASSERT_EQ(0xFF00'0000u, first[column]);
+    ASSERT_EQ(0xFFFF'FFFFu, second[column]);
+  }
+  target.unlock();
+}
+
+TEST(PaletteLut, ApplyPackedIndices)
+{
+  cen::palette palette{16};
+  for (int index = 0; index < 16; ++index)
+  {
+    const auto value = static_cast<cen::u8>(index * 17);
+    palette.set_color(index, cen::color{value, value, value});
+  }
+
+  const cen::palette_lut lut{palette, cen::pixel_format::argb8888};
+  cen::surface target{{3, 1}, cen::pixel_format::argb8888};
+
+  const auto mapped = [&] {
+    std::array<cen::u32, 3> pixels{};
+    if (target.lock())
+    {
+      std::memcpy(pixels.data(), target.pixels(), sizeof pixels);
+      target.unlock();
+    }
+
+    return pixels;
+  };
+
+  // The first index is stored in the least significant nibble
+  cen::surface nibbles{{3, 1}, cen::pixel_format::index4lsb};
+  ASSERT_TRUE(nibbles.lock());
+  static_cast<cen::u8*>(nibbles.pixels())[0] = 0xF1;
+  static_cast<cen::u8*>(nibbles.pixels())[1] = 0x02;
+  nibbles.unlock();
+
+  ASSERT_TRUE(lut.apply(nibbles, target));
+  ASSERT_EQ((std::array{0xFF11'1111u, 0xFFFF'FFFFu, 0xFF22'2222u}), mapped());
+
+  // The first index is stored in the most significant bit
+  cen::surface bits{{3, 1}, cen::pixel_format::index1msb};
+  ASSERT_TRUE(bits.lock());
+  static_cast<cen::u8*>(bits.pixels())[0] = 0b1010'0000;
+  bits.unlock();
+
+  ASSERT_TRUE(lut.apply(bits, target));
+  ASSERT_EQ((std::array{0xFF11'1111u, 0xFF00'0000u, 0xFF11'1111u}), mapped());
+}
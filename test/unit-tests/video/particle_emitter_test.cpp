@@ -0,0 +1,116 @@
+#include "video/particle_emitter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+#include <memory>   // unique_ptr
+
+#include "thread/thread_pool.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+class ParticleEmitterTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_texture = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_texture.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_texture;
+};
+
+TEST_F(ParticleEmitterTest, Defaults)
+{
+  const cen::particle_emitter emitter;
+  ASSERT_TRUE(emitter.empty());
+  ASSERT_EQ(0u, emitter.size());
+  ASSERT_EQ(cen::fpoint{}, emitter.acceleration());
+  ASSERT_FALSE(emitter.fades_out());
+}
+
+TEST_F(ParticleEmitterTest, Update)
+{
+  cen::particle_emitter emitter{8};
+  emitter.set_acceleration({0, 10});
+
+  emitter.emit({{0, 0}, {4, 0}, cen::colors::red, 1.0f, 2});
+  emitter.emit({{10, 10}, {0, -2}, cen::colors::blue, 3.0f, 2});
+  ASSERT_EQ(2u, emitter.size());
+
+  emitter.update(0.5f);
+  ASSERT_EQ(2u, emitter.size());
+  ASSERT_EQ(cen::fpoint(2, 2.5f), emitter.position(0));
+  ASSERT_EQ(cen::fpoint(4, 5), emitter.velocity(0));
+  ASSERT_EQ(cen::fpoint(10, 11.5f), emitter.position(1));
+
+  // The first particle expires, and the second particle takes its place
+  emitter.update(0.5f);
+  ASSERT_EQ(1u, emitter.size());
+  ASSERT_EQ(cen::fpoint(0, 8), emitter.velocity(0));
+
+  emitter.clear();
+  ASSERT_TRUE(emitter.empty());
+}
+
+TEST_F(ParticleEmitterTest, ParallelUpdate)
+{
+  cen::thread_pool pool{2};
+
+  cen::particle_emitter serial;
+  cen::particle_emitter parallel;
+
+  for (int index = 0; index < 1'000; ++index)
+  {
+    const auto x = static_cast<float>(index);
+    const auto lifetime = 0.5f + static_cast<float>(index % 4);
+
+    serial.emit({{x, 0}, {1, x}, cen::colors::white, lifetime, 1});
+    parallel.emit({{x, 0}, {1, x}, cen::colors::white, lifetime, 1});
+  }
+
+  serial.update(1.0f);
+  parallel.update(pool, 1.0f);
+
+  ASSERT_EQ(750u, serial.size());
+  ASSERT_EQ(serial.size(), parallel.size());
+
+  for (std::size_t index = 0; index < serial.size(); ++index)
+  {
+    ASSERT_FLOAT_EQ(serial.position(index).x(), parallel.position(index).x());
+    ASSERT_FLOAT_EQ(serial.position(index).y(), parallel.position(index).y());
+  }
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+TEST_F(ParticleEmitterTest, Render)
+{
+  cen::particle_emitter emitter;
+  ASSERT_TRUE(emitter.render(*m_renderer, *m_texture));
+
+  emitter.set_fade_out(true);
+  for (int index = 0; index < 10; ++index)
+  {
+    emitter.emit({{10, static_cast<float>(index)}, {}, cen::colors::white, 2.0f, 8});
+  }
+
+  emitter.update(1.0f);
+
+  ASSERT_TRUE(emitter.render(*m_renderer, *m_texture, {{0, 0}, {16, 16}}));
+  ASSERT_TRUE(emitter.render(*m_renderer, *m_texture));
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
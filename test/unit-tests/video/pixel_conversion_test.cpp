@@ -0,0 +1,141 @@
+#include "video/pixel_conversion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <vector>  // vector
+
+TEST(PixelConversion, HasFastConversion)
+{
+  ASSERT_TRUE(cen::has_fast_conversion(cen::pixel_format::rgba8888,
+                                       cen::pixel_format::argb8888));
+  ASSERT_TRUE(cen::has_fast_conversion(cen::pixel_format::bgra8888,
+                                       cen::pixel_format::rgb888));
+  ASSERT_TRUE(cen::has_fast_conversion(cen::pixel_format::abgr8888,
+                                       cen::pixel_format::abgr8888));
+
+  ASSERT_FALSE(cen::has_fast_conversion(cen::pixel_format::rgb24,
+                                        cen::pixel_format::rgba8888));
+  ASSERT_FALSE(cen::has_fast_conversion(cen::pixel_format::rgba8888,
+                                        cen::pixel_format::rgb565));
+}
+
+TEST(PixelConversion, ConvertPixels)
+{
+  const std::vector<cen::u32> source(37, 0x11223344u);
+  std::vector<cen::u32> result(source.size());
+
+  ASSERT_TRUE(cen::convert_pixels(source.data(),
+                                  cen::pixel_format::rgba8888,
+                                  result.data(),
+                                  cen::pixel_format::argb8888,
+                                  source.size()));
+
+  for (const auto pixel : result)
+  {
+    ASSERT_EQ(0x44112233u, pixel);
+  }
+
+  ASSERT_FALSE(cen::convert_pixels(source.data(),
+                                   cen::pixel_format::rgba8888,
+                                   result.data(),
+                                   cen::pixel_format::rgb565,
+                                   source.size()));
+}
+
+TEST(PixelConversion, ConvertPixelsInPlace)
+{
+  std::vector<cen::u32> pixels(19, 0x11223344u);
+
+  ASSERT_TRUE(cen::convert_pixels(pixels.data(),
+                                  cen::pixel_format::rgba8888,
+                                  pixels.data(),
+                                  cen::pixel_format::abgr8888,
+                                  pixels.size()));
+
+  for (const auto pixel : pixels)
+  {
+    ASSERT_EQ(0x44332211u, pixel);
+  }
+}
+
+TEST(PixelConversion, ConvertPixelsWithPitch)
+{
+  // Three rows of two pixels, with one unused pixel at the end of each source row
+  const std::array<cen::u32, 9> source = {1, 2, 0, 3, 4, 0, 5, 6, 0};
+  std::array<cen::u32, 6> result{};
+
+  ASSERT_TRUE(cen::convert_pixels({2, 3},
+                                  source.data(),
+                                  3 * 4,
+                                  cen::pixel_format::argb8888,
+                                  result.data(),
+                                  2 * 4,
+                                  cen::pixel_format::rgb888));
+
+  // Converting to a format without alpha makes the pixels opaque
+  const std::array<cen::u32, 6> expected = {0xFF000001u,
+                                            0xFF000002u,
+                                            0xFF000003u,
+                                            0xFF000004u,
+                                            0xFF000005u,
+                                            0xFF000006u};
+  ASSERT_EQ(expected, result);
+}
+
+TEST(PixelConversion, ConvertPixelsFallback)
+{
+  const std::array<cen::u32, 4> source = {0xFF0000FFu, 0x00FF00FFu, 0, 0};
+  std::array<cen::u8, 12> result{};
+
+  ASSERT_TRUE(cen::convert_pixels({2, 2},
+                                  source.data(),
+                                  2 * 4,
+                                  cen::pixel_format::rgba8888,
+                                  result.data(),
+                                  2 * 3,
+                                  cen::pixel_format::rgb24));
+
+  ASSERT_EQ(0xFF, result.at(0));
+  ASSERT_EQ(0x00, result.at(1));
+  ASSERT_EQ(0xFF, result.at(4));
+}
+
+TEST(PixelConversion, PremultiplyAlpha)
+{
+  std::vector<cen::u32> pixels(21, 0xFF80FF80u);
+
+  ASSERT_TRUE(cen::premultiply_alpha(pixels.data(),
+                                     cen::pixel_format::rgba8888,
+                                     pixels.size()));
+  for (const auto pixel : pixels)
+  {
+    ASSERT_EQ(0x80408080u, pixel);
+  }
+
+  ASSERT_TRUE(cen::unpremultiply_alpha(pixels.data(),
+                                       cen::pixel_format::rgba8888,
+                                       pixels.size()));
+  for (const auto pixel : pixels)
+  {
+    ASSERT_EQ(0xFF80FF80u, pixel);
+  }
+
+  ASSERT_FALSE(cen::premultiply_alpha(pixels.data(),
+                                      cen::pixel_format::rgb565,
+                                      pixels.size()));
+}
+
+TEST(PixelConversion, PremultiplyOpaqueFormat)
+{
+  // The padding byte of opaque formats is not interpreted as alpha
+  std::vector<cen::u32> pixels(8, 0x00112233u);
+
+  ASSERT_TRUE(cen::premultiply_alpha(pixels.data(),
+                                     cen::pixel_format::rgb888,
+                                     pixels.size()));
+  for (const auto pixel : pixels)
+  {
+    ASSERT_EQ(0x00112233u, pixel);
+  }
+}
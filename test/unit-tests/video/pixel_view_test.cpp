@@ -0,0 +1,182 @@
+#include "video/pixel_view.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>  // vector
+
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/surface.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::pixel_view>);
+static_assert(!std::is_copy_constructible_v<cen::pixel_view>);
+static_assert(!std::is_copy_assignable_v<cen::pixel_view>);
+
+TEST(PixelView, SurfaceConstruction)
+{
+  cen::surface surface{{40, 30}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  ASSERT_EQ(40, view.width());
+  ASSERT_EQ(30, view.height());
+  ASSERT_EQ(surface.pitch(), view.pitch());
+  ASSERT_EQ(cen::pixel_format::rgba8888, view.format());
+  ASSERT_EQ(4u, view.bytes_per_pixel());
+  ASSERT_EQ(surface.pixels(), view.data());
+}
+
+TEST(PixelView, SetAndGetPixel)
+{
+  cen::surface surface{{10, 10}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  view.set_pixel({3, 4}, cen::colors::red);
+  ASSERT_EQ(cen::colors::red, view.get_pixel({3, 4}));
+
+  ASSERT_TRUE(view.in_bounds({0, 0}));
+  ASSERT_TRUE(view.in_bounds({9, 9}));
+  ASSERT_FALSE(view.in_bounds({10, 0}));
+  ASSERT_FALSE(view.in_bounds({0, -1}));
+}
+
+TEST(PixelView, Row)
+{
+  cen::surface surface{{8, 4}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  auto row = view.row(2);
+  ASSERT_EQ(8u, row.size());
+
+  for (auto& pixel : row)
+  {
+    pixel = 0xFF0000FF;
+  }
+
+  ASSERT_EQ(cen::colors::red, view.get_pixel({0, 2}));
+  ASSERT_EQ(cen::colors::red, view.get_pixel({7, 2}));
+}
+
+TEST(PixelView, Fill)
+{
+  cen::surface surface{{16, 16}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  view.fill(cen::colors::black);
+  view.fill({{-4, -4}, {8, 8}}, cen::colors::blue);
+
+  ASSERT_EQ(cen::colors::blue, view.get_pixel({0, 0}));
+  ASSERT_EQ(cen::colors::blue, view.get_pixel({3, 3}));
+  ASSERT_EQ(cen::colors::black, view.get_pixel({4, 4}));
+
+  // Completely outside of the view
+  ASSERT_NO_FATAL_FAILURE(view.fill({{20, 20}, {5, 5}}, cen::colors::red));
+}
+
+TEST(PixelView, FillRgb24)
+{
+  cen::surface surface{{5, 5}, cen::pixel_format::rgb24};
+  cen::pixel_view view{surface};
+
+  view.fill(cen::colors::lime);
+  ASSERT_EQ(cen::colors::lime, view.get_pixel({4, 4}));
+}
+
+TEST(PixelView, Generate)
+{
+  for (const auto format :
+       {cen::pixel_format::rgba8888, cen::pixel_format::rgb24, cen::pixel_format::rgb565})
+  {
+    cen::surface surface{{6, 4}, format};
+    cen::pixel_view view{surface};
+
+    const auto gradient = [](const cen::ipoint pixel) {
+      return cen::color{static_cast<cen::u8>(pixel.x() * 40),
+                        static_cast<cen::u8>(pixel.y() * 60),
+                        0xFF};
+    };
+
+    view.fill(cen::colors::black);
+    view.generate({{-2, 1}, {5, 10}}, gradient);
+
+    const auto info = surface.format_info();
+    for (int y = 0; y < view.height(); ++y)
+    {
+      for (int x = 0; x < view.width(); ++x)
+      {
+        const auto inside = x < 3 && y >= 1;
+        const auto expected = inside ? gradient({x, y}) : cen::colors::black;
+
+        // The conversion must match SDL, including the precision loss of packed formats
+        const auto pixel = info.rgba_to_pixel(expected);
+        ASSERT_EQ(info.pixel_to_rgba(pixel), view.get_pixel({x, y}));
+      }
+    }
+  }
+}
+
+TEST(PixelView, CopyRect)
+{
+  cen::surface a{{10, 10}, cen::pixel_format::rgba8888};
+  cen::surface b{{10, 10}, cen::pixel_format::rgba8888};
+
+  cen::pixel_view src{a};
+  cen::pixel_view dst{b};
+
+  src.fill(cen::colors::red);
+  dst.fill(cen::colors::black);
+
+  dst.copy_rect(src, {{0, 0}, {4, 4}}, {8, 8});
+
+  ASSERT_EQ(cen::colors::red, dst.get_pixel({8, 8}));
+  ASSERT_EQ(cen::colors::red, dst.get_pixel({9, 9}));
+  ASSERT_EQ(cen::colors::black, dst.get_pixel({7, 7}));
+}
+
+TEST(PixelView, WriteAndReadRow)
+{
+  cen::surface surface{{4, 2}, cen::pixel_format::rgba8888};
+  cen::pixel_view view{surface};
+
+  const std::vector colors = {cen::colors::red,
+                              cen::colors::lime,
+                              cen::colors::blue,
+                              cen::colors::white,
+                              cen::colors::black};  // Out of bounds, ignored
+
+  view.write_row({0, 1}, colors.data(), colors.size());
+
+  std::vector<cen::color> result(4);
+  view.read_row({0, 1}, result.data(), result.size());
+
+  ASSERT_EQ(cen::colors::red, result.at(0));
+  ASSERT_EQ(cen::colors::lime, result.at(1));
+  ASSERT_EQ(cen::colors::blue, result.at(2));
+  ASSERT_EQ(cen::colors::white, result.at(3));
+}
+
+TEST(PixelView, StreamingTexture)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+
+  cen::texture texture{renderer,
+                       cen::pixel_format::rgba8888,
+                       cen::texture_access::streaming,
+                       {32, 32}};
+
+  {
+    cen::pixel_view view{texture};
+    ASSERT_EQ(32, view.width());
+    ASSERT_EQ(32, view.height());
+
+    view.fill(cen::colors::red);
+  }
+
+  cen::texture unlocked{renderer,
+                        cen::pixel_format::rgba8888,
+                        cen::texture_access::no_lock,
+                        {32, 32}};
+  ASSERT_THROW(cen::pixel_view{unlocked}, cen::sdl_error);
+}
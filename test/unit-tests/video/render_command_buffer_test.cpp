@@ -0,0 +1,287 @@
+#include "video/render_command_buffer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>       // array
+#include <functional>  // less
+#include <memory>      // unique_ptr
+#include <thread>      // thread
+#include <utility>     // move
+#include <vector>      // vector
+
+#include "core/memory_resource.hpp"
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+class RenderCommandBufferTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_first = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+    m_second = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_second.reset();
+    m_first.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_first;
+  inline static std::unique_ptr<cen::texture> m_second;
+};
+
+TEST_F(RenderCommandBufferTest, Defaults)
+{
+  const cen::render_command_buffer buffer;
+  ASSERT_TRUE(buffer.empty());
+  ASSERT_EQ(0u, buffer.size());
+}
+
+TEST_F(RenderCommandBufferTest, Recording)
+{
+  cen::render_command_buffer buffer{8};
+
+  buffer.render(*m_first, {{0, 0}, {32, 32}});
+  buffer.render(*m_first, {{0, 0}, {16, 16}}, {{32, 0}, {32, 32}}, cen::blend_mode::add);
+  buffer.fill_rect({{10, 10}, {20, 20}}, cen::colors::red);
+  buffer.draw_rect({{10, 10}, {20, 20}}, cen::colors::blue);
+  buffer.draw_line({1, 2}, {3, 4}, cen::colors::green);
+  ASSERT_EQ(5u, buffer.size());
+
+  const auto& line = *(buffer.begin() + 4);
+  ASSERT_EQ(cen::render_command_type::draw_line, line.type);
+  ASSERT_EQ(nullptr, line.texture);
+  ASSERT_EQ(cen::colors::green, line.tint);
+  ASSERT_EQ(3, line.destination.width());
+
+  buffer.clear();
+  ASSERT_TRUE(buffer.empty());
+}
+
+TEST_F(RenderCommandBufferTest, Sort)
+{
+  cen::render_command_buffer buffer;
+
+  buffer.render(*m_first, {{0, 0}, {32, 32}}, cen::blend_mode::blend, 1);
+  buffer.render(*m_second, {{0, 0}, {32, 32}});
+  buffer.render(*m_first, {{0, 0}, {32, 32}});
+  buffer.render(*m_second, {{1, 0}, {32, 32}});
+
+  buffer.sort();
+
+  const auto firstIsLower =
+      std::less<const SDL_Texture*>{}(m_first->get(), m_second->get());
+  const auto* lower = firstIsLower ? m_first->get() : m_second->get();
+  ASSERT_EQ(0, buffer.begin()->layer);
+  ASSERT_EQ(lower, buffer.begin()->texture);
+  ASSERT_EQ(1, (buffer.begin() + 3)->layer);
+
+  // The sort is stable
+  const auto& a = *(m_second->get() == lower ? buffer.begin() : buffer.begin() + 1);
+  const auto& b = *(m_second->get() == lower ? buffer.begin() + 1 : buffer.begin() + 2);
+  ASSERT_EQ(0, a.destination.x());
+  ASSERT_EQ(1, b.destination.x());
+}
+
+TEST_F(RenderCommandBufferTest, ParallelRecording)
+{
+  std::array<cen::render_command_buffer, 4> buffers;
+  std::array<std::thread, 4> threads;
+
+  for (auto i = 0u; i < threads.size(); ++i)
+  {
+    threads[i] = std::thread{[&buffer = buffers[i], this] {
+      for (auto j = 0; j < 100; ++j)
+      {
+        buffer.render(*m_first, {{0, 0}, {8, 8}});
+        buffer.fill_rect({{0, 0}, {8, 8}}, cen::colors::pink);
+      }
+    }};
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  cen::render_command_buffer merged;
+  for (const auto& buffer : buffers)
+  {
+    merged.append(buffer);
+  }
+
+  ASSERT_EQ(800u, merged.size());
+}
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+TEST_F(RenderCommandBufferTest, MemoryResource)
+{
+  cen::frame_resource arena;
+
+  cen::render_command_buffer buffer{16, &arena};
+  ASSERT_EQ(&arena, buffer.get_resource());
+  ASSERT_LT(0u, arena.capacity());
+
+  buffer.fill_rect({{0, 0}, {8, 8}}, cen::colors::pink);
+  ASSERT_EQ(1u, buffer.size());
+
+  const auto copy = buffer;
+  ASSERT_EQ(1u, copy.size());
+  ASSERT_EQ(std::pmr::get_default_resource(), copy.get_resource());
+
+  const auto moved = std::move(buffer);
+  ASSERT_EQ(&arena, moved.get_resource());
+}
+
+TEST_F(RenderCommandBufferTest, ParallelRecordingWithArenas)
+{
+  std::array<cen::frame_resource, 4> arenas;
+
+  {
+    std::vector<cen::render_command_buffer> buffers;
+    buffers.reserve(arenas.size());
+
+    for (auto& arena : arenas)
+    {
+      buffers.emplace_back(&arena);
+    }
+
+    std::array<std::thread, 4> threads;
+    for (auto i = 0u; i < threads.size(); ++i)
+    {
+      threads[i] = std::thread{[&buffer = buffers[i], this] {
+        for (auto j = 0; j < 100; ++j)
+        {
+          buffer.render(*m_first, {{0, 0}, {8, 8}});
+          buffer.fill_rect({{0, 0}, {8, 8}}, cen::colors::pink);
+        }
+      }};
+    }
+
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    cen::render_command_buffer merged{800, &m_renderer->frame_resource()};
+    for (auto i = 0u; i < buffers.size(); ++i)
+    {
+      ASSERT_EQ(&arenas[i], buffers[i].get_resource());
+      ASSERT_LT(0u, arenas[i].capacity());
+      merged.append(buffers[i]);
+    }
+
+    ASSERT_EQ(800u, merged.size());
+  }
+
+  // The buffers of the frame are destroyed, so the arenas can be reused
+  for (auto& arena : arenas)
+  {
+    arena.reset();
+  }
+}
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+TEST_F(RenderCommandBufferTest, Submit)
+{
+  const auto color = m_renderer->get_color();
+  const auto mode = m_renderer->get_blend_mode();
+
+  cen::render_command_buffer buffer;
+  buffer.render(*m_first, {{0, 0}, {32, 32}});
+  buffer.fill_rect({{10, 10}, {20, 20}}, cen::colors::red, 1);
+
+  cen::render_command cmd;
+  cmd.texture = m_second->get();
+  cmd.destination = {{50, 50}, {32, 32}};
+  cmd.angle = 45;
+  cmd.flip = SDL_FLIP_HORIZONTAL;
+  cmd.tint = cen::colors::yellow;
+  buffer.push(cmd);
+
+  m_second->set_color_mod(cen::colors::red);
+  m_second->set_alpha(0x80);
+
+  buffer.sort();
+  ASSERT_TRUE(buffer.submit(*m_renderer));
+
+  ASSERT_EQ(color, m_renderer->get_color());
+  ASSERT_EQ(mode, m_renderer->get_blend_mode());
+
+  // The modulation of tinted textures is restored
+  ASSERT_EQ(cen::colors::red, m_second->color_mod());
+  ASSERT_EQ(0x80, m_second->alpha());
+
+  m_second->set_color_mod(cen::colors::white);
+  m_second->set_alpha(0xFF);
+}
+
+TEST_F(RenderCommandBufferTest, Transform)
+{
+  cen::render_command_buffer buffer;
+  buffer.render(*m_first, {{0, 0}, {10, 20}});
+  buffer.fill_rect({{10, 10}, {20, 20}}, cen::colors::red);
+  buffer.draw_line({1, 2}, {3, 4}, cen::colors::blue);
+
+  buffer.transform(cen::transform2d::translation(5, -5) *
+                   cen::transform2d::scaling(2, 2));
+
+  auto it = buffer.begin();
+  ASSERT_EQ(cen::frect(cen::fpoint{5, -5}, {20, 40}), it->destination);
+  ASSERT_FLOAT_EQ(0, static_cast<float>(it->angle));
+
+  ++it;
+  ASSERT_EQ(cen::frect(cen::fpoint{25, 15}, {40, 40}), it->destination);
+
+  ++it;
+  ASSERT_EQ(cen::frect(cen::fpoint{7, -1}, {11, 3}), it->destination);
+
+  buffer.transform(cen::transform2d::rotation(90));
+  ASSERT_NEAR(90.0, buffer.begin()->angle, 0.001);
+}
+
+TEST_F(RenderCommandBufferTest, OffsetLatched)
+{
+  cen::render_command_buffer buffer;
+  buffer.latch_last();  // No effect on an empty buffer
+
+  buffer.fill_rect({{10, 10}, {20, 20}}, cen::colors::red);
+  buffer.render(*m_first, {{0, 0}, {32, 32}});
+  buffer.latch_last();
+  buffer.draw_line({1, 2}, {3, 4}, cen::colors::blue);
+  buffer.latch_last();
+
+  buffer.sort();
+  ASSERT_EQ(2u, buffer.offset_latched({5, -5}));
+
+  for (const auto& cmd : buffer)
+  {
+    if (cmd.type == cen::render_command_type::fill_rect)
+    {
+      ASSERT_FALSE(cmd.latched);
+      ASSERT_EQ(cen::frect(cen::fpoint{10, 10}, {20, 20}), cmd.destination);
+    }
+    else if (cmd.type == cen::render_command_type::texture)
+    {
+      ASSERT_TRUE(cmd.latched);
+      ASSERT_EQ(cen::frect(cen::fpoint{5, -5}, {32, 32}), cmd.destination);
+    }
+    else
+    {
+      ASSERT_TRUE(cmd.latched);
+      ASSERT_EQ(cen::frect(cen::fpoint{6, -3}, {8, -1}), cmd.destination);
+    }
+  }
+}
@@ -0,0 +1,88 @@
+#include "video/render_layer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <type_traits>
+
+#include "video/colors.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::render_layer>);
+
+class RenderLayerTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(RenderLayerTest, Construction)
+{
+  const cen::render_layer layer{*m_renderer, {64, 32}};
+  ASSERT_EQ((cen::iarea{64, 32}), layer.size());
+  ASSERT_FALSE(layer.is_valid());
+  ASSERT_EQ(0u, layer.paint_count());
+  ASSERT_TRUE(layer.get().is_target());
+}
+
+TEST_F(RenderLayerTest, Render)
+{
+  cen::render_layer layer{*m_renderer, {64, 32}};
+
+  int calls = 0;
+  const auto paint = [&](cen::renderer& target) {
+    ++calls;
+    target.fill_with(cen::colors::red);
+  };
+
+  ASSERT_TRUE(layer.render(*m_renderer, cen::ipoint{10, 10}, paint));
+  ASSERT_TRUE(layer.is_valid());
+  ASSERT_EQ(1, calls);
+
+  // Valid layers are only composited
+  ASSERT_TRUE(layer.render(*m_renderer, cen::ipoint{10, 10}, paint));
+  ASSERT_TRUE(layer.render(*m_renderer, cen::fpoint{20, 20}));
+  ASSERT_EQ(1, calls);
+  ASSERT_EQ(1u, layer.paint_count());
+
+  layer.invalidate();
+  ASSERT_FALSE(layer.is_valid());
+
+  ASSERT_TRUE(layer.render(*m_renderer, cen::ipoint{10, 10}, paint));
+  ASSERT_EQ(2, calls);
+  ASSERT_EQ(2u, layer.paint_count());
+}
+
+TEST_F(RenderLayerTest, RestoresTarget)
+{
+  cen::render_layer layer{*m_renderer, {16, 16}};
+  cen::texture other{*m_renderer,
+                     cen::pixel_format::rgba8888,
+                     cen::texture_access::target,
+                     {16, 16}};
+
+  ASSERT_TRUE(layer.update(*m_renderer, [](cen::renderer&) {}));
+  ASSERT_EQ(nullptr, SDL_GetRenderTarget(m_renderer->get()));
+
+  // Layers can be painted while rendering to another target
+  ASSERT_TRUE(m_renderer->set_target(other));
+
+  layer.invalidate();
+  ASSERT_TRUE(layer.update(*m_renderer, [](cen::renderer&) {}));
+  ASSERT_EQ(other.get(), SDL_GetRenderTarget(m_renderer->get()));
+
+  ASSERT_TRUE(m_renderer->reset_target());
+}
@@ -0,0 +1,80 @@
+#include "video/render_scaler.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+#include "video/window.hpp"
+
+TEST(RenderScaler, Construction)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+
+  ASSERT_THROW(cen::render_scaler(renderer, 0.0f), cen::cen_error);
+  ASSERT_THROW(cen::render_scaler(renderer, -0.5f), cen::cen_error);
+  ASSERT_THROW(cen::render_scaler(renderer, 1.5f), cen::cen_error);
+
+  const cen::render_scaler scaler{renderer, 0.5f};
+  ASSERT_EQ(0.5f, scaler.world_scale());
+  ASSERT_EQ((cen::iarea{0, 0}), scaler.world_size());
+}
+
+TEST(RenderScaler, Frame)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+  cen::render_scaler scaler{renderer, 0.5f};
+
+  ASSERT_FALSE(scaler.world_texture());
+
+  ASSERT_TRUE(scaler.begin_world());
+  ASSERT_TRUE(scaler.world_texture());
+
+  const auto output = renderer.output_size();
+  ASSERT_EQ(output, scaler.output_size());
+  ASSERT_EQ((cen::iarea{output.width / 2, output.height / 2}), scaler.world_size());
+  ASSERT_EQ(scaler.world_size(), scaler.world_texture()->size());
+
+  ASSERT_TRUE(scaler.end_world());
+
+  ASSERT_TRUE(scaler.begin_ui());
+  ASSERT_LT(0.0f, scaler.pixel_ratio().width);
+  ASSERT_LT(0.0f, scaler.pixel_ratio().height);
+  ASSERT_TRUE(scaler.end_ui());
+
+  {  // The world texture is only recreated when its size changes
+    const auto* texture = scaler.world_texture();
+
+    scaler.invalidate();
+    ASSERT_TRUE(scaler.begin_world());
+    ASSERT_TRUE(scaler.end_world());
+    ASSERT_EQ(texture, scaler.world_texture());
+
+    scaler.set_world_scale(1.0f);
+    ASSERT_TRUE(scaler.begin_world());
+    ASSERT_TRUE(scaler.end_world());
+    ASSERT_EQ(output, scaler.world_size());
+  }
+}
+
+TEST(RenderScaler, Handle)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+  cen::render_scaler scaler{renderer};
+
+  ASSERT_TRUE(scaler.begin_world());
+  ASSERT_TRUE(scaler.end_world());
+
+  window.set_size({400, 300});
+
+  SDL_WindowEvent event{};
+  event.type = SDL_WINDOWEVENT;
+  event.windowID = window.id();
+  event.event = static_cast<cen::u8>(SDL_WINDOWEVENT_SIZE_CHANGED);
+  scaler.handle(cen::window_event{event});
+
+  ASSERT_TRUE(scaler.begin_world());
+  ASSERT_TRUE(scaler.end_world());
+  ASSERT_EQ(renderer.output_size(), scaler.world_size());
+}
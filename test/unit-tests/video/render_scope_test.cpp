@@ -0,0 +1,149 @@
+#include "video/render_scope.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <type_traits>
+
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::clip_scope<cen::detail::owning_type>>);
+static_assert(std::is_final_v<cen::target_scope<cen::detail::owning_type>>);
+
+static_assert(!std::is_copy_constructible_v<cen::clip_scope<cen::detail::owning_type>>);
+static_assert(!std::is_copy_constructible_v<cen::target_scope<cen::detail::owning_type>>);
+
+class RenderScopeTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_texture = std::make_unique<cen::texture>(*m_renderer,
+                                               cen::pixel_format::rgba8888,
+                                               cen::texture_access::target,
+                                               cen::iarea{64, 64});
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_texture.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_texture;
+};
+
+TEST_F(RenderScopeTest, ClipIntersection)
+{
+  ASSERT_TRUE(m_renderer->set_clip(std::nullopt));
+
+  {
+    const cen::clip_scope outer{*m_renderer, {10, 10, 100, 100}};
+    ASSERT_TRUE(outer.is_active());
+    ASSERT_EQ(1u, m_renderer->clip_depth());
+    ASSERT_EQ((cen::irect{10, 10, 100, 100}), m_renderer->clip());
+
+    {
+      const cen::clip_scope inner{*m_renderer, {50, 0, 100, 40}};
+      ASSERT_EQ(2u, m_renderer->clip_depth());
+      ASSERT_EQ((cen::irect{50, 10, 60, 30}), m_renderer->clip());
+    }
+
+    ASSERT_EQ(1u, m_renderer->clip_depth());
+    ASSERT_EQ((cen::irect{10, 10, 100, 100}), m_renderer->clip());
+  }
+
+  ASSERT_EQ(0u, m_renderer->clip_depth());
+  ASSERT_FALSE(m_renderer->clip().has_value());
+}
+
+TEST_F(RenderScopeTest, RestoresOriginalClip)
+{
+  constexpr cen::irect original{0, 0, 200, 150};
+  ASSERT_TRUE(m_renderer->set_clip(original));
+
+  {
+    const cen::clip_scope scope{*m_renderer, {100, 100, 200, 200}};
+    ASSERT_EQ((cen::irect{100, 100, 100, 50}), m_renderer->clip());
+  }
+
+  ASSERT_EQ(original, m_renderer->clip());
+  ASSERT_TRUE(m_renderer->set_clip(std::nullopt));
+}
+
+TEST_F(RenderScopeTest, EmptyIntersection)
+{
+  const cen::clip_scope outer{*m_renderer, {0, 0, 10, 10}};
+  const cen::clip_scope inner{*m_renderer, {20, 20, 10, 10}};
+
+  // Clip rectangles without area clip everything
+  ASSERT_EQ(2u, m_renderer->clip_depth());
+  ASSERT_FALSE(m_renderer->clip().has_value());
+}
+
+TEST_F(RenderScopeTest, PopWithoutPush)
+{
+  ASSERT_FALSE(m_renderer->pop_clip());
+  ASSERT_FALSE(m_renderer->pop_target());
+}
+
+TEST_F(RenderScopeTest, Target)
+{
+  ASSERT_EQ(nullptr, SDL_GetRenderTarget(m_renderer->get()));
+
+  {
+    const cen::target_scope scope{*m_renderer, *m_texture};
+    ASSERT_TRUE(scope.is_active());
+    ASSERT_EQ(1u, m_renderer->target_depth());
+    ASSERT_EQ(m_texture->get(), SDL_GetRenderTarget(m_renderer->get()));
+
+    {
+      // Pushing the active target again doesn't change anything
+      const cen::target_scope same{*m_renderer, *m_texture};
+      ASSERT_EQ(2u, m_renderer->target_depth());
+      ASSERT_EQ(m_texture->get(), SDL_GetRenderTarget(m_renderer->get()));
+    }
+
+    ASSERT_EQ(m_texture->get(), SDL_GetRenderTarget(m_renderer->get()));
+  }
+
+  ASSERT_EQ(0u, m_renderer->target_depth());
+  ASSERT_EQ(nullptr, SDL_GetRenderTarget(m_renderer->get()));
+}
+
+TEST_F(RenderScopeTest, ClipsAreIndependentOfTargets)
+{
+  const cen::clip_scope windowClip{*m_renderer, {10, 10, 20, 20}};
+
+  {
+    const cen::target_scope target{*m_renderer, *m_texture};
+    ASSERT_EQ(1u, m_renderer->clip_depth());
+
+    // The clip of the window doesn't affect the texture
+    const cen::clip_scope textureClip{*m_renderer, {40, 40, 10, 10}};
+    ASSERT_EQ(2u, m_renderer->clip_depth());
+    ASSERT_EQ((cen::irect{40, 40, 10, 10}), m_renderer->clip());
+  }
+
+  ASSERT_EQ(1u, m_renderer->clip_depth());
+  ASSERT_EQ((cen::irect{10, 10, 20, 20}), m_renderer->clip());
+}
+
+TEST_F(RenderScopeTest, StateCaching)
+{
+  m_renderer->set_state_caching(true);
+
+  {
+    const cen::clip_scope outer{*m_renderer, {0, 0, 50, 50}};
+    const cen::clip_scope inner{*m_renderer, {0, 0, 50, 50}};
+    ASSERT_EQ((cen::irect{0, 0, 50, 50}), m_renderer->clip());
+  }
+
+  ASSERT_FALSE(m_renderer->clip().has_value());
+  m_renderer->set_state_caching(false);
+}
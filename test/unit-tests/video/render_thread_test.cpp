@@ -0,0 +1,39 @@
+#include "video/render_thread.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>  // atomic
+
+#include "video/window.hpp"
+
+TEST(RenderThread, Publish)
+{
+  cen::window window;
+
+  std::atomic<bool> executed{false};
+
+  {
+    cen::render_thread renderer{window};
+    ASSERT_EQ(0u, renderer.published_frames());
+
+    renderer.execute([&](cen::renderer& target) { executed = target.get() != nullptr; });
+
+    auto& snapshot = renderer.snapshot();
+    snapshot.background = cen::colors::pink;
+    snapshot.view = cen::transform2d::translation(10, 10);
+    snapshot.commands.fill_rect({{0, 0}, {10, 10}}, cen::colors::red);
+
+    ASSERT_EQ(0u, renderer.publish());
+    ASSERT_EQ(1u, renderer.published_frames());
+
+    // The next snapshot is empty, but keeps the view and background
+    ASSERT_TRUE(renderer.snapshot().commands.empty());
+    ASSERT_EQ(cen::colors::pink, renderer.snapshot().background);
+    ASSERT_EQ(cen::transform2d::translation(10, 10), renderer.snapshot().view);
+
+    ASSERT_EQ(1u, renderer.publish());
+    ASSERT_LE(renderer.rendered_frames() + renderer.dropped_frames(), 2u);
+  }
+
+  ASSERT_TRUE(executed);
+}
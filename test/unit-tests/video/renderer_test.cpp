@@ -2,8 +2,10 @@
 
 #include <gtest/gtest.h>
 
+#include <array>     // array
 #include <iostream>  // cout
 #include <memory>    // unique_ptr
+#include <vector>    // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
@@ -192,6 +194,39 @@ TEST_F(RendererTest, TranslatedRenderWithSourceDestinationAngleCenterFlip)
   }
 }
 
+TEST_F(RendererTest, DrawRects)
+{
+  const std::array<cen::irect, 2> rects{{{{10, 10}, {20, 20}}, {{40, 10}, {20, 20}}}};
+  ASSERT_TRUE(m_renderer->draw_rects(rects));
+  ASSERT_TRUE(m_renderer->fill_rects(rects));
+
+  const std::vector<cen::frect> none;
+  ASSERT_FALSE(m_renderer->draw_rects(none));
+  ASSERT_FALSE(m_renderer->fill_rects(none));
+}
+
+TEST_F(RendererTest, DrawPoints)
+{
+  const std::array<cen::fpoint, 3> points{{{1, 2}, {3, 4}, {5, 6}}};
+  ASSERT_TRUE(m_renderer->draw_points(points));
+
+  const std::vector<cen::ipoint> none;
+  ASSERT_FALSE(m_renderer->draw_points(none));
+}
+
+TEST_F(RendererTest, TranslatedBulkPrimitives)
+{
+  const std::vector<cen::irect> rects{{{10, 10}, {20, 20}}, {{40, 10}, {20, 20}}};
+  ASSERT_TRUE(m_renderer->draw_rects_t(rects));
+  ASSERT_TRUE(m_renderer->fill_rects_t(rects));
+
+  const std::vector<cen::fpoint> points{{1, 2}, {3, 4}};
+  ASSERT_TRUE(m_renderer->draw_points_t(points));
+
+  const std::vector<cen::fpoint> none;
+  ASSERT_FALSE(m_renderer->draw_points_t(none));
+}
+
 TEST_F(RendererTest, AddFont)
 {
   const auto id = 7;
@@ -301,6 +336,52 @@ TEST_F(RendererTest, SetLogicalIntegerScaling)
   ASSERT_FALSE(m_renderer->is_using_integer_logical_scaling());
 }
 
+TEST_F(RendererTest, SetStateCaching)
+{
+  ASSERT_FALSE(m_renderer->is_state_caching());
+
+  m_renderer->set_state_caching(true);
+  ASSERT_TRUE(m_renderer->is_state_caching());
+
+  m_renderer->set_color(cen::colors::orange);
+  ASSERT_EQ(cen::colors::orange, m_renderer->get_color());
+  ASSERT_EQ(cen::success, m_renderer->set_color(cen::colors::orange));
+
+  m_renderer->set_blend_mode(cen::blend_mode::add);
+  ASSERT_EQ(cen::blend_mode::add, m_renderer->get_blend_mode());
+
+  constexpr cen::irect clip{{10, 20}, {30, 40}};
+  m_renderer->set_clip(clip);
+  ASSERT_EQ(clip, m_renderer->clip());
+
+  m_renderer->set_clip(std::nullopt);
+  ASSERT_FALSE(m_renderer->clip().has_value());
+
+  // Bypass the cache, and make sure that resetting the cache picks up the change
+  SDL_SetRenderDrawColor(m_renderer->get(), 1, 2, 3, 4);
+  m_renderer->reset_state_cache();
+  ASSERT_EQ(cen::color(1, 2, 3, 4), m_renderer->get_color());
+
+  m_renderer->set_blend_mode(cen::blend_mode::blend);
+
+  m_renderer->set_state_caching(false);
+  ASSERT_FALSE(m_renderer->is_state_caching());
+}
+
+TEST_F(RendererTest, SetPresentCallback)
+{
+  int presented = 0;
+  m_renderer->set_present_callback([&presented] { ++presented; });
+
+  m_renderer->present();
+  m_renderer->present();
+  ASSERT_EQ(2, presented);
+
+  m_renderer->set_present_callback(nullptr);
+  m_renderer->present();
+  ASSERT_EQ(2, presented);
+}
+
 TEST_F(RendererTest, GetRenderTarget)
 {
   ASSERT_EQ(nullptr, m_renderer->get_render_target().get());
@@ -358,6 +439,14 @@ TEST_F(RendererTest, Capture)
   m_renderer->set_color(cen::colors::maroon);
   m_renderer->fill_circle({400, 300}, 35);
 
+  m_renderer->set_color(cen::colors::navy);
+  const std::array<cen::fpoint, 3> centers{{{500, 100}, {540, 100}, {580, 100}}};
+  ASSERT_TRUE(m_renderer->draw_circles(centers, 15));
+  ASSERT_TRUE(m_renderer->fill_circles(centers, 10));
+
+  const std::vector<cen::ipoint> none;
+  ASSERT_TRUE(m_renderer->draw_circles(none, 15));
+
   m_renderer->present();
 
   const auto snapshot = m_renderer->capture(m_window->get_pixel_format());
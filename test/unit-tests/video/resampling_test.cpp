@@ -0,0 +1,125 @@
+#include "video/resampling.hpp"
+
+#include <gtest/gtest.h>
+
+#include "core/exception.hpp"
+#include "thread/thread_pool.hpp"
+#include "video/colors.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_gradient(const cen::iarea size, const cen::pixel_format format)
+    -> cen::surface
+{
+  cen::surface surface{size, format};
+  for (int y = 0; y < size.height; ++y)
+  {
+    for (int x = 0; x < size.width; ++x)
+    {
+      const auto red = static_cast<cen::u8>((x * 255) / size.width);
+      const auto green = static_cast<cen::u8>((y * 255) / size.height);
+      surface.set_pixel({x, y}, cen::color{red, green, 0x80, 0xFF});
+    }
+  }
+
+  return surface;
+}
+
+[[nodiscard]] auto pixel_at(const cen::surface& surface, const cen::ipoint position)
+    -> cen::color
+{
+  const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+  const auto index = position.y() * (surface.pitch() / 4) + position.x();
+  return surface.format_info().pixel_to_rgba(pixels[index]);
+}
+
+}  // namespace
+
+TEST(Resampling, Resize)
+{
+  const auto source = make_gradient({64, 48}, cen::pixel_format::rgba8888);
+
+  for (const auto filter : {cen::resample_filter::box,
+                            cen::resample_filter::bilinear,
+                            cen::resample_filter::lanczos})
+  {
+    const auto resized = cen::resize(source, {16, 12}, filter);
+    ASSERT_EQ((cen::iarea{16, 12}), resized.size());
+    ASSERT_EQ(cen::pixel_format::rgba8888, resized.format_info().format());
+
+    // Constant channels are preserved exactly, and gradients remain monotonic
+    ASSERT_EQ(0x80, pixel_at(resized, {5, 5}).blue());
+    ASSERT_EQ(0xFF, pixel_at(resized, {5, 5}).alpha());
+    ASSERT_LT(pixel_at(resized, {2, 2}).red(), pixel_at(resized, {12, 2}).red());
+    ASSERT_LT(pixel_at(resized, {2, 2}).green(), pixel_at(resized, {2, 9}).green());
+  }
+
+  ASSERT_THROW(cen::resize(source, {0, 10}), cen::cen_error);
+}
+
+TEST(Resampling, ResizeUnsupportedFormat)
+{
+  cen::surface source{{8, 8}, cen::pixel_format::rgb565};
+  source.set_blend_mode(cen::blend_mode::add);
+
+  const auto resized = cen::resize(source, {3, 5});
+  ASSERT_EQ(cen::pixel_format::argb8888, resized.format_info().format());
+  ASSERT_EQ((cen::iarea{3, 5}), resized.size());
+  ASSERT_EQ(cen::blend_mode::add, resized.get_blend_mode());
+}
+
+TEST(Resampling, ResizeInParallel)
+{
+  cen::thread_pool pool{4};
+
+  const auto source = make_gradient({300, 200}, cen::pixel_format::argb8888);
+  const auto filter = cen::resample_filter::lanczos;
+  const auto serial = cen::resize(source, {97, 61}, filter);
+  const auto parallel = cen::resize(pool, source, {97, 61}, filter);
+
+  for (int y = 0; y < 61; ++y)
+  {
+    for (int x = 0; x < 97; ++x)
+    {
+      ASSERT_EQ(pixel_at(serial, {x, y}), pixel_at(parallel, {x, y}));
+    }
+  }
+}
+
+TEST(Resampling, MakeMipmaps)
+{
+  cen::surface source{{8, 3}, cen::pixel_format::abgr8888};
+  for (int y = 0; y < 3; ++y)
+  {
+    for (int x = 0; x < 8; ++x)
+    {
+      source.set_pixel({x, y}, cen::colors::red);
+    }
+  }
+
+  const auto levels = cen::make_mipmaps(source);
+  ASSERT_EQ(3u, levels.size());
+  ASSERT_EQ((cen::iarea{4, 1}), levels.at(0).size());
+  ASSERT_EQ((cen::iarea{2, 1}), levels.at(1).size());
+  ASSERT_EQ((cen::iarea{1, 1}), levels.at(2).size());
+
+  for (const auto& level : levels)
+  {
+    ASSERT_EQ(cen::colors::red, pixel_at(level, {0, 0}));
+  }
+
+  cen::thread_pool pool{2};
+  const auto square = make_gradient({256, 256}, cen::pixel_format::rgba8888);
+
+  const auto chain = cen::make_mipmaps(pool, square);
+  ASSERT_EQ(8u, chain.size());
+  ASSERT_EQ((cen::iarea{128, 128}), chain.front().size());
+  ASSERT_EQ((cen::iarea{1, 1}), chain.back().size());
+
+  // The 2x2 averages match the box filter
+  const auto box = cen::resize(square, {128, 128}, cen::resample_filter::box);
+  ASSERT_EQ(pixel_at(box, {17, 93}), pixel_at(chain.front(), {17, 93}));
+
+  cen::surface tiny{{1, 1}, cen::pixel_format::rgba8888};
+  ASSERT_TRUE(cen::make_mipmaps(tiny).empty());
+}
@@ -0,0 +1,147 @@
+#include "video/shape_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <vector>  // vector
+
+#include "core/exception.hpp"
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class ShapeBatchTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(ShapeBatchTest, Defaults)
+{
+  const cen::shape_batch batch;
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.vertex_count());
+  ASSERT_EQ(0u, batch.triangle_count());
+}
+
+TEST_F(ShapeBatchTest, Lines)
+{
+  cen::shape_batch batch;
+
+  batch.add_line({0, 0}, {10, 0}, {4}, cen::colors::red);
+  ASSERT_EQ(4u, batch.vertex_count());
+  ASSERT_EQ(2u, batch.triangle_count());
+
+  // Lines without a length are ignored
+  batch.add_line({5, 5}, {5, 5}, {4}, cen::colors::red);
+  ASSERT_EQ(4u, batch.vertex_count());
+}
+
+TEST_F(ShapeBatchTest, Joins)
+{
+  const std::vector<cen::fpoint> corner{{0, 0}, {10, 0}, {10, 10}};
+
+  cen::shape_batch bevel;
+  bevel.add_polyline(corner, {4, cen::line_join::bevel}, cen::colors::red);
+  ASSERT_EQ(5u, bevel.triangle_count());  // Two segments and a bevel
+
+  cen::shape_batch miter;
+  miter.add_polyline(corner, {4, cen::line_join::miter}, cen::colors::red);
+  ASSERT_EQ(6u, miter.triangle_count());
+
+  // A right angle has a miter length of sqrt(2) times the width
+  cen::shape_batch limited;
+  limited.add_polyline(corner, {4, cen::line_join::miter, cen::line_cap::butt, 1.2f},
+                       cen::colors::red);
+  ASSERT_EQ(5u, limited.triangle_count());
+
+  cen::shape_batch round;
+  round.add_polyline(corner, {4, cen::line_join::round}, cen::colors::red);
+  ASSERT_GT(round.triangle_count(), 5u);
+
+  cen::shape_batch closed;
+  closed.add_polyline(corner, {4, cen::line_join::bevel}, cen::colors::red, true);
+  ASSERT_EQ(9u, closed.triangle_count());  // Three segments and three bevels
+}
+
+TEST_F(ShapeBatchTest, Caps)
+{
+  cen::shape_batch butt;
+  butt.add_line({0, 0}, {10, 0}, {4, cen::line_join::miter, cen::line_cap::butt}, {});
+
+  cen::shape_batch square;
+  square.add_line({0, 0}, {10, 0}, {4, cen::line_join::miter, cen::line_cap::square}, {});
+  ASSERT_EQ(butt.triangle_count(), square.triangle_count());
+
+  cen::shape_batch round;
+  round.add_line({0, 0}, {10, 0}, {4, cen::line_join::miter, cen::line_cap::round}, {});
+  ASSERT_GT(round.triangle_count(), butt.triangle_count());
+}
+
+TEST_F(ShapeBatchTest, Polygons)
+{
+  const std::vector<cen::fpoint> shape{{0, 0}, {20, 0}, {20, 20}, {10, 12}, {0, 20}};
+  const cen::polygon_mesh mesh{shape};
+  ASSERT_EQ(3u, mesh.triangle_count());
+
+  cen::shape_batch batch;
+  batch.add_polygon(mesh, cen::colors::blue);
+  batch.add_polygon(mesh, cen::colors::blue, {30, 0});
+  ASSERT_EQ(10u, batch.vertex_count());
+  ASSERT_EQ(6u, batch.triangle_count());
+
+  ASSERT_TRUE(batch.add_polygon(shape, cen::colors::green));
+  ASSERT_EQ(9u, batch.triangle_count());
+
+  const std::vector<cen::fpoint> line{{0, 0}, {10, 10}};
+  ASSERT_FALSE(batch.add_polygon(line, cen::colors::green));
+  ASSERT_EQ(9u, batch.triangle_count());
+
+  ASSERT_THROW(cen::polygon_mesh{line}, cen::cen_error);
+}
+
+TEST_F(ShapeBatchTest, Circles)
+{
+  cen::shape_batch batch;
+
+  batch.add_circle({50, 50}, 20, cen::colors::white);
+  ASSERT_EQ(0u, (batch.vertex_count() - 1) % 2);  // A center and two rings
+  ASSERT_EQ(3u * (batch.vertex_count() - 1) / 2, batch.triangle_count());
+
+  batch.clear();
+  batch.add_ring({50, 50}, 20, 3, cen::colors::white);
+  ASSERT_EQ(6u * batch.vertex_count() / 4, batch.triangle_count());
+
+  batch.add_circle({0, 0}, 0, cen::colors::white);
+  batch.add_ring({0, 0}, 10, 0, cen::colors::white);
+  ASSERT_EQ(6u * batch.vertex_count() / 4, batch.triangle_count());
+}
+
+TEST_F(ShapeBatchTest, Submit)
+{
+  cen::shape_batch batch;
+  ASSERT_TRUE(batch.submit(*m_renderer));
+
+  batch.add_line({0, 0}, {100, 50}, {3, cen::line_join::round}, cen::colors::red);
+  batch.add_circle({50, 50}, 10, cen::colors::white);
+
+  ASSERT_TRUE(batch.submit(*m_renderer));
+  ASSERT_TRUE(batch.empty());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,99 @@
+#include "video/shared_surface.hpp"
+
+#include <gtest/gtest.h>
+
+#include <type_traits>  // is_nothrow_copy_constructible_v
+#include <utility>      // move
+
+#include "core/exception.hpp"
+#include "video/colors.hpp"
+
+static_assert(std::is_nothrow_copy_constructible_v<cen::shared_surface>);
+static_assert(std::is_nothrow_move_constructible_v<cen::shared_surface>);
+
+TEST(SharedSurface, Construction)
+{
+  ASSERT_THROW(cen::shared_surface{static_cast<SDL_Surface*>(nullptr)}, cen::cen_error);
+  ASSERT_THROW(cen::shared_surface{"foobar"}, cen::img_error);
+
+  const cen::shared_surface image{"resources/panda.png"};
+  ASSERT_TRUE(image.is_unique());
+
+  cen::surface source{{8, 4}, cen::pixel_format::rgba8888};
+  const auto* ptr = source.get();
+
+  const cen::shared_surface shared{std::move(source)};
+  ASSERT_EQ(ptr, shared.get());
+  ASSERT_EQ(8, shared.width());
+  ASSERT_EQ(4, shared.height());
+}
+
+TEST(SharedSurface, CopyOnWrite)
+{
+  cen::shared_surface original{cen::surface{{4, 4}, cen::pixel_format::rgba8888}};
+  original.set_pixel({1, 1}, cen::colors::red);
+
+  auto copy = original;
+  ASSERT_EQ(original.get(), copy.get());
+  ASSERT_EQ(2, original.use_count());
+  ASSERT_FALSE(copy.is_unique());
+
+  // Reading never copies the pixels
+  ASSERT_EQ(original.pixels(), std::as_const(copy).pixels());
+  ASSERT_EQ(original.get(), copy.view().get());
+
+  copy.set_pixel({1, 1}, cen::colors::blue);
+  ASSERT_NE(original.get(), copy.get());
+  ASSERT_TRUE(original.is_unique());
+  ASSERT_TRUE(copy.is_unique());
+
+  const auto readPixel = [](const cen::shared_surface& surface) {
+    const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+    return surface.format_info().pixel_to_rgba(pixels[(surface.pitch() / 4) + 1]);
+  };
+
+  ASSERT_EQ(cen::colors::red, readPixel(original));
+  ASSERT_EQ(cen::colors::blue, readPixel(copy));
+
+  // Modifying a unique surface doesn't copy it
+  const auto* ptr = copy.get();
+  ASSERT_TRUE(copy.lock());
+  copy.unlock();
+  ASSERT_EQ(ptr, copy.get());
+}
+
+TEST(SharedSurface, Edit)
+{
+  const cen::shared_surface original{cen::surface{{2, 2}, cen::pixel_format::rgba8888}};
+
+  auto copy = original;
+  auto handle = copy.edit();
+  handle.set_blend_mode(cen::blend_mode::mod);
+
+  ASSERT_EQ(cen::blend_mode::mod, copy.view().get_blend_mode());
+  ASSERT_NE(cen::blend_mode::mod, original.view().get_blend_mode());
+}
+
+TEST(SharedSurface, Assignment)
+{
+  cen::shared_surface first{cen::surface{{2, 2}, cen::pixel_format::rgba8888}};
+  const cen::shared_surface second{cen::surface{{4, 4}, cen::pixel_format::rgba8888}};
+
+  first = second;
+  ASSERT_EQ(second.get(), first.get());
+  ASSERT_EQ(2, second.use_count());
+
+  first = cen::shared_surface{cen::surface{{1, 1}, cen::pixel_format::rgba8888}};
+  ASSERT_TRUE(second.is_unique());
+  ASSERT_TRUE(first.is_unique());
+}
+
+TEST(SharedSurface, ToSurface)
+{
+  const cen::shared_surface shared{cen::surface{{3, 3}, cen::pixel_format::argb8888}};
+
+  const auto copy = shared.to_surface();
+  ASSERT_NE(shared.get(), copy.get());
+  ASSERT_EQ(shared.size(), copy.size());
+  ASSERT_TRUE(shared.is_unique());
+}
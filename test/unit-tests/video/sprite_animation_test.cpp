@@ -0,0 +1,153 @@
+#include "video/sprite_animation.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>  // vector
+
+TEST(SpriteSheet, Grid)
+{
+  const cen::sprite_sheet sheet{cen::iarea{100, 70}, {20, 30}, {2, 4}, {1, 1}};
+  ASSERT_EQ(4, sheet.columns());
+  ASSERT_EQ(2, sheet.rows());
+  ASSERT_EQ(8u, sheet.cell_count());
+  ASSERT_EQ(0u, sheet.animation_count());
+
+  ASSERT_EQ(cen::irect(1, 1, 20, 30), sheet.cell(0));
+  ASSERT_EQ(cen::irect(23, 1, 20, 30), sheet.cell(1));
+  ASSERT_EQ(cen::irect(1, 35, 20, 30), sheet.cell(4));
+  ASSERT_EQ(cen::irect(67, 35, 20, 30), sheet.cell(7));
+}
+
+TEST(SpriteSheet, GridAnimations)
+{
+  cen::sprite_sheet sheet{cen::iarea{64, 64}, {16, 16}};
+
+  const auto idle = sheet.add_animation(2, 4, 0.25f);
+  ASSERT_EQ(0u, idle);
+  ASSERT_EQ(1u, sheet.animation_count());
+  ASSERT_EQ(4u, sheet.frame_count(idle));
+  ASSERT_FLOAT_EQ(1.0f, sheet.duration(idle));
+  ASSERT_TRUE(sheet.is_looping(idle));
+
+  // The frames may span several rows of the grid
+  ASSERT_EQ(sheet.cell(2), sheet.frame_source(idle, 0));
+  ASSERT_EQ(sheet.cell(5), sheet.frame_source(idle, 3));
+
+  ASSERT_EQ(0u, sheet.frame_at(idle, 0.0f));
+  ASSERT_EQ(1u, sheet.frame_at(idle, 0.3f));
+  ASSERT_EQ(3u, sheet.frame_at(idle, 0.99f));
+  ASSERT_EQ(3u, sheet.frame_at(idle, 1.0f));
+}
+
+TEST(SpriteSheet, CustomAnimations)
+{
+  cen::sprite_sheet sheet{cen::iarea{64, 64}, {16, 16}};
+
+  const std::vector<cen::animation_frame> frames{{{{0, 0}, {8, 8}}, 0.1f},
+                                                 {{{8, 0}, {8, 8}}, 0.5f},
+                                                 {{{16, 0}, {8, 8}}, 0.2f}};
+  const auto blink = sheet.add_animation(frames, false);
+
+  ASSERT_EQ(3u, sheet.frame_count(blink));
+  ASSERT_FLOAT_EQ(0.8f, sheet.duration(blink));
+  ASSERT_FALSE(sheet.is_looping(blink));
+  ASSERT_EQ(frames.at(1).source, sheet.frame_source(blink, 1));
+
+  ASSERT_EQ(0u, sheet.frame_at(blink, 0.05f));
+  ASSERT_EQ(1u, sheet.frame_at(blink, 0.1f));
+  ASSERT_EQ(1u, sheet.frame_at(blink, 0.55f));
+  ASSERT_EQ(2u, sheet.frame_at(blink, 0.7f));
+  ASSERT_EQ(2u, sheet.frame_at(blink, 0.8f));
+}
+
+TEST(SpriteAnimator, Defaults)
+{
+  const cen::sprite_sheet sheet{cen::iarea{64, 64}, {16, 16}};
+  const cen::sprite_animator animator{sheet};
+  ASSERT_TRUE(animator.empty());
+  ASSERT_EQ(0u, animator.size());
+}
+
+TEST(SpriteAnimator, Update)
+{
+  cen::sprite_sheet sheet{cen::iarea{64, 64}, {16, 16}};
+  const auto walk = sheet.add_animation(0, 4, 0.1f);
+  const auto death = sheet.add_animation(8, 2, 0.1f, false);
+
+  cen::sprite_animator animator{sheet, 4};
+  const auto a = animator.play(walk);
+  const auto b = animator.play(walk, 2.0f);
+  const auto c = animator.play(death);
+
+  ASSERT_EQ(3u, animator.size());
+  ASSERT_EQ(sheet.cell(0), animator.source(a));
+  ASSERT_EQ(sheet.cell(8), animator.source(c));
+
+  animator.update(0.15f);
+  ASSERT_EQ(1u, animator.frame(a));
+  ASSERT_EQ(3u, animator.frame(b));
+  ASSERT_EQ(1u, animator.frame(c));
+  ASSERT_EQ(sheet.cell(1), animator.sources()[a]);
+  ASSERT_EQ(sheet.cell(3), animator.sources()[b]);
+  ASSERT_FALSE(animator.is_finished(c));
+
+  // Looping animations wrap around, the others stop on their last frame
+  animator.update(0.3f);
+  ASSERT_EQ(0u, animator.frame(a));
+  ASSERT_NEAR(0.05f, animator.time(a), 0.0001f);
+  ASSERT_EQ(1u, animator.frame(c));
+  ASSERT_EQ(sheet.cell(9), animator.source(c));
+  ASSERT_TRUE(animator.is_finished(c));
+}
+
+TEST(SpriteAnimator, SwitchTo)
+{
+  cen::sprite_sheet sheet{cen::iarea{64, 64}, {16, 16}};
+  const auto idle = sheet.add_animation(0, 4, 0.1f);
+  const auto run = sheet.add_animation(4, 4, 0.1f);
+
+  cen::sprite_animator animator{sheet};
+  const auto index = animator.play(idle);
+
+  animator.update(0.25f);
+  ASSERT_EQ(2u, animator.frame(index));
+
+  // Switching to the current animation doesn't restart it
+  animator.switch_to(index, idle);
+  ASSERT_EQ(2u, animator.frame(index));
+
+  animator.switch_to(index, run);
+  ASSERT_EQ(run, animator.animation(index));
+  ASSERT_EQ(0u, animator.frame(index));
+  ASSERT_EQ(sheet.cell(4), animator.source(index));
+
+  animator.set_speed(index, 0);
+  animator.update(1.0f);
+  ASSERT_EQ(0u, animator.frame(index));
+}
+
+TEST(SpriteAnimator, Remove)
+{
+  cen::sprite_sheet sheet{cen::iarea{64, 64}, {16, 16}};
+  const auto first = sheet.add_animation(0, 2, 0.1f);
+  const auto second = sheet.add_animation(2, 2, 0.1f);
+  const auto third = sheet.add_animation(4, 2, 0.1f);
+
+  cen::sprite_animator animator{sheet};
+  animator.play(first);
+  animator.play(second);
+  animator.play(third);
+
+  // The last instance is moved into the removed index
+  animator.remove(0);
+  ASSERT_EQ(2u, animator.size());
+  ASSERT_EQ(third, animator.animation(0));
+  ASSERT_EQ(second, animator.animation(1));
+  ASSERT_EQ(sheet.cell(4), animator.source(0));
+
+  animator.remove(1);
+  ASSERT_EQ(1u, animator.size());
+
+  animator.clear();
+  ASSERT_TRUE(animator.empty());
+}
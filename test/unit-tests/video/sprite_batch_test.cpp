@@ -0,0 +1,144 @@
+#include "video/sprite_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>   // array
+#include <memory>  // unique_ptr
+
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class SpriteBatchTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_texture = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+    m_other = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_other.reset();
+    m_texture.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_texture;
+  inline static std::unique_ptr<cen::texture> m_other;
+};
+
+TEST_F(SpriteBatchTest, Defaults)
+{
+  const cen::sprite_batch batch;
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.size());
+  ASSERT_EQ(0u, batch.run_count());
+  ASSERT_EQ(cen::blend_mode::blend, batch.get_blend_mode());
+}
+
+TEST_F(SpriteBatchTest, Runs)
+{
+  cen::sprite_batch batch{16};
+
+  batch.add(*m_texture, {{0, 0}, {10, 10}}, {{0, 0}, {32, 32}});
+  batch.add(*m_texture, {{10, 10}, {10, 10}}, {{32, 0}, {32, 32}});
+  ASSERT_EQ(2u, batch.size());
+  ASSERT_EQ(1u, batch.run_count());
+
+  batch.add(*m_other, {{0, 0}, {32, 32}});
+  ASSERT_EQ(3u, batch.size());
+  ASSERT_EQ(2u, batch.run_count());
+
+  batch.set_blend_mode(cen::blend_mode::add);
+  batch.add(*m_other, {{32, 32}, {32, 32}}, cen::colors::red);
+  ASSERT_EQ(4u, batch.size());
+  ASSERT_EQ(3u, batch.run_count());
+}
+
+TEST_F(SpriteBatchTest, Submit)
+{
+  cen::sprite_batch batch;
+
+  batch.add(*m_texture, {{0, 0}, {32, 32}});
+  batch.add(*m_other, {{32, 0}, {32, 32}});
+
+  ASSERT_TRUE(batch.submit(*m_renderer));
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.run_count());
+
+  ASSERT_TRUE(batch.submit(*m_renderer));
+}
+
+TEST_F(SpriteBatchTest, Tints)
+{
+  cen::sprite_batch batch;
+
+  m_texture->set_color_mod(cen::colors::white);
+  m_texture->set_alpha(0xFF);
+
+  // Tints are vertex colors, so they don't split runs of the same texture
+  batch.add(*m_texture, {{0, 0}, {32, 32}}, cen::colors::red);
+  batch.add(*m_texture, {{32, 0}, {32, 32}}, cen::colors::blue.with_alpha(0x80));
+  batch.add(*m_texture, {{64, 0}, {32, 32}});
+  ASSERT_EQ(1u, batch.run_count());
+
+  ASSERT_TRUE(batch.submit(*m_renderer));
+  ASSERT_EQ(cen::colors::white, m_texture->color_mod());
+  ASSERT_EQ(0xFF, m_texture->alpha());
+}
+
+TEST_F(SpriteBatchTest, Transforms)
+{
+  cen::sprite_batch batch;
+
+  const cen::frect destination{{0, 0}, {32, 32}};
+  const auto transform = cen::transform2d::rotation(45, destination.center());
+
+  batch.add(*m_texture, destination, transform);
+  batch.add(*m_texture, {{0, 0}, {10, 10}}, destination, transform, cen::colors::red);
+  batch.add(*m_texture, destination);
+  ASSERT_EQ(3u, batch.size());
+  ASSERT_EQ(1u, batch.run_count());
+
+  ASSERT_TRUE(batch.submit(*m_renderer));
+}
+
+TEST_F(SpriteBatchTest, AddRange)
+{
+  cen::sprite_batch batch;
+
+  const std::array<cen::irect, 3> sources{cen::irect{{0, 0}, {10, 10}},
+                                          cen::irect{{10, 0}, {10, 10}},
+                                          cen::irect{{20, 0}, {10, 10}}};
+  const std::array<cen::frect, 3> destinations{cen::frect{{0, 0}, {32, 32}},
+                                               cen::frect{{32, 0}, {32, 32}},
+                                               cen::frect{{64, 0}, {32, 32}}};
+
+  batch.add(*m_texture, sources.data(), destinations.data(), 3);
+  batch.add(*m_texture, sources.data(), destinations.data(), 0);
+  ASSERT_EQ(3u, batch.size());
+  ASSERT_EQ(1u, batch.run_count());
+
+  ASSERT_TRUE(batch.submit(*m_renderer));
+}
+
+TEST_F(SpriteBatchTest, Clear)
+{
+  cen::sprite_batch batch;
+  batch.add(*m_texture, {{0, 0}, {32, 32}});
+
+  batch.clear();
+  ASSERT_TRUE(batch.empty());
+  ASSERT_EQ(0u, batch.run_count());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,113 @@
+#include "video/sprite_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/renderer.hpp"
+#include "video/sprite_batch.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class SpriteQueueTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_texture = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+    m_other = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_other.reset();
+    m_texture.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_texture;
+  inline static std::unique_ptr<cen::texture> m_other;
+};
+
+TEST_F(SpriteQueueTest, Defaults)
+{
+  const cen::sprite_queue queue;
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(0u, queue.size());
+  ASSERT_EQ(0u, queue.texture_count());
+  ASSERT_EQ(cen::blend_mode::blend, queue.get_blend_mode());
+}
+
+TEST_F(SpriteQueueTest, MergesTexturesWithinLayer)
+{
+  cen::sprite_queue queue{16};
+
+  // Alternating textures would produce four runs if batched in submission order
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {0});
+  queue.add(*m_other, {{32, 0}, {32, 32}}, {0});
+  queue.add(*m_texture, {{64, 0}, {32, 32}}, {0});
+  queue.add(*m_other, {{96, 0}, {32, 32}}, {0});
+  ASSERT_EQ(4u, queue.size());
+  ASSERT_EQ(2u, queue.texture_count());
+
+  cen::sprite_batch batch;
+  queue.submit(batch);
+
+  ASSERT_TRUE(queue.empty());
+  ASSERT_EQ(0u, queue.texture_count());
+  ASSERT_EQ(4u, batch.size());
+  ASSERT_EQ(2u, batch.run_count());
+}
+
+TEST_F(SpriteQueueTest, KeepsLayering)
+{
+  cen::sprite_queue queue;
+
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {2});
+  queue.add(*m_other, {{0, 0}, {32, 32}}, {1});
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {2});
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {0});
+
+  // Layer 0 and 2 use the same texture, but must not be merged across layer 1
+  cen::sprite_batch batch;
+  queue.submit(batch);
+  ASSERT_EQ(3u, batch.run_count());
+}
+
+TEST_F(SpriteQueueTest, BlendModes)
+{
+  cen::sprite_queue queue;
+
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {0, 4});
+  queue.set_blend_mode(cen::blend_mode::add);
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {0, 4});
+  queue.set_blend_mode(cen::blend_mode::blend);
+  queue.add(*m_texture, {{0, 0}, {32, 32}}, {0, 4});
+
+  cen::sprite_batch batch;
+  batch.set_blend_mode(cen::blend_mode::mod);
+  queue.submit(batch);
+
+  ASSERT_EQ(2u, batch.run_count());
+  ASSERT_EQ(cen::blend_mode::mod, batch.get_blend_mode());
+}
+
+TEST_F(SpriteQueueTest, SubmitToRenderer)
+{
+  cen::sprite_queue queue;
+
+  queue.add(*m_texture, {{0, 0}, {10, 10}}, {{0, 0}, {32, 32}}, {1, 20});
+  queue.add(*m_other, {{0, 0}, {32, 32}}, cen::transform2d::rotation(1.0f), {1, 10});
+
+  ASSERT_TRUE(queue.submit(*m_renderer));
+  ASSERT_TRUE(queue.empty());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
@@ -0,0 +1,157 @@
+#include "video/streaming_texture_ring.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>  // fill_n
+#include <memory>     // unique_ptr
+#include <type_traits>
+#include <utility>  // move
+#include <vector>   // vector
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::streaming_texture_ring>);
+static_assert(!std::is_copy_constructible_v<cen::streaming_texture_ring>);
+
+using write_guard = cen::streaming_texture_ring::write_guard;
+
+static_assert(!std::is_copy_constructible_v<write_guard>);
+static_assert(std::is_nothrow_move_constructible_v<write_guard>);
+
+class StreamingTextureRingTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(StreamingTextureRingTest, Construction)
+{
+  const cen::streaming_texture_ring ring{*m_renderer,
+                                         cen::pixel_format::rgba8888,
+                                         {64, 32}};
+  ASSERT_EQ(3u, ring.count());
+  ASSERT_EQ((cen::iarea{64, 32}), ring.size());
+  ASSERT_EQ(cen::pixel_format::rgba8888, ring.format());
+  ASSERT_FALSE(ring.has_frame());
+  ASSERT_FALSE(ring.is_writing());
+  ASSERT_TRUE(ring.front().is_streaming());
+
+  // At least two textures are used
+  const cen::streaming_texture_ring single{*m_renderer,
+                                           cen::pixel_format::rgba8888,
+                                           {8, 8},
+                                           1};
+  ASSERT_EQ(2u, single.count());
+}
+
+TEST_F(StreamingTextureRingTest, Write)
+{
+  cen::streaming_texture_ring ring{*m_renderer, cen::pixel_format::rgba8888, {16, 16}};
+
+  const auto* initial = ring.front().get();
+
+  {
+    auto guard = ring.begin_write();
+    ASSERT_TRUE(ring.is_writing());
+    ASSERT_TRUE(guard.data());
+    ASSERT_GE(guard.pitch(), 16 * 4);
+    ASSERT_EQ(16, guard.width());
+    ASSERT_EQ(16, guard.height());
+
+    for (int y = 0; y < guard.height(); ++y)
+    {
+      std::fill_n(guard.row(y), guard.width(), 0xFF0000FFu);
+    }
+
+    // The front texture is not changed until the guard is destroyed
+    ASSERT_EQ(initial, ring.front().get());
+  }
+
+  ASSERT_FALSE(ring.is_writing());
+  ASSERT_TRUE(ring.has_frame());
+  ASSERT_EQ(1u, ring.frame_count());
+  ASSERT_NE(initial, ring.front().get());
+}
+
+TEST_F(StreamingTextureRingTest, Rotation)
+{
+  cen::streaming_texture_ring ring{*m_renderer, cen::pixel_format::rgba8888, {8, 8}, 3};
+
+  const auto* first = ring.front().get();
+  for (int frame = 0; frame < 3; ++frame)
+  {
+    const auto* previous = ring.front().get();
+    {
+      auto guard = ring.begin_write();
+    }
+
+    ASSERT_NE(previous, ring.front().get());
+  }
+
+  // After a full rotation, the first texture is the front texture again
+  ASSERT_EQ(first, ring.front().get());
+  ASSERT_EQ(3u, ring.frame_count());
+}
+
+TEST_F(StreamingTextureRingTest, MovedGuard)
+{
+  cen::streaming_texture_ring ring{*m_renderer, cen::pixel_format::rgba8888, {8, 8}};
+
+  {
+    auto guard = ring.begin_write();
+    auto other = std::move(guard);
+    ASSERT_TRUE(ring.is_writing());
+  }
+
+  // Only the guard that was moved to commits the frame
+  ASSERT_EQ(1u, ring.frame_count());
+}
+
+TEST_F(StreamingTextureRingTest, WriteYUV)
+{
+  cen::streaming_texture_ring ring{*m_renderer, cen::pixel_format::iyuv, {16, 8}};
+
+  const auto* initial = ring.front().get();
+
+  // The chroma planes are subsampled in both directions
+  const std::vector<cen::u8> luma(16 * 8, 0x80);
+  const std::vector<cen::u8> chroma(8 * 4, 0x80);
+  ASSERT_TRUE(ring.write_yuv({luma.data(), 16}, {chroma.data(), 8}, {chroma.data(), 8}));
+
+  ASSERT_TRUE(ring.has_frame());
+  ASSERT_EQ(1u, ring.frame_count());
+  ASSERT_NE(initial, ring.front().get());
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+
+TEST_F(StreamingTextureRingTest, WriteNV)
+{
+  cen::streaming_texture_ring ring{*m_renderer, cen::pixel_format::nv12, {16, 8}};
+
+  const auto* initial = ring.front().get();
+
+  // The chroma plane has interleaved samples, so it is as wide as the luma plane
+  const std::vector<cen::u8> luma(16 * 8, 0x80);
+  const std::vector<cen::u8> chroma(16 * 4, 0x80);
+  ASSERT_TRUE(ring.write_nv({luma.data(), 16}, {chroma.data(), 16}));
+
+  ASSERT_EQ(1u, ring.frame_count());
+  ASSERT_NE(initial, ring.front().get());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
@@ -3,13 +3,16 @@
 #include <SDL_image.h>
 #include <gtest/gtest.h>
 
+#include <cstddef>   // byte
 #include <iostream>  // cout
 #include <memory>    // unique_ptr
 #include <type_traits>
 #include <utility>  // move
+#include <vector>   // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
+#include "filesystem/file.hpp"
 #include "video/colors.hpp"
 #include "video/window.hpp"
 
@@ -51,6 +54,32 @@ TEST_F(SurfaceTest, PathConstructor)
   ASSERT_NO_THROW(cen::surface{m_path});
 }
 
+TEST_F(SurfaceTest, FileConstructor)
+{
+  cen::file file{m_path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  const cen::surface surface{file};
+  ASSERT_EQ(m_surface->size(), surface.size());
+
+  // The file is still owned by the caller
+  ASSERT_TRUE(file);
+}
+
+TEST_F(SurfaceTest, MemoryConstructor)
+{
+  cen::file file{m_path, cen::file_mode::read_existing_binary};
+  ASSERT_TRUE(file);
+
+  std::vector<std::byte> data(file.size().value());
+  ASSERT_EQ(data.size(), file.read_to(data));
+
+  const cen::surface surface{data.data(), data.size()};
+  ASSERT_EQ(m_surface->size(), surface.size());
+
+  ASSERT_THROW(cen::surface(data.data(), 16), cen::img_error);
+}
+
 TEST_F(SurfaceTest, FromSDLSurfaceConstructor)
 {
   ASSERT_NO_THROW(cen::surface(IMG_Load(m_path)));
@@ -234,6 +263,91 @@ TEST_F(SurfaceTest, Convert)
   ASSERT_EQ(source.color_mod(), converted.color_mod());
 }
 
+TEST_F(SurfaceTest, ConvertFast)
+{
+  cen::surface source{{4, 4}, cen::pixel_format::rgba8888};
+  source.set_alpha(0x12);
+  source.set_color_mod(cen::colors::blue);
+  source.set_pixel({1, 2}, cen::colors::dark_orange);
+
+  for (const auto format : {cen::pixel_format::argb8888,
+                            cen::pixel_format::abgr8888,
+                            cen::pixel_format::bgra8888,
+                            cen::pixel_format::rgb888})
+  {
+    ASSERT_TRUE(cen::has_fast_conversion(source.format_info().format(), format));
+
+    const auto converted = source.convert(format);
+    ASSERT_EQ(format, converted.format_info().format());
+    ASSERT_EQ(source.size(), converted.size());
+    ASSERT_EQ(source.alpha(), converted.alpha());
+    ASSERT_EQ(source.color_mod(), converted.color_mod());
+
+    const auto* pixels = static_cast<const cen::u32*>(converted.pixels());
+    const auto pixel = pixels[2 * (converted.pitch() / 4) + 1];
+    ASSERT_EQ(cen::colors::dark_orange, converted.format_info().pixel_to_rgba(pixel));
+  }
+}
+
+TEST_F(SurfaceTest, ConvertInPlace)
+{
+  cen::surface surface{{4, 4}, cen::pixel_format::rgba8888};
+  surface.set_blend_mode(cen::blend_mode::add);
+  surface.set_alpha(0x34);
+  surface.set_pixel({3, 1}, cen::colors::sea_green);
+
+  const auto* before = surface.pixels();
+  ASSERT_TRUE(surface.convert_in_place(cen::pixel_format::bgra8888));
+
+  // The pixel memory is reused by fast conversions
+  ASSERT_EQ(before, surface.pixels());
+  ASSERT_EQ(cen::pixel_format::bgra8888, surface.format_info().format());
+  ASSERT_EQ(cen::blend_mode::add, surface.get_blend_mode());
+  ASSERT_EQ(0x34, surface.alpha());
+
+  const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+  const auto pixel = pixels[1 * (surface.pitch() / 4) + 3];
+  ASSERT_EQ(cen::colors::sea_green, surface.format_info().pixel_to_rgba(pixel));
+
+  // Other conversions allocate a new surface
+  ASSERT_TRUE(surface.convert_in_place(cen::pixel_format::rgb565));
+  ASSERT_EQ(cen::pixel_format::rgb565, surface.format_info().format());
+  ASSERT_EQ(cen::blend_mode::add, surface.get_blend_mode());
+}
+
+TEST_F(SurfaceTest, WithFormat)
+{
+  const auto format = cen::pixel_format::argb8888;
+
+  const auto surface = cen::surface::with_format(m_path, cen::blend_mode::blend, format);
+  ASSERT_EQ(format, surface.format_info().format());
+  ASSERT_EQ(cen::blend_mode::blend, surface.get_blend_mode());
+  ASSERT_EQ(m_surface->size(), surface.size());
+
+  const auto premultiplied =
+      cen::surface::with_format(m_path, cen::blend_mode::blend, format, true);
+  ASSERT_EQ(format, premultiplied.format_info().format());
+}
+
+TEST_F(SurfaceTest, PremultiplyAlpha)
+{
+  cen::surface surface{{2, 2}, cen::pixel_format::rgba8888};
+  surface.set_pixel({0, 0}, cen::color{0xFF, 0x80, 0x00, 0x80});
+
+  ASSERT_TRUE(surface.premultiply_alpha());
+
+  const auto info = surface.format_info();
+  const auto* pixels = static_cast<const cen::u32*>(surface.pixels());
+  ASSERT_EQ((cen::color{0x80, 0x40, 0x00, 0x80}), info.pixel_to_rgba(pixels[0]));
+
+  ASSERT_TRUE(surface.unpremultiply_alpha());
+  ASSERT_EQ((cen::color{0xFF, 0x80, 0x00, 0x80}), info.pixel_to_rgba(pixels[0]));
+
+  cen::surface unsupported{{2, 2}, cen::pixel_format::rgb565};
+  ASSERT_FALSE(unsupported.premultiply_alpha());
+  ASSERT_FALSE(unsupported.unpremultiply_alpha());
+}
+
 TEST_F(SurfaceTest, Get)
 {
   ASSERT_TRUE(m_surface->get());
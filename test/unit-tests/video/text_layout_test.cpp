@@ -0,0 +1,151 @@
+#include "video/text_layout.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>   // unique_ptr
+#include <utility>  // move
+
+#include "core/memory_resource.hpp"
+#include "video/font.hpp"
+#include "video/font_cache.hpp"
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+namespace {
+inline constexpr auto fontPath = "resources/daniel.ttf";
+}
+
+class TextLayoutTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_font = std::make_unique<cen::font>(fontPath, 16);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_font.reset();
+  }
+
+  inline static std::unique_ptr<cen::font> m_font;
+};
+
+TEST_F(TextLayoutTest, Empty)
+{
+  const cen::text_layout layout{*m_font, ""};
+  ASSERT_TRUE(layout.glyphs().empty());
+  ASSERT_TRUE(layout.lines().empty());
+  ASSERT_EQ(0, layout.width());
+  ASSERT_EQ(0, layout.height());
+}
+
+TEST_F(TextLayoutTest, SingleLine)
+{
+  const cen::text_layout layout{*m_font, "Hello"};
+  ASSERT_EQ(5u, layout.glyphs().size());
+  ASSERT_EQ(1u, layout.lines().size());
+  ASSERT_LT(0, layout.width());
+  ASSERT_EQ(m_font->height(), layout.height());
+
+  const auto& glyphs = layout.glyphs();
+  ASSERT_EQ(0, glyphs.front().position.x());
+  ASSERT_LT(glyphs.front().position.x(), glyphs.back().position.x());
+}
+
+TEST_F(TextLayoutTest, Newlines)
+{
+  const cen::text_layout layout{*m_font, "ab\ncd\n"};
+  ASSERT_EQ(4u, layout.glyphs().size());
+  ASSERT_EQ(3u, layout.lines().size());
+  ASSERT_EQ(2 * m_font->line_skip() + m_font->height(), layout.height());
+
+  const auto& c = layout.glyphs().at(2);
+  ASSERT_EQ('c', c.glyph);
+  ASSERT_EQ(0, c.position.x());
+  ASSERT_EQ(m_font->line_skip(), c.position.y());
+}
+
+TEST_F(TextLayoutTest, Wrap)
+{
+  const cen::text_layout unwrapped{*m_font, "foo bar"};
+  const auto foo = cen::text_layout{*m_font, "foo"}.width();
+
+  // Only room for a single word per line
+  const cen::text_layout layout{*m_font, "foo bar", foo + 1};
+  ASSERT_EQ(2u, layout.lines().size());
+  ASSERT_EQ(foo, layout.lines().front().width);
+  ASSERT_GE(foo + 1, layout.width());
+  ASSERT_GT(unwrapped.width(), layout.width());
+
+  const auto& b = layout.glyphs().at(4);
+  ASSERT_EQ('b', b.glyph);
+  ASSERT_EQ(0, b.position.x());
+  ASSERT_EQ(m_font->line_skip(), b.position.y());
+
+  // Words that don't fit are broken between glyphs
+  const cen::text_layout narrow{*m_font, "foo", 1};
+  ASSERT_EQ(3u, narrow.lines().size());
+}
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+TEST_F(TextLayoutTest, MemoryResource)
+{
+  cen::frame_resource arena;
+
+  const cen::text_layout empty{&arena};
+  ASSERT_EQ(&arena, empty.get_resource());
+  ASSERT_TRUE(empty.glyphs().empty());
+
+  cen::text_layout layout{*m_font, "foo bar", 0, &arena};
+  ASSERT_EQ(&arena, layout.get_resource());
+  ASSERT_LT(0u, arena.capacity());
+
+  // The layout is the same as one allocated from the default resource
+  const cen::text_layout expected{*m_font, "foo bar"};
+  ASSERT_EQ(expected.glyphs().size(), layout.glyphs().size());
+  ASSERT_EQ(expected.lines().size(), layout.lines().size());
+  ASSERT_EQ(expected.size(), layout.size());
+
+  const auto copy = layout;
+  ASSERT_EQ(std::pmr::get_default_resource(), copy.get_resource());
+
+  const auto moved = std::move(layout);
+  ASSERT_EQ(&arena, moved.get_resource());
+}
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
+
+TEST_F(TextLayoutTest, Cache)
+{
+  cen::text_layout_cache cache{2};
+  ASSERT_EQ(2u, cache.capacity());
+
+  const auto& first = cache.get(*m_font, "foo");
+  const auto& second = cache.get(*m_font, "foo");
+  ASSERT_EQ(&first, &second);
+  ASSERT_EQ(1u, cache.size());
+
+  (void) cache.get(*m_font, "foo", 10);
+  ASSERT_EQ(2u, cache.size());
+
+  // The cache is cleared when it is full
+  ASSERT_EQ(cen::text_layout(*m_font, "bar").size(), cache.measure(*m_font, "bar"));
+  ASSERT_EQ(1u, cache.size());
+
+  cache.clear();
+  ASSERT_EQ(0u, cache.size());
+}
+
+TEST_F(TextLayoutTest, RenderLayout)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+
+  cen::font_cache fontCache{fontPath, 16};
+  fontCache.add_basic_latin(renderer);
+
+  const cen::text_layout layout{fontCache.get_font(), "foo bar\nbaz", 40};
+  ASSERT_NO_THROW(renderer.render_layout(fontCache, layout, {10, 10}));
+}
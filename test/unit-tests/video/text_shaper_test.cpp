@@ -0,0 +1,110 @@
+#include "video/text_shaper.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/font.hpp"
+#include "video/font_source.hpp"
+#include "video/renderer.hpp"
+#include "video/text_layout.hpp"
+#include "video/window.hpp"
+
+namespace {
+inline constexpr auto fontPath = "resources/fira_code.ttf";
+}
+
+class TextShaperTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_shaper = std::make_unique<cen::text_shaper>(cen::font_source{fontPath}, 16);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_shaper.reset();
+  }
+
+  inline static std::unique_ptr<cen::text_shaper> m_shaper;
+};
+
+TEST_F(TextShaperTest, Construction)
+{
+  const cen::font_source source{fontPath};
+  ASSERT_THROW(cen::text_shaper(source, 0), cen::cen_error);
+
+  const cen::font_source garbage{"garbage", 7};
+  ASSERT_THROW(cen::text_shaper(garbage, 16), cen::cen_error);
+}
+
+TEST_F(TextShaperTest, Metrics)
+{
+  // The shaper sizes fonts like SDL_ttf, the rounding differs between versions though
+  const cen::font font{fontPath, 16};
+  ASSERT_EQ(16, m_shaper->size());
+  ASSERT_NEAR(font.line_skip(), m_shaper->line_skip(), 1);
+  ASSERT_NEAR(font.ascent(), m_shaper->ascent(), 1);
+}
+
+TEST_F(TextShaperTest, Shape)
+{
+  const auto empty = m_shaper->shape("");
+  ASSERT_TRUE(empty.is_shaped());
+  ASSERT_TRUE(empty.glyphs().empty());
+
+  const auto layout = m_shaper->shape("abc\nde");
+  ASSERT_TRUE(layout.is_shaped());
+  ASSERT_EQ(5u, layout.glyphs().size());
+  ASSERT_EQ(2u, layout.lines().size());
+
+  const auto& glyphs = layout.glyphs();
+  ASSERT_EQ(0, glyphs.at(0).position.y());
+  ASSERT_LT(glyphs.at(0).position.x(), glyphs.at(1).position.x());
+  ASSERT_EQ(0, glyphs.at(3).position.x());
+  ASSERT_EQ(m_shaper->line_skip(), glyphs.at(3).position.y());
+
+  const auto& line = layout.lines().at(0);
+  ASSERT_EQ(3u, line.count);
+  ASSERT_GT(line.width, 0);
+
+  // Plain layouts aren't shaped
+  const cen::font font{fontPath, 16};
+  ASSERT_FALSE(cen::text_layout(font, "abc").is_shaped());
+}
+
+TEST_F(TextShaperTest, LayoutCache)
+{
+  cen::text_layout_cache cache;
+
+  const auto& first = cache.get(*m_shaper, "shaped");
+  const auto& second = cache.get(*m_shaper, "shaped");
+  ASSERT_EQ(&first, &second);
+  ASSERT_TRUE(first.is_shaped());
+  ASSERT_EQ(1u, cache.size());
+
+  // Shaped and plain layouts of the same text are separate
+  const cen::font font{fontPath, 16};
+  ASSERT_FALSE(cache.get(font, "shaped").is_shaped());
+  ASSERT_EQ(2u, cache.size());
+}
+
+TEST_F(TextShaperTest, Render)
+{
+  cen::window window;
+  cen::renderer renderer{window};
+
+  cen::text_shaper shaper{cen::font_source{fontPath}, 16};
+  const auto layout = shaper.shape("a == b");
+
+  ASSERT_EQ(0u, shaper.glyph_count());
+  ASSERT_NO_THROW(renderer.render_layout(shaper, layout, {10, 10}));
+
+  shaper.add_glyphs(renderer, layout);
+  ASSERT_GT(shaper.glyph_count(), 0u);
+  ASSERT_EQ(1u, shaper.glyph_page_count());
+  ASSERT_TRUE(shaper.try_at(layout.glyphs().front().glyph));
+
+  ASSERT_NO_THROW(renderer.render_layout(shaper, layout, {10, 10}));
+}
@@ -0,0 +1,103 @@
+#include "video/texture_atlas.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "core/exception.hpp"
+#include "video/renderer.hpp"
+#include "video/surface.hpp"
+#include "video/window.hpp"
+
+class TextureAtlasTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TextureAtlasTest, Defaults)
+{
+  const cen::texture_atlas atlas;
+  ASSERT_EQ(0u, atlas.size());
+  ASSERT_EQ(0u, atlas.page_count());
+  ASSERT_EQ(2048, atlas.page_size().width);
+  ASSERT_EQ(2048, atlas.page_size().height);
+}
+
+TEST_F(TextureAtlasTest, Add)
+{
+  cen::texture_atlas atlas{{64, 64}};
+
+  const cen::surface image{{30, 30}, cen::pixel_format::rgba32};
+  const auto a = atlas.add(image);
+  const auto b = atlas.add(image);
+  const auto c = atlas.add(image);
+  const auto d = atlas.add(image);
+  ASSERT_EQ(1u, atlas.page_count());
+
+  // There is only room for four padded images in each page
+  const auto e = atlas.add(image);
+  ASSERT_EQ(2u, atlas.page_count());
+  ASSERT_EQ(5u, atlas.size());
+
+  ASSERT_THROW((void) atlas.region(a), cen::cen_error);
+  ASSERT_NO_THROW(atlas.build(*m_renderer));
+
+  const auto ra = atlas.region(a);
+  const auto rb = atlas.region(b);
+  ASSERT_EQ(30, ra.source.width());
+  ASSERT_EQ(30, ra.source.height());
+  ASSERT_FALSE(cen::intersects(ra.source, rb.source));
+  ASSERT_EQ(ra.texture.get(), rb.texture.get());
+  ASSERT_EQ(ra.texture.get(), atlas.page(0).get());
+
+  ASSERT_EQ(0u, atlas.region(d).page);
+  ASSERT_EQ(1u, atlas.region(e).page);
+  ASSERT_NE(atlas.region(c).texture.get(), atlas.region(e).texture.get());
+
+  ASSERT_TRUE(m_renderer->render(ra.texture, ra.source, cen::frect{{0, 0}, {30, 30}}));
+  ASSERT_THROW((void) atlas.region(42), cen::cen_error);
+}
+
+TEST_F(TextureAtlasTest, TooLarge)
+{
+  cen::texture_atlas atlas{{16, 16}};
+  const cen::surface image{{20, 20}, cen::pixel_format::rgba32};
+  ASSERT_THROW(atlas.add(image), cen::cen_error);
+}
+
+TEST_F(TextureAtlasTest, IncrementalBuild)
+{
+  cen::texture_atlas atlas{{64, 64}};
+
+  const cen::surface image{{30, 30}, cen::pixel_format::rgba32};
+  const auto a = atlas.add(image);
+  ASSERT_NO_THROW(atlas.build(*m_renderer));
+
+  const auto page = atlas.page(0).get();
+  ASSERT_TRUE(page);
+
+  // The existing page texture is updated instead of being recreated
+  const auto b = atlas.add(image);
+  ASSERT_THROW((void) atlas.region(b), cen::cen_error);
+  ASSERT_NO_THROW(atlas.build(*m_renderer));
+
+  ASSERT_EQ(1u, atlas.page_count());
+  ASSERT_EQ(page, atlas.page(0).get());
+  ASSERT_EQ(page, atlas.region(a).texture.get());
+  ASSERT_EQ(page, atlas.region(b).texture.get());
+  ASSERT_EQ(cen::blend_mode::blend, atlas.page(0).get_blend_mode());
+}
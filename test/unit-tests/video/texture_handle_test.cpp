@@ -46,3 +46,17 @@ TEST_F(TextureHandleTest, FromRawPointer)
   ASSERT_TRUE(good);
   ASSERT_TRUE(good.get());
 }
+
+TEST_F(TextureHandleTest, Attributes)
+{
+  const cen::texture_handle fromTexture{*m_texture};
+  const cen::texture_handle fromPointer{m_texture->get()};
+
+  ASSERT_EQ(m_texture->size(), fromTexture.size());
+  ASSERT_EQ(m_texture->format(), fromTexture.format());
+  ASSERT_EQ(m_texture->access(), fromTexture.access());
+
+  ASSERT_EQ(m_texture->size(), fromPointer.size());
+  ASSERT_EQ(m_texture->format(), fromPointer.format());
+  ASSERT_EQ(m_texture->access(), fromPointer.access());
+}
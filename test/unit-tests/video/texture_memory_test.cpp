@@ -0,0 +1,147 @@
+#include "video/texture_memory.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>  // size_t
+
+#include "video/offscreen_renderer.hpp"
+#include "video/texture.hpp"
+#include "video/texture_pool.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_texture(cen::renderer& renderer,
+                                const cen::texture_access access,
+                                const cen::iarea size) -> cen::texture
+{
+  return cen::texture{renderer, cen::pixel_format::rgba8888, access, size};
+}
+
+}  // namespace
+
+TEST(TextureMemory, TextureBytes)
+{
+  constexpr auto rgba = static_cast<cen::u32>(SDL_PIXELFORMAT_RGBA8888);
+  constexpr auto yv12 = static_cast<cen::u32>(SDL_PIXELFORMAT_YV12);
+
+  ASSERT_EQ(512u, cen::detail::texture_bytes(rgba, 16, 8));
+  ASSERT_EQ(192u, cen::detail::texture_bytes(yv12, 16, 8));
+  ASSERT_EQ(0u, cen::detail::texture_bytes(rgba, 0, 8));
+}
+
+TEST(TextureMemory, Accounting)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  auto& renderer = offscreen.get();
+
+  const auto before = cen::texture_memory::usage();
+  const auto userBefore = cen::texture_memory::usage(cen::texture_category::user);
+
+  {
+    const cen::texture_category_scope scope{cen::texture_category::user};
+    const auto texture = make_texture(renderer, cen::texture_access::no_lock, {16, 8});
+
+    const auto usage = cen::texture_memory::usage();
+    ASSERT_EQ(before.bytes + 512u, usage.bytes);
+    ASSERT_EQ(before.textures + 1u, usage.textures);
+    ASSERT_GE(usage.peak_bytes, usage.bytes);
+
+    const auto user = cen::texture_memory::usage(cen::texture_category::user);
+    ASSERT_EQ(userBefore.bytes + 512u, user.bytes);
+    ASSERT_EQ(userBefore.textures + 1u, user.textures);
+  }
+
+  ASSERT_EQ(before.bytes, cen::texture_memory::usage().bytes);
+  ASSERT_EQ(before.textures, cen::texture_memory::usage().textures);
+
+  cen::texture_memory::reset_peaks();
+
+  const auto user = cen::texture_memory::usage(cen::texture_category::user);
+  ASSERT_EQ(user.bytes, user.peak_bytes);
+}
+
+TEST(TextureMemory, CategoryFromAccess)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  auto& renderer = offscreen.get();
+
+  constexpr auto category = cen::texture_category::targets;
+
+  const auto before = cen::texture_memory::usage(category).bytes;
+  const auto target = make_texture(renderer, cen::texture_access::target, {4, 4});
+
+  ASSERT_EQ(before + 64u, cen::texture_memory::usage(category).bytes);
+}
+
+TEST(TextureMemory, Release)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  auto& renderer = offscreen.get();
+
+  const auto before = cen::texture_memory::usage().bytes;
+
+  auto texture = make_texture(renderer, cen::texture_access::no_lock, {4, 4});
+  auto* ptr = texture.release();
+  ASSERT_EQ(before, cen::texture_memory::usage().bytes);
+
+  // Taking ownership again accounts for the texture once more
+  const cen::texture owner{ptr};
+  ASSERT_EQ(before + 64u, cen::texture_memory::usage().bytes);
+}
+
+TEST(TextureMemory, Budget)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  auto& renderer = offscreen.get();
+
+  int calls = 0;
+  std::size_t reported = 0;
+  cen::texture_memory::set_budget(cen::texture_memory::usage().bytes + 100u,
+                                  [&](const std::size_t used, std::size_t) {
+                                    ++calls;
+                                    reported = used;
+                                  });
+
+  {
+    const auto small = make_texture(renderer, cen::texture_access::no_lock, {4, 4});
+    ASSERT_EQ(0, calls);
+    ASSERT_FALSE(cen::texture_memory::over_budget());
+
+    const auto large = make_texture(renderer, cen::texture_access::no_lock, {16, 16});
+    ASSERT_EQ(1, calls);
+    ASSERT_EQ(cen::texture_memory::usage().bytes, reported);
+    ASSERT_TRUE(cen::texture_memory::over_budget());
+  }
+
+  ASSERT_FALSE(cen::texture_memory::over_budget());
+
+  cen::texture_memory::set_budget(0);
+  ASSERT_EQ(0u, cen::texture_memory::budget());
+}
+
+TEST(TextureMemory, TrimPoolToBudget)
+{
+  cen::offscreen_renderer offscreen{{16, 16}};
+  auto& renderer = offscreen.get();
+
+  cen::texture_pool pool;
+  for (int size = 1; size <= 3; ++size)
+  {
+    const auto lease = pool.acquire(renderer,
+                                    cen::pixel_format::rgba8888,
+                                    cen::texture_access::target,
+                                    {size * 4, size * 4});
+  }
+
+  ASSERT_EQ(3u, pool.idle_count());
+  ASSERT_EQ(64u + 256u + 576u, pool.idle_bytes());
+
+  // Only the oldest idle texture needs to be destroyed to meet the budget
+  cen::texture_memory::set_budget(cen::texture_memory::usage().bytes - 64u);
+  ASSERT_EQ(1u, pool.trim_to_budget());
+  ASSERT_EQ(2u, pool.idle_count());
+  ASSERT_EQ(256u + 576u, pool.idle_bytes());
+
+  ASSERT_EQ(0u, pool.trim_to_budget());
+  cen::texture_memory::set_budget(0);
+}
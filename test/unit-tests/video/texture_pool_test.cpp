@@ -0,0 +1,156 @@
+#include "video/texture_pool.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <type_traits>
+#include <utility>  // move
+
+#include "video/renderer.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::texture_pool>);
+static_assert(!std::is_copy_constructible_v<cen::texture_pool>);
+
+static_assert(!std::is_copy_constructible_v<cen::texture_pool::lease>);
+static_assert(std::is_nothrow_move_constructible_v<cen::texture_pool::lease>);
+static_assert(std::is_nothrow_move_assignable_v<cen::texture_pool::lease>);
+
+class TexturePoolTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  [[nodiscard]] static auto acquire(cen::texture_pool& pool, const cen::iarea size)
+      -> cen::texture_pool::lease
+  {
+    return pool.acquire(*m_renderer,
+                        cen::pixel_format::rgba8888,
+                        cen::texture_access::target,
+                        size);
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+};
+
+TEST_F(TexturePoolTest, Defaults)
+{
+  const cen::texture_pool pool;
+  ASSERT_EQ(0u, pool.idle_count());
+  ASSERT_EQ(0u, pool.leased_count());
+  ASSERT_EQ(0u, pool.created_count());
+  ASSERT_EQ(0u, pool.reused_count());
+}
+
+TEST_F(TexturePoolTest, Acquire)
+{
+  cen::texture_pool pool;
+
+  {
+    const auto lease = acquire(pool, {64, 32});
+    ASSERT_TRUE(lease);
+    ASSERT_EQ(64, lease->width());
+    ASSERT_EQ(32, lease->height());
+    ASSERT_EQ(cen::pixel_format::rgba8888, lease->format());
+    ASSERT_TRUE(lease->is_target());
+
+    ASSERT_EQ(1u, pool.leased_count());
+    ASSERT_EQ(0u, pool.idle_count());
+  }
+
+  ASSERT_EQ(0u, pool.leased_count());
+  ASSERT_EQ(1u, pool.idle_count());
+  ASSERT_EQ(1u, pool.created_count());
+}
+
+TEST_F(TexturePoolTest, Reuse)
+{
+  cen::texture_pool pool;
+
+  const SDL_Texture* ptr{};
+  {
+    auto lease = acquire(pool, {16, 16});
+    lease->set_blend_mode(cen::blend_mode::add);
+    lease->set_alpha(0x10);
+    ptr = lease->get();
+  }
+
+  {
+    const auto lease = acquire(pool, {16, 16});
+    ASSERT_EQ(ptr, lease->get());
+    ASSERT_EQ(1u, pool.reused_count());
+    ASSERT_EQ(1u, pool.created_count());
+
+    // The state of returned textures is reset
+    ASSERT_EQ(cen::blend_mode::none, lease->get_blend_mode());
+    ASSERT_EQ(0xFF, lease->alpha());
+
+    // Textures with other properties are not reused
+    const auto other = acquire(pool, {16, 8});
+    ASSERT_NE(ptr, other->get());
+    ASSERT_EQ(2u, pool.created_count());
+  }
+
+  ASSERT_EQ(2u, pool.idle_count());
+}
+
+TEST_F(TexturePoolTest, Trim)
+{
+  cen::texture_pool pool;
+
+  {
+    const auto a = acquire(pool, {8, 8});
+    const auto b = acquire(pool, {9, 9});
+    const auto c = acquire(pool, {10, 10});
+  }
+
+  ASSERT_EQ(3u, pool.idle_count());
+
+  ASSERT_EQ(1u, pool.trim(2));
+  ASSERT_EQ(2u, pool.idle_count());
+
+  ASSERT_EQ(0u, pool.trim(2));
+
+  ASSERT_EQ(2u, pool.trim());
+  ASSERT_EQ(0u, pool.idle_count());
+}
+
+TEST_F(TexturePoolTest, Release)
+{
+  cen::texture_pool pool;
+
+  auto lease = acquire(pool, {8, 8});
+  const auto texture = lease.release();
+
+  ASSERT_FALSE(lease);
+  ASSERT_TRUE(texture.get());
+  ASSERT_EQ(0u, pool.leased_count());
+  ASSERT_EQ(0u, pool.idle_count());
+}
+
+TEST_F(TexturePoolTest, Move)
+{
+  cen::texture_pool pool;
+
+  auto lease = acquire(pool, {8, 8});
+  auto other = std::move(lease);
+
+  ASSERT_FALSE(lease);
+  ASSERT_TRUE(other);
+  ASSERT_EQ(1u, pool.leased_count());
+
+  other = acquire(pool, {4, 4});  // The previous texture is returned
+  ASSERT_EQ(1u, pool.leased_count());
+  ASSERT_EQ(1u, pool.idle_count());
+}
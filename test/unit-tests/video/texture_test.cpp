@@ -3,9 +3,11 @@
 #include <SDL_image.h>
 #include <gtest/gtest.h>
 
-#include <iostream>  // cout
-#include <memory>    // unique_ptr
+#include <algorithm>  // fill_n
+#include <iostream>   // cout
+#include <memory>     // unique_ptr
 #include <type_traits>
+#include <vector>     // vector
 
 #include "core/exception.hpp"
 #include "core/log.hpp"
@@ -118,6 +120,77 @@ TEST_F(TextureTest, SetPixel)
   ASSERT_NO_THROW(texture.set_pixel({45, 23}, color));
 }
 
+TEST_F(TextureTest, Update)
+{
+  constexpr auto format = cen::pixel_format::rgba8888;
+  constexpr cen::iarea size{16, 8};
+
+  cen::texture texture{*m_renderer, format, cen::texture_access::no_lock, size};
+
+  // Rows that are wider than the texture, to make sure the pitch is honored
+  std::vector<cen::u32> pixels(static_cast<std::size_t>(32 * size.height), 0xFF0000FF);
+  ASSERT_TRUE(texture.update(pixels.data(), 32 * 4));
+  ASSERT_TRUE(texture.update(cen::irect{2, 2, 4, 4}, pixels.data(), 32 * 4));
+
+  const cen::surface surface{{8, 4}, format};
+  ASSERT_TRUE(texture.update(surface));
+  ASSERT_TRUE(texture.update(surface, {8, 4}));
+}
+
+TEST_F(TextureTest, UpdateYUV)
+{
+  constexpr cen::iarea size{16, 8};
+  cen::texture texture{*m_renderer,
+                       cen::pixel_format::iyuv,
+                       cen::texture_access::streaming,
+                       size};
+
+  const std::vector<cen::u8> luma(16 * 8, 0x10);
+  const std::vector<cen::u8> chroma(8 * 4, 0x80);
+
+  const cen::yuv_plane y{luma.data(), 16};
+  const cen::yuv_plane uv{chroma.data(), 8};
+  ASSERT_TRUE(texture.update_yuv(y, uv, uv));
+  ASSERT_TRUE(texture.update_yuv(cen::irect{0, 0, 8, 4}, y, uv, uv));
+
+#if SDL_VERSION_ATLEAST(2, 0, 16)
+  cen::texture nv{*m_renderer,
+                  cen::pixel_format::nv12,
+                  cen::texture_access::streaming,
+                  size};
+
+  const std::vector<cen::u8> interleaved(16 * 4, 0x80);
+  ASSERT_TRUE(nv.update_nv(y, {interleaved.data(), 16}));
+#endif  // SDL_VERSION_ATLEAST(2, 0, 16)
+}
+
+TEST_F(TextureTest, WritePixels)
+{
+  constexpr auto format = cen::pixel_format::rgba8888;
+  constexpr cen::iarea size{16, 8};
+
+  cen::texture texture{*m_renderer, format, cen::texture_access::streaming, size};
+
+  int rows = 0;
+  ASSERT_TRUE(texture.write_pixels([&](void* pixels, const int pitch) {
+    ASSERT_TRUE(pixels);
+    ASSERT_LE(size.width * 4, pitch);
+
+    auto* bytes = static_cast<cen::u8*>(pixels);
+    for (int y = 0; y < size.height; ++y, ++rows)
+    {
+      std::fill_n(reinterpret_cast<cen::u32*>(bytes + y * pitch), size.width, 0xFFu);
+    }
+  }));
+  ASSERT_EQ(size.height, rows);
+
+  ASSERT_TRUE(texture.write_pixels(cen::irect{4, 4, 2, 2}, [](void*, int) {}));
+
+  // Textures without streaming access cannot be locked
+  cen::texture other{*m_renderer, format, cen::texture_access::no_lock, size};
+  ASSERT_FALSE(other.write_pixels([](void*, int) {}));
+}
+
 TEST_F(TextureTest, SetBlendMode)
 {
   const auto previous = m_texture->get_blend_mode();
@@ -0,0 +1,137 @@
+#include "video/tilemap_renderer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+#include <type_traits>
+
+#include "core/exception.hpp"
+#include "video/window.hpp"
+
+static_assert(std::is_final_v<cen::tilemap_renderer>);
+
+class TilemapRendererTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_tileset = std::make_unique<cen::texture>(*m_renderer,
+                                               cen::pixel_format::rgba8888,
+                                               cen::texture_access::no_lock,
+                                               cen::iarea{64, 16});
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_tileset.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_tileset;
+};
+
+TEST_F(TilemapRendererTest, Construction)
+{
+  const cen::tilemap_renderer map{*m_tileset, {16, 16}, {100, 40}, 16};
+  ASSERT_EQ((cen::iarea{100, 40}), map.size());
+  ASSERT_EQ((cen::iarea{16, 16}), map.tile_size());
+  ASSERT_EQ(16, map.chunk_size());
+  ASSERT_EQ(7u * 3u, map.chunk_count());
+  ASSERT_EQ(0u, map.cached_chunks());
+
+  using map_t = cen::tilemap_renderer;
+  ASSERT_THROW(map_t(*m_tileset, {0, 16}, {10, 10}), cen::cen_error);
+  ASSERT_THROW(map_t(*m_tileset, {16, 16}, {10, 0}), cen::cen_error);
+  ASSERT_THROW(map_t(*m_tileset, {16, 16}, {10, 10}, 0), cen::cen_error);
+  ASSERT_THROW(map_t(*m_tileset, {128, 16}, {10, 10}), cen::cen_error);
+}
+
+TEST_F(TilemapRendererTest, Tiles)
+{
+  cen::tilemap_renderer map{*m_tileset, {16, 16}, {20, 20}};
+  ASSERT_EQ(cen::tilemap_renderer::empty_tile, map.tile({3, 4}));
+
+  map.set_tile({3, 4}, 2);
+  ASSERT_EQ(2u, map.tile({3, 4}));
+}
+
+TEST_F(TilemapRendererTest, VisibleChunks)
+{
+  cen::texture_pool pool;
+  cen::tilemap_renderer map{*m_tileset, {16, 16}, {64, 64}, 8};
+  map.set_tile({0, 0}, 1);
+
+  // Chunks are 128 pixels wide, so this viewport touches 2x2 chunks
+  const cen::frect viewport{100, 100, 100, 100};
+  map.render(*m_renderer, pool, viewport);
+  ASSERT_EQ(4u, map.drawn_chunks());
+  ASSERT_EQ(4u, map.baked_chunks());
+  ASSERT_EQ(4u, map.cached_chunks());
+
+  // Clean chunks aren't baked again
+  map.render(*m_renderer, pool, viewport);
+  ASSERT_EQ(4u, map.drawn_chunks());
+  ASSERT_EQ(0u, map.baked_chunks());
+
+  // Only the chunk of the changed tile is baked
+  map.set_tile({9, 9}, 3);
+  map.render(*m_renderer, pool, viewport);
+  ASSERT_EQ(1u, map.baked_chunks());
+
+  // Setting a tile to its current value doesn't dirty the chunk
+  map.set_tile({9, 9}, 3);
+  map.render(*m_renderer, pool, viewport);
+  ASSERT_EQ(0u, map.baked_chunks());
+
+  map.invalidate();
+  map.render(*m_renderer, pool, viewport);
+  ASSERT_EQ(4u, map.baked_chunks());
+}
+
+TEST_F(TilemapRendererTest, OutsideMap)
+{
+  cen::texture_pool pool;
+  cen::tilemap_renderer map{*m_tileset, {16, 16}, {16, 16}};
+
+  map.render(*m_renderer, pool, cen::frect{-500, -500, 100, 100});
+  ASSERT_EQ(0u, map.drawn_chunks());
+
+  map.render(*m_renderer, pool, cen::frect{300, 0, 100, 100});
+  ASSERT_EQ(0u, map.drawn_chunks());
+}
+
+TEST_F(TilemapRendererTest, ReleaseHidden)
+{
+  cen::texture_pool pool;
+  cen::tilemap_renderer map{*m_tileset, {16, 16}, {64, 16}, 16};
+
+  map.render(*m_renderer, pool, cen::frect{0, 0, 512, 256});
+  ASSERT_EQ(2u, map.cached_chunks());
+
+  map.render(*m_renderer, pool, cen::frect{300, 0, 100, 100});
+  ASSERT_EQ(1u, map.drawn_chunks());
+
+  ASSERT_EQ(1u, map.release_hidden());
+  ASSERT_EQ(1u, map.cached_chunks());
+  ASSERT_EQ(1u, pool.idle_count());
+}
+
+TEST_F(TilemapRendererTest, TranslationViewport)
+{
+  cen::texture_pool pool;
+  cen::tilemap_renderer map{*m_tileset, {16, 16}, {64, 64}, 8};
+
+  m_renderer->set_translation_viewport({0, 0, 100, 100});
+  map.render(*m_renderer, pool);
+  ASSERT_EQ(1u, map.drawn_chunks());
+
+  // The render target is restored after baking
+  ASSERT_EQ(nullptr, SDL_GetRenderTarget(m_renderer->get()));
+
+  m_renderer->set_translation_viewport({});
+}
@@ -0,0 +1,89 @@
+#include "video/ui_batch.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>  // unique_ptr
+
+#include "video/colors.hpp"
+#include "video/renderer.hpp"
+#include "video/texture.hpp"
+#include "video/window.hpp"
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+
+class UIBatchTest : public testing::Test
+{
+ protected:
+  static void SetUpTestSuite()
+  {
+    m_window = std::make_unique<cen::window>();
+    m_renderer = std::make_unique<cen::renderer>(*m_window);
+    m_atlas = std::make_unique<cen::texture>(*m_renderer, "resources/panda.png");
+  }
+
+  static void TearDownTestSuite()
+  {
+    m_atlas.reset();
+    m_renderer.reset();
+    m_window.reset();
+  }
+
+  inline static std::unique_ptr<cen::window> m_window;
+  inline static std::unique_ptr<cen::renderer> m_renderer;
+  inline static std::unique_ptr<cen::texture> m_atlas;
+};
+
+TEST_F(UIBatchTest, Panel)
+{
+  cen::ui_batch ui{*m_atlas, {{0, 0}, {4, 4}}};
+
+  const cen::nine_slice slice{{{0, 0}, {48, 48}}, 16, 16, 16, 16};
+  ui.add_panel(slice, {{10, 10}, {200, 100}});
+  ASSERT_EQ(9u, ui.size());
+  ASSERT_EQ(1u, ui.run_count());
+
+  // Slices without borders only have a center
+  ui.add_panel({{{0, 0}, {48, 48}}}, {{10, 10}, {200, 100}});
+  ASSERT_EQ(10u, ui.size());
+
+  // Panels smaller than their borders shrink the borders, and lose the center
+  ui.add_panel(slice, {{0, 0}, {20, 20}});
+  ASSERT_EQ(14u, ui.size());
+}
+
+TEST_F(UIBatchTest, Primitives)
+{
+  cen::ui_batch ui{*m_atlas, {{0, 0}, {4, 4}}};
+
+  ui.fill_rect({{0, 0}, {100, 20}}, cen::colors::navy);
+  ui.fill_gradient({{0, 20}, {100, 20}}, cen::colors::navy, cen::colors::royal_blue);
+  ui.fill_gradient({{0, 40}, {100, 20}},
+                   {cen::colors::red, cen::colors::green, cen::colors::blue, {}});
+  ui.add_image({{8, 8}, {16, 16}}, {{0, 60}, {16, 16}});
+  ASSERT_EQ(4u, ui.size());
+
+  ui.draw_border({{0, 0}, {100, 100}}, 2, cen::colors::gold);
+  ASSERT_EQ(8u, ui.size());
+
+  // Borders that fill the entire rectangle only consist of two quads
+  ui.draw_border({{0, 0}, {10, 10}}, 8, cen::colors::gold);
+  ASSERT_EQ(10u, ui.size());
+
+  ASSERT_EQ(1u, ui.run_count());
+
+  ui.clear();
+  ASSERT_EQ(0u, ui.size());
+}
+
+TEST_F(UIBatchTest, Submit)
+{
+  cen::ui_batch ui{*m_atlas, {{0, 0}, {4, 4}}};
+
+  ui.add_panel({{{0, 0}, {48, 48}}, 8, 8, 8, 8}, {{10, 10}, {200, 100}});
+  ui.draw_border({{10, 10}, {200, 100}}, 1, cen::colors::white);
+
+  ASSERT_TRUE(ui.submit(*m_renderer));
+  ASSERT_EQ(0u, ui.size());
+}
+
+#endif  // SDL_VERSION_ATLEAST(2, 0, 18)
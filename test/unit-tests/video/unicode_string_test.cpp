@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <cereal/types/vector.hpp>
+#include <utility>  // move
 
 #include "serialization_utils.hpp"
 
@@ -241,3 +242,92 @@ TEST(UnicodeString, Serialize)
   const auto other = serialize_create<cen::unicode_string>("unicode_string.binary");
   ASSERT_EQ(string, other);
 }
+
+TEST(UnicodeString, SmallStringsUseInlineBuffer)
+{
+  cen::unicode_string str;
+  ASSERT_TRUE(str.is_small());
+  ASSERT_EQ(cen::unicode_string::small_capacity, str.capacity());
+
+  for (cen::unicode_string::size_type index = 0;
+       index < cen::unicode_string::small_capacity - 1;
+       ++index)
+  {
+    str += 'a'_uni;
+  }
+
+  ASSERT_TRUE(str.is_small());
+
+  str += 'b'_uni;
+  ASSERT_FALSE(str.is_small());
+  ASSERT_EQ(cen::unicode_string::small_capacity, str.size());
+  ASSERT_EQ('b'_uni, str.at(str.size() - 1));
+  ASSERT_EQ(0, str.at(str.size()));  // null-terminator
+}
+
+TEST(UnicodeString, CopyAndMove)
+{
+  const cen::unicode_string small = {'a', 'b'};
+  const cen::unicode_string large = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j'};
+
+  for (const auto& original : {small, large})
+  {
+    auto copy = original;
+    ASSERT_EQ(original, copy);
+
+    const auto* data = copy.data();
+    const auto wasSmall = copy.is_small();
+
+    auto moved = std::move(copy);
+    ASSERT_EQ(original, moved);
+    ASSERT_EQ(!wasSmall, moved.data() == data);
+
+    copy = moved;
+    ASSERT_EQ(original, copy);
+
+    moved = small;
+    ASSERT_EQ(small, moved);
+  }
+}
+
+TEST(UnicodeString, FromUtf8)
+{
+  const auto ascii = cen::unicode_string::from_utf8("Hello, world! This is a test.");
+  ASSERT_EQ(29u, ascii.size());
+  ASSERT_EQ('H'_uni, ascii.at(0));
+  ASSERT_EQ('.'_uni, ascii.at(28));
+  ASSERT_EQ(0, ascii.at(29));  // null-terminator
+
+  const auto str = cen::unicode_string::from_utf8("\xC3\xA5\xC3\xA4\xC3\xB6!");
+  ASSERT_EQ(cen::unicode_string({0xE5, 0xE4, 0xF6, '!'}), str);
+
+  ASSERT_TRUE(cen::unicode_string::from_utf8("").empty());
+}
+
+#ifdef CENTURION_HAS_STD_MEMORY_RESOURCE
+
+TEST(UnicodeString, MemoryResource)
+{
+  std::pmr::monotonic_buffer_resource resource;
+
+  cen::unicode_string str{&resource};
+  ASSERT_EQ(&resource, str.get_resource());
+
+  str = cen::unicode_string::from_utf8("A string that doesn't fit in the inline buffer");
+  ASSERT_FALSE(str.is_small());
+  ASSERT_EQ(&resource, str.get_resource());
+
+  const auto copy = str;
+  ASSERT_EQ(str, copy);
+  ASSERT_EQ(std::pmr::get_default_resource(), copy.get_resource());
+
+  const auto moved = std::move(str);
+  ASSERT_EQ(copy, moved);
+  ASSERT_EQ(&resource, moved.get_resource());
+
+  const auto decoded = cen::unicode_string::from_utf8("abc", &resource);
+  ASSERT_EQ(&resource, decoded.get_resource());
+  ASSERT_EQ(cen::unicode_string({'a', 'b', 'c'}), decoded);
+}
+
+#endif  // CENTURION_HAS_STD_MEMORY_RESOURCE
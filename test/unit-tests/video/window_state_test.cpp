@@ -0,0 +1,82 @@
+#include "video/window_state.hpp"
+
+#include <gtest/gtest.h>
+
+#include "events/event_dispatcher.hpp"
+
+namespace {
+
+[[nodiscard]] auto make_event(const cen::window& window,
+                              const SDL_WindowEventID id,
+                              const int data1,
+                              const int data2) -> SDL_Event
+{
+  SDL_Event event{};
+  event.type = SDL_WINDOWEVENT;
+  event.window.windowID = window.id();
+  event.window.event = static_cast<cen::u8>(id);
+  event.window.data1 = data1;
+  event.window.data2 = data2;
+  return event;
+}
+
+}  // namespace
+
+TEST(WindowState, Construction)
+{
+  cen::window window;
+  const cen::window_state state{window};
+
+  ASSERT_EQ(window.id(), state.id());
+  ASSERT_EQ(window.size(), state.size());
+  ASSERT_EQ(window.width(), state.width());
+  ASSERT_EQ(window.height(), state.height());
+  ASSERT_EQ(window.position(), state.position());
+  ASSERT_EQ(window.flags(), state.flags());
+  ASSERT_EQ(window.is_visible(), state.is_visible());
+  ASSERT_EQ(window.is_resizable(), state.is_resizable());
+}
+
+TEST(WindowState, Handle)
+{
+  cen::window window;
+  cen::window_state state{window};
+
+  const auto moved = make_event(window, SDL_WINDOWEVENT_MOVED, 12, 34);
+  state.handle(cen::window_event{moved.window});
+  ASSERT_EQ(cen::ipoint(12, 34), state.position());
+
+  const auto resized = make_event(window, SDL_WINDOWEVENT_SIZE_CHANGED, 56, 78);
+  state.handle(cen::window_event{resized.window});
+  ASSERT_EQ(56, state.width());
+  ASSERT_EQ(78, state.height());
+
+  {  // Events for other windows are ignored
+    auto event = make_event(window, SDL_WINDOWEVENT_MOVED, 1, 2);
+    ++event.window.windowID;
+
+    state.handle(cen::window_event{event.window});
+    ASSERT_EQ(cen::ipoint(12, 34), state.position());
+  }
+
+  state.refresh();
+  ASSERT_EQ(window.size(), state.size());
+  ASSERT_EQ(window.position(), state.position());
+}
+
+TEST(WindowState, Connect)
+{
+  cen::window window;
+  cen::window_state state{window};
+
+  cen::event_dispatcher<cen::window_event> dispatcher;
+  state.connect(dispatcher);
+
+  int count{};
+  dispatcher.bind<cen::window_event>().to([&](const cen::window_event&) { ++count; });
+
+  ASSERT_TRUE(dispatcher.dispatch(make_event(window, SDL_WINDOWEVENT_RESIZED, 90, 120)));
+  ASSERT_EQ(1, count);
+  ASSERT_EQ(90, state.width());
+  ASSERT_EQ(120, state.height());
+}